@@ -52,4 +52,4 @@ if __name__ == '__main__':
 
     R = fut.octavicRanges(.125, 16, 6)
     C = fut.chebcoeffs(R, Nout, hp.erfcx, final)
-    fut.print_powerseries_code(R, C, Nout)
+    fut.print_powerseries_code(R, C, Nout, "CerfErfcxCoeffs")
@@ -51,4 +51,4 @@ if __name__ == '__main__':
     Nout = 8
     R = fut.octavicRanges(.5, 12., 6)
     C = fut.chebcoeffs(R, Nout, hp.imwx, final)
-    fut.print_powerseries_code(R, C, Nout)
+    fut.print_powerseries_code(R, C, Nout, "CerfImwxCoeffs")
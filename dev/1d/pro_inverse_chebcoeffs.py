@@ -0,0 +1,91 @@
+#!/bin/env python
+
+# File pro_inverse_chebcoeffs.py:
+#   Compute Chebyshev coefficients for starting values of erfcx_inv, erfc_inv, erf_inv,
+#   and write tables for use in inverse.c.
+#
+# Copyright:
+#   (C) 2026 Forschungszentrum Jülich GmbH
+#
+# Licence:
+#   Permission is hereby granted, free of charge, to any person obtaining
+#   a copy of this software and associated documentation files (the
+#   "Software"), to deal in the Software without restriction, including
+#   without limitation the rights to use, copy, modify, merge, publish,
+#   distribute, sublicense, and/or sell copies of the Software, and to
+#   permit persons to whom the Software is furnished to do so, subject to
+#   the following conditions:
+#
+#   The above copyright notice and this permission notice shall be
+#   included in all copies or substantial portions of the Software.
+#
+#   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+#   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+#   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+#   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+#   LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+#   OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+#   WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#
+# Website:
+#   http://apps.jcns.fz-juelich.de/libcerf
+#
+# Revision history:
+#   2026, initial version.
+
+# The interpolants need not be accurate to machine precision, because in inverse.c
+# they only provide starting values for one Halley step, which cubes the relative error.
+
+from mpmath import *
+import sys
+sys.path.insert(0, '../shared')
+import functool as fut
+import hp_funcs as hp
+
+mp.dps = 48
+mp.pretty = True
+
+Nout = 7 # polynomial order; 8 coefficients fill one cache line
+limit = 2**-26
+
+def erfcx_inv_scaled(y, doublecheck=False):
+    """ Returns x/(1-y), where erfcx(x) = y. Scaled so that there is no zero crossing. """
+    if y == 1:
+        return sqrt(pi)/2
+    ly = log(y)
+    f = lambda x: log(hp.erfcx(x)) - ly
+    x0 = findroot(f, (-40, 1e4), solver='illinois', verify=False)
+    return findroot(f, x0) / (1-y)
+
+def erfc_inv_of_s(s, doublecheck=False):
+    """ Returns x such that erfc(x) = exp(-s^2). """
+    f = lambda x: log(erfc(x)) + s**2
+    x0 = findroot(f, (0, 40), solver='illinois', verify=False)
+    return findroot(f, x0)
+
+def erf_inv_of_w(w, doublecheck=False):
+    """ Returns erf_inv(sqrt(w))/sqrt(w), an even function of erf_inv's argument. """
+    if w == 0:
+        return sqrt(pi)/2
+    return erfinv(sqrt(w))/sqrt(w)
+
+if __name__ == '__main__':
+
+    fut.print_begin_autogenerated()
+
+    # erfcx_inv(y)/(1-y) for y in 2^-8..2^20, four subranges per octave
+    R = fut.octavicRanges(2**-8, 2**20, 2)
+    C = fut.chebcoeffs(R, Nout, erfcx_inv_scaled, False, limit)
+    fut.print_powerseries_table("ErfcxInvCoeffs", R, C, Nout)
+
+    # erfc_inv(y) for y = exp(-s^2) with s in 0.5..32, two subranges per octave
+    R = fut.octavicRanges(.5, 32, 1)
+    C = fut.chebcoeffs(R, Nout, erfc_inv_of_s, False, limit)
+    fut.print_powerseries_table("ErfcInvCoeffs", R, C, Nout)
+
+    # erf_inv(z)/z as function of w = z^2 in 0..1/4, one range
+    R = [(0, .25, 0, 0)]
+    C = fut.chebcoeffs(R, Nout, erf_inv_of_w, False, limit)
+    fut.print_powerseries_table("ErfInvCoeffs", R, C, Nout)
+
+    fut.print_end_autogenerated()
@@ -0,0 +1,96 @@
+#!/bin/env python
+
+# File pro_uniform_chebcoeffs.py:
+#   Compute Chebyshev coefficients for erfcx(x) or Im w(x) over the entire positive real axis,
+#   and write tables for the uniform table path in cerf_inline.h.
+#
+# Copyright:
+#   (C) 2026 Forschungszentrum Jülich GmbH
+#
+# Licence:
+#   Permission is hereby granted, free of charge, to any person obtaining
+#   a copy of this software and associated documentation files (the
+#   "Software"), to deal in the Software without restriction, including
+#   without limitation the rights to use, copy, modify, merge, publish,
+#   distribute, sublicense, and/or sell copies of the Software, and to
+#   permit persons to whom the Software is furnished to do so, subject to
+#   the following conditions:
+#
+#   The above copyright notice and this permission notice shall be
+#   included in all copies or substantial portions of the Software.
+#
+#   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+#   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+#   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+#   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+#   LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+#   OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+#   WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#
+# Usage:
+#   pro_uniform_chebcoeffs.py erfcx|imwx
+#
+# Each octave from 2^(j-1) to 2^j is divided into as few subranges as possible, but at most 64.
+# Depending on the octave, the tabulated function is f(x), f(x)/x, or f(x)*x,
+# so that the interpolants are nearly constant in the lowest and highest octave,
+# and can be used for all arguments below and above.
+
+from mpmath import *
+import sys
+sys.path.insert(0, '../shared')
+import functool as fut
+import hp_funcs as hp
+
+mp.dps = 48
+mp.pretty = True
+
+final = False # Extra checks, to be turned on in final production run
+
+# Per function: hp function, number of coefficients, first and last octave,
+# first octave of direct tabulation, first octave of tabulating f(x)*x, table name.
+Setup = {
+    'erfcx': (hp.erfcx, 10, -55, 27, -55, 5, "CerfErfcxUniform"),
+    'imwx':  (hp.imwx,   9, -28, 28,   0, 5, "CerfImwxUniform"),
+}
+
+def scaled(f, jdir, jdiv, j):
+    if j < jdir:
+        return lambda x, dc=False: f(x, dc) / x
+    if j < jdiv:
+        return f
+    return lambda x, dc=False: f(x, dc) * x
+
+def octave_coeffs(g, Nout, j):
+    """
+    Returns ranges and coefficients for the octave from 2^(j-1) to 2^j,
+    using the smallest number of subranges that achieves double precision.
+    """
+    for n2e in range(7):
+        R = fut.octavicRanges(mpf(2)**(j-1), mpf(2)**j, n2e)
+        try:
+            return R, fut.chebcoeffs(R, Nout, g, final)
+        except Exception:
+            mp.dps = 48 # check_cheb_interpolant does not restore precision when it fails
+    raise Exception("octave %i: 64 subranges are not enough" % j)
+
+if __name__ == '__main__':
+
+    f, N1, jlo, jhi, jdir, jdiv, name = Setup[sys.argv[1]]
+
+    RR = []
+    CC = []
+    O = []
+    for j in range(jlo, jhi+1):
+        R, C = octave_coeffs(scaled(f, jdir, jdiv, j), N1-1, j)
+        O.append((len(RR), len(R), j))
+        RR += [(asu, bsu, j, js) for (asu, bsu, ir, js) in R]
+        CC += C
+
+    fut.print_begin_autogenerated()
+    print("static CERF_INLINE_CONST int %sOctaves[%i * 2] = {" % (name, len(O)))
+    for first, n, j in O:
+        print("    %4i, %2i, // octave %i (%g..%g)" % (first, n, j, 2.**(j-1), 2.**j))
+    print("};")
+    fut.print_powerseries_table(name + "Coeffs", RR, CC, N1-1,
+                                "alignas(64) static CERF_INLINE_CONST double")
+    fut.print_end_autogenerated()
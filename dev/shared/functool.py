@@ -204,9 +204,9 @@ def chebcoeffs(R, Nout, hp_f, doublecheck, limit=2**-52):
             for j in range(1,N):
                 sum += yy[j] * chebyt(n, xx[j])
             if n==0 or n==N:
-                sum *= 1./N
+                sum *= mpf(1)/N
             else:
-                sum *= 2./N
+                sum *= mpf(2)/N
 
             Cs[n] = sum
 
@@ -255,9 +255,10 @@ def print_clenshaw_code(R, C, Nout):
     print("};")
     print_end_autogenerated()
 
-def print_powerseries_code(R, C, Nout):
+def print_powerseries_code(R, C, Nout, name="ChebCoeffs"):
     """
     Prints C code that initializes lookup table for Chebyshev polynomials as power series in r.
+    The two tables are called name0 and name1.
     """
     nRge = len(R)
     assert(len(C) == nRge)
@@ -266,7 +267,7 @@ def print_powerseries_code(R, C, Nout):
     print_begin_autogenerated()
     koffset = 0
     if Nout + 1 == 9:
-        print("alignas(64) static const double ChebCoeffs0[%i] = {" % (nRge))
+        print("alignas(64) static CERF_INLINE_CONST double %s0[%i] = {" % (name, nRge))
         print("   ", end="")
         for irge in range(nRge):
             asu, bsu, ir, js = R[irge]
@@ -275,7 +276,7 @@ def print_powerseries_code(R, C, Nout):
         print("};")
         koffset = 1
     elif Nout + 1 == 10:
-        print("alignas(64) static const double ChebCoeffs0[%i * 2] = {" % (nRge))
+        print("alignas(64) static CERF_INLINE_CONST double %s0[%i * 2] = {" % (name, nRge))
         print("   ", end="")
         for irge in range(nRge):
             asu, bsu, ir, js = R[irge]
@@ -284,7 +285,7 @@ def print_powerseries_code(R, C, Nout):
         print("};")
         koffset = 2
 
-    print("alignas(64) static const double ChebCoeffs1[%i * 8] = {" % (nRge))
+    print("alignas(64) static CERF_INLINE_CONST double %s1[%i * 8] = {" % (name, nRge))
     for irge in range(nRge):
         Ps = P[irge]
         for p in Ps[koffset:Nout+1]:
@@ -293,3 +294,20 @@ def print_powerseries_code(R, C, Nout):
         print(" // x in subrange %i:%i (%g..%g)" % (ir, js, asu, bsu))
     print("};")
     print_end_autogenerated()
+
+def print_powerseries_table(name, R, C, Nout, decl="alignas(64) static const double"):
+    """
+    Prints C code that initializes one lookup table for Chebyshev polynomials as power series,
+    with Nout+1 coefficients per subrange, in increasing order.
+    """
+    nRge = len(R)
+    assert(len(C) == nRge)
+    P = [polynomial_coeffs(Cs) for Cs in C]
+
+    print("%s %s[%i * %i] = {" % (decl, name, nRge, Nout+1))
+    for irge in range(nRge):
+        for p in P[irge]:
+            print(" %s," % double2hexstring(p), end="")
+        asu, bsu, ir, js = R[irge]
+        print(" // subrange %i:%i (%g..%g)" % (ir, js, asu, bsu))
+    print("};")
@@ -86,12 +86,12 @@ def wofz(z, doublecheck=False):
                     (z.real, z.imag, r1.real, r1.imag,
                      (r2-r1).real, (r2-r1).imag, (r3-r1).real, (r3-r1).imag))
 
-def wofz_taylor(z, N):
+def wofz_taylor(z, N, doublecheck=True):
     """
     Taylor coefficients of w(z), forward computed.
     """
     W = []
-    W.append(wofz(z, True))
+    W.append(wofz(z, doublecheck))
     W.append(-2*z*W[0] + mpc(0,2)/sqrt(pi))
     for k in range(2,N):
         W.append(-2*(z*W[k-1]+(k-1)*W[k-2]))
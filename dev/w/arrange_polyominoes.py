@@ -13,7 +13,6 @@ from math import sqrt
 import hp_funcs as hp
 import functool as fut
 import enumerate_polyominoes as ep
-import datetime
 
 mp.dps = 48
 mp.pretty = True
@@ -249,38 +248,33 @@ if __name__ == '__main__':
 
     print(f"needed {len(C)} subdomains")
 
-    fname1 = "/tmp/w_taylor_centers.c"
-    with open(fname1, "w") as f:
-        print("// Created by %s on %s" % (" ".join(sys.argv), datetime.datetime.now().time()),
+    # Tables for lib/cerf_inline.h, to replace the autogenerated block in section w_of_z.
+    fname = "/tmp/w_taylor_tables.h"
+    with open(fname, "w") as f:
+        print("//--- The following code is generated by dev/w/arrange_polyominoes.py %s; do not edit"
+              % " ".join(sys.argv[1:]), file=f)
+        print("// clang-format off", file=f)
+        print("alignas(64) static CERF_INLINE_CONST short CerfWTaylorCenters[2 * %i] = {" % len(C),
               file=f)
-        print("alignas(64) static const short Centers[2*%i] = {" % len(C), file=f)
         for n in range(len(C)):
             ix, iy = C[n]
             print("%3i,%3i," % (ix, iy), file=f)
         print("};", file=f)
-    print(f"wrote {fname1}")
-
-    fname2 = "/tmp/w_taylor_cover.c"
-    with open(fname2, "w") as f:
-        print("// Created by %s on %s" % (" ".join(sys.argv), datetime.datetime.now().time()),
-              file=f)
+        print("", file=f)
         typ = "short"
         if len(C)<128:
             typ = "signed char"
-        print("alignas(64) static const %s Cover[%i] = {" % (typ, Nax**2), file=f)
+        print("alignas(64) static CERF_INLINE_CONST %s CerfWTaylorCover[%i] = {" % (typ, Nax**2),
+              file=f)
         for jx in range(Nax):
             for jy in range(Nax):
                 print("%2i," % F[jx][jy], end="", file=f)
             print("", file=f)
         print("};", file=f)
-    print(f"wrote {fname2}")
-
-    fname3 = "/tmp/w_taylor_coeffs.c"
-    with open(fname3, "w") as f:
-        print("// Created by %s on %s" % (" ".join(sys.argv), datetime.datetime.now().time()),
-              file=f)
-        print("static const int NTay = %i;" % Ntay, file=f)
-        print("alignas(64) static const double TaylorCoeffs[2*%i*%i] = {" % (Ntay,len(C)), file=f)
+        print("", file=f)
+        print("static CERF_INLINE_CONST int CerfWTaylorN = %i;" % Ntay, file=f)
+        print("alignas(64) static CERF_INLINE_CONST double CerfWTaylorCoeffs[2 * %i * %i] = {"
+              % (Ntay,len(C)), file=f)
         for c in C:
             x = c[0]/(2*Ndiv)
             y = c[1]/(2*Ndiv)
@@ -291,4 +285,6 @@ if __name__ == '__main__':
                       end="", file=f)
             print(" // x=%8g y=%8g" % (x, y), file=f)
         print("};", file=f)
-    print(f"wrote {fname3}")
+        print("// clang-format on", file=f)
+        print("//--- End of autogenerated code", file=f)
+    print(f"wrote {fname}")
@@ -49,11 +49,13 @@ def process_neighbor(C, A, j, i, dj, di):
 
 # Driver Code
 if __name__ == '__main__':
-    with open("../../lib/w_taylor_cover.c") as f:
+    with open("../../lib/cerf_inline.h") as f:
         ta = f.readlines()
+    i0 = [k for k, t in enumerate(ta) if "CerfWTaylorCover[" in t][0] + 1
+    i1 = ta.index("};\n", i0)
     C = []
     nmax = -1
-    for t in ta[2:-2]:
+    for t in ta[i0:i1]:
         c = []
         for w in t.rstrip(",\n").split(","):
             n = int(w.strip())
@@ -0,0 +1,258 @@
+#!/bin/env python
+
+# File pro_wofz_cheb.py:
+#   Compute polynomial approximants of w(z) on a regular grid of square tiles,
+#   fitted at bivariate Chebyshev nodes, and write the C source file w_cheb_tiles.c.
+#
+# Copyright:
+#   (C) 2026 Forschungszentrum Jülich GmbH
+#
+# Licence:
+#   Permission is hereby granted, free of charge, to any person obtaining
+#   a copy of this software and associated documentation files (the
+#   "Software"), to deal in the Software without restriction, including
+#   without limitation the rights to use, copy, modify, merge, publish,
+#   distribute, sublicense, and/or sell copies of the Software, and to
+#   permit persons to whom the Software is furnished to do so, subject to
+#   the following conditions:
+#
+#   The above copyright notice and this permission notice shall be
+#   included in all copies or substantial portions of the Software.
+#
+#   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+#   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+#   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+#   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+#   LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+#   OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+#   WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#
+# Usage:
+#   pro_wofz_cheb.py <1/h> > ../../lib/w_cheb_tiles.c
+#
+# The quadrant 0 <= x, y < 7 is divided into square tiles of edge h.
+# In each tile, w(z) is approximated by a complex polynomial in dz = z - center,
+# with as few terms as possible.
+#
+# As w is analytic, a complex polynomial in dz needs far fewer terms than a tensor product
+# of real Chebyshev series in x and y. The polynomial is obtained by a weighted least-squares fit
+# at the nodes of a bivariate Chebyshev grid plus the tile boundary, which is close to
+# the minimax approximation on the tile. The relative error of the real and of the imaginary part
+# are minimized separately, which matters near the axes where one of them is small.
+#
+# Tiles that touch an axis have their center on that axis. On the imaginary axis,
+# the coefficients of even order are real, those of odd order imaginary, so that Im w(iy) = 0
+# holds exactly. Near the real axis, w_of_z uses the tiles down to y -> 0 (unless x > 6.9),
+# so that Re w(x) = exp(-x^2) must be reproduced with small relative error. Therefore the fit
+# includes points on the real axis.
+#
+# The fit starts from the Taylor coefficients at the center (computed in high precision),
+# and determines a small correction in double precision. Therefore it is fast enough
+# to run without numpy.
+
+from mpmath import *
+import sys
+sys.path.insert(0, '../shared')
+import functool as fut
+import hp_funcs as hp
+import datetime
+
+mp.dps = 48
+mp.pretty = True
+
+final = False # Extra checks, to be turned on in final production run
+
+Rtot = 7 # radius of the domain; beyond, w_of_z uses the asymptotic expansion
+NTaylor = 70 # number of Taylor terms for computing reference values within one tile
+# Maximum componentwise relative error of the approximant, before rounding the coefficients.
+# Rounding errors are not included because they are inherent to any polynomial evaluation:
+# near the real axis, Re w is much smaller than Im w, and the real parts of the coefficients
+# cancel each other partly, such that rounding causes errors of a few epsilon.
+limit = 2**-53
+
+def least_squares(A, b):
+    """
+    Solves the overdetermined linear system A x = b by Householder QR in double precision.
+    """
+    m = len(A)
+    n = len(A[0])
+    # Householder QR is only stable for rows of very different weight if these are sorted.
+    order = sorted(range(m), key=lambda i: -max(abs(a) for a in A[i]))
+    A = [A[i][:] for i in order]
+    b = [b[i] for i in order]
+    for k in range(n):
+        s = sum(A[i][k]**2 for i in range(k, m)) ** .5
+        if s == 0:
+            continue
+        if A[k][k] > 0:
+            s = -s
+        v = [0.] * k + [A[k][k] - s] + [A[i][k] for i in range(k+1, m)]
+        vv = sum(v[i]**2 for i in range(k, m))
+        if vv == 0:
+            continue
+        for j in range(k, n):
+            d = 2 * sum(v[i] * A[i][j] for i in range(k, m)) / vv
+            for i in range(k, m):
+                A[i][j] -= d * v[i]
+        d = 2 * sum(v[i] * b[i] for i in range(k, m)) / vv
+        for i in range(k, m):
+            b[i] -= d * v[i]
+    x = [0.] * n
+    for k in reversed(range(n)):
+        x[k] = (b[k] - sum(A[k][j] * x[j] for j in range(k+1, n))) / A[k][k]
+    return x
+
+class Tile:
+    def __init__(self, ix, iy, h):
+        self.x0, self.x1 = ix*h, (ix+1)*h
+        self.y0, self.y1 = iy*h, (iy+1)*h
+        self.center = mpc(0 if ix==0 else (ix+mpf(1)/2)*h, 0 if iy==0 else (iy+mpf(1)/2)*h)
+        self.onimag = ix==0
+        self.h = h
+        self.T = hp.wofz_taylor(self.center, NTaylor, final)
+        self.fit_points = [(z, self.reference(z)) for z in self.points(17, 8)]
+        self.check_points = [(z, self.reference(z)) for z in self.points(23, 31)]
+        if final:
+            for z, f in self.check_points[::37]:
+                if not hp.cagree(f, hp.wofz(z, True)):
+                    raise Exception("Taylor reference inaccurate at %s" % z)
+
+    def reference(self, z):
+        dz = z - self.center
+        r = mpc(0)
+        for t in reversed(self.T):
+            r = r*dz + t
+        return r
+
+    def points(self, M, K):
+        """
+        Returns M x M bivariate Chebyshev nodes, plus K+1 points on each tile edge,
+        plus points with y = 1e-8 x, x = 1e-8 y, where w_of_z switches to special algorithms.
+        """
+        x0, x1, y0, y1 = self.x0, self.x1, self.y0, self.y1
+        P = []
+        for i in range(M):
+            for j in range(M):
+                P.append(mpc((x0+x1)/2 - (x1-x0)/2*cos(pi*(i+mpf(1)/2)/M),
+                             (y0+y1)/2 - (y1-y0)/2*cos(pi*(j+mpf(1)/2)/M)))
+        for k in range(K+1):
+            s = mpf(k)/K
+            x = x0+s*(x1-x0)
+            y = y0+s*(y1-y0)
+            P += [mpc(x, y0), mpc(x, y1), mpc(x0, y), mpc(x1, y)]
+            if y0 == 0 and x > 0:
+                P.append(mpc(x, x*mpf(1e-8)))
+            if x0 == 0 and y > 0:
+                P.append(mpc(y*mpf(1e-8), y))
+        return [z for z in P if abs(z) > 0]
+
+    def basis(self, N):
+        """
+        Returns list of (k, b): the real unknowns are factors of b * dz^k.
+        """
+        if self.onimag:
+            return [(k, mpc(1,0) if k%2==0 else mpc(0,1)) for k in range(N)]
+        return [(k, b) for k in range(N) for b in [mpc(1,0), mpc(0,1)]]
+
+    def fit(self, N):
+        """
+        Returns N coefficients of the polynomial in dz.
+        """
+        # The scaled variable t = dz/h is of order 1, which keeps the linear system well conditioned.
+        h = self.h
+        B = self.basis(N)
+        A = []
+        rhs = []
+        for z, f in self.fit_points:
+            t = (z - self.center) / h
+            res = f
+            for k in range(N):
+                res -= self.T[k] * h**k * t**k
+            for part in [lambda u: u.real, lambda u: u.imag]:
+                if part(f) == 0:
+                    continue
+                wgt = 1 / abs(part(f))
+                A.append([float(part(b * t**k) * wgt) for k, b in B])
+                rhs.append(float(part(res) * wgt))
+        delta = least_squares(A, rhs)
+        C = [self.T[k] for k in range(N)]
+        for (k, b), d in zip(B, delta):
+            C[k] += b * d / h**k
+        return C
+
+    def error(self, C):
+        """
+        Returns maximum componentwise relative error of polynomial with coefficients C.
+        """
+        emax = 0
+        for z, f in self.check_points:
+            dz = z - self.center
+            p = mpc(0)
+            for c in reversed(C):
+                p = p*dz + c
+            for part in [lambda u: u.real, lambda u: u.imag]:
+                if part(f) != 0:
+                    emax = max(emax, abs(part(p) - part(f)) / abs(part(f)))
+        return emax
+
+    def coeffs(self, Nguess):
+        """
+        Returns coefficients, rounded to double precision, for the smallest number of terms
+        that achieves the required accuracy. The search starts at Nguess.
+        """
+        N = Nguess
+        C = self.fit(N)
+        if self.error(C) < limit:
+            while N > 2:
+                C1 = self.fit(N-1)
+                if self.error(C1) >= limit:
+                    break
+                N, C = N-1, C1
+        else:
+            while True:
+                N += 1
+                if N > 32:
+                    raise Exception("tile (%g,%g): 32 terms are not enough" % (self.x0, self.y0))
+                C = self.fit(N)
+                if self.error(C) < limit:
+                    break
+        return [mpc(float(c.real), float(c.imag)) for c in C]
+
+if __name__ == '__main__':
+    if len(sys.argv) != 2:
+        raise Exception(f'Usage: {sys.argv[0]} <1/h>')
+    Ndiv = int(sys.argv[1])
+    h = mpf(1) / Ndiv
+    Nax = Rtot * Ndiv
+
+    Tiles = [] # (offset, number of terms) per tile
+    Coeffs = []
+    nC = 0
+    for ix in range(Nax):
+        for iy in range(Nax):
+            if (ix**2 + iy**2) * h**2 >= Rtot**2:
+                Tiles.append((0, 0))
+                continue
+            # Start the search from the neighbor with similar |z|.
+            Nguess = Tiles[(ix-1)*Nax+iy][1] if ix > 0 else Tiles[-1][1] if iy > 0 else 16
+            C = Tile(ix, iy, h).coeffs(Nguess)
+            Tiles.append((nC, len(C)))
+            Coeffs.append((C, ix, iy))
+            nC += len(C)
+            print("tile %2i %2i: %2i terms" % (ix, iy, len(C)), file=sys.stderr)
+
+    print("// Created by %s on %s" % (" ".join(sys.argv), datetime.datetime.now().time()))
+    print("static const int NChebDiv = %i; // tiles per unit length" % Ndiv)
+    print("static const int NChebAx = %i; // tiles per axis" % Nax)
+    print("alignas(64) static const short ChebTiles[2*%i] = { // offset, number of terms" % Nax**2)
+    for ix in range(Nax):
+        for iy in range(Nax):
+            print("%4i,%2i," % Tiles[ix*Nax+iy], end="")
+        print("")
+    print("};")
+    print("alignas(64) static const double ChebCoeffs[2*%i] = {" % nC)
+    for C, ix, iy in Coeffs:
+        for c in C:
+            print(" %s, %s," % (fut.double2hexstring(c.real), fut.double2hexstring(c.imag)), end="")
+        print(" // x=%8g y=%8g" % (ix*h, iy*h))
+    print("};")
@@ -0,0 +1,51 @@
+#!/bin/env python
+
+"""
+Computes componentwise relative error of w(z) for random z in the domain of the tile core
+(Taylor expansions on polyominoes, or fitted polynomials on regular grid if built with
+CERF_W_CHEB), and prints worst and mean error in units of 2^-53.
+Half of the points are close to the real or imaginary axis, where Re w or Im w is small.
+Requires run/run_wofz built with -DCERF_INTROSPECT=ON.
+"""
+
+from mpmath import *
+import random
+import sys
+sys.path.insert(0, '../shared')
+import hp_funcs as hp
+import runtool as rt
+
+mp.dps = 48
+mp.pretty = True
+
+if __name__ == '__main__':
+    rt.external_program = "run/run_wofz"
+    N = int(sys.argv[1]) if len(sys.argv) > 1 else 10000
+
+    random.seed(4711)
+    eps = 2**-53
+    emax = [0, 0]
+    esum = [0, 0]
+    zmax = [None, None]
+    n = 0
+    while n < N:
+        r = random.uniform(.23, 7)
+        ph = random.uniform(0, pi/2)
+        if n % 2: # half of the points close to one of the axes
+            ph = 10**random.uniform(-8, -1)
+            if n % 4 == 3:
+                ph = pi/2 - ph
+        x, y = float(r*cos(ph)), float(r*sin(ph))
+        z, v, a, nt = rt.external_function2d(x, y)
+        if a // 100 != 9:
+            continue
+        n += 1
+        vref = hp.wofz(z)
+        for k, part in enumerate([lambda u: u.real, lambda u: u.imag]):
+            e = abs((part(v) - part(vref)) / part(vref)) / eps
+            esum[k] += e
+            if e > emax[k]:
+                emax[k] = e
+                zmax[k] = z
+    for k, name in enumerate(["Re", "Im"]):
+        print("%s w: max %6.2f at %s, mean %6.3f" % (name, emax[k], zmax[k], esum[k]/N))
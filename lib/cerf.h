@@ -40,13 +40,16 @@
  *   ../CHANGELOG
  *
  * Man pages:
- *   w_of_z(3), dawson(3), voigt(3), cerf(3), erfcx(3), erfi(3)
+ *   w_of_z(3), dawson(3), voigt(3), cerf(3), erfcx(3), erfi(3), plasma_z(3), cerf_roots(3)
+ *   C++ interface: cerf.hpp, cerf_cpp(3)
  */
 
 
 #ifndef __CERF_H
 #  define __CERF_H
 
+#  include <stddef.h>
+
 #  ifdef CERF_AS_CPP
 #    include <complex>
      typedef std::complex<double> _cerf_cmplx;
@@ -75,6 +78,18 @@ EXPORT _cerf_cmplx w_of_z(_cerf_cmplx z);
 EXPORT double im_w_of_x(double x); // special case Im[w(x)] of real x
 EXPORT double re_w_of_z(double x, double y);
 EXPORT double im_w_of_z(double x, double y);
+// engines for w_of_z_array
+enum cerf_w_engine { CERF_W_DEFAULT = 0, CERF_W_RATIONAL = 1, CERF_W_TABLE = 2 };
+// compute w(z) for n arguments, with real and imaginary parts in separate arrays
+EXPORT void w_of_z_array(
+    size_t n, const double* z_re, const double* z_im, double* w_re, double* w_im, int engine);
+// fast approximate w(z), interpolated in a table file; returns 0, or -1 (i/o), -2 (format),
+// -3 (error bound of table larger than errbound)
+EXPORT int cerf_w_table_open(const char* filename, double errbound);
+EXPORT void cerf_w_table_close(void);
+EXPORT _cerf_cmplx w_of_z_table(_cerf_cmplx z); // w_of_z where no table or outside of grid
+EXPORT int cerf_w_table_write(
+    const char* filename, int ndiv, double xmax, double ymax, double* errbound);
 
 // compute erf(z), the error function of complex arguments
 EXPORT _cerf_cmplx cerf(_cerf_cmplx z);
@@ -82,9 +97,38 @@ EXPORT _cerf_cmplx cerf(_cerf_cmplx z);
 // compute erfc(z) = 1 - erf(z), the complementary error function
 EXPORT _cerf_cmplx cerfc(_cerf_cmplx z);
 
+// compute erf(x) and erfc(x) for real x, independent of the C library
+EXPORT double erf_real(double x);
+EXPORT double erfc_real(double x);
+EXPORT void erf_real_array(size_t n, const double* x, double* result);
+EXPORT void erfc_real_array(size_t n, const double* x, double* result);
+
 // compute erfcx(z) = exp(z^2) erfc(z), an underflow-compensated version of erfc
 EXPORT _cerf_cmplx cerfcx(_cerf_cmplx z);
 EXPORT double erfcx(double x); // special case for real x
+EXPORT void erfcx_array(size_t n, const double* x, double* result); // for n real arguments
+
+// compute log(erfc(x)) and log(Phi(x)), with Phi the cumulative standard normal distribution
+EXPORT double log_erfc(double x);
+EXPORT double log_ndtr(double x);
+EXPORT void log_erfc_array(size_t n, const double* x, double* result);
+EXPORT void log_ndtr_array(size_t n, const double* x, double* result);
+
+// compute the inverse functions of erfcx, erfc, erf for real arguments
+EXPORT double erfcx_inv(double y);
+EXPORT double erfc_inv(double y);
+EXPORT double erf_inv(double z);
+EXPORT void erfcx_inv_array(size_t n, const double* y, double* result);
+EXPORT void erfc_inv_array(size_t n, const double* y, double* result);
+EXPORT void erf_inv_array(size_t n, const double* z, double* result);
+
+// compute Mills ratio (1-Phi(x))/phi(x), its inverse, and the normal tail 1-Phi(x)
+EXPORT double mills_ratio(double x);
+EXPORT double inv_mills_ratio(double x);
+EXPORT double normal_tail(double x);
+EXPORT void mills_ratio_array(size_t n, const double* x, double* result);
+EXPORT void inv_mills_ratio_array(size_t n, const double* x, double* result);
+EXPORT void normal_tail_array(size_t n, const double* x, double* result);
 
 // compute erfi(z) = -i erf(iz), the imaginary error function
 EXPORT _cerf_cmplx cerfi(_cerf_cmplx z);
@@ -99,11 +143,46 @@ EXPORT double voigt(double x, double sigma, double gamma);
 // compute the full width at half maximum of the Voigt function
 EXPORT double voigt_hwhm(double sigma, double gamma);
 
+// compute emg(x,...), the convolution of a Gaussian and a one-sided exponential decay
+EXPORT double emg(double x, double mu, double sigma, double tau);
+// compute emg, and set grad = {d/dmu, d/dsigma, d/dtau} emg
+EXPORT double emg_grad(double x, double mu, double sigma, double tau, double* grad);
+// compute emg and, where pointers are not NULL, its derivatives for n arguments
+EXPORT void emg_array(
+    size_t n, const double* x, double mu, double sigma, double tau,
+    double* result, double* d_mu, double* d_sigma, double* d_tau);
+
+// compute Z(zeta) = i sqrt(pi) w(zeta), the plasma dispersion function of Fried and Conte
+EXPORT _cerf_cmplx plasma_z(_cerf_cmplx zeta);
+// compute Z'(zeta) = -2 (1 + zeta Z(zeta)), the derivative of the plasma dispersion function
+EXPORT _cerf_cmplx plasma_zprime(_cerf_cmplx zeta);
+// compute Z and Z' for n arguments, with real and imaginary parts in separate arrays
+EXPORT void plasma_z_zprime_array(
+    size_t n, const double* zeta_re, const double* zeta_im,
+    double* z_re, double* z_im, double* zp_re, double* zp_im);
+
+// function f(z) whose roots are sought; returns f(z) and sets *df = f'(z), *d2f = f''(z)
+typedef _cerf_cmplx (*cerf_rootfct)(
+    _cerf_cmplx z, const void* param, _cerf_cmplx* df, _cerf_cmplx* d2f);
+// predefined f(z) = a + b w(z) and f(z) = a + b z Z(z), with param = {Re a, Im a, Re b, Im b}
+EXPORT _cerf_cmplx cerf_rootfct_w(
+    _cerf_cmplx z, const void* param, _cerf_cmplx* df, _cerf_cmplx* d2f);
+EXPORT _cerf_cmplx cerf_rootfct_zZ(
+    _cerf_cmplx z, const void* param, _cerf_cmplx* df, _cerf_cmplx* d2f);
+// refine n independent starting values by Halley's method; returns number of converged roots
+EXPORT size_t cerf_roots_halley(
+    size_t n, cerf_rootfct f, const void* param, size_t param_stride,
+    double* z_re, double* z_im, int* status, double tol, int maxiter);
+// find roots within a rectangle of the complex plane; returns number of roots found
+EXPORT size_t cerf_roots_scan(
+    cerf_rootfct f, const void* param, double xmin, double xmax, double ymin, double ymax,
+    size_t max_roots, double* z_re, double* z_im);
+
 #ifndef CERF_AS_CPP
 #ifdef __cplusplus
 } // extern "C"
 
-#define WRAP(f) std::complex<double> f(std::complex<double> z) { \
+#define WRAP(f) inline std::complex<double> f(std::complex<double> z) { \
     _cerf_cmplx ret = f(*((_cerf_cmplx*)(void*)&z)); \
     return *((std::complex<double>*)(void*)&ret); }
 
@@ -113,6 +192,8 @@ WRAP(cerfc)
 WRAP(cerfcx)
 WRAP(cerfi)
 WRAP(cdawson)
+WRAP(plasma_z)
+WRAP(plasma_zprime)
 
 #endif
 #endif
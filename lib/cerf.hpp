@@ -0,0 +1,216 @@
+/* Library libcerf:
+ *   Compute complex error functions, based on a new implementation of
+ *   Faddeeva's w_of_z. Also provide Dawson and Voigt functions.
+ *
+ * File cerf.hpp:
+ *   C++ interface: function templates for float and double arguments,
+ *   and batch versions for pointer ranges and for contiguous ranges (C++20).
+ *
+ * Copyright:
+ *   (C) 2026 Forschungszentrum Jülich GmbH
+ *
+ * Licence:
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *   LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *   OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *   WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * Website:
+ *   http://apps.jcns.fz-juelich.de/libcerf
+ *
+ * Revision history:
+ *   ../CHANGELOG
+ *
+ * Man page:
+ *   cerf_cpp(3)
+ */
+
+#ifndef __CERF_HPP
+#define __CERF_HPP
+
+#include "cerf.h"
+#include "cerf_inline.h"
+#include <complex>
+#include <cstddef>
+#include <type_traits>
+
+#if __cplusplus >= 202002L && defined(__has_include)
+#  if __has_include(<ranges>)
+#    include <ranges>
+#  endif
+#endif
+
+// The namespace cannot be called cerf, because this is the name of a function from cerf.h.
+namespace libcerf {
+
+namespace detail {
+
+//! Computations are done in double precision; results are rounded to T.
+//! The float versions are narrowing wrappers around the double kernels: there is no
+//! float-precision algorithm, and they are not faster than the double versions.
+template <class T> struct is_supported {
+    static constexpr bool value = std::is_same<T, float>::value || std::is_same<T, double>::value;
+};
+
+inline CERF_INLINE_CONSTEXPR std::complex<double> widen(std::complex<float> z) {
+    return std::complex<double>(z.real(), z.imag());
+}
+inline CERF_INLINE_CONSTEXPR std::complex<double> widen(std::complex<double> z) { return z; }
+
+template <class T> inline CERF_INLINE_CONSTEXPR std::complex<T> narrow(std::complex<double> z) {
+    return std::complex<T>(static_cast<T>(z.real()), static_cast<T>(z.imag()));
+}
+
+} // namespace detail
+
+/******************************************************************************/
+/*  Real functions, inlined from cerf_inline.h                                */
+/******************************************************************************/
+
+// In C++20, these functions are constexpr (see cerf_inline.h).
+
+#define CERF_HPP_REAL(name, kernel)                                                               \
+    template <class T> inline CERF_INLINE_CONSTEXPR T name(T x) {                                 \
+        static_assert(detail::is_supported<T>::value, "libcerf: T must be float or double");     \
+        return static_cast<T>(kernel(static_cast<double>(x)));                                    \
+    }                                                                                             \
+    template <class T> inline void name(std::size_t n, const T* x, T* result) {                   \
+        for (std::size_t i = 0; i < n; ++i)                                                       \
+            result[i] = name(x[i]);                                                               \
+    }
+
+CERF_HPP_REAL(erfcx, cerf_inline_erfcx)
+CERF_HPP_REAL(im_w_of_x, cerf_inline_im_w_of_x)
+CERF_HPP_REAL(dawson, cerf_inline_dawson)
+
+#undef CERF_HPP_REAL
+
+/******************************************************************************/
+/*  Voigt profile, calling the library                                        */
+/******************************************************************************/
+
+//! Voigt profile. In C++20, constexpr: in constant expressions, it is computed by
+//! cerf_inline_constexpr_voigt, otherwise by the library.
+template <class T> inline CERF_INLINE_CONSTEXPR T voigt(T x, T sigma, T gamma) {
+    static_assert(detail::is_supported<T>::value, "libcerf: T must be float or double");
+#ifdef CERF_HAS_CONSTEXPR
+    if (std::is_constant_evaluated())
+        return static_cast<T>(cerf_inline_constexpr_voigt(x, sigma, gamma));
+#endif
+    return static_cast<T>(::voigt(x, sigma, gamma));
+}
+
+/******************************************************************************/
+/*  Complex functions, calling the library                                    */
+/******************************************************************************/
+
+//! In C++20, w_of_z is constexpr: in constant expressions, it is computed by
+//! cerf_inline_constexpr_w_of_z, otherwise by the library.
+template <class T> inline CERF_INLINE_CONSTEXPR std::complex<T> w_of_z(std::complex<T> z) {
+    static_assert(detail::is_supported<T>::value, "libcerf: T must be float or double");
+#ifdef CERF_HAS_CONSTEXPR
+    if (std::is_constant_evaluated()) {
+        double wr = 0, wi = 0;
+        cerf_inline_constexpr_w_of_z(z.real(), z.imag(), &wr, &wi);
+        return std::complex<T>(static_cast<T>(wr), static_cast<T>(wi));
+    }
+#endif
+    return detail::narrow<T>(::w_of_z(detail::widen(z)));
+}
+
+#define CERF_HPP_COMPLEX(name)                                                                    \
+    template <class T> inline std::complex<T> name(std::complex<T> z) {                           \
+        static_assert(detail::is_supported<T>::value, "libcerf: T must be float or double");     \
+        return detail::narrow<T>(::name(detail::widen(z)));                                       \
+    }                                                                                             \
+    CERF_HPP_COMPLEX_BATCH(name)
+
+#define CERF_HPP_COMPLEX_BATCH(name)                                                              \
+    template <class T>                                                                            \
+    inline void name(std::size_t n, const std::complex<T>* z, std::complex<T>* result) {          \
+        for (std::size_t i = 0; i < n; ++i)                                                       \
+            result[i] = name(z[i]);                                                               \
+    }
+
+CERF_HPP_COMPLEX_BATCH(w_of_z)
+CERF_HPP_COMPLEX(cerf)
+CERF_HPP_COMPLEX(cerfc)
+CERF_HPP_COMPLEX(cerfcx)
+CERF_HPP_COMPLEX(cerfi)
+CERF_HPP_COMPLEX(cdawson)
+CERF_HPP_COMPLEX(plasma_z)
+CERF_HPP_COMPLEX(plasma_zprime)
+
+#undef CERF_HPP_COMPLEX
+#undef CERF_HPP_COMPLEX_BATCH
+
+/******************************************************************************/
+/*  Batch versions for contiguous ranges (C++20)                              */
+/******************************************************************************/
+
+#ifdef __cpp_lib_ranges
+
+namespace detail {
+
+//! Input X and output R are contiguous ranges with the same value type, which is
+//! float or double (Real), or std::complex<float> or std::complex<double> (Complex).
+template <class X, class R, class V>
+concept batch_ranges = std::ranges::contiguous_range<const X> && std::ranges::sized_range<const X>
+    && std::ranges::contiguous_range<R> && std::ranges::sized_range<R>
+    && std::same_as<std::ranges::range_value_t<const X>, V>
+    && std::same_as<std::ranges::range_value_t<R>, V> && std::ranges::output_range<R, V>;
+
+template <class X, class R>
+concept real_batch = batch_ranges<X, R, std::ranges::range_value_t<const X>>
+    && is_supported<std::ranges::range_value_t<const X>>::value;
+
+template <class X, class R>
+concept complex_batch = batch_ranges<X, R, std::ranges::range_value_t<const X>>
+    && (std::same_as<std::ranges::range_value_t<const X>, std::complex<float>>
+        || std::same_as<std::ranges::range_value_t<const X>, std::complex<double>>);
+
+} // namespace detail
+
+//! Computes result[i] = F(x[i]) for all i within both ranges, e.g. std::vector or std::span.
+#define CERF_HPP_RANGE(name, kind)                                                                \
+    template <class X, class R>                                                                   \
+        requires detail::kind<X, R>                                                               \
+    inline void name(const X& x, R&& result) {                                                    \
+        const std::size_t n = std::ranges::size(x);                                               \
+        const std::size_t m = std::ranges::size(result);                                          \
+        name(n < m ? n : m, std::ranges::data(x), std::ranges::data(result));                     \
+    }
+
+CERF_HPP_RANGE(erfcx, real_batch)
+CERF_HPP_RANGE(im_w_of_x, real_batch)
+CERF_HPP_RANGE(dawson, real_batch)
+CERF_HPP_RANGE(w_of_z, complex_batch)
+CERF_HPP_RANGE(cerf, complex_batch)
+CERF_HPP_RANGE(cerfc, complex_batch)
+CERF_HPP_RANGE(cerfcx, complex_batch)
+CERF_HPP_RANGE(cerfi, complex_batch)
+CERF_HPP_RANGE(cdawson, complex_batch)
+CERF_HPP_RANGE(plasma_z, complex_batch)
+CERF_HPP_RANGE(plasma_zprime, complex_batch)
+
+#undef CERF_HPP_RANGE
+
+#endif // __cpp_lib_ranges
+
+} // namespace libcerf
+
+#endif // __CERF_HPP
@@ -0,0 +1,3248 @@
+/* Library libcerf:
+ *   Compute complex error functions, based on a new implementation of
+ *   Faddeeva's w_of_z. Also provide Dawson and Voigt functions.
+ *
+ * File cerf_inline.h:
+ *   Optional header-only versions of the real-argument functions erfcx,
+ *   im_w_of_x and dawson, together with their lookup tables.
+ *   All functions are static inline, so that the compiler can inline and
+ *   vectorize them into user loops. The library itself is built from this
+ *   header, so that results are the same as from erfcx, im_w_of_x and dawson.
+ *   In C++20, the functions are also constexpr.
+ *   Also contains the series kernels and Taylor tables of w_of_z, shared with
+ *   the library, and in C++20 constexpr versions of w_of_z and voigt.
+ *   For erfcx and im_w_of_x, there are alternative versions with suffix _uniform
+ *   that use one lookup table for all arguments, and have no branches.
+ *
+ * Copyright:
+ *   (C) 2012 Massachusetts Institute of Technology
+ *   (C) 2013, 2024, 2026 Forschungszentrum Jülich GmbH
+ *
+ * Licence:
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *   LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *   OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *   WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * Website:
+ *   http://apps.jcns.fz-juelich.de/libcerf
+ *
+ * Revision history:
+ *   ../CHANGELOG
+ *
+ * Man page:
+ *   cerf_inline(3)
+ */
+
+#ifndef __CERF_INLINE_H
+#define __CERF_INLINE_H
+
+#include <math.h>
+#include <string.h>
+#if !defined(__cplusplus) && !defined(alignas)
+#include <stdalign.h>
+#endif
+
+// Introspection is only supported within the library (see defs.h).
+#ifndef SET_INFO
+#define CERF_INLINE_NO_INFO
+#define SET_INFO(a,n)
+#define SET_ALGO(a)
+#define SET_NTER(n)
+#endif
+
+// In C++20, the functions in this header are constexpr, so that they can be evaluated
+// at compile time. Introspection (see defs.h) is incompatible with constexpr,
+// and the bit manipulation in cerf_inline_frexp2 requires IEEE 754 layout.
+#if defined(__cplusplus) && __cplusplus >= 202002L
+#include <version>
+#endif
+#if defined(CERF_INLINE_NO_INFO) && !defined(CERF_NO_IEEE754) \
+    && defined(__cpp_lib_bit_cast) && defined(__cpp_lib_is_constant_evaluated)
+#include <bit>
+#include <type_traits>
+#define CERF_HAS_CONSTEXPR 1
+#define CERF_INLINE_CONSTEXPR constexpr
+#else
+#define CERF_INLINE_CONSTEXPR
+#endif
+
+// Lookup tables must be constexpr to be readable in constant expressions.
+#ifdef __cplusplus
+#define CERF_INLINE_CONST constexpr
+#else
+#define CERF_INLINE_CONST const
+#endif
+
+#ifdef CERF_NO_IEEE754 // This flag can be set via CMake option -DCERF_IEEE754=OFF
+// Fall back to frexp from math.h. To be used for non-standard processor architectures
+// for which our accelerated function cerf_inline_frexp2 does not work.
+#define cerf_inline_frexp2 frexp
+
+#elif defined(CERF_HAS_CONSTEXPR)
+//! Replacement for frexp from math.h, assuming that 0 < value < inf.
+static inline constexpr double cerf_inline_frexp2(double value, int* eptr)
+{
+    const unsigned long long u = std::bit_cast<unsigned long long>(value);
+    *eptr = (int)((u >> 52) & 0x7ff) - 1022;
+    return std::bit_cast<double>((u & ~(0x7ffULL << 52)) | (1022ULL << 52));
+}
+
+#else
+//! Simpler replacement for frexp from math.h, assuming that 0 < value < inf.
+//!
+//! Works on the 64-bit integer representation. Unlike an earlier version based on a union
+//! with bit fields, this can be vectorized by the compiler.
+static inline double cerf_inline_frexp2(double value, int* eptr)
+{
+    unsigned long long u;
+    memcpy(&u, &value, sizeof(u));
+    *eptr = (int)((u >> 52) & 0x7ff) - 1022;
+    u = (u & ~(0x7ffULL << 52)) | (1022ULL << 52);
+    memcpy(&value, &u, sizeof(u));
+    return value;
+}
+#endif
+
+#ifdef CERF_HAS_CONSTEXPR
+//! Computes exp(x) in constant expressions, where exp from math.h is not available.
+//! Cody-Waite reduction x = k ln2 + r with |r| <= ln2/2, and Taylor series for exp(r).
+static inline constexpr double cerf_inline_constexpr_exp(double x)
+{
+    if (x != x)
+        return x;
+    if (x > 709.8)
+        return HUGE_VAL;
+    if (x < -745.2)
+        return 0;
+    const double ln2hi = 6.93147180369123816490e-01;
+    const double ln2lo = 1.90821492927058770002e-10;
+    int k = (int)(x * 1.44269504088896338700 + (x < 0 ? -.5 : .5));
+    const double r = (x - k * ln2hi) - k * ln2lo;
+    double s = 1;
+    for (int n = 14; n >= 1; --n)
+        s = 1 + r / n * s;
+    for (; k > 1000; k -= 1000)
+        s *= 0x1p1000;
+    for (; k < -1000; k += 1000)
+        s *= 0x1p-1000;
+    return s * std::bit_cast<double>((unsigned long long)(k + 1023) << 52);
+}
+
+//! Not constexpr: reached in a constant expression, it stops compilation with an error.
+static inline double cerf_inline_constexpr_sincos_out_of_range() { return NAN; }
+
+//! Computes sin(x) and cos(x) in constant expressions, where sin and cos from math.h are
+//! not available. Cody-Waite reduction x = k pi/2 + r with |r| <= pi/4, where pi/2 is split
+//! into parts of 24 bits, so that k times each part is exact; Taylor series for sin(r) and
+//! cos(r). The reduction is only exact for |x| <= 2^28, larger x are a compile-time error.
+static inline constexpr void cerf_inline_constexpr_sincos(double x, double* s, double* c)
+{
+    if (x != x || x - x != 0) { // NaN or inf
+        *s = *c = x - x;
+        return;
+    }
+    if (x > 0x1p28 || x < -0x1p28) {
+        *s = *c = cerf_inline_constexpr_sincos_out_of_range();
+        return;
+    }
+    const long long k = (long long)(x * 0.63661977236758134308 + (x < 0 ? -.5 : .5));
+    const double r = ((((x - k * 0x1.921fb4p0) - k * 0x1.4442d0p-24) - k * 0x1.846988p-48)
+                      - k * 0x1.8cc516p-72) - k * 0x1.01b839a25204ap-96;
+    const double r2 = r * r;
+    double sr = 1, cr = 1;
+    for (int n = 23; n >= 3; n -= 2)
+        sr = 1 - r2 / (n * (n - 1)) * sr;
+    sr *= r;
+    for (int n = 22; n >= 2; n -= 2)
+        cr = 1 - r2 / (n * (n - 1)) * cr;
+    switch (k & 3) {
+    case 0: *s = sr; *c = cr; break;
+    case 1: *s = cr; *c = -sr; break;
+    case 2: *s = -sr; *c = -cr; break;
+    default: *s = -cr; *c = sr;
+    }
+}
+#endif
+
+//! Computes exp(x), at compile time if possible.
+static inline CERF_INLINE_CONSTEXPR double cerf_inline_exp(double x)
+{
+#ifdef CERF_HAS_CONSTEXPR
+    if (std::is_constant_evaluated())
+        return cerf_inline_constexpr_exp(x);
+#endif
+    return exp(x);
+}
+
+//! Computes 2 exp(x^2). The low-order part of x^2 is taken into account; otherwise the
+//! rounding error of x*x would be amplified by x^2, to some 100 ulp for |x| near 20.
+static inline CERF_INLINE_CONSTEXPR double cerf_inline_2exp_xx(double x)
+{
+    const double xx = x * x;
+    double xxlo;
+#ifdef CERF_HAS_CONSTEXPR
+    if (std::is_constant_evaluated()) {
+        // Dekker's exact product, since fma is not constexpr.
+        const double c = 134217729. * x; // 2^27 + 1
+        const double hi = c - (c - x);
+        const double lo = x - hi;
+        xxlo = ((hi * hi - xx) + 2 * hi * lo) + lo * lo;
+    } else
+#endif
+        xxlo = fma(x, x, -xx);
+    return 2 * cerf_inline_exp(xx) * (1 + xxlo);
+}
+
+//! Evaluates a polynomial of order 7, with coefficients P[0..7] in increasing order.
+//! With CERF_ESTRIN, Estrin's scheme shortens the chain of dependent multiply-adds
+//! from 7 to 3, at the cost of two more multiplications.
+static inline CERF_INLINE_CONSTEXPR double cerf_inline_poly7(const double* P, double t)
+{
+#ifdef CERF_ESTRIN
+    const double t2 = t * t;
+    return ((P[0] + P[1] * t) + (P[2] + P[3] * t) * t2)
+        + ((P[4] + P[5] * t) + (P[6] + P[7] * t) * t2) * (t2 * t2);
+#else
+    return ((((((P[7] * t + P[6]) * t + P[5]) * t + P[4]) * t + P[3]) * t + P[2]) * t + P[1]) * t
+        + P[0];
+#endif
+}
+
+/******************************************************************************/
+/*  erfcx                                                                     */
+/******************************************************************************/
+
+//--- The following code is generated by dev/1d/pro_erfcx_chebcoeffs.py; do not edit
+// clang-format off
+alignas(64) static CERF_INLINE_CONST double CerfErfcxCoeffs0[448 * 2] = {
+        0x0.df5145019522b0p0, -0x0.e8997b2143a390p-10, // x in subrange 0:0 (0.125..0.126953)
+     0x0.dedd28b3ad1e28p0, -0x0.e7d7df1a30eb98p-10, // x in subrange 0:1 (0.126953..0.128906)
+     0x0.de696cfff586d8p0, -0x0.e7171233ac6f48p-10, // x in subrange 0:2 (0.128906..0.130859)
+     0x0.ddf6117f1fc9b0p0, -0x0.e657136724d520p-10, // x in subrange 0:3 (0.130859..0.132812)
+     0x0.dd8315ca603dd0p0, -0x0.e597e1af82f640p-10, // x in subrange 0:4 (0.132812..0.134766)
+     0x0.dd10797b6d67b8p0, -0x0.e4d97c09278320p-10, // x in subrange 0:5 (0.134766..0.136719)
+     0x0.dc9e3c2c7f3e40p0, -0x0.e41be171e8ac28p-10, // x in subrange 0:6 (0.136719..0.138672)
+     0x0.dc2c5d784e7020p0, -0x0.e35f10e90fce80p-10, // x in subrange 0:7 (0.138672..0.140625)
+     0x0.dbbadcfa13ab20p0, -0x0.e2a3096f5724d8p-10, // x in subrange 0:8 (0.140625..0.142578)
+     0x0.db49ba4d86e428p0, -0x0.e1e7ca06e77c48p-10, // x in subrange 0:9 (0.142578..0.144531)
+     0x0.dad8f50edea0a0p0, -0x0.e12d51b355ed10p-10, // x in subrange 0:10 (0.144531..0.146484)
+     0x0.da688cdacf40b0p0, -0x0.e0739f79a19738p-10, // x in subrange 0:11 (0.146484..0.148438)
+     0x0.d9f8814e8a4b00p0, -0x0.dfbab260316360p-10, // x in subrange 0:12 (0.148438..0.150391)
+     0x0.d988d207bdb930p0, -0x0.df02896ed1c740p-10, // x in subrange 0:13 (0.150391..0.152344)
+     0x0.d9197ea49345c8p0, -0x0.de4b23aeb28de8p-10, // x in subrange 0:14 (0.152344..0.154297)
+     0x0.d8aa86c3afbb08p0, -0x0.dd94802a64a438p-10, // x in subrange 0:15 (0.154297..0.15625)
+     0x0.d83bea043242e0p0, -0x0.dcde9dedd7e8c8p-10, // x in subrange 0:16 (0.15625..0.158203)
+     0x0.d7cda805b3b810p0, -0x0.dc297c0658ffb0p-10, // x in subrange 0:17 (0.158203..0.160156)
+     0x0.d75fc06845f848p0, -0x0.db7519828f2a48p-10, // x in subrange 0:18 (0.160156..0.162109)
+     0x0.d6f232cc733758p0, -0x0.dac175727a2240p-10, // x in subrange 0:19 (0.162109..0.164062)
+     0x0.d684fed33d5390p0, -0x0.da0e8ee76ff8b8p-10, // x in subrange 0:20 (0.164062..0.166016)
+     0x0.d618241e1d2b10p0, -0x0.d95c64f41af8e8p-10, // x in subrange 0:21 (0.166016..0.167969)
+     0x0.d5aba24f01f230p0, -0x0.d8aaf6ac778e78p-10, // x in subrange 0:22 (0.167969..0.169922)
+     0x0.d53f7908508b00p0, -0x0.d7fa4325d22f48p-10, // x in subrange 0:23 (0.169922..0.171875)
+     0x0.d4d3a7ece2ddc8p0, -0x0.d74a4976c54920p-10, // x in subrange 0:24 (0.171875..0.173828)
+     0x0.d4682ea0073270p0, -0x0.d69b08b73732a8p-10, // x in subrange 0:25 (0.173828..0.175781)
+     0x0.d3fd0cc57f8b38p0, -0x0.d5ec8000582018p-10, // x in subrange 0:26 (0.175781..0.177734)
+     0x0.d3924201810048p0, -0x0.d53eae6ca01b38p-10, // x in subrange 0:27 (0.177734..0.179688)
+     0x0.d327cdf8b31c18p0, -0x0.d4919317ccff28p-10, // x in subrange 0:28 (0.179688..0.181641)
+     0x0.d2bdb0502f3948p0, -0x0.d3e52d1ee07760p-10, // x in subrange 0:29 (0.181641..0.183594)
+     0x0.d253e8ad7fe110p0, -0x0.d3397ba01e0238p-10, // x in subrange 0:30 (0.183594..0.185547)
+     0x0.d1ea76b6a02ad0p0, -0x0.d28e7dbb08f6d0p-10, // x in subrange 0:31 (0.185547..0.1875)
+     0x0.d1815a11fb1cc0p0, -0x0.d1e43290628e78p-10, // x in subrange 0:32 (0.1875..0.189453)
+     0x0.d11892666b0d60p0, -0x0.d13a994227f138p-10, // x in subrange 0:33 (0.189453..0.191406)
+     0x0.d0b01f5b390610p0, -0x0.d091b0f39045f8p-10, // x in subrange 0:34 (0.191406..0.193359)
+     0x0.d04800981c2678p0, -0x0.cfe978c90ac5d8p-10, // x in subrange 0:35 (0.193359..0.195312)
+     0x0.cfe035c5390910p0, -0x0.cf41efe83cd2c0p-10, // x in subrange 0:36 (0.195312..0.197266)
+     0x0.cf78be8b212878p0, -0x0.ce9b1578001140p-10, // x in subrange 0:37 (0.197266..0.199219)
+     0x0.cf119a92d245d0p0, -0x0.cdf4e8a06085d8p-10, // x in subrange 0:38 (0.199219..0.201172)
+     0x0.ceaac985b5d000p0, -0x0.cd4f688a9ab530p-10, // x in subrange 0:39 (0.201172..0.203125)
+     0x0.ce444b0da04bf8p0, -0x0.ccaa946119c7c8p-10, // x in subrange 0:40 (0.203125..0.205078)
+     0x0.cdde1ed4d0bdc0p0, -0x0.cc066b4f75b098p-10, // x in subrange 0:41 (0.205078..0.207031)
+     0x0.cd784485f012a0p0, -0x0.cb62ec82715708p-10, // x in subrange 0:42 (0.207031..0.208984)
+     0x0.cd12bbcc108c18p0, -0x0.cac01727f8c3f8p-10, // x in subrange 0:43 (0.208984..0.210938)
+     0x0.ccad8452ad2ba8p0, -0x0.ca1dea6f1f51d0p-10, // x in subrange 0:44 (0.210938..0.212891)
+     0x0.cc489dc5a91fb8p0, -0x0.c97c65881ddfb8p-10, // x in subrange 0:45 (0.212891..0.214844)
+     0x0.cbe407d14f3148p0, -0x0.c8db87a4510808p-10, // x in subrange 0:46 (0.214844..0.216797)
+     0x0.cb7fc222513270p0, -0x0.c83b4ff6375958p-10, // x in subrange 0:47 (0.216797..0.21875)
+     0x0.cb1bcc65c76de0p0, -0x0.c79bbdb16f9300p-10, // x in subrange 0:48 (0.21875..0.220703)
+     0x0.cab82649301740p0, -0x0.c6fcd00ab6e480p-10, // x in subrange 0:49 (0.220703..0.222656)
+     0x0.ca54cf7a6ebc68p0, -0x0.c65e8637e72f88p-10, // x in subrange 0:50 (0.222656..0.224609)
+     0x0.c9f1c7a7cbb758p0, -0x0.c5c0df6ff54d98p-10, // x in subrange 0:51 (0.224609..0.226562)
+     0x0.c98f0e7ff3a150p0, -0x0.c523daeaef57e0p-10, // x in subrange 0:52 (0.226562..0.228516)
+     0x0.c92ca3b1f6c698p0, -0x0.c48777e1faf2a8p-10, // x in subrange 0:53 (0.228516..0.230469)
+     0x0.c8ca86ed489b10p0, -0x0.c3ebb58f539b08p-10, // x in subrange 0:54 (0.230469..0.232422)
+     0x0.c868b7e1bf2fc0p0, -0x0.c350932e48f800p-10, // x in subrange 0:55 (0.232422..0.234375)
+     0x0.c807363f92a920p0, -0x0.c2b60ffb3d2e30p-10, // x in subrange 0:56 (0.234375..0.236328)
+     0x0.c7a601b75cb670p0, -0x0.c21c2b33a33638p-10, // x in subrange 0:57 (0.236328..0.238281)
+     0x0.c74519fa180970p0, -0x0.c182e415fd3648p-10, // x in subrange 0:58 (0.238281..0.240234)
+     0x0.c6e47eb91fcf70p0, -0x0.c0ea39e1dade38p-10, // x in subrange 0:59 (0.240234..0.242188)
+     0x0.c6842fa62f2ad8p0, -0x0.c0522bd7d7c678p-10, // x in subrange 0:60 (0.242188..0.244141)
+     0x0.c6242c7360ad98p0, -0x0.bfbab93999d1b0p-10, // x in subrange 0:61 (0.244141..0.246094)
+     0x0.c5c474d32dd488p0, -0x0.bf23e149cf9148p-10, // x in subrange 0:62 (0.246094..0.248047)
+     0x0.c56508786e8340p0, -0x0.be8da34c2eac70p-10, // x in subrange 0:63 (0.248047..0.25)
+     0x0.c4d6726aa75860p0, -0x0.bdad655c6b6348p-9, // x in subrange 1:0 (0.25..0.253906)
+     0x0.c41959ac606148p0, -0x0.bc847c20f46508p-9, // x in subrange 1:1 (0.253906..0.257812)
+     0x0.c35d68a97b67c0p0, -0x0.bb5deda41c99e8p-9, // x in subrange 1:2 (0.257812..0.261719)
+     0x0.c2a29d0a142358p0, -0x0.ba39b433d91828p-9, // x in subrange 1:3 (0.261719..0.265625)
+     0x0.c1e8f47bf076f0p0, -0x0.b917ca2dd60728p-9, // x in subrange 1:4 (0.265625..0.269531)
+     0x0.c1306cb270d1c8p0, -0x0.b7f829ff4674e8p-9, // x in subrange 1:5 (0.269531..0.273438)
+     0x0.c079036680c080p0, -0x0.b6dace24b4ccc8p-9, // x in subrange 1:6 (0.273438..0.277344)
+     0x0.bfc2b65687ad30p0, -0x0.b5bfb129d3ed10p-9, // x in subrange 1:7 (0.277344..0.28125)
+     0x0.bf0d834659ce20p0, -0x0.b4a6cda950d908p-9, // x in subrange 1:8 (0.28125..0.285156)
+     0x0.be5967ff2942a8p0, -0x0.b3901e4ca50588p-9, // x in subrange 1:9 (0.285156..0.289062)
+     0x0.bda6624f775d28p0, -0x0.b27b9dcbe93d90p-9, // x in subrange 1:10 (0.289062..0.292969)
+     0x0.bcf4700b061a38p0, -0x0.b16946eda91d58p-9, // x in subrange 1:11 (0.292969..0.296875)
+     0x0.bc438f0ac9c3b0p0, -0x0.b0591486b720d8p-9, // x in subrange 1:12 (0.296875..0.300781)
+     0x0.bb93bd2cdabf98p0, -0x0.af4b017a0144d0p-9, // x in subrange 1:13 (0.300781..0.304688)
+     0x0.bae4f854678a10p0, -0x0.ae3f08b8663720p-9, // x in subrange 1:14 (0.304688..0.308594)
+     0x0.ba373e69a6d9e8p0, -0x0.ad3525408b1578p-9, // x in subrange 1:15 (0.308594..0.3125)
+     0x0.b98a8d59c9eee8p0, -0x0.ac2d521eb1b790p-9, // x in subrange 1:16 (0.3125..0.316406)
+     0x0.b8dee316ef09e0p0, -0x0.ab278a6c8f8380p-9, // x in subrange 1:17 (0.316406..0.320312)
+     0x0.b8343d98140d68p0, -0x0.aa23c95124ca28p-9, // x in subrange 1:18 (0.320312..0.324219)
+     0x0.b78a9ad9094708p0, -0x0.a9220a0094a978p-9, // x in subrange 1:19 (0.324219..0.328125)
+     0x0.b6e1f8da646048p0, -0x0.a82247bbfd7340p-9, // x in subrange 1:20 (0.328125..0.332031)
+     0x0.b63a55a1737710p0, -0x0.a7247dd1519640p-9, // x in subrange 1:21 (0.332031..0.335938)
+     0x0.b593af38305cf8p0, -0x0.a628a79b3107f8p-9, // x in subrange 1:22 (0.335938..0.339844)
+     0x0.b4ee03ad33fca8p0, -0x0.a52ec080c32d18p-9, // x in subrange 1:23 (0.339844..0.34375)
+     0x0.b4495113a9e570p0, -0x0.a436c3f5913f28p-9, // x in subrange 1:24 (0.34375..0.347656)
+     0x0.b3a5958343fbf0p0, -0x0.a340ad79612da0p-9, // x in subrange 1:25 (0.347656..0.351562)
+     0x0.b302cf182e4fd0p0, -0x0.a24c789810f860p-9, // x in subrange 1:26 (0.351562..0.355469)
+     0x0.b260fbf30315b0p0, -0x0.a15a20e9728248p-9, // x in subrange 1:27 (0.355469..0.359375)
+     0x0.b1c01a38bec568p0, -0x0.a069a21127da28p-9, // x in subrange 1:28 (0.359375..0.363281)
+     0x0.b1202812b45b38p0, -0x0.9f7af7be7ff828p-9, // x in subrange 1:29 (0.363281..0.367188)
+     0x0.b08123ae81bca0p0, -0x0.9e8e1dac53ee90p-9, // x in subrange 1:30 (0.367188..0.371094)
+     0x0.afe30b3e043f38p0, -0x0.9da30fa0e48ba8p-9, // x in subrange 1:31 (0.371094..0.375)
+     0x0.af45dcf74d5220p0, -0x0.9cb9c96db86be0p-9, // x in subrange 1:32 (0.375..0.378906)
+     0x0.aea997149748f8p0, -0x0.9bd246ef7a7a38p-9, // x in subrange 1:33 (0.378906..0.382812)
+     0x0.ae0e37d43a4808p0, -0x0.9aec840dd8dd60p-9, // x in subrange 1:34 (0.382812..0.386719)
+     0x0.ad73bd78a15178p0, -0x0.9a087cbb645078p-9, // x in subrange 1:35 (0.386719..0.390625)
+     0x0.acda26483f72f0p0, -0x0.99262cf56fe590p-9, // x in subrange 1:36 (0.390625..0.394531)
+     0x0.ac41708d851308p0, -0x0.984590c3f130b8p-9, // x in subrange 1:37 (0.394531..0.398438)
+     0x0.aba99a96d55ea8p0, -0x0.9766a43960da00p-9, // x in subrange 1:38 (0.398438..0.402344)
+     0x0.ab12a2b67bd580p0, -0x0.968963729b9528p-9, // x in subrange 1:39 (0.402344..0.40625)
+     0x0.aa7c8742a1f550p0, -0x0.95adca96c37d88p-9, // x in subrange 1:40 (0.40625..0.410156)
+     0x0.a9e74695450398p0, -0x0.94d3d5d721d4d8p-9, // x in subrange 1:41 (0.410156..0.414062)
+     0x0.a952df0c2bf588p0, -0x0.93fb816f092380p-9, // x in subrange 1:42 (0.414062..0.417969)
+     0x0.a8bf4f08dd7570p0, -0x0.9324c9a3b7b928p-9, // x in subrange 1:43 (0.417969..0.421875)
+     0x0.a82c94f0960598p0, -0x0.924faac43a8c10p-9, // x in subrange 1:44 (0.421875..0.425781)
+     0x0.a79aaf2c3e3fe8p0, -0x0.917c2129507620p-9, // x in subrange 1:45 (0.425781..0.429688)
+     0x0.a7099c28613278p0, -0x0.90aa29354dce38p-9, // x in subrange 1:46 (0.429688..0.433594)
+     0x0.a6795a5522d7e0p0, -0x0.8fd9bf54005cc0p-9, // x in subrange 1:47 (0.433594..0.4375)
+     0x0.a5e9e82636abd8p0, -0x0.8f0adffa93a9c8p-9, // x in subrange 1:48 (0.4375..0.441406)
+     0x0.a55b4412d65b08p0, -0x0.8e3d87a775a418p-9, // x in subrange 1:49 (0.441406..0.445312)
+     0x0.a4cd6c95b88e48p0, -0x0.8d71b2e23b9f80p-9, // x in subrange 1:50 (0.445312..0.449219)
+     0x0.a440602d07d090p0, -0x0.8ca75e3b87a9a0p-9, // x in subrange 1:51 (0.449219..0.453125)
+     0x0.a3b41d5a598f48p0, -0x0.8bde864cee3360p-9, // x in subrange 1:52 (0.453125..0.457031)
+     0x0.a328a2a2a53540p0, -0x0.8b1727b8dc0ee8p-9, // x in subrange 1:53 (0.457031..0.460938)
+     0x0.a29dee8e3b5ed0p0, -0x0.8a513f2a7cc000p-9, // x in subrange 1:54 (0.460938..0.464844)
+     0x0.a213ffa8bd2828p0, -0x0.898cc955a11e48p-9, // x in subrange 1:55 (0.464844..0.46875)
+     0x0.a18ad481139460p0, -0x0.88c9c2f6a64820p-9, // x in subrange 1:56 (0.46875..0.472656)
+     0x0.a1026ba9670d90p0, -0x0.880828d25ce4f0p-9, // x in subrange 1:57 (0.472656..0.476562)
+     0x0.a07ac3b716fdb0p0, -0x0.8747f7b5f0b608p-9, // x in subrange 1:58 (0.476562..0.480469)
+     0x0.9ff3db42b17f68p0, -0x0.86892c76d074e0p-9, // x in subrange 1:59 (0.480469..0.484375)
+     0x0.9f6db0e7eb2720p0, -0x0.85cbc3f295fdb8p-9, // x in subrange 1:60 (0.484375..0.488281)
+     0x0.9ee8434596e3b8p0, -0x0.850fbb0eeec588p-9, // x in subrange 1:61 (0.488281..0.492188)
+     0x0.9e6390fd9df660p0, -0x0.84550eb9849a50p-9, // x in subrange 1:62 (0.492188..0.496094)
+     0x0.9ddf98b4f801f8p0, -0x0.839bbbe7e6acd8p-9, // x in subrange 1:63 (0.496094..0.5)
+     0x0.9d1afe17088270p0, -0x0.828840f0f32358p-8, // x in subrange 2:0 (0.5..0.507812)
+     0x0.9c175925b83210p0, -0x0.811d8fc78f3390p-8, // x in subrange 2:1 (0.507812..0.515625)
+     0x0.9b168462077cc8p0, -0x0.ff701eec9bde50p-9, // x in subrange 2:2 (0.515625..0.523438)
+     0x0.9a1875814107f0p0, -0x0.fcaf522bae40d8p-9, // x in subrange 2:3 (0.523438..0.53125)
+     0x0.991d2266099980p0, -0x0.f9f88c65e6e100p-9, // x in subrange 2:4 (0.53125..0.539062)
+     0x0.9824811f7a6a90p0, -0x0.f74ba197f58e28p-9, // x in subrange 2:5 (0.539062..0.546875)
+     0x0.972e87e8408d38p0, -0x0.f4a8669ca53680p-9, // x in subrange 2:6 (0.546875..0.554688)
+     0x0.963b2d25c14620p0, -0x0.f20eb127f794e8p-9, // x in subrange 2:7 (0.554688..0.5625)
+     0x0.954a6767433b50p0, -0x0.ef7e57c25f1b38p-9, // x in subrange 2:8 (0.5625..0.570312)
+     0x0.945c2d651c5a18p0, -0x0.ecf731c4164eb0p-9, // x in subrange 2:9 (0.570312..0.578125)
+     0x0.937075ffe45758p0, -0x0.ea79175093d238p-9, // x in subrange 2:10 (0.578125..0.585938)
+     0x0.9287383fabade0p0, -0x0.e803e1521a5f60p-9, // x in subrange 2:11 (0.585938..0.59375)
+     0x0.91a06b5336feb0p0, -0x0.e597697563f4b8p-9, // x in subrange 2:12 (0.59375..0.601562)
+     0x0.90bc068f3eb950p0, -0x0.e3338a256784c8p-9, // x in subrange 2:13 (0.601562..0.609375)
+     0x0.8fda016db2f118p0, -0x0.e0d81e87387630p-9, // x in subrange 2:14 (0.609375..0.617188)
+     0x0.8efa538d034678p0, -0x0.de850275ff4a88p-9, // x in subrange 2:15 (0.617188..0.625)
+     0x0.8e1cf4af6acb68p0, -0x0.dc3a127f0ac5e8p-9, // x in subrange 2:16 (0.625..0.632812)
+     0x0.8d41dcba3fca78p0, -0x0.d9f72bddf8f5f0p-9, // x in subrange 2:17 (0.632812..0.640625)
+     0x0.8c6903b5475968p0, -0x0.d7bc2c78f77b18p-9, // x in subrange 2:18 (0.640625..0.648438)
+     0x0.8b9261ca0c9fe8p0, -0x0.d588f2dd1a7c60p-9, // x in subrange 2:19 (0.648438..0.65625)
+     0x0.8abdef433bbc50p0, -0x0.d35d5e3ac9b050p-9, // x in subrange 2:20 (0.65625..0.664062)
+     0x0.89eba48c0030c8p0, -0x0.d1394e6242eb50p-9, // x in subrange 2:21 (0.664062..0.671875)
+     0x0.891b7a2f66c2c8p0, -0x0.cf1ca3c031a718p-9, // x in subrange 2:22 (0.671875..0.679688)
+     0x0.884d68d7c2b978p0, -0x0.cd073f5a5afa70p-9, // x in subrange 2:23 (0.679688..0.6875)
+     0x0.8781694e1665a0p0, -0x0.caf902cc5d7c98p-9, // x in subrange 2:24 (0.6875..0.695312)
+     0x0.86b774797ee000p0, -0x0.c8f1d044849310p-9, // x in subrange 2:25 (0.695312..0.703125)
+     0x0.85ef835ea2eb38p0, -0x0.c6f18a80aeac68p-9, // x in subrange 2:26 (0.703125..0.710938)
+     0x0.85298f1f24e5a0p0, -0x0.c4f814cb45ed10p-9, // x in subrange 2:27 (0.710938..0.71875)
+     0x0.846590f917b9e8p0, -0x0.c30552f84ad830p-9, // x in subrange 2:28 (0.71875..0.726562)
+     0x0.83a3824676bc18p0, -0x0.c1192962708000p-9, // x in subrange 2:29 (0.726562..0.734375)
+     0x0.82e35c7ca061a0p0, -0x0.bf337ce849cd58p-9, // x in subrange 2:30 (0.734375..0.742188)
+     0x0.8225192bd3c3f8p0, -0x0.bd5432e98770c8p-9, // x in subrange 2:31 (0.742188..0.75)
+     0x0.8168b1feb0dd28p0, -0x0.bb7b31444612a8p-9, // x in subrange 2:32 (0.75..0.757812)
+     0x0.80ae20b9bb6e08p0, -0x0.b9a85e526c5a50p-9, // x in subrange 2:33 (0.757812..0.765625)
+     0x0.ffeabe75c0fda0p-1, -0x0.b7dba0e7186738p-9, // x in subrange 2:34 (0.765625..0.773438)
+     0x0.fe7ccef1fcd528p-1, -0x0.b614e04c1c5a38p-9, // x in subrange 2:35 (0.773438..0.78125)
+     0x0.fd126706decdb0p-1, -0x0.b454043f898e98p-9, // x in subrange 2:36 (0.78125..0.789062)
+     0x0.fbab7b032cf198p-1, -0x0.b298f4f14a2670p-9, // x in subrange 2:37 (0.789062..0.796875)
+     0x0.fa47ff64dd93c8p-1, -0x0.b0e39b00c88ee8p-9, // x in subrange 2:38 (0.796875..0.804688)
+     0x0.f8e7e8d83a9c18p-1, -0x0.af33df7aa4a530p-9, // x in subrange 2:39 (0.804688..0.8125)
+     0x0.f78b2c37095c50p-1, -0x0.ad89abd67624e8p-9, // x in subrange 2:40 (0.8125..0.820312)
+     0x0.f631be87b6d318p-1, -0x0.abe4e9f49c0da0p-9, // x in subrange 2:41 (0.820312..0.828125)
+     0x0.f4db94fc884390p-1, -0x0.aa45841c18ad28p-9, // x in subrange 2:42 (0.828125..0.835938)
+     0x0.f388a4f2d00840p-1, -0x0.a8ab64f879ffc0p-9, // x in subrange 2:43 (0.835938..0.84375)
+     0x0.f238e3f2268958p-1, -0x0.a7167797ce18c0p-9, // x in subrange 2:44 (0.84375..0.851562)
+     0x0.f0ec47aba73e50p-1, -0x0.a586a768a34900p-9, // x in subrange 2:45 (0.851562..0.859375)
+     0x0.efa2c5f931a3a8p-1, -0x0.a3fbe03813b908p-9, // x in subrange 2:46 (0.859375..0.867188)
+     0x0.ee5c54dcae0e68p-1, -0x0.a2760e2fdc3088p-9, // x in subrange 2:47 (0.867188..0.875)
+     0x0.ed18ea7f5646c8p-1, -0x0.a0f51dd47dc530p-9, // x in subrange 2:48 (0.875..0.882812)
+     0x0.ebd87d3101d538p-1, -0x0.9f78fc036a2d78p-9, // x in subrange 2:49 (0.882812..0.890625)
+     0x0.ea9b036775ec00p-1, -0x0.9e0195f13a7568p-9, // x in subrange 2:50 (0.890625..0.898438)
+     0x0.e96073bdb8d970p-1, -0x0.9c8ed927efd530p-9, // x in subrange 2:51 (0.898438..0.90625)
+     0x0.e828c4f368ee78p-1, -0x0.9b20b3853e6b80p-9, // x in subrange 2:52 (0.90625..0.914062)
+     0x0.e6f3edec16c608p-1, -0x0.99b71338e19e08p-9, // x in subrange 2:53 (0.914062..0.921875)
+     0x0.e5c1e5aea2da30p-1, -0x0.9851e6c2f9e598p-9, // x in subrange 2:54 (0.921875..0.929688)
+     0x0.e492a3649e54b8p-1, -0x0.96f11cf273cb70p-9, // x in subrange 2:55 (0.929688..0.9375)
+     0x0.e3661e59af0838p-1, -0x0.9594a4e377e018p-9, // x in subrange 2:56 (0.9375..0.945312)
+     0x0.e23c4dfaf68108p-1, -0x0.943c6dfde374a0p-9, // x in subrange 2:57 (0.945312..0.953125)
+     0x0.e11529d67c1bb0p-1, -0x0.92e867f3c9e0a0p-9, // x in subrange 2:58 (0.953125..0.960938)
+     0x0.dff0a99a9a10a8p-1, -0x0.919882bffe2170p-9, // x in subrange 2:59 (0.960938..0.96875)
+     0x0.decec5156d64c0p-1, -0x0.904caea4a49fa0p-9, // x in subrange 2:60 (0.96875..0.976562)
+     0x0.ddaf743448ad98p-1, -0x0.8f04dc29cce930p-9, // x in subrange 2:61 (0.976562..0.984375)
+     0x0.dc92af03299b70p-1, -0x0.8dc0fc1c133060p-9, // x in subrange 2:62 (0.984375..0.992188)
+     0x0.db786dac3137c8p-1, -0x0.8c80ff8b496080p-9, // x in subrange 2:63 (0.992188..1)
+     0x0.d9d5b207b0b0e8p-1, -0x0.8aa82f30d34900p-8, // x in subrange 3:0 (1..1.01562)
+     0x0.d7afe8e2e47c38p-1, -0x0.883ed957e7bf50p-8, // x in subrange 3:1 (1.01562..1.03125)
+     0x0.d593a7d56f4c08p-1, -0x0.85e41140c823a0p-8, // x in subrange 3:2 (1.03125..1.04688)
+     0x0.d380b581042390p-1, -0x0.83976b2c2eb298p-8, // x in subrange 3:3 (1.04688..1.0625)
+     0x0.d176da2f056d00p-1, -0x0.81587efbabd040p-8, // x in subrange 3:4 (1.0625..1.07812)
+     0x0.cf75dfc248b308p-1, -0x0.fe4dd01cbb1178p-9, // x in subrange 3:5 (1.07812..1.09375)
+     0x0.cd7d91a96480c0p-1, -0x0.fa048a3e4403e0p-9, // x in subrange 3:6 (1.09375..1.10938)
+     0x0.cb8dbcd1829ec8p-1, -0x0.f5d470486725a0p-9, // x in subrange 3:7 (1.10938..1.125)
+     0x0.c9a62f99b12868p-1, -0x0.f1bccc603c1c18p-9, // x in subrange 3:8 (1.125..1.14062)
+     0x0.c7c6b9c6ad3338p-1, -0x0.edbceea7fb37d8p-9, // x in subrange 3:9 (1.14062..1.15625)
+     0x0.c5ef2c77220140p-1, -0x0.e9d42d05f08550p-9, // x in subrange 3:10 (1.15625..1.17188)
+     0x0.c41f5a1857ef40p-1, -0x0.e601e2edc7ea48p-9, // x in subrange 3:11 (1.17188..1.1875)
+     0x0.c257165b4e8830p-1, -0x0.e245712c176008p-9, // x in subrange 3:12 (1.1875..1.20312)
+     0x0.c096362a3d5bf0p-1, -0x0.de9e3db40da5d0p-9, // x in subrange 3:13 (1.20312..1.21875)
+     0x0.bedc8f9e776838p-1, -0x0.db0bb36f2d03f0p-9, // x in subrange 3:14 (1.21875..1.23438)
+     0x0.bd29f9f6ad1370p-1, -0x0.d78d420efae298p-9, // x in subrange 3:15 (1.23438..1.25)
+     0x0.bb7e4d8d88e660p-1, -0x0.d4225de08e1408p-9, // x in subrange 3:16 (1.25..1.26562)
+     0x0.b9d963d0a35bd8p-1, -0x0.d0ca7fa1e6bf50p-9, // x in subrange 3:17 (1.26562..1.28125)
+     0x0.b83b1737ca47e8p-1, -0x0.cd852458fbd880p-9, // x in subrange 3:18 (1.28125..1.29688)
+     0x0.b6a3433c987e80p-1, -0x0.ca51cd2c6b0710p-9, // x in subrange 3:19 (1.29688..1.3125)
+     0x0.b511c4525a8748p-1, -0x0.c72fff3db8c0b0p-9, // x in subrange 3:20 (1.3125..1.32812)
+     0x0.b38677de3d4f70p-1, -0x0.c41f43850f3aa0p-9, // x in subrange 3:21 (1.32812..1.34375)
+     0x0.b2013c2fc3eca0p-1, -0x0.c11f26ae6ba400p-9, // x in subrange 3:22 (1.34375..1.35938)
+     0x0.b081f07981a460p-1, -0x0.be2f38f829e040p-9, // x in subrange 3:23 (1.35938..1.375)
+     0x0.af0874ca158a68p-1, -0x0.bb4f0e12dfb5b8p-9, // x in subrange 3:24 (1.375..1.39062)
+     0x0.ad94aa056524a8p-1, -0x0.b87e3d02791620p-9, // x in subrange 3:25 (1.39062..1.40625)
+     0x0.ac2671de13a1a0p-1, -0x0.b5bc600087d0e8p-9, // x in subrange 3:26 (1.40625..1.42188)
+     0x0.aabdaecf334670p-1, -0x0.b309145fb9a050p-9, // x in subrange 3:27 (1.42188..1.4375)
+     0x0.a95a44162ed510p-1, -0x0.b063fa70681b68p-9, // x in subrange 3:28 (1.4375..1.45312)
+     0x0.a7fc15ace8c2b0p-1, -0x0.adccb56636a968p-9, // x in subrange 3:29 (1.45312..1.46875)
+     0x0.a6a308440e2dc0p-1, -0x0.ab42eb3eb31d00p-9, // x in subrange 3:30 (1.46875..1.48438)
+     0x0.a54f013d9b98f0p-1, -0x0.a8c644a8ee2268p-9, // x in subrange 3:31 (1.48438..1.5)
+     0x0.a3ffe6a7918678p-1, -0x0.a6566cee012840p-9, // x in subrange 3:32 (1.5..1.51562)
+     0x0.a2b59f36d72220p-1, -0x0.a3f311da77e348p-9, // x in subrange 3:33 (1.51562..1.53125)
+     0x0.a1701242493ca0p-1, -0x0.a19be3a893fde8p-9, // x in subrange 3:34 (1.53125..1.54688)
+     0x0.a02f27bdf3ed08p-1, -0x0.9f5094eb61f120p-9, // x in subrange 3:35 (1.54688..1.5625)
+     0x0.9ef2c836753e60p-1, -0x0.9d10da7a966b60p-9, // x in subrange 3:36 (1.5625..1.57812)
+     0x0.9dbadccc8760f8p-1, -0x0.9adc6b5f2c0c08p-9, // x in subrange 3:37 (1.57812..1.59375)
+     0x0.9c874f30b0e668p-1, -0x0.98b300c0b99728p-9, // x in subrange 3:38 (1.59375..1.60938)
+     0x0.9b58099f199f00p-1, -0x0.969455d3791eb0p-9, // x in subrange 3:39 (1.60938..1.625)
+     0x0.9a2cf6db82bdf0p-1, -0x0.948027c6f8f2a8p-9, // x in subrange 3:40 (1.625..1.64062)
+     0x0.9906022d60f798p-1, -0x0.927635b56f7aa8p-9, // x in subrange 3:41 (1.64062..1.65625)
+     0x0.97e3175c175a98p-1, -0x0.90764093ab6838p-9, // x in subrange 3:42 (1.65625..1.67188)
+     0x0.96c422ab51b188p-1, -0x0.8e800b2199fa58p-9, // x in subrange 3:43 (1.67188..1.6875)
+     0x0.95a910d77d4718p-1, -0x0.8c9359db5d5118p-9, // x in subrange 3:44 (1.6875..1.70312)
+     0x0.9491cf125ef220p-1, -0x0.8aaff2eaed1220p-9, // x in subrange 3:45 (1.70312..1.71875)
+     0x0.937e4affc55af0p-1, -0x0.88d59e1a3bdf20p-9, // x in subrange 3:46 (1.71875..1.73438)
+     0x0.926e72b2567518p-1, -0x0.870424c5dc5b18p-9, // x in subrange 3:47 (1.73438..1.75)
+     0x0.916234a87733e8p-1, -0x0.853b51d020b640p-9, // x in subrange 3:48 (1.75..1.76562)
+     0x0.90597fc94c8930p-1, -0x0.837af194afede8p-9, // x in subrange 3:49 (1.76562..1.78125)
+     0x0.8f544361d4c800p-1, -0x0.81c2d1dc8c23e8p-9, // x in subrange 3:50 (1.78125..1.79688)
+     0x0.8e526f22188ce0p-1, -0x0.8012c1d285a228p-9, // x in subrange 3:51 (1.79688..1.8125)
+     0x0.8d53f31a725750p-1, -0x0.fcd523f02c9f00p-10, // x in subrange 3:52 (1.8125..1.82812)
+     0x0.8c58bfb8ec06e8p-1, -0x0.f9942835431108p-10, // x in subrange 3:53 (1.82812..1.84375)
+     0x0.8b60c5c6b17808p-1, -0x0.f662369228f468p-10, // x in subrange 3:54 (1.84375..1.85938)
+     0x0.8a6bf665978220p-1, -0x0.f33ef793c68e80p-10, // x in subrange 3:55 (1.85938..1.875)
+     0x0.897a430db6a208p-1, -0x0.f02a1622becdd0p-10, // x in subrange 3:56 (1.875..1.89062)
+     0x0.888b9d8b18a118p-1, -0x0.ed233f70c7a7b8p-10, // x in subrange 3:57 (1.89062..1.90625)
+     0x0.879ff7fb789108p-1, -0x0.ea2a22e6a789b0p-10, // x in subrange 3:58 (1.90625..1.92188)
+     0x0.86b744cc147a30p-1, -0x0.e73e7212d19818p-10, // x in subrange 3:59 (1.92188..1.9375)
+     0x0.85d176b79020e8p-1, -0x0.e45fe0989ab620p-10, // x in subrange 3:60 (1.9375..1.95312)
+     0x0.84ee80c3e84bb8p-1, -0x0.e18e2420019258p-10, // x in subrange 3:61 (1.95312..1.96875)
+     0x0.840e564075fa60p-1, -0x0.dec8f446042f90p-10, // x in subrange 3:62 (1.96875..1.98438)
+     0x0.8330eac40102b0p-1, -0x0.dc100a8d7d9bb8p-10, // x in subrange 3:63 (1.98438..2)
+     0x0.81e9d53b006660p-1, -0x0.d81119c9e74368p-9, // x in subrange 4:0 (2..2.03125)
+     0x0.803ee60343fef0p-1, -0x0.d2e5b1abd447e0p-9, // x in subrange 4:1 (2.03125..2.0625)
+     0x0.fd3c4198014d48p-2, -0x0.cde6c6e1c2e400p-9, // x in subrange 4:2 (2.0625..2.09375)
+     0x0.fa0e5d017bf7b8p-2, -0x0.c9127764c7bc40p-9, // x in subrange 4:3 (2.09375..2.125)
+     0x0.f6f3777133c418p-2, -0x0.c466f968027760p-9, // x in subrange 4:4 (2.125..2.15625)
+     0x0.f3eaf10e7b0420p-2, -0x0.bfe299f3810288p-9, // x in subrange 4:5 (2.15625..2.1875)
+     0x0.f0f430a10a7a70p-2, -0x0.bb83bb96215f80p-9, // x in subrange 4:6 (2.1875..2.21875)
+     0x0.ee0ea33d5e77e8p-2, -0x0.b748d52cd166a0p-9, // x in subrange 4:7 (2.21875..2.25)
+     0x0.eb39bbf5cec480p-2, -0x0.b33070bdabe188p-9, // x in subrange 4:8 (2.25..2.28125)
+     0x0.e874f39014ad50p-2, -0x0.af392a658fbdf8p-9, // x in subrange 4:9 (2.28125..2.3125)
+     0x0.e5bfc83ef7e960p-2, -0x0.ab61af56e90900p-9, // x in subrange 4:10 (2.3125..2.34375)
+     0x0.e319bd5fdff4b0p-2, -0x0.a7a8bce87c2148p-9, // x in subrange 4:11 (2.34375..2.375)
+     0x0.e0825b3c0c1198p-2, -0x0.a40d1fb31a4e30p-9, // x in subrange 4:12 (2.375..2.40625)
+     0x0.ddf92ecd3859c8p-2, -0x0.a08db2bd3bd0b0p-9, // x in subrange 4:13 (2.40625..2.4375)
+     0x0.db7dc9857a2fe0p-2, -0x0.9d295eb38ec090p-9, // x in subrange 4:14 (2.4375..2.46875)
+     0x0.d90fc11a2202b8p-2, -0x0.99df192d9bbb70p-9, // x in subrange 4:15 (2.46875..2.5)
+     0x0.d6aeaf5173ad08p-2, -0x0.96ade3fdb1b930p-9, // x in subrange 4:16 (2.5..2.53125)
+     0x0.d45a31d309d998p-2, -0x0.9394cc8b595d90p-9, // x in subrange 4:17 (2.53125..2.5625)
+     0x0.d211e9fabbb568p-2, -0x0.9092eb379df7b8p-9, // x in subrange 4:18 (2.5625..2.59375)
+     0x0.cfd57caddee7b8p-2, -0x0.8da762ca8723f8p-9, // x in subrange 4:19 (2.59375..2.625)
+     0x0.cda49232c243a8p-2, -0x0.8ad15fe929cbe0p-9, // x in subrange 4:20 (2.625..2.65625)
+     0x0.cb7ed60a3ff600p-2, -0x0.88101893c22120p-9, // x in subrange 4:21 (2.65625..2.6875)
+     0x0.c963f6cb481770p-2, -0x0.8562cbab523900p-9, // x in subrange 4:22 (2.6875..2.71875)
+     0x0.c753a600468968p-2, -0x0.82c8c07e4a3798p-9, // x in subrange 4:23 (2.71875..2.75)
+     0x0.c54d980648dfb0p-2, -0x0.8041465bc78bd8p-9, // x in subrange 4:24 (2.75..2.78125)
+     0x0.c35183edcad198p-2, -0x0.fb97685a015b18p-10, // x in subrange 4:25 (2.78125..2.8125)
+     0x0.c15f235d1149b0p-2, -0x0.f6ced028f449b0p-10, // x in subrange 4:26 (2.8125..2.84375)
+     0x0.bf763273fda9f8p-2, -0x0.f2278e2550dc88p-10, // x in subrange 4:27 (2.84375..2.875)
+     0x0.bd966fb1443f70p-2, -0x0.eda0795f513218p-10, // x in subrange 4:28 (2.875..2.90625)
+     0x0.bbbf9bd8f22c30p-2, -0x0.e93875537ea3e8p-10, // x in subrange 4:29 (2.90625..2.9375)
+     0x0.b9f179dc3046a0p-2, -0x0.e4ee7150a6e850p-10, // x in subrange 4:30 (2.9375..2.96875)
+     0x0.b82bcec2318c38p-2, -0x0.e0c167e63c7928p-10, // x in subrange 4:31 (2.96875..3)
+     0x0.b66e61923cd5e8p-2, -0x0.dcb05e5a9fc408p-10, // x in subrange 4:32 (3..3.03125)
+     0x0.b4b8fb3ec27790p-2, -0x0.d8ba6428d74aa0p-10, // x in subrange 4:33 (3.03125..3.0625)
+     0x0.b30b66916f5f88p-2, -0x0.d4de928544dc10p-10, // x in subrange 4:34 (3.0625..3.09375)
+     0x0.b1657018302850p-2, -0x0.d11c0be8ed8218p-10, // x in subrange 4:35 (3.09375..3.125)
+     0x0.afc6e613175aa0p-2, -0x0.cd71fba2f0a810p-10, // x in subrange 4:36 (3.125..3.15625)
+     0x0.ae2f98631ae068p-2, -0x0.c9df956fd16ec0p-10, // x in subrange 4:37 (3.15625..3.1875)
+     0x0.ac9f58799d5bc8p-2, -0x0.c66415163b1c88p-10, // x in subrange 4:38 (3.1875..3.21875)
+     0x0.ab15f948b8be98p-2, -0x0.c2febe08ef2950p-10, // x in subrange 4:39 (3.21875..3.25)
+     0x0.a9934f34401be8p-2, -0x0.bfaedb0d9093c0p-10, // x in subrange 4:40 (3.25..3.28125)
+     0x0.a81730036f41f8p-2, -0x0.bc73bde80500d0p-10, // x in subrange 4:41 (3.28125..3.3125)
+     0x0.a6a172d33f3400p-2, -0x0.b94cbf0a28a448p-10, // x in subrange 4:42 (3.3125..3.34375)
+     0x0.a531f009571e30p-2, -0x0.b6393d47962188p-10, // x in subrange 4:43 (3.34375..3.375)
+     0x0.a3c8814791d758p-2, -0x0.b3389d8d477bc0p-10, // x in subrange 4:44 (3.375..3.40625)
+     0x0.a26501601075f8p-2, -0x0.b04a4a9cd8cfa8p-10, // x in subrange 4:45 (3.40625..3.4375)
+     0x0.a1074c49d2e990p-2, -0x0.ad6db4cb38f870p-10, // x in subrange 4:46 (3.4375..3.46875)
+     0x0.9faf3f15cfeda8p-2, -0x0.aaa251c2976c18p-10, // x in subrange 4:47 (3.46875..3.5)
+     0x0.9e5cb7e4860a10p-2, -0x0.a7e79c47619228p-10, // x in subrange 4:48 (3.5..3.53125)
+     0x0.9d0f95dbffad28p-2, -0x0.a53d1400249b68p-10, // x in subrange 4:49 (3.53125..3.5625)
+     0x0.9bc7b91e44bfe8p-2, -0x0.a2a23d402b77a0p-10, // x in subrange 4:50 (3.5625..3.59375)
+     0x0.9a8502c0346168p-2, -0x0.a016a0d4b2f000p-10, // x in subrange 4:51 (3.59375..3.625)
+     0x0.994754c0c1c260p-2, -0x0.9d99cbd4902ff0p-10, // x in subrange 4:52 (3.625..3.65625)
+     0x0.980e92008f5cf0p-2, -0x0.9b2b4f722822e8p-10, // x in subrange 4:53 (3.65625..3.6875)
+     0x0.96da9e39e407b8p-2, -0x0.98cac0cf9807c0p-10, // x in subrange 4:54 (3.6875..3.71875)
+     0x0.95ab5df8f59f50p-2, -0x0.9677b8d4f17500p-10, // x in subrange 4:55 (3.71875..3.75)
+     0x0.9480b694853bc8p-2, -0x0.9431d4086dc448p-10, // x in subrange 4:56 (3.75..3.78125)
+     0x0.935a8e26c91e10p-2, -0x0.91f8b2687e7b80p-10, // x in subrange 4:57 (3.78125..3.8125)
+     0x0.9238cb86a0b4a8p-2, -0x0.8fcbf747a1d010p-10, // x in subrange 4:58 (3.8125..3.84375)
+     0x0.911b56410f4678p-2, -0x0.8dab4929e3cd70p-10, // x in subrange 4:59 (3.84375..3.875)
+     0x0.90021692fa0178p-2, -0x0.8b9651a3f5fed8p-10, // x in subrange 4:60 (3.875..3.90625)
+     0x0.8eecf563265528p-2, -0x0.898cbd3bc8bd58p-10, // x in subrange 4:61 (3.90625..3.9375)
+     0x0.8ddbdc3c75a8d8p-2, -0x0.878e3b4a927110p-10, // x in subrange 4:62 (3.9375..3.96875)
+     0x0.8cceb5485ba590p-2, -0x0.859a7de0322f38p-10, // x in subrange 4:63 (3.96875..4)
+     0x0.8b4232ab9dc0a0p-2, -0x0.82c06e23fbe910p-9, // x in subrange 5:0 (4..4.0625)
+     0x0.893e92c6e8fd88p-2, -0x0.fe2c12a099fb30p-10, // x in subrange 5:1 (4.0625..4.125)
+     0x0.87494f9c5feaf8p-2, -0x0.f72372664c4fb0p-10, // x in subrange 5:2 (4.125..4.1875)
+     0x0.8561d4e0ad0918p-2, -0x0.f062ff4796f4c8p-10, // x in subrange 5:3 (4.1875..4.25)
+     0x0.838795ff9bfe50p-2, -0x0.e9e6fd9ff94c58p-10, // x in subrange 5:4 (4.25..4.3125)
+     0x0.81ba0d9f980d68p-2, -0x0.e3abedb16f34d0p-10, // x in subrange 5:5 (4.3125..4.375)
+     0x0.fff17a5c9ee8b8p-3, -0x0.ddae8744554e80p-10, // x in subrange 5:6 (4.375..4.4375)
+     0x0.fc8658eb715858p-3, -0x0.d7ebb5a422c360p-10, // x in subrange 5:7 (4.4375..4.5)
+     0x0.f931d271912b60p-3, -0x0.d26093f0687518p-10, // x in subrange 5:8 (4.5..4.5625)
+     0x0.f5f30dae71bb30p-3, -0x0.cd0a69ba633a60p-10, // x in subrange 5:9 (4.5625..4.625)
+     0x0.f2c93bef98fb48p-3, -0x0.c7e6a7e8344958p-10, // x in subrange 5:10 (4.625..4.6875)
+     0x0.efb398711ace88p-3, -0x0.c2f2e5d782e590p-10, // x in subrange 5:11 (4.6875..4.75)
+     0x0.ecb167c9147b30p-3, -0x0.be2cdeb9e771a8p-10, // x in subrange 5:12 (4.75..4.8125)
+     0x0.e9c1f75d4b6bd8p-3, -0x0.b9926f260c4738p-10, // x in subrange 5:13 (4.8125..4.875)
+     0x0.e6e49ce225b990p-3, -0x0.b52192d8ee26b0p-10, // x in subrange 5:14 (4.875..4.9375)
+     0x0.e418b5e24470b0p-3, -0x0.b0d862a3165a00p-10, // x in subrange 5:15 (4.9375..5)
+     0x0.e15da74e174b50p-3, -0x0.acb5127e0d41c0p-10, // x in subrange 5:16 (5..5.0625)
+     0x0.deb2dd12cfea70p-3, -0x0.a8b5efc69e4880p-10, // x in subrange 5:17 (5.0625..5.125)
+     0x0.dc17c9b8278dc0p-3, -0x0.a4d95f98d74240p-10, // x in subrange 5:18 (5.125..5.1875)
+     0x0.d98be604760dd8p-3, -0x0.a11ddd4af61810p-10, // x in subrange 5:19 (5.1875..5.25)
+     0x0.d70eb0a6a38af8p-3, -0x0.9d81f904b929b0p-10, // x in subrange 5:20 (5.25..5.3125)
+     0x0.d49fade587fa18p-3, -0x0.9a045670c1d628p-10, // x in subrange 5:21 (5.3125..5.375)
+     0x0.d23e6754548e40p-3, -0x0.96a3ab85edd160p-10, // x in subrange 5:22 (5.375..5.4375)
+     0x0.cfea6b8bab09c8p-3, -0x0.935ebf66bbed80p-10, // x in subrange 5:23 (5.4375..5.5)
+     0x0.cda34de70e56b8p-3, -0x0.90346954fc5bd0p-10, // x in subrange 5:24 (5.5..5.5625)
+     0x0.cb68a6465e76c0p-3, -0x0.8d238fb83397a8p-10, // x in subrange 5:25 (5.5625..5.625)
+     0x0.c93a10d317f5e0p-3, -0x0.8a2b27353aa3f8p-10, // x in subrange 5:26 (5.625..5.6875)
+     0x0.c7172dc9149f60p-3, -0x0.874a31d5c75dc0p-10, // x in subrange 5:27 (5.6875..5.75)
+     0x0.c4ffa142904e08p-3, -0x0.847fbe3ea4c028p-10, // x in subrange 5:28 (5.75..5.8125)
+     0x0.c2f31307395bb8p-3, -0x0.81cae6f37d5a30p-10, // x in subrange 5:29 (5.8125..5.875)
+     0x0.c0f12e5e187ad8p-3, -0x0.fe55a34e645910p-11, // x in subrange 5:30 (5.875..5.9375)
+     0x0.bef9a1e21faf38p-3, -0x0.f93d5d2f9bd630p-11, // x in subrange 5:31 (5.9375..6)
+     0x0.bd0c1f5933b2c0p-3, -0x0.f44b6fea70d180p-11, // x in subrange 5:32 (6..6.0625)
+     0x0.bb285b8d866088p-3, -0x0.ef7e62a3bff028p-11, // x in subrange 5:33 (6.0625..6.125)
+     0x0.b94e0e291bc648p-3, -0x0.ead4ce393de7b0p-11, // x in subrange 5:34 (6.125..6.1875)
+     0x0.b77cf1935646d8p-3, -0x0.e64d5c46652b70p-11, // x in subrange 5:35 (6.1875..6.25)
+     0x0.b5b4c2d068c670p-3, -0x0.e1e6c6394bcc90p-11, // x in subrange 5:36 (6.25..6.3125)
+     0x0.b3f541629036a8p-3, -0x0.dd9fd476400858p-11, // x in subrange 5:37 (6.3125..6.375)
+     0x0.b23e2f2cf80258p-3, -0x0.d9775d8920c180p-11, // x in subrange 5:38 (6.375..6.4375)
+     0x0.b08f50582edb98p-3, -0x0.d56c45637bec38p-11, // x in subrange 5:39 (6.4375..6.5)
+     0x0.aee86b38134520p-3, -0x0.d17d7ca68ffbb0p-11, // x in subrange 5:40 (6.5..6.5625)
+     0x0.ad49483320e648p-3, -0x0.cda9fff85ecae0p-11, // x in subrange 5:41 (6.5625..6.625)
+     0x0.abb1b1ab0949f8p-3, -0x0.c9f0d763106ef0p-11, // x in subrange 5:42 (6.625..6.6875)
+     0x0.aa2173e6841e38p-3, -0x0.c65115bdf30310p-11, // x in subrange 5:43 (6.6875..6.75)
+     0x0.a8985cfc446298p-3, -0x0.c2c9d81f71e8d8p-11, // x in subrange 5:44 (6.75..6.8125)
+     0x0.a7163cbf0130e0p-3, -0x0.bf5a45576b4a50p-11, // x in subrange 5:45 (6.8125..6.875)
+     0x0.a59ae4aa81f3c0p-3, -0x0.bc018d7155fc08p-11, // x in subrange 5:46 (6.875..6.9375)
+     0x0.a42627d19eefc8p-3, -0x0.b8bee93db44480p-11, // x in subrange 5:47 (6.9375..7)
+     0x0.a2b7dacd280028p-3, -0x0.b59199e259a010p-11, // x in subrange 5:48 (7..7.0625)
+     0x0.a14fd3aba45420p-3, -0x0.b278e871126680p-11, // x in subrange 5:49 (7.0625..7.125)
+     0x0.9fede9e1ded300p-3, -0x0.af742584445448p-11, // x in subrange 5:50 (7.125..7.1875)
+     0x0.9e91f63c339860p-3, -0x0.ac82a8e12672a8p-11, // x in subrange 5:51 (7.1875..7.25)
+     0x0.9d3bd2d093b530p-3, -0x0.a9a3d11f35bdd0p-11, // x in subrange 5:52 (7.25..7.3125)
+     0x0.9beb5af1351148p-3, -0x0.a6d70354924478p-11, // x in subrange 5:53 (7.3125..7.375)
+     0x0.9aa06b1fe4ec38p-3, -0x0.a41baac6f65ab8p-11, // x in subrange 5:54 (7.375..7.4375)
+     0x0.995ae101f412d8p-3, -0x0.a17138a0fee670p-11, // x in subrange 5:55 (7.4375..7.5)
+     0x0.981a9b54b46c20p-3, -0x0.9ed723ab80cdf8p-11, // x in subrange 5:56 (7.5..7.5625)
+     0x0.96df79e2800328p-3, -0x0.9c4ce80aac3528p-11, // x in subrange 5:57 (7.5625..7.625)
+     0x0.95a95d78422e68p-3, -0x0.99d206fec27d38p-11, // x in subrange 5:58 (7.625..7.6875)
+     0x0.947827db7be698p-3, -0x0.976606a827f668p-11, // x in subrange 5:59 (7.6875..7.75)
+     0x0.934bbbc0bcc928p-3, -0x0.950871ce9ddd58p-11, // x in subrange 5:60 (7.75..7.8125)
+     0x0.9223fcc28aa758p-3, -0x0.92b8d7ab74a940p-11, // x in subrange 5:61 (7.8125..7.875)
+     0x0.9100cf58b1dd50p-3, -0x0.9076cbb689d6c0p-11, // x in subrange 5:62 (7.875..7.9375)
+     0x0.8fe218cff905d0p-3, -0x0.8e41e575e74c18p-11, // x in subrange 5:63 (7.9375..8)
+     0x0.8e3c2d77aecb48p-3, -0x0.8b0a57bb5943b0p-10, // x in subrange 6:0 (8..8.125)
+     0x0.8c185315690ad8p-3, -0x0.86eabd15ad2748p-10, // x in subrange 6:1 (8.125..8.25)
+     0x0.8a049a46eac980p-3, -0x0.82f91a32730230p-10, // x in subrange 6:2 (8.25..8.375)
+     0x0.88005077e6bfe8p-3, -0x0.fe65a39f7d01d8p-11, // x in subrange 6:3 (8.375..8.5)
+     0x0.860acd2a7e6460p-3, -0x0.f72aea9993f900p-11, // x in subrange 6:4 (8.5..8.625)
+     0x0.842371448309b8p-3, -0x0.f03d81ae8ed520p-11, // x in subrange 6:5 (8.625..8.75)
+     0x0.8249a66b469d48p-3, -0x0.e9992fe9122428p-11, // x in subrange 6:6 (8.75..8.875)
+     0x0.807cde6ca06230p-3, -0x0.e33a04b9adb7a8p-11, // x in subrange 6:7 (8.875..9)
+     0x0.fd792567dccf70p-4, -0x0.dd1c5240c9e6c8p-11, // x in subrange 6:8 (9..9.125)
+     0x0.fa108793f94738p-4, -0x0.d73ca81cb780e8p-11, // x in subrange 6:9 (9.125..9.25)
+     0x0.f6bef1bdae2ef0p-4, -0x0.d197ceae7a1590p-11, // x in subrange 6:10 (9.25..9.375)
+     0x0.f3837eb94b60d0p-4, -0x0.cc2ac2c9654990p-11, // x in subrange 6:11 (9.375..9.5)
+     0x0.f05d55058e0950p-4, -0x0.c6f2b1c2f7d388p-11, // x in subrange 6:12 (9.5..9.625)
+     0x0.ed4ba610e61d48p-4, -0x0.c1ecf5d987aba8p-11, // x in subrange 6:13 (9.625..9.75)
+     0x0.ea4dad8c81a668p-4, -0x0.bd1712e9585a40p-11, // x in subrange 6:14 (9.75..9.875)
+     0x0.e762b0cbf386b8p-4, -0x0.b86eb3689abb18p-11, // x in subrange 6:15 (9.875..10)
+     0x0.e489fe3067b788p-4, -0x0.b3f1a5a3a0fa00p-11, // x in subrange 6:16 (10..10.125)
+     0x0.e1c2ec9e706de8p-4, -0x0.af9dd933456930p-11, // x in subrange 6:17 (10.125..10.25)
+     0x0.df0cdafd8e4fa0p-4, -0x0.ab715ca82213d8p-11, // x in subrange 6:18 (10.25..10.375)
+     0x0.dc672fc0aa4b80p-4, -0x0.a76a5b65c42380p-11, // x in subrange 6:19 (10.375..10.5)
+     0x0.d9d15876c9fcc0p-4, -0x0.a3871ba9838d88p-11, // x in subrange 6:20 (10.5..10.625)
+     0x0.d74ac96357fab0p-4, -0x0.9fc5fcb916f4a8p-11, // x in subrange 6:21 (10.625..10.75)
+     0x0.d4d2fd1d684db0p-4, -0x0.9c2575355ee3a8p-11, // x in subrange 6:22 (10.75..10.875)
+     0x0.d26974356ea018p-4, -0x0.98a4118e3bf808p-11, // x in subrange 6:23 (10.875..11)
+     0x0.d00db4e0e7d300p-4, -0x0.95407294928340p-11, // x in subrange 6:24 (11..11.125)
+     0x0.cdbf4aab838608p-4, -0x0.91f94c27e4b118p-11, // x in subrange 6:25 (11.125..11.25)
+     0x0.cb7dc62d63fa68p-4, -0x0.8ecd63fd2b5bf0p-11, // x in subrange 6:26 (11.25..11.375)
+     0x0.c948bcc613a818p-4, -0x0.8bbb907cce3d48p-11, // x in subrange 6:27 (11.375..11.5)
+     0x0.c71fc85bd7f028p-4, -0x0.88c2b7b5ced760p-11, // x in subrange 6:28 (11.5..11.625)
+     0x0.c502871f0fae78p-4, -0x0.85e1ce6466f538p-11, // x in subrange 6:29 (11.625..11.75)
+     0x0.c2f09b51531588p-4, -0x0.8317d70a8482e8p-11, // x in subrange 6:30 (11.75..11.875)
+     0x0.c0e9ab10104de0p-4, -0x0.8063e118b14b18p-11, // x in subrange 6:31 (11.875..12)
+     0x0.beed602265d460p-4, -0x0.fb8a104c2c93c0p-12, // x in subrange 6:32 (12..12.125)
+     0x0.bcfb67ca009750p-4, -0x0.f674e66cd04b08p-12, // x in subrange 6:33 (12.125..12.25)
+     0x0.bb137296c86570p-4, -0x0.f186a8194aab78p-12, // x in subrange 6:34 (12.25..12.375)
+     0x0.b935343d296e08p-4, -0x0.ecbdcd134dbc18p-12, // x in subrange 6:35 (12.375..12.5)
+     0x0.b760636ecd60a0p-4, -0x0.e818e02b3510c8p-12, // x in subrange 6:36 (12.5..12.625)
+     0x0.b594b9b59a3760p-4, -0x0.e3967e2722fd90p-12, // x in subrange 6:37 (12.625..12.75)
+     0x0.b3d1f350cfe608p-4, -0x0.df3554bcc06928p-12, // x in subrange 6:38 (12.75..12.875)
+     0x0.b217cf14211318p-4, -0x0.daf4219c39e740p-12, // x in subrange 6:39 (12.875..13)
+     0x0.b0660e48a5ace0p-4, -0x0.d6d1b18b3283a0p-12, // x in subrange 6:40 (13..13.125)
+     0x0.aebc748f889fa0p-4, -0x0.d2ccdf8e7fb080p-12, // x in subrange 6:41 (13.125..13.25)
+     0x0.ad1ac7c65432c0p-4, -0x0.cee494219a5e30p-12, // x in subrange 6:42 (13.25..13.375)
+     0x0.ab80cfecc2a3d0p-4, -0x0.cb17c47ac7a450p-12, // x in subrange 6:43 (13.375..13.5)
+     0x0.a9ee570bfa7c78p-4, -0x0.c76571db0fc4c0p-12, // x in subrange 6:44 (13.5..13.625)
+     0x0.a863291f1fe060p-4, -0x0.c3cca8e92ce660p-12, // x in subrange 6:45 (13.625..13.75)
+     0x0.a6df13fd25ac00p-4, -0x0.c04c8116abdae0p-12, // x in subrange 6:46 (13.75..13.875)
+     0x0.a561e743cab8d8p-4, -0x0.bce41c0e88bd58p-12, // x in subrange 6:47 (13.875..14)
+     0x0.a3eb7443b0fa00p-4, -0x0.b992a52c9f5f70p-12, // x in subrange 6:48 (14..14.125)
+     0x0.a27b8ded7d65b8p-4, -0x0.b65750fd546b48p-12, // x in subrange 6:49 (14.125..14.25)
+     0x0.a11208bff0cd08p-4, -0x0.b3315cc4e7f9a0p-12, // x in subrange 6:50 (14.25..14.375)
+     0x0.9faebab6ead370p-4, -0x0.b0200e0ded35d8p-12, // x in subrange 6:51 (14.375..14.5)
+     0x0.9e517b3b493940p-4, -0x0.ad22b23e6c9c00p-12, // x in subrange 6:52 (14.5..14.625)
+     0x0.9cfa23139695f8p-4, -0x0.aa389e333f7dd0p-12, // x in subrange 6:53 (14.625..14.75)
+     0x0.9ba88c557c7a90p-4, -0x0.a7612de13bdc28p-12, // x in subrange 6:54 (14.75..14.875)
+     0x0.9a5c9257edbd50p-4, -0x0.a49bc3fbcf5520p-12, // x in subrange 6:55 (14.875..15)
+     0x0.991611a5fe6c40p-4, -0x0.a1e7c9a0aefa30p-12, // x in subrange 6:56 (15..15.125)
+     0x0.97d4e7f25f9198p-4, -0x0.9f44ae084864d8p-12, // x in subrange 6:57 (15.125..15.25)
+     0x0.9698f40b7595a8p-4, -0x0.9cb1e63aa65df8p-12, // x in subrange 6:58 (15.25..15.375)
+     0x0.956215d000a090p-4, -0x0.9a2eecc880f130p-12, // x in subrange 6:59 (15.375..15.5)
+     0x0.94302e244ee8d8p-4, -0x0.97bb418835dd60p-12, // x in subrange 6:60 (15.5..15.625)
+     0x0.93031ee7f15cb8p-4, -0x0.955669566b0348p-12, // x in subrange 6:61 (15.625..15.75)
+     0x0.91dacaebeb8da8p-4, -0x0.92ffedda20ca48p-12, // x in subrange 6:62 (15.75..15.875)
+     0x0.90b715e9583460p-4, -0x0.90b75d4bfe71f0p-12, // x in subrange 6:63 (15.875..16)
+};
+alignas(64) static CERF_INLINE_CONST double CerfErfcxCoeffs1[448 * 8] = {
+ 0x0.c203ef3ea45d50p-20, -0x0.8ac5a82914f488p-30, 0x0.b08888cf777988p-41, -0x0.cc3e7dab38e338p-52, 0x0.da3976dc134100p-63, -0x0.d9b66ca2fb89f0p-74, 0x0.cc82dfe7160cf0p-85, -0x0.b61267c97860a0p-96, // x in subrange 0:0 (0.125..0.126953)
+ 0x0.c1344ae9135c08p-20, -0x0.8a159f033fcbb8p-30, 0x0.af8a06d168f2b8p-41, -0x0.caf84485c45518p-52, 0x0.d8bddc94789600p-63, -0x0.d81eff78e130b0p-74, 0x0.caeae79125c1d0p-85, -0x0.b491ff689c9fd0p-96, // x in subrange 0:1 (0.126953..0.128906)
+ 0x0.c065ade2bf6160p-20, -0x0.89669393fb6298p-30, 0x0.ae8d1b37c6fad0p-41, -0x0.c9b442b2602410p-52, 0x0.d7450883ec8c80p-63, -0x0.d68abee0ec5fa8p-74, 0x0.c9564c63fdc300p-85, -0x0.b314ececc79b78p-96, // x in subrange 0:2 (0.128906..0.130859)
+ 0x0.bf9816b046ae98p-20, -0x0.88b88446450268p-30, 0x0.ad91c340031588p-41, -0x0.c872740be14a28p-52, 0x0.d5cef5224e0bc0p-63, -0x0.d4f9a4284738a0p-74, 0x0.c7c506e718e168p-85, -0x0.b19b2893a16298p-96, // x in subrange 0:3 (0.130859..0.132812)
+ 0x0.becb83d8a4f858p-20, -0x0.880b6f87d9ed58p-30, 0x0.ac97fc2cb81058p-41, -0x0.c732d475602ed0p-52, 0x0.d45b9cf327e890p-63, -0x0.d36ba8aafb7ff0p-74, 0x0.c6370fb351fc58p-85, -0x0.b024aaada61c90p-96, // x in subrange 0:4 (0.132812..0.134766)
+ 0x0.bdfff3e52f4ab0p-20, -0x0.875f53c9323a80p-30, 0x0.ab9fc3459fb940p-41, -0x0.c5f55fda273878p-52, 0x0.d2eafa8596fc38p-63, -0x0.d1e0c5d3d006a8p-74, 0x0.c4ac5f72b9d9f0p-85, -0x0.aeb16b9df687c0p-96, // x in subrange 0:5 (0.134766..0.136719)
+ 0x0.bd3565618ff488p-20, -0x0.86b42f7d7bbbd0p-30, 0x0.aaa915d788aaf0p-41, -0x0.c4ba122da184e0p-52, 0x0.d17d0874307798p-63, -0x0.d058f51c266898p-74, 0x0.c324eee06d69c8p-85, -0x0.ad4163da28f488p-96, // x in subrange 0:6 (0.136719..0.138672)
+ 0x0.bc6bd6dbc27b08p-20, -0x0.860a011a94ee88p-30, 0x0.a9b3f1344c2eb8p-41, -0x0.c380e76b49c7a0p-52, 0x0.d011c164e87220p-63, -0x0.ced4300bd91d58p-74, 0x0.c1a0b6c86c70c0p-85, -0x0.abd48bea1abb20p-96, // x in subrange 0:7 (0.138672..0.140625)
+ 0x0.bba346e40f9428p-20, -0x0.8560c71907f568p-30, 0x0.a8c052b2c433a8p-41, -0x0.c249db96994ed0p-52, 0x0.cea92008f8b3b8p-63, -0x0.cd52703919dbb0p-74, 0x0.c01fb007709d38p-85, -0x0.aa6adc67c22b20p-96, // x in subrange 0:8 (0.140625..0.142578)
+ 0x0.badbb40d092910p-20, -0x0.84b87ff4059d18p-30, 0x0.a7ce37aec15ac8p-41, -0x0.c114eabaf72d20p-52, 0x0.cd431f1cc7b938p-63, -0x0.cbd3af48504e50p-74, 0x0.bea1d38ac50228p-85, -0x0.a9044dff00f370p-96, // x in subrange 0:9 (0.142578..0.144531)
+ 0x0.ba151ceb865fe0p-20, -0x0.84112a29606a68p-30, 0x0.a6dd9d89011868p-41, -0x0.bfe210eba78998p-52, 0x0.cbdfb967cff2e8p-63, -0x0.ca57e6ebf91928p-74, 0x0.bd271a501df878p-85, -0x0.a7a0d96d770140p-96, // x in subrange 0:10 (0.144531..0.146484)
+ 0x0.b94f80169faca8p-20, -0x0.836ac43987b258p-30, 0x0.a5ee81a723ea18p-41, -0x0.beb14a43bb13f0p-52, 0x0.ca7ee9bc873c70p-63, -0x0.c8df10e4852ec8p-74, 0x0.bbaf7d65716538p-85, -0x0.a640778255d4f8p-96, // x in subrange 0:11 (0.146484..0.148438)
+ 0x0.b88adc27aae9e8p-20, -0x0.82c54ca782bbf8p-30, 0x0.a500e173a3a150p-41, -0x0.bd8292e5fe9da8p-52, 0x0.c920aaf8468db0p-63, -0x0.c76927003974a8p-74, 0x0.ba3af5e8cf6408p-85, -0x0.a4e3211e344ba0p-96, // x in subrange 0:12 (0.148438..0.150391)
+ 0x0.b7c72fba377848p-20, -0x0.8220c1f8ebebd8p-30, 0x0.a414ba5dc9c250p-41, -0x0.bc55e6fcead7a0p-52, 0x0.c7c4f80331e3d8p-63, -0x0.c5f6231b0eb598p-74, 0x0.b8c97d083b5438p-85, -0x0.a388cf32e2dbc8p-96, // x in subrange 0:13 (0.150391..0.152344)
+ 0x0.b704796c0a6588p-20, -0x0.817d22b5ebf938p-30, 0x0.a32a09d9a5f790p-41, -0x0.bb2b42ba943368p-52, 0x0.c66bcbd0206288p-63, -0x0.c485ff1e91e220p-74, 0x0.b75b0c01854800p-85, -0x0.a2317ac3404468p-96, // x in subrange 0:14 (0.152344..0.154297)
+ 0x0.b642b7dd1a9a88p-20, -0x0.80da6d69352c78p-30, 0x0.a240cd600498e0p-41, -0x0.ba02a2589ae830p-52, 0x0.c515215c84ac08p-63, -0x0.c318b501c49d20p-74, 0x0.b5ef9c2223d4c8p-85, -0x0.a0dd1ce30eacf0p-96, // x in subrange 0:15 (0.154297..0.15625)
+ 0x0.b581e9af8d1088p-20, -0x0.8038a09ffea748p-30, 0x0.a159026e6546b8p-41, -0x0.b8dc02181b1b58p-52, 0x0.c3c0f3b0557060p-63, -0x0.c1ae3ec8fe14c8p-74, 0x0.b48726c70e4330p-85, -0x0.9f8baeb6c934f8p-96, // x in subrange 0:16 (0.15625..0.158203)
+ 0x0.b4c20d87b10d60p-20, -0x0.ff2f75d3ff6bc0p-31, 0x0.a072a686f19928p-41, -0x0.b7b75e419d2bb0p-52, 0x0.c26f3dddf632b8p-63, -0x0.c0469685cc26b0p-74, 0x0.b321a55c971e50p-85, -0x0.9e3d297379f280p-96, // x in subrange 0:17 (0.158203..0.160156)
+ 0x0.b403220bfc66b8p-20, -0x0.fdef75b2d653a8p-31, 0x0.9f8db73073e238p-41, -0x0.b694b325061f90p-52, 0x0.c11ffb02204468p-63, -0x0.bee1b656d4ce70p-74, 0x0.b1bf115e4720e0p-85, -0x0.9cf1865e905db8p-96, // x in subrange 0:18 (0.160156..0.162109)
+ 0x0.b34525e507cc40p-20, -0x0.fcb13e05d57b98p-31, 0x0.9eaa31f64e03d0p-41, -0x0.b573fd19883528p-52, 0x0.bfd32643cbf550p-63, -0x0.bd7f9867b7de00p-74, 0x0.b05f6456b87f78p-85, -0x0.9ba8becdb828e0p-96, // x in subrange 0:19 (0.162109..0.164062)
+ 0x0.b28817bd8b18c0p-20, -0x0.fb74cbfb350530p-31, 0x0.9dc814687058b8p-41, -0x0.b455387d939538p-52, 0x0.be88bad419f8e0p-63, -0x0.bc2036f0f0ff50p-74, 0x0.af0297df728f00p-85, -0x0.9a62cc26b08390p-96, // x in subrange 0:20 (0.164062..0.166016)
+ 0x0.b1cbf64259aa00p-20, -0x0.fa3a1cc608aa60p-31, 0x0.9ce75c1b50b0c0p-41, -0x0.b33861b6c72718p-52, 0x0.bd40b3ee3cff90p-63, -0x0.bac38c37b9fdf8p-74, 0x0.ada8a5a0c5c630p-85, -0x0.991fa7df23c7a8p-96, // x in subrange 0:21 (0.166016..0.167969)
+ 0x0.b110c0225ebf60p-20, -0x0.f9012d9e36bb80p-31, 0x0.9c0806a7e15fc8p-41, -0x0.b21d7531e18678p-52, 0x0.bbfb0cd76383a0p-63, -0x0.b969928ded58a8p-74, 0x0.ac518751a81990p-85, -0x0.97df4b7c7f8f90p-96, // x in subrange 0:22 (0.167969..0.169922)
+ 0x0.b056740e99df70p-20, -0x0.f7c9fbc06f2f20p-31, 0x0.9b2a11ab885f48p-41, -0x0.b1046f62b21a48p-52, 0x0.bab7c0dea1c9d0p-63, -0x0.b8124451e91998p-74, 0x0.aafd36b791b088p-85, -0x0.96a1b093cd33b0p-96, // x in subrange 0:23 (0.169922..0.171875)
+ 0x0.af9d10ba1b43e0p-20, -0x0.f694846e22c388p-31, 0x0.9a4d7ac81682b8p-41, -0x0.afed4cc40a4c58p-52, 0x0.b976cb5cdc1420p-63, -0x0.b6bd9bee71f520p-74, 0x0.a9abada659f318p-85, -0x0.9566d0c98aaf40p-96, // x in subrange 0:24 (0.171875..0.173828)
+ 0x0.aee494da004c50p-20, -0x0.f560c4ed7a31c8p-31, 0x0.99723fa3bebe38p-41, -0x0.aed809d7aee1a0p-52, 0x0.b83827b4b10770p-63, -0x0.b56b93da96add0p-74, 0x0.a85ce60014ef10p-85, -0x0.942ea5d183ea30p-96, // x in subrange 0:25 (0.173828..0.175781)
+ 0x0.ae2cff256ff790p-20, -0x0.f42eba894d7218p-31, 0x0.98985de90d7f58p-41, -0x0.adc4a3264972a8p-52, 0x0.b6fbd1526442c0p-63, -0x0.b41c269993bd98p-74, 0x0.a710d9b4f113d0p-85, -0x0.92f9296eac67e0p-96, // x in subrange 0:26 (0.175781..0.177734)
+ 0x0.ad764e55976368p-20, -0x0.f2fe62911b1198p-31, 0x0.97bfd346e01838p-41, -0x0.acb3153f5a0438p-52, 0x0.b5c1c3abc92798p-63, -0x0.b2cf4ebab742e8p-74, 0x0.a5c782c3154400p-85, -0x0.91c65572f95958p-96, // x in subrange 0:27 (0.177734..0.179688)
+ 0x0.acc08125a65300p-20, -0x0.f1cfba58ff98e0p-31, 0x0.96e89d705c3c50p-41, -0x0.aba35cb928bf30p-52, 0x0.b489fa402dd3b8p-63, -0x0.b18506d9453180p-74, 0x0.a480db367f3c18p-85, -0x0.909623bf3c11c0p-96, // x in subrange 0:28 (0.179688..0.181641)
+ 0x0.ac0b9652cbbb80p-20, -0x0.f0a2bf39ad03d8p-31, 0x0.9612ba1ce78f48p-41, -0x0.aa957630b7c858p-52, 0x0.b3547098464af8p-63, -0x0.b03d499c5bc600p-74, 0x0.a33cdd28e24ce0p-85, -0x0.8f688e42fcdc80p-96, // x in subrange 0:29 (0.181641..0.183594)
+ 0x0.ab578c9c325728p-20, -0x0.ef776e90624a30p-31, 0x0.953e27081f4510p-41, -0x0.a9895e49b536f0p-52, 0x0.b221224617d128p-63, -0x0.aef811b6d83be0p-74, 0x0.a1fb82c1866948p-85, -0x0.8e3d8efc5633a0p-96, // x in subrange 0:30 (0.183594..0.185547)
+ 0x0.aaa462c2fd3ec8p-20, -0x0.ee4dc5bee2f880p-31, 0x0.946ae1f1cfd3d8p-41, -0x0.a87f11ae6d2a30p-52, 0x0.b0f00ae4e47390p-63, -0x0.adb559e73bc4c0p-74, 0x0.a0bcc635278680p-85, -0x0.8d151ff7d055a8p-96, // x in subrange 0:31 (0.185547..0.1875)
+ 0x0.a9f2178a448968p-20, -0x0.ed25c22b6eda18p-31, 0x0.9398e89decb718p-41, -0x0.a7768d0fbbfd40p-52, 0x0.afc1261916c178p-63, -0x0.ac751cf790c0c0p-74, 0x0.9f80a1c5d54da8p-85, -0x0.8bef3b503d39b0p-96, // x in subrange 0:32 (0.1875..0.189453)
+ 0x0.a940a9b711f230p-20, -0x0.ebff6140b9b320p-31, 0x0.92c838d48843c0p-41, -0x0.a66fcd250099c8p-52, 0x0.ae946f902db358p-63, -0x0.ab3755bd503738p-74, 0x0.9e470fc2d31e10p-85, -0x0.8acbdb2e94e118p-96, // x in subrange 0:33 (0.189453..0.191406)
+ 0x0.a89018105d8498p-20, -0x0.eadaa06de30af0p-31, 0x0.91f8d061cb8da8p-41, -0x0.a56aceac0ee7f8p-52, 0x0.ad69e300a8c020p-63, -0x0.a9fbff19478ef8p-74, 0x0.9d100a88785f80p-85, -0x0.89aaf9c9d20568p-96, // x in subrange 0:34 (0.191406..0.193359)
+ 0x0.a7e0615f0a4e80p-20, -0x0.e9b77d266e06c8p-31, 0x0.912aad15ee5d98p-41, -0x0.a4678e69225ce0p-52, 0x0.ac417c29f420a0p-63, -0x0.a8c313f77e85a8p-74, 0x0.9bdb8c80112380p-85, -0x0.888c9166cf21f0p-96, // x in subrange 0:35 (0.193359..0.195312)
+ 0x0.a731846de318b0p-20, -0x0.e895f4e2395430p-31, 0x0.905dccc52f3850p-41, -0x0.a3660926d0a5e8p-52, 0x0.ab1b36d4553fb8p-63, -0x0.a78c8f4f1d6590p-74, 0x0.9aa9901fbf14d8p-85, -0x0.87709c5823d798p-96, // x in subrange 0:36 (0.195312..0.197266)
+ 0x0.a6838009972510p-20, -0x0.e776051d772388p-31, 0x0.8f922d47cb75e8p-41, -0x0.a2663bb5fc7188p-52, 0x0.a9f70ed0d75808p-63, -0x0.a6586c22537950p-74, 0x0.997a0fea5ab498p-85, -0x0.865714fe02aa70p-96, // x in subrange 0:37 (0.197266..0.199219)
+ 0x0.a5d65300b6f308p-20, -0x0.e657ab58a53240p-31, 0x0.8ec7cc79f769e0p-41, -0x0.a16822edc85510p-52, 0x0.a8d4fff9383dd0p-63, -0x0.a526a57e3dbc80p-74, 0x0.984d066f54e3f0p-85, -0x0.853ff5c61717d8p-96, // x in subrange 0:38 (0.199219..0.201172)
+ 0x0.a529fc23b109e0p-20, -0x0.e53ae51884e498p-31, 0x0.8dfea83bd69b48p-41, -0x0.a06bbbab89cef8p-52, 0x0.a7b5062fd554c8p-63, -0x0.a3f7367acdc968p-74, 0x0.97226e4a98b990p-85, -0x0.842b392b640428p-96, // x in subrange 0:39 (0.201172..0.203125)
+ 0x0.a47e7a44cec8f0p-20, -0x0.e41fafe6136f08p-31, 0x0.8d36be71740d40p-41, -0x0.9f7102d2bc65e0p-52, 0x0.a6971d5f98b218p-63, -0x0.a2ca1a3ab10248p-74, 0x0.95fa42246da2c8p-85, -0x0.8318d9b6227f80p-96, // x in subrange 0:40 (0.203125..0.205078)
+ 0x0.a3d3cc38313da0p-20, -0x0.e306094e820ee0p-31, 0x0.8c700d02ba9758p-41, -0x0.9e77f54cf4e358p-52, 0x0.a57b417be66900p-63, -0x0.a19f4beb37f688p-74, 0x0.94d47cb159ce68p-85, -0x0.8208d1fba0dff0p-96, // x in subrange 0:41 (0.205078..0.207031)
+ 0x0.a329f0d3cdff48p-20, -0x0.e1edeee32e5240p-31, 0x0.8baa91db6d4df8p-41, -0x0.9d809009d4ab08p-52, 0x0.a4616e808a02e0p-63, -0x0.a076c6c43e0250p-74, 0x0.93b118b204e1d0p-85, -0x0.80fb1c9e223120p-96, // x in subrange 0:42 (0.207031..0.208984)
+ 0x0.a280e6ef6c10f0p-20, -0x0.e0d75e399a6f38p-31, 0x0.8ae64aeb1ffa88p-41, -0x0.9c8acffefd2d18p-52, 0x0.a349a071a42150p-63, -0x0.9f5086081128d8p-74, 0x0.929010f31af690p-85, -0x0.ffdf68997bef48p-97, // x in subrange 0:43 (0.208984..0.210938)
+ 0x0.a1d8ad64a0c890p-20, -0x0.dfc254eb65a9b8p-31, 0x0.8a2336252fa2f8p-41, -0x0.9b96b228037458p-52, 0x0.a233d35b984a98p-63, -0x0.9e2c85035a2838p-74, 0x0.9171604d2fe048p-85, -0x0.fdcd2786808f48p-97, // x in subrange 0:44 (0.210938..0.212891)
+ 0x0.a131430eccbc20p-20, -0x0.deaed09644c8a8p-31, 0x0.89615180bb2128p-41, -0x0.9aa4338663cf70p-52, 0x0.a1200352fadf90p-63, -0x0.9d0abf0d04c678p-74, 0x0.905501a4a2ba10p-85, -0x0.fbbf6b94145c08p-97, // x in subrange 0:45 (0.212891..0.214844)
+ 0x0.a08aa6cb18b450p-20, -0x0.dd9ccedbfa9978p-31, 0x0.88a09af89bc980p-41, -0x0.99b35121759500p-52, 0x0.a00e2c747f3af0p-63, -0x0.9beb2f86285720p-74, 0x0.8f3aefe981ba78p-85, -0x0.f9b62a6be4d598p-97, // x in subrange 0:46 (0.214844..0.216797)
+ 0x0.9fe4d77872a4b8p-20, -0x0.dc8c4d625082a0p-31, 0x0.87e1108b5e2080p-41, -0x0.98c408065f0270p-52, 0x0.9efe4ae4e5f988p-63, -0x0.9acdd1d9f07918p-74, 0x0.8e2326176e4da0p-85, -0x0.f7b159d04cf878p-97, // x in subrange 0:47 (0.216797..0.21875)
+ 0x0.9f3fd3f78aa9d0p-20, -0x0.db7d49d30f2440p-31, 0x0.8722b03b3a9ff8p-41, -0x0.97d65548093548p-52, 0x0.9df05ad0eb6ad8p-63, -0x0.99b2a17d860bd8p-74, 0x0.8d0d9f35817488p-85, -0x0.f5b0ef9c17f390p-97, // x in subrange 0:48 (0.21875..0.220703)
+ 0x0.9e9b9b2ad00c20p-20, -0x0.da6fc1dbf707c0p-31, 0x0.8665780e0e8aa0p-41, -0x0.96ea35ff143ed0p-52, 0x0.9ce4586d3629e8p-63, -0x0.989999eff85ba8p-74, 0x0.8bfa5656306928p-85, -0x0.f3b4e1c2447be8p-97, // x in subrange 0:49 (0.220703..0.222656)
+ 0x0.9df82bf66e4900p-20, -0x0.d963b32eb95cf0p-31, 0x0.85a9660d54cf00p-41, -0x0.95ffa749cb5150p-52, 0x0.9bda3ff645ddd8p-63, -0x0.9782b6ba268450p-74, 0x0.8ae94697318610p-85, -0x0.f1bd264dc8bc68p-97, // x in subrange 0:50 (0.222656..0.224609)
+ 0x0.9d5585404a2118p-20, -0x0.d8591b80f0c628p-31, 0x0.84ee78461ef8b8p-41, -0x0.9516a64c1907a8p-52, 0x0.9ad20db06221f0p-63, -0x0.966df36ea909c8p-74, 0x0.89da6b216171d0p-85, -0x0.efc9b36156e0c0p-97, // x in subrange 0:51 (0.224609..0.226562)
+ 0x0.9cb3a5effeab90p-20, -0x0.d74ff88c1a31c8p-31, 0x0.8434acc90e30a8p-41, -0x0.942f302f7bc5c8p-52, 0x0.99cbbde7899478p-63, -0x0.955b4ba9bba620p-74, 0x0.88cdbf28a88c68p-85, -0x0.edda7f372238d8p-97, // x in subrange 0:52 (0.226562..0.228516)
+ 0x0.9c128ceeda6f68p-20, -0x0.d648480d8dc218p-31, 0x0.837c01aa4c4b48p-41, -0x0.93494222fa3310p-52, 0x0.98c74cef610c78p-63, -0x0.944abb11274c88p-74, 0x0.87c33debe09ee8p-85, -0x0.ebef8020a4f418p-97, // x in subrange 0:53 (0.228516..0.230469)
+ 0x0.9b723927dc8170p-20, -0x0.d54207c677c2c0p-31, 0x0.82c4750184e588p-41, -0x0.9264d95b17cd50p-52, 0x0.97c4b72322f590p-63, -0x0.933c3d542c6080p-74, 0x0.86bae2b4bacc40p-85, -0x0.ea08ac86667218p-97, // x in subrange 0:54 (0.230469..0.232422)
+ 0x0.9ad2a987b1a7d8p-20, -0x0.d43d357bd1ac20p-31, 0x0.820e04e9de8fe8p-41, -0x0.9181f311c994d0p-52, 0x0.96c3f8e58ed210p-63, -0x0.922fce2b6d2118p-74, 0x0.85b4a8d7a5c288p-85, -0x0.e825fae7c22810p-97, // x in subrange 0:55 (0.232422..0.234375)
+ 0x0.9a33dcfcb18308p-20, -0x0.d339cef65b3420p-31, 0x0.8158af81f40780p-41, -0x0.90a08c866ad118p-52, 0x0.95c50ea0d8e230p-63, -0x0.91256958d84768p-74, 0x0.84b08bb3b42c40p-85, -0x0.e64761daaf18d8p-97, // x in subrange 0:56 (0.234375..0.236328)
+ 0x0.9995d276dbbb50p-20, -0x0.d237d202936cb0p-31, 0x0.80a472ebcd7d48p-41, -0x0.8fc0a2fdb1edc0p-52, 0x0.94c7f4c699f110p-63, -0x0.901d0aa793d7e0p-74, 0x0.83ae86b28360e0p-85, -0x0.e46cd80b87de10p-97, // x in subrange 0:57 (0.236328..0.238281)
+ 0x0.98f888e7d53430p-20, -0x0.d1373c70b1ef68p-31, 0x0.ffe29a99b3d5d8p-42, -0x0.8ee233c1a56ff0p-52, 0x0.93cca7cfbf4628p-63, -0x0.8f16adebe82628p-74, 0x0.82ae9548225408p-85, -0x0.e296543cd34120p-97, // x in subrange 0:58 (0.238281..0.240234)
+ 0x0.985bff42e54450p-20, -0x0.d0380c14a016a8p-31, 0x0.fe7e799bd0eb30p-42, -0x0.8e053c21910370p-52, 0x0.92d3243c7abb78p-63, -0x0.8e124f032b0ab8p-74, 0x0.81b0b2f2f8c2a0p-85, -0x0.e0c3cd470d6280p-97, // x in subrange 0:59 (0.240234..0.242188)
+ 0x0.97c0347cf2f2d0p-20, -0x0.cf3a3ec5f243e8p-31, 0x0.fd1c7f3643bca0p-42, -0x0.8d29b971fa9fa8p-52, 0x0.91db669432f810p-63, -0x0.8d0fe9d3ab49e8p-74, 0x0.80b4db3bae9d88p-85, -0x0.def53a18716da0p-97, // x in subrange 0:60 (0.242188..0.244141)
+ 0x0.9725278c823978p-20, -0x0.ce3dd25fe132d0p-31, 0x0.fbbca7c803ffb8p-42, -0x0.8c4fa90c97c448p-52, 0x0.90e56b6573ce38p-63, -0x0.8c0f7a4c9c2bd8p-74, 0x0.ff76136a2761d8p-86, -0x0.dd2a91b4c3d828p-97, // x in subrange 0:61 (0.244141..0.246094)
+ 0x0.968ad769b14be0p-20, -0x0.cd42c4c14359b8p-31, 0x0.fa5eefb6a2b3d8p-42, -0x0.8b77085042cd00p-52, 0x0.8ff12f45debd40p-63, -0x0.8b10fc66014518p-74, 0x0.fd8673f80f0f58p-86, -0x0.db63cb351d2b30p-97, // x in subrange 0:62 (0.246094..0.248047)
+ 0x0.95f1430e35e3d0p-20, -0x0.cc4913cc865698p-31, 0x0.f903536e3d5398p-42, -0x0.8a9fd4a0f05ca8p-52, 0x0.8efeaed21b9698p-63, -0x0.8a146c209a6ed0p-74, 0x0.fb9acf6ec31558p-86, -0x0.d9a0ddc7b554b8p-97, // x in subrange 0:63 (0.248047..0.25)
+ 0x0.950c4260de49e0p-18, -0x0.cad51384048238p-28, 0x0.f6fdd556f970f0p-38, -0x0.895fade972de30p-47, 0x0.8d9626ae6f11b0p-57, -0x0.889d289dae6ac8p-67, 0x0.f8c0d31bcc4e20p-78, -0x0.d703af9e87ee18p-88, // x in subrange 1:0 (0.25..0.253906)
+ 0x0.93dd73e9f1d970p-18, -0x0.c8e9c3f6215a80p-28, 0x0.f45318306a2a38p-38, -0x0.87b9b54b2637b0p-47, 0x0.8bbb62de7457b0p-57, -0x0.86af699836f428p-67, 0x0.f501022fd48868p-78, -0x0.d394808ac7fa00p-88, // x in subrange 1:1 (0.253906..0.257812)
+ 0x0.92b1826e59f9c8p-18, -0x0.c703c1adeda358p-28, 0x0.f1b08b0d05b8a8p-38, -0x0.861942e5308418p-47, 0x0.89e7521da78338p-57, -0x0.84c91ad5869870p-67, 0x0.f15084393b7428p-78, -0x0.d0341b1562c8c8p-88, // x in subrange 1:2 (0.257812..0.261719)
+ 0x0.91886606686578p-18, -0x0.c522fc66e0c1e0p-28, 0x0.ef16127fb087d8p-38, -0x0.847e42c53c2ff8p-47, 0x0.8819da9873e3a8p-57, -0x0.82ea1df1ddec28p-67, 0x0.edaf1743516b00p-78, -0x0.cce23c83b6cc18p-88, // x in subrange 1:3 (0.261719..0.265625)
+ 0x0.906216e2acb200p-18, -0x0.c3476412e91760p-28, 0x0.ec83937e4a0548p-38, -0x0.82e8a145cfc020p-47, 0x0.8652e2e4bc6ae8p-57, -0x0.8112550c3c5f88p-67, 0x0.ea1c7a82e92cc0p-78, -0x0.c99ea355720ff0p-88, // x in subrange 1:4 (0.265625..0.269531)
+ 0x0.8f3e8d4ba33108p-18, -0x0.c170e8d9a78978p-28, 0x0.e9f8f3602f6640p-38, -0x0.81584b0d141510p-47, 0x0.84925200161c18p-57, -0x0.fe834588256e58p-68, 0x0.e6986e50df0e20p-78, -0x0.c6690f3e8e1190p-88, // x in subrange 1:5 (0.269531..0.273438)
+ 0x0.8e1dc1a164f618p-18, -0x0.bf9f7b17adfeb0p-28, 0x0.e77617dcc48190p-38, -0x0.ff9a5a173fe628p-48, 0x0.82d80f4e0a76d0p-57, -0x0.faefd46e00b7f0p-68, 0x0.e322b424baf4c8p-78, -0x0.c34141216a2aa8p-88, // x in subrange 1:6 (0.273438..0.277344)
+ 0x0.8cffac5b58fc78p-18, -0x0.bdd30b5dc0c368p-28, 0x0.e4fae70a02a258p-38, -0x0.fc8e68f6916ec8p-48, 0x0.8124029661b918p-57, -0x0.f76a1dfd369888p-68, 0x0.dfbb0e8f6c9920p-78, -0x0.c026fb0903f048p-88, // x in subrange 1:7 (0.277344..0.28125)
+ 0x0.8be44607e668a8p-18, -0x0.bc0b8a701acb38p-28, 0x0.e287475b0d3ac8p-38, -0x0.f98c9dbbf045d0p-48, 0x0.feec2806e9a648p-58, -0x0.f3f1ea5c84f5e8p-68, 0x0.dc614136218820p-78, -0x0.bd1a00234ce820p-88, // x in subrange 1:8 (0.28125..0.285156)
+ 0x0.8acb874c27e190p-18, -0x0.ba48e945b4c308p-28, 0x0.e01b1f9ecc5d20p-38, -0x0.f694d3f90e4770p-48, 0x0.fb9c58410dd1e8p-58, -0x0.f08702a1f4d230p-68, 0x0.d91510cd346290p-78, -0x0.ba1a14bb9cfa20p-88, // x in subrange 1:9 (0.285156..0.289062)
+ 0x0.89b568e39ffcc0p-18, -0x0.b88b19078ee8b0p-28, 0x0.ddb656fe8ce2c8p-38, -0x0.f3a6e7cb3b0de8p-48, 0x0.f85867b04c7c40p-58, -0x0.ed2930cea79058p-68, 0x0.d5d6431334d9c8p-78, -0x0.b726fe35410718p-88, // x in subrange 1:10 (0.289062..0.292969)
+ 0x0.88a1e39feeba18p-18, -0x0.b6d20b0ffd9c98p-28, 0x0.db58d4fca62878p-38, -0x0.f0c2b5d92cf9d0p-48, 0x0.f52028e528d270p-58, -0x0.e9d83fcab7e850p-68, 0x0.d2a49ecc07ec70p-78, -0x0.b4408306251180p-88, // x in subrange 1:11 (0.292969..0.296875)
+ 0x0.8790f068880a60p-18, -0x0.b51db0e9f8a250p-28, 0x0.d9028173254840p-38, -0x0.ede81b50d3b3a8p-48, 0x0.f1f36f286b5910p-58, -0x0.e693fb612e2a58p-68, 0x0.cf7febbc1fe8c8p-78, -0x0.b1666ab1996730p-88, // x in subrange 1:12 (0.296875..0.300781)
+ 0x0.8682883a6b5d40p-18, -0x0.b36dfc506d0570p-28, 0x0.d6b344927db960p-38, -0x0.eb16f5e533fc30p-48, 0x0.eed20e780ea540p-58, -0x0.e35c303c077370p-68, 0x0.cc67f2a3cbbba8p-78, -0x0.ae987dc3323f38p-88, // x in subrange 1:13 (0.300781..0.304688)
+ 0x0.8576a427dc3228p-18, -0x0.b1c2df2d9197a8p-28, 0x0.d46b06e03f3f50p-38, -0x0.e84f23cc4ca1f0p-48, 0x0.ebbbdb8439dc60p-58, -0x0.e030abe04f76e8p-68, 0x0.c95c7d3a9d1728p-78, -0x0.abd685c9c14090p-88, // x in subrange 1:14 (0.304688..0.308594)
+ 0x0.846d3d581ba8b8p-18, -0x0.b01c4b9a3dfe18p-28, 0x0.d229b135d11110p-38, -0x0.e59083bd0472b8p-48, 0x0.e8b0abac48b8f8p-58, -0x0.dd113caa4c8220p-68, 0x0.c65d562ae4fca0p-78, -0x0.a9204d52686b38p-88, // x in subrange 1:15 (0.308594..0.3125)
+ 0x0.83664d07230cb0p-18, -0x0.ae7a33dd4442c0p-28, 0x0.cfef2cbf322260p-38, -0x0.e2daf4ed210158p-48, 0x0.e5b054fbe0d6b0p-58, -0x0.d9fdb1c9bd6268p-68, 0x0.c36a490d4639f0p-78, -0x0.a6759fe3c5ddc8p-88, // x in subrange 1:16 (0.3125..0.316406)
+ 0x0.8261cc855f5988p-18, -0x0.acdc8a6acce0b0p-28, 0x0.cdbb62f9be7980p-38, -0x0.e02e570f4617c0p-48, 0x0.e2baae28140678p-58, -0x0.d6f5db3e28d578p-68, 0x0.c08322645d6a48p-78, -0x0.a3d649f937f6d0p-88, // x in subrange 1:17 (0.316406..0.320312)
+ 0x0.815fb5376db240p-18, -0x0.ab4341e3b54048p-28, 0x0.cb8e3db2f97b50p-38, -0x0.dd8a8a50fdaea8p-48, 0x0.dfcf8e8c8f6eb0p-58, -0x0.d3f989d33e2f98p-68, 0x0.bda7af987e0f08p-78, -0x0.a14218fe3951f8p-88, // x in subrange 1:18 (0.320312..0.324219)
+ 0x0.80600095d8c9c0p-18, -0x0.a9ae4d14f09a38p-28, 0x0.c967a7075d1938p-38, -0x0.daef6f58c84558p-48, 0x0.dceece28d73b20p-58, -0x0.d1088f1d46e400p-68, 0x0.bad7bef3845570p-78, -0x0.9eb8db49d424c8p-88, // x in subrange 1:19 (0.324219..0.328125)
+ 0x0.fec55059ae6f78p-19, -0x0.a81d9ef6eb3720p-28, 0x0.c74789612dcbc8p-38, -0x0.d85ce744357398p-48, 0x0.da18459d8ea2f0p-58, -0x0.ce22bd75a89d40p-68, 0x0.b8131f9cbb21d0p-78, -0x0.9c3a601a2c8168p-88, // x in subrange 1:20 (0.328125..0.332031)
+ 0x0.fccf4b38156ec8p-19, -0x0.a6912aacf002b0p-28, 0x0.c52dcf775345e0p-38, -0x0.d5d2d3a6049138p-48, 0x0.d74bce29cc0a28p-58, -0x0.cb47e7f77795f8p-68, 0x0.b559a194d5f9b8p-78, -0x0.99c677902107a8p-88, // x in subrange 1:21 (0.332031..0.335938)
+ 0x0.fadde52c809788p-19, -0x0.a508e384906880p-28, 0x0.c31a644c35cc40p-38, -0x0.d35116844d4f98p-48, 0x0.d48941a8790790p-58, -0x0.c877e27c18e240p-68, 0x0.b2ab15b1fe6988p-78, -0x0.975cf2ab018fc0p-88, // x in subrange 1:22 (0.335938..0.339844)
+ 0x0.f8f111c2628d80p-19, -0x0.a384bcf50e71e0p-28, 0x0.c10d332ca01d98p-38, -0x0.d0d79256b02148p-48, 0x0.d1d07a8dbe16d0p-58, -0x0.c5b28197f45da8p-68, 0x0.b0074d9bf48358p-78, -0x0.94fda3445b5cb8p-88, // x in subrange 1:23 (0.339844..0.34375)
+ 0x0.f708c4aa8a5e38p-19, -0x0.a204aa9ec91b28p-28, 0x0.bf0627aea5d858p-38, -0x0.ce662a048e4da0p-48, 0x0.cf2153e479c0d8p-58, -0x0.c2f79a9735f160p-68, 0x0.ad6e1bc8421770p-78, -0x0.92a85c0bda65d0p-88, // x in subrange 1:24 (0.34375..0.347656)
+ 0x0.f524f1baa90500p-19, -0x0.a088a04aaad800p-28, 0x0.bd052db08e4a78p-38, -0x0.cbfcc0e3498d98p-48, 0x0.cc7ba94bc30580p-58, -0x0.c047037a9de8a8p-68, 0x0.aadf5376804828p-78, -0x0.905cf0833f4a40p-88, // x in subrange 1:25 (0.347656..0.351562)
+ 0x0.f3458cecd8a000p-19, -0x0.9f1091e99a3d78p-28, 0x0.bb0a3157c39940p-38, -0x0.c99b3ab48b1100p-48, 0x0.c9df56f476d210p-58, -0x0.bda092f4600ae8p-68, 0x0.a85ac8acaf1d88p-78, -0x0.8e1b34fa698338p-88, // x in subrange 1:26 (0.351562..0.355469)
+ 0x0.f16a8a5f255040p-19, -0x0.9d9c7393ecc998p-28, 0x0.b9151f0fc62e30p-38, -0x0.c7417ba491caf0p-48, 0x0.c74c399ed05158p-58, -0x0.bb042065113400p-68, 0x0.a5e050339ebe08p-78, -0x0.8be2fe8b756bc0p-88, // x in subrange 1:27 (0.355469..0.359375)
+ 0x0.ef93de5317be20p-19, -0x0.9c2c3988dbc010p-28, 0x0.b725e389245738p-38, -0x0.c4ef684887e548p-48, 0x0.c4c22e980be380p-58, -0x0.b87183d8a32500p-68, 0x0.a36fbf9369f478p-78, -0x0.89b42316edb6e8p-88, // x in subrange 1:28 (0.359375..0.363281)
+ 0x0.edc17d2d413c28p-19, -0x0.9abfd82dfb1340p-28, 0x0.b53c6bb87608a8p-38, -0x0.c2a4e59cdf3b70p-48, 0x0.c24113b8148bb8p-58, -0x0.b5e896036e48c0p-68, 0x0.a108ed1001ac30p-78, -0x0.878e79400ff080p-88, // x in subrange 1:29 (0.363281..0.367188)
+ 0x0.ebf35b74c98218p-19, -0x0.9957440eb251b8p-28, 0x0.b358a4d55caef0p-38, -0x0.c061d903b4bd78p-48, 0x0.bfc8c75f3ba3c8p-58, -0x0.b369303f492910p-68, 0x0.9eabafa5c90f00p-78, -0x0.8571d86923a4e8p-88, // x in subrange 1:30 (0.367188..0.371094)
+ 0x0.ea296dd2fdfa38p-19, -0x0.97f271dbb79048p-28, 0x0.b17a7c5986ffe8p-38, -0x0.be2628433a9ce8p-48, 0x0.bd592873faa610p-58, -0x0.b0f32c88ad52e8p-68, 0x0.9c57df0641f1a8p-78, -0x0.835e18afe3cff8p-88, // x in subrange 1:31 (0.371094..0.375)
+ 0x0.e863a912e29ae8p-19, -0x0.9691566a8c4840p-28, 0x0.afa1dfffb8b9b0p-38, -0x0.bbf1b984292530p-48, 0x0.baf21660bedf18p-58, -0x0.ae86657be96870p-68, 0x0.9a0d5394c93d58p-78, -0x0.815312e9fa3450p-88, // x in subrange 1:32 (0.375..0.378906)
+ 0x0.e6a20220c446d0p-19, -0x0.9533e6b4fc2250p-28, 0x0.adcebdc2d63fc0p-38, -0x0.b9c473503622b0p-48, 0x0.b8937111bed948p-58, -0x0.ac22b652602260p-68, 0x0.97cbe6636306b0p-78, -0x0.fea14143187d50p-89, // x in subrange 1:33 (0.378906..0.382812)
+ 0x0.e4e46e09ccadb0p-19, -0x0.93da17d89da6a0p-28, 0x0.ac0103dcf40518p-38, -0x0.b79e3c9092baa0p-48, 0x0.b63d18f2d955d0p-58, -0x0.a9c7fadfd401e0p-68, 0x0.9593712f9603b0p-78, -0x0.faad3823b23478p-89, // x in subrange 1:34 (0.382812..0.386719)
+ 0x0.e32ae1fb97a868p-19, -0x0.9283df1654c9f8p-28, 0x0.aa38a0c669b3e8p-38, -0x0.b57efc8c6f9870p-48, 0x0.b3eeeeed7da6b8p-58, -0x0.a7760f8fbf7648p-68, 0x0.9363ce5f5614b0p-78, -0x0.f6c9c047d13c00p-89, // x in subrange 1:35 (0.386719..0.390625)
+ 0x0.e1755343ca0aa0p-19, -0x0.913131d1d75150p-28, 0x0.a8758334e90338p-38, -0x0.b3669ae78753e0p-48, 0x0.b1a8d4669d3f00p-58, -0x0.a52cd162b93b48p-68, 0x0.913cd8fdfd9460p-78, -0x0.f2f690d69576d0p-89, // x in subrange 1:36 (0.390625..0.394531)
+ 0x0.dfc3b74fa9e468p-19, -0x0.8fe20591330398p-28, 0x0.a6b79a1a982a78p-38, -0x0.b154ffa0aef510p-48, 0x0.af6aab3ca64e78p-58, -0x0.a2ec1debe4b488p-68, 0x0.8f1e6cb9552660p-78, -0x0.ef336245ce33e8p-89, // x in subrange 1:37 (0.394531..0.398438)
+ 0x0.de1603abb82eb8p-19, -0x0.8e964ffc55a388p-28, 0x0.a4fed4a52fe4c0p-38, -0x0.af4a13106c7b30p-48, 0x0.ad3455c5873f98p-58, -0x0.a0b3d34e6e0da8p-68, 0x0.8d0865dea9bb48p-78, -0x0.eb7fee53b917f8p-89, // x in subrange 1:38 (0.398438..0.402344)
+ 0x0.dc6c2e034bdd68p-19, -0x0.8d4e06dc96a988p-28, 0x0.a34b223d1cf3d8p-38, -0x0.ad45bde7934b98p-48, 0x0.ab05b6ccbaeeb0p-58, -0x0.9e83d03b11e610p-68, 0x0.8afaa157f084a0p-78, -0x0.e7dbf000e016e0p-89, // x in subrange 1:39 (0.402344..0.40625)
+ 0x0.dac62c202e5120p-19, -0x0.8c09201c42b748p-28, 0x0.a19c7284a51550p-38, -0x0.ab47e92de66f88p-48, 0x0.a8deb1915d7258p-58, -0x0.9c5bf3edb051d0p-68, 0x0.88f4fca8f89298p-78, -0x0.e447238a15dca8p-89, // x in subrange 1:40 (0.40625..0.410156)
+ 0x0.d923f3ea3924c0p-19, -0x0.8ac791c628be08p-28, 0x0.9ff2b5570f5a78p-38, -0x0.a9507e40c08698p-48, 0x0.a6bf29c4494de8p-58, -0x0.9a3c1e2aeaf8b0p-68, 0x0.86f755eca9d860p-78, -0x0.e0c14662900a50p-89, // x in subrange 1:41 (0.410156..0.414062)
+ 0x0.d7857b66f55088p-19, -0x0.8989520528d0a8p-28, 0x0.9e4ddac7cfd5b8p-38, -0x0.a75f66d1c15588p-48, 0x0.a4a703863ce718p-58, -0x0.98242f3dce1f40p-68, 0x0.85018bd2515470p-78, -0x0.dd4a172e1eacc0p-89, // x in subrange 1:42 (0.414062..0.417969)
+ 0x0.d5eab8b93b9e68p-19, -0x0.884e5723c49b88p-28, 0x0.9cadd321b68f18p-38, -0x0.a5748ce580d7f8p-48, 0x0.a29623660819b0p-58, -0x0.961407f5846528p-68, 0x0.83137d9afa1bc8p-78, -0x0.d9e155bb8057e0p-89, // x in subrange 1:43 (0.417969..0.421875)
+ 0x0.d453a220d66a78p-19, -0x0.8716978bb17aa8p-28, 0x0.9b128ee621b1f8p-38, -0x0.a38fdad247bdf0p-48, 0x0.a08c6e5ec1c318p-58, -0x0.940b89a3150600p-68, 0x0.812d0b16d30800p-78, -0x0.d686c2fed25348p-89, // x in subrange 1:44 (0.421875..0.425781)
+ 0x0.d2c02dfa24aad0p-19, -0x0.85e209c56c28c8p-28, 0x0.997bfecc32e758p-38, -0x0.a1b13b3ecd3c80p-48, 0x0.9e89c9d6052268p-58, -0x0.920a96172c6a90p-68, 0x0.fe9c2945419498p-79, -0x0.d33a210c1c4848p-89, // x in subrange 1:45 (0.425781..0.429688)
+ 0x0.d13052bdbe39e8p-19, -0x0.84b0a477ce0050p-28, 0x0.97ea13c007cec8p-38, -0x0.9fd89920fa1b18p-48, 0x0.9c8e1b9a36e870p-58, -0x0.90110f9feed960p-68, 0x0.faecf64a784ac8p-79, -0x0.cffb3311f6e4d0p-89, // x in subrange 1:46 (0.429688..0.433594)
+ 0x0.cfa40700195ef8p-19, -0x0.83825e67a3c868p-28, 0x0.965cbee1f58930p-38, -0x0.9e05dfbcb0e610p-48, 0x0.9a9949e0d1d4e0p-58, -0x0.8e1ed906d51668p-68, 0x0.f74c401a3825f0p-79, -0x0.ccc9bd544ce8c8p-89, // x in subrange 1:47 (0.433594..0.4375)
+ 0x0.ce1b4171318f78p-19, -0x0.82572e77460800p-28, 0x0.94d3f185c748f0p-38, -0x0.9c38faa29b3058p-48, 0x0.98ab3b44babe60p-58, -0x0.8c33d58e92c2d0p-68, 0x0.f3b9ca9bd732c8p-79, -0x0.c9a58527361748p-89, // x in subrange 1:48 (0.4375..0.441406)
+ 0x0.cc95f8dc2f6590p-19, -0x0.812f0ba632d868p-28, 0x0.934f9d31ffdaa0p-38, -0x0.9a71d5aefbcde8p-48, 0x0.96c3d6c49be368p-58, -0x0.8a4fe8f1064e40p-68, 0x0.f0355abc563088p-79, -0x0.c68e50e9eb86a0p-89, // x in subrange 1:49 (0.441406..0.445312)
+ 0x0.cb14242711c6e8p-19, -0x0.8009ed10a93260p-28, 0x0.91cfb39f1e19e0p-38, -0x0.98b05d0885f1c0p-48, 0x0.94e303c1476298p-58, -0x0.8872f75d324c70p-68, 0x0.ecbeb669b9a628p-79, -0x0.c383e801d4ce98p-89, // x in subrange 1:50 (0.445312..0.449219)
+ 0x0.c995ba52583708p-19, -0x0.fdcf93de8b5de0p-29, 0x0.905426b6e446a0p-38, -0x0.96f47d1f391998p-48, 0x0.9308a9fc20baa8p-58, -0x0.869ce575400268p-68, 0x0.e955a48e7905a8p-79, -0x0.c08612d5ad9500p-89, // x in subrange 1:51 (0.449219..0.453125)
+ 0x0.c81ab278ae51d8p-19, -0x0.fb91332d416e08p-29, 0x0.8edce893a22e88p-38, -0x0.953e22ab41b310p-48, 0x0.9134b1958d3138p-58, -0x0.84cd984c8affe0p-68, 0x0.e5f9ed0d037058p-79, -0x0.bd949ac8c2fcb8p-89, // x in subrange 1:52 (0.453125..0.457031)
+ 0x0.c6a303ce9868d0p-19, -0x0.f958a6eddc37a8p-29, 0x0.8d69eb7f821f08p-38, -0x0.938d3aabde6520p-48, 0x0.8f67030b6b0180p-58, -0x0.8304f565b59998p-68, 0x0.e2ab58bb59b190p-79, -0x0.baaf4a36487da8p-89, // x in subrange 1:53 (0.457031..0.460938)
+ 0x0.c52ea5a2213fe8p-19, -0x0.f725de373c2540p-29, 0x0.8bfb21f3d89448p-38, -0x0.91e1b26649ea18p-48, 0x0.8d9f87378f3408p-58, -0x0.8142e2b0c61b20p-68, 0x0.df69b15ebd0858p-79, -0x0.b7d5ec6cc3adf0p-89, // x in subrange 1:54 (0.460938..0.464844)
+ 0x0.c3bd8f5a88e510p-19, -0x0.f4f8c855ff1ce8p-29, 0x0.8a907e98769a10p-38, -0x0.903b7764a96660p-48, 0x0.8bde274e4a0140p-58, -0x0.ff0e8d12990cb0p-69, 0x0.dc34c1a77258c8p-79, -0x0.b5084da98e87c0p-89, // x in subrange 1:55 (0.464844..0.46875)
+ 0x0.c24fb877f49ed0p-19, -0x0.f2d154cbc7e4a8p-29, 0x0.8929f442fed340p-38, -0x0.8e9a7774ff2830p-48, 0x0.8a22ccdcf1a130p-58, -0x0.fba40f69217100p-69, 0x0.d90c552c9961a8p-79, -0x0.b2463b146fb978p-89, // x in subrange 1:56 (0.46875..0.472656)
+ 0x0.c0e518931fedd0p-19, -0x0.f0af734e882e00p-29, 0x0.87c775f63d1ce8p-38, -0x0.8cfea0a821bd68p-48, 0x0.886d61c8736b10p-58, -0x0.f8461abf919aa8p-69, 0x0.d5f038681793d8p-79, -0x0.af8f82bb489028p-89, // x in subrange 1:57 (0.472656..0.476562)
+ 0x0.bf7da75d0e9d28p-19, -0x0.ee9313c7cd3d28p-29, 0x0.8668f6e180c240p-38, -0x0.8b67e150b74cf0p-48, 0x0.86bdd04beb2898p-58, -0x0.f4f47e3caf31d0p-69, 0x0.d2e038b2962b60p-79, -0x0.ace3f38dd80e28p-89, // x in subrange 1:58 (0.476562..0.480469)
+ 0x0.be195c9ebfde00p-19, -0x0.ec7c26540f22e0p-29, 0x0.850e6a5ff93758p-38, -0x0.89d62802352090p-48, 0x0.851402f7408060p-58, -0x0.f1af09d0262530p-69, 0x0.cfdc243f932b88p-79, -0x0.aa435d5992c328p-89, // x in subrange 1:59 (0.480469..0.484375)
+ 0x0.bcb83038e26a78p-19, -0x0.ea6a9b42027e40p-29, 0x0.83b7c3f8154f48p-38, -0x0.8849638fe34dc0p-48, 0x0.836fe4adca5c68p-58, -0x0.ee758e2f251660p-69, 0x0.cce3ca1984e200p-79, -0x0.a7ad90c58efb80p-89, // x in subrange 1:60 (0.484375..0.488281)
+ 0x0.bb5a1a2389abc0p-19, -0x0.e85e6311ecbc80p-29, 0x0.8264f75ae4e488p-38, -0x0.86c1830be46b90p-48, 0x0.81d160a4f83148p-58, -0x0.eb47dcd1091420p-69, 0x0.c9f6fa1e0f9610p-79, -0x0.a5225f4e84e060p-89, // x in subrange 1:61 (0.488281..0.492188)
+ 0x0.b9ff126de3e038p-19, -0x0.e6576e74facdc8p-29, 0x0.8115f8637ce8e0p-38, -0x0.853e75c64143c0p-48, 0x0.80386263010bb8p-58, -0x0.e825c7ec185998p-69, 0x0.c71584fa4d0af8p-79, -0x0.a2a19b42e22348p-89, // x in subrange 1:62 (0.492188..0.496094)
+ 0x0.b8a7113df13dc0p-19, -0x0.e455ae4c9a4490p-29, 0x0.ff95762cbba660p-39, -0x0.83c02b4bf86e50p-48, 0x0.fd49ab7b309470p-59, -0x0.e50f22724bcce0p-69, 0x0.c43f3c27257ec0p-79, -0x0.a02b17bef0d270p-89, // x in subrange 1:63 (0.496094..0.5)
+ 0x0.b6a8aabb3bfb48p-17, -0x0.e15cafccbc1168p-26, 0x0.fbc1a0e04d31d0p-35, -0x0.818b8569c6e518p-43, 0x0.f8a318dd40c8b0p-53, -0x0.e0823a5b2067d0p-62, 0x0.c0129d1b943538p-71, -0x0.9c8c5a60f71d00p-80, // x in subrange 2:0 (0.5..0.507812)
+ 0x0.b40a712533d550p-17, -0x0.dd77b4e1712c00p-26, 0x0.f6c0a0bb0ac120p-35, -0x0.fd557935bcac20p-44, 0x0.f294584a501d30p-53, -0x0.da9772fe75d2a8p-62, 0x0.baa6e9a83f9cb8p-71, -0x0.97dabf79cf3700p-80, // x in subrange 2:1 (0.507812..0.515625)
+ 0x0.b177c8b321ff08p-17, -0x0.d9a684df644668p-26, 0x0.f1dc0e5e34e580p-35, -0x0.f7b7c50645a7b0p-44, 0x0.ecae6ceab1d650p-53, -0x0.d4d761fa8ebd30p-62, 0x0.b564c8af8112d8p-71, -0x0.934f25b679b540p-80, // x in subrange 2:2 (0.515625..0.523438)
+ 0x0.aef076ad792bb0p-17, -0x0.d5e8af72ef23c0p-26, 0x0.ed1338d5563b80p-35, -0x0.f23cfcbde4a4e8p-44, 0x0.e6f030419df7c8p-53, -0x0.cf40c0052bebf0p-62, 0x0.b04ae9dcd12270p-71, -0x0.8ee84a218bb628p-80, // x in subrange 2:3 (0.523438..0.53125)
+ 0x0.ac7441a98aa498p-17, -0x0.d23dc702e4e940p-26, 0x0.e86573d288c858p-35, -0x0.ece435a1b21908p-44, 0x0.e15884a0f42180p-53, -0x0.c9d25029c95ec0p-62, 0x0.ab5808038f9948p-71, -0x0.8aa4f4f9f50ee0p-80, // x in subrange 2:4 (0.53125..0.539062)
+ 0x0.aa02f1817280f0p-17, -0x0.cea5609e3b2d90p-26, 0x0.e3d2178cfae020p-35, -0x0.e7ac8b8f21b5f0p-44, 0x0.dbe654e21828d0p-53, -0x0.c48adf71edc518p-62, 0x0.a68ae8bc01a148p-71, -0x0.8683f94b5d6500p-80, // x in subrange 2:5 (0.539062..0.546875)
+ 0x0.a79c4f4c3a1b68p-17, -0x0.cb1f13ea36f1e0p-26, 0x0.df5880a073f398p-35, -0x0.e29520c9a4d210p-44, 0x0.d698942129d348p-53, -0x0.bf694490839b98p-62, 0x0.a1e25c03e2f7e8p-71, -0x0.8284348a649218p-80, // x in subrange 2:6 (0.546875..0.554688)
+ 0x0.a54025562f4018p-17, -0x0.c7aa7b11199578p-26, 0x0.daf80fedd135b0p-35, -0x0.dd9d1dc9e2a4c0p-44, 0x0.d16e3d7a82d1a8p-53, -0x0.ba6c5f901fe418p-62, 0x0.9d5d3be267f5a0p-71, -0x0.fd491c693f4cb0p-81, // x in subrange 2:7 (0.554688..0.5625)
+ 0x0.a2ee3f196e9838p-17, -0x0.c44732b149f400p-26, 0x0.d6b02a7c724d38p-35, -0x0.d8c3b10e78eea0p-44, 0x0.cc6653ca66dba0p-53, -0x0.b59319841b76f0p-62, 0x0.98fa6c0f8f6b38p-71, -0x0.f5c7eee85adb10p-81, // x in subrange 2:8 (0.5625..0.570312)
+ 0x0.a0a669369fe4f8p-17, -0x0.c0f4d9ccf5fda0p-26, 0x0.d280395c8e8950p-35, -0x0.d4080eee381b88p-44, 0x0.c77fe16ed28500p-53, -0x0.b0dc643c64eda0p-62, 0x0.94b8d99ea4a3b0p-71, -0x0.ee82d58d7dab68p-81, // x in subrange 2:9 (0.570312..0.578125)
+ 0x0.9e68716de2a560p-17, -0x0.bdb311ba293548p-26, 0x0.ce67a98a6b4eb8p-35, -0x0.cf69716bce5e38p-44, 0x0.c2b9f80b561908p-53, -0x0.ac4739fbf22178p-62, 0x0.90977aabd311c0p-71, -0x0.e777d74fe20980p-81, // x in subrange 2:10 (0.578125..0.585938)
+ 0x0.9c342697e9cd80p-17, -0x0.ba817e13549ee8p-26, 0x0.ca65ebd26cb140p-35, -0x0.cae7180ad5b430p-44, 0x0.be13b04eea72f8p-53, -0x0.a7d29d31b92610p-62, 0x0.8c954e0cae5f80p-71, -0x0.e0a50c7db08f78p-81, // x in subrange 2:11 (0.585938..0.59375)
+ 0x0.9a09589f454020p-17, -0x0.b75fc4a844c1e0p-26, 0x0.c67a74b5f96860p-35, -0x0.c68047a63929e8p-44, 0x0.b98c29bbae7188p-53, -0x0.a37d9834198e88p-62, 0x0.88b15b0392b6b0p-71, -0x0.da089e1d38acb0p-81, // x in subrange 2:12 (0.59375..0.601562)
+ 0x0.97e7d879d7c538p-17, -0x0.b44d8d6f828080p-26, 0x0.c2a4bc512b86a8p-35, -0x0.c2344a47e61ec8p-44, 0x0.b5228a707c4218p-53, -0x0.9f473cfe9fa850p-62, 0x0.84eab0f5c22ed0p-71, -0x0.d3a0c5540f4e28p-81, // x in subrange 2:13 (0.601562..0.609375)
+ 0x0.95cf78227841b0p-17, -0x0.b14a82781b9d38p-26, 0x0.bee43e414793f8p-35, -0x0.be026f01beaa28p-44, 0x0.b0d5fef44658e0p-53, -0x0.9b2ea4f20c2be0p-62, 0x0.814067242559a0p-71, -0x0.cd6bcad3d989d0p-81, // x in subrange 2:14 (0.609375..0.617188)
+ 0x0.93c00a92bcfda8p-17, -0x0.ae564fdbcfe150p-26, 0x0.bb38798bf3de58p-35, -0x0.b9ea09c7c2a2d8p-44, 0x0.aca5ba032c80f0p-53, -0x0.9732f0968bae60p-62, 0x0.fb6338cd2bcb18p-72, -0x0.c768064c8b7e70p-81, // x in subrange 2:15 (0.617188..0.625)
+ 0x0.91b963bcefd058p-17, -0x0.ab70a3b19fefe0p-26, 0x0.b7a0f0872a0ad0p-35, -0x0.b5ea734b652590p-44, 0x0.a890f45d39fa98p-53, -0x0.9353476009e550p-62, 0x0.f47aedd3368aa0p-72, -0x0.c193dde3e5d170p-81, // x in subrange 2:16 (0.625..0.632812)
+ 0x0.8fbb58862a1060p-17, -0x0.a8992e00bae758p-26, 0x0.b41d28c1dd1f70p-35, -0x0.b20308d804cfc0p-44, 0x0.a496ec96be2a60p-53, -0x0.8f8ed7748d88d0p-62, 0x0.edc647dd046db8p-72, -0x0.bbedc5b1fe5380p-81, // x in subrange 2:17 (0.632812..0.640625)
+ 0x0.8dc5bec0973080p-17, -0x0.a5cfa0b3c80bc8p-26, 0x0.b0acaaed4e7168p-35, -0x0.ae332c307d39f8p-44, 0x0.a0b6e6ea31dc90p-53, -0x0.8be4d5748a5760p-62, 0x0.e743af1b71cfb0p-72, -0x0.b6743f42a25fa0p-81, // x in subrange 2:18 (0.640625..0.648438)
+ 0x0.8bd86d25dcf8a8p-17, -0x0.a313af8c89c838p-26, 0x0.ad4f02c70c0fb0p-35, -0x0.aa7a436dc88e90p-44, 0x0.9cf02d0b9ba110p-53, -0x0.88547c45176c58p-62, 0x0.e0f198f6b49e30p-72, -0x0.b125d91b637cd8p-81, // x in subrange 2:19 (0.648438..0.65625)
+ 0x0.89f33b51a85340p-17, -0x0.a0651017d76c70p-26, 0x0.aa03bf03936ff0p-35, -0x0.a6d7b8dea86998p-44, 0x0.99420dfd663e80p-53, -0x0.84dd0cdbf8c270p-62, 0x0.dace879ba84898p-72, -0x0.ac012e4620a9e0p-81, // x in subrange 2:20 (0.65625..0.664062)
+ 0x0.881601bc5dae58p-17, -0x0.9dc379a1eb1fc8p-26, 0x0.a6ca7139934e80p-35, -0x0.a34afae84d7b50p-44, 0x0.95abdde69caf88p-53, -0x0.817dce0d6b5d18p-62, 0x0.d4d9098d275028p-72, -0x0.a704e5dfe08888p-81, // x in subrange 2:21 (0.664062..0.671875)
+ 0x0.864099b5ebf7a0p-17, -0x0.9b2ea52b019650p-26, 0x0.a3a2adcdc7dcb0p-35, -0x0.9fd37be7f5b068p-44, 0x0.922cf5ea7f9098p-53, -0x0.fc6c18b7485e50p-63, 0x0.cf0fb9394c5f98p-72, -0x0.a22fb2abd256f8p-81, // x in subrange 2:22 (0.671875..0.679688)
+ 0x0.8472dd60c141c0p-17, -0x0.98a64d5c4928a8p-26, 0x0.a08c0bdf6c80b8p-35, -0x0.9c70b21578eaa8p-44, 0x0.8ec4b401685080p-53, -0x0.f60a338fe4d3d0p-63, 0x0.c9713c927643f0p-72, -0x0.9d8052aa4d4d78p-81, // x in subrange 2:23 (0.679688..0.6875)
+ 0x0.82aca7ace02818p-17, -0x0.962a2e7d1e0128p-26, 0x0.9d8625353e9160p-35, -0x0.99221766bc9970p-44, 0x0.8b727ad2eee058p-53, -0x0.efd49b4aece198p-63, 0x0.c3fc44abeb84e0p-72, -0x0.98f58eb3a78e08p-81, // x in subrange 2:24 (0.6875..0.695312)
+ 0x0.80edd453150d30p-17, -0x0.93ba06689123d0p-26, 0x0.9a90962b0c9e50p-35, -0x0.95e7297406c3f0p-44, 0x0.8835b1914703f0p-53, -0x0.e9ca08dabe6e20p-63, 0x0.beaf8d59fbb1a8p-72, -0x0.948e3a16bf5990p-81, // x in subrange 2:25 (0.695312..0.703125)
+ 0x0.fe6c7fa094ad10p-18, -0x0.915594833826f8p-26, 0x0.97aafd9fcdf980p-35, -0x0.92bf695d2956d0p-44, 0x0.850dc3d5cac680p-53, -0x0.e3e93f2940a4c8p-63, 0x0.b989dcd57dc028p-72, -0x0.9049323b12b420p-81, // x in subrange 2:26 (0.703125..0.710938)
+ 0x0.fb0b8ec1f59d90p-18, -0x0.8efc99b1438450p-26, 0x0.94d4fce43e59f8p-35, -0x0.8faa5baf7ec510p-44, 0x0.81fa217ea7f500p-53, -0x0.de310ac6271b40p-63, 0x0.b48a03628c1848p-72, -0x0.8c255e46430978p-81, // x in subrange 2:27 (0.710938..0.71875)
+ 0x0.f7b891f982bb38p-18, -0x0.8caed84cd97a08p-26, 0x0.920e37a9f99208p-35, -0x0.8ca7884cb147a0p-44, 0x0.fdf47d1b4db500p-54, -0x0.d8a04197f282e8p-63, 0x0.afaedafa601590p-72, -0x0.8821aec4e3bbf8p-81, // x in subrange 2:28 (0.71875..0.726562)
+ 0x0.f47346a40a9568p-18, -0x0.8a6c141cb38340p-26, 0x0.8f5653f3137488p-35, -0x0.89b67a52464048p-44, 0x0.f81b261001a460p-54, -0x0.d335c28f966010p-63, 0x0.aaf746f82fecc0p-72, -0x0.843d1d5673d278p-81, // x in subrange 2:29 (0.726562..0.734375)
+ 0x0.f13b6b83848d40p-18, -0x0.8834124afc7ef0p-26, 0x0.8cacfa02282390p-35, -0x0.86d6c001e77c78p-44, 0x0.f26735ae7b2ea0p-54, -0x0.cdf0755eac2438p-63, 0x0.a66233c8f2fb88p-72, -0x0.8076ac5c643710p-81, // x in subrange 2:30 (0.734375..0.742188)
+ 0x0.ee10c0b6d6f590p-18, -0x0.8606995c6daae8p-26, 0x0.8a11d44ae12310p-35, -0x0.8407eaaa644a18p-44, 0x0.ecd7ab561d1838p-54, -0x0.c8cf4a301ce4d8p-63, 0x0.a1ee969df19678p-72, -0x0.f99acd581a53d8p-82, // x in subrange 2:31 (0.742188..0.75)
+ 0x0.eaf307b1d1cc78p-18, -0x0.83e37127a8a6c8p-26, 0x0.87848f62eba6c0p-35, -0x0.81498e916483e8p-44, 0x0.e76b8db83efea8p-54, -0x0.c3d139632bbaa0p-63, 0x0.9d9b6d22066c40p-72, -0x0.f280be86ed5ed8p-82, // x in subrange 2:32 (0.75..0.757812)
+ 0x0.e7e203355ca690p-18, -0x0.81ca62ccccc130p-26, 0x0.8504d9f35caf70p-35, -0x0.fd3685bb8fdac0p-45, 0x0.e221ea9fa98660p-54, -0x0.bef54348cba188p-63, 0x0.9967bd31788db8p-72, -0x0.eb9d6201b1b328p-82, // x in subrange 2:33 (0.757812..0.765625)
+ 0x0.e4dd7747d66c68p-18, -0x0.ff76715a8bbc10p-27, 0x0.829264aa7fa888p-35, -0x0.f7f9430558cbc8p-45, 0x0.dcf9d6b9dd6348p-54, -0x0.ba3a6fe32c74b8p-63, 0x0.95529494561ad8p-72, -0x0.e4eefcb973b478p-82, // x in subrange 2:34 (0.765625..0.773438)
+ 0x0.e1e5292da59608p-18, -0x0.fb6b7cc7a6a668p-27, 0x0.802ce22e0c5058p-35, -0x0.f2da8e562b5328p-45, 0x0.d7f26d6215fec0p-54, -0x0.b59fcea76b5e58p-63, 0x0.915b08bb387958p-72, -0x0.de73e24d219ca0p-82, // x in subrange 2:35 (0.773438..0.78125)
+ 0x0.def8df61f79970p-18, -0x0.f77381798a47a8p-27, 0x0.fba80e1b81a098p-36, -0x0.edd9a64c6306a0p-45, 0x0.d30ad06df90600p-54, -0x0.b124764153c8d0p-63, 0x0.8d80367e5bd840p-72, -0x0.d82a7487aa5520p-82, // x in subrange 2:36 (0.78125..0.789062)
+ 0x0.dc18618fae4a48p-18, -0x0.f38e1b5cdc1fe8p-27, 0x0.f70f136cba0740p-36, -0x0.e8f5cea866fce0p-45, 0x0.ce4227fbe4adc8p-54, -0x0.acc784591e8cd0p-63, 0x0.89c141def496f0p-72, -0x0.d21122e2c74128p-82, // x in subrange 2:37 (0.789062..0.796875)
+ 0x0.d943788a79f2b0p-18, -0x0.efbae8a391f358p-27, 0x0.f28e44c9f80580p-36, -0x0.e42e502786a1d0p-45, 0x0.c997a242cef550p-54, -0x0.a8881d5b1dc080p-63, 0x0.861d55caadf3c0p-72, -0x0.cc266a0e446fe0p-82, // x in subrange 2:38 (0.796875..0.804688)
+ 0x0.d679ee481ef510p-18, -0x0.ebf989b6a05848p-27, 0x0.ee2516359242b8p-36, -0x0.df82785ff2bd50p-45, 0x0.c50a7363a8ac20p-54, -0x0.a4656c41442d40p-63, 0x0.8293a3e13e2a50p-72, -0x0.c668d37b9c6618p-82, // x in subrange 2:39 (0.804688..0.8125)
+ 0x0.d3bb8dd9e5d060p-18, -0x0.e849a1280a38e8p-27, 0x0.e9d2ff221b4848p-36, -0x0.daf1999dc9bca8p-45, 0x0.c099d53c3772c0p-54, -0x0.a05ea25e780d58p-63, 0x0.fe46c877f9cc88p-73, -0x0.c0d6f4edbe5420p-82, // x in subrange 2:40 (0.8125..0.820312)
+ 0x0.d10823663467c0p-18, -0x0.e4aad3a54e8cf0p-27, 0x0.e5977a5b291158p-36, -0x0.d67b0ac12e9a18p-45, 0x0.bc45073b5a5f20p-54, -0x0.9c72f72ba14990p-63, 0x0.f797aa6ed34a90p-73, -0x0.bb6f700cd722a0p-82, // x in subrange 2:41 (0.820312..0.828125)
+ 0x0.ce5f7c224f7700p-18, -0x0.e11cc7ea31a5b8p-27, 0x0.e17205eec39f20p-36, -0x0.d21e271d620678p-45, 0x0.b80b4e36ad5960p-54, -0x0.98a1a81663fdb0p-63, 0x0.f118767d20a478p-73, -0x0.b630f1fdf74570p-82, // x in subrange 2:42 (0.828125..0.835938)
+ 0x0.cbc1664c4324f0p-18, -0x0.dd9f26b3df79e8p-27, 0x0.dd622317759a88p-36, -0x0.cdda4e58d5bf40p-45, 0x0.b3ebf4417faf38p-54, -0x0.94e9f8517897c0p-63, 0x0.eac7c130761428p-73, -0x0.b11a32fe70ba18p-82, // x in subrange 2:43 (0.835938..0.84375)
+ 0x0.c92db124f1acb8p-18, -0x0.da319ab46472d0p-27, 0x0.d9675626fa3420p-36, -0x0.c9aee44e323f88p-45, 0x0.afe6488512c000p-54, -0x0.914b30a6936a40p-63, 0x0.e4a42a6bc13c60p-73, -0x0.ac29f602c9fde0p-82, // x in subrange 2:44 (0.84375..0.851562)
+ 0x0.c6a42cea471db8p-18, -0x0.d6d3d0867a4f68p-27, 0x0.d5812671839980p-36, -0x0.c59b50ee473ba0p-45, 0x0.abf99f1a160610p-54, -0x0.8dc49f49ce0b50p-63, 0x0.deac5d088003f0p-73, -0x0.a75f08592420e0p-82, // x in subrange 2:45 (0.851562..0.859375)
+ 0x0.c424aad19139e8p-18, -0x0.d38576a1a6c410p-27, 0x0.d1af1e39957c88p-36, -0x0.c19f0022df9620p-45, 0x0.a82550e3561e30p-54, -0x0.8a5597ae8556c0p-63, 0x0.d8df0e7b32cf48p-73, -0x0.a2b8414ef36560p-82, // x in subrange 2:46 (0.859375..0.867188)
+ 0x0.c1aefd01fa8048p-18, -0x0.d0463d4ea98f10p-27, 0x0.cdf0ca9c6f4cf0p-36, -0x0.bdb961b271bb48p-45, 0x0.a468bb6994ca78p-54, -0x0.86fd725d9f60f8p-63, 0x0.d33afe7aecbf58p-73, -0x0.9e3481d9eb1a80p-82, // x in subrange 2:47 (0.867188..0.875)
+ 0x0.bf42f68f2778f0p-18, -0x0.cd15d69c37cc20p-27, 0x0.ca45bb7f01e778p-36, -0x0.b9e9e924a58970p-45, 0x0.a0c340b8804348p-54, -0x0.83bb8ccd2d1af8p-63, 0x0.cdbef6abe5b0e0p-73, -0x0.99d2b443fe9138p-82, // x in subrange 2:48 (0.875..0.882812)
+ 0x0.bce06b73f55dc8p-18, -0x0.c9f3f654026118p-27, 0x0.c6ad837b6c9f78p-36, -0x0.b6300da7a92708p-45, 0x0.9d34473cc07e58p-54, -0x0.808f49395bd7b8p-63, 0x0.c869ca4cf2c1b8p-73, -0x0.9591cbda5a3158p-82, // x in subrange 2:49 (0.882812..0.890625)
+ 0x0.ba87308d5941f8p-18, -0x0.c6e051f0056e60p-27, 0x0.c327b7cefda838p-36, -0x0.b28b49f64e5dd0p-45, 0x0.99bb39a3116548p-54, -0x0.faf01cfd569b50p-64, 0x0.c33a55e7cb20f8p-73, -0x0.9170c49f38cd28p-82, // x in subrange 2:50 (0.890625..0.898438)
+ 0x0.b8371b955ee028p-18, -0x0.c3daa0901ebd70p-27, 0x0.bfb3f048b20360p-36, -0x0.aefb1c3eea47e0p-45, 0x0.965786b8614248p-54, -0x0.f4ea8feaba2b08p-64, 0x0.be2f7f03ffe590p-73, -0x0.8d6ea2fe7a6248p-82, // x in subrange 2:51 (0.898438..0.90625)
+ 0x0.b5f0031e463d48p-18, -0x0.c0e29aefe936f0p-27, 0x0.bc51c738313798p-36, -0x0.ab7f060af14e98p-45, 0x0.9308a14aeaf628p-54, -0x0.ef0cca9c261828p-64, 0x0.b94833dc8e92d0p-73, -0x0.898a7384e279f8p-82, // x in subrange 2:52 (0.90625..0.914062)
+ 0x0.b3b1be8dbf53e8p-18, -0x0.bdf7fb5cdb7818p-27, 0x0.b900d95d413090p-36, -0x0.a8168c2749ad48p-45, 0x0.8fce000c43d3e0p-54, -0x0.e955b4df24b5a0p-64, 0x0.b4836b17f6d768p-73, -0x0.85c34a99e55500p-82, // x in subrange 2:53 (0.914062..0.921875)
+ 0x0.b17c2618430150p-18, -0x0.bb1a7daca7aea0p-27, 0x0.b5c0c5d7aec5f0p-36, -0x0.a4c1368d4ed998p-45, 0x0.8ca71d74554308p-54, -0x0.e3c43eab4290a8p-64, 0x0.afe02382bced28p-73, -0x0.8218443bec0060p-82, // x in subrange 2:54 (0.921875..0.929688)
+ 0x0.af4f12bc887398p-18, -0x0.b849df33daee90p-27, 0x0.b2912e17a78278p-36, -0x0.a17e904c8061e0p-45, 0x0.899377a53a9020p-54, -0x0.de575fe1ec9380p-64, 0x0.ab5d63cc42d3f8p-73, -0x0.fd11077df0ac58p-83, // x in subrange 2:55 (0.929688..0.9375)
+ 0x0.ad2a5e3f165c80p-18, -0x0.b585debcba4430p-27, 0x0.af71b5ce815ed0p-36, -0x0.9e4e2774d6fe80p-45, 0x0.8692904ffb91c8p-54, -0x0.d90e18105e47e0p-64, 0x0.a6fa3a45e36c68p-73, -0x0.f626671b2598f8p-83, // x in subrange 2:56 (0.9375..0.945312)
+ 0x0.ab0de325ef32a8p-18, -0x0.b2ce3c7e5bd040p-27, 0x0.ac6202dfed3e98p-36, -0x0.9b2f8d01babe80p-45, 0x0.83a3ec9a1d0998p-54, -0x0.d3e76e338e7bc8p-64, 0x0.a2b5bca43b3aa0p-73, -0x0.ef6f09d7d99208p-83, // x in subrange 2:57 (0.945312..0.953125)
+ 0x0.a8f97cb457cf70p-18, -0x0.b022ba13fa4a48p-27, 0x0.a961bd539115c8p-36, -0x0.982254c5956230p-45, 0x0.80c71503ffe500p-54, -0x0.cee2707e092928p-64, 0x0.9e8f07c28b5508p-73, -0x0.e8e95f7a45fb00p-83, // x in subrange 2:58 (0.953125..0.960938)
+ 0x0.a6ed06e6b7bcd0p-18, -0x0.ad831a74814f90p-27, 0x0.a6708f4706b5e8p-36, -0x0.95261555fc1e18p-45, 0x0.fbf72aa0117838p-55, -0x0.c9fe341fa61b80p-64, 0x0.9a853f6823b830p-73, -0x0.e293e495182b70p-83, // x in subrange 2:59 (0.960938..0.96875)
+ 0x0.a4e85e6e928af0p-18, -0x0.aaef21ea50f2d8p-27, 0x0.a38e24e03c59b0p-36, -0x0.923a67f86c2860p-45, 0x0.f681f8d5124ce8p-55, -0x0.c539d50f0c6088p-64, 0x0.96978e0fc2e6c0p-73, -0x0.dc6d221a017ab8p-83, // x in subrange 2:60 (0.96875..0.976562)
+ 0x0.a2eb60ae9989f0p-18, -0x0.a866960b370ae0p-27, 0x0.a0ba2c40341c30p-36, -0x0.8f5ee88f959810p-45, 0x0.f12db8a4c967c8p-55, -0x0.c09475d4f31ff8p-64, 0x0.92c524b0d96438p-73, -0x0.d673acf0157418p-83, // x in subrange 2:61 (0.976562..0.984375)
+ 0x0.a0f5ebb6d54938p-18, -0x0.a5e93db09cc9e0p-27, 0x0.9df455761f9ef8p-36, -0x0.8c9335893042e8p-45, 0x0.ebf99404d71970p-55, -0x0.bc0d3f5910ff60p-64, 0x0.8f0d3a8aa03a30p-73, -0x0.d0a6258dd30990p-83, // x in subrange 2:62 (0.984375..0.992188)
+ 0x0.9f07de40e64158p-18, -0x0.a376e0efe73288p-27, 0x0.9b3c5272d53758p-36, -0x0.89d6efcc5668c0p-45, 0x0.e6e4bab6c9df00p-55, -0x0.b7a360b0abbb08p-64, 0x0.8b6f0cf0f25380p-73, -0x0.cb033796b6ecc0p-83, // x in subrange 2:63 (0.992188..1)
+ 0x0.9c3064f0f782a8p-16, -0x0.9fdf7633bc2b18p-24, 0x0.974194c1cb6210p-32, -0x0.85d8a9fcede488p-40, 0x0.df7e6842dd10a8p-49, -0x0.b139dd1194d758p-57, 0x0.8630fb12a59208p-65, -0x0.c2dca1a40e0148p-74, // x in subrange 3:0 (1..1.01562)
+ 0x0.987f2ce5da9ce0p-16, -0x0.9b3a0e50c25818p-24, 0x0.9220ef250e53b8p-32, -0x0.80b8531ae00568p-40, 0x0.d606f6facd2ca8p-49, -0x0.a90cab39e825d0p-57, 0x0.ff0c5816c840b0p-66, -0x0.b886e863c69270p-74, // x in subrange 3:1 (1.01562..1.03125)
+ 0x0.94e95bd03eae00p-16, -0x0.96bce179943348p-24, 0x0.8d327558295ed8p-32, -0x0.f79eee6f48a9f0p-41, 0x0.ccff21155fa968p-49, -0x0.a1474bb51d6598p-57, 0x0.f26b7b11046420p-66, -0x0.aec5b2dda4dab0p-74, // x in subrange 3:2 (1.03125..1.04688)
+ 0x0.916e04f0d5c668p-16, -0x0.926666d87a9298p-24, 0x0.887409695a4650p-32, -0x0.ee3712d2f31860p-41, 0x0.c4615fdc03ebc0p-49, -0x0.99e44173b913e0p-57, 0x0.e6753d9d8c0f68p-66, -0x0.a5903ac701b188p-74, // x in subrange 3:3 (1.04688..1.0625)
+ 0x0.8e0c448b4f1038p-16, -0x0.8e352622fc0188p-24, 0x0.83e3a6452c66e8p-32, -0x0.e5343a197d9510p-41, 0x0.bc2877430a2638p-49, -0x0.92de5e06d56888p-57, 0x0.db2017460c2990p-66, -0x0.9cde44e0ccc238p-74, // x in subrange 3:4 (1.0625..1.07812)
+ 0x0.8ac33f855e4120p-16, -0x0.8a27b6d7de48f8p-24, 0x0.fefebcf8a23e40p-33, -0x0.dc91c8212d9098p-41, 0x0.b44f71bd9f6c98p-49, -0x0.8c30bcfe6b2f20p-57, 0x0.d0630f1f455258p-66, -0x0.94a817fc076ff8p-74, // x in subrange 3:5 (1.07812..1.09375)
+ 0x0.8792230a321540p-16, -0x0.863cbf86b675e8p-24, 0x0.f68ab633fe5978p-33, -0x0.d44b5ab7a95468p-41, 0x0.acd19c509bcc50p-49, -0x0.85d6bf90ca5ca8p-57, 0x0.c635b2f02f5d20p-66, -0x0.8ce67498c5d578p-74, // x in subrange 3:6 (1.09375..1.10938)
+ 0x0.84782432220188p-16, -0x0.8272f52086dfe0p-24, 0x0.ee67b513daaa28p-33, -0x0.cc5cc6918a9168p-41, 0x0.a5aa82e0432f90p-49, -0x0.ff98110d16b680p-58, 0x0.bc900eead1a5e0p-66, -0x0.85928d14f0a070p-74, // x in subrange 3:7 (1.10938..1.125)
+ 0x0.81747fae5e3900p-16, -0x0.fd9234a1e3a960p-25, 0x0.e6925f1a14fe58p-33, -0x0.c4c2146cfc6f30p-41, 0x0.9ed5ecb55997b8p-49, -0x0.f418f0cd25d2a8p-58, 0x0.b36aa5ed0fbcb8p-66, -0x0.fd4bfcc192c650p-75, // x in subrange 3:8 (1.125..1.14062)
+ 0x0.fd0cf2f0dfc8a8p-17, -0x0.f67bfdbf1c9458p-25, 0x0.df07807844bf20p-33, -0x0.bd777e5ce1c470p-41, 0x0.984fd93626bb48p-49, -0x0.e92853bc1b6108p-58, 0x0.aabe6a40573980p-66, -0x0.f035925fd603f0p-75, // x in subrange 3:9 (1.14062..1.15625)
+ 0x0.f75ab90ab40eb0p-17, -0x0.efa0fe31e49758p-25, 0x0.d7c40a2f540568p-33, -0x0.b6796d3a278098p-41, 0x0.92147cd03c9c08p-49, -0x0.debedcc11d88d0p-58, 0x0.a284b6cfbc6b90p-66, -0x0.e3d6973c548058p-75, // x in subrange 3:10 (1.15625..1.17188)
+ 0x0.f1d0f4f85c1030p-17, -0x0.e8ff067e19a1f8p-25, 0x0.d0c51047f5e378p-33, -0x0.afc476390c27f0p-41, 0x0.8c203e10087f68p-49, -0x0.d4d595f97ade60p-58, 0x0.9ab748cca8f308p-66, -0x0.d8247680b06260p-75, // x in subrange 3:11 (1.17188..1.1875)
+ 0x0.ec6e56dfd23f30p-17, -0x0.e293fe00dc9608p-25, 0x0.ca07c8229cd330p-33, -0x0.a95558a047c658p-41, 0x0.866fb2e3661710p-49, -0x0.cb65eac476cdc8p-58, 0x0.935039bac9fe50p-66, -0x0.cd153f32f4d220p-75, // x in subrange 3:12 (1.1875..1.20312)
+ 0x0.e7319b38e46240p-17, -0x0.dc5de1ec48fb88p-25, 0x0.c38986dda86400p-33, -0x0.a328fba0200b68p-41, 0x0.80ff9e0499d888p-49, -0x0.c269a22b4a1ce8p-58, 0x0.8c49f9dc6cafe8p-66, -0x0.c29f99db283248p-75, // x in subrange 3:13 (1.20312..1.21875)
+ 0x0.e2198a4d233330p-17, -0x0.d65ac44fa67970p-25, 0x0.bd47bfd0943590p-33, -0x0.9d3c6c47928788p-41, 0x0.f799d916836bf8p-50, -0x0.b9dad99f841990p-58, 0x0.859f4af8eed0c8p-66, -0x0.b8babed73145e8p-75, // x in subrange 3:14 (1.21875..1.23438)
+ 0x0.dd24f7bd7d02d8p-17, -0x0.d088cb2b70a4e0p-25, 0x0.b740031b041900p-33, -0x0.978cdb95db5bf8p-41, 0x0.eda96741e5b010p-50, -0x0.b1b4000a5b1fe8p-58, 0x0.fe9676eeb22f58p-67, -0x0.af5e6d5128adf0p-75, // x in subrange 3:15 (1.23438..1.25)
+ 0x0.d852c20d3e2f20p-17, -0x0.cae62f909a9668p-25, 0x0.b16ffc4699ed38p-33, -0x0.92179ca6b94088p-41, 0x0.e4285caebf9900p-50, -0x0.a9efd127d68cd0p-58, 0x0.f292438f3f27a0p-67, -0x0.a682e2cd077c38p-75, // x in subrange 3:16 (1.25..1.26562)
+ 0x0.d3a1d23235c038p-17, -0x0.c5713cca7c0fc8p-25, 0x0.abd570fa918470p-33, -0x0.8cda22f7e8a750p-41, 0x0.db11773c0a1700p-50, -0x0.a2895129115c00p-58, 0x0.e729302ac98a40p-67, -0x0.9e20d3436b3760p-75, // x in subrange 3:17 (1.26562..1.28125)
+ 0x0.cf111b29bfd570p-17, -0x0.c0284f92dddfd0p-25, 0x0.a66e3fc02da880p-33, -0x0.87d200c6671d50p-41, 0x0.d25fb8aaf3be48p-50, -0x0.9b7bc899241620p-58, 0x0.dc52f07eea4c78p-67, -0x0.963161bfe0bb40p-75, // x in subrange 3:18 (1.28125..1.29688)
+ 0x0.ca9f99927ab380p-17, -0x0.bb09d54fa29ff0p-25, 0x0.a1385ed70f3a70p-33, -0x0.82fce58225e7d8p-41, 0x0.ca0e62fd439c48p-50, -0x0.94c2c0808eb6b8p-58, 0x0.d207b01f07c2c8p-67, -0x0.8eae1979d30238p-75, // x in subrange 3:19 (1.29688..1.3125)
+ 0x0.c64c534a6e4058p-17, -0x0.b6144b598feb30p-25, 0x0.9c31db189c7c48p-33, -0x0.fcb138adcec408p-42, 0x0.c218f5082d91a8p-50, -0x0.8e59fec34033d8p-58, 0x0.c8400b5bfd1ee8p-67, -0x0.8790e75fda1150p-75, // x in subrange 3:20 (1.3125..1.32812)
+ 0x0.c2165711708d28p-17, -0x0.b1463e4bc2cb90p-25, 0x0.9758d6e9aade78p-33, -0x0.f3c615922bb690p-42, 0x0.ba7b27387d47d0p-50, -0x0.883d82b599af80p-58, 0x0.bef5089c2b4158p-67, -0x0.80d4140db9efd8p-75, // x in subrange 3:21 (1.32812..1.34375)
+ 0x0.bdfcbc2f94bb28p-17, -0x0.ac9e495b605968p-25, 0x0.92ab8939a93d80p-33, -0x0.eb345ecae98970p-42, 0x0.b330e8852e0ca0p-50, -0x0.826981e50761e0p-58, 0x0.b620121cb3a060p-67, -0x0.f4e47c4bd52d60p-76, // x in subrange 3:22 (1.34375..1.35938)
+ 0x0.b9fea21f741050p-17, -0x0.a81b15b7196da8p-25, 0x0.8e283c8e935cc8p-33, -0x0.e2f841053bd100p-42, 0x0.ac365b8db3e408p-50, -0x0.f9b4ca22029f88p-59, 0x0.adbaf0151a3f20p-67, -0x0.e8ccaa1001de90p-76, // x in subrange 3:23 (1.35938..1.375)
+ 0x0.b61b303c237700p-17, -0x0.a3bb59ee1dd688p-25, 0x0.89cd4e1d01ab60p-33, -0x0.db0e16269896d0p-42, 0x0.a587d3e16531a8p-50, -0x0.ef198aa2f44668p-59, 0x0.a5bfc336ff4960p-67, -0x0.dd5727bb8e0568p-76, // x in subrange 3:24 (1.375..1.39062)
+ 0x0.b2519572a9e8c8p-17, -0x0.9f7dd95e20c0f8p-25, 0x0.85992cebb203b8p-33, -0x0.d37263110a8170p-42, 0x0.9f21d36d9ca920p-50, -0x0.e4fad2cfe68790p-59, 0x0.9e28ff840c8600p-67, -0x0.d27af9f27e1ec0p-76, // x in subrange 3:25 (1.39062..1.40625)
+ 0x0.aea107f6ce6bb8p-17, -0x0.9b6163a814fcb0p-25, 0x0.818a5901ef2a28p-33, -0x0.cc21d5857c7320p-42, 0x0.9901081050eeb0p-50, -0x0.db52867135aa18p-59, 0x0.96f1677496fe68p-67, -0x0.c82faafc65fbb0p-76, // x in subrange 3:26 (1.40625..1.42188)
+ 0x0.ab08c4fb165360p-17, -0x0.9764d42b4c71f0p-25, 0x0.fb3ec5408ab7e0p-34, -0x0.c519422255f748p-42, 0x0.9322494d02a358p-50, -0x0.d21adad2058838p-59, 0x0.90140769d28328p-67, -0x0.be6d42a4a05d70p-76, // x in subrange 3:27 (1.42188..1.4375)
+ 0x0.a788106bce6510p-17, -0x0.93871186aa8bb0p-25, 0x0.f3add305f49888p-34, -0x0.be55a27cd88878p-42, 0x0.8d82962202aa28p-50, -0x0.c94e52444f80a8p-59, 0x0.898c3166cb9660p-67, -0x0.b52c3e9e4ecc40p-76, // x in subrange 3:28 (1.4375..1.45312)
+ 0x0.a41e34acfb53d8p-17, -0x0.8fc70d1f9d8870p-25, 0x0.ec5f385b8d04c0p-34, -0x0.b7d41353c4e420p-42, 0x0.881f12fc316e70p-50, -0x0.c0e7b7e7481df8p-59, 0x0.8355790bad3198p-67, -0x0.ac658b637452d8p-76, // x in subrange 3:29 (1.45312..1.46875)
+ 0x0.a0ca825b0fc550p-17, -0x0.8c23c2ae969640p-25, 0x0.e5506e80aa61b0p-34, -0x0.b191d2d9e56a58p-42, 0x0.82f507c774f580p-50, -0x0.b8e21bac199948p-59, 0x0.fad75f9e4685e8p-68, -0x0.a4127d87155e70p-76, // x in subrange 3:30 (1.46875..1.48438)
+ 0x0.9d8c500e47b508p-17, -0x0.889c37d0bc5b88p-25, 0x0.de7f09a62cb318p-34, -0x0.ab8c3f172efc20p-42, 0x0.fc03bc347d6cd8p-51, -0x0.b138ce95311658p-59, 0x0.ef95c2e3e1fe58p-68, -0x0.9c2ccb72d3e8d8p-76, // x in subrange 3:31 (1.48438..1.5)
+ 0x0.9a62fa208a9c78p-17, -0x0.852f7b9e971610p-25, 0x0.d7e8b7b7ead368p-34, -0x0.a5c0d45f3d04a0p-42, 0x0.f2863ef5275400p-51, -0x0.a9e75f2c98f338p-59, 0x0.e4dea1522742e0p-68, -0x0.94ae8789020a48p-76, // x in subrange 3:32 (1.5..1.51562)
+ 0x0.974de275b73ff8p-17, -0x0.81dca64778ced8p-25, 0x0.d18b3f3518e9b0p-34, -0x0.a02d2bdbff6c80p-42, 0x0.e96ce77641cb90p-51, -0x0.a2e9962e130d30p-59, 0x0.daaae7f60e78e8p-68, -0x0.8d921aa49ed958p-76, // x in subrange 3:33 (1.51562..1.53125)
+ 0x0.944c70463d68f8p-17, -0x0.fd45b162ce9620p-26, 0x0.cb647e16e3b0e0p-34, -0x0.9acefa2b8231d0p-42, 0x0.e0b33eddfae970p-51, -0x0.9c3b7361dab578p-59, 0x0.d0f3e599f852f0p-68, -0x0.86d23ef122bc58p-76, // x in subrange 3:34 (1.53125..1.54688)
+ 0x0.915e0febeb2a70p-17, -0x0.f702783aa0bb50p-26, 0x0.c57268c486c6a8p-34, -0x0.95a40e0fc657f0p-42, 0x0.d85504e59e37a0p-51, -0x0.95d92aa5277938p-59, 0x0.c7b3453a0167f8p-68, -0x0.8069fb1469a6a0p-76, // x in subrange 3:35 (1.54688..1.5625)
+ 0x0.8e8232b0d49058p-17, -0x0.f0ee039ea82020p-26, 0x0.bfb309142e3f00p-34, -0x0.90aa4f2fb2e798p-42, 0x0.d04e2d1436ca48p-51, -0x0.8fbf211db81638p-59, 0x0.bee308cca840a8p-68, -0x0.f4a93b4ad76fb0p-77, // x in subrange 3:36 (1.5625..1.57812)
+ 0x0.8bb84ea03dcdc8p-17, -0x0.eb06c575e589d0p-26, 0x0.ba247d57fd2e98p-34, -0x0.8bdfbce832d658p-42, 0x0.c89adc1f417f50p-51, -0x0.89e9ea95d82c70p-59, 0x0.b67d845a8cb0a0p-68, -0x0.e91b71d59fc1b0p-77, // x in subrange 3:37 (1.57812..1.59375)
+ 0x0.88ffde59712180p-17, -0x0.e54b3e65dffc68p-26, 0x0.b4c4f7769bcbc8p-34, -0x0.87426d2ca1f6e8p-42, 0x0.c137656f49a108p-51, -0x0.845646fe7bac38p-59, 0x0.ae7d5960653bb8p-68, -0x0.de223db9721528p-77, // x in subrange 3:38 (1.59375..1.60938)
+ 0x0.865860e46abcb8p-17, -0x0.dfb9fd3979ab28p-26, 0x0.af92bc0eb83030p-34, -0x0.82d08b75b793a0p-42, 0x0.ba2048c66aa1a8p-51, -0x0.fe02402a61a850p-60, 0x0.a6dd727697af18p-68, -0x0.d3b5bacafa6b38p-77, // x in subrange 3:39 (1.60938..1.625)
+ 0x0.83c1598845ff58p-17, -0x0.da519e4e7ef0f0p-26, 0x0.aa8c21a4ecb818p-34, -0x0.fd10af7c522f28p-43, 0x0.b3523006d01cb8p-51, -0x0.f3cf0e5799f2d8p-60, 0x0.9f98ff3a2d22b0p-68, -0x0.c9ce75ba7f1d70p-77, // x in subrange 3:40 (1.625..1.64062)
+ 0x0.813a4fa3585600p-17, -0x0.d510cb099e3ec8p-26, 0x0.a5af8fdb867c90p-34, -0x0.f4d04b18947a30p-43, 0x0.acc9ed1769e8a8p-51, -0x0.ea0d661fb2ee30p-60, 0x0.98ab70731fa610p-68, -0x0.c065657955d560p-77, // x in subrange 3:41 (1.64062..1.65625)
+ 0x0.fd859d09cde720p-18, -0x0.cff639507bfda0p-26, 0x0.a0fb7eb3ad7a40p-34, -0x0.ecdcb60ff54988p-43, 0x0.a68477e524d948p-51, -0x0.e0b7fc1fca4d40p-60, 0x0.92107474414520p-68, -0x0.b773e50693b9a8p-77, // x in subrange 3:42 (1.65625..1.67188)
+ 0x0.f8b4ca90cb0268p-18, -0x0.cb00ab099939b8p-26, 0x0.9c6e75d776a5f0p-34, -0x0.e532e038750e18p-43, 0x0.a07eec7f120bd8p-51, -0x0.d7c9c839f79d28p-60, 0x0.8bc3f3b13927a0p-68, -0x0.aef3ad9c69fc78p-77, // x in subrange 3:43 (1.67188..1.6875)
+ 0x0.f4014d64596ad8p-18, -0x0.c62eeda1c79198p-26, 0x0.98070bec6e80e8p-34, -0x0.ddcfdb4792e148p-43, 0x0.9ab6894bfe3e50p-51, -0x0.cf3e020d404f78p-60, 0x0.85c20d874c9af0p-68, -0x0.a6ded1380e9e28p-77, // x in subrange 3:44 (1.6875..1.70312)
+ 0x0.ef6a521b311ce8p-18, -0x0.c17fd996e856c8p-26, 0x0.93c3e5ee30b558p-34, -0x0.d6b0d9407558b0p-43, 0x0.9528ad5810f0c8p-51, -0x0.c7101d9f7d2420p-60, 0x0.80071535df22c8p-68, -0x0.9f2fb576784fe0p-77, // x in subrange 3:45 (1.70312..1.71875)
+ 0x0.eaef0c18fd5ab0p-18, -0x0.bcf25207b81278p-26, 0x0.8fa3b690a6e588p-34, -0x0.cfd32af5e66130p-43, 0x0.8fd2d6b91fef90p-51, -0x0.bf3bc8364ce228p-60, 0x0.f51f1e078cf3b0p-69, -0x0.97e10ec0947808p-77, // x in subrange 3:46 (1.71875..1.73438)
+ 0x0.e68eb54fdc0e10p-18, -0x0.b88544486aba80p-26, 0x0.8ba53da98e2b38p-34, -0x0.c9343e9f193c90p-43, 0x0.8ab2a1087784a0p-51, -0x0.b7bce55c5d0540p-60, 0x0.eab05b1d7be7b0p-69, -0x0.90eddbc1f7ea48p-77, // x in subrange 3:47 (1.73438..1.75)
+ 0x0.e2488e04539dc0p-18, -0x0.b437a77bdfd240p-26, 0x0.87c747a0e7cbf8p-34, -0x0.c2d19e7e404cf8p-43, 0x0.85c5c3f0e9fcf0p-51, -0x0.b08f8c107af0a8p-60, 0x0.e0bb9e84e06498p-69, -0x0.8a5161255e6320p-77, // x in subrange 3:48 (1.75..1.76562)
+ 0x0.de1bdc93a449e8p-18, -0x0.b0087c31387b70p-26, 0x0.8408ace7fe68f0p-34, -0x0.bca8ef98060e38p-43, 0x0.810a11d00a81b8p-51, -0x0.a9b0041c077dc8p-60, 0x0.d73af7e96d8b58p-69, -0x0.840725929ab280p-77, // x in subrange 3:49 (1.76562..1.78125)
+ 0x0.da07ed3c5b5f20p-18, -0x0.abf6cc059c1f38p-26, 0x0.80685176ad6e68p-34, -0x0.b6b7f07b098b40p-43, 0x0.f8faecd30f1e38p-52, -0x0.a31ac38e8b90d8p-60, 0x0.ce28c549aab240p-69, -0x0.fc15dbd3c43880p-78, // x in subrange 3:50 (1.78125..1.79688)
+ 0x0.d60c11e90fbca8p-18, -0x0.a801a949fad828p-26, 0x0.f9ca489d398e88p-35, -0x0.b0fc78168ace08p-43, 0x0.f03beb57513f20p-52, -0x0.9ccc6c5c4ee380p-60, 0x0.c57faeb7332868p-69, -0x0.f0b17371425bc8p-78, // x in subrange 3:51 (1.79688..1.8125)
+ 0x0.d227a1fd304788p-18, -0x0.a4282eac9f2518p-26, 0x0.f2fc3e084dbb18p-35, -0x0.ab74749f7f44d0p-43, 0x0.e7d35508021490p-52, -0x0.96c1ca1df29550p-60, 0x0.bd3aa254d43b60p-69, -0x0.e5d97fc88ef290p-78, // x in subrange 3:52 (1.8125..1.82812)
+ 0x0.ce59fa23cdf4b8p-18, -0x0.a0697ee662ae60p-26, 0x0.ec648a99457a90p-35, -0x0.a61dea8350eef0p-43, 0x0.dfbd8b86ef35e0p-52, -0x0.90f7cfef2f6f98p-60, 0x0.b554d08edc8c10p-69, -0x0.db86d70f652cf0p-78, // x in subrange 3:53 (1.82812..1.84375)
+ 0x0.caa27c204c1720p-18, -0x0.9cc4c46b5c0800p-26, 0x0.e60149239f8ef0p-35, -0x0.a0f6f367955ad8p-43, 0x0.d7f71a219e4b60p-52, -0x0.8b6b966af44690p-60, 0x0.adc9a88a29f2f8p-69, -0x0.d1b2b2002fa9d8p-78, // x in subrange 3:54 (1.84375..1.85938)
+ 0x0.c7008ea0e294e8p-18, -0x0.9939311edd63f8p-26, 0x0.dfd0a714479260p-35, -0x0.9bfdbd361323c8p-43, 0x0.d07cb3d1d0aa08p-52, -0x0.861a59c33b9a00p-60, 0x0.a694d4c6b9ac50p-69, -0x0.c856a64cfebc18p-78, // x in subrange 3:55 (1.85938..1.875)
+ 0x0.c3739d12de9138p-18, -0x0.95c5fe0a9e1300p-26, 0x0.d9d0e3ab7f0558p-35, -0x0.9730893475b678p-43, 0x0.c94b3158006718p-52, -0x0.810177f308ad10p-60, 0x0.9fb237f2b17dd0p-69, -0x0.bf6ca16626f990p-78, // x in subrange 3:56 (1.875..1.89062)
+ 0x0.bffb17788ef800p-18, -0x0.926a6b18ea8620p-26, 0x0.d4004f3fa16ae8p-35, -0x0.928dab2717b958p-43, 0x0.c25f8f6e7320e0p-52, -0x0.f83cde1227a998p-61, 0x0.991de9eb084028p-69, -0x0.b6eee38f6702a0p-78, // x in subrange 3:57 (1.89062..1.90625)
+ 0x0.bc967240cb2d28p-18, -0x0.8f25bed1b83e98p-26, 0x0.ce5d4a88576508p-35, -0x0.8e13887e548f50p-43, 0x0.bbb6ed1392ae60p-52, -0x0.eeddb71387ab78p-61, 0x0.92d434e720e348p-69, -0x0.aed7fb3ec70c88p-78, // x in subrange 3:58 (1.90625..1.92188)
+ 0x0.b945262002ea90p-18, -0x0.8bf7461a7cbf60p-26, 0x0.c8e645f1d237a8p-35, -0x0.89c0978dd911d0p-43, 0x0.b54e89ea4eb568p-52, -0x0.e5e0edce4dcc30p-61, 0x0.8cd192ccd4da80p-69, -0x0.a722c0c0b2d0b0p-78, // x in subrange 3:59 (1.92188..1.9375)
+ 0x0.b606afeac71ac8p-18, -0x0.88de53f8a822e0p-26, 0x0.c399c0f7ae4368p-35, -0x0.85935ecd72d6d8p-43, 0x0.af23c4af5bd700p-52, -0x0.dd422c1b62ca00p-61, 0x0.8712aaaa920bc0p-69, -0x0.9fca521d177838p-78, // x in subrange 3:60 (1.9375..1.95312)
+ 0x0.b2da9071bc33e8p-18, -0x0.85da4156a573e8p-26, 0x0.be7649871fed08p-35, -0x0.818a7422e42a60p-43, 0x0.a93419c235cce0p-52, -0x0.d4fd5009354178p-61, 0x0.81944e555510a8p-69, -0x0.98ca0f399343f0p-78, // x in subrange 3:61 (1.95312..1.96875)
+ 0x0.afc04c5ee746d8p-18, -0x0.82ea6ccb445170p-26, 0x0.b97a7b68130980p-35, -0x0.fb48f86892a1c0p-44, 0x0.a37d21c0d98398p-52, -0x0.cd0e6941826a90p-61, 0x0.f8a6f050d5f5a8p-70, -0x0.921d96350465c0p-78, // x in subrange 3:62 (1.96875..1.98438)
+ 0x0.acb76c14479d00p-18, -0x0.800e3a6370bb90p-26, 0x0.b4a4fface948c0p-35, -0x0.f3c05385437f10p-44, 0x0.9dfc90353b0598p-52, -0x0.c571b692215fb8p-61, 0x0.ee9a91ca0c0910p-70, -0x0.8bc0bff9000900p-78, // x in subrange 3:63 (1.98438..2)
+ 0x0.a849b9e216eb68p-16, -0x0.f7ceed15963638p-24, 0x0.ada9d1a8d8ead8p-31, -0x0.e8ec18eaf1f630p-39, 0x0.961ced98c68fe8p-46, -0x0.ba99034e7eff48p-54, 0x0.e05a7a518e1c30p-62, -0x0.82c3931785b268p-69, // x in subrange 4:0 (2..2.03125)
+ 0x0.a29ae0c2b2f128p-16, -0x0.ed3ba8c3061b18p-24, 0x0.a4d5659b9b4770p-31, -0x0.db50d5ac10a3a8p-39, 0x0.8c481609530c70p-46, -0x0.ad226ba9c270f0p-54, 0x0.cec0c8f1143340p-62, -0x0.ef72491068b1f8p-70, // x in subrange 4:1 (2.03125..2.0625)
+ 0x0.9d29dbc5b33180p-16, -0x0.e33182cc790d98p-24, 0x0.9c848b45e137e8p-31, -0x0.ce98ed12c35ac8p-39, 0x0.83284045c68758p-46, -0x0.a0b960a0d17aa8p-54, 0x0.bea26706ec1958p-62, -0x0.db598871a8d640p-70, // x in subrange 4:2 (2.0625..2.09375)
+ 0x0.97f38c54c53cc0p-16, -0x0.d9a8876753cb98p-24, 0x0.94aeb3b5203370p-31, -0x0.c2b412c75919a8p-39, 0x0.f55e9ef0a53010p-47, -0x0.9547422b1b5168p-54, 0x0.afdd54eb8a0e10p-62, -0x0.c90c942e365e48p-70, // x in subrange 4:3 (2.09375..2.125)
+ 0x0.92f501ff848140p-16, -0x0.d09946c2ce1ad8p-24, 0x0.8d4bec8510d558p-31, -0x0.b7933ec139e970p-39, 0x0.e5a0aa4f3da3d0p-47, -0x0.8ab775f132cac0p-54, 0x0.a252cc4e0086f0p-62, -0x0.b85ff19ce927a0p-70, // x in subrange 4:4 (2.125..2.15625)
+ 0x0.8e2b778033ad90p-16, -0x0.c7fccba184c040p-24, 0x0.8654d3be026650p-31, -0x0.ad289236fa17a8p-39, 0x0.d6feec879cd980p-47, -0x0.80f7365792a320p-54, 0x0.95e6edd6f49230p-62, -0x0.a92c79d99a0e90p-70, // x in subrange 4:5 (2.15625..2.1875)
+ 0x0.89944ff6a6dce8p-16, -0x0.bfcc92acf300e0p-24, 0x0.ff85196b282e48p-32, -0x0.a3673ef62c6b10p-39, 0x0.c963a57c646910p-47, -0x0.efeaccd1b45458p-55, 0x0.8a80776825c9a0p-62, -0x0.9b4ee63f81c400p-70, // x in subrange 4:6 (2.1875..2.21875)
+ 0x0.852d1455321d08p-16, -0x0.b8028273678bb0p-24, 0x0.f31d6bb5da32b0p-32, -0x0.9a4370e9088a90p-39, 0x0.bcbaded61cd698p-47, -0x0.df44d43ad05be0p-55, 0x0.80088207f17308p-62, -0x0.8ea76976edf208p-70, // x in subrange 4:7 (2.21875..2.25)
+ 0x0.80f370fbc83c20p-16, -0x0.b098e402659cf8p-24, 0x0.e766beb36573f8p-32, -0x0.91b23995b6e698p-39, 0x0.b0f243e7292598p-47, -0x0.cfe00518c7f158p-55, 0x0.ecd48d4713c2f8p-63, -0x0.831953a9a8ec78p-70, // x in subrange 4:8 (2.25..2.28125)
+ 0x0.f9ca66fb8cc928p-17, -0x0.a98a5c109f77d8p-24, 0x0.dc560501d69840p-32, -0x0.89a97d68373360p-39, 0x0.a5f8fd485d1270p-47, -0x0.c1a25b3da6e888p-55, 0x0.db25d1d56999b8p-63, -0x0.f1158138949180p-71, // x in subrange 4:9 (2.28125..2.3125)
+ 0x0.f200911e652758p-17, -0x0.a2d1e4abd63080p-24, 0x0.d1e0f3b9774d90p-32, -0x0.821fe29c726c58p-39, 0x0.9bbf8fd1204638p-47, -0x0.b47411d1049f38p-55, 0x0.cae28f3a5323a0p-63, -0x0.ddc89d209515a8p-71, // x in subrange 4:10 (2.3125..2.34375)
+ 0x0.ea85742cec2b48p-17, -0x0.9c6ac75fef1410p-24, 0x0.c7fdf3e7008838p-32, -0x0.f61983445820b8p-40, 0x0.9237be97922d40p-47, -0x0.a83f6ea8c575f8p-55, 0x0.bbeba368e5ded8p-63, -0x0.cc21b9e79262b0p-71, // x in subrange 4:11 (2.34375..2.375)
+ 0x0.e3555abfb50120p-17, -0x0.965097cd7b5810p-24, 0x0.bea415305e4928p-32, -0x0.e8d02db0799718p-40, 0x0.89546fada631b8p-47, -0x0.9cf092b5b47d90p-55, 0x0.ae24bfcba75488p-63, -0x0.bbfaa402197ca0p-71, // x in subrange 4:12 (2.375..2.40625)
+ 0x0.dc6cc2e08f58a0p-17, -0x0.907f2ea6c57560p-24, 0x0.b5cb018a70f380p-32, -0x0.dc54eaffad4748p-40, 0x0.81099357cc1298p-47, -0x0.92754f007a31d0p-55, 0x0.a174240cbb67e0p-63, -0x0.ad30cd12bdefd8p-71, // x in subrange 4:13 (2.40625..2.4375)
+ 0x0.d5c85ae9e8bda0p-17, -0x0.8af2a50b3ac170p-24, 0x0.ad6af1e88ab2e0p-32, -0x0.d099f797247868p-40, 0x0.f2981b010b3ec0p-48, -0x0.88bcfdc15a9218p-55, 0x0.95c25fd0d5d870p-63, -0x0.9fa4ee7ae6a1d0p-71, // x in subrange 4:14 (2.4375..2.46875)
+ 0x0.cf64fe9bd47ef8p-17, -0x0.85a75039b95880p-24, 0x0.a57ca3d0810d68p-32, -0x0.c5928fe16e0df8p-40, 0x0.e4234264c22528p-48, -0x0.ff70be5305a000p-56, 0x0.8afa1aaa51b580p-63, -0x0.933ab5b2c5a070p-71, // x in subrange 4:15 (2.46875..2.5)
+ 0x0.c93fb462d110e8p-17, -0x0.8099bd92ebf2f0p-24, 0x0.9df94fc0112678p-32, -0x0.bb32dc473aaae8p-40, 0x0.d6a1bbce837e30p-48, -0x0.eeb2f2ff63cc00p-56, 0x0.8107e19e362c70p-63, -0x0.87d87957987e80p-71, // x in subrange 4:16 (2.5..2.53125)
+ 0x0.c355aaccb063c0p-17, -0x0.f78d5dcae095b0p-25, 0x0.96daa0520d92e0p-32, -0x0.b16fded470faf0p-40, 0x0.ca021d01834dd0p-48, -0x0.df26f877ae4cc8p-56, 0x0.efb3f34e0878f8p-64, -0x0.facdebfc6a0408p-72, // x in subrange 4:17 (2.53125..2.5625)
+ 0x0.bda4362850a098p-17, -0x0.ee562dfc155788p-25, 0x0.901aaa135b7dc0p-32, -0x0.a83f62639e1cf0p-40, 0x0.be345383ab6118p-48, -0x0.d0b54bac020cb0p-56, 0x0.dec06d62643a80p-64, -0x0.e7a223e6585838p-72, // x in subrange 4:18 (2.5625..2.59375)
+ 0x0.b828ce4d14b660p-17, -0x0.e5882ced46b520p-25, 0x0.89b3e3f92e59d8p-32, -0x0.9f97eb2d5a5e18p-40, 0x0.b329884b933510p-48, -0x0.c3485809879008p-56, 0x0.cf17ad36e97878p-64, -0x0.d6074e53c8e440p-72, // x in subrange 4:19 (2.59375..2.625)
+ 0x0.b2e10c8748a398p-17, -0x0.dd1df17e73a960p-25, 0x0.83a1206b392408p-32, -0x0.9770a89c6d83d8p-40, 0x0.a8d405e859eb88p-48, -0x0.b6cc4c5c6ca980p-56, 0x0.c09ebfa336de80p-64, -0x0.c5daa562abb2b8p-72, // x in subrange 4:20 (2.625..2.65625)
+ 0x0.adcaa9a6d4ee20p-17, -0x0.d51262b8beeb58p-25, 0x0.fbbb0dab6b3900p-33, -0x0.8fc1684a60f810p-40, 0x0.9f2720e8e4dd70p-48, -0x0.ab2ef3a9b72118p-56, 0x0.b33d0647fa4b28p-64, -0x0.b6fc922fcb6488p-72, // x in subrange 4:21 (2.65625..2.6875)
+ 0x0.a8e37c2dd7b328p-17, -0x0.cd60b2ae4f8a08p-25, 0x0.f0c91b705f9850p-33, -0x0.88828a0ac96a88p-40, 0x0.9617224db0aa28p-48, -0x0.a05f919eb9c900p-56, 0x0.a6dc010ee549a8p-64, -0x0.a9505e710ee338p-72, // x in subrange 4:22 (2.6875..2.71875)
+ 0x0.a429769ce88b10p-17, -0x0.c60459b5a2b048p-25, 0x0.e663ea4df2a5d0p-33, -0x0.81acf4edec39c8p-40, 0x0.8d9933d57ac870p-48, -0x0.964ec23de4e670p-56, 0x0.9b671ce576c668p-64, -0x0.9cbbedf40d8f30p-72, // x in subrange 4:23 (2.71875..2.75)
+ 0x0.9f9aa5daf78270p-17, -0x0.bef911f96f1c80p-25, 0x0.dc83836c0d7ef8p-33, -0x0.f6741a4b0b6b30p-41, 0x0.85a34df99e2238p-48, -0x0.8cee5c798df3b0p-56, 0x0.90cb872c254c30p-64, -0x0.91277f2cdd3f80p-72, // x in subrange 4:24 (2.75..2.78125)
+ 0x0.9b352fb6def738p-17, -0x0.b83ad356c84758p-25, 0x0.d3206f89876bd8p-33, -0x0.ea475570c3cc10p-41, 0x0.fc584ee6381390p-49, -0x0.843157753f03f0p-56, 0x0.86f805618a5b98p-64, -0x0.867d7218282c00p-72, // x in subrange 4:25 (2.78125..2.8125)
+ 0x0.96f75180e48cb0p-17, -0x0.b1c5cf83b08ea0p-25, 0x0.ca33ae4645bfc8p-33, -0x0.dec821e66e5f70p-41, 0x0.ee564c4a005528p-49, -0x0.f817645a7b12b8p-57, 0x0.fbb9a13b780ef8p-65, -0x0.f95429904170b0p-73, // x in subrange 4:26 (2.8125..2.84375)
+ 0x0.92df5eba86e2a0p-17, -0x0.ab966e78c01810p-25, 0x0.c1b6ae11ac8c78p-33, -0x0.d3ebcd0d8b3630p-41, 0x0.e130a29849fda8p-49, -0x0.e8e4ba94b41850p-57, 0x0.ead6e8fa649da8p-65, -0x0.e736ea0c4148a0p-73, // x in subrange 4:27 (2.84375..2.875)
+ 0x0.8eebbfdb1491c0p-17, -0x0.a5a94b18f27d08p-25, 0x0.b9a344b06aac20p-33, -0x0.c9a85c8955c8e0p-41, 0x0.d4d889aec12d58p-49, -0x0.dab64ddba60fa8p-57, 0x0.db2d624921a988p-65, -0x0.d6826d05dae410p-73, // x in subrange 4:28 (2.875..2.90625)
+ 0x0.8b1af127a553b0p-17, -0x0.9ffb3013109378p-25, 0x0.b1f3a84dc1c070p-33, -0x0.bff480db4d1d78p-41, 0x0.c9404b9bafb728p-49, -0x0.cd79508c6dbb80p-57, 0x0.cca4c01f2c73b0p-65, -0x0.c718da3bf34618p-73, // x in subrange 4:29 (2.90625..2.9375)
+ 0x0.876b819d2868e0p-17, -0x0.9a8914f8869d20p-25, 0x0.aaa2690d6837c8p-33, -0x0.b6c7890a6ab6f8p-41, 0x0.be5b2f575186a8p-49, -0x0.c11c69859785d8p-57, 0x0.bf26b6cace1cf0p-65, -0x0.b8def5b17e69f8p-73, // x in subrange 4:30 (2.9375..2.96875)
+ 0x0.83dc11eb536ea8p-17, -0x0.95501b85ca8ae8p-25, 0x0.a3aa6b140a88c8p-33, -0x0.ae19573ef79638p-41, 0x0.b41d653ea21b70p-49, -0x0.b58f957e4e4e88p-57, 0x0.b29ecf270c5e98p-65, -0x0.abbbe22d553f68p-73, // x in subrange 4:31 (2.96875..3)
+ 0x0.806b537f531908p-17, -0x0.904d8d18c28170p-25, 0x0.9d06e0fd43ac60p-33, -0x0.a5e2563edcb9f0p-41, 0x0.aa7bf5286ad878p-49, -0x0.aac40b08aa2fc0p-57, 0x0.a6fa3dee4e9ff8p-65, -0x0.9f98e9a84ff618p-73, // x in subrange 4:32 (3..3.03125)
+ 0x0.fa300f3a679b38p-18, -0x0.8b7ed851e1fcc0p-25, 0x0.96b346b6a55138p-33, -0x0.9e1b6fb80d35e8p-41, 0x0.a16cadf0f3c308p-49, -0x0.a0ac21008dd5c0p-57, 0x0.9c27bec46f7d30p-65, -0x0.94614b10c4eb58p-73, // x in subrange 4:33 (3.03125..3.0625)
+ 0x0.f3c1fd0e162340p-18, -0x0.86e18edcf46500p-25, 0x0.90ab5cb817ffa8p-33, -0x0.96be03483f8b60p-41, 0x0.98e6165bf97980p-49, -0x0.973b372e827d88p-57, 0x0.9217729d1f9ef0p-65, -0x0.8a020cda925800p-73, // x in subrange 4:34 (3.0625..3.09375)
+ 0x0.ed8a2d61f882e0p-18, -0x0.8273635ec71748p-25, 0x0.8aeb23927bf348p-33, -0x0.8fc3de329e5718p-41, 0x0.90df5f2f7c8a40p-49, -0x0.8e65a0eb6a0540p-57, 0x0.88bac12c9b2688p-65, -0x0.8069d3e1205d58p-73, // x in subrange 4:35 (3.09375..3.125)
+ 0x0.e7867802866a90p-18, -0x0.fc644f0a369988p-26, 0x0.856ed7ce063090p-33, -0x0.892733b56939f8p-41, 0x0.8950566ca7e740p-49, -0x0.86209196bbcc88p-57, 0x0.80043d18dc7e58p-65, -0x0.ef117c5b092018p-74, // x in subrange 4:36 (3.125..3.15625)
+ 0x0.e1b4ce36fcd950p-18, -0x0.f437946cf499b8p-26, 0x0.8032ee125b8e20p-33, -0x0.82e295f2b149f0p-41, 0x0.82315b8e751af0p-49, -0x0.fcc4156ac58718p-58, 0x0.efcf155190af08p-66, -0x0.dea0827c9820e0p-74, // x in subrange 4:37 (3.15625..3.1875)
+ 0x0.dc13396d005f40p-18, -0x0.ec5cabbf68ad60p-26, 0x0.f6681f25cc6410p-34, -0x0.f9e1dec0e67338p-42, 0x0.f6f6a96fc71a78p-50, -0x0.ee4197268b8890p-58, 0x0.e0b2916abc9e90p-66, -0x0.cf6616f129c4c8p-74, // x in subrange 4:38 (3.1875..3.21875)
+ 0x0.d69fd9f7f5c320p-18, -0x0.e4cfddb9fa05a8p-26, 0x0.ecde2d74a4c510p-34, -0x0.ee9af96a9ead00p-42, 0x0.ea4f497b249e88p-50, -0x0.e0a8848a252798p-58, 0x0.d29df74db9b420p-66, -0x0.c149d0e65aa440p-74, // x in subrange 4:39 (3.21875..3.25)
+ 0x0.d158e5e2d13470p-18, -0x0.dd8da3f97daa08p-26, 0x0.e3c218210ce5c0p-34, -0x0.e3e78e900dad90p-42, 0x0.de6043f0ad6458p-50, -0x0.d3e8fbd633c628p-58, 0x0.c57df49a201cf0p-66, -0x0.b4354fa90efbe8p-74, // x in subrange 4:40 (3.25..3.28125)
+ 0x0.cc3ca7d3322498p-18, -0x0.d692a634c731b0p-26, 0x0.db0e46ad8fb5d8p-34, -0x0.d9bf3fb17195f0p-42, 0x0.d31e1ba01407e8p-50, -0x0.c7f44431e0ecd8p-58, 0x0.b940b8cd844500p-66, -0x0.a8140d0715b0a8p-74, // x in subrange 4:41 (3.28125..3.3125)
+ 0x0.c7497dfcb63530p-18, -0x0.cfdbb79ee06af0p-26, 0x0.d2bd71ac2be238p-34, -0x0.d01a3377329b88p-42, 0x0.c87e19de84a600p-50, -0x0.bcbcb6904ec770p-58, 0x0.add5d56110e348p-66, -0x0.9cd333e38b74a8p-74, // x in subrange 4:42 (3.3125..3.34375)
+ 0x0.c27dd923808048p-18, -0x0.c965d472e23dc8p-26, 0x0.caca9db823f3d0p-34, -0x0.c6f10cbb19e9f8p-42, 0x0.be7640240194f8p-50, -0x0.b235a87d94c850p-58, 0x0.a32e20adfb5e10p-66, -0x0.92617a9696a720p-74, // x in subrange 4:43 (3.34375..3.375)
+ 0x0.bdd83bad03f710p-18, -0x0.c32e1fa6a14e40p-26, 0x0.c33116c629de50p-34, -0x0.be3ce237653ba0p-42, 0x0.b4fd3ac52ee860p-50, -0x0.a85358a8ec1620p-58, 0x0.993b9b57da13c8p-66, -0x0.88af00bb72b670p-74, // x in subrange 4:44 (3.375..3.40625)
+ 0x0.b95738be2fc538p-18, -0x0.bd31e0c194bf50p-26, 0x0.bbec6bc4ac2cf8p-34, -0x0.b5f736ceefbb80p-42, 0x0.ac0a54b245e768p-50, -0x0.9f0add058c4ea0p-58, 0x0.8ff1580219a300p-66, -0x0.ff5a603216d730p-75, // x in subrange 4:45 (3.40625..3.4375)
+ 0x0.b4f973662bb1c0p-18, -0x0.b76e81d58d54f8p-26, 0x0.b4f86a86857ba0p-34, -0x0.ae19f262b3d7b0p-42, 0x0.a3956c25ebb740p-50, -0x0.9652125f37c380p-58, 0x0.8743651b6582f0p-66, -0x0.ee9d40b376e3b0p-75, // x in subrange 4:46 (3.4375..3.46875)
+ 0x0.b0bd9dd4e067e0p-18, -0x0.b1e18d96ff6670p-26, 0x0.ae511bf2bf6da0p-34, -0x0.a69f5b29ddc260p-42, 0x0.9b96e8307a05d0p-50, -0x0.8e1f8d42a00468p-58, 0x0.fe4d711dc306d8p-67, -0x0.df0dfa9c7066d0p-75, // x in subrange 4:47 (3.46875..3.5)
+ 0x0.aca2789c948978p-18, -0x0.ac88ad92cae3a8p-26, 0x0.a7f2c07481bb78p-34, -0x0.9f820f82858e88p-42, 0x0.9407af0df1e3c0p-50, -0x0.866a8c1ca8afc0p-58, 0x0.ef223a5f377c98p-67, -0x0.d095defcceaf10p-75, // x in subrange 4:48 (3.5..3.53125)
+ 0x0.a8a6d1fdf37598p-18, -0x0.a761a87f926c20p-26, 0x0.a1d9cca6a4fe28p-34, -0x0.98bd0031f3fa58p-42, 0x0.8ce11d36543480p-50, -0x0.fe55d4ec4d6140p-59, 0x0.e0f2436d6c7998p-67, -0x0.c3200da1b98f30p-75, // x in subrange 4:49 (3.53125..3.5625)
+ 0x0.a4c9853dddde28p-18, -0x0.a26a60a8d55478p-26, 0x0.9c02e636b84ce8p-34, -0x0.924b6b0c0fcd10p-42, 0x0.861cfd197bb9a0p-50, -0x0.f0b22a68280ba0p-59, 0x0.d3ac1260f16fa0p-67, -0x0.b6994e2e4b92e8p-75, // x in subrange 4:50 (3.5625..3.59375)
+ 0x0.a1097a046ead90p-18, -0x0.9da0d27220b958p-26, 0x0.966ae0fb9932f8p-34, -0x0.8c28d5fa3cb788p-42, 0x0.ff6afef1ac0610p-51, -0x0.e3dbff8ca3fe68p-59, 0x0.c73f796f9fc370p-67, -0x0.aaefeca3be1b80p-75, // x in subrange 4:51 (3.59375..3.625)
+ 0x0.9d65a3c4a86b88p-18, -0x0.990312f0c99618p-26, 0x0.910ebc3c078fd8p-34, -0x0.86510a5a914fc0p-42, 0x0.f34a68a4fabea0p-51, -0x0.d7c63462060a20p-59, 0x0.bb9d7cc583ca78p-67, -0x0.a0139907dea918p-75, // x in subrange 4:52 (3.625..3.65625)
+ 0x0.99dd012c484e68p-18, -0x0.948f4e9abd74a0p-26, 0x0.8beba021e32308p-34, -0x0.80c010b0d94b18p-42, 0x0.e7ce08a481db38p-51, -0x0.cc648fbc8cb7b0p-59, 0x0.b0b83a8a2f28f0p-67, -0x0.95f549e05758d0p-75, // x in subrange 4:53 (3.65625..3.6875)
+ 0x0.966e9b9b448908p-18, -0x0.9043c80910dec8p-26, 0x0.86fedb56ff5690p-34, -0x0.f6e45946b96518p-43, 0x0.dcec557c371158p-51, -0x0.c1abae4f70b970p-59, 0x0.a682d4e1dd3f68p-67, -0x0.8c872140621f08p-75, // x in subrange 4:54 (3.6875..3.71875)
+ 0x0.931986a2833150p-18, -0x0.8c1ed6cd0a6a70p-26, 0x0.8245e0c8b3bfa0p-34, -0x0.ecc7b27bbaf088p-43, 0x0.d29c5fa8f12aa0p-51, -0x0.b790f311187ac0p-59, 0x0.9cf15dbe4391a8p-67, -0x0.83bc542cd76fd0p-75, // x in subrange 4:55 (3.71875..3.75)
+ 0x0.8fdcdf895e5fa0p-18, -0x0.881ee6567f2da8p-26, 0x0.fb7c8b1f0a5ab8p-35, -0x0.e3238aeb571bd8p-43, 0x0.c8d5c726e17690p-51, -0x0.ae0a78d4caa8f0p-59, 0x0.93f8c456ecce68p-67, -0x0.f7122840811e50p-76, // x in subrange 4:56 (3.75..3.78125)
+ 0x0.8cb7ccd990ed70p-18, -0x0.844274ea69c128p-26, 0x0.f2cb7df0e8b1f0p-35, -0x0.d9f1a1d42a7228p-43, 0x0.bf90b1c1c3f638p-51, -0x0.a50f0500900670p-59, 0x0.8b8ec424a02668p-67, -0x0.e7c4f4fb78ac28p-76, // x in subrange 4:57 (3.78125..3.8125)
+ 0x0.89a97df12d88b0p-18, -0x0.808812a8b7d7f8p-26, 0x0.ea74415b597088p-35, -0x0.d12c11b9ad63f8p-43, 0x0.b6c5c217e00a00p-51, -0x0.9c95fb4821ed70p-59, 0x0.83a9d53ea197e8p-67, -0x0.d97ceb8c5380d0p-76, // x in subrange 4:58 (3.8125..3.84375)
+ 0x0.86b12a9a47b3f0p-18, -0x0.f9dcc140b7e688p-27, 0x0.e272b5f8efc428p-35, -0x0.c8cd4abd039dc8p-43, 0x0.ae6e0f42293938p-51, -0x0.94975257bdd200p-59, 0x0.f8823bf726ce40p-68, -0x0.cc2770ce76bdd0p-76, // x in subrange 4:59 (3.84375..3.875)
+ 0x0.83ce12a7fbc9d0p-18, -0x0.f2e81fe181f600p-27, 0x0.dac2f26d015b40p-35, -0x0.c0d00d564a83e0p-43, 0x0.a6831d14eb06b8p-51, -0x0.8d0b895b838e20p-59, 0x0.ea98cb74e9e698p-68, -0x0.bfb351ffbb7b18p-76, // x in subrange 4:60 (3.875..3.90625)
+ 0x0.80ff7d98883830p-18, -0x0.ec2fc1ef992f98p-27, 0x0.d361405929f608p-35, -0x0.b92f656786b150p-43, 0x0.9efed4ed6e08b8p-51, -0x0.85eb9e51a88a48p-59, 0x0.dd8811755cdff8p-68, -0x0.b410a7f1871ee8p-76, // x in subrange 4:61 (3.90625..3.9375)
+ 0x0.fc8974785de308p-19, -0x0.e5b14517565d80p-27, 0x0.cc4a19826c4548p-35, -0x0.b1e6a5a2d588c8p-43, 0x0.97db7f01f1cb08p-51, -0x0.fe620a2e918a18p-60, 0x0.d141d9d8a41980p-68, -0x0.a930bca5fd1540p-76, // x in subrange 4:62 (3.9375..3.96875)
+ 0x0.f73a3cc1351100p-19, -0x0.df6a627f5ac598p-27, 0x0.c57a2522cd3180p-35, -0x0.aaf1633e027090p-43, 0x0.9113bc2a3053b8p-51, -0x0.f1ab3e41f78de0p-60, 0x0.c5b8ef477ecd40p-68, -0x0.9f05f322a7a6f8p-76, // x in subrange 4:63 (3.96875..4)
+ 0x0.ef88756b3bf7c0p-17, -0x0.d66394bee419e0p-24, 0x0.bbc0cc16d0bd00p-31, -0x0.a114f9ff5852f8p-38, 0x0.8788d608f94580p-45, -0x0.dfe5391bdc5668p-53, 0x0.b5b7867d7fb9c0p-60, -0x0.9100eafbb56108p-67, // x in subrange 5:0 (4..4.0625)
+ 0x0.e5c0a7d7463fd8p-17, -0x0.cb099e6dab93c0p-24, 0x0.afa67d984542b8p-31, -0x0.94ee3f4bb806b8p-38, 0x0.f7c708a2330880p-46, -0x0.ca683562350fb8p-53, 0x0.a285d14d55bdd8p-60, -0x0.805756dbb1b940p-67, // x in subrange 5:1 (4.0625..4.125)
+ 0x0.dc7ca5a748b290p-17, -0x0.c069ed9a72ec50p-24, 0x0.a474a6266a53f8p-31, -0x0.89d16c90365f80p-38, 0x0.e2b5ce4cb5ccb0p-46, -0x0.b72d70e92d23b8p-53, 0x0.91861e8f57e838p-60, -0x0.e37767f023c188p-68, // x in subrange 5:2 (4.125..4.1875)
+ 0x0.d3b4083d8dbfd8p-17, -0x0.b6769b9c7a2f78p-24, 0x0.9a1780f42718d0p-31, -0x0.ff4a7af2d994a8p-39, 0x0.cfa26bdeafa760p-46, -0x0.a5f31765b3e208p-53, 0x0.8273725d5abb48p-60, -0x0.c9d1dd4551b7c0p-68, // x in subrange 5:3 (4.1875..4.25)
+ 0x0.cb5f089ff28f00p-17, -0x0.ad22eedda74dd8p-24, 0x0.907d27b5abf698p-31, -0x0.eca61e42aa24e0p-39, 0x0.be58101f43d488p-46, -0x0.967f5fc57c6d50p-53, 0x0.ea23ac588a5aa0p-61, -0x0.b3471c8a9acb20p-68, // x in subrange 5:4 (4.25..4.3125)
+ 0x0.c3767208157798p-17, -0x0.a4633e86fedf70p-24, 0x0.8795610be58fe8p-31, -0x0.db8d28342e5888p-39, 0x0.aea7d79c042a88p-46, -0x0.889f8013990180p-53, 0x0.d25a320570c1b8p-61, -0x0.9f709a4ffac948p-68, // x in subrange 5:5 (4.3125..4.375)
+ 0x0.bbf395b58f0400p-17, -0x0.9c2cd918e82b98p-24, 0x0.fea2e901f44e38p-32, -0x0.cbdb23576ea948p-39, 0x0.a06815b54659c8p-46, -0x0.f84d8caa502438p-54, 0x0.bd2f7caddf4f50p-61, -0x0.8df5cf1f5ef7c0p-68, // x in subrange 5:6 (4.375..4.4375)
+ 0x0.b4d03fe12820f8p-17, -0x0.9475ed9ba9f0b0p-24, 0x0.ef4806d4046dd8p-32, -0x0.bd6f4a295ff4b8p-39, 0x0.9373b52c737180p-46, -0x0.e1dba1fe14c550p-54, 0x0.aa5428e044fb50p-61, -0x0.fd14654c3bff88p-69, // x in subrange 5:7 (4.4375..4.5)
+ 0x0.ae06adb3ad6bf0p-17, -0x0.8d35771e955e28p-24, 0x0.e101cc30837f48p-32, -0x0.b02c1f8e254d48p-39, 0x0.87a9ad01106e80p-46, -0x0.cda3c4ee5f0ab0p-54, 0x0.9982d897ffc6b0p-61, -0x0.e1d709fb079ef0p-69, // x in subrange 5:8 (4.5..4.5625)
+ 0x0.a79184263c6240p-17, -0x0.86632a45141068p-24, 0x0.d3ba19ae758050p-32, -0x0.a3f7137ebb1968p-39, 0x0.f9d90dbd9aba88p-47, -0x0.bb68978871d220p-54, 0x0.8a7edbf8ec63d0p-61, -0x0.c9c0b374acddc8p-69, // x in subrange 5:9 (4.5625..4.625)
+ 0x0.a16bc7b4c1deb0p-17, -0x0.ffeec950e25768p-25, 0x0.c75cc88ae22618p-32, -0x0.98b8326160db10p-39, 0x0.e643e98586cf98p-47, -0x0.aaf3d6451abca8p-54, 0x0.fa2614f5452e70p-62, -0x0.b46db4e7079f60p-69, // x in subrange 5:10 (4.625..4.6875)
+ 0x0.9b90d4cde63b90p-17, -0x0.f3d63bb7c64658p-25, 0x0.bbd779480488c8p-32, -0x0.8e59ddb86c9348p-39, 0x0.d464e7a5f51768p-47, -0x0.9c1577661b7d90p-54, 0x0.e2218aacd51d58p-62, -0x0.a187703ee5e298p-69, // x in subrange 5:11 (4.6875..4.75)
+ 0x0.95fc58eddd5548p-17, -0x0.e86fb3cc6824f8p-25, 0x0.b119678b3179c8p-32, -0x0.84c88d002d0f60p-39, 0x0.c411f557543380p-47, -0x0.8ea2e7c2789b90p-54, 0x0.cc9e3a4f32db20p-62, -0x0.90c2881b073ae0p-69, // x in subrange 5:12 (4.75..4.8125)
+ 0x0.90aa4c5388d9a0p-17, -0x0.ddaf3a130bf988p-25, 0x0.a71342a0099ea0p-32, -0x0.f7e52b766af9e8p-40, 0x0.b5256346bdc900p-47, -0x0.827660eff6b660p-54, 0x0.b9542b39569be8p-62, -0x0.81dd54d604c508p-69, // x in subrange 5:13 (4.8125..4.875)
+ 0x0.8b96ec4119e170p-17, -0x0.d389c16c5e0448p-25, 0x0.9db70a1a439230p-32, -0x0.e78ff39b8ee9c0p-40, 0x0.a77d6777d39d60p-47, -0x0.eedcaa9eb18aa8p-55, 0x0.a80405bfae5938p-62, -0x0.e93d24eb12fcd0p-70, // x in subrange 5:14 (4.875..4.9375)
+ 0x0.86beb5baeace88p-17, -0x0.c9f51313391e68p-25, 0x0.94f7ee1fa54f70p-32, -0x0.d87476cbb09d28p-40, 0x0.9afbae462190b0p-47, -0x0.dad9de027a9ff0p-55, 0x0.9875fa0cbba9f8p-62, -0x0.d1a87dd59a1eb0p-70, // x in subrange 5:15 (4.9375..5)
+ 0x0.821e60b8a9ea48p-17, -0x0.c0e7bc7b4b6bc0p-25, 0x0.8cca32f1f7bc98p-32, -0x0.ca786b8c178588p-40, 0x0.8f84f89935aa30p-47, -0x0.c8af3e6cd68460p-55, 0x0.8a78ccc77c0ed8p-62, -0x0.bca542d34e7148p-70, // x in subrange 5:16 (5..5.0625)
+ 0x0.fb65b77c4b4408p-18, -0x0.b858fedf87ae78p-25, 0x0.8523175d23e2b0p-32, -0x0.bd83f4bf000e08p-40, 0x0.8500c5a0dcb540p-47, -0x0.b82d775607b280p-55, 0x0.fbc2085690f278p-63, -0x0.a9e6e978ec52c8p-70, // x in subrange 5:17 (5.0625..5.125)
+ 0x0.f2f28fa4424ad0p-18, -0x0.b040c054b600e0p-25, 0x0.fbf17b70fae1a0p-33, -0x0.b1816371d0e9f0p-40, 0x0.f6b20d4fa670f0p-48, -0x0.a92a50d5e3cc48p-55, 0x0.e5106209ee30c8p-63, -0x0.992a5eda193de8p-70, // x in subrange 5:18 (5.125..5.1875)
+ 0x0.eadde9951f4d78p-18, -0x0.a8977e39390b68p-25, 0x0.ee842e676e0f98p-33, -0x0.a65cff63369458p-40, 0x0.e4f3b77844be60p-48, -0x0.9b801882622fa8p-55, 0x0.d0989f67e99168p-63, -0x0.8a34cacbaa7d48p-70, // x in subrange 5:19 (5.1875..5.25)
+ 0x0.e322bbcce23eb0p-18, -0x0.a15640df5130b8p-25, 0x0.e1eda26090cba0p-33, -0x0.9c04d57a7b1c80p-40, 0x0.d4a2b02cf50578p-48, -0x0.8f0d1cd9e7f920p-55, 0x0.be1e7bbd8a05e8p-63, -0x0.f9a4fd635680c0p-71, // x in subrange 5:20 (5.25..5.3125)
+ 0x0.dbbc4d5ca0bf18p-18, -0x0.9a769052df35e0p-25, 0x0.d61e88dea8d728p-33, -0x0.92688b81d27c38p-40, 0x0.c59e9a9c4e5f28p-48, -0x0.83b338d18ae960p-55, 0x0.ad6c840a1a3510p-63, -0x0.e1ac132688cbe8p-71, // x in subrange 5:21 (5.3125..5.375)
+ 0x0.d4a6302a2427e0p-18, -0x0.93f26a1ef2dee8p-25, 0x0.cb08cbc4fe6dd0p-33, -0x0.8979388a8c18b0p-40, 0x0.b7ca390d13fa48p-48, -0x0.f2aedae7176648p-56, 0x0.9e534502fc7798p-63, -0x0.cc2ed84070ab58p-71, // x in subrange 5:22 (5.375..5.4375)
+ 0x0.cddc3ba6c36228p-18, -0x0.8dc437fa5d1e30p-25, 0x0.c09f71e78131f8p-33, -0x0.812941749732c0p-40, 0x0.ab0b19bc321838p-48, -0x0.dfc30f84961440p-56, 0x0.90a893cd050df0p-63, -0x0.b8e6d03ec11660p-71, // x in subrange 5:23 (5.4375..5.5)
+ 0x0.c75a87f12bf940p-18, -0x0.87e6c745145f40p-25, 0x0.b6d6863a5cdc38p-33, -0x0.f2d87245d15d68p-41, 0x0.9f494cfc8d9a20p-48, -0x0.ce77a2a38db5d0p-56, 0x0.8446edd7e98578p-63, -0x0.a795ced34fcb28p-71, // x in subrange 5:24 (5.5..5.5625)
+ 0x0.c11d6958ca1510p-18, -0x0.82554142863eb8p-25, 0x0.ada3015c259880p-33, -0x0.e46d87e8cbf370p-41, 0x0.946f237ffe06b8p-48, -0x0.bea5947d84bb10p-56, 0x0.f219d991a8fbb8p-64, -0x0.9804ee4cf40620p-71, // x in subrange 5:25 (5.5625..5.625)
+ 0x0.bb216c3a614028p-18, -0x0.fa1647fdfaef58p-26, 0x0.a4fab53ced51d0p-33, -0x0.d6fcfc4a918090p-41, 0x0.8a68f3d3f2f190p-48, -0x0.b029d6b0c8a298p-56, 0x0.ddb9979da91410p-64, -0x0.8a03a8f39ed308p-71, // x in subrange 5:26 (5.625..5.6875)
+ 0x0.b563512e32eab8p-18, -0x0.f00877a02953c8p-26, 0x0.9cd43aab560020p-33, -0x0.ca73c98f6b60f8p-41, 0x0.8124e63acb5050p-48, -0x0.a2e4def0d0cce8p-56, 0x0.cb37f83319b488p-64, -0x0.face20f1b50738p-72, // x in subrange 5:27 (5.6875..5.75)
+ 0x0.afe00980c60990p-18, -0x0.e6793ac39b3528p-26, 0x0.9526e096ae04e8p-33, -0x0.bec0821762af40p-41, 0x0.f1258c4ad7afd8p-49, -0x0.96ba464fce51b8p-56, 0x0.ba658cf565aa20p-64, -0x0.e4123ebe54dcd0p-72, // x in subrange 5:28 (5.75..5.8125)
+ 0x0.aa94b3f0073ef0p-18, -0x0.dd614086ad3338p-26, 0x0.8dea9cda6baa88p-33, -0x0.b3d32b2dcbc520p-41, 0x0.e147b14f6aed60p-49, -0x0.8b907397f50d98p-56, 0x0.ab17f0ff0e3bc0p-64, -0x0.cf9041a2e57f00p-72, // x in subrange 5:29 (5.8125..5.875)
+ 0x0.a57e99a70ca3b0p-18, -0x0.d4b9b3cfa3f248p-26, 0x0.8717fe6c099ef8p-33, -0x0.a99d1b67e33ac8p-41, 0x0.d2956ead2d81c8p-49, -0x0.81504f5d9c6618p-56, 0x0.9d293714a6b318p-64, -0x0.bd0c57c7915b58p-72, // x in subrange 5:30 (5.875..5.9375)
+ 0x0.a09b2b734d4ce0p-18, -0x0.cc7c3221352008p-26, 0x0.80a820c86aa158p-33, -0x0.a010dc4eb38028p-41, 0x0.c4f65e1ff3bac8p-49, -0x0.efca013e2cb000p-57, 0x0.9077694cf8bc08p-64, -0x0.ac515f48917608p-72, // x in subrange 5:31 (5.9375..6)
+ 0x0.9be7ff2e9499d0p-18, -0x0.c4a2c32f102180p-26, 0x0.f52941032e1510p-34, -0x0.97220efbb84e98p-41, 0x0.b8544478398438p-49, -0x0.de7761d9ff2828p-57, 0x0.84e417fa4a0968p-64, -0x0.9d301b7f7d2198p-72, // x in subrange 5:32 (6..6.0625)
+ 0x0.9762cd596592b8p-18, -0x0.bd27d1214438e8p-26, 0x0.e9af21a1d36e70p-34, -0x0.8ec553599be788p-41, 0x0.ac9adc4a7efc38p-49, -0x0.ce86ae6d4b9ef8p-57, 0x0.f4a7ebd6eba508p-65, -0x0.8f7e839af9ec78p-72, // x in subrange 5:33 (6.0625..6.125)
+ 0x0.93096ee1e46048p-18, -0x0.b606217708f5a8p-26, 0x0.ded6e4294f6a00p-34, -0x0.86f031c3248f00p-41, 0x0.a1b7a61c8ad6c0p-49, -0x0.bfd910e54ac0d8p-57, 0x0.e15d00b7d70ae8p-65, -0x0.831727339a5148p-72, // x in subrange 5:34 (6.125..6.1875)
+ 0x0.8ed9db13b44250p-18, -0x0.af38ce7ae906a8p-26, 0x0.d496524523c748p-34, -0x0.ff320d8438ddc8p-42, 0x0.9799bd7645ac08p-49, -0x0.b2529ae94c56e8p-57, 0x0.cfbb62424d5a08p-65, -0x0.efb14c0263fed8p-73, // x in subrange 5:35 (6.1875..6.25)
+ 0x0.8ad225ad885a88p-18, -0x0.a8bb413ba3dd38p-26, 0x0.cae3eeb6963d68p-34, -0x0.f16de16d974720p-42, 0x0.8e31b24dd339d0p-49, -0x0.a5d9faad5a1cc8p-57, 0x0.bf9b73a8405030p-65, -0x0.db4a706f6a78a0p-73, // x in subrange 5:36 (6.25..6.3125)
+ 0x0.86f07d196e0100p-18, -0x0.a2892bfe4c3ad8p-26, 0x0.c1b6e6d8f1ccf8p-34, -0x0.e4837e6d3fe460p-42, 0x0.857166564d0e30p-49, -0x0.9a5837de75b938p-57, 0x0.b0d98dbd46ce50p-65, -0x0.c8c48ad0b16fa8p-73, // x in subrange 5:37 (6.3125..6.375)
+ 0x0.833328c518ecc0p-18, -0x0.9c9e851f3c8780p-26, 0x0.b9070562ae8948p-34, -0x0.d863c7ebe08140p-42, 0x0.fa97db8cab3d60p-50, -0x0.8fb877bb9a4f78p-57, 0x0.a35592f08eb6f0p-65, -0x0.b7f0101a61fbf0p-73, // x in subrange 5:38 (6.375..6.4375)
+ 0x0.ff310f2f69e528p-19, -0x0.96f7825870fe50p-26, 0x0.b0cca646329f78p-34, -0x0.cd00ca2b01acb8p-42, 0x0.eb6ae66fc49250p-50, -0x0.85e7c78b34b168p-57, 0x0.96f28f7ba67dc8p-65, -0x0.a8a2784995c200p-73, // x in subrange 5:39 (6.4375..6.5)
+ 0x0.f83e1d05ee29a8p-19, -0x0.91909464b64e68p-26, 0x0.a900ab97c7db98p-34, -0x0.c24da16136efd0p-42, 0x0.dd463c9a990d90p-50, -0x0.f9a9d96b653198p-58, 0x0.8b9664517e1710p-65, -0x0.9ab5aef343da28p-73, // x in subrange 5:40 (6.5..6.5625)
+ 0x0.f18a8e5ab145d8p-19, -0x0.8c6662f7e3dbc0p-26, 0x0.a19c7360fa9ad0p-34, -0x0.b83e631887ede8p-42, 0x0.d015f9a24bc3c8p-50, -0x0.e8e073c7284080p-58, 0x0.81297b87b230a8p-65, -0x0.8e0794c07c0598p-73, // x in subrange 5:41 (6.5625..6.625)
+ 0x0.eb139d672769c0p-19, -0x0.8775c9050da9c0p-26, 0x0.9a99ce4bead578p-34, -0x0.aec80996ba5168p-42, 0x0.c3c7dc1d2fdd78p-50, -0x0.d956d120f95c88p-58, 0x0.ef2d0a398d81e0p-66, -0x0.82798fbe666b80p-73, // x in subrange 5:42 (6.625..6.6875)
+ 0x0.e4d6a8ff41a888p-19, -0x0.82bbd14c3d35d8p-26, 0x0.93f2f7132d82c8p-34, -0x0.a5e0611cffcc08p-42, 0x0.b84b204eda5d28p-50, -0x0.caf2ed2ae99dc8p-58, 0x0.dd9476427bf758p-66, -0x0.efe0515cac7cd8p-74, // x in subrange 5:43 (6.6875..6.75)
+ 0x0.ded13267350e40p-19, -0x0.fc6b6653a7f678p-27, 0x0.8da28aa4bae670p-34, -0x0.9d7df6d1c17aa8p-42, 0x0.ad905e66b09b58p-50, -0x0.bd9d0e76678f88p-58, 0x0.cd6658d05df8a0p-66, -0x0.dca5677d37fb50p-74, // x in subrange 5:44 (6.75..6.8125)
+ 0x0.d900db4e1a13a8p-19, -0x0.f3c19f447f40b0p-27, 0x0.87a380e81375d8p-34, -0x0.9598092be5ef38p-42, 0x0.a3896bf38f0248p-50, -0x0.b13f8ee4442138p-58, 0x0.be8319fd843be0p-66, -0x0.cb160691fe7370p-74, // x in subrange 5:45 (6.8125..6.875)
+ 0x0.d36363eaae4be0p-19, -0x0.eb755d4a40c1b0p-27, 0x0.81f12619464b18p-34, -0x0.8e2679bb11e0f8p-42, 0x0.9a29403942bd48p-50, -0x0.a5c6a9b22042b8p-58, 0x0.b0ce17829ff938p-66, -0x0.bb0a46c2087fb0p-74, // x in subrange 5:46 (6.875..6.9375)
+ 0x0.cdf6a937ba0628p-19, -0x0.e381f906dedb88p-27, 0x0.f90e2957bc9f80p-35, -0x0.8721c02c13e618p-42, 0x0.9163db1d879de0p-50, -0x0.9b204e8b1464b8p-58, 0x0.a42d58f280bd68p-66, -0x0.ac5e3a46b32d10p-74, // x in subrange 5:47 (6.9375..7)
+ 0x0.c8b8a34dce9ec8p-19, -0x0.dbe30f292bc138p-27, 0x0.eec25f53e53fb8p-35, -0x0.8082de6bf6acd0p-42, 0x0.892e2e6a2d2340p-50, -0x0.913bf912db94e0p-58, 0x0.98894c0128dac0p-66, -0x0.9ef181b3a2ba70p-74, // x in subrange 5:48 (7..7.0625)
+ 0x0.c3a763d840cfb8p-19, -0x0.d4947c0d7d0ce8p-27, 0x0.e4f73b095daa78p-35, -0x0.f486ab9e4ccb58p-43, 0x0.817e0929118d60p-50, -0x0.880a8c722f46f0p-58, 0x0.8dcc87ef34df48p-66, -0x0.92a6ec49b474c0p-74, // x in subrange 5:49 (7.0625..7.125)
+ 0x0.bec114a36ce738p-19, -0x0.cd9257adfc3d50p-27, 0x0.dba58699488d58p-35, -0x0.e8ba3a496f3260p-43, 0x0.f49409c9c6f4a0p-51, -0x0.fefc64f1235ec0p-59, 0x0.83e3974dd6ff60p-66, -0x0.876422ea3e6a48p-74, // x in subrange 5:50 (7.125..7.1875)
+ 0x0.ba03f64279bbd0p-19, -0x0.c6d8f1dc6f07e8p-27, 0x0.d2c68092317698p-35, -0x0.dd952f4070b100p-43, 0x0.e712e93e5345d8p-51, -0x0.ef147be7799688p-59, 0x0.f5798ecf183370p-67, -0x0.fa22b8d95010c8p-75, // x in subrange 5:51 (7.1875..7.25)
+ 0x0.b56e5ecaf2dbd8p-19, -0x0.c064cebfc89e60p-27, 0x0.ca53d3cca877e8p-35, -0x0.d30d190d210458p-43, 0x0.da68aaa203a408p-51, -0x0.e0461fcefc6b38p-59, 0x0.e48ff95d4924c0p-67, -0x0.e732347ebd80e8p-75, // x in subrange 5:52 (7.25..7.3125)
+ 0x0.b0feb8a4b31b80p-19, -0x0.ba32a3904f0958p-27, 0x0.c2478fe751be80p-35, -0x0.c9183f18b33bd0p-43, 0x0.ce867fa0dd0188p-51, -0x0.d27bfeb43f4698p-59, 0x0.d4ed174a40d0d8p-67, -0x0.d5cfd8be47c680p-75, // x in subrange 5:53 (7.3125..7.375)
+ 0x0.acb3816cb68ef0p-19, -0x0.b43f538d8ebb80p-27, 0x0.ba9c22552d6c38p-35, -0x0.bfad93ab918340p-43, 0x0.c35eb7efeb7e80p-51, -0x0.c5a286e37f2978p-59, 0x0.c6762b830e9ef0p-67, -0x0.c5d8779aaf3e48p-75, // x in subrange 5:54 (7.375..7.4375)
+ 0x0.a88b48e9866e68p-19, -0x0.ae87ed29bb8f70p-27, 0x0.b34c4ff20a7060p-35, -0x0.b6c4a71394eda8p-43, 0x0.b8e4a9e3a4b7d0p-51, -0x0.b9a7bf4c9dcf08p-59, 0x0.b912d3c537a448p-67, -0x0.b72c358f96cc10p-75, // x in subrange 5:55 (7.4375..7.5)
+ 0x0.a484b0100a8d88p-19, -0x0.a909a7667a74b8p-27, 0x0.ac532f1228b648p-35, -0x0.ae559bd69cfb18p-43, 0x0.af0c9d162c2240p-51, -0x0.ae7b23a4c74150p-59, 0x0.acaccfe0950b48p-67, -0x0.a9ae3436954448p-75, // x in subrange 5:56 (7.5..7.5625)
+ 0x0.a09e6817a32c70p-19, -0x0.a3c1df5f62fe18p-27, 0x0.a5ac220306a880p-35, -0x0.a6591bd9f7ae08p-43, 0x0.a5cbb6ebc79e30p-51, -0x0.a40d83e5a219e8p-59, 0x0.a12fcea675ad10p-67, -0x0.9d4445fbb1af78p-75, // x in subrange 5:57 (7.5625..7.625)
+ 0x0.9cd7319c832458p-19, -0x0.9eae15fed493a8p-27, 0x0.9f52d1f43660d8p-35, -0x0.9ec84e6940f580p-43, 0x0.9d17e8c8cb5378p-51, -0x0.9a50e6d41f02d8p-59, 0x0.96893fec3af068p-67, -0x0.91d6a9ddfd05d8p-75, // x in subrange 5:58 (7.625..7.6875)
+ 0x0.992ddbcf55f680p-19, -0x0.99cbedda00ed18p-27, 0x0.99432a3fe238b8p-35, -0x0.979ccf095db0d0p-43, 0x0.94e7dfd0b61428p-51, -0x0.91386f420c5018p-59, 0x0.8ca82b18ccc690p-67, -0x0.874fce57679140p-75, // x in subrange 5:59 (7.6875..7.75)
+ 0x0.95a143b14f3810p-19, -0x0.951929314d4e08p-27, 0x0.9379540b60e510p-35, -0x0.90d0a506019388p-43, 0x0.8d32f60a320100p-51, -0x0.88b843c5a0fd18p-59, 0x0.837d09c3632d30p-67, -0x0.fb3835434025c0p-76, // x in subrange 5:60 (7.75..7.8125)
+ 0x0.9230535bd15a08p-19, -0x0.9093a812665400p-27, 0x0.8df1b238e0b618p-35, -0x0.8a5e3ba9ccfe38p-43, 0x0.85f124c73d37b0p-51, -0x0.80c578a95d0bb0p-59, 0x0.f5f34bef077ea8p-68, -0x0.e9537b4a72db80p-76, // x in subrange 5:61 (7.8125..7.875)
+ 0x0.8eda0152e904d8p-19, -0x0.8c396699977e20p-27, 0x0.88a8dda3c9a790p-35, -0x0.84405b12853250p-43, 0x0.fe35f067df5378p-52, -0x0.f2abf7b9fd3608p-60, 0x0.e621f77bccbe48p-68, -0x0.d8d103e9d5df10p-76, // x in subrange 5:62 (7.875..7.9375)
+ 0x0.8b9d4fe1e841e0p-19, -0x0.88087b50286938p-27, 0x0.839ba1a20022c8p-35, -0x0.fce443287498b8p-44, 0x0.f15307e2606a60p-52, -0x0.e4c1056bf476b8p-60, 0x0.d76e3b28d96038p-68, -0x0.c9934c91b6b9f0p-76, // x in subrange 5:63 (7.9375..8)
+ 0x0.86f04337b54428p-17, -0x0.8208aa336e2ab8p-24, 0x0.f8e1ebf80f73f0p-32, -0x0.ec90757c7e9c60p-39, 0x0.df5c769b5ad330p-46, -0x0.d184fd06444270p-53, 0x0.c34e212a0d5600p-60, -0x0.b4e265ab037ee8p-67, // x in subrange 6:0 (8..8.125)
+ 0x0.8105644e7528e0p-17, -0x0.f512cf206a7cb0p-25, 0x0.e7311437aaeac8p-32, -0x0.d8a8718b5f5d10p-39, 0x0.c9b9557e057b90p-46, -0x0.baa04831fff768p-53, 0x0.ab9ad8488af5d8p-60, -0x0.9ccda4ab3737b0p-67, // x in subrange 6:1 (8.125..8.25)
+ 0x0.f6e2873fa49d68p-18, -0x0.e7234f76297990p-25, 0x0.d6fad5dbb0c448p-32, -0x0.c6aaecc9fe8bb0p-39, 0x0.b66fa6bcaf97a8p-46, -0x0.a67e63b02af270p-53, 0x0.970a71402e4368p-60, -0x0.882f2f8da86ec8p-67, // x in subrange 6:2 (8.25..8.375)
+ 0x0.ec5b9765e9f728p-18, -0x0.da2c53000a8640p-25, 0x0.c81afb7bdbcec8p-32, -0x0.b662f9f0e1bd80p-39, 0x0.a5375294de1548p-46, -0x0.94c2572cdf1098p-53, 0x0.852a2b6edfb1a8p-60, -0x0.ecfcfe95c489f0p-68, // x in subrange 6:3 (8.375..8.5)
+ 0x0.e26acf271a0de8p-18, -0x0.ce197af4590510p-25, 0x0.ba7131b258e918p-32, -0x0.a7a1f9f2324798p-39, 0x0.95d1ae5e1aee28p-46, -0x0.851c6009d0b520p-53, 0x0.eb31b31e4e38f8p-61, -0x0.ce92dfda08a600p-68, // x in subrange 6:4 (8.5..8.625)
+ 0x0.d905ed5dbe0138p-18, -0x0.c2d851cb154da0p-25, 0x0.ade091669bf250p-32, -0x0.9a3eca2a67a140p-39, 0x0.880827a98dcf78p-46, -0x0.ee8fdcc87311f8p-54, 0x0.d00808209a7688p-61, -0x0.b460bb7df7aea0p-68, // x in subrange 6:5 (8.625..8.75)
+ 0x0.d02383f3cfae80p-18, -0x0.b85817bfe4fde0p-25, 0x0.a24f394daded28p-32, -0x0.8e1510085925a0p-39, 0x0.f75645fe0ddd30p-47, -0x0.d613eb35b15668p-54, 0x0.b84b142bff6ca0p-61, -0x0.9dc5f0d80c8ab0p-68, // x in subrange 6:6 (8.75..8.875)
+ 0x0.c7bae4742c4a48p-18, -0x0.ae899550b4c750p-25, 0x0.97a5f4804a83b8p-32, -0x0.83049dbcf5d7b0p-39, 0x0.e1220bc9c89ef0p-47, -0x0.c05f03fc054b10p-54, 0x0.a383542aa46d50p-61, -0x0.8a3b524ac196b0p-68, // x in subrange 6:7 (8.875..9)
+ 0x0.bfc40e9e060168p-18, -0x0.a55ef2f68431e0p-25, 0x0.8dcfec58882af0p-32, -0x0.f1e1d872004168p-40, 0x0.cd2aca9813e8e8p-47, -0x0.ad190fd786c5e0p-54, 0x0.914abed5d4c5f0p-61, -0x0.f29dbf95b50e18p-69, // x in subrange 6:8 (9..9.125)
+ 0x0.b837a0bfa24b78p-18, -0x0.9ccb95708509e8p-25, 0x0.84ba640d304e88p-32, -0x0.df814eacb92c70p-40, 0x0.bb30a546f732c8p-47, -0x0.9bf5c56806dbc0p-54, 0x0.814a0b96ab2140p-61, -0x0.d54085c7b10160p-69, // x in subrange 6:9 (9.125..9.25)
+ 0x0.b10ec9a5047420p-18, -0x0.94c3fe107bbbd0p-25, 0x0.f8a8f9751af410p-33, -0x0.ceba93109e7158p-40, 0x0.aafb8598c27e20p-47, -0x0.8cb2f6ab0534d8p-54, 0x0.e66cd906e702d0p-62, -0x0.bbbbd08eefce98p-69, // x in subrange 6:10 (9.25..9.375)
+ 0x0.aa433bed790270p-18, -0x0.8d3dae8ac17240p-25, 0x0.e91e0172337d60p-33, -0x0.bf6589add2da98p-40, 0x0.9c5a15e2978e88p-47, -0x0.fe2e4220a1b900p-55, 0x0.cd9f4edbbd5e88p-62, -0x0.a58533e3ed5a90p-69, // x in subrange 6:11 (9.375..9.5)
+ 0x0.a3cf22a0739f10p-18, -0x0.862f0fdcefe6b0p-25, 0x0.dab86a97376488p-33, -0x0.b15e6e832aa8e0p-40, 0x0.8f20dfd4d0a710p-47, -0x0.e5e06aadc00c38p-55, 0x0.b7bcfb41901930p-62, -0x0.922704fe3ff590p-69, // x in subrange 6:12 (9.5..9.625)
+ 0x0.9dad16def4d9a0p-18, -0x0.ff1eb7d90eb668p-26, 0x0.cd5f63a23c5a10p-33, -0x0.a48551dc2b73a0p-40, 0x0.83298ac4d13e98p-47, -0x0.d0251c74a01ff8p-55, 0x0.a466a9c693aa98p-62, -0x0.813d0d80538638p-69, // x in subrange 6:13 (9.625..9.75)
+ 0x0.97d81692d1ebc0p-18, -0x0.f2ad13164a5d00p-26, 0x0.c0fc7789943a70p-33, -0x0.98bda58ddc7458p-40, 0x0.f0a46989c48590p-48, -0x0.bcb01cfdbd9260p-55, 0x0.934a2d7c187688p-62, -0x0.e4e398d0349080p-70, // x in subrange 6:14 (9.75..9.875)
+ 0x0.924b7c00d492c8p-18, -0x0.e6fa7530e44168p-26, 0x0.b57b4dddb395b0p-33, -0x0.8dedd8bfec4b18p-40, 0x0.dcf9c52a4eca20p-48, -0x0.ab3ec0534e1cb8p-55, 0x0.842079e71bb768p-62, -0x0.caf85787dad9a8p-70, // x in subrange 6:15 (9.875..10)
+ 0x0.8d02f625cf4498p-18, -0x0.dbf95806173e88p-26, 0x0.aac9727ea99a80p-33, -0x0.83ff0046ff0440p-40, 0x0.cb1e062eb1d488p-48, -0x0.9b969f74e174d8p-55, 0x0.ed580eccaf21f8p-63, -0x0.b43b2d91eb6a50p-70, // x in subrange 6:16 (10..10.125)
+ 0x0.87fa81c9827ea0p-18, -0x0.d19d4ee313f960p-26, 0x0.a0d623bb31be38p-33, -0x0.f5b913bd558fa8p-41, 0x0.bae206e6a5c300p-48, -0x0.8d847e2bc8d860p-55, 0x0.d56eed6b9e6150p-63, -0x0.a040bf455e67d0p-70, // x in subrange 6:17 (10.125..10.25)
+ 0x0.832e63349882e8p-18, -0x0.c7daecc7290760p-26, 0x0.9792260ec45220p-33, -0x0.e4e7f19fffcd38p-41, 0x0.ac1be3128c2aa0p-48, -0x0.80db5905b36248p-55, 0x0.c028d2aeb4ecb0p-63, -0x0.8eacceae5ba950p-70, // x in subrange 6:18 (10.25..10.375)
+ 0x0.fd3640f2329940p-19, -0x0.bea7ad41b5d7c0p-26, 0x0.8eef9cceeb3e68p-33, -0x0.d569558c975e00p-41, 0x0.9ea65556455bd0p-48, -0x0.eae72aca44a7b8p-56, 0x0.ad350cca954e50p-63, -0x0.fe5ff23795b8c0p-71, // x in subrange 6:19 (10.375..10.5)
+ 0x0.f47af87d25f0b0p-19, -0x0.b5f9dfa1d5e078p-26, 0x0.86e1e72f31cfe8p-33, -0x0.c71f47813a4fd0p-41, 0x0.926029c97d1150p-48, -0x0.d6549d1e07c6d0p-56, 0x0.9c4d4984aa1510p-63, -0x0.e30ba00e6b8260p-71, // x in subrange 6:20 (10.5..10.625)
+ 0x0.ec24e209a7e870p-19, -0x0.adc89436997780p-26, 0x0.febb022db8bd58p-34, -0x0.b9eec0696b2810p-41, 0x0.872bc2b788b500p-48, -0x0.c3c176d5bb9860p-56, 0x0.8d34298ea4fd78p-63, -0x0.cae67c529dac90p-71, // x in subrange 6:21 (10.625..10.75)
+ 0x0.e42e59a306ffe0p-19, -0x0.a60b8b6662eb08p-26, 0x0.f0afcea95394e0p-34, -0x0.adbf5931178000p-41, 0x0.f9dd5a1ed71178p-49, -0x0.b2f752ad94d040p-56, 0x0.ff68122014ed88p-64, -0x0.b58a5864591bb8p-71, // x in subrange 6:22 (10.75..10.875)
+ 0x0.dc921a7c517b98p-19, -0x0.9ebb266ac183b8p-26, 0x0.e38efd973a67f8p-34, -0x0.a27b0346859dd0p-41, 0x0.e72284c3b7dc58p-49, -0x0.a3c61200367ab8p-56, 0x0.e73bea5675d338p-64, -0x0.a29eb58bc28508p-71, // x in subrange 6:23 (10.875..11)
+ 0x0.d54b37ba9cbe50p-19, -0x0.97d059840be408p-26, 0x0.d746fc81134790p-34, -0x0.980dc95c50e218p-41, 0x0.d5fcad34144df8p-49, -0x0.96031553388408p-56, 0x0.d1918f3fc55470p-64, -0x0.91d6d247c6ae50p-71, // x in subrange 6:24 (11..11.125)
+ 0x0.ce5515dcdb2dc0p-19, -0x0.91449f7d255db8p-26, 0x0.cbc7b4f63b3338p-34, -0x0.8e65976532a848p-41, 0x0.c645dfc18367e0p-49, -0x0.89888f5a67de48p-56, 0x0.be20c58e89aeb8p-64, -0x0.82f002a8ed0208p-71, // x in subrange 6:25 (11.125..11.25)
+ 0x0.c7ab64b2553260p-19, -0x0.8b11ee5c5fc590p-26, 0x0.c10268ed7147e0p-34, -0x0.857208e6238800p-41, 0x0.b7dc0ea4759030p-49, -0x0.fc69dd6cfb55e0p-57, 0x0.acaa122382aad0p-64, -0x0.eb608fa835e798p-72, // x in subrange 6:26 (11.25..11.375)
+ 0x0.c14a19d2663be8p-19, -0x0.8532ad2262d268p-26, 0x0.b6e992cf3ccb78p-34, -0x0.fa4879b28cffe0p-42, 0x0.aaa0a2be5a97f0p-49, -0x0.e7d4b684f87be0p-57, 0x0.9cf597e14d5588p-64, -0x0.d3ca3986550f00p-72, // x in subrange 6:27 (11.375..11.5)
+ 0x0.bb2d6b897e6e38p-19, -0x0.ff4354f6fbd4a8p-27, 0x0.ad70c8c09c6658p-34, -0x0.eadd5ceb8fd308p-42, 0x0.9e7819b59410a8p-49, -0x0.d51c8875e888c8p-57, 0x0.8ed21d755ea7d8p-64, -0x0.bec4dff679a5c8p-72, // x in subrange 6:28 (11.5..11.625)
+ 0x0.b551cc30a219a8p-19, -0x0.f4b42895b2fe28p-27, 0x0.a48ca2d21683b0p-34, -0x0.dc8a248e064fc8p-42, 0x0.9349afb48e9540p-49, -0x0.c411f9dfb24b10p-57, 0x0.821435442328e0p-64, -0x0.ac0386957194b8p-72, // x in subrange 6:29 (11.625..11.75)
+ 0x0.afb3e5e5b61db8p-19, -0x0.eaaedff35f4d40p-27, 0x0.9c32a3c2307068p-34, -0x0.cf386e20c27e30p-42, 0x0.88ff13513865d8p-49, -0x0.b48acc0e9d47c0p-57, 0x0.ed2b051581c958p-65, -0x0.9b42d77fb9f748p-72, // x in subrange 6:30 (11.75..11.875)
+ 0x0.aa50969bdfe7a8p-19, -0x0.e12b26ee28d7e8p-27, 0x0.9459240bdba888p-34, -0x0.c2d3d417d16ca0p-42, 0x0.ff0844aa85e468p-50, -0x0.a661434104a870p-57, 0x0.d8682f11a73da0p-65, -0x0.8c47d9ee677c70p-72, // x in subrange 6:31 (11.875..12)
+ 0x0.a524ec7c1c7d80p-19, -0x0.d8213daddf8320p-27, 0x0.8cf73f01beec00p-34, -0x0.b749bc3f87e808p-42, 0x0.ed8d5c97006b58p-50, -0x0.9973a1c6972de0p-57, 0x0.c5a3d24b6ae278p-65, -0x0.fdbdae9e98bd90p-73, // x in subrange 6:32 (12..12.125)
+ 0x0.a02e228ef71318p-19, -0x0.cf89ed014bfc90p-27, 0x0.8604c1be8c7028p-34, -0x0.ac892b66cf80e8p-42, 0x0.dd6c8fb8addeb8p-50, -0x0.8da3b37b681220p-57, 0x0.b4a8aa193ae828p-65, -0x0.e5b4cfdd66fa20p-73, // x in subrange 6:33 (12.125..12.25)
+ 0x0.9b699da8f7be30p-19, -0x0.c75e7bbf204058p-27, 0x0.fef43771f65ba0p-35, -0x0.a2829daf8976c8p-42, 0x0.ce8820474fb560p-50, -0x0.82d6677a4c2b60p-57, 0x0.a5476f5a97b430p-65, -0x0.d02542babb9cd8p-73, // x in subrange 6:34 (12.25..12.375)
+ 0x0.96d4e994006910p-19, -0x0.bf98a511b2e9e0p-27, 0x0.f2a0a19f2aa5d0p-35, -0x0.9927e2fe8e0780p-42, 0x0.c0c51e8cb59598p-50, -0x0.f1e6ec5c1c7848p-58, 0x0.97561fdf3b4330p-65, -0x0.bcc8c34939b380p-73, // x in subrange 6:35 (12.375..12.5)
+ 0x0.926db6705b3a28p-19, -0x0.b8328f97452818p-27, 0x0.e701d94af6d888p-35, -0x0.906bff151230e8p-42, 0x0.b40b1f4b9ce050p-50, -0x0.dfca2453ed5138p-58, 0x0.8aaf5d743dbfa8p-65, -0x0.ab6166383a71d0p-73, // x in subrange 6:36 (12.5..12.625)
+ 0x0.8e31d648bc25f0p-19, -0x0.b126c542ddcb10p-27, 0x0.dc0bee5b22fb90p-35, -0x0.88430ceb69a350p-42, 0x0.a843fa483fec28p-50, -0x0.cf2f44d3557770p-58, 0x0.fe63c2c3c4b7f8p-66, -0x0.9bb88aaf19e0f0p-73, // x in subrange 6:37 (12.625..12.75)
+ 0x0.8a1f3ad4e8e670p-19, -0x0.aa702bebcd5e88p-27, 0x0.d1b3d48ab8e048p-35, -0x0.80a224f1777680p-42, 0x0.9d5b8ffc53fb10p-50, -0x0.bff3098fea00d8p-58, 0x0.e98003346e8428p-66, -0x0.8d9df055f51b10p-73, // x in subrange 6:38 (12.75..12.875)
+ 0x0.8633f367209020p-19, -0x0.a409fe7bbf62e0p-27, 0x0.c7ef50886799d8p-35, -0x0.f2fe8bc7d97490p-43, 0x0.933f959f379ce0p-50, -0x0.b1f5af499e8118p-58, 0x0.d67e8a79151630p-66, -0x0.80e6ec6fc4c310p-73, // x in subrange 6:39 (12.875..13)
+ 0x0.826e2b00b7b4b0p-19, -0x0.9defc6acda3300p-27, 0x0.beb4e6ccc888f8p-35, -0x0.e5a27fddcba948p-43, 0x0.89df66c5f2e130p-50, -0x0.a51a93ac1622d0p-58, 0x0.c5300ccd581790p-66, -0x0.eadb7357baf898p-74, // x in subrange 6:40 (13..13.125)
+ 0x0.fd984d15612400p-20, -0x0.981d574adff138p-27, 0x0.b5fbcbfcff1a68p-35, -0x0.d91f43bd79b340p-43, 0x0.812bdbf5fc7638p-50, -0x0.9947e03824b4b8p-58, 0x0.b56a3f2ab5b600p-66, -0x0.d621bdf1a82720p-74, // x in subrange 6:41 (13.125..13.25)
+ 0x0.f698865ec26018p-20, -0x0.928ec6eb8c1478p-27, 0x0.adbbd6b2d182e0p-35, -0x0.cd65504e4e7c20p-43, 0x0.f22e4b33f314d0p-51, -0x0.8e663edc4da878p-58, 0x0.a70746260edf58p-66, -0x0.c365545ae22f68p-74, // x in subrange 6:42 (13.25..13.375)
+ 0x0.efd9e9a4f8cf20p-20, -0x0.8d406b138f7560p-27, 0x0.a5ed7287760020p-35, -0x0.c2665b1e251b90p-43, 0x0.e32955b29cae48p-51, -0x0.8460970fc4f9f0p-58, 0x0.99e53651c279d8p-66, -0x0.b27177a3b27d60p-74, // x in subrange 6:43 (13.375..13.5)
+ 0x0.e959894a1eb6a0p-20, -0x0.882ed3be93fa88p-27, 0x0.9e899441f5fb68p-35, -0x0.b8153aaa971ea0p-43, 0x0.d531d7c55e71f0p-51, -0x0.f647a4d41f6048p-59, 0x0.8de5a3e6ae33c8p-66, -0x0.a317436d7008a8p-74, // x in subrange 6:44 (13.5..13.625)
+ 0x0.e3149fa6774e60p-20, -0x0.8356c7419cc520p-27, 0x0.9789af0d454778p-35, -0x0.ae65cd4dcdb428p-43, 0x0.c832ce8e8ac488p-51, -0x0.e53d4fa57fab88p-59, 0x0.82ed3fc3d63550p-66, -0x0.952cfcb9c632b8p-74, // x in subrange 6:45 (13.625..13.75)
+ 0x0.dd088c93500b30p-20, -0x0.fd6a7cffd62128p-28, 0x0.90e7aa9d0c2688p-35, -0x0.a54ce2896e9528p-43, 0x0.bc19041f54d8b8p-51, -0x0.d582d90352a2c8p-59, 0x0.f1c7002dd37860p-67, -0x0.888d76efe5ccd8p-74, // x in subrange 6:46 (13.75..13.875)
+ 0x0.d732d3219bee50p-20, -0x0.f48ec2d69b2738p-28, 0x0.8a9dda2ab1cb40p-35, -0x0.9cc02671e1d918p-43, 0x0.b0d2e47c6b2730p-51, -0x0.c6fbd441e898c0p-59, 0x0.df64a671e7d9b8p-67, -0x0.fa2f184e9cb068p-75, // x in subrange 6:47 (13.875..14)
+ 0x0.d1911778e71c70p-20, -0x0.ec150792d4f550p-28, 0x0.84a6f4367c3660p-35, -0x0.94b60f02ecba70p-43, 0x0.a65056f60ca1d0p-51, -0x0.b98e72f05266c0p-59, 0x0.ce8bb6f74ecc88p-67, -0x0.e55b4c61150ba0p-75, // x in subrange 6:48 (14..14.125)
+ 0x0.cc211cdb8a96f0p-20, -0x0.e3f844705a48f8p-28, 0x0.fdfc15f54422f8p-36, -0x0.8d25cb2c9324e0p-43, 0x0.9c829b5c1aaf58p-51, -0x0.ad2342345f96c8p-59, 0x0.bf18659c06b450p-67, -0x0.d26aac5b487b98p-75, // x in subrange 6:49 (14.125..14.25)
+ 0x0.c6e0c3cd4abbe8p-20, -0x0.dc33bed8150898p-28, 0x0.f33d0afff59bd0p-36, -0x0.8607336c779270p-43, 0x0.935c2aa467ae08p-51, -0x0.a1a4ef41464740p-59, 0x0.b0ea6a871ea308p-67, -0x0.c12df1b11b0128p-75, // x in subrange 6:50 (14.25..14.375)
+ 0x0.c1ce0859c7d8d0p-20, -0x0.d4c30346962520p-28, 0x0.e908328b2eaa48p-36, -0x0.fea57799379508p-44, 0x0.8ad09aa5926da0p-51, -0x0.9700121a4b1920p-59, 0x0.a3e4a351dc41e8p-67, -0x0.b17acbae725840p-75, // x in subrange 6:51 (14.375..14.5)
+ 0x0.bce700785f3fc0p-20, -0x0.cda1e093f1ff20p-28, 0x0.df5588dbff4630p-36, -0x0.f202ce4910a538p-44, 0x0.82d484935a05d0p-51, -0x0.8d22fdeba7fd70p-59, 0x0.97ecbed78ea2c8p-67, -0x0.a32b516a8e10c8p-75, // x in subrange 6:52 (14.5..14.625)
+ 0x0.b829da8b4d75e0p-20, -0x0.c6cc6394ec67a0p-28, 0x0.d61d90cc396108p-36, -0x0.e61976fb185498p-44, 0x0.f6badbe554c660p-52, -0x0.83fd9659ad9dc0p-59, 0x0.8ceaf2673715f8p-67, -0x0.961d8496bac950p-75, // x in subrange 6:53 (14.625..14.75)
+ 0x0.b394dbf80fbd10p-20, -0x0.c03ed30e316e28p-28, 0x0.cd5949f5fd09d8p-36, -0x0.dadd6efc121688p-44, 0x0.e8c36787b469b8p-52, -0x0.f7025272321d70p-60, 0x0.82c9b73b10fcc0p-67, -0x0.8a32e30b795bc0p-75, // x in subrange 6:54 (14.75..14.875)
+ 0x0.af265fd72cd418p-20, -0x0.b9f5abf2fcbcd0p-28, 0x0.c50227a96fecd8p-36, -0x0.d04391854cb320p-44, 0x0.dbb0ef51a4c0b0p-52, -0x0.e740986867d918p-60, 0x0.f2eb1e7af012e0p-68, -0x0.fea00a7d142c68p-76, // x in subrange 6:55 (14.875..15)
+ 0x0.aadcd5b9b2b9f8p-20, -0x0.b3ed9de9261568p-28, 0x0.bd12089aefe758p-36, -0x0.c641861db24010p-44, 0x0.cf731da679bb90p-52, -0x0.d89d7bddc0a870p-60, 0x0.e1b9a082f39008p-68, -0x0.eab890138a7c00p-76, // x in subrange 6:56 (15..15.125)
+ 0x0.a6b6c082d9dcc0p-20, -0x0.ae23880d1036c8p-28, 0x0.b5832f39bc5f50p-36, -0x0.bccdb080f6e498p-44, 0x0.c3fae518ffb408p-52, -0x0.cb029490e35790p-60, 0x0.d1dee9e0503358p-68, -0x0.d88300bf64dea0p-76, // x in subrange 6:57 (15.125..15.25)
+ 0x0.a2b2b5545dbac8p-20, -0x0.a89475f0717590p-28, 0x0.ae503aa092a2d0p-36, -0x0.b3df21e87370a0p-44, 0x0.b93a645c935f38p-52, -0x0.be5b62cac53370p-60, 0x0.c33de586267120p-68, -0x0.c7d76f713c6558p-76, // x in subrange 6:58 (15.25..15.375)
+ 0x0.9ecf5a8c37de10p-20, -0x0.a33d9ccf5bf2b8p-28, 0x0.a7742013137200p-36, -0x0.ab6d8b94e034b0p-44, 0x0.af24cccdbe45a0p-52, -0x0.b2952269971020p-60, 0x0.b5bc28f146fb08p-68, -0x0.b891e055104700p-76, // x in subrange 6:59 (15.375..15.5)
+ 0x0.9b0b66d2848578p-20, -0x0.9e1c58f74fb510p-28, 0x0.a0ea24fbff2c40p-36, -0x0.a371327b67e5a8p-44, 0x0.a5ae4b50923948p-52, -0x0.a79ea25c407730p-60, 0x0.a941b10189e6d0p-68, -0x0.aa91de8119a588p-76, // x in subrange 6:60 (15.5..15.625)
+ 0x0.9765a036707ba0p-20, -0x0.992e2b5c7c0ab8p-28, 0x0.9aadd9616e8f98p-36, -0x0.9be2e3fb750ae8p-44, 0x0.9ccbf349f2dcf0p-52, -0x0.9d682016aa0a88p-60, 0x0.9db8a5dfa34ab0p-68, -0x0.9dba1d88493470p-76, // x in subrange 6:61 (15.625..15.75)
+ 0x0.93dcdb5925bef0p-20, -0x0.9470b759a86270p-28, 0x0.94bb12c52ad668p-36, -0x0.94bbeb85387728p-44, 0x0.9473ab7f290880p-52, -0x0.93e326947cbf68p-60, 0x0.930d25265fe488p-68, -0x0.91f02588ae6840p-76, // x in subrange 6:62 (15.75..15.875)
+ 0x0.906ffaa5c0e6b0p-20, -0x0.8fe1c097881678p-28, 0x0.8f0de7682c29a0p-36, -0x0.8df6091b3d6ef8p-44, 0x0.8c9c1cac9862a0p-52, -0x0.8b02708bcadb98p-60, 0x0.892d119de3af78p-68, -0x0.871c087acd6bf0p-76, // x in subrange 6:63 (15.875..16)
+};
+// clang-format on
+//--- End of autogenerated code
+
+//! Compute erfcx(x) by Chebyshev interpolation within certain subranges.
+//! Coefficients are read from the avove lookup table.
+//! For speed and accuracy, Chebychev subranges are 64th fractions of octaves.
+//! This allows us to compute the within-subrange coordinate t = (x -
+//! center_of_range) / half_range by integer and bitwise operations without any
+//! rounding.
+
+static inline CERF_INLINE_CONSTEXPR double cerf_inline_erfcx_cheb(double x) {
+    // Application-specific constants:
+    const int M = 6;   // 2^M subranges
+    const int j0 = -2; // first octave runs from 2^(j0-1) to 2^j0
+    const int l0 = 0;  // index of x_min in full first octave
+    const int loff = (j0 + 1) * (1 << M) + l0; // precomputed offset
+
+    // For given x, obtain mantissa xm and exponent je:
+    int je;                          // will be set in next line
+    const double xm = cerf_inline_frexp2(x, &je); // sets xm and je
+
+    // Integer arithmetics to obtain reduced coordinate t:
+    const int ip = (int)((1 << (M+1)) * xm);   // index in octave + 2^M
+    const int lij = je * (1 << M) + ip - loff; // index in lookup table
+    const double t = (1 << (M+2)) * xm - (1 + 2 * ip);
+
+    SET_NTER(lij);
+
+    const double *const P = CerfErfcxCoeffs1 + (lij * 8);
+    const double *const Q = CerfErfcxCoeffs0 + (lij * 2);
+
+    // hard-coded for N1cheb=10
+#ifdef CERF_ESTRIN
+    return (Q[0] + Q[1] * t) + cerf_inline_poly7(P, t) * (t * t);
+#else
+    return (cerf_inline_poly7(P, t) * t + Q[1]) * t + Q[0];
+#endif
+}
+
+
+/******************************************************************************/
+/*  erfcx: uniform table path                                                 */
+/******************************************************************************/
+
+//--- The following code is generated by dev/1d/pro_uniform_chebcoeffs.py erfcx; do not edit
+// clang-format off
+static CERF_INLINE_CONST int CerfErfcxUniformOctaves[83 * 2] = {
+       0,  1, // octave -55 (1.38778e-17..2.77556e-17)
+       1,  1, // octave -54 (2.77556e-17..5.55112e-17)
+       2,  1, // octave -53 (5.55112e-17..1.11022e-16)
+       3,  1, // octave -52 (1.11022e-16..2.22045e-16)
+       4,  1, // octave -51 (2.22045e-16..4.44089e-16)
+       5,  1, // octave -50 (4.44089e-16..8.88178e-16)
+       6,  1, // octave -49 (8.88178e-16..1.77636e-15)
+       7,  1, // octave -48 (1.77636e-15..3.55271e-15)
+       8,  1, // octave -47 (3.55271e-15..7.10543e-15)
+       9,  1, // octave -46 (7.10543e-15..1.42109e-14)
+      10,  1, // octave -45 (1.42109e-14..2.84217e-14)
+      11,  1, // octave -44 (2.84217e-14..5.68434e-14)
+      12,  1, // octave -43 (5.68434e-14..1.13687e-13)
+      13,  1, // octave -42 (1.13687e-13..2.27374e-13)
+      14,  1, // octave -41 (2.27374e-13..4.54747e-13)
+      15,  1, // octave -40 (4.54747e-13..9.09495e-13)
+      16,  1, // octave -39 (9.09495e-13..1.81899e-12)
+      17,  1, // octave -38 (1.81899e-12..3.63798e-12)
+      18,  1, // octave -37 (3.63798e-12..7.27596e-12)
+      19,  1, // octave -36 (7.27596e-12..1.45519e-11)
+      20,  1, // octave -35 (1.45519e-11..2.91038e-11)
+      21,  1, // octave -34 (2.91038e-11..5.82077e-11)
+      22,  1, // octave -33 (5.82077e-11..1.16415e-10)
+      23,  1, // octave -32 (1.16415e-10..2.32831e-10)
+      24,  1, // octave -31 (2.32831e-10..4.65661e-10)
+      25,  1, // octave -30 (4.65661e-10..9.31323e-10)
+      26,  1, // octave -29 (9.31323e-10..1.86265e-09)
+      27,  1, // octave -28 (1.86265e-09..3.72529e-09)
+      28,  1, // octave -27 (3.72529e-09..7.45058e-09)
+      29,  1, // octave -26 (7.45058e-09..1.49012e-08)
+      30,  1, // octave -25 (1.49012e-08..2.98023e-08)
+      31,  1, // octave -24 (2.98023e-08..5.96046e-08)
+      32,  1, // octave -23 (5.96046e-08..1.19209e-07)
+      33,  1, // octave -22 (1.19209e-07..2.38419e-07)
+      34,  1, // octave -21 (2.38419e-07..4.76837e-07)
+      35,  1, // octave -20 (4.76837e-07..9.53674e-07)
+      36,  1, // octave -19 (9.53674e-07..1.90735e-06)
+      37,  1, // octave -18 (1.90735e-06..3.8147e-06)
+      38,  1, // octave -17 (3.8147e-06..7.62939e-06)
+      39,  1, // octave -16 (7.62939e-06..1.52588e-05)
+      40,  1, // octave -15 (1.52588e-05..3.05176e-05)
+      41,  1, // octave -14 (3.05176e-05..6.10352e-05)
+      42,  1, // octave -13 (6.10352e-05..0.00012207)
+      43,  1, // octave -12 (0.00012207..0.000244141)
+      44,  1, // octave -11 (0.000244141..0.000488281)
+      45,  1, // octave -10 (0.000488281..0.000976562)
+      46,  1, // octave -9 (0.000976562..0.00195312)
+      47,  1, // octave -8 (0.00195312..0.00390625)
+      48,  1, // octave -7 (0.00390625..0.0078125)
+      49,  1, // octave -6 (0.0078125..0.015625)
+      50,  1, // octave -5 (0.015625..0.03125)
+      51,  1, // octave -4 (0.03125..0.0625)
+      52,  1, // octave -3 (0.0625..0.125)
+      53,  1, // octave -2 (0.125..0.25)
+      54,  2, // octave -1 (0.25..0.5)
+      56,  4, // octave 0 (0.5..1)
+      60,  8, // octave 1 (1..2)
+      68,  8, // octave 2 (2..4)
+      76, 16, // octave 3 (4..8)
+      92, 16, // octave 4 (8..16)
+     108,  8, // octave 5 (16..32)
+     116,  8, // octave 6 (32..64)
+     124,  8, // octave 7 (64..128)
+     132,  8, // octave 8 (128..256)
+     140,  4, // octave 9 (256..512)
+     144,  4, // octave 10 (512..1024)
+     148,  4, // octave 11 (1024..2048)
+     152,  4, // octave 12 (2048..4096)
+     156,  2, // octave 13 (4096..8192)
+     158,  2, // octave 14 (8192..16384)
+     160,  2, // octave 15 (16384..32768)
+     162,  2, // octave 16 (32768..65536)
+     164,  1, // octave 17 (65536..131072)
+     165,  1, // octave 18 (131072..262144)
+     166,  1, // octave 19 (262144..524288)
+     167,  1, // octave 20 (524288..1.04858e+06)
+     168,  1, // octave 21 (1.04858e+06..2.09715e+06)
+     169,  1, // octave 22 (2.09715e+06..4.1943e+06)
+     170,  1, // octave 23 (4.1943e+06..8.38861e+06)
+     171,  1, // octave 24 (8.38861e+06..1.67772e+07)
+     172,  1, // octave 25 (1.67772e+07..3.35544e+07)
+     173,  1, // octave 26 (3.35544e+07..6.71089e+07)
+     174,  1, // octave 27 (6.71089e+07..1.34218e+08)
+};
+alignas(64) static CERF_INLINE_CONST double CerfErfcxUniformCoeffs[175 * 10] = {
+ 0x0.80000000000000p1, -0x0.906eba8214db68p-56, 0x0.fffffffffff6c8p-114, 0x0.87000000000000p-154, -0x0.80000000000000p-156, -0x0.f4000000000000p-154, 0x0.f5555555555558p-155, 0x0.80000000000000p-154, -0x0.aaaaaaaaaaaaa8p-155, 0x0, // subrange -55:0 (1.38778e-17..2.77556e-17)
+ 0x0.80000000000000p1, -0x0.906eba8214db68p-55, 0x0.fffffffffffe48p-112, 0x0.ef8e38e38e38e0p-155, -0x0.8f1c71c71c71c8p-156, -0x0.c2aaaaaaaaaaa8p-154, 0x0.f8e38e38e38e38p-155, 0x0.80000000000000p-155, -0x0.aaaaaaaaaaaaa8p-155, 0x0.e38e38e38e38e0p-157, // subrange -54:0 (2.77556e-17..5.55112e-17)
+ 0x0.fffffffffffff8p0, -0x0.906eba8214db60p-54, 0x0.ffffffffffffd8p-110, 0x0.a2aaaaaaaaaaa8p-154, -0x0.c8000000000000p-156, -0x0.a8000000000000p-153, 0x0.85555555555558p-154, 0x0.ee38e38e38e390p-154, -0x0.aaaaaaaaaaaaa8p-155, -0x0.aaaaaaaaaaaaa8p-156, // subrange -53:0 (5.55112e-17..1.11022e-16)
+ 0x0.fffffffffffff0p0, -0x0.906eba8214db60p-53, 0x0.ffffffffffffc0p-108, 0x0.f0000000000000p-155, -0x0.c8e38e38e38e38p-157, -0x0.c2aaaaaaaaaaa8p-154, 0x0.caaaaaaaaaaaa8p-155, 0x0.80000000000000p-155, -0x0.8e38e38e38e390p-155, 0x0.e38e38e38e38e0p-157, // subrange -52:0 (1.11022e-16..2.22045e-16)
+ 0x0.ffffffffffffe8p0, -0x0.906eba8214db50p-52, 0x0.ffffffffffffc8p-106, 0x0.ec71c71c71c720p-155, -0x0.af1c71c71c71c8p-156, -0x0.cd555555555558p-154, 0x0.81c71c71c71c70p-154, 0x0.8e38e38e38e390p-155, -0x0.aaaaaaaaaaaaa8p-155, 0x0.e38e38e38e38e0p-157, // subrange -51:0 (2.22045e-16..4.44089e-16)
+ 0x0.ffffffffffffc8p0, -0x0.906eba8214db38p-51, 0x0.ffffffffffff90p-104, 0x0.cf555555555558p-155, -0x0.871c71c71c71c8p-157, -0x0.918e38e38e38e0p-153, 0x0.c0000000000000p-155, 0x0.ae38e38e38e390p-154, -0x0.8e38e38e38e390p-155, -0x0.e38e38e38e38e0p-158, // subrange -50:0 (4.44089e-16..8.88178e-16)
+ 0x0.ffffffffffff90p0, -0x0.906eba8214db08p-50, 0x0.ffffffffffff28p-102, -0x0.83f1c71c71c720p-153, -0x0.dc71c71c71c720p-157, -0x0.cb1c71c71c71c8p-154, 0x0.eaaaaaaaaaaaa8p-155, 0x0.8e38e38e38e390p-155, -0x0.aaaaaaaaaaaaa8p-155, 0x0.e38e38e38e38e0p-157, // subrange -49:0 (8.88178e-16..1.77636e-15)
+ 0x0.ffffffffffff28p0, -0x0.906eba8214daa8p-49, 0x0.fffffffffffe50p-100, -0x0.bac38e38e38e38p-150, -0x0.c2aaaaaaaaaaa8p-156, -0x0.8471c71c71c720p-154, 0x0.938e38e38e38e0p-154, 0x0.aaaaaaaaaaaaa8p-158, -0x0.c71c71c71c71c8p-155, 0x0.aaaaaaaaaaaaa8p-156, // subrange -48:0 (1.77636e-15..3.55271e-15)
+ 0x0.fffffffffffe50p0, -0x0.906eba8214d9e8p-48, 0x0.fffffffffffca0p-98, -0x0.bfcb8e38e38e38p-147, -0x0.db8e38e38e38e0p-156, -0x0.a38e38e38e38e0p-154, 0x0.98e38e38e38e38p-154, 0x0.c71c71c71c71c8p-156, -0x0.c71c71c71c71c8p-155, 0x0.e38e38e38e38e0p-157, // subrange -47:0 (3.55271e-15..7.10543e-15)
+ 0x0.fffffffffffca0p0, -0x0.906eba8214d868p-47, 0x0.fffffffffff938p-96, -0x0.c075b1c71c71c8p-144, -0x0.9aaaaaaaaaaaa8p-156, -0x0.d871c71c71c720p-154, 0x0.80000000000000p-154, 0x0.e38e38e38e38e0p-155, -0x0.aaaaaaaaaaaaa8p-155, 0x0, // subrange -46:0 (7.10543e-15..1.42109e-14)
+ 0x0.fffffffffff938p0, -0x0.906eba8214d568p-46, 0x0.fffffffffff278p-94, -0x0.c08eb38e38e390p-141, -0x0.b471c71c71c720p-156, -0x0.9d555555555558p-153, 0x0.81c71c71c71c70p-154, 0x0.ce38e38e38e390p-154, -0x0.aaaaaaaaaaaaa8p-155, -0x0.e38e38e38e38e0p-157, // subrange -45:0 (1.42109e-14..2.84217e-14)
+ 0x0.fffffffffff278p0, -0x0.906eba8214cf68p-45, 0x0.ffffffffffe4e8p-92, -0x0.c0932b00000000p-138, -0x0.be38e38e38e390p-156, -0x0.c071c71c71c720p-154, 0x0.971c71c71c71c8p-154, 0x0.b8e38e38e38e38p-156, -0x0.c71c71c71c71c8p-155, 0x0.aaaaaaaaaaaaa8p-156, // subrange -44:0 (2.84217e-14..5.68434e-14)
+ 0x0.ffffffffffe4e8p0, -0x0.906eba8214c368p-44, 0x0.ffffffffffc9d8p-90, -0x0.c0939091c71c70p-135, -0x0.9e38e38e38e390p-156, -0x0.9bc71c71c71c70p-153, 0x0.80000000000000p-154, 0x0.e0000000000000p-154, -0x0.aaaaaaaaaaaaa8p-155, -0x0.aaaaaaaaaaaaa8p-156, // subrange -43:0 (5.68434e-14..1.13687e-13)
+ 0x0.ffffffffffc9d8p0, -0x0.906eba8214ab68p-43, 0x0.ffffffffff93b0p-88, -0x0.c093a118000000p-132, -0x0.8ce38e38e38e38p-155, -0x0.8aaaaaaaaaaaa8p-153, 0x0.b5555555555558p-154, 0x0.a71c71c71c71c8p-154, -0x0.e38e38e38e38e0p-155, -0x0.e38e38e38e38e0p-158, // subrange -42:0 (1.13687e-13..2.27374e-13)
+ 0x0.ffffffffff93b0p0, -0x0.906eba82147b68p-42, 0x0.ffffffffff2758p-86, -0x0.c093a321638e38p-129, -0x0.aaaaaaaaaaaaa8p-155, -0x0.b6aaaaaaaaaaa8p-154, 0x0.d0000000000000p-154, 0x0.95555555555558p-155, -0x0.80000000000000p-154, 0x0.e38e38e38e38e0p-158, // subrange -41:0 (2.27374e-13..4.54747e-13)
+ 0x0.ffffffffff2758p0, -0x0.906eba82141b68p-41, 0x0.fffffffffe4eb0p-84, -0x0.c093a34e9e38e0p-126, -0x0.95555555555558p-156, -0x0.8838e38e38e390p-153, 0x0.fc71c71c71c720p-155, 0x0.8e38e38e38e390p-154, -0x0.aaaaaaaaaaaaa8p-155, 0x0, // subrange -40:0 (4.54747e-13..9.09495e-13)
+ 0x0.fffffffffe4eb0p0, -0x0.906eba82135b68p-40, 0x0.fffffffffc9d68p-82, -0x0.c093a356d51c70p-123, -0x0.a71c71c71c71c8p-155, -0x0.aa000000000000p-153, 0x0.bc71c71c71c720p-154, 0x0.80000000000000p-153, -0x0.e38e38e38e38e0p-155, -0x0.e38e38e38e38e0p-156, // subrange -39:0 (9.09495e-13..1.81899e-12)
+ 0x0.fffffffffc9d68p0, -0x0.906eba8211db68p-39, 0x0.fffffffff93ad0p-80, -0x0.c093a357f3ce38p-120, -0x0.838e38e38e38e0p-155, -0x0.ff8e38e38e38e0p-154, 0x0.b38e38e38e38e0p-154, 0x0.98e38e38e38e38p-154, -0x0.e38e38e38e38e0p-155, -0x0.e38e38e38e38e0p-158, // subrange -38:0 (1.81899e-12..3.63798e-12)
+ 0x0.fffffffff93ad0p0, -0x0.906eba820edb68p-38, 0x0.fffffffff275a0p-78, -0x0.c093a3580bec70p-117, -0x0.91c71c71c71c70p-158, -0x0.e0000000000000p-154, 0x0.91c71c71c71c70p-154, 0x0.ce38e38e38e390p-155, -0x0.c71c71c71c71c8p-155, 0x0.e38e38e38e38e0p-158, // subrange -37:0 (3.63798e-12..7.27596e-12)
+ 0x0.fffffffff275a0p0, -0x0.906eba8208db68p-37, 0x0.ffffffffe4eb40p-76, -0x0.c093a358033690p-114, 0x0.e91c71c71c71c8p-153, -0x0.9caaaaaaaaaaa8p-153, 0x0.81c71c71c71c70p-154, 0x0.e0000000000000p-154, -0x0.aaaaaaaaaaaaa8p-155, -0x0.aaaaaaaaaaaaa8p-156, // subrange -36:0 (7.27596e-12..1.45519e-11)
+ 0x0.ffffffffe4eb40p0, -0x0.906eba81fcdb68p-36, 0x0.ffffffffc9d678p-74, -0x0.c093a357ebbf68p-111, 0x0.ffa1c71c71c720p-149, -0x0.e1c71c71c71c70p-154, 0x0.b8e38e38e38e38p-155, 0x0.ce38e38e38e390p-155, -0x0.8e38e38e38e390p-155, 0x0.e38e38e38e38e0p-158, // subrange -35:0 (1.45519e-11..2.91038e-11)
+ 0x0.ffffffffc9d678p0, -0x0.906eba81e4db68p-35, 0x0.ffffffff93acf8p-72, -0x0.c093a357bbcd38p-108, 0x0.fffce38e38e390p-145, -0x0.f1555555555558p-154, 0x0.8aaaaaaaaaaaa8p-155, 0x0.91c71c71c71c70p-154, -0x0.e38e38e38e38e0p-156, -0x0.e38e38e38e38e0p-158, // subrange -34:0 (2.91038e-11..5.82077e-11)
+ 0x0.ffffffff93acf8p0, -0x0.906eba81b4db68p-34, 0x0.ffffffff2759e8p-70, -0x0.c093a3575bcef0p-105, 0x0.fffe5c71c71c70p-141, -0x0.8038e38e38e390p-153, 0x0.98e38e38e38e38p-154, 0x0.871c71c71c71c8p-154, -0x0.c71c71c71c71c8p-155, 0x0, // subrange -33:0 (5.82077e-11..1.16415e-10)
+ 0x0.ffffffff2759e8p0, -0x0.906eba8154db68p-33, 0x0.fffffffe4eb3d0p-68, -0x0.c093a3569bcf30p-102, 0x0.ffffd51c71c720p-137, -0x0.d1555555555558p-154, 0x0.d0000000000000p-154, 0x0.8e38e38e38e390p-155, -0x0.80000000000000p-154, 0x0.e38e38e38e38e0p-157, // subrange -32:0 (1.16415e-10..2.32831e-10)
+ 0x0.fffffffe4eb3d0p0, -0x0.906eba8094db68p-32, 0x0.fffffffc9d67a0p-66, -0x0.c093a3551bcf38p-99, 0x0.fffffdb0000000p-133, -0x0.90e38e38e38e38p-153, 0x0.b71c71c71c71c8p-154, 0x0.d1c71c71c71c70p-154, -0x0.e38e38e38e38e0p-155, -0x0.aaaaaaaaaaaaa8p-156, // subrange -31:0 (2.32831e-10..4.65661e-10)
+ 0x0.fffffffc9d67a0p0, -0x0.906eba7f14db68p-31, 0x0.fffffff93acf40p-64, -0x0.c093a3521bcf38p-96, 0x0.ffffffd51c71c8p-129, -0x0.8caaaaaaaaaaa8p-153, 0x0.b38e38e38e38e0p-154, 0x0.a71c71c71c71c8p-154, -0x0.e38e38e38e38e0p-155, -0x0.e38e38e38e38e0p-158, // subrange -30:0 (4.65661e-10..9.31323e-10)
+ 0x0.fffffff93acf40p0, -0x0.906eba7c14db68p-30, 0x0.fffffff2759e88p-62, -0x0.c093a34c1bcf38p-93, 0x0.ffffffed8e38e0p-125, -0x0.aa38e38e38e390p-154, 0x0.b8e38e38e38e38p-155, -0x0.c71c71c71c71c8p-157, -0x0.8e38e38e38e390p-155, 0x0.8e38e38e38e390p-155, // subrange -29:0 (9.31323e-10..1.86265e-09)
+ 0x0.fffffff2759e88p0, -0x0.906eba7614db68p-29, 0x0.ffffffe4eb3d08p-60, -0x0.c093a3401bcf38p-90, 0x0.ffffffdbd771c8p-121, -0x0.b8c71c71c71c70p-151, 0x0.caaaaaaaaaaaa8p-155, 0x0.b8e38e38e38e38p-155, -0x0.8e38e38e38e390p-155, 0x0.e38e38e38e38e0p-157, // subrange -28:0 (1.86265e-09..3.72529e-09)
+ 0x0.ffffffe4eb3d08p0, -0x0.906eba6a14db68p-28, 0x0.ffffffc9d67a18p-58, -0x0.c093a3281bcf40p-87, 0x0.ffffffb7c62558p-117, -0x0.9b19c71c71c720p-146, 0x0.baaaaaaaaaaaa8p-154, 0x0.a0000000000000p-154, -0x0.e38e38e38e38e0p-155, -0x0.e38e38e38e38e0p-158, // subrange -27:0 (3.72529e-09..7.45058e-09)
+ 0x0.ffffffc9d67a18p0, -0x0.906eba5214db70p-27, 0x0.ffffff93acf438p-56, -0x0.c093a2f81bcf50p-84, 0x0.ffffff6f911fc8p-113, -0x0.9a164aaaaaaaa8p-141, 0x0.b8e38e38e38e38p-154, 0x0.d5555555555558p-156, -0x0.e38e38e38e38e0p-155, 0x0.aaaaaaaaaaaaa8p-156, // subrange -26:0 (7.45058e-09..1.49012e-08)
+ 0x0.ffffff93acf440p0, -0x0.906eba2214db90p-26, 0x0.ffffff2759e8a8p-54, -0x0.c093a2981bcfa0p-81, 0x0.fffffedf228a98p-109, -0x0.9a0fdf71c71c70p-136, 0x0.f5555555555558p-155, 0x0.c71c71c71c71c8p-156, -0x0.aaaaaaaaaaaaa8p-155, 0x0.e38e38e38e38e0p-157, // subrange -25:0 (1.49012e-08..2.98023e-08)
+ 0x0.ffffff2759e8d0p0, -0x0.906eb9c214dc08p-25, 0x0.fffffe4eb3d228p-52, -0x0.c093a1d81bd0e8p-78, 0x0.fffffdbe4518b8p-105, -0x0.9a0fb5eaaaaaa8p-131, 0x0.871c71c71c71c8p-154, 0x0.80000000000000p-155, -0x0.aaaaaaaaaaaaa8p-155, 0x0.e38e38e38e38e0p-157, // subrange -24:0 (2.98023e-08..5.96046e-08)
+ 0x0.fffffe4eb3d2b8p0, -0x0.906eb90214ddf0p-24, 0x0.fffffc9d67a7b0p-50, -0x0.c093a0581bd5f8p-75, 0x0.fffffb7c8a3730p-101, -0x0.9a0fb2f55c71c8p-126, 0x0.caaaaaaaaaaaa8p-152, 0x0.dc71c71c71c720p-154, -0x0.aaaaaaaaaaaaa8p-155, -0x0.e38e38e38e38e0p-157, // subrange -23:0 (5.96046e-08..1.19209e-07)
+ 0x0.fffffc9d67a9f0p0, -0x0.906eb78214e590p-23, 0x0.fffff93acf5ce8p-48, -0x0.c0939d581bea48p-72, 0x0.fffff6f91484e0p-97, -0x0.9a0fafe083c720p-121, 0x0.ab638e38e38e38p-146, 0x0.9c71c71c71c720p-155, -0x0.e38e38e38e38e0p-155, 0x0.e38e38e38e38e0p-157, // subrange -22:0 (1.19209e-07..2.38419e-07)
+ 0x0.fffff93acf65e8p0, -0x0.906eb482150408p-22, 0x0.fffff2759eefd0p-46, -0x0.c09397581c3b88p-69, 0x0.ffffedf22963c0p-93, -0x0.9a0fa9e01bf558p-116, 0x0.aaac471c71c720p-140, 0x0.80000000000000p-153, -0x0.8e38e38e38e390p-155, -0x0.e38e38e38e38e0p-156, // subrange -21:0 (2.38419e-07..4.76837e-07)
+ 0x0.fffff2759f13d0p0, -0x0.906eae82157de8p-21, 0x0.ffffe4eb3eb7a0p-44, -0x0.c0938b581d8080p-66, 0x0.ffffdbe4542f78p-89, -0x0.9a0f9de0186010p-111, 0x0.aaaa9d00000000p-134, 0x0.c71c71c71c71c8p-157, -0x0.8e38e38e38e390p-154, 0x0.aaaaaaaaaaaaa8p-156, // subrange -20:0 (4.76837e-07..9.53674e-07)
+ 0x0.ffffe4eb3f4798p0, -0x0.906ea282176558p-20, 0x0.ffffc9d680cf38p-42, -0x0.c0937358229468p-63, 0x0.ffffb7c8adfef8p-85, -0x0.9a0f85e01e6008p-106, 0x0.aaaa70fc71c720p-128, -0x0.a7c71c71c71c70p-150, -0x0.8e38e38e38e390p-155, -0x0.e38e38e38e38e0p-158, // subrange -19:0 (9.53674e-07..1.90735e-06)
+ 0x0.ffffc9d6830f38p0, -0x0.906e8a821f0330p-19, 0x0.ffff93ad0f1e68p-40, -0x0.c093435836e3f0p-60, 0x0.ffff6f91727de0p-81, -0x0.9a0f55e036beb0p-101, 0x0.aaaa371f8c71c8p-122, -0x0.b00ce38e38e390p-143, -0x0.aaaaaaaaaaaaa8p-155, 0x0.aaaaaaaaaaaaa8p-156, // subrange -18:0 (1.90735e-06..3.8147e-06)
+ 0x0.ffff93ad181e68p0, -0x0.906e5a823d7a80p-18, 0x0.ffff275a543cb8p-38, -0x0.c092e358882218p-57, 0x0.fffedf233efb88p-77, -0x0.9a0ef5e0983c60p-96, 0x0.aaa9c393c3c000p-116, -0x0.b010ce38e38e38p-136, -0x0.aaaaaaaaaaaaa8p-156, 0x0, // subrange -17:0 (3.8147e-06..7.62939e-06)
+ 0x0.ffff275a783c90p0, -0x0.906dfa82b75790p-17, 0x0.fffe4eb5807880p-36, -0x0.c0922359cd1a00p-54, 0x0.fffdbe47e5f520p-73, -0x0.9a0e35e21e3270p-91, 0x0.aaa8dc7e290f70p-110, -0x0.b00ff43c71c720p-129, 0x0.a9555555555558p-148, 0x0, // subrange -16:0 (7.62939e-06..1.52588e-05)
+ 0x0.fffe4eb6107738p0, -0x0.906d3a849eca50p-16, 0x0.fffc9d6e60e958p-34, -0x0.c090a35ee0f4b8p-51, 0x0.fffb7c956bdb08p-69, -0x0.9a0cb5e83603b8p-86, 0x0.aaa70e56e75490p-104, -0x0.b00df479ce38e0p-122, 0x0.aaa55555555558p-140, 0x0, // subrange -15:0 (1.52588e-05..3.05176e-05)
+ 0x0.fffc9d70a0df30p0, -0x0.906bba8c3c8988p-15, 0x0.fff93aea4195c8p-32, -0x0.c08da373303830p-48, 0x0.fff6f941573c38p-65, -0x0.9a09b6009511c0p-81, 0x0.aaa37218237c50p-98, -0x0.b009f49f5371c8p-115, 0x0.aaa26955555558p-132, -0x0.9c71c71c71c720p-149, // subrange -14:0 (3.05176e-05..6.10352e-05)
+ 0x0.fff93af3414488p0, -0x0.9068baaab327e0p-14, 0x0.fff2760a814428p-30, -0x0.c087a3c46c0b28p-45, 0x0.ffedf2dcaaa9a0p-61, -0x0.9a03b6620f90e8p-76, 0x0.aa9c39d9983e28p-92, -0x0.b001f533ddb920p-108, 0x0.aa9a29d4000000p-124, -0x0.9c71c71c71c720p-140, // subrange -13:0 (6.10352e-05..0.00012207)
+ 0x0.fff2762e7eba50p0, -0x0.9062bb248aad78p-13, 0x0.ffe4ececf34d50p-28, -0x0.c07ba509517fb0p-42, 0x0.ffdbe72136dd80p-57, -0x0.99f7b7e7ebc6b8p-71, 0x0.aa8dca58655448p-86, -0x0.aff1f785eb1740p-101, 0x0.aa89aab2731c70p-116, -0x0.9c61c000000000p-131, // subrange -12:0 (0.00012207..0.000244141)
+ 0x0.ffe4ed7cdeff78p0, -0x0.9056bd0bd12680p-12, 0x0.ffc9dd396cc840p-26, -0x0.c063aa1c989c88p-39, 0x0.ffb7d3e17a19f8p-53, -0x0.99dfbdfeee6f10p-66, 0x0.aa70ef451c2268p-80, -0x0.afd200cd63a688p-94, 0x0.aa68b1847fe358p-108, -0x0.9c41caa6471c70p-122, // subrange -11:0 (0.000244141..0.000488281)
+ 0x0.ffc9df78ca6788p0, -0x0.903ec4a82e3578p-11, 0x0.ff93c7ef0b5630p-24, -0x0.c033be673fbb30p-36, 0x0.ff6fbe3b57fa40p-49, -0x0.99afd657882258p-61, 0x0.aa3748d76fb5b8p-74, -0x0.af9225e55fed80p-87, 0x0.aa26d3816f8428p-100, -0x0.9c01f4167e9558p-113, // subrange -10:0 (0.000488281..0.000976562)
+ 0x0.ff93d0e9f92eb0p0, -0x0.900ee313bd1df8p-10, 0x0.ff27c5bfaa60d8p-22, -0x0.bfd40f7e36e808p-33, 0x0.fedfd639db0c40p-45, -0x0.9950379e700bf8p-56, 0x0.a9c43ac3551568p-68, -0x0.af12ba16319ed0p-80, 0x0.a9a368b56512e8p-92, -0x0.9b82999ce57cb0p-104, // subrange -9:0 (0.000976562..0.00195312)
+ 0x0.ff27e997270590p0, -0x0.8faf5c92e37e28p-9, 0x0.fe50628c4ab050p-20, -0x0.bf15533d3e82d8p-30, 0x0.fdc1128ddcc170p-41, -0x0.9891bbdea10cd8p-51, 0x0.a8df18d5f919d0p-62, -0x0.ae15096180da30p-73, 0x0.a89dd6bc49ff88p-84, -0x0.9a852de39a9128p-95, // subrange -8:0 (0.00195312..0.00390625)
+ 0x0.fe50f1490d3318p0, -0x0.8ef14118274798p-8, 0x0.fca41d85c4bd40p-18, -0x0.bd9a5d5803f010p-27, 0x0.fb87b5f9c0b758p-37, -0x0.9717c60c6d4c70p-46, 0x0.a718b6e072a7b8p-56, -0x0.ac1e3adf291398p-66, 0x0.a697b70c9f3420p-76, -0x0.988f707d79aa78p-86, // subrange -7:0 (0.00390625..0.0078125)
+ 0x0.fca6537998a2e0p0, -0x0.8d78c787a81180p-7, 0x0.f9557ecc6ab278p-16, -0x0.baae5f0c9c9748p-24, 0x0.f72573af44dcb8p-33, -0x0.942fb8b277c000p-41, 0x0.a39b43035de770p-50, -0x0.a842a4590326a0p-59, 0x0.a29f380351a928p-68, -0x0.94b8083d210d10p-77, // subrange -6:0 (0.0078125..0.015625)
+ 0x0.f95e2f444f67d0p0, -0x0.8a9685667afef8p-6, 0x0.f2df210381a3e0p-14, -0x0.b4fd3559eb4d68p-21, 0x0.eea131c3662118p-29, -0x0.8e8ddb03b41610p-36, 0x0.9cdbe9bf964b60p-44, -0x0.a0d176064ba7a0p-52, 0x0.9afac6ad207668p-60, -0x0.8d56e77dfd7e50p-68, // subrange -5:0 (0.015625..0.03125)
+ 0x0.f300b2022fafc0p0, -0x0.850ab229fa9f28p-5, 0x0.e687b14e4030d0p-12, -0x0.aa2f5aad86d2b0p-18, 0x0.de8d790e1e1b40p-25, -0x0.83f9a178f4fee0p-31, 0x0.903e8395c74488p-38, -0x0.92f70bcf95da68p-45, 0x0.8cd17629edee28p-52, -0x0.ff6f5f676a5d00p-60, // subrange -4:0 (0.03125..0.0625)
+ 0x0.e7050323728898p0, -0x0.f58c846d843d38p-5, 0x0.cfffd6b92e22a0p-10, -0x0.96b305881a9be0p-15, 0x0.c1df0e3477d7c8p-21, -0x0.e2941afc461280p-27, 0x0.f4557a0bcb3410p-33, -0x0.f5db88f4d2eb98p-39, 0x0.e8eddde9139248p-45, -0x0.d0f006607b3868p-51, // subrange -3:0 (0.0625..0.125)
+ 0x0.d1b5ddbf9b4368p0, -0x0.d23941dc4f7d88p-4, 0x0.aa4b21664c3628p-8, -0x0.edb98f76d6c790p-13, 0x0.9401bbf52b5490p-17, -0x0.a7fa9695cf4958p-22, 0x0.b0583eab9a5ca0p-27, -0x0.ad14dc8fa60290p-32, 0x0.a06f44630694a0p-37, -0x0.8cc2a74d0e92a8p-42, // subrange -2:0 (0.125..0.25)
+ 0x0.b9e0c4e7576d70p0, -0x0.acb0f9f3931270p-4, 0x0.83e976cb3961c0p-8, -0x0.af4ab11ac16af8p-13, 0x0.d10b96406cb1f8p-18, -0x0.e4349c36b5ca58p-23, 0x0.e72f10d0f3aff0p-28, -0x0.db85ebca7fa150p-33, 0x0.c5402e6ac57d80p-38, -0x0.a812c1dcd71188p-43, // subrange -1:0 (0.25..0.375)
+ 0x0.a6318761c3eaa8p0, -0x0.8f721e8e9e4980p-4, 0x0.cedf3406bd3b38p-9, -0x0.82ec643c311f68p-13, 0x0.9597c82dc829c0p-18, -0x0.9d1eb3eb692f78p-23, 0x0.99a15e3b04c5b0p-28, -0x0.8d28686751f7f0p-33, 0x0.f5efd4be8e7098p-39, -0x0.cb89fecfb52108p-44, // subrange -1:1 (0.375..0.5)
+ 0x0.95c2783b70a7d8p0, -0x0.f0c55b8295f3f8p-5, 0x0.a415ecfd6ce718p-9, -0x0.c5f6b2f00b8100p-14, 0x0.d8d11555783b00p-19, -0x0.db2ca181f78040p-24, 0x0.cee5fa62d6ad58p-29, -0x0.b7fb4dce4212a0p-34, 0x0.9b6972421e2678p-39, -0x0.f9e252d4884ce8p-45, // subrange 0:0 (0.5..0.625)
+ 0x0.87e7274b6eb0c8p0, -0x0.cbff3df8e30780p-5, 0x0.838ed3fbc14318p-9, -0x0.9766bafa6827e8p-14, 0x0.9f07076c59a390p-19, -0x0.9ac6e716529e18p-24, 0x0.8d18d633e04450p-29, -0x0.f2e9e466f23730p-35, 0x0.c701560eeedf50p-40, -0x0.9b6fe1bd8e3870p-45, // subrange 0:1 (0.625..0.75)
+ 0x0.f8391ffad66fc8p-1, -0x0.ae5e1610b6f800p-5, 0x0.d5195c1a838120p-10, -0x0.ea1f6c652eb500p-15, 0x0.ebf93024096558p-20, -0x0.dd36b48c1e2290p-25, 0x0.c2ce92662ac1c0p-30, -0x0.a25e8eaac49220p-35, 0x0.81093e6ff58388p-40, -0x0.c3df231574f630p-46, // subrange 0:2 (0.75..0.875)
+ 0x0.e3fc09c1390f78p-1, -0x0.964257be0870a0p-5, 0x0.ae3baefe2244a8p-10, -0x0.b6e64f3d1648c8p-15, 0x0.b0ff73b3c18f38p-20, -0x0.9fe41b359bc770p-25, 0x0.8810ac7c2b7e28p-30, -0x0.dbae4ea6fbc428p-36, 0x0.a96497443681c8p-41, -0x0.f9e83ce9eaefc8p-47, // subrange 0:3 (0.875..1)
+ 0x0.d27aa862f8d4c8p-1, -0x0.8276443602a978p-5, 0x0.8fb9ffd32bfcf0p-10, -0x0.90493624de1450p-15, 0x0.8626361fa5e278p-20, -0x0.e9a951419e5110p-26, 0x0.c0389814e4d8c0p-31, -0x0.9655f49bcaede8p-36, 0x0.e102782683d5b8p-42, -0x0.a1598f6628d340p-47, // subrange 1:0 (1..1.125)
+ 0x0.c33a491e302f08p-1, -0x0.e420f8c141fbd0p-6, 0x0.ef1ad5adc40078p-11, -0x0.e5c2c5058ee768p-16, 0x0.cd5e6165894d30p-21, -0x0.ac845eb633c580p-26, 0x0.893fb0ee585a40p-31, -0x0.d00eead6b828a8p-37, 0x0.97273df27c02f0p-42, -0x0.d2c763906a5c08p-48, // subrange 1:1 (1.125..1.25)
+ 0x0.b5d9bb549c8668p-1, -0x0.c8bebc94711990p-6, 0x0.c8723e4cc932e8p-11, -0x0.b88a09dacd77c0p-16, 0x0.9eaf4faac86b10p-21, -0x0.80a4c8eb6af1e8p-26, 0x0.c6086d2e437e98p-32, -0x0.91849356e59410p-37, 0x0.cd5184d7a943b8p-43, -0x0.8b3a2c605013e0p-48, // subrange 1:2 (1.25..1.375)
+ 0x0.aa0b502cb0f0e0p-1, -0x0.b1b4c70fad7240p-6, 0x0.a9458465b118a8p-11, -0x0.95722a66e5bb68p-16, 0x0.f76dd7af7195e0p-22, -0x0.c1af02da01bf90p-27, 0x0.904ab7de61daa8p-32, -0x0.cda780f988ea68p-38, 0x0.8cedcd707f3948p-43, -0x0.b9ee949eb406e0p-49, // subrange 1:3 (1.375..1.5)
+ 0x0.9f90680bf9a980p-1, -0x0.9e2f49c5ce77d8p-6, 0x0.8fedd9a5c16de8p-11, -0x0.f3f27e96fc8240p-17, 0x0.c28c80cb706b20p-22, -0x0.9321298d7eff98p-27, 0x0.d446e5014af550p-33, -0x0.92c351dd318e40p-38, 0x0.c3723058159720p-44, -0x0.fae9f89fc94bf0p-50, // subrange 1:4 (1.5..1.625)
+ 0x0.96361e95630888p-1, -0x0.8d8885a04a61a0p-6, 0x0.f6576eb1222f38p-12, -0x0.c89364f2ffc348p-17, 0x0.9a3623086d6380p-22, -0x0.e178b140801a50p-28, 0x0.9d933c54e38490p-33, -0x0.d377dc712d1018p-39, 0x0.88dcee26e29890p-44, -0x0.ab0559ad9674b8p-50, // subrange 1:5 (1.625..1.75)
+ 0x0.8dd2c7128c6d98p-1, -0x0.fe7b6194598170p-7, 0x0.d416f6da9ef630p-12, -0x0.a61184fb43d768p-17, 0x0.f65c595bf1e3a8p-23, -0x0.ae3227f8eda8a8p-28, 0x0.ebfd07db9460b0p-34, -0x0.99bed2fbdb5118p-39, 0x0.c17ff25c3a80d8p-45, -0x0.eb6a43c00130d0p-51, // subrange 1:6 (1.75..1.875)
+ 0x0.864401efd49590p-1, -0x0.e5cd8a1beea828p-7, 0x0.b7a3985267e018p-12, -0x0.8a6826caf00fd8p-17, 0x0.c63acaf770b858p-23, -0x0.87a55b23e46f00p-28, 0x0.b23198838de730p-34, -0x0.e1860ae740f990p-40, 0x0.8a09af61e6ed68p-45, -0x0.a38edb738c8f88p-51, // subrange 1:7 (1.875..2)
+ 0x0.f87e947ee10560p-2, -0x0.c6b7b9ead50908p-6, 0x0.956d7bd57a25f8p-10, -0x0.d51221d5631190p-15, 0x0.90ef6777c719d8p-19, -0x0.bd0c0c9ac26588p-24, 0x0.ed5a66dcccd5a0p-29, -0x0.8fe421ccc48130p-33, 0x0.a98338ba4ae030p-38, -0x0.c120ef10503790p-43, // subrange 2:0 (2..2.25)
+ 0x0.e1cc3e82685cc0p-2, -0x0.a5d7564a6e4590p-6, 0x0.e6e440502acc58p-11, -0x0.995455e46d5860p-15, 0x0.c340694ab9c200p-20, -0x0.ef5a2f55ca1190p-25, 0x0.8db22b017268d0p-29, -0x0.a27c508d4312d0p-34, 0x0.b56ffa58d6dfc8p-39, -0x0.c470ba23877830p-44, // subrange 2:1 (2.25..2.5)
+ 0x0.cebb9c70fa6db8p-2, -0x0.8c39bd7f083670p-6, 0x0.b57e9dd1fcefa0p-11, -0x0.e146e9e26afa50p-16, 0x0.86a0515926ea60p-20, -0x0.9b74ca0a13fbe0p-25, 0x0.ade8cbdb091bf0p-30, -0x0.bced3f80b1e470p-35, 0x0.c8431e6842b738p-40, -0x0.ce4f2d044fd680p-45, // subrange 2:2 (2.5..2.75)
+ 0x0.be852f4eeab880p-2, -0x0.efe0102b84d960p-7, 0x0.90e11d7d19bfe8p-11, -0x0.a897c97e534b80p-16, 0x0.bda0255618a110p-21, -0x0.ceb791171fbc98p-26, 0x0.daeba19d432928p-31, -0x0.e1ae10c0dc3f18p-36, 0x0.e36d71f6123f70p-41, -0x0.df39a554a84fc8p-46, // subrange 2:3 (2.75..3)
+ 0x0.b0954092a28de8p-2, -0x0.cf4401f0bb9120p-7, 0x0.ea81f0e90023f8p-12, -0x0.804d493911c7d0p-16, 0x0.8824ba0143b148p-21, -0x0.8c6a32a59a0560p-26, 0x0.8d094f33222c58p-31, -0x0.8a319bbd4d3ac8p-36, 0x0.84988562c28928p-41, -0x0.f851210ae16cb8p-47, // subrange 2:4 (3..3.25)
+ 0x0.a47c78814cdb88p-2, -0x0.b4b69a9f8045a8p-7, 0x0.c02660ab89f850p-12, -0x0.c642609d7dbcf8p-17, 0x0.c6f2f9375f17e8p-22, -0x0.c288c238a44cb8p-27, 0x0.b9a85cef4420a8p-32, -0x0.ad308a4b037448p-37, 0x0.9e73230d4c7d88p-42, -0x0.8db9b1686e73f0p-47, // subrange 2:5 (3.25..3.5)
+ 0x0.99e58c8bcebfb0p-2, -0x0.9ed6646c2fb620p-7, 0x0.9f34189c381ee0p-12, -0x0.9b4c969bddf758p-17, 0x0.93b580f8e85620p-22, -0x0.8933d7e35e46e0p-27, 0x0.f94576b9ecb3e0p-33, -0x0.ddb9c37aaae9a0p-38, 0x0.c1b436cb872510p-43, -0x0.a5b6dcf43fab00p-48, // subrange 2:6 (3.5..3.75)
+ 0x0.908e312c9271a0p-2, -0x0.8c9f5bdcdfab20p-7, 0x0.853d02e99c36d8p-12, -0x0.f65ac0e15bf1d0p-18, 0x0.de90d7c8981dc8p-23, -0x0.c4c2cbd0273138p-28, 0x0.aa6b5466c1bfd8p-33, -0x0.90c37a391c58f8p-38, 0x0.f1dd77b1fa0fe0p-44, -0x0.c627d2c16c5990p-49, // subrange 2:7 (3.75..4)
+ 0x0.88422f0ee58cd0p-2, -0x0.fa9e7eae088c30p-8, 0x0.e10eb7a5248950p-13, -0x0.c5a36327c8ee28p-18, 0x0.a9f1cb21b74b80p-23, -0x0.8f403df2c85d00p-28, 0x0.ecfb12ec0b8368p-34, -0x0.c086d045e3bd98p-39, 0x0.9a0086346ab648p-44, -0x0.f1f47e0fac2808p-50, // subrange 3:0 (4..4.25)
+ 0x0.80d7e611738dc0p-2, -0x0.e0a5b7bf9e1780p-8, 0x0.bfa8b295231850p-13, -0x0.a037848551fcf0p-18, 0x0.835fcd1b05d078p-23, -0x0.d38968d12d8480p-29, 0x0.a75c499f8ab878p-34, -0x0.8238cb707a90f0p-39, 0x0.c7be52df9dc370p-45, -0x0.96a19f62bb1928p-50, // subrange 3:1 (4.25..4.5)
+ 0x0.f45b92f487dc68p-3, -0x0.ca72632d93feb0p-8, 0x0.a475047d4bdc08p-13, -0x0.8320ea8782df68p-18, 0x0.cd6f550a5dfb28p-24, -0x0.9e3a44b1c18010p-29, 0x0.efd4db107f4830p-35, -0x0.b2f884deae3918p-40, 0x0.83c4f914bc6020p-45, -0x0.bf028c322919d8p-51, // subrange 3:2 (4.5..4.75)
+ 0x0.e85111b6a49f50p-3, -0x0.b754edb2229530p-8, 0x0.8e190058a795d0p-13, -0x0.d889c5d731b460p-19, 0x0.a250bc98b184f8p-24, -0x0.ef91997a9d0060p-30, 0x0.ae2ac44a985ea0p-35, -0x0.f99f725c10c0e0p-41, 0x0.b0a72734fd2998p-46, -0x0.f6632b62606af0p-52, // subrange 3:3 (4.75..5)
+ 0x0.dd63652170dfd8p-3, -0x0.a6c36e2a230058p-8, 0x0.f71fff6e80eae8p-14, -0x0.b43e8b475e08c8p-19, 0x0.817ee7d8be1a78p-24, -0x0.b765b61960c6f8p-30, 0x0.80129d84f23c48p-35, -0x0.b07e7ec62b4920p-41, 0x0.f062f5d8cb0ac8p-47, -0x0.a1799078e2f460p-52, // subrange 3:4 (5..5.25)
+ 0x0.d36d5a4abadb68p-3, -0x0.985075f7d3ffa0p-8, 0x0.d82778b6bf7b78p-14, -0x0.972967c0f1f9b8p-19, 0x0.d07d54b7f08030p-25, -0x0.8ddc2447555ca0p-30, 0x0.be90248ee1dec8p-36, -0x0.fcce3eca4a2f30p-42, 0x0.a5dbe17449c700p-47, -0x0.d6dac3fe785a30p-53, // subrange 3:5 (5.25..5.5)
+ 0x0.ca4fdf5b1ebb08p-3, -0x0.8ba45d80cff968p-8, 0x0.be177bbf488980p-14, -0x0.ff4f150d7eacd8p-20, 0x0.a93e0f1ce88af0p-25, -0x0.dd9730a810cd68p-31, 0x0.8f52b083c59168p-36, -0x0.b73ef380fc3608p-42, 0x0.e7e47d7ccabf90p-48, -0x0.90f88501f80550p-53, // subrange 3:6 (5.5..5.75)
+ 0x0.c1f0d0aa2c9eb0p-3, -0x0.8078514705b868p-8, 0x0.a803293b86fa00p-14, -0x0.d8ffd537c40f30p-20, 0x0.8a748a695058b8p-25, -0x0.aea218aa086de8p-31, 0x0.d9caac0efae4d8p-37, -0x0.86548305c25868p-42, 0x0.a41d1ea106a8b8p-48, -0x0.c63f3d3ab591e8p-54, // subrange 3:7 (5.75..6)
+ 0x0.ba3a0a77fed700p-3, -0x0.ed253f1adf66e8p-9, 0x0.9530c4ed798688p-14, -0x0.b98c21451c05b0p-20, 0x0.e42f6e922db498p-26, -0x0.8aca6e443613b8p-31, 0x0.a70f8f11fb3678p-37, -0x0.c709488575b468p-43, 0x0.eafdd3b1f9e448p-49, -0x0.894110b7347288p-54, // subrange 3:8 (6..6.25)
+ 0x0.b318ae2b837858p-3, -0x0.db87dbb40bc070p-9, 0x0.850d6301435f70p-14, -0x0.9f8b28d607fe18p-20, 0x0.bd4fced6bd9570p-26, -0x0.de5b33802ae008p-32, 0x0.814c10edeaf5c8p-37, -0x0.94ed4efc2a9dd0p-43, 0x0.aa146b293a2738p-49, -0x0.c04d75b805b0e0p-55, // subrange 3:9 (6.25..6.5)
+ 0x0.ac7c8ea62be650p-3, -0x0.cbca303c405828p-9, 0x0.ee47ad11a752c8p-15, -0x0.89e7137825f098p-20, 0x0.9e0f4d2a9bffc0p-26, -0x0.b370c1b16f7de8p-32, 0x0.c9d3b7dda70d08p-38, -0x0.e0f55576781170p-44, 0x0.f8bbaed29c5618p-50, -0x0.883805633cfe00p-55, // subrange 3:10 (6.5..6.75)
+ 0x0.a657ba87d19188p-3, -0x0.bdab1aae612bf8p-9, 0x0.d62be67d83eec8p-15, -0x0.ef9019c0a1c188p-21, 0x0.84c105bf9cd338p-26, -0x0.91d13191dffcb0p-32, 0x0.9ec54107d19fa0p-38, -0x0.ab67b1818d4388p-44, 0x0.b7a598cbb9e080p-50, -0x0.c304a0e3d3b2a8p-56, // subrange 3:11 (6.75..7)
+ 0x0.a09e1d96e6a1a8p-3, -0x0.b0f413d7b9b810p-9, 0x0.c12efab14e6ea0p-15, -0x0.d10a184d4f8fc0p-21, 0x0.e03fa18e8609e0p-27, -0x0.ee8ad771da2528p-33, 0x0.fbaa20bb9797e8p-39, -0x0.83b08d0e14d1b0p-44, 0x0.88d5f495dc5b08p-50, -0x0.8cfdad390c4c88p-56, // subrange 3:12 (7..7.25)
+ 0x0.9b45343327ff70p-3, -0x0.a5773175fdf760p-9, 0x0.aed4a69877d7b8p-15, -0x0.b731503d3f66c0p-21, 0x0.be6614003a9910p-27, -0x0.c4522e1be15918p-33, 0x0.c8dc1dbb201800p-39, -0x0.cbf2543ba581e8p-45, 0x0.cdaea502e2d558p-51, -0x0.cdc956185c5158p-57, // subrange 3:13 (7.25..7.5)
+ 0x0.9643ccf5c095a0p-3, -0x0.9b0d93eca66428p-9, 0x0.9eb6fe0c7f8b30p-15, -0x0.a131a174cde6c8p-21, 0x0.a2760525736768p-27, -0x0.a283a7b6fb45b0p-33, 0x0.a160c4b7b9b2b8p-39, -0x0.9f19e7bee483d0p-45, 0x0.9bda6415acafe8p-51, -0x0.9785efcc747dc8p-57, // subrange 3:14 (7.5..7.75)
+ 0x0.9191d58b2c4e48p-3, -0x0.9196268a9f2be0p-9, 0x0.9081e6ade7c5f8p-15, -0x0.8e613e9280d2b0p-21, 0x0.8b45a2b6260c28p-27, -0x0.87450a52acae38p-33, 0x0.82790a9ef1f1d0p-39, -0x0.f9fbd128c9eef8p-46, 0x0.ee078b17e74cd0p-52, -0x0.e107a91c52a518p-58, // subrange 3:15 (7.75..8)
+ 0x0.8b0c7de3afc500p-3, -0x0.84ec57a3cc1fe0p-8, 0x0.fc61c162a1fbc0p-14, -0x0.edfaa4502fa528p-19, 0x0.dee8fe005d2b88p-24, -0x0.cf6fd69f2c4f60p-29, 0x0.bfcdf8289f02f0p-34, -0x0.b03d0d8afaeb70p-39, 0x0.a14afa66e61430p-44, -0x0.92650b2fbaa628p-49, // subrange 4:0 (8..8.5)
+ 0x0.8334e2c8b360b8p-3, -0x0.ece27690a99d80p-9, 0x0.d484f8cb4f4150p-14, -0x0.bd81130c7adb70p-19, 0x0.a7f97eb658f4b8p-24, -0x0.9404d8a4a71d70p-29, 0x0.81aec406516070p-34, -0x0.e1f2e91d2a9408p-40, 0x0.c42124fec487b0p-45, -0x0.a8f8e68cbac2b0p-50, // subrange 4:1 (8.5..9)
+ 0x0.f864ea4423f0a8p-4, -0x0.d46312b01445d8p-9, 0x0.b4972a231ff3e8p-14, -0x0.98b6fe93e20578p-19, 0x0.80727905067e50p-24, -0x0.d6ed5494934590p-30, 0x0.b2e0a22003d528p-35, -0x0.941c0bc0737420p-40, 0x0.f476f7a36cddc8p-46, -0x0.c861be1425c6e0p-51, // subrange 4:2 (9..9.5)
+ 0x0.ebca3ee3746d78p-4, -0x0.bf7c2f79e8b420p-9, 0x0.9ab941b8347840p-14, -0x0.f8cd20783ef4d0p-20, 0x0.c7107bbc561020p-25, -0x0.9e80f7927e4770p-30, 0x0.fb379b0c50eb40p-36, -0x0.c6262693eb6120p-41, 0x0.9bd2e88c04b420p-46, -0x0.f38f64f2a5dc70p-52, // subrange 4:3 (9.5..10)
+ 0x0.e065cd949adc90p-4, -0x0.ad82cee1a61ea8p-9, 0x0.858d20df815008p-14, -0x0.cca9966d79bb08p-20, 0x0.9c1f2058503110p-25, -0x0.ed243297426858p-31, 0x0.b3529e72307b88p-36, -0x0.87055d002a1d38p-41, 0x0.cac552801ccb18p-47, -0x0.9764e85d8e9b88p-52, // subrange 4:4 (10..10.5)
+ 0x0.d60d13007cb438p-4, -0x0.9df1bdc1125468p-9, 0x0.e81e02860962c0p-15, -0x0.a9dc050156bb68p-20, 0x0.f796f30fcb5ba8p-26, -0x0.b3b8570689b168p-31, 0x0.81efd22c2a0ba8p-36, -0x0.bb26617895d540p-42, 0x0.86701d9136e320p-47, -0x0.c0239dbec4b7c0p-53, // subrange 4:5 (10.5..11)
+ 0x0.cc9cf27b77aa38p-4, -0x0.90600344b7b918p-9, 0x0.caf6f16aa6f2e0p-15, -0x0.8e2081e8c70a98p-20, 0x0.c64eaed41fcd18p-26, -0x0.89d63260a1b598p-31, 0x0.bee94d94621268p-37, -0x0.83bbcffa8c5090p-42, 0x0.b5607a449a71c8p-48, -0x0.f887892f858468p-54, // subrange 4:6 (11..11.5)
+ 0x0.c3f82c3f05b5a0p-4, -0x0.847a03ccaa0768p-9, 0x0.b27b5535fd5de8p-15, -0x0.efa0d0ad4e6d20p-21, 0x0.a04efdae2c1d68p-26, -0x0.d5c26ac4422358p-32, 0x0.8e0931d5eaf030p-37, -0x0.bc20662a5c90f0p-43, 0x0.f8a376edbfb1d8p-49, -0x0.a394253a09fd70p-54, // subrange 4:7 (11.5..12)
+ 0x0.bc0631a2da6f48p-4, -0x0.f3f902cb3c6ea8p-10, 0x0.9dc5bfa01546a8p-15, -0x0.cb671f5e9dcb58p-21, 0x0.82b2e6e9437f60p-26, -0x0.a76f8ebb6f01e0p-32, 0x0.d5d485748e42b8p-38, -0x0.881e49c738e5f8p-43, 0x0.acf40634a9e950p-49, -0x0.dada69b93c11e8p-55, // subrange 4:8 (12..12.5)
+ 0x0.b4b23e3a8814c8p-4, -0x0.e161d6e0d5b880p-10, 0x0.8c237faee2dd70p-15, -0x0.adc120b40cf4f0p-21, 0x0.d6cccfb4768548p-27, -0x0.84623ce14a2648p-32, 0x0.a2b5191bd3ddc0p-38, -0x0.c7675e218adb10p-44, 0x0.f3ec9e58e03ec0p-50, -0x0.949f80a0562f40p-55, // subrange 4:9 (12.5..13)
+ 0x0.adeaa41976ce18p-4, -0x0.d0d539fcf17cc8p-10, 0x0.fa1013fed2bfc8p-16, -0x0.954dcf4e51d200p-21, 0x0.b1cd2946efcb18p-27, -0x0.d32a0cac4fc5a0p-33, 0x0.fa1ce86032da48p-39, -0x0.93ba48974dacf0p-44, 0x0.ae3542a1685f40p-50, -0x0.ccb47e45f44a30p-56, // subrange 4:10 (13..13.5)
+ 0x0.a7a03e85568390p-4, -0x0.c2098efd04ad20p-10, 0x0.e007a3e67ec7a8p-16, -0x0.80ff60fa9312a0p-21, 0x0.942d4df49603b8p-27, -0x0.a9c731c88e2f90p-33, 0x0.c20a60af0b6220p-39, -0x0.dd37ec07701bc0p-45, 0x0.fbcc082e851d18p-51, -0x0.8ed36ffd8e22c0p-56, // subrange 4:11 (13.5..14)
+ 0x0.a1c601daa18b68p-4, -0x0.b4c1b6b9f67c90p-10, 0x0.c97b1d020477f0p-16, -0x0.e00b42c70100a0p-22, 0x0.f88ac463e7dd58p-28, -0x0.8988c606bd2a18p-33, 0x0.97db4455410fc8p-39, -0x0.a747bbe803fea8p-45, 0x0.b7fe2f546f3888p-51, -0x0.c9bf627ec545d0p-57, // subrange 4:12 (14..14.5)
+ 0x0.9c50a1d946b6a0p-4, -0x0.a8ca9b8f561ca0p-10, 0x0.b5da7123543df8p-16, -0x0.c37cd72da235b8p-22, 0x0.d1ad62a16f14c8p-28, -0x0.e066805ae6b448p-34, 0x0.efa16c01ecd150p-40, -0x0.ff56397ed67778p-46, 0x0.87d81a89e18a50p-51, -0x0.901f8df62e51a8p-57, // subrange 4:13 (14.5..15)
+ 0x0.9736494da90b28p-4, -0x0.9df9481f798d88p-10, 0x0.a4b08fa9304468p-16, -0x0.ab54cc25082168p-22, 0x0.b1de8af250dfc0p-28, -0x0.b84648da0a4160p-34, 0x0.be847e975914e0p-40, -0x0.c491b8dd10b890p-46, 0x0.ca8b49c87e9ab0p-52, -0x0.d0217f92b88628p-58, // subrange 4:14 (15..15.5)
+ 0x0.926e5f4ba70f58p-4, -0x0.94296738d09838p-10, 0x0.959dafb9b98310p-16, -0x0.96c97ea95210e8p-22, 0x0.97ab8586678858p-28, -0x0.9842e39f5cfde8p-34, 0x0.988f2597a365d8p-40, -0x0.98904bcaf14208p-46, 0x0.9860b123ea5f20p-52, -0x0.97cd17cc3c8930p-58, // subrange 4:15 (15.5..16)
+ 0x0.902f166dfb6d48p0, 0x0.ee5c53e3577838p-13, -0x0.a71ba215956178p-16, 0x0.cfec779078cbe0p-20, -0x0.f221e073a3fcd0p-24, 0x0.871e81b3daa2f0p-27, -0x0.925d23dffdcf80p-31, 0x0.9b0f4520b2c8e8p-35, -0x0.a343ebb5c30928p-39, 0x0.a7918e77b9b8e0p-43, // subrange 5:0 (16..18)
+ 0x0.903bba74aca298p0, 0x0.ab154b583ac638p-13, -0x0.d6ec281d5f3b80p-17, 0x0.efab9638097cc0p-21, -0x0.fa398dc6159808p-25, 0x0.fa74f1128aec38p-29, -0x0.f36421370d0c20p-33, 0x0.e76556693b2830p-37, -0x0.da3c3be21f6130p-41, 0x0.c924a8cc01ad98p-45, // subrange 5:1 (18..20)
+ 0x0.9044f2e96fe8f0p0, 0x0.fdcc343e8c1218p-14, -0x0.90604abded2780p-17, 0x0.91d8b90ea1ab28p-21, -0x0.89f86297dcca88p-25, 0x0.fa51c9a06b3b80p-30, -0x0.dc857742582340p-34, 0x0.be19b8b7100568p-38, -0x0.a2582b10db2150p-42, 0x0.87be3d7e749af0p-46, // subrange 5:2 (20..22)
+ 0x0.904be1219fc9d8p0, 0x0.c1658a93f7a330p-14, -0x0.c90c73d88e66d0p-18, 0x0.b99b8f13f56938p-22, -0x0.a07e64dbbbdcd0p-26, 0x0.851a70907e3750p-30, -0x0.d670cc5eca48d0p-35, 0x0.a90feffa288928p-39, -0x0.83e749c56d1938p-43, 0x0.c9cef7299f8968p-48, // subrange 5:3 (22..24)
+ 0x0.9051382f6ca870p0, 0x0.96b9d246f961d8p-14, -0x0.903cb2b22f39a8p-18, 0x0.f5304560f7f740p-23, -0x0.c3380f477e9808p-27, 0x0.951937452e3730p-31, -0x0.dd3ed87837e1a8p-36, 0x0.a0ad75de916ba8p-40, -0x0.e6c614586f9908p-45, 0x0.a2abb0a4df2520p-49, // subrange 5:4 (24..26)
+ 0x0.90556baffb7520p0, 0x0.ef770646d12b88p-15, -0x0.d446fee381cf00p-19, 0x0.a72786dd15dde0p-23, -0x0.f6a04506cbde08p-28, 0x0.ae8b895295fa38p-32, -0x0.f0090c9bba6158p-37, 0x0.a192b4354919b8p-41, -0x0.d6f31ee06258a8p-46, 0x0.8c7789a13bdd68p-50, // subrange 5:5 (26..28)
+ 0x0.9058c8f883f330p0, 0x0.c15d36dd1831a8p-15, -0x0.9fa59dc7e8d810p-19, 0x0.ea306c6677fb40p-24, -0x0.a0f0230f2fe0c8p-28, 0x0.d4399fdef14558p-33, -0x0.87f5eb37e10bf0p-37, 0x0.aa8cf1579d2bb8p-42, -0x0.d34ec94c6bdef0p-47, 0x0.80b11643192870p-51, // subrange 5:6 (28..30)
+ 0x0.905b85576b3c08p0, 0x0.9e5f20b82219d8p-15, -0x0.f4b66a6834cab0p-20, 0x0.a7f7feff1b0028p-24, -0x0.d80fd20bd2e318p-29, 0x0.8555d6fbdd7718p-33, -0x0.9fe9a128ace4c8p-38, 0x0.bbc72749622ec0p-43, -0x0.d9b1d95693d2f0p-48, 0x0.f841cfb7332450p-53, // subrange 5:7 (30..32)
+ 0x0.905ec1b8b32d50p0, 0x0.f034a99d6dcb68p-15, -0x0.a943c7396bc8d8p-18, 0x0.d3f4177fa9cbe8p-22, -0x0.f8b6ab8eb4e448p-26, 0x0.8c070a803f3e18p-29, -0x0.993847a2c12d70p-33, 0x0.a42c04ed53c138p-37, -0x0.af1997794fb1e8p-41, 0x0.b6355f9704c138p-45, // subrange 6:0 (32..36)
+ 0x0.9061f05e5e9918p0, 0x0.ac2501bff22208p-15, -0x0.d92540d5dc4748p-19, 0x0.f3645a2a381c88p-23, -0x0.ffac16eed35d18p-27, 0x0.80dec924912910p-30, -0x0.fc8365c0dc2428p-35, 0x0.f244acd27c21f0p-39, -0x0.e6dc4239ad9b28p-43, 0x0.d727ecaf2850f0p-47, // subrange 6:1 (36..40)
+ 0x0.906441d0168890p0, 0x0.ff16700a047578p-16, -0x0.91997a6a5c5f60p-19, 0x0.93b39fa4004dc0p-23, -0x0.8c6e0d666ca950p-27, 0x0.8023adee583658p-31, -0x0.e348c9baf07c90p-36, 0x0.c567cd34dc5e50p-40, -0x0.aa03df3b8ea4a0p-44, 0x0.8f76412c4e3540p-48, // subrange 6:2 (40..44)
+ 0x0.9065ff6f6c3530p0, 0x0.c2377430759738p-16, -0x0.ca783c78385d50p-20, 0x0.bb939f9031f248p-24, -0x0.a2e12ce0a18e40p-28, 0x0.87beb47deaeee0p-32, -0x0.dbebe4476b5f28p-37, 0x0.ae796dd2819ff8p-41, -0x0.89171d3d26cfe8p-45, 0x0.d35aaed8c8ebf8p-50, // subrange 6:3 (44..48)
+ 0x0.90675689690180p0, 0x0.97445b8e81d128p-16, -0x0.9119b2495743a0p-20, 0x0.f76410ce2b2008p-25, -0x0.c5ad0302c95620p-29, 0x0.979a66acfdd9a0p-33, -0x0.e207d32acfb0f0p-38, 0x0.a50761cbfd3948p-42, -0x0.ee71cc6659c518p-47, 0x0.a92c224b5ff320p-51, // subrange 6:4 (48..52)
+ 0x0.9068644f17d938p0, 0x0.f033cbb6a767d8p-17, -0x0.d55df144af0c40p-21, 0x0.a871258163a940p-25, -0x0.f9499a608fe2a8p-30, 0x0.b10f1378e8fa58p-34, -0x0.f47c4185670828p-39, 0x0.a552a0c03728d0p-43, -0x0.dd11a3a0bd0d00p-48, 0x0.91462132ac5c58p-52, // subrange 6:5 (52..56)
+ 0x0.90693c3faf5ad0p0, 0x0.c1e1627b175078p-17, -0x0.a05b842ccf20f8p-21, 0x0.ebc0d235d51f48p-26, -0x0.a271968d35d198p-30, 0x0.d6dfe403e5a390p-35, -0x0.8a252bf7722bc8p-39, 0x0.adfaf6d75b4a00p-44, -0x0.d88493e7f76cd8p-49, 0x0.848157c10d5ac0p-53, // subrange 6:6 (56..60)
+ 0x0.9069ebc7a207a8p0, 0x0.9ebde2c91a9868p-17, -0x0.f5aa7a5f470aa8p-22, 0x0.a8f35c8ca583a8p-26, -0x0.d9d4ba2d6492a0p-31, 0x0.86cac47bdd8c10p-35, -0x0.a2293339c59c70p-40, 0x0.bf14eae1c93a98p-45, -0x0.de6390c34f1f88p-50, 0x0.feb082a69c7368p-55, // subrange 6:7 (60..64)
+ 0x0.906abb516d9b38p0, 0x0.f0ac2cfb61fad0p-17, -0x0.a9d027a5ec9a60p-20, 0x0.d4fbd530d74c20p-24, -0x0.fa6822281da808p-28, 0x0.8d4c9feee9a940p-31, -0x0.9b02a4e79677b8p-35, 0x0.a6927f8340e790p-39, -0x0.b23f6de9996258p-43, 0x0.ba245890b63d90p-47, // subrange 7:0 (64..72)
+ 0x0.906b87561552e0p0, 0x0.ac699809119e40p-17, -0x0.d9b575d1833038p-21, 0x0.f456dc5691c350p-25, -0x0.80886d6af17930p-28, 0x0.81ceaad1c8d3a8p-32, -0x0.fee01171299fb0p-37, 0x0.f51a626824b9d8p-41, -0x0.ea2d87a99cc3f0p-45, 0x0.dade427fb73d88p-49, // subrange 7:1 (72..80)
+ 0x0.906c1be8448068p0, 0x0.ff69a6ee57c4d0p-18, -0x0.91e8a5618d8948p-21, 0x0.942c1c780adb98p-25, -0x0.8d0e79c94ebd08p-29, 0x0.80e6eec94c2c40p-33, -0x0.e50646157fb4d8p-38, 0x0.c74bbf3da91418p-42, -0x0.ac034a44d09138p-46, 0x0.917c58d12f8118p-50, // subrange 7:2 (80..88)
+ 0x0.906c8b716c67f8p0, 0x0.c26c47a24a7748p-18, -0x0.cad406b6afb7f8p-22, 0x0.bc133312095610p-26, -0x0.a37c4d75bc1908p-30, 0x0.886b23cabcf250p-34, -0x0.dd5336f0667c68p-39, 0x0.afddf1a9b1e600p-43, -0x0.8a6e9be08d3d98p-47, 0x0.d5d669c7589ee0p-52, // subrange 7:3 (88..96)
+ 0x0.906ce14d75d2a8p0, 0x0.97672fa2bfa788p-18, -0x0.91516155e49c50p-22, 0x0.f7f27de05cb300p-27, -0x0.c64c5eb081b538p-31, 0x0.983d669a7ac410p-35, -0x0.e34063201dccf0p-40, 0x0.a624c33ecb2090p-44, -0x0.f06b287e589e88p-49, 0x0.aada87057d54d8p-53, // subrange 7:4 (96..104)
+ 0x0.906d24cd4d6968p0, 0x0.f0633738a6f0e8p-19, -0x0.d5a4262e31f088p-23, 0x0.a8c44ac9be73c8p-27, -0x0.f9f5e7df5bb018p-32, 0x0.b1b24994abb798p-36, -0x0.f59e18305c5060p-41, 0x0.a647b4c3b8dc50p-45, -0x0.dea321886a93a8p-50, 0x0.9282d2c9bb5b78p-54, // subrange 7:5 (104..112)
+ 0x0.906d5ad3660920p0, 0x0.c20290af8a3da8p-19, -0x0.a08941cca1eed8p-23, 0x0.ec25b35d9f5160p-28, -0x0.a2d2eab158bb70p-32, 0x0.d78b953372eea0p-37, -0x0.8ab320d8993298p-41, 0x0.aeda82ace14bf0p-46, -0x0.d9d94ce12288c0p-51, 0x0.857b9f834d35b8p-55, // subrange 7:6 (112..120)
+ 0x0.906d86bc6d4b50p0, 0x0.9ed5a974760680p-19, -0x0.f5e7ce41257200p-24, 0x0.a932a1abe48068p-28, -0x0.da46f2800eb358p-33, 0x0.872905b3539528p-37, -0x0.a2bb05ebdca7e0p-42, 0x0.bfebc3b751a1f0p-47, -0x0.df95ba58039160p-52, 0x0.802aad9a3bb148p-56, // subrange 7:7 (120..128)
+ 0x0.906dbaa5fde0d8p0, 0x0.f0ca250e7a2e08p-19, -0x0.a9f365f65a03e0p-22, 0x0.d53e2458b79d08p-26, -0x0.fad54a275f6830p-30, 0x0.8d9ec357a131e8p-33, -0x0.9b7683586d8440p-37, 0x0.a72e2caf895ff8p-41, -0x0.b30c18c97c87d0p-45, 0x0.bb24c415393098p-49, // subrange 8:0 (128..144)
+ 0x0.906dedacdf9ec0p0, 0x0.ac7ac8488478b0p-19, -0x0.d9d9a27e5ac998p-23, 0x0.f493c35d304910p-27, -0x0.80b54893f2f2c0p-30, 0x0.820b1357c7e258p-34, -0x0.ff7895d6c8ead0p-39, 0x0.f5d1c1919ed670p-43, -0x0.eb048cf81070d8p-47, 0x0.dbcf5f476c65a0p-51, // subrange 8:1 (144..160)
+ 0x0.906e12d4c965d8p0, 0x0.ff7e7f426be938p-20, -0x0.91fc7e3fc49288p-23, 0x0.944a5858863260p-27, -0x0.8d36c5f872c248p-31, 0x0.811809b2df2650p-35, -0x0.e5767586c7dd28p-40, 0x0.c7c5cb73fcd110p-44, -0x0.ac8479c6d7abd0p-48, 0x0.91ff7173d51ca0p-52, // subrange 8:2 (160..176)
+ 0x0.906e2eb9298168p0, 0x0.c279821bc22dd8p-20, -0x0.caeb06ee393e08p-24, 0x0.bc333141ab0cf8p-28, -0x0.a3a33d2de0c8d0p-32, 0x0.8896769d196780p-36, -0x0.ddad97b41927f0p-41, 0x0.b037b979eee1f0p-45, -0x0.8ac53a2f6adc10p-49, 0x0.d676f429aab048p-54, // subrange 8:3 (176..192)
+ 0x0.906e4431850718p0, 0x0.976fe7c9cbae70p-20, -0x0.915f541c39f680p-24, 0x0.f816310fb2bcc8p-29, -0x0.c67458050f9250p-33, 0x0.98665296b6fac8p-37, -0x0.e38eee437c8a40p-42, 0x0.a66c8ca614dac0p-46, -0x0.f0ea6cc8b07c18p-51, 0x0.ab470bf3373ae8p-55, // subrange 8:4 (192..208)
+ 0x0.906e551261f818p0, 0x0.f06f15c1618e20p-21, -0x0.d5b5bafd381240p-25, 0x0.a8d92014778988p-29, -0x0.fa211b254d2658p-34, 0x0.b1db3ce228d4a8p-38, -0x0.f5e6dfdc1ac9b8p-43, 0x0.a6854cfe361940p-47, -0x0.df08228b5ee150p-52, 0x0.92d293d6b64ff8p-56, // subrange 8:5 (208..224)
+ 0x0.906e62948779e8p0, 0x0.c20ade748ab4f0p-21, -0x0.a094b57ca22000p-25, 0x0.ec3ef83ed463e8p-30, -0x0.a2eb4f5912b008p-34, 0x0.d7b6a3f1bdb578p-39, -0x0.8ad6c0e17d94e8p-43, 0x0.af12a76f6d93f0p-48, -0x0.da2ef1e8943ce8p-53, 0x0.85ba973fdeece0p-57, // subrange 8:6 (224..240)
+ 0x0.906e6d8f3a1028p0, 0x0.9edb9c836fda80p-21, -0x0.f5f7283fb735c8p-26, 0x0.a94279dceb12a0p-30, -0x0.da63909f885380p-35, 0x0.8740a68dd4a7e8p-39, -0x0.a2df99e47f12e8p-44, 0x0.c021b144660c38p-49, -0x0.dfe2a21ebf4088p-54, 0x0.805f938c517890p-58, // subrange 8:7 (240..256)
+ 0x0.906e81730ba380p0, 0x0.cadf30577433e0p-20, -0x0.873e9fb8c54b90p-22, 0x0.a048fbfc372008p-25, -0x0.b216c554577c38p-28, 0x0.bdf41530aa13d0p-31, -0x0.c4d8e3c9744220p-34, 0x0.c7f790d84b5c58p-37, -0x0.d09a480a9ae7c8p-40, 0x0.cddb987ceac0e8p-43, // subrange 9:0 (256..320)
+ 0x0.906e944fc25db0p0, 0x0.de3b5e2e1ba5d8p-21, -0x0.f26e4ef94eb8c8p-24, 0x0.eb146b14879da0p-27, -0x0.d5b43911f8ec70p-30, 0x0.ba8000e6324558p-33, -0x0.9e30c011919e40p-36, 0x0.837ade68c555e0p-39, -0x0.dd487af6dc0f40p-43, 0x0.b2b75b2e568c30p-46, // subrange 9:1 (320..384)
+ 0x0.906e9f29029770p0, 0x0.86a283992e3230p-21, -0x0.f88dc088b697f8p-25, 0x0.cbf045edf2b5a8p-28, -0x0.9cdf88cc377280p-31, 0x0.e7af573e5e0080p-35, -0x0.a64f18ea5891f8p-38, 0x0.e9ecb483a07d30p-42, -0x0.a53a4b4ec76118p-45, 0x0.e1dd09f4f44248p-49, // subrange 9:2 (384..448)
+ 0x0.906ea5f77cd688p0, 0x0.af490ab5610a10p-22, -0x0.8c3a1f3122a448p-25, 0x0.c76e8d7ab98c20p-29, -0x0.84f3eebc56f890p-32, 0x0.aa2d54bf1325b8p-36, -0x0.d3c11aa95f5248p-40, 0x0.811138bd3508e0p-43, -0x0.9d39a84efc5b78p-47, 0x0.ba49309a2cefb8p-51, // subrange 9:3 (448..512)
+ 0x0.906eac3e45df80p0, 0x0.cae098feccd7b8p-22, -0x0.87403070616c68p-24, 0x0.a04bc45a4683a8p-27, -0x0.b21b19715f1998p-30, 0x0.bdfa3d1d4a5e60p-33, -0x0.c4e115d7888270p-36, 0x0.c801f95c9c6170p-39, -0x0.d0a7cb7e058270p-42, 0x0.cdeb9168a3c3e8p-45, // subrange 10:0 (512..640)
+ 0x0.906eb0f57a8d60p0, 0x0.de3c66a69d8ff0p-23, -0x0.f2702fd28bea30p-26, 0x0.eb17267be65630p-29, -0x0.d5b7b33509d918p-32, 0x0.ba840cab9b5010p-35, -0x0.9e35293d446408p-38, 0x0.837f739fd2d8f8p-41, -0x0.dd5205580ca868p-45, 0x0.b2c0973afa04b8p-48, // subrange 10:1 (640..768)
+ 0x0.906eb3abcd60c0p0, 0x0.86a2f650cfb748p-23, -0x0.f88f2181acd160p-27, 0x0.cbf1f85a08b728p-30, -0x0.9ce15ca1937360p-33, 0x0.e7b2f08012c978p-37, -0x0.a6526b02d2fd68p-40, 0x0.e9f28b363ad160p-44, -0x0.a53f60ad3b7860p-47, 0x0.e1e55ebf9ecb70p-51, // subrange 10:2 (768..896)
+ 0x0.906eb55f6d3580p0, 0x0.af497ae3ea5db0p-24, -0x0.8c3ab4c4349ef0p-27, 0x0.c76fcc9190d7a8p-31, -0x0.84f5188ca006a0p-34, 0x0.aa2f5102380918p-38, -0x0.d3c447b8643618p-42, 0x0.8113a437315060p-45, -0x0.9d3d48807af708p-49, 0x0.ba4e5767a8eb28p-53, // subrange 10:3 (896..1024)
+ 0x0.906eb6f1205190p0, 0x0.cae0f3299d73c8p-24, -0x0.8740949fce0910p-26, 0x0.a04c767565c9d0p-29, -0x0.b21c2e7fd7e7f0p-32, 0x0.bdfbc72545ae58p-35, -0x0.c4e3226fe48a18p-38, 0x0.c804939d756118p-41, -0x0.d0ab2c8caf6d70p-44, 0x0.cdef8fe8164590p-47, // subrange 11:0 (1024..1280)
+ 0x0.906eb81eeded00p0, 0x0.de3ca8c538fc50p-25, -0x0.f270a80a1428a0p-28, 0x0.eb17d5581ceea0p-31, -0x0.d5b891c1af3600p-34, 0x0.ba850fa29a1830p-37, -0x0.9e36438fb4a888p-40, 0x0.838098f6f4d988p-43, -0x0.dd546807ba5a28p-47, 0x0.b2c2e6587ef5c8p-50, // subrange 11:1 (1280..1536)
+ 0x0.906eb8cc82ce20p0, 0x0.86a312fede4730p-25, -0x0.f88f79c08ed978p-29, 0x0.cbf264f61c1f58p-32, -0x0.9ce1d198602a18p-35, 0x0.e7b3d6d417e0a0p-39, -0x0.a6533f8cfec048p-42, 0x0.e9f400eb6ddc38p-46, -0x0.a540a60dbb0a58p-49, 0x0.e1e77403415060p-53, // subrange 11:2 (1536..1792)
+ 0x0.906eb9396ad7a0p0, 0x0.af4996efa8be30p-26, -0x0.8c3ada292d7768p-29, 0x0.c7701c57db92e0p-33, -0x0.84f5630164fa38p-36, 0x0.aa2fd0147e7440p-40, -0x0.d3c512ff0e9cb8p-44, 0x0.81143f1859b7c8p-47, -0x0.9d3e30919a2ce0p-51, 0x0.ba4fa122e514c0p-55, // subrange 11:3 (1792..2048)
+ 0x0.906eb99dd7ac40p0, 0x0.cae109b4614238p-26, -0x0.8740adabc189f0p-28, 0x0.a04ca2fc675380p-31, -0x0.b21c73c3e98d30p-34, 0x0.bdfc29a811bd00p-37, -0x0.c4e3a5974908a8p-40, 0x0.c8053a2fa80448p-43, -0x0.d0ac04d37707d8p-46, 0x0.cdf08f8c3b6e00p-49, // subrange 12:0 (2048..2560)
+ 0x0.906eb9e94b1a20p0, 0x0.de3cb94ce78698p-27, -0x0.f270c61809c798p-30, 0x0.eb18010f5083f8p-33, -0x0.d5b8c96516a080p-36, 0x0.ba855060b41498p-39, -0x0.9e368a24c8f600p-42, 0x0.8380e24d534848p-45, -0x0.dd5500b51becd8p-49, 0x0.b2c37a218604a0p-52, // subrange 12:1 (2560..3072)
+ 0x0.906eba14b05530p0, 0x0.86a31a2a644e18p-27, -0x0.f88f8fd051a330p-31, 0x0.cbf2801d31d818p-34, -0x0.9ce1eed62ab378p-37, 0x0.e7b4106952a5a8p-41, -0x0.a65374afca84b8p-44, 0x0.e9f45e59436950p-48, -0x0.a540f766691b48p-51, 0x0.e1e7f9553977c0p-55, // subrange 12:2 (3072..3584)
+ 0x0.906eba2fea58d0p0, 0x0.af499df29a1710p-28, -0x0.8c3ae3826ef328p-31, 0x0.c7703049779048p-35, -0x0.84f5759ea16238p-38, 0x0.aa2fefd927e278p-42, -0x0.d3c545d0e7c9e0p-46, 0x0.811465d0ce67b0p-49, -0x0.9d3e6a962df4c0p-53, 0x0.ba4ff39231f498p-57, // subrange 12:3 (3584..4096)
+ 0x0.906eba53dcf1d0p0, 0x0.93e61e2857de58p-27, -0x0.b17a75bc2d8df0p-29, 0x0.bd4f6f3abe9728p-31, -0x0.bd57f4e6273d88p-33, 0x0.b5c452700dd9c0p-35, -0x0.a856c25f40ebc0p-37, 0x0.99f6fbec349428p-39, -0x0.a0065c5afc7548p-41, 0x0.8de4da0601ec98p-43, // subrange 13:0 (4096..6144)
+ 0x0.906eba6a802ab8p0, 0x0.d7989830fa5498p-29, -0x0.b8cbee5f8b89c8p-31, 0x0.8ccc2310fa8940p-33, -0x0.c924bf74daad10p-36, 0x0.89ed3d6ad586a0p-38, -0x0.b78e60f4fb48b0p-41, 0x0.efc477dc5344c0p-44, -0x0.a578952fc37e08p-46, 0x0.d1dbde68c86438p-49, // subrange 13:1 (6144..8192)
+ 0x0.906eba7686e0f8p0, 0x0.93e61efd515120p-29, -0x0.b17a77661ee9a8p-31, 0x0.bd4f71e441a558p-33, -0x0.bd57f8a0ecb510p-35, 0x0.b5c45735fd0b90p-37, -0x0.a856c7ffcbd6c8p-39, 0x0.99f7025dc88100p-41, -0x0.a0066518039188p-43, 0x0.8de4e3437bb9e0p-45, // subrange 14:0 (8192..12288)
+ 0x0.906eba7c2faf38p0, 0x0.d79898cf5ffd88p-31, -0x0.b8cbef41d39248p-33, 0x0.8ccc2413960558p-35, -0x0.c924c17a1caad8p-38, 0x0.89ed3f43bf5370p-40, -0x0.b78e641c4cd940p-43, 0x0.efc47d0300c198p-46, -0x0.a57899aaec79a8p-48, 0x0.d1dbe5351b0230p-51, // subrange 14:1 (12288..16384)
+ 0x0.906eba7f315cd0p0, 0x0.93e61f328fae48p-31, -0x0.b17a77d09b41e8p-33, 0x0.bd4f728ea26bb0p-35, -0x0.bd57f98f9e1800p-37, 0x0.b5c4586778e018p-39, -0x0.a856c967ee9cf8p-41, 0x0.99f703fa2d8bf8p-43, -0x0.a00667474573f0p-45, 0x0.8de4e592da4ea8p-47, // subrange 15:0 (16384..24576)
+ 0x0.906eba809b9060p0, 0x0.d79898f6f967f8p-33, -0x0.b8cbef7a6594c0p-35, 0x0.8ccc24543ce4e8p-37, -0x0.c924c1fb6d2bb0p-40, 0x0.89ed3fb9f9c838p-42, -0x0.b78e64e62140b8p-45, 0x0.efc47e4cac2750p-48, -0x0.a5789ac9b6bf80p-50, 0x0.d1dbe6e82fb5e0p-53, // subrange 15:1 (24576..32768)
+ 0x0.906eba815bfbc0p0, 0x0.93e61f3fdf4598p-33, -0x0.b17a77eb3a5808p-35, 0x0.bd4f72b93a9d70p-37, -0x0.bd57f9cb4a7110p-39, 0x0.b5c458b3d7d5b8p-41, -0x0.a856c9c1f74f38p-43, 0x0.99f7046146cfb0p-45, -0x0.a00667d315ee40p-47, 0x0.8de4e626b1f5f8p-49, // subrange 16:0 (32768..49152)
+ 0x0.906eba81b688a8p0, 0x0.d7989900dfc290p-35, -0x0.b8cbef888a1568p-37, 0x0.8ccc2464669cd0p-39, -0x0.c924c21bc14bf8p-42, 0x0.89ed3fd7886588p-44, -0x0.b78e6518965ac8p-47, 0x0.efc47e9f170120p-50, -0x0.a5789b11695160p-52, 0x0.d1dbe754f4e390p-55, // subrange 16:1 (49152..65536)
+ 0x0.906eba81f4c2c8p0, 0x0.ab2decffe3a490p-35, -0x0.ab28300ff2dd28p-36, 0x0.9824aa5af885d8p-37, -0x0.fecc7d5e9eba48p-39, 0x0.cbbf6ebdff8ff0p-40, -0x0.92661a29dfec70p-41, 0x0.dff140b61bf5f8p-43, -0x0.856e4e738f5cb0p-43, 0x0.c44dd104ccda58p-45, // subrange 17:0 (65536..131072)
+ 0x0.906eba820cd540p0, 0x0.ab2ded008ed2e8p-37, -0x0.ab2830110fd4d8p-38, 0x0.9824aa5c74a510p-39, -0x0.fecc7d62280b90p-41, 0x0.cbbf6ec1c121b0p-42, -0x0.92661a2cec38c0p-43, 0x0.dff140bc10e870p-45, -0x0.856e4e79327d70p-45, 0x0.c44dd10e949158p-47, // subrange 18:0 (131072..262144)
+ 0x0.906eba8212d9e0p0, 0x0.ab2ded00b99e78p-39, -0x0.ab2830115712c8p-40, 0x0.9824aa5cd3acd8p-41, -0x0.fecc7d630a5fe0p-43, 0x0.cbbf6ec2b18620p-44, -0x0.92661a2daf4bd0p-45, 0x0.dff140bd8e2510p-47, -0x0.856e4e7a9b45a0p-47, 0x0.c44dd111067f18p-49, // subrange 19:0 (262144..524288)
+ 0x0.906eba82145b08p0, 0x0.ab2ded00c45160p-41, -0x0.ab28301168e240p-42, 0x0.9824aa5ceb6ed0p-43, -0x0.fecc7d6342f4f8p-45, 0x0.cbbf6ec2ed9f38p-46, -0x0.92661a2de01098p-47, 0x0.dff140bded7438p-49, -0x0.856e4e7af577a8p-49, 0x0.c44dd111a2fa88p-51, // subrange 20:0 (524288..1.04858e+06)
+ 0x0.906eba8214bb50p0, 0x0.ab2ded00c6fe18p-43, -0x0.ab2830116d5620p-44, 0x0.9824aa5cf15f48p-45, -0x0.fecc7d63511a38p-47, 0x0.cbbf6ec2fca580p-48, -0x0.92661a2dec41c8p-49, 0x0.dff140be054800p-51, -0x0.856e4e7b0c0430p-51, 0x0.c44dd111ca1960p-53, // subrange 21:0 (1.04858e+06..2.09715e+06)
+ 0x0.906eba8214d360p0, 0x0.ab2ded00c7a948p-45, -0x0.ab2830116e7318p-46, 0x0.9824aa5cf2db68p-47, -0x0.fecc7d6354a390p-49, 0x0.cbbf6ec3006710p-50, -0x0.92661a2def4e10p-51, 0x0.dff140be0b3cf0p-53, -0x0.856e4e7b11a750p-53, 0x0.c44dd111d3e118p-55, // subrange 22:0 (2.09715e+06..4.1943e+06)
+ 0x0.906eba8214d968p0, 0x0.ab2ded00c7d410p-47, -0x0.ab2830116eba58p-48, 0x0.9824aa5cf33a70p-49, -0x0.fecc7d635585e0p-51, 0x0.cbbf6ec3015778p-52, -0x0.92661a2df01128p-53, 0x0.dff140be0cba30p-55, -0x0.856e4e7b131018p-55, 0x0.c44dd111d65308p-57, // subrange 23:0 (4.1943e+06..8.38861e+06)
+ 0x0.906eba8214dae8p0, 0x0.ab2ded00c7dec8p-49, -0x0.ab2830116ecc28p-50, 0x0.9824aa5cf35238p-51, -0x0.fecc7d6355be78p-53, 0x0.cbbf6ec3019390p-54, -0x0.92661a2df041e8p-55, 0x0.dff140be0d1978p-57, -0x0.856e4e7b136a48p-57, 0x0.c44dd111d6ef88p-59, // subrange 24:0 (8.38861e+06..1.67772e+07)
+ 0x0.906eba8214db48p0, 0x0.ab2ded00c7e170p-51, -0x0.ab2830116ed098p-52, 0x0.9824aa5cf35828p-53, -0x0.fecc7d6355cc98p-55, 0x0.cbbf6ec301a2a0p-56, -0x0.92661a2df04e28p-57, 0x0.dff140be0d30f8p-59, -0x0.856e4e7b1380b8p-59, 0x0.c44dd111d71720p-61, // subrange 25:0 (1.67772e+07..3.35544e+07)
+ 0x0.906eba8214db60p0, 0x0.ab2ded00c7e220p-53, -0x0.ab2830116ed1b8p-54, 0x0.9824aa5cf35998p-55, -0x0.fecc7d6355d000p-57, 0x0.cbbf6ec301a700p-58, -0x0.92661a2df051f8p-59, 0x0.dff140be0d31d0p-61, -0x0.856e4e7b1384c8p-61, 0x0.c44dd111d72870p-63, // subrange 26:0 (3.35544e+07..6.71089e+07)
+ 0x0.906eba8214db68p0, 0x0.ab2ded00c7e248p-55, -0x0.ab2830116ed210p-56, 0x0.9824aa5cf35980p-57, -0x0.fecc7d6355cef8p-59, 0x0.cbbf6ec301b1c0p-60, -0x0.92661a2df05f20p-61, 0x0.dff140be0ce178p-63, -0x0.856e4e7b136cd0p-63, 0x0.c44dd111d7a340p-65, // subrange 27:0 (6.71089e+07..1.34218e+08)
+};
+// clang-format on
+//--- End of autogenerated code
+
+//! Computes erfcx(x) for x >= 0 by one lookup and one polynomial of order 9, for any x.
+//! Octave j runs from 2^(j-1) to 2^j, and is divided into 1 to 16 subranges.
+//! In octaves up to j=4, erfcx(x) is tabulated; beyond, x*erfcx(x) is tabulated.
+//! The lowest and highest octave are valid for all arguments below and above.
+
+static inline CERF_INLINE_CONSTEXPR double cerf_inline_erfcx_uniform_kernel(double x) {
+    const int jlo = -55; // first tabulated octave
+    const int jhi = 27;  // last tabulated octave
+    const int jdiv = 5;  // first octave where x*erfcx(x) is tabulated
+
+    int je;
+#ifdef CERF_NO_IEEE754
+    // frexp from math.h returns 0 for x=0, and is unspecified for Inf and NaN.
+    const double xm = cerf_inline_frexp2(x < 0x1p27 ? (x >= 0x1p-56 ? x : 0x1p-56) : 0x1p26, &je);
+#else
+    const double xm = cerf_inline_frexp2(x, &je);
+#endif
+    // Clamp the octave, not the argument, so that the compiler does not branch out
+    // constant results. Inf and NaN end up in the highest octave, where the final division
+    // yields 0 or NaN.
+    const int jc = je < jlo ? jlo : je > jhi ? jhi : je;
+
+    const int n = CerfErfcxUniformOctaves[2 * (jc - jlo) + 1]; // number of subranges in octave
+    const int ip = (int)((2 * n) * xm); // index in octave + n
+    const int lij = CerfErfcxUniformOctaves[2 * (jc - jlo)] + ip - n; // index in lookup table
+    const double t = (4 * n) * xm - (1 + 2 * ip);
+
+    SET_INFO(50, lij);
+
+    // Horner scheme, with array indices instead of pointers so that the compiler can use
+    // gather instructions.
+    double y = CerfErfcxUniformCoeffs[lij * 10 + 9];
+    for (int k = 8; k >= 0; --k)
+        y = y * t + CerfErfcxUniformCoeffs[lij * 10 + k];
+    // Divide unconditionally, to avoid control flow that would prevent vectorization.
+    return y / (je < jdiv ? 1. : x);
+}
+
+//! Computes erfcx(x) by the uniform table path. For x < 0, uses erfcx(x) = 2 exp(x^2) - erfcx(-x).
+
+static inline CERF_INLINE_CONSTEXPR double cerf_inline_erfcx_uniform(double x) {
+    const double y = cerf_inline_erfcx_uniform_kernel(x < 0 ? -x : x);
+    // The test x < -26.7 prevents overflow of x^2, which is not allowed in constant expressions.
+    return x < 0 ? (x < -26.7 ? HUGE_VAL : cerf_inline_2exp_xx(x) - y) : y;
+}
+
+//! Computes erfcx(x) = exp(x^2) erfc(x).
+
+static inline CERF_INLINE_CONSTEXPR double cerf_inline_erfcx(double x) {
+    // Steven G. Johnson, October 2012.
+    // Rewritten for better accuracy by Joachim Wuttke, Sept 2024.
+
+    // Uses the following methods:
+    // - Asymptotic expansion for large positive x,
+    // - Chebyshev polynomials for medium positive x,
+    // - Taylor (Maclaurin) series for small |x|,
+    // - Asymptote 2exp(x^2) for large negative x,
+    // - 2*exp(x^2)-erfcx(-x) for medium negative x.
+
+#ifdef CERF_UNIFORM
+    return cerf_inline_erfcx_uniform(x);
+#else
+
+    const double ax = x < 0 ? -x : x;
+
+    if (ax < .125) {
+        // Use Taylor expansion
+        SET_INFO(10, 15);
+#ifdef CERF_ESTRIN
+        // Split into even and odd terms, evaluated as two independent chains.
+        const double x2 = x * x;
+        return ((((((((+1.9841269841269841e-04) * x2 +
+                      1.3888888888888889e-03) * x2 +
+                     8.3333333333333332e-03) * x2 +
+                    4.1666666666666664e-02) * x2 +
+                   1.6666666666666666e-01) * x2 +
+                  5.0000000000000000e-01) * x2 +
+                 1.0000000000000000e+00) * x
+                - (((((((+5.3440090793734269e-04) * x2 +
+                       3.4736059015927274e-03) * x2 +
+                      1.9104832458760001e-02) * x2 +
+                     8.5971746064419999e-02) * x2 +
+                    3.0090111122547003e-01) * x2 +
+                   7.5225277806367508e-01) * x2 +
+                  1.1283791670955126e+00)) * x +
+            1.0000000000000000e+00;
+#else
+        return ((((((((((((((+1.9841269841269841e-04) * x -
+                            5.3440090793734269e-04) * x +
+                           1.3888888888888889e-03) * x -
+                          3.4736059015927274e-03) * x +
+                         8.3333333333333332e-03) * x -
+                        1.9104832458760001e-02) * x +
+                       4.1666666666666664e-02) * x -
+                      8.5971746064419999e-02) * x +
+                     1.6666666666666666e-01) * x -
+                    3.0090111122547003e-01) * x +
+                   5.0000000000000000e-01) * x -
+                  7.5225277806367508e-01) * x +
+                 1.0000000000000000e+00) * x -
+                1.1283791670955126e+00) * x +
+            1.0000000000000000e+00;
+#endif
+    }
+
+    if (x < 0) {
+        if (x < -26.7) {
+            SET_INFO(20, 1);
+            return HUGE_VAL;
+        }
+        if (x < -6.1) {
+            SET_INFO(21, 1);
+            return cerf_inline_2exp_xx(x);
+        }
+        SET_ALGO(31);
+        return cerf_inline_2exp_xx(x) - cerf_inline_erfcx_cheb(-x);
+    }
+
+    if (x <= 12) {
+        SET_ALGO(30);
+        return cerf_inline_erfcx_cheb(x);
+    }
+
+    /* else */ {
+        // Use asymptotic expansion
+        //
+        // Coefficient are a_0 = 1/sqrt(pi), a_N = (2N-1)!!/2^N/sqrt(pi).
+
+        const double r = 1 / x;
+
+        if (x < 150) {
+            if (x < 23.2) {
+                SET_INFO(40, 11);
+                return (((((((((((+3.6073371500083758e+05) * (r * r) -
+                                 3.7971970000088164e+04) * (r * r) +
+                                4.4672905882456671e+03) * (r * r) -
+                               5.9563874509942218e+02) * (r * r) +
+                              9.1636730015295726e+01) * (r * r) -
+                             1.6661223639144676e+01) * (r * r) +
+                            3.7024941420321507e+00) * (r * r) -
+                           1.0578554691520430e+00) * (r * r) +
+                          4.2314218766081724e-01) * (r * r) -
+                         2.8209479177387814e-01) * (r * r) +
+                        5.6418958354775628e-01) * r;
+            }
+            SET_INFO(40, 7);
+            return (((((((+9.1636730015295726e+01) * (r * r) -
+                         1.6661223639144676e+01) * (r * r) +
+                        3.7024941420321507e+00) * (r * r) -
+                       1.0578554691520430e+00) * (r * r) +
+                      4.2314218766081724e-01) * (r * r) -
+                     2.8209479177387814e-01) * (r * r) +
+                    5.6418958354775628e-01) * r;
+        }
+        if (x < 6.9e7) {
+            SET_INFO(40, 4);
+            return ((((-1.0578554691520430e+00) * (r * r) +
+                      4.2314218766081724e-01) * (r * r) -
+                     2.8209479177387814e-01) * (r * r) +
+                    5.6418958354775628e-01) * r;
+        }
+        SET_INFO(40, 1);
+        // 1-term expansion, important to avoid overflow
+        return 0.56418958354775629 / x;
+    }
+
+#endif // CERF_UNIFORM
+} // cerf_inline_erfcx
+
+/******************************************************************************/
+/*  im_w_of_x                                                                 */
+/******************************************************************************/
+
+//--- The following code is generated by dev/1d/pro_imwofx_chebcoeffs.py; do not edit
+// clang-format off
+alignas(64) static CERF_INLINE_CONST double CerfImwxCoeffs0[288] = {
+        0x0.f6809795a1f940p-1, // x in subrange 0:0 (0.5..0.507812)
+     0x0.f90cbdfc4295b0p-1, // x in subrange 0:1 (0.507812..0.515625)
+     0x0.fb8bf275790688p-1, // x in subrange 0:2 (0.515625..0.523438)
+     0x0.fdfe27cef96d58p-1, // x in subrange 0:3 (0.523438..0.53125)
+     0x0.8031a91434f3e0p0, // x in subrange 0:4 (0.53125..0.539062)
+     0x0.815db3790e2e30p0, // x in subrange 0:5 (0.539062..0.546875)
+     0x0.82832e75cb4998p0, // x in subrange 0:6 (0.546875..0.554688)
+     0x0.83a21610f4a3e8p0, // x in subrange 0:7 (0.554688..0.5625)
+     0x0.84ba66f6eb7810p0, // x in subrange 0:8 (0.5625..0.570312)
+     0x0.85cc1e78e57b08p0, // x in subrange 0:9 (0.570312..0.578125)
+     0x0.86d73a8bd118e8p0, // x in subrange 0:10 (0.578125..0.585938)
+     0x0.87dbb9c722ba30p0, // x in subrange 0:11 (0.585938..0.59375)
+     0x0.88d99b638b7fa8p0, // x in subrange 0:12 (0.59375..0.601562)
+     0x0.89d0df3999e5a8p0, // x in subrange 0:13 (0.601562..0.609375)
+     0x0.8ac185c044c3d8p0, // x in subrange 0:14 (0.609375..0.617188)
+     0x0.8bab900b6122b0p0, // x in subrange 0:15 (0.617188..0.625)
+     0x0.8c8effca036258p0, // x in subrange 0:16 (0.625..0.632812)
+     0x0.8d6bd744cc32c8p0, // x in subrange 0:17 (0.632812..0.640625)
+     0x0.8e42195c21dff0p0, // x in subrange 0:18 (0.640625..0.648438)
+     0x0.8f11c986567790p0, // x in subrange 0:19 (0.648438..0.65625)
+     0x0.8fdaebcdbb5188p0, // x in subrange 0:20 (0.65625..0.664062)
+     0x0.909d84cea28590p0, // x in subrange 0:21 (0.664062..0.671875)
+     0x0.915999b54edcd0p0, // x in subrange 0:22 (0.671875..0.679688)
+     0x0.920f303bd2cf18p0, // x in subrange 0:23 (0.679688..0.6875)
+     0x0.92be4ea7df1e48p0, // x in subrange 0:24 (0.6875..0.695312)
+     0x0.9366fbc881a490p0, // x in subrange 0:25 (0.695312..0.703125)
+     0x0.94093ef3d4ebb0p0, // x in subrange 0:26 (0.703125..0.710938)
+     0x0.94a52004a12580p0, // x in subrange 0:27 (0.710938..0.71875)
+     0x0.953aa757ef1f20p0, // x in subrange 0:28 (0.71875..0.726562)
+     0x0.95c9ddca8dca08p0, // x in subrange 0:29 (0.726562..0.734375)
+     0x0.9652ccb68af728p0, // x in subrange 0:30 (0.734375..0.742188)
+     0x0.96d57df09fe158p0, // x in subrange 0:31 (0.742188..0.75)
+     0x0.9751fbc5922530p0, // x in subrange 0:32 (0.75..0.757812)
+     0x0.97c850f789c528p0, // x in subrange 0:33 (0.757812..0.765625)
+     0x0.983888bb5cd9c8p0, // x in subrange 0:34 (0.765625..0.773438)
+     0x0.98a2aeb5d18d08p0, // x in subrange 0:35 (0.773438..0.78125)
+     0x0.9906cef8d701e0p0, // x in subrange 0:36 (0.78125..0.789062)
+     0x0.9964f600b5c740p0, // x in subrange 0:37 (0.789062..0.796875)
+     0x0.99bd30b1387740p0, // x in subrange 0:38 (0.796875..0.804688)
+     0x0.9a0f8c52cd2218p0, // x in subrange 0:39 (0.804688..0.8125)
+     0x0.9a5c168fa02420p0, // x in subrange 0:40 (0.8125..0.820312)
+     0x0.9aa2dd70b10638p0, // x in subrange 0:41 (0.820312..0.828125)
+     0x0.9ae3ef5ae20690p0, // x in subrange 0:42 (0.828125..0.835938)
+     0x0.9b1f5b0c02e748p0, // x in subrange 0:43 (0.835938..0.84375)
+     0x0.9b552f97d79f68p0, // x in subrange 0:44 (0.84375..0.851562)
+     0x0.9b857c651b8988p0, // x in subrange 0:45 (0.851562..0.859375)
+     0x0.9bb0512a81aa40p0, // x in subrange 0:46 (0.859375..0.867188)
+     0x0.9bd5bdebb2a718p0, // x in subrange 0:47 (0.867188..0.875)
+     0x0.9bf5d2f6490550p0, // x in subrange 0:48 (0.875..0.882812)
+     0x0.9c10a0decc45d0p0, // x in subrange 0:49 (0.882812..0.890625)
+     0x0.9c26387dab7260p0, // x in subrange 0:50 (0.890625..0.898438)
+     0x0.9c36aaec37ae18p0, // x in subrange 0:51 (0.898438..0.90625)
+     0x0.9c4209819f58a0p0, // x in subrange 0:52 (0.90625..0.914062)
+     0x0.9c4865cfea52b0p0, // x in subrange 0:53 (0.914062..0.921875)
+     0x0.9c49d1a0f7eed8p0, // x in subrange 0:54 (0.921875..0.929688)
+     0x0.9c465ef37f1878p0, // x in subrange 0:55 (0.929688..0.9375)
+     0x0.9c3e1ff8113750p0, // x in subrange 0:56 (0.9375..0.945312)
+     0x0.9c31270e205470p0, // x in subrange 0:57 (0.945312..0.953125)
+     0x0.9c1f86c10901f8p0, // x in subrange 0:58 (0.953125..0.960938)
+     0x0.9c0951c52084f8p0, // x in subrange 0:59 (0.960938..0.96875)
+     0x0.9bee9af4c7bdd0p0, // x in subrange 0:60 (0.96875..0.976562)
+     0x0.9bcf754d834840p0, // x in subrange 0:61 (0.976562..0.984375)
+     0x0.9babf3ed1949c8p0, // x in subrange 0:62 (0.984375..0.992188)
+     0x0.9b842a0eb561f8p0, // x in subrange 0:63 (0.992188..1)
+     0x0.9b409da707bdc8p0, // x in subrange 1:0 (1..1.01562)
+     0x0.9ad84498e51b48p0, // x in subrange 1:1 (1.01562..1.03125)
+     0x0.9a60284bea1e98p0, // x in subrange 1:2 (1.03125..1.04688)
+     0x0.99d8e640892d20p0, // x in subrange 1:3 (1.04688..1.0625)
+     0x0.99431c858c84c8p0, // x in subrange 1:4 (1.0625..1.07812)
+     0x0.989f6965c8c7e0p0, // x in subrange 1:5 (1.07812..1.09375)
+     0x0.97ee6b18559c38p0, // x in subrange 1:6 (1.09375..1.10938)
+     0x0.9730bf737216f0p0, // x in subrange 1:7 (1.10938..1.125)
+     0x0.966703a2372610p0, // x in subrange 1:8 (1.125..1.14062)
+     0x0.9591d3dd369a18p0, // x in subrange 1:9 (1.14062..1.15625)
+     0x0.94b1cb2621e680p0, // x in subrange 1:10 (1.15625..1.17188)
+     0x0.93c78306902618p0, // x in subrange 1:11 (1.17188..1.1875)
+     0x0.92d39351f77110p0, // x in subrange 1:12 (1.1875..1.20312)
+     0x0.91d691eaea1d78p0, // x in subrange 1:13 (1.20312..1.21875)
+     0x0.90d1128ba51ca8p0, // x in subrange 1:14 (1.21875..1.23438)
+     0x0.8fc3a691f95600p0, // x in subrange 1:15 (1.23438..1.25)
+     0x0.8eaedcce96a080p0, // x in subrange 1:16 (1.25..1.26562)
+     0x0.8d934157bbd748p0, // x in subrange 1:17 (1.26562..1.28125)
+     0x0.8c715d5f4c79e0p0, // x in subrange 1:18 (1.28125..1.29688)
+     0x0.8b49b70c495b00p0, // x in subrange 1:19 (1.29688..1.3125)
+     0x0.8a1cd157a71158p0, // x in subrange 1:20 (1.3125..1.32812)
+     0x0.88eb2bec7a30e0p0, // x in subrange 1:21 (1.32812..1.34375)
+     0x0.87b5430b6ec690p0, // x in subrange 1:22 (1.34375..1.35938)
+     0x0.867b8f717e2ac8p0, // x in subrange 1:23 (1.35938..1.375)
+     0x0.853e8641d3fc38p0, // x in subrange 1:24 (1.375..1.39062)
+     0x0.83fe98f2d0fa48p0, // x in subrange 1:25 (1.39062..1.40625)
+     0x0.82bc353e188130p0, // x in subrange 1:26 (1.40625..1.42188)
+     0x0.8177c513939db8p0, // x in subrange 1:27 (1.42188..1.4375)
+     0x0.8031ae8f530a50p0, // x in subrange 1:28 (1.4375..1.45312)
+     0x0.fdd4a7e46fd320p-1, // x in subrange 1:29 (1.45312..1.46875)
+     0x0.fb44273a937d38p-1, // x in subrange 1:30 (1.46875..1.48438)
+     0x0.f8b2901f3ded28p-1, // x in subrange 1:31 (1.48438..1.5)
+     0x0.f6208fcd78a0b0p-1, // x in subrange 1:32 (1.5..1.51562)
+     0x0.f38ecbc29d2378p-1, // x in subrange 1:33 (1.51562..1.53125)
+     0x0.f0fde1c8427ee0p-1, // x in subrange 1:34 (1.53125..1.54688)
+     0x0.ee6e680268f288p-1, // x in subrange 1:35 (1.54688..1.5625)
+     0x0.ebe0ed01a75908p-1, // x in subrange 1:36 (1.5625..1.57812)
+     0x0.e955f7d91d0018p-1, // x in subrange 1:37 (1.57812..1.59375)
+     0x0.e6ce0837ea65c8p-1, // x in subrange 1:38 (1.59375..1.60938)
+     0x0.e4499685f332f0p-1, // x in subrange 1:39 (1.60938..1.625)
+     0x0.e1c91403abf210p-1, // x in subrange 1:40 (1.625..1.64062)
+     0x0.df4ceaecb660d8p-1, // x in subrange 1:41 (1.64062..1.65625)
+     0x0.dcd57e9d0fd218p-1, // x in subrange 1:42 (1.65625..1.67188)
+     0x0.da632bb895dfa8p-1, // x in subrange 1:43 (1.67188..1.6875)
+     0x0.d7f64854a6a6f0p-1, // x in subrange 1:44 (1.6875..1.70312)
+     0x0.d58f2423a2f190p-1, // x in subrange 1:45 (1.70312..1.71875)
+     0x0.d32e08a219fce0p-1, // x in subrange 1:46 (1.71875..1.73438)
+     0x0.d0d33945680870p-1, // x in subrange 1:47 (1.73438..1.75)
+     0x0.ce7ef3ab926d60p-1, // x in subrange 1:48 (1.75..1.76562)
+     0x0.cc316fcc2db598p-1, // x in subrange 1:49 (1.76562..1.78125)
+     0x0.c9eae02a1bfe70p-1, // x in subrange 1:50 (1.78125..1.79688)
+     0x0.c7ab7205f3da40p-1, // x in subrange 1:51 (1.79688..1.8125)
+     0x0.c5734d90e1e478p-1, // x in subrange 1:52 (1.8125..1.82812)
+     0x0.c342961fd94a20p-1, // x in subrange 1:53 (1.82812..1.84375)
+     0x0.c1196a5ee9a738p-1, // x in subrange 1:54 (1.84375..1.85938)
+     0x0.bef7e48492c0f0p-1, // x in subrange 1:55 (1.85938..1.875)
+     0x0.bcde1a84f0d5e0p-1, // x in subrange 1:56 (1.875..1.89062)
+     0x0.bacc1e449e7258p-1, // x in subrange 1:57 (1.89062..1.90625)
+     0x0.b8c1fdcb2aeeb8p-1, // x in subrange 1:58 (1.90625..1.92188)
+     0x0.b6bfc37506f5f0p-1, // x in subrange 1:59 (1.92188..1.9375)
+     0x0.b4c57624caa710p-1, // x in subrange 1:60 (1.9375..1.95312)
+     0x0.b2d31973bb14d0p-1, // x in subrange 1:61 (1.95312..1.96875)
+     0x0.b0e8ade1771090p-1, // x in subrange 1:62 (1.96875..1.98438)
+     0x0.af063102b54ce0p-1, // x in subrange 1:63 (1.98438..2)
+     0x0.ac414947ee1a40p-1, // x in subrange 2:0 (2..2.03125)
+     0x0.a8ab9295fed4f8p-1, // x in subrange 2:1 (2.03125..2.0625)
+     0x0.a534eb7e3b5380p-1, // x in subrange 2:2 (2.0625..2.09375)
+     0x0.a1dcd1d3086fb8p-1, // x in subrange 2:3 (2.09375..2.125)
+     0x0.9ea2a8520e24a8p-1, // x in subrange 2:4 (2.125..2.15625)
+     0x0.9b85bb1c734620p-1, // x in subrange 2:5 (2.15625..2.1875)
+     0x0.988543d6be9b98p-1, // x in subrange 2:6 (2.1875..2.21875)
+     0x0.95a06d6fc7ace8p-1, // x in subrange 2:7 (2.21875..2.25)
+     0x0.92d6578f56f418p-1, // x in subrange 2:8 (2.25..2.28125)
+     0x0.902619ae2144b0p-1, // x in subrange 2:9 (2.28125..2.3125)
+     0x0.8d8ec5d9ade0b0p-1, // x in subrange 2:10 (2.3125..2.34375)
+     0x0.8b0f6b27736120p-1, // x in subrange 2:11 (2.34375..2.375)
+     0x0.88a717db0f4838p-1, // x in subrange 2:12 (2.375..2.40625)
+     0x0.8654db43f12918p-1, // x in subrange 2:13 (2.40625..2.4375)
+     0x0.8417c757278650p-1, // x in subrange 2:14 (2.4375..2.46875)
+     0x0.81eef20a34c608p-1, // x in subrange 2:15 (2.46875..2.5)
+     0x0.ffb2ece7e1dab8p-2, // x in subrange 2:16 (2.5..2.53125)
+     0x0.fbaceb7108b058p-2, // x in subrange 2:17 (2.53125..2.5625)
+     0x0.f7ca2f8af6ce50p-2, // x in subrange 2:18 (2.5625..2.59375)
+     0x0.f40917c5ac4e68p-2, // x in subrange 2:19 (2.59375..2.625)
+     0x0.f068123b9841d8p-2, // x in subrange 2:20 (2.625..2.65625)
+     0x0.ece59d238d06b0p-2, // x in subrange 2:21 (2.65625..2.6875)
+     0x0.e9804727a879e0p-2, // x in subrange 2:22 (2.6875..2.71875)
+     0x0.e636af892d3d70p-2, // x in subrange 2:23 (2.71875..2.75)
+     0x0.e3078618b7ced8p-2, // x in subrange 2:24 (2.75..2.78125)
+     0x0.dff18b09a2cc30p-2, // x in subrange 2:25 (2.78125..2.8125)
+     0x0.dcf38ea6d4b7d8p-2, // x in subrange 2:26 (2.8125..2.84375)
+     0x0.da0c70ee998818p-2, // x in subrange 2:27 (2.84375..2.875)
+     0x0.d73b211a959d88p-2, // x in subrange 2:28 (2.875..2.90625)
+     0x0.d47e9d18503ea8p-2, // x in subrange 2:29 (2.90625..2.9375)
+     0x0.d1d5f0f64ae058p-2, // x in subrange 2:30 (2.9375..2.96875)
+     0x0.cf403649197a00p-2, // x in subrange 2:31 (2.96875..3)
+     0x0.ccbc938b77aee0p-2, // x in subrange 2:32 (3..3.03125)
+     0x0.ca4a3b7be73a00p-2, // x in subrange 2:33 (3.03125..3.0625)
+     0x0.c7e86c79fe0ea0p-2, // x in subrange 2:34 (3.0625..3.09375)
+     0x0.c5966fe52e0b98p-2, // x in subrange 2:35 (3.09375..3.125)
+     0x0.c353997e7cddf0p-2, // x in subrange 2:36 (3.125..3.15625)
+     0x0.c11f46ce5872b8p-2, // x in subrange 2:37 (3.15625..3.1875)
+     0x0.bef8de8f72c5a0p-2, // x in subrange 2:38 (3.1875..3.21875)
+     0x0.bcdfd01f567698p-2, // x in subrange 2:39 (3.21875..3.25)
+     0x0.bad392f533d680p-2, // x in subrange 2:40 (3.25..3.28125)
+     0x0.b8d3a61f3b7668p-2, // x in subrange 2:41 (3.28125..3.3125)
+     0x0.b6df8fc6b71e68p-2, // x in subrange 2:42 (3.3125..3.34375)
+     0x0.b4f6dcbaf3ceb0p-2, // x in subrange 2:43 (3.34375..3.375)
+     0x0.b3192002f67510p-2, // x in subrange 2:44 (3.375..3.40625)
+     0x0.b145f275e0c150p-2, // x in subrange 2:45 (3.40625..3.4375)
+     0x0.af7cf259db6858p-2, // x in subrange 2:46 (3.4375..3.46875)
+     0x0.adbdc3094eb118p-2, // x in subrange 2:47 (3.46875..3.5)
+     0x0.ac080c9e28d238p-2, // x in subrange 2:48 (3.5..3.53125)
+     0x0.aa5b7ba2eb06b8p-2, // x in subrange 2:49 (3.53125..3.5625)
+     0x0.a8b7c0c931e528p-2, // x in subrange 2:50 (3.5625..3.59375)
+     0x0.a71c90a56b11b0p-2, // x in subrange 2:51 (3.59375..3.625)
+     0x0.a589a36f6982c0p-2, // x in subrange 2:52 (3.625..3.65625)
+     0x0.a3feb4c789f618p-2, // x in subrange 2:53 (3.65625..3.6875)
+     0x0.a27b83801a9d00p-2, // x in subrange 2:54 (3.6875..3.71875)
+     0x0.a0ffd16abb3bb0p-2, // x in subrange 2:55 (3.71875..3.75)
+     0x0.9f8b63296dc3a0p-2, // x in subrange 2:56 (3.75..3.78125)
+     0x0.9e1e000312aca8p-2, // x in subrange 2:57 (3.78125..3.8125)
+     0x0.9cb771bb0fd670p-2, // x in subrange 2:58 (3.8125..3.84375)
+     0x0.9b57846be46e90p-2, // x in subrange 2:59 (3.84375..3.875)
+     0x0.99fe06647021a0p-2, // x in subrange 2:60 (3.875..3.90625)
+     0x0.98aac807b7a5b0p-2, // x in subrange 2:61 (3.90625..3.9375)
+     0x0.975d9baef469b0p-2, // x in subrange 2:62 (3.9375..3.96875)
+     0x0.9616558dc0d760p-2, // x in subrange 2:63 (3.96875..4)
+     0x0.9436207ec3b2f0p-2, // x in subrange 3:0 (4..4.0625)
+     0x0.91c904bc5f2088p-2, // x in subrange 3:1 (4.0625..4.125)
+     0x0.8f70c05c37b158p-2, // x in subrange 3:2 (4.125..4.1875)
+     0x0.8d2c3e8c27f218p-2, // x in subrange 3:3 (4.1875..4.25)
+     0x0.8afa7e6288e110p-2, // x in subrange 3:4 (4.25..4.3125)
+     0x0.88da90fd350cf0p-2, // x in subrange 3:5 (4.3125..4.375)
+     0x0.86cb97d9f3de80p-2, // x in subrange 3:6 (4.375..4.4375)
+     0x0.84ccc360000ff0p-2, // x in subrange 3:7 (4.4375..4.5)
+     0x0.82dd5193ba1f78p-2, // x in subrange 3:8 (4.5..4.5625)
+     0x0.80fc8ceeb91468p-2, // x in subrange 3:9 (4.5625..4.625)
+     0x0.fe5396aeb5a098p-3, // x in subrange 3:10 (4.625..4.6875)
+     0x0.fac8da6773e4a8p-3, // x in subrange 3:11 (4.6875..4.75)
+     0x0.f757b9292300d8p-3, // x in subrange 3:12 (4.75..4.8125)
+     0x0.f3ff18ea38bcc0p-3, // x in subrange 3:13 (4.8125..4.875)
+     0x0.f0bdf01adab600p-3, // x in subrange 3:14 (4.875..4.9375)
+     0x0.ed93446a311e90p-3, // x in subrange 3:15 (4.9375..5)
+     0x0.ea7e29a8a6f228p-3, // x in subrange 3:16 (5..5.0625)
+     0x0.e77dc0c3e2e530p-3, // x in subrange 3:17 (5.0625..5.125)
+     0x0.e49136d9b06ad0p-3, // x in subrange 3:18 (5.125..5.1875)
+     0x0.e1b7c45f6b9a60p-3, // x in subrange 3:19 (5.1875..5.25)
+     0x0.def0ac5bd06db8p-3, // x in subrange 3:20 (5.25..5.3125)
+     0x0.dc3b3bb1502558p-3, // x in subrange 3:21 (5.3125..5.375)
+     0x0.d996c877488288p-3, // x in subrange 3:22 (5.375..5.4375)
+     0x0.d702b160a983c8p-3, // x in subrange 3:23 (5.4375..5.5)
+     0x0.d47e5d2ec0ad08p-3, // x in subrange 3:24 (5.5..5.5625)
+     0x0.d2093a2f05a700p-3, // x in subrange 3:25 (5.5625..5.625)
+     0x0.cfa2bdc2e40678p-3, // x in subrange 3:26 (5.625..5.6875)
+     0x0.cd4a63f09a0380p-3, // x in subrange 3:27 (5.6875..5.75)
+     0x0.caffaefc5c6d58p-3, // x in subrange 3:28 (5.75..5.8125)
+     0x0.c8c2270905b148p-3, // x in subrange 3:29 (5.8125..5.875)
+     0x0.c69159bfa8c660p-3, // x in subrange 3:30 (5.875..5.9375)
+     0x0.c46cd9fd7193e8p-3, // x in subrange 3:31 (5.9375..6)
+     0x0.c2543f874b40f8p-3, // x in subrange 3:32 (6..6.0625)
+     0x0.c04726c2d206b8p-3, // x in subrange 3:33 (6.0625..6.125)
+     0x0.be45307421d680p-3, // x in subrange 3:34 (6.125..6.1875)
+     0x0.bc4e01801d9398p-3, // x in subrange 3:35 (6.1875..6.25)
+     0x0.ba6142b2d3f1b0p-3, // x in subrange 3:36 (6.25..6.3125)
+     0x0.b87ea089af5e90p-3, // x in subrange 3:37 (6.3125..6.375)
+     0x0.b6a5cb0125d290p-3, // x in subrange 3:38 (6.375..6.4375)
+     0x0.b4d67565a41888p-3, // x in subrange 3:39 (6.4375..6.5)
+     0x0.b31056277620a8p-3, // x in subrange 3:40 (6.5..6.5625)
+     0x0.b15326b1735ed0p-3, // x in subrange 3:41 (6.5625..6.625)
+     0x0.af9ea3423b16e8p-3, // x in subrange 3:42 (6.625..6.6875)
+     0x0.adf28ac7d0e370p-3, // x in subrange 3:43 (6.6875..6.75)
+     0x0.ac4e9ebd6dbf30p-3, // x in subrange 3:44 (6.75..6.8125)
+     0x0.aab2a30b5d7788p-3, // x in subrange 3:45 (6.8125..6.875)
+     0x0.a91e5de8c3b2d0p-3, // x in subrange 3:46 (6.875..6.9375)
+     0x0.a79197bf26aec0p-3, // x in subrange 3:47 (6.9375..7)
+     0x0.a60c1b0fa08dc8p-3, // x in subrange 3:48 (7..7.0625)
+     0x0.a48db4599a7f70p-3, // x in subrange 3:49 (7.0625..7.125)
+     0x0.a3163202f74c60p-3, // x in subrange 3:50 (7.125..7.1875)
+     0x0.a1a5644194d970p-3, // x in subrange 3:51 (7.1875..7.25)
+     0x0.a03b1d060e1140p-3, // x in subrange 3:52 (7.25..7.3125)
+     0x0.9ed72fe7a85850p-3, // x in subrange 3:53 (7.3125..7.375)
+     0x0.9d797211593e40p-3, // x in subrange 3:54 (7.375..7.4375)
+     0x0.9c21ba2fd28ad0p-3, // x in subrange 3:55 (7.4375..7.5)
+     0x0.9acfe0608415b8p-3, // x in subrange 3:56 (7.5..7.5625)
+     0x0.9983be21840978p-3, // x in subrange 3:57 (7.5625..7.625)
+     0x0.983d2e424f4cb0p-3, // x in subrange 3:58 (7.625..7.6875)
+     0x0.96fc0cd554cfe8p-3, // x in subrange 3:59 (7.6875..7.75)
+     0x0.95c037223f6c38p-3, // x in subrange 3:60 (7.75..7.8125)
+     0x0.94898b98f2db38p-3, // x in subrange 3:61 (7.8125..7.875)
+     0x0.9357e9c5311a50p-3, // x in subrange 3:62 (7.875..7.9375)
+     0x0.922b3242de4668p-3, // x in subrange 3:63 (7.9375..8)
+     0x0.9071142cb864c0p-3, // x in subrange 4:0 (8..8.125)
+     0x0.8e33b776b1aee8p-3, // x in subrange 4:1 (8.125..8.25)
+     0x0.8c07fffa2f8798p-3, // x in subrange 4:2 (8.25..8.375)
+     0x0.89ed1ec37f65b0p-3, // x in subrange 4:3 (8.375..8.5)
+     0x0.87e2516af286d0p-3, // x in subrange 4:4 (8.5..8.625)
+     0x0.85e6e12341c7d8p-3, // x in subrange 4:5 (8.625..8.75)
+     0x0.83fa21dd9769f8p-3, // x in subrange 4:6 (8.75..8.875)
+     0x0.821b7180ffafd8p-3, // x in subrange 4:7 (8.875..9)
+     0x0.804a373344f2f0p-3, // x in subrange 4:8 (9..9.125)
+     0x0.fd0bc562ed3f90p-4, // x in subrange 4:9 (9.125..9.25)
+     0x0.f99bd76d1b6ed8p-4, // x in subrange 4:10 (9.25..9.375)
+     0x0.f643a2dd9c4050p-4, // x in subrange 4:11 (9.375..9.5)
+     0x0.f30233ed563cc0p-4, // x in subrange 4:12 (9.5..9.625)
+     0x0.efd6a3c82f1148p-4, // x in subrange 4:13 (9.625..9.75)
+     0x0.ecc017b290b188p-4, // x in subrange 4:14 (9.75..9.875)
+     0x0.e9bdc040155b90p-4, // x in subrange 4:15 (9.875..10)
+     0x0.e6ced899cb45f8p-4, // x in subrange 4:16 (10..10.125)
+     0x0.e3f2a5d2a9edf0p-4, // x in subrange 4:17 (10.125..10.25)
+     0x0.e1287648f76c08p-4, // x in subrange 4:18 (10.25..10.375)
+     0x0.de6fa1137c80c8p-4, // x in subrange 4:19 (10.375..10.5)
+     0x0.dbc7857982b728p-4, // x in subrange 4:20 (10.5..10.625)
+     0x0.d92f8a74b179e8p-4, // x in subrange 4:21 (10.625..10.75)
+     0x0.d6a71e3bf5b010p-4, // x in subrange 4:22 (10.75..10.875)
+     0x0.d42db5d6b3b738p-4, // x in subrange 4:23 (10.875..11)
+     0x0.d1c2ccb795ac50p-4, // x in subrange 4:24 (11..11.125)
+     0x0.cf65e45e5827c0p-4, // x in subrange 4:25 (11.125..11.25)
+     0x0.cd168400061378p-4, // x in subrange 4:26 (11.25..11.375)
+     0x0.cad43835214910p-4, // x in subrange 4:27 (11.375..11.5)
+     0x0.c89e92ad4158a8p-4, // x in subrange 4:28 (11.5..11.625)
+     0x0.c67529e7bc6160p-4, // x in subrange 4:29 (11.625..11.75)
+     0x0.c45798f0f75f00p-4, // x in subrange 4:30 (11.75..11.875)
+     0x0.c2457f2403df60p-4, // x in subrange 4:31 (11.875..12)
+};
+alignas(64) static CERF_INLINE_CONST double CerfImwxCoeffs1[288 * 8] = {
+ 0x0.a4a6a8a1c31838p-8, -0x0.ce3846c4544bd0p-16, -0x0.a1f622978c5010p-26, 0x0.e29f889febb8e8p-33, -0x0.d4954384857bb0p-45, -0x0.929e6374fab2d8p-50, 0x0.e59bb7b81bec50p-61, 0x0.8427afe4a6ca98p-68, // x in subrange 0:0 (0.5..0.507812)
+ 0x0.a16befcc13a438p-8, -0x0.cf209ab38f57e0p-16, -0x0.93d0ac5b2e1b60p-26, 0x0.e2098cc0397de0p-33, -0x0.85a1c2b554aa60p-44, -0x0.90fe37f28635d0p-50, 0x0.f5f2ac485b04e0p-61, 0x0.81428edbee7da8p-68, // x in subrange 0:1 (0.507812..0.515625)
+ 0x0.9e2dc00d21d670p-8, -0x0.cff3be018f17a8p-16, -0x0.85b5a63b86a860p-26, 0x0.e15195d8ca5508p-33, -0x0.a0a83258cf4f70p-44, -0x0.8f41c66274e448p-50, 0x0.82f58a6929b840p-60, 0x0.fc7e406530bdd8p-69, // x in subrange 0:2 (0.515625..0.523438)
+ 0x0.9aec6e06042e28p-8, -0x0.d0b1c1eca8eb00p-16, -0x0.ef4e596125e148p-27, 0x0.e0780c10f04a38p-33, -0x0.bb58b341b09a88p-44, -0x0.8d69b77fee6908p-50, 0x0.8ac09d395fff00p-60, 0x0.f63d2475111d28p-69, // x in subrange 0:3 (0.523438..0.53125)
+ 0x0.97a84e0c8909d0p-8, -0x0.d15abad8ea4a20p-16, -0x0.d34eaaf7be2b70p-27, 0x0.df7d5e08bce2c0p-33, -0x0.d5ae2841fb2078p-44, -0x0.8b76ba64d376b8p-50, 0x0.9258c64528aec8p-60, 0x0.efc43597dfad00p-69, // x in subrange 0:4 (0.53125..0.539062)
+ 0x0.9461b41eb450a8p-8, -0x0.d1eec045ba1600p-16, -0x0.b7705e84817928p-27, 0x0.de6200aff85f90p-33, -0x0.efa3959424b0d8p-44, -0x0.89698445f8af40p-50, 0x0.99bc50d3233570p-60, 0x0.e915ed83d0fe68p-69, // x in subrange 0:5 (0.539062..0.546875)
+ 0x0.9118f3d667c7c0p-8, -0x0.d26decc2e27298p-16, -0x0.9bb782505af8d0p-27, 0x0.dd266f1baab5f8p-33, -0x0.849a10fcd55928p-43, -0x0.8742d02dd8efd0p-50, 0x0.a0e99c2c3da7f8p-60, 0x0.e234d2eaa22e18p-69, // x in subrange 0:6 (0.546875..0.554688)
+ 0x0.8dce605d3867b0p-8, -0x0.d2d85de50725d8p-16, -0x0.802814e1878858p-27, 0x0.dbcb2a5a467c78p-33, -0x0.912d8be642b250p-43, -0x0.85035eb5dc2020p-50, 0x0.a7df1bff5d8d10p-60, 0x0.db23786c45c690p-69, // x in subrange 0:7 (0.554688..0.5625)
+ 0x0.8a824c6072f8d0p-8, -0x0.d32e34398c9700p-16, -0x0.c98c087e6e4df8p-28, 0x0.da50b946865ea0p-33, -0x0.9d89f3019c50f0p-43, -0x0.82abf5be4ff988p-50, 0x0.ae9b58bc938a70p-60, 0x0.d3e47b8703c960p-69, // x in subrange 0:8 (0.5625..0.570312)
+ 0x0.87350a05522b80p-8, -0x0.d36f9339f3aa08p-16, -0x0.932a5a75cd5ed0p-28, 0x0.d8b7a8590df8d8p-33, -0x0.a9ad1093a32370p-43, -0x0.803d6025308130p-50, 0x0.b51cefe7c77de0p-60, 0x0.cc7a838588d6b0p-69, // x in subrange 0:9 (0.570312..0.578125)
+ 0x0.83e6eadd684fd0p-8, -0x0.d39ca13eaecf60p-16, -0x0.ba656afe616da0p-29, 0x0.d7008978df4500p-33, -0x0.b594c21ee600d8p-43, -0x0.fb70daf7bc54e0p-51, 0x0.bb629462ce6ad8p-60, 0x0.c4e8406b6051a0p-69, // x in subrange 0:10 (0.578125..0.585938)
+ 0x0.80983fdb3ebf28p-8, -0x0.d3b5877174bcf0p-16, -0x0.9eb229387b49e0p-30, 0x0.d52bf3cab5ffd0p-33, -0x0.c13ef8d10df488p-43, -0x0.f63be377bf86b8p-51, 0x0.c16b0eaedf82b0p-60, 0x0.bd3069e0550a18p-69, // x in subrange 0:11 (0.585938..0.59375)
+ 0x0.fa92b28e59f068p-9, -0x0.d3ba71bf156000p-16, 0x0.d60dcd59dec618p-32, 0x0.d33a837f5aa9e0p-33, -0x0.cca9b9e91273b8p-43, -0x0.f0dd89f59cd740p-51, 0x0.c7353d25616820p-60, 0x0.b555be1b335f98p-69, // x in subrange 0:12 (0.59375..0.601562)
+ 0x0.f3f50d68d2b578p-9, -0x0.d3ab8ec8d5af98p-16, 0x0.83dcba9955e170p-29, 0x0.d12cd9a0fef798p-33, -0x0.d7d31f1642da38p-43, -0x0.eb57863b13cef0p-51, 0x0.ccc014280ca2d8p-60, 0x0.ad5b00cc6703d0p-69, // x in subrange 0:13 (0.601562..0.609375)
+ 0x0.ed582decaabd38p-9, -0x0.d3890fd5571ee0p-16, 0x0.ebe9faa0169be0p-29, 0x0.cf039bdfb5aff0p-33, -0x0.e2b956d0156218p-43, -0x0.e5ab9715a74920p-51, 0x0.d20a9e48640570p-60, 0x0.a542fa08ed7748p-69, // x in subrange 0:14 (0.609375..0.617188)
+ 0x0.e6bcb02c0e1b70p-9, -0x0.d35328c10f8438p-16, 0x0.a96ded1410e428p-28, 0x0.ccbf745d181c58p-33, -0x0.ed5aa4a6aea3b0p-43, -0x0.dfdb81badd7a58p-51, 0x0.d713fc66878bc0p-60, 0x0.9d107536151888p-69, // x in subrange 0:15 (0.617188..0.625)
+ 0x0.e0232e9022ea38p-9, -0x0.d30a0fee565d00p-16, 0x0.dc5287de1e7948p-28, 0x0.ca6111772b4a58p-33, -0x0.f7b5618c177fc8p-43, -0x0.d9e9112bc65fe0p-51, 0x0.dbdb65c769f0a0p-60, 0x0.94c63ff67f1fe0p-69, // x in subrange 0:16 (0.625..0.632812)
+ 0x0.d98c41c51b5c50p-9, -0x0.d2adfe350c68a8p-16, 0x0.874e2a86868290p-27, 0x0.c7e92592977408p-33, -0x0.80e3fe0b0d1530p-42, -0x0.d3d6159804bd50p-51, 0x0.e060282274e658p-60, 0x0.8c672918d92f58p-69, // x in subrange 0:17 (0.632812..0.640625)
+ 0x0.d2f880a6cc1850p-9, -0x0.d23f2ed1e2a5c8p-16, 0x0.a022848a058390p-27, 0x0.c55866e443f408p-33, -0x0.85c87c5c60edf0p-42, -0x0.cda463c0956ea0p-51, 0x0.e4a1a7a6ab7a98p-60, 0x0.83f5ff88c13400p-69, // x in subrange 0:18 (0.640625..0.648438)
+ 0x0.cc68802dc9cda0p-9, -0x0.d1bddf5545ca28p-16, 0x0.b8a34333e8aae8p-27, 0x0.c2af8f3a6a3130p-33, -0x0.8a8778fcbdbc78p-42, -0x0.c755d45a905a30p-51, 0x0.e89f5ef75dbc60p-60, 0x0.f6eb2284886ee0p-70, // x in subrange 0:19 (0.648438..0.65625)
+ 0x0.c5dcd35d10ca58p-9, -0x0.d12a4f91f35c50p-16, 0x0.d0cd6f2f06b968p-27, 0x0.bfef5bc531ee40p-33, -0x0.8f204c4d6c2278p-42, -0x0.c0ec43721dbdc0p-51, 0x0.ec58df20843668p-60, 0x0.e5d15490ccdf58p-70, // x in subrange 0:20 (0.65625..0.664062)
+ 0x0.bf560b303930c8p-9, -0x0.d084c18b3d9f58p-16, 0x0.e89e28ff730590p-27, 0x0.bd188cdee964c0p-33, -0x0.939259e07b38c8p-42, -0x0.ba698fcdd9e660p-51, 0x0.efcdcf82dd3860p-60, 0x0.d4a4273e40b3a8p-70, // x in subrange 0:21 (0.664062..0.671875)
+ 0x0.b8d4b68a3a40b8p-9, -0x0.cfcd7963038bb0p-16, 0x0.800954b220b810p-26, 0x0.ba2be5d3eb8498p-33, -0x0.97dd10874b07c8p-42, -0x0.b3cf9a52e0a278p-51, 0x0.f2fdedb7e93e38p-60, 0x0.c369249273f490p-70, // x in subrange 0:22 (0.671875..0.679688)
+ 0x0.b2596224beff58p-9, -0x0.cf04bd47621760p-16, 0x0.8b9420d9217b70p-26, 0x0.b72a2caa469e88p-33, -0x0.9bffea5d71c998p-42, -0x0.ad204569b8e430p-51, 0x0.f5e90d6de70110p-60, 0x0.b225cc94d4fe18p-70, // x in subrange 0:23 (0.679688..0.6875)
+ 0x0.abe498800e5de8p-9, -0x0.ce2ad5602415c0p-16, 0x0.96ee2e13da0ad8p-26, 0x0.b41429e935a558p-33, -0x0.9ffa6cd001dd00p-42, -0x0.a65d7464581b70p-51, 0x0.f88f183bf2e3b8p-60, 0x0.a0df935c3eed40p-70, // x in subrange 0:24 (0.6875..0.695312)
+ 0x0.a576e1d388d568p-9, -0x0.cd400bbbf5fb28p-16, 0x0.a2163e1c6c3508p-26, 0x0.b0eaa8607e10e0p-33, -0x0.a3cc28a1379ce0p-42, -0x0.9f890ae573cac0p-51, 0x0.faf00d6e7079c8p-60, 0x0.8f9bdf26973698p-70, // x in subrange 0:25 (0.695312..0.703125)
+ 0x0.9f10c3febd4318p-9, -0x0.cc44ac3d62d3e8p-16, 0x0.ad0b1f6ac0a608p-26, 0x0.adae74efc44688p-33, -0x0.a774b9e8979130p-42, -0x0.98a4ec4956bfc0p-51, 0x0.fd0c01cbe7daa0p-60, 0x0.fcc00cf6675d70p-71, // x in subrange 0:26 (0.703125..0.710938)
+ 0x0.98b2c27b16a660p-9, -0x0.cb3904879fbdf8p-16, 0x0.b7cbad53bfa440p-26, 0x0.aa605e4de83e60p-33, -0x0.aaf3c80f86ad28p-42, -0x0.91b2fb106e2ac0p-51, 0x0.fee31f528348c0p-60, 0x0.da629cb176a240p-71, // x in subrange 0:27 (0.710938..0.71875)
+ 0x0.925d5e4e2437b0p-9, -0x0.ca1d63eb2b3540p-16, 0x0.c256d025004f00p-26, 0x0.a70134d07be6f8p-33, -0x0.ae4905ca678390p-42, -0x0.8ab5184bc18fb8p-51, 0x0.803ad2772e38c8p-59, 0x0.b829d0de5998a8p-71, // x in subrange 0:28 (0.71875..0.726562)
+ 0x0.8c1115fc7d2360p-9, -0x0.c8f21b52457e70p-16, 0x0.ccab7d3cf08470p-26, 0x0.a391ca33649240p-33, -0x0.b174310e488780p-42, -0x0.83ad230b8735f8p-51, 0x0.80e1f3146592b8p-59, 0x0.961fe2cd5caa80p-71, // x in subrange 0:29 (0.726562..0.734375)
+ 0x0.85ce657d410bc8p-9, -0x0.c7b77d2d477a00p-16, 0x0.d6c8b71f78a870p-26, 0x0.a012f160b874e8p-33, -0x0.b4751303309658p-42, -0x0.f939efa00aae70p-52, 0x0.8167256874f3e0p-59, 0x0.e89dbccf0a0c58p-72, // x in subrange 0:30 (0.734375..0.742188)
+ 0x0.ff2b8c5c6c9238p-10, -0x0.c66ddd5edd21a0p-16, 0x0.e0ad8d871f9408p-26, 0x0.9c857e38e8fdc0p-33, -0x0.b74b7ff3182440p-42, -0x0.eb0cdff9ddaca8p-52, 0x0.81caa74ec38a88p-59, 0x0.a5813de5d7ecc0p-72, // x in subrange 0:31 (0.742188..0.75)
+ 0x0.f2cf5d910d6b08p-10, -0x0.c515912828ec98p-16, 0x0.ea591d72b3fef0p-26, 0x0.98ea455b4a7fd0p-33, -0x0.b9f757359e7948p-42, -0x0.dcd6c29ed18058p-52, 0x0.820cc0645dce50p-59, 0x0.c5fb2fd08c4b80p-73, // x in subrange 0:32 (0.75..0.757812)
+ 0x0.e68926ac3751d0p-10, -0x0.c3aeef14d54e00p-16, 0x0.f3ca912f81ba80p-26, 0x0.95421bef0959b8p-33, -0x0.bc7883188b7768p-42, -0x0.ce9b3aadc88348p-52, 0x0.822dc1d2b13418p-59, 0x0.8496b16d3e8220p-74, // x in subrange 0:33 (0.757812..0.765625)
+ 0x0.da59ca4f333ea0p-10, -0x0.c23a4ee7197590p-16, 0x0.fd0120601a14d0p-26, 0x0.918dd76c9c7110p-33, -0x0.becef8c52f62f0p-42, -0x0.c05de1e1ee32e8p-52, 0x0.822e061756c480p-59, -0x0.ffa0b41a40fca0p-75, // x in subrange 0:34 (0.765625..0.773438)
+ 0x0.ce422595f7b630p-10, -0x0.c0b80983b670b0p-16, 0x0.82fe07ffdbdab8p-25, 0x0.8dce4d67c47d30p-33, -0x0.c0fab822b31ea8p-42, -0x0.b2224790b5b550p-52, 0x0.820df0c90c0d90p-59, -0x0.c07b768063e128p-73, // x in subrange 0:35 (0.773438..0.78125)
+ 0x0.c2431005a05780p-10, -0x0.bf2878ddf1bb10p-16, 0x0.875d5931239d48p-25, 0x0.8a04535a273fc8p-33, -0x0.c2fbcbb56c38b8p-42, -0x0.a3ebefae732a00p-52, 0x0.81cdee59fac350p-59, -0x0.9fa5ca74587270p-72, // x in subrange 0:36 (0.78125..0.789062)
+ 0x0.b65d5b7c25b358p-10, -0x0.bd8bf7e3924088p-16, 0x0.8b9e33988f65c8p-25, 0x0.8630be6e9565b0p-33, -0x0.c4d2487b490800p-42, -0x0.95be51d9d95e68p-52, 0x0.816e73d7702ce0p-59, -0x0.de1b4fc3ac21e8p-72, // x in subrange 0:37 (0.789062..0.796875)
+ 0x0.aa91d421551f40p-10, -0x0.bbe2e268e4c1c8p-16, 0x0.8fc04db237df20p-25, 0x0.8254634d0962f0p-33, -0x0.c67e4dc569f138p-42, -0x0.879cd86ea1d3c8p-52, 0x0.80effea7263400p-59, -0x0.8dc6ef4bcc00a0p-71, // x in subrange 0:38 (0.796875..0.804688)
+ 0x0.9ee1405907e6b0p-10, -0x0.ba2d9514cc7af8p-16, 0x0.93c3649cbf27b0p-25, 0x0.fce02bceda64e0p-34, -0x0.c800050efdb6c0p-42, -0x0.f315bf3f428e18p-53, 0x0.80531442409260p-59, -0x0.abf6cb49f26d98p-71, // x in subrange 0:39 (0.804688..0.8125)
+ 0x0.934c60b698ef58p-10, -0x0.b86c6d4ce4daf8p-16, 0x0.97a73c12d623e8p-25, 0x0.f509528e68e2a0p-34, -0x0.c957a1d1777740p-42, -0x0.d71769310e3d08p-53, 0x0.ff3083dc425958p-60, -0x0.c99593e27aaee8p-71, // x in subrange 0:40 (0.8125..0.820312)
+ 0x0.87d3eff1979a50p-10, -0x0.b69fc921b90340p-16, 0x0.9b6b9e63321ec8p-25, 0x0.ed25deb7afb720p-34, -0x0.ca85615635b480p-42, -0x0.bb45294f048690p-53, 0x0.fd8038e66e58b0p-60, -0x0.e69beb4334d028p-71, // x in subrange 0:41 (0.820312..0.828125)
+ 0x0.f8f145b76cbf58p-11, -0x0.b4c8073b15b5f0p-16, 0x0.9f105c66f9f5f0p-25, 0x0.e53771947d7240p-34, -0x0.cb898a85b265c8p-42, -0x0.9fa558de040510p-53, 0x0.fb967fa3d9b368p-60, -0x0.81815fc8573f80p-70, // x in subrange 0:42 (0.828125..0.835938)
+ 0x0.e27650afe6b2e8p-11, -0x0.b2e586c47a3f48p-16, 0x0.a2954d76b27110p-25, 0x0.dd3fa97a44a1a8p-34, -0x0.cc646db454b6a8p-42, -0x0.843e2e3f8b3b30p-53, 0x0.f9749debb128d8p-60, -0x0.8f61a648655ee0p-70, // x in subrange 0:43 (0.835938..0.84375)
+ 0x0.cc3852a5f154c8p-11, -0x0.b0f8a759acd180p-16, 0x0.a5fa4f5db1c3f8p-25, 0x0.d540216cedf3e0p-34, -0x0.cd16646cfda578p-42, -0x0.d22b76eda4c1f0p-54, 0x0.f71be6ceab28c8p-60, -0x0.9ceb8e984804f0p-70, // x in subrange 0:44 (0.84375..0.851562)
+ 0x0.b638917964cc38p-11, -0x0.af01c8f376b0d8p-16, 0x0.a93f464c229500p-25, 0x0.cd3a70c3cbcc40p-34, -0x0.cd9fd139693a10p-42, -0x0.9c63d97e6a4520p-54, 0x0.f48db9f752ac78p-60, -0x0.aa1c06727e4f80p-70, // x in subrange 0:45 (0.851562..0.859375)
+ 0x0.a07847062eb710p-11, -0x0.ad014bd48c74c0p-16, 0x0.ac641cc79f37d8p-25, 0x0.c5302ad0c47648p-34, -0x0.ce011f687e87f8p-42, -0x0.ce621cd0e5fa60p-55, 0x0.f1cb8307b57bf8p-60, -0x0.b6f02473612bc8p-70, // x in subrange 0:46 (0.859375..0.867188)
+ 0x0.8af8a11c43bd80p-11, -0x0.aaf79076a68760p-16, 0x0.af68c39a6e2048p-25, 0x0.bd22de89c72098p-34, -0x0.ce3ac2d2a91c90p-42, -0x0.ca793c5bc6a5d8p-56, 0x0.eed6b8f4c02030p-60, -0x0.c36528a46eab08p-70, // x in subrange 0:47 (0.867188..0.875)
+ 0x0.eb7582f3d5b758p-12, -0x0.a8e4f777cdf2b8p-16, 0x0.b24d31c168de78p-25, 0x0.b51416349eb9e0p-34, -0x0.ce4d379c56dac0p-42, 0x0.a4bf1f57ea33e0p-61, 0x0.ebb0dd5f91ca68p-60, -0x0.cf787cf5050c18p-70, // x in subrange 0:48 (0.875..0.882812)
+ 0x0.c17f7b90b73038p-12, -0x0.a6c9e187e16cc8p-16, 0x0.b5116458974098p-25, 0x0.ad05571534bb50p-34, -0x0.ce3901f6b59c08p-42, 0x0.d1ef236060c500p-56, 0x0.e85b7bed125f78p-60, -0x0.db27b5a0986788p-70, // x in subrange 0:49 (0.882812..0.890625)
+ 0x0.98113f354fc2e0p-12, -0x0.a4a6af565677f8p-16, 0x0.b7b55e86887c28p-25, 0x0.a4f8211e54d8e0p-34, -0x0.cdfeaddecc3700p-42, 0x0.cddcaf148a3318p-55, 0x0.e4d8299c1497a8p-60, -0x0.e67091827664f0p-70, // x in subrange 0:50 (0.890625..0.898438)
+ 0x0.de5991bba75448p-13, -0x0.a27bc1803a4e00p-16, 0x0.ba392966748250p-25, 0x0.9cedeea5017a68p-34, -0x0.cd9ecedb0ac948p-42, 0x0.98974ab886ee10p-54, 0x0.e128841a4dc6e0p-60, -0x0.f150fa5733b2f0p-70, // x in subrange 0:51 (0.898438..0.90625)
+ 0x0.8da7f6c6b4ef70p-13, -0x0.a049787e762e10p-16, 0x0.bc9cd3f12fe098p-25, 0x0.94e8341667c8b8p-34, -0x0.cd19ffb76e5298p-42, 0x0.c96d1e27f899c0p-54, 0x0.dd4e31186c6078p-60, -0x0.fbc704ebe723d8p-70, // x in subrange 0:52 (0.90625..0.914062)
+ 0x0.f8450c38c183c0p-15, -0x0.9e1034945a85f8p-16, 0x0.bee072e4fcc7e8p-25, 0x0.8ce85fb0810068p-34, -0x0.cc70e24053d550p-42, 0x0.f966aaad4a2a38p-54, 0x0.d94add9d95ab48p-60, -0x0.82e8789daf2510p-69, // x in subrange 0:53 (0.914062..0.921875)
+ -0x0.83391fe15964e0p-16, -0x0.9bd055be744f10p-16, 0x0.c10420ac4408c8p-25, 0x0.84efd93d6da200p-34, -0x0.cba41efc174810p-42, 0x0.943d93da624cb0p-53, 0x0.d5203d5a925b30p-60, -0x0.87b6953cbf9bc0p-69, // x in subrange 0:54 (0.921875..0.929688)
+ -0x0.bb7c119f663650p-14, -0x0.998a3ba1afd6c0p-16, 0x0.c307fd43410320p-25, 0x0.fa0003a32bf738p-35, -0x0.cab464e39ab300p-42, 0x0.ab5116523e6748p-53, 0x0.d0d009fcf0e760p-60, -0x0.8c4d2386894a60p-69, // x in subrange 0:55 (0.929688..0.9375)
+ -0x0.a9f0659cd66af0p-13, -0x0.973e457acc0880p-16, 0x0.c4ec2e1cabb470p-25, 0x0.ea34671934d840p-35, -0x0.c9a26919d1d3b0p-42, 0x0.c1e9d90c5da100p-53, 0x0.cc5c0282637950p-60, -0x0.90ab843c1c4fd8p-69, // x in subrange 0:56 (0.9375..0.945312)
+ -0x0.f4fb6414f53030p-13, -0x0.94ecd20e212e90p-16, 0x0.c6b0de056c3640p-25, 0x0.da7f82ba394b38p-35, -0x0.c86ee6a26e99b0p-42, 0x0.d804097d566bd8p-53, 0x0.c7c5ea8c9e37f8p-60, -0x0.94d12d97e95f10p-69, // x in subrange 0:57 (0.945312..0.953125)
+ -0x0.9f6e2e95186ef0p-12, -0x0.92963f97bdfbd0p-16, 0x0.c8563d07632140p-25, 0x0.cae3ed8ed431b0p-35, -0x0.c71a9e17cab840p-42, 0x0.ed9c06b8c03778p-53, 0x0.c30f89b5f97d98p-60, -0x0.98bdab31191808p-69, // x in subrange 0:58 (0.953125..0.960938)
+ -0x0.c3c86c63b09bf8p-12, -0x0.903aebbbdd8e90p-16, 0x0.c9dc804b526860p-25, 0x0.bb642f5e1d34d0p-35, -0x0.c5a655602a6a00p-42, 0x0.815730eb88d238p-52, 0x0.be3aaae71a37f0p-60, -0x0.9c709dd6b18670p-69, // x in subrange 0:59 (0.960938..0.96875)
+ -0x0.e78b46c02d86d0p-12, -0x0.8ddb3377b8f950p-16, 0x0.cb43e1f9f25938p-25, 0x0.ac02c046aa73b0p-35, -0x0.c412d762745820p-42, 0x0.8b9bef24772f78p-52, 0x0.b9491bade14840p-60, -0x0.9fe9bb62b88700p-69, // x in subrange 0:60 (0.96875..0.976562)
+ -0x0.855ad80eadc6f0p-11, -0x0.8b777312b6bc00p-16, 0x0.cc8ca11c3e8440p-25, 0x0.9cc2085d7858a8p-35, -0x0.c260f3ba7a6098p-42, 0x0.959ab90c05efa0p-52, 0x0.b43cab95e136b0p-60, -0x0.a328ce8584e0b0p-69, // x in subrange 0:61 (0.976562..0.984375)
+ -0x0.96a358f3d22848p-11, -0x0.8910060ffa7390p-16, 0x0.cdb7017b0661a8p-25, 0x0.8da45f52bf3140p-35, -0x0.c0917e6ceeb828p-42, 0x0.9f52230aed92c0p-52, 0x0.af172b8297f2f8p-60, -0x0.a62db68972c270p-69, // x in subrange 0:62 (0.984375..0.992188)
+ -0x0.a79eb6291d12d8p-11, -0x0.86a5472056e340p-16, 0x0.cec34b7dcd93a0p-25, 0x0.fd5818397801e0p-36, -0x0.bea54f9b209918p-42, 0x0.a8c0dafc1617f8p-52, 0x0.a9da6d0ba8aa80p-60, -0x0.a8f8670f331858p-69, // x in subrange 0:63 (0.992188..1)
+ -0x0.c08646040f1db0p-10, -0x0.82ffb35504d648p-14, 0x0.d01df9faebaf38p-22, 0x0.d104c2eca09a18p-32, -0x0.bb8f0fa06ea3d0p-37, 0x0.b65bfc040a79f8p-46, 0x0.a1d73835166338p-53, -0x0.acba28a10a62d8p-61, // x in subrange 1:0 (1..1.01562)
+ -0x0.e0a9bb2659e818p-10, -0x0.fc351bcf7a35a8p-15, 0x0.d185db7ff3b300p-22, 0x0.971874aa1b3428p-32, -0x0.b714fd235354a0p-37, 0x0.c77727dd653e40p-46, 0x0.96e89ef0720700p-53, -0x0.b0f349175dd1a8p-61, // x in subrange 1:1 (1.01562..1.03125)
+ -0x0.ff92f5ccc68638p-10, -0x0.f25ca3be22ab58p-15, 0x0.d27b550f2bc4d8p-22, 0x0.bd43eae2f98b98p-33, -0x0.b237e4f2fd22d8p-37, 0x0.d75cc8b345bd60p-46, 0x0.8bbda5f4637478p-53, -0x0.b4468da85dff18p-61, // x in subrange 1:2 (1.03125..1.04688)
+ -0x0.8ea042afde9170p-9, -0x0.e87b495653fb88p-15, 0x0.d3017075fd3d30p-22, 0x0.9efc4b9e2e5b00p-34, -0x0.acff1a8fc69878p-37, 0x0.e6070c600ae2d8p-46, 0x0.806492dba09e78p-53, -0x0.b6b729b5c3c320p-61, // x in subrange 1:3 (1.04688..1.0625)
+ -0x0.9cd8d026dc5590p-9, -0x0.de9631a64d1fc0p-15, 0x0.d31b70cf9dcf18p-22, -0x0.d74b45fa71ca38p-36, -0x0.a7720fbe1ecca0p-37, 0x0.f371ad3f7f79f8p-46, 0x0.e9d6de6a7eba00p-54, -0x0.b84968ea722de8p-61, // x in subrange 1:4 (1.0625..1.07812)
+ -0x0.aa730f93996d40p-9, -0x0.d4b259566d4170p-15, 0x0.d2cccdde6f9270p-22, -0x0.81c071c8ff3670p-33, -0x0.a1984b51194ea8p-37, 0x0.ff99eaac7cdb90p-46, 0x0.d2bfeef2bbb0f0p-54, -0x0.b9029fdfc0efa8p-61, // x in subrange 1:5 (1.07812..1.09375)
+ -0x0.b76f3bb5cb9578p-9, -0x0.cad4924d8a1720p-15, 0x0.d2192f58354580p-22, -0x0.e4d95ecd04b510p-33, -0x0.9b79602788a278p-37, 0x0.853f3fd789ed38p-45, 0x0.bb9f15f9caf7a0p-54, -0x0.b8e91b9b05db40p-61, // x in subrange 1:6 (1.09375..1.10938)
+ -0x0.c3cddb0724d1e0p-9, -0x0.c101818de69ca8p-15, 0x0.d104682abc0810p-22, -0x0.a205ab475dce00p-32, -0x0.951ce4662a7dc8p-37, 0x0.8a0fcbfc0d93d0p-45, 0x0.a48e39eb6a2bc0p-54, -0x0.b80410096a2b28p-61, // x in subrange 1:7 (1.10938..1.125)
+ -0x0.cf8fbcdd6ceda0p-9, -0x0.b73d9d4b039988p-15, 0x0.cf9271be75b1f8p-22, -0x0.cf991e3af6e4d0p-32, -0x0.8e8a68f8ba4ef0p-37, 0x0.8e3f61a462a6d0p-45, 0x0.8da64d3c319268p-54, -0x0.b65b85a0b2a088p-61, // x in subrange 1:8 (1.125..1.14062)
+ -0x0.dab5f66fbecc90p-9, -0x0.ad8d2b3842a4c0p-15, 0x0.cdc7673c529fe0p-22, -0x0.fb17555c10f7b8p-32, -0x0.87c97163022ac8p-37, 0x0.91cf73b32fd790p-45, 0x0.edfe6a102513a8p-55, -0x0.b3f8464beaf6d0p-61, // x in subrange 1:9 (1.14062..1.15625)
+ -0x0.e541dfc274d768p-9, -0x0.a3f43f1015cba8p-15, 0x0.cba780dbf7dcc8p-22, -0x0.923979dff174c8p-31, -0x0.80e16bea3da200p-37, 0x0.94c2185dcb9488p-45, 0x0.c15f6438f1ff30p-55, -0x0.b0e3c9cadf9650p-61, // x in subrange 1:10 (1.15625..1.17188)
+ -0x0.ef35107d498c20p-9, -0x0.9a76b95339ea80p-15, 0x0.c9370f3f376620p-22, -0x0.a5d07552b2de00p-31, -0x0.f3b3543cad96b0p-38, 0x0.971a00e4cb0c98p-45, 0x0.959a98fa96b798p-55, -0x0.ad2821aafea290p-61, // x in subrange 1:11 (1.17188..1.1875)
+ -0x0.f8915caf274de8p-9, -0x0.9118463f406490p-15, 0x0.c67a76df746a78p-22, -0x0.b84c37afb18368p-31, -0x0.e572b3936b3aa0p-38, 0x0.98da70c60195a8p-45, 0x0.d5b105bce87d30p-56, -0x0.a8cfe4ff9ec168p-61, // x in subrange 1:12 (1.1875..1.20312)
+ -0x0.80ac68c18a9120p-8, -0x0.87dc5cfb766f38p-15, 0x0.c3762b915d52f0p-22, -0x0.c9a9778d212468p-31, -0x0.d70efc9b0c22a0p-38, 0x0.9a073479acbcb0p-45, 0x0.827dd03477dcb8p-56, -0x0.a3e61bfeca0f98p-61, // x in subrange 1:13 (1.20312..1.21875)
+ -0x0.84c6d8f4cea6f8p-8, -0x0.fd8c7df6098108p-16, 0x0.c02eac2321a7d8p-22, -0x0.d9e60050250cb8p-31, -0x0.c895d4df080c48p-38, 0x0.9aa497cca16638p-45, 0x0.c78606990a2560p-58, -0x0.9e762ba68ae928p-61, // x in subrange 1:14 (1.21875..1.23438)
+ -0x0.8899399cfb75b8p-8, -0x0.ebb1ef25e49f98p-16, 0x0.bca87e1902f908p-22, -0x0.e900aa203ec110p-31, -0x0.ba14753b0bdf90p-38, 0x0.9ab75be9470af0p-45, -0x0.df1dd8cfaea8b0p-59, -0x0.988bc18d5b2558p-61, // x in subrange 1:15 (1.23438..1.25)
+ -0x0.8c24dce71269e8p-8, -0x0.da2eb785102f98p-16, 0x0.b8e8298bd665b8p-22, -0x0.f6f950feb72650p-31, -0x0.ab979f54551570p-38, 0x0.9a44ad21087960p-45, -0x0.cd2f3ffd632bd0p-57, -0x0.9232bffec22940p-61, // x in subrange 1:16 (1.25..1.26562)
+ -0x0.8f6b2ace916300p-8, -0x0.c9081458d51508p-16, 0x0.b4f2352cc0b570p-22, -0x0.81e8658a92db90p-30, -0x0.9d2b940a76c4f0p-38, 0x0.995218879efb70p-45, -0x0.ae05e1383f4158p-56, -0x0.8b772a836813e0p-61, // x in subrange 1:17 (1.26562..1.28125)
+ -0x0.926d9f6b0ee6e0p-8, -0x0.b842d67d2f7c60p-16, 0x0.b0cb227129ac90p-22, -0x0.87c46f2747f948p-30, -0x0.8edc0ae30eb3d8p-38, 0x0.97e581713ed8a8p-45, -0x0.f20039115bf2c8p-56, -0x0.846512f1f1cd38p-61, // x in subrange 1:18 (1.28125..1.29688)
+ -0x0.952dc93fcb6530p-8, -0x0.a7e3630eaeafe8p-16, 0x0.ac7769e994e730p-22, -0x0.8d121aa768ecb8p-30, -0x0.80b42a725d89d8p-38, 0x0.960516e434a2c0p-45, -0x0.992f353e18d4a8p-55, -0x0.fa110e47c153e0p-62, // x in subrange 1:19 (1.29688..1.3125)
+ -0x0.97ad478e96e5f8p-8, -0x0.97edb46a15ce28p-16, 0x0.a7fb77c5bf87f0p-22, -0x0.91d329ee0bf970p-30, -0x0.e57d03825cb8c0p-39, 0x0.93b7490df35cc0p-45, -0x0.b77f1d5406ae68p-55, -0x0.eadafeceece570p-62, // x in subrange 1:20 (1.3125..1.32812)
+ -0x0.99edc8af5987a0p-8, -0x0.88655b7d658d38p-16, 0x0.a35ba88812e938p-22, -0x0.9609c567167c08p-30, -0x0.ca0a055e02bcd0p-39, 0x0.9102becaee5170p-45, -0x0.d3e1b102096ee0p-55, -0x0.db3f9b8a93b538p-62, // x in subrange 1:21 (1.32812..1.34375)
+ -0x0.9bf1086d7b73e8p-8, -0x0.f29b02cb92c9f0p-17, 0x0.9e9c45ea2db408p-22, -0x0.99b875cb9d11f0p-30, -0x0.af21fa9c0b02c8p-39, 0x0.8dee4b4fe05c10p-45, -0x0.ee4bba8ef86c10p-55, -0x0.cb561c5b9b5950p-62, // x in subrange 1:22 (1.34375..1.35938)
+ -0x0.9db8ce6c568c48p-8, -0x0.d551d2ab780710p-17, 0x0.99c183f3f6b7c0p-22, -0x0.9ce21dbcad4c88p-30, -0x0.94d6386a2e16a0p-39, 0x0.8a80e402579d18p-45, -0x0.835a717546aed0p-54, -0x0.bb352f41282770p-62, // x in subrange 1:23 (1.35938..1.375)
+ -0x0.9f46ec93c91d68p-8, -0x0.b8f3e57d2f7700p-17, 0x0.94cf7e466004a8p-22, -0x0.9f89f33e04e7d0p-30, -0x0.f66d870adc7510p-40, 0x0.86c1968d823a50p-45, -0x0.8e8bcf58d4ab50p-54, -0x0.aaf2dcb92a2978p-62, // x in subrange 1:24 (1.375..1.39062)
+ -0x0.a09d3d85ed8a78p-8, -0x0.9d8537715f13e0p-17, 0x0.8fca359ab585e8p-22, -0x0.a1b3791a021368p-30, -0x0.c4a4992b0ced00p-40, 0x0.82b77f3f5112a8p-45, -0x0.98b88bf093f060p-54, -0x0.9aa46e4c727b70p-62, // x in subrange 1:25 (1.39062..1.40625)
+ -0x0.a1bda31ee72d18p-8, -0x0.83090749f87270p-17, 0x0.8ab58d770901a8p-22, -0x0.a3627837d49ee8p-30, -0x0.946c5c9e74f958p-40, 0x0.fcd37f7224da80p-46, -0x0.a1e08a3f02f7c8p-54, -0x0.8a5e575aca2028p-62, // x in subrange 1:26 (1.40625..1.42188)
+ -0x0.a2aa04ffa0c060p-8, -0x0.d303b80d7b4348p-18, 0x0.85954a18065b10p-22, -0x0.a49af8eca9acf8p-30, -0x0.cbb9b533a54288p-41, 0x0.f3beebfb55a9f0p-46, -0x0.aa04ed3df0ceb8p-54, -0x0.f468406d0fdf50p-63, // x in subrange 1:27 (1.42188..1.4375)
+ -0x0.a3644f2444a608p-8, -0x0.a1e315e1d6e560p-18, 0x0.806d0e90367be8p-22, -0x0.a5613c5033e1b0p-30, -0x0.e42dcc57acee00p-42, 0x0.ea3f67cd1f6940p-46, -0x0.b12808963c66a8p-54, -0x0.d470a7347e5750p-63, // x in subrange 1:28 (1.4375..1.45312)
+ -0x0.a3ee7087234f38p-8, -0x0.e564f7f023d600p-19, 0x0.f680b638eb7260p-23, -0x0.a5b9b59c91be78p-30, -0x0.e0ae2e7f13ab50p-44, 0x0.e062ee0f400a80p-46, -0x0.b74d5041e9b208p-54, -0x0.b4f8dcfcb961c0p-63, // x in subrange 1:29 (1.45312..1.46875)
+ -0x0.a44a59d0a82028p-8, -0x0.8ae5e9c7b3db90p-19, 0x0.ec25175a4822e8p-23, -0x0.a5a903a12c0360p-30, 0x0.d8a5998b7fc9c8p-43, 0x0.d6374211db1ee0p-46, -0x0.bc79473e9b3670p-54, -0x0.9621a49fdc53b0p-63, // x in subrange 1:30 (1.46875..1.48438)
+ -0x0.a479fc14e96218p-8, -0x0.d1227e026b3198p-21, 0x0.e1cdad46b51900p-23, -0x0.a533ea4fb77040p-30, 0x0.848b75738c5598p-41, 0x0.cbc9e0f8fdc7b8p-46, -0x0.c0b16d766ee170p-54, -0x0.f012e615938448p-64, // x in subrange 1:31 (1.48438..1.5)
+ -0x0.a47f479f4c56e8p-8, 0x0.f3ad185c3d2fc8p-22, 0x0.d780978272e9a0p-23, -0x0.a45f4c6a111be8p-30, 0x0.cefa3e157bb398p-41, 0x0.c127f46a1269c0p-46, -0x0.c3fc2d04e82a08p-54, -0x0.b598ba27cf7838p-64, // x in subrange 1:32 (1.5..1.51562)
+ -0x0.a45c2acca35a78p-8, 0x0.dab3ae24770a78p-20, 0x0.cd43a6985e95e8p-23, -0x0.a330255733c3f8p-30, 0x0.8ab23a815eedd0p-40, 0x0.b65e464336f298p-46, -0x0.c660c6fcfb90c0p-54, -0x0.fa1027a1a8bd90p-65, // x in subrange 1:33 (1.51562..1.53125)
+ -0x0.a41290f41940d8p-8, 0x0.b86b14f6c5ef60p-19, 0x0.c31c5abfd09f48p-23, -0x0.a1ab832507e908p-30, 0x0.abdec377119f28p-40, 0x0.ab79356266e0a8p-46, -0x0.c7e73fd47c6cd0p-54, -0x0.8d1ea7c8893760p-65, // x in subrange 1:34 (1.53125..1.54688)
+ -0x0.a3a4615f2ae480p-8, 0x0.ffb275f8bbcb78p-19, 0x0.b90fe2e0d4dd20p-23, -0x0.9fd680bc513420p-30, 0x0.cafeb739caaed8p-40, 0x0.a084ab8075bf18p-46, -0x0.c8984b98220a98p-54, -0x0.92bf210f941958p-67, // x in subrange 1:35 (1.54688..1.5625)
+ -0x0.a3137e50de25f0p-8, 0x0.a19d7acaabf470p-18, 0x0.af231bf37287e0p-23, -0x0.9db6404b7a6ad0p-30, 0x0.e81043374fb880p-40, 0x0.958c1421f25ff0p-46, -0x0.c87d3a0a1908a8p-54, 0x0.fbce502fc3e140p-67, // x in subrange 1:36 (1.5625..1.57812)
+ -0x0.a261c41c548ea0p-8, 0x0.c188a95e88d0d8p-18, 0x0.a55a90b673ea80p-23, -0x0.9b4fe5ec7f04b0p-30, 0x0.8189d647de8030p-39, 0x0.8a9a549e398d80p-46, -0x0.c79fe2cba67878p-54, 0x0.9d8c6d7dfbb5a0p-65, // x in subrange 1:37 (1.57812..1.59375)
+ -0x0.a191084ac76058p-8, 0x0.dfa1f87ec75460p-18, 0x0.9bba79b9dd4c70p-23, -0x0.98a89289af2070p-30, 0x0.8e059b21acb0f0p-39, 0x0.ff738a76853c10p-47, -0x0.c60a91b0c88e50p-54, 0x0.f6e58b2f844a90p-65, // x in subrange 1:38 (1.59375..1.60938)
+ -0x0.a0a318d0eb2b28p-8, 0x0.fbf15cdf48e6d0p-18, 0x0.9246bdb90ae970p-23, -0x0.95c55f0488ef58p-30, 0x0.997d8317ab9038p-39, 0x0.e9e856b616fa20p-47, -0x0.c3c7f35b01b940p-54, 0x0.a569a838f10180p-64, // x in subrange 1:39 (1.60938..1.625)
+ -0x0.9f99bb53aa14e8p-8, 0x0.8b3fbf6bbf1038p-17, 0x0.8902f2403e1f18p-23, -0x0.92ab57a1627b30p-30, 0x0.a3f4848632f638p-39, 0x0.d4a5696bfc76a0p-47, -0x0.c0e302369bff88p-54, 0x0.cc99c286dfaf88p-64, // x in subrange 1:40 (1.625..1.64062)
+ -0x0.9e76ac7c15d9a8p-8, 0x0.97aad59f568fd8p-17, 0x0.ffe4b932747a60p-24, -0x0.8f5f77ba20a430p-30, 0x0.ad6e6ad07c2990p-39, 0x0.bfbbe738735658p-47, -0x0.bd66f3f3b8a258p-54, 0x0.f0f688af5285b8p-64, // x in subrange 1:41 (1.64062..1.65625)
+ -0x0.9d3b9f5a653988p-8, 0x0.a33ee23d727eb0p-17, 0x0.ee2fe5f4e2eb70p-24, -0x0.8be6a5b9bd0678p-30, 0x0.b5efc7abed2140p-39, 0x0.ab3bb86ca49608p-47, -0x0.b95f2792707a90p-54, 0x0.893bebd4ca0e20p-63, // x in subrange 1:42 (1.65625..1.67188)
+ -0x0.9bea3cd7c40db0p-8, 0x0.ae0119e755bd60p-17, 0x0.dcecbbe85422e8p-24, -0x0.8845af61e4c3e0p-30, 0x0.bd7de4351a5330p-39, 0x0.97338579d39f98p-47, -0x0.b4d71417294cb8p-54, 0x0.988ce4594abd88p-63, // x in subrange 1:43 (1.67188..1.6875)
+ -0x0.9a842336b1a060p-8, 0x0.b7f6ed7849ebd8p-17, 0x0.cc1ff42de620d0p-24, -0x0.8481465b8683c8p-30, 0x0.c41eb1e53083b8p-39, 0x0.83b0b53ac59c70p-47, -0x0.afda37fa187160p-54, 0x0.a66e40288f15a8p-63, // x in subrange 1:44 (1.6875..1.70312)
+ -0x0.990ae5a19e2500p-8, 0x0.c12602fb8686f0p-17, 0x0.bbcdb39d6af1a8p-24, -0x0.809dfd12b6e010p-30, 0x0.c9d8bb7d8295e0p-39, 0x0.e17eda03ef2520p-48, -0x0.aa740962b870b8p-54, 0x0.b2e1fcb79a2b10p-63, // x in subrange 1:45 (1.70312..1.71875)
+ -0x0.97800bc76e4f88p-8, 0x0.c9942ed0e9e1d0p-17, 0x0.abf98edb58f4f8p-24, -0x0.f94087bbd0bc60p-31, 0x0.ceb315fdebe4d0p-39, 0x0.bcd524ab064340p-48, -0x0.a4afe73dc232d8p-54, 0x0.bdebe68af279a0p-63, // x in subrange 1:46 (1.71875..1.73438)
+ -0x0.95e51185830fd0p-8, 0x0.d1476d04c93450p-17, 0x0.9ca68ec523cf68p-24, -0x0.f118cce01ecbe0p-31, 0x0.d2b551b99918d0p-39, 0x0.99779c80316de8p-48, -0x0.9e990b3a0795a0p-54, 0x0.c7917babc08d98p-63, // x in subrange 1:47 (1.73438..1.75)
+ -0x0.943b669edb5ae0p-8, 0x0.d845dadeaca188p-17, 0x0.8dd7352aabfaf8p-24, -0x0.e8cd1329d77880p-31, 0x0.d5e76b9c9a99e8p-39, 0x0.eeee4874e940a8p-49, -0x0.983a7cb660be30p-54, 0x0.cfd9ccf9280ec8p-63, // x in subrange 1:48 (1.75..1.76562)
+ -0x0.92846e7fdeb280p-8, 0x0.de95b0aa5cebc8p-17, 0x0.ff1b039722ab70p-25, -0x0.e065526cb05518p-31, 0x0.d851beb3678e10p-39, 0x0.adc4771789f5f8p-49, -0x0.919f04a8bb3d30p-54, 0x0.d6cd5e9957d720p-63, // x in subrange 1:49 (1.76562..1.78125)
+ -0x0.90c1800e58bcc8p-8, 0x0.e43d3bbe3b0d28p-17, 0x0.e395ef1ebc6830p-25, -0x0.d7e92d525ccb70p-31, 0x0.d9fcf604318980p-39, 0x0.df14380ff79fa8p-50, -0x0.8ad1228445bd78p-54, 0x0.dc7607cbdb8b38p-63, // x in subrange 1:50 (1.78125..1.79688)
+ -0x0.8ef3e58528ba18p-8, 0x0.e942d8c16e9678p-17, 0x0.c92143df671c68p-25, -0x0.cf5fee800250e0p-31, 0x0.daf1fec89a7448p-39, 0x0.d14c2229af03e8p-51, -0x0.83db0222afbd98p-54, 0x0.e0ded25c61c868p-63, // x in subrange 1:51 (1.79688..1.8125)
+ -0x0.8d1cdc5b22f618p-8, 0x0.edacee340efe08p-17, 0x0.afbe3517b612f8p-25, -0x0.c6d0864351db08p-31, 0x0.db39fb150a4eb8p-39, -0x0.f45457be1c88a0p-55, -0x0.f98ce5650b9d88p-55, 0x0.e413d9f2779c60p-63, // x in subrange 1:52 (1.8125..1.82812)
+ -0x0.8b3d95349e6e88p-8, 0x0.f181e73b065340p-17, 0x0.976d1dbad02750p-25, -0x0.be4188c2c1b418p-31, 0x0.dade34f98bf6d0p-39, -0x0.e35ed26fbfa430p-51, -0x0.eb39bd55b551e8p-55, 0x0.e6222b77b70938p-63, // x in subrange 1:53 (1.82812..1.84375)
+ -0x0.895733df25d190p-8, 0x0.f4c82eb1097b48p-17, 0x0.802d8c0bba4ac0p-25, -0x0.b5b92cabf279b8p-31, 0x0.d9e81226c14828p-39, -0x0.d571d6b3314798p-50, -0x0.dcce89855cdc10p-55, 0x0.e717a4ca9d6a28p-63, // x in subrange 1:54 (1.84375..1.85938)
+ -0x0.876acf56c09ad0p-8, 0x0.f7862a7da380a8p-17, 0x0.d3fc9ab67302b0p-26, -0x0.ad3d4a5ae718b8p-31, 0x0.d86108202a2f18p-39, -0x0.9971968a6649d8p-49, -0x0.ce5c63d1c37d88p-55, 0x0.e702d4f0ba3240p-63, // x in subrange 1:55 (1.85938..1.875)
+ -0x0.857971d44777c0p-8, 0x0.f9c23732f6e670p-17, 0x0.a9baf3b31802a8p-26, -0x0.a4d35b7461da68p-31, 0x0.d6529103a9b690p-39, -0x0.c501faf9e18778p-49, -0x0.bff3786ff6f0a0p-55, 0x0.e5f2dcf7313f78p-63, // x in subrange 1:56 (1.875..1.89062)
+ -0x0.838418e4362c88p-8, 0x0.fb82a3f28198c8p-17, 0x0.819100dbe71a30p-26, -0x0.9c807aed6fe470p-31, 0x0.d3c620ece9b788p-39, -0x0.ed6dcc6112b1c0p-49, -0x0.b1a2fdbf3ee070p-55, 0x0.e3f751acb03158p-63, // x in subrange 1:57 (1.89062..1.90625)
+ -0x0.818bb5856cec30p-8, 0x0.fccdae98de3580p-17, 0x0.b6f0ca1b374a90p-27, -0x0.94496579f098b0p-31, 0x0.d0c51bf9fb7788p-39, -0x0.895dfb72c12f20p-48, -0x0.a3792df896b7d0p-55, 0x0.e1201e5bfdf798p-63, // x in subrange 1:58 (1.90625..1.92188)
+ -0x0.ff22589ea6df20p-9, 0x0.fda98030302d60p-17, 0x0.dda67eae084288p-28, -0x0.8c327a5bb6b6d8p-31, 0x0.cd58ccf55ae6c8p-39, -0x0.9a7b33b49cca68p-48, -0x0.958342a98bf110p-55, 0x0.dd7d68aa40ec98p-63, // x in subrange 1:59 (1.92188..1.9375)
+ -0x0.fb2aab3da20898p-9, 0x0.fe1c29a89fcd48p-17, 0x0.aae11ec5199ca0p-29, -0x0.843fbc8bbd9698p-31, 0x0.c98a5ca84ccc50p-39, -0x0.aa14e98717acf0p-48, -0x0.87cd71e747e730p-55, 0x0.d91f75b803ac20p-63, // x in subrange 1:60 (1.9375..1.95312)
+ -0x0.f731fb931c9010p-9, 0x0.fe2ba0d607b1b0p-17, -0x0.ab990a3efe7db0p-30, -0x0.f8e9a86da996f0p-32, 0x0.c562c9d76f6a70p-39, -0x0.b832bf25946600p-48, -0x0.f4c5da49789c18p-56, 0x0.d416909fec6180p-63, // x in subrange 1:61 (1.95312..1.96875)
+ -0x0.f339caadee7fa0p-9, 0x0.fdddbdb1b68e40p-17, -0x0.a3877b8ee8f178p-28, -0x0.e9aa210e2f08d8p-32, 0x0.c0eae1ea422918p-39, -0x0.c4dd81f5a519e0p-48, -0x0.da9bc32ab55f68p-56, 0x0.ce72f26a0dedc8p-63, // x in subrange 1:62 (1.96875..1.98438)
+ -0x0.ef43827cede170p-9, 0x0.fd3837deee9aa0p-17, -0x0.8a4fe1c1687500p-27, -0x0.dac6d36704d8f0p-32, 0x0.bc2b3a3d64aa40p-39, -0x0.d01f0e26402d78p-48, -0x0.c12ef408e1a320p-56, 0x0.c844ab86bde590p-63, // x in subrange 1:63 (1.98438..2)
+ -0x0.e9588ac348d848p-8, 0x0.fba7ca43853ee8p-15, -0x0.d845f632d07650p-24, -0x0.c52a29bbb81740p-28, 0x0.b49763eb67cdc8p-34, -0x0.de73fa023fef40p-42, -0x0.9c97c053b9fb50p-49, 0x0.be1bb90e28c310p-55, // x in subrange 2:0 (2..2.03125)
+ -0x0.e186ec1b6f9448p-8, 0x0.f8920c38557340p-15, -0x0.99f842212a95a0p-23, -0x0.a9c802615d0760p-28, 0x0.a9cd68d4fa2e00p-34, -0x0.ed0b400e396328p-42, -0x0.ddcb0c990cac50p-50, 0x0.af3eb8593c7c60p-55, // x in subrange 2:1 (2.03125..2.0625)
+ -0x0.d9d21178a64ac8p-8, 0x0.f47d6aa485d8c8p-15, -0x0.c12bfc76ef7800p-23, -0x0.9021907abbcd28p-28, 0x0.9e717f73abda90p-34, -0x0.f6d865a48b2ab0p-42, -0x0.8a203cd4eecba8p-50, 0x0.9f47a672aff1e0p-55, // x in subrange 2:2 (2.0625..2.09375)
+ -0x0.d2415653f05368p-8, 0x0.ef905ce5fc20f0p-15, -0x0.e22f9378a92148p-23, -0x0.f0928c42b69780p-29, 0x0.92ba8a54304c48p-34, -0x0.fc4af2056d43f8p-42, -0x0.fa82126c19e380p-52, 0x0.8ea35a266657e0p-55, // x in subrange 2:3 (2.09375..2.125)
+ -0x0.cadaed2df23eb8p-8, 0x0.e9eea6247c89d8p-15, -0x0.fd78037090ea28p-23, -0x0.c492d89a7ea8b0p-29, 0x0.86da1248ac0618p-34, -0x0.fdd72e461738b8p-42, 0x0.8ed5e7a04516f0p-55, 0x0.fb69caea29adc0p-56, // x in subrange 2:4 (2.125..2.15625)
+ -0x0.c3a3f5768295d0p-8, 0x0.e3b945c8fa2250p-15, -0x0.89bdf62f4dc5b8p-22, -0x0.9c49f8e33801b8p-29, 0x0.f5f83bb1449610p-35, -0x0.fbf37057bec5c8p-42, 0x0.fc5b4e27a3fa40p-52, 0x0.d9a938f950b658p-56, // x in subrange 2:5 (2.15625..2.1875)
+ -0x0.bca091c3c8dfd0p-8, 0x0.dd0e72ebb2abd0p-15, -0x0.9258ecdf9ad360p-22, -0x0.ef61f7f589b398p-30, 0x0.de8e4ee02ca0d0p-35, -0x0.f715b10c6c9c40p-42, 0x0.e2b56ba696f8f8p-51, 0x0.b89ef8ab538c70p-56, // x in subrange 2:6 (2.1875..2.21875)
+ -0x0.b5d3fe0661bdf8p-8, 0x0.d609a16d661550p-15, -0x0.98c760da3bc630p-22, -0x0.ad6b8ce65e5738p-30, 0x0.c7b85d5c771768p-35, -0x0.efb1714de62a30p-42, 0x0.9b80bd1b00b208p-50, 0x0.98cdd3c3829860p-56, // x in subrange 2:7 (2.21875..2.25)
+ -0x0.af40a5725d28c8p-8, 0x0.cec38f70da5080p-15, -0x0.9d425d73f0add8p-22, -0x0.e4f30c9c1f6808p-31, 0x0.b1adc220886998p-35, -0x0.e635f0541307d0p-42, 0x0.bde51e178e1ec8p-50, 0x0.f542fc8447cb70p-57, // x in subrange 2:8 (2.25..2.28125)
+ -0x0.a8e837df2acbf0p-8, 0x0.c75259f0a78608p-15, -0x0.a000f3c88f2cf0p-22, -0x0.f9141f85353170p-32, 0x0.9c9bac58c1d0d0p-35, -0x0.db0cb283168348p-42, 0x0.d8fc2793714810p-50, 0x0.bcde72c43d0a60p-57, // x in subrange 2:9 (2.28125..2.3125)
+ -0x0.a2cbbe6a7c6108p-8, 0x0.bfc997391ba128p-15, -0x0.a137c9a54fa8b8p-22, -0x0.83d4cfd5a34fa0p-33, 0x0.88a5b781330768p-35, -0x0.ce9856bc7b43c8p-42, 0x0.ed4cc650554198p-50, 0x0.88edd2423c9cd0p-57, // x in subrange 2:10 (2.3125..2.34375)
+ -0x0.9cebaf33aa0938p-8, 0x0.b83a761dfcd718p-15, -0x0.a118c05f3b82a8p-22, 0x0.ba179a4b6606e8p-33, 0x0.ebcd37f5435760p-36, -0x0.c133b65dfd75d8p-42, 0x0.fb6b5a4e486190p-50, 0x0.b3921903a43b88p-58, // x in subrange 2:11 (2.34375..2.375)
+ -0x0.9748000e1b4740p-8, 0x0.b0b3e0d7354be0p-15, -0x0.9fd2b1ddb15438p-22, 0x0.e55f7c3c884cd0p-32, 0x0.c8e1e2a1a63048p-36, -0x0.b3314ae4bc71c8p-42, 0x0.81fa78ee028148p-49, 0x0.be8eb8ab272258p-59, // x in subrange 2:12 (2.375..2.40625)
+ -0x0.91e038118962b8p-8, 0x0.a942a2852cd1d8p-15, -0x0.9d9141f49d3340p-22, 0x0.ac5a1ac84b5688p-31, 0x0.a89ff7e2302170p-36, -0x0.a4dad3338d9518p-42, 0x0.83c57cc347bbf8p-49, 0x0.a90b4d653fa600p-61, // x in subrange 2:13 (2.40625..2.4375)
+ -0x0.8cb37ff68cfac8p-8, 0x0.a1f18e75059518p-15, -0x0.9a7cc20d4a7458p-22, 0x0.dc5bbc7a3d2420p-31, 0x0.8b1101520230c0p-36, -0x0.967131cb712cb0p-42, 0x0.8367b57ea46588p-49, -0x0.abcaebcf2ea120p-60, // x in subrange 2:14 (2.4375..2.46875)
+ -0x0.87c0b134c594b0p-8, 0x0.9ac9a85562a2b0p-15, -0x0.96ba250e1d4ca8p-22, 0x0.81c646c896bd40p-30, 0x0.e06663ad3ec190p-37, -0x0.882c7cd8c53450p-42, 0x0.8130c0335d8ba8p-49, -0x0.c271509de9c870p-59, // x in subrange 2:15 (2.46875..2.5)
+ -0x0.830663de017920p-8, 0x0.93d24ca533b400p-15, -0x0.926b016f6eec20p-22, 0x0.91612ca3d70cf8p-30, 0x0.aff60e1a95f1c8p-37, -0x0.f4787190f2ac90p-43, 0x0.fadaed8597acb0p-50, -0x0.8e1c3ba93613d8p-58, // x in subrange 2:16 (2.5..2.53125)
+ -0x0.fd05f66e3acdf0p-9, 0x0.8d1158beac63d8p-15, -0x0.8dad9f7485be98p-22, 0x0.9d67013ed79080p-30, 0x0.84a9b8a2e72740p-37, -0x0.d98f6c3e1cc748p-43, 0x0.f0cd9c79ddfd40p-50, -0x0.b229816605ed98p-58, // x in subrange 2:17 (2.53125..2.5625)
+ -0x0.f4696227c37910p-9, 0x0.868b51f8965780p-15, -0x0.889d1191803a10p-22, 0x0.a63c9ab3e3bc48p-30, 0x0.bc99a5aa7afad0p-38, -0x0.bfdd16ffab3768p-43, 0x0.e4c1e8e71b0a70p-50, -0x0.ce050625a25a28p-58, // x in subrange 2:18 (2.5625..2.59375)
+ -0x0.ec333ffde8bbb0p-9, 0x0.80438b6f32ad00p-15, -0x0.8351552054b490p-22, 0x0.ac424683ef5940p-30, 0x0.f28141dcbf8078p-39, -0x0.a7924a5b704800p-43, 0x0.d73551d7e06a68p-50, -0x0.e264b2e8057460p-58, // x in subrange 2:19 (2.59375..2.625)
+ -0x0.e45f98742a80d0p-9, 0x0.f47894371f7100p-16, -0x0.fbbef34c4d6890p-23, 0x0.afd312073d92b0p-30, 0x0.fae9e03f7f9328p-40, -0x0.90d2c78fbaba10p-43, 0x0.c89998d4faeba0p-50, -0x0.f0094df4e5e2b8p-58, // x in subrange 2:20 (2.625..2.65625)
+ -0x0.dcea574aa580f0p-9, 0x0.e8edcde8b04e50p-16, -0x0.f0b39a1b3ac528p-23, 0x0.b14443ef608280p-30, 0x0.c6e178df9abaa8p-42, -0x0.f76d125098a1f0p-44, 0x0.b954434da2a088p-50, -0x0.f7b8b20d51ca58p-58, // x in subrange 2:21 (2.65625..2.6875)
+ -0x0.d5cf593b7fef50p-9, 0x0.dde7ddcb09be58p-16, -0x0.e5a016c2734aa8p-23, 0x0.b0e501ef8c4b30p-30, -0x0.f22495ebfc6008p-41, -0x0.d0963921cb6150p-44, 0x0.a9be7292c0e5f8p-50, -0x0.fa38c5e6b5af38p-58, // x in subrange 2:22 (2.6875..2.71875)
+ -0x0.cf0a77cb111968p-9, 0x0.d36680f9d08d38p-16, -0x0.da9f2171456508p-23, 0x0.aefe1d7e18cfc0p-30, -0x0.8401df4922bd78p-39, -0x0.ad29f7addd5088p-44, 0x0.9a25063e0809e0p-50, -0x0.f84b3740855198p-58, // x in subrange 2:23 (2.71875..2.75)
+ -0x0.c897935023a9d0p-9, 0x0.c9684e706607d0p-16, -0x0.cfc71868c3c470p-23, 0x0.abd202a0f18bc0p-30, -0x0.bed52e5a0a60e0p-39, -0x0.8d21c042965bd8p-44, 0x0.8ac8fcd7e2cc90p-50, -0x0.f2a9f72144fc28p-58, // x in subrange 2:24 (2.75..2.78125)
+ -0x0.c2729b5a7f95a8p-9, 0x0.bfeae8dbae7c60p-16, -0x0.c52a66173bbf50p-23, 0x0.a79cc3d19e56e0p-30, -0x0.ee454b58237628p-39, -0x0.e0d41adb35a188p-45, 0x0.f7c00dbc7ad920p-51, -0x0.ea046ff6ca87d8p-58, // x in subrange 2:25 (2.78125..2.8125)
+ -0x0.bc97959df8a950p-9, 0x0.b6eb2baa339e38p-16, -0x0.bad7e5ac8b7d18p-23, 0x0.a2943e379378f0p-30, -0x0.89c58776d78610p-38, -0x0.adc98ec1fa5b68p-45, 0x0.db2a81c521e310p-51, -0x0.defd6a78585b88p-58, // x in subrange 2:26 (2.8125..2.84375)
+ -0x0.b702a387ae4de0p-9, 0x0.ae65537586ad20p-16, -0x0.b0db44c64093b8p-23, 0x0.9ce851bbd38578p-30, -0x0.97e9338db09d30p-38, -0x0.80d6fa999d3588p-45, 0x0.c0141480caebe8p-51, -0x0.d2299337f4c018p-58, // x in subrange 2:27 (2.84375..2.875)
+ -0x0.b1b006a21436f0p-9, 0x0.a65521eeae6778p-16, -0x0.a73d6117b4dfc8p-23, 0x0.96c328cb2a41c8p-30, -0x0.a21bcc7b540a18p-38, -0x0.b345b5f359fd40p-46, 0x0.a6adddc0b72420p-51, -0x0.c40e90bcf4fa48p-58, // x in subrange 2:28 (2.875..2.90625)
+ -0x0.ac9c23eadc25d0p-9, 0x0.9eb5fd83358260p-16, -0x0.9e04a132355488p-23, 0x0.90498bf84907b0p-30, -0x0.a8e29dd7f62848p-38, -0x0.df2ac81912ac78p-47, 0x0.8f193712da7ec8p-51, -0x0.b52298b915f468p-58, // x in subrange 2:29 (2.90625..2.9375)
+ -0x0.a7c3863c06c370p-9, 0x0.97830cf95c70f0p-16, -0x0.953547cb1f35f8p-23, 0x0.899b3e111f81c0p-30, -0x0.acb96c70da40b0p-38, -0x0.d732174d481228p-48, 0x0.f2d35579fcc348p-52, -0x0.a5cc7255288818p-58, // x in subrange 2:30 (2.9375..2.96875)
+ -0x0.a322dfe7526a00p-9, 0x0.90b74f484e0090p-16, -0x0.8cd1c1118534d0p-23, 0x0.82d35d9fadbec8p-30, -0x0.ae120ef295df30p-38, -0x0.a2985e36e2f378p-51, 0x0.cb4db91c2dd0f8p-52, -0x0.9663d399a0d3c0p-58, // x in subrange 2:31 (2.96875..3)
+ -0x0.9eb70ba105f6c0p-9, 0x0.8a4daff54d3cb8p-16, -0x0.84dae9d2413fd8p-23, 0x0.f8119266e4fdc8p-31, -0x0.ad544513c2d350p-38, 0x0.8da53bc2c57ea0p-48, 0x0.a79cc476e05b20p-52, -0x0.87320880976fd0p-58, // x in subrange 2:32 (3..3.03125)
+ -0x0.9a7d0cd4c45c68p-9, 0x0.84411840efab00p-16, -0x0.faa0a0a0d93d38p-24, 0x0.ea9d0866579c48p-31, -0x0.aaddc393691c20p-38, 0x0.8904522cbfe8c0p-47, 0x0.87ab063efa3b88p-52, -0x0.f0e5a660cd1468p-59, // x in subrange 2:33 (3.03125..3.0625)
+ -0x0.96720f7cba5d98p-9, 0x0.fd18fadfc62b78p-17, -0x0.ec60ddb285e830p-24, 0x0.dd6834a9f83318p-31, -0x0.a7026bdee1de28p-38, 0x0.be081be0ac00d0p-47, 0x0.d6ab64b3230718p-53, -0x0.d4aaec3ea37ae8p-59, // x in subrange 2:34 (3.0625..3.09375)
+ -0x0.929367911ef9c8p-9, 0x0.f255d8f380e5b0p-17, -0x0.def1c06b8bb9f0p-24, 0x0.d08c006764ff40p-31, -0x0.a20ca6d3ec8348p-38, 0x0.e768e480737570p-47, 0x0.a4df3ae15bf940p-53, -0x0.b9fbb4b4f50668p-59, // x in subrange 2:35 (3.09375..3.125)
+ -0x0.8ede9023b2eda8p-9, 0x0.e82f26cc90da28p-17, -0x0.d24d1c64e42b48p-24, 0x0.c41bdf93bb3110p-31, -0x0.9c3ddacba15390p-38, 0x0.834e050d345db0p-46, 0x0.f30fb2ef3793e0p-54, -0x0.a10b8b8f85b668p-59, // x in subrange 2:36 (3.125..3.15625)
+ -0x0.8b512a38b47918p-9, 0x0.de9b913cae2ab0p-17, -0x0.c66bb50cddf398p-24, 0x0.b8267fcb73f1b0p-31, -0x0.95cef5e156f820p-38, 0x0.8e7f457f2c4310p-46, 0x0.a861dd562a8d38p-54, -0x0.89fc2dd13c6e78p-59, // x in subrange 2:37 (3.15625..3.1875)
+ -0x0.87e8fb6ca0cda0p-9, 0x0.d59220e4361d88p-17, -0x0.bb4584e0a2bce8p-24, 0x0.acb66bd71d4950p-31, -0x0.8ef10636051c20p-38, 0x0.95e9956519a218p-46, 0x0.d17ec7015fe398p-55, -0x0.e9bff54d1f7110p-60, // x in subrange 2:38 (3.1875..3.21875)
+ -0x0.84a3ec7420e7d8p-9, 0x0.cd0a4223b602b8p-17, -0x0.b0d1facea6aba8p-24, 0x0.a1d2a2ecf74650p-31, -0x0.87cddabedb50e0p-38, 0x0.9a20b75779eea0p-46, 0x0.ccb3738d104820p-56, -0x0.c3789eecea82c8p-60, // x in subrange 2:39 (3.21875..3.25)
+ -0x0.81800781a76b80p-9, 0x0.c4fbca63fc37f0p-17, -0x0.a7082e8a87e288p-24, 0x0.977f23346b81d0p-31, -0x0.8088a7f76d42f8p-38, 0x0.9baaa7f8676728p-46, 0x0.d5df483b9074b0p-59, -0x0.a11787ba7d3a60p-60, // x in subrange 2:40 (3.25..3.28125)
+ -0x0.fcf6ed3524e5d8p-10, 0x0.bd5efb1c8f9858p-17, -0x0.9ddf0c9fd4c1e0p-24, 0x0.8dbd6765d26a38p-31, -0x0.f27d592199ad18p-39, 0x0.9affc2b1ecb730p-46, -0x0.ed84f0b84cc7f8p-57, -0x0.82807a7339c7c8p-60, // x in subrange 2:41 (3.28125..3.3125)
+ -0x0.f72903c8301ca0p-10, 0x0.b62c82f6c74b28p-17, -0x0.954d7b113eac88p-24, 0x0.848cd7a7d625b8p-31, -0x0.e40fa5d7f61398p-39, 0x0.988b236ccbeed0p-46, -0x0.eb7dca0d794540p-56, -0x0.cf135023946f98p-61, // x in subrange 2:42 (3.3125..3.34375)
+ -0x0.f1931bddbce548p-10, 0x0.af5d7d622eaf28p-17, -0x0.8d4a774dceaa60p-24, 0x0.f7d65c0a0a0d20p-32, -0x0.d5ee99a9e2ac90p-39, 0x0.94ab37fc0de798p-46, -0x0.a37e7d29a11188p-55, -0x0.9ffe1e5771d998p-61, // x in subrange 2:43 (3.34375..3.375)
+ -0x0.ec32340dc1ba68p-10, 0x0.a8eb70e5960fa0p-17, -0x0.85cd2e3e91bf50p-24, 0x0.e7a99e01f451f0p-32, -0x0.c8384f1544dde8p-39, 0x0.8fb2755461e078p-46, -0x0.c6479161e0de78p-55, -0x0.ee95f38e128280p-62, // x in subrange 2:44 (3.375..3.40625)
+ -0x0.e7037d184d3eb0p-10, 0x0.a2d04c6f4a9aa8p-17, -0x0.fd9a1e4b420be0p-25, 0x0.d88a2dec5bc408p-32, -0x0.bb03ad4dc01b98p-39, 0x0.89e8260bed8f98p-46, -0x0.dfa2d638df4390p-55, -0x0.a8f49e90cd1f50p-62, // x in subrange 2:45 (3.40625..3.4375)
+ -0x0.e20456afb1b558p-10, 0x0.9d0663de8809b8p-17, -0x0.f083b3f81b81e8p-25, 0x0.ca6d39fa9efb98p-32, -0x0.ae6169ddb06140p-39, 0x0.83894904371868p-46, -0x0.f0f86e6a4a9b68p-55, -0x0.dc1f341874a8a8p-63, // x in subrange 2:46 (3.4375..3.46875)
+ -0x0.dd324c60d61bb0p-10, 0x0.97886bf85e8828p-17, -0x0.e44753df4dba90p-25, 0x0.bd46d85c98d3f8p-32, -0x0.a25cf4f42e9a18p-39, 0x0.f992f0f5fdec08p-47, -0x0.fb8f3531e69608p-55, -0x0.f370a3741888b8p-64, // x in subrange 2:47 (3.46875..3.5)
+ -0x0.d88b129da0ab68p-10, 0x0.925175f30b2378p-17, -0x0.d8d5f92884cf38p-25, 0x0.b10a68264672e0p-32, -0x0.96fd4fe6a527a0p-39, 0x0.eba7a611d40798p-47, -0x0.80466f679216f8p-54, -0x0.a29bc438a77e90p-65, // x in subrange 2:48 (3.5..3.53125)
+ -0x0.d40c83ec3171a0p-10, 0x0.8d5ceabc268830p-17, -0x0.ce216c9d3a0bc0p-25, 0x0.a5aae24d0fd398p-32, -0x0.8c45cdf93a6070p-39, 0x0.dd97c290b41e98p-47, -0x0.807b62904f2480p-54, 0x0.c889c3d59b9910p-66, // x in subrange 2:49 (3.53125..3.5625)
+ -0x0.cfb49e3c98d278p-10, 0x0.88a68618167900p-17, -0x0.c41c48e2a75910p-25, 0x0.9b1b1c6aa4f470p-32, -0x0.8236bff2783858p-39, 0x0.cf9ce7f00efb48p-47, -0x0.fdb33a2c999c58p-55, 0x0.9aa7af1569b218p-64, // x in subrange 2:50 (3.5625..3.59375)
+ -0x0.cb818065d83138p-10, 0x0.842a51b3d815f0p-17, -0x0.bab9faee7ec760p-25, 0x0.914dfee5714968p-32, -0x0.f19c16ad60bc18p-40, 0x0.c1e4eed31f73d8p-47, -0x0.f78b3e9a3caaa8p-55, 0x0.ebcd6a51c94dd0p-64, // x in subrange 2:51 (3.59375..3.625)
+ -0x0.c77167ca459308p-10, 0x0.ffc9407afd00f0p-18, -0x0.b1eebf738e6068p-25, 0x0.8836b00ab85b50p-32, -0x0.e00f5cd2cefd20p-40, 0x0.b49373d65ff6e8p-47, -0x0.ef2c7e5fc521a0p-55, 0x0.946e2adf896210p-63, // x in subrange 2:52 (3.625..3.65625)
+ -0x0.c382ae22d92ff8p-10, 0x0.f7a41127368ed0p-18, -0x0.a9af9deb74c350p-25, 0x0.ff916b1c474588p-33, -0x0.cfbc6482b38a08p-40, 0x0.a7c3473a9091e8p-47, -0x0.e52b7a1a95a9a8p-55, 0x0.aa6b0ed45d3d50p-63, // x in subrange 2:53 (3.65625..3.6875)
+ -0x0.bfb3c77078fe80p-10, 0x0.efdec230566950p-18, -0x0.a1f261cc255900p-25, 0x0.eff01b8e9af760p-33, -0x0.c09618b2594738p-40, 0x0.9b87bd91b2d9f8p-47, -0x0.da05c78bcdffe0p-55, 0x0.b939d93e871240p-63, // x in subrange 2:54 (3.6875..3.71875)
+ -0x0.bc034011fe2a30p-10, 0x0.e873766110db00p-18, -0x0.9aad9263586090p-25, 0x0.e17283d1b8a2d0p-33, -0x0.b28de22c82afb0p-40, 0x0.8fede0aadf6300p-47, -0x0.ce24577b0c95c0p-55, 0x0.c212c915c6dd18p-63, // x in subrange 2:55 (3.71875..3.75)
+ -0x0.b86fbafd6f37c0p-10, 0x0.e15cbdf27efdc8p-18, -0x0.93d869bf371b60p-25, 0x0.d402e49e1b0960p-33, -0x0.a5943185a486f8p-40, 0x0.84fd80d9830350p-47, -0x0.c1ddb2babc6f48p-55, 0x0.c60ad2fe77e180p-63, // x in subrange 2:56 (3.75..3.78125)
+ -0x0.b4f7f01abbcfa8p-10, 0x0.da958e64d99710p-18, -0x0.8d6acafaa3e440p-25, 0x0.c78cbbcbe62908p-33, -0x0.9998f0e5b53200p-40, 0x0.f5744ecbce1f10p-48, -0x0.b578232cd5f208p-55, 0x0.c6152b0a4d7460p-63, // x in subrange 2:57 (3.78125..3.8125)
+ -0x0.b19aaabe2999b8p-10, 0x0.d4193acedf9ad8p-18, -0x0.875d3834621df0p-25, 0x0.bbfccb1590c010p-33, -0x0.8e8be07c961ec0p-40, 0x0.e247d6f988e680p-48, -0x0.a92bc06f8f10b0p-55, 0x0.c3053fa5b12668p-63, // x in subrange 2:58 (3.8125..3.84375)
+ -0x0.ae56c840916840p-10, 0x0.cde36ca67dd068p-18, -0x0.81a8c86b0a9568p-25, 0x0.b1411860426488p-33, -0x0.845ce05125d860p-40, 0x0.d07056ae151840p-48, -0x0.9d245a4615a470p-55, 0x0.bd9101c0f09e38p-63, // x in subrange 2:59 (3.84375..3.875)
+ -0x0.ab2b36b386a9a8p-10, 0x0.c7f01d02dd9610p-18, -0x0.f88e3ad81e9058p-26, 0x0.a748e8e5608568p-33, -0x0.f5f853dc885210p-41, 0x0.bfe4572deb2c88p-48, -0x0.91833ce3fa2060p-55, 0x0.b6535bc9a14a00p-63, // x in subrange 2:60 (3.875..3.90625)
+ -0x0.a816f3af868140p-10, 0x0.c23b8e5613b090p-18, -0x0.ee64b3f3f336a8p-26, 0x0.9e04b8686f0bb8p-33, -0x0.e4b4f87e6d75b8p-41, 0x0.b0973e01bf8710p-48, -0x0.8660ccfe8fe160p-55, 0x0.adcebe3ca20fa8p-63, // x in subrange 2:61 (3.90625..3.9375)
+ -0x0.a5190b3a562100p-10, 0x0.bcc2469b2b4f18p-18, -0x0.e4ca308ad1da00p-26, 0x0.95662d781848c0p-33, -0x0.d4d27770685168p-41, 0x0.a27a3192dfa170p-48, -0x0.f79bf5e81462c0p-56, 0x0.a46fad65dd17b8p-63, // x in subrange 2:62 (3.9375..3.96875)
+ -0x0.a23096c3c76478p-10, 0x0.b78109f42c5ac0p-18, -0x0.dbb4c19a086d20p-26, 0x0.8d600b91081b20p-33, -0x0.c635116488ef50p-41, 0x0.957cd7683480e8p-48, -0x0.e3ab1af6e249a8p-56, 0x0.9a8f403a2f07b0p-63, // x in subrange 2:63 (3.96875..4)
+ -0x0.9dfa47b58bddf0p-9, 0x0.b001bc63342bb8p-16, -0x0.cefa56ef485c30p-23, 0x0.825a3ce7c7f428p-29, -0x0.b271bf2689a768p-36, 0x0.83f6656b621650p-42, -0x0.c82421a0cba9a8p-49, 0x0.8b66158058a100p-55, // x in subrange 3:0 (4..4.0625)
+ -0x0.98a00ad68ffc70p-9, 0x0.a6ac65b383bd50p-16, -0x0.bf8437f709b4c0p-23, 0x0.eaa75c9a7be2b8p-30, -0x0.9ba368b44e17d0p-36, 0x0.dfc850a63f8800p-43, -0x0.a7c9c7b7a22b10p-49, 0x0.ef2ac1ce187a68p-56, // x in subrange 3:1 (4.0625..4.125)
+ -0x0.938dabb7a05be0p-9, 0x0.9e0741094ee190p-16, -0x0.b193e92b271b68p-23, 0x0.d3e379ec38f488p-30, -0x0.8847d7cba2bae0p-36, 0x0.be2f87fbc1dc18p-43, -0x0.8c3af7e407f690p-49, 0x0.ca54a6bd18f360p-56, // x in subrange 3:2 (4.125..4.1875)
+ -0x0.8ebdeeb7a8bd20p-9, 0x0.96013398c05610p-16, -0x0.a4f8e77a172860p-23, 0x0.bfea84501c4500p-30, -0x0.ef9c6667c712e0p-37, 0x0.a2212aebd5a880p-43, -0x0.ea14b047771190p-50, 0x0.a964e8e0564600p-56, // x in subrange 3:3 (4.1875..4.25)
+ -0x0.8a2c186c34af50p-9, 0x0.8e8b3c14782918p-16, -0x0.9989e9677fb368p-23, 0x0.ae52fde2705898p-30, -0x0.d3790e87e3e5b0p-37, 0x0.8ab6e0072f47b8p-43, -0x0.c3668116c17b28p-50, 0x0.8cc1c7f033cf00p-56, // x in subrange 3:4 (4.25..4.3125)
+ -0x0.85d3de1c581500p-9, 0x0.87982359299db0p-16, -0x0.8f23ad9a76efe0p-23, 0x0.9ec4d964991ce0p-30, -0x0.bb5a2916f3b838p-37, 0x0.ee5052c07fbe48p-44, -0x0.a357fea8624908p-50, 0x0.e8bdb39c9964a8p-57, // x in subrange 3:5 (4.3125..4.375)
+ -0x0.81b1588038f650p-9, 0x0.811c3a34ae0cf8p-16, -0x0.85a7fbe89ddae8p-23, 0x0.90f68a4c7bfd08p-30, -0x0.a69702842699a0p-37, 0x0.cd944e78c91f20p-44, -0x0.88e204cd077ff0p-50, 0x0.bfda301ccc17a0p-57, // x in subrange 3:6 (4.375..4.4375)
+ -0x0.fb81f0cacd9a80p-10, 0x0.f61a4429192af0p-17, -0x0.f9f9a3cbdb6600p-24, 0x0.84aa83529583e8p-30, -0x0.94a451c825d6d0p-37, 0x0.b21b014b3c7400p-44, -0x0.e62bcc7844e598p-51, 0x0.9df87c38987610p-57, // x in subrange 3:7 (4.4375..4.5)
+ -0x0.f3fef9d0ff0ec8p-10, 0x0.eac33d74cafd70p-17, -0x0.ea17688df4a8e0p-24, 0x0.f35a37e01d9440p-31, -0x0.850f556379e8e8p-37, 0x0.9af6ba6f63aca8p-44, -0x0.c24591df585570p-51, 0x0.8221916ad0eea0p-57, // x in subrange 3:8 (4.5..4.5625)
+ -0x0.ecd3d604ec81c0p-10, 0x0.e022dec3574330p-17, -0x0.db823df9bd4890p-24, 0x0.dfa5a34bbddca8p-31, -0x0.eef3167a8bf848p-38, 0x0.876417721b4ff0p-44, -0x0.a4ad3cbe153a98p-51, 0x0.d6c622aababe78p-58, // x in subrange 3:9 (4.5625..4.625)
+ -0x0.e5fb0c66b6c398p-10, 0x0.d62a5c0db1f190p-17, -0x0.ce181d626ef7e0p-24, 0x0.cdedb137174d20p-31, -0x0.d72a1258af00a0p-38, 0x0.ed86d7498a6338p-45, -0x0.8c3903441f31e0p-51, 0x0.b1bcf16b367640p-58, // x in subrange 3:10 (4.625..4.6875)
+ -0x0.df6f943c201dc0p-10, 0x0.cccc67779fe730p-17, -0x0.c1bb3e1ff07720p-24, 0x0.bdf3de906c1140p-31, -0x0.c242dc292f5aa8p-38, 0x0.d1255c7f2dd428p-45, -0x0.efe6e50a9996f0p-52, 0x0.93a07ca076fd60p-58, // x in subrange 3:11 (4.6875..4.75)
+ -0x0.d92cc9e0440598p-10, 0x0.c3fd024ee4dd80p-17, -0x0.b6517415bb57a8p-24, 0x0.af82d398a6cd88p-31, -0x0.afd2b867d7a020p-38, 0x0.b8d0453abf4a60p-45, -0x0.ce28b91ee155f8p-52, 0x0.f6471ff73db640p-59, // x in subrange 3:12 (4.75..4.8125)
+ -0x0.d32e64eedfb838p-10, 0x0.bbb154f0a2c568p-17, -0x0.abc3a9dae449d8p-24, 0x0.a26cd5f36bef10p-31, -0x0.9f80d483a0f290p-38, 0x0.a3db92c4ae67d8p-45, -0x0.b1f368c1f0b4a0p-52, 0x0.ce613d9b724328p-59, // x in subrange 3:13 (4.8125..4.875)
+ -0x0.cd706f98d18d20p-10, 0x0.b3df8c696511c8p-17, -0x0.a1fd715a2f4090p-24, 0x0.968a84f9c5e7c0p-31, -0x0.9102f17eec9310p-38, 0x0.91bb272778f838p-45, -0x0.9a41d52da1ea60p-52, 0x0.adc8a15e888090p-59, // x in subrange 3:14 (4.875..4.9375)
+ -0x0.c7ef3ef7e9a4e8p-10, 0x0.ac7ebcdc31c490p-17, -0x0.98eca6bbd755b8p-24, 0x0.8bb9d2091cbdf0p-31, -0x0.841ab43299a008p-38, 0x0.81fc8a19b2ef28p-45, -0x0.864223e8f80d98p-52, 0x0.930d69ffec7cb0p-59, // x in subrange 3:15 (4.9375..5)
+ -0x0.c2a76c3f08b860p-10, 0x0.a586c7ea205c00p-17, -0x0.9081223a2a9178p-24, 0x0.81dd2918489fa8p-31, -0x0.f126f8f8b00930p-39, 0x0.e883bb50d411f8p-46, -0x0.ea978b19bd2360p-53, 0x0.fa1118501394a8p-60, // x in subrange 3:16 (5..5.0625)
+ -0x0.bd95cea92720c8p-10, 0x0.9ef046784ee918p-17, -0x0.88ac762b393f68p-24, 0x0.f1b5802bbe6d48p-32, -0x0.dc81524f1efc78p-39, 0x0.d07ba41ff533c0p-46, -0x0.cdae5ea6cbd0e0p-53, 0x0.d59d8ae271e350p-60, // x in subrange 3:17 (5.0625..5.125)
+ -0x0.b8b7760e765b58p-10, 0x0.98b4754f426f18p-17, -0x0.8161b7123864d8p-24, 0x0.e1380ae3a2f828p-32, -0x0.c9f8659f72f7f0p-39, 0x0.bb60d67fe9c698p-46, -0x0.b4ee3cdb744b70p-53, 0x0.b74a3968463890p-60, // x in subrange 3:18 (5.125..5.1875)
+ -0x0.b409a60a959370p-10, 0x0.92cd242638bf80p-17, -0x0.f52a97f0b4a4f0p-25, 0x0.d21a4f7cd07928p-32, -0x0.b94b1804929b40p-39, 0x0.a8c8dfb0e9c2f0p-46, -0x0.9fa65eb78e80c8p-53, 0x0.9dee47d9077b10p-60, // x in subrange 3:19 (5.1875..5.25)
+ -0x0.af89d1a1ef41a8p-10, 0x0.8d34a6bfd76f80p-17, -0x0.e8798b479963f8p-25, 0x0.c4396326cc5520p-32, -0x0.aa4170c4bf2580p-39, 0x0.985abf0890f4e0p-46, -0x0.8d47228b1708d0p-53, 0x0.889de23bcc7aa8p-60, // x in subrange 3:20 (5.25..5.3125)
+ -0x0.ab359756eb6278p-10, 0x0.87e5c7cce50338p-17, -0x0.dc9d771136bb48p-25, 0x0.b7766bb9a7fb18p-32, -0x0.9cab1ef58f3060p-39, 0x0.89cba916683dc8p-46, -0x0.fab683c50b5560p-54, 0x0.ed3a8c3d511288p-61, // x in subrange 3:21 (5.3125..5.375)
+ -0x0.a70abda1c932b0p-10, 0x0.82dbbd5616bfb0p-17, -0x0.d1855b0c211970p-25, 0x0.abb61311b93fd0p-32, -0x0.905e4497fc4298p-39, 0x0.f9b8e7769529d0p-47, -0x0.df04f54868d000p-54, 0x0.ceace5a75ee9c8p-61, // x in subrange 3:22 (5.375..5.4375)
+ -0x0.a3072fbfc16b38p-10, 0x0.fc243cf01d9940p-18, -0x0.c721d35d917010p-25, 0x0.a0e0104e795d70p-32, -0x0.85367919411808p-39, 0x0.e2af0dfa41e170p-47, -0x0.c6dabbb4fe0a48p-54, 0x0.b4a217a89bd488p-61, // x in subrange 3:23 (5.4375..5.5)
+ -0x0.9f28facf970e18p-10, 0x0.f309b489c68f18p-18, -0x0.bd64eaf8ef9e78p-25, 0x0.96dec313a5d120p-32, -0x0.f627f055e6d5a0p-40, 0x0.ce1e6c24b75fb8p-47, -0x0.b1b4098cc89198p-54, 0x0.9e58028a3d82f8p-61, // x in subrange 3:24 (5.5..5.5625)
+ -0x0.9b6e4b330617a8p-10, 0x0.ea605f4a9bc1d0p-18, -0x0.b441f3d866c850p-25, 0x0.8d9eddb01f6318p-32, -0x0.e3b5e8877c0b20p-40, 0x0.bbb8d4b3b424d8p-47, -0x0.9f22f2f96d0e98p-54, 0x0.8b31417d7d90d8p-61, // x in subrange 3:25 (5.5625..5.625)
+ -0x0.97d56a2d974ab8p-10, 0x0.e2214c327d2698p-18, -0x0.abad642ceed518p-25, 0x0.850f1ba8643498p-32, -0x0.d2e60be70e4338p-40, 0x0.ab3b1dca360f48p-47, -0x0.8ecb5621a27c78p-54, 0x0.f55b00b8896c98p-62, // x in subrange 3:26 (5.625..5.6875)
+ -0x0.945cbbba4f45f8p-10, 0x0.da460e786a5098p-18, -0x0.a39cb7d064d620p-25, 0x0.fa4005385ced20p-33, -0x0.c38d654bb954b0p-40, 0x0.9c6b5e33d17fb8p-47, -0x0.805f9c44bec080p-54, 0x0.d8c70e55e5bf70p-62, // x in subrange 3:27 (5.6875..5.75)
+ -0x0.9102bc927be738p-10, 0x0.d2c8b1eb54da80p-18, -0x0.9c065561b395d8p-25, 0x0.eb8757be0aaa70p-33, -0x0.b5860d16caae50p-40, 0x0.8f177be493c000p-47, -0x0.e73c46c948b108p-55, 0x0.bff92e95b9c808p-62, // x in subrange 3:28 (5.75..5.8125)
+ -0x0.8dc60060934650p-10, 0x0.cba3b0822eed40p-18, -0x0.94e1768b1570a0p-25, 0x0.dddb2ad025cf98p-33, -0x0.a8ae7c82cb5758p-40, 0x0.8313fb66d81c80p-47, -0x0.d09e56b7494650p-55, 0x0.aa6198c62915b8p-62, // x in subrange 3:29 (5.8125..5.875)
+ -0x0.8aa5301aafc2c0p-10, 0x0.c4d1e8f7d7e5b8p-18, -0x0.8e261306382d18p-25, 0x0.d124f1f5705780p-33, -0x0.9ce8faf778b670p-40, 0x0.f07606f4754ce0p-48, -0x0.bc8653a573c930p-55, 0x0.978889c90a08c8p-62, // x in subrange 3:30 (5.875..5.9375)
+ -0x0.879f0880b87c78p-10, 0x0.be4e965436ba20p-18, -0x0.87ccce025cb7e0p-25, 0x0.c5505134f99b30p-33, -0x0.921b20fac9ac60p-40, 0x0.dcd715ca6d97f0p-48, -0x0.aaa2de4a006f88p-55, 0x0.8709c855dadf38p-62, // x in subrange 3:31 (5.9375..6)
+ -0x0.84b258bab82468p-10, 0x0.b8154847ccbd60p-18, -0x0.81cee59e19e1a0p-25, 0x0.ba4adf09642fe0p-33, -0x0.882d6d2c87f700p-40, 0x0.cb11512f1fa1d8p-48, -0x0.9aae168d1dd1e0p-55, 0x0.f1222cb88ecde0p-63, // x in subrange 3:32 (6..6.0625)
+ -0x0.81de011447eda8p-10, 0x0.b221dc4271aaa0p-18, -0x0.f84c4863713f08p-26, 0x0.b003ee14d93360p-33, -0x0.fe15d0c59c7880p-41, 0x0.baf1ffb9abb298p-48, -0x0.8c6bcb34b058e0p-55, 0x0.d7aeb46366ecd8p-63, // x in subrange 3:33 (6.0625..6.125)
+ -0x0.fe41e3a4975570p-11, 0x0.ac707730d3c7a0p-18, -0x0.ed99a66137ac60p-26, 0x0.a66c5d7fc0b650p-33, -0x0.ed41ad08009358p-41, 0x0.ac4c87435ecb00p-48, -0x0.ff4ff63663a0b8p-56, 0x0.c140adddd23590p-63, // x in subrange 3:34 (6.125..6.1875)
+ -0x0.f8f45441112818p-11, 0x0.a6fd7fced85310p-18, -0x0.e37b5ee0437168p-26, 0x0.9d766f17c15ef8p-33, -0x0.ddbce44c918738p-41, 0x0.9ef99994d61348p-48, -0x0.e86b30226a24d0p-56, 0x0.ad71aa0114cfd0p-63, // x in subrange 3:35 (6.1875..6.25)
+ -0x0.f3d16e29c6ae90p-11, 0x0.a1c5997f21aba0p-18, -0x0.d9e7bd52596e00p-26, 0x0.9515a2686880d0p-33, -0x0.cf6962a658c3a0p-41, 0x0.92d680bd59c850p-48, -0x0.d3dafddee7ebe0p-56, 0x0.9bea4657bfd250p-63, // x in subrange 3:36 (6.25..6.3125)
+ -0x0.eed7658c9a48f8p-11, 0x0.9cc59f99df29f8p-18, -0x0.d0d5cc1e785158p-26, 0x0.8d3e9424a3b300p-33, -0x0.c22c2427a78c88p-41, 0x0.87c485d3220ba0p-48, -0x0.c15b35f76da750p-56, 0x0.8c5fbb7f207510p-63, // x in subrange 3:37 (6.3125..6.375)
+ -0x0.ea0486eb371ad8p-11, 0x0.97faa126a9bd90p-18, -0x0.c83d43b9ba9460p-26, 0x0.85e6e1510a8418p-33, -0x0.b5ecdb47782c70p-41, 0x0.fb50dba3d551f0p-49, -0x0.b0b0598df00340p-56, 0x0.fd23b71de443a8p-64, // x in subrange 3:38 (6.375..6.4375)
+ -0x0.e557358d6a37a8p-11, 0x0.9361dcf6994e90p-18, -0x0.c0167b72cf2120p-26, 0x0.fe0a1b678550b0p-34, -0x0.aa95a2ac697780p-41, 0x0.e8d4122435a750p-49, -0x0.a1a65c77ff0060p-56, 0x0.e492d4ebec06c8p-64, // x in subrange 3:39 (6.4375..6.5)
+ -0x0.e0cdea114aa098p-11, 0x0.8ef8be14f98e70p-18, -0x0.b85a5bbf122ce8p-26, 0x0.f120da4088b9d0p-34, -0x0.a012b8c2fdd720p-41, 0x0.d7e7a4e1a951a8p-49, -0x0.940f9d9e0deb98p-56, 0x0.cead7df98ef608p-64, // x in subrange 3:40 (6.5..6.5625)
+ -0x0.dc6731169ddcf0p-11, 0x0.8abcd88617c9b8p-18, -0x0.b10251de7224b0p-26, 0x0.e5021e88090a30p-34, -0x0.965243c44debd0p-41, 0x0.c8653781bee990p-49, -0x0.87c4076ae7d3e0p-56, 0x0.bb213d8b8ae920p-64, // x in subrange 3:41 (6.5625..6.625)
+ -0x0.d821aa032751e0p-11, 0x0.86abe64c940780p-18, -0x0.aa0844b0958ef0p-26, 0x0.d99f5b4b0cce00p-34, -0x0.8d441d071a2cf8p-41, 0x0.ba2a8b07f4dc48p-49, -0x0.f940a33f6c9aa8p-57, 0x0.a9a694e0ea99d0p-64, // x in subrange 3:42 (6.625..6.6875)
+ -0x0.d3fc05ddc9cd48p-11, 0x0.82c3c4ae72fea8p-18, -0x0.a3668a9a478c48p-26, 0x0.ceeb3723e2cbd8p-34, -0x0.84d9a2a1194a20p-41, 0x0.ad1900815c0e70p-49, -0x0.e50abe2fc54ab0p-57, 0x0.99ff626a1779e8p-64, // x in subrange 3:43 (6.6875..6.75)
+ -0x0.cff5063e95d380p-11, 0x0.fe04e367d04650p-19, -0x0.9d17e05e24aed8p-26, 0x0.c4d96f7c9e6d80p-34, -0x0.fa0b1d06486d20p-42, 0x0.a1152c1bfc9a90p-49, -0x0.d2af66025cf278p-57, 0x0.8bf58a019b6130p-64, // x in subrange 3:44 (6.75..6.8125)
+ -0x0.cc0b7c520ceac0p-11, 0x0.f6cc13b4e552d8p-19, -0x0.971760cef044d8p-26, 0x0.bb5ebed29bffc8p-34, -0x0.eb77a4b379d650p-42, 0x0.9606764edfe098p-49, -0x0.c1fdf3aa144fa0p-57, 0x0.feb3a5cae5db30p-65, // x in subrange 3:45 (6.8125..6.875)
+ -0x0.c83e47ee0af900p-11, 0x0.efd98beef18a28p-19, -0x0.91607d44f64750p-26, 0x0.b270c5a1faa3f0p-34, -0x0.dde2ef2ad4d850p-42, 0x0.8bd6c915fc58b8p-49, -0x0.b2cb4605588680p-57, 0x0.e805e49c09f848p-65, // x in subrange 3:46 (6.875..6.9375)
+ -0x0.c48c56b6eb67b8p-11, 0x0.e929f28c182658p-19, -0x0.8beef6c2782598p-26, 0x0.aa05f5ab528b38p-34, -0x0.d1390628b314a8p-42, 0x0.827247938cfa80p-49, -0x0.a4f1117b435cf8p-57, 0x0.d399765e7341d8p-65, // x in subrange 3:47 (6.9375..7)
+ -0x0.c0f4a353a09a00p-11, 0x0.e2ba1f37e66530p-19, -0x0.86bed7b5686aa0p-26, 0x0.a2157f4fb24020p-34, -0x0.c567b7f2988820p-42, 0x0.f38e1d532b8320p-50, -0x0.984d47a1342030p-57, 0x0.c12eda129ee170p-65, // x in subrange 3:48 (7..7.0625)
+ -0x0.bd7634af91ca38p-11, 0x0.dc871784f1b848p-19, -0x0.81cc6e46b65ad0p-26, 0x0.9a9740c75aabc0p-34, -0x0.ba5e6a975fcaa8p-42, 0x0.e389faa9aecd70p-50, -0x0.8cc19359bfb568p-57, 0x0.b08e39893bb748p-65, // x in subrange 3:49 (7.0625..7.125)
+ -0x0.ba101d492df490p-11, 0x0.d68e0bdfb3d980p-19, -0x0.fa288e52522cf8p-27, 0x0.9383b6fefa6d98p-34, -0x0.b00df414519670p-42, 0x0.d4bb07804ad3f0p-50, -0x0.8232e66ff080f8p-57, 0x0.a18666e77b8430p-65, // x in subrange 3:50 (7.125..7.1875)
+ -0x0.b6c17a8c3a66a8p-11, 0x0.d0cc54bcf64b18p-19, -0x0.f12651b6a3dce0p-27, 0x0.8cd3efed78f810p-34, -0x0.a66876c8c456d0p-42, 0x0.c706f05afa07c8p-50, -0x0.f1122c55396208p-58, 0x0.93ebff1b3fe538p-65, // x in subrange 3:51 (7.1875..7.25)
+ -0x0.b3897436f92430p-11, 0x0.cb3f6ffeac2be0p-19, -0x0.e88c1ea2ed4c38p-27, 0x0.86817e39dccf50p-34, -0x0.9d6141b58fea90p-42, 0x0.ba55e1e5427dc0p-50, -0x0.df5d096fa7ace8p-58, 0x0.8798ab8afc11e8p-65, // x in subrange 3:52 (7.25..7.3125)
+ -0x0.b0673bc956d5c0p-11, 0x0.c5e4fe8a9778a8p-19, -0x0.e0544ffb0902d8p-27, 0x0.80866e0d9cb830p-34, -0x0.94ecb416858c28p-42, 0x0.ae9245c4c9d140p-50, -0x0.cf1fab47a2be28p-58, 0x0.f8d4fc7ffef410p-66, // x in subrange 3:53 (7.3125..7.375)
+ -0x0.ad5a0bfd619b38p-11, 0x0.c0bac20e879dd8p-19, -0x0.d8799c5852fd70p-27, 0x0.f5ba75e7a6af08p-35, -0x0.8d0023f2a1c028p-42, 0x0.a3a8872606eae0p-50, -0x0.c03757a90fb6a0p-58, 0x0.e486c922a308a0p-66, // x in subrange 3:54 (7.375..7.4375)
+ -0x0.aa6128485a1708p-11, 0x0.bbbe9aee642c70p-19, -0x0.d0f70f5e3d14a8p-27, 0x0.eb018d52db1498p-35, -0x0.8591c74c31e6e0p-42, 0x0.9986de0b4ac820p-50, -0x0.b284df7a54b3f8p-58, 0x0.d21159f34c6508p-66, // x in subrange 3:55 (7.4375..7.5)
+ -0x0.a77bdc63be8368p-11, 0x0.b6ee865890ff30p-19, -0x0.c9c8039aff7b00p-27, 0x0.e0d8a18b304f78p-35, -0x0.fd313f49eaab20p-43, 0x0.901d2087f6eef8p-50, -0x0.a5ec395c1ff970p-58, 0x0.c1453a95b5a3f8p-66, // x in subrange 3:56 (7.5..7.5625)
+ -0x0.a4a97bddbcc8c8p-11, 0x0.b2489c7d8a4918p-19, -0x0.c2e81ce7946ed8p-27, 0x0.d736de48f363c0p-35, -0x0.f018cf273634b0p-43, 0x0.875c992e6aeef0p-50, -0x0.9a54289d0becf8p-58, 0x0.b1f82dc4406c80p-66, // x in subrange 3:57 (7.5625..7.625)
+ -0x0.a1e961b0847df0p-11, 0x0.adcb0ee7dff698p-19, -0x0.bc53433b798388p-27, 0x0.ce140e016a6a40p-35, -0x0.e3cb04602ffb08p-43, 0x0.fe6fc41f8007b8p-51, -0x0.8fa5eee1daddc0p-58, 0x0.a4048dbb713b00p-66, // x in subrange 3:58 (7.625..7.6875)
+ -0x0.9f3aefdffc96d8p-11, 0x0.a97426f1f968b8p-19, -0x0.b6059de9d78980p-27, 0x0.c5688d54b18250p-35, -0x0.d839d846b36ff8p-43, 0x0.ef458782ee3e00p-51, -0x0.85cd071de0d500p-58, 0x0.9748c146c52600p-66, // x in subrange 3:59 (7.6875..7.75)
+ -0x0.9c9d8f1d6a6bc0p-11, 0x0.a542445745a680p-19, -0x0.affb8f3eb88958p-27, 0x0.bd2d3f977ac920p-35, -0x0.cd585c59f6ca28p-43, 0x0.e1242fdea70aa0p-51, -0x0.f96dd15233a530p-59, 0x0.8ba6c28fe20720p-66, // x in subrange 3:60 (7.75..7.8125)
+ -0x0.9a10ae70a0c4c0p-11, 0x0.a133dbdeb16ba8p-19, -0x0.aa31b073dd4d30p-27, 0x0.b55b845d11c930p-35, -0x0.c31aa1ede98568p-43, 0x0.d3f75e1e5b2128p-51, -0x0.e8a5a2d7a8bf08p-59, 0x0.8103b53ece9900p-66, // x in subrange 3:61 (7.8125..7.875)
+ -0x0.9793c2e655ce00p-11, 0x0.9d47761c6c9148p-19, -0x0.a4a4cdf594ee90p-27, 0x0.aded2de8f3b9e8p-35, -0x0.b975a427cb80d0p-43, 0x0.c7ac71b3ec5fb0p-51, -0x0.d9232c77ee8d18p-59, 0x0.ee8f13ac202d98p-67, // x in subrange 3:62 (7.875..7.9375)
+ -0x0.95264743465bd8p-11, 0x0.997bae4933c5e8p-19, -0x0.9f51e3f0b3b7a8p-27, 0x0.a6dc7871e7ac80p-35, -0x0.b05f341163dad8p-43, 0x0.bc325e717ab5b8p-51, -0x0.cacaf14d799f58p-59, 0x0.dcb959066d0390p-67, // x in subrange 3:63 (7.9375..8)
+ -0x0.919de97e7d0ec0p-10, 0x0.94044930690890p-17, -0x0.97bc0b62221f40p-24, 0x0.9ce7490fa6e7b8p-31, -0x0.a3b46ca74641a8p-38, 0x0.ac610bab47c130p-45, -0x0.b7462083adbbf8p-52, 0x0.c4bcd323096e10p-59, // x in subrange 4:0 (8..8.125)
+ -0x0.8d19a0b27ecce8p-10, 0x0.8d20bfff05b388p-17, -0x0.8e50a2158196f0p-24, 0x0.90b8bc5f99ca80p-31, -0x0.94717857110088p-38, 0x0.999dbd65de00a0p-45, -0x0.a07423fae571f0p-52, 0x0.a9265ad3ba2448p-59, // x in subrange 4:1 (8.125..8.25)
+ -0x0.88cabbf043bc18p-10, 0x0.86a9d35db67688p-17, -0x0.859ef284a49cf0p-24, 0x0.85aa94038f4668p-31, -0x0.86d453d3942108p-38, 0x0.892b98dc26d250p-45, -0x0.8cce9929c66038p-52, 0x0.91d46d893b19b8p-59, // x in subrange 4:2 (8.25..8.375)
+ -0x0.84adf80dc0ea48p-10, 0x0.809736c0845b48p-17, -0x0.fb2be5c38f8088p-25, 0x0.f73bda670eb068p-32, -0x0.f552a861029c78p-39, 0x0.f5719c2796cc48p-46, -0x0.f7b1b558902c60p-53, 0x0.fc1ce0b431fbe0p-60, // x in subrange 4:3 (8.375..8.5)
+ -0x0.80c051315c7060p-10, 0x0.f5c2bdf134ba90p-18, -0x0.ec4cd192ed4de0p-25, 0x0.e4ef4bc1a36e90p-32, -0x0.df87c01e45f738p-39, 0x0.dbffffb9de4c60p-46, -0x0.da564c9aedadc0p-53, 0x0.da7b25d6fc69d0p-60, // x in subrange 4:4 (8.5..8.625)
+ -0x0.f9fdfa34939ba0p-11, 0x0.eb02dba52ed390p-18, -0x0.de8562ccdfcfd8p-25, 0x0.d43fb4a982c030p-32, -0x0.cbfabd05cd9800p-39, 0x0.c58c6465fe9508p-46, -0x0.c0dda4a9753030p-53, 0x0.bdcc4faab4bc40p-60, // x in subrange 4:5 (8.625..8.75)
+ -0x0.f2cecc03ef5658p-11, 0x0.e0e24049b44900p-18, -0x0.d1bd22358b1f50p-25, 0x0.c502eca8db39a8p-32, -0x0.ba68a5f66a55b0p-39, 0x0.b1b22feece60c8p-46, -0x0.aab680d1f56a70p-53, 0x0.a544c7c3c0e188p-60, // x in subrange 4:6 (8.75..8.875)
+ -0x0.ebee4c08cb0728p-11, 0x0.d7557bf4dc9618p-18, -0x0.c5de1320918338p-25, 0x0.b713ad30bc1430p-32, -0x0.aa973c50de6140p-39, 0x0.a01b5b1c3b36e0p-46, -0x0.9766ccdda93638p-53, 0x0.903c676b5f91b8p-60, // x in subrange 4:7 (8.875..9)
+ -0x0.e55805ff3fc960p-11, 0x0.ce521927170fc8p-18, -0x0.bad46a8163d558p-25, 0x0.aa50efef7e28f0p-32, -0x0.9c53babaad8418p-39, 0x0.907e236f05b240p-46, -0x0.86879d2a507be0p-53, 0x0.fc4faa285df4a0p-61, // x in subrange 4:8 (9..9.125)
+ -0x0.df07d5b96017d8p-11, 0x0.c5ce83fdc6f4a0p-18, -0x0.b08e4f58663fd0p-25, 0x0.9e9d6437cc9c60p-32, -0x0.8f71c6509d6b10p-39, 0x0.829b21fd2ce728p-46, -0x0.ef83d9f938b8f8p-54, 0x0.dd266bd1542d08p-61, // x in subrange 4:9 (9.125..9.25)
+ -0x0.d8f9e06c1c19c0p-11, 0x0.bdc1f42f51c7f8p-18, -0x0.a6fba329843bf8p-25, 0x0.93def7e0428fe0p-32, -0x0.83ca89b51ce9e8p-39, 0x0.ec7769a25ef678p-47, -0x0.d597ea81a234f8p-54, 0x0.c23bd5fc2e3398p-61, // x in subrange 4:10 (9.25..9.375)
+ -0x0.d32a8ea24e8468p-11, 0x0.b624597717f958p-18, -0x0.9e0dd15d4b57b0p-25, 0x0.89fe709edb1aa8p-32, -0x0.f277e5f0f35908p-40, 0x0.d66157a6c60540p-47, -0x0.becdfbd7a19640p-54, 0x0.aaee44220fdee0p-61, // x in subrange 4:11 (9.375..9.5)
+ -0x0.cd9686c3aee650p-11, 0x0.aeee4a2434a2e0p-18, -0x0.95b7a499561b80p-25, 0x0.80e71362879260p-32, -0x0.df501d37cd7e08p-40, 0x0.c2a25a58a9aa08p-47, -0x0.aabb24c40b1ef8p-54, 0x0.96b61c4c023690p-61, // x in subrange 4:12 (9.5..9.625)
+ -0x0.c83aa81fa40f38p-11, 0x0.a818f3886649c0p-18, -0x0.8ded21414d0d58p-25, 0x0.f10caf2b3e2428p-33, -0x0.cde8f5ea6ebcc0p-40, 0x0.b0f38ebaa0ad78p-47, -0x0.99040c3e3432e8p-54, 0x0.85214be5d45498p-61, // x in subrange 4:13 (9.625..9.75)
+ -0x0.c314066de176c8p-11, 0x0.a19e0c0d768af0p-18, -0x0.86a3647052a408p-25, 0x0.e1974913b1f220p-33, -0x0.be13e01931b540p-40, 0x0.a1175244b3a0b0p-47, -0x0.895a7544e87888p-54, 0x0.eb9f3533173cc8p-62, // x in subrange 4:14 (9.75..9.875)
+ -0x0.be1fe5b8687778p-11, 0x0.9b77c6bf1a3658p-18, -0x0.ffa10da8b2bca8p-26, 0x0.d3502f2b30e300p-33, -0x0.afa7b172ff4920p-40, 0x0.92d7f151fd7010p-47, -0x0.f6f66a79ab1608p-55, 0x0.d0df5205bca378p-62, // x in subrange 4:15 (9.875..10)
+ -0x0.b95bb6a3fb98b0p-11, 0x0.95a0c81dcc0410p-18, -0x0.f2d705d50186a0p-26, 0x0.c61ca34a7a58e8p-33, -0x0.a27ff4a080a200p-40, 0x0.860689aa8576c0p-47, -0x0.de590307793e58p-55, 0x0.b978f3b26813b8p-62, // x in subrange 4:16 (10..10.125)
+ -0x0.b4c5130d571658p-11, 0x0.90141c14be2200p-18, -0x0.e6d83c5badb1f8p-26, 0x0.b9e496685bbf28p-33, -0x0.967c51493f9660p-40, 0x0.f4f43104a9e388p-48, -0x0.c879094335a7d0p-55, 0x0.a4f6d619c81d70p-62, // x in subrange 4:17 (10.125..10.25)
+ -0x0.b059baf29d36e8p-11, 0x0.8acd2cf1cf3080p-18, -0x0.db95a9b29f3fa0p-26, 0x0.ae925b945b3f08p-33, -0x0.8b800907decc40p-40, 0x0.e01d59a0179ef8p-48, -0x0.b5005cefe3a980p-55, 0x0.92f51369e86880p-62, // x in subrange 4:18 (10.25..10.375)
+ -0x0.ac1791a15c9bc8p-11, 0x0.85c7bb42949d88p-18, -0x0.d1018fd5c34810p-26, 0x0.a4126477702b68p-33, -0x0.8171862de47a88p-40, 0x0.cd49703865da78p-48, -0x0.a3a46a5ae0d578p-55, 0x0.831e5fc92bf180p-62, // x in subrange 4:19 (10.375..10.5)
+ -0x0.a7fc9b226f8138p-11, 0x0.80ffd67d205dc0p-18, -0x0.c70f5a41be37e0p-26, 0x0.9a5306118bfc38p-33, -0x0.f073f36fc01808p-41, 0x0.bc40f1dc30e478p-48, -0x0.94247cf3d87d68p-55, 0x0.ea537b55478f08p-63, // x in subrange 4:20 (10.5..10.625)
+ -0x0.a406f9ddb103e0p-11, 0x0.f8e3acbc80a278p-19, -0x0.bdb381684d94b0p-26, 0x0.9144449adf1cc8p-33, -0x0.df8a0c79f81c88p-41, 0x0.acd2f59dbf1280p-48, -0x0.864854fa4dd470p-55, 0x0.d1b129db805148p-63, // x in subrange 4:21 (10.625..10.75)
+ -0x0.a034ec702c94e8p-11, 0x0.f034a9d3489780p-19, -0x0.b4e37133d32da0p-26, 0x0.88d7a598597c78p-33, -0x0.d000ebfaaf7bf8p-41, 0x0.9ed45111bfa040p-48, -0x0.f3bdea1791d688p-56, 0x0.bbea363bd95800p-63, // x in subrange 4:22 (10.75..10.875)
+ -0x0.9c84cbaffed508p-11, 0x0.e7ec51f5580318p-19, -0x0.ac95723d71b958p-26, 0x0.810007552e1b28p-33, -0x0.c1b7f4f81858f8p-41, 0x0.921edbafb5d008p-48, -0x0.dd7b3cb73732e8p-56, 0x0.a8a1fcff2eca18p-63, // x in subrange 4:23 (10.875..11)
+ -0x0.98f508d9a0b900p-11, 0x0.e004c2ad49c408p-19, -0x0.a4c0956517dd38p-26, 0x0.f362fa204d4c10p-34, -0x0.b491e89e500b80p-41, 0x0.8690cc67a2e440p-48, -0x0.c97de7f63a4a78p-56, 0x0.9788908b905498p-63, // x in subrange 4:24 (11..11.125)
+ -0x0.95842be2c86160p-11, 0x0.d8788066083888p-19, -0x0.9d5ca1851f65d8p-26, 0x0.e5c25e886a79c8p-34, -0x0.a8748406a71368p-41, 0x0.f8185b04447e00p-49, -0x0.b7847dd46fa220p-56, 0x0.8858d8e391ee70p-63, // x in subrange 4:25 (11.125..11.25)
+ -0x0.9230d1ef705cb8p-11, 0x0.d1426e4767d1b0p-19, -0x0.96620304038738p-26, 0x0.d90a7f11498588p-34, -0x0.9d482a37e03790p-41, 0x0.e4ecc700e8b298p-49, -0x0.a7559b7690b558p-56, 0x0.f5adfe6611ffd0p-64, // x in subrange 4:26 (11.25..11.375)
+ -0x0.8ef9abe5efd018p-11, 0x0.ca5dc6cdc93af0p-19, -0x0.8fc9bd0e585bc8p-26, 0x0.cd295f2e44da48p-34, -0x0.92f798b99c5a28p-41, 0x0.d36f886df86400p-49, -0x0.98bed6ed2d0a68p-56, 0x0.dd9e30dc8d4338p-64, // x in subrange 4:27 (11.375..11.5)
+ -0x0.8bdd7d1f5da720p-11, 0x0.c3c6150a0175d0p-19, -0x0.898d5c49cd03f8p-26, 0x0.c20e962a356160p-34, -0x0.896fa55253a4b8p-41, 0x0.c3767796c0f870p-49, -0x0.8b93d44540af00p-56, 0x0.c828091945e948p-64, // x in subrange 4:28 (11.5..11.625)
+ -0x0.88db1a31bfb678p-11, 0x0.bd772e78d99a28p-19, -0x0.83a6ead7bf0f58p-26, 0x0.b7ab2795e09020p-34, -0x0.809f03baeb1c68p-41, 0x0.b4dbfb37a0e120p-49, -0x0.ff5af7bab8af40p-57, 0x0.b4fcf37c36b6b0p-64, // x in subrange 4:29 (11.625..11.75)
+ -0x0.85f167d1c5ba40p-11, 0x0.b76d2d634b0028p-19, -0x0.fc21cb05c343b0p-27, 0x0.adf15ffd894d80p-34, -0x0.f0ec247d707d98p-42, 0x0.a77e7ec42d5900p-49, -0x0.e9d299eb1bd2f8p-57, 0x0.a3d868f6b36788p-64, // x in subrange 4:30 (11.75..11.875)
+ -0x0.831f59ca083fc0p-11, 0x0.b1a46bba37e168p-19, -0x0.f18c63efa0f518p-27, 0x0.a4d4b5644c8cc8p-34, -0x0.e1cd58c7cb6d00p-42, 0x0.9b3ffa4b991478p-49, -0x0.d65190802974b0p-57, 0x0.947e8d117ed8b0p-64, // x in subrange 4:31 (11.875..12)
+};
+// clang-format on
+//--- End of autogenerated code
+
+//! Compute Im w(x) by Chebyshev interpolation within certain subranges.
+//! Coefficients are read from the avove lookup table.
+//! This allows us to compute the within-subrange coordinate t = (x -
+//! center_of_range) / half_range by integer and bitwise operations without any
+//! rounding.
+
+static inline CERF_INLINE_CONSTEXPR double cerf_inline_im_w_of_x_cheb(double x) {
+    // Application-specific constants:
+    const int M = 6;  // 2^M subranges
+    const int j0 = 0; // first octave runs from 2^(j0-1) to 2^j0
+    const int l0 = 0; // index of x_min in full first octave
+    const int loff = (j0 + 1) * (1 << M) + l0; // precomputed offset
+
+    // For given x, obtain mantissa xm and exponent je:
+    int je;                          // will be set in next line
+    const double xm = cerf_inline_frexp2(x, &je); // from math.h; sets xm and je
+
+    // Integer arithmetics to obtain reduced coordinate t:
+    const int ip = (int)((1 << (M+1)) * xm);   // index in octave + 2^M
+    const int lij = je * (1 << M) + ip - loff; // index in lookup table
+    const double t = (1 << (M+2)) * xm - (1 + 2 * ip);
+
+    SET_NTER(lij);
+
+    const double *const P = CerfImwxCoeffs1 + (lij * 8);
+    const double *const Q = CerfImwxCoeffs0 + (lij * 1);
+
+    // hard-coded for N1cheb=9
+    return cerf_inline_poly7(P, t) * t + Q[0];
+}
+
+
+/******************************************************************************/
+/*  im_w_of_x: uniform table path                                             */
+/******************************************************************************/
+
+//--- The following code is generated by dev/1d/pro_uniform_chebcoeffs.py imwx; do not edit
+// clang-format off
+static CERF_INLINE_CONST int CerfImwxUniformOctaves[57 * 2] = {
+       0,  1, // octave -28 (1.86265e-09..3.72529e-09)
+       1,  1, // octave -27 (3.72529e-09..7.45058e-09)
+       2,  1, // octave -26 (7.45058e-09..1.49012e-08)
+       3,  1, // octave -25 (1.49012e-08..2.98023e-08)
+       4,  1, // octave -24 (2.98023e-08..5.96046e-08)
+       5,  1, // octave -23 (5.96046e-08..1.19209e-07)
+       6,  1, // octave -22 (1.19209e-07..2.38419e-07)
+       7,  1, // octave -21 (2.38419e-07..4.76837e-07)
+       8,  1, // octave -20 (4.76837e-07..9.53674e-07)
+       9,  1, // octave -19 (9.53674e-07..1.90735e-06)
+      10,  1, // octave -18 (1.90735e-06..3.8147e-06)
+      11,  1, // octave -17 (3.8147e-06..7.62939e-06)
+      12,  1, // octave -16 (7.62939e-06..1.52588e-05)
+      13,  1, // octave -15 (1.52588e-05..3.05176e-05)
+      14,  1, // octave -14 (3.05176e-05..6.10352e-05)
+      15,  1, // octave -13 (6.10352e-05..0.00012207)
+      16,  1, // octave -12 (0.00012207..0.000244141)
+      17,  1, // octave -11 (0.000244141..0.000488281)
+      18,  1, // octave -10 (0.000488281..0.000976562)
+      19,  1, // octave -9 (0.000976562..0.00195312)
+      20,  1, // octave -8 (0.00195312..0.00390625)
+      21,  1, // octave -7 (0.00390625..0.0078125)
+      22,  1, // octave -6 (0.0078125..0.015625)
+      23,  1, // octave -5 (0.015625..0.03125)
+      24,  1, // octave -4 (0.03125..0.0625)
+      25,  1, // octave -3 (0.0625..0.125)
+      26,  2, // octave -2 (0.125..0.25)
+      28,  4, // octave -1 (0.25..0.5)
+      32,  8, // octave 0 (0.5..1)
+      40, 16, // octave 1 (1..2)
+      56, 32, // octave 2 (2..4)
+      88, 32, // octave 3 (4..8)
+     120, 32, // octave 4 (8..16)
+     152, 16, // octave 5 (16..32)
+     168, 16, // octave 6 (32..64)
+     184,  8, // octave 7 (64..128)
+     192,  8, // octave 8 (128..256)
+     200,  8, // octave 9 (256..512)
+     208,  8, // octave 10 (512..1024)
+     216,  4, // octave 11 (1024..2048)
+     220,  4, // octave 12 (2048..4096)
+     224,  4, // octave 13 (4096..8192)
+     228,  4, // octave 14 (8192..16384)
+     232,  2, // octave 15 (16384..32768)
+     234,  2, // octave 16 (32768..65536)
+     236,  2, // octave 17 (65536..131072)
+     238,  1, // octave 18 (131072..262144)
+     239,  1, // octave 19 (262144..524288)
+     240,  1, // octave 20 (524288..1.04858e+06)
+     241,  1, // octave 21 (1.04858e+06..2.09715e+06)
+     242,  1, // octave 22 (2.09715e+06..4.1943e+06)
+     243,  1, // octave 23 (4.1943e+06..8.38861e+06)
+     244,  1, // octave 24 (8.38861e+06..1.67772e+07)
+     245,  1, // octave 25 (1.67772e+07..3.35544e+07)
+     246,  1, // octave 26 (3.35544e+07..6.71089e+07)
+     247,  1, // octave 27 (6.71089e+07..1.34218e+08)
+     248,  1, // octave 28 (1.34218e+08..2.68435e+08)
+};
+alignas(64) static CERF_INLINE_CONST double CerfImwxUniformCoeffs[249 * 9] = {
+ 0x0.906eba8214db68p1, -0x0.906eba8214db68p-57, -0x0.c093a3581bcf38p-60, 0x0.e71790d0205400p-118, 0x0.9a0fb5e010ca80p-121, 0x0.bc000000000000p-156, 0x0.c0000000000000p-158, -0x0.80000000000000p-156, 0x0, // subrange -28:0 (1.86265e-09..3.72529e-09)
+ 0x0.906eba8214db68p1, -0x0.906eba8214db68p-55, -0x0.c093a3581bcf30p-58, 0x0.e71790d0215940p-114, 0x0.9a0fb5e0142ca8p-117, 0x0.b8000000000000p-157, 0x0.90000000000000p-155, -0x0.80000000000000p-157, -0x0.80000000000000p-157, // subrange -27:0 (3.72529e-09..7.45058e-09)
+ 0x0.906eba8214db68p1, -0x0.906eba8214db68p-53, -0x0.c093a3581bcf28p-56, 0x0.e71790d0215f30p-110, 0x0.9a0fb5e01636c8p-113, -0x0.a0000000000000p-159, 0x0.a0000000000000p-157, 0x0, 0x0, // subrange -26:0 (7.45058e-09..1.49012e-08)
+ 0x0.906eba8214db58p1, -0x0.906eba8214db58p-51, -0x0.c093a3581bcef8p-54, 0x0.e71790d0215ef8p-106, 0x0.9a0fb5e0163ed0p-109, -0x0.a8000000000000p-156, -0x0.80000000000000p-158, 0x0.80000000000000p-157, 0x0.80000000000000p-157, // subrange -25:0 (1.49012e-08..2.98023e-08)
+ 0x0.906eba8214db30p1, -0x0.906eba8214db28p-49, -0x0.c093a3581bce30p-52, 0x0.e71790d0215e58p-102, 0x0.9a0fb5e0163de0p-105, -0x0.d2000000000000p-155, 0x0.a0000000000000p-157, 0x0, 0x0, // subrange -24:0 (2.98023e-08..5.96046e-08)
+ 0x0.906eba8214da90p1, -0x0.906eba8214da68p-47, -0x0.c093a3581bcb28p-50, 0x0.e71790d0215c28p-98, 0x0.9a0fb5e0163990p-101, -0x0.c5780000000000p-149, -0x0.c0000000000000p-153, -0x0.80000000000000p-157, 0x0.80000000000000p-156, // subrange -23:0 (5.96046e-08..1.19209e-07)
+ 0x0.906eba8214d808p1, -0x0.906eba8214d758p-45, -0x0.c093a3581bbef8p-48, 0x0.e71790d0215370p-94, 0x0.9a0fb5e0162828p-97, -0x0.c6196000000000p-143, -0x0.afa80000000000p-147, 0x0.80000000000000p-157, -0x0.80000000000000p-157, // subrange -22:0 (1.19209e-07..2.38419e-07)
+ 0x0.906eba8214cde0p1, -0x0.906eba8214cb28p-43, -0x0.c093a3581b8e38p-46, 0x0.e71790d02130a0p-90, 0x0.9a0fb5e015e288p-93, -0x0.c6141a00000000p-137, -0x0.b0114000000000p-141, -0x0.80000000000000p-156, 0x0, // subrange -21:0 (2.38419e-07..4.76837e-07)
+ 0x0.906eba8214a540p1, -0x0.906eba82149a68p-41, -0x0.c093a3581acb38p-44, 0x0.e71790d020a558p-86, 0x0.9a0fb5e014cbf8p-89, -0x0.c6143302000000p-131, -0x0.b011f480000000p-135, 0x0, 0x0.80000000000000p-157, // subrange -20:0 (4.76837e-07..9.53674e-07)
+ 0x0.906eba821402c0p1, -0x0.906eba8213d770p-39, -0x0.c093a35817bf50p-42, 0x0.e71790d01e7840p-82, 0x0.9a0fb5e01071c8p-85, -0x0.c61432fa380000p-125, -0x0.b011f440000000p-129, -0x0.80000000000000p-156, -0x0.80000000000000p-156, // subrange -19:0 (9.53674e-07..1.90735e-06)
+ 0x0.906eba821178d0p1, -0x0.906eba8210cb80p-37, -0x0.c093a3580b8f90p-40, 0x0.e71790d015c3e0p-78, 0x0.9a0fb5dfff0900p-81, -0x0.c61432fb7c0000p-119, -0x0.b011f46d480000p-123, 0x0, -0x0.80000000000000p-157, // subrange -18:0 (1.90735e-06..3.8147e-06)
+ 0x0.906eba82075108p1, -0x0.906eba82049bc0p-35, -0x0.c093a357dad098p-38, 0x0.e71790cff2f250p-74, 0x0.9a0fb5dfb965e8p-77, -0x0.c61432fb509980p-113, -0x0.b011f46d344000p-117, 0x0.f0000000000000p-153, 0x0, // subrange -17:0 (3.8147e-06..7.62939e-06)
+ 0x0.906eba81deb1e0p1, -0x0.906eba81d3dcc8p-33, -0x0.c093a35717d4b0p-36, 0x0.e71790cf67ac20p-70, 0x0.9a0fb5dea2d980p-73, -0x0.c61432faa33970p-107, -0x0.b011f46b680680p-111, 0x0.eab00000000000p-145, 0x0.9c800000000000p-149, // subrange -16:0 (7.62939e-06..1.52588e-05)
+ 0x0.906eba813c3550p1, -0x0.906eba8110e0e8p-31, -0x0.c093a3540be528p-34, 0x0.e71790cd3a9350p-66, 0x0.9a0fb5da48a7e0p-69, -0x0.c61432f7edf338p-101, -0x0.b011f4642f4cf0p-105, 0x0.eac2a000000000p-137, 0x0.9c818000000000p-141, // subrange -15:0 (1.52588e-05..3.05176e-05)
+ 0x0.906eba7eb24308p1, -0x0.906eba7e04f160p-29, -0x0.c093a347dc2708p-32, 0x0.e71790c4863010p-62, 0x0.9a0fb5c8dfe168p-65, -0x0.c61432ed18d870p-95, -0x0.b011f4474c5af8p-99, 0x0.eac29b28000000p-129, 0x0.9c81bc00000000p-133, // subrange -14:0 (3.05176e-05..6.10352e-05)
+ 0x0.906eba748a79f0p1, -0x0.906eba71d53338p-27, -0x0.c093a3171d2e80p-30, 0x0.e71790a1b4a320p-58, 0x0.9a0fb5833cc788p-61, -0x0.c61432c1c46d50p-89, -0x0.b011f3d3c092a8p-93, 0x0.eac29ae0e80000p-121, 0x0.9c81bc1f000000p-125, // subrange -13:0 (6.10352e-05..0.00012207)
+ 0x0.906eba4beb5580p1, -0x0.906eba41163ac0p-25, -0x0.c093a254214cb8p-28, 0x0.e71790166e6f80p-54, 0x0.9a0fb46cb060a0p-57, -0x0.c614321472c110p-83, -0x0.b011f2059172c8p-87, 0x0.eac299cc9ac800p-113, 0x0.9c81b9fea88000p-117, // subrange -12:0 (0.00012207..0.000244141)
+ 0x0.906eb9a96ec468p1, -0x0.906eb97e1a5978p-23, -0x0.c0939f4831ca18p-26, 0x0.e7178de955a3f0p-50, 0x0.9a0fb0127ece88p-53, -0x0.c6142f5f2c14e0p-77, -0x0.b011eaccd507f8p-81, 0x0.eac2957b2a20c0p-105, 0x0.9c81b180754000p-109, // subrange -11:0 (0.000244141..0.000488281)
+ 0x0.906eb71f7c8888p1, -0x0.906eb6722adf68p-21, -0x0.c0939318740908p-24, 0x0.e7178534f2a350p-46, 0x0.9a0f9ea9b91e88p-49, -0x0.c614248a11aeb8p-71, -0x0.b011cde9e4a908p-75, 0x0.eac28435680790p-97, 0x0.9c818f87aba9a0p-101, // subrange -10:0 (0.000488281..0.000976562)
+ 0x0.906eacf7b42230p1, -0x0.906eaa426da778p-19, -0x0.c0936259819bf8p-22, 0x0.e7176263697c00p-42, 0x0.9a0f5906abe3d8p-45, -0x0.c613f935acc158p-65, -0x0.b0115a5e37f268p-69, 0x0.eac23f1e696148p-89, 0x0.9c8107a4a49030p-93, // subrange -9:0 (0.000976562..0.00195312)
+ 0x0.906e84589b1a60p1, -0x0.906e798383cbf8p-17, -0x0.c0929f5e0159a0p-20, 0x0.e716d71d7291d0p-38, 0x0.9a0e427b0f4d90p-41, -0x0.c6134be463bfb8p-59, -0x0.b00f8c30d16878p-63, 0x0.eac12ac30aaef0p-81, 0x0.9c7ee81a7c2b58p-85, // subrange -8:0 (0.00195312..0.00390625)
+ 0x0.906de1dcc013b0p1, -0x0.906db6888ca230p-15, -0x0.c08f9374976af8p-18, 0x0.e714aa08721640p-34, 0x0.9a09e8562231b0p-37, -0x0.c61096a3eaf1c8p-53, -0x0.b008538ffc2b80p-57, 0x0.eabcd95f4e4358p-73, 0x0.9c766a111a6b70p-77, // subrange -7:0 (0.00390625..0.0078125)
+ 0x0.906b57f5e56db8p1, -0x0.906aaaa7b42210p-13, -0x0.c0836418604dd0p-16, 0x0.e70bf5e2225ec0p-30, 0x0.99f8805abeb568p-33, -0x0.c605c1ecba0440p-47, -0x0.afeb7258ee1e88p-51, 0x0.eaab946c3f1348p-65, 0x0.9c5473df81e080p-69, // subrange -6:0 (0.0078125..0.015625)
+ 0x0.906130e38cb658p1, -0x0.905e7bd48d57d8p-11, -0x0.c052ab3e4a3a10p-14, 0x0.e6e92823df7d98p-26, 0x0.99b2e9f187fce0p-29, -0x0.c5da73bacb78a0p-41, -0x0.af78023f332538p-45, 0x0.ea668a5d5233e0p-57, 0x0.9bccba54565900p-61, // subrange -5:0 (0.015625..0.03125)
+ 0x0.90389d29ed1218p1, -0x0.902dcb89d72bb0p-9, -0x0.bf9011317d1118p-12, 0x0.e65e1ed0b9cd80p-22, 0x0.989d28642b11d0p-25, -0x0.c52d858c895500p-35, -0x0.adab8d83ebb3c0p-39, 0x0.e952fdc0a95750p-49, 0x0.99afc6ef30abf0p-53, // subrange -4:0 (0.03125..0.0625)
+ 0x0.8f96d6e919b640p1, -0x0.8f6bba09ef8448p-7, -0x0.bc8a3a8301daa0p-10, 0x0.e434d16d906700p-18, 0x0.944f9832848a00p-21, -0x0.c27e717804c440p-29, -0x0.a68e5663269bf8p-33, 0x0.e50e77cef8dee0p-41, 0x0.915aeb2254a188p-45, // subrange -3:0 (0.0625..0.125)
+ 0x0.8e1ac334f29628p1, -0x0.ec117230b70470p-7, -0x0.b57cdadcbe5e08p-10, 0x0.b9f61387088ba8p-17, 0x0.8a582ac70ea298p-21, -0x0.9cdf53ca006b60p-28, -0x0.963301f7149078p-33, 0x0.b6d377ed0a53b8p-40, 0x0.fcea593915cda0p-46, // subrange -2:0 (0.125..0.1875)
+ 0x0.8be977bf41ae50p1, -0x0.a22f3a7f9d6f40p-6, -0x0.ab339c97f2cb78p-10, 0x0.fbb74244266a48p-17, 0x0.f7fd1f0b415cb8p-22, -0x0.d108bff170e078p-28, -0x0.fdead8629d31e8p-34, 0x0.efb44f35564748p-40, 0x0.c7ef9fe1c4ee08p-46, // subrange -2:1 (0.1875..0.25)
+ 0x0.890d369c650878p1, -0x0.cb649fe4579ab8p-6, -0x0.9e04425f86bc98p-10, 0x0.9aab23d43d1d58p-16, 0x0.d3e05a06106db8p-22, -0x0.fb68deb0530728p-28, -0x0.c48c811e26b4a0p-34, 0x0.8ced8ebda42ed0p-39, 0x0.87d6e2ad20b8a8p-46, // subrange -1:0 (0.25..0.3125)
+ 0x0.85932622f8b488p1, -0x0.f0fc7601cd1498p-6, -0x0.8e5ab729af1720p-10, 0x0.b296696c169eb8p-16, 0x0.aa061a56c44ce8p-22, -0x0.8d23688e695908p-27, -0x0.83c72a114d6548p-34, 0x0.998be7752c94d0p-39, 0x0.82e499fa96da88p-47, // subrange -1:1 (0.3125..0.375)
+ 0x0.818ae56badda58p1, -0x0.8933c3259cf390p-5, -0x0.f968210201ff88p-11, 0x0.c5038a7cac2718p-16, 0x0.f8a3829f417038p-23, -0x0.964d2abbeeb010p-27, -0x0.fdbb32a48d44f8p-36, 0x0.9d3dbf09796680p-39, -0x0.c331b1792a0438p-51, // subrange -1:2 (0.375..0.4375)
+ 0x0.fa0c1f68b69be8p0, -0x0.979bb7e246b450p-5, -0x0.d331d712dfcf40p-11, 0x0.d19705ce4134d0p-16, 0x0.9982e9a6c92ac0p-23, -0x0.990ac7595b0658p-27, 0x0.930aa9429005f8p-39, 0x0.982f5bf5cef158p-39, -0x0.939016fccf7b58p-47, // subrange -1:3 (0.4375..0.5)
+ 0x0.ff325f0c8e6660p-1, 0x0.994ab2857e1098p-5, -0x0.d108de5d322bd8p-10, -0x0.e14a976ad17250p-18, 0x0.dffed26b3f3550p-21, -0x0.c88f19ab409d98p-29, -0x0.8c738ae50d6810p-32, 0x0.8e76dbc23087f0p-39, 0x0.f2ef9e5f7e4120p-45, // subrange 0:0 (0.5..0.5625)
+ 0x0.885b7e4f663c88p0, 0x0.fde19e0bc09e48p-6, -0x0.d3ba793ae36b58p-10, -0x0.d164b1fa729288p-23, 0x0.d436cd04865650p-21, -0x0.c6fc633c2b5760p-28, -0x0.f391c6dc1c7050p-33, 0x0.c435a6500f5930p-39, 0x0.b938a006116380p-45, // subrange 0:1 (0.5625..0.625)
+ 0x0.8f772c2003a4a8p0, 0x0.c922163449dde0p-6, -0x0.d1765b692be148p-10, 0x0.c4c35a0f010918p-18, 0x0.c1525505e895e0p-21, -0x0.8cd8afd4b91188p-27, -0x0.c4244df5d0d018p-33, 0x0.ea5f45eeb4a530p-39, 0x0.ee574ecb51ac60p-46, // subrange 0:2 (0.625..0.6875)
+ 0x0.94f0ae5b2219e8p0, 0x0.9586f4c2516398p-6, -0x0.caad2e50f75990p-10, 0x0.bd17fd17ee6ce8p-17, 0x0.a8b2ded6a44520p-21, -0x0.aca3a359af72e0p-27, -0x0.8e356a1fe8fc40p-33, 0x0.ff8f846f8cd6c0p-39, 0x0.c95342552712a8p-47, // subrange 0:3 (0.6875..0.75)
+ 0x0.98d57ec8f34220p0, 0x0.c83f7ba8b67ef0p-7, -0x0.bff1e4efe6e6c8p-10, 0x0.85317a96eafd70p-16, 0x0.8bea910cef1e38p-21, -0x0.c200947521ffb8p-27, -0x0.ab063cec8907a8p-34, 0x0.81e0908b124720p-38, -0x0.ff5140b8071dc0p-49, // subrange 0:4 (0.75..0.8125)
+ 0x0.9b3af74213e328p0, 0x0.d74f9e25413d60p-8, -0x0.b1f05cf001c488p-10, 0x0.a44bce326692c0p-16, 0x0.d940c3e579c5e8p-22, -0x0.ccc27f13223670p-27, -0x0.ed4384b88379c8p-36, 0x0.f8316afc48c9b8p-39, -0x0.960b22e2a51570p-46, // subrange 0:5 (0.8125..0.875)
+ 0x0.9c3cfb9a47a7e0p0, 0x0.b5dd9f90fad5a8p-10, -0x0.a163825f22c260p-10, 0x0.bb6f018cdd6ee0p-16, 0x0.98ea6b569e5d80p-22, -0x0.cd60fa1d9c3e10p-27, 0x0.b11d22ede16108p-36, 0x0.df29b42b07c860p-39, -0x0.f66a7cf52225f8p-46, // subrange 0:6 (0.875..0.9375)
+ 0x0.9bfc8568740958p0, -0x0.d5bcd76371b300p-9, -0x0.8f0b965deea700p-10, 0x0.ca940981953eb8p-16, 0x0.b3af870cb551c0p-23, -0x0.c4e06f59d11df8p-27, 0x0.8682341e6aa958p-34, 0x0.bbb62ab54f33d8p-39, -0x0.9e1b121062bb50p-45, // subrange 0:7 (0.9375..1)
+ 0x0.9a9e25068cb6c8p0, -0x0.f045bacac410f0p-8, -0x0.f74a4fe4d2e140p-11, 0x0.d20eb60f184260p-16, 0x0.f559212a5d0818p-25, -0x0.b4b25cf6f122d0p-27, 0x0.cf910d79bc09c0p-34, 0x0.9152db48d2a290p-39, -0x0.b2a1aea2fda2a0p-45, // subrange 1:0 (1..1.0625)
+ 0x0.984889c4399cd0p0, -0x0.b104e1645140f0p-7, -0x0.cfc2684596ca48p-11, 0x0.d27f61d42e7d38p-16, -0x0.b3c755d37a15b8p-25, -0x0.9e91012e583288p-27, 0x0.829a56c81455f0p-33, 0x0.c72f85b59c3da0p-40, -0x0.b8fa2fe2ac2ca8p-45, // subrange 1:1 (1.0625..1.125)
+ 0x0.952320fdc69610p0, -0x0.e00f1d1ac610f8p-7, -0x0.a8bd852812aa88p-11, 0x0.ccc1cb027ed6d8p-16, -0x0.88051b258239f8p-23, -0x0.8459dae4bd9760p-27, 0x0.935c4b261cbea8p-33, 0x0.d7afeb294f6238p-41, -0x0.b2719f69039760p-45, // subrange 1:2 (1.125..1.1875)
+ 0x0.9154d8d5b09fe8p0, -0x0.82c2b709699e00p-6, -0x0.834c6297e88780p-11, 0x0.c1da8a21b9fbf8p-16, -0x0.d1ebeb824465f8p-23, -0x0.cfd441e2275cf0p-28, 0x0.9a6787fd37b010p-33, 0x0.b46684bc8d2ed8p-43, -0x0.a130d093c87c38p-45, // subrange 1:3 (1.1875..1.25)
+ 0x0.8d030ff697b048p0, -0x0.90f4c7c775fa10p-6, -0x0.c098ffeb407108p-12, 0x0.b2e487d17acfe0p-16, -0x0.84e84e0eb52518p-22, -0x0.95ff8af81d5110p-28, 0x0.98aaab89057548p-33, -0x0.cffe5d24ad7d70p-42, -0x0.87efcbe0835d58p-45, // subrange 1:4 (1.25..1.3125)
+ 0x0.8850b849844570p0, -0x0.9af6f482d387e0p-6, -0x0.80cb3006789940p-12, 0x0.a0ffa5da276d38p-16, -0x0.97f1eed9d99430p-22, -0x0.bc838827361028p-29, 0x0.8f84135af0aa10p-33, -0x0.e1141208042010p-41, -0x0.d34c3f0e4bd5d0p-46, // subrange 1:5 (1.3125..1.375)
+ 0x0.835daf2f509c08p0, -0x0.a1340f61d20040p-6, -0x0.9028a2f447a018p-13, 0x0.8d4190728165b0p-16, -0x0.a29a0a63e6a218p-22, -0x0.ac54dbca149908p-30, 0x0.8098a280e414d0p-33, -0x0.9d4b314801a060p-40, -0x0.928100a5d6f628p-46, // subrange 1:6 (1.375..1.4375)
+ 0x0.fc8c957ef88698p-1, -0x0.a4220d1ca69de8p-6, -0x0.b7a923ce3ceed8p-15, 0x0.f152c532d9ca60p-17, -0x0.a5be369468fbd0p-22, 0x0.d83d137b923080p-35, 0x0.db56253c8716d0p-34, -0x0.b9e203d87b1500p-40, -0x0.a5899349a0a630p-47, // subrange 1:7 (1.4375..1.5)
+ 0x0.f24631f36fd598p-1, -0x0.a43c0ef13310b8p-6, 0x0.935c4ede65bc48p-15, 0x0.c82cf731491488p-17, -0x0.a278322f99d370p-22, 0x0.9b89d87726c6a0p-30, 0x0.b0ee6984d32628p-34, -0x0.c722e19d9004a8p-40, -0x0.c38025e5594168p-49, // subrange 1:8 (1.5..1.5625)
+ 0x0.e81197a5cad458p-1, -0x0.a1fd2958231768p-6, 0x0.d0cf11f568c630p-14, 0x0.a085365b0c9b68p-17, -0x0.9a04098f357c98p-22, 0x0.87e8585ee6e7d0p-29, 0x0.85274812c24f88p-34, -0x0.c6d44c5c85e9b0p-40, 0x0.ca557f286ce4a0p-49, // subrange 1:9 (1.5625..1.625)
+ 0x0.de109739e503d8p-1, -0x0.9ddc0ae7732f30p-6, 0x0.9d8f6b55c708d0p-13, 0x0.f6fc6be53bddb0p-18, -0x0.8da85f8259acf8p-22, 0x0.b1cdd8015acd68p-29, 0x0.b56db5804940c0p-35, -0x0.bb625b22c80a58p-40, 0x0.80e33f55e6a278p-47, // subrange 1:10 (1.625..1.6875)
+ 0x0.d45dd0f1fc5140p-1, -0x0.984794377fe9c8p-6, 0x0.c574d7359e21e0p-13, 0x0.b3d3a9fbf2bc28p-18, -0x0.fd4451af530cb0p-23, 0x0.cc616706a93f28p-29, 0x0.cf01a450301290p-36, -0x0.a79182600eb648p-40, 0x0.b86e6f724d47b8p-47, // subrange 1:11 (1.6875..1.75)
+ 0x0.cb0d46807b72d0p-1, -0x0.91a46121645b70p-6, 0x0.e17e1a0bfd4020p-13, 0x0.f136882b00f090p-19, -0x0.dc2955a928d430p-23, 0x0.d93eafbb279eb0p-29, 0x0.8e480aa598c148p-37, -0x0.8e37d6d7813690p-40, 0x0.d9a87c812173c0p-47, // subrange 1:12 (1.75..1.8125)
+ 0x0.c22d0d0bcecb20p-1, -0x0.8a4b3613371f58p-6, 0x0.f3367a9e7b5ae0p-13, 0x0.8bab32f63916f8p-19, -0x0.b9fc26ccc34550p-23, 0x0.da75d7ee759618p-29, -0x0.a45a76fcf92b90p-38, -0x0.e4040df4b16e48p-41, 0x0.e6a29c33592488p-47, // subrange 1:13 (1.8125..1.875)
+ 0x0.b9c611d3d3c530p-1, -0x0.828839ef43f210p-6, 0x0.fc367271170160p-13, 0x0.dc85f31d23dfd0p-21, -0x0.98612eaf8e0c70p-23, 0x0.d2539c04f31be8p-29, -0x0.803c020995b3f8p-36, -0x0.aa8e515520f070p-41, 0x0.e29020c032d4b0p-47, // subrange 1:14 (1.875..1.9375)
+ 0x0.b1dce59c7d46c0p-1, -0x0.f535bc1fb3b1d0p-7, 0x0.fe0ffe4ade7190p-13, -0x0.d055b300bd6c58p-23, -0x0.f13eb887a950b0p-24, 0x0.c33056752c0498p-29, -0x0.beb5e96ef24ad8p-36, -0x0.e7b1bd16aed960p-42, 0x0.d147cf88ed9d90p-47, // subrange 1:15 (1.9375..2)
+ 0x0.aa728508b940e0p-1, -0x0.e56ca4d63a53d0p-7, 0x0.fa3f498367f178p-13, -0x0.83e8b466b5a370p-20, -0x0.b7431de7575a20p-24, 0x0.af4846dadcc9e0p-29, -0x0.e65f94a5e3d368p-36, -0x0.856074ddad38c0p-42, 0x0.b6d0902d2732f8p-47, // subrange 2:0 (2..2.0625)
+ 0x0.a385163a8f3228p-1, -0x0.d604c619c86898p-7, 0x0.f21fa4a1ba6df8p-13, -0x0.d26c8bfda21680p-20, -0x0.83fad35b0ec078p-24, 0x0.989e2dfdcb4f98p-29, -0x0.fa15ce26078490p-36, -0x0.c71b0105f17188p-44, 0x0.97022fc4bdf6c0p-47, // subrange 2:1 (2.0625..2.125)
+ 0x0.9d1096306484f8p-1, -0x0.c7393b50bc1f68p-7, 0x0.e6e4770a993418p-13, -0x0.848d8d674219e8p-19, -0x0.aff7b52eb6b1c0p-25, 0x0.80e83fb15df360p-29, -0x0.fd4be64ac1e250p-36, 0x0.8a7253767084b8p-45, 0x0.ea7e1748cc9820p-48, // subrange 2:2 (2.125..2.1875)
+ 0x0.970f7252f76a28p-1, -0x0.b933428facf2b8p-7, 0x0.d995ae11b1cce8p-13, -0x0.95d21c1ff43f68p-19, -0x0.cd825b79465080p-26, 0x0.d30d242b82bca8p-30, -0x0.f3ad4f72291808p-36, 0x0.87374677349e58p-43, 0x0.a88fbbcb553a38p-48, // subrange 2:3 (2.1875..2.25)
+ 0x0.917b0c65353e10p-1, -0x0.ac0cfd0adefb08p-7, 0x0.cb0f10ecc46170p-13, -0x0.9ed5db5de94710p-19, -0x0.af1915adae8820p-27, 0x0.a70336e7500808p-30, -0x0.e0d0b37ccc13a8p-36, 0x0.cc233d1a5f7508p-43, 0x0.d89fd55eba1378p-49, // subrange 2:4 (2.25..2.3125)
+ 0x0.8c4c2879156cf8p-1, -0x0.9fd4275e820240p-7, 0x0.bc01d6a6abb700p-13, -0x0.a15000778c5340p-19, 0x0.83f4f2b0547810p-31, 0x0.fe3bf0052be108p-31, -0x0.c7feb4cca76e60p-36, 0x0.f4f15cb90c7dc0p-43, 0x0.e1b05d9a97cb68p-50, // subrange 2:5 (2.3125..2.375)
+ 0x0.877b45adc461b0p-1, -0x0.948caa97db50d0p-7, 0x0.acf7de43bdee80p-13, -0x0.9ececcd9c3d9a8p-19, 0x0.90c78191c84238p-27, 0x0.b86ae064e26310p-31, -0x0.ac0c4e1d329350p-36, 0x0.831aadf72ebe90p-42, 0x0.e4976f52f9bf18p-52, // subrange 2:6 (2.375..2.4375)
+ 0x0.8300e34d10b668p-1, -0x0.8a32f0885e2de0p-7, 0x0.9e57f66d0e2910p-13, -0x0.98af09bb5bc1c8p-19, 0x0.f100ccb18c9660p-27, 0x0.fa98f1cf66bc28p-32, -0x0.8f470fde316ae0p-36, 0x0.827730ce77ada8p-42, -0x0.8e2c81fbde8858p-51, // subrange 2:7 (2.4375..2.5)
+ 0x0.fdab68cd4a7fc0p-2, -0x0.80bdee7ea24b80p-7, 0x0.906ab5c6809ec0p-13, -0x0.9018542c46cfe8p-19, 0x0.97d0530618d1b0p-26, 0x0.99ae675b810db0p-32, -0x0.e6e0b3b508fb88p-37, 0x0.f60d55c1940a38p-43, -0x0.a1065b4e88d990p-50, // subrange 2:8 (2.5..2.5625)
+ 0x0.f5e588a1d52730p-2, -0x0.f041c16db5c028p-8, 0x0.835f7c70e51c10p-13, -0x0.85fd371ed3c798p-19, 0x0.a9939c2c53f2a0p-26, 0x0.99c99b0e29a080p-33, -0x0.b3883a1db65168p-37, 0x0.de1bda8b5a2558p-43, -0x0.d8f289f44de2b8p-50, // subrange 2:9 (2.5625..2.625)
+ 0x0.eea31d1a0a0418p-2, -0x0.e0996d135cb4d0p-8, 0x0.eea29f0eb47050p-14, -0x0.f63c25cb1f8350p-20, 0x0.b0ca8646277fc8p-26, 0x0.925bc984b45430p-35, -0x0.860f2d788ebbb0p-37, 0x0.c10313febcaf48p-43, -0x0.f47586a0766f60p-50, // subrange 2:10 (2.625..2.6875)
+ 0x0.e7d818f2b42870p-2, -0x0.d262672e198138p-8, 0x0.d896ad3fda0cd0p-14, -0x0.e01bcb8c872868p-20, 0x0.b01e36e664e9c0p-26, -0x0.c3dd2859ef8ec0p-35, -0x0.be72da77436198p-38, 0x0.a1eeaa25613900p-43, -0x0.f9ae37d3ce2dc8p-50, // subrange 2:11 (2.6875..2.75)
+ 0x0.e179761fcf8c98p-2, -0x0.c57b9a009745b8p-8, 0x0.c499b0240b4158p-14, -0x0.ca70528413b2d8p-20, 0x0.a9d505374ce558p-26, -0x0.d7e5d390c78ab0p-34, -0x0.fcbb005d63be18p-39, 0x0.8346cce82b1ca8p-43, -0x0.ee9ee88fa2e928p-50, // subrange 2:12 (2.75..2.8125)
+ 0x0.db7d355ba8d430p-2, -0x0.b9c496d152b720p-8, 0x0.b2994457e320b8p-14, -0x0.b5ce3b9f075c98p-20, 0x0.9fcff0dc84d300p-26, -0x0.915e310c18e240p-33, -0x0.96929eac4c36a8p-39, 0x0.cd76a56be144b8p-44, -0x0.d8bc3db54371d0p-50, // subrange 2:13 (2.8125..2.875)
+ 0x0.d5da5531502d08p-2, -0x0.af1e763bf654d0p-8, 0x0.a277ba774718d0p-14, -0x0.a2940c98f36348p-20, 0x0.938ecfae0397d8p-26, -0x0.a5e4b8c2f66c20p-33, -0x0.902364c0441e70p-40, 0x0.9ab4448dca7018p-44, -0x0.bca8b3038b60b8p-50, // subrange 2:14 (2.875..2.9375)
+ 0x0.d088c354eb5f10p-2, -0x0.a56c676f1d5270p-8, 0x0.941098d0109cf8p-14, -0x0.90f5f3b9eedbc0p-20, 0x0.8638f9efe9b578p-26, -0x0.adaecc4c140218p-33, -0x0.e2dff08d9ec550p-43, 0x0.deaee928c47698p-45, -0x0.9e15f909f7b6b0p-50, // subrange 2:15 (2.9375..3)
+ 0x0.cb814a8bd3e340p-2, -0x0.9c93ffbe1b6cf0p-8, 0x0.873c144136b758p-14, -0x0.810827e1ef8090p-20, 0x0.f15120c4fa4c08p-27, -0x0.ac4aa4c87c63b8p-33, 0x0.d35546f34bb268p-42, 0x0.97467ad8fbfaa8p-45, -0x0.ff879a5ca0c678p-51, // subrange 2:16 (3..3.0625)
+ 0x0.c6bd7ee257ba30p-2, -0x0.947d5a0fafe9a8p-8, 0x0.f7a3436f631980p-15, -0x0.e58f95d7c66e08p-21, 0x0.d6edb0b4ddad38p-27, -0x0.a4a68d934d5c90p-33, 0x0.d41501bd80c568p-41, 0x0.bd1c4a2246b628p-46, -0x0.c7271047a96e80p-51, // subrange 2:17 (3.0625..3.125)
+ 0x0.c237a97965c308p-2, -0x0.8d13137b5707c0p-8, 0x0.e3538a29fca958p-15, -0x0.cc447d898568b0p-21, 0x0.be1117e62639d8p-27, -0x0.99172e72613530p-33, 0x0.89694a20009a48p-40, 0x0.cc94ac6e7be328p-47, -0x0.95508ca376ce48p-51, // subrange 2:18 (3.125..3.1875)
+ 0x0.bdeab4d52206a0p-2, -0x0.86423016c85ef8p-8, 0x0.d13e847c439140p-15, -0x0.b5f5f81bc4d130p-21, 0x0.a732ada0e95888p-27, -0x0.8b65c00cb9e498p-33, 0x0.9862db2ce9fec0p-40, 0x0.9a0765c54ff488p-48, -0x0.d6335e427bb0c0p-52, // subrange 2:19 (3.1875..3.25)
+ 0x0.b9d21a46588fc0p-2, -0x0.fff3e173f950c8p-9, 0x0.c11fa5564fa3c8p-15, -0x0.a2601a24543e30p-21, 0x0.928c0b1aa0d760p-27, -0x0.f9c54ed8f07c78p-34, 0x0.9b94d1a7f18730p-40, -0x0.c428a3bce27f88p-51, -0x0.9168e885bcb780p-52, // subrange 2:20 (3.25..3.3125)
+ 0x0.b5e9d0cadc3f58p-2, -0x0.f45740efe831b8p-9, 0x0.b2b8fbed7ed188p-15, -0x0.913ab603114910p-21, 0x0.802a58bf4cf238p-27, -0x0.dcf37c2619a2f8p-34, 0x0.96c32b93991258p-40, -0x0.8dc8d5bd384ef8p-48, -0x0.b6d81c8f8ebd60p-53, // subrange 2:21 (3.3125..3.375)
+ 0x0.b22e3d922e3330p-2, -0x0.e994bd8ccf8630p-9, 0x0.a5d35ebdd42860p-15, -0x0.823dff7bf77e58p-21, 0x0.dff8e1854206b8p-28, -0x0.c18c9c6bcb44d0p-34, 0x0.8ce3753e28ab50p-40, -0x0.d3d1a504046458p-48, -0x0.ca991d04d4d688p-54, // subrange 2:22 (3.375..3.4375)
+ 0x0.ae9c26321055d0p-2, -0x0.df95d3aaa9e030p-9, 0x0.9a3e3adf77d4b0p-15, -0x0.ea4b37af86acc0p-22, 0x0.c3bbfdab045fc0p-28, -0x0.a84aedf51d3370p-34, 0x0.80329de8627378p-40, -0x0.f6df91cf111ea8p-48, -0x0.a9026566e9c1a8p-55, // subrange 2:23 (3.4375..3.5)
+ 0x0.ab30a47f8a9e60p-2, -0x0.d646d6d0708cd0p-9, 0x0.8fcf2923c5ef68p-15, -0x0.d364f463d7c800p-22, 0x0.ab3fda717f9408p-28, -0x0.918c75c35748d0p-34, 0x0.e4a063077094f0p-41, -0x0.8094e9e09f9600p-47, -0x0.c969535515a4b0p-60, // subrange 2:24 (3.5..3.5625)
+ 0x0.a7e91bf2314bf0p-2, -0x0.cd9693306dd9d8p-9, 0x0.8661625a8b2e50p-15, -0x0.bf578836bfbb00p-22, 0x0.961d081a9738a8p-28, -0x0.fadba1b60a2378p-35, 0x0.c8b61d69c8fbf0p-41, -0x0.fadf6f6daa1e10p-48, 0x0.c57cb4a6d797d0p-56, // subrange 2:25 (3.5625..3.625)
+ 0x0.a4c3306f1f9960p-2, -0x0.c575f86fc0d978p-9, 0x0.fbaa4a706ad620p-16, -0x0.adbe533aae2008p-22, 0x0.83eb4b6db81f80p-28, -0x0.d7bf6f3f6e63e8p-35, 0x0.ae19d5f9448610p-41, -0x0.ea4ec3ace9f5a0p-48, 0x0.a03d8712aa9cb0p-55, // subrange 2:26 (3.625..3.6875)
+ 0x0.a1bcbe55647378p-2, -0x0.bdd7ce29d0fe10p-9, 0x0.ec1e3557bd8bd8p-16, -0x0.9e417cf4063408p-22, 0x0.e88e3bf7f7d218p-29, -0x0.b96f2f7c8f4510p-35, 0x0.95a6009f4f0b50p-41, -0x0.d4230a89193160p-48, 0x0.be362af5419a90p-55, // subrange 2:27 (3.6875..3.75)
+ 0x0.9ed3d3a522e700p-2, -0x0.b6b07200c45ea8p-9, 0x0.ddef81f96ba7c0p-16, -0x0.9095249abcca00p-22, 0x0.cda9dcec836500p-29, -0x0.9f77c7292cfc78p-35, 0x0.ff8c3fa166daa0p-42, -0x0.bbaaf5e44860e8p-48, 0x0.c66d270be47670p-55, // subrange 2:28 (3.75..3.8125)
+ 0x0.9c06aa1c47ce38p-2, -0x0.aff59ea30497c0p-9, 0x0.d0f5c545e9b9c0p-16, -0x0.847844f6358ee0p-22, 0x0.b6857d0d123538p-29, -0x0.89599d5fab40c8p-35, 0x0.d931f9e0198f80p-42, -0x0.a31f66a8048ea0p-48, 0x0.c082589fce0560p-55, // subrange 2:29 (3.8125..3.875)
+ 0x0.9953a226980bd8p-2, -0x0.a99e3af3740530p-9, 0x0.c50e36b2741378p-16, -0x0.f366ef9e0ee4e0p-23, 0x0.a2913d3796d150p-29, -0x0.ed28bf946a8180p-36, 0x0.b816d0837fe9c0p-42, -0x0.8be4858385df60p-48, 0x0.b22d0f4c4c9ec0p-55, // subrange 2:30 (3.875..3.9375)
+ 0x0.96b93e825fa368p-2, -0x0.a3a23068c11738p-9, 0x0.ba1ad858ff1a30p-16, -0x0.e02f6d5080f3e8p-23, 0x0.9150d873803418p-29, -0x0.cd5ccd2abf3fa8p-36, 0x0.9bd89e79116f20p-42, -0x0.ed843e0da118e8p-49, 0x0.9f88e15c157138p-55, // subrange 2:31 (3.9375..4)
+ 0x0.92fce58e969e28p-2, -0x0.9b43d45783a648p-8, 0x0.ab3fe1a4b17020p-14, -0x0.c70b337d8bd098p-20, 0x0.f73bf53509bad8p-26, -0x0.a692337847e910p-31, 0x0.f2f820ce778d60p-37, -0x0.b77959c4224fe8p-42, 0x0.8163c2776527d0p-47, // subrange 3:0 (4..4.125)
+ 0x0.8e4c17a249d030p-2, -0x0.911dc77a0d50f8p-8, 0x0.99f15317c20cb0p-14, -0x0.ab1e7ac8e67240p-20, 0x0.c994ab93494648p-26, -0x0.ff6dca5a86d5b8p-32, 0x0.af861de7fe89a8p-37, -0x0.803a5699622100p-42, 0x0.b96cb08e986e18p-48, // subrange 3:1 (4.125..4.25)
+ 0x0.89e85b9d1c83b0p-2, -0x0.87f90869bc5180p-8, 0x0.8b02174e2845f8p-14, -0x0.9437b245bee048p-20, 0x0.a64fa7276b7560p-26, -0x0.c6f453766f6ae8p-32, 0x0.807f6a4dd4fb80p-37, -0x0.b2c4d5d2500220p-43, 0x0.80222aca0af8f0p-48, // subrange 3:2 (4.25..4.375)
+ 0x0.85ca35759728a8p-2, -0x0.ff663317b56cf0p-9, 0x0.fc0f5c31ef3c58p-15, -0x0.8139d0fe69e658p-20, 0x0.8aa3ae0990d470p-26, -0x0.9d4b494ebffe90p-32, 0x0.bf3f3996122870p-38, -0x0.fb216f534b65c0p-44, 0x0.ae3b3b61035258p-49, // subrange 3:3 (4.375..4.5)
+ 0x0.81eb247f90bdf8p-2, -0x0.f05ec7db0f5138p-9, 0x0.e55d2f6bbfce28p-15, -0x0.e2a56d29160528p-21, 0x0.e93c08b8116490p-27, -0x0.fc137fa7f77be0p-33, 0x0.90c5ef2e3ff990p-38, -0x0.b2e97277ac2950p-44, 0x0.ec8d03cdf9c2a8p-50, // subrange 3:4 (4.5..4.625)
+ 0x0.fc8af2db5baf68p-3, -0x0.e2abf29cb757d8p-9, 0x0.d168d744b2ba78p-15, -0x0.c7c9bc5328d3a0p-21, 0x0.c5bc8b6574f858p-27, -0x0.cc615ca45bd408p-33, 0x0.dec857b7b47428p-39, -0x0.81b6f1edd18488p-44, 0x0.a20885723f93c0p-50, // subrange 3:5 (4.625..4.75)
+ 0x0.f5a869e1c27460p-3, -0x0.d6254bee87a618p-9, 0x0.bfc757938bf8d8p-15, -0x0.b0f0649fe990b8p-21, 0x0.a8cf0be662f620p-27, -0x0.a76aeee1085438p-33, 0x0.adf3495e3c05b8p-39, -0x0.bf8fd050487330p-45, 0x0.e17b9838f84558p-51, // subrange 3:6 (4.75..4.875)
+ 0x0.ef25d9b345d9b8p-3, -0x0.caa876a4103e20p-9, 0x0.b0218bf3e33068p-15, -0x0.9d5f6bdfdf8f38p-21, 0x0.9101e9a35fd028p-27, -0x0.8a5f9b5e50b990p-33, 0x0.8995e92b4546b8p-39, -0x0.8fed657b76ecd0p-45, 0x0.9fdf444d74bd30p-51, // subrange 3:7 (4.875..5)
+ 0x0.e8fb6c6f4e5460p-3, -0x0.c0180716ad7eb0p-9, 0x0.a22fc89653ffe8p-15, -0x0.8c84c850e39d18p-21, 0x0.fa844f005dce90p-28, -0x0.e68c135141dbf8p-34, 0x0.dc1a93a94c5500p-40, -0x0.dbaf9a1c9143b8p-46, 0x0.e72224f4d4c5f8p-52, // subrange 3:8 (5..5.125)
+ 0x0.e32226bb583aa0p-3, -0x0.b65aa6d996a670p-9, 0x0.95b69a6d725448p-15, -0x0.fbd8c9077fa5f0p-22, 0x0.d97f7ed65f7ee8p-28, -0x0.c169fb113592f0p-34, 0x0.b1ca6cbd43bc00p-40, -0x0.a9fa0c0a4c8788p-46, 0x0.aa2523f0c59568p-52, // subrange 3:9 (5.125..5.25)
+ 0x0.dd93c9ef589b60p-3, -0x0.ad5a65b6fef138p-9, 0x0.8a84527b1fd020p-15, -0x0.e271fc60a16e68p-22, 0x0.bdb5f1d081a7e8p-28, -0x0.a34a9d8ba14670p-34, 0x0.90db83537b71e8p-40, -0x0.851837f6c95448p-46, 0x0.fe9b71b1534250p-53, // subrange 3:10 (5.25..5.375)
+ 0x0.d84abb2a399680p-3, -0x0.a5042d27923828p-9, 0x0.806f237912ddb8p-15, -0x0.cc3dec15a269d8p-22, 0x0.a62f2fd9f12988p-28, -0x0.8aa7d2329975c8p-34, 0x0.eddf7309fac7a0p-41, -0x0.d29d6ae402e7a8p-47, 0x0.c13a1a29477ba0p-53, // subrange 3:11 (5.375..5.5)
+ 0x0.d341ee5ba63838p-3, -0x0.9d474e692deb90p-9, 0x0.eea755d3b46bb0p-16, -0x0.b8c0f055ce3390p-22, 0x0.9227c31cd4e650p-28, -0x0.ecb7bec8dce890p-35, 0x0.c4aaad146fec90p-41, -0x0.a82edf736a8c00p-47, 0x0.9478223126db68p-53, // subrange 3:12 (5.5..5.625)
+ 0x0.ce74d4868d9878p-3, -0x0.96152564f3bf58p-9, 0x0.de27949f9f7310p-16, -0x0.a7953060a48d90p-22, 0x0.8104614e3d6030p-28, -0x0.cb0d4bafed7d60p-35, 0x0.a3a0cafcfa3590p-41, -0x0.87683e10b69e18p-47, 0x0.e6a3ff0ff563a0p-54, // subrange 3:13 (5.625..5.75)
+ 0x0.c9df4ca82a70c0p-3, -0x0.8f60cc067ea098p-9, 0x0.cf2b7a28b21430p-16, -0x0.98663a4191d220p-22, 0x0.e49127e939a3d0p-29, -0x0.aef63c0ea41d48p-35, 0x0.88ee2ba0adff20p-41, -0x0.dba8f4dff95858p-48, 0x0.b4de6339499140p-54, // subrange 3:14 (5.75..5.875)
+ 0x0.c57d96cdecbe68p-3, -0x0.891edab0367a10p-9, 0x0.c186b9f483d9c0p-16, -0x0.8aed9c459eb8b0p-22, 0x0.cb1fa02d203de8p-29, -0x0.9764a0e82f9338p-35, 0x0.e667f8b1fd9720p-42, -0x0.b360613b359688p-48, 0x0.8f0f161a7b2d18p-54, // subrange 3:15 (5.875..6)
+ 0x0.c14c48fc0fba30p-3, -0x0.8345333bc3ebc0p-9, 0x0.b5131550a6e378p-16, -0x0.fde07c8f1962b0p-23, 0x0.b510913c8f9a90p-29, -0x0.8383fcd77f6e90p-35, 0x0.c2cfc535789028p-42, -0x0.9364a7cf5a6380p-48, 0x0.e411fa5b92cf20p-55, // subrange 3:16 (6..6.125)
+ 0x0.bd484598ce55e0p-3, -0x0.fb95a90d5d8048p-10, 0x0.a9af64f0ff6b78p-16, -0x0.e878974923acd8p-23, 0x0.a1de0119113d80p-29, -0x0.e557517f577dd0p-36, 0x0.a57b03ab625210p-42, -0x0.f39edd723a8080p-49, 0x0.b71817326731c0p-55, // subrange 3:17 (6.125..6.25)
+ 0x0.b96eb31e5ecc18p-3, -0x0.f14f69f0f8d0f8p-10, 0x0.9f3ecf38b119e8p-16, -0x0.d54f170a8f8290p-23, 0x0.91198f5a341f08p-29, -0x0.c8a98ebb283b98p-36, 0x0.8d2d266742f268p-42, -0x0.ca69e67f5c4a48p-49, 0x0.93f3874c531528p-55, // subrange 3:18 (6.25..6.375)
+ 0x0.b5bcf4e1172910p-3, -0x0.e7a94585e3d120p-10, 0x0.95a82214c52750p-16, -0x0.c41c1c4b75c7e0p-23, 0x0.8267caff2e9740p-29, -0x0.b02584cc7c99c8p-36, 0x0.f1ddd82163e050p-43, -0x0.a904780fa0a478p-49, 0x0.f08f5fec11bc48p-56, // subrange 3:19 (6.375..6.5)
+ 0x0.b230a4c00c0d40p-3, -0x0.de9651ba83bbb0p-10, 0x0.8cd5495e805670p-16, -0x0.b4a238609241e8p-23, 0x0.eaf91c16e1efe0p-30, -0x0.9b1b3b6bee1d98p-36, 0x0.cffb68e377aaa8p-43, -0x0.8dcae0f4ac3ba0p-49, 0x0.c4acabe2761258p-56, // subrange 3:20 (6.5..6.625)
+ 0x0.aec78d9da50be8p-3, -0x0.d60aefd98e4450p-10, 0x0.84b2dc46fc2670p-16, -0x0.a6acb3c29c42a8p-23, 0x0.d4303fb6400318p-30, -0x0.88fb4627f24178p-36, 0x0.b37e69fba5b660p-43, -0x0.eef4220a4dde60p-50, 0x0.a1a5400fc9e610p-56, // subrange 3:21 (6.625..6.75)
+ 0x0.ab7fa6836a91b8p-3, -0x0.cdfca4e9f257f8p-10, 0x0.fa5f7af3734c58p-17, -0x0.9a0e261d27bbf8p-23, 0x0.c009df63398710p-30, -0x0.f2a035c31714f0p-37, 0x0.9b709ca9a13000p-43, -0x0.ca2ec1dc546f88p-50, 0x0.8583ccaa4c9788p-56, // subrange 3:22 (6.75..6.875)
+ 0x0.a8570e5903c430p-3, -0x0.c661f78e345b48p-10, 0x0.ec79951368bec8p-17, -0x0.8e9f4f62b53c88p-23, 0x0.ae2b89bc8f1640p-30, -0x0.d771cdfabffb18p-37, 0x0.870c4c0a3b50e8p-43, -0x0.abbdd708e86b38p-50, 0x0.dd970176cb93f0p-57, // subrange 3:23 (6.875..7)
+ 0x0.a54c081a3117c0p-3, -0x0.bf3252853dc640p-10, 0x0.df992fdbdc52a8p-17, -0x0.843e24e78fe068p-23, 0x0.9e4894cfd2cae0p-30, -0x0.bfcb0bbed29f50p-37, 0x0.eb63a58548fd00p-44, -0x0.926d1b183af738p-50, 0x0.b8b183383fd4e0p-57, // subrange 3:24 (7..7.125)
+ 0x0.a25cf77ab718c8p-3, -0x0.b865eb15d26cc8p-10, 0x0.d3a66eb8fd3df0p-17, -0x0.f59a10bad9ff20p-24, 0x0.901fc4ee22b160p-30, -0x0.ab26a7da0a41c0p-37, 0x0.cdbf2b9255d3c0p-44, -0x0.fa90eaf51d3768p-51, 0x0.9a9538f5da9678p-57, // subrange 3:25 (7.125..7.25)
+ 0x0.9f885de9c6c1d0p-3, -0x0.b1f5aacd68df80p-10, 0x0.c88c0d7ec69ea0p-17, -0x0.e464416972adb0p-24, 0x0.837964b9bd4770p-30, -0x0.991555f0bd8350p-37, 0x0.b457aa09a8d030p-44, -0x0.d71af4580e9198p-51, 0x0.81e4ae55683398p-57, // subrange 3:26 (7.25..7.375)
+ 0x0.9cccd7e898f090p-3, -0x0.abdb1c14aa1d50p-10, 0x0.be370ca74dac90p-17, -0x0.d4ad9d2559df18p-24, 0x0.f04b6e2d720cf8p-31, -0x0.8939c3823fd418p-37, 0x0.9e7fbb90e42638p-44, -0x0.b940e2d9fe1900p-51, 0x0.db1d6692732078p-58, // subrange 3:27 (7.375..7.5)
+ 0x0.9a291aa9be88b8p-3, -0x0.a6105930a0ea20p-10, 0x0.b496698e652650p-17, -0x0.c64e6ea9c8fa10p-24, 0x0.dbf761c3524510p-31, -0x0.f68ac6427cf360p-38, 0x0.8ba893ca0c0760p-44, -0x0.a007f7f56ed268p-51, 0x0.b978d81f80f4c8p-58, // subrange 3:28 (7.5..7.625)
+ 0x0.979bf1f0279e18p-3, -0x0.a08ffd589b40b8p-10, 0x0.ab9ae0bf6485f0p-17, -0x0.b923c537e43df8p-24, 0x0.c9afd88a1281d8p-31, -0x0.ddebaf7da8d170p-38, 0x0.f6b8305b1ca398p-45, -0x0.8aa5526c722fc0p-51, 0x0.9d87cd01399250p-58, // subrange 3:29 (7.625..7.75)
+ 0x0.95243e26272a98p-3, -0x0.9b551796b21800p-10, 0x0.a336b8c0b03598p-17, -0x0.ad0ece3eff9810p-24, 0x0.b937951aa67fa8p-31, -0x0.c825bc58863418p-38, 0x0.da706a12e67108p-45, -0x0.f0e80c52382448p-52, 0x0.863bfb39db0968p-58, // subrange 3:30 (7.75..7.875)
+ 0x0.92c0f2a5c94778p-3, -0x0.965b1f346cc210p-10, 0x0.9b5d940ea84380p-17, -0x0.a1f4485a5da880p-24, 0x0.aa5977600ffe40p-31, -0x0.b4d9355cf07478p-38, 0x0.c1d64ed1292378p-45, -0x0.d1dad2cf98c970p-52, 0x0.e57ab4826193d0p-59, // subrange 3:31 (7.875..8)
+ 0x0.8f5023b6b9f9f0p-3, -0x0.8f54e1c0033908p-9, 0x0.90846412530210p-15, -0x0.92edfb198bee80p-21, 0x0.96a9de72daed98p-27, -0x0.9bdaad1541f3f8p-33, 0x0.a2af9361d596a0p-39, -0x0.ab85d1624ed728p-45, 0x0.b674e02aab3d40p-51, // subrange 4:0 (8..8.25)
+ 0x0.8af88104eed390p-3, -0x0.86b6478a950718p-9, 0x0.839478094bfb20p-15, -0x0.81865a867155f8p-21, 0x0.8085d76d916d78p-27, -0x0.80937edc174970p-33, 0x0.81b6e0e5a40550p-39, -0x0.8415240464aed8p-45, 0x0.879b4ad784b6c8p-51, // subrange 4:1 (8.25..8.5)
+ 0x0.86e2b8a3f20738p-3, -0x0.fdb48eac145f68p-10, 0x0.f04e22687a1df8p-16, -0x0.e547bcc294e8d0p-22, 0x0.dc66a328a851e8p-28, -0x0.d57de86ee465b8p-34, 0x0.d06d191d039048p-40, -0x0.cd3f2ec1e23050p-46, 0x0.cbab1eec0d81c8p-52, // subrange 4:2 (8.5..8.75)
+ 0x0.830911953c0c20p-3, -0x0.ef54ff79c208f8p-10, 0x0.dc0a1026ca6fb0p-16, -0x0.cbb1bd8bc83f38p-22, 0x0.bde3c4081913f8p-28, -0x0.b24b3014501008p-34, 0x0.a8a3380599aec0p-40, -0x0.a0cc13773c5b30p-46, 0x0.9a6b1aa66660d8p-52, // subrange 4:3 (8.75..9)
+ 0x0.feccf1d6de5700p-4, -0x0.e2276a75f23508p-10, 0x0.ca00e5ea7b61f8p-16, -0x0.b599f6eb1b34c8p-22, 0x0.a456f7354b9e58p-28, -0x0.95b91a0c9796a8p-34, 0x0.8958f595fc83a8p-40, -0x0.fde6e6cbb9d228p-47, 0x0.ec407447971a98p-53, // subrange 4:4 (9..9.25)
+ 0x0.f7ecd585646e20p-4, -0x0.d60a9a13fd2060p-10, 0x0.b9e5c2820cf5b0p-16, -0x0.a270fa11b0cf68p-22, 0x0.8ed45155458030p-28, -0x0.fcc43e45c56af0p-35, 0x0.e11ca7b61e09a0p-41, -0x0.c9e92f29a56d50p-47, 0x0.b63c366dcad0e8p-53, // subrange 4:5 (9.25..9.5)
+ 0x0.f169bdf33adf58p-4, -0x0.cae1c23c8ef360p-10, 0x0.ab77ef68475e10p-16, -0x0.91c1a2267efca8p-22, 0x0.f941eb81908928p-29, -0x0.d667800d3edc50p-35, 0x0.b98cfae601a7f8p-41, -0x0.a1a7f0dd9e5fe0p-47, 0x0.8daaae00055658p-53, // subrange 4:6 (9.5..9.75)
+ 0x0.eb3c71efcaedf8p-4, -0x0.c093cfea6378c8p-10, 0x0.9e80ad61f6c768p-16, -0x0.832baf16dd9a50p-22, 0x0.da4faf9012f248p-29, -0x0.b6b30cd266aee8p-35, 0x0.99c719bc354640p-41, -0x0.82407e4e9bb690p-47, 0x0.dddf3024bee528p-54, // subrange 4:7 (9.75..10)
+ 0x0.e55e73ea6e7c60p-4, -0x0.b70ad8450f4e50p-10, 0x0.92d1733e38aea0p-16, -0x0.ecbf31e57d5c70p-23, 0x0.bfe2953fad4358p-29, -0x0.9c5b7f4e1b5cf8p-35, 0x0.801a0d179a5900p-41, -0x0.d32819e8def638p-48, 0x0.aef04b264bb208p-54, // subrange 4:8 (10..10.25)
+ 0x0.dfc9ea9edb3ad0p-4, -0x0.ae33a0ed4cbb20p-10, 0x0.8842853911f798p-16, -0x0.d6369d92331380p-23, 0x0.a9393cee675ba8p-29, -0x0.865c8b07dfe860p-35, 0x0.d676a90f6cec58p-42, -0x0.ac203f8194f368p-48, 0x0.8ad3ece65cec58p-54, // subrange 4:9 (10.25..10.5)
+ 0x0.da798d2b2583e0p-4, -0x0.a5fd3c920e2c50p-10, 0x0.fd63a36aa77d28p-17, -0x0.c24f50ec5b7b80p-23, 0x0.95b681e7f1e948p-29, -0x0.e7d0b8031ba540p-36, 0x0.b45975b3376720p-42, -0x0.8d0f6ab96d1480p-48, 0x0.ddb0d8e65d2b40p-55, // subrange 4:10 (10.5..10.75)
+ 0x0.d56891fd1b7fb0p-4, -0x0.9e58b7f3d560b8p-10, 0x0.ec04092d47e7a8p-17, -0x0.b0acc2fb2bb720p-23, 0x0.84d9fc04b1c120p-29, -0x0.c8b651ac596f90p-36, 0x0.9852a521a990b0p-42, -0x0.e85f8822aed820p-49, 0x0.b207f457bdcce0p-55, // subrange 4:11 (10.75..11)
+ 0x0.d092a0202d5f90p-4, -0x0.9738d44ab109d8p-10, 0x0.dc338bd8690df8p-17, -0x0.a100fb42ac73e8p-23, 0x0.ec7464134b5860p-30, -0x0.ae63a9b348ed68p-36, 0x0.812f0b1f494e00p-42, -0x0.c0511edd851ee0p-49, 0x0.8fc0f9e487d4b0p-55, // subrange 4:12 (11..11.25)
+ 0x0.cbf3c28adafc58p-4, -0x0.9091cca2d3fe18p-10, 0x0.cdc63655387890p-17, -0x0.9309ff40b8ca68p-23, 0x0.d30026b33f8fe8p-30, -0x0.9805a69668d198p-36, 0x0.dbfb1c1cf46b38p-43, -0x0.9fe4227e104888p-49, 0x0.e95c4bb39185c8p-56, // subrange 4:13 (11.25..11.5)
+ 0x0.c7885d1bfb3520p-4, -0x0.8a59243fa931d8p-10, 0x0.c095c84353a770p-17, -0x0.868fc06b32aa30p-23, 0x0.bcc6d61c3af5d0p-30, -0x0.84f16d947194f0p-36, 0x0.bbff965ef57250p-43, -0x0.85825047364be8p-49, 0x0.be5916b98f0c98p-56, // subrange 4:14 (11.5..11.75)
+ 0x0.c34d23061f0b18p-4, -0x0.84857c762ed498p-10, 0x0.b480dca73c3ae0p-17, -0x0.f6c4de9feb4070p-24, 0x0.a95024dce0dff8p-30, -0x0.e9380456288fc0p-37, 0x0.a13d1d33b4e220p-43, -0x0.dfe17b59193378p-50, 0x0.9bfe901dbef3d0p-56, // subrange 4:15 (11.75..12)
+ 0x0.bf3f0e728f27a8p-4, -0x0.fe1ce177414668p-11, 0x0.a96a34e827dbf0p-17, -0x0.e2b23d890c93b8p-24, 0x0.98376e6cbde3c0p-30, -0x0.cd279063509eb8p-37, 0x0.8ac235f4fc17e0p-43, -0x0.bc73a359db1768p-50, 0x0.806a16415621c8p-56, // subrange 4:16 (12..12.25)
+ 0x0.bb5b592e7f93d0p-4, -0x0.f3d8efc3a1d998p-11, 0x0.9f382167cd3b10p-17, -0x0.d0a14da5355aa0p-24, 0x0.8928297e5cff40p-30, -0x0.b4f6e8283761b0p-37, 0x0.ef9a18a4f0aa90p-44, -0x0.9f39cd1c90c7f8p-50, 0x0.d453893cd46460p-57, // subrange 4:17 (12.25..12.5)
+ 0x0.b79f763c831998p-4, -0x0.ea3193552d8d10p-11, 0x0.95d402596bdd18p-17, -0x0.c055755039e650p-24, 0x0.f7b61bf0ab8488p-31, -0x0.a00c254bc1c0e0p-37, 0x0.cf828c4bdc5190p-44, -0x0.870413d253c750p-50, 0x0.b040c6bc66e150p-57, // subrange 4:18 (12.5..12.75)
+ 0x0.b4090c2a5d3658p-4, -0x0.e11a90044ca840p-11, 0x0.8d29dc8c3c83b0p-17, -0x0.b19a4f21946608p-24, 0x0.e02790643fbfe0p-31, -0x0.8de7cf9f545808p-37, 0x0.b44057de3eb6c0p-44, -0x0.e5c307d5863cc8p-51, 0x0.92e17be7a5c920p-57, // subrange 4:19 (12.75..13)
+ 0x0.b095f01052cd30p-4, -0x0.d888d69e21cc28p-11, 0x0.8527feb2762618p-17, -0x0.a4426a3803dca0p-24, 0x0.cb3e37be576ce0p-31, -0x0.fc3fcd544eead8p-38, 0x0.9d05287b90b888p-44, -0x0.c424381eadbb88p-51, 0x0.f5b946b7d618c8p-58, // subrange 4:20 (13..13.25)
+ 0x0.ad4421233c6ac8p-4, -0x0.d07262bf4baf10p-11, 0x0.fb7d68acd99638p-18, -0x0.9826406611d688p-24, 0x0.b8a2bf72eb0828p-31, -0x0.e0b7daef27e038p-38, 0x0.89284c130446d8p-44, -0x0.a7f83f7e448fd8p-51, 0x0.ce477c6db65b70p-58, // subrange 4:21 (13.25..13.5)
+ 0x0.aa11c4c60b3bf0p-4, -0x0.c8ce1d216b48b0p-11, 0x0.edc0086a1ff360p-18, -0x0.8d2358514f23a0p-24, 0x0.a80a801696f040p-31, -0x0.c8a3808d9afbb0p-38, 0x0.f03e858f55e390p-45, -0x0.9047cbda4259b0p-51, 0x0.adc3500f76efc8p-58, // subrange 4:22 (13.5..13.75)
+ 0x0.a6fd230a4d6688p-4, -0x0.c193c1b4870680p-11, 0x0.e0fef03fb118e8p-18, -0x0.831b8b91849880p-24, 0x0.9935742c1e3e30p-31, -0x0.b38611b73b0d00p-38, 0x0.d2efc812593078p-45, -0x0.f8961ab8e6dd48p-52, 0x0.92db3a3f9d6d28p-58, // subrange 4:23 (13.75..14)
+ 0x0.a404a391a21880p-4, -0x0.babbc8f87c6d58p-11, 0x0.d523d9bbc00b78p-18, -0x0.f3e8d4d768e8b8p-25, 0x0.8bec8a9a8ec118p-31, -0x0.a0f660255f2568p-38, 0x0.b9a777f3e1c700p-45, -0x0.d6bfcf8f8be570p-52, 0x0.f90578825bb0b8p-59, // subrange 4:24 (14..14.25)
+ 0x0.a126cac40edaa0p-4, -0x0.b43f5420fa05f0p-11, 0x0.ca1ad191c6b2f0p-18, -0x0.e32d6ffeff8e70p-25, 0x0.80004354a74768p-31, -0x0.909b65b27fb2c0p-38, 0x0.a3c8b7607052b8p-45, -0x0.ba049a01cceb40p-52, 0x0.d3c69b1ddf9d30p-59, // subrange 4:25 (14.25..14.5)
+ 0x0.9e623750d7d868p-4, -0x0.ae181ba0e0cc30p-11, 0x0.bfd1f035a23d70p-18, -0x0.d3dbf56e5595b0p-25, 0x0.ea8f109bdf3028p-32, -0x0.82298cb9314998p-38, 0x0.90d0ce85c937f8p-45, -0x0.a18c7edc076028p-52, 0x0.b4a18f0ebe0a40p-59, // subrange 4:26 (14.5..14.75)
+ 0x0.9bb59ff0e9e2b8p-4, -0x0.a8405fc92ab788p-11, 0x0.b6391c1bd3ea40p-18, -0x0.c5d03b22ddbd50p-25, 0x0.d73d6f4b02f0a0p-32, -0x0.eac0ee92677d68p-39, 0x0.805271c1371ac0p-45, -0x0.8ca63586e3fb68p-52, 0x0.9a80e8bc635828p-59, // subrange 4:27 (14.75..15)
+ 0x0.991fd1631a5d20p-4, -0x0.a2b2db34213890p-11, 0x0.ad41d42d0a5f58p-18, -0x0.b8ea3ef70e8db0p-25, 0x0.c5cdac409a37a0p-32, -0x0.d41258a8005328p-39, 0x0.e3e3e5e94872b8p-46, -0x0.f57f65e4cd1670p-53, 0x0.84843da9894ab0p-59, // subrange 4:28 (15..15.25)
+ 0x0.969fac9b884fe0p-4, -0x0.9d6ab6c042b0e8p-11, 0x0.a4df0137c61ea0p-18, -0x0.ad0d9ce3cb2f18p-25, 0x0.b609c58f7c74e8p-32, -0x0.bfe92e4f2a4b08p-39, 0x0.cac45a60009380p-46, -0x0.d6c07b07490e88p-53, 0x0.e3eaa56f558040p-60, // subrange 4:29 (15.25..15.5)
+ 0x0.943425204a20d8p-4, -0x0.98637ee71156e8p-11, 0x0.9d04cd5cce0338p-18, -0x0.a221190a904f98p-25, 0x0.a7c28bc1642420p-32, -0x0.adf4933618c090p-39, 0x0.b4c40940b87bc8p-46, -0x0.bc47682c87c278p-53, 0x0.c47f45e5445d40p-60, // subrange 4:30 (15.5..15.75)
+ 0x0.91dc3f8e533d20p-4, -0x0.93991a43767a08p-11, 0x0.95a8809c4ff788p-18, -0x0.980e3a6b3e7b88p-25, 0x0.9acead0bf4bfb8p-32, -0x0.9deee8f4f006e8p-39, 0x0.a174b9efc68bf0p-46, -0x0.a56d8bfd4b5c18p-53, 0x0.a9d36a89525a80p-60, // subrange 4:31 (15.75..16)
+ 0x0.90b30312952160p0, -0x0.852aeec967b4d8p-13, 0x0.c3253f2725a7d8p-18, -0x0.feaca1886ca560p-23, 0x0.9c17412f236438p-27, -0x0.b808c1183d85d8p-32, 0x0.d35be152b3d490p-37, -0x0.eef5c2821ab268p-42, 0x0.84d35751117730p-46, // subrange 5:0 (16..17)
+ 0x0.90ab64c0d5df18p0, -0x0.def5be1c3752c8p-14, 0x0.99e67566fa2340p-18, -0x0.bd2be25348e208p-23, 0x0.da5c29cd806f58p-28, -0x0.f260f862fe2f30p-33, 0x0.83017936da1528p-37, -0x0.8b551069d4e858p-42, 0x0.91bad0d05d2fa0p-47, // subrange 5:1 (17..18)
+ 0x0.90a4fbf2c80c60p0, -0x0.bc86bb686ec1a8p-14, 0x0.f605e3fc4b34a0p-19, -0x0.8ee77fb20031d8p-23, 0x0.9bdf287a4e4b58p-28, -0x0.a375fd62f0a3a8p-33, 0x0.a6e92195ab21f0p-38, -0x0.a79a922f2db6f8p-43, 0x0.a586661a679b28p-48, // subrange 5:2 (18..19)
+ 0x0.909f8a63aba4d8p0, -0x0.a0d76a4b08dbe8p-14, 0x0.c703304d286200p-19, -0x0.db2cf3a9de2f50p-24, 0x0.e2999c3d9a4e40p-29, -0x0.e13571610f8b18p-34, 0x0.d9e78eeeaa8298p-39, -0x0.cf41069d9efba0p-44, 0x0.c1e41c2532fd70p-49, // subrange 5:3 (19..20)
+ 0x0.909ae0bb33d078p0, -0x0.8a53fe56ffca10p-14, 0x0.a2b963a3901f88p-19, -0x0.aa5c1a0c695730p-24, 0x0.a768ecdf9eca20p-29, -0x0.9e1f853c806510p-34, 0x0.916186d0390630p-39, -0x0.835964ec369d18p-44, 0x0.e977e9eb75c360p-50, // subrange 5:4 (20..21)
+ 0x0.9096da741a62f8p0, -0x0.efa9dedb26f2a8p-15, 0x0.8659a51fff0520p-19, -0x0.8609d46c4ac460p-24, 0x0.fb03f0a804a838p-30, -0x0.e1e3447959cf80p-35, 0x0.c5d9439ccd4e98p-40, -0x0.aa3cb462dcfcc0p-45, 0x0.9018ca6940f258p-50, // subrange 5:5 (21..22)
+ 0x0.90935b048b4290p0, -0x0.d0fd1332586918p-15, 0x0.dfcf4b932a7b08p-20, -0x0.d543a7a030e1e8p-25, 0x0.beb4cf4f7e1070p-30, -0x0.a3e0c303383248p-35, 0x0.890cfb69da42e0p-40, -0x0.e1228330763b60p-46, 0x0.b5eb379501d138p-51, // subrange 5:6 (22..23)
+ 0x0.90904bdc410770p0, -0x0.b7564a69d8eec0p-15, 0x0.bbebea1686cbf0p-20, -0x0.ab60218b88b440p-25, 0x0.92a73dc472c2a0p-30, -0x0.f12d62a6f2c280p-36, 0x0.c0fb9b53fe3348p-41, -0x0.97a072a0efd428p-46, 0x0.ea6a99bdd820f8p-52, // subrange 5:7 (23..24)
+ 0x0.908d9af36fd2a8p0, -0x0.a1b87c74c724c8p-15, 0x0.9ef3bb16d8f278p-20, -0x0.8afd328bf51870p-25, 0x0.e41147627fbf60p-31, -0x0.b3c925b955a808p-36, 0x0.89e7d54e9551a0p-41, -0x0.cfb25500a85738p-47, 0x0.99e2112f9a9270p-52, // subrange 5:8 (24..25)
+ 0x0.908b39bda30868p0, -0x0.8f602374d2d420p-15, 0x0.875c10c80d7468p-20, -0x0.e35cbf7751e9c8p-26, 0x0.b3278809c31b00p-31, -0x0.87a09296561d18p-36, 0x0.c7cd97418df0c0p-42, -0x0.90757964a24288p-47, 0x0.cd87e3383cfa10p-53, // subrange 5:9 (25..26)
+ 0x0.90891c62c18ab8p0, -0x0.ff6911a0f5d958p-16, 0x0.e7fa67a211ac98p-21, -0x0.bb6b7753405650p-26, 0x0.8e0f0f5aa64c70p-31, -0x0.cee36506fd09a8p-37, 0x0.9292aa818235a8p-42, -0x0.cbd2a146b6c830p-48, 0x0.8b7171ce7645a0p-53, // subrange 5:10 (26..27)
+ 0x0.9087392a101478p0, -0x0.e47a6e5f8c3c78p-16, 0x0.c7ee00a81db898p-21, -0x0.9b9d0bc0a71ea8p-26, 0x0.e340a8034956b0p-32, -0x0.9f67bd7983e678p-37, 0x0.d98ff729f27880p-43, -0x0.91b074ff6960d0p-48, 0x0.bffebf57ea6540p-54, // subrange 5:11 (27..28)
+ 0x0.90858809547c40p0, -0x0.cd349869e825b0p-16, 0x0.ad3b8298453aa8p-21, -0x0.8212aaea2cb2b0p-26, 0x0.b73cfb3a98d720p-32, -0x0.f7f68cca432bd8p-38, 0x0.a33783e4711bf8p-43, -0x0.d2d21bc4b091d0p-49, 0x0.85fa44bad61460p-54, // subrange 5:12 (28..29)
+ 0x0.9084024e6b6120p0, -0x0.b8fd9fcf7f8d90p-16, 0x0.96d93e378359b0p-21, -0x0.dacea979489b98p-27, 0x0.94dbf1a62b2a30p-32, -0x0.c28e24d1ee3f98p-38, 0x0.f75c16a2219c10p-44, -0x0.9a44d6b05df120p-49, 0x0.bd5a047f932d40p-55, // subrange 5:13 (29..30)
+ 0x0.9082a25c750ff8p0, -0x0.a758faa322ea08p-16, 0x0.83f7c3b1b4b378p-21, -0x0.b91c1d658f2d68p-27, 0x0.f38e2f832af8a8p-33, -0x0.99e6d23b9d2ac0p-38, 0x0.bd332a59b5bd38p-44, -0x0.e42a4a74d7d070p-50, 0x0.87626db107f6e8p-55, // subrange 5:14 (30..31)
+ 0x0.90816377ae79e8p0, -0x0.97e12b57ddc8d8p-16, 0x0.e7e77629a19050p-22, -0x0.9d7466e88eaf40p-27, 0x0.c88d0cdbfcd708p-33, -0x0.f5599f4b8518f8p-39, 0x0.91fbdcbc746168p-44, -0x0.aa660af90c9c30p-50, 0x0.c3bad40f992a10p-56, // subrange 5:15 (31..32)
+ 0x0.907fba7b515f88p0, -0x0.840f6ad4a11f98p-15, 0x0.c0711c94cde828p-20, -0x0.f96346b7547e60p-25, 0x0.979020c4fd9eb0p-29, -0x0.b0ef37d56fda00p-34, 0x0.c8e8c9e905be90p-39, -0x0.e03b0a8073ba28p-44, 0x0.f5bbf09e6deb78p-49, // subrange 6:0 (32..34)
+ 0x0.907dd6bafe9788p0, -0x0.dd500e0e1d7d50p-16, 0x0.9801875c7288d8p-20, -0x0.b9aeb16b52cc48p-25, 0x0.d4bb1dbb979478p-30, -0x0.ea110d79ecaa80p-35, 0x0.fa7df6d22b6858p-40, -0x0.83b152ac2ecb08p-44, 0x0.880167e8800af8p-49, // subrange 6:1 (34..36)
+ 0x0.907c3f664ad3e8p0, -0x0.bb47dcfec04c90p-16, 0x0.f3509c1a8c0588p-21, -0x0.8c8c00c3827500p-25, 0x0.9846f25446fae8p-30, -0x0.9e71e7bb3fcc18p-35, 0x0.a057a9f46311c0p-40, -0x0.9f605b5e6be550p-45, 0x0.9ba1c8eb5ae168p-50, // subrange 6:2 (36..38)
+ 0x0.907ae5323209d8p0, -0x0.9fe2ae59948b40p-16, 0x0.c50aa919031860p-21, -0x0.d7ec2af9a4b758p-26, 0x0.dde5cec0622e28p-31, -0x0.dafd2131a54288p-36, 0x0.d22f492e9743a8p-41, -0x0.c617c7d78f6358p-46, 0x0.b773bb625b62a0p-51, // subrange 6:3 (38..40)
+ 0x0.9079bc7871b378p0, -0x0.8995a175c6f540p-16, 0x0.a14445978299b8p-21, -0x0.a8129938bb6cc0p-26, 0x0.a4446006bf2c60p-31, -0x0.9a2bf62e4d5730p-36, 0x0.8cb842ca4e2208p-41, -0x0.fc30108a2fb2b8p-47, 0x0.de1641d1819870p-52, // subrange 6:4 (40..42)
+ 0x0.9078bc38f724e0p0, -0x0.ee7e21946e80b0p-17, 0x0.8541ac8bccc890p-21, -0x0.8467216c113e80p-26, 0x0.f6bb62a2cdf5a0p-32, -0x0.dcc18548852e08p-37, 0x0.c014a46b46d500p-42, -0x0.a40af038369288p-47, 0x0.89b4df2802e3e0p-52, // subrange 6:5 (42..44)
+ 0x0.9077dd68d73958p0, -0x0.d00e7e5ae24c70p-17, 0x0.de2590404923a0p-22, -0x0.d2e38589cd6ba8p-27, 0x0.bbbc3b632a60a8p-32, -0x0.a07a8282b5e3d0p-37, 0x0.8566e0d24705e0p-42, -0x0.d9a71890f17070p-48, 0x0.ae8c682dfd7300p-53, // subrange 6:6 (44..46)
+ 0x0.90771a74f19518p0, -0x0.b6967b0214b4c0p-17, 0x0.baa44f63d5ffe0p-22, -0x0.a9a03eb3c9f6d0p-27, 0x0.908f248d432540p-32, -0x0.ec97573a828350p-38, 0x0.bc45af0b339f88p-43, -0x0.93019603feb0a8p-48, 0x0.e1b4c74cfd40f8p-54, // subrange 6:7 (46..48)
+ 0x0.90766ee7b38d48p0, -0x0.a11cdc1d002b00p-17, 0x0.9df4d8b28fad38p-22, -0x0.89af0fca4a6808p-27, 0x0.e1125242b97710p-33, -0x0.b0a3f345c770d8p-38, 0x0.86cee6284e3380p-43, -0x0.c9df4d4a05d7d8p-49, 0x0.949ecc2a297798p-54, // subrange 6:8 (48..50)
+ 0x0.9075d7272a3280p0, -0x0.8ee0cd8e1412c8p-17, 0x0.8693be3381c398p-22, -0x0.e164452ec59d40p-28, 0x0.b0fb7131591d18p-33, -0x0.856fdbc3f80870p-38, 0x0.c3a8fc096ce460p-44, -0x0.8cb7fa3333c8b8p-49, 0x0.c70a32e29e3b68p-55, // subrange 6:9 (50..52)
+ 0x0.907550442e75a8p0, -0x0.fe9711d6746370p-18, 0x0.e6bc92861649f0p-23, -0x0.b9ea766675dc70p-28, 0x0.8c76cd0698b598p-33, -0x0.cbcb69981afad8p-39, 0x0.8fc22a5aee93e0p-44, -0x0.c6ef7aeb2ced40p-50, 0x0.875d35a06d36f0p-55, // subrange 6:10 (52..54)
+ 0x0.9074d7d5c7ce28p0, -0x0.e3cc05096d2f18p-18, 0x0.c6efae0c89a248p-23, -0x0.9a743e6ce954d8p-28, 0x0.e0e23e1dc601c0p-34, -0x0.9d311a4acd75d8p-39, 0x0.d5aec9f58dae48p-45, -0x0.8e71e27b1a0618p-50, 0x0.bac7408e8518e0p-56, // subrange 6:11 (54..56)
+ 0x0.90746bdd667198p0, -0x0.cca2c59ba4c748p-18, 0x0.ac6e5ec44904c8p-23, -0x0.812bb5c7d4f9c8p-28, 0x0.b575c2d5a48620p-34, -0x0.f4c1e431980a48p-40, 0x0.a081bed0756c68p-45, -0x0.ce72ee7329afe8p-51, 0x0.82965d38a977f0p-56, // subrange 6:12 (56..58)
+ 0x0.90740ab1993270p0, -0x0.b882f1befa6698p-18, 0x0.9632896db21158p-23, -0x0.d964142e9b4418p-29, 0x0.9382cceed27e30p-34, -0x0.c0352964386488p-40, 0x0.f386abaee58e10p-46, -0x0.97485d0091c160p-51, 0x0.b8e0e322547ab0p-57, // subrange 6:13 (58..60)
+ 0x0.9073b2ed928850p0, -0x0.a6f12baccb6750p-18, 0x0.836f58a5c0c140p-23, -0x0.b7fd2ecc8c0b40p-29, 0x0.f17deed9570b58p-35, -0x0.982a1561e29f68p-40, 0x0.ba74e03d203a70p-46, -0x0.e0086eaf73f2b8p-52, 0x0.84645214d54fb8p-57, // subrange 6:14 (60..62)
+ 0x0.9073636448d5b8p0, -0x0.9788da5471bdf0p-18, 0x0.e706bd61502948p-24, -0x0.9c8f9b56fb57e0p-29, 0x0.c6f54567ee59a8p-35, -0x0.f2c0ecfbdf2bf8p-41, 0x0.8fffd12c8d4db0p-46, -0x0.a7814d0a79f5a0p-52, 0x0.bfac404ba6b698p-58, // subrange 6:15 (62..64)
+ 0x0.9072ba5cbb48f8p0, -0x0.f0fc2c9a39e210p-17, 0x0.aa2e4556240300p-20, -0x0.d5acff12b87ed0p-24, 0x0.fb8bec82a54730p-28, -0x0.8e26c2cea83010p-31, 0x0.9c3935cfb2ce18p-35, -0x0.aa0b84b764fe18p-39, 0x0.b43322ed8e2650p-43, // subrange 7:0 (64..72)
+ 0x0.9071ee1b073fe8p0, -0x0.ac97778ed7b020p-17, 0x0.da160908ef5968p-21, -0x0.f4f9840f468088p-25, 0x0.810046c019aad0p-28, -0x0.826f3af6d19088p-32, 0x0.803c38f72fb898p-36, -0x0.f92e8faec0a3c0p-41, 0x0.ec39ffe48fc2e0p-45, // subrange 7:1 (72..80)
+ 0x0.90715964e6c5d0p0, -0x0.ffa14699299298p-18, 0x0.921d9ef914c588p-21, -0x0.947cd5f52124d0p-25, 0x0.8d7a1b6e1878f0p-29, -0x0.81698820423970p-33, 0x0.e6326f806f6158p-38, -0x0.ca01473b434768p-42, 0x0.ad3e2b62a36770p-46, // subrange 7:2 (80..88)
+ 0x0.9070e9c579fbf8p0, -0x0.c28f933c6369f8p-18, 0x0.cb1168cea30dc8p-22, -0x0.bc689a4ee14978p-26, 0x0.a3e44558b3b2f0p-30, -0x0.88de6a0b10c518p-34, 0x0.de44e4e7091210p-39, -0x0.b1db528435a458p-43, 0x0.8b419f11378e98p-47, // subrange 7:3 (88..96)
+ 0x0.907093db0ce320p0, -0x0.977e72d568bd18p-18, 0x0.917699a74e2d70p-22, -0x0.f851c67db56490p-27, 0x0.c6b7163fec1b70p-31, -0x0.98aa528927e830p-35, 0x0.e4125487cd4288p-40, -0x0.a7bb902ce7ccb8p-44, 0x0.f1a11141ee9858p-49, // subrange 7:4 (96..104)
+ 0x0.9070505193c080p0, -0x0.f082e13c75d728p-19, 0x0.d5d30f17b84f48p-23, -0x0.a8fbe39fe12330p-27, 0x0.fa6937b233a700p-32, -0x0.b21f5085c3fc20p-36, 0x0.f66090fa7afed8p-41, -0x0.a7a46beaa09a58p-45, 0x0.df990206045858p-50, // subrange 7:5 (104..112)
+ 0x0.90701a44d6bea0p0, -0x0.c218b761357c10p-19, 0x0.a0a7cf72678858p-23, -0x0.ec6920facee600p-28, 0x0.a3140505a72750p-32, -0x0.d7fe3eac00c7c8p-37, 0x0.8b124b7db68978p-41, -0x0.b0182030300a70p-46, 0x0.daa9bbdbdab2b8p-51, // subrange 7:6 (112..120)
+ 0x0.906fee571c2ff0p0, -0x0.9ee5882ec67f70p-19, 0x0.f610c2b6c40e88p-24, -0x0.a95ce85ca11128p-28, 0x0.da93511da93830p-33, -0x0.8767f48d271d10p-37, 0x0.a31cb6bb5a05e8p-42, -0x0.c11ca8ab7e53d8p-47, 0x0.e050da7a2decf0p-52, // subrange 7:7 (120..128)
+ 0x0.906fba68cbc888p0, -0x0.f0de24f50b9138p-19, 0x0.aa0aed60631728p-22, -0x0.d56a6f8bc14328p-26, 0x0.fb1e3c365e1fb8p-30, -0x0.8dd42143ef5250p-33, 0x0.9bc4795c352528p-37, -0x0.a96be986c9bc80p-41, 0x0.b3649915caad10p-45, // subrange 8:0 (128..144)
+ 0x0.906f875e1945b0p0, -0x0.ac8640298d0f20p-19, 0x0.d9f1c74ade36a0p-23, -0x0.f4bc6db8e4ef20p-27, 0x0.80d33ec59bb448p-30, -0x0.823287f7566b88p-34, 0x0.ffdf03e7215200p-39, -0x0.f8737f6328dbf0p-43, 0x0.eb61689e5fd900p-47, // subrange 8:1 (144..160)
+ 0x0.906f6233f069e0p0, -0x0.ff8c672ccca250p-20, 0x0.9209bca5271308p-23, -0x0.945e86dc2956d0p-27, 0x0.8d51ae4c3c7818p-31, -0x0.81383b8e00a1f0p-35, 0x0.e5c1b385af5430p-40, -0x0.c98539769d9040p-44, 0x0.acbc367e56dc28p-48, // subrange 8:2 (160..176)
+ 0x0.906f464e2c0038p0, -0x0.c282550223ffa8p-20, 0x0.cafa5f73cef440p-24, -0x0.bc488b2b956f40p-28, 0x0.a3bd3b184393e8p-32, -0x0.88b2f2a45162e0p-36, 0x0.ddea25d2c0b5d8p-41, -0x0.b1805066f16770p-45, 0x0.8aea928f4bcb80p-49, // subrange 8:3 (176..192)
+ 0x0.906f30d4ea3fa8p0, -0x0.9775b89664f0d8p-20, 0x0.9168a230675b98p-24, -0x0.f82e034c5bdb90p-29, 0x0.c68f05de5e1db8p-33, -0x0.98814945900a08p-37, 0x0.e3c3840e851108p-42, -0x0.a772f264f2b8f8p-46, 0x0.f121440c16e838p-51, // subrange 8:4 (192..208)
+ 0x0.906f1ff37335e8p0, -0x0.f0770042446768p-21, 0x0.d5c175376fd528p-25, -0x0.a8e7065323b398p-29, 0x0.fa3def11a42968p-34, -0x0.b1f64413dd0bd0p-38, 0x0.f6179240076040p-43, -0x0.a76637a66c8908p-47, 0x0.df33a3ea593f58p-52, // subrange 8:5 (208..224)
+ 0x0.906f1270e36df8p0, -0x0.c2106820ecb510p-21, 0x0.a09c58e5fefee0p-25, -0x0.ec4fd3ae72f260p-30, 0x0.a2fb95ea99b448p-34, -0x0.d7d318ff1c8c40p-39, 0x0.8aee941a887918p-43, -0x0.afdf8042d005b0p-48, 0x0.da53d2711678b8p-53, // subrange 8:6 (224..240)
+ 0x0.906f0775e5a2f0p0, -0x0.9edf9431ff2a18p-21, 0x0.f601655d09bd80p-26, -0x0.a94d0b8d18ce10p-30, 0x0.da76a843bf0db8p-35, -0x0.875048adb54f20p-39, 0x0.a2f80dc890a6c0p-44, -0x0.c0e653aac95db8p-49, 0x0.e003bcfc02dea0p-54, // subrange 8:7 (240..256)
+ 0x0.906efa7ac38cf0p0, -0x0.f0d6a481f0d838p-21, 0x0.aa0219cb7f1df0p-24, -0x0.d559d1b616d510p-28, 0x0.fb02dcf320e1e0p-32, -0x0.8dbf84f11fd5e0p-35, 0x0.9ba75f12a7e508p-39, -0x0.a944251a0e82a8p-43, 0x0.b3312b24178bb0p-47, // subrange 9:0 (256..288)
+ 0x0.906eedb8728408p0, -0x0.ac81f2fbf537b0p-21, 0x0.d9e8b8d5a7d7a0p-25, -0x0.f4ad2c94a6d7e8p-29, 0x0.80c800fce2bd50p-32, -0x0.8223624f658640p-36, 0x0.ffb8be4f161c38p-41, -0x0.f844db86df2128p-45, 0x0.eb2b6ed87714f8p-49, // subrange 9:1 (288..320)
+ 0x0.906ee46e1e3998p0, -0x0.ff872ffc2212f0p-22, 0x0.9204c4f375a7d0p-25, -0x0.9456f4e3d7a000p-29, 0x0.8d47961be27bf8p-33, -0x0.812bed20c627b8p-37, 0x0.e5a591b52e9948p-42, -0x0.c966477e685b98p-46, 0x0.ac9bcee382fe88p-50, // subrange 9:2 (320..352)
+ 0x0.906edd74ce87d0p0, -0x0.c27f05cdb78ea8p-22, 0x0.caf49df89d2a88p-26, -0x0.bc4088fa10fe30p-30, 0x0.a3b37b05d7ca68p-34, -0x0.88a818420c4b28p-38, 0x0.ddd37ee5f76be8p-43, -0x0.b1699a8d72ffa0p-47, 0x0.8ad4db7f8129a8p-51, // subrange 9:3 (352..384)
+ 0x0.906ed81693ade0p0, -0x0.97738a38eb1998p-22, 0x0.916524c351fc18p-26, -0x0.f825140094e340p-31, 0x0.c68503efddec98p-35, -0x0.987709b9c7d8e0p-39, 0x0.e3afd670b59808p-44, -0x0.a760d22856b9f0p-48, 0x0.f1015fbb3602d0p-53, // subrange 9:4 (384..416)
+ 0x0.906ed3de445e30p0, -0x0.f074083e631170p-23, 0x0.d5bd0f3910f4e0p-27, -0x0.a8e1cfc04da328p-31, 0x0.fa331eea870c50p-36, -0x0.b1ec03578677c8p-40, 0x0.f60557bb1b25e0p-45, -0x0.a756afe01c96a0p-49, 0x0.df1a569380f418p-54, // subrange 9:5 (416..448)
+ 0x0.906ed07daa6300p0, -0x0.c20e54746d6fa8p-23, 0x0.a0997b8798eea8p-27, -0x0.ec4981258cf0d0p-32, 0x0.a2f57b1edfcdf0p-36, -0x0.d7c851bdfcaf20p-41, 0x0.8ae5a872513d60p-45, -0x0.afd15c7420c110p-50, 0x0.da3e5f91f10638p-55, // subrange 9:6 (448..480)
+ 0x0.906ecdbef1fd58p0, -0x0.9ede17491adef8p-23, 0x0.f5fd8e57318648p-28, -0x0.a94914c824db30p-32, 0x0.da6f7f0ef2d0f8p-37, -0x0.874a5ebfe08430p-41, 0x0.a2eee583691988p-46, -0x0.c0d8c1ebbbeee8p-51, 0x0.dff07b7cdc8d90p-56, // subrange 9:7 (480..512)
+ 0x0.906eca803097b0p0, -0x0.f0d4c47c874488p-23, 0x0.a9ffe50cc24930p-26, -0x0.d555aaa145e108p-30, 0x0.fafc05eee86e00p-34, -0x0.8dba5e9cf63140p-37, 0x0.9ba019cc8da878p-41, -0x0.a93a36230caa48p-45, 0x0.b32452ecc882b8p-49, // subrange 10:0 (512..576)
+ 0x0.906ec74fa20eb8p0, -0x0.ac80dfbb48bf50p-23, 0x0.d9e67557f6d570p-27, -0x0.f4a95c9295b338p-31, 0x0.80c531cdf7f588p-34, -0x0.821f9956b1b328p-38, 0x0.ffaf2e46e8b940p-43, -0x0.f8393491df7f78p-47, 0x0.eb1df3259a7cc0p-51, // subrange 10:1 (576..640)
+ 0x0.906ec4fd105ac0p0, -0x0.ff85e23a9c7358p-24, 0x0.920387153ae1b0p-27, -0x0.945510829a3a18p-31, 0x0.8d4510413d9780p-35, -0x0.8128d9d0cf42c0p-39, 0x0.e59e8a138f75c0p-44, -0x0.c95e8c175232a8p-48, 0x0.ac93b655d8f728p-52, // subrange 10:2 (640..704)
+ 0x0.906ec33ebe84c8p0, -0x0.c27e32063de090p-24, 0x0.caf32da7867868p-28, -0x0.bc3e88871f1ae0p-32, 0x0.a3b10b290cfb00p-36, -0x0.88a561e0df8700p-40, 0x0.ddcdd5b812dfe0p-45, -0x0.b163edc1a31cf0p-49, 0x0.8acf6e7c349e78p-53, // subrange 10:3 (704..768)
+ 0x0.906ec1e73127a8p0, -0x0.9772fea4b0b6e8p-24, 0x0.9164456f15d8f8p-28, -0x0.f822d845a790c0p-33, 0x0.c6828396d415d8p-37, -0x0.98747a031b5fd8p-41, 0x0.e3aaeb7127ce30p-46, -0x0.a75c4a8c599538p-50, 0x0.f0f967965d1138p-55, // subrange 10:4 (768..832)
+ 0x0.906ec0d91e3ae0p0, -0x0.f0734a41150db0p-25, 0x0.d5bbf5c1137440p-29, -0x0.a8e082279bc108p-33, 0x0.fa306b00c9d768p-38, -0x0.b1e9734e69fcc8p-42, 0x0.f600c96c63ee98p-47, -0x0.a752ce431898d8p-51, 0x0.df1403e08e42f0p-56, // subrange 10:5 (832..896)
+ 0x0.906ec000f85b80p0, -0x0.c20dcf8b869b58p-25, 0x0.a098c4344a3030p-29, -0x0.ec47ec8ff4b9b0p-34, 0x0.a2f3f47b9f3a30p-38, -0x0.d7c5a0104f2888p-43, 0x0.8ae36dab442b48p-47, -0x0.afcdd3c32c7770p-52, 0x0.da390351b91260p-57, // subrange 10:6 (896..960)
+ 0x0.906ebf514ab2e8p0, -0x0.9eddb810468988p-25, 0x0.f5fc989ac45f80p-30, -0x0.a948171dd5e628p-34, 0x0.da6db4d1d83b30p-39, -0x0.8748e45508cca0p-43, 0x0.a2ec9b91912e50p-48, -0x0.c0d55db3fc98a8p-53, 0x0.dfebab7afe3ca0p-58, // subrange 10:7 (960..1024)
+ 0x0.906ebe1309ec88p0, -0x0.cae12f2cb447b8p-24, 0x0.8740d77e1d0308p-26, -0x0.a04d108a03e498p-29, 0x0.b21cd2b759ebb0p-32, -0x0.bde179cf7449f0p-35, 0x0.c4eb994de6ea00p-38, -0x0.d011019959fa90p-41, 0x0.cfe3714563b4a8p-44, // subrange 11:0 (1024..1280)
+ 0x0.906ebce53c0670p0, -0x0.de3cd4d4287350p-25, 0x0.f270f8365c3d70p-28, -0x0.eb1859441b0860p-31, 0x0.d5b91eda912648p-34, -0x0.ba79df04a21d10p-37, 0x0.9e39847b6b56c0p-40, -0x0.86fef9c3b02ac8p-43, 0x0.dcc6b0f08468b0p-47, // subrange 11:1 (1280..1536)
+ 0x0.906ebc37a707c0p0, -0x0.86a3261cb987a0p-25, 0x0.f88fb497283c40p-29, -0x0.cbf2b237f14588p-32, 0x0.9ce21da1134c88p-35, -0x0.e7acf0f4f62790p-39, 0x0.a65525c285cc00p-42, -0x0.ee5e52cb556460p-46, 0x0.a4f4ec3b407fe0p-49, // subrange 11:2 (1536..1792)
+ 0x0.906ebbcabef0b8p0, -0x0.af49a9a1d0d458p-26, 0x0.8c3af31789c280p-29, -0x0.c7705386ead760p-33, 0x0.84f593f2fa5758p-36, -0x0.aa2d0d35532a10p-40, 0x0.d3c690af3b78f0p-44, -0x0.82e65fa3176828p-47, 0x0.9d0814febbc098p-51, // subrange 11:3 (1792..2048)
+ 0x0.906ebb66521300p0, -0x0.cae118a1e62970p-26, 0x0.8740be72192960p-28, -0x0.a04ce402b00810p-31, 0x0.b21c8d73195b40p-34, -0x0.bde1176e0916e8p-37, 0x0.c4eb161b3b66d0p-40, -0x0.d010510a9e78c0p-43, 0x0.cfe29a24c5aaa0p-46, // subrange 12:0 (2048..2560)
+ 0x0.906ebb1adea080p0, -0x0.de3cc44c74ce28p-27, 0x0.f270da28598d58p-30, -0x0.eb182d8cc17a38p-33, 0x0.d5b8e737077390p-36, -0x0.ba799e501a53b8p-39, 0x0.9e393de3912aa8p-42, -0x0.86fead8a3c0e08p-45, 0x0.dcc618ce2601d0p-49, // subrange 12:1 (2560..3072)
+ 0x0.906ebaef796398p0, -0x0.86a31ef131e9f0p-27, 0x0.f88f9e875e96c0p-31, -0x0.cbf29710cd7128p-34, 0x0.9ce200633a8b80p-37, -0x0.e7acb76401a4d0p-41, 0x0.a654f09e9e9320p-44, -0x0.ee5df2c2b12468p-48, 0x0.a4f49b1799fb18p-51, // subrange 12:2 (3072..3584)
+ 0x0.906ebad43f5f18p0, -0x0.af49a29ede5078p-28, 0x0.8c3ae9be461820p-31, -0x0.c7703f9547c308p-35, 0x0.84f58155b6da28p-38, -0x0.aa2ced71f80d08p-42, 0x0.d3c65ddcc28ac0p-46, -0x0.82e6381c78fa20p-49, 0x0.9d07db16908200p-53, // subrange 12:3 (3584..4096)
+ 0x0.906ebabb242880p0, -0x0.cae112ff339c58p-28, 0x0.8740b82f19b898p-30, -0x0.a04cd8e0deac88p-33, 0x0.b21c7c22106e50p-36, -0x0.bde0fed5bb14e8p-39, 0x0.c4eaf54ea56160p-42, -0x0.d01024e7120c10p-45, 0x0.cfe2645ccf9fa0p-48, // subrange 13:0 (4096..5120)
+ 0x0.906ebaa8474c50p0, -0x0.de3cc02a885fd8p-29, 0x0.f270d2a4da1a48p-32, -0x0.eb18229eed75a8p-35, 0x0.d5b8d94e28e820p-38, -0x0.ba798e22fe0458p-41, 0x0.9e392c3da22400p-44, -0x0.86fe9a7be8e9a0p-47, 0x0.dcc5f2c5a5ae08p-51, // subrange 13:1 (5120..6144)
+ 0x0.906eba9d6dfd48p0, -0x0.86a31d265028b8p-29, 0x0.f88f99036cd1d8p-33, -0x0.cbf29047058a00p-36, 0x0.9ce1f913c5d0f8p-39, -0x0.e7aca8ffc81b88p-43, 0x0.a654e355a8d248p-46, -0x0.ee5ddac090f600p-50, 0x0.a4f486ceb934f0p-53, // subrange 13:2 (6144..7168)
+ 0x0.906eba969f7c38p0, -0x0.af49a0de21cb90p-30, 0x0.8c3ae767f561e8p-33, -0x0.c7703a98df92e0p-37, 0x0.84f57cae66ad90p-40, -0x0.aa2ce58122c2e0p-44, 0x0.d3c65128273880p-48, -0x0.82e62e3ad41ba8p-51, 0x0.9d07cc9c8a6ee8p-55, // subrange 13:3 (7168..8192)
+ 0x0.906eba9058aea0p0, -0x0.cae111968708b8p-30, 0x0.8740b69e59f4c0p-32, -0x0.a04cd6186a8f58p-35, 0x0.b21c77cdcea680p-38, -0x0.bde0f8afa86118p-41, 0x0.c4eaed1b812db8p-44, -0x0.d01019de311820p-47, 0x0.cfe256ead53458p-50, // subrange 14:0 (8192..10240)
+ 0x0.906eba8ba177a0p0, -0x0.de3cbf220d4bf0p-31, 0x0.f270d0c3fa5110p-34, -0x0.eb181fe3789a70p-37, 0x0.d5b8d5d3f18358p-40, -0x0.ba798a17b74ab0p-43, 0x0.9e3927d426da98p-46, -0x0.86fe95b854beb8p-49, 0x0.dcc5e943870d70p-53, // subrange 14:1 (10240..12288)
+ 0x0.906eba88eb23e0p0, -0x0.86a31cb397bac8p-31, 0x0.f88f97a2706ae8p-35, -0x0.cbf28e9493a110p-38, 0x0.9ce1f73fe8b9b0p-41, -0x0.e7aca566b9f2b0p-45, 0x0.a654e0036ba2e8p-48, -0x0.ee5dd4c0097878p-52, 0x0.a4f481bc819118p-55, // subrange 14:2 (12288..14336)
+ 0x0.906eba87378398p0, -0x0.af49a06df2ac18p-32, 0x0.8c3ae6d26137a0p-35, -0x0.c7703959c59020p-39, 0x0.84f57b8492ad90p-42, -0x0.aa2ce384ed8828p-46, 0x0.d3c64dfb009280p-50, -0x0.82e62bc26b0fe0p-53, 0x0.9d07c8fe0935e8p-57, // subrange 14:3 (14336..16384)
+ 0x0.906eba84f85a08p0, -0x0.93e6168c6e4f38p-31, 0x0.b17a8454db54b8p-33, -0x0.bd55839dcdefa8p-35, 0x0.bd54c9133f97c0p-37, -0x0.b497b0cb72ce90p-39, 0x0.a89da2f09f29f8p-41, -0x0.b01bd668a22630p-43, 0x0.9e0df05f4a30e8p-45, // subrange 15:0 (16384..24576)
+ 0x0.906eba838e2678p0, -0x0.d79898407bfaa8p-33, 0x0.b8cbf06e9c3760p-35, -0x0.8cccb464122738p-37, 0x0.c92456c66a3f20p-40, -0x0.89b5965f6466f8p-42, 0x0.b7a10708a56e18p-45, -0x0.80138a60f5c5d0p-47, 0x0.a46f7326c951d8p-50, // subrange 15:1 (24576..32768)
+ 0x0.906eba82cdbb10p0, -0x0.93e6167f1ec100p-33, 0x0.b17a843a3c2f80p-35, -0x0.bd5583732f6f48p-37, 0x0.bd54c8d7972a98p-39, -0x0.b497b0804cc4a0p-41, 0x0.a89da2963f59b8p-43, -0x0.b01bd5ea792670p-45, 0x0.9e0defd5e65048p-47, // subrange 16:0 (32768..49152)
+ 0x0.906eba82732e28p0, -0x0.d798983695a078p-35, 0x0.b8cbf06077b640p-37, -0x0.8cccb453e824c8p-39, 0x0.c92456a6166090p-42, -0x0.89b59641f29f30p-44, 0x0.b7a106d624ec60p-47, -0x0.80138a33819238p-49, 0x0.a46f72dfb91770p-52, // subrange 16:1 (49152..65536)
+ 0x0.906eba82431350p0, -0x0.93e6167bcadd70p-35, 0x0.b17a8433946638p-37, -0x0.bd55836887cf38p-39, 0x0.bd54c8c8ad0f50p-41, -0x0.b497b06d834228p-43, 0x0.a89da27fa765b0p-45, -0x0.b01bd5caeee690p-47, 0x0.9e0defb38d5838p-49, // subrange 17:0 (65536..98304)
+ 0x0.906eba822c7018p0, -0x0.d79898341c09e8p-37, 0x0.b8cbf05cee95f0p-39, -0x0.8cccb44fdda428p-41, 0x0.c924569e0168f0p-44, -0x0.89b5963a962d38p-46, 0x0.b7a106c984cbf8p-49, -0x0.80138a28248550p-51, 0x0.a46f72cdf508e0p-54, // subrange 17:1 (98304..131072)
+ 0x0.906eba821ce190p0, -0x0.ab2af01a4f43f0p-37, 0x0.ab2bbd42310208p-38, -0x0.98a9970dfb6b18p-39, 0x0.fe5544dda7a4f0p-41, -0x0.bed1db1ec829e8p-42, 0x0.94fe0902011670p-43, -0x0.ad1986603b7a48p-44, 0x0.80cd67b1b2a8d8p-45, // subrange 18:0 (131072..262144)
+ 0x0.906eba8216dcf0p0, -0x0.ab2af01a2481c8p-39, 0x0.ab2bbd41e9b6d8p-40, -0x0.98a9970d9abdd0p-41, 0x0.fe5544dcc70f38p-43, -0x0.bed1db1e00ddc0p-44, 0x0.94fe0901344790p-45, -0x0.ad19865eba3420p-46, 0x0.80cd67b05b4590p-47, // subrange 19:0 (262144..524288)
+ 0x0.906eba82155bc8p0, -0x0.ab2af01a19d140p-41, 0x0.ab2bbd41d7e408p-42, -0x0.98a9970d829280p-43, 0x0.fe5544dc8ee9d0p-45, -0x0.bed1db1dcf0ab0p-46, 0x0.94fe09010113d8p-47, -0x0.ad19865e59e290p-48, 0x0.80cd67b0056cc0p-49, // subrange 20:0 (524288..1.04858e+06)
+ 0x0.906eba8214fb80p0, -0x0.ab2af01a172520p-43, 0x0.ab2bbd41d36f58p-44, -0x0.98a9970d7c87b0p-45, 0x0.fe5544dc80e070p-47, -0x0.bed1db1dc295f0p-48, 0x0.94fe0900f446f0p-49, -0x0.ad19865e41ce30p-50, 0x0.80cd67afeff690p-51, // subrange 21:0 (1.04858e+06..2.09715e+06)
+ 0x0.906eba8214e370p0, -0x0.ab2af01a167a18p-45, 0x0.ab2bbd41d25228p-46, -0x0.98a9970d7b04f8p-47, 0x0.fe5544dc7d5e18p-49, -0x0.bed1db1dbf78c0p-50, 0x0.94fe0900f113b0p-51, -0x0.ad19865e3bc918p-52, 0x0.80cd67afea9900p-53, // subrange 22:0 (2.09715e+06..4.1943e+06)
+ 0x0.906eba8214dd68p0, -0x0.ab2af01a164f50p-47, 0x0.ab2bbd41d20ae0p-48, -0x0.98a9970d7aa450p-49, 0x0.fe5544dc7c7d88p-51, -0x0.bed1db1dbeb170p-52, 0x0.94fe0900f046e0p-53, -0x0.ad19865e3a47d0p-54, 0x0.80cd67afe941a0p-55, // subrange 23:0 (4.1943e+06..8.38861e+06)
+ 0x0.906eba8214dbe8p0, -0x0.ab2af01a1644a0p-49, 0x0.ab2bbd41d1f910p-50, -0x0.98a9970d7a8c20p-51, 0x0.fe5544dc7c4560p-53, -0x0.bed1db1dbe7fa0p-54, 0x0.94fe0900f013b0p-55, -0x0.ad19865e39e780p-56, 0x0.80cd67afe8ebc8p-57, // subrange 24:0 (8.38861e+06..1.67772e+07)
+ 0x0.906eba8214db88p0, -0x0.ab2af01a1641f8p-51, 0x0.ab2bbd41d1f498p-52, -0x0.98a9970d7a8618p-53, 0x0.fe5544dc7c3758p-55, -0x0.bed1db1dbe7328p-56, 0x0.94fe0900f006d8p-57, -0x0.ad19865e39cf68p-58, 0x0.80cd67afe8d660p-59, // subrange 25:0 (1.67772e+07..3.35544e+07)
+ 0x0.906eba8214db70p0, -0x0.ab2af01a164148p-53, 0x0.ab2bbd41d1f380p-54, -0x0.98a9970d7a8498p-55, 0x0.fe5544dc7c33e0p-57, -0x0.bed1db1dbe7010p-58, 0x0.94fe0900f00338p-59, -0x0.ad19865e39c948p-60, 0x0.80cd67afe8d228p-61, // subrange 26:0 (3.35544e+07..6.71089e+07)
+ 0x0.906eba8214db68p0, -0x0.ab2af01a164120p-55, 0x0.ab2bbd41d1f338p-56, -0x0.98a9970d7a8440p-57, 0x0.fe5544dc7c3388p-59, -0x0.bed1db1dbe6fa8p-60, 0x0.94fe0900effb38p-61, -0x0.ad19865e39c648p-62, 0x0.80cd67afe8e358p-63, // subrange 27:0 (6.71089e+07..1.34218e+08)
+ 0x0.906eba8214db68p0, -0x0.ab2af01a1640f0p-57, 0x0.ab2bbd41d1f350p-58, -0x0.98a9970d7a84c0p-59, 0x0.fe5544dc7c3c40p-61, -0x0.bed1db1dbe7530p-62, 0x0.94fe0900ef87c8p-63, -0x0.ad19865e39add0p-64, 0x0.80cd67afea0b10p-65, // subrange 28:0 (1.34218e+08..2.68435e+08)
+};
+// clang-format on
+//--- End of autogenerated code
+
+//! Computes im_w_of_x(x) by one lookup and one polynomial of order 8, for any x.
+//! Octave j runs from 2^(j-1) to 2^j, and is divided into 1 to 32 subranges.
+//! Tabulated are Im w(x)/x in octaves below j=0, Im w(x) up to j=4, and x*Im w(x) beyond.
+//! The lowest and highest octave are valid for all arguments below and above.
+
+static inline CERF_INLINE_CONSTEXPR double cerf_inline_im_w_of_x_uniform(double x) {
+    const int jlo = -28; // first tabulated octave
+    const int jhi = 28;  // last tabulated octave
+    const int jdir = 0;  // first octave where Im w(x) is tabulated
+    const int jdiv = 5;  // first octave where x*Im w(x) is tabulated
+
+    const double ax = x < 0 ? -x : x;
+
+    int je;
+#ifdef CERF_NO_IEEE754
+    // frexp from math.h returns 0 for x=0, and is unspecified for Inf and NaN.
+    const double xm = cerf_inline_frexp2(ax < 0x1p28 ? (ax >= 0x1p-29 ? ax : 0x1p-29) : 0x1p27, &je);
+#else
+    const double xm = cerf_inline_frexp2(ax, &je);
+#endif
+    // Clamp the octave, as in cerf_inline_erfcx_uniform_kernel.
+    const int jc = je < jlo ? jlo : je > jhi ? jhi : je;
+
+    const int n = CerfImwxUniformOctaves[2 * (jc - jlo) + 1]; // number of subranges in octave
+    const int ip = (int)((2 * n) * xm); // index in octave + n
+    const int lij = CerfImwxUniformOctaves[2 * (jc - jlo)] + ip - n; // index in lookup table
+    const double t = (4 * n) * xm - (1 + 2 * ip);
+
+    SET_INFO(95, lij);
+
+    double y = CerfImwxUniformCoeffs[lij * 9 + 8];
+    for (int k = 7; k >= 0; --k)
+        y = y * t + CerfImwxUniformCoeffs[lij * 9 + k];
+    // Multiply and divide unconditionally, to avoid control flow that would prevent vectorization.
+    const double sgn = x < 0 ? -1. : 1.;
+    return y * (je < jdir ? x : je < jdiv ? sgn : 1.) / (je < jdiv ? 1. : x);
+}
+
+//! Computes Im w(x) = 2*dawson(x)/sqrt(pi).
+
+static inline CERF_INLINE_CONSTEXPR double cerf_inline_im_w_of_x(double x) {
+    // Steven G. Johnson, October 2012.
+    // Rewritten for better accuracy by Joachim Wuttke, Sept 2024.
+
+    // Uses three different methods:
+    // - asymptotic expansion for large |x|,
+    // - Chebyshev polynomials for medium |x|,
+    // - Taylor (Maclaurin) series for small |x|.
+
+#ifdef CERF_UNIFORM
+    return cerf_inline_im_w_of_x_uniform(x);
+#else
+
+    const double ax = x < 0 ? -x : x;
+
+    if (ax < .51) {
+        // Use Taylor expansion (2/sqrt(pi)) * (x - 2/3 x^3  + 4/15 x^5  - 8/105 x^7 ...)
+
+        const double x2 = x * x;
+
+        if (ax < .083) {
+            if (ax < 0.003) {
+		SET_INFO(60, 4);
+                return ((((-0.085971746064420005629) * x2 // x^7
+                          + 0.30090111122547001970) * x2 // x^5
+                         - 0.75225277806367504925) * x2 // x^3
+                        + 1.1283791670955125739) * x;
+            }
+
+	    SET_INFO(60, 7);
+            return (((((((+0.00053440090793734269229) * x2 // x^13
+                         - 0.0034736059015927275001) * x2 // x^11
+                        + 0.019104832458760001251) * x2 // x^9
+                       - 0.085971746064420005629) * x2 // x^7
+                      + 0.30090111122547001970) * x2 // x^5
+                     - 0.75225277806367504925) * x2 // x^3
+                    + 1.1283791670955125739) * x;
+        }
+
+        if (ax < .272) {
+	    SET_INFO(60, 10);
+            return ((((((((((-8.82395720020380130481012927e-7) * x2 // x^19
+                            + 8.38275934019361123956e-6) * x2 // x^17
+                           - 7.1253454391645686483238e-5) * x2 // x^15
+                          + 0.00053440090793734269229) * x2 // x^13
+                         - 0.0034736059015927275001) * x2 // x^11
+                        + 0.019104832458760001251) * x2 // x^9
+                       - 0.085971746064420005629) * x2 // x^7
+                      + 0.30090111122547001970) * x2 // x^5
+                     - 0.75225277806367504925) * x2 // x^3
+                    + 1.1283791670955125739) * x;
+        }
+
+	SET_INFO(60, 13);
+#ifdef CERF_ESTRIN
+        // Split into two independent chains in x^4.
+        const double x4 = x2 * x2;
+        return ((((((((+5.8461000084165966602290712e-10) * x4 // x^25
+                     + 8.40376876209885782941868884e-8) * x4 // x^21
+                    + 8.38275934019361123956e-6) * x4 // x^17
+                   + 0.00053440090793734269229) * x4 // x^13
+                  + 0.019104832458760001251) * x4 // x^9
+                 + 0.30090111122547001970) * x4 // x^5
+                + 1.1283791670955125739) // x^1
+               + (((((((-7.30762501052074563638866034e-9) * x4 // x^23
+                       - 8.82395720020380130481012927e-7) * x4 // x^19
+                      - 7.1253454391645686483238e-5) * x4 // x^15
+                     - 0.0034736059015927275001) * x4 // x^11
+                    - 0.085971746064420005629) * x4 // x^7
+                   - 0.75225277806367504925) * x2)) * x; // x^3
+#else
+        return (((((((((((((+5.8461000084165966602290712e-10) * x2 // x^25
+                           - 7.30762501052074563638866034e-9) * x2 // x^23
+                          + 8.40376876209885782941868884e-8) * x2 // x^21
+                         - 8.82395720020380130481012927e-7) * x2 // x^19
+                        + 8.38275934019361123956e-6) * x2 // x^17
+                       - 7.1253454391645686483238e-5) * x2 // x^15
+                      + 0.00053440090793734269229) * x2 // x^13
+                     - 0.0034736059015927275001) * x2 // x^11
+                    + 0.019104832458760001251) * x2 // x^9
+                   - 0.085971746064420005629) * x2 // x^7
+                  + 0.30090111122547001970) * x2 // x^5
+                 - 0.75225277806367504925) * x2 // x^3
+                + 1.1283791670955125739) * x;
+#endif
+    }
+
+    if (ax < 12.) {
+        // Intermediate range: Use Chebyshev interpolants.
+
+	SET_ALGO(80);
+        return x < 0 ? -cerf_inline_im_w_of_x_cheb(ax) : cerf_inline_im_w_of_x_cheb(ax);
+    }
+
+    /* else */ {
+        // Use asymptotic expansion up to N = 0, 3, 6, or 10
+        //
+        // With N=15 or 20 we could extend the range down to 7.73 or 6.72,
+        // but we expect Chebyshev to be faster.
+        //
+        // Coefficient are a_0 = 1/sqrt(pi), a_N = (2N-1)!!/2^N/sqrt(pi).
+
+        const double r = 1 / x;
+
+        if (ax < 150) {
+            if (ax < 23.2) {
+		SET_INFO(90, 11);
+                return (((((((((((+3.6073371500083758e+05) * (r * r) +
+                                 3.7971970000088164e+04) * (r * r) +
+                                4.4672905882456671e+03) * (r * r) +
+                               5.9563874509942218e+02) * (r * r) +
+                              9.1636730015295726e+01) * (r * r) +
+                             1.6661223639144676e+01) * (r * r) +
+                            3.7024941420321507e+00) * (r * r) +
+                           1.0578554691520430e+00) * (r * r) +
+                          4.2314218766081724e-01) * (r * r) +
+                         2.8209479177387814e-01) * (r * r) +
+                        5.6418958354775628e-01) * r;
+            }
+
+	    SET_INFO(90, 7);
+            return (((((((+9.1636730015295726e+01) * (r * r) +
+                         1.6661223639144676e+01) * (r * r) +
+                        3.7024941420321507e+00) * (r * r) +
+                       1.0578554691520430e+00) * (r * r) +
+                      4.2314218766081724e-01) * (r * r) +
+                     2.8209479177387814e-01) * (r * r) +
+                    5.6418958354775628e-01) * r;
+        }
+
+        if (ax < 6.9e7) {
+	    SET_INFO(90, 4);
+            return ((((+1.0578554691520430e+00) * (r * r) + 4.2314218766081724e-01) * (r * r) +
+                     2.8209479177387814e-01) * (r * r) +
+                    5.6418958354775628e-01) * r;
+        }
+
+	SET_INFO(90, 1);
+        // 1-term expansion, important to avoid overflow
+        return 0.56418958354775629 / x;
+    }
+
+#endif // CERF_UNIFORM
+} // cerf_inline_im_w_of_x
+
+/******************************************************************************/
+/*  dawson                                                                    */
+/******************************************************************************/
+
+//! Computes the Dawson integral.
+
+static inline CERF_INLINE_CONSTEXPR double cerf_inline_dawson(double x) {
+    return 0.88622692545275801364 * cerf_inline_im_w_of_x(x); // sqrt(pi)/2
+}
+
+/******************************************************************************/
+/*  w_of_z                                                                    */
+/******************************************************************************/
+
+// Series and Taylor kernels of w_of_z, shared by the library and by the constexpr version
+// cerf_inline_constexpr_w_of_z below. Complex numbers are passed as pairs of doubles,
+// so that the kernels can be used from C and C++.
+
+//! Coefficients of the Maclaurin series of w(z): the coefficient of z^k is CerfWMaclaurin[k]
+//! for even k, and i*CerfWMaclaurin[k] for odd k.
+static CERF_INLINE_CONST double CerfWMaclaurin[20] = {
+    +1.0000000000000000e+00, +1.1283791670955126e+00, -1.0000000000000000e+00,
+    -7.5225277806367508e-01, +5.0000000000000000e-01, +3.0090111122547003e-01,
+    -1.6666666666666666e-01, -8.5971746064419999e-02, +4.1666666666666664e-02,
+    +1.9104832458760001e-02, -8.3333333333333332e-03, -3.4736059015927274e-03,
+    +1.3888888888888889e-03, +5.3440090793734269e-04, -1.9841269841269841e-04,
+    -7.1253454391645692e-05, +2.4801587301587302e-05, +8.3827593401936105e-06,
+    -2.7557319223985893e-06, -8.8239572002038009e-07};
+
+//! Computes (*wr, *wi) = w(x+iy) from the first n terms of the Maclaurin series.
+static inline CERF_INLINE_CONSTEXPR void cerf_inline_w_maclaurin(
+    int n, double x, double y, double* wr, double* wi)
+{
+    SET_INFO(210, n);
+    double rr = (n - 1) % 2 ? 0 : CerfWMaclaurin[n - 1];
+    double ri = (n - 1) % 2 ? CerfWMaclaurin[n - 1] : 0;
+    for (int k = n - 2; k >= 0; --k) {
+        const double t = rr * x - ri * y;
+        ri = rr * y + ri * x;
+        rr = t;
+        if (k % 2)
+            ri += CerfWMaclaurin[k];
+        else
+            rr += CerfWMaclaurin[k];
+    }
+    *wr = rr;
+    *wi = ri;
+}
+
+//! Coefficients of the asymptotic expansion w(z) = i/z sum_k CerfWAsymptotic[k] / z^(2k).
+static CERF_INLINE_CONST double CerfWAsymptotic[20] = {
+    5.6418958354775628e-01, 2.8209479177387814e-01, 4.2314218766081724e-01,
+    1.0578554691520430e+00, 3.7024941420321507e+00, 1.6661223639144676e+01,
+    9.1636730015295726e+01, 5.9563874509942218e+02, 4.4672905882456671e+03,
+    3.7971970000088164e+04, 3.6073371500083758e+05, 3.7877040075087948e+06,
+    4.3558596086351141e+07, 5.4448245107938921e+08, 7.3505130895717545e+09,
+    1.0658243979879044e+11, 1.6520278168812520e+12, 2.7258458978540656e+13,
+    4.7702303212446150e+14, 8.8249260943025370e+15};
+
+//! Computes (*wr, *wi) = w(x+iy) for finite y >= 0 and z2 = x^2 + y^2 >= 49, from the
+//! asymptotic expansion; for z2 > 4.8e15 from its leading term, scaled to prevent overflow.
+static inline CERF_INLINE_CONSTEXPR void cerf_inline_w_asymptotic(
+    double x, double y, double z2, double* wr, double* wi)
+{
+    if (z2 > 4.8e15) {
+        if (x > y || -x > y) {
+            SET_INFO(222, 1);
+            const double yx = y / x;
+            const double denom = 0.56418958354775629 / (x + yx * y);
+            *wr = denom * yx;
+            *wi = denom;
+        } else {
+            SET_INFO(224, 1);
+            const double xy = x / y;
+            const double denom = 0.56418958354775629 / (xy * x + y);
+            *wr = denom;
+            *wi = denom * xy;
+        }
+        return;
+    }
+    const double zm2 = 1 / z2;
+    const double rr = y * zm2, ri = x * zm2; // i/z
+    const double zm4 = zm2 * zm2;
+    const double sr = zm4 * (x + y) * (x - y), si = -2 * zm4 * x * y; // 1/z^2
+    const int n = z2 > 540 ? (z2 > 22500 ? 4 : 12) : 20;
+    SET_INFO(220, n);
+    double qr = CerfWAsymptotic[n - 1] * sr;
+    double qi = CerfWAsymptotic[n - 1] * si;
+    for (int k = n - 2; k >= 1; --k) {
+        qr += CerfWAsymptotic[k];
+        const double t = qr * sr - qi * si;
+        qi = qr * si + qi * sr;
+        qr = t;
+    }
+    qr += CerfWAsymptotic[0];
+    *wr = qr * rr - qi * ri;
+    *wi = qr * ri + qi * rr;
+}
+
+//--- The following code is generated by dev/w/arrange_polyominoes.py 20 d30N20b16.dat; do not edit
+// clang-format off
+alignas(64) static CERF_INLINE_CONST short CerfWTaylorCenters[2 * 91] = {
+  0,  3,
+  0,  7,
+  0, 15,
+  0, 25,
+  0, 36,
+  0, 54,
+  0, 77,
+  0,106,
+  3,  0,
+  5,  0,
+  7,  0,
+  9,  0,
+ 11,  0,
+ 13,  0,
+ 15,  0,
+ 17,  0,
+ 19,  0,
+ 21,  0,
+ 25,  0,
+ 29,  0,
+ 35,  0,
+ 41,  0,
+ 49,  0,
+ 57,  0,
+ 67,  0,
+ 81,  0,
+ 99,  0,
+111,  0,
+  4,  4,
+  5, 10,
+  6, 21,
+ 11, 44,
+ 11, 30,
+  8,  4,
+  9,  8,
+  9, 14,
+ 15, 66,
+ 10,  4,
+ 13, 10,
+ 13, 20,
+ 14,  4,
+ 16, 16,
+ 17,  8,
+ 20, 55,
+ 20, 27,
+ 21, 36,
+ 19, 93,
+ 19,  4,
+ 21, 12,
+ 23, 20,
+ 24,  7,
+ 26, 81,
+ 25,  4,
+ 29, 44,
+ 28, 12,
+ 29, 16,
+ 30, 28,
+ 31,  5,
+ 36, 37,
+ 35,  8,
+ 37, 20,
+ 37, 62,
+ 37, 14,
+ 32,104,
+ 27, 99,
+ 41,  4,
+ 43, 26,
+ 47, 50,
+ 44, 13,
+ 49, 10,
+ 51, 20,
+ 53, 36,
+ 52, 80,
+ 53, 89,
+ 58, 25,
+ 57,  9,
+ 60, 58,
+ 61, 67,
+ 66, 18,
+ 68, 45,
+ 69,  8,
+ 73, 34,
+ 83, 22,
+ 78, 70,
+ 84, 13,
+ 60, 90,
+ 86, 53,
+ 84, 10,
+ 96, 37,
+103, 20,
+ 88, 49,
+};
+
+alignas(64) static CERF_INLINE_CONST signed char CerfWTaylorCover[4096] = {
+-1, 0, 0, 1, 1, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,-1,-1,-1,-1,-1,-1,-1,-1,
+ 8,28,28, 1,29,29, 2, 2, 2,30, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4,31, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,-1,-1,-1,-1,-1,-1,-1,-1,
+ 9,28,28,29,29,29,29, 2,30,30,30, 3, 3, 3,32, 4, 4, 4, 4, 4, 4,31,31, 5, 5, 5, 5, 5, 5, 5, 5,36,36, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,46, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,-1,-1,-1,-1,-1,-1,-1,-1,
+10,33,33,34,29,29,35,35,30,30,30,30,30,32,32,32,32, 4, 4,31,31,31,31,31, 5, 5, 5, 5, 5, 5,36,36,36, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,46,46, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,-1,-1,-1,-1,-1,-1,-1,-1,
+11,33,33,34,34,35,35,35,35,30,30,30,32,32,32,32,32,32,31,31,31,31,31,31,31, 5, 5, 5, 5,36,36,36,36,36, 6, 6, 6, 6, 6, 6, 6, 6, 6,46,46,46, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,-1,-1,-1,-1,-1,-1,-1,-1,
+12,37,37,34,34,38,35,35,39,39,39,39,32,32,32,32,32,32,31,31,31,31,31,31,31,31,43,43,43,36,36,36,36,36,36, 6, 6, 6, 6, 6, 6, 6,46,46,46,46,46, 7, 7, 7, 7, 7, 7, 7, 7, 7,-1,-1,-1,-1,-1,-1,-1,-1,
+13,40,40,38,38,38,38,41,39,39,39,39,32,32,32,32,32,32,31,31,31,31,31,31,31,31,43,43,43,36,36,36,36,36,36,36,36,36, 6,51,51,46,46,46,46,46,46,46, 7, 7, 7, 7, 7, 7, 7, 7,-1,-1,-1,-1,-1,-1,-1,-1,
+14,40,40,42,38,38,41,41,41,39,39,39,44,32,32,32,32,45,45,31,31,31,31,31,31,43,43,43,43,43,36,36,36,36,36,36,36,36,36,51,51,46,46,46,46,46,46,46,46,46, 7, 7, 7, 7, 7, 7,-1,-1,-1,-1,-1,-1,-1,-1,
+15,47,47,42,42,42,41,41,41,41,39,44,44,44,44,44,45,45,45,45,45,31,31,31,43,43,43,43,43,43,36,36,36,36,36,36,36,36,51,51,51,51,46,46,46,46,46,46,46,46,46,46,64,64,64,64,-1,-1,-1,-1,-1,-1,-1,-1,
+16,47,47,42,42,48,48,41,41,49,49,44,44,44,44,44,45,45,45,45,45,45,31,43,43,43,43,43,43,43,43,36,36,36,36,36,36,51,51,51,51,51,46,46,46,46,46,46,46,46,46,64,64,64,64,64,-1,-1,-1,-1,-1,-1,-1,-1,
+17,47,47,50,48,48,48,48,49,49,49,49,44,44,44,44,45,45,45,45,45,45,53,43,43,43,43,43,43,43,43,36,36,36,36,36,36,51,51,51,51,51,51,46,46,46,46,46,46,64,64,64,64,64,64,63,-1,-1,-1,-1,-1,-1,-1,-1,
+18,52,50,50,50,48,48,49,49,49,49,49,44,44,44,44,45,45,45,45,45,53,53,53,43,43,43,43,43,43,43,36,36,36,36,36,51,51,51,51,51,51,51,51,46,46,46,46,64,64,64,64,64,64,63,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+18,52,52,50,50,54,54,55,49,49,49,49,44,44,56,56,45,45,45,45,53,53,53,53,53,43,43,43,43,43,43,43,36,36,36,51,51,51,51,51,51,51,51,51,46,46,46,64,64,64,64,64,64,63,63,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+18,52,52,50,54,54,54,55,55,55,49,56,56,56,56,56,56,45,45,53,53,53,53,53,53,53,43,43,43,43,43,61,61,61,51,51,51,51,51,51,51,51,51,51,51,64,64,64,64,64,64,64,63,63,63,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+19,57,57,57,54,54,54,55,55,55,55,56,56,56,56,56,56,58,53,53,53,53,53,53,53,53,43,43,43,61,61,61,61,61,61,51,51,51,51,51,51,51,51,51,51,64,64,64,64,64,64,63,63,63,63,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+19,57,57,57,59,54,54,55,55,55,60,56,56,56,56,56,56,58,58,53,53,53,53,53,53,53,61,61,61,61,61,61,61,61,61,61,51,51,51,51,51,51,51,51,51,64,64,64,64,64,63,63,63,63,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+20,57,57,59,59,59,62,55,55,60,60,60,56,56,56,56,58,58,58,58,53,53,53,53,53,53,61,61,61,61,61,61,61,61,61,61,51,51,51,51,51,51,51,51,51,64,64,64,64,63,63,63,63,63,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+20,20,59,59,59,59,62,62,60,60,60,60,60,56,56,56,58,58,58,58,58,53,53,53,53,61,61,61,61,61,61,61,61,61,61,61,61,51,51,51,51,51,51,51,51,64,64,64,63,63,63,63,63,63,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+20,65,59,59,59,62,62,62,60,60,60,60,60,66,66,58,58,58,58,58,58,58,53,53,67,67,61,61,61,61,61,61,61,61,61,61,61,51,51,51,51,51,51,51,64,64,64,63,63,63,63,63,63,63,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+21,21,65,65,59,62,62,62,60,60,60,60,66,66,66,66,58,58,58,58,58,58,67,67,67,67,67,61,61,61,61,61,61,61,61,61,61,72,72,72,51,51,72,73,73,73,63,63,63,63,63,63,63,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+21,21,65,65,68,68,68,68,60,60,60,66,66,66,66,66,58,58,58,58,58,58,67,67,67,67,67,67,61,61,61,61,61,61,61,61,72,72,72,72,72,72,72,73,73,73,73,63,63,63,63,63,63,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+21,21,65,65,68,68,68,68,68,60,66,66,66,66,66,66,66,58,58,58,67,67,67,67,67,67,67,67,61,61,61,61,61,61,61,61,72,72,72,72,72,72,72,73,73,73,73,73,73,63,63,63,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+22,65,65,69,68,68,68,68,68,70,66,66,66,66,66,66,71,71,71,71,67,67,67,67,67,67,67,67,67,61,61,61,61,61,61,72,72,72,72,72,72,72,72,73,73,73,73,73,73,73,63,63,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+22,22,69,69,69,69,68,68,68,70,70,66,66,66,66,66,71,71,71,71,71,67,67,67,67,67,67,67,67,67,61,61,61,61,72,72,72,72,72,72,72,72,72,73,73,73,73,73,73,73,73,63,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+22,22,69,69,69,69,69,69,70,70,70,70,70,66,66,71,71,71,71,71,71,67,67,67,67,67,67,67,67,67,76,77,77,77,72,72,72,72,72,72,72,72,73,73,73,73,73,73,73,73,73,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+22,22,69,69,69,69,69,70,70,70,70,70,70,74,71,71,71,71,71,71,71,71,67,67,67,67,67,67,67,76,76,76,77,77,77,72,72,72,72,72,72,72,73,73,73,73,73,73,73,73,73,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+22,23,75,75,75,69,69,70,70,70,70,70,74,74,74,71,71,71,71,71,71,71,67,67,67,67,67,76,76,76,76,76,77,77,77,77,72,72,72,72,72,72,73,73,73,73,73,73,73,73,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+23,23,75,75,75,75,75,70,70,70,70,74,74,74,74,71,71,71,71,71,71,71,67,67,67,67,76,76,76,76,76,76,77,77,77,77,72,72,72,72,72,72,73,73,73,73,73,73,73,73,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+23,23,23,75,75,75,75,75,74,70,74,74,74,74,74,74,71,71,71,71,71,71,79,76,76,76,76,76,76,76,76,77,77,77,77,77,77,72,72,72,72,72,73,85,85,85,85,85,85,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+23,23,75,75,75,75,75,78,78,74,74,74,74,74,74,74,71,71,71,71,71,79,79,79,76,76,76,76,76,76,76,77,77,77,77,77,77,77,72,72,72,85,85,85,85,85,85,85,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+23,23,75,75,75,75,75,78,78,78,74,74,74,74,74,74,71,71,71,71,79,79,79,79,79,76,76,76,76,76,76,77,77,77,77,77,77,77,72,72,72,85,85,85,85,85,85,85,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+24,24,80,80,75,80,78,78,78,78,78,74,74,74,74,74,81,81,79,79,79,79,79,79,79,76,76,76,76,76,76,77,77,77,77,77,77,77,77,72,85,85,85,85,85,85,85,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+24,24,24,80,80,80,78,78,78,78,78,78,74,74,81,81,81,81,79,79,79,79,79,79,79,79,76,76,76,76,76,77,77,77,77,77,77,77,77,85,85,85,85,85,85,85,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+24,24,24,80,80,80,78,78,78,78,78,78,78,81,81,81,81,81,81,79,79,79,79,79,79,79,79,76,76,76,76,77,77,77,77,77,77,77,77,85,85,85,85,85,85,85,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+24,24,24,80,80,80,80,78,78,78,78,78,78,81,81,81,81,81,81,79,79,79,79,79,79,79,79,76,76,76,76,77,77,77,77,77,83,83,83,83,85,85,85,85,85,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+24,24,80,80,80,80,80,78,78,78,78,78,81,81,81,81,81,81,81,81,79,79,79,79,79,79,79,79,76,76,76,83,83,83,83,83,83,83,83,83,83,85,85,85,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+24,80,80,80,80,80,80,78,78,78,78,82,81,81,81,81,81,81,81,81,79,79,79,79,79,79,79,86,83,83,83,83,83,83,83,83,83,83,83,83,83,83,85,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+25,25,80,80,80,80,84,84,82,82,82,82,82,81,81,81,81,81,81,81,81,79,79,79,79,79,79,86,86,83,83,83,83,83,83,83,83,83,83,83,83,83,85,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+25,25,25,87,87,87,84,84,82,82,82,82,82,82,81,81,81,81,81,81,81,79,79,79,79,86,86,86,86,86,83,83,83,83,83,83,83,83,83,83,83,83,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+25,25,25,25,87,87,84,84,82,82,82,82,82,82,81,81,81,81,81,81,81,90,90,86,86,86,86,86,86,86,83,83,83,83,83,83,83,83,83,83,83,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+25,25,25,25,87,87,84,84,84,82,82,82,82,82,82,81,81,81,81,81,90,90,90,90,86,86,86,86,86,86,86,83,83,83,83,83,83,83,83,83,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+25,25,25,25,87,87,84,84,84,82,82,82,82,82,82,82,81,81,88,90,90,90,90,90,86,86,86,86,86,86,86,83,83,83,83,83,83,83,83,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+25,25,25,87,87,87,84,84,84,82,82,82,82,82,82,82,88,88,88,90,90,90,90,90,90,86,86,86,86,86,86,83,83,83,83,83,83,83,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+25,25,87,87,87,87,84,84,84,82,82,82,82,82,82,82,88,88,88,88,90,90,90,90,90,86,86,86,86,86,86,86,83,83,83,83,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+26,87,87,87,87,87,84,84,84,82,82,82,82,82,82,88,88,88,88,88,88,90,90,90,90,90,86,86,86,86,86,86,83,83,83,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+26,26,26,87,87,87,84,84,84,82,82,82,82,82,88,88,88,88,88,88,88,90,90,90,90,90,86,86,86,86,86,86,86,83,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+26,26,26,26,87,87,84,84,89,89,82,82,89,88,88,88,88,88,88,88,88,88,90,90,90,90,90,86,86,86,86,86,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+26,26,26,26,26,89,89,89,89,89,89,89,89,88,88,88,88,88,88,88,88,88,88,90,90,90,90,86,86,86,86,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+26,26,26,26,26,89,89,89,89,89,89,89,89,89,88,88,88,88,88,88,88,88,88,90,90,90,90,90,86,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+26,26,26,26,26,89,89,89,89,89,89,89,89,89,88,88,88,88,88,88,88,88,88,88,90,90,90,90,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+26,26,26,26,26,89,89,89,89,89,89,89,89,89,89,88,88,88,88,88,88,88,88,88,88,90,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+26,26,26,26,26,89,89,89,89,89,89,89,89,89,89,88,88,88,88,88,88,88,88,88,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+26,26,26,26,27,89,89,89,89,89,89,89,89,89,89,88,88,88,88,88,88,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+26,26,26,27,27,27,89,89,89,89,89,89,89,89,89,89,88,88,88,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+26,27,27,27,27,27,89,89,89,89,89,89,89,89,89,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+27,27,27,27,27,27,89,89,89,89,89,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+};
+
+static CERF_INLINE_CONST int CerfWTaylorN = 20;
+alignas(64) static CERF_INLINE_CONST double CerfWTaylorCoeffs[2 * 20 * 91] = {
+ 0x0.d1b5ddbf9b4368p0, 0x0, 0x0, 0x0.d23941dc4f7d88p0, -0x0.aa4b21664c5be0p0, 0x0, 0x0, -0x0.edb98f76d6e5c0p-1, 0x0.9401bbf3283650p-1, 0x0, 0x0, 0x0.a7fa969432afa8p-2, -0x0.b0585271af47d0p-3, 0x0, 0x0, -0x0.ad14ec6654dc80p-4, 0x0.a01e5c48175320p-5, 0x0, 0x0, 0x0.8c81d8aa497d10p-6, -0x0.eb1d198d00b248p-8, 0x0, 0x0, -0x0.bc57f968421e20p-9, 0x0.90f8917226ffa0p-10, 0x0, 0x0, 0x0.d71484a4609170p-12, -0x0.9a28b1675e40f0p-13, 0x0, 0x0, -0x0.d600c002dd94a8p-15, 0x0.9020a8673bddf8p-16, 0x0, 0x0, 0x0.bcb287bd5a52a8p-18, -0x0.f08083a0a2e748p-20, 0x0, 0x0, -0x0.9568d8e6967920p-21, // x=       0 y=  0.1875
+ 0x0.a6318761c3eaa8p0, 0x0, 0x0, 0x0.8f721e8e9e4980p0, -0x0.cedf3406bd5500p-1, 0x0, 0x0, -0x0.82ec643c312930p-1, 0x0.9597c82c67d2f8p-2, 0x0, 0x0, 0x0.9d1eb3ea5d84e0p-3, -0x0.99a16bc1847d38p-4, 0x0, 0x0, -0x0.8d2872adc09d20p-5, 0x0.f581255704b5b0p-7, 0x0, 0x0, 0x0.cb35e82b158240p-8, -0x0.a0d77ba4799a90p-9, 0x0, 0x0, -0x0.f466f02d3e6960p-11, 0x0.b2d04c7f5e5eb8p-12, 0x0, 0x0, 0x0.fca91301b36830p-14, -0x0.acc6a2c3a323d0p-15, 0x0, 0x0, -0x0.e530aa075d9170p-17, 0x0.93b5502ad4e7e8p-18, 0x0, 0x0, 0x0.b94c3cb2d1e0a8p-20, -0x0.e28ff47eb53ed0p-22, 0x0, 0x0, -0x0.872c342c994f00p-23, // x=       0 y=  0.4375
+ 0x0.e3fc09c1390f78p-1, 0x0, 0x0, 0x0.964257be0870a0p-1, -0x0.ae3baefe224bc0p-2, 0x0, 0x0, -0x0.b6e64f3d164da8p-3, 0x0.b0ff73b2ffaeb0p-4, 0x0, 0x0, 0x0.9fe41b35171f98p-5, -0x0.8810b3ed7bca88p-6, 0x0, 0x0, -0x0.dbae58d654cab0p-8, 0x0.a927ae367fd610p-9, 0x0, 0x0, 0x0.f994e216ba6ed8p-11, -0x0.b10e0ec1e039c0p-12, 0x0, 0x0, -0x0.f24ef8f9f64b50p-14, 0x0.a05a1089b8aac8p-15, 0x0, 0x0, 0x0.cdb71532f5d2d0p-17, -0x0.80282d38e37d00p-18, 0x0, 0x0, -0x0.9b59ddde2e1148p-20, 0x0.b77e3a71a161e8p-22, 0x0, 0x0, 0x0.d3790051f8edd0p-24, -0x0.ee18a7c44c83d0p-26, 0x0, 0x0, -0x0.8316eca1a79350p-27, // x=       0 y=  0.9375
+ 0x0.9f90680bf9a980p-1, 0x0, 0x0, 0x0.9e2f49c5ce77d8p-2, -0x0.8fedd9a5c16f78p-3, 0x0, 0x0, -0x0.f3f27e96fc8420p-5, 0x0.c28c80cb1b2f68p-6, 0x0, 0x0, 0x0.9321298d4ba4f0p-7, -0x0.d446eb8c959178p-9, 0x0, 0x0, -0x0.92c355ce951290p-10, 0x0.c33ca1066235e8p-12, 0x0, 0x0, 0x0.faa96de3def728p-14, -0x0.9bb71cf564fbd0p-15, 0x0, 0x0, -0x0.bba65c060bbdb8p-17, 0x0.dbc5ad5d6bb9e0p-19, 0x0, 0x0, 0x0.fa9680bee68c98p-21, -0x0.8b4c713a1d55a8p-22, 0x0, 0x0, -0x0.97362af910ac78p-24, 0x0.a07690e1a5a490p-26, 0x0, 0x0, 0x0.a6a55ed48f0060p-28, -0x0.a98a9c2834f280p-30, 0x0, 0x0, -0x0.a92061667d2b30p-32, // x=       0 y=  1.5625
+ 0x0.eca2236b13c990p-2, 0x0, 0x0, 0x0.b538695d9ba088p-3, -0x0.830ab38712d3d8p-4, 0x0, 0x0, -0x0.b441fcc8cd0bc8p-6, 0x0.ed2caab0fbe998p-8, 0x0, 0x0, 0x0.95e928dd978148p-9, -0x0.b6bba1e9d94068p-11, 0x0, 0x0, -0x0.d76bf5e4cf1718p-13, 0x0.f63b9e64930db0p-15, 0x0, 0x0, 0x0.88bd33323270b0p-16, -0x0.93d7a146907e50p-18, 0x0, 0x0, -0x0.9bdcd2d8bd9070p-20, 0x0.a073c721ba4d78p-22, 0x0, 0x0, 0x0.a17f420e331fa8p-24, -0x0.9f1bdff1b13f48p-26, 0x0, 0x0, -0x0.9998b362a96f10p-28, 0x0.916bf61463e1a0p-30, 0x0, 0x0, 0x0.87259867e43c80p-32, -0x0.f6c2e4ce0c7040p-35, 0x0, 0x0, -0x0.dd75289abf1e20p-37, // x=       0 y=    2.25
+ 0x0.a47c78814cdb88p-2, 0x0, 0x0, 0x0.b4b69a9f8045a8p-4, -0x0.c02660ab8a0c40p-6, 0x0, 0x0, -0x0.c642609d7dce20p-8, 0x0.c6f2f9353f3288p-10, 0x0, 0x0, 0x0.c288c236cfe320p-12, -0x0.b9a871cffee4d8p-14, 0x0, 0x0, -0x0.ad309c4603c020p-16, 0x0.9e1db7d3aeeaf0p-18, 0x0, 0x0, 0x0.8d70209a55ea50p-20, -0x0.f82d82095c54c8p-23, 0x0, 0x0, -0x0.d5bf95c8113d78p-25, 0x0.b4df9f16cf6d18p-27, 0x0, 0x0, 0x0.967d4da967efc8p-29, -0x0.f664196d2355d0p-32, 0x0, 0x0, -0x0.c695a61f6acb10p-34, 0x0.9dabaa854274f0p-36, 0x0, 0x0, 0x0.f6c6cc38649828p-39, -0x0.be710f8538f460p-41, 0x0, 0x0, -0x0.90fefe86b6cd70p-43, // x=       0 y=   3.375
+ 0x0.eb376260c61f78p-3, 0x0, 0x0, 0x0.bbda54f76b1ec0p-5, -0x0.934b427193e780p-7, 0x0, 0x0, -0x0.e2fb6b3b1904b8p-10, 0x0.ac003f006daa58p-12, 0x0, 0x0, 0x0.80472f9086e500p-14, -0x0.bc7112f07948d8p-17, 0x0, 0x0, -0x0.886613da3641e0p-19, 0x0.c2b2186f800c88p-22, 0x0, 0x0, 0x0.8914ebc0fa8268p-24, -0x0.be85eb7baa9740p-27, 0x0, 0x0, -0x0.82bc46607f59d8p-29, 0x0.b13ccefdb1fb88p-32, 0x0, 0x0, 0x0.ed7325fedb67a0p-35, -0x0.9d3de52f76d7b8p-37, 0x0, 0x0, -0x0.cdf1d66ddfab28p-40, 0x0.8569a8c5792b10p-42, 0x0, 0x0, 0x0.ab0a39e2f80c98p-45, -0x0.d90ab886aa5188p-48, 0x0, 0x0, -0x0.8856d3d0b48540p-50, // x=       0 y=  4.8125
+ 0x0.ac7c8ea62be650p-3, 0x0, 0x0, 0x0.cbca303c405828p-6, -0x0.ee47ad11a75328p-9, 0x0, 0x0, -0x0.89e7137825f0c8p-11, 0x0.9e0f4d2a87c5b8p-14, 0x0, 0x0, 0x0.b370c1b159b408p-17, -0x0.c9d3baf8ca6330p-20, 0x0, 0x0, -0x0.e0f558cf01d9b0p-23, 0x0.f888d6d5cdae48p-26, 0x0, 0x0, 0x0.881ca2d4fc9818p-28, -0x0.93d5d4204875b0p-31, 0x0, 0x0, -0x0.9f40b0774caa30p-34, 0x0.aa2d6a8fdfb298p-37, 0x0, 0x0, 0x0.b46d15da21a060p-40, -0x0.bdd30442233528p-43, 0x0, 0x0, -0x0.c63613d86a6978p-46, 0x0.cd71de9758ae68p-49, 0x0, 0x0, 0x0.d367c017348038p-52, -0x0.d7ffa739cfac48p-55, 0x0, 0x0, -0x0.db28ac823968c0p-58, // x=       0 y=   6.625
+ 0x0.f728078f76cb38p0, 0x0.d3a44c2ddf7f60p-2, -0x0.b95e05ab991868p-1, 0x0.868306efee6170p1, -0x0.e5c737076070f0p0, -0x0.ceb46b4ae288c0p-1, 0x0.b505d1899381d8p-1, -0x0.a66e17e08faeb0p0, 0x0.d4ceab627a9cc0p-1, 0x0.868eda1f8c3520p-1, -0x0.b0bd41566ecc30p-2, 0x0.f61ab8af5da928p-2, -0x0.82d348d6ead118p-2, -0x0.d22c79eaa6a6a8p-3, 0x0.e60591231ea870p-4, -0x0.815f2c255a4e98p-3, 0x0.f0160c128ac260p-5, 0x0.ea6e5231a79568p-5, -0x0.e078903d350980p-6, 0x0.d27555dab622d8p-6, -0x0.af3bcba3d7d468p-7, -0x0.cb5441cb53ba28p-7, 0x0.af33083d80eca8p-8, -0x0.8b327fc5903560p-8, 0x0.d3beae7d6fa848p-10, 0x0.9040a92e90d4c0p-9, -0x0.e3d89435651e38p-11, 0x0.9aacd881796438p-11, -0x0.d99500ae34c638p-13, -0x0.ad2571854c0640p-12, 0x0.fdea3374dd6e70p-14, -0x0.93ac17521c03e0p-14, 0x0.c1c70bdb4003e0p-16, 0x0.b411829d255670p-15, -0x0.f78716998bb360p-17, 0x0.f631c98de2d9e8p-18, -0x0.979e8fc450d0f0p-19, -0x0.a5309a13f97878p-18, 0x0.d66de98c6b5bf8p-20, -0x0.b53d3316036ea0p-21, // x=  0.1875 y=       0
+ 0x0.e82e9230961578p0, 0x0.a93bbabc1bab10p-1, -0x0.911d1b5e5dcd68p0, 0x0.ebfacaa9611160p0, -0x0.bad579a318c548p0, -0x0.9e5c3cb2fc2af8p0, 0x0.87aa8b96390760p0, -0x0.f8a7f4ec985a90p-1, 0x0.90702e0426f2f8p-1, 0x0.c5367af7f3f918p-1, -0x0.fd2cead7cb6220p-2, 0x0.959f25327ce3c8p-2, -0x0.8bd6e1c33ee4d8p-3, -0x0.930f90853a5320p-2, 0x0.9d28481150b118p-3, -0x0.ecf2edcb185f90p-5, 0x0.b574967bab5b00p-6, 0x0.9c510dcf2946e0p-4, -0x0.91fef710213b40p-5, 0x0.f78eb3d8365b30p-8, -0x0.90552ce8f0f000p-9, -0x0.80ebdf751b7888p-6, 0x0.d875472f88a2d0p-8, -0x0.fb5cb010f46a38p-12, 0x0.c0fd5e44f62f98p-16, 0x0.ad8819c1963810p-9, -0x0.8559979bb01d60p-10, -0x0.e09327c8a164d8p-15, 0x0.b0b708b4ea0200p-15, -0x0.c511945b43ebd0p-12, 0x0.8c66311761f398p-13, 0x0.bf44071d02fc60p-16, -0x0.b01b6309123940p-17, 0x0.c1554037b2dce0p-15, -0x0.80e734da8bdad0p-16, -0x0.92debbe1cc9998p-18, 0x0.e427039dec1e38p-20, -0x0.a6c07d39ab70c8p-18, 0x0.d19853d85b5b50p-20, 0x0.a78fe7976d9f08p-21, // x=  0.3125 y=       0
+ 0x0.d3676f4fb82340p0, 0x0.ded80dc886cf10p-1, -0x0.b8fa8165c11ed8p0, 0x0.bf5eeefc6ebc38p0, -0x0.8279d6b333a5c0p0, -0x0.c3258f72b3d9e0p0, 0x0.a15fdf8d6fcf90p0, -0x0.8d5355a3001130p-1, 0x0.ef7f93954aebc0p-3, 0x0.e20fca2e5bdda0p-1, -0x0.8b93e14c7b2060p-1, 0x0.87c15d624c6720p-4, 0x0.cb33c8176cd088p-10, -0x0.9ba83e31280788p-2, 0x0.9f51a240d000a8p-3, 0x0.9c2a5acd667498p-6, -0x0.8e943d1913b3d0p-6, 0x0.976315b58a3a58p-4, -0x0.86af945db9b610p-5, -0x0.bb27005a43b688p-7, 0x0.d057e588de8f50p-8, -0x0.e1d7ec4dc40a30p-7, 0x0.b3557cd1cde058p-8, 0x0.cff85714928800p-9, -0x0.bf338818706ba0p-10, 0x0.8765d72fad5788p-9, -0x0.c2fae4d78bca88p-11, -0x0.a46f51fbf52658p-11, 0x0.85a1613b31b6d8p-12, -0x0.862f9df6fe5188p-12, 0x0.b0cc5d692ba4d8p-14, 0x0.ceb50d5ffc9140p-14, -0x0.98f7bb72b27ce0p-15, 0x0.df27a100fd6350p-16, -0x0.86e7b152e63628p-17, -0x0.d98511de34f898p-17, 0x0.951649a35897d0p-18, -0x0.9c10764e8fd298p-19, 0x0.ac481cfe98fae0p-21, 0x0.c58c85bb9ee820p-20, // x=  0.4375 y=       0
+ 0x0.ba903bcc873ce8p0, 0x0.842f11895cc800p0, -0x0.d1e24346182488p0, 0x0.8c288149a155d0p0, -0x0.8901ebea3350b8p-1, -0x0.d305da42c78848p0, 0x0.a59c89154f0cd0p0, -0x0.e4e24580b661e0p-4, -0x0.c538b9371676c0p-4, 0x0.db11ceb44df1b0p-1, -0x0.fde27750986aa0p-2, -0x0.9762c5bbbb45f8p-3, 0x0.8013b647679120p-3, -0x0.83da9c99451298p-2, 0x0.f8fc7b7c03c210p-4, 0x0.ab44fa3b8521a0p-4, -0x0.c61ab902489fb0p-5, 0x0.d789d2d1ccb3b0p-5, -0x0.abcb869f712f40p-6, -0x0.ce1fc4e95b4ad8p-6, 0x0.c5232be5b390d0p-7, -0x0.fc1b058044d778p-8, 0x0.a93c8ef2aca0c8p-9, 0x0.afb1242277fb00p-8, -0x0.934a755537e4f0p-9, 0x0.cc5f2c3bd72308p-11, -0x0.d4a41fdf5b89e0p-13, -0x0.e9ec1a25c15ce8p-11, 0x0.b0e042cdcb8ea0p-12, -0x0.a660d5c5f321c8p-15, 0x0.e90e2e63a2c2d8p-20, 0x0.ffc19b5fb209b0p-14, -0x0.b1635ac7e39a30p-15, -0x0.f2b1f20b6a5240p-19, 0x0.ae1d12191497c8p-19, -0x0.ecb25549e0a128p-17, 0x0.983cbd763a8ef8p-18, 0x0.ac47d235b29bc0p-20, -0x0.916c615d82b988p-21, 0x0.bd1f657b087b28p-20, // x=  0.5625 y=       0
+ 0x0.9f937e1d211d08p0, 0x0.92678e0b685d70p0, -0x0.db6acd680d87f0p0, 0x0.af1e2368f46cb8p-1, -0x0.8ba10e597cf968p-4, -0x0.ce99ea377c62c8p0, 0x0.96472603ee99c0p0, 0x0.91475384737980p-2, -0x0.bd2db27a387440p-2, 0x0.b5a1a7dcb889e8p-1, -0x0.bc6babbe47d610p-2, -0x0.9e023dbb2d4940p-2, 0x0.d47a7b08b13a48p-3, -0x0.a9c12e30814ba8p-3, 0x0.83dd3883c35498p-4, 0x0.f7454f8d8b1f28p-4, -0x0.80e7433afe2fb0p-4, 0x0.a982b5afb2f1e0p-6, -0x0.99c0cf44492a08p-8, -0x0.f5b1943fc53990p-6, 0x0.d8d0e037e220d0p-7, -0x0.f432d2f8908140p-17, -0x0.d1fdaa3afcbea0p-11, 0x0.b2bef4cfed8458p-8, -0x0.8a875144e62db8p-9, -0x0.a336e931f403a0p-11, 0x0.b5d43e115f4da8p-12, -0x0.cabb5e7d16d3b8p-11, 0x0.8c75cda3e48ef0p-12, 0x0.ace8fca91d8c20p-13, -0x0.947a41d66d0880p-14, 0x0.b88c14555b7718p-14, -0x0.e5e194a613a2f0p-16, -0x0.ec5923a674fd10p-16, 0x0.b0ee2511dabcb8p-17, -0x0.87756b7cf05638p-17, 0x0.9646dc5c63f3a0p-19, 0x0.fb7a396bea50a0p-19, -0x0.aabe96b09e3ed0p-20, 0x0.9b5846183cbd40p-21, // x=  0.6875 y=       0
+ 0x0.844b13b092b978p0, 0x0.9a368abf6f0798p0, -0x0.d6f9fffeee6d68p0, 0x0.99134e345529e0p-2, 0x0.a980313a3bfda8p-2, -0x0.b94e76a2105418p0, 0x0.f0ba9d5422fd28p-1, 0x0.95b93bc8caa278p-1, -0x0.8c2bdc38bd3640p-1, 0x0.f8f66cb0fc0430p-2, -0x0.caf190a34201c0p-3, -0x0.c8b11326f40358p-2, 0x0.f1dbe777de28d8p-3, -0x0.e5117858e4ae98p-5, 0x0.eb453968c93968p-10, 0x0.fff3419243b388p-4, -0x0.f35a37f5286fd0p-5, -0x0.bad9d234c95520p-7, 0x0.a9381fb5424810p-7, -0x0.d2a4903294ab78p-6, 0x0.a72f0e0378c760p-7, 0x0.d3a87e9c645e50p-8, -0x0.dddbe528c90750p-9, 0x0.f3daac558c0c10p-9, -0x0.a2d32f49954280p-10, -0x0.cf26386a18d778p-10, 0x0.b13c1dc41c1a08p-11, -0x0.c48db7e5788f70p-12, 0x0.cf989996a8c8f8p-14, 0x0.8d2f6eb98c3058p-12, -0x0.d38a4174b486e8p-14, 0x0.ae97d974b8de30p-16, -0x0.8ee1119f586d78p-19, -0x0.960d24c47993a8p-15, 0x0.ca82cbac78ba08p-17, 0x0.8255a9f5bd8ac0p-20, -0x0.e5039024154dd8p-21, 0x0.826ff8d8a75888p-18, -0x0.a0bdfdc59747a8p-20, -0x0.e95efa6785a620p-22, // x=  0.8125 y=       0
+ 0x0.d499ebee9107e0p-1, 0x0.9c42d7daa00528p0, -0x0.c7504d2fa7f760p0, -0x0.83fbf6b84a5ae8p-5, 0x0.a11ca4cac9e7f8p-1, -0x0.9864f62039d780p0, 0x0.a50e7feb7718d8p-1, 0x0.c3fe089aa0bbd0p-1, -0x0.9ded1e5bc4c7a0p-1, 0x0.f217885ef9fdc8p-3, -0x0.d99c2c4587e290p-6, -0x0.ca2fa3a71c42a0p-2, 0x0.db11978a685908p-3, 0x0.b6ad0df8795438p-5, -0x0.cba11c0a5c6398p-5, 0x0.ce9ab24db49e98p-4, -0x0.ab57d4f7fab1b0p-5, -0x0.8e83c7128aff68p-5, 0x0.a1e516fa26d9e0p-6, -0x0.f888c1c1cd4520p-7, 0x0.98ba5051272c20p-8, 0x0.a09ca9fcc5afb0p-7, -0x0.8fc65e66aba8e0p-8, 0x0.8e7cec35915db8p-10, -0x0.bf58fe0997e880p-14, -0x0.ec69bce410f638p-10, 0x0.b46749ff26ef70p-11, 0x0.c2d43363101670p-14, -0x0.a5f43d46dd2878p-14, 0x0.8091e35c264bf8p-12, -0x0.abafa523099e98p-14, -0x0.b48635546eda78p-15, 0x0.a374740bdb1690p-16, -0x0.d6d45238829cb8p-16, 0x0.fb0fb85ad71910p-18, 0x0.84576777f69ff8p-17, -0x0.c59902e4931cd8p-19, 0x0.87d1334e780188p-19, -0x0.856bc9431cbfa0p-21, -0x0.8a405de3aabce8p-20, // x=  0.9375 y=       0
+ 0x0.a592f34b58f4f8p-1, 0x0.998fc874c6adc0p0, -0x0.afec22800e8448p0, -0x0.95d053cff1e980p-2, 0x0.d042d604c5e420p-1, -0x0.e388e46314d770p-1, 0x0.ae1702240e5d90p-2, 0x0.d31bbdb62a1118p-1, -0x0.965f8793f6c2e8p-1, 0x0.cedab462095100p-8, 0x0.e8b99656fccdd0p-4, -0x0.aa42a52ac850b8p-2, 0x0.9f492cd08c3f78p-3, 0x0.ece4863a90eb58p-4, -0x0.a333bd052faa78p-4, 0x0.f556ba508429a0p-5, -0x0.912b60cb95d9c8p-6, -0x0.b79d4c9aab90b8p-5, 0x0.b3583b511f8768p-6, -0x0.b2a93c2b4dc698p-9, -0x0.913ac721f21378p-10, 0x0.9c6207ae096258p-7, -0x0.f6d64bc5a0a8e8p-9, -0x0.b0b70d43097e48p-10, 0x0.df40b80ca27e20p-11, -0x0.b1379fe42d7f68p-10, 0x0.e6d021167ceb90p-12, 0x0.e09edd035eaae0p-12, -0x0.c5a42a129e3428p-13, 0x0.86587cc852b008p-13, -0x0.86342d95f86640p-15, -0x0.9ddcbb5cb05148p-14, 0x0.e94a062e742f50p-16, -0x0.c9ece4fc541368p-18, 0x0.9aa36df5557a28p-22, 0x0.a1325179d49cc8p-17, -0x0.d1a66ee5228968p-19, -0x0.f9fc80448dbbf8p-22, 0x0.ab4dd0e915e760p-22, -0x0.80c1353c419af8p-20, // x=  1.0625 y=       0
+ 0x0.f9f6b28eca70e0p-2, 0x0.934eb6b46bacd8p0, -0x0.946a7a04c83300p0, -0x0.f3f5f3a1580ed0p-2, 0x0.e3818883f640b8p-1, -0x0.95c364c10b10e8p-1, 0x0.8e3b5f99ea8638p-4, 0x0.c7e200f9461cf8p-1, -0x0.f89e58b4cf10a0p-2, -0x0.af31f8cdf06308p-3, 0x0.cfbdc12695ce90p-3, -0x0.ec9844f9d13288p-3, 0x0.a70792b2882800p-4, 0x0.980cee3cdd9a58p-3, -0x0.af6149497aa830p-4, 0x0.8014602816f520p-6, 0x0.a4efd152e5fee0p-8, -0x0.ab0ff482d102c0p-5, 0x0.9103198e833040p-6, 0x0.f74875d4169db0p-8, -0x0.aabfb557f76da0p-8, 0x0.d6f851a222a560p-8, -0x0.8931b9c6656e20p-9, -0x0.b6bfc2760b8c60p-9, 0x0.a8237d192d1a00p-10, -0x0.8df3483aba62a8p-11, 0x0.b7ef875fbe4848p-14, 0x0.8a64e9c986b240p-11, -0x0.cfc29706096620p-13, -0x0.ccbbe829e9c018p-17, 0x0.a51054f6b77cf8p-16, -0x0.8f918593ff9548p-14, 0x0.b7422a696a2998p-16, 0x0.c4144ba4fcb948p-17, -0x0.b4161281d57028p-18, 0x0.d775aa11e5c718p-18, -0x0.e6bf4fda6fa410p-20, -0x0.9000f59c45d8a8p-19, 0x0.d156a02e0c4778p-21, -0x0.dae028d2b66938p-22, // x=  1.1875 y=       0
+ 0x0.b6e0982a1053c8p-2, 0x0.8ab3e40f4de200p0, -0x0.f006c7b7356df8p-1, -0x0.967583480574e8p-1, 0x0.df989a0b6df670p-1, -0x0.9fdb17a0293528p-2, -0x0.8e840694c7b948p-3, 0x0.aa3e31db6affd8p-1, -0x0.b0d547e29c6da0p-2, -0x0.8f84159fe7d538p-2, 0x0.f2ae5ae97423a8p-3, -0x0.f364d887ef8c88p-4, 0x0.bb73d7b9aced60p-7, 0x0.94eb731dac4a40p-3, -0x0.93763458f678a0p-4, -0x0.a8983d4ff31988p-6, 0x0.aa1ca9bd8de0a8p-6, -0x0.f284f21d1cd018p-6, 0x0.a2ec167dce1370p-7, 0x0.d8668c09d94be0p-7, -0x0.dd9fad334a7df0p-8, 0x0.a0cf70577056f0p-9, -0x0.cb6c38303c6618p-13, -0x0.c3c1e6791ea900p-9, 0x0.994fbe562dfac0p-10, 0x0.80296834b533d8p-12, -0x0.d85c79977c0f38p-13, 0x0.d70dab8a6d7450p-12, -0x0.86a53996166e08p-13, -0x0.ea867c33a75970p-14, 0x0.d1a4fa39da6630p-15, -0x0.934e71e7fa2dd8p-15, 0x0.83b62ef63588f8p-17, 0x0.a598fb79f1c3c0p-16, -0x0.edfcf27af4ac58p-18, 0x0.917121693a6e88p-20, 0x0.adfeabd8c039e0p-23, -0x0.9dcd9114f4f0b8p-19, 0x0.c266bcfecac510p-21, 0x0.e259ab4ef9b710p-23, // x=  1.3125 y=       0
+ 0x0.b2412bf4a54838p-3, 0x0.ed27620b8a8d68p-1, -0x0.8b42ea57212070p-1, -0x0.a360285bbd8c40p-1, 0x0.ad08432afa7098p-1, 0x0.90f6e81e6cee08p-4, -0x0.aecd537ab2ea08p-2, 0x0.b4153eb265b258p-2, -0x0.91df67cc7aa710p-4, -0x0.9ecf75ff2d1118p-2, 0x0.b96d466ba8a908p-3, 0x0.d9c9522768b458p-5, -0x0.90875c16a6cdb8p-4, 0x0.9b082fef4e27d8p-4, -0x0.a5beea3b57a550p-6, -0x0.c8a566d7c844d0p-5, 0x0.d145ef95d50a48p-6, 0x0.dc8434a326f5b0p-13, -0x0.8f53e01b59fb60p-8, 0x0.b127dcaf968710p-7, -0x0.f541e011d639c8p-9, -0x0.e0337aea530be8p-9, 0x0.f396cb06c0fa90p-10, -0x0.824b46cbb76668p-10, 0x0.928ad936d3e570p-13, 0x0.d954317ba6e2a0p-11, -0x0.a783a35abefe60p-12, -0x0.c26ec43f712098p-15, 0x0.d764de706e4328p-15, -0x0.e2ad005d17d080p-14, 0x0.85ceddc51b27c0p-15, 0x0.f0bec5b3d42560p-16, -0x0.d43c0c7a3458a8p-17, 0x0.84a27b22d8f1e8p-17, -0x0.bfa36cc8ec1350p-20, -0x0.a20dfb3f8df210p-18, 0x0.ddec6a6bf3f5b0p-20, -0x0.ab81a65ae4fa40p-25, -0x0.829ffa8687ac48p-23, 0x0.8a3ae5648f2668p-21, // x=  1.5625 y=       0
+ 0x0.99552a487e3e50p-4, 0x0.c68e7443a97a58p-1, -0x0.8af52e51b26878p-2, -0x0.8e097b6cf2edd8p-1, 0x0.d5871961f3cdc8p-2, 0x0.eb8aedc73b5318p-3, -0x0.a55fca753a5300p-2, 0x0.bc4d7e4e404110p-4, 0x0.ac6d0b250bd150p-4, -0x0.cb18941f12c708p-3, 0x0.8b970240b4c040p-4, 0x0.db2b0aa75b2030p-4, -0x0.8dcf9513712498p-4, 0x0.beedbe915da590p-10, 0x0.86384482e4f010p-6, -0x0.8054282bfc0410p-5, 0x0.a1fc2c1042cf98p-7, 0x0.e2a11adb2dda30p-7, -0x0.f9cb6065015200p-8, 0x0.b64f555a170888p-10, 0x0.ce0d3dbdae08a0p-11, -0x0.d658dcf478db50p-9, 0x0.93b78bee916008p-10, 0x0.d8410438c57b18p-11, -0x0.f72cddaa29ac38p-12, 0x0.9b248963a9d4b8p-12, -0x0.afd4c269a9ceb0p-15, -0x0.db99ecc1e70260p-13, 0x0.a401c0fa581530p-14, 0x0.c88d855bb4ab28p-17, -0x0.df4da700fa6568p-17, 0x0.d20204f5e1a558p-16, -0x0.e2d452483eb470p-18, -0x0.f07535d5c1a8a0p-18, 0x0.c9d1ea26cccf78p-19, -0x0.be366a7a6572b0p-20, 0x0.9c3215a04b0168p-23, 0x0.912d4642519cb0p-20, -0x0.b8da99c5047820p-22, -0x0.f5a07c2e8198c0p-25, // x=  1.8125 y=       0
+ 0x0.88da4297554c20p-6, 0x0.9a01fdbf261408p-1, -0x0.95aeb8d5854b40p-4, -0x0.c01b9837e653f8p-2, 0x0.929bd1d69f20d0p-3, 0x0.e070c2f7f75f40p-3, -0x0.a3e8ff11d0f6c0p-3, -0x0.8e54a2be2b4b38p-4, 0x0.d3f1dc2059faf0p-4, -0x0.898861eff009e8p-5, -0x0.d94b523837d8c0p-6, 0x0.ea34a4b07b11a8p-5, -0x0.f84c73199e8120p-7, -0x0.f9dc8436be1dd8p-6, 0x0.8bad692ca3c648p-6, 0x0.b2a711eaf1b210p-9, -0x0.b5651c84d70130p-8, 0x0.c902d550800720p-8, -0x0.8feb13d54ee960p-10, -0x0.eb20c5260783d8p-9, 0x0.d01489179820a8p-10, 0x0.b3b66dd04d69d0p-12, -0x0.e25e6e960a15e0p-12, 0x0.87438de80d57f0p-11, -0x0.e0c261a41c4c88p-14, -0x0.8094ff1bebf718p-12, 0x0.d6f1aec254a738p-14, 0x0.d39a04b0bad168p-19, -0x0.8c3f0739b51300p-16, 0x0.8ed16a9abe98e0p-15, -0x0.9376a0dc8e8968p-17, -0x0.adaca731e49738p-17, 0x0.96c46395787ca8p-18, -0x0.bf5bfcadd658c0p-20, -0x0.834c9706fa5238p-23, 0x0.d4b485eac12160p-20, -0x0.fc12f076360010p-22, -0x0.f37f07589c8e78p-23, 0x0.81e85cf3ce2a60p-23, -0x0.f61a976cac54f8p-24, // x=  2.1875 y=       0
+ 0x0.b865db86d11140p-9, 0x0.f9b73f3dfed248p-2, -0x0.ec428144bbde18p-7, -0x0.f8aaa01a2634f0p-3, 0x0.8bd43d179b4930p-5, 0x0.89c6bbc7044308p-3, -0x0.c77f7d7cdf4d58p-5, -0x0.8b2e2c1a70f3d0p-4, 0x0.b9b13a3c307680p-5, 0x0.a231b2eb71d570p-6, -0x0.dd121fcab0b510p-6, 0x0.e1c2231719c6f8p-8, 0x0.8212a8aa029750p-7, -0x0.cc8c0b997ee5f0p-7, 0x0.f8c0fe963d3338p-10, 0x0.eb03501a294eb8p-8, -0x0.d1c07a362231b8p-9, -0x0.c12066100c0dd0p-10, 0x0.b79afd46eead40p-10, -0x0.c5d9e146e65fc8p-11, -0x0.a3270eb7fd8198p-14, 0x0.b2a639145ae368p-11, -0x0.e50e289c501c60p-13, -0x0.bd0baf43d34ae0p-13, 0x0.ded7efced95880p-14, -0x0.9971f777bebe80p-15, -0x0.8afc5546ad33c0p-17, 0x0.b0d41ea540ea68p-15, -0x0.cbccb2d9622238p-17, -0x0.ab3e9f76b20ef8p-17, 0x0.b0536ed20f1ca8p-18, -0x0.8f33343e52dfa0p-19, -0x0.b0f1991e09d3e8p-23, 0x0.837db6774f9320p-19, -0x0.989e32e115f3f0p-21, -0x0.b65959b7ea6328p-22, 0x0.c179ae83af6d58p-23, -0x0.81ec9bf60b8d10p-23, 0x0.c12a14c183d6c0p-27, 0x0.92de876303de48p-24, // x=  2.5625 y=       0
+ 0x0.b12ee9ddf25b08p-13, 0x0.c9174e83667158p-2, -0x0.87a7eb0ded8db8p-10, -0x0.9871d9a85935c0p-3, 0x0.c4a6314f749b50p-9, 0x0.815c1b1988a3d8p-4, -0x0.b223007eca1c40p-8, -0x0.f36654795570c8p-6, 0x0.df9c0c6e485468p-8, 0x0.e3f8f64d731a10p-7, -0x0.caaac23ac7c288p-8, -0x0.a917d4486ae4f8p-8, 0x0.845a4ccc93cfc8p-8, 0x0.a512ceb2586da0p-11, -0x0.e79d77f68ec208p-10, 0x0.f20f2737301928p-11, 0x0.b3e90c30c5f320p-12, -0x0.e2984db2d6eeb0p-11, 0x0.a6e1da02293fd0p-13, 0x0.c8d6ca1ae480d0p-12, -0x0.ae2df401a20b88p-13, -0x0.8180f2d6f18a78p-14, 0x0.8549c646d9d2b8p-14, -0x0.93e8d1b7bf6128p-15, -0x0.9f901339e7fb78p-18, 0x0.ed53a2a589ba28p-16, -0x0.fcea552945f530p-18, -0x0.849d13487364d8p-17, 0x0.8571f5b80b2ce8p-18, -0x0.9ca0851e2947d8p-21, -0x0.a624fb0b0d15b0p-21, 0x0.ad6eb847b494f0p-20, -0x0.8baf9b3ba05538p-22, -0x0.e26968e6423218p-22, 0x0.b2d778d20c83d8p-23, -0x0.a5c3831d5ebc78p-34, -0x0.ee8426b55a5da8p-26, 0x0.c95d74bafb64a0p-25, -0x0.936d46bdaf06b8p-27, -0x0.81c2627839f030p-26, // x=  3.0625 y=       0
+ 0x0.ce865883c7dad8p-18, 0x0.a988883f23c498p-2, -0x0.b7efa6d55dfee8p-15, -0x0.d1dbdac4dff5f0p-4, 0x0.9d5d3dd1e97830p-13, 0x0.8afa34c19d9390p-5, -0x0.ab8ac0d77d6978p-12, -0x0.c909bbc003da30p-7, 0x0.851bec05ae82e8p-11, 0x0.a049d9d5976b08p-8, -0x0.9b5f3cf6993240p-11, -0x0.87294d3a4fc728p-9, 0x0.8c227462f11560p-11, 0x0.d694949b6729e0p-11, -0x0.c47d6eaa37ced0p-12, -0x0.ffc4b2dbdbe530p-13, 0x0.d1dcf8bc425300p-13, 0x0.d369ab068ae410p-17, -0x0.9da0277653d9d0p-14, 0x0.b981ee06946b08p-15, 0x0.e2e75e94d68318p-17, -0x0.8ebea88b6a4ae0p-15, 0x0.a49a89ba526710p-18, 0x0.eaec9335e1a2b0p-17, -0x0.ad5e36a2e86e38p-18, -0x0.b14ac6d6dc7008p-19, 0x0.8b6407aa791e08p-19, -0x0.bd988f100d10f8p-21, -0x0.ab3feb7890b538p-22, 0x0.c5ccf149cdc1d0p-21, -0x0.86ae01b92393f8p-23, -0x0.895a03572aa6c8p-22, 0x0.cd92ef452c0a60p-24, 0x0.bb6d92a5d8dd28p-26, -0x0.d9e19e9102b350p-26, 0x0.b3fd650f8291f8p-26, -0x0.a3e37272174268p-31, -0x0.b824825f5b1d98p-27, 0x0.c6d7f334cf66f0p-29, 0x0.f9497e9827f730p-30, // x=  3.5625 y=       0
+ 0x0.d03df193a0c1d8p-25, 0x0.8e4c17a249d030p-2, -0x0.da00d8e68c4af0p-22, -0x0.911dc77a0d5130p-4, 0x0.ddb6f384bdd860p-20, 0x0.99f15317c20ce0p-6, -0x0.91a7a6405ea690p-18, -0x0.ab1e7ac8be2db0p-8, 0x0.8aa012d31738d8p-17, 0x0.c994ab932857b0p-10, -0x0.cb10fe47e72ab8p-17, -0x0.ff6dd222005a58p-12, 0x0.ed3d07535598b0p-17, 0x0.af862116801268p-13, -0x0.e1d1e01cdfca70p-17, -0x0.8015ba738d7ba0p-14, 0x0.b11874c964e1c8p-17, 0x0.b94eba96e050e8p-16, -0x0.e53ae7866d9f90p-18, -0x0.ea57ca41685928p-18, 0x0.f248b32cda1d10p-19, 0x0.c01090784fc158p-20, -0x0.ca3839e8597e00p-20, 0x0.c199e2fcd66d48p-23, 0x0.f17c081781ae58p-22, -0x0.c39a1385c55458p-22, -0x0.f907f8ed950290p-25, 0x0.de3d9d9e136aa8p-23, -0x0.fe043f87319000p-26, -0x0.9a1f63b541e640p-24, 0x0.d03bf6ead69bc0p-26, 0x0.d64d06b6413200p-27, -0x0.9a7db69c0c4710p-27, 0x0.a7cc48c76f1850p-29, 0x0.d8e7fee93301e8p-30, -0x0.b7833d99e65a18p-29, 0x0.919d6edc620e68p-32, 0x0.857af3d11daae0p-30, -0x0.9b83b575dba578p-32, -0x0.a19ea32f0d13b0p-33, // x=  4.1875 y=       0
+ 0x0.8243cd494c35c0p-36, 0x0.e8fb6c6f4e5460p-3, -0x0.a4ddcfd0c47408p-33, -0x0.c0180716ad7eb8p-5, 0x0.cc969c99ee4130p-31, 0x0.a22fc89653fff0p-7, -0x0.a5c080ce838228p-29, -0x0.8c84c850de0cf0p-9, 0x0.c4fe393bbf8ca8p-28, 0x0.fa844f00508750p-12, -0x0.b6e159de3e6498p-27, -0x0.e68c15777208a0p-14, 0x0.89e39f0e8a03d8p-26, 0x0.dc1a9639e99358p-16, -0x0.ad52301547dbc0p-26, -0x0.db87279abe1a90p-18, 0x0.b8e31d174c7128p-26, 0x0.e6f1df97bc1938p-20, -0x0.a97b760ad0b208p-26, -0x0.815a9b57a37b48p-21, 0x0.869f94e64a6a70p-26, 0x0.9a5f28fcf5f148p-23, -0x0.ba330fe9d46048p-27, -0x0.c010f5ea3991c8p-25, 0x0.e07672410f70d8p-28, 0x0.ec90d0a947c888p-27, -0x0.eb0f3bdf4b8350p-29, -0x0.841b78d3b7bb20p-28, 0x0.d3bb7e74a8f8e0p-30, 0x0.df9d14fcde5e08p-31, -0x0.a0794240001b00p-31, -0x0.a0653af410d310p-35, 0x0.c277713d574b80p-33, -0x0.acdd0d55a50b40p-34, -0x0.a1384d4e5ed3d8p-35, 0x0.e0c7ed6860edc0p-35, 0x0.8836416f987a98p-40, -0x0.b00ce5284022f0p-36, 0x0.eb3c2857f12ff0p-39, 0x0.b9f9dd2d0eaaa8p-38, // x=  5.0625 y=       0
+ 0x0.d9b318e7f6fea8p-55, 0x0.bd484598ce55e0p-3, -0x0.a86085436908f8p-51, -0x0.fb95a90d5d8048p-6, 0x0.808740e0534ef0p-48, 0x0.a9af64f0ff6b78p-8, -0x0.81097820990e90p-46, -0x0.e87897492229a8p-11, 0x0.bf9231c4678d90p-45, 0x0.a1de0119100c20p-13, -0x0.e02a5e5fca70f0p-44, -0x0.e5575214eedab8p-16, 0x0.d734d7d7c02358p-43, 0x0.a57b04215cb5b8p-18, -0x0.ae371c9eb91730p-42, -0x0.f388de3d0515c0p-21, 0x0.f296a54a8e4b70p-42, 0x0.b706be0ea9c8e0p-23, -0x0.936c1cae10d150p-41, -0x0.8cbe70e9774a90p-25, 0x0.9e2d1fc3269510p-41, 0x0.ddff03dcab2968p-28, -0x0.9724ed10428778p-41, -0x0.b41be929ef1410p-30, 0x0.818139d83e2d80p-41, 0x0.96f5c22b31c468p-32, -0x0.c80d2042ff71e8p-42, -0x0.8376c2ee7ad800p-34, 0x0.8bd465220250d0p-42, 0x0.ef88ead0eee328p-37, -0x0.b15f37ddb72b40p-43, -0x0.e58d60c90831f8p-39, 0x0.cc7517d9f62e80p-44, 0x0.e71b8dcc139438p-41, -0x0.d6325f05ee54f8p-45, -0x0.f0d52a75ed5918p-43, 0x0.cba68d63ba4ad8p-46, 0x0.fb6e8e0429e660p-45, -0x0.af17f538aca2c8p-47, -0x0.f96ee71bcff150p-47, // x=  6.1875 y=       0
+ 0x0.bd5155fd4813c8p-69, 0x0.a8570e5903c430p-3, -0x0.a42c8891a48128p-65, -0x0.c661f78e345b48p-6, 0x0.8ce3fbc25217d8p-62, 0x0.ec79951368bec8p-9, -0x0.9f7c02eafb7e38p-60, -0x0.8e9f4f62b4d8b0p-11, 0x0.85e66aa9b386b0p-58, 0x0.ae2b89bc8e9148p-14, -0x0.b1cfe70c82eb00p-57, -0x0.d771ce47e0edc0p-17, 0x0.c26fda42fdbf28p-56, 0x0.870c4c3d9a8978p-19, -0x0.b40000f3c8fca8p-55, -0x0.abb27f88d32a98p-22, 0x0.8ff1032f386f28p-54, 0x0.dd87e5b0c957b8p-25, -0x0.c9e8e4cdb60118p-54, -0x0.91260bbc515168p-27, 0x0.fb5c89a0c7a4e0p-54, 0x0.c15a2aa54ad650p-30, -0x0.8c2c765ce1bac8p-53, -0x0.830c7b9d37bcb8p-32, 0x0.8d21080dff0790p-53, 0x0.b4fd3ea75f1a98p-35, -0x0.81101b4f6b0180p-53, -0x0.ff0b1ac42ea0f0p-38, 0x0.d77fa18bb460d0p-54, 0x0.b7af79680616c0p-40, -0x0.a4eb5d1494fb48p-54, -0x0.878b2a3c3b9660p-42, 0x0.e8284d0cc54ba0p-55, 0x0.cd978f61c50858p-45, -0x0.96ad471a494478p-55, -0x0.a0ea69cd5f28d0p-47, 0x0.b4b3f562218e18p-56, 0x0.82a8e3c44e3d48p-49, -0x0.c87a81b6c80da8p-57, -0x0.dd4bce4052a6a8p-52, // x=  6.9375 y=       0
+ 0x0.bc181ee481a348p0, 0x0.b8065d294d79f0p-2, -0x0.8e16879a2e44d0p-1, 0x0.abd099ecbf35f0p0, -0x0.fec24eec181a68p-1, -0x0.8e65d9a47ac6b8p-1, 0x0.e2e786901cccf0p-2, -0x0.a2e4c678e677b8p-1, 0x0.b9ac2c7bdae2d8p-2, 0x0.9ac21a70b0cb08p-2, -0x0.bbb4d5a8b90f20p-3, 0x0.c08b2f5eee6990p-3, -0x0.b8303a79329a60p-4, -0x0.cf268789f49dd0p-4, 0x0.d33dc499dc59f0p-5, -0x0.a424f5d9c1b9c8p-5, 0x0.8943e32abed7e8p-6, 0x0.c9436db1f149c8p-6, -0x0.b4a8bbcf1398a8p-7, 0x0.d8956a35a309e8p-8, -0x0.a1d588159d2058p-9, -0x0.99c623e2ba6c48p-8, 0x0.f987b9eeabcd48p-10, -0x0.e5b046262fb298p-11, 0x0.9b0cbb4730e4b0p-12, 0x0.c1cee346ac3c00p-11, -0x0.909cb6e8caa9e8p-12, 0x0.c734dfe6ea7ec8p-14, -0x0.f34e48214829d0p-16, -0x0.cff35f53304328p-14, 0x0.9071d78ceb7e40p-15, -0x0.8cd025eef983a0p-17, 0x0.997b579cf33a38p-19, 0x0.c24ba5910a9f78p-17, -0x0.fd8d411366d510p-19, 0x0.9b91ef2ee13c78p-21, -0x0.8ee19d25a29050p-23, -0x0.a0c8166eb8a2c0p-20, 0x0.c6791174562430p-22, -0x0.df27b6623f2f68p-26, // x=    0.25 y=    0.25
+ 0x0.8798873b803a30p0, 0x0.8536d5e485d8e0p-2, -0x0.ac78c6b7194260p-2, 0x0.c51c751c290868p-1, -0x0.f218cc7195b980p-2, -0x0.949d22e3afb4a0p-2, 0x0.cefdc11062f9f0p-3, -0x0.82fadfb173b840p-2, 0x0.ffc8b4f03bde98p-4, 0x0.f9b878ec09e030p-4, -0x0.8722c609ba9888p-4, 0x0.e4d0531e51e648p-5, -0x0.bd66516f9ff3f8p-6, -0x0.8602316c76b340p-5, 0x0.f6fb9d9cb24830p-7, -0x0.91ff9df89ea6e8p-7, 0x0.d25e3ee2e50908p-9, 0x0.d5a5b246ce79f8p-8, -0x0.aecd8280433ef0p-9, 0x0.8dc555d912d9b0p-10, -0x0.b24d5ed7f69bc0p-12, -0x0.8813e9c2f25918p-10, 0x0.ca892d5121aa70p-12, -0x0.cfabb44cd32748p-14, 0x0.dc29cc06f2eba0p-16, 0x0.90a6719a5c4848p-13, -0x0.c6eebe8630b440p-15, 0x0.cbf8f9a5928338p-18, -0x0.92318d950cc5a0p-20, -0x0.8411397402f998p-16, 0x0.a9b1f7f315c258p-18, -0x0.88ec63e8b17a50p-24, -0x0.8e8c4883cab818p-24, 0x0.d370692a809568p-20, -0x0.ffed96e54582f8p-22, -0x0.c392598d8468d8p-25, 0x0.b25fcb2d6736b0p-26, -0x0.96b3dfbeee28d0p-23, 0x0.aced0f29de6020p-25, 0x0.8a315f0ca0c7e8p-27, // x=  0.3125 y=   0.625
+ 0x0.aefed7b2cd1628p-1, 0x0.91cf57f5336d00p-3, -0x0.8e3c4034c04458p-3, 0x0.b60e26a9fede10p-2, -0x0.a8bfa1392f3810p-3, -0x0.bf55c15eec73a8p-4, 0x0.d534e4b51223e8p-5, -0x0.8e564749849120p-4, 0x0.dd6833ffda15c8p-6, 0x0.d196cc07548508p-6, -0x0.bb7bf419f8e788p-7, 0x0.a01fd6b6037810p-7, -0x0.d87583896db448p-9, -0x0.9b6f3acb37c4d0p-8, 0x0.f1c4843a45ec20p-10, -0x0.890a1ca1ddc008p-10, 0x0.a2640fe88e23f0p-12, 0x0.b1e7642e8b3aa0p-11, -0x0.f951dc6646e558p-13, 0x0.b33165ca11cb88p-14, -0x0.b5e803c9d66d60p-16, -0x0.a7315a9d87ae50p-14, 0x0.d774deb4e2c5f8p-16, -0x0.a54236023bcc68p-18, 0x0.fa0d22f17415a0p-21, 0x0.85d36912f8e580p-17, -0x0.a0b1951f185d10p-19, 0x0.eafb0e7a00cc40p-24, 0x0.870b1760f06b40p-26, -0x0.baf0dc6cdc5a70p-21, 0x0.d31c4dd0ba5be0p-23, 0x0.96265700694438p-26, -0x0.8ed36ba8a55558p-27, 0x0.e7d23fbebbf100p-25, -0x0.f7e65387e36af0p-27, -0x0.d8bd71175471d0p-29, 0x0.925fac5549b1d8p-30, -0x0.813e6df16bdbc8p-28, 0x0.838e354eb38560p-30, 0x0.b7413eb2e281a8p-32, // x=   0.375 y=  1.3125
+ 0x0.bd20603b211240p-2, 0x0.aa78d0107163e0p-4, -0x0.cd3331d58c7e20p-5, 0x0.e2a8ed1727f230p-4, -0x0.fa9d6f2db88eb0p-6, -0x0.b09a3a2aeeb3d8p-6, 0x0.81635585f49508p-7, -0x0.800ba381d58630p-7, 0x0.f09a47a9371758p-10, 0x0.aad6931d7f3418p-9, -0x0.d0ba10416587f8p-11, 0x0.cc7c7abad60fb8p-12, -0x0.96c3f3b6dac9b0p-14, -0x0.ef8737edd43fc8p-13, 0x0.824d93ff17cc80p-14, -0x0.a91dff8c864130p-17, 0x0.c31387cb11ac18p-22, 0x0.8741acd43a96d0p-16, -0x0.86890941eeae18p-18, -0x0.ef1c53a1b7a360p-22, 0x0.fae7300562b8a0p-23, -0x0.809fb502ec13a0p-20, 0x0.ece47bd055db00p-23, 0x0.b43e4847869f98p-24, -0x0.dd3e2d03062fb0p-26, 0x0.d2629c813ed288p-25, -0x0.b4483bef4f1908p-27, -0x0.f74874049d7420p-28, 0x0.81615d8b8f0088p-29, -0x0.9501a79c2b39f0p-29, 0x0.ed3d46eebf26e0p-32, 0x0.80a57ccf5d87d0p-31, -0x0.f54b6f560c81f0p-34, 0x0.b5609719d5c4e0p-34, -0x0.847c0ee603d520p-36, -0x0.e18e85bc424410p-36, 0x0.c8e15feaf114e8p-38, -0x0.b734a31a1b8960p-39, 0x0.eba9f4dc064560p-42, 0x0.adcda4bae9eaf8p-40, // x=  0.6875 y=    2.75
+ 0x0.fe0d99297f8ff8p-2, 0x0.9a8ffddfb446f0p-3, -0x0.ee12da567583c0p-4, 0x0.c0ffae56791d48p-3, -0x0.80caa0c6474770p-4, -0x0.801c321432bf18p-4, 0x0.e66e1d4268fc28p-6, -0x0.9680221e19d8a8p-6, 0x0.951d1e0608f450p-8, 0x0.b7da68e8f7e880p-7, -0x0.85ea2ce8102d20p-8, 0x0.dec532f59f1c28p-11, -0x0.ce51337cc1c920p-15, -0x0.b50395553c3670p-10, 0x0.e55c428d46d290p-12, 0x0.e5f3666e9d3810p-15, -0x0.9c00769f373cf8p-15, 0x0.891f36df454608p-13, -0x0.9b61b3679ae688p-15, -0x0.8bcad4d9d01110p-16, 0x0.d2d590a9fddf30p-18, -0x0.a7465b265c1b48p-17, 0x0.ab356f42f418e8p-19, 0x0.8f3897d0756b58p-19, -0x0.b48e80c76f9978p-21, 0x0.a6698d130eadc0p-21, -0x0.99088761d3c788p-23, -0x0.d69d61b6c40328p-23, 0x0.f2e072d82dfc10p-25, -0x0.841801df83ed00p-25, 0x0.d2a51cdd6f15e8p-28, 0x0.83b3847b924620p-26, -0x0.8982571f5c6630p-28, 0x0.95ce66448e6f10p-30, -0x0.acbf12eff3ef50p-33, -0x0.8ab17c4eb6be20p-30, 0x0.877b1c04a7f6a0p-32, -0x0.c6a4e8c9faae48p-37, -0x0.f80a4936b1cb78p-39, 0x0.806d54153f8c28p-34, // x=  0.6875 y=   1.875
+ 0x0.a36a1463086f90p0, 0x0.a6d133e3361538p-1, -0x0.f36b8ed475d488p-1, 0x0.f77fa1c214e8d8p-1, -0x0.8f3e78eb50baa8p-1, -0x0.e5b6210f231480p-1, 0x0.abbe2caee39dd0p-1, -0x0.811beeaa3eea90p-2, 0x0.a4ef92fa5c39b8p-4, 0x0.db0d918df9e7b0p-2, -0x0.f778b91476a0c0p-3, 0x0.ed6adec2d1e938p-8, 0x0.e5fcd98db9d1d0p-7, -0x0.fd4c6ae140f490p-4, 0x0.ee6ce10d931670p-5, 0x0.ef23b8800cb058p-7, -0x0.a1c36b623734a8p-7, 0x0.d08c93378dc6b8p-6, -0x0.aac9abc2178640p-7, -0x0.b4ffc0632212a0p-8, 0x0.b3a03a924bc460p-9, -0x0.83a91e28b87620p-8, 0x0.bfd22f83f2e730p-10, 0x0.a32ec01b0f26a8p-10, -0x0.8a1f499fef10e0p-11, 0x0.845d843c1f2e70p-11, -0x0.ad3971f1c8e8d0p-13, -0x0.dc517ff3d013e0p-13, 0x0.a6dcffda3157b8p-14, -0x0.d6dad4d813b0f0p-15, 0x0.fbe78172a0bb60p-17, 0x0.f167b5f2b7dcd8p-16, -0x0.a784fc922fe5a0p-17, 0x0.8ac26f443bae08p-18, -0x0.8dedd7c4b5f390p-20, -0x0.dfd24044ae6ef8p-19, 0x0.905b4c7ad5a8d0p-20, -0x0.8370030c085ac0p-22, 0x0.cf4762d2aa70e0p-25, 0x0.b43413487cd730p-22, // x=     0.5 y=    0.25
+ 0x0.837517e322d948p0, 0x0.8125e8f7360738p-1, -0x0.a6a18cc7d861a8p-1, 0x0.a986142bf0f2f8p-1, -0x0.a8d88cffc70448p-2, -0x0.8d308dec015f08p-1, 0x0.bf5d91f7b4e478p-2, -0x0.ff6e05d14cece8p-4, 0x0.ea3151523d3138p-6, 0x0.de9dcbad971d28p-3, -0x0.e64fc4a6b86ca8p-4, -0x0.9b710981b7d9d0p-8, 0x0.b062aff871dab0p-7, -0x0.d8687d2181b390p-5, 0x0.bb3561234922c0p-6, 0x0.8820a66001f350p-7, -0x0.9f773508119410p-8, 0x0.96768d732f24a8p-7, -0x0.e213841eda7320p-9, -0x0.a0cc07b7ce49b8p-9, 0x0.9247c0356f8e68p-10, -0x0.9f58ac8f2aeca8p-10, 0x0.d30d55b4693a10p-12, 0x0.f5e18049c39840p-12, -0x0.c1a1eaf7728a10p-13, 0x0.832f0fbda85aa8p-13, -0x0.985d934e0885a0p-15, -0x0.903a0136eb4478p-14, 0x0.cc92f193135690p-16, -0x0.a39942410bb3e8p-17, 0x0.9eacfe09ae1f88p-19, 0x0.8ad5c60dfb6270p-17, -0x0.b505a9ec42bc28p-19, 0x0.8356c62ff11130p-21, -0x0.983851a11849a0p-24, -0x0.e36f471e5f1798p-21, 0x0.8a043786ee05c8p-22, 0x0.adb45305fe4c90p-29, -0x0.8308b7963c0898p-27, 0x0.a2257c7786eb08p-24, // x=  0.5625 y=     0.5
+ 0x0.d1adf3c17223a8p-1, 0x0.a4c79d8a802bb0p-2, -0x0.b76a10c0e083c0p-2, 0x0.ec346dafc72d50p-2, -0x0.db04bc392f6b18p-3, -0x0.89284c949bc1e8p-2, 0x0.a6aad8e93cc040p-3, -0x0.a89f2b5dc783b0p-4, 0x0.cdfbfcf3d7d558p-6, 0x0.afe7df8f827898p-4, -0x0.a6b4fe38f48d98p-5, 0x0.9d8a5b6492a120p-8, 0x0.aae98b17ce8cd0p-11, -0x0.90ae121180d870p-6, 0x0.e8ee5d5c33b2a8p-8, 0x0.aa9fb9328559b0p-10, -0x0.e620aac79374f8p-11, 0x0.af74a0451db268p-9, -0x0.f8de4cdc5260b8p-11, -0x0.eda090b2a1ff58p-12, 0x0.d4ec5ef77befc0p-13, -0x0.a6e4554093a880p-12, 0x0.d43be04d7ab068p-14, 0x0.ad586de4dc3df8p-14, -0x0.832f03fb6eb980p-15, 0x0.801e664f4276f0p-15, -0x0.92d06f49f44530p-17, -0x0.bb0f46102f6058p-17, 0x0.fd8240b2f3e980p-19, -0x0.9f4f371d4569b8p-19, 0x0.a2ce7c05170298p-21, 0x0.a44650b46eb360p-20, -0x0.cc8886d4bab760p-22, 0x0.9afc8a92d27d70p-23, -0x0.865bf089ae06c0p-25, -0x0.f58427715b96b8p-24, 0x0.8e772f36c45f00p-25, -0x0.c90b98667b3e78p-28, 0x0.d925ede2cab258p-31, 0x0.a03716dbca1cf0p-27, // x=  0.5625 y=   0.875
+ 0x0.8252f5c9c29c68p-2, 0x0.e12b0c0394aff0p-5, -0x0.c2728769b8fcf8p-6, 0x0.dc1a8bfa53bd70p-5, -0x0.ae11f5afb2fd38p-7, -0x0.f3bdbfa1ad3e80p-8, 0x0.83a6c51c8be668p-9, -0x0.80531702091fd0p-9, 0x0.ae12fc2e8ca660p-12, 0x0.8172ef7f03e8b8p-11, -0x0.ed85fbf36ae550p-14, 0x0.d2a2e26d2b25e0p-15, -0x0.d0f75d6f1cc1e8p-18, -0x0.ce0ede6998bcc8p-16, 0x0.aa60a96ddbc000p-18, -0x0.e656920dd158b0p-22, -0x0.a25930f713af98p-24, 0x0.86ebd15007bf50p-20, -0x0.cd3da453419470p-23, -0x0.c058798d544688p-25, 0x0.f0bd43cc4e20c0p-27, -0x0.9622d356262b08p-25, 0x0.d33de54e381830p-28, 0x0.f6cb797e4454c0p-29, -0x0.e3568552053720p-31, 0x0.8eafefe7914880p-30, -0x0.b8640b3a1bdd40p-33, -0x0.c30b9eace02228p-33, 0x0.9ea91c27af1ae8p-35, -0x0.e252327a05f1a0p-36, 0x0.822ac6d4dcd6e8p-38, 0x0.f73f6481122538p-38, -0x0.b9b5be884e83a8p-40, 0x0.888ce78107cd20p-41, -0x0.f471576f336db0p-45, -0x0.87086f55e20e10p-42, 0x0.bea4dba8e16dc8p-45, -0x0.918a6056cf58e0p-48, -0x0.fb6d7de1fb4528p-53, 0x0.82e91e439f8368p-47, // x=  0.9375 y=   4.125
+ 0x0.934035cda7c8e0p0, 0x0.c210dcf79dd348p-1, -0x0.878c0c032a4648p0, 0x0.bbe5a005265ca8p-1, -0x0.9c2fe92c224580p-2, -0x0.f3ba5af940aa10p-1, 0x0.aca5a6c3df6528p-1, -0x0.ab21c02911bca0p-5, -0x0.81f06a93fb0db8p-4, 0x0.cf4042c9e38220p-2, -0x0.da8af024ebbfb8p-3, -0x0.a007de7fad4170p-4, 0x0.f212bf6c2448b0p-5, -0x0.ce923801c3f548p-4, 0x0.b1068cd6a1cfa8p-5, 0x0.93ee3c54266580p-5, -0x0.9ddda42e9fe888p-6, 0x0.8a36f38ca3bb98p-6, -0x0.c44b690b85ff30p-8, -0x0.98589fecaf9f30p-7, 0x0.879846e24583a0p-8, -0x0.faae899fdb1fb0p-10, 0x0.8b764bd76fca20p-11, 0x0.e16d6b5e62fbf0p-10, -0x0.b088e8219abf90p-11, 0x0.f648f81a7e17e8p-14, -0x0.d3046c5e94fc90p-17, -0x0.8310b62e4a31d0p-12, 0x0.b962b2c3223458p-14, 0x0.c91473f7494120p-18, -0x0.b834efb80bf7c0p-18, 0x0.fab2dd99fb6520p-16, -0x0.a285738c520658p-17, -0x0.c37198828eb000p-19, 0x0.aaca24471e6df8p-20, -0x0.ca75f03a94b358p-19, 0x0.f2b5d85ad98488p-21, 0x0.859d59d491b2d0p-21, -0x0.c1a11822796ca8p-23, 0x0.8c235b831b3be8p-22, // x=   0.625 y=    0.25
+ 0x0.cdb0a38c5a9d40p-1, 0x0.8ca7d93544d490p-1, -0x0.9e6d3a417d35d0p-1, 0x0.b81ab944a49f58p-2, -0x0.9b7c528d8b7dc8p-4, -0x0.e8dce02072e750p-2, 0x0.8743c6224ca068p-2, 0x0.9cc0de94782c10p-5, -0x0.eb23abd387fdb8p-5, 0x0.8466edafeece98p-3, -0x0.e0065ae5e099d8p-5, -0x0.b00a0978048528p-5, 0x0.ccc1b52cdd1a58p-6, -0x0.a45fb97f077408p-6, 0x0.cc83fe76c10698p-8, 0x0.cc607286676010p-7, -0x0.b66e6112fc01a8p-8, 0x0.c58facd77d2fd0p-10, -0x0.b4c6209a050c98p-13, -0x0.94d40a70513060p-9, 0x0.e0d1d5d2df9f00p-11, 0x0.bae7955696d8e0p-14, -0x0.b2b8889a46c190p-14, 0x0.9e7ab9cc9c3e98p-12, -0x0.d18652845a2500p-14, -0x0.c4c109450cce70p-15, 0x0.b0e8369daec460p-16, -0x0.822a026af9ac20p-15, 0x0.97e6e30c72ff40p-17, 0x0.8d460ef3d2e2d0p-17, -0x0.cf6f0f2094e368p-19, 0x0.a5d4b2fef0c8e8p-19, -0x0.a7b63003fe4350p-21, -0x0.8e8be8f2848818p-20, 0x0.b95e710546b358p-22, -0x0.99d1aecae7ef40p-23, 0x0.f319182412d918p-26, 0x0.e5b293a088f600p-24, -0x0.8845bcc8710f18p-25, 0x0.8bd4cd3f903dd8p-28, // x=  0.8125 y=   0.625
+ 0x0.9ca8ca9d9d8d48p-1, 0x0.952832ff3890f0p-2, -0x0.8840130232a0d0p-2, 0x0.81c88c1dd72d50p-2, -0x0.a18b5a9093fd00p-4, -0x0.a8961a29703980p-3, 0x0.a9dc2d79c6cb68p-4, -0x0.e6ab19519c9348p-7, -0x0.c8246571dff480p-9, 0x0.94465c0cf1dba8p-5, -0x0.e6bdb12dbe3af0p-7, -0x0.96f1c1b7192e90p-8, 0x0.bee5805443bfe0p-9, -0x0.a23c12b024f160p-8, 0x0.cf037eb3832710p-10, 0x0.baccb7a657d578p-10, -0x0.9e3ef9053a2250p-11, 0x0.ee659729087740p-12, -0x0.f295ebbae6b860p-14, -0x0.f258e146106400p-13, 0x0.ab70adb3b3e950p-14, -0x0.cd3b9fed524358p-16, 0x0.e3cfec55b36778p-19, 0x0.e2f8044b6c12f0p-16, -0x0.8dba9a7b144200p-17, -0x0.9d995a8e662d28p-22, 0x0.801ca9963049d8p-21, -0x0.a7dc8b803bd5b0p-19, 0x0.bd2e3c0e94d120p-21, 0x0.84a19b0ca2a038p-22, -0x0.d4303d4f14dd70p-24, 0x0.cb3f532b81bbe0p-23, -0x0.d03b17ade84fd0p-25, -0x0.94e441ad98cf58p-25, 0x0.bfbdba3d6565e8p-27, -0x0.cb2a576574e370p-27, 0x0.bc1420f4db0010p-29, 0x0.e789e5be418a20p-29, -0x0.84b4d1cd33b4e0p-30, 0x0.a3f954efa6f830p-31, // x=  0.8125 y=    1.25
+ 0x0.e06eaf43b65a88p-1, 0x0.e2050246292be0p-1, -0x0.8bdf98c9b54440p0, 0x0.8bf59cd7606728p-2, 0x0.975d3ee0cba730p-3, -0x0.d950aa7f88b6e0p-1, 0x0.80346b76e7ded0p-1, 0x0.939d43c7ce42a8p-2, -0x0.83918547440468p-2, 0x0.f15d83f4c90400p-3, -0x0.b1c94fb491c200p-4, -0x0.b0417027442910p-3, 0x0.c5e72b97cf2cf8p-4, -0x0.ad1d94f4f314f8p-6, -0x0.e2aff6cbd0f3e0p-11, 0x0.c2cd75b5ceafb0p-5, -0x0.ac00c8f130a958p-6, -0x0.a604991b9efc98p-8, 0x0.82da9386d498e8p-8, -0x0.89e7dfdd02db78p-7, 0x0.c9d32de682e0c8p-9, 0x0.95db17feac55c8p-9, -0x0.91c29a9fe32348p-10, 0x0.868fa28a073e08p-10, -0x0.a1a5729468ccc0p-12, -0x0.fe0225096ed0a8p-12, 0x0.cb60d075dc79e8p-13, -0x0.a995b94b8af530p-14, 0x0.8ddf641bb61288p-16, 0x0.97d198dd458410p-14, -0x0.d53efc0e1d8c30p-16, 0x0.ede0f9df8ef308p-20, 0x0.c1bcf160880fb0p-21, -0x0.8dbe3c86f21fa0p-17, 0x0.b30a63a90ae1b0p-19, 0x0.abca21cc7836a8p-21, -0x0.acc34862e721c8p-22, 0x0.d76480cccc3640p-21, -0x0.f70b5dcc816978p-23, -0x0.8e984758f86c98p-23, // x=   0.875 y=    0.25
+ 0x0.9c076eb672a9b0p-1, 0x0.d5375867f4be38p-2, -0x0.c5af0a09e12a50p-2, 0x0.d1d2d0cde57030p-3, -0x0.9766afc1170f58p-6, -0x0.f0e36d8a0c97f8p-3, 0x0.e734a6027628c8p-4, 0x0.854e87361ac480p-5, -0x0.fd676cee460568p-6, 0x0.b7eaf17695a4d8p-5, -0x0.f2ddd35852a9a8p-7, -0x0.986b01c4711ef0p-6, 0x0.94478de3fed238p-7, -0x0.fa9fe94c2ce538p-9, 0x0.91f832e14bf778p-11, 0x0.fa875b647e7358p-9, -0x0.bd8a7471e7e9b8p-10, -0x0.9195fb42923000p-13, 0x0.aedbbf48c67ff8p-13, -0x0.825d1dbf72fc00p-11, 0x0.a400af74ef5f90p-13, 0x0.c4df7ac96fd9a0p-14, -0x0.aedaaf868a24e0p-15, 0x0.bc6007601aa590p-15, -0x0.c330049e1077e0p-17, -0x0.87c16f242566a0p-16, 0x0.bfb8950ebf7598p-18, -0x0.b07e4b727f9458p-19, 0x0.fc5c2109719250p-22, 0x0.fb2b99d89ed1c8p-20, -0x0.9a5900b4763e30p-21, 0x0.a53b8be6773d28p-25, 0x0.99faa3b893a370p-26, -0x0.b328f5dd976c98p-23, 0x0.c52b29a4526588p-25, 0x0.df416672a410b8p-27, -0x0.c215737549f480p-28, 0x0.ce11ec898103d8p-27, -0x0.cc7286dd1c75e8p-29, -0x0.8be8ac51794e78p-29, // x=       1 y=       1
+ 0x0.aa181815cad0c8p-1, 0x0.b1dff83d3d4f38p-1, -0x0.b7933af111ac70p-1, 0x0.ed37138332a420p-4, 0x0.9f1f1f0a2c82d0p-3, -0x0.eb2f56b8426598p-2, 0x0.dc08580b78ab78p-3, 0x0.c910ff55e902e8p-3, -0x0.922fbe75b41bc8p-3, 0x0.92b8721f80e250p-4, -0x0.b3633a903a2288p-7, -0x0.a4bc16fca2bdd0p-4, 0x0.9be314cd7f0b80p-5, 0x0.d2c88a74fe32c8p-8, -0x0.f5f6b422382580p-8, 0x0.ff76dcc7fba820p-7, -0x0.b692ea8fe84300p-8, -0x0.9daa7163363950p-8, 0x0.a07eecbd1e2398p-9, -0x0.e01bb5296c0fe8p-10, 0x0.ddc013ada26068p-12, 0x0.8da80ea8bf83c0p-10, -0x0.e0c66e1742a7f0p-12, 0x0.8577ac013affa8p-14, 0x0.b409243be9b548p-17, -0x0.a33aef17e577a0p-13, 0x0.db107bd549e1d8p-15, 0x0.f8cb10fd4c52b8p-17, -0x0.8cf3aa93643890p-17, 0x0.885f4d20795478p-16, -0x0.9d5dcbfde31fb8p-18, -0x0.f9a8662f422770p-19, 0x0.c158722c5c9c78p-20, -0x0.a7166c1cec4e88p-20, 0x0.a03b4b93be1738p-22, 0x0.8882eadc0404b8p-21, -0x0.b35bf8796c8868p-23, 0x0.848298b49281f8p-24, -0x0.a2f9a353149ca0p-27, -0x0.ddcb653089f420p-25, // x=  1.0625 y=     0.5
+ 0x0.917029429f5490p-2, 0x0.c5c7437880d9c8p-4, -0x0.bd4f597b86e8b8p-5, 0x0.ffb171da776e20p-5, -0x0.bfb08b6e5ddc58p-7, -0x0.80d72352ee7a68p-6, 0x0.94195727e1e688p-8, -0x0.de9afefb7a0578p-10, 0x0.de86d9588f7950p-14, 0x0.97abc2c26f0588p-10, -0x0.8d758cfceeade8p-12, -0x0.bd557547943980p-15, 0x0.d4780806c43718p-16, -0x0.f239a02d969390p-15, 0x0.bdfaa050983898p-17, 0x0.91115b17eccce8p-17, -0x0.a3bdaf5008b488p-19, 0x0.868347c3670b90p-19, -0x0.a511fefd94f388p-22, -0x0.a4ef8a2b68f6a8p-21, 0x0.98eedaedec1548p-23, -0x0.9a2273719cb160p-25, 0x0.979ea577491798p-30, 0x0.8482ceae06c0a0p-25, -0x0.d8329fa02d4d40p-28, -0x0.943888f695dcf8p-30, 0x0.81300a6a732850p-31, -0x0.a6842b07b848d0p-30, 0x0.f1e2725f9693f8p-33, 0x0.9983a0f8505560p-33, -0x0.9b69ff9fd7d7f0p-35, 0x0.a4abf2106acc70p-35, -0x0.cf3639de1d6338p-38, -0x0.8ed489e0286f60p-37, 0x0.f4e135618de0d8p-40, -0x0.e96b1ef7ed70f8p-41, 0x0.d81b29ceead828p-44, 0x0.c68eb69b0e4cb0p-42, -0x0.997a6b51a193f8p-44, 0x0.ddcd850eed0fa8p-48, // x=    1.25 y=  3.4375
+ 0x0.dfb8ee327567e8p-2, 0x0.890090620ff6f0p-2, -0x0.c1d8d8665f44b8p-3, 0x0.e7911cc4cacd10p-4, -0x0.9c05d9ee89ce40p-7, -0x0.b73bcb24bbd420p-4, 0x0.89279abab424e8p-5, 0x0.a20f4607b04898p-7, -0x0.802332c500b7e8p-7, 0x0.a8bff698012688p-7, -0x0.a5e3f8867c6138p-9, -0x0.fad2edc200d0b8p-9, 0x0.c5c3e0587dfb40p-10, -0x0.d9694f71848330p-12, -0x0.82aaa2ae547f80p-16, 0x0.86c6fc6ef16600p-11, -0x0.a2fd4c5af54d70p-13, -0x0.d38050f6e824b0p-15, 0x0.e89c1f54223b20p-16, -0x0.aff93fa0ff3368p-15, 0x0.a7b2685fa754d8p-17, 0x0.bc29b80dbb68d8p-17, -0x0.81eedb1a6c22b0p-18, 0x0.870e6323eeab30p-19, -0x0.9d659dea904fc0p-22, -0x0.a0fb92e38e56c0p-20, 0x0.b6edefee25cf90p-22, -0x0.c384f02478b1b8p-29, -0x0.a8c86aa83b86e8p-26, 0x0.c0a7c1b98bd858p-24, -0x0.bcbaaea7f38c48p-26, -0x0.ae6774f7465100p-27, 0x0.80c53d24c450f0p-28, -0x0.ab91ab881c3900p-28, 0x0.8f42fe76a9f678p-30, 0x0.a2cf226e6b96e8p-30, -0x0.ba6883cceabcf8p-32, 0x0.d63b4c290a4db0p-33, -0x0.8621184a017600p-35, -0x0.c62233c0a55670p-34, // x=    1.25 y=  1.6875
+ 0x0.bd9af02f346810p-2, 0x0.c2ca4140998e80p-3, -0x0.edbe8eaa404218p-4, 0x0.ba4c965dc5efd8p-4, -0x0.d9aa9952ff6ef0p-7, -0x0.c6588dba6ca628p-5, 0x0.862d21005fd3a0p-6, 0x0.d8eaf5fc3366c0p-10, -0x0.9313903e1b4f58p-9, 0x0.9a00960ca2f178p-8, -0x0.95e3c5fa179e90p-10, -0x0.916f3376066228p-10, 0x0.da352b63df02b0p-12, -0x0.ea551337d0ab90p-13, 0x0.e275061db26330p-16, 0x0.8bbe499db98ae8p-13, -0x0.9f256425bbd118p-15, -0x0.cc5971f8d06aa8p-19, 0x0.edea9db7c72308p-19, -0x0.a3ac2995db1948p-17, 0x0.98342c3790c340p-19, 0x0.d353c3c59f7370p-20, -0x0.916959d32fd280p-21, 0x0.fc6ef7d27d2600p-22, -0x0.b2a21ae5b4a7e8p-24, -0x0.ae178ab6ce4978p-23, 0x0.bd06a7e77e9570p-25, -0x0.b99f2f904f8680p-27, 0x0.adfd860ea24b30p-33, 0x0.bdb1f4f58cd110p-27, -0x0.b186394f9f1b68p-29, -0x0.9433d49aa44568p-31, 0x0.8ac32b409a4838p-32, -0x0.9b5c689027aff0p-31, 0x0.fd9ef634767aa8p-34, 0x0.b879ee4a82a100p-34, -0x0.d2286e38b85190p-36, 0x0.bf2996209fc398p-36, -0x0.81e8ee786c0328p-38, -0x0.d93e0959c90c58p-38, // x=  1.3125 y=    2.25
+ 0x0.bc9becdd2bcdc8p-3, 0x0.96051537846400p-5, -0x0.bf38ce3ef46118p-7, 0x0.ea200fe9cf17a0p-6, -0x0.89ed3fd3e66cc0p-8, -0x0.b2992f6dc3cf58p-9, 0x0.90f62262dc5960p-11, -0x0.996182a2196750p-11, 0x0.9efbb9ee684cc0p-14, 0x0.d7c783e3b28258p-14, -0x0.96d3b53d9b4d88p-16, 0x0.957fff1bb66bf8p-17, -0x0.ee5020ff468cd8p-21, -0x0.c8895983146790p-19, 0x0.ff6bac6ad409a0p-22, -0x0.f80828047edfb0p-25, -0x0.dcb0fa725c0920p-29, 0x0.9c7a27dc5d99b0p-24, -0x0.b8d5813774c518p-27, -0x0.9a697ed2f1bff8p-29, 0x0.a0e7f272ee0458p-31, -0x0.d29b16a98a1800p-30, 0x0.e74142fd08f850p-33, 0x0.84c75d01bfa2a8p-33, -0x0.c348a652b673c0p-36, 0x0.f400d74f4c0f38p-36, -0x0.f5feafe3dec5b0p-39, -0x0.85799e248ba190p-38, 0x0.acfec2e1f9af18p-41, -0x0.ea7d29bef48ee0p-42, 0x0.cf120e88e61048p-45, 0x0.d6ed49c8cff730p-44, -0x0.80d2c968eea2d8p-46, 0x0.a1dcca3efd4d38p-48, -0x0.c370b4c13234b0p-52, -0x0.959f87fc43c0f0p-49, 0x0.a8cfc6d6f98828p-52, -0x0.e6470a3b7b5528p-58, -0x0.aebc8050c3cd60p-58, 0x0.b94c18e60bed78p-55, // x=  1.1875 y=  5.8125
+ 0x0.8ff2c463964e20p-1, 0x0.e55c6635ac3d88p-1, -0x0.e3325f51aedac8p-1, -0x0.9be7aba3c32e68p-3, 0x0.e83524265a4590p-2, -0x0.fc8e0ed9452a28p-2, 0x0.9a02d554ac4b40p-3, 0x0.d534d446de1a90p-2, -0x0.872ccedf7485c8p-2, -0x0.9f083f2bc0f680p-6, 0x0.81a5dcd0885570p-4, -0x0.8616697f015240p-3, 0x0.d5220b047505b8p-5, 0x0.d933e2184b87c8p-5, -0x0.82e20d325deda0p-5, 0x0.80a6962375e840p-6, -0x0.a6832250daf9f0p-9, -0x0.826f23f8610720p-6, 0x0.e1aa79542017a8p-8, 0x0.df98d2d572e3c8p-11, -0x0.8e3013770a6cd0p-10, 0x0.acda1a80520388p-9, -0x0.eb6a179e2cb898p-11, -0x0.b10252b95ac578p-11, 0x0.ad39da19311678p-12, -0x0.8cc90b49e05c78p-12, 0x0.8d7e4ab8980978p-14, 0x0.930b5c68a885e8p-13, -0x0.e0f90e8c782e60p-15, 0x0.cc0afedc55ef80p-17, -0x0.d22bcbe5548460p-24, -0x0.9e00a6d7b6d0d8p-16, 0x0.cdb5c3b2917e70p-18, 0x0.ab9fa349eeeac0p-20, -0x0.d8b995a5807d90p-21, 0x0.f93d11de3e1968p-20, -0x0.8c693e8c8b2588p-21, -0x0.c3c789b083d250p-22, 0x0.97276b3f4c50c8p-23, -0x0.9228fd9e8b6db8p-23, // x=  1.1875 y=    0.25
+ 0x0.80b3bb36d1f2b0p-1, 0x0.904d9df40cfed8p-1, -0x0.f2c6bd03a73d90p-2, 0x0.bc3252aecc93e8p-6, 0x0.8c1f7b0eb264b8p-3, -0x0.f3ec9ddb66af50p-3, 0x0.9e439829f46f40p-4, 0x0.ff60e0bec9e010p-4, -0x0.943782a2af19b8p-4, 0x0.87dd8a73b45440p-7, 0x0.9cd34dae20ee08p-7, -0x0.8534792fce8218p-5, 0x0.c16dc685d60500p-7, 0x0.949d27d6e50c10p-7, -0x0.aafe94c735bd78p-8, 0x0.dc38565c57e0e8p-9, -0x0.9fb092c7291a00p-11, -0x0.9cc02c627dbad0p-9, 0x0.f610dcd377b4c0p-11, 0x0.dbd54d03d32cf8p-15, -0x0.f4bf4be9f02ea0p-14, 0x0.a9c49ea4052070p-12, -0x0.cee85b76a94730p-14, -0x0.94a959e5bd2850p-14, 0x0.86f06ad8757f48p-15, -0x0.db2e9ffbb384f0p-16, 0x0.be2beab4b76938p-18, 0x0.d1344cb51d8a20p-17, -0x0.910b37f706e9e0p-18, 0x0.d35bbe56ac8bc0p-21, 0x0.aac7c0c9a94b70p-24, -0x0.b7a0a8e3d45fe0p-20, 0x0.d638ff3058be38p-22, 0x0.fea742ec7910d8p-24, -0x0.81efb5ec03cfb0p-24, 0x0.e6b8f1fb0aecd8p-24, -0x0.e422f58ded3bd8p-26, -0x0.cc748ab3fae8d8p-26, 0x0.8c2ce8d4ea9e10p-27, -0x0.cb8db9fb946720p-28, // x=  1.3125 y=    0.75
+ 0x0.ddf05f92aea6b8p-2, 0x0.c611557e773178p-2, -0x0.8ee7bd098c23a0p-2, 0x0.f9587ab2dc61e0p-5, 0x0.b3949ab7e9de48p-5, -0x0.807b1e7d573d10p-3, 0x0.a1cb20f6332820p-5, 0x0.b0a122254def90p-5, -0x0.bf5f2f6b31fc80p-6, 0x0.e71bbeaff3e6c8p-8, 0x0.97e18bb78b4588p-10, -0x0.9dadce097a6ec0p-7, 0x0.d32372ea153578p-9, 0x0.e901f2ad40c280p-10, -0x0.859cdd5b6b3a50p-10, 0x0.e3caddce9c32b0p-11, -0x0.afad39ff3d4ed8p-13, -0x0.e5b7ad677afe00p-12, 0x0.a60829efe6c590p-13, -0x0.dd69ac0d677f98p-18, -0x0.e54209a074b398p-17, 0x0.d1791e17bfbc48p-15, -0x0.e8a6ed948cb610p-17, -0x0.92c3194498e1e0p-17, 0x0.fd7ebfb57fe9f8p-19, -0x0.e0123cb7223088p-19, 0x0.b012e6ac89fd10p-21, 0x0.b63d979ab2b3f0p-20, -0x0.e7da56b0efc9b0p-22, 0x0.ae00479b8c00a8p-24, 0x0.9789292a242230p-27, -0x0.85c7e10289f880p-23, 0x0.8d6ec0b5f4eed8p-25, 0x0.baf0f0dd2b0470p-27, -0x0.ac05d6a0ece078p-28, 0x0.89030d7457a680p-27, -0x0.f0bb8e026e2538p-30, -0x0.f5ac28f1a0dc00p-30, 0x0.99105f0c089528p-31, -0x0.ba1daed96a39d8p-32, // x=  1.4375 y=    1.25
+ 0x0.c38e4fc24e9110p-2, 0x0.b5294824d037a0p-1, -0x0.86d158833fa8e8p-1, -0x0.cd3cc52c7e62d0p-3, 0x0.a4006ea5b4c410p-2, -0x0.b4db9dead3e2b8p-3, -0x0.a9eaa539ec93e0p-6, 0x0.de03e0d27eb230p-3, -0x0.c7032bf475be68p-4, -0x0.8edf5e47bf3880p-4, 0x0.decaf4cb067b18p-5, -0x0.e43ee7fd7813b8p-6, 0x0.9456ea5f4ffeb0p-10, 0x0.efa36a4dd91c00p-6, -0x0.caa852e2d0d7e8p-7, -0x0.9a9788ffe574d0p-8, 0x0.fba07910551278p-9, -0x0.8955c4cc4560f8p-8, 0x0.8b1ee7e3915c08p-10, 0x0.87cced34c4d9e0p-9, -0x0.ed3e65c3232cf8p-11, 0x0.81b7a365256320p-13, 0x0.858b7286bd4900p-14, -0x0.b1793092c68ee8p-12, 0x0.e72cfce25b0000p-14, 0x0.f8fe48d9234118p-15, -0x0.83072baab31978p-15, 0x0.81d957b2d625d0p-15, -0x0.eedb94750d53c0p-18, -0x0.dcd2f3061eecf8p-17, 0x0.a1c59ed9936e28p-18, -0x0.90f870d5ee2c38p-20, -0x0.9d403145aef270p-24, 0x0.d49e4d6ea35528p-20, -0x0.fdcccd9a0e0d70p-22, -0x0.9fad6b42f00a38p-23, 0x0.ab25eb39b73f58p-24, -0x0.89b4c9a11996e8p-23, 0x0.865007d1d3fd38p-25, 0x0.8a70f886b89050p-25, // x=     1.5 y=  0.4375
+ 0x0.cca3a4bcca72b8p-3, 0x0.fe17c0786f85e8p-5, -0x0.af3dc1a5bd4eb8p-6, 0x0.81fddf1fc54118p-5, -0x0.90b9605d4b0a98p-8, -0x0.adffc704470388p-8, 0x0.9363b46d1470a0p-10, -0x0.82c49ea4e3f2a0p-11, 0x0.861cab289f5260p-15, 0x0.e0586e3b772458p-13, -0x0.9c8f5e39c1bd60p-15, -0x0.8facdbd2f90a40p-18, 0x0.9caf8f33df8498p-19, -0x0.c9a228b1a321e8p-18, 0x0.eea3234a8ebf00p-21, 0x0.aac91a379c3ad8p-21, -0x0.95ed416f1f1ed8p-23, 0x0.fee13092911170p-24, -0x0.e9caaa4259a270p-27, -0x0.e94b2577106d08p-26, 0x0.a6a839b67ee8c8p-28, -0x0.9b9ee169156b38p-30, -0x0.8ee4827a6013c8p-40, 0x0.de1970618b87b8p-31, -0x0.8af347681650a0p-33, -0x0.80afae5adb07d8p-35, 0x0.9da459917f8308p-37, -0x0.a34d466553e6c0p-36, 0x0.b333fdd4027990p-39, 0x0.8d610e26f1dee0p-39, -0x0.dbc6fac5b4e7d0p-42, 0x0.b4c15cf9a3e2d0p-42, -0x0.a169b06f002780p-45, -0x0.9c11a9622ab910p-44, 0x0.cf350ff0fbbac8p-47, -0x0.e5049e53159110p-49, 0x0.87bdc333901440p-53, 0x0.820bcbdc0c8460p-49, -0x0.9b29f076e1d6c8p-52, -0x0.aa25ad349d6160p-55, // x=   1.625 y=  5.0625
+ 0x0.97d69a32960eb0p-2, 0x0.ca4d61dfcb3dd0p-1, -0x0.88189fff24d808p-1, -0x0.b8d91cbf5a6e78p-2, 0x0.e340129ae678d0p-2, -0x0.beecdb541b0c20p-4, -0x0.fcd9c76d55a3e0p-4, 0x0.8713be83a795f8p-2, -0x0.bd6c22268e3e98p-4, -0x0.93860661d9bd18p-3, 0x0.be064a3d0f9c78p-4, -0x0.cc6d8a14756f70p-8, -0x0.93948aac3aa4d8p-6, 0x0.b2561dcaf4b1f8p-5, -0x0.fb9edc37cdfb10p-7, -0x0.8615e242e02fb8p-6, 0x0.9b5197138dc288p-7, -0x0.e76c5d0ce2b3e8p-9, -0x0.9d442f0fbe3c40p-14, 0x0.8e1b6c0b827080p-8, -0x0.d90453fe7a0330p-10, -0x0.a925702d9125c0p-11, 0x0.ee61b47ad78e88p-12, -0x0.8aeb671b350a18p-11, 0x0.8e0ba6241ee850p-13, 0x0.ed9b5c7b260d20p-13, -0x0.c4b5c6986932b8p-14, 0x0.b744db8e013368p-16, 0x0.9ebb911ef9bf40p-19, -0x0.8e2dc3bc79cac8p-15, 0x0.b6997d60e51918p-17, 0x0.88935b83351e00p-18, -0x0.99f6265f5ee1a0p-19, 0x0.d02ec80d9632b0p-19, -0x0.ce048b14504720p-21, -0x0.83c088f1d5edd0p-20, 0x0.c1bfdfa0f4e348p-22, -0x0.a43907c603a450p-23, 0x0.9583a14abf1898p-26, 0x0.ff863358567570p-24, // x=  1.5625 y=    0.25
+ 0x0.92f7a1131f3a18p-2, 0x0.b1ef39fb775fb0p-3, -0x0.adbf21c723add0p-4, 0x0.c512287d95f270p-5, -0x0.fd8fb36f07fc90p-11, -0x0.e2a52f14721458p-6, 0x0.e587c37afd3320p-8, 0x0.cd079ec79da8e8p-9, -0x0.ccd3431d2249b0p-10, 0x0.b320f5b5524740p-10, -0x0.adab350e746ff0p-13, -0x0.892b351301b9d8p-11, 0x0.942c606b661ec0p-13, 0x0.d02cc57a8d4648p-17, -0x0.871eed2bc0dab8p-16, 0x0.866b1c4fc4a6c0p-15, -0x0.c92dd9c529d470p-18, -0x0.dbc59d261d2618p-18, 0x0.85aa6336ea4160p-19, -0x0.dc0836bdfb4850p-21, 0x0.e1b90204a1ab08p-26, 0x0.89551b69099100p-21, -0x0.f6f511975fcff0p-24, -0x0.8c7431c822c368p-25, 0x0.840971f403a0f8p-26, -0x0.c2d3be87190748p-26, 0x0.82ea5fec1fe768p-28, 0x0.a6b9f852857bf0p-28, -0x0.af641872e9dce0p-30, 0x0.85d3dbb3f9a4c8p-31, -0x0.b9a02d177b8ee8p-36, -0x0.a32053d1b1a0e8p-32, 0x0.88ff503353fc10p-34, 0x0.efa9a1109f9aa0p-37, -0x0.e0f939d58c2d20p-38, 0x0.d06fc7bfdd8ca0p-37, -0x0.8dbb38d5fc4228p-39, -0x0.88f0afd1391350p-39, 0x0.8b0d6ed0aa5d18p-41, -0x0.a4de543c736670p-42, // x=  1.8125 y=    2.75
+ 0x0.a6ab048fcea888p-2, 0x0.89d6f5010182d0p-1, -0x0.a9d1b0f44ec568p-2, -0x0.edad973866d4d0p-4, 0x0.abe6c9824fd218p-3, -0x0.b152cc886bd1c8p-4, -0x0.93a83cf8786808p-6, 0x0.c16d89ed1d3088p-4, -0x0.8621d0e6151248p-5, -0x0.857d5967f0afa0p-5, 0x0.a6c10733f07370p-6, -0x0.a87abbe5aaccc8p-8, -0x0.930dd01a1c74f0p-9, 0x0.8fbfbfbe452c30p-7, -0x0.b8695f7d6e5e60p-9, -0x0.9fb66785fe1370p-9, 0x0.aefeb4c88f85c0p-10, -0x0.9d30c2308547f0p-11, 0x0.ced3f3ee21b5e8p-18, 0x0.90c3c09c740ee8p-11, -0x0.c365325ad45eb0p-13, -0x0.9bc67ae511a120p-14, 0x0.c98007929ffcc8p-15, -0x0.d76caf60e9d708p-15, 0x0.b24225c15c14b0p-17, 0x0.b323b657417ef8p-16, -0x0.82a71fd2c4bee8p-17, 0x0.f8a7b8a0964f28p-21, 0x0.8dce21592c0ba8p-21, -0x0.a44719b7ffed68p-19, 0x0.b3ed53f44cad10p-21, 0x0.d3fb91b46892a8p-22, -0x0.bc978ed08581c0p-23, 0x0.a85724357559c0p-23, -0x0.f7ebfb0b797670p-26, -0x0.87cad0dcb36220p-24, 0x0.aa948db2044618p-26, -0x0.bae062face3e80p-29, -0x0.e56f3d4f62dea8p-31, 0x0.c00c2eaa2b8e28p-28, // x=    1.75 y=    0.75
+ 0x0.a7e30adaad7868p-2, 0x0.ea60b8db63db40p-2, -0x0.8bd595a1ed1df8p-2, -0x0.ef76fdfff082b0p-5, 0x0.de84d26b48f648p-4, -0x0.a128b6b5e8feb0p-4, -0x0.db2f981c20dea0p-10, 0x0.fc6b4a533220e8p-5, -0x0.b4342865c7ef08p-6, -0x0.80578c8a17d758p-6, 0x0.a994c4f3507978p-7, -0x0.93392f3d4e9408p-8, -0x0.db69d32bb85668p-12, 0x0.930419f59ef240p-8, -0x0.bf3083737dda30p-10, -0x0.f13605f97b6848p-11, 0x0.8c63b007c23e70p-11, -0x0.b246eef8e61848p-12, 0x0.89e6abf373e018p-15, 0x0.e93b3791250e18p-13, -0x0.9c5338fce1c550p-14, -0x0.a10b69369fe808p-16, 0x0.fd46c46167b3b8p-17, -0x0.ac7baa864b8cf0p-16, 0x0.94db64f8a3b3a0p-18, 0x0.e75ac810e353b8p-18, -0x0.a7b15afc7c8cb0p-19, 0x0.95d70ceeaf5908p-21, 0x0.c7b8d336f7adf8p-24, -0x0.cf60f1b7ae9af0p-21, 0x0.df0274775d96a8p-23, 0x0.d67920d4a8b558p-24, -0x0.c66a2624c08eb0p-25, 0x0.ce11c65351f858p-25, -0x0.9992a8a930a580p-27, -0x0.8e2013867d8350p-26, 0x0.af0eb99ad1a390p-28, -0x0.8a3908c40e71a0p-30, -0x0.9692f6d507b588p-33, 0x0.c0082dabc7fb78p-30, // x=  1.8125 y=       1
+ 0x0.a4097b8a98d758p-2, 0x0.97ca04af442b20p-2, -0x0.a7c0fdc49d2130p-3, 0x0.c1f121a5047da0p-6, 0x0.e71d20bc6f5838p-6, -0x0.dddb44a489a670p-5, 0x0.b04280af9dfcd8p-7, 0x0.9bb6c4517de560p-6, -0x0.f7b743a4ee47a8p-8, -0x0.9e95da58bfa200p-13, 0x0.a53d78d50d4fa0p-10, -0x0.900c75ae82b158p-9, 0x0.ebd2ead748fb78p-12, 0x0.b48e961871d6a0p-11, -0x0.869f84178478d0p-12, 0x0.8f1b23b618fb30p-15, 0x0.bf987292937820p-16, -0x0.9f10616669b4a8p-14, 0x0.9765474c919450p-16, 0x0.fdfd3d96d772e0p-17, -0x0.ca93ceb1b987c8p-18, 0x0.d51e31bd301f20p-19, -0x0.e47d6971765a10p-23, -0x0.8075dd2002aab0p-19, 0x0.8a155dd9d18240p-21, 0x0.8ca161134f8750p-23, -0x0.aca02166e30318p-24, 0x0.fde08364afb068p-24, -0x0.c067e147ad1fc0p-26, -0x0.820d91bb3ea128p-25, 0x0.9ef436eb5b0dd8p-27, -0x0.cbd6cdb2498630p-29, -0x0.9a0799fc294a50p-36, 0x0.a8cbcb9e56d1a0p-29, -0x0.9f231bb06aac18p-31, -0x0.d016fb431baa10p-33, 0x0.bc9557d2ef4968p-34, -0x0.84f4e01b2fd610p-33, 0x0.bf392bfceaa5e0p-36, 0x0.f6356dfde867c0p-36, // x=   1.875 y=    1.75
+ 0x0.b0d4712c266010p-3, 0x0.a2dc0c49b18d68p-1, -0x0.8b088be96c6958p-2, -0x0.a1f5ee88452ab0p-2, 0x0.82597bf3993ec0p-2, 0x0.fc388a6ca64670p-5, -0x0.8a38d3c86801f8p-3, 0x0.a060bb64e2b008p-4, 0x0.80a8fed369c750p-6, -0x0.af3a15f644ab80p-4, 0x0.fefc3ba2521c80p-6, 0x0.874215cc9813c8p-5, -0x0.b362cc3f589b68p-6, 0x0.817740fcba4b68p-8, 0x0.eab802ae128ed0p-9, -0x0.9e61bf922cf8e0p-7, 0x0.c395eb54b22be0p-9, 0x0.dfcb6277408950p-9, -0x0.f1a868d3f52788p-10, 0x0.f6c3b545a93140p-12, 0x0.9a1c642abfc778p-13, -0x0.c4a39330cdc410p-11, 0x0.fc85c81a26a0d8p-13, 0x0.b297e4e330cb60p-13, -0x0.c3dab57223ca88p-14, 0x0.f11421d73da298p-15, -0x0.d8641bf9e81380p-18, -0x0.a2ee71cd4cf540p-15, 0x0.e0af837cf0fe60p-17, 0x0.bdd651b2f382f8p-19, -0x0.a68f9adf8a97f0p-19, 0x0.828c90adba4918p-18, -0x0.f737fbbb0982c0p-21, -0x0.a0ea887b9283a8p-20, 0x0.f5cd3f82a9b370p-22, -0x0.a1b0195c7c0840p-23, -0x0.c9062c2baf0ee8p-30, 0x0.a0c65a5e02ede8p-23, -0x0.b88e1f856231c8p-25, -0x0.fb7d975b0aadf0p-27, // x=  1.9375 y=  0.3125
+ 0x0.851ff802dc3f10p-2, 0x0.ebf6d8dde1bf00p-3, -0x0.d5941a2f144850p-4, 0x0.8d691103049d98p-6, 0x0.ee70c5a1da8c70p-7, -0x0.e6493b025cbdc0p-6, 0x0.8ec0852cb77670p-8, 0x0.86b71454347958p-7, -0x0.af03f8e2df3228p-9, -0x0.f302368e16ce28p-13, 0x0.ea1b726e5fe710p-12, -0x0.9ff15026b746e8p-11, 0x0.b232993a182cc0p-14, 0x0.c7ea5ce4043fe8p-13, -0x0.ebdd8bec5cc568p-15, -0x0.930532e7ba90f0p-18, 0x0.83cdc7a8a474c8p-17, -0x0.d4dfa9ac4dfe50p-17, 0x0.8973856a442d28p-19, 0x0.dc28ddc8806980p-19, -0x0.82f1d0c7341b80p-20, 0x0.f4fd2dcf08e3b8p-24, 0x0.a061d8d9036a28p-24, -0x0.fa2033367c7958p-23, 0x0.c079528fa8c800p-25, 0x0.a9e5d1101a72f0p-25, -0x0.de1e49d8a0e048p-27, 0x0.d517931f628f10p-28, -0x0.d91136ad1d3600p-33, -0x0.e7cfdadab98378p-29, 0x0.cc3b26eb3afe48p-31, 0x0.87377ac06802a0p-32, -0x0.f8e8a3f7852ba0p-34, 0x0.976c1ba93c4f70p-33, -0x0.afc0d5e10a0f70p-36, -0x0.9828197bf3a478p-35, 0x0.98bee27eeba900p-37, -0x0.d5c46ab13de9f0p-40, -0x0.b5c560aade5af8p-42, 0x0.84da329953cc30p-39, // x=    2.25 y=  2.3125
+ 0x0.a8b5421209b3a0p-3, 0x0.87175ea1b2e798p-1, -0x0.c5bb86881ed378p-3, -0x0.dde291fe76d200p-3, 0x0.98e3ab387e51f0p-3, 0x0.af7fa0679edaf0p-5, -0x0.9908ba9e023088p-4, 0x0.83e7d719776e20p-5, 0x0.f7d6de3c180770p-7, -0x0.9b810628a8f5a8p-5, 0x0.94724dcaead050p-7, 0x0.8dd2d5465f5510p-6, -0x0.8f94b10b337360p-7, -0x0.c1d3de3c870f08p-10, 0x0.af743f8b33c388p-9, -0x0.b58d03b9d24bc8p-9, 0x0.c77bee9ec6d7a0p-12, 0x0.cb2a23bf92d5c0p-10, -0x0.9f4c16fb4f7d68p-11, -0x0.bce679e95f0c68p-13, 0x0.b41622fa8baa60p-13, -0x0.b2b35aab17f4d8p-13, 0x0.dfda8ea82f3808p-16, 0x0.b218a275395108p-14, -0x0.832e7e3f7c2a48p-15, -0x0.a07154fe08fc30p-18, 0x0.cb1558087f4fa8p-18, -0x0.97d58f1bd77138p-17, 0x0.81890e5f4589f8p-19, 0x0.ce9f232a2b65a0p-19, -0x0.9c52ea1ce26928p-20, 0x0.c13f22d43be138p-23, 0x0.bdee6b1bcfe058p-24, -0x0.c1f60a65f6fb20p-22, 0x0.c7bd4b9cde56c0p-24, 0x0.8f060b4472fc88p-24, -0x0.f6d26f8053e378p-26, 0x0.a161e881a41928p-26, -0x0.962f12c4ffd4e8p-29, -0x0.a8c7d13f6a4f10p-27, // x=  2.1875 y=     0.5
+ 0x0.f2e78b9df55040p-3, 0x0.bf0bf7811f8088p-2, -0x0.a8331034f11088p-3, -0x0.fe17994febdc10p-5, 0x0.854e53e6fce260p-4, -0x0.c793b0eeea8988p-6, -0x0.b69b84cfaa7260p-7, 0x0.ca1e102e43c6c8p-6, -0x0.8adfd3a4037998p-8, -0x0.99b0a17a47aaa8p-7, 0x0.f1b5a5e0bb02a8p-9, 0x0.f3016eeb356d70p-11, -0x0.88d7f919708b28p-10, 0x0.e58383404d5ad0p-11, -0x0.d70f33f1c3d008p-15, -0x0.f6a7c8f7088b28p-12, 0x0.969c471a6d0c60p-13, 0x0.90f75a586fa4b8p-14, -0x0.b542a9c13dba68p-15, 0x0.f4522bb6b85610p-16, -0x0.c3b09d040e51b0p-20, -0x0.8a575ad1094e68p-16, 0x0.9e74d7c4ed0358p-18, 0x0.8430ec75cefc88p-19, -0x0.9c97a5487f6e58p-20, 0x0.86f732c3d91640p-20, -0x0.fd89172584f248p-24, -0x0.ea4ebae6169550p-22, 0x0.8928fa8a4e6318p-23, 0x0.b99bae933a1b48p-26, -0x0.ac2caf7df0c3f8p-26, 0x0.81df978d3145d0p-25, -0x0.bb38c1cf1d9278p-28, -0x0.8ec37c08b44250p-27, 0x0.b3f04d312a8a88p-29, -0x0.882afcb3307d00p-31, -0x0.95b8351460af20p-33, 0x0.bcd2d9a94ff3b8p-31, -0x0.a73a96bd27b7b0p-33, -0x0.d5a43e5c9cca00p-34, // x=  2.3125 y=    1.25
+ 0x0.dbc72be306bcb0p-3, 0x0.fa52f1ee3e98c8p-4, -0x0.b9df05fb326298p-5, 0x0.e622245745f718p-6, -0x0.d9b2d387b800b8p-11, -0x0.b9f49ad00b64f8p-7, 0x0.90fd96edf29dd0p-9, 0x0.efc7308f352520p-11, -0x0.c25304665e4330p-12, 0x0.ad72694d5adb78p-12, -0x0.f608ee2d78d120p-16, -0x0.cc3b9f5431cef8p-14, 0x0.aad8428757da40p-16, 0x0.b3b4150e3323b8p-19, -0x0.8db6ba384cbc18p-19, 0x0.eb57d58e36e8e0p-19, -0x0.fe2e5422f13158p-22, -0x0.aecb214ce8c568p-21, 0x0.a30bdd7166f5b8p-23, -0x0.9ee2f999f90c00p-25, -0x0.90aaa3f01fd408p-28, 0x0.fec2d241f35a58p-26, -0x0.a9d83e8f277b08p-28, -0x0.bedc061d02a7f8p-29, 0x0.df85e103f2a420p-31, -0x0.baf3ea0f61cdd0p-31, 0x0.9083edb6c49c80p-34, 0x0.cad6fea2a7bb00p-33, -0x0.9d3f66f99dae40p-35, -0x0.b780abd7c4bcc8p-43, 0x0.993b114820a9c0p-39, -0x0.d5b98a9ff87970p-38, 0x0.fc9ff2a5a4d708p-41, 0x0.cb16a474ed75d8p-41, -0x0.c1030439a1bc10p-43, 0x0.f5de47f07863a0p-44, -0x0.9c1209a9958050p-47, -0x0.9afc659d865d38p-45, 0x0.dc621174582cc8p-48, 0x0.f0a97f8f17d308p-52, // x=  2.3125 y=   3.875
+ 0x0.d04d7d5bb815c0p-3, 0x0.dfed54b7793548p-2, -0x0.b3a7bb460b2a28p-3, -0x0.f9de85c0ab38d8p-4, 0x0.c3aa1263eda5b8p-4, -0x0.df4d757155faa8p-10, -0x0.8049d972ba8a70p-5, 0x0.e748b06989b308p-6, 0x0.d0cde7f40a6238p-11, -0x0.9431020a194e00p-6, 0x0.b2e97fc2604db0p-8, 0x0.a91e6b236da788p-8, -0x0.c2920f20aab390p-9, 0x0.f0b203421203c0p-12, 0x0.875dfb392944e0p-11, -0x0.87c047fd5af1c0p-10, 0x0.e3ae69931c37e0p-13, 0x0.c28707c05bbff8p-12, -0x0.a1adfd372864a0p-13, -0x0.b77e3d4ebfb620p-19, 0x0.e5e9236fc8e948p-16, -0x0.c0c39b61162ee0p-15, 0x0.9a56b7390a1430p-17, 0x0.81b0cfdebcddb8p-16, -0x0.c49720ef3a3468p-18, 0x0.c1043eec222cb8p-22, 0x0.c09b6dbb22d7b0p-21, -0x0.e68cb114c5d498p-20, 0x0.ced0f7f3a1f5d8p-22, 0x0.e4ede101ca1ca8p-22, -0x0.b0d7fccab1f728p-23, 0x0.e1f5255fc25f10p-25, 0x0.b2fca369a892b8p-28, -0x0.d8e03f36ca7000p-25, 0x0.db3ba04a7e1e38p-27, 0x0.f0eedd1d8aa948p-28, -0x0.da3fde10133b30p-29, 0x0.b07cb94e24eb70p-29, -0x0.b769d5799e0f28p-32, -0x0.9329bd91349ad0p-30, // x=  2.3125 y=   0.875
+ 0x0.a13f30ea817f00p-3, 0x0.c25b0a52eafb90p-5, -0x0.d54e21c8a4a718p-7, 0x0.a2d90f2e7a3ff8p-6, -0x0.914416ea658918p-9, -0x0.a95229b59abfb8p-9, 0x0.e638c9e4ff0298p-12, -0x0.d4660b8b058c30p-13, 0x0.b637e055c3bef0p-17, 0x0.8d0c71cec3f1f0p-14, -0x0.9ecd8c84a444f8p-17, -0x0.89051484624318p-20, 0x0.8050802a6fc278p-21, -0x0.a51b3fe79dfbe0p-20, 0x0.9d8653a7480050p-23, 0x0.e588ecbea00ce0p-24, -0x0.a4a34d198dc158p-26, 0x0.86cfe57df7a008p-26, -0x0.c2498bd698a958p-30, -0x0.d118f3397c84c0p-29, 0x0.f39c72aefbbbe0p-32, -0x0.b8c193487ecf38p-34, -0x0.efc07c7d5a7610p-39, 0x0.84228744e834c0p-34, -0x0.861c6f9aefec68p-37, -0x0.a4575fd49136c8p-39, 0x0.9669df0954e5b0p-41, -0x0.fdff46e7177af8p-41, 0x0.ddada3228e1fc8p-44, 0x0.d67b4d0456d700p-44, -0x0.86af5aa407fb80p-46, 0x0.ace991ee57d8a0p-47, -0x0.dd82f3ee2c2048p-51, -0x0.9b62f8d57f51c8p-49, 0x0.a7bd2afbdc8fb0p-52, -0x0.9d840c91ad7c58p-55, -0x0.9153579a9b37f0p-58, 0x0.aad1105f603f48p-55, -0x0.a4707f9e90e8b8p-58, -0x0.de73bffe2b6e58p-60, // x=       2 y=     6.5
+ 0x0.ac4e20117160f0p-3, 0x0.b7a16174da2c58p-5, -0x0.d6c66b95badf00p-7, 0x0.bda58876d48be8p-6, -0x0.be4acb2f91cd88p-9, -0x0.b6a1e2d8071708p-9, 0x0.85d099a6b9c0e8p-11, -0x0.a84193beb6ae40p-12, 0x0.ed0485ee8957d8p-16, 0x0.b210a545a49610p-14, -0x0.dbf249e4deb290p-17, 0x0.971f4a6f40c880p-20, 0x0.956ad9a20d0740p-22, -0x0.fe9c47169bc540p-20, 0x0.8a704d1e84dca0p-22, 0x0.d8b2f1b7e43c10p-24, -0x0.bf4e377460baa0p-26, 0x0.8cdd8268096d00p-25, -0x0.846de96068d028p-28, -0x0.8ce69537a58bc8p-28, 0x0.baff6093058e40p-31, -0x0.df2fa492be7440p-32, 0x0.9b5436f7d132d8p-35, 0x0.e6810a3ef84648p-34, -0x0.85dd17b7c32bf8p-36, 0x0.f7ad9f6afc3650p-40, 0x0.d8fc35e91d58a0p-43, -0x0.93844283db2ad0p-39, 0x0.9a969bfe75ec08p-42, 0x0.bc43d9ff61c850p-44, -0x0.a6b1b54a7c9b28p-46, 0x0.99ce7656029b68p-45, -0x0.906172c8a61b90p-48, -0x0.f0bca5a2ecedd8p-49, 0x0.9be551570cec80p-51, -0x0.fc301f73022d48p-52, 0x0.c6b14db63257d8p-55, 0x0.bbaaec41e16920p-54, -0x0.d592feb142a4b0p-57, 0x0.82494ea3b02188p-58, // x=  1.6875 y=  6.1875
+ 0x0.f7cb4caccb4f98p-5, 0x0.f3fb54b94bb740p-2, -0x0.93024b08318d70p-4, -0x0.dcdde5df93c9c0p-3, 0x0.8e6146fecf6dc8p-4, 0x0.c0c479f6b2f040p-4, -0x0.e2327b341c5508p-5, -0x0.ea35516c9229b0p-6, 0x0.84cc11c52bbc98p-5, -0x0.e740266a1c2ea8p-9, -0x0.bc5584b146b180p-7, 0x0.c18177132ddb78p-7, -0x0.8cb8c450e1a8d8p-18, -0x0.82521cc8c44378p-7, 0x0.b234a5591ae5a0p-9, 0x0.a0861bf3e8ae38p-9, -0x0.d01f822a992808p-10, 0x0.82c744578c2c08p-12, 0x0.a483781cd14560p-12, -0x0.9ccc7165e3f130p-11, 0x0.8502c4df0a8f18p-13, 0x0.fcaca7849315e0p-13, -0x0.dc9e227ba61e88p-14, -0x0.9bbe19dcdc71b0p-17, 0x0.c44bd3dfe91db0p-16, -0x0.856fa0b5d4ad38p-15, 0x0.c0752deff1b5d8p-18, 0x0.db47711bcbaa38p-17, -0x0.a6f5b1cef16e40p-18, -0x0.eeb33a3f8664a0p-22, 0x0.f7170da3941cd8p-21, -0x0.bf3f56196e1b18p-20, 0x0.97b8b41dea3698p-22, 0x0.81b70e5f264ec0p-21, -0x0.c07f07ea68c358p-23, 0x0.ea6d33a0602a00p-27, 0x0.abfe0efbddce40p-26, -0x0.e1e71774bf4e98p-25, 0x0.cfa3b8ac8654d8p-27, 0x0.d202274b9daa98p-27, // x=  2.5625 y=    0.25
+ 0x0.d17b60ccd73b78p-3, 0x0.9b5b98c37897d0p-2, -0x0.e8478eacea09d0p-4, -0x0.9ff7f2b6f8aae8p-5, 0x0.96a03144b8f138p-5, -0x0.e82768783f4d18p-7, -0x0.b85232a92394f8p-8, 0x0.bdd04ceae71c88p-7, -0x0.b97f5007919940p-10, -0x0.80359d15a0e690p-8, 0x0.a0fa9511b98208p-10, 0x0.80f0a917aab5e0p-11, -0x0.bdd37446730098p-12, 0x0.cff4fd05175c28p-13, 0x0.a0f25154e4a5e8p-16, -0x0.82c63c221c8860p-13, 0x0.e226bf05e5a798p-16, 0x0.dd9d1822adc158p-16, -0x0.b59a4c3748a9e0p-17, 0x0.93c14a4adca208p-19, 0x0.993f87f1e8f830p-20, -0x0.c5eaa844a7bc70p-19, 0x0.90a1d2005dd720p-21, 0x0.bcd2b6e3b4ff10p-21, -0x0.8173d90642ac08p-22, 0x0.8323ab7ad56700p-25, 0x0.d1e9b65b2e64e0p-26, -0x0.820e40718aabc8p-24, 0x0.bd1160fa995830p-27, 0x0.e30f73d9ecb840p-27, -0x0.950f348e534308p-28, 0x0.832f31b6ddddc0p-30, 0x0.97828ef72e6ba8p-32, -0x0.9604f3d9b79a50p-30, 0x0.ebea67724ad3c8p-33, 0x0.c61012675ec8a8p-33, -0x0.88b58c021f17a0p-34, 0x0.fce3211ad95468p-36, -0x0.b628ea1856a0d8p-44, -0x0.90cad5b3165770p-36, // x=  2.6875 y=   1.625
+ 0x0.c8766f3a8ff8a0p-3, 0x0.b29adf7f652e08p-3, -0x0.f5bf626f55d3a8p-5, 0x0.8b98fe6d7762e8p-7, 0x0.e8bfd8128c0418p-8, -0x0.c3e714e830bd88p-7, 0x0.9a5e1042b1d730p-10, 0x0.c08578fef80910p-9, -0x0.b5317bd48c3fe8p-11, -0x0.b8f5c9a35c2660p-13, 0x0.fcdd78a44dcaa0p-14, -0x0.d9af36323a3448p-14, 0x0.8d4964c4288358p-18, 0x0.921c1ba5e01e20p-15, -0x0.e6e4b205327e78p-18, -0x0.e01600d8d13348p-19, 0x0.bad404d854f008p-20, -0x0.ec6bbf409fc4f8p-21, 0x0.9867007b6d0090p-27, 0x0.bc1183123c1e00p-22, -0x0.8adf0b76238338p-24, -0x0.97300280978528p-25, 0x0.de0a9f8f88a4d0p-27, -0x0.8bfdd86ced0370p-27, 0x0.e2a971a0eb1dc8p-33, 0x0.d6bb02168787d0p-29, -0x0.9f3a95e5178340p-31, -0x0.8da14a9d6c4b10p-32, 0x0.d8e1f6156ef340p-34, -0x0.af36ebd121d100p-34, 0x0.be47072b2bc108p-38, 0x0.d72cff04d20558p-36, -0x0.a76bb2552fcf08p-38, -0x0.9fbff6e6b7b520p-40, 0x0.a65238466a8178p-41, -0x0.cf3e8cacd65f70p-41, 0x0.b495da70789dd8p-44, 0x0.b59136beb577f8p-43, -0x0.98e4b569a367f0p-45, 0x0.b5576612f20898p-50, // x=  2.9375 y=   3.125
+ 0x0.8a6a29b89ed720p-3, 0x0.c8c936fec51e38p-2, -0x0.d973e576d1f9f8p-4, -0x0.f54c713a5966e8p-4, 0x0.f3b88f2c363b10p-5, 0x0.c06e1757aff4d0p-6, -0x0.d1895c6b179960p-6, 0x0.953da02bc44658p-8, 0x0.ee3248adf09bf0p-8, -0x0.f991b4bd877120p-8, -0x0.fbc2da32aa8fd8p-13, 0x0.896a7becd84738p-8, -0x0.8be15c51884cf8p-10, -0x0.a2939204ad52c8p-10, 0x0.a2501cdcff9cc0p-11, 0x0.ca7fc68d4e16e0p-16, -0x0.a175583217d9a0p-13, 0x0.afdf1185a64038p-13, -0x0.ddac7b4cf81df8p-17, -0x0.a7e640991c4130p-14, 0x0.d228b83b64d3b0p-16, 0x0.d3fdb83283d628p-17, -0x0.8a89b23d35b180p-17, 0x0.984239c4e43bd8p-18, 0x0.f02c0c659d0ba8p-23, -0x0.cddb448a56b020p-19, 0x0.d4af6bc6c0d448p-21, 0x0.9978cc80ea6e38p-21, -0x0.94a33860ec4e08p-22, 0x0.829cc4b0c55e48p-23, 0x0.9b7eb925bd45c8p-27, -0x0.c3137c9ce02168p-24, 0x0.bf4cbe4fa10680p-26, 0x0.81b89740043320p-26, -0x0.ea8d607d196eb0p-28, 0x0.fc5e167b1112a0p-29, -0x0.fb1bee78d88e98p-35, -0x0.9611f856245b98p-29, 0x0.96b891dfbf6c48p-31, 0x0.89b20cd1908e60p-32, // x=    2.75 y=  0.8125
+ 0x0.b05ef4fada5230p-4, 0x0.bd98e03a51c548p-2, -0x0.84493b5ce05d10p-4, -0x0.f3c0d78bc8db18p-4, 0x0.98d194346e83a8p-5, 0x0.8d91b099b887f0p-5, -0x0.9945c108fddae8p-6, -0x0.dda7e1ffd7ecd8p-8, 0x0.81203b72b2aa08p-7, -0x0.8d19fc2f88ad80p-10, -0x0.9fe1f91b303408p-9, 0x0.869f9703e430f0p-9, 0x0.98bcf3f2698f58p-12, -0x0.a1345877703f08p-10, 0x0.e94f005727d900p-13, 0x0.e53afa0947dc58p-12, -0x0.b75c881908d4f0p-13, -0x0.821bebf9e78a78p-14, 0x0.ff9fb0a309a378p-15, -0x0.808f6fb58dea50p-15, -0x0.cf9a83cdd16ba0p-18, 0x0.c5aaecaa5e44f0p-16, -0x0.a65eba817749d0p-18, -0x0.e5abf4ed718fc0p-18, 0x0.bf3061f74d4148p-19, 0x0.b1ebfff1381cb8p-24, -0x0.996a86c6989110p-21, 0x0.c6a8fa3c2584e8p-21, -0x0.c3267e887986b0p-24, -0x0.98c942e2ec2920p-22, 0x0.c066caffec0a68p-24, 0x0.d7a308d54b1398p-26, -0x0.b4316ae2facf18p-26, 0x0.a2e5fcf437d180p-26, -0x0.da43ee3c18cc48p-30, -0x0.8d9f2c666f5b38p-27, 0x0.9df7b6c3f98fb8p-29, 0x0.de2c168a9b40a8p-31, -0x0.8f20bec53fd788p-31, 0x0.faa88526022d28p-32, // x=  3.0625 y=   0.625
+ 0x0.8a0bba024b02f0p-3, 0x0.9fb7ab406e3b88p-2, -0x0.a2e8d318ee1200p-4, -0x0.8d2ee0b3d68fb0p-4, 0x0.856827f4293fd0p-5, 0x0.ec9c71aac92658p-8, -0x0.a68513b9ea6e80p-7, 0x0.e38d172f39c380p-9, 0x0.88874c9d709c28p-9, -0x0.b6f89d4d4321a0p-9, 0x0.df4f3a1925af60p-17, 0x0.9401cb8e992a00p-10, -0x0.f99fdf9d5ae040p-13, -0x0.9003b067011668p-12, 0x0.f0f686ef229fe8p-14, 0x0.d296d9b96a20a0p-17, -0x0.ebea7cda900810p-16, 0x0.bef27e3138c8c8p-16, 0x0.beadc6ef525d20p-21, -0x0.ba3de4e749c9e0p-17, 0x0.a0d59728452298p-19, 0x0.9d7bc7c345c220p-19, -0x0.842c3220095e28p-20, 0x0.f40bdca5252030p-24, 0x0.9e437e434dfc98p-23, -0x0.843f1e8ceecd50p-22, 0x0.88ccb28fa5c1c8p-25, 0x0.a0fd90cd75a2c0p-24, -0x0.be77025869c610p-26, -0x0.9f3f4fe6be8630p-28, 0x0.97545a569efcb0p-28, -0x0.94ca28db704490p-28, 0x0.bb04ecb67ffa28p-32, 0x0.de2d209af6d270p-30, -0x0.e04bbaee373f88p-32, -0x0.a1629526ccdce0p-33, 0x0.bdcdb62e78ed78p-34, -0x0.9c0e8c0571a820p-34, 0x0.a38f35e18ff0e8p-38, 0x0.f57388cc2717f0p-36, // x=  3.1875 y=    1.25
+ 0x0.aaea22a73a5ee8p-3, 0x0.ebdc9ed19d8f50p-3, -0x0.8ddcb5c93b5fd0p-4, -0x0.a63c7fdf665040p-6, 0x0.8a5333b9d98998p-6, -0x0.ede8ab974cc960p-8, -0x0.83136e7ef6deb0p-9, 0x0.8aba99916bd938p-8, -0x0.c08632ef54e590p-12, -0x0.94572997257768p-10, 0x0.8c83028cdf97a0p-12, 0x0.8f3900785b18e8p-13, -0x0.950f86a5370650p-14, 0x0.d5527f2c2a26f0p-16, 0x0.ec63a19522ca30p-18, -0x0.91f62858a17b40p-16, 0x0.90237bfbdfe8f0p-19, 0x0.8934db95892f98p-18, -0x0.93ea328c4f1620p-20, -0x0.e949d18f74a1d8p-23, 0x0.d9b9ada77bc308p-23, -0x0.bf1312ee7a6908p-23, 0x0.bb4383409ee198p-28, 0x0.88d9e661aa0e28p-24, -0x0.ddbd697f77b938p-27, -0x0.820184fa311b70p-27, 0x0.d66162da755320p-29, -0x0.cb6272b362f330p-30, -0x0.eda32ffe172480p-34, 0x0.d6036fb1570c50p-31, -0x0.940cedfda87528p-33, -0x0.fb00a127aeddf0p-34, 0x0.a36ddb85526e58p-35, -0x0.d66f38c1cf1400p-37, -0x0.8357fe5a615300p-39, 0x0.92c2e91ff2b4c8p-37, -0x0.bee002979b9700p-40, -0x0.afd9b5af457578p-40, 0x0.d23b05439f0e48p-42, -0x0.888522cf0eba68p-43, // x=  3.3125 y=    2.25
+ 0x0.a2c7572b603a80p-3, 0x0.cde19d87c754b0p-4, -0x0.e53d179866a600p-6, 0x0.e050076439a500p-7, 0x0.e4f973b6f90040p-12, -0x0.a75c309fe70388p-8, 0x0.b36ea95a450c38p-11, 0x0.fd3bcb95e76468p-12, -0x0.811dc69434d9b8p-13, 0x0.f1b85b4236deb0p-15, 0x0.cf5068ac0832e8p-20, -0x0.b74e67c1d6c3b8p-16, 0x0.c61a418eb38250p-19, 0x0.fd6fdfe988f9a0p-20, -0x0.822b41d9181340p-21, 0x0.9284f33ac48aa8p-22, -0x0.c40409951bfe68p-29, -0x0.bc3f03aa31e898p-24, 0x0.d5627b6fdc4528p-27, 0x0.c85b1e2f817598p-28, -0x0.e5c5387f352b70p-30, 0x0.b58c3821b279a0p-30, -0x0.98f99502d45150p-34, -0x0.b0700f0b45d7a0p-32, 0x0.d6e9d51e5aa240p-35, 0x0.cd118e07629508p-37, -0x0.a79c1edd3e6570p-38, 0x0.d19ed2e7e445a8p-38, -0x0.908a74b2aa3270p-41, -0x0.90c61af5d409e8p-40, 0x0.c18bad1be87e18p-43, -0x0.e1c66f31eded20p-48, -0x0.ac46425faffa58p-47, 0x0.d5649d6e2802b8p-46, -0x0.bd9a81c0eefc98p-49, -0x0.c241a3af590b00p-49, 0x0.9474e21eafbc20p-51, -0x0.e3301a213f9380p-53, -0x0.d90cb029f6e248p-59, 0x0.b8b38ea0d1d040p-54, // x=    3.25 y=       5
+ 0x0.995d7360b5a708p-3, 0x0.b2736b5e2c40c0p-4, -0x0.bb48b926ea5380p-6, 0x0.d9db0e5763db48p-7, -0x0.a175d1b749d9c8p-14, -0x0.836fdd43dbd730p-8, 0x0.8caaa4efa567c8p-11, 0x0.92349281f1e4a0p-12, -0x0.9c9142a607a2b8p-14, 0x0.d7151014f02cf0p-15, -0x0.d9bd6618989f38p-20, -0x0.e076ec9622d900p-17, 0x0.faf7f933712c40p-20, 0x0.b89201e399deb8p-21, -0x0.e528fbb8a9db40p-23, 0x0.d6e07e96cea710p-23, -0x0.d59d1e83e4ea18p-27, -0x0.af5bb2aec330a8p-25, 0x0.d1f8d94dcce400p-28, 0x0.8301e34ed766f8p-30, -0x0.89cbeab3a88618p-31, 0x0.ca3fad8cdf1958p-31, -0x0.8f019c855cf2a8p-34, -0x0.f0af28aff4f440p-34, 0x0.9e2ee682d903f8p-36, -0x0.86abfa8c2c9390p-39, -0x0.e078922e8053e8p-41, 0x0.aa97567d929db0p-39, -0x0.95540b58e2a128p-42, -0x0.8726779efe7020p-42, 0x0.cc9b44dcd56428p-45, -0x0.b854df0ffa9d28p-46, 0x0.863f48e4250e80p-53, 0x0.f8609f5e079838p-48, -0x0.fd512aca956260p-51, -0x0.ccb98ebac226e8p-52, 0x0.d1eb85d416be40p-54, -0x0.d453b23c7ca8f0p-54, 0x0.fcd02e7554beb8p-58, 0x0.9549006189b300p-56, // x=  3.3125 y=  5.5625
+ 0x0.fb05ab16945fc8p-4, 0x0.87ba41c6a280c8p-2, -0x0.f6a1c46188d938p-5, -0x0.c567b3c8b9a9c0p-5, 0x0.a71a11958a7538p-6, 0x0.f22a05af2d4868p-9, -0x0.add204fcce50e8p-8, 0x0.ffd165846fa5c8p-10, 0x0.f67b5d97f6b4f8p-11, -0x0.a2a53e1932e808p-10, -0x0.8f5f125bbe4a08p-16, 0x0.e1eec3f3803cb8p-12, -0x0.8f4829238fe868p-14, -0x0.cde5b183ea33a8p-14, 0x0.8571670eb42b98p-15, 0x0.980e76c8945110p-17, -0x0.89c51ce7d35d98p-17, 0x0.82fa2cb628f368p-18, 0x0.f1abfe2a300aa8p-21, -0x0.9ad5425ce75c78p-19, 0x0.903895bfda46d8p-22, 0x0.a3ee064994d020p-21, -0x0.b396488dc81b80p-23, -0x0.fecba9b175e8a8p-25, 0x0.af5ab37b49da20p-25, -0x0.c04647fff4f8e8p-26, -0x0.a6378b75906a18p-29, 0x0.caa5bd62eb66c8p-27, -0x0.85cc48edbe1fe0p-29, -0x0.a2ece2506d20c0p-29, 0x0.d38dd6830c5268p-31, -0x0.ba787afa324f58p-36, -0x0.f0cbe7e54ba010p-34, 0x0.ab22c801a47a98p-33, -0x0.85ff75dc430770p-36, -0x0.c070cf49324a18p-35, 0x0.bc5840adf9d9b8p-37, 0x0.d150b0d34871c8p-39, -0x0.8c34d4e9f091a8p-39, 0x0.f0a89aceb6d518p-40, // x=   3.625 y=  1.5625
+ 0x0.e394a457b89e20p-5, 0x0.a4470ca0378a78p-2, -0x0.8f03a14f0f8860p-5, -0x0.bc153404eb5610p-4, 0x0.8ca0df98cbedd8p-6, 0x0.d4a170bb925c98p-6, -0x0.fe481c173846a8p-8, -0x0.e0b77e26a76908p-8, 0x0.d8f62eb9ca9930p-9, 0x0.ba20fc90f53720p-10, -0x0.a99c6c32236400p-10, -0x0.d4732c47fc75c0p-16, 0x0.e0992bcf33e258p-12, -0x0.d2643bf9feae40p-13, -0x0.ceb27b9b559ab8p-14, 0x0.958b308c24b5f8p-13, 0x0.c677f7475751f0p-21, -0x0.841cb71aca0338p-14, 0x0.e1878a67d4bdd0p-17, 0x0.97b9758f138be0p-16, -0x0.8108580de11268p-17, -0x0.f19977659e2260p-20, 0x0.9def8f31cb9b20p-19, -0x0.b3514955f47768p-20, -0x0.8143e362bd1630p-22, 0x0.ea3f2e85455468p-21, -0x0.a5fc2ad17060e8p-23, -0x0.873c20f4a53120p-22, 0x0.c758b535d27af8p-24, 0x0.890f77c8f10350p-26, -0x0.bf6d9b3e30a208p-26, 0x0.a397ea3e952f28p-26, -0x0.bb374034460160p-32, -0x0.990bc0bd3a4810p-27, 0x0.9576b50b2e3f60p-29, 0x0.d04f8a23a61ba0p-30, -0x0.c8360d5fad0458p-31, 0x0.8b9b29d48d8a08p-32, 0x0.823dc975d02928p-34, -0x0.e8b4a81cab5f78p-33, // x=  3.5625 y=  0.5625
+ 0x0.9cd5ed16cc72c8p-3, 0x0.9c6562435438d8p-3, -0x0.a995a70b6b0320p-5, 0x0.e450430bcc1190p-11, 0x0.ac404ede547c88p-8, -0x0.c1bdfb8cef6898p-8, 0x0.b39d64e49e3bc0p-13, 0x0.c438c2c2e55c20p-10, -0x0.f7950307f2c0b8p-13, -0x0.a900f77ad8a8e0p-13, 0x0.d9e30892fdeaf8p-15, -0x0.f68ead245c5390p-17, -0x0.85d70281024520p-18, 0x0.9c6e2c362ba810p-17, -0x0.f4be3cf5854e30p-21, -0x0.decae4d47530f8p-20, 0x0.baa13ece3a35a0p-22, 0x0.dd023742dea650p-25, -0x0.c3f772c72165e0p-25, 0x0.c56726a8bb5b90p-25, -0x0.8840593e2a7000p-29, -0x0.c8b66cee3689f0p-27, 0x0.85d4f733d70920p-29, 0x0.fbbf70aaca52b0p-31, -0x0.b74bb4e1f0c9b8p-32, 0x0.d9db454cd7edb8p-33, 0x0.e3d0cac1b205f8p-39, -0x0.98536e819df128p-34, 0x0.b0590cc83b2480p-37, 0x0.fabf41e5909770p-38, -0x0.8caea8192cea90p-39, 0x0.e8f348df489c10p-41, 0x0.851cf51f56aca0p-44, -0x0.d1e976c1326ed8p-42, 0x0.e1a1b1691d6a50p-45, 0x0.bcd557f25f64c8p-45, -0x0.be24d76f39b670p-47, 0x0.883a40ffad6db0p-48, 0x0.c16f0da1db4948p-52, -0x0.875d12d33d4838p-49, // x=    3.75 y=   3.625
+ 0x0.98a71b2c22bbf8p-3, 0x0.86c04135cae3d0p-3, -0x0.8dc03438169538p-5, 0x0.9f466aaff8e7d8p-8, 0x0.d2f363d67725f0p-9, -0x0.aa9dc8214ce758p-8, 0x0.b9df8ed9fab1b8p-12, 0x0.840ebe0fdcdc60p-10, -0x0.b8487fc9118a00p-13, -0x0.f971da378dce30p-15, 0x0.df06b681767c78p-16, -0x0.9679114cba8170p-16, -0x0.82b6d48708b3b0p-22, 0x0.b8dc3832035638p-18, -0x0.c6872025220df0p-21, -0x0.9cfa358a1a1b18p-21, 0x0.a4e6d49ec8dd90p-23, -0x0.c447fb58623fd0p-25, -0x0.8e6dd9769dff10p-27, 0x0.dd450d1bfa90c8p-26, -0x0.c1d358d800ccf8p-29, -0x0.f4821328dff6d0p-29, 0x0.cf205784f53a50p-31, -0x0.992b8a71591190p-34, -0x0.fc1c8cb0964488p-35, 0x0.f4ea282bac8c68p-34, -0x0.b9a71d3b45f140p-37, -0x0.9b8353c708b510p-36, 0x0.ec78d4e5619a08p-39, 0x0.8e45b134fbedd0p-45, -0x0.9f9ad4b0386080p-42, 0x0.82e1976b6080e0p-41, -0x0.bb270827eda930p-45, -0x0.adb43f0bb9a020p-44, 0x0.fc0a4d749b8588p-47, 0x0.d441a826bcec40p-52, -0x0.a4040d7c407f88p-50, 0x0.894ce43781e368p-49, -0x0.cb0ca274713a80p-53, -0x0.adf6a0b9868b60p-52, // x=  3.8125 y=  4.1875
+ 0x0.9a290d2ce28e10p-4, 0x0.84fd3e1faf02e0p-2, -0x0.95d6fb2a4bf460p-5, -0x0.e3541eefe36290p-5, 0x0.d8183b9b519428p-7, 0x0.a98ba4be9d4a20p-7, -0x0.870e952c14fd98p-8, -0x0.b0e44f5d25a138p-10, 0x0.9656f39a01b100p-10, -0x0.976dfa72851630p-14, -0x0.90e9b93e66fec8p-12, 0x0.95c2b2d15352a8p-13, 0x0.d70f862857e3e8p-15, -0x0.8ffed7bbde4870p-14, -0x0.ecd9cd08b103f0p-19, 0x0.c645d33420f3b0p-16, -0x0.a9e061fb1edf50p-19, -0x0.d096077255e6f0p-18, 0x0.d01f074fb15ee8p-20, 0x0.90c8b2ae8e2318p-20, -0x0.8e5893ac0c0090p-21, 0x0.984419878cd580p-28, 0x0.fa943fa28b47b8p-24, -0x0.c365bbb7875c58p-24, -0x0.98ec7b10c90f18p-27, 0x0.ab883461e84a48p-25, -0x0.b9356924787b70p-28, -0x0.a87888a2844360p-27, 0x0.c55d2a67874a40p-29, 0x0.8122c5fa9714e0p-30, -0x0.c5e76d7a378858p-31, 0x0.c5df93bc89dcc8p-32, 0x0.8a33bd14157590p-34, -0x0.dddf28c04603d8p-33, 0x0.f1da4d42f3dcc0p-36, 0x0.cfe021114bc5c0p-35, -0x0.f09b5e5be92c68p-37, -0x0.bc84c8a3668808p-39, 0x0.bfe7fa38f4bfc8p-39, -0x0.9a471231614710p-39, // x=   4.125 y=   1.125
+ 0x0.81720549113650p-3, 0x0.bc051a61a57210p-3, -0x0.aab1e21f3eb058p-5, -0x0.f6115d7b164698p-7, 0x0.8a9ed897e7aa58p-7, -0x0.a8daa3bedcd3e8p-9, -0x0.85c6e639b07d90p-10, 0x0.bde4e18e1c83a0p-10, -0x0.cab6fd4be15900p-16, -0x0.ba301f37fe4d00p-12, 0x0.d0f5f46afb8438p-15, 0x0.d78a1cbf911130p-15, -0x0.f0b1d45d45b180p-17, -0x0.97e7fe766588d0p-20, 0x0.98ce2ac342c868p-19, -0x0.eeddd814a9dd58p-20, -0x0.b466e12e9f6890p-24, 0x0.99c79221efe710p-21, -0x0.93569d333f8090p-24, -0x0.c7d5e6a4788f38p-24, 0x0.c3a4507b14f9b8p-26, 0x0.d61a55174b3e28p-29, -0x0.f2b25c1cf844a0p-29, 0x0.c4e2274aad7c68p-29, 0x0.d5fb6c2ff82a28p-35, -0x0.f583e602218940p-31, 0x0.897fcf45a08340p-33, 0x0.865563e88ffa08p-33, -0x0.949a388c78bc20p-35, 0x0.df544d70875550p-39, 0x0.80e0052e2973b0p-38, -0x0.bea038b455a3f0p-38, 0x0.d1ee1dc8c9b070p-42, 0x0.a8045dda29dc58p-40, -0x0.fa5b1abc9c9520p-43, -0x0.baaf3e1c4d7a08p-44, 0x0.a99cada735d7b0p-45, -0x0.d8459c1ed6fc90p-46, -0x0.9eb8479148edf8p-51, 0x0.95dbaefae385f8p-47, // x=    4.25 y=  2.8125
+ 0x0.85b4400e449490p-5, 0x0.87c67a98f131e0p-2, -0x0.85fda7670be500p-6, -0x0.814255610815b0p-4, 0x0.cfa2dc3727dc30p-8, 0x0.f89ed5dc7c95b8p-7, -0x0.93cbd846ea4fb8p-9, -0x0.f00810cbb17dd8p-9, 0x0.cc2aa7bb540120p-11, 0x0.e51aba3fe07f60p-11, -0x0.8bc8f749cd6b70p-12, -0x0.cff3b96a2d1740p-13, 0x0.be0090d16e1f00p-14, 0x0.a036d2859282e8p-15, -0x0.fba590d9c9d158p-16, -0x0.e0898ddee2b018p-19, 0x0.9b979243c7d7e0p-17, -0x0.93216c4833d478p-19, -0x0.a569824fc7b450p-19, 0x0.f37d93b132e5a8p-20, 0x0.f2f362eec41f30p-22, -0x0.ec26e0d1980d40p-21, 0x0.e55ab485a1caa0p-27, 0x0.ab289ab21a8228p-22, -0x0.fb0a6937a18fe0p-25, -0x0.b399d834a5d408p-24, 0x0.821a84fc97c358p-25, 0x0.bbe204cf6e2488p-27, -0x0.a3bd8b3fdaf128p-27, 0x0.d15893f566eb70p-29, 0x0.e2029010b99998p-30, -0x0.b0e9ff4ef96758p-29, 0x0.9e574d67bdbb90p-33, 0x0.f88bf2857f1df0p-31, -0x0.ea918a8132ea88p-33, -0x0.b4b3f98f6c5f90p-33, 0x0.a987a27861b398p-34, -0x0.ad8c39f6e2eea8p-37, -0x0.e5bb7546e31b38p-37, 0x0.9bdf0a94f1c798p-36, // x=  4.3125 y=     0.5
+ 0x0.cb0aeb29ebf408p-4, 0x0.d11aaaa0d211c8p-3, -0x0.96c1ef0f1ef740p-5, -0x0.e4f7049a249238p-6, 0x0.99e21df57a12b0p-7, 0x0.c89e7f8f9e7bf0p-10, -0x0.f41f0db1e551b0p-10, 0x0.b02188728e6b50p-11, 0x0.8bc0bf931a02a8p-12, -0x0.a7520375d82630p-12, -0x0.d5ac88196f8630p-17, 0x0.b6a8d946568348p-14, -0x0.82aa1d4126edc8p-17, -0x0.8f20a7190b5348p-16, 0x0.e654762e0125e8p-19, 0x0.8be9e5697487f0p-19, -0x0.e6e7dead31e500p-21, 0x0.89b4b7aba3eb50p-24, 0x0.96039c78b086e0p-23, -0x0.831fef4c26bd90p-23, -0x0.fc857e179a8d20p-28, 0x0.a87fbc5db956f0p-25, -0x0.8e842e1a602c10p-28, -0x0.80dfb4e65b57e0p-27, 0x0.ecb1351348c070p-30, 0x0.ae706d00598ac0p-31, -0x0.c7b16ff4fd9a10p-32, 0x0.a0195fb28e9f60p-33, 0x0.99a437106662d0p-35, -0x0.a5933f1687bc70p-34, 0x0.cdb7f7c9f851f8p-38, 0x0.91104ff79a4660p-36, -0x0.e9ab9ad5042d90p-39, -0x0.d9ae5845b9b5f0p-40, 0x0.c73ef351d175e8p-41, -0x0.9d87a326aebf48p-42, -0x0.fc019cbd083720p-45, 0x0.a5090a8625c288p-43, -0x0.85c250f4b61710p-46, -0x0.8003d6ecbda698p-45, // x=  4.5625 y=   2.125
+ 0x0.e7f657b017bc68p-5, 0x0.d2d43aba7dda00p-3, -0x0.aefa8f7f1bc9b0p-6, -0x0.8f9e55da714318p-5, 0x0.c34eb3a9e4d350p-8, 0x0.b005a8d4b9f590p-8, -0x0.bde5fa56607fa8p-10, -0x0.ae7a15731bbe18p-11, 0x0.a7d48a72bc6c98p-12, 0x0.9923c866cce658p-15, -0x0.878730a66d2e78p-14, 0x0.f1bc6de3c6e068p-17, 0x0.c36963e9724e30p-17, -0x0.fa81030166d998p-18, -0x0.e8720738207e70p-20, 0x0.9f3852e347ae40p-19, 0x0.a0be9431367b30p-23, -0x0.a523c3019fcdc8p-21, 0x0.d0c52b8167d630p-26, 0x0.923ed9de915ca8p-23, -0x0.980cd154f31ab0p-26, -0x0.d65b02a3b45080p-26, 0x0.cf747f1bc3e120p-28, 0x0.dbbe7247f85e50p-29, -0x0.d34414fc80a2d8p-30, 0x0.bca11f529294a0p-37, 0x0.a503a4a092fd20p-32, -0x0.c0ca3a470a86c8p-33, -0x0.a3fd426d7f1510p-35, 0x0.98b846c082a2c8p-34, -0x0.d2f17f62e3efc0p-40, -0x0.9cc0ba07160038p-36, 0x0.b4d5d15e4fd098p-39, 0x0.dc676af5372c90p-39, -0x0.f933dfb04b6428p-41, -0x0.81dafad3cf0400p-42, 0x0.d5633bc367c840p-43, -0x0.b3b0534483a1d8p-44, -0x0.c4c728da9a5c28p-46, 0x0.b60cfe162a6c00p-45, // x=  5.1875 y=   1.375
+ 0x0.eee569c47c8bc0p-4, 0x0.8205c67585b5f8p-3, -0x0.d75ed8cc6988f0p-6, -0x0.fc2aca156d8718p-10, 0x0.cb283485a2ccb8p-9, -0x0.a8d1acdac4cbc8p-9, -0x0.80367dc6322bd8p-14, 0x0.a0b46fcc250e70p-11, -0x0.fb51a2a51406e0p-15, -0x0.982c833ef81d50p-14, 0x0.f02259a9de5ac8p-17, 0x0.98ceec4ae43d08p-20, -0x0.da2a037ce82478p-20, 0x0.c47f4487d815d0p-20, 0x0.9d5fdca77e8318p-28, -0x0.b29655d9e6e460p-22, 0x0.9eb31217188f68p-25, 0x0.93bb85a2e43848p-25, -0x0.82ab26528f2f40p-27, 0x0.c9d67472d6f508p-31, 0x0.b7af142b2e98d8p-31, -0x0.81343d622cb500p-30, 0x0.bc3990acd33850p-35, 0x0.b8ef35acaf5398p-33, -0x0.ceba92e5265848p-36, -0x0.c4c882394038a8p-37, 0x0.f73fc2566c50e8p-39, -0x0.eac696ead47790p-40, -0x0.94c17c44201f80p-43, 0x0.9ead3a967514a8p-41, -0x0.f21c7ad6373948p-45, -0x0.96b721fd20bf10p-44, 0x0.e4472f3ef796a8p-47, -0x0.a1d849a20691c8p-52, -0x0.9cbdd00a9786e8p-50, 0x0.da09042a90ba00p-50, -0x0.c05dad66e50a70p-54, -0x0.95a6de192ea728p-52, 0x0.ae0cf25fa962a0p-55, 0x0.e46b5d61d45860p-57, // x=   4.875 y=   4.375
+ 0x0.8c8d6e92394258p-5, 0x0.da8c2ccb20d160p-3, -0x0.dcf7975c0f9f58p-7, -0x0.a3b68c7bc88b30p-5, 0x0.8399af90426d88p-8, 0x0.f17fc8e0660d30p-8, -0x0.8caa3f67c6e468p-10, -0x0.ad939902c3b760p-10, 0x0.8e1e449b16e7f8p-12, 0x0.ee484d44f39e30p-13, -0x0.8aa74511c2c010p-14, -0x0.954cc81970c710p-15, 0x0.83bd33de1154b0p-16, 0x0.9559e47c503678p-18, -0x0.f3d6ccd5dab998p-19, -0x0.a329f9d0d44e78p-23, 0x0.d9f4f2c296e100p-21, -0x0.bc2df249643198p-23, -0x0.b82019364c0f20p-23, 0x0.c4c6b77d3551a0p-24, 0x0.8bd1297e0df6c0p-25, -0x0.8f0148b5bb2d10p-25, -0x0.a56cba463039a0p-28, 0x0.b12e151e0080a0p-27, 0x0.c9ecd7044c32e8p-33, -0x0.c1fb1591618fc8p-29, 0x0.83abfba86c8708p-32, 0x0.b842f9c003e390p-31, -0x0.8ccddb1af503a0p-33, -0x0.8bf7841645dcc0p-33, 0x0.c126396c0aefc8p-35, 0x0.ef52cdd2b81900p-37, -0x0.c91a379e4bfba0p-37, 0x0.b1a4a71979dee0p-39, 0x0.963f25c3cb4178p-39, -0x0.917394aed7ada8p-39, -0x0.b6565664f60b68p-43, 0x0.ce2db4cd0d0538p-41, -0x0.a37e6e1e5de758p-44, -0x0.c332913b377028p-43, // x=    5.25 y=  0.8125
+ 0x0.8e82eb44284648p-3, 0x0.b9f93c74c53448p-4, -0x0.b5df8372c64860p-6, 0x0.a442eaca51bd78p-7, 0x0.fac1c98ad084f0p-12, -0x0.e6c9354695e9b0p-9, 0x0.d17287ab1c0c40p-12, 0x0.ab233a34588518p-12, -0x0.93123dcc0f8c88p-14, 0x0.d30aa66f2cab18p-16, 0x0.86768e41a587b0p-19, -0x0.b06750c5a7fa68p-17, 0x0.9b4f071dab8c28p-20, 0x0.863e6ff174d008p-20, -0x0.dbe9ba531e61e0p-23, 0x0.9c5ac1a8a85610p-24, 0x0.af9c13a577ff48p-28, -0x0.821af294573af8p-25, 0x0.e8dd0cbaa5b940p-29, 0x0.b7dbbad06ae910p-29, -0x0.9834168ed011e0p-31, 0x0.83c6082ffdb978p-32, 0x0.e6eaf915b96c10p-38, -0x0.b7cd6e23645670p-34, 0x0.acd2c8bdc64478p-37, 0x0.d7f45732fb2638p-38, -0x0.c03709f029ab88p-40, 0x0.e5d7bc278b2e10p-41, -0x0.8c5368f1164128p-46, -0x0.f41298c82cc2b0p-43, 0x0.f5f630516aaec0p-46, 0x0.c9bed14885ee10p-47, -0x0.d69f1fa4412098p-49, 0x0.bec62e0f72e008p-49, -0x0.a8f4c544ab68a8p-53, -0x0.944ce1d2de3180p-51, 0x0.a264e4aa02fe38p-54, 0x0.d9c5aab5857648p-57, -0x0.c6a4c18e701c68p-58, 0x0.8fe0bce9b7b4a8p-57, // x=    3.75 y=   5.625
+ 0x0.c4a8c7e17b1188p-4, 0x0.9b8416a31ca3e8p-3, -0x0.d600e31abe0348p-6, -0x0.c4f61530dd5848p-7, 0x0.95a8484389c4e8p-8, -0x0.bd0d7b9f9ae500p-11, -0x0.8e42f100b88060p-11, 0x0.86698b06a220f0p-11, 0x0.ca329cd8a98068p-16, -0x0.f8b04546a58ac8p-14, 0x0.885865b5260930p-17, 0x0.96551d3860a040p-16, -0x0.bc65f90ca9bb58p-19, -0x0.d08f022d2bb288p-20, 0x0.8b3d5285520bf0p-21, -0x0.a562ad219e7e20p-24, -0x0.fd324c2776cc58p-25, 0x0.86025ea69c3480p-24, 0x0.94b10069211628p-30, -0x0.f0fdc9c0f982c0p-27, 0x0.b75c267330bc00p-30, 0x0.81597da3dc9fb8p-29, -0x0.c9ae21f93b3360p-32, -0x0.cb82d15b031050p-34, 0x0.f2beb494a64e28p-35, -0x0.f8b388b2b76400p-36, -0x0.fe16f93409e8f0p-39, 0x0.a6f669cb0772c8p-37, -0x0.aed19dc05087d8p-41, -0x0.d8b06eb56ee920p-40, 0x0.8ac8fdacc296c8p-42, 0x0.fce6d10bb75518p-44, -0x0.bae5f2e2410858p-45, 0x0.86639343716d60p-46, 0x0.dc01d2d617e8b8p-49, -0x0.e94adb95da6db0p-48, 0x0.e921490407edf0p-52, 0x0.9c723d57993840p-50, -0x0.c5f0cdf8c934e8p-53, -0x0.a9c049d580b068p-54, // x=   5.375 y=  3.3125
+ 0x0.daa14c4f446740p-6, 0x0.dcdd60bebbcf38p-3, -0x0.adefb399f047c0p-7, -0x0.a9480e7723e5c0p-5, 0x0.d2cec87f2baf08p-9, 0x0.81c8f41a6b1220p-7, -0x0.e6c11fda4171c8p-11, -0x0.c6507ab55c9248p-10, 0x0.f0ac57b4ea44d0p-13, 0x0.95f67ab203c578p-12, -0x0.f4e6b916d24538p-15, -0x0.dd9fdbebbbe998p-15, 0x0.f60804966c8820p-17, 0x0.9bda2b9a550d38p-17, -0x0.f550f766d658a8p-19, -0x0.c36b5ba79876f0p-20, 0x0.f2b773ddd38bd8p-21, 0x0.ab8ef33b87eb30p-23, -0x0.ec9d442a9c70a8p-23, 0x0.c6b0de9420fd50p-27, 0x0.df4bcc14f387f8p-25, -0x0.8e311c4267f308p-26, -0x0.c4919ccbdb1988p-27, 0x0.85d553a0233590p-27, 0x0.944c6769aec510p-29, -0x0.c4ec7dadaaacc0p-29, -0x0.8dfe20588e8a68p-32, 0x0.f9bddb7e3ec100p-31, -0x0.932448231f49c8p-35, -0x0.88e0f6b820a200p-32, 0x0.a3349f73c2db48p-35, 0x0.f60030fcb7be18p-35, -0x0.8afbf797ab37b0p-36, -0x0.953d178b0caf88p-37, 0x0.a7d21cfcd728e0p-38, -0x0.c98f9d099935e8p-43, -0x0.923f91b9be89c0p-40, 0x0.c9794435055cc8p-41, 0x0.864cc8c70b4098p-43, -0x0.ad962a3f1c9050p-42, // x=    5.25 y=   0.625
+ 0x0.8548607074ab40p-4, 0x0.a89f8ebe164100p-3, -0x0.9e82739ca8b6b0p-6, -0x0.a6333e5e590bf8p-6, 0x0.865acebfcebd78p-8, 0x0.ec4ab9faa66538p-10, -0x0.bd3f22d19cbe10p-11, -0x0.e2f445b3fad700p-18, 0x0.e22ac4a3588238p-14, -0x0.c2800161148650p-15, -0x0.d95815fe2919c8p-17, 0x0.eef46c0f350a48p-17, 0x0.fc532e9c9bad78p-21, -0x0.cc29154ee6cbd8p-19, 0x0.ab9774d4c18e08p-24, 0x0.8ce0d30b79d8b0p-21, -0x0.dcf378c68c4bb0p-25, -0x0.9c74c99d7faf78p-24, 0x0.e625223da3a948p-27, 0x0.eee24a98058aa8p-28, -0x0.b0af69acb1e6e0p-29, 0x0.8eb5fde07a80b8p-35, 0x0.d27463a5c78d88p-32, -0x0.f02e8d6dc36720p-33, -0x0.a9467ab00ab728p-35, 0x0.90052c13e8f400p-34, -0x0.95054a6e6034e0p-44, -0x0.e76cd84f3e2ec8p-37, 0x0.aa3086e26415c0p-40, 0x0.889e3c67191e90p-39, -0x0.caa5dc6c102ba0p-42, -0x0.c1af3e2958fa90p-43, 0x0.9b97378f80e680p-44, -0x0.ad126c0b628020p-47, -0x0.a2ce4a43d21090p-47, 0x0.941ccfe14cf118p-47, 0x0.84a83c2361fa78p-51, -0x0.96b7bc38b42ab0p-49, 0x0.aea8496a3dbc60p-53, 0x0.c60856c5873be0p-52, // x=       6 y=  2.3125
+ 0x0.8b0de280f1f130p-5, 0x0.aeba66fbcad568p-3, -0x0.ac2af998faabd8p-7, -0x0.cce79ac8e7df38p-6, 0x0.9f68673b08fdf0p-9, 0x0.e6d4c474d56890p-9, -0x0.829b4c3ae12c78p-11, -0x0.f551e7b8e06ee8p-12, 0x0.c74bb3ed654538p-14, 0x0.ec757a8ab1d348p-15, -0x0.9085a62a6bd5e8p-16, -0x0.b93a82e43b1278p-18, 0x0.c8c8b835d1bb60p-19, 0x0.f90b8bd3091680p-23, -0x0.859dc1d5432610p-21, 0x0.b03b39428c1868p-24, 0x0.a91bdfcffe7688p-24, -0x0.943562f6ec46c8p-25, -0x0.c7b6aaa21d7e08p-27, 0x0.9efc09cea7b7a8p-27, 0x0.d26cc0565fadc0p-30, -0x0.90ca17fcce2ad0p-29, -0x0.ace8b5ed44f5f0p-33, 0x0.ef759b9b63af00p-32, 0x0.9735c7da292498p-38, -0x0.b76c9abe638460p-34, 0x0.891b24f59b01a0p-38, 0x0.81ef14ff669480p-36, -0x0.db853505da5738p-40, -0x0.a665e448631eb0p-39, 0x0.ef54617cf42120p-42, 0x0.b42d5c829ba250p-42, -0x0.dab0d5ecdbd6c8p-44, -0x0.ffbcb643c43190p-46, 0x0.ae64a6b2b91f60p-46, -0x0.86a84122fff4d8p-49, -0x0.ef0d3c15d5a820p-49, 0x0.81de7af077c850p-49, 0x0.80e0e1374f3a00p-51, -0x0.a97fc1569e58a0p-51, // x=  6.4375 y=    1.25
+ 0x0.b74e9660c028d0p-4, 0x0.a064e1b9eb6aa8p-3, -0x0.ce32a40af79900p-6, -0x0.ecab7641c5bb88p-7, 0x0.99d67e92697cc0p-8, -0x0.d47238e54cf448p-14, -0x0.a7e8a661f92e80p-11, 0x0.da53bd9e8aeb28p-12, 0x0.d8dec7129a8fc0p-15, -0x0.ee7e132d252700p-14, 0x0.d31f71b7ee76e0p-19, 0x0.aa1bb6a90662d0p-16, -0x0.9a7b77d00eb1c0p-19, -0x0.a685c3e3ea2248p-19, 0x0.92eb6619985d58p-21, 0x0.80808de6e2f920p-23, -0x0.b77ccb4f8ae788p-24, 0x0.9dd58f0f3752d8p-25, 0x0.863cc7f1d15f10p-27, -0x0.e58b0bb1cf73a0p-27, 0x0.aa5b130b8262c0p-32, 0x0.b009e6339ecab8p-29, -0x0.a73385a4813368p-32, -0x0.a7a48c8a4ada60p-32, 0x0.9d3ae90e7f5218p-34, 0x0.897dee125ada58p-37, -0x0.b06707834f9b80p-37, 0x0.e8af46c54c6280p-38, 0x0.9cf6551c376790p-41, -0x0.8782858872ec00p-39, 0x0.9f8c224e04e840p-43, 0x0.aa694c826b9b78p-42, -0x0.e6cb8e3f92c1b8p-45, -0x0.c2fb1a225ff540p-46, 0x0.9c86d53cad7518p-47, -0x0.e26a4c5e610028p-49, -0x0.c5731963023b30p-51, 0x0.c5430e6ed72e50p-50, -0x0.b1080d463a2890p-54, -0x0.8ad93fe7443e40p-52, // x=     5.5 y=  3.0625
+};
+// clang-format on
+//--- End of autogenerated code
+
+//! Computes (*wr, *wi) = w(x+iy) for 0 <= x, 0 <= y, x^2 + y^2 < 49, by a Taylor expansion
+//! around the center of the polyomino that contains z. Polyominoes are made of squares
+//! with edge 1/8; the array CerfWTaylorCover gives the polyomino for each square.
+static inline CERF_INLINE_CONSTEXPR void cerf_inline_w_taylor(
+    double x, double y, double* wr, double* wi)
+{
+    const int kP = CerfWTaylorCover[((int)(8 * x) * 64) + ((int)(8 * y))];
+    SET_INFO(900, kP);
+    const double dx = x - CerfWTaylorCenters[2 * kP] / 16.;
+    const double dy = y - CerfWTaylorCenters[2 * kP + 1] / 16.;
+    const int N = CerfWTaylorN;
+    const double* T = &CerfWTaylorCoeffs[2 * N * kP];
+#ifdef CERF_ESTRIN
+    // Split into even and odd terms, evaluated as two independent chains in dz^2.
+    // N is even.
+    const double d2x = dx * dx - dy * dy, d2y = dx * dy + dy * dx;
+    double er = T[2 * N - 4], ei = T[2 * N - 3];
+    double orr = T[2 * N - 2], oi = T[2 * N - 1];
+    for (int k = N - 4; k >= 0; k -= 2) {
+        const double te = er * d2x - ei * d2y;
+        ei = er * d2y + ei * d2x + T[2 * k + 1];
+        er = te + T[2 * k];
+        const double to = orr * d2x - oi * d2y;
+        oi = orr * d2y + oi * d2x + T[2 * k + 3];
+        orr = to + T[2 * k + 2];
+    }
+    *wr = er + (orr * dx - oi * dy);
+    *wi = ei + (orr * dy + oi * dx);
+#else
+    double rr = T[2 * N - 2], ri = T[2 * N - 1];
+    for (int k = N - 2; k >= 0; --k) {
+        const double t = rr * dx - ri * dy;
+        ri = rr * dy + ri * dx + T[2 * k + 1];
+        rr = t + T[2 * k];
+    }
+    *wr = rr;
+    *wi = ri;
+#endif
+}
+
+#ifdef CERF_HAS_CONSTEXPR
+//! Computes (*wr, *wi) = w(x+iy) in constant expressions. Same algorithm as w_of_z from the
+//! library (with Taylor expansion also where the library is built with CERF_W_CHEB), except
+//! that exp(-z^2) is computed by cerf_inline_constexpr_exp and cerf_inline_constexpr_sincos,
+//! and may differ in the last bits. In the lower half plane, |2xy| must not exceed 2^28,
+//! unless exp(-z^2) underflows.
+static inline constexpr void cerf_inline_constexpr_w_of_z(
+    double x, double y, double* wr, double* wi)
+{
+    const double xa = x < 0 ? -x : x;
+    const double ya = y < 0 ? -y : y;
+    // Overflow is not allowed in constant expressions, hence saturate explicitly.
+    const bool huge = xa > 1e150 || ya > 1e150;
+    const double z2 = huge ? HUGE_VAL : xa * xa + y * y;
+    const double ispi = 0.5641895835477562869; // 1 / sqrt(pi)
+
+    // Case |y| << |x|, see w_of_z.
+    if (ya < 1e-8 * xa) {
+        const double wi0 = cerf_inline_im_w_of_x(x);
+        const double e2 = xa > 27. ? 0. : cerf_inline_constexpr_exp(-xa * xa);
+        if (ya == 0 || xa > 6.9) {
+            *wr = ya == 0 ? e2 : e2 + y * (2 * (x * wi0 - ispi));
+            *wi = wi0;
+            return;
+        }
+    }
+
+    // Case |x| << |y|.
+    if (xa < 1e-8 * ya) {
+        *wr = cerf_inline_erfcx(y);
+        *wi = xa == 0 ? 0 : x * (2 * (ispi - y * *wr));
+        return;
+    }
+
+    // Case |z| -> 0.
+    if (z2 < .053) {
+        cerf_inline_w_maclaurin(z2 < .00689 ? (z2 < 4e-7 ? 5 : 14) : 20, x, y, wr, wi);
+        return;
+    }
+
+    double rr = 0, ri = 0;
+    if (z2 >= 49) {
+        // Case |z| -> infty, computed for -z if y < 0.
+        const double xs = y < 0 ? -x : x;
+        if (ya - ya != 0) { // ya = inf
+            *wr = *wi = (xa != xa || y < 0) ? NAN : 0;
+            return;
+        }
+        cerf_inline_w_asymptotic(xs, ya, z2, &rr, &ri);
+        if (y >= 0) {
+            *wr = rr;
+            *wi = ri;
+            return;
+        }
+    } else {
+        // Taylor expansion, computed for |x| + i |y|.
+        if (xa != xa || y != y) {
+            *wr = *wi = xa != xa ? xa : y;
+            return;
+        }
+        cerf_inline_w_taylor(xa, ya, &rr, &ri);
+        if (y >= 0) {
+            *wr = rr;
+            *wi = x < 0 ? -ri : ri;
+            return;
+        }
+        if (x >= 0)
+            ri = -ri; // w(-z) = conj(w(|x| + i|y|)) for x >= 0 > y
+    }
+
+    // Lower half plane: w(z) = 2 exp(-z^2) - w(-z).
+    const double a = huge ? (ya > xa ? HUGE_VAL : -HUGE_VAL) : (y - x) * (x + y);
+    const double e = 2 * cerf_inline_constexpr_exp(a);
+    if (e == 0) {
+        *wr = -rr;
+        *wi = -ri;
+        return;
+    }
+    double s = 0, c = 0;
+    cerf_inline_constexpr_sincos(-2 * x * y, &s, &c);
+    *wr = e * c - rr;
+    *wi = e * s - ri;
+}
+
+//! Computes the Voigt profile in constant expressions, as voigt from the library.
+static inline constexpr double cerf_inline_constexpr_voigt(double x, double sigma, double gamma)
+{
+    const double gam = gamma < 0 ? -gamma : gamma;
+    const double sig = sigma < 0 ? -sigma : sigma;
+    const double s2pi = 2.5066282746310005024; // sqrt(2*pi)
+    if (gam == 0) {
+        if (sig == 0)
+            return x ? 0 : HUGE_VAL; // delta function
+        return cerf_inline_constexpr_exp(-0.5 * (x * (1 / sig)) * (x * (1 / sig))) * (1 / s2pi)
+            * (1 / sig); // Gaussian
+    }
+    if (sig == 0)
+        return gam / (3.14159265358979323846 * (x * x + gam * gam)); // Lorentzian
+    double wr = 0, wi = 0;
+    cerf_inline_constexpr_w_of_z(x * 0.70710678118654752440 * (1 / sig),
+                                 gam * 0.70710678118654752440 * (1 / sig), &wr, &wi);
+    return wr * (1 / s2pi) * (1 / sig);
+}
+#endif // CERF_HAS_CONSTEXPR
+
+#ifdef CERF_INLINE_NO_INFO
+#undef SET_INFO
+#undef SET_ALGO
+#undef SET_NTER
+#undef CERF_INLINE_NO_INFO
+#endif
+
+#endif // __CERF_INLINE_H
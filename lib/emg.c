@@ -0,0 +1,208 @@
+/* Library libcerf:
+ *   Compute complex error functions, based on a new implementation of
+ *   Faddeeva's w_of_z. Also provide Dawson and Voigt functions.
+ *
+ * File emg.c:
+ *   Compute the exponentially modified Gaussian (EMG) peak shape,
+ *   i.e. the convolution of a Gaussian with a one-sided exponential decay,
+ *   together with its derivatives with respect to the peak parameters.
+ *   All computations are based on erfcx, as implemented in erfcx.c.
+ *
+ * Copyright:
+ *   (C) 2026 Forschungszentrum Jülich GmbH
+ *
+ * Licence:
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *   LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *   OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *   WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * Website:
+ *   http://apps.jcns.fz-juelich.de/libcerf
+ *
+ * Revision history:
+ *   ../CHANGELOG
+ *
+ * Man page:
+ *   emg(3)
+ */
+
+#include "cerf.h"
+#include "defs.h" // defines _cerf_cmplx, NaN, C, cexp, ...
+#include <math.h>
+
+#ifdef CERF_INTROSPECT
+IMPORT extern int cerf_algorithm;
+#endif
+
+static const double ispi = 0.5641895835477562869;            // 1 / sqrt(pi)
+static const double is2 = 0.70710678118654752440084436210485; // 1 / sqrt(2)
+static const double is2pi = 0.39894228040143267793994605993438; // 1 / sqrt(2*pi)
+
+// For d = x-mu, s = |sigma|, t = |tau|, the EMG function is
+//    emg = 1/(2t) * exp(a) * erfc(u),
+// with
+//    a = s^2/(2t^2) - d/t,
+//    u = (s/t - d/s) / sqrt(2).
+// Since a - u^2 = -d^2/(2s^2), this can be rewritten as
+//    emg = 1/(2t) * G * erfcx(u)                      for u >= 0,
+//    emg = 1/(2t) * (2 * exp(a) - G * erfcx(-u))      for u < 0,
+// with the Gaussian factor G = exp(-d^2/(2s^2)). In both cases, the arguments of exp
+// are non-positive, so that there is no risk of overflow.
+//
+// Derivatives are computed by the chain rule, with G, exp(a), u depending on the parameters,
+// and erfcx'(v) = 2 v erfcx(v) - 2/sqrt(pi).
+
+//! Computes erfcx'(v) for v >= 0, given E = erfcx(v).
+
+static double erfcx_deriv(double v, double E)
+{
+    if (v < 10)
+        return 2 * v * E - 2 * ispi;
+    // Asymptotic expansion, avoiding cancellation between 2 v erfcx(v) and 2/sqrt(pi):
+    // erfcx'(v) = 2/sqrt(pi) * sum_{n>=1} (-1)^n (2n-1)!! / (2v^2)^n
+    const double r = .5 / (v * v);
+    double term = -r;
+    double sum = term;
+    for (int n = 2; n <= 14; ++n) {
+        term *= -(2 * n - 1) * r;
+        sum += term;
+    }
+    return 2 * ispi * sum;
+}
+
+//! Computes emg and optionally its derivatives, given E = erfcx(|u|).
+
+static double emg_from_erfcx(double d, double s, double t, double u, double E, double* grad)
+{
+    const double G = exp(-0.5 * (d / s) * (d / s));
+    const double F = (0.5 / t) * G * E;
+    const double P = u >= 0 ? 0 : exp(0.5 * (s / t) * (s / t) - d / t) / t;
+    const double f = u >= 0 ? F : P - F;
+    if (grad) {
+        // emg = P + sgn(u) F, with F = G erfcx(|u|) / (2t) and P = exp(a) / t for u < 0.
+        const double sF = u >= 0 ? F : -F;
+        const double D = (0.5 / t) * G * erfcx_deriv(fabs(u), E); // d(sgn(u) F)/du
+        const double it = 1 / t;
+        const double ds2 = d / (s * s);
+        grad[0] = P * it + sF * ds2 + D * is2 / s;
+        grad[1] = P * s * it * it + sF * ds2 * d / s + D * is2 * (it + ds2);
+        grad[2] = P * it * (d * it - s * s * it * it - 1) - sF * it - D * is2 * s * it * it;
+    }
+    return f;
+}
+
+//! Computes emg and optionally its derivatives if sigma or tau vanishes.
+
+static double emg_degenerate(double d, double s, double t, double* grad)
+{
+    if (t == 0) {
+        if (s == 0) {
+            // Delta function, as in voigt
+            SET_ALGO(1201);
+            if (grad)
+                grad[0] = grad[1] = grad[2] = NaN;
+            return d ? 0 : Inf;
+        }
+        // Pure Gaussian. For small tau, emg = G - tau G' + O(tau^2).
+        SET_ALGO(1202);
+        const double f = exp(-0.5 * (d / s) * (d / s)) * (is2pi / s);
+        if (grad) {
+            grad[0] = f * d / (s * s);
+            grad[1] = f * (d * d / (s * s) - 1) / s;
+            grad[2] = f * d / (s * s);
+        }
+        return f;
+    }
+    // Pure exponential decay. For small sigma, emg = E + sigma^2/2 E'' + O(sigma^4).
+    SET_ALGO(1203);
+    const double f = d < 0 ? 0 : exp(-d / t) / t;
+    if (grad) {
+        grad[0] = f / t;
+        grad[1] = 0;
+        grad[2] = f * (d / t - 1) / t;
+    }
+    return f;
+}
+
+/******************************************************************************/
+/*  Library functions emg, emg_grad, emg_array                                */
+/******************************************************************************/
+
+double emg_grad(double x, double mu, double sigma, double tau, double* grad)
+{
+    const double s = fabs(sigma);
+    const double t = fabs(tau);
+    const double d = x - mu;
+    if (s == 0 || t == 0)
+        return emg_degenerate(d, s, t, grad);
+
+    SET_ALGO(1200);
+    const double u = (s / t - d / s) * is2;
+    return emg_from_erfcx(d, s, t, u, erfcx(fabs(u)), grad);
+}
+
+double emg(double x, double mu, double sigma, double tau)
+{
+    return emg_grad(x, mu, sigma, tau, NULL);
+}
+
+void emg_array(
+    size_t n, const double* x, double mu, double sigma, double tau,
+    double* result, double* d_mu, double* d_sigma, double* d_tau)
+{
+    const double s = fabs(sigma);
+    const double t = fabs(tau);
+    const int with_grad = d_mu || d_sigma || d_tau;
+    double grad[3];
+
+    if (s == 0 || t == 0) {
+        for (size_t i = 0; i < n; ++i) {
+            result[i] = emg_degenerate(x[i] - mu, s, t, with_grad ? grad : NULL);
+            if (d_mu)
+                d_mu[i] = grad[0];
+            if (d_sigma)
+                d_sigma[i] = grad[1];
+            if (d_tau)
+                d_tau[i] = grad[2];
+        }
+        return;
+    }
+
+    // Work in chunks: compute all erfcx arguments, then all erfcx values in one call
+    // of erfcx_array, and finally combine them with the exponential factors.
+    enum { NCHUNK = 256 };
+    double u[NCHUNK], E[NCHUNK];
+    for (size_t i0 = 0; i0 < n; i0 += NCHUNK) {
+        const size_t m = n - i0 < NCHUNK ? n - i0 : NCHUNK;
+        for (size_t j = 0; j < m; ++j) {
+            u[j] = (s / t - (x[i0 + j] - mu) / s) * is2;
+            E[j] = fabs(u[j]);
+        }
+        erfcx_array(m, E, E);
+        for (size_t j = 0; j < m; ++j) {
+            const size_t i = i0 + j;
+            result[i] = emg_from_erfcx(x[i] - mu, s, t, u[j], E[j], with_grad ? grad : NULL);
+            if (d_mu)
+                d_mu[i] = grad[0];
+            if (d_sigma)
+                d_sigma[i] = grad[1];
+            if (d_tau)
+                d_tau[i] = grad[2];
+        }
+    }
+}
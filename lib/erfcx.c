@@ -7,6 +7,10 @@
  *   using a novel algorithm that is much faster than DERFC of SLATEC.
  *   This function is used in the computation of Faddeeva, Dawson, and
  *   other complex error functions.
+ *   Also compute erf(x) and erfc(x) for real x, based on erfcx.
+ *   Also compute log(erfc(x)) and log(Phi(x)) for likelihood computations,
+ *   the Mills ratio and its inverse, and the tail of the normal distribution.
+ *   The kernel of erfcx and its lookup tables are in cerf_inline.h.
  *
  * Copyright:
  *   (C) 2012 Massachusetts Institute of Technology
@@ -54,12 +58,13 @@
  *
  * Manual page:
  *   man 3 erfcx
+ *   man 3 log_erfc
+ *   man 3 mills_ratio
  */
 
 #include "cerf.h"
 #include "defs.h" // defines _cerf_cmplx, NaN, C, cexp, ...
 #include <math.h>
-#include <stdalign.h>
 #include <stdio.h>
 #include <stdlib.h>
 
@@ -68,1048 +73,225 @@ IMPORT extern int cerf_algorithm;
 IMPORT extern int cerf_nofterms;
 #endif
 
-//--- The following code is generated by devtool/pro_erfcx_chebcoeffs.py; do not edit
-// clang-format off
-alignas(64) static const double ChebCoeffs0[448 * 2] = {
-        0x0.df5145019522b0p0, -0x0.e8997b2143a390p-10, // x in subrange 0:0 (0.125..0.126953)
-     0x0.dedd28b3ad1e28p0, -0x0.e7d7df1a30eb98p-10, // x in subrange 0:1 (0.126953..0.128906)
-     0x0.de696cfff586d8p0, -0x0.e7171233ac6f48p-10, // x in subrange 0:2 (0.128906..0.130859)
-     0x0.ddf6117f1fc9b0p0, -0x0.e657136724d520p-10, // x in subrange 0:3 (0.130859..0.132812)
-     0x0.dd8315ca603dd0p0, -0x0.e597e1af82f640p-10, // x in subrange 0:4 (0.132812..0.134766)
-     0x0.dd10797b6d67b8p0, -0x0.e4d97c09278320p-10, // x in subrange 0:5 (0.134766..0.136719)
-     0x0.dc9e3c2c7f3e40p0, -0x0.e41be171e8ac28p-10, // x in subrange 0:6 (0.136719..0.138672)
-     0x0.dc2c5d784e7020p0, -0x0.e35f10e90fce80p-10, // x in subrange 0:7 (0.138672..0.140625)
-     0x0.dbbadcfa13ab20p0, -0x0.e2a3096f5724d8p-10, // x in subrange 0:8 (0.140625..0.142578)
-     0x0.db49ba4d86e428p0, -0x0.e1e7ca06e77c48p-10, // x in subrange 0:9 (0.142578..0.144531)
-     0x0.dad8f50edea0a0p0, -0x0.e12d51b355ed10p-10, // x in subrange 0:10 (0.144531..0.146484)
-     0x0.da688cdacf40b0p0, -0x0.e0739f79a19738p-10, // x in subrange 0:11 (0.146484..0.148438)
-     0x0.d9f8814e8a4b00p0, -0x0.dfbab260316360p-10, // x in subrange 0:12 (0.148438..0.150391)
-     0x0.d988d207bdb930p0, -0x0.df02896ed1c740p-10, // x in subrange 0:13 (0.150391..0.152344)
-     0x0.d9197ea49345c8p0, -0x0.de4b23aeb28de8p-10, // x in subrange 0:14 (0.152344..0.154297)
-     0x0.d8aa86c3afbb08p0, -0x0.dd94802a64a438p-10, // x in subrange 0:15 (0.154297..0.15625)
-     0x0.d83bea043242e0p0, -0x0.dcde9dedd7e8c8p-10, // x in subrange 0:16 (0.15625..0.158203)
-     0x0.d7cda805b3b810p0, -0x0.dc297c0658ffb0p-10, // x in subrange 0:17 (0.158203..0.160156)
-     0x0.d75fc06845f848p0, -0x0.db7519828f2a48p-10, // x in subrange 0:18 (0.160156..0.162109)
-     0x0.d6f232cc733758p0, -0x0.dac175727a2240p-10, // x in subrange 0:19 (0.162109..0.164062)
-     0x0.d684fed33d5390p0, -0x0.da0e8ee76ff8b8p-10, // x in subrange 0:20 (0.164062..0.166016)
-     0x0.d618241e1d2b10p0, -0x0.d95c64f41af8e8p-10, // x in subrange 0:21 (0.166016..0.167969)
-     0x0.d5aba24f01f230p0, -0x0.d8aaf6ac778e78p-10, // x in subrange 0:22 (0.167969..0.169922)
-     0x0.d53f7908508b00p0, -0x0.d7fa4325d22f48p-10, // x in subrange 0:23 (0.169922..0.171875)
-     0x0.d4d3a7ece2ddc8p0, -0x0.d74a4976c54920p-10, // x in subrange 0:24 (0.171875..0.173828)
-     0x0.d4682ea0073270p0, -0x0.d69b08b73732a8p-10, // x in subrange 0:25 (0.173828..0.175781)
-     0x0.d3fd0cc57f8b38p0, -0x0.d5ec8000582018p-10, // x in subrange 0:26 (0.175781..0.177734)
-     0x0.d3924201810048p0, -0x0.d53eae6ca01b38p-10, // x in subrange 0:27 (0.177734..0.179688)
-     0x0.d327cdf8b31c18p0, -0x0.d4919317ccff28p-10, // x in subrange 0:28 (0.179688..0.181641)
-     0x0.d2bdb0502f3948p0, -0x0.d3e52d1ee07760p-10, // x in subrange 0:29 (0.181641..0.183594)
-     0x0.d253e8ad7fe110p0, -0x0.d3397ba01e0238p-10, // x in subrange 0:30 (0.183594..0.185547)
-     0x0.d1ea76b6a02ad0p0, -0x0.d28e7dbb08f6d0p-10, // x in subrange 0:31 (0.185547..0.1875)
-     0x0.d1815a11fb1cc0p0, -0x0.d1e43290628e78p-10, // x in subrange 0:32 (0.1875..0.189453)
-     0x0.d11892666b0d60p0, -0x0.d13a994227f138p-10, // x in subrange 0:33 (0.189453..0.191406)
-     0x0.d0b01f5b390610p0, -0x0.d091b0f39045f8p-10, // x in subrange 0:34 (0.191406..0.193359)
-     0x0.d04800981c2678p0, -0x0.cfe978c90ac5d8p-10, // x in subrange 0:35 (0.193359..0.195312)
-     0x0.cfe035c5390910p0, -0x0.cf41efe83cd2c0p-10, // x in subrange 0:36 (0.195312..0.197266)
-     0x0.cf78be8b212878p0, -0x0.ce9b1578001140p-10, // x in subrange 0:37 (0.197266..0.199219)
-     0x0.cf119a92d245d0p0, -0x0.cdf4e8a06085d8p-10, // x in subrange 0:38 (0.199219..0.201172)
-     0x0.ceaac985b5d000p0, -0x0.cd4f688a9ab530p-10, // x in subrange 0:39 (0.201172..0.203125)
-     0x0.ce444b0da04bf8p0, -0x0.ccaa946119c7c8p-10, // x in subrange 0:40 (0.203125..0.205078)
-     0x0.cdde1ed4d0bdc0p0, -0x0.cc066b4f75b098p-10, // x in subrange 0:41 (0.205078..0.207031)
-     0x0.cd784485f012a0p0, -0x0.cb62ec82715708p-10, // x in subrange 0:42 (0.207031..0.208984)
-     0x0.cd12bbcc108c18p0, -0x0.cac01727f8c3f8p-10, // x in subrange 0:43 (0.208984..0.210938)
-     0x0.ccad8452ad2ba8p0, -0x0.ca1dea6f1f51d0p-10, // x in subrange 0:44 (0.210938..0.212891)
-     0x0.cc489dc5a91fb8p0, -0x0.c97c65881ddfb8p-10, // x in subrange 0:45 (0.212891..0.214844)
-     0x0.cbe407d14f3148p0, -0x0.c8db87a4510808p-10, // x in subrange 0:46 (0.214844..0.216797)
-     0x0.cb7fc222513270p0, -0x0.c83b4ff6375958p-10, // x in subrange 0:47 (0.216797..0.21875)
-     0x0.cb1bcc65c76de0p0, -0x0.c79bbdb16f9300p-10, // x in subrange 0:48 (0.21875..0.220703)
-     0x0.cab82649301740p0, -0x0.c6fcd00ab6e480p-10, // x in subrange 0:49 (0.220703..0.222656)
-     0x0.ca54cf7a6ebc68p0, -0x0.c65e8637e72f88p-10, // x in subrange 0:50 (0.222656..0.224609)
-     0x0.c9f1c7a7cbb758p0, -0x0.c5c0df6ff54d98p-10, // x in subrange 0:51 (0.224609..0.226562)
-     0x0.c98f0e7ff3a150p0, -0x0.c523daeaef57e0p-10, // x in subrange 0:52 (0.226562..0.228516)
-     0x0.c92ca3b1f6c698p0, -0x0.c48777e1faf2a8p-10, // x in subrange 0:53 (0.228516..0.230469)
-     0x0.c8ca86ed489b10p0, -0x0.c3ebb58f539b08p-10, // x in subrange 0:54 (0.230469..0.232422)
-     0x0.c868b7e1bf2fc0p0, -0x0.c350932e48f800p-10, // x in subrange 0:55 (0.232422..0.234375)
-     0x0.c807363f92a920p0, -0x0.c2b60ffb3d2e30p-10, // x in subrange 0:56 (0.234375..0.236328)
-     0x0.c7a601b75cb670p0, -0x0.c21c2b33a33638p-10, // x in subrange 0:57 (0.236328..0.238281)
-     0x0.c74519fa180970p0, -0x0.c182e415fd3648p-10, // x in subrange 0:58 (0.238281..0.240234)
-     0x0.c6e47eb91fcf70p0, -0x0.c0ea39e1dade38p-10, // x in subrange 0:59 (0.240234..0.242188)
-     0x0.c6842fa62f2ad8p0, -0x0.c0522bd7d7c678p-10, // x in subrange 0:60 (0.242188..0.244141)
-     0x0.c6242c7360ad98p0, -0x0.bfbab93999d1b0p-10, // x in subrange 0:61 (0.244141..0.246094)
-     0x0.c5c474d32dd488p0, -0x0.bf23e149cf9148p-10, // x in subrange 0:62 (0.246094..0.248047)
-     0x0.c56508786e8340p0, -0x0.be8da34c2eac70p-10, // x in subrange 0:63 (0.248047..0.25)
-     0x0.c4d6726aa75860p0, -0x0.bdad655c6b6348p-9, // x in subrange 1:0 (0.25..0.253906)
-     0x0.c41959ac606148p0, -0x0.bc847c20f46508p-9, // x in subrange 1:1 (0.253906..0.257812)
-     0x0.c35d68a97b67c0p0, -0x0.bb5deda41c99e8p-9, // x in subrange 1:2 (0.257812..0.261719)
-     0x0.c2a29d0a142358p0, -0x0.ba39b433d91828p-9, // x in subrange 1:3 (0.261719..0.265625)
-     0x0.c1e8f47bf076f0p0, -0x0.b917ca2dd60728p-9, // x in subrange 1:4 (0.265625..0.269531)
-     0x0.c1306cb270d1c8p0, -0x0.b7f829ff4674e8p-9, // x in subrange 1:5 (0.269531..0.273438)
-     0x0.c079036680c080p0, -0x0.b6dace24b4ccc8p-9, // x in subrange 1:6 (0.273438..0.277344)
-     0x0.bfc2b65687ad30p0, -0x0.b5bfb129d3ed10p-9, // x in subrange 1:7 (0.277344..0.28125)
-     0x0.bf0d834659ce20p0, -0x0.b4a6cda950d908p-9, // x in subrange 1:8 (0.28125..0.285156)
-     0x0.be5967ff2942a8p0, -0x0.b3901e4ca50588p-9, // x in subrange 1:9 (0.285156..0.289062)
-     0x0.bda6624f775d28p0, -0x0.b27b9dcbe93d90p-9, // x in subrange 1:10 (0.289062..0.292969)
-     0x0.bcf4700b061a38p0, -0x0.b16946eda91d58p-9, // x in subrange 1:11 (0.292969..0.296875)
-     0x0.bc438f0ac9c3b0p0, -0x0.b0591486b720d8p-9, // x in subrange 1:12 (0.296875..0.300781)
-     0x0.bb93bd2cdabf98p0, -0x0.af4b017a0144d0p-9, // x in subrange 1:13 (0.300781..0.304688)
-     0x0.bae4f854678a10p0, -0x0.ae3f08b8663720p-9, // x in subrange 1:14 (0.304688..0.308594)
-     0x0.ba373e69a6d9e8p0, -0x0.ad3525408b1578p-9, // x in subrange 1:15 (0.308594..0.3125)
-     0x0.b98a8d59c9eee8p0, -0x0.ac2d521eb1b790p-9, // x in subrange 1:16 (0.3125..0.316406)
-     0x0.b8dee316ef09e0p0, -0x0.ab278a6c8f8380p-9, // x in subrange 1:17 (0.316406..0.320312)
-     0x0.b8343d98140d68p0, -0x0.aa23c95124ca28p-9, // x in subrange 1:18 (0.320312..0.324219)
-     0x0.b78a9ad9094708p0, -0x0.a9220a0094a978p-9, // x in subrange 1:19 (0.324219..0.328125)
-     0x0.b6e1f8da646048p0, -0x0.a82247bbfd7340p-9, // x in subrange 1:20 (0.328125..0.332031)
-     0x0.b63a55a1737710p0, -0x0.a7247dd1519640p-9, // x in subrange 1:21 (0.332031..0.335938)
-     0x0.b593af38305cf8p0, -0x0.a628a79b3107f8p-9, // x in subrange 1:22 (0.335938..0.339844)
-     0x0.b4ee03ad33fca8p0, -0x0.a52ec080c32d18p-9, // x in subrange 1:23 (0.339844..0.34375)
-     0x0.b4495113a9e570p0, -0x0.a436c3f5913f28p-9, // x in subrange 1:24 (0.34375..0.347656)
-     0x0.b3a5958343fbf0p0, -0x0.a340ad79612da0p-9, // x in subrange 1:25 (0.347656..0.351562)
-     0x0.b302cf182e4fd0p0, -0x0.a24c789810f860p-9, // x in subrange 1:26 (0.351562..0.355469)
-     0x0.b260fbf30315b0p0, -0x0.a15a20e9728248p-9, // x in subrange 1:27 (0.355469..0.359375)
-     0x0.b1c01a38bec568p0, -0x0.a069a21127da28p-9, // x in subrange 1:28 (0.359375..0.363281)
-     0x0.b1202812b45b38p0, -0x0.9f7af7be7ff828p-9, // x in subrange 1:29 (0.363281..0.367188)
-     0x0.b08123ae81bca0p0, -0x0.9e8e1dac53ee90p-9, // x in subrange 1:30 (0.367188..0.371094)
-     0x0.afe30b3e043f38p0, -0x0.9da30fa0e48ba8p-9, // x in subrange 1:31 (0.371094..0.375)
-     0x0.af45dcf74d5220p0, -0x0.9cb9c96db86be0p-9, // x in subrange 1:32 (0.375..0.378906)
-     0x0.aea997149748f8p0, -0x0.9bd246ef7a7a38p-9, // x in subrange 1:33 (0.378906..0.382812)
-     0x0.ae0e37d43a4808p0, -0x0.9aec840dd8dd60p-9, // x in subrange 1:34 (0.382812..0.386719)
-     0x0.ad73bd78a15178p0, -0x0.9a087cbb645078p-9, // x in subrange 1:35 (0.386719..0.390625)
-     0x0.acda26483f72f0p0, -0x0.99262cf56fe590p-9, // x in subrange 1:36 (0.390625..0.394531)
-     0x0.ac41708d851308p0, -0x0.984590c3f130b8p-9, // x in subrange 1:37 (0.394531..0.398438)
-     0x0.aba99a96d55ea8p0, -0x0.9766a43960da00p-9, // x in subrange 1:38 (0.398438..0.402344)
-     0x0.ab12a2b67bd580p0, -0x0.968963729b9528p-9, // x in subrange 1:39 (0.402344..0.40625)
-     0x0.aa7c8742a1f550p0, -0x0.95adca96c37d88p-9, // x in subrange 1:40 (0.40625..0.410156)
-     0x0.a9e74695450398p0, -0x0.94d3d5d721d4d8p-9, // x in subrange 1:41 (0.410156..0.414062)
-     0x0.a952df0c2bf588p0, -0x0.93fb816f092380p-9, // x in subrange 1:42 (0.414062..0.417969)
-     0x0.a8bf4f08dd7570p0, -0x0.9324c9a3b7b928p-9, // x in subrange 1:43 (0.417969..0.421875)
-     0x0.a82c94f0960598p0, -0x0.924faac43a8c10p-9, // x in subrange 1:44 (0.421875..0.425781)
-     0x0.a79aaf2c3e3fe8p0, -0x0.917c2129507620p-9, // x in subrange 1:45 (0.425781..0.429688)
-     0x0.a7099c28613278p0, -0x0.90aa29354dce38p-9, // x in subrange 1:46 (0.429688..0.433594)
-     0x0.a6795a5522d7e0p0, -0x0.8fd9bf54005cc0p-9, // x in subrange 1:47 (0.433594..0.4375)
-     0x0.a5e9e82636abd8p0, -0x0.8f0adffa93a9c8p-9, // x in subrange 1:48 (0.4375..0.441406)
-     0x0.a55b4412d65b08p0, -0x0.8e3d87a775a418p-9, // x in subrange 1:49 (0.441406..0.445312)
-     0x0.a4cd6c95b88e48p0, -0x0.8d71b2e23b9f80p-9, // x in subrange 1:50 (0.445312..0.449219)
-     0x0.a440602d07d090p0, -0x0.8ca75e3b87a9a0p-9, // x in subrange 1:51 (0.449219..0.453125)
-     0x0.a3b41d5a598f48p0, -0x0.8bde864cee3360p-9, // x in subrange 1:52 (0.453125..0.457031)
-     0x0.a328a2a2a53540p0, -0x0.8b1727b8dc0ee8p-9, // x in subrange 1:53 (0.457031..0.460938)
-     0x0.a29dee8e3b5ed0p0, -0x0.8a513f2a7cc000p-9, // x in subrange 1:54 (0.460938..0.464844)
-     0x0.a213ffa8bd2828p0, -0x0.898cc955a11e48p-9, // x in subrange 1:55 (0.464844..0.46875)
-     0x0.a18ad481139460p0, -0x0.88c9c2f6a64820p-9, // x in subrange 1:56 (0.46875..0.472656)
-     0x0.a1026ba9670d90p0, -0x0.880828d25ce4f0p-9, // x in subrange 1:57 (0.472656..0.476562)
-     0x0.a07ac3b716fdb0p0, -0x0.8747f7b5f0b608p-9, // x in subrange 1:58 (0.476562..0.480469)
-     0x0.9ff3db42b17f68p0, -0x0.86892c76d074e0p-9, // x in subrange 1:59 (0.480469..0.484375)
-     0x0.9f6db0e7eb2720p0, -0x0.85cbc3f295fdb8p-9, // x in subrange 1:60 (0.484375..0.488281)
-     0x0.9ee8434596e3b8p0, -0x0.850fbb0eeec588p-9, // x in subrange 1:61 (0.488281..0.492188)
-     0x0.9e6390fd9df660p0, -0x0.84550eb9849a50p-9, // x in subrange 1:62 (0.492188..0.496094)
-     0x0.9ddf98b4f801f8p0, -0x0.839bbbe7e6acd8p-9, // x in subrange 1:63 (0.496094..0.5)
-     0x0.9d1afe17088270p0, -0x0.828840f0f32358p-8, // x in subrange 2:0 (0.5..0.507812)
-     0x0.9c175925b83210p0, -0x0.811d8fc78f3390p-8, // x in subrange 2:1 (0.507812..0.515625)
-     0x0.9b168462077cc8p0, -0x0.ff701eec9bde50p-9, // x in subrange 2:2 (0.515625..0.523438)
-     0x0.9a1875814107f0p0, -0x0.fcaf522bae40d8p-9, // x in subrange 2:3 (0.523438..0.53125)
-     0x0.991d2266099980p0, -0x0.f9f88c65e6e100p-9, // x in subrange 2:4 (0.53125..0.539062)
-     0x0.9824811f7a6a90p0, -0x0.f74ba197f58e28p-9, // x in subrange 2:5 (0.539062..0.546875)
-     0x0.972e87e8408d38p0, -0x0.f4a8669ca53680p-9, // x in subrange 2:6 (0.546875..0.554688)
-     0x0.963b2d25c14620p0, -0x0.f20eb127f794e8p-9, // x in subrange 2:7 (0.554688..0.5625)
-     0x0.954a6767433b50p0, -0x0.ef7e57c25f1b38p-9, // x in subrange 2:8 (0.5625..0.570312)
-     0x0.945c2d651c5a18p0, -0x0.ecf731c4164eb0p-9, // x in subrange 2:9 (0.570312..0.578125)
-     0x0.937075ffe45758p0, -0x0.ea79175093d238p-9, // x in subrange 2:10 (0.578125..0.585938)
-     0x0.9287383fabade0p0, -0x0.e803e1521a5f60p-9, // x in subrange 2:11 (0.585938..0.59375)
-     0x0.91a06b5336feb0p0, -0x0.e597697563f4b8p-9, // x in subrange 2:12 (0.59375..0.601562)
-     0x0.90bc068f3eb950p0, -0x0.e3338a256784c8p-9, // x in subrange 2:13 (0.601562..0.609375)
-     0x0.8fda016db2f118p0, -0x0.e0d81e87387630p-9, // x in subrange 2:14 (0.609375..0.617188)
-     0x0.8efa538d034678p0, -0x0.de850275ff4a88p-9, // x in subrange 2:15 (0.617188..0.625)
-     0x0.8e1cf4af6acb68p0, -0x0.dc3a127f0ac5e8p-9, // x in subrange 2:16 (0.625..0.632812)
-     0x0.8d41dcba3fca78p0, -0x0.d9f72bddf8f5f0p-9, // x in subrange 2:17 (0.632812..0.640625)
-     0x0.8c6903b5475968p0, -0x0.d7bc2c78f77b18p-9, // x in subrange 2:18 (0.640625..0.648438)
-     0x0.8b9261ca0c9fe8p0, -0x0.d588f2dd1a7c60p-9, // x in subrange 2:19 (0.648438..0.65625)
-     0x0.8abdef433bbc50p0, -0x0.d35d5e3ac9b050p-9, // x in subrange 2:20 (0.65625..0.664062)
-     0x0.89eba48c0030c8p0, -0x0.d1394e6242eb50p-9, // x in subrange 2:21 (0.664062..0.671875)
-     0x0.891b7a2f66c2c8p0, -0x0.cf1ca3c031a718p-9, // x in subrange 2:22 (0.671875..0.679688)
-     0x0.884d68d7c2b978p0, -0x0.cd073f5a5afa70p-9, // x in subrange 2:23 (0.679688..0.6875)
-     0x0.8781694e1665a0p0, -0x0.caf902cc5d7c98p-9, // x in subrange 2:24 (0.6875..0.695312)
-     0x0.86b774797ee000p0, -0x0.c8f1d044849310p-9, // x in subrange 2:25 (0.695312..0.703125)
-     0x0.85ef835ea2eb38p0, -0x0.c6f18a80aeac68p-9, // x in subrange 2:26 (0.703125..0.710938)
-     0x0.85298f1f24e5a0p0, -0x0.c4f814cb45ed10p-9, // x in subrange 2:27 (0.710938..0.71875)
-     0x0.846590f917b9e8p0, -0x0.c30552f84ad830p-9, // x in subrange 2:28 (0.71875..0.726562)
-     0x0.83a3824676bc18p0, -0x0.c1192962708000p-9, // x in subrange 2:29 (0.726562..0.734375)
-     0x0.82e35c7ca061a0p0, -0x0.bf337ce849cd58p-9, // x in subrange 2:30 (0.734375..0.742188)
-     0x0.8225192bd3c3f8p0, -0x0.bd5432e98770c8p-9, // x in subrange 2:31 (0.742188..0.75)
-     0x0.8168b1feb0dd28p0, -0x0.bb7b31444612a8p-9, // x in subrange 2:32 (0.75..0.757812)
-     0x0.80ae20b9bb6e08p0, -0x0.b9a85e526c5a50p-9, // x in subrange 2:33 (0.757812..0.765625)
-     0x0.ffeabe75c0fda0p-1, -0x0.b7dba0e7186738p-9, // x in subrange 2:34 (0.765625..0.773438)
-     0x0.fe7ccef1fcd528p-1, -0x0.b614e04c1c5a38p-9, // x in subrange 2:35 (0.773438..0.78125)
-     0x0.fd126706decdb0p-1, -0x0.b454043f898e98p-9, // x in subrange 2:36 (0.78125..0.789062)
-     0x0.fbab7b032cf198p-1, -0x0.b298f4f14a2670p-9, // x in subrange 2:37 (0.789062..0.796875)
-     0x0.fa47ff64dd93c8p-1, -0x0.b0e39b00c88ee8p-9, // x in subrange 2:38 (0.796875..0.804688)
-     0x0.f8e7e8d83a9c18p-1, -0x0.af33df7aa4a530p-9, // x in subrange 2:39 (0.804688..0.8125)
-     0x0.f78b2c37095c50p-1, -0x0.ad89abd67624e8p-9, // x in subrange 2:40 (0.8125..0.820312)
-     0x0.f631be87b6d318p-1, -0x0.abe4e9f49c0da0p-9, // x in subrange 2:41 (0.820312..0.828125)
-     0x0.f4db94fc884390p-1, -0x0.aa45841c18ad28p-9, // x in subrange 2:42 (0.828125..0.835938)
-     0x0.f388a4f2d00840p-1, -0x0.a8ab64f879ffc0p-9, // x in subrange 2:43 (0.835938..0.84375)
-     0x0.f238e3f2268958p-1, -0x0.a7167797ce18c0p-9, // x in subrange 2:44 (0.84375..0.851562)
-     0x0.f0ec47aba73e50p-1, -0x0.a586a768a34900p-9, // x in subrange 2:45 (0.851562..0.859375)
-     0x0.efa2c5f931a3a8p-1, -0x0.a3fbe03813b908p-9, // x in subrange 2:46 (0.859375..0.867188)
-     0x0.ee5c54dcae0e68p-1, -0x0.a2760e2fdc3088p-9, // x in subrange 2:47 (0.867188..0.875)
-     0x0.ed18ea7f5646c8p-1, -0x0.a0f51dd47dc530p-9, // x in subrange 2:48 (0.875..0.882812)
-     0x0.ebd87d3101d538p-1, -0x0.9f78fc036a2d78p-9, // x in subrange 2:49 (0.882812..0.890625)
-     0x0.ea9b036775ec00p-1, -0x0.9e0195f13a7568p-9, // x in subrange 2:50 (0.890625..0.898438)
-     0x0.e96073bdb8d970p-1, -0x0.9c8ed927efd530p-9, // x in subrange 2:51 (0.898438..0.90625)
-     0x0.e828c4f368ee78p-1, -0x0.9b20b3853e6b80p-9, // x in subrange 2:52 (0.90625..0.914062)
-     0x0.e6f3edec16c608p-1, -0x0.99b71338e19e08p-9, // x in subrange 2:53 (0.914062..0.921875)
-     0x0.e5c1e5aea2da30p-1, -0x0.9851e6c2f9e598p-9, // x in subrange 2:54 (0.921875..0.929688)
-     0x0.e492a3649e54b8p-1, -0x0.96f11cf273cb70p-9, // x in subrange 2:55 (0.929688..0.9375)
-     0x0.e3661e59af0838p-1, -0x0.9594a4e377e018p-9, // x in subrange 2:56 (0.9375..0.945312)
-     0x0.e23c4dfaf68108p-1, -0x0.943c6dfde374a0p-9, // x in subrange 2:57 (0.945312..0.953125)
-     0x0.e11529d67c1bb0p-1, -0x0.92e867f3c9e0a0p-9, // x in subrange 2:58 (0.953125..0.960938)
-     0x0.dff0a99a9a10a8p-1, -0x0.919882bffe2170p-9, // x in subrange 2:59 (0.960938..0.96875)
-     0x0.decec5156d64c0p-1, -0x0.904caea4a49fa0p-9, // x in subrange 2:60 (0.96875..0.976562)
-     0x0.ddaf743448ad98p-1, -0x0.8f04dc29cce930p-9, // x in subrange 2:61 (0.976562..0.984375)
-     0x0.dc92af03299b70p-1, -0x0.8dc0fc1c133060p-9, // x in subrange 2:62 (0.984375..0.992188)
-     0x0.db786dac3137c8p-1, -0x0.8c80ff8b496080p-9, // x in subrange 2:63 (0.992188..1)
-     0x0.d9d5b207b0b0e8p-1, -0x0.8aa82f30d34900p-8, // x in subrange 3:0 (1..1.01562)
-     0x0.d7afe8e2e47c38p-1, -0x0.883ed957e7bf50p-8, // x in subrange 3:1 (1.01562..1.03125)
-     0x0.d593a7d56f4c08p-1, -0x0.85e41140c823a0p-8, // x in subrange 3:2 (1.03125..1.04688)
-     0x0.d380b581042390p-1, -0x0.83976b2c2eb298p-8, // x in subrange 3:3 (1.04688..1.0625)
-     0x0.d176da2f056d00p-1, -0x0.81587efbabd040p-8, // x in subrange 3:4 (1.0625..1.07812)
-     0x0.cf75dfc248b308p-1, -0x0.fe4dd01cbb1178p-9, // x in subrange 3:5 (1.07812..1.09375)
-     0x0.cd7d91a96480c0p-1, -0x0.fa048a3e4403e0p-9, // x in subrange 3:6 (1.09375..1.10938)
-     0x0.cb8dbcd1829ec8p-1, -0x0.f5d470486725a0p-9, // x in subrange 3:7 (1.10938..1.125)
-     0x0.c9a62f99b12868p-1, -0x0.f1bccc603c1c18p-9, // x in subrange 3:8 (1.125..1.14062)
-     0x0.c7c6b9c6ad3338p-1, -0x0.edbceea7fb37d8p-9, // x in subrange 3:9 (1.14062..1.15625)
-     0x0.c5ef2c77220140p-1, -0x0.e9d42d05f08550p-9, // x in subrange 3:10 (1.15625..1.17188)
-     0x0.c41f5a1857ef40p-1, -0x0.e601e2edc7ea48p-9, // x in subrange 3:11 (1.17188..1.1875)
-     0x0.c257165b4e8830p-1, -0x0.e245712c176008p-9, // x in subrange 3:12 (1.1875..1.20312)
-     0x0.c096362a3d5bf0p-1, -0x0.de9e3db40da5d0p-9, // x in subrange 3:13 (1.20312..1.21875)
-     0x0.bedc8f9e776838p-1, -0x0.db0bb36f2d03f0p-9, // x in subrange 3:14 (1.21875..1.23438)
-     0x0.bd29f9f6ad1370p-1, -0x0.d78d420efae298p-9, // x in subrange 3:15 (1.23438..1.25)
-     0x0.bb7e4d8d88e660p-1, -0x0.d4225de08e1408p-9, // x in subrange 3:16 (1.25..1.26562)
-     0x0.b9d963d0a35bd8p-1, -0x0.d0ca7fa1e6bf50p-9, // x in subrange 3:17 (1.26562..1.28125)
-     0x0.b83b1737ca47e8p-1, -0x0.cd852458fbd880p-9, // x in subrange 3:18 (1.28125..1.29688)
-     0x0.b6a3433c987e80p-1, -0x0.ca51cd2c6b0710p-9, // x in subrange 3:19 (1.29688..1.3125)
-     0x0.b511c4525a8748p-1, -0x0.c72fff3db8c0b0p-9, // x in subrange 3:20 (1.3125..1.32812)
-     0x0.b38677de3d4f70p-1, -0x0.c41f43850f3aa0p-9, // x in subrange 3:21 (1.32812..1.34375)
-     0x0.b2013c2fc3eca0p-1, -0x0.c11f26ae6ba400p-9, // x in subrange 3:22 (1.34375..1.35938)
-     0x0.b081f07981a460p-1, -0x0.be2f38f829e040p-9, // x in subrange 3:23 (1.35938..1.375)
-     0x0.af0874ca158a68p-1, -0x0.bb4f0e12dfb5b8p-9, // x in subrange 3:24 (1.375..1.39062)
-     0x0.ad94aa056524a8p-1, -0x0.b87e3d02791620p-9, // x in subrange 3:25 (1.39062..1.40625)
-     0x0.ac2671de13a1a0p-1, -0x0.b5bc600087d0e8p-9, // x in subrange 3:26 (1.40625..1.42188)
-     0x0.aabdaecf334670p-1, -0x0.b309145fb9a050p-9, // x in subrange 3:27 (1.42188..1.4375)
-     0x0.a95a44162ed510p-1, -0x0.b063fa70681b68p-9, // x in subrange 3:28 (1.4375..1.45312)
-     0x0.a7fc15ace8c2b0p-1, -0x0.adccb56636a968p-9, // x in subrange 3:29 (1.45312..1.46875)
-     0x0.a6a308440e2dc0p-1, -0x0.ab42eb3eb31d00p-9, // x in subrange 3:30 (1.46875..1.48438)
-     0x0.a54f013d9b98f0p-1, -0x0.a8c644a8ee2268p-9, // x in subrange 3:31 (1.48438..1.5)
-     0x0.a3ffe6a7918678p-1, -0x0.a6566cee012840p-9, // x in subrange 3:32 (1.5..1.51562)
-     0x0.a2b59f36d72220p-1, -0x0.a3f311da77e348p-9, // x in subrange 3:33 (1.51562..1.53125)
-     0x0.a1701242493ca0p-1, -0x0.a19be3a893fde8p-9, // x in subrange 3:34 (1.53125..1.54688)
-     0x0.a02f27bdf3ed08p-1, -0x0.9f5094eb61f120p-9, // x in subrange 3:35 (1.54688..1.5625)
-     0x0.9ef2c836753e60p-1, -0x0.9d10da7a966b60p-9, // x in subrange 3:36 (1.5625..1.57812)
-     0x0.9dbadccc8760f8p-1, -0x0.9adc6b5f2c0c08p-9, // x in subrange 3:37 (1.57812..1.59375)
-     0x0.9c874f30b0e668p-1, -0x0.98b300c0b99728p-9, // x in subrange 3:38 (1.59375..1.60938)
-     0x0.9b58099f199f00p-1, -0x0.969455d3791eb0p-9, // x in subrange 3:39 (1.60938..1.625)
-     0x0.9a2cf6db82bdf0p-1, -0x0.948027c6f8f2a8p-9, // x in subrange 3:40 (1.625..1.64062)
-     0x0.9906022d60f798p-1, -0x0.927635b56f7aa8p-9, // x in subrange 3:41 (1.64062..1.65625)
-     0x0.97e3175c175a98p-1, -0x0.90764093ab6838p-9, // x in subrange 3:42 (1.65625..1.67188)
-     0x0.96c422ab51b188p-1, -0x0.8e800b2199fa58p-9, // x in subrange 3:43 (1.67188..1.6875)
-     0x0.95a910d77d4718p-1, -0x0.8c9359db5d5118p-9, // x in subrange 3:44 (1.6875..1.70312)
-     0x0.9491cf125ef220p-1, -0x0.8aaff2eaed1220p-9, // x in subrange 3:45 (1.70312..1.71875)
-     0x0.937e4affc55af0p-1, -0x0.88d59e1a3bdf20p-9, // x in subrange 3:46 (1.71875..1.73438)
-     0x0.926e72b2567518p-1, -0x0.870424c5dc5b18p-9, // x in subrange 3:47 (1.73438..1.75)
-     0x0.916234a87733e8p-1, -0x0.853b51d020b640p-9, // x in subrange 3:48 (1.75..1.76562)
-     0x0.90597fc94c8930p-1, -0x0.837af194afede8p-9, // x in subrange 3:49 (1.76562..1.78125)
-     0x0.8f544361d4c800p-1, -0x0.81c2d1dc8c23e8p-9, // x in subrange 3:50 (1.78125..1.79688)
-     0x0.8e526f22188ce0p-1, -0x0.8012c1d285a228p-9, // x in subrange 3:51 (1.79688..1.8125)
-     0x0.8d53f31a725750p-1, -0x0.fcd523f02c9f00p-10, // x in subrange 3:52 (1.8125..1.82812)
-     0x0.8c58bfb8ec06e8p-1, -0x0.f9942835431108p-10, // x in subrange 3:53 (1.82812..1.84375)
-     0x0.8b60c5c6b17808p-1, -0x0.f662369228f468p-10, // x in subrange 3:54 (1.84375..1.85938)
-     0x0.8a6bf665978220p-1, -0x0.f33ef793c68e80p-10, // x in subrange 3:55 (1.85938..1.875)
-     0x0.897a430db6a208p-1, -0x0.f02a1622becdd0p-10, // x in subrange 3:56 (1.875..1.89062)
-     0x0.888b9d8b18a118p-1, -0x0.ed233f70c7a7b8p-10, // x in subrange 3:57 (1.89062..1.90625)
-     0x0.879ff7fb789108p-1, -0x0.ea2a22e6a789b0p-10, // x in subrange 3:58 (1.90625..1.92188)
-     0x0.86b744cc147a30p-1, -0x0.e73e7212d19818p-10, // x in subrange 3:59 (1.92188..1.9375)
-     0x0.85d176b79020e8p-1, -0x0.e45fe0989ab620p-10, // x in subrange 3:60 (1.9375..1.95312)
-     0x0.84ee80c3e84bb8p-1, -0x0.e18e2420019258p-10, // x in subrange 3:61 (1.95312..1.96875)
-     0x0.840e564075fa60p-1, -0x0.dec8f446042f90p-10, // x in subrange 3:62 (1.96875..1.98438)
-     0x0.8330eac40102b0p-1, -0x0.dc100a8d7d9bb8p-10, // x in subrange 3:63 (1.98438..2)
-     0x0.81e9d53b006660p-1, -0x0.d81119c9e74368p-9, // x in subrange 4:0 (2..2.03125)
-     0x0.803ee60343fef0p-1, -0x0.d2e5b1abd447e0p-9, // x in subrange 4:1 (2.03125..2.0625)
-     0x0.fd3c4198014d48p-2, -0x0.cde6c6e1c2e400p-9, // x in subrange 4:2 (2.0625..2.09375)
-     0x0.fa0e5d017bf7b8p-2, -0x0.c9127764c7bc40p-9, // x in subrange 4:3 (2.09375..2.125)
-     0x0.f6f3777133c418p-2, -0x0.c466f968027760p-9, // x in subrange 4:4 (2.125..2.15625)
-     0x0.f3eaf10e7b0420p-2, -0x0.bfe299f3810288p-9, // x in subrange 4:5 (2.15625..2.1875)
-     0x0.f0f430a10a7a70p-2, -0x0.bb83bb96215f80p-9, // x in subrange 4:6 (2.1875..2.21875)
-     0x0.ee0ea33d5e77e8p-2, -0x0.b748d52cd166a0p-9, // x in subrange 4:7 (2.21875..2.25)
-     0x0.eb39bbf5cec480p-2, -0x0.b33070bdabe188p-9, // x in subrange 4:8 (2.25..2.28125)
-     0x0.e874f39014ad50p-2, -0x0.af392a658fbdf8p-9, // x in subrange 4:9 (2.28125..2.3125)
-     0x0.e5bfc83ef7e960p-2, -0x0.ab61af56e90900p-9, // x in subrange 4:10 (2.3125..2.34375)
-     0x0.e319bd5fdff4b0p-2, -0x0.a7a8bce87c2148p-9, // x in subrange 4:11 (2.34375..2.375)
-     0x0.e0825b3c0c1198p-2, -0x0.a40d1fb31a4e30p-9, // x in subrange 4:12 (2.375..2.40625)
-     0x0.ddf92ecd3859c8p-2, -0x0.a08db2bd3bd0b0p-9, // x in subrange 4:13 (2.40625..2.4375)
-     0x0.db7dc9857a2fe0p-2, -0x0.9d295eb38ec090p-9, // x in subrange 4:14 (2.4375..2.46875)
-     0x0.d90fc11a2202b8p-2, -0x0.99df192d9bbb70p-9, // x in subrange 4:15 (2.46875..2.5)
-     0x0.d6aeaf5173ad08p-2, -0x0.96ade3fdb1b930p-9, // x in subrange 4:16 (2.5..2.53125)
-     0x0.d45a31d309d998p-2, -0x0.9394cc8b595d90p-9, // x in subrange 4:17 (2.53125..2.5625)
-     0x0.d211e9fabbb568p-2, -0x0.9092eb379df7b8p-9, // x in subrange 4:18 (2.5625..2.59375)
-     0x0.cfd57caddee7b8p-2, -0x0.8da762ca8723f8p-9, // x in subrange 4:19 (2.59375..2.625)
-     0x0.cda49232c243a8p-2, -0x0.8ad15fe929cbe0p-9, // x in subrange 4:20 (2.625..2.65625)
-     0x0.cb7ed60a3ff600p-2, -0x0.88101893c22120p-9, // x in subrange 4:21 (2.65625..2.6875)
-     0x0.c963f6cb481770p-2, -0x0.8562cbab523900p-9, // x in subrange 4:22 (2.6875..2.71875)
-     0x0.c753a600468968p-2, -0x0.82c8c07e4a3798p-9, // x in subrange 4:23 (2.71875..2.75)
-     0x0.c54d980648dfb0p-2, -0x0.8041465bc78bd8p-9, // x in subrange 4:24 (2.75..2.78125)
-     0x0.c35183edcad198p-2, -0x0.fb97685a015b18p-10, // x in subrange 4:25 (2.78125..2.8125)
-     0x0.c15f235d1149b0p-2, -0x0.f6ced028f449b0p-10, // x in subrange 4:26 (2.8125..2.84375)
-     0x0.bf763273fda9f8p-2, -0x0.f2278e2550dc88p-10, // x in subrange 4:27 (2.84375..2.875)
-     0x0.bd966fb1443f70p-2, -0x0.eda0795f513218p-10, // x in subrange 4:28 (2.875..2.90625)
-     0x0.bbbf9bd8f22c30p-2, -0x0.e93875537ea3e8p-10, // x in subrange 4:29 (2.90625..2.9375)
-     0x0.b9f179dc3046a0p-2, -0x0.e4ee7150a6e850p-10, // x in subrange 4:30 (2.9375..2.96875)
-     0x0.b82bcec2318c38p-2, -0x0.e0c167e63c7928p-10, // x in subrange 4:31 (2.96875..3)
-     0x0.b66e61923cd5e8p-2, -0x0.dcb05e5a9fc408p-10, // x in subrange 4:32 (3..3.03125)
-     0x0.b4b8fb3ec27790p-2, -0x0.d8ba6428d74aa0p-10, // x in subrange 4:33 (3.03125..3.0625)
-     0x0.b30b66916f5f88p-2, -0x0.d4de928544dc10p-10, // x in subrange 4:34 (3.0625..3.09375)
-     0x0.b1657018302850p-2, -0x0.d11c0be8ed8218p-10, // x in subrange 4:35 (3.09375..3.125)
-     0x0.afc6e613175aa0p-2, -0x0.cd71fba2f0a810p-10, // x in subrange 4:36 (3.125..3.15625)
-     0x0.ae2f98631ae068p-2, -0x0.c9df956fd16ec0p-10, // x in subrange 4:37 (3.15625..3.1875)
-     0x0.ac9f58799d5bc8p-2, -0x0.c66415163b1c88p-10, // x in subrange 4:38 (3.1875..3.21875)
-     0x0.ab15f948b8be98p-2, -0x0.c2febe08ef2950p-10, // x in subrange 4:39 (3.21875..3.25)
-     0x0.a9934f34401be8p-2, -0x0.bfaedb0d9093c0p-10, // x in subrange 4:40 (3.25..3.28125)
-     0x0.a81730036f41f8p-2, -0x0.bc73bde80500d0p-10, // x in subrange 4:41 (3.28125..3.3125)
-     0x0.a6a172d33f3400p-2, -0x0.b94cbf0a28a448p-10, // x in subrange 4:42 (3.3125..3.34375)
-     0x0.a531f009571e30p-2, -0x0.b6393d47962188p-10, // x in subrange 4:43 (3.34375..3.375)
-     0x0.a3c8814791d758p-2, -0x0.b3389d8d477bc0p-10, // x in subrange 4:44 (3.375..3.40625)
-     0x0.a26501601075f8p-2, -0x0.b04a4a9cd8cfa8p-10, // x in subrange 4:45 (3.40625..3.4375)
-     0x0.a1074c49d2e990p-2, -0x0.ad6db4cb38f870p-10, // x in subrange 4:46 (3.4375..3.46875)
-     0x0.9faf3f15cfeda8p-2, -0x0.aaa251c2976c18p-10, // x in subrange 4:47 (3.46875..3.5)
-     0x0.9e5cb7e4860a10p-2, -0x0.a7e79c47619228p-10, // x in subrange 4:48 (3.5..3.53125)
-     0x0.9d0f95dbffad28p-2, -0x0.a53d1400249b68p-10, // x in subrange 4:49 (3.53125..3.5625)
-     0x0.9bc7b91e44bfe8p-2, -0x0.a2a23d402b77a0p-10, // x in subrange 4:50 (3.5625..3.59375)
-     0x0.9a8502c0346168p-2, -0x0.a016a0d4b2f000p-10, // x in subrange 4:51 (3.59375..3.625)
-     0x0.994754c0c1c260p-2, -0x0.9d99cbd4902ff0p-10, // x in subrange 4:52 (3.625..3.65625)
-     0x0.980e92008f5cf0p-2, -0x0.9b2b4f722822e8p-10, // x in subrange 4:53 (3.65625..3.6875)
-     0x0.96da9e39e407b8p-2, -0x0.98cac0cf9807c0p-10, // x in subrange 4:54 (3.6875..3.71875)
-     0x0.95ab5df8f59f50p-2, -0x0.9677b8d4f17500p-10, // x in subrange 4:55 (3.71875..3.75)
-     0x0.9480b694853bc8p-2, -0x0.9431d4086dc448p-10, // x in subrange 4:56 (3.75..3.78125)
-     0x0.935a8e26c91e10p-2, -0x0.91f8b2687e7b80p-10, // x in subrange 4:57 (3.78125..3.8125)
-     0x0.9238cb86a0b4a8p-2, -0x0.8fcbf747a1d010p-10, // x in subrange 4:58 (3.8125..3.84375)
-     0x0.911b56410f4678p-2, -0x0.8dab4929e3cd70p-10, // x in subrange 4:59 (3.84375..3.875)
-     0x0.90021692fa0178p-2, -0x0.8b9651a3f5fed8p-10, // x in subrange 4:60 (3.875..3.90625)
-     0x0.8eecf563265528p-2, -0x0.898cbd3bc8bd58p-10, // x in subrange 4:61 (3.90625..3.9375)
-     0x0.8ddbdc3c75a8d8p-2, -0x0.878e3b4a927110p-10, // x in subrange 4:62 (3.9375..3.96875)
-     0x0.8cceb5485ba590p-2, -0x0.859a7de0322f38p-10, // x in subrange 4:63 (3.96875..4)
-     0x0.8b4232ab9dc0a0p-2, -0x0.82c06e23fbe910p-9, // x in subrange 5:0 (4..4.0625)
-     0x0.893e92c6e8fd88p-2, -0x0.fe2c12a099fb30p-10, // x in subrange 5:1 (4.0625..4.125)
-     0x0.87494f9c5feaf8p-2, -0x0.f72372664c4fb0p-10, // x in subrange 5:2 (4.125..4.1875)
-     0x0.8561d4e0ad0918p-2, -0x0.f062ff4796f4c8p-10, // x in subrange 5:3 (4.1875..4.25)
-     0x0.838795ff9bfe50p-2, -0x0.e9e6fd9ff94c58p-10, // x in subrange 5:4 (4.25..4.3125)
-     0x0.81ba0d9f980d68p-2, -0x0.e3abedb16f34d0p-10, // x in subrange 5:5 (4.3125..4.375)
-     0x0.fff17a5c9ee8b8p-3, -0x0.ddae8744554e80p-10, // x in subrange 5:6 (4.375..4.4375)
-     0x0.fc8658eb715858p-3, -0x0.d7ebb5a422c360p-10, // x in subrange 5:7 (4.4375..4.5)
-     0x0.f931d271912b60p-3, -0x0.d26093f0687518p-10, // x in subrange 5:8 (4.5..4.5625)
-     0x0.f5f30dae71bb30p-3, -0x0.cd0a69ba633a60p-10, // x in subrange 5:9 (4.5625..4.625)
-     0x0.f2c93bef98fb48p-3, -0x0.c7e6a7e8344958p-10, // x in subrange 5:10 (4.625..4.6875)
-     0x0.efb398711ace88p-3, -0x0.c2f2e5d782e590p-10, // x in subrange 5:11 (4.6875..4.75)
-     0x0.ecb167c9147b30p-3, -0x0.be2cdeb9e771a8p-10, // x in subrange 5:12 (4.75..4.8125)
-     0x0.e9c1f75d4b6bd8p-3, -0x0.b9926f260c4738p-10, // x in subrange 5:13 (4.8125..4.875)
-     0x0.e6e49ce225b990p-3, -0x0.b52192d8ee26b0p-10, // x in subrange 5:14 (4.875..4.9375)
-     0x0.e418b5e24470b0p-3, -0x0.b0d862a3165a00p-10, // x in subrange 5:15 (4.9375..5)
-     0x0.e15da74e174b50p-3, -0x0.acb5127e0d41c0p-10, // x in subrange 5:16 (5..5.0625)
-     0x0.deb2dd12cfea70p-3, -0x0.a8b5efc69e4880p-10, // x in subrange 5:17 (5.0625..5.125)
-     0x0.dc17c9b8278dc0p-3, -0x0.a4d95f98d74240p-10, // x in subrange 5:18 (5.125..5.1875)
-     0x0.d98be604760dd8p-3, -0x0.a11ddd4af61810p-10, // x in subrange 5:19 (5.1875..5.25)
-     0x0.d70eb0a6a38af8p-3, -0x0.9d81f904b929b0p-10, // x in subrange 5:20 (5.25..5.3125)
-     0x0.d49fade587fa18p-3, -0x0.9a045670c1d628p-10, // x in subrange 5:21 (5.3125..5.375)
-     0x0.d23e6754548e40p-3, -0x0.96a3ab85edd160p-10, // x in subrange 5:22 (5.375..5.4375)
-     0x0.cfea6b8bab09c8p-3, -0x0.935ebf66bbed80p-10, // x in subrange 5:23 (5.4375..5.5)
-     0x0.cda34de70e56b8p-3, -0x0.90346954fc5bd0p-10, // x in subrange 5:24 (5.5..5.5625)
-     0x0.cb68a6465e76c0p-3, -0x0.8d238fb83397a8p-10, // x in subrange 5:25 (5.5625..5.625)
-     0x0.c93a10d317f5e0p-3, -0x0.8a2b27353aa3f8p-10, // x in subrange 5:26 (5.625..5.6875)
-     0x0.c7172dc9149f60p-3, -0x0.874a31d5c75dc0p-10, // x in subrange 5:27 (5.6875..5.75)
-     0x0.c4ffa142904e08p-3, -0x0.847fbe3ea4c028p-10, // x in subrange 5:28 (5.75..5.8125)
-     0x0.c2f31307395bb8p-3, -0x0.81cae6f37d5a30p-10, // x in subrange 5:29 (5.8125..5.875)
-     0x0.c0f12e5e187ad8p-3, -0x0.fe55a34e645910p-11, // x in subrange 5:30 (5.875..5.9375)
-     0x0.bef9a1e21faf38p-3, -0x0.f93d5d2f9bd630p-11, // x in subrange 5:31 (5.9375..6)
-     0x0.bd0c1f5933b2c0p-3, -0x0.f44b6fea70d180p-11, // x in subrange 5:32 (6..6.0625)
-     0x0.bb285b8d866088p-3, -0x0.ef7e62a3bff028p-11, // x in subrange 5:33 (6.0625..6.125)
-     0x0.b94e0e291bc648p-3, -0x0.ead4ce393de7b0p-11, // x in subrange 5:34 (6.125..6.1875)
-     0x0.b77cf1935646d8p-3, -0x0.e64d5c46652b70p-11, // x in subrange 5:35 (6.1875..6.25)
-     0x0.b5b4c2d068c670p-3, -0x0.e1e6c6394bcc90p-11, // x in subrange 5:36 (6.25..6.3125)
-     0x0.b3f541629036a8p-3, -0x0.dd9fd476400858p-11, // x in subrange 5:37 (6.3125..6.375)
-     0x0.b23e2f2cf80258p-3, -0x0.d9775d8920c180p-11, // x in subrange 5:38 (6.375..6.4375)
-     0x0.b08f50582edb98p-3, -0x0.d56c45637bec38p-11, // x in subrange 5:39 (6.4375..6.5)
-     0x0.aee86b38134520p-3, -0x0.d17d7ca68ffbb0p-11, // x in subrange 5:40 (6.5..6.5625)
-     0x0.ad49483320e648p-3, -0x0.cda9fff85ecae0p-11, // x in subrange 5:41 (6.5625..6.625)
-     0x0.abb1b1ab0949f8p-3, -0x0.c9f0d763106ef0p-11, // x in subrange 5:42 (6.625..6.6875)
-     0x0.aa2173e6841e38p-3, -0x0.c65115bdf30310p-11, // x in subrange 5:43 (6.6875..6.75)
-     0x0.a8985cfc446298p-3, -0x0.c2c9d81f71e8d8p-11, // x in subrange 5:44 (6.75..6.8125)
-     0x0.a7163cbf0130e0p-3, -0x0.bf5a45576b4a50p-11, // x in subrange 5:45 (6.8125..6.875)
-     0x0.a59ae4aa81f3c0p-3, -0x0.bc018d7155fc08p-11, // x in subrange 5:46 (6.875..6.9375)
-     0x0.a42627d19eefc8p-3, -0x0.b8bee93db44480p-11, // x in subrange 5:47 (6.9375..7)
-     0x0.a2b7dacd280028p-3, -0x0.b59199e259a010p-11, // x in subrange 5:48 (7..7.0625)
-     0x0.a14fd3aba45420p-3, -0x0.b278e871126680p-11, // x in subrange 5:49 (7.0625..7.125)
-     0x0.9fede9e1ded300p-3, -0x0.af742584445448p-11, // x in subrange 5:50 (7.125..7.1875)
-     0x0.9e91f63c339860p-3, -0x0.ac82a8e12672a8p-11, // x in subrange 5:51 (7.1875..7.25)
-     0x0.9d3bd2d093b530p-3, -0x0.a9a3d11f35bdd0p-11, // x in subrange 5:52 (7.25..7.3125)
-     0x0.9beb5af1351148p-3, -0x0.a6d70354924478p-11, // x in subrange 5:53 (7.3125..7.375)
-     0x0.9aa06b1fe4ec38p-3, -0x0.a41baac6f65ab8p-11, // x in subrange 5:54 (7.375..7.4375)
-     0x0.995ae101f412d8p-3, -0x0.a17138a0fee670p-11, // x in subrange 5:55 (7.4375..7.5)
-     0x0.981a9b54b46c20p-3, -0x0.9ed723ab80cdf8p-11, // x in subrange 5:56 (7.5..7.5625)
-     0x0.96df79e2800328p-3, -0x0.9c4ce80aac3528p-11, // x in subrange 5:57 (7.5625..7.625)
-     0x0.95a95d78422e68p-3, -0x0.99d206fec27d38p-11, // x in subrange 5:58 (7.625..7.6875)
-     0x0.947827db7be698p-3, -0x0.976606a827f668p-11, // x in subrange 5:59 (7.6875..7.75)
-     0x0.934bbbc0bcc928p-3, -0x0.950871ce9ddd58p-11, // x in subrange 5:60 (7.75..7.8125)
-     0x0.9223fcc28aa758p-3, -0x0.92b8d7ab74a940p-11, // x in subrange 5:61 (7.8125..7.875)
-     0x0.9100cf58b1dd50p-3, -0x0.9076cbb689d6c0p-11, // x in subrange 5:62 (7.875..7.9375)
-     0x0.8fe218cff905d0p-3, -0x0.8e41e575e74c18p-11, // x in subrange 5:63 (7.9375..8)
-     0x0.8e3c2d77aecb48p-3, -0x0.8b0a57bb5943b0p-10, // x in subrange 6:0 (8..8.125)
-     0x0.8c185315690ad8p-3, -0x0.86eabd15ad2748p-10, // x in subrange 6:1 (8.125..8.25)
-     0x0.8a049a46eac980p-3, -0x0.82f91a32730230p-10, // x in subrange 6:2 (8.25..8.375)
-     0x0.88005077e6bfe8p-3, -0x0.fe65a39f7d01d8p-11, // x in subrange 6:3 (8.375..8.5)
-     0x0.860acd2a7e6460p-3, -0x0.f72aea9993f900p-11, // x in subrange 6:4 (8.5..8.625)
-     0x0.842371448309b8p-3, -0x0.f03d81ae8ed520p-11, // x in subrange 6:5 (8.625..8.75)
-     0x0.8249a66b469d48p-3, -0x0.e9992fe9122428p-11, // x in subrange 6:6 (8.75..8.875)
-     0x0.807cde6ca06230p-3, -0x0.e33a04b9adb7a8p-11, // x in subrange 6:7 (8.875..9)
-     0x0.fd792567dccf70p-4, -0x0.dd1c5240c9e6c8p-11, // x in subrange 6:8 (9..9.125)
-     0x0.fa108793f94738p-4, -0x0.d73ca81cb780e8p-11, // x in subrange 6:9 (9.125..9.25)
-     0x0.f6bef1bdae2ef0p-4, -0x0.d197ceae7a1590p-11, // x in subrange 6:10 (9.25..9.375)
-     0x0.f3837eb94b60d0p-4, -0x0.cc2ac2c9654990p-11, // x in subrange 6:11 (9.375..9.5)
-     0x0.f05d55058e0950p-4, -0x0.c6f2b1c2f7d388p-11, // x in subrange 6:12 (9.5..9.625)
-     0x0.ed4ba610e61d48p-4, -0x0.c1ecf5d987aba8p-11, // x in subrange 6:13 (9.625..9.75)
-     0x0.ea4dad8c81a668p-4, -0x0.bd1712e9585a40p-11, // x in subrange 6:14 (9.75..9.875)
-     0x0.e762b0cbf386b8p-4, -0x0.b86eb3689abb18p-11, // x in subrange 6:15 (9.875..10)
-     0x0.e489fe3067b788p-4, -0x0.b3f1a5a3a0fa00p-11, // x in subrange 6:16 (10..10.125)
-     0x0.e1c2ec9e706de8p-4, -0x0.af9dd933456930p-11, // x in subrange 6:17 (10.125..10.25)
-     0x0.df0cdafd8e4fa0p-4, -0x0.ab715ca82213d8p-11, // x in subrange 6:18 (10.25..10.375)
-     0x0.dc672fc0aa4b80p-4, -0x0.a76a5b65c42380p-11, // x in subrange 6:19 (10.375..10.5)
-     0x0.d9d15876c9fcc0p-4, -0x0.a3871ba9838d88p-11, // x in subrange 6:20 (10.5..10.625)
-     0x0.d74ac96357fab0p-4, -0x0.9fc5fcb916f4a8p-11, // x in subrange 6:21 (10.625..10.75)
-     0x0.d4d2fd1d684db0p-4, -0x0.9c2575355ee3a8p-11, // x in subrange 6:22 (10.75..10.875)
-     0x0.d26974356ea018p-4, -0x0.98a4118e3bf808p-11, // x in subrange 6:23 (10.875..11)
-     0x0.d00db4e0e7d300p-4, -0x0.95407294928340p-11, // x in subrange 6:24 (11..11.125)
-     0x0.cdbf4aab838608p-4, -0x0.91f94c27e4b118p-11, // x in subrange 6:25 (11.125..11.25)
-     0x0.cb7dc62d63fa68p-4, -0x0.8ecd63fd2b5bf0p-11, // x in subrange 6:26 (11.25..11.375)
-     0x0.c948bcc613a818p-4, -0x0.8bbb907cce3d48p-11, // x in subrange 6:27 (11.375..11.5)
-     0x0.c71fc85bd7f028p-4, -0x0.88c2b7b5ced760p-11, // x in subrange 6:28 (11.5..11.625)
-     0x0.c502871f0fae78p-4, -0x0.85e1ce6466f538p-11, // x in subrange 6:29 (11.625..11.75)
-     0x0.c2f09b51531588p-4, -0x0.8317d70a8482e8p-11, // x in subrange 6:30 (11.75..11.875)
-     0x0.c0e9ab10104de0p-4, -0x0.8063e118b14b18p-11, // x in subrange 6:31 (11.875..12)
-     0x0.beed602265d460p-4, -0x0.fb8a104c2c93c0p-12, // x in subrange 6:32 (12..12.125)
-     0x0.bcfb67ca009750p-4, -0x0.f674e66cd04b08p-12, // x in subrange 6:33 (12.125..12.25)
-     0x0.bb137296c86570p-4, -0x0.f186a8194aab78p-12, // x in subrange 6:34 (12.25..12.375)
-     0x0.b935343d296e08p-4, -0x0.ecbdcd134dbc18p-12, // x in subrange 6:35 (12.375..12.5)
-     0x0.b760636ecd60a0p-4, -0x0.e818e02b3510c8p-12, // x in subrange 6:36 (12.5..12.625)
-     0x0.b594b9b59a3760p-4, -0x0.e3967e2722fd90p-12, // x in subrange 6:37 (12.625..12.75)
-     0x0.b3d1f350cfe608p-4, -0x0.df3554bcc06928p-12, // x in subrange 6:38 (12.75..12.875)
-     0x0.b217cf14211318p-4, -0x0.daf4219c39e740p-12, // x in subrange 6:39 (12.875..13)
-     0x0.b0660e48a5ace0p-4, -0x0.d6d1b18b3283a0p-12, // x in subrange 6:40 (13..13.125)
-     0x0.aebc748f889fa0p-4, -0x0.d2ccdf8e7fb080p-12, // x in subrange 6:41 (13.125..13.25)
-     0x0.ad1ac7c65432c0p-4, -0x0.cee494219a5e30p-12, // x in subrange 6:42 (13.25..13.375)
-     0x0.ab80cfecc2a3d0p-4, -0x0.cb17c47ac7a450p-12, // x in subrange 6:43 (13.375..13.5)
-     0x0.a9ee570bfa7c78p-4, -0x0.c76571db0fc4c0p-12, // x in subrange 6:44 (13.5..13.625)
-     0x0.a863291f1fe060p-4, -0x0.c3cca8e92ce660p-12, // x in subrange 6:45 (13.625..13.75)
-     0x0.a6df13fd25ac00p-4, -0x0.c04c8116abdae0p-12, // x in subrange 6:46 (13.75..13.875)
-     0x0.a561e743cab8d8p-4, -0x0.bce41c0e88bd58p-12, // x in subrange 6:47 (13.875..14)
-     0x0.a3eb7443b0fa00p-4, -0x0.b992a52c9f5f70p-12, // x in subrange 6:48 (14..14.125)
-     0x0.a27b8ded7d65b8p-4, -0x0.b65750fd546b48p-12, // x in subrange 6:49 (14.125..14.25)
-     0x0.a11208bff0cd08p-4, -0x0.b3315cc4e7f9a0p-12, // x in subrange 6:50 (14.25..14.375)
-     0x0.9faebab6ead370p-4, -0x0.b0200e0ded35d8p-12, // x in subrange 6:51 (14.375..14.5)
-     0x0.9e517b3b493940p-4, -0x0.ad22b23e6c9c00p-12, // x in subrange 6:52 (14.5..14.625)
-     0x0.9cfa23139695f8p-4, -0x0.aa389e333f7dd0p-12, // x in subrange 6:53 (14.625..14.75)
-     0x0.9ba88c557c7a90p-4, -0x0.a7612de13bdc28p-12, // x in subrange 6:54 (14.75..14.875)
-     0x0.9a5c9257edbd50p-4, -0x0.a49bc3fbcf5520p-12, // x in subrange 6:55 (14.875..15)
-     0x0.991611a5fe6c40p-4, -0x0.a1e7c9a0aefa30p-12, // x in subrange 6:56 (15..15.125)
-     0x0.97d4e7f25f9198p-4, -0x0.9f44ae084864d8p-12, // x in subrange 6:57 (15.125..15.25)
-     0x0.9698f40b7595a8p-4, -0x0.9cb1e63aa65df8p-12, // x in subrange 6:58 (15.25..15.375)
-     0x0.956215d000a090p-4, -0x0.9a2eecc880f130p-12, // x in subrange 6:59 (15.375..15.5)
-     0x0.94302e244ee8d8p-4, -0x0.97bb418835dd60p-12, // x in subrange 6:60 (15.5..15.625)
-     0x0.93031ee7f15cb8p-4, -0x0.955669566b0348p-12, // x in subrange 6:61 (15.625..15.75)
-     0x0.91dacaebeb8da8p-4, -0x0.92ffedda20ca48p-12, // x in subrange 6:62 (15.75..15.875)
-     0x0.90b715e9583460p-4, -0x0.90b75d4bfe71f0p-12, // x in subrange 6:63 (15.875..16)
-};
-alignas(64) static const double ChebCoeffs1[448 * 8] = {
- 0x0.c203ef3ea45d50p-20, -0x0.8ac5a82914f488p-30, 0x0.b08888cf777988p-41, -0x0.cc3e7dab38e338p-52, 0x0.da3976dc134100p-63, -0x0.d9b66ca2fb89f0p-74, 0x0.cc82dfe7160cf0p-85, -0x0.b61267c97860a0p-96, // x in subrange 0:0 (0.125..0.126953)
- 0x0.c1344ae9135c08p-20, -0x0.8a159f033fcbb8p-30, 0x0.af8a06d168f2b8p-41, -0x0.caf84485c45518p-52, 0x0.d8bddc94789600p-63, -0x0.d81eff78e130b0p-74, 0x0.caeae79125c1d0p-85, -0x0.b491ff689c9fd0p-96, // x in subrange 0:1 (0.126953..0.128906)
- 0x0.c065ade2bf6160p-20, -0x0.89669393fb6298p-30, 0x0.ae8d1b37c6fad0p-41, -0x0.c9b442b2602410p-52, 0x0.d7450883ec8c80p-63, -0x0.d68abee0ec5fa8p-74, 0x0.c9564c63fdc300p-85, -0x0.b314ececc79b78p-96, // x in subrange 0:2 (0.128906..0.130859)
- 0x0.bf9816b046ae98p-20, -0x0.88b88446450268p-30, 0x0.ad91c340031588p-41, -0x0.c872740be14a28p-52, 0x0.d5cef5224e0bc0p-63, -0x0.d4f9a4284738a0p-74, 0x0.c7c506e718e168p-85, -0x0.b19b2893a16298p-96, // x in subrange 0:3 (0.130859..0.132812)
- 0x0.becb83d8a4f858p-20, -0x0.880b6f87d9ed58p-30, 0x0.ac97fc2cb81058p-41, -0x0.c732d475602ed0p-52, 0x0.d45b9cf327e890p-63, -0x0.d36ba8aafb7ff0p-74, 0x0.c6370fb351fc58p-85, -0x0.b024aaada61c90p-96, // x in subrange 0:4 (0.132812..0.134766)
- 0x0.bdfff3e52f4ab0p-20, -0x0.875f53c9323a80p-30, 0x0.ab9fc3459fb940p-41, -0x0.c5f55fda273878p-52, 0x0.d2eafa8596fc38p-63, -0x0.d1e0c5d3d006a8p-74, 0x0.c4ac5f72b9d9f0p-85, -0x0.aeb16b9df687c0p-96, // x in subrange 0:5 (0.134766..0.136719)
- 0x0.bd3565618ff488p-20, -0x0.86b42f7d7bbbd0p-30, 0x0.aaa915d788aaf0p-41, -0x0.c4ba122da184e0p-52, 0x0.d17d0874307798p-63, -0x0.d058f51c266898p-74, 0x0.c324eee06d69c8p-85, -0x0.ad4163da28f488p-96, // x in subrange 0:6 (0.136719..0.138672)
- 0x0.bc6bd6dbc27b08p-20, -0x0.860a011a94ee88p-30, 0x0.a9b3f1344c2eb8p-41, -0x0.c380e76b49c7a0p-52, 0x0.d011c164e87220p-63, -0x0.ced4300bd91d58p-74, 0x0.c1a0b6c86c70c0p-85, -0x0.abd48bea1abb20p-96, // x in subrange 0:7 (0.138672..0.140625)
- 0x0.bba346e40f9428p-20, -0x0.8560c71907f568p-30, 0x0.a8c052b2c433a8p-41, -0x0.c249db96994ed0p-52, 0x0.cea92008f8b3b8p-63, -0x0.cd52703919dbb0p-74, 0x0.c01fb007709d38p-85, -0x0.aa6adc67c22b20p-96, // x in subrange 0:8 (0.140625..0.142578)
- 0x0.badbb40d092910p-20, -0x0.84b87ff4059d18p-30, 0x0.a7ce37aec15ac8p-41, -0x0.c114eabaf72d20p-52, 0x0.cd431f1cc7b938p-63, -0x0.cbd3af48504e50p-74, 0x0.bea1d38ac50228p-85, -0x0.a9044dff00f370p-96, // x in subrange 0:9 (0.142578..0.144531)
- 0x0.ba151ceb865fe0p-20, -0x0.84112a29606a68p-30, 0x0.a6dd9d89011868p-41, -0x0.bfe210eba78998p-52, 0x0.cbdfb967cff2e8p-63, -0x0.ca57e6ebf91928p-74, 0x0.bd271a501df878p-85, -0x0.a7a0d96d770140p-96, // x in subrange 0:10 (0.144531..0.146484)
- 0x0.b94f80169faca8p-20, -0x0.836ac43987b258p-30, 0x0.a5ee81a723ea18p-41, -0x0.beb14a43bb13f0p-52, 0x0.ca7ee9bc873c70p-63, -0x0.c8df10e4852ec8p-74, 0x0.bbaf7d65716538p-85, -0x0.a640778255d4f8p-96, // x in subrange 0:11 (0.146484..0.148438)
- 0x0.b88adc27aae9e8p-20, -0x0.82c54ca782bbf8p-30, 0x0.a500e173a3a150p-41, -0x0.bd8292e5fe9da8p-52, 0x0.c920aaf8468db0p-63, -0x0.c76927003974a8p-74, 0x0.ba3af5e8cf6408p-85, -0x0.a4e3211e344ba0p-96, // x in subrange 0:12 (0.148438..0.150391)
- 0x0.b7c72fba377848p-20, -0x0.8220c1f8ebebd8p-30, 0x0.a414ba5dc9c250p-41, -0x0.bc55e6fcead7a0p-52, 0x0.c7c4f80331e3d8p-63, -0x0.c5f6231b0eb598p-74, 0x0.b8c97d083b5438p-85, -0x0.a388cf32e2dbc8p-96, // x in subrange 0:13 (0.150391..0.152344)
- 0x0.b704796c0a6588p-20, -0x0.817d22b5ebf938p-30, 0x0.a32a09d9a5f790p-41, -0x0.bb2b42ba943368p-52, 0x0.c66bcbd0206288p-63, -0x0.c485ff1e91e220p-74, 0x0.b75b0c01854800p-85, -0x0.a2317ac3404468p-96, // x in subrange 0:14 (0.152344..0.154297)
- 0x0.b642b7dd1a9a88p-20, -0x0.80da6d69352c78p-30, 0x0.a240cd600498e0p-41, -0x0.ba02a2589ae830p-52, 0x0.c515215c84ac08p-63, -0x0.c318b501c49d20p-74, 0x0.b5ef9c2223d4c8p-85, -0x0.a0dd1ce30eacf0p-96, // x in subrange 0:15 (0.154297..0.15625)
- 0x0.b581e9af8d1088p-20, -0x0.8038a09ffea748p-30, 0x0.a159026e6546b8p-41, -0x0.b8dc02181b1b58p-52, 0x0.c3c0f3b0557060p-63, -0x0.c1ae3ec8fe14c8p-74, 0x0.b48726c70e4330p-85, -0x0.9f8baeb6c934f8p-96, // x in subrange 0:16 (0.15625..0.158203)
- 0x0.b4c20d87b10d60p-20, -0x0.ff2f75d3ff6bc0p-31, 0x0.a072a686f19928p-41, -0x0.b7b75e419d2bb0p-52, 0x0.c26f3dddf632b8p-63, -0x0.c0469685cc26b0p-74, 0x0.b321a55c971e50p-85, -0x0.9e3d297379f280p-96, // x in subrange 0:17 (0.158203..0.160156)
- 0x0.b403220bfc66b8p-20, -0x0.fdef75b2d653a8p-31, 0x0.9f8db73073e238p-41, -0x0.b694b325061f90p-52, 0x0.c11ffb02204468p-63, -0x0.bee1b656d4ce70p-74, 0x0.b1bf115e4720e0p-85, -0x0.9cf1865e905db8p-96, // x in subrange 0:18 (0.160156..0.162109)
- 0x0.b34525e507cc40p-20, -0x0.fcb13e05d57b98p-31, 0x0.9eaa31f64e03d0p-41, -0x0.b573fd19883528p-52, 0x0.bfd32643cbf550p-63, -0x0.bd7f9867b7de00p-74, 0x0.b05f6456b87f78p-85, -0x0.9ba8becdb828e0p-96, // x in subrange 0:19 (0.162109..0.164062)
- 0x0.b28817bd8b18c0p-20, -0x0.fb74cbfb350530p-31, 0x0.9dc814687058b8p-41, -0x0.b455387d939538p-52, 0x0.be88bad419f8e0p-63, -0x0.bc2036f0f0ff50p-74, 0x0.af0297df728f00p-85, -0x0.9a62cc26b08390p-96, // x in subrange 0:20 (0.164062..0.166016)
- 0x0.b1cbf64259aa00p-20, -0x0.fa3a1cc608aa60p-31, 0x0.9ce75c1b50b0c0p-41, -0x0.b33861b6c72718p-52, 0x0.bd40b3ee3cff90p-63, -0x0.bac38c37b9fdf8p-74, 0x0.ada8a5a0c5c630p-85, -0x0.991fa7df23c7a8p-96, // x in subrange 0:21 (0.166016..0.167969)
- 0x0.b110c0225ebf60p-20, -0x0.f9012d9e36bb80p-31, 0x0.9c0806a7e15fc8p-41, -0x0.b21d7531e18678p-52, 0x0.bbfb0cd76383a0p-63, -0x0.b969928ded58a8p-74, 0x0.ac518751a81990p-85, -0x0.97df4b7c7f8f90p-96, // x in subrange 0:22 (0.167969..0.169922)
- 0x0.b056740e99df70p-20, -0x0.f7c9fbc06f2f20p-31, 0x0.9b2a11ab885f48p-41, -0x0.b1046f62b21a48p-52, 0x0.bab7c0dea1c9d0p-63, -0x0.b8124451e91998p-74, 0x0.aafd36b791b088p-85, -0x0.96a1b093cd33b0p-96, // x in subrange 0:23 (0.169922..0.171875)
- 0x0.af9d10ba1b43e0p-20, -0x0.f694846e22c388p-31, 0x0.9a4d7ac81682b8p-41, -0x0.afed4cc40a4c58p-52, 0x0.b976cb5cdc1420p-63, -0x0.b6bd9bee71f520p-74, 0x0.a9abada659f318p-85, -0x0.9566d0c98aaf40p-96, // x in subrange 0:24 (0.171875..0.173828)
- 0x0.aee494da004c50p-20, -0x0.f560c4ed7a31c8p-31, 0x0.99723fa3bebe38p-41, -0x0.aed809d7aee1a0p-52, 0x0.b83827b4b10770p-63, -0x0.b56b93da96add0p-74, 0x0.a85ce60014ef10p-85, -0x0.942ea5d183ea30p-96, // x in subrange 0:25 (0.173828..0.175781)
- 0x0.ae2cff256ff790p-20, -0x0.f42eba894d7218p-31, 0x0.98985de90d7f58p-41, -0x0.adc4a3264972a8p-52, 0x0.b6fbd1526442c0p-63, -0x0.b41c269993bd98p-74, 0x0.a710d9b4f113d0p-85, -0x0.92f9296eac67e0p-96, // x in subrange 0:26 (0.175781..0.177734)
- 0x0.ad764e55976368p-20, -0x0.f2fe62911b1198p-31, 0x0.97bfd346e01838p-41, -0x0.acb3153f5a0438p-52, 0x0.b5c1c3abc92798p-63, -0x0.b2cf4ebab742e8p-74, 0x0.a5c782c3154400p-85, -0x0.91c65572f95958p-96, // x in subrange 0:27 (0.177734..0.179688)
- 0x0.acc08125a65300p-20, -0x0.f1cfba58ff98e0p-31, 0x0.96e89d705c3c50p-41, -0x0.aba35cb928bf30p-52, 0x0.b489fa402dd3b8p-63, -0x0.b18506d9453180p-74, 0x0.a480db367f3c18p-85, -0x0.909623bf3c11c0p-96, // x in subrange 0:28 (0.179688..0.181641)
- 0x0.ac0b9652cbbb80p-20, -0x0.f0a2bf39ad03d8p-31, 0x0.9612ba1ce78f48p-41, -0x0.aa957630b7c858p-52, 0x0.b3547098464af8p-63, -0x0.b03d499c5bc600p-74, 0x0.a33cdd28e24ce0p-85, -0x0.8f688e42fcdc80p-96, // x in subrange 0:29 (0.181641..0.183594)
- 0x0.ab578c9c325728p-20, -0x0.ef776e90624a30p-31, 0x0.953e27081f4510p-41, -0x0.a9895e49b536f0p-52, 0x0.b221224617d128p-63, -0x0.aef811b6d83be0p-74, 0x0.a1fb82c1866948p-85, -0x0.8e3d8efc5633a0p-96, // x in subrange 0:30 (0.183594..0.185547)
- 0x0.aaa462c2fd3ec8p-20, -0x0.ee4dc5bee2f880p-31, 0x0.946ae1f1cfd3d8p-41, -0x0.a87f11ae6d2a30p-52, 0x0.b0f00ae4e47390p-63, -0x0.adb559e73bc4c0p-74, 0x0.a0bcc635278680p-85, -0x0.8d151ff7d055a8p-96, // x in subrange 0:31 (0.185547..0.1875)
- 0x0.a9f2178a448968p-20, -0x0.ed25c22b6eda18p-31, 0x0.9398e89decb718p-41, -0x0.a7768d0fbbfd40p-52, 0x0.afc1261916c178p-63, -0x0.ac751cf790c0c0p-74, 0x0.9f80a1c5d54da8p-85, -0x0.8bef3b503d39b0p-96, // x in subrange 0:32 (0.1875..0.189453)
- 0x0.a940a9b711f230p-20, -0x0.ebff6140b9b320p-31, 0x0.92c838d48843c0p-41, -0x0.a66fcd250099c8p-52, 0x0.ae946f902db358p-63, -0x0.ab3755bd503738p-74, 0x0.9e470fc2d31e10p-85, -0x0.8acbdb2e94e118p-96, // x in subrange 0:33 (0.189453..0.191406)
- 0x0.a89018105d8498p-20, -0x0.eadaa06de30af0p-31, 0x0.91f8d061cb8da8p-41, -0x0.a56aceac0ee7f8p-52, 0x0.ad69e300a8c020p-63, -0x0.a9fbff19478ef8p-74, 0x0.9d100a88785f80p-85, -0x0.89aaf9c9d20568p-96, // x in subrange 0:34 (0.191406..0.193359)
- 0x0.a7e0615f0a4e80p-20, -0x0.e9b77d266e06c8p-31, 0x0.912aad15ee5d98p-41, -0x0.a4678e69225ce0p-52, 0x0.ac417c29f420a0p-63, -0x0.a8c313f77e85a8p-74, 0x0.9bdb8c80112380p-85, -0x0.888c9166cf21f0p-96, // x in subrange 0:35 (0.193359..0.195312)
- 0x0.a731846de318b0p-20, -0x0.e895f4e2395430p-31, 0x0.905dccc52f3850p-41, -0x0.a3660926d0a5e8p-52, 0x0.ab1b36d4553fb8p-63, -0x0.a78c8f4f1d6590p-74, 0x0.9aa9901fbf14d8p-85, -0x0.87709c5823d798p-96, // x in subrange 0:36 (0.195312..0.197266)
- 0x0.a6838009972510p-20, -0x0.e776051d772388p-31, 0x0.8f922d47cb75e8p-41, -0x0.a2663bb5fc7188p-52, 0x0.a9f70ed0d75808p-63, -0x0.a6586c22537950p-74, 0x0.997a0fea5ab498p-85, -0x0.865714fe02aa70p-96, // x in subrange 0:37 (0.197266..0.199219)
- 0x0.a5d65300b6f308p-20, -0x0.e657ab58a53240p-31, 0x0.8ec7cc79f769e0p-41, -0x0.a16822edc85510p-52, 0x0.a8d4fff9383dd0p-63, -0x0.a526a57e3dbc80p-74, 0x0.984d066f54e3f0p-85, -0x0.853ff5c61717d8p-96, // x in subrange 0:38 (0.199219..0.201172)
- 0x0.a529fc23b109e0p-20, -0x0.e53ae51884e498p-31, 0x0.8dfea83bd69b48p-41, -0x0.a06bbbab89cef8p-52, 0x0.a7b5062fd554c8p-63, -0x0.a3f7367acdc968p-74, 0x0.97226e4a98b990p-85, -0x0.842b392b640428p-96, // x in subrange 0:39 (0.201172..0.203125)
- 0x0.a47e7a44cec8f0p-20, -0x0.e41fafe6136f08p-31, 0x0.8d36be71740d40p-41, -0x0.9f7102d2bc65e0p-52, 0x0.a6971d5f98b218p-63, -0x0.a2ca1a3ab10248p-74, 0x0.95fa42246da2c8p-85, -0x0.8318d9b6227f80p-96, // x in subrange 0:40 (0.203125..0.205078)
- 0x0.a3d3cc38313da0p-20, -0x0.e306094e820ee0p-31, 0x0.8c700d02ba9758p-41, -0x0.9e77f54cf4e358p-52, 0x0.a57b417be66900p-63, -0x0.a19f4beb37f688p-74, 0x0.94d47cb159ce68p-85, -0x0.8208d1fba0dff0p-96, // x in subrange 0:41 (0.205078..0.207031)
- 0x0.a329f0d3cdff48p-20, -0x0.e1edeee32e5240p-31, 0x0.8baa91db6d4df8p-41, -0x0.9d809009d4ab08p-52, 0x0.a4616e808a02e0p-63, -0x0.a076c6c43e0250p-74, 0x0.93b118b204e1d0p-85, -0x0.80fb1c9e223120p-96, // x in subrange 0:42 (0.207031..0.208984)
- 0x0.a280e6ef6c10f0p-20, -0x0.e0d75e399a6f38p-31, 0x0.8ae64aeb1ffa88p-41, -0x0.9c8acffefd2d18p-52, 0x0.a349a071a42150p-63, -0x0.9f5086081128d8p-74, 0x0.929010f31af690p-85, -0x0.ffdf68997bef48p-97, // x in subrange 0:43 (0.208984..0.210938)
- 0x0.a1d8ad64a0c890p-20, -0x0.dfc254eb65a9b8p-31, 0x0.8a2336252fa2f8p-41, -0x0.9b96b228037458p-52, 0x0.a233d35b984a98p-63, -0x0.9e2c85035a2838p-74, 0x0.9171604d2fe048p-85, -0x0.fdcd2786808f48p-97, // x in subrange 0:44 (0.210938..0.212891)
- 0x0.a131430eccbc20p-20, -0x0.deaed09644c8a8p-31, 0x0.89615180bb2128p-41, -0x0.9aa4338663cf70p-52, 0x0.a1200352fadf90p-63, -0x0.9d0abf0d04c678p-74, 0x0.905501a4a2ba10p-85, -0x0.fbbf6b94145c08p-97, // x in subrange 0:45 (0.212891..0.214844)
- 0x0.a08aa6cb18b450p-20, -0x0.dd9ccedbfa9978p-31, 0x0.88a09af89bc980p-41, -0x0.99b35121759500p-52, 0x0.a00e2c747f3af0p-63, -0x0.9beb2f86285720p-74, 0x0.8f3aefe981ba78p-85, -0x0.f9b62a6be4d598p-97, // x in subrange 0:46 (0.214844..0.216797)
- 0x0.9fe4d77872a4b8p-20, -0x0.dc8c4d625082a0p-31, 0x0.87e1108b5e2080p-41, -0x0.98c408065f0270p-52, 0x0.9efe4ae4e5f988p-63, -0x0.9acdd1d9f07918p-74, 0x0.8e2326176e4da0p-85, -0x0.f7b159d04cf878p-97, // x in subrange 0:47 (0.216797..0.21875)
- 0x0.9f3fd3f78aa9d0p-20, -0x0.db7d49d30f2440p-31, 0x0.8722b03b3a9ff8p-41, -0x0.97d65548093548p-52, 0x0.9df05ad0eb6ad8p-63, -0x0.99b2a17d860bd8p-74, 0x0.8d0d9f35817488p-85, -0x0.f5b0ef9c17f390p-97, // x in subrange 0:48 (0.21875..0.220703)
- 0x0.9e9b9b2ad00c20p-20, -0x0.da6fc1dbf707c0p-31, 0x0.8665780e0e8aa0p-41, -0x0.96ea35ff143ed0p-52, 0x0.9ce4586d3629e8p-63, -0x0.989999eff85ba8p-74, 0x0.8bfa5656306928p-85, -0x0.f3b4e1c2447be8p-97, // x in subrange 0:49 (0.220703..0.222656)
- 0x0.9df82bf66e4900p-20, -0x0.d963b32eb95cf0p-31, 0x0.85a9660d54cf00p-41, -0x0.95ffa749cb5150p-52, 0x0.9bda3ff645ddd8p-63, -0x0.9782b6ba268450p-74, 0x0.8ae94697318610p-85, -0x0.f1bd264dc8bc68p-97, // x in subrange 0:50 (0.222656..0.224609)
- 0x0.9d5585404a2118p-20, -0x0.d8591b80f0c628p-31, 0x0.84ee78461ef8b8p-41, -0x0.9516a64c1907a8p-52, 0x0.9ad20db06221f0p-63, -0x0.966df36ea909c8p-74, 0x0.89da6b216171d0p-85, -0x0.efc9b36156e0c0p-97, // x in subrange 0:51 (0.224609..0.226562)
- 0x0.9cb3a5effeab90p-20, -0x0.d74ff88c1a31c8p-31, 0x0.8434acc90e30a8p-41, -0x0.942f302f7bc5c8p-52, 0x0.99cbbde7899478p-63, -0x0.955b4ba9bba620p-74, 0x0.88cdbf28a88c68p-85, -0x0.edda7f372238d8p-97, // x in subrange 0:52 (0.226562..0.228516)
- 0x0.9c128ceeda6f68p-20, -0x0.d648480d8dc218p-31, 0x0.837c01aa4c4b48p-41, -0x0.93494222fa3310p-52, 0x0.98c74cef610c78p-63, -0x0.944abb11274c88p-74, 0x0.87c33debe09ee8p-85, -0x0.ebef8020a4f418p-97, // x in subrange 0:53 (0.228516..0.230469)
- 0x0.9b723927dc8170p-20, -0x0.d54207c677c2c0p-31, 0x0.82c4750184e588p-41, -0x0.9264d95b17cd50p-52, 0x0.97c4b72322f590p-63, -0x0.933c3d542c6080p-74, 0x0.86bae2b4bacc40p-85, -0x0.ea08ac86667218p-97, // x in subrange 0:54 (0.230469..0.232422)
- 0x0.9ad2a987b1a7d8p-20, -0x0.d43d357bd1ac20p-31, 0x0.820e04e9de8fe8p-41, -0x0.9181f311c994d0p-52, 0x0.96c3f8e58ed210p-63, -0x0.922fce2b6d2118p-74, 0x0.85b4a8d7a5c288p-85, -0x0.e825fae7c22810p-97, // x in subrange 0:55 (0.232422..0.234375)
- 0x0.9a33dcfcb18308p-20, -0x0.d339cef65b3420p-31, 0x0.8158af81f40780p-41, -0x0.90a08c866ad118p-52, 0x0.95c50ea0d8e230p-63, -0x0.91256958d84768p-74, 0x0.84b08bb3b42c40p-85, -0x0.e64761daaf18d8p-97, // x in subrange 0:56 (0.234375..0.236328)
- 0x0.9995d276dbbb50p-20, -0x0.d237d202936cb0p-31, 0x0.80a472ebcd7d48p-41, -0x0.8fc0a2fdb1edc0p-52, 0x0.94c7f4c699f110p-63, -0x0.901d0aa793d7e0p-74, 0x0.83ae86b28360e0p-85, -0x0.e46cd80b87de10p-97, // x in subrange 0:57 (0.236328..0.238281)
- 0x0.98f888e7d53430p-20, -0x0.d1373c70b1ef68p-31, 0x0.ffe29a99b3d5d8p-42, -0x0.8ee233c1a56ff0p-52, 0x0.93cca7cfbf4628p-63, -0x0.8f16adebe82628p-74, 0x0.82ae9548225408p-85, -0x0.e296543cd34120p-97, // x in subrange 0:58 (0.238281..0.240234)
- 0x0.985bff42e54450p-20, -0x0.d0380c14a016a8p-31, 0x0.fe7e799bd0eb30p-42, -0x0.8e053c21910370p-52, 0x0.92d3243c7abb78p-63, -0x0.8e124f032b0ab8p-74, 0x0.81b0b2f2f8c2a0p-85, -0x0.e0c3cd470d6280p-97, // x in subrange 0:59 (0.240234..0.242188)
- 0x0.97c0347cf2f2d0p-20, -0x0.cf3a3ec5f243e8p-31, 0x0.fd1c7f3643bca0p-42, -0x0.8d29b971fa9fa8p-52, 0x0.91db669432f810p-63, -0x0.8d0fe9d3ab49e8p-74, 0x0.80b4db3bae9d88p-85, -0x0.def53a18716da0p-97, // x in subrange 0:60 (0.242188..0.244141)
- 0x0.9725278c823978p-20, -0x0.ce3dd25fe132d0p-31, 0x0.fbbca7c803ffb8p-42, -0x0.8c4fa90c97c448p-52, 0x0.90e56b6573ce38p-63, -0x0.8c0f7a4c9c2bd8p-74, 0x0.ff76136a2761d8p-86, -0x0.dd2a91b4c3d828p-97, // x in subrange 0:61 (0.244141..0.246094)
- 0x0.968ad769b14be0p-20, -0x0.cd42c4c14359b8p-31, 0x0.fa5eefb6a2b3d8p-42, -0x0.8b77085042cd00p-52, 0x0.8ff12f45debd40p-63, -0x0.8b10fc66014518p-74, 0x0.fd8673f80f0f58p-86, -0x0.db63cb351d2b30p-97, // x in subrange 0:62 (0.246094..0.248047)
- 0x0.95f1430e35e3d0p-20, -0x0.cc4913cc865698p-31, 0x0.f903536e3d5398p-42, -0x0.8a9fd4a0f05ca8p-52, 0x0.8efeaed21b9698p-63, -0x0.8a146c209a6ed0p-74, 0x0.fb9acf6ec31558p-86, -0x0.d9a0ddc7b554b8p-97, // x in subrange 0:63 (0.248047..0.25)
- 0x0.950c4260de49e0p-18, -0x0.cad51384048238p-28, 0x0.f6fdd556f970f0p-38, -0x0.895fade972de30p-47, 0x0.8d9626ae6f11b0p-57, -0x0.889d289dae6ac8p-67, 0x0.f8c0d31bcc4e20p-78, -0x0.d703af9e87ee18p-88, // x in subrange 1:0 (0.25..0.253906)
- 0x0.93dd73e9f1d970p-18, -0x0.c8e9c3f6215a80p-28, 0x0.f45318306a2a38p-38, -0x0.87b9b54b2637b0p-47, 0x0.8bbb62de7457b0p-57, -0x0.86af699836f428p-67, 0x0.f501022fd48868p-78, -0x0.d394808ac7fa00p-88, // x in subrange 1:1 (0.253906..0.257812)
- 0x0.92b1826e59f9c8p-18, -0x0.c703c1adeda358p-28, 0x0.f1b08b0d05b8a8p-38, -0x0.861942e5308418p-47, 0x0.89e7521da78338p-57, -0x0.84c91ad5869870p-67, 0x0.f15084393b7428p-78, -0x0.d0341b1562c8c8p-88, // x in subrange 1:2 (0.257812..0.261719)
- 0x0.91886606686578p-18, -0x0.c522fc66e0c1e0p-28, 0x0.ef16127fb087d8p-38, -0x0.847e42c53c2ff8p-47, 0x0.8819da9873e3a8p-57, -0x0.82ea1df1ddec28p-67, 0x0.edaf1743516b00p-78, -0x0.cce23c83b6cc18p-88, // x in subrange 1:3 (0.261719..0.265625)
- 0x0.906216e2acb200p-18, -0x0.c3476412e91760p-28, 0x0.ec83937e4a0548p-38, -0x0.82e8a145cfc020p-47, 0x0.8652e2e4bc6ae8p-57, -0x0.8112550c3c5f88p-67, 0x0.ea1c7a82e92cc0p-78, -0x0.c99ea355720ff0p-88, // x in subrange 1:4 (0.265625..0.269531)
- 0x0.8f3e8d4ba33108p-18, -0x0.c170e8d9a78978p-28, 0x0.e9f8f3602f6640p-38, -0x0.81584b0d141510p-47, 0x0.84925200161c18p-57, -0x0.fe834588256e58p-68, 0x0.e6986e50df0e20p-78, -0x0.c6690f3e8e1190p-88, // x in subrange 1:5 (0.269531..0.273438)
- 0x0.8e1dc1a164f618p-18, -0x0.bf9f7b17adfeb0p-28, 0x0.e77617dcc48190p-38, -0x0.ff9a5a173fe628p-48, 0x0.82d80f4e0a76d0p-57, -0x0.faefd46e00b7f0p-68, 0x0.e322b424baf4c8p-78, -0x0.c34141216a2aa8p-88, // x in subrange 1:6 (0.273438..0.277344)
- 0x0.8cffac5b58fc78p-18, -0x0.bdd30b5dc0c368p-28, 0x0.e4fae70a02a258p-38, -0x0.fc8e68f6916ec8p-48, 0x0.8124029661b918p-57, -0x0.f76a1dfd369888p-68, 0x0.dfbb0e8f6c9920p-78, -0x0.c026fb0903f048p-88, // x in subrange 1:7 (0.277344..0.28125)
- 0x0.8be44607e668a8p-18, -0x0.bc0b8a701acb38p-28, 0x0.e287475b0d3ac8p-38, -0x0.f98c9dbbf045d0p-48, 0x0.feec2806e9a648p-58, -0x0.f3f1ea5c84f5e8p-68, 0x0.dc614136218820p-78, -0x0.bd1a00234ce820p-88, // x in subrange 1:8 (0.28125..0.285156)
- 0x0.8acb874c27e190p-18, -0x0.ba48e945b4c308p-28, 0x0.e01b1f9ecc5d20p-38, -0x0.f694d3f90e4770p-48, 0x0.fb9c58410dd1e8p-58, -0x0.f08702a1f4d230p-68, 0x0.d91510cd346290p-78, -0x0.ba1a14bb9cfa20p-88, // x in subrange 1:9 (0.285156..0.289062)
- 0x0.89b568e39ffcc0p-18, -0x0.b88b19078ee8b0p-28, 0x0.ddb656fe8ce2c8p-38, -0x0.f3a6e7cb3b0de8p-48, 0x0.f85867b04c7c40p-58, -0x0.ed2930cea79058p-68, 0x0.d5d6431334d9c8p-78, -0x0.b726fe35410718p-88, // x in subrange 1:10 (0.289062..0.292969)
- 0x0.88a1e39feeba18p-18, -0x0.b6d20b0ffd9c98p-28, 0x0.db58d4fca62878p-38, -0x0.f0c2b5d92cf9d0p-48, 0x0.f52028e528d270p-58, -0x0.e9d83fcab7e850p-68, 0x0.d2a49ecc07ec70p-78, -0x0.b4408306251180p-88, // x in subrange 1:11 (0.292969..0.296875)
- 0x0.8790f068880a60p-18, -0x0.b51db0e9f8a250p-28, 0x0.d9028173254840p-38, -0x0.ede81b50d3b3a8p-48, 0x0.f1f36f286b5910p-58, -0x0.e693fb612e2a58p-68, 0x0.cf7febbc1fe8c8p-78, -0x0.b1666ab1996730p-88, // x in subrange 1:12 (0.296875..0.300781)
- 0x0.8682883a6b5d40p-18, -0x0.b36dfc506d0570p-28, 0x0.d6b344927db960p-38, -0x0.eb16f5e533fc30p-48, 0x0.eed20e780ea540p-58, -0x0.e35c303c077370p-68, 0x0.cc67f2a3cbbba8p-78, -0x0.ae987dc3323f38p-88, // x in subrange 1:13 (0.300781..0.304688)
- 0x0.8576a427dc3228p-18, -0x0.b1c2df2d9197a8p-28, 0x0.d46b06e03f3f50p-38, -0x0.e84f23cc4ca1f0p-48, 0x0.ebbbdb8439dc60p-58, -0x0.e030abe04f76e8p-68, 0x0.c95c7d3a9d1728p-78, -0x0.abd685c9c14090p-88, // x in subrange 1:14 (0.304688..0.308594)
- 0x0.846d3d581ba8b8p-18, -0x0.b01c4b9a3dfe18p-28, 0x0.d229b135d11110p-38, -0x0.e59083bd0472b8p-48, 0x0.e8b0abac48b8f8p-58, -0x0.dd113caa4c8220p-68, 0x0.c65d562ae4fca0p-78, -0x0.a9204d52686b38p-88, // x in subrange 1:15 (0.308594..0.3125)
- 0x0.83664d07230cb0p-18, -0x0.ae7a33dd4442c0p-28, 0x0.cfef2cbf322260p-38, -0x0.e2daf4ed210158p-48, 0x0.e5b054fbe0d6b0p-58, -0x0.d9fdb1c9bd6268p-68, 0x0.c36a490d4639f0p-78, -0x0.a6759fe3c5ddc8p-88, // x in subrange 1:16 (0.3125..0.316406)
- 0x0.8261cc855f5988p-18, -0x0.acdc8a6acce0b0p-28, 0x0.cdbb62f9be7980p-38, -0x0.e02e570f4617c0p-48, 0x0.e2baae28140678p-58, -0x0.d6f5db3e28d578p-68, 0x0.c08322645d6a48p-78, -0x0.a3d649f937f6d0p-88, // x in subrange 1:17 (0.316406..0.320312)
- 0x0.815fb5376db240p-18, -0x0.ab4341e3b54048p-28, 0x0.cb8e3db2f97b50p-38, -0x0.dd8a8a50fdaea8p-48, 0x0.dfcf8e8c8f6eb0p-58, -0x0.d3f989d33e2f98p-68, 0x0.bda7af987e0f08p-78, -0x0.a14218fe3951f8p-88, // x in subrange 1:18 (0.320312..0.324219)
- 0x0.80600095d8c9c0p-18, -0x0.a9ae4d14f09a38p-28, 0x0.c967a7075d1938p-38, -0x0.daef6f58c84558p-48, 0x0.dceece28d73b20p-58, -0x0.d1088f1d46e400p-68, 0x0.bad7bef3845570p-78, -0x0.9eb8db49d424c8p-88, // x in subrange 1:19 (0.324219..0.328125)
- 0x0.fec55059ae6f78p-19, -0x0.a81d9ef6eb3720p-28, 0x0.c74789612dcbc8p-38, -0x0.d85ce744357398p-48, 0x0.da18459d8ea2f0p-58, -0x0.ce22bd75a89d40p-68, 0x0.b8131f9cbb21d0p-78, -0x0.9c3a601a2c8168p-88, // x in subrange 1:20 (0.328125..0.332031)
- 0x0.fccf4b38156ec8p-19, -0x0.a6912aacf002b0p-28, 0x0.c52dcf775345e0p-38, -0x0.d5d2d3a6049138p-48, 0x0.d74bce29cc0a28p-58, -0x0.cb47e7f77795f8p-68, 0x0.b559a194d5f9b8p-78, -0x0.99c677902107a8p-88, // x in subrange 1:21 (0.332031..0.335938)
- 0x0.fadde52c809788p-19, -0x0.a508e384906880p-28, 0x0.c31a644c35cc40p-38, -0x0.d35116844d4f98p-48, 0x0.d48941a8790790p-58, -0x0.c877e27c18e240p-68, 0x0.b2ab15b1fe6988p-78, -0x0.975cf2ab018fc0p-88, // x in subrange 1:22 (0.335938..0.339844)
- 0x0.f8f111c2628d80p-19, -0x0.a384bcf50e71e0p-28, 0x0.c10d332ca01d98p-38, -0x0.d0d79256b02148p-48, 0x0.d1d07a8dbe16d0p-58, -0x0.c5b28197f45da8p-68, 0x0.b0074d9bf48358p-78, -0x0.94fda3445b5cb8p-88, // x in subrange 1:23 (0.339844..0.34375)
- 0x0.f708c4aa8a5e38p-19, -0x0.a204aa9ec91b28p-28, 0x0.bf0627aea5d858p-38, -0x0.ce662a048e4da0p-48, 0x0.cf2153e479c0d8p-58, -0x0.c2f79a9735f160p-68, 0x0.ad6e1bc8421770p-78, -0x0.92a85c0bda65d0p-88, // x in subrange 1:24 (0.34375..0.347656)
- 0x0.f524f1baa90500p-19, -0x0.a088a04aaad800p-28, 0x0.bd052db08e4a78p-38, -0x0.cbfcc0e3498d98p-48, 0x0.cc7ba94bc30580p-58, -0x0.c047037a9de8a8p-68, 0x0.aadf5376804828p-78, -0x0.905cf0833f4a40p-88, // x in subrange 1:25 (0.347656..0.351562)
- 0x0.f3458cecd8a000p-19, -0x0.9f1091e99a3d78p-28, 0x0.bb0a3157c39940p-38, -0x0.c99b3ab48b1100p-48, 0x0.c9df56f476d210p-58, -0x0.bda092f4600ae8p-68, 0x0.a85ac8acaf1d88p-78, -0x0.8e1b34fa698338p-88, // x in subrange 1:26 (0.351562..0.355469)
- 0x0.f16a8a5f255040p-19, -0x0.9d9c7393ecc998p-28, 0x0.b9151f0fc62e30p-38, -0x0.c7417ba491caf0p-48, 0x0.c74c399ed05158p-58, -0x0.bb042065113400p-68, 0x0.a5e050339ebe08p-78, -0x0.8be2fe8b756bc0p-88, // x in subrange 1:27 (0.355469..0.359375)
- 0x0.ef93de5317be20p-19, -0x0.9c2c3988dbc010p-28, 0x0.b725e389245738p-38, -0x0.c4ef684887e548p-48, 0x0.c4c22e980be380p-58, -0x0.b87183d8a32500p-68, 0x0.a36fbf9369f478p-78, -0x0.89b42316edb6e8p-88, // x in subrange 1:28 (0.359375..0.363281)
- 0x0.edc17d2d413c28p-19, -0x0.9abfd82dfb1340p-28, 0x0.b53c6bb87608a8p-38, -0x0.c2a4e59cdf3b70p-48, 0x0.c24113b8148bb8p-58, -0x0.b5e896036e48c0p-68, 0x0.a108ed1001ac30p-78, -0x0.878e79400ff080p-88, // x in subrange 1:29 (0.363281..0.367188)
- 0x0.ebf35b74c98218p-19, -0x0.9957440eb251b8p-28, 0x0.b358a4d55caef0p-38, -0x0.c061d903b4bd78p-48, 0x0.bfc8c75f3ba3c8p-58, -0x0.b369303f492910p-68, 0x0.9eabafa5c90f00p-78, -0x0.8571d86923a4e8p-88, // x in subrange 1:30 (0.367188..0.371094)
- 0x0.ea296dd2fdfa38p-19, -0x0.97f271dbb79048p-28, 0x0.b17a7c5986ffe8p-38, -0x0.be2628433a9ce8p-48, 0x0.bd592873faa610p-58, -0x0.b0f32c88ad52e8p-68, 0x0.9c57df0641f1a8p-78, -0x0.835e18afe3cff8p-88, // x in subrange 1:31 (0.371094..0.375)
- 0x0.e863a912e29ae8p-19, -0x0.9691566a8c4840p-28, 0x0.afa1dfffb8b9b0p-38, -0x0.bbf1b984292530p-48, 0x0.baf21660bedf18p-58, -0x0.ae86657be96870p-68, 0x0.9a0d5394c93d58p-78, -0x0.815312e9fa3450p-88, // x in subrange 1:32 (0.375..0.378906)
- 0x0.e6a20220c446d0p-19, -0x0.9533e6b4fc2250p-28, 0x0.adcebdc2d63fc0p-38, -0x0.b9c473503622b0p-48, 0x0.b8937111bed948p-58, -0x0.ac22b652602260p-68, 0x0.97cbe6636306b0p-78, -0x0.fea14143187d50p-89, // x in subrange 1:33 (0.378906..0.382812)
- 0x0.e4e46e09ccadb0p-19, -0x0.93da17d89da6a0p-28, 0x0.ac0103dcf40518p-38, -0x0.b79e3c9092baa0p-48, 0x0.b63d18f2d955d0p-58, -0x0.a9c7fadfd401e0p-68, 0x0.9593712f9603b0p-78, -0x0.faad3823b23478p-89, // x in subrange 1:34 (0.382812..0.386719)
- 0x0.e32ae1fb97a868p-19, -0x0.9283df1654c9f8p-28, 0x0.aa38a0c669b3e8p-38, -0x0.b57efc8c6f9870p-48, 0x0.b3eeeeed7da6b8p-58, -0x0.a7760f8fbf7648p-68, 0x0.9363ce5f5614b0p-78, -0x0.f6c9c047d13c00p-89, // x in subrange 1:35 (0.386719..0.390625)
- 0x0.e1755343ca0aa0p-19, -0x0.913131d1d75150p-28, 0x0.a8758334e90338p-38, -0x0.b3669ae78753e0p-48, 0x0.b1a8d4669d3f00p-58, -0x0.a52cd162b93b48p-68, 0x0.913cd8fdfd9460p-78, -0x0.f2f690d69576d0p-89, // x in subrange 1:36 (0.390625..0.394531)
- 0x0.dfc3b74fa9e468p-19, -0x0.8fe20591330398p-28, 0x0.a6b79a1a982a78p-38, -0x0.b154ffa0aef510p-48, 0x0.af6aab3ca64e78p-58, -0x0.a2ec1debe4b488p-68, 0x0.8f1e6cb9552660p-78, -0x0.ef336245ce33e8p-89, // x in subrange 1:37 (0.394531..0.398438)
- 0x0.de1603abb82eb8p-19, -0x0.8e964ffc55a388p-28, 0x0.a4fed4a52fe4c0p-38, -0x0.af4a13106c7b30p-48, 0x0.ad3455c5873f98p-58, -0x0.a0b3d34e6e0da8p-68, 0x0.8d0865dea9bb48p-78, -0x0.eb7fee53b917f8p-89, // x in subrange 1:38 (0.398438..0.402344)
- 0x0.dc6c2e034bdd68p-19, -0x0.8d4e06dc96a988p-28, 0x0.a34b223d1cf3d8p-38, -0x0.ad45bde7934b98p-48, 0x0.ab05b6ccbaeeb0p-58, -0x0.9e83d03b11e610p-68, 0x0.8afaa157f084a0p-78, -0x0.e7dbf000e016e0p-89, // x in subrange 1:39 (0.402344..0.40625)
- 0x0.dac62c202e5120p-19, -0x0.8c09201c42b748p-28, 0x0.a19c7284a51550p-38, -0x0.ab47e92de66f88p-48, 0x0.a8deb1915d7258p-58, -0x0.9c5bf3edb051d0p-68, 0x0.88f4fca8f89298p-78, -0x0.e447238a15dca8p-89, // x in subrange 1:40 (0.40625..0.410156)
- 0x0.d923f3ea3924c0p-19, -0x0.8ac791c628be08p-28, 0x0.9ff2b5570f5a78p-38, -0x0.a9507e40c08698p-48, 0x0.a6bf29c4494de8p-58, -0x0.9a3c1e2aeaf8b0p-68, 0x0.86f755eca9d860p-78, -0x0.e0c14662900a50p-89, // x in subrange 1:41 (0.410156..0.414062)
- 0x0.d7857b66f55088p-19, -0x0.8989520528d0a8p-28, 0x0.9e4ddac7cfd5b8p-38, -0x0.a75f66d1c15588p-48, 0x0.a4a703863ce718p-58, -0x0.98242f3dce1f40p-68, 0x0.85018bd2515470p-78, -0x0.dd4a172e1eacc0p-89, // x in subrange 1:42 (0.414062..0.417969)
- 0x0.d5eab8b93b9e68p-19, -0x0.884e5723c49b88p-28, 0x0.9cadd321b68f18p-38, -0x0.a5748ce580d7f8p-48, 0x0.a29623660819b0p-58, -0x0.961407f5846528p-68, 0x0.83137d9afa1bc8p-78, -0x0.d9e155bb8057e0p-89, // x in subrange 1:43 (0.417969..0.421875)
- 0x0.d453a220d66a78p-19, -0x0.8716978bb17aa8p-28, 0x0.9b128ee621b1f8p-38, -0x0.a38fdad247bdf0p-48, 0x0.a08c6e5ec1c318p-58, -0x0.940b89a3150600p-68, 0x0.812d0b16d30800p-78, -0x0.d686c2fed25348p-89, // x in subrange 1:44 (0.421875..0.425781)
- 0x0.d2c02dfa24aad0p-19, -0x0.85e209c56c28c8p-28, 0x0.997bfecc32e758p-38, -0x0.a1b13b3ecd3c80p-48, 0x0.9e89c9d6052268p-58, -0x0.920a96172c6a90p-68, 0x0.fe9c2945419498p-79, -0x0.d33a210c1c4848p-89, // x in subrange 1:45 (0.425781..0.429688)
- 0x0.d13052bdbe39e8p-19, -0x0.84b0a477ce0050p-28, 0x0.97ea13c007cec8p-38, -0x0.9fd89920fa1b18p-48, 0x0.9c8e1b9a36e870p-58, -0x0.90110f9feed960p-68, 0x0.faecf64a784ac8p-79, -0x0.cffb3311f6e4d0p-89, // x in subrange 1:46 (0.429688..0.433594)
- 0x0.cfa40700195ef8p-19, -0x0.83825e67a3c868p-28, 0x0.965cbee1f58930p-38, -0x0.9e05dfbcb0e610p-48, 0x0.9a9949e0d1d4e0p-58, -0x0.8e1ed906d51668p-68, 0x0.f74c401a3825f0p-79, -0x0.ccc9bd544ce8c8p-89, // x in subrange 1:47 (0.433594..0.4375)
- 0x0.ce1b4171318f78p-19, -0x0.82572e77460800p-28, 0x0.94d3f185c748f0p-38, -0x0.9c38faa29b3058p-48, 0x0.98ab3b44babe60p-58, -0x0.8c33d58e92c2d0p-68, 0x0.f3b9ca9bd732c8p-79, -0x0.c9a58527361748p-89, // x in subrange 1:48 (0.4375..0.441406)
- 0x0.cc95f8dc2f6590p-19, -0x0.812f0ba632d868p-28, 0x0.934f9d31ffdaa0p-38, -0x0.9a71d5aefbcde8p-48, 0x0.96c3d6c49be368p-58, -0x0.8a4fe8f1064e40p-68, 0x0.f0355abc563088p-79, -0x0.c68e50e9eb86a0p-89, // x in subrange 1:49 (0.441406..0.445312)
- 0x0.cb14242711c6e8p-19, -0x0.8009ed10a93260p-28, 0x0.91cfb39f1e19e0p-38, -0x0.98b05d0885f1c0p-48, 0x0.94e303c1476298p-58, -0x0.8872f75d324c70p-68, 0x0.ecbeb669b9a628p-79, -0x0.c383e801d4ce98p-89, // x in subrange 1:50 (0.445312..0.449219)
- 0x0.c995ba52583708p-19, -0x0.fdcf93de8b5de0p-29, 0x0.905426b6e446a0p-38, -0x0.96f47d1f391998p-48, 0x0.9308a9fc20baa8p-58, -0x0.869ce575400268p-68, 0x0.e955a48e7905a8p-79, -0x0.c08612d5ad9500p-89, // x in subrange 1:51 (0.449219..0.453125)
- 0x0.c81ab278ae51d8p-19, -0x0.fb91332d416e08p-29, 0x0.8edce893a22e88p-38, -0x0.953e22ab41b310p-48, 0x0.9134b1958d3138p-58, -0x0.84cd984c8affe0p-68, 0x0.e5f9ed0d037058p-79, -0x0.bd949ac8c2fcb8p-89, // x in subrange 1:52 (0.453125..0.457031)
- 0x0.c6a303ce9868d0p-19, -0x0.f958a6eddc37a8p-29, 0x0.8d69eb7f821f08p-38, -0x0.938d3aabde6520p-48, 0x0.8f67030b6b0180p-58, -0x0.8304f565b59998p-68, 0x0.e2ab58bb59b190p-79, -0x0.baaf4a36487da8p-89, // x in subrange 1:53 (0.457031..0.460938)
- 0x0.c52ea5a2213fe8p-19, -0x0.f725de373c2540p-29, 0x0.8bfb21f3d89448p-38, -0x0.91e1b26649ea18p-48, 0x0.8d9f87378f3408p-58, -0x0.8142e2b0c61b20p-68, 0x0.df69b15ebd0858p-79, -0x0.b7d5ec6cc3adf0p-89, // x in subrange 1:54 (0.460938..0.464844)
- 0x0.c3bd8f5a88e510p-19, -0x0.f4f8c855ff1ce8p-29, 0x0.8a907e98769a10p-38, -0x0.903b7764a96660p-48, 0x0.8bde274e4a0140p-58, -0x0.ff0e8d12990cb0p-69, 0x0.dc34c1a77258c8p-79, -0x0.b5084da98e87c0p-89, // x in subrange 1:55 (0.464844..0.46875)
- 0x0.c24fb877f49ed0p-19, -0x0.f2d154cbc7e4a8p-29, 0x0.8929f442fed340p-38, -0x0.8e9a7774ff2830p-48, 0x0.8a22ccdcf1a130p-58, -0x0.fba40f69217100p-69, 0x0.d90c552c9961a8p-79, -0x0.b2463b146fb978p-89, // x in subrange 1:56 (0.46875..0.472656)
- 0x0.c0e518931fedd0p-19, -0x0.f0af734e882e00p-29, 0x0.87c775f63d1ce8p-38, -0x0.8cfea0a821bd68p-48, 0x0.886d61c8736b10p-58, -0x0.f8461abf919aa8p-69, 0x0.d5f038681793d8p-79, -0x0.af8f82bb489028p-89, // x in subrange 1:57 (0.472656..0.476562)
- 0x0.bf7da75d0e9d28p-19, -0x0.ee9313c7cd3d28p-29, 0x0.8668f6e180c240p-38, -0x0.8b67e150b74cf0p-48, 0x0.86bdd04beb2898p-58, -0x0.f4f47e3caf31d0p-69, 0x0.d2e038b2962b60p-79, -0x0.ace3f38dd80e28p-89, // x in subrange 1:58 (0.476562..0.480469)
- 0x0.be195c9ebfde00p-19, -0x0.ec7c26540f22e0p-29, 0x0.850e6a5ff93758p-38, -0x0.89d62802352090p-48, 0x0.851402f7408060p-58, -0x0.f1af09d0262530p-69, 0x0.cfdc243f932b88p-79, -0x0.aa435d5992c328p-89, // x in subrange 1:59 (0.480469..0.484375)
- 0x0.bcb83038e26a78p-19, -0x0.ea6a9b42027e40p-29, 0x0.83b7c3f8154f48p-38, -0x0.8849638fe34dc0p-48, 0x0.836fe4adca5c68p-58, -0x0.ee758e2f251660p-69, 0x0.cce3ca1984e200p-79, -0x0.a7ad90c58efb80p-89, // x in subrange 1:60 (0.484375..0.488281)
- 0x0.bb5a1a2389abc0p-19, -0x0.e85e6311ecbc80p-29, 0x0.8264f75ae4e488p-38, -0x0.86c1830be46b90p-48, 0x0.81d160a4f83148p-58, -0x0.eb47dcd1091420p-69, 0x0.c9f6fa1e0f9610p-79, -0x0.a5225f4e84e060p-89, // x in subrange 1:61 (0.488281..0.492188)
- 0x0.b9ff126de3e038p-19, -0x0.e6576e74facdc8p-29, 0x0.8115f8637ce8e0p-38, -0x0.853e75c64143c0p-48, 0x0.80386263010bb8p-58, -0x0.e825c7ec185998p-69, 0x0.c71584fa4d0af8p-79, -0x0.a2a19b42e22348p-89, // x in subrange 1:62 (0.492188..0.496094)
- 0x0.b8a7113df13dc0p-19, -0x0.e455ae4c9a4490p-29, 0x0.ff95762cbba660p-39, -0x0.83c02b4bf86e50p-48, 0x0.fd49ab7b309470p-59, -0x0.e50f22724bcce0p-69, 0x0.c43f3c27257ec0p-79, -0x0.a02b17bef0d270p-89, // x in subrange 1:63 (0.496094..0.5)
- 0x0.b6a8aabb3bfb48p-17, -0x0.e15cafccbc1168p-26, 0x0.fbc1a0e04d31d0p-35, -0x0.818b8569c6e518p-43, 0x0.f8a318dd40c8b0p-53, -0x0.e0823a5b2067d0p-62, 0x0.c0129d1b943538p-71, -0x0.9c8c5a60f71d00p-80, // x in subrange 2:0 (0.5..0.507812)
- 0x0.b40a712533d550p-17, -0x0.dd77b4e1712c00p-26, 0x0.f6c0a0bb0ac120p-35, -0x0.fd557935bcac20p-44, 0x0.f294584a501d30p-53, -0x0.da9772fe75d2a8p-62, 0x0.baa6e9a83f9cb8p-71, -0x0.97dabf79cf3700p-80, // x in subrange 2:1 (0.507812..0.515625)
- 0x0.b177c8b321ff08p-17, -0x0.d9a684df644668p-26, 0x0.f1dc0e5e34e580p-35, -0x0.f7b7c50645a7b0p-44, 0x0.ecae6ceab1d650p-53, -0x0.d4d761fa8ebd30p-62, 0x0.b564c8af8112d8p-71, -0x0.934f25b679b540p-80, // x in subrange 2:2 (0.515625..0.523438)
- 0x0.aef076ad792bb0p-17, -0x0.d5e8af72ef23c0p-26, 0x0.ed1338d5563b80p-35, -0x0.f23cfcbde4a4e8p-44, 0x0.e6f030419df7c8p-53, -0x0.cf40c0052bebf0p-62, 0x0.b04ae9dcd12270p-71, -0x0.8ee84a218bb628p-80, // x in subrange 2:3 (0.523438..0.53125)
- 0x0.ac7441a98aa498p-17, -0x0.d23dc702e4e940p-26, 0x0.e86573d288c858p-35, -0x0.ece435a1b21908p-44, 0x0.e15884a0f42180p-53, -0x0.c9d25029c95ec0p-62, 0x0.ab5808038f9948p-71, -0x0.8aa4f4f9f50ee0p-80, // x in subrange 2:4 (0.53125..0.539062)
- 0x0.aa02f1817280f0p-17, -0x0.cea5609e3b2d90p-26, 0x0.e3d2178cfae020p-35, -0x0.e7ac8b8f21b5f0p-44, 0x0.dbe654e21828d0p-53, -0x0.c48adf71edc518p-62, 0x0.a68ae8bc01a148p-71, -0x0.8683f94b5d6500p-80, // x in subrange 2:5 (0.539062..0.546875)
- 0x0.a79c4f4c3a1b68p-17, -0x0.cb1f13ea36f1e0p-26, 0x0.df5880a073f398p-35, -0x0.e29520c9a4d210p-44, 0x0.d698942129d348p-53, -0x0.bf694490839b98p-62, 0x0.a1e25c03e2f7e8p-71, -0x0.8284348a649218p-80, // x in subrange 2:6 (0.546875..0.554688)
- 0x0.a54025562f4018p-17, -0x0.c7aa7b11199578p-26, 0x0.daf80fedd135b0p-35, -0x0.dd9d1dc9e2a4c0p-44, 0x0.d16e3d7a82d1a8p-53, -0x0.ba6c5f901fe418p-62, 0x0.9d5d3be267f5a0p-71, -0x0.fd491c693f4cb0p-81, // x in subrange 2:7 (0.554688..0.5625)
- 0x0.a2ee3f196e9838p-17, -0x0.c44732b149f400p-26, 0x0.d6b02a7c724d38p-35, -0x0.d8c3b10e78eea0p-44, 0x0.cc6653ca66dba0p-53, -0x0.b59319841b76f0p-62, 0x0.98fa6c0f8f6b38p-71, -0x0.f5c7eee85adb10p-81, // x in subrange 2:8 (0.5625..0.570312)
- 0x0.a0a669369fe4f8p-17, -0x0.c0f4d9ccf5fda0p-26, 0x0.d280395c8e8950p-35, -0x0.d4080eee381b88p-44, 0x0.c77fe16ed28500p-53, -0x0.b0dc643c64eda0p-62, 0x0.94b8d99ea4a3b0p-71, -0x0.ee82d58d7dab68p-81, // x in subrange 2:9 (0.570312..0.578125)
- 0x0.9e68716de2a560p-17, -0x0.bdb311ba293548p-26, 0x0.ce67a98a6b4eb8p-35, -0x0.cf69716bce5e38p-44, 0x0.c2b9f80b561908p-53, -0x0.ac4739fbf22178p-62, 0x0.90977aabd311c0p-71, -0x0.e777d74fe20980p-81, // x in subrange 2:10 (0.578125..0.585938)
- 0x0.9c342697e9cd80p-17, -0x0.ba817e13549ee8p-26, 0x0.ca65ebd26cb140p-35, -0x0.cae7180ad5b430p-44, 0x0.be13b04eea72f8p-53, -0x0.a7d29d31b92610p-62, 0x0.8c954e0cae5f80p-71, -0x0.e0a50c7db08f78p-81, // x in subrange 2:11 (0.585938..0.59375)
- 0x0.9a09589f454020p-17, -0x0.b75fc4a844c1e0p-26, 0x0.c67a74b5f96860p-35, -0x0.c68047a63929e8p-44, 0x0.b98c29bbae7188p-53, -0x0.a37d9834198e88p-62, 0x0.88b15b0392b6b0p-71, -0x0.da089e1d38acb0p-81, // x in subrange 2:12 (0.59375..0.601562)
- 0x0.97e7d879d7c538p-17, -0x0.b44d8d6f828080p-26, 0x0.c2a4bc512b86a8p-35, -0x0.c2344a47e61ec8p-44, 0x0.b5228a707c4218p-53, -0x0.9f473cfe9fa850p-62, 0x0.84eab0f5c22ed0p-71, -0x0.d3a0c5540f4e28p-81, // x in subrange 2:13 (0.601562..0.609375)
- 0x0.95cf78227841b0p-17, -0x0.b14a82781b9d38p-26, 0x0.bee43e414793f8p-35, -0x0.be026f01beaa28p-44, 0x0.b0d5fef44658e0p-53, -0x0.9b2ea4f20c2be0p-62, 0x0.814067242559a0p-71, -0x0.cd6bcad3d989d0p-81, // x in subrange 2:14 (0.609375..0.617188)
- 0x0.93c00a92bcfda8p-17, -0x0.ae564fdbcfe150p-26, 0x0.bb38798bf3de58p-35, -0x0.b9ea09c7c2a2d8p-44, 0x0.aca5ba032c80f0p-53, -0x0.9732f0968bae60p-62, 0x0.fb6338cd2bcb18p-72, -0x0.c768064c8b7e70p-81, // x in subrange 2:15 (0.617188..0.625)
- 0x0.91b963bcefd058p-17, -0x0.ab70a3b19fefe0p-26, 0x0.b7a0f0872a0ad0p-35, -0x0.b5ea734b652590p-44, 0x0.a890f45d39fa98p-53, -0x0.9353476009e550p-62, 0x0.f47aedd3368aa0p-72, -0x0.c193dde3e5d170p-81, // x in subrange 2:16 (0.625..0.632812)
- 0x0.8fbb58862a1060p-17, -0x0.a8992e00bae758p-26, 0x0.b41d28c1dd1f70p-35, -0x0.b20308d804cfc0p-44, 0x0.a496ec96be2a60p-53, -0x0.8f8ed7748d88d0p-62, 0x0.edc647dd046db8p-72, -0x0.bbedc5b1fe5380p-81, // x in subrange 2:17 (0.632812..0.640625)
- 0x0.8dc5bec0973080p-17, -0x0.a5cfa0b3c80bc8p-26, 0x0.b0acaaed4e7168p-35, -0x0.ae332c307d39f8p-44, 0x0.a0b6e6ea31dc90p-53, -0x0.8be4d5748a5760p-62, 0x0.e743af1b71cfb0p-72, -0x0.b6743f42a25fa0p-81, // x in subrange 2:18 (0.640625..0.648438)
- 0x0.8bd86d25dcf8a8p-17, -0x0.a313af8c89c838p-26, 0x0.ad4f02c70c0fb0p-35, -0x0.aa7a436dc88e90p-44, 0x0.9cf02d0b9ba110p-53, -0x0.88547c45176c58p-62, 0x0.e0f198f6b49e30p-72, -0x0.b125d91b637cd8p-81, // x in subrange 2:19 (0.648438..0.65625)
- 0x0.89f33b51a85340p-17, -0x0.a0651017d76c70p-26, 0x0.aa03bf03936ff0p-35, -0x0.a6d7b8dea86998p-44, 0x0.99420dfd663e80p-53, -0x0.84dd0cdbf8c270p-62, 0x0.dace879ba84898p-72, -0x0.ac012e4620a9e0p-81, // x in subrange 2:20 (0.65625..0.664062)
- 0x0.881601bc5dae58p-17, -0x0.9dc379a1eb1fc8p-26, 0x0.a6ca7139934e80p-35, -0x0.a34afae84d7b50p-44, 0x0.95abdde69caf88p-53, -0x0.817dce0d6b5d18p-62, 0x0.d4d9098d275028p-72, -0x0.a704e5dfe08888p-81, // x in subrange 2:21 (0.664062..0.671875)
- 0x0.864099b5ebf7a0p-17, -0x0.9b2ea52b019650p-26, 0x0.a3a2adcdc7dcb0p-35, -0x0.9fd37be7f5b068p-44, 0x0.922cf5ea7f9098p-53, -0x0.fc6c18b7485e50p-63, 0x0.cf0fb9394c5f98p-72, -0x0.a22fb2abd256f8p-81, // x in subrange 2:22 (0.671875..0.679688)
- 0x0.8472dd60c141c0p-17, -0x0.98a64d5c4928a8p-26, 0x0.a08c0bdf6c80b8p-35, -0x0.9c70b21578eaa8p-44, 0x0.8ec4b401685080p-53, -0x0.f60a338fe4d3d0p-63, 0x0.c9713c927643f0p-72, -0x0.9d8052aa4d4d78p-81, // x in subrange 2:23 (0.679688..0.6875)
- 0x0.82aca7ace02818p-17, -0x0.962a2e7d1e0128p-26, 0x0.9d8625353e9160p-35, -0x0.99221766bc9970p-44, 0x0.8b727ad2eee058p-53, -0x0.efd49b4aece198p-63, 0x0.c3fc44abeb84e0p-72, -0x0.98f58eb3a78e08p-81, // x in subrange 2:24 (0.6875..0.695312)
- 0x0.80edd453150d30p-17, -0x0.93ba06689123d0p-26, 0x0.9a90962b0c9e50p-35, -0x0.95e7297406c3f0p-44, 0x0.8835b1914703f0p-53, -0x0.e9ca08dabe6e20p-63, 0x0.beaf8d59fbb1a8p-72, -0x0.948e3a16bf5990p-81, // x in subrange 2:25 (0.695312..0.703125)
- 0x0.fe6c7fa094ad10p-18, -0x0.915594833826f8p-26, 0x0.97aafd9fcdf980p-35, -0x0.92bf695d2956d0p-44, 0x0.850dc3d5cac680p-53, -0x0.e3e93f2940a4c8p-63, 0x0.b989dcd57dc028p-72, -0x0.9049323b12b420p-81, // x in subrange 2:26 (0.703125..0.710938)
- 0x0.fb0b8ec1f59d90p-18, -0x0.8efc99b1438450p-26, 0x0.94d4fce43e59f8p-35, -0x0.8faa5baf7ec510p-44, 0x0.81fa217ea7f500p-53, -0x0.de310ac6271b40p-63, 0x0.b48a03628c1848p-72, -0x0.8c255e46430978p-81, // x in subrange 2:27 (0.710938..0.71875)
- 0x0.f7b891f982bb38p-18, -0x0.8caed84cd97a08p-26, 0x0.920e37a9f99208p-35, -0x0.8ca7884cb147a0p-44, 0x0.fdf47d1b4db500p-54, -0x0.d8a04197f282e8p-63, 0x0.afaedafa601590p-72, -0x0.8821aec4e3bbf8p-81, // x in subrange 2:28 (0.71875..0.726562)
- 0x0.f47346a40a9568p-18, -0x0.8a6c141cb38340p-26, 0x0.8f5653f3137488p-35, -0x0.89b67a52464048p-44, 0x0.f81b261001a460p-54, -0x0.d335c28f966010p-63, 0x0.aaf746f82fecc0p-72, -0x0.843d1d5673d278p-81, // x in subrange 2:29 (0.726562..0.734375)
- 0x0.f13b6b83848d40p-18, -0x0.8834124afc7ef0p-26, 0x0.8cacfa02282390p-35, -0x0.86d6c001e77c78p-44, 0x0.f26735ae7b2ea0p-54, -0x0.cdf0755eac2438p-63, 0x0.a66233c8f2fb88p-72, -0x0.8076ac5c643710p-81, // x in subrange 2:30 (0.734375..0.742188)
- 0x0.ee10c0b6d6f590p-18, -0x0.8606995c6daae8p-26, 0x0.8a11d44ae12310p-35, -0x0.8407eaaa644a18p-44, 0x0.ecd7ab561d1838p-54, -0x0.c8cf4a301ce4d8p-63, 0x0.a1ee969df19678p-72, -0x0.f99acd581a53d8p-82, // x in subrange 2:31 (0.742188..0.75)
- 0x0.eaf307b1d1cc78p-18, -0x0.83e37127a8a6c8p-26, 0x0.87848f62eba6c0p-35, -0x0.81498e916483e8p-44, 0x0.e76b8db83efea8p-54, -0x0.c3d139632bbaa0p-63, 0x0.9d9b6d22066c40p-72, -0x0.f280be86ed5ed8p-82, // x in subrange 2:32 (0.75..0.757812)
- 0x0.e7e203355ca690p-18, -0x0.81ca62ccccc130p-26, 0x0.8504d9f35caf70p-35, -0x0.fd3685bb8fdac0p-45, 0x0.e221ea9fa98660p-54, -0x0.bef54348cba188p-63, 0x0.9967bd31788db8p-72, -0x0.eb9d6201b1b328p-82, // x in subrange 2:33 (0.757812..0.765625)
- 0x0.e4dd7747d66c68p-18, -0x0.ff76715a8bbc10p-27, 0x0.829264aa7fa888p-35, -0x0.f7f9430558cbc8p-45, 0x0.dcf9d6b9dd6348p-54, -0x0.ba3a6fe32c74b8p-63, 0x0.95529494561ad8p-72, -0x0.e4eefcb973b478p-82, // x in subrange 2:34 (0.765625..0.773438)
- 0x0.e1e5292da59608p-18, -0x0.fb6b7cc7a6a668p-27, 0x0.802ce22e0c5058p-35, -0x0.f2da8e562b5328p-45, 0x0.d7f26d6215fec0p-54, -0x0.b59fcea76b5e58p-63, 0x0.915b08bb387958p-72, -0x0.de73e24d219ca0p-82, // x in subrange 2:35 (0.773438..0.78125)
- 0x0.def8df61f79970p-18, -0x0.f77381798a47a8p-27, 0x0.fba80e1b81a098p-36, -0x0.edd9a64c6306a0p-45, 0x0.d30ad06df90600p-54, -0x0.b124764153c8d0p-63, 0x0.8d80367e5bd840p-72, -0x0.d82a7487aa5520p-82, // x in subrange 2:36 (0.78125..0.789062)
- 0x0.dc18618fae4a48p-18, -0x0.f38e1b5cdc1fe8p-27, 0x0.f70f136cba0740p-36, -0x0.e8f5cea866fce0p-45, 0x0.ce4227fbe4adc8p-54, -0x0.acc784591e8cd0p-63, 0x0.89c141def496f0p-72, -0x0.d21122e2c74128p-82, // x in subrange 2:37 (0.789062..0.796875)
- 0x0.d943788a79f2b0p-18, -0x0.efbae8a391f358p-27, 0x0.f28e44c9f80580p-36, -0x0.e42e502786a1d0p-45, 0x0.c997a242cef550p-54, -0x0.a8881d5b1dc080p-63, 0x0.861d55caadf3c0p-72, -0x0.cc266a0e446fe0p-82, // x in subrange 2:38 (0.796875..0.804688)
- 0x0.d679ee481ef510p-18, -0x0.ebf989b6a05848p-27, 0x0.ee2516359242b8p-36, -0x0.df82785ff2bd50p-45, 0x0.c50a7363a8ac20p-54, -0x0.a4656c41442d40p-63, 0x0.8293a3e13e2a50p-72, -0x0.c668d37b9c6618p-82, // x in subrange 2:39 (0.804688..0.8125)
- 0x0.d3bb8dd9e5d060p-18, -0x0.e849a1280a38e8p-27, 0x0.e9d2ff221b4848p-36, -0x0.daf1999dc9bca8p-45, 0x0.c099d53c3772c0p-54, -0x0.a05ea25e780d58p-63, 0x0.fe46c877f9cc88p-73, -0x0.c0d6f4edbe5420p-82, // x in subrange 2:40 (0.8125..0.820312)
- 0x0.d10823663467c0p-18, -0x0.e4aad3a54e8cf0p-27, 0x0.e5977a5b291158p-36, -0x0.d67b0ac12e9a18p-45, 0x0.bc45073b5a5f20p-54, -0x0.9c72f72ba14990p-63, 0x0.f797aa6ed34a90p-73, -0x0.bb6f700cd722a0p-82, // x in subrange 2:41 (0.820312..0.828125)
- 0x0.ce5f7c224f7700p-18, -0x0.e11cc7ea31a5b8p-27, 0x0.e17205eec39f20p-36, -0x0.d21e271d620678p-45, 0x0.b80b4e36ad5960p-54, -0x0.98a1a81663fdb0p-63, 0x0.f118767d20a478p-73, -0x0.b630f1fdf74570p-82, // x in subrange 2:42 (0.828125..0.835938)
- 0x0.cbc1664c4324f0p-18, -0x0.dd9f26b3df79e8p-27, 0x0.dd622317759a88p-36, -0x0.cdda4e58d5bf40p-45, 0x0.b3ebf4417faf38p-54, -0x0.94e9f8517897c0p-63, 0x0.eac7c130761428p-73, -0x0.b11a32fe70ba18p-82, // x in subrange 2:43 (0.835938..0.84375)
- 0x0.c92db124f1acb8p-18, -0x0.da319ab46472d0p-27, 0x0.d9675626fa3420p-36, -0x0.c9aee44e323f88p-45, 0x0.afe6488512c000p-54, -0x0.914b30a6936a40p-63, 0x0.e4a42a6bc13c60p-73, -0x0.ac29f602c9fde0p-82, // x in subrange 2:44 (0.84375..0.851562)
- 0x0.c6a42cea471db8p-18, -0x0.d6d3d0867a4f68p-27, 0x0.d5812671839980p-36, -0x0.c59b50ee473ba0p-45, 0x0.abf99f1a160610p-54, -0x0.8dc49f49ce0b50p-63, 0x0.deac5d088003f0p-73, -0x0.a75f08592420e0p-82, // x in subrange 2:45 (0.851562..0.859375)
- 0x0.c424aad19139e8p-18, -0x0.d38576a1a6c410p-27, 0x0.d1af1e39957c88p-36, -0x0.c19f0022df9620p-45, 0x0.a82550e3561e30p-54, -0x0.8a5597ae8556c0p-63, 0x0.d8df0e7b32cf48p-73, -0x0.a2b8414ef36560p-82, // x in subrange 2:46 (0.859375..0.867188)
- 0x0.c1aefd01fa8048p-18, -0x0.d0463d4ea98f10p-27, 0x0.cdf0ca9c6f4cf0p-36, -0x0.bdb961b271bb48p-45, 0x0.a468bb6994ca78p-54, -0x0.86fd725d9f60f8p-63, 0x0.d33afe7aecbf58p-73, -0x0.9e3481d9eb1a80p-82, // x in subrange 2:47 (0.867188..0.875)
- 0x0.bf42f68f2778f0p-18, -0x0.cd15d69c37cc20p-27, 0x0.ca45bb7f01e778p-36, -0x0.b9e9e924a58970p-45, 0x0.a0c340b8804348p-54, -0x0.83bb8ccd2d1af8p-63, 0x0.cdbef6abe5b0e0p-73, -0x0.99d2b443fe9138p-82, // x in subrange 2:48 (0.875..0.882812)
- 0x0.bce06b73f55dc8p-18, -0x0.c9f3f654026118p-27, 0x0.c6ad837b6c9f78p-36, -0x0.b6300da7a92708p-45, 0x0.9d34473cc07e58p-54, -0x0.808f49395bd7b8p-63, 0x0.c869ca4cf2c1b8p-73, -0x0.9591cbda5a3158p-82, // x in subrange 2:49 (0.882812..0.890625)
- 0x0.ba87308d5941f8p-18, -0x0.c6e051f0056e60p-27, 0x0.c327b7cefda838p-36, -0x0.b28b49f64e5dd0p-45, 0x0.99bb39a3116548p-54, -0x0.faf01cfd569b50p-64, 0x0.c33a55e7cb20f8p-73, -0x0.9170c49f38cd28p-82, // x in subrange 2:50 (0.890625..0.898438)
- 0x0.b8371b955ee028p-18, -0x0.c3daa0901ebd70p-27, 0x0.bfb3f048b20360p-36, -0x0.aefb1c3eea47e0p-45, 0x0.965786b8614248p-54, -0x0.f4ea8feaba2b08p-64, 0x0.be2f7f03ffe590p-73, -0x0.8d6ea2fe7a6248p-82, // x in subrange 2:51 (0.898438..0.90625)
- 0x0.b5f0031e463d48p-18, -0x0.c0e29aefe936f0p-27, 0x0.bc51c738313798p-36, -0x0.ab7f060af14e98p-45, 0x0.9308a14aeaf628p-54, -0x0.ef0cca9c261828p-64, 0x0.b94833dc8e92d0p-73, -0x0.898a7384e279f8p-82, // x in subrange 2:52 (0.90625..0.914062)
- 0x0.b3b1be8dbf53e8p-18, -0x0.bdf7fb5cdb7818p-27, 0x0.b900d95d413090p-36, -0x0.a8168c2749ad48p-45, 0x0.8fce000c43d3e0p-54, -0x0.e955b4df24b5a0p-64, 0x0.b4836b17f6d768p-73, -0x0.85c34a99e55500p-82, // x in subrange 2:53 (0.914062..0.921875)
- 0x0.b17c2618430150p-18, -0x0.bb1a7daca7aea0p-27, 0x0.b5c0c5d7aec5f0p-36, -0x0.a4c1368d4ed998p-45, 0x0.8ca71d74554308p-54, -0x0.e3c43eab4290a8p-64, 0x0.afe02382bced28p-73, -0x0.8218443bec0060p-82, // x in subrange 2:54 (0.921875..0.929688)
- 0x0.af4f12bc887398p-18, -0x0.b849df33daee90p-27, 0x0.b2912e17a78278p-36, -0x0.a17e904c8061e0p-45, 0x0.899377a53a9020p-54, -0x0.de575fe1ec9380p-64, 0x0.ab5d63cc42d3f8p-73, -0x0.fd11077df0ac58p-83, // x in subrange 2:55 (0.929688..0.9375)
- 0x0.ad2a5e3f165c80p-18, -0x0.b585debcba4430p-27, 0x0.af71b5ce815ed0p-36, -0x0.9e4e2774d6fe80p-45, 0x0.8692904ffb91c8p-54, -0x0.d90e18105e47e0p-64, 0x0.a6fa3a45e36c68p-73, -0x0.f626671b2598f8p-83, // x in subrange 2:56 (0.9375..0.945312)
- 0x0.ab0de325ef32a8p-18, -0x0.b2ce3c7e5bd040p-27, 0x0.ac6202dfed3e98p-36, -0x0.9b2f8d01babe80p-45, 0x0.83a3ec9a1d0998p-54, -0x0.d3e76e338e7bc8p-64, 0x0.a2b5bca43b3aa0p-73, -0x0.ef6f09d7d99208p-83, // x in subrange 2:57 (0.945312..0.953125)
- 0x0.a8f97cb457cf70p-18, -0x0.b022ba13fa4a48p-27, 0x0.a961bd539115c8p-36, -0x0.982254c5956230p-45, 0x0.80c71503ffe500p-54, -0x0.cee2707e092928p-64, 0x0.9e8f07c28b5508p-73, -0x0.e8e95f7a45fb00p-83, // x in subrange 2:58 (0.953125..0.960938)
- 0x0.a6ed06e6b7bcd0p-18, -0x0.ad831a74814f90p-27, 0x0.a6708f4706b5e8p-36, -0x0.95261555fc1e18p-45, 0x0.fbf72aa0117838p-55, -0x0.c9fe341fa61b80p-64, 0x0.9a853f6823b830p-73, -0x0.e293e495182b70p-83, // x in subrange 2:59 (0.960938..0.96875)
- 0x0.a4e85e6e928af0p-18, -0x0.aaef21ea50f2d8p-27, 0x0.a38e24e03c59b0p-36, -0x0.923a67f86c2860p-45, 0x0.f681f8d5124ce8p-55, -0x0.c539d50f0c6088p-64, 0x0.96978e0fc2e6c0p-73, -0x0.dc6d221a017ab8p-83, // x in subrange 2:60 (0.96875..0.976562)
- 0x0.a2eb60ae9989f0p-18, -0x0.a866960b370ae0p-27, 0x0.a0ba2c40341c30p-36, -0x0.8f5ee88f959810p-45, 0x0.f12db8a4c967c8p-55, -0x0.c09475d4f31ff8p-64, 0x0.92c524b0d96438p-73, -0x0.d673acf0157418p-83, // x in subrange 2:61 (0.976562..0.984375)
- 0x0.a0f5ebb6d54938p-18, -0x0.a5e93db09cc9e0p-27, 0x0.9df455761f9ef8p-36, -0x0.8c9335893042e8p-45, 0x0.ebf99404d71970p-55, -0x0.bc0d3f5910ff60p-64, 0x0.8f0d3a8aa03a30p-73, -0x0.d0a6258dd30990p-83, // x in subrange 2:62 (0.984375..0.992188)
- 0x0.9f07de40e64158p-18, -0x0.a376e0efe73288p-27, 0x0.9b3c5272d53758p-36, -0x0.89d6efcc5668c0p-45, 0x0.e6e4bab6c9df00p-55, -0x0.b7a360b0abbb08p-64, 0x0.8b6f0cf0f25380p-73, -0x0.cb033796b6ecc0p-83, // x in subrange 2:63 (0.992188..1)
- 0x0.9c3064f0f782a8p-16, -0x0.9fdf7633bc2b18p-24, 0x0.974194c1cb6210p-32, -0x0.85d8a9fcede488p-40, 0x0.df7e6842dd10a8p-49, -0x0.b139dd1194d758p-57, 0x0.8630fb12a59208p-65, -0x0.c2dca1a40e0148p-74, // x in subrange 3:0 (1..1.01562)
- 0x0.987f2ce5da9ce0p-16, -0x0.9b3a0e50c25818p-24, 0x0.9220ef250e53b8p-32, -0x0.80b8531ae00568p-40, 0x0.d606f6facd2ca8p-49, -0x0.a90cab39e825d0p-57, 0x0.ff0c5816c840b0p-66, -0x0.b886e863c69270p-74, // x in subrange 3:1 (1.01562..1.03125)
- 0x0.94e95bd03eae00p-16, -0x0.96bce179943348p-24, 0x0.8d327558295ed8p-32, -0x0.f79eee6f48a9f0p-41, 0x0.ccff21155fa968p-49, -0x0.a1474bb51d6598p-57, 0x0.f26b7b11046420p-66, -0x0.aec5b2dda4dab0p-74, // x in subrange 3:2 (1.03125..1.04688)
- 0x0.916e04f0d5c668p-16, -0x0.926666d87a9298p-24, 0x0.887409695a4650p-32, -0x0.ee3712d2f31860p-41, 0x0.c4615fdc03ebc0p-49, -0x0.99e44173b913e0p-57, 0x0.e6753d9d8c0f68p-66, -0x0.a5903ac701b188p-74, // x in subrange 3:3 (1.04688..1.0625)
- 0x0.8e0c448b4f1038p-16, -0x0.8e352622fc0188p-24, 0x0.83e3a6452c66e8p-32, -0x0.e5343a197d9510p-41, 0x0.bc2877430a2638p-49, -0x0.92de5e06d56888p-57, 0x0.db2017460c2990p-66, -0x0.9cde44e0ccc238p-74, // x in subrange 3:4 (1.0625..1.07812)
- 0x0.8ac33f855e4120p-16, -0x0.8a27b6d7de48f8p-24, 0x0.fefebcf8a23e40p-33, -0x0.dc91c8212d9098p-41, 0x0.b44f71bd9f6c98p-49, -0x0.8c30bcfe6b2f20p-57, 0x0.d0630f1f455258p-66, -0x0.94a817fc076ff8p-74, // x in subrange 3:5 (1.07812..1.09375)
- 0x0.8792230a321540p-16, -0x0.863cbf86b675e8p-24, 0x0.f68ab633fe5978p-33, -0x0.d44b5ab7a95468p-41, 0x0.acd19c509bcc50p-49, -0x0.85d6bf90ca5ca8p-57, 0x0.c635b2f02f5d20p-66, -0x0.8ce67498c5d578p-74, // x in subrange 3:6 (1.09375..1.10938)
- 0x0.84782432220188p-16, -0x0.8272f52086dfe0p-24, 0x0.ee67b513daaa28p-33, -0x0.cc5cc6918a9168p-41, 0x0.a5aa82e0432f90p-49, -0x0.ff98110d16b680p-58, 0x0.bc900eead1a5e0p-66, -0x0.85928d14f0a070p-74, // x in subrange 3:7 (1.10938..1.125)
- 0x0.81747fae5e3900p-16, -0x0.fd9234a1e3a960p-25, 0x0.e6925f1a14fe58p-33, -0x0.c4c2146cfc6f30p-41, 0x0.9ed5ecb55997b8p-49, -0x0.f418f0cd25d2a8p-58, 0x0.b36aa5ed0fbcb8p-66, -0x0.fd4bfcc192c650p-75, // x in subrange 3:8 (1.125..1.14062)
- 0x0.fd0cf2f0dfc8a8p-17, -0x0.f67bfdbf1c9458p-25, 0x0.df07807844bf20p-33, -0x0.bd777e5ce1c470p-41, 0x0.984fd93626bb48p-49, -0x0.e92853bc1b6108p-58, 0x0.aabe6a40573980p-66, -0x0.f035925fd603f0p-75, // x in subrange 3:9 (1.14062..1.15625)
- 0x0.f75ab90ab40eb0p-17, -0x0.efa0fe31e49758p-25, 0x0.d7c40a2f540568p-33, -0x0.b6796d3a278098p-41, 0x0.92147cd03c9c08p-49, -0x0.debedcc11d88d0p-58, 0x0.a284b6cfbc6b90p-66, -0x0.e3d6973c548058p-75, // x in subrange 3:10 (1.15625..1.17188)
- 0x0.f1d0f4f85c1030p-17, -0x0.e8ff067e19a1f8p-25, 0x0.d0c51047f5e378p-33, -0x0.afc476390c27f0p-41, 0x0.8c203e10087f68p-49, -0x0.d4d595f97ade60p-58, 0x0.9ab748cca8f308p-66, -0x0.d8247680b06260p-75, // x in subrange 3:11 (1.17188..1.1875)
- 0x0.ec6e56dfd23f30p-17, -0x0.e293fe00dc9608p-25, 0x0.ca07c8229cd330p-33, -0x0.a95558a047c658p-41, 0x0.866fb2e3661710p-49, -0x0.cb65eac476cdc8p-58, 0x0.935039bac9fe50p-66, -0x0.cd153f32f4d220p-75, // x in subrange 3:12 (1.1875..1.20312)
- 0x0.e7319b38e46240p-17, -0x0.dc5de1ec48fb88p-25, 0x0.c38986dda86400p-33, -0x0.a328fba0200b68p-41, 0x0.80ff9e0499d888p-49, -0x0.c269a22b4a1ce8p-58, 0x0.8c49f9dc6cafe8p-66, -0x0.c29f99db283248p-75, // x in subrange 3:13 (1.20312..1.21875)
- 0x0.e2198a4d233330p-17, -0x0.d65ac44fa67970p-25, 0x0.bd47bfd0943590p-33, -0x0.9d3c6c47928788p-41, 0x0.f799d916836bf8p-50, -0x0.b9dad99f841990p-58, 0x0.859f4af8eed0c8p-66, -0x0.b8babed73145e8p-75, // x in subrange 3:14 (1.21875..1.23438)
- 0x0.dd24f7bd7d02d8p-17, -0x0.d088cb2b70a4e0p-25, 0x0.b740031b041900p-33, -0x0.978cdb95db5bf8p-41, 0x0.eda96741e5b010p-50, -0x0.b1b4000a5b1fe8p-58, 0x0.fe9676eeb22f58p-67, -0x0.af5e6d5128adf0p-75, // x in subrange 3:15 (1.23438..1.25)
- 0x0.d852c20d3e2f20p-17, -0x0.cae62f909a9668p-25, 0x0.b16ffc4699ed38p-33, -0x0.92179ca6b94088p-41, 0x0.e4285caebf9900p-50, -0x0.a9efd127d68cd0p-58, 0x0.f292438f3f27a0p-67, -0x0.a682e2cd077c38p-75, // x in subrange 3:16 (1.25..1.26562)
- 0x0.d3a1d23235c038p-17, -0x0.c5713cca7c0fc8p-25, 0x0.abd570fa918470p-33, -0x0.8cda22f7e8a750p-41, 0x0.db11773c0a1700p-50, -0x0.a2895129115c00p-58, 0x0.e729302ac98a40p-67, -0x0.9e20d3436b3760p-75, // x in subrange 3:17 (1.26562..1.28125)
- 0x0.cf111b29bfd570p-17, -0x0.c0284f92dddfd0p-25, 0x0.a66e3fc02da880p-33, -0x0.87d200c6671d50p-41, 0x0.d25fb8aaf3be48p-50, -0x0.9b7bc899241620p-58, 0x0.dc52f07eea4c78p-67, -0x0.963161bfe0bb40p-75, // x in subrange 3:18 (1.28125..1.29688)
- 0x0.ca9f99927ab380p-17, -0x0.bb09d54fa29ff0p-25, 0x0.a1385ed70f3a70p-33, -0x0.82fce58225e7d8p-41, 0x0.ca0e62fd439c48p-50, -0x0.94c2c0808eb6b8p-58, 0x0.d207b01f07c2c8p-67, -0x0.8eae1979d30238p-75, // x in subrange 3:19 (1.29688..1.3125)
- 0x0.c64c534a6e4058p-17, -0x0.b6144b598feb30p-25, 0x0.9c31db189c7c48p-33, -0x0.fcb138adcec408p-42, 0x0.c218f5082d91a8p-50, -0x0.8e59fec34033d8p-58, 0x0.c8400b5bfd1ee8p-67, -0x0.8790e75fda1150p-75, // x in subrange 3:20 (1.3125..1.32812)
- 0x0.c2165711708d28p-17, -0x0.b1463e4bc2cb90p-25, 0x0.9758d6e9aade78p-33, -0x0.f3c615922bb690p-42, 0x0.ba7b27387d47d0p-50, -0x0.883d82b599af80p-58, 0x0.bef5089c2b4158p-67, -0x0.80d4140db9efd8p-75, // x in subrange 3:21 (1.32812..1.34375)
- 0x0.bdfcbc2f94bb28p-17, -0x0.ac9e495b605968p-25, 0x0.92ab8939a93d80p-33, -0x0.eb345ecae98970p-42, 0x0.b330e8852e0ca0p-50, -0x0.826981e50761e0p-58, 0x0.b620121cb3a060p-67, -0x0.f4e47c4bd52d60p-76, // x in subrange 3:22 (1.34375..1.35938)
- 0x0.b9fea21f741050p-17, -0x0.a81b15b7196da8p-25, 0x0.8e283c8e935cc8p-33, -0x0.e2f841053bd100p-42, 0x0.ac365b8db3e408p-50, -0x0.f9b4ca22029f88p-59, 0x0.adbaf0151a3f20p-67, -0x0.e8ccaa1001de90p-76, // x in subrange 3:23 (1.35938..1.375)
- 0x0.b61b303c237700p-17, -0x0.a3bb59ee1dd688p-25, 0x0.89cd4e1d01ab60p-33, -0x0.db0e16269896d0p-42, 0x0.a587d3e16531a8p-50, -0x0.ef198aa2f44668p-59, 0x0.a5bfc336ff4960p-67, -0x0.dd5727bb8e0568p-76, // x in subrange 3:24 (1.375..1.39062)
- 0x0.b2519572a9e8c8p-17, -0x0.9f7dd95e20c0f8p-25, 0x0.85992cebb203b8p-33, -0x0.d37263110a8170p-42, 0x0.9f21d36d9ca920p-50, -0x0.e4fad2cfe68790p-59, 0x0.9e28ff840c8600p-67, -0x0.d27af9f27e1ec0p-76, // x in subrange 3:25 (1.39062..1.40625)
- 0x0.aea107f6ce6bb8p-17, -0x0.9b6163a814fcb0p-25, 0x0.818a5901ef2a28p-33, -0x0.cc21d5857c7320p-42, 0x0.9901081050eeb0p-50, -0x0.db52867135aa18p-59, 0x0.96f1677496fe68p-67, -0x0.c82faafc65fbb0p-76, // x in subrange 3:26 (1.40625..1.42188)
- 0x0.ab08c4fb165360p-17, -0x0.9764d42b4c71f0p-25, 0x0.fb3ec5408ab7e0p-34, -0x0.c519422255f748p-42, 0x0.9322494d02a358p-50, -0x0.d21adad2058838p-59, 0x0.90140769d28328p-67, -0x0.be6d42a4a05d70p-76, // x in subrange 3:27 (1.42188..1.4375)
- 0x0.a788106bce6510p-17, -0x0.93871186aa8bb0p-25, 0x0.f3add305f49888p-34, -0x0.be55a27cd88878p-42, 0x0.8d82962202aa28p-50, -0x0.c94e52444f80a8p-59, 0x0.898c3166cb9660p-67, -0x0.b52c3e9e4ecc40p-76, // x in subrange 3:28 (1.4375..1.45312)
- 0x0.a41e34acfb53d8p-17, -0x0.8fc70d1f9d8870p-25, 0x0.ec5f385b8d04c0p-34, -0x0.b7d41353c4e420p-42, 0x0.881f12fc316e70p-50, -0x0.c0e7b7e7481df8p-59, 0x0.8355790bad3198p-67, -0x0.ac658b637452d8p-76, // x in subrange 3:29 (1.45312..1.46875)
- 0x0.a0ca825b0fc550p-17, -0x0.8c23c2ae969640p-25, 0x0.e5506e80aa61b0p-34, -0x0.b191d2d9e56a58p-42, 0x0.82f507c774f580p-50, -0x0.b8e21bac199948p-59, 0x0.fad75f9e4685e8p-68, -0x0.a4127d87155e70p-76, // x in subrange 3:30 (1.46875..1.48438)
- 0x0.9d8c500e47b508p-17, -0x0.889c37d0bc5b88p-25, 0x0.de7f09a62cb318p-34, -0x0.ab8c3f172efc20p-42, 0x0.fc03bc347d6cd8p-51, -0x0.b138ce95311658p-59, 0x0.ef95c2e3e1fe58p-68, -0x0.9c2ccb72d3e8d8p-76, // x in subrange 3:31 (1.48438..1.5)
- 0x0.9a62fa208a9c78p-17, -0x0.852f7b9e971610p-25, 0x0.d7e8b7b7ead368p-34, -0x0.a5c0d45f3d04a0p-42, 0x0.f2863ef5275400p-51, -0x0.a9e75f2c98f338p-59, 0x0.e4dea1522742e0p-68, -0x0.94ae8789020a48p-76, // x in subrange 3:32 (1.5..1.51562)
- 0x0.974de275b73ff8p-17, -0x0.81dca64778ced8p-25, 0x0.d18b3f3518e9b0p-34, -0x0.a02d2bdbff6c80p-42, 0x0.e96ce77641cb90p-51, -0x0.a2e9962e130d30p-59, 0x0.daaae7f60e78e8p-68, -0x0.8d921aa49ed958p-76, // x in subrange 3:33 (1.51562..1.53125)
- 0x0.944c70463d68f8p-17, -0x0.fd45b162ce9620p-26, 0x0.cb647e16e3b0e0p-34, -0x0.9acefa2b8231d0p-42, 0x0.e0b33eddfae970p-51, -0x0.9c3b7361dab578p-59, 0x0.d0f3e599f852f0p-68, -0x0.86d23ef122bc58p-76, // x in subrange 3:34 (1.53125..1.54688)
- 0x0.915e0febeb2a70p-17, -0x0.f702783aa0bb50p-26, 0x0.c57268c486c6a8p-34, -0x0.95a40e0fc657f0p-42, 0x0.d85504e59e37a0p-51, -0x0.95d92aa5277938p-59, 0x0.c7b3453a0167f8p-68, -0x0.8069fb1469a6a0p-76, // x in subrange 3:35 (1.54688..1.5625)
- 0x0.8e8232b0d49058p-17, -0x0.f0ee039ea82020p-26, 0x0.bfb309142e3f00p-34, -0x0.90aa4f2fb2e798p-42, 0x0.d04e2d1436ca48p-51, -0x0.8fbf211db81638p-59, 0x0.bee308cca840a8p-68, -0x0.f4a93b4ad76fb0p-77, // x in subrange 3:36 (1.5625..1.57812)
- 0x0.8bb84ea03dcdc8p-17, -0x0.eb06c575e589d0p-26, 0x0.ba247d57fd2e98p-34, -0x0.8bdfbce832d658p-42, 0x0.c89adc1f417f50p-51, -0x0.89e9ea95d82c70p-59, 0x0.b67d845a8cb0a0p-68, -0x0.e91b71d59fc1b0p-77, // x in subrange 3:37 (1.57812..1.59375)
- 0x0.88ffde59712180p-17, -0x0.e54b3e65dffc68p-26, 0x0.b4c4f7769bcbc8p-34, -0x0.87426d2ca1f6e8p-42, 0x0.c137656f49a108p-51, -0x0.845646fe7bac38p-59, 0x0.ae7d5960653bb8p-68, -0x0.de223db9721528p-77, // x in subrange 3:38 (1.59375..1.60938)
- 0x0.865860e46abcb8p-17, -0x0.dfb9fd3979ab28p-26, 0x0.af92bc0eb83030p-34, -0x0.82d08b75b793a0p-42, 0x0.ba2048c66aa1a8p-51, -0x0.fe02402a61a850p-60, 0x0.a6dd727697af18p-68, -0x0.d3b5bacafa6b38p-77, // x in subrange 3:39 (1.60938..1.625)
- 0x0.83c1598845ff58p-17, -0x0.da519e4e7ef0f0p-26, 0x0.aa8c21a4ecb818p-34, -0x0.fd10af7c522f28p-43, 0x0.b3523006d01cb8p-51, -0x0.f3cf0e5799f2d8p-60, 0x0.9f98ff3a2d22b0p-68, -0x0.c9ce75ba7f1d70p-77, // x in subrange 3:40 (1.625..1.64062)
- 0x0.813a4fa3585600p-17, -0x0.d510cb099e3ec8p-26, 0x0.a5af8fdb867c90p-34, -0x0.f4d04b18947a30p-43, 0x0.acc9ed1769e8a8p-51, -0x0.ea0d661fb2ee30p-60, 0x0.98ab70731fa610p-68, -0x0.c065657955d560p-77, // x in subrange 3:41 (1.64062..1.65625)
- 0x0.fd859d09cde720p-18, -0x0.cff639507bfda0p-26, 0x0.a0fb7eb3ad7a40p-34, -0x0.ecdcb60ff54988p-43, 0x0.a68477e524d948p-51, -0x0.e0b7fc1fca4d40p-60, 0x0.92107474414520p-68, -0x0.b773e50693b9a8p-77, // x in subrange 3:42 (1.65625..1.67188)
- 0x0.f8b4ca90cb0268p-18, -0x0.cb00ab099939b8p-26, 0x0.9c6e75d776a5f0p-34, -0x0.e532e038750e18p-43, 0x0.a07eec7f120bd8p-51, -0x0.d7c9c839f79d28p-60, 0x0.8bc3f3b13927a0p-68, -0x0.aef3ad9c69fc78p-77, // x in subrange 3:43 (1.67188..1.6875)
- 0x0.f4014d64596ad8p-18, -0x0.c62eeda1c79198p-26, 0x0.98070bec6e80e8p-34, -0x0.ddcfdb4792e148p-43, 0x0.9ab6894bfe3e50p-51, -0x0.cf3e020d404f78p-60, 0x0.85c20d874c9af0p-68, -0x0.a6ded1380e9e28p-77, // x in subrange 3:44 (1.6875..1.70312)
- 0x0.ef6a521b311ce8p-18, -0x0.c17fd996e856c8p-26, 0x0.93c3e5ee30b558p-34, -0x0.d6b0d9407558b0p-43, 0x0.9528ad5810f0c8p-51, -0x0.c7101d9f7d2420p-60, 0x0.80071535df22c8p-68, -0x0.9f2fb576784fe0p-77, // x in subrange 3:45 (1.70312..1.71875)
- 0x0.eaef0c18fd5ab0p-18, -0x0.bcf25207b81278p-26, 0x0.8fa3b690a6e588p-34, -0x0.cfd32af5e66130p-43, 0x0.8fd2d6b91fef90p-51, -0x0.bf3bc8364ce228p-60, 0x0.f51f1e078cf3b0p-69, -0x0.97e10ec0947808p-77, // x in subrange 3:46 (1.71875..1.73438)
- 0x0.e68eb54fdc0e10p-18, -0x0.b88544486aba80p-26, 0x0.8ba53da98e2b38p-34, -0x0.c9343e9f193c90p-43, 0x0.8ab2a1087784a0p-51, -0x0.b7bce55c5d0540p-60, 0x0.eab05b1d7be7b0p-69, -0x0.90eddbc1f7ea48p-77, // x in subrange 3:47 (1.73438..1.75)
- 0x0.e2488e04539dc0p-18, -0x0.b437a77bdfd240p-26, 0x0.87c747a0e7cbf8p-34, -0x0.c2d19e7e404cf8p-43, 0x0.85c5c3f0e9fcf0p-51, -0x0.b08f8c107af0a8p-60, 0x0.e0bb9e84e06498p-69, -0x0.8a5161255e6320p-77, // x in subrange 3:48 (1.75..1.76562)
- 0x0.de1bdc93a449e8p-18, -0x0.b0087c31387b70p-26, 0x0.8408ace7fe68f0p-34, -0x0.bca8ef98060e38p-43, 0x0.810a11d00a81b8p-51, -0x0.a9b0041c077dc8p-60, 0x0.d73af7e96d8b58p-69, -0x0.840725929ab280p-77, // x in subrange 3:49 (1.76562..1.78125)
- 0x0.da07ed3c5b5f20p-18, -0x0.abf6cc059c1f38p-26, 0x0.80685176ad6e68p-34, -0x0.b6b7f07b098b40p-43, 0x0.f8faecd30f1e38p-52, -0x0.a31ac38e8b90d8p-60, 0x0.ce28c549aab240p-69, -0x0.fc15dbd3c43880p-78, // x in subrange 3:50 (1.78125..1.79688)
- 0x0.d60c11e90fbca8p-18, -0x0.a801a949fad828p-26, 0x0.f9ca489d398e88p-35, -0x0.b0fc78168ace08p-43, 0x0.f03beb57513f20p-52, -0x0.9ccc6c5c4ee380p-60, 0x0.c57faeb7332868p-69, -0x0.f0b17371425bc8p-78, // x in subrange 3:51 (1.79688..1.8125)
- 0x0.d227a1fd304788p-18, -0x0.a4282eac9f2518p-26, 0x0.f2fc3e084dbb18p-35, -0x0.ab74749f7f44d0p-43, 0x0.e7d35508021490p-52, -0x0.96c1ca1df29550p-60, 0x0.bd3aa254d43b60p-69, -0x0.e5d97fc88ef290p-78, // x in subrange 3:52 (1.8125..1.82812)
- 0x0.ce59fa23cdf4b8p-18, -0x0.a0697ee662ae60p-26, 0x0.ec648a99457a90p-35, -0x0.a61dea8350eef0p-43, 0x0.dfbd8b86ef35e0p-52, -0x0.90f7cfef2f6f98p-60, 0x0.b554d08edc8c10p-69, -0x0.db86d70f652cf0p-78, // x in subrange 3:53 (1.82812..1.84375)
- 0x0.caa27c204c1720p-18, -0x0.9cc4c46b5c0800p-26, 0x0.e60149239f8ef0p-35, -0x0.a0f6f367955ad8p-43, 0x0.d7f71a219e4b60p-52, -0x0.8b6b966af44690p-60, 0x0.adc9a88a29f2f8p-69, -0x0.d1b2b2002fa9d8p-78, // x in subrange 3:54 (1.84375..1.85938)
- 0x0.c7008ea0e294e8p-18, -0x0.9939311edd63f8p-26, 0x0.dfd0a714479260p-35, -0x0.9bfdbd361323c8p-43, 0x0.d07cb3d1d0aa08p-52, -0x0.861a59c33b9a00p-60, 0x0.a694d4c6b9ac50p-69, -0x0.c856a64cfebc18p-78, // x in subrange 3:55 (1.85938..1.875)
- 0x0.c3739d12de9138p-18, -0x0.95c5fe0a9e1300p-26, 0x0.d9d0e3ab7f0558p-35, -0x0.9730893475b678p-43, 0x0.c94b3158006718p-52, -0x0.810177f308ad10p-60, 0x0.9fb237f2b17dd0p-69, -0x0.bf6ca16626f990p-78, // x in subrange 3:56 (1.875..1.89062)
- 0x0.bffb17788ef800p-18, -0x0.926a6b18ea8620p-26, 0x0.d4004f3fa16ae8p-35, -0x0.928dab2717b958p-43, 0x0.c25f8f6e7320e0p-52, -0x0.f83cde1227a998p-61, 0x0.991de9eb084028p-69, -0x0.b6eee38f6702a0p-78, // x in subrange 3:57 (1.89062..1.90625)
- 0x0.bc967240cb2d28p-18, -0x0.8f25bed1b83e98p-26, 0x0.ce5d4a88576508p-35, -0x0.8e13887e548f50p-43, 0x0.bbb6ed1392ae60p-52, -0x0.eeddb71387ab78p-61, 0x0.92d434e720e348p-69, -0x0.aed7fb3ec70c88p-78, // x in subrange 3:58 (1.90625..1.92188)
- 0x0.b945262002ea90p-18, -0x0.8bf7461a7cbf60p-26, 0x0.c8e645f1d237a8p-35, -0x0.89c0978dd911d0p-43, 0x0.b54e89ea4eb568p-52, -0x0.e5e0edce4dcc30p-61, 0x0.8cd192ccd4da80p-69, -0x0.a722c0c0b2d0b0p-78, // x in subrange 3:59 (1.92188..1.9375)
- 0x0.b606afeac71ac8p-18, -0x0.88de53f8a822e0p-26, 0x0.c399c0f7ae4368p-35, -0x0.85935ecd72d6d8p-43, 0x0.af23c4af5bd700p-52, -0x0.dd422c1b62ca00p-61, 0x0.8712aaaa920bc0p-69, -0x0.9fca521d177838p-78, // x in subrange 3:60 (1.9375..1.95312)
- 0x0.b2da9071bc33e8p-18, -0x0.85da4156a573e8p-26, 0x0.be7649871fed08p-35, -0x0.818a7422e42a60p-43, 0x0.a93419c235cce0p-52, -0x0.d4fd5009354178p-61, 0x0.81944e555510a8p-69, -0x0.98ca0f399343f0p-78, // x in subrange 3:61 (1.95312..1.96875)
- 0x0.afc04c5ee746d8p-18, -0x0.82ea6ccb445170p-26, 0x0.b97a7b68130980p-35, -0x0.fb48f86892a1c0p-44, 0x0.a37d21c0d98398p-52, -0x0.cd0e6941826a90p-61, 0x0.f8a6f050d5f5a8p-70, -0x0.921d96350465c0p-78, // x in subrange 3:62 (1.96875..1.98438)
- 0x0.acb76c14479d00p-18, -0x0.800e3a6370bb90p-26, 0x0.b4a4fface948c0p-35, -0x0.f3c05385437f10p-44, 0x0.9dfc90353b0598p-52, -0x0.c571b692215fb8p-61, 0x0.ee9a91ca0c0910p-70, -0x0.8bc0bff9000900p-78, // x in subrange 3:63 (1.98438..2)
- 0x0.a849b9e216eb68p-16, -0x0.f7ceed15963638p-24, 0x0.ada9d1a8d8ead8p-31, -0x0.e8ec18eaf1f630p-39, 0x0.961ced98c68fe8p-46, -0x0.ba99034e7eff48p-54, 0x0.e05a7a518e1c30p-62, -0x0.82c3931785b268p-69, // x in subrange 4:0 (2..2.03125)
- 0x0.a29ae0c2b2f128p-16, -0x0.ed3ba8c3061b18p-24, 0x0.a4d5659b9b4770p-31, -0x0.db50d5ac10a3a8p-39, 0x0.8c481609530c70p-46, -0x0.ad226ba9c270f0p-54, 0x0.cec0c8f1143340p-62, -0x0.ef72491068b1f8p-70, // x in subrange 4:1 (2.03125..2.0625)
- 0x0.9d29dbc5b33180p-16, -0x0.e33182cc790d98p-24, 0x0.9c848b45e137e8p-31, -0x0.ce98ed12c35ac8p-39, 0x0.83284045c68758p-46, -0x0.a0b960a0d17aa8p-54, 0x0.bea26706ec1958p-62, -0x0.db598871a8d640p-70, // x in subrange 4:2 (2.0625..2.09375)
- 0x0.97f38c54c53cc0p-16, -0x0.d9a8876753cb98p-24, 0x0.94aeb3b5203370p-31, -0x0.c2b412c75919a8p-39, 0x0.f55e9ef0a53010p-47, -0x0.9547422b1b5168p-54, 0x0.afdd54eb8a0e10p-62, -0x0.c90c942e365e48p-70, // x in subrange 4:3 (2.09375..2.125)
- 0x0.92f501ff848140p-16, -0x0.d09946c2ce1ad8p-24, 0x0.8d4bec8510d558p-31, -0x0.b7933ec139e970p-39, 0x0.e5a0aa4f3da3d0p-47, -0x0.8ab775f132cac0p-54, 0x0.a252cc4e0086f0p-62, -0x0.b85ff19ce927a0p-70, // x in subrange 4:4 (2.125..2.15625)
- 0x0.8e2b778033ad90p-16, -0x0.c7fccba184c040p-24, 0x0.8654d3be026650p-31, -0x0.ad289236fa17a8p-39, 0x0.d6feec879cd980p-47, -0x0.80f7365792a320p-54, 0x0.95e6edd6f49230p-62, -0x0.a92c79d99a0e90p-70, // x in subrange 4:5 (2.15625..2.1875)
- 0x0.89944ff6a6dce8p-16, -0x0.bfcc92acf300e0p-24, 0x0.ff85196b282e48p-32, -0x0.a3673ef62c6b10p-39, 0x0.c963a57c646910p-47, -0x0.efeaccd1b45458p-55, 0x0.8a80776825c9a0p-62, -0x0.9b4ee63f81c400p-70, // x in subrange 4:6 (2.1875..2.21875)
- 0x0.852d1455321d08p-16, -0x0.b8028273678bb0p-24, 0x0.f31d6bb5da32b0p-32, -0x0.9a4370e9088a90p-39, 0x0.bcbaded61cd698p-47, -0x0.df44d43ad05be0p-55, 0x0.80088207f17308p-62, -0x0.8ea76976edf208p-70, // x in subrange 4:7 (2.21875..2.25)
- 0x0.80f370fbc83c20p-16, -0x0.b098e402659cf8p-24, 0x0.e766beb36573f8p-32, -0x0.91b23995b6e698p-39, 0x0.b0f243e7292598p-47, -0x0.cfe00518c7f158p-55, 0x0.ecd48d4713c2f8p-63, -0x0.831953a9a8ec78p-70, // x in subrange 4:8 (2.25..2.28125)
- 0x0.f9ca66fb8cc928p-17, -0x0.a98a5c109f77d8p-24, 0x0.dc560501d69840p-32, -0x0.89a97d68373360p-39, 0x0.a5f8fd485d1270p-47, -0x0.c1a25b3da6e888p-55, 0x0.db25d1d56999b8p-63, -0x0.f1158138949180p-71, // x in subrange 4:9 (2.28125..2.3125)
- 0x0.f200911e652758p-17, -0x0.a2d1e4abd63080p-24, 0x0.d1e0f3b9774d90p-32, -0x0.821fe29c726c58p-39, 0x0.9bbf8fd1204638p-47, -0x0.b47411d1049f38p-55, 0x0.cae28f3a5323a0p-63, -0x0.ddc89d209515a8p-71, // x in subrange 4:10 (2.3125..2.34375)
- 0x0.ea85742cec2b48p-17, -0x0.9c6ac75fef1410p-24, 0x0.c7fdf3e7008838p-32, -0x0.f61983445820b8p-40, 0x0.9237be97922d40p-47, -0x0.a83f6ea8c575f8p-55, 0x0.bbeba368e5ded8p-63, -0x0.cc21b9e79262b0p-71, // x in subrange 4:11 (2.34375..2.375)
- 0x0.e3555abfb50120p-17, -0x0.965097cd7b5810p-24, 0x0.bea415305e4928p-32, -0x0.e8d02db0799718p-40, 0x0.89546fada631b8p-47, -0x0.9cf092b5b47d90p-55, 0x0.ae24bfcba75488p-63, -0x0.bbfaa402197ca0p-71, // x in subrange 4:12 (2.375..2.40625)
- 0x0.dc6cc2e08f58a0p-17, -0x0.907f2ea6c57560p-24, 0x0.b5cb018a70f380p-32, -0x0.dc54eaffad4748p-40, 0x0.81099357cc1298p-47, -0x0.92754f007a31d0p-55, 0x0.a174240cbb67e0p-63, -0x0.ad30cd12bdefd8p-71, // x in subrange 4:13 (2.40625..2.4375)
- 0x0.d5c85ae9e8bda0p-17, -0x0.8af2a50b3ac170p-24, 0x0.ad6af1e88ab2e0p-32, -0x0.d099f797247868p-40, 0x0.f2981b010b3ec0p-48, -0x0.88bcfdc15a9218p-55, 0x0.95c25fd0d5d870p-63, -0x0.9fa4ee7ae6a1d0p-71, // x in subrange 4:14 (2.4375..2.46875)
- 0x0.cf64fe9bd47ef8p-17, -0x0.85a75039b95880p-24, 0x0.a57ca3d0810d68p-32, -0x0.c5928fe16e0df8p-40, 0x0.e4234264c22528p-48, -0x0.ff70be5305a000p-56, 0x0.8afa1aaa51b580p-63, -0x0.933ab5b2c5a070p-71, // x in subrange 4:15 (2.46875..2.5)
- 0x0.c93fb462d110e8p-17, -0x0.8099bd92ebf2f0p-24, 0x0.9df94fc0112678p-32, -0x0.bb32dc473aaae8p-40, 0x0.d6a1bbce837e30p-48, -0x0.eeb2f2ff63cc00p-56, 0x0.8107e19e362c70p-63, -0x0.87d87957987e80p-71, // x in subrange 4:16 (2.5..2.53125)
- 0x0.c355aaccb063c0p-17, -0x0.f78d5dcae095b0p-25, 0x0.96daa0520d92e0p-32, -0x0.b16fded470faf0p-40, 0x0.ca021d01834dd0p-48, -0x0.df26f877ae4cc8p-56, 0x0.efb3f34e0878f8p-64, -0x0.facdebfc6a0408p-72, // x in subrange 4:17 (2.53125..2.5625)
- 0x0.bda4362850a098p-17, -0x0.ee562dfc155788p-25, 0x0.901aaa135b7dc0p-32, -0x0.a83f62639e1cf0p-40, 0x0.be345383ab6118p-48, -0x0.d0b54bac020cb0p-56, 0x0.dec06d62643a80p-64, -0x0.e7a223e6585838p-72, // x in subrange 4:18 (2.5625..2.59375)
- 0x0.b828ce4d14b660p-17, -0x0.e5882ced46b520p-25, 0x0.89b3e3f92e59d8p-32, -0x0.9f97eb2d5a5e18p-40, 0x0.b329884b933510p-48, -0x0.c3485809879008p-56, 0x0.cf17ad36e97878p-64, -0x0.d6074e53c8e440p-72, // x in subrange 4:19 (2.59375..2.625)
- 0x0.b2e10c8748a398p-17, -0x0.dd1df17e73a960p-25, 0x0.83a1206b392408p-32, -0x0.9770a89c6d83d8p-40, 0x0.a8d405e859eb88p-48, -0x0.b6cc4c5c6ca980p-56, 0x0.c09ebfa336de80p-64, -0x0.c5daa562abb2b8p-72, // x in subrange 4:20 (2.625..2.65625)
- 0x0.adcaa9a6d4ee20p-17, -0x0.d51262b8beeb58p-25, 0x0.fbbb0dab6b3900p-33, -0x0.8fc1684a60f810p-40, 0x0.9f2720e8e4dd70p-48, -0x0.ab2ef3a9b72118p-56, 0x0.b33d0647fa4b28p-64, -0x0.b6fc922fcb6488p-72, // x in subrange 4:21 (2.65625..2.6875)
- 0x0.a8e37c2dd7b328p-17, -0x0.cd60b2ae4f8a08p-25, 0x0.f0c91b705f9850p-33, -0x0.88828a0ac96a88p-40, 0x0.9617224db0aa28p-48, -0x0.a05f919eb9c900p-56, 0x0.a6dc010ee549a8p-64, -0x0.a9505e710ee338p-72, // x in subrange 4:22 (2.6875..2.71875)
- 0x0.a429769ce88b10p-17, -0x0.c60459b5a2b048p-25, 0x0.e663ea4df2a5d0p-33, -0x0.81acf4edec39c8p-40, 0x0.8d9933d57ac870p-48, -0x0.964ec23de4e670p-56, 0x0.9b671ce576c668p-64, -0x0.9cbbedf40d8f30p-72, // x in subrange 4:23 (2.71875..2.75)
- 0x0.9f9aa5daf78270p-17, -0x0.bef911f96f1c80p-25, 0x0.dc83836c0d7ef8p-33, -0x0.f6741a4b0b6b30p-41, 0x0.85a34df99e2238p-48, -0x0.8cee5c798df3b0p-56, 0x0.90cb872c254c30p-64, -0x0.91277f2cdd3f80p-72, // x in subrange 4:24 (2.75..2.78125)
- 0x0.9b352fb6def738p-17, -0x0.b83ad356c84758p-25, 0x0.d3206f89876bd8p-33, -0x0.ea475570c3cc10p-41, 0x0.fc584ee6381390p-49, -0x0.843157753f03f0p-56, 0x0.86f805618a5b98p-64, -0x0.867d7218282c00p-72, // x in subrange 4:25 (2.78125..2.8125)
- 0x0.96f75180e48cb0p-17, -0x0.b1c5cf83b08ea0p-25, 0x0.ca33ae4645bfc8p-33, -0x0.dec821e66e5f70p-41, 0x0.ee564c4a005528p-49, -0x0.f817645a7b12b8p-57, 0x0.fbb9a13b780ef8p-65, -0x0.f95429904170b0p-73, // x in subrange 4:26 (2.8125..2.84375)
- 0x0.92df5eba86e2a0p-17, -0x0.ab966e78c01810p-25, 0x0.c1b6ae11ac8c78p-33, -0x0.d3ebcd0d8b3630p-41, 0x0.e130a29849fda8p-49, -0x0.e8e4ba94b41850p-57, 0x0.ead6e8fa649da8p-65, -0x0.e736ea0c4148a0p-73, // x in subrange 4:27 (2.84375..2.875)
- 0x0.8eebbfdb1491c0p-17, -0x0.a5a94b18f27d08p-25, 0x0.b9a344b06aac20p-33, -0x0.c9a85c8955c8e0p-41, 0x0.d4d889aec12d58p-49, -0x0.dab64ddba60fa8p-57, 0x0.db2d624921a988p-65, -0x0.d6826d05dae410p-73, // x in subrange 4:28 (2.875..2.90625)
- 0x0.8b1af127a553b0p-17, -0x0.9ffb3013109378p-25, 0x0.b1f3a84dc1c070p-33, -0x0.bff480db4d1d78p-41, 0x0.c9404b9bafb728p-49, -0x0.cd79508c6dbb80p-57, 0x0.cca4c01f2c73b0p-65, -0x0.c718da3bf34618p-73, // x in subrange 4:29 (2.90625..2.9375)
- 0x0.876b819d2868e0p-17, -0x0.9a8914f8869d20p-25, 0x0.aaa2690d6837c8p-33, -0x0.b6c7890a6ab6f8p-41, 0x0.be5b2f575186a8p-49, -0x0.c11c69859785d8p-57, 0x0.bf26b6cace1cf0p-65, -0x0.b8def5b17e69f8p-73, // x in subrange 4:30 (2.9375..2.96875)
- 0x0.83dc11eb536ea8p-17, -0x0.95501b85ca8ae8p-25, 0x0.a3aa6b140a88c8p-33, -0x0.ae19573ef79638p-41, 0x0.b41d653ea21b70p-49, -0x0.b58f957e4e4e88p-57, 0x0.b29ecf270c5e98p-65, -0x0.abbbe22d553f68p-73, // x in subrange 4:31 (2.96875..3)
- 0x0.806b537f531908p-17, -0x0.904d8d18c28170p-25, 0x0.9d06e0fd43ac60p-33, -0x0.a5e2563edcb9f0p-41, 0x0.aa7bf5286ad878p-49, -0x0.aac40b08aa2fc0p-57, 0x0.a6fa3dee4e9ff8p-65, -0x0.9f98e9a84ff618p-73, // x in subrange 4:32 (3..3.03125)
- 0x0.fa300f3a679b38p-18, -0x0.8b7ed851e1fcc0p-25, 0x0.96b346b6a55138p-33, -0x0.9e1b6fb80d35e8p-41, 0x0.a16cadf0f3c308p-49, -0x0.a0ac21008dd5c0p-57, 0x0.9c27bec46f7d30p-65, -0x0.94614b10c4eb58p-73, // x in subrange 4:33 (3.03125..3.0625)
- 0x0.f3c1fd0e162340p-18, -0x0.86e18edcf46500p-25, 0x0.90ab5cb817ffa8p-33, -0x0.96be03483f8b60p-41, 0x0.98e6165bf97980p-49, -0x0.973b372e827d88p-57, 0x0.9217729d1f9ef0p-65, -0x0.8a020cda925800p-73, // x in subrange 4:34 (3.0625..3.09375)
- 0x0.ed8a2d61f882e0p-18, -0x0.8273635ec71748p-25, 0x0.8aeb23927bf348p-33, -0x0.8fc3de329e5718p-41, 0x0.90df5f2f7c8a40p-49, -0x0.8e65a0eb6a0540p-57, 0x0.88bac12c9b2688p-65, -0x0.8069d3e1205d58p-73, // x in subrange 4:35 (3.09375..3.125)
- 0x0.e7867802866a90p-18, -0x0.fc644f0a369988p-26, 0x0.856ed7ce063090p-33, -0x0.892733b56939f8p-41, 0x0.8950566ca7e740p-49, -0x0.86209196bbcc88p-57, 0x0.80043d18dc7e58p-65, -0x0.ef117c5b092018p-74, // x in subrange 4:36 (3.125..3.15625)
- 0x0.e1b4ce36fcd950p-18, -0x0.f437946cf499b8p-26, 0x0.8032ee125b8e20p-33, -0x0.82e295f2b149f0p-41, 0x0.82315b8e751af0p-49, -0x0.fcc4156ac58718p-58, 0x0.efcf155190af08p-66, -0x0.dea0827c9820e0p-74, // x in subrange 4:37 (3.15625..3.1875)
- 0x0.dc13396d005f40p-18, -0x0.ec5cabbf68ad60p-26, 0x0.f6681f25cc6410p-34, -0x0.f9e1dec0e67338p-42, 0x0.f6f6a96fc71a78p-50, -0x0.ee4197268b8890p-58, 0x0.e0b2916abc9e90p-66, -0x0.cf6616f129c4c8p-74, // x in subrange 4:38 (3.1875..3.21875)
- 0x0.d69fd9f7f5c320p-18, -0x0.e4cfddb9fa05a8p-26, 0x0.ecde2d74a4c510p-34, -0x0.ee9af96a9ead00p-42, 0x0.ea4f497b249e88p-50, -0x0.e0a8848a252798p-58, 0x0.d29df74db9b420p-66, -0x0.c149d0e65aa440p-74, // x in subrange 4:39 (3.21875..3.25)
- 0x0.d158e5e2d13470p-18, -0x0.dd8da3f97daa08p-26, 0x0.e3c218210ce5c0p-34, -0x0.e3e78e900dad90p-42, 0x0.de6043f0ad6458p-50, -0x0.d3e8fbd633c628p-58, 0x0.c57df49a201cf0p-66, -0x0.b4354fa90efbe8p-74, // x in subrange 4:40 (3.25..3.28125)
- 0x0.cc3ca7d3322498p-18, -0x0.d692a634c731b0p-26, 0x0.db0e46ad8fb5d8p-34, -0x0.d9bf3fb17195f0p-42, 0x0.d31e1ba01407e8p-50, -0x0.c7f44431e0ecd8p-58, 0x0.b940b8cd844500p-66, -0x0.a8140d0715b0a8p-74, // x in subrange 4:41 (3.28125..3.3125)
- 0x0.c7497dfcb63530p-18, -0x0.cfdbb79ee06af0p-26, 0x0.d2bd71ac2be238p-34, -0x0.d01a3377329b88p-42, 0x0.c87e19de84a600p-50, -0x0.bcbcb6904ec770p-58, 0x0.add5d56110e348p-66, -0x0.9cd333e38b74a8p-74, // x in subrange 4:42 (3.3125..3.34375)
- 0x0.c27dd923808048p-18, -0x0.c965d472e23dc8p-26, 0x0.caca9db823f3d0p-34, -0x0.c6f10cbb19e9f8p-42, 0x0.be7640240194f8p-50, -0x0.b235a87d94c850p-58, 0x0.a32e20adfb5e10p-66, -0x0.92617a9696a720p-74, // x in subrange 4:43 (3.34375..3.375)
- 0x0.bdd83bad03f710p-18, -0x0.c32e1fa6a14e40p-26, 0x0.c33116c629de50p-34, -0x0.be3ce237653ba0p-42, 0x0.b4fd3ac52ee860p-50, -0x0.a85358a8ec1620p-58, 0x0.993b9b57da13c8p-66, -0x0.88af00bb72b670p-74, // x in subrange 4:44 (3.375..3.40625)
- 0x0.b95738be2fc538p-18, -0x0.bd31e0c194bf50p-26, 0x0.bbec6bc4ac2cf8p-34, -0x0.b5f736ceefbb80p-42, 0x0.ac0a54b245e768p-50, -0x0.9f0add058c4ea0p-58, 0x0.8ff1580219a300p-66, -0x0.ff5a603216d730p-75, // x in subrange 4:45 (3.40625..3.4375)
- 0x0.b4f973662bb1c0p-18, -0x0.b76e81d58d54f8p-26, 0x0.b4f86a86857ba0p-34, -0x0.ae19f262b3d7b0p-42, 0x0.a3956c25ebb740p-50, -0x0.9652125f37c380p-58, 0x0.8743651b6582f0p-66, -0x0.ee9d40b376e3b0p-75, // x in subrange 4:46 (3.4375..3.46875)
- 0x0.b0bd9dd4e067e0p-18, -0x0.b1e18d96ff6670p-26, 0x0.ae511bf2bf6da0p-34, -0x0.a69f5b29ddc260p-42, 0x0.9b96e8307a05d0p-50, -0x0.8e1f8d42a00468p-58, 0x0.fe4d711dc306d8p-67, -0x0.df0dfa9c7066d0p-75, // x in subrange 4:47 (3.46875..3.5)
- 0x0.aca2789c948978p-18, -0x0.ac88ad92cae3a8p-26, 0x0.a7f2c07481bb78p-34, -0x0.9f820f82858e88p-42, 0x0.9407af0df1e3c0p-50, -0x0.866a8c1ca8afc0p-58, 0x0.ef223a5f377c98p-67, -0x0.d095defcceaf10p-75, // x in subrange 4:48 (3.5..3.53125)
- 0x0.a8a6d1fdf37598p-18, -0x0.a761a87f926c20p-26, 0x0.a1d9cca6a4fe28p-34, -0x0.98bd0031f3fa58p-42, 0x0.8ce11d36543480p-50, -0x0.fe55d4ec4d6140p-59, 0x0.e0f2436d6c7998p-67, -0x0.c3200da1b98f30p-75, // x in subrange 4:49 (3.53125..3.5625)
- 0x0.a4c9853dddde28p-18, -0x0.a26a60a8d55478p-26, 0x0.9c02e636b84ce8p-34, -0x0.924b6b0c0fcd10p-42, 0x0.861cfd197bb9a0p-50, -0x0.f0b22a68280ba0p-59, 0x0.d3ac1260f16fa0p-67, -0x0.b6994e2e4b92e8p-75, // x in subrange 4:50 (3.5625..3.59375)
- 0x0.a1097a046ead90p-18, -0x0.9da0d27220b958p-26, 0x0.966ae0fb9932f8p-34, -0x0.8c28d5fa3cb788p-42, 0x0.ff6afef1ac0610p-51, -0x0.e3dbff8ca3fe68p-59, 0x0.c73f796f9fc370p-67, -0x0.aaefeca3be1b80p-75, // x in subrange 4:51 (3.59375..3.625)
- 0x0.9d65a3c4a86b88p-18, -0x0.990312f0c99618p-26, 0x0.910ebc3c078fd8p-34, -0x0.86510a5a914fc0p-42, 0x0.f34a68a4fabea0p-51, -0x0.d7c63462060a20p-59, 0x0.bb9d7cc583ca78p-67, -0x0.a0139907dea918p-75, // x in subrange 4:52 (3.625..3.65625)
- 0x0.99dd012c484e68p-18, -0x0.948f4e9abd74a0p-26, 0x0.8beba021e32308p-34, -0x0.80c010b0d94b18p-42, 0x0.e7ce08a481db38p-51, -0x0.cc648fbc8cb7b0p-59, 0x0.b0b83a8a2f28f0p-67, -0x0.95f549e05758d0p-75, // x in subrange 4:53 (3.65625..3.6875)
- 0x0.966e9b9b448908p-18, -0x0.9043c80910dec8p-26, 0x0.86fedb56ff5690p-34, -0x0.f6e45946b96518p-43, 0x0.dcec557c371158p-51, -0x0.c1abae4f70b970p-59, 0x0.a682d4e1dd3f68p-67, -0x0.8c872140621f08p-75, // x in subrange 4:54 (3.6875..3.71875)
- 0x0.931986a2833150p-18, -0x0.8c1ed6cd0a6a70p-26, 0x0.8245e0c8b3bfa0p-34, -0x0.ecc7b27bbaf088p-43, 0x0.d29c5fa8f12aa0p-51, -0x0.b790f311187ac0p-59, 0x0.9cf15dbe4391a8p-67, -0x0.83bc542cd76fd0p-75, // x in subrange 4:55 (3.71875..3.75)
- 0x0.8fdcdf895e5fa0p-18, -0x0.881ee6567f2da8p-26, 0x0.fb7c8b1f0a5ab8p-35, -0x0.e3238aeb571bd8p-43, 0x0.c8d5c726e17690p-51, -0x0.ae0a78d4caa8f0p-59, 0x0.93f8c456ecce68p-67, -0x0.f7122840811e50p-76, // x in subrange 4:56 (3.75..3.78125)
- 0x0.8cb7ccd990ed70p-18, -0x0.844274ea69c128p-26, 0x0.f2cb7df0e8b1f0p-35, -0x0.d9f1a1d42a7228p-43, 0x0.bf90b1c1c3f638p-51, -0x0.a50f0500900670p-59, 0x0.8b8ec424a02668p-67, -0x0.e7c4f4fb78ac28p-76, // x in subrange 4:57 (3.78125..3.8125)
- 0x0.89a97df12d88b0p-18, -0x0.808812a8b7d7f8p-26, 0x0.ea74415b597088p-35, -0x0.d12c11b9ad63f8p-43, 0x0.b6c5c217e00a00p-51, -0x0.9c95fb4821ed70p-59, 0x0.83a9d53ea197e8p-67, -0x0.d97ceb8c5380d0p-76, // x in subrange 4:58 (3.8125..3.84375)
- 0x0.86b12a9a47b3f0p-18, -0x0.f9dcc140b7e688p-27, 0x0.e272b5f8efc428p-35, -0x0.c8cd4abd039dc8p-43, 0x0.ae6e0f42293938p-51, -0x0.94975257bdd200p-59, 0x0.f8823bf726ce40p-68, -0x0.cc2770ce76bdd0p-76, // x in subrange 4:59 (3.84375..3.875)
- 0x0.83ce12a7fbc9d0p-18, -0x0.f2e81fe181f600p-27, 0x0.dac2f26d015b40p-35, -0x0.c0d00d564a83e0p-43, 0x0.a6831d14eb06b8p-51, -0x0.8d0b895b838e20p-59, 0x0.ea98cb74e9e698p-68, -0x0.bfb351ffbb7b18p-76, // x in subrange 4:60 (3.875..3.90625)
- 0x0.80ff7d98883830p-18, -0x0.ec2fc1ef992f98p-27, 0x0.d361405929f608p-35, -0x0.b92f656786b150p-43, 0x0.9efed4ed6e08b8p-51, -0x0.85eb9e51a88a48p-59, 0x0.dd8811755cdff8p-68, -0x0.b410a7f1871ee8p-76, // x in subrange 4:61 (3.90625..3.9375)
- 0x0.fc8974785de308p-19, -0x0.e5b14517565d80p-27, 0x0.cc4a19826c4548p-35, -0x0.b1e6a5a2d588c8p-43, 0x0.97db7f01f1cb08p-51, -0x0.fe620a2e918a18p-60, 0x0.d141d9d8a41980p-68, -0x0.a930bca5fd1540p-76, // x in subrange 4:62 (3.9375..3.96875)
- 0x0.f73a3cc1351100p-19, -0x0.df6a627f5ac598p-27, 0x0.c57a2522cd3180p-35, -0x0.aaf1633e027090p-43, 0x0.9113bc2a3053b8p-51, -0x0.f1ab3e41f78de0p-60, 0x0.c5b8ef477ecd40p-68, -0x0.9f05f322a7a6f8p-76, // x in subrange 4:63 (3.96875..4)
- 0x0.ef88756b3bf7c0p-17, -0x0.d66394bee419e0p-24, 0x0.bbc0cc16d0bd00p-31, -0x0.a114f9ff5852f8p-38, 0x0.8788d608f94580p-45, -0x0.dfe5391bdc5668p-53, 0x0.b5b7867d7fb9c0p-60, -0x0.9100eafbb56108p-67, // x in subrange 5:0 (4..4.0625)
- 0x0.e5c0a7d7463fd8p-17, -0x0.cb099e6dab93c0p-24, 0x0.afa67d984542b8p-31, -0x0.94ee3f4bb806b8p-38, 0x0.f7c708a2330880p-46, -0x0.ca683562350fb8p-53, 0x0.a285d14d55bdd8p-60, -0x0.805756dbb1b940p-67, // x in subrange 5:1 (4.0625..4.125)
- 0x0.dc7ca5a748b290p-17, -0x0.c069ed9a72ec50p-24, 0x0.a474a6266a53f8p-31, -0x0.89d16c90365f80p-38, 0x0.e2b5ce4cb5ccb0p-46, -0x0.b72d70e92d23b8p-53, 0x0.91861e8f57e838p-60, -0x0.e37767f023c188p-68, // x in subrange 5:2 (4.125..4.1875)
- 0x0.d3b4083d8dbfd8p-17, -0x0.b6769b9c7a2f78p-24, 0x0.9a1780f42718d0p-31, -0x0.ff4a7af2d994a8p-39, 0x0.cfa26bdeafa760p-46, -0x0.a5f31765b3e208p-53, 0x0.8273725d5abb48p-60, -0x0.c9d1dd4551b7c0p-68, // x in subrange 5:3 (4.1875..4.25)
- 0x0.cb5f089ff28f00p-17, -0x0.ad22eedda74dd8p-24, 0x0.907d27b5abf698p-31, -0x0.eca61e42aa24e0p-39, 0x0.be58101f43d488p-46, -0x0.967f5fc57c6d50p-53, 0x0.ea23ac588a5aa0p-61, -0x0.b3471c8a9acb20p-68, // x in subrange 5:4 (4.25..4.3125)
- 0x0.c3767208157798p-17, -0x0.a4633e86fedf70p-24, 0x0.8795610be58fe8p-31, -0x0.db8d28342e5888p-39, 0x0.aea7d79c042a88p-46, -0x0.889f8013990180p-53, 0x0.d25a320570c1b8p-61, -0x0.9f709a4ffac948p-68, // x in subrange 5:5 (4.3125..4.375)
- 0x0.bbf395b58f0400p-17, -0x0.9c2cd918e82b98p-24, 0x0.fea2e901f44e38p-32, -0x0.cbdb23576ea948p-39, 0x0.a06815b54659c8p-46, -0x0.f84d8caa502438p-54, 0x0.bd2f7caddf4f50p-61, -0x0.8df5cf1f5ef7c0p-68, // x in subrange 5:6 (4.375..4.4375)
- 0x0.b4d03fe12820f8p-17, -0x0.9475ed9ba9f0b0p-24, 0x0.ef4806d4046dd8p-32, -0x0.bd6f4a295ff4b8p-39, 0x0.9373b52c737180p-46, -0x0.e1dba1fe14c550p-54, 0x0.aa5428e044fb50p-61, -0x0.fd14654c3bff88p-69, // x in subrange 5:7 (4.4375..4.5)
- 0x0.ae06adb3ad6bf0p-17, -0x0.8d35771e955e28p-24, 0x0.e101cc30837f48p-32, -0x0.b02c1f8e254d48p-39, 0x0.87a9ad01106e80p-46, -0x0.cda3c4ee5f0ab0p-54, 0x0.9982d897ffc6b0p-61, -0x0.e1d709fb079ef0p-69, // x in subrange 5:8 (4.5..4.5625)
- 0x0.a79184263c6240p-17, -0x0.86632a45141068p-24, 0x0.d3ba19ae758050p-32, -0x0.a3f7137ebb1968p-39, 0x0.f9d90dbd9aba88p-47, -0x0.bb68978871d220p-54, 0x0.8a7edbf8ec63d0p-61, -0x0.c9c0b374acddc8p-69, // x in subrange 5:9 (4.5625..4.625)
- 0x0.a16bc7b4c1deb0p-17, -0x0.ffeec950e25768p-25, 0x0.c75cc88ae22618p-32, -0x0.98b8326160db10p-39, 0x0.e643e98586cf98p-47, -0x0.aaf3d6451abca8p-54, 0x0.fa2614f5452e70p-62, -0x0.b46db4e7079f60p-69, // x in subrange 5:10 (4.625..4.6875)
- 0x0.9b90d4cde63b90p-17, -0x0.f3d63bb7c64658p-25, 0x0.bbd779480488c8p-32, -0x0.8e59ddb86c9348p-39, 0x0.d464e7a5f51768p-47, -0x0.9c1577661b7d90p-54, 0x0.e2218aacd51d58p-62, -0x0.a187703ee5e298p-69, // x in subrange 5:11 (4.6875..4.75)
- 0x0.95fc58eddd5548p-17, -0x0.e86fb3cc6824f8p-25, 0x0.b119678b3179c8p-32, -0x0.84c88d002d0f60p-39, 0x0.c411f557543380p-47, -0x0.8ea2e7c2789b90p-54, 0x0.cc9e3a4f32db20p-62, -0x0.90c2881b073ae0p-69, // x in subrange 5:12 (4.75..4.8125)
- 0x0.90aa4c5388d9a0p-17, -0x0.ddaf3a130bf988p-25, 0x0.a71342a0099ea0p-32, -0x0.f7e52b766af9e8p-40, 0x0.b5256346bdc900p-47, -0x0.827660eff6b660p-54, 0x0.b9542b39569be8p-62, -0x0.81dd54d604c508p-69, // x in subrange 5:13 (4.8125..4.875)
- 0x0.8b96ec4119e170p-17, -0x0.d389c16c5e0448p-25, 0x0.9db70a1a439230p-32, -0x0.e78ff39b8ee9c0p-40, 0x0.a77d6777d39d60p-47, -0x0.eedcaa9eb18aa8p-55, 0x0.a80405bfae5938p-62, -0x0.e93d24eb12fcd0p-70, // x in subrange 5:14 (4.875..4.9375)
- 0x0.86beb5baeace88p-17, -0x0.c9f51313391e68p-25, 0x0.94f7ee1fa54f70p-32, -0x0.d87476cbb09d28p-40, 0x0.9afbae462190b0p-47, -0x0.dad9de027a9ff0p-55, 0x0.9875fa0cbba9f8p-62, -0x0.d1a87dd59a1eb0p-70, // x in subrange 5:15 (4.9375..5)
- 0x0.821e60b8a9ea48p-17, -0x0.c0e7bc7b4b6bc0p-25, 0x0.8cca32f1f7bc98p-32, -0x0.ca786b8c178588p-40, 0x0.8f84f89935aa30p-47, -0x0.c8af3e6cd68460p-55, 0x0.8a78ccc77c0ed8p-62, -0x0.bca542d34e7148p-70, // x in subrange 5:16 (5..5.0625)
- 0x0.fb65b77c4b4408p-18, -0x0.b858fedf87ae78p-25, 0x0.8523175d23e2b0p-32, -0x0.bd83f4bf000e08p-40, 0x0.8500c5a0dcb540p-47, -0x0.b82d775607b280p-55, 0x0.fbc2085690f278p-63, -0x0.a9e6e978ec52c8p-70, // x in subrange 5:17 (5.0625..5.125)
- 0x0.f2f28fa4424ad0p-18, -0x0.b040c054b600e0p-25, 0x0.fbf17b70fae1a0p-33, -0x0.b1816371d0e9f0p-40, 0x0.f6b20d4fa670f0p-48, -0x0.a92a50d5e3cc48p-55, 0x0.e5106209ee30c8p-63, -0x0.992a5eda193de8p-70, // x in subrange 5:18 (5.125..5.1875)
- 0x0.eadde9951f4d78p-18, -0x0.a8977e39390b68p-25, 0x0.ee842e676e0f98p-33, -0x0.a65cff63369458p-40, 0x0.e4f3b77844be60p-48, -0x0.9b801882622fa8p-55, 0x0.d0989f67e99168p-63, -0x0.8a34cacbaa7d48p-70, // x in subrange 5:19 (5.1875..5.25)
- 0x0.e322bbcce23eb0p-18, -0x0.a15640df5130b8p-25, 0x0.e1eda26090cba0p-33, -0x0.9c04d57a7b1c80p-40, 0x0.d4a2b02cf50578p-48, -0x0.8f0d1cd9e7f920p-55, 0x0.be1e7bbd8a05e8p-63, -0x0.f9a4fd635680c0p-71, // x in subrange 5:20 (5.25..5.3125)
- 0x0.dbbc4d5ca0bf18p-18, -0x0.9a769052df35e0p-25, 0x0.d61e88dea8d728p-33, -0x0.92688b81d27c38p-40, 0x0.c59e9a9c4e5f28p-48, -0x0.83b338d18ae960p-55, 0x0.ad6c840a1a3510p-63, -0x0.e1ac132688cbe8p-71, // x in subrange 5:21 (5.3125..5.375)
- 0x0.d4a6302a2427e0p-18, -0x0.93f26a1ef2dee8p-25, 0x0.cb08cbc4fe6dd0p-33, -0x0.8979388a8c18b0p-40, 0x0.b7ca390d13fa48p-48, -0x0.f2aedae7176648p-56, 0x0.9e534502fc7798p-63, -0x0.cc2ed84070ab58p-71, // x in subrange 5:22 (5.375..5.4375)
- 0x0.cddc3ba6c36228p-18, -0x0.8dc437fa5d1e30p-25, 0x0.c09f71e78131f8p-33, -0x0.812941749732c0p-40, 0x0.ab0b19bc321838p-48, -0x0.dfc30f84961440p-56, 0x0.90a893cd050df0p-63, -0x0.b8e6d03ec11660p-71, // x in subrange 5:23 (5.4375..5.5)
- 0x0.c75a87f12bf940p-18, -0x0.87e6c745145f40p-25, 0x0.b6d6863a5cdc38p-33, -0x0.f2d87245d15d68p-41, 0x0.9f494cfc8d9a20p-48, -0x0.ce77a2a38db5d0p-56, 0x0.8446edd7e98578p-63, -0x0.a795ced34fcb28p-71, // x in subrange 5:24 (5.5..5.5625)
- 0x0.c11d6958ca1510p-18, -0x0.82554142863eb8p-25, 0x0.ada3015c259880p-33, -0x0.e46d87e8cbf370p-41, 0x0.946f237ffe06b8p-48, -0x0.bea5947d84bb10p-56, 0x0.f219d991a8fbb8p-64, -0x0.9804ee4cf40620p-71, // x in subrange 5:25 (5.5625..5.625)
- 0x0.bb216c3a614028p-18, -0x0.fa1647fdfaef58p-26, 0x0.a4fab53ced51d0p-33, -0x0.d6fcfc4a918090p-41, 0x0.8a68f3d3f2f190p-48, -0x0.b029d6b0c8a298p-56, 0x0.ddb9979da91410p-64, -0x0.8a03a8f39ed308p-71, // x in subrange 5:26 (5.625..5.6875)
- 0x0.b563512e32eab8p-18, -0x0.f00877a02953c8p-26, 0x0.9cd43aab560020p-33, -0x0.ca73c98f6b60f8p-41, 0x0.8124e63acb5050p-48, -0x0.a2e4def0d0cce8p-56, 0x0.cb37f83319b488p-64, -0x0.face20f1b50738p-72, // x in subrange 5:27 (5.6875..5.75)
- 0x0.afe00980c60990p-18, -0x0.e6793ac39b3528p-26, 0x0.9526e096ae04e8p-33, -0x0.bec0821762af40p-41, 0x0.f1258c4ad7afd8p-49, -0x0.96ba464fce51b8p-56, 0x0.ba658cf565aa20p-64, -0x0.e4123ebe54dcd0p-72, // x in subrange 5:28 (5.75..5.8125)
- 0x0.aa94b3f0073ef0p-18, -0x0.dd614086ad3338p-26, 0x0.8dea9cda6baa88p-33, -0x0.b3d32b2dcbc520p-41, 0x0.e147b14f6aed60p-49, -0x0.8b907397f50d98p-56, 0x0.ab17f0ff0e3bc0p-64, -0x0.cf9041a2e57f00p-72, // x in subrange 5:29 (5.8125..5.875)
- 0x0.a57e99a70ca3b0p-18, -0x0.d4b9b3cfa3f248p-26, 0x0.8717fe6c099ef8p-33, -0x0.a99d1b67e33ac8p-41, 0x0.d2956ead2d81c8p-49, -0x0.81504f5d9c6618p-56, 0x0.9d293714a6b318p-64, -0x0.bd0c57c7915b58p-72, // x in subrange 5:30 (5.875..5.9375)
- 0x0.a09b2b734d4ce0p-18, -0x0.cc7c3221352008p-26, 0x0.80a820c86aa158p-33, -0x0.a010dc4eb38028p-41, 0x0.c4f65e1ff3bac8p-49, -0x0.efca013e2cb000p-57, 0x0.9077694cf8bc08p-64, -0x0.ac515f48917608p-72, // x in subrange 5:31 (5.9375..6)
- 0x0.9be7ff2e9499d0p-18, -0x0.c4a2c32f102180p-26, 0x0.f52941032e1510p-34, -0x0.97220efbb84e98p-41, 0x0.b8544478398438p-49, -0x0.de7761d9ff2828p-57, 0x0.84e417fa4a0968p-64, -0x0.9d301b7f7d2198p-72, // x in subrange 5:32 (6..6.0625)
- 0x0.9762cd596592b8p-18, -0x0.bd27d1214438e8p-26, 0x0.e9af21a1d36e70p-34, -0x0.8ec553599be788p-41, 0x0.ac9adc4a7efc38p-49, -0x0.ce86ae6d4b9ef8p-57, 0x0.f4a7ebd6eba508p-65, -0x0.8f7e839af9ec78p-72, // x in subrange 5:33 (6.0625..6.125)
- 0x0.93096ee1e46048p-18, -0x0.b606217708f5a8p-26, 0x0.ded6e4294f6a00p-34, -0x0.86f031c3248f00p-41, 0x0.a1b7a61c8ad6c0p-49, -0x0.bfd910e54ac0d8p-57, 0x0.e15d00b7d70ae8p-65, -0x0.831727339a5148p-72, // x in subrange 5:34 (6.125..6.1875)
- 0x0.8ed9db13b44250p-18, -0x0.af38ce7ae906a8p-26, 0x0.d496524523c748p-34, -0x0.ff320d8438ddc8p-42, 0x0.9799bd7645ac08p-49, -0x0.b2529ae94c56e8p-57, 0x0.cfbb62424d5a08p-65, -0x0.efb14c0263fed8p-73, // x in subrange 5:35 (6.1875..6.25)
- 0x0.8ad225ad885a88p-18, -0x0.a8bb413ba3dd38p-26, 0x0.cae3eeb6963d68p-34, -0x0.f16de16d974720p-42, 0x0.8e31b24dd339d0p-49, -0x0.a5d9faad5a1cc8p-57, 0x0.bf9b73a8405030p-65, -0x0.db4a706f6a78a0p-73, // x in subrange 5:36 (6.25..6.3125)
- 0x0.86f07d196e0100p-18, -0x0.a2892bfe4c3ad8p-26, 0x0.c1b6e6d8f1ccf8p-34, -0x0.e4837e6d3fe460p-42, 0x0.857166564d0e30p-49, -0x0.9a5837de75b938p-57, 0x0.b0d98dbd46ce50p-65, -0x0.c8c48ad0b16fa8p-73, // x in subrange 5:37 (6.3125..6.375)
- 0x0.833328c518ecc0p-18, -0x0.9c9e851f3c8780p-26, 0x0.b9070562ae8948p-34, -0x0.d863c7ebe08140p-42, 0x0.fa97db8cab3d60p-50, -0x0.8fb877bb9a4f78p-57, 0x0.a35592f08eb6f0p-65, -0x0.b7f0101a61fbf0p-73, // x in subrange 5:38 (6.375..6.4375)
- 0x0.ff310f2f69e528p-19, -0x0.96f7825870fe50p-26, 0x0.b0cca646329f78p-34, -0x0.cd00ca2b01acb8p-42, 0x0.eb6ae66fc49250p-50, -0x0.85e7c78b34b168p-57, 0x0.96f28f7ba67dc8p-65, -0x0.a8a2784995c200p-73, // x in subrange 5:39 (6.4375..6.5)
- 0x0.f83e1d05ee29a8p-19, -0x0.91909464b64e68p-26, 0x0.a900ab97c7db98p-34, -0x0.c24da16136efd0p-42, 0x0.dd463c9a990d90p-50, -0x0.f9a9d96b653198p-58, 0x0.8b9664517e1710p-65, -0x0.9ab5aef343da28p-73, // x in subrange 5:40 (6.5..6.5625)
- 0x0.f18a8e5ab145d8p-19, -0x0.8c6662f7e3dbc0p-26, 0x0.a19c7360fa9ad0p-34, -0x0.b83e631887ede8p-42, 0x0.d015f9a24bc3c8p-50, -0x0.e8e073c7284080p-58, 0x0.81297b87b230a8p-65, -0x0.8e0794c07c0598p-73, // x in subrange 5:41 (6.5625..6.625)
- 0x0.eb139d672769c0p-19, -0x0.8775c9050da9c0p-26, 0x0.9a99ce4bead578p-34, -0x0.aec80996ba5168p-42, 0x0.c3c7dc1d2fdd78p-50, -0x0.d956d120f95c88p-58, 0x0.ef2d0a398d81e0p-66, -0x0.82798fbe666b80p-73, // x in subrange 5:42 (6.625..6.6875)
- 0x0.e4d6a8ff41a888p-19, -0x0.82bbd14c3d35d8p-26, 0x0.93f2f7132d82c8p-34, -0x0.a5e0611cffcc08p-42, 0x0.b84b204eda5d28p-50, -0x0.caf2ed2ae99dc8p-58, 0x0.dd9476427bf758p-66, -0x0.efe0515cac7cd8p-74, // x in subrange 5:43 (6.6875..6.75)
- 0x0.ded13267350e40p-19, -0x0.fc6b6653a7f678p-27, 0x0.8da28aa4bae670p-34, -0x0.9d7df6d1c17aa8p-42, 0x0.ad905e66b09b58p-50, -0x0.bd9d0e76678f88p-58, 0x0.cd6658d05df8a0p-66, -0x0.dca5677d37fb50p-74, // x in subrange 5:44 (6.75..6.8125)
- 0x0.d900db4e1a13a8p-19, -0x0.f3c19f447f40b0p-27, 0x0.87a380e81375d8p-34, -0x0.9598092be5ef38p-42, 0x0.a3896bf38f0248p-50, -0x0.b13f8ee4442138p-58, 0x0.be8319fd843be0p-66, -0x0.cb160691fe7370p-74, // x in subrange 5:45 (6.8125..6.875)
- 0x0.d36363eaae4be0p-19, -0x0.eb755d4a40c1b0p-27, 0x0.81f12619464b18p-34, -0x0.8e2679bb11e0f8p-42, 0x0.9a29403942bd48p-50, -0x0.a5c6a9b22042b8p-58, 0x0.b0ce17829ff938p-66, -0x0.bb0a46c2087fb0p-74, // x in subrange 5:46 (6.875..6.9375)
- 0x0.cdf6a937ba0628p-19, -0x0.e381f906dedb88p-27, 0x0.f90e2957bc9f80p-35, -0x0.8721c02c13e618p-42, 0x0.9163db1d879de0p-50, -0x0.9b204e8b1464b8p-58, 0x0.a42d58f280bd68p-66, -0x0.ac5e3a46b32d10p-74, // x in subrange 5:47 (6.9375..7)
- 0x0.c8b8a34dce9ec8p-19, -0x0.dbe30f292bc138p-27, 0x0.eec25f53e53fb8p-35, -0x0.8082de6bf6acd0p-42, 0x0.892e2e6a2d2340p-50, -0x0.913bf912db94e0p-58, 0x0.98894c0128dac0p-66, -0x0.9ef181b3a2ba70p-74, // x in subrange 5:48 (7..7.0625)
- 0x0.c3a763d840cfb8p-19, -0x0.d4947c0d7d0ce8p-27, 0x0.e4f73b095daa78p-35, -0x0.f486ab9e4ccb58p-43, 0x0.817e0929118d60p-50, -0x0.880a8c722f46f0p-58, 0x0.8dcc87ef34df48p-66, -0x0.92a6ec49b474c0p-74, // x in subrange 5:49 (7.0625..7.125)
- 0x0.bec114a36ce738p-19, -0x0.cd9257adfc3d50p-27, 0x0.dba58699488d58p-35, -0x0.e8ba3a496f3260p-43, 0x0.f49409c9c6f4a0p-51, -0x0.fefc64f1235ec0p-59, 0x0.83e3974dd6ff60p-66, -0x0.876422ea3e6a48p-74, // x in subrange 5:50 (7.125..7.1875)
- 0x0.ba03f64279bbd0p-19, -0x0.c6d8f1dc6f07e8p-27, 0x0.d2c68092317698p-35, -0x0.dd952f4070b100p-43, 0x0.e712e93e5345d8p-51, -0x0.ef147be7799688p-59, 0x0.f5798ecf183370p-67, -0x0.fa22b8d95010c8p-75, // x in subrange 5:51 (7.1875..7.25)
- 0x0.b56e5ecaf2dbd8p-19, -0x0.c064cebfc89e60p-27, 0x0.ca53d3cca877e8p-35, -0x0.d30d190d210458p-43, 0x0.da68aaa203a408p-51, -0x0.e0461fcefc6b38p-59, 0x0.e48ff95d4924c0p-67, -0x0.e732347ebd80e8p-75, // x in subrange 5:52 (7.25..7.3125)
- 0x0.b0feb8a4b31b80p-19, -0x0.ba32a3904f0958p-27, 0x0.c2478fe751be80p-35, -0x0.c9183f18b33bd0p-43, 0x0.ce867fa0dd0188p-51, -0x0.d27bfeb43f4698p-59, 0x0.d4ed174a40d0d8p-67, -0x0.d5cfd8be47c680p-75, // x in subrange 5:53 (7.3125..7.375)
- 0x0.acb3816cb68ef0p-19, -0x0.b43f538d8ebb80p-27, 0x0.ba9c22552d6c38p-35, -0x0.bfad93ab918340p-43, 0x0.c35eb7efeb7e80p-51, -0x0.c5a286e37f2978p-59, 0x0.c6762b830e9ef0p-67, -0x0.c5d8779aaf3e48p-75, // x in subrange 5:54 (7.375..7.4375)
- 0x0.a88b48e9866e68p-19, -0x0.ae87ed29bb8f70p-27, 0x0.b34c4ff20a7060p-35, -0x0.b6c4a71394eda8p-43, 0x0.b8e4a9e3a4b7d0p-51, -0x0.b9a7bf4c9dcf08p-59, 0x0.b912d3c537a448p-67, -0x0.b72c358f96cc10p-75, // x in subrange 5:55 (7.4375..7.5)
- 0x0.a484b0100a8d88p-19, -0x0.a909a7667a74b8p-27, 0x0.ac532f1228b648p-35, -0x0.ae559bd69cfb18p-43, 0x0.af0c9d162c2240p-51, -0x0.ae7b23a4c74150p-59, 0x0.acaccfe0950b48p-67, -0x0.a9ae3436954448p-75, // x in subrange 5:56 (7.5..7.5625)
- 0x0.a09e6817a32c70p-19, -0x0.a3c1df5f62fe18p-27, 0x0.a5ac220306a880p-35, -0x0.a6591bd9f7ae08p-43, 0x0.a5cbb6ebc79e30p-51, -0x0.a40d83e5a219e8p-59, 0x0.a12fcea675ad10p-67, -0x0.9d4445fbb1af78p-75, // x in subrange 5:57 (7.5625..7.625)
- 0x0.9cd7319c832458p-19, -0x0.9eae15fed493a8p-27, 0x0.9f52d1f43660d8p-35, -0x0.9ec84e6940f580p-43, 0x0.9d17e8c8cb5378p-51, -0x0.9a50e6d41f02d8p-59, 0x0.96893fec3af068p-67, -0x0.91d6a9ddfd05d8p-75, // x in subrange 5:58 (7.625..7.6875)
- 0x0.992ddbcf55f680p-19, -0x0.99cbedda00ed18p-27, 0x0.99432a3fe238b8p-35, -0x0.979ccf095db0d0p-43, 0x0.94e7dfd0b61428p-51, -0x0.91386f420c5018p-59, 0x0.8ca82b18ccc690p-67, -0x0.874fce57679140p-75, // x in subrange 5:59 (7.6875..7.75)
- 0x0.95a143b14f3810p-19, -0x0.951929314d4e08p-27, 0x0.9379540b60e510p-35, -0x0.90d0a506019388p-43, 0x0.8d32f60a320100p-51, -0x0.88b843c5a0fd18p-59, 0x0.837d09c3632d30p-67, -0x0.fb3835434025c0p-76, // x in subrange 5:60 (7.75..7.8125)
- 0x0.9230535bd15a08p-19, -0x0.9093a812665400p-27, 0x0.8df1b238e0b618p-35, -0x0.8a5e3ba9ccfe38p-43, 0x0.85f124c73d37b0p-51, -0x0.80c578a95d0bb0p-59, 0x0.f5f34bef077ea8p-68, -0x0.e9537b4a72db80p-76, // x in subrange 5:61 (7.8125..7.875)
- 0x0.8eda0152e904d8p-19, -0x0.8c396699977e20p-27, 0x0.88a8dda3c9a790p-35, -0x0.84405b12853250p-43, 0x0.fe35f067df5378p-52, -0x0.f2abf7b9fd3608p-60, 0x0.e621f77bccbe48p-68, -0x0.d8d103e9d5df10p-76, // x in subrange 5:62 (7.875..7.9375)
- 0x0.8b9d4fe1e841e0p-19, -0x0.88087b50286938p-27, 0x0.839ba1a20022c8p-35, -0x0.fce443287498b8p-44, 0x0.f15307e2606a60p-52, -0x0.e4c1056bf476b8p-60, 0x0.d76e3b28d96038p-68, -0x0.c9934c91b6b9f0p-76, // x in subrange 5:63 (7.9375..8)
- 0x0.86f04337b54428p-17, -0x0.8208aa336e2ab8p-24, 0x0.f8e1ebf80f73f0p-32, -0x0.ec90757c7e9c60p-39, 0x0.df5c769b5ad330p-46, -0x0.d184fd06444270p-53, 0x0.c34e212a0d5600p-60, -0x0.b4e265ab037ee8p-67, // x in subrange 6:0 (8..8.125)
- 0x0.8105644e7528e0p-17, -0x0.f512cf206a7cb0p-25, 0x0.e7311437aaeac8p-32, -0x0.d8a8718b5f5d10p-39, 0x0.c9b9557e057b90p-46, -0x0.baa04831fff768p-53, 0x0.ab9ad8488af5d8p-60, -0x0.9ccda4ab3737b0p-67, // x in subrange 6:1 (8.125..8.25)
- 0x0.f6e2873fa49d68p-18, -0x0.e7234f76297990p-25, 0x0.d6fad5dbb0c448p-32, -0x0.c6aaecc9fe8bb0p-39, 0x0.b66fa6bcaf97a8p-46, -0x0.a67e63b02af270p-53, 0x0.970a71402e4368p-60, -0x0.882f2f8da86ec8p-67, // x in subrange 6:2 (8.25..8.375)
- 0x0.ec5b9765e9f728p-18, -0x0.da2c53000a8640p-25, 0x0.c81afb7bdbcec8p-32, -0x0.b662f9f0e1bd80p-39, 0x0.a5375294de1548p-46, -0x0.94c2572cdf1098p-53, 0x0.852a2b6edfb1a8p-60, -0x0.ecfcfe95c489f0p-68, // x in subrange 6:3 (8.375..8.5)
- 0x0.e26acf271a0de8p-18, -0x0.ce197af4590510p-25, 0x0.ba7131b258e918p-32, -0x0.a7a1f9f2324798p-39, 0x0.95d1ae5e1aee28p-46, -0x0.851c6009d0b520p-53, 0x0.eb31b31e4e38f8p-61, -0x0.ce92dfda08a600p-68, // x in subrange 6:4 (8.5..8.625)
- 0x0.d905ed5dbe0138p-18, -0x0.c2d851cb154da0p-25, 0x0.ade091669bf250p-32, -0x0.9a3eca2a67a140p-39, 0x0.880827a98dcf78p-46, -0x0.ee8fdcc87311f8p-54, 0x0.d00808209a7688p-61, -0x0.b460bb7df7aea0p-68, // x in subrange 6:5 (8.625..8.75)
- 0x0.d02383f3cfae80p-18, -0x0.b85817bfe4fde0p-25, 0x0.a24f394daded28p-32, -0x0.8e1510085925a0p-39, 0x0.f75645fe0ddd30p-47, -0x0.d613eb35b15668p-54, 0x0.b84b142bff6ca0p-61, -0x0.9dc5f0d80c8ab0p-68, // x in subrange 6:6 (8.75..8.875)
- 0x0.c7bae4742c4a48p-18, -0x0.ae899550b4c750p-25, 0x0.97a5f4804a83b8p-32, -0x0.83049dbcf5d7b0p-39, 0x0.e1220bc9c89ef0p-47, -0x0.c05f03fc054b10p-54, 0x0.a383542aa46d50p-61, -0x0.8a3b524ac196b0p-68, // x in subrange 6:7 (8.875..9)
- 0x0.bfc40e9e060168p-18, -0x0.a55ef2f68431e0p-25, 0x0.8dcfec58882af0p-32, -0x0.f1e1d872004168p-40, 0x0.cd2aca9813e8e8p-47, -0x0.ad190fd786c5e0p-54, 0x0.914abed5d4c5f0p-61, -0x0.f29dbf95b50e18p-69, // x in subrange 6:8 (9..9.125)
- 0x0.b837a0bfa24b78p-18, -0x0.9ccb95708509e8p-25, 0x0.84ba640d304e88p-32, -0x0.df814eacb92c70p-40, 0x0.bb30a546f732c8p-47, -0x0.9bf5c56806dbc0p-54, 0x0.814a0b96ab2140p-61, -0x0.d54085c7b10160p-69, // x in subrange 6:9 (9.125..9.25)
- 0x0.b10ec9a5047420p-18, -0x0.94c3fe107bbbd0p-25, 0x0.f8a8f9751af410p-33, -0x0.ceba93109e7158p-40, 0x0.aafb8598c27e20p-47, -0x0.8cb2f6ab0534d8p-54, 0x0.e66cd906e702d0p-62, -0x0.bbbbd08eefce98p-69, // x in subrange 6:10 (9.25..9.375)
- 0x0.aa433bed790270p-18, -0x0.8d3dae8ac17240p-25, 0x0.e91e0172337d60p-33, -0x0.bf6589add2da98p-40, 0x0.9c5a15e2978e88p-47, -0x0.fe2e4220a1b900p-55, 0x0.cd9f4edbbd5e88p-62, -0x0.a58533e3ed5a90p-69, // x in subrange 6:11 (9.375..9.5)
- 0x0.a3cf22a0739f10p-18, -0x0.862f0fdcefe6b0p-25, 0x0.dab86a97376488p-33, -0x0.b15e6e832aa8e0p-40, 0x0.8f20dfd4d0a710p-47, -0x0.e5e06aadc00c38p-55, 0x0.b7bcfb41901930p-62, -0x0.922704fe3ff590p-69, // x in subrange 6:12 (9.5..9.625)
- 0x0.9dad16def4d9a0p-18, -0x0.ff1eb7d90eb668p-26, 0x0.cd5f63a23c5a10p-33, -0x0.a48551dc2b73a0p-40, 0x0.83298ac4d13e98p-47, -0x0.d0251c74a01ff8p-55, 0x0.a466a9c693aa98p-62, -0x0.813d0d80538638p-69, // x in subrange 6:13 (9.625..9.75)
- 0x0.97d81692d1ebc0p-18, -0x0.f2ad13164a5d00p-26, 0x0.c0fc7789943a70p-33, -0x0.98bda58ddc7458p-40, 0x0.f0a46989c48590p-48, -0x0.bcb01cfdbd9260p-55, 0x0.934a2d7c187688p-62, -0x0.e4e398d0349080p-70, // x in subrange 6:14 (9.75..9.875)
- 0x0.924b7c00d492c8p-18, -0x0.e6fa7530e44168p-26, 0x0.b57b4dddb395b0p-33, -0x0.8dedd8bfec4b18p-40, 0x0.dcf9c52a4eca20p-48, -0x0.ab3ec0534e1cb8p-55, 0x0.842079e71bb768p-62, -0x0.caf85787dad9a8p-70, // x in subrange 6:15 (9.875..10)
- 0x0.8d02f625cf4498p-18, -0x0.dbf95806173e88p-26, 0x0.aac9727ea99a80p-33, -0x0.83ff0046ff0440p-40, 0x0.cb1e062eb1d488p-48, -0x0.9b969f74e174d8p-55, 0x0.ed580eccaf21f8p-63, -0x0.b43b2d91eb6a50p-70, // x in subrange 6:16 (10..10.125)
- 0x0.87fa81c9827ea0p-18, -0x0.d19d4ee313f960p-26, 0x0.a0d623bb31be38p-33, -0x0.f5b913bd558fa8p-41, 0x0.bae206e6a5c300p-48, -0x0.8d847e2bc8d860p-55, 0x0.d56eed6b9e6150p-63, -0x0.a040bf455e67d0p-70, // x in subrange 6:17 (10.125..10.25)
- 0x0.832e63349882e8p-18, -0x0.c7daecc7290760p-26, 0x0.9792260ec45220p-33, -0x0.e4e7f19fffcd38p-41, 0x0.ac1be3128c2aa0p-48, -0x0.80db5905b36248p-55, 0x0.c028d2aeb4ecb0p-63, -0x0.8eacceae5ba950p-70, // x in subrange 6:18 (10.25..10.375)
- 0x0.fd3640f2329940p-19, -0x0.bea7ad41b5d7c0p-26, 0x0.8eef9cceeb3e68p-33, -0x0.d569558c975e00p-41, 0x0.9ea65556455bd0p-48, -0x0.eae72aca44a7b8p-56, 0x0.ad350cca954e50p-63, -0x0.fe5ff23795b8c0p-71, // x in subrange 6:19 (10.375..10.5)
- 0x0.f47af87d25f0b0p-19, -0x0.b5f9dfa1d5e078p-26, 0x0.86e1e72f31cfe8p-33, -0x0.c71f47813a4fd0p-41, 0x0.926029c97d1150p-48, -0x0.d6549d1e07c6d0p-56, 0x0.9c4d4984aa1510p-63, -0x0.e30ba00e6b8260p-71, // x in subrange 6:20 (10.5..10.625)
- 0x0.ec24e209a7e870p-19, -0x0.adc89436997780p-26, 0x0.febb022db8bd58p-34, -0x0.b9eec0696b2810p-41, 0x0.872bc2b788b500p-48, -0x0.c3c176d5bb9860p-56, 0x0.8d34298ea4fd78p-63, -0x0.cae67c529dac90p-71, // x in subrange 6:21 (10.625..10.75)
- 0x0.e42e59a306ffe0p-19, -0x0.a60b8b6662eb08p-26, 0x0.f0afcea95394e0p-34, -0x0.adbf5931178000p-41, 0x0.f9dd5a1ed71178p-49, -0x0.b2f752ad94d040p-56, 0x0.ff68122014ed88p-64, -0x0.b58a5864591bb8p-71, // x in subrange 6:22 (10.75..10.875)
- 0x0.dc921a7c517b98p-19, -0x0.9ebb266ac183b8p-26, 0x0.e38efd973a67f8p-34, -0x0.a27b0346859dd0p-41, 0x0.e72284c3b7dc58p-49, -0x0.a3c61200367ab8p-56, 0x0.e73bea5675d338p-64, -0x0.a29eb58bc28508p-71, // x in subrange 6:23 (10.875..11)
- 0x0.d54b37ba9cbe50p-19, -0x0.97d059840be408p-26, 0x0.d746fc81134790p-34, -0x0.980dc95c50e218p-41, 0x0.d5fcad34144df8p-49, -0x0.96031553388408p-56, 0x0.d1918f3fc55470p-64, -0x0.91d6d247c6ae50p-71, // x in subrange 6:24 (11..11.125)
- 0x0.ce5515dcdb2dc0p-19, -0x0.91449f7d255db8p-26, 0x0.cbc7b4f63b3338p-34, -0x0.8e65976532a848p-41, 0x0.c645dfc18367e0p-49, -0x0.89888f5a67de48p-56, 0x0.be20c58e89aeb8p-64, -0x0.82f002a8ed0208p-71, // x in subrange 6:25 (11.125..11.25)
- 0x0.c7ab64b2553260p-19, -0x0.8b11ee5c5fc590p-26, 0x0.c10268ed7147e0p-34, -0x0.857208e6238800p-41, 0x0.b7dc0ea4759030p-49, -0x0.fc69dd6cfb55e0p-57, 0x0.acaa122382aad0p-64, -0x0.eb608fa835e798p-72, // x in subrange 6:26 (11.25..11.375)
- 0x0.c14a19d2663be8p-19, -0x0.8532ad2262d268p-26, 0x0.b6e992cf3ccb78p-34, -0x0.fa4879b28cffe0p-42, 0x0.aaa0a2be5a97f0p-49, -0x0.e7d4b684f87be0p-57, 0x0.9cf597e14d5588p-64, -0x0.d3ca3986550f00p-72, // x in subrange 6:27 (11.375..11.5)
- 0x0.bb2d6b897e6e38p-19, -0x0.ff4354f6fbd4a8p-27, 0x0.ad70c8c09c6658p-34, -0x0.eadd5ceb8fd308p-42, 0x0.9e7819b59410a8p-49, -0x0.d51c8875e888c8p-57, 0x0.8ed21d755ea7d8p-64, -0x0.bec4dff679a5c8p-72, // x in subrange 6:28 (11.5..11.625)
- 0x0.b551cc30a219a8p-19, -0x0.f4b42895b2fe28p-27, 0x0.a48ca2d21683b0p-34, -0x0.dc8a248e064fc8p-42, 0x0.9349afb48e9540p-49, -0x0.c411f9dfb24b10p-57, 0x0.821435442328e0p-64, -0x0.ac0386957194b8p-72, // x in subrange 6:29 (11.625..11.75)
- 0x0.afb3e5e5b61db8p-19, -0x0.eaaedff35f4d40p-27, 0x0.9c32a3c2307068p-34, -0x0.cf386e20c27e30p-42, 0x0.88ff13513865d8p-49, -0x0.b48acc0e9d47c0p-57, 0x0.ed2b051581c958p-65, -0x0.9b42d77fb9f748p-72, // x in subrange 6:30 (11.75..11.875)
- 0x0.aa50969bdfe7a8p-19, -0x0.e12b26ee28d7e8p-27, 0x0.9459240bdba888p-34, -0x0.c2d3d417d16ca0p-42, 0x0.ff0844aa85e468p-50, -0x0.a661434104a870p-57, 0x0.d8682f11a73da0p-65, -0x0.8c47d9ee677c70p-72, // x in subrange 6:31 (11.875..12)
- 0x0.a524ec7c1c7d80p-19, -0x0.d8213daddf8320p-27, 0x0.8cf73f01beec00p-34, -0x0.b749bc3f87e808p-42, 0x0.ed8d5c97006b58p-50, -0x0.9973a1c6972de0p-57, 0x0.c5a3d24b6ae278p-65, -0x0.fdbdae9e98bd90p-73, // x in subrange 6:32 (12..12.125)
- 0x0.a02e228ef71318p-19, -0x0.cf89ed014bfc90p-27, 0x0.8604c1be8c7028p-34, -0x0.ac892b66cf80e8p-42, 0x0.dd6c8fb8addeb8p-50, -0x0.8da3b37b681220p-57, 0x0.b4a8aa193ae828p-65, -0x0.e5b4cfdd66fa20p-73, // x in subrange 6:33 (12.125..12.25)
- 0x0.9b699da8f7be30p-19, -0x0.c75e7bbf204058p-27, 0x0.fef43771f65ba0p-35, -0x0.a2829daf8976c8p-42, 0x0.ce8820474fb560p-50, -0x0.82d6677a4c2b60p-57, 0x0.a5476f5a97b430p-65, -0x0.d02542babb9cd8p-73, // x in subrange 6:34 (12.25..12.375)
- 0x0.96d4e994006910p-19, -0x0.bf98a511b2e9e0p-27, 0x0.f2a0a19f2aa5d0p-35, -0x0.9927e2fe8e0780p-42, 0x0.c0c51e8cb59598p-50, -0x0.f1e6ec5c1c7848p-58, 0x0.97561fdf3b4330p-65, -0x0.bcc8c34939b380p-73, // x in subrange 6:35 (12.375..12.5)
- 0x0.926db6705b3a28p-19, -0x0.b8328f97452818p-27, 0x0.e701d94af6d888p-35, -0x0.906bff151230e8p-42, 0x0.b40b1f4b9ce050p-50, -0x0.dfca2453ed5138p-58, 0x0.8aaf5d743dbfa8p-65, -0x0.ab6166383a71d0p-73, // x in subrange 6:36 (12.5..12.625)
- 0x0.8e31d648bc25f0p-19, -0x0.b126c542ddcb10p-27, 0x0.dc0bee5b22fb90p-35, -0x0.88430ceb69a350p-42, 0x0.a843fa483fec28p-50, -0x0.cf2f44d3557770p-58, 0x0.fe63c2c3c4b7f8p-66, -0x0.9bb88aaf19e0f0p-73, // x in subrange 6:37 (12.625..12.75)
- 0x0.8a1f3ad4e8e670p-19, -0x0.aa702bebcd5e88p-27, 0x0.d1b3d48ab8e048p-35, -0x0.80a224f1777680p-42, 0x0.9d5b8ffc53fb10p-50, -0x0.bff3098fea00d8p-58, 0x0.e98003346e8428p-66, -0x0.8d9df055f51b10p-73, // x in subrange 6:38 (12.75..12.875)
- 0x0.8633f367209020p-19, -0x0.a409fe7bbf62e0p-27, 0x0.c7ef50886799d8p-35, -0x0.f2fe8bc7d97490p-43, 0x0.933f959f379ce0p-50, -0x0.b1f5af499e8118p-58, 0x0.d67e8a79151630p-66, -0x0.80e6ec6fc4c310p-73, // x in subrange 6:39 (12.875..13)
- 0x0.826e2b00b7b4b0p-19, -0x0.9defc6acda3300p-27, 0x0.beb4e6ccc888f8p-35, -0x0.e5a27fddcba948p-43, 0x0.89df66c5f2e130p-50, -0x0.a51a93ac1622d0p-58, 0x0.c5300ccd581790p-66, -0x0.eadb7357baf898p-74, // x in subrange 6:40 (13..13.125)
- 0x0.fd984d15612400p-20, -0x0.981d574adff138p-27, 0x0.b5fbcbfcff1a68p-35, -0x0.d91f43bd79b340p-43, 0x0.812bdbf5fc7638p-50, -0x0.9947e03824b4b8p-58, 0x0.b56a3f2ab5b600p-66, -0x0.d621bdf1a82720p-74, // x in subrange 6:41 (13.125..13.25)
- 0x0.f698865ec26018p-20, -0x0.928ec6eb8c1478p-27, 0x0.adbbd6b2d182e0p-35, -0x0.cd65504e4e7c20p-43, 0x0.f22e4b33f314d0p-51, -0x0.8e663edc4da878p-58, 0x0.a70746260edf58p-66, -0x0.c365545ae22f68p-74, // x in subrange 6:42 (13.25..13.375)
- 0x0.efd9e9a4f8cf20p-20, -0x0.8d406b138f7560p-27, 0x0.a5ed7287760020p-35, -0x0.c2665b1e251b90p-43, 0x0.e32955b29cae48p-51, -0x0.8460970fc4f9f0p-58, 0x0.99e53651c279d8p-66, -0x0.b27177a3b27d60p-74, // x in subrange 6:43 (13.375..13.5)
- 0x0.e959894a1eb6a0p-20, -0x0.882ed3be93fa88p-27, 0x0.9e899441f5fb68p-35, -0x0.b8153aaa971ea0p-43, 0x0.d531d7c55e71f0p-51, -0x0.f647a4d41f6048p-59, 0x0.8de5a3e6ae33c8p-66, -0x0.a317436d7008a8p-74, // x in subrange 6:44 (13.5..13.625)
- 0x0.e3149fa6774e60p-20, -0x0.8356c7419cc520p-27, 0x0.9789af0d454778p-35, -0x0.ae65cd4dcdb428p-43, 0x0.c832ce8e8ac488p-51, -0x0.e53d4fa57fab88p-59, 0x0.82ed3fc3d63550p-66, -0x0.952cfcb9c632b8p-74, // x in subrange 6:45 (13.625..13.75)
- 0x0.dd088c93500b30p-20, -0x0.fd6a7cffd62128p-28, 0x0.90e7aa9d0c2688p-35, -0x0.a54ce2896e9528p-43, 0x0.bc19041f54d8b8p-51, -0x0.d582d90352a2c8p-59, 0x0.f1c7002dd37860p-67, -0x0.888d76efe5ccd8p-74, // x in subrange 6:46 (13.75..13.875)
- 0x0.d732d3219bee50p-20, -0x0.f48ec2d69b2738p-28, 0x0.8a9dda2ab1cb40p-35, -0x0.9cc02671e1d918p-43, 0x0.b0d2e47c6b2730p-51, -0x0.c6fbd441e898c0p-59, 0x0.df64a671e7d9b8p-67, -0x0.fa2f184e9cb068p-75, // x in subrange 6:47 (13.875..14)
- 0x0.d1911778e71c70p-20, -0x0.ec150792d4f550p-28, 0x0.84a6f4367c3660p-35, -0x0.94b60f02ecba70p-43, 0x0.a65056f60ca1d0p-51, -0x0.b98e72f05266c0p-59, 0x0.ce8bb6f74ecc88p-67, -0x0.e55b4c61150ba0p-75, // x in subrange 6:48 (14..14.125)
- 0x0.cc211cdb8a96f0p-20, -0x0.e3f844705a48f8p-28, 0x0.fdfc15f54422f8p-36, -0x0.8d25cb2c9324e0p-43, 0x0.9c829b5c1aaf58p-51, -0x0.ad2342345f96c8p-59, 0x0.bf18659c06b450p-67, -0x0.d26aac5b487b98p-75, // x in subrange 6:49 (14.125..14.25)
- 0x0.c6e0c3cd4abbe8p-20, -0x0.dc33bed8150898p-28, 0x0.f33d0afff59bd0p-36, -0x0.8607336c779270p-43, 0x0.935c2aa467ae08p-51, -0x0.a1a4ef41464740p-59, 0x0.b0ea6a871ea308p-67, -0x0.c12df1b11b0128p-75, // x in subrange 6:50 (14.25..14.375)
- 0x0.c1ce0859c7d8d0p-20, -0x0.d4c30346962520p-28, 0x0.e908328b2eaa48p-36, -0x0.fea57799379508p-44, 0x0.8ad09aa5926da0p-51, -0x0.9700121a4b1920p-59, 0x0.a3e4a351dc41e8p-67, -0x0.b17acbae725840p-75, // x in subrange 6:51 (14.375..14.5)
- 0x0.bce700785f3fc0p-20, -0x0.cda1e093f1ff20p-28, 0x0.df5588dbff4630p-36, -0x0.f202ce4910a538p-44, 0x0.82d484935a05d0p-51, -0x0.8d22fdeba7fd70p-59, 0x0.97ecbed78ea2c8p-67, -0x0.a32b516a8e10c8p-75, // x in subrange 6:52 (14.5..14.625)
- 0x0.b829da8b4d75e0p-20, -0x0.c6cc6394ec67a0p-28, 0x0.d61d90cc396108p-36, -0x0.e61976fb185498p-44, 0x0.f6badbe554c660p-52, -0x0.83fd9659ad9dc0p-59, 0x0.8ceaf2673715f8p-67, -0x0.961d8496bac950p-75, // x in subrange 6:53 (14.625..14.75)
- 0x0.b394dbf80fbd10p-20, -0x0.c03ed30e316e28p-28, 0x0.cd5949f5fd09d8p-36, -0x0.dadd6efc121688p-44, 0x0.e8c36787b469b8p-52, -0x0.f7025272321d70p-60, 0x0.82c9b73b10fcc0p-67, -0x0.8a32e30b795bc0p-75, // x in subrange 6:54 (14.75..14.875)
- 0x0.af265fd72cd418p-20, -0x0.b9f5abf2fcbcd0p-28, 0x0.c50227a96fecd8p-36, -0x0.d04391854cb320p-44, 0x0.dbb0ef51a4c0b0p-52, -0x0.e740986867d918p-60, 0x0.f2eb1e7af012e0p-68, -0x0.fea00a7d142c68p-76, // x in subrange 6:55 (14.875..15)
- 0x0.aadcd5b9b2b9f8p-20, -0x0.b3ed9de9261568p-28, 0x0.bd12089aefe758p-36, -0x0.c641861db24010p-44, 0x0.cf731da679bb90p-52, -0x0.d89d7bddc0a870p-60, 0x0.e1b9a082f39008p-68, -0x0.eab890138a7c00p-76, // x in subrange 6:56 (15..15.125)
- 0x0.a6b6c082d9dcc0p-20, -0x0.ae23880d1036c8p-28, 0x0.b5832f39bc5f50p-36, -0x0.bccdb080f6e498p-44, 0x0.c3fae518ffb408p-52, -0x0.cb029490e35790p-60, 0x0.d1dee9e0503358p-68, -0x0.d88300bf64dea0p-76, // x in subrange 6:57 (15.125..15.25)
- 0x0.a2b2b5545dbac8p-20, -0x0.a89475f0717590p-28, 0x0.ae503aa092a2d0p-36, -0x0.b3df21e87370a0p-44, 0x0.b93a645c935f38p-52, -0x0.be5b62cac53370p-60, 0x0.c33de586267120p-68, -0x0.c7d76f713c6558p-76, // x in subrange 6:58 (15.25..15.375)
- 0x0.9ecf5a8c37de10p-20, -0x0.a33d9ccf5bf2b8p-28, 0x0.a7742013137200p-36, -0x0.ab6d8b94e034b0p-44, 0x0.af24cccdbe45a0p-52, -0x0.b2952269971020p-60, 0x0.b5bc28f146fb08p-68, -0x0.b891e055104700p-76, // x in subrange 6:59 (15.375..15.5)
- 0x0.9b0b66d2848578p-20, -0x0.9e1c58f74fb510p-28, 0x0.a0ea24fbff2c40p-36, -0x0.a371327b67e5a8p-44, 0x0.a5ae4b50923948p-52, -0x0.a79ea25c407730p-60, 0x0.a941b10189e6d0p-68, -0x0.aa91de8119a588p-76, // x in subrange 6:60 (15.5..15.625)
- 0x0.9765a036707ba0p-20, -0x0.992e2b5c7c0ab8p-28, 0x0.9aadd9616e8f98p-36, -0x0.9be2e3fb750ae8p-44, 0x0.9ccbf349f2dcf0p-52, -0x0.9d682016aa0a88p-60, 0x0.9db8a5dfa34ab0p-68, -0x0.9dba1d88493470p-76, // x in subrange 6:61 (15.625..15.75)
- 0x0.93dcdb5925bef0p-20, -0x0.9470b759a86270p-28, 0x0.94bb12c52ad668p-36, -0x0.94bbeb85387728p-44, 0x0.9473ab7f290880p-52, -0x0.93e326947cbf68p-60, 0x0.930d25265fe488p-68, -0x0.91f02588ae6840p-76, // x in subrange 6:62 (15.75..15.875)
- 0x0.906ffaa5c0e6b0p-20, -0x0.8fe1c097881678p-28, 0x0.8f0de7682c29a0p-36, -0x0.8df6091b3d6ef8p-44, 0x0.8c9c1cac9862a0p-52, -0x0.8b02708bcadb98p-60, 0x0.892d119de3af78p-68, -0x0.871c087acd6bf0p-76, // x in subrange 6:63 (15.875..16)
-};
-// clang-format on
-//--- End of autogenerated code
+#include "cerf_inline.h" // defines cerf_inline_erfcx
 
-//! Compute erfcx(x) by Chebyshev interpolation within certain subranges.
-//! Coefficients are read from the avove lookup table.
-//! For speed and accuracy, Chebychev subranges are 64th fractions of octaves.
-//! This allows us to compute the within-subrange coordinate t = (x -
-//! center_of_range) / half_range by integer and bitwise operations without any
-//! rounding.
+/******************************************************************************/
+/*  Library functions erfcx, erfcx_array                                      */
+/******************************************************************************/
+
+
+double erfcx(double x) {
+    return cerf_inline_erfcx(x);
+}
+
+void erfcx_array(size_t n, const double* x, double* result) {
+#ifdef CERF_UNIFORM
+    // Work in chunks: first a loop without branches and function calls, which the compiler
+    // can vectorize, then the correction for negative arguments. The buffer allows x == result.
+    enum { NCHUNK = 256 };
+    double y[NCHUNK];
+    for (size_t i0 = 0; i0 < n; i0 += NCHUNK) {
+        const size_t m = n - i0 < NCHUNK ? n - i0 : NCHUNK;
+        for (size_t j = 0; j < m; ++j)
+            y[j] = cerf_inline_erfcx_uniform_kernel(fabs(x[i0 + j]));
+        for (size_t j = 0; j < m; ++j) {
+            const double xj = x[i0 + j];
+            result[i0 + j] =
+                xj < 0 ? (xj < -26.7 ? HUGE_VAL : cerf_inline_2exp_xx(xj) - y[j]) : y[j];
+        }
+    }
+#else
+    for (size_t i = 0; i < n; ++i)
+        result[i] = cerf_inline_erfcx(x[i]);
+#endif
+}
+
+/******************************************************************************/
+/*  Library functions erf_real, erfc_real, and their array versions           */
+/******************************************************************************/
+
+//! Computes erfc(x) = erfcx(x) exp(-x^2) for x >= 0.
+static double erfc_pos_kernel(double x) {
+    if (x > 27.3)
+        return 0; // underflow
+    // The low-order part of x^2, obtained by fma, matters for large x.
+    const double xx = x * x;
+    const double xxlo = fma(x, x, -xx);
+    return cerf_inline_erfcx(x) * exp(-xx) * (1 - xxlo);
+}
 
-static double chebInterpolant(double x) {
-    // Application-specific constants:
-    static const int M = 6;   // 2^M subranges
-    static const int j0 = -2; // first octave runs from 2^(j0-1) to 2^j0
-    static const int l0 = 0;  // index of x_min in full first octave
-    static const int loff = (j0 + 1) * (1 << M) + l0; // precomputed offset
+//! Computes erfc(x).
+static double erfc_kernel(double x) {
+    if (x >= 0)
+        return erfc_pos_kernel(x);
+    return 2 - erfc_pos_kernel(-x);
+}
 
-    // For given x, obtain mantissa xm and exponent je:
-    int je;                          // will be set in next line
-    const double xm = frexp2(x, &je); // sets xm and je
+//! Computes erf(x).
+static double erf_kernel(double x) {
+    if (fabs(x) < .5) {
+        // Use Taylor expansion, to avoid cancellation in 1 - erfc(x)
+        SET_INFO(1400, 13);
+        const double x2 = x * x;
+        return x * ((((((((((((+9.4227590646504113e-11 * x2
+                                - 1.2290555301717928e-09) * x2
+                               + 1.4807192815879218e-08) * x2
+                              - 1.6365844691234924e-07) * x2
+                             + 1.6462114365889248e-06) * x2
+                            - 1.4925650358406250e-05) * x2
+                           + 1.2055332981789664e-04) * x2
+                          - 8.5483270234508533e-04) * x2
+                         + 5.2239776254421879e-03) * x2
+                        - 2.6866170645131252e-02) * x2
+                       + 1.1283791670955126e-01) * x2
+                      - 3.7612638903183754e-01) * x2
+                     + 1.1283791670955126e+00);
+    }
+    return copysign(1 - erfc_pos_kernel(fabs(x)), x);
+}
 
-    // Integer arithmetics to obtain reduced coordinate t:
-    const int ip = (int)((1 << (M+1)) * xm);   // index in octave + 2^M
-    const int lij = je * (1 << M) + ip - loff; // index in lookup table
-    const double t = (1 << (M+2)) * xm - (1 + 2 * ip);
+double erf_real(double x) {
+    return erf_kernel(x);
+}
 
-    SET_NTER(lij);
+double erfc_real(double x) {
+    return erfc_kernel(x);
+}
 
-    const double *const P = ChebCoeffs1 + (lij * 8);
-    const double *const Q = ChebCoeffs0 + (lij * 2);
+void erf_real_array(size_t n, const double* x, double* result) {
+    for (size_t i = 0; i < n; ++i)
+        result[i] = erf_kernel(x[i]);
+}
 
-    // hard-coded for N1cheb=10
-    return ((((((((P[7] * t
-		   + P[6]) * t
-		  + P[5]) * t
-		 + P[4]) * t
-		+ P[3]) * t
-	       + P[2]) * t
-	      + P[1]) * t
-	     + P[0]) * t
-	    + Q[1]) * t
-	   + Q[0];
+void erfc_real_array(size_t n, const double* x, double* result) {
+    for (size_t i = 0; i < n; ++i)
+        result[i] = erfc_kernel(x[i]);
 }
 
 /******************************************************************************/
-/*  Library function erfcx                                                    */
+/*  Library functions log_erfc, log_ndtr, and their array versions            */
 /******************************************************************************/
 
-double erfcx(double x) {
-    // Steven G. Johnson, October 2012.
-    // Rewritten for better accuracy by Joachim Wuttke, Sept 2024.
+static const double ln2 = 0.69314718055994530942;
+static const double is2 = 0.70710678118654752440; // 1 / sqrt(2)
 
-    // Uses the following methods:
-    // - Asymptotic expansion for large positive x,
-    // - Chebyshev polynomials for medium positive x,
-    // - Taylor (Maclaurin) series for small |x|,
-    // - Asymptote 2exp(x^2) for large negative x,
-    // - 2*exp(x^2)-erfcx(-x) for medium negative x.
+//! Computes exp(-x^2/2), using fma to obtain the low-order part of x^2,
+//! which matters for large |x|.
+static double gauss_kernel(double x) {
+    if (fabs(x) > 40)
+        return 0; // underflow
+    const double xx = x * x;
+    const double xxlo = fma(x, x, -xx);
+    return exp(-.5 * xx) * (1 - .5 * xxlo);
+}
 
-    double ax = fabs(x);
+//! Computes log(erfc(x)).
+static double log_erfc_kernel(double x) {
+    // For x >= 0.5, this is the plain log(erfcx(x)) - x^2: one erfcx and one log, with no
+    // log-domain table. The scaled function erfcx prevents underflow, and the subtraction
+    // of x^2 involves no cancellation. Only for x < 0.5 is the evaluation different:
+    // erfc(x) = 1 - erf(x) is not small there, and log1p retains full accuracy also as
+    // erf(x) -> 0.
+    if (x < .5)
+        return log1p(-erf_kernel(x));
+    return log(cerf_inline_erfcx(x)) - x * x;
+}
 
-    if (ax < .125) {
-        // Use Taylor expansion
-        SET_INFO(10, 15);
-        return ((((((((((((((+1.9841269841269841e-04) * x -
-                            5.3440090793734269e-04) * x +
-                           1.3888888888888889e-03) * x -
-                          3.4736059015927274e-03) * x +
-                         8.3333333333333332e-03) * x -
-                        1.9104832458760001e-02) * x +
-                       4.1666666666666664e-02) * x -
-                      8.5971746064419999e-02) * x +
-                     1.6666666666666666e-01) * x -
-                    3.0090111122547003e-01) * x +
-                   5.0000000000000000e-01) * x -
-                  7.5225277806367508e-01) * x +
-                 1.0000000000000000e+00) * x -
-                1.1283791670955126e+00) * x +
-            1.0000000000000000e+00;
-    }
+//! Computes log(Phi(x)), where Phi is the cumulative standard normal distribution.
+static double log_ndtr_kernel(double x) {
+    // Phi(x) = erfc(-x/sqrt(2)) / 2 = erfcx(-x/sqrt(2)) exp(-x^2/2) / 2.
+    // As erfc is ill-conditioned for large arguments, the rounding of x/sqrt(2)
+    // is only allowed to affect erfcx, whereas x^2/2 is computed from x directly.
+    if (x < -1)
+        return log(cerf_inline_erfcx(-x * is2)) - .5 * x * x - ln2;
+    if (x < 0)
+        return log_erfc_kernel(-x * is2) - ln2;
+    // For x >= 0, log(Phi) is small and is obtained from the tail 1 - Phi(x) by log1p.
+    return log1p(-.5 * cerf_inline_erfcx(x * is2) * gauss_kernel(x));
+}
 
-    if (x < 0) {
-        if (x < -26.7) {
-            SET_INFO(20, 1);
-            return HUGE_VAL;
-        }
-        if (x < -6.1) {
-            SET_INFO(21, 1);
-            return 2 * exp(x * x);
-        }
-        SET_ALGO(31);
-        return 2 * exp(x * x) - chebInterpolant(-x);
-    }
+double log_erfc(double x) {
+    return log_erfc_kernel(x);
+}
 
-    if (x <= 12) {
-        SET_ALGO(30);
-        return chebInterpolant(x);
-    }
+double log_ndtr(double x) {
+    return log_ndtr_kernel(x);
+}
 
-    /* else */ {
-        // Use asymptotic expansion
-        //
-        // Coefficient are a_0 = 1/sqrt(pi), a_N = (2N-1)!!/2^N/sqrt(pi).
+void log_erfc_array(size_t n, const double* x, double* result) {
+    for (size_t i = 0; i < n; ++i)
+        result[i] = log_erfc_kernel(x[i]);
+}
 
-        const double r = 1 / x;
+void log_ndtr_array(size_t n, const double* x, double* result) {
+    for (size_t i = 0; i < n; ++i)
+        result[i] = log_ndtr_kernel(x[i]);
+}
 
-        if (x < 150) {
-            if (x < 23.2) {
-                SET_INFO(40, 11);
-                return (((((((((((+3.6073371500083758e+05) * (r * r) -
-                                 3.7971970000088164e+04) * (r * r) +
-                                4.4672905882456671e+03) * (r * r) -
-                               5.9563874509942218e+02) * (r * r) +
-                              9.1636730015295726e+01) * (r * r) -
-                             1.6661223639144676e+01) * (r * r) +
-                            3.7024941420321507e+00) * (r * r) -
-                           1.0578554691520430e+00) * (r * r) +
-                          4.2314218766081724e-01) * (r * r) -
-                         2.8209479177387814e-01) * (r * r) +
-                        5.6418958354775628e-01) * r;
-            }
-            SET_INFO(40, 7);
-            return (((((((+9.1636730015295726e+01) * (r * r) -
-                         1.6661223639144676e+01) * (r * r) +
-                        3.7024941420321507e+00) * (r * r) -
-                       1.0578554691520430e+00) * (r * r) +
-                      4.2314218766081724e-01) * (r * r) -
-                     2.8209479177387814e-01) * (r * r) +
-                    5.6418958354775628e-01) * r;
-        }
-        if (x < 6.9e7) {
-            SET_INFO(40, 4);
-            return ((((-1.0578554691520430e+00) * (r * r) +
-                      4.2314218766081724e-01) * (r * r) -
-                     2.8209479177387814e-01) * (r * r) +
-                    5.6418958354775628e-01) * r;
-        }
-        SET_INFO(40, 1);
-        // 1-term expansion, important to avoid overflow
-        return 0.56418958354775629 / x;
-    }
+/******************************************************************************/
+/*  Library functions mills_ratio, inv_mills_ratio, normal_tail, and arrays   */
+/******************************************************************************/
+
+static const double sqpi2 = 1.2533141373155002512;   // sqrt(pi/2)
+static const double s2pi = 2.5066282746310005024;    // sqrt(2*pi)
+static const double is2pi = 0.39894228040143267794;  // 1 / sqrt(2*pi)
+
+// With the standard normal density phi(x) = exp(-x^2/2) / sqrt(2*pi)
+// and the tail 1 - Phi(x) = erfc(x/sqrt(2)) / 2 = sqrt(pi/2) erfcx(x/sqrt(2)) phi(x),
+// the Mills ratio is (1 - Phi(x)) / phi(x) = sqrt(pi/2) erfcx(x/sqrt(2)).
+// For x < 0, erfcx(x/sqrt(2)) = 2 exp(x^2/2) - erfcx(|x|/sqrt(2)) would take the exponential
+// from the rounded x/sqrt(2), with a relative error that grows like x^2. Therefore the
+// reflection is done here, with the exponential computed from x directly.
 
-} // erfcx
+//! Computes the Mills ratio (1 - Phi(x)) / phi(x).
+static double mills_ratio_kernel(double x) {
+    if (x >= 0)
+        return sqpi2 * cerf_inline_erfcx(x * is2);
+    if (x < -38)
+        return HUGE_VAL; // overflow
+    const double xx = x * x;
+    const double xxlo = fma(x, x, -xx);
+    return s2pi * exp(.5 * xx) * (1 + .5 * xxlo) - sqpi2 * cerf_inline_erfcx(-x * is2);
+}
+
+//! Computes the inverse Mills ratio phi(x) / (1 - Phi(x)).
+static double inv_mills_ratio_kernel(double x) {
+    if (x >= 0)
+        return 1 / (sqpi2 * cerf_inline_erfcx(x * is2));
+    const double g = gauss_kernel(x);
+    return is2pi * g / (1 - .5 * cerf_inline_erfcx(-x * is2) * g);
+}
+
+//! Computes the normal tail probability 1 - Phi(x) = Phi(-x).
+static double normal_tail_kernel(double x) {
+    if (x >= 0)
+        return .5 * cerf_inline_erfcx(x * is2) * gauss_kernel(x);
+    return 1 - .5 * cerf_inline_erfcx(-x * is2) * gauss_kernel(x);
+}
+
+double mills_ratio(double x) {
+    return mills_ratio_kernel(x);
+}
+
+double inv_mills_ratio(double x) {
+    return inv_mills_ratio_kernel(x);
+}
+
+double normal_tail(double x) {
+    return normal_tail_kernel(x);
+}
+
+void mills_ratio_array(size_t n, const double* x, double* result) {
+    for (size_t i = 0; i < n; ++i)
+        result[i] = mills_ratio_kernel(x[i]);
+}
+
+void inv_mills_ratio_array(size_t n, const double* x, double* result) {
+    for (size_t i = 0; i < n; ++i)
+        result[i] = inv_mills_ratio_kernel(x[i]);
+}
+
+void normal_tail_array(size_t n, const double* x, double* result) {
+    for (size_t i = 0; i < n; ++i)
+        result[i] = normal_tail_kernel(x[i]);
+}
@@ -173,7 +173,7 @@ _cerf_cmplx cerf(_cerf_cmplx z) {
   double x = creal(z), y = cimag(z);
 
   if (y == 0)
-    return C(erf(x), y); // preserve sign of 0
+    return C(erf_real(x), y); // preserve sign of 0
   if (x == 0)   // handle separately for speed & handling of y = Inf or NaN
     return C(x, // preserve sign of 0
              /* handle y -> Inf limit manually, since
@@ -267,13 +267,8 @@ _cerf_cmplx cerfc(_cerf_cmplx z) {
                 exp(y^2) -> Inf but Im[w(y)] -> 0, so
                 IEEE will give us a NaN when it should be Inf */
              y * y > 720 ? (y > 0 ? -Inf : Inf) : -exp(y * y) * im_w_of_x(y));
-  if (y == 0.) {
-    if (x * x > 750) // underflow
-      return C(x >= 0 ? 0.0 : 2.0,
-               -y); // preserve sign of 0
-    return C(x >= 0 ? exp(-x * x) * erfcx(x) : 2. - exp(-x * x) * erfcx(-x),
-             -y); // preserve sign of zero
-  }
+  if (y == 0.)
+    return C(erfc_real(x), -y); // preserve sign of zero
 
   double mRe_z2 = (y - x) * (x + y); // Re(-z^2), being careful of overflow
   double mIm_z2 = -2 * x * y;        // Im(-z^2)
@@ -0,0 +1,325 @@
+/* Library libcerf:
+ *   Compute complex error functions, based on a new implementation of
+ *   Faddeeva's w_of_z. Also provide Dawson and Voigt functions.
+ *
+ * File inverse.c:
+ *   Compute the inverse functions erfcx_inv, erfc_inv, erf_inv of real arguments.
+ *   Starting values are obtained from Chebyshev interpolants or asymptotic expansions,
+ *   and are then refined by one Halley step based on erfcx or erf_real.
+ *
+ * Copyright:
+ *   (C) 2026 Forschungszentrum Jülich GmbH
+ *
+ * Licence:
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *   LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *   OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *   WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * Website:
+ *   http://apps.jcns.fz-juelich.de/libcerf
+ *
+ * Revision history:
+ *   ../CHANGELOG
+ *
+ * Manual page:
+ *   man 3 erf_inv
+ */
+
+#include "cerf.h"
+#include "defs.h" // defines _cerf_cmplx, NaN, C, cexp, ...
+#include <math.h>
+#include <stdalign.h>
+
+#ifdef CERF_INTROSPECT
+IMPORT extern int cerf_algorithm;
+IMPORT extern int cerf_nofterms;
+#endif
+
+#include "cerf_inline.h" // defines cerf_inline_erfcx, cerf_inline_frexp2, cerf_inline_poly7
+
+//--- The following code is generated by pro_inverse_chebcoeffs.py; do not edit
+// clang-format off
+alignas(64) static const double ErfcxInvCoeffs[112 * 8] = {
+ 0x0.80f27e792176e8p8, -0x0.e43dd9aa688da8p4, 0x0.cae11aa5c371e8p1, -0x0.b456511d427778p-2, 0x0.a042464b990258p-5, -0x0.8e73ccb4f83f90p-8, 0x0.823dfcfd3aaf60p-11, -0x0.e78aa550685448p-15, // subrange 0:0 (0.00390625..0.00488281)
+ 0x0.d33565ebe00530p7, -0x0.98ca69c9ba2ff8p4, 0x0.de3cc0dcde09e8p0, -0x0.a1a08d220981a8p-3, 0x0.eb1144e45d2230p-7, -0x0.aaf549603ef848p-10, 0x0.fd60c2fb833a48p-14, -0x0.b8465f428dfc00p-17, // subrange 0:1 (0.00488281..0.00585938)
+ 0x0.b2e32b8f37bc20p7, -0x0.daca5c38c71a40p3, 0x0.86a31c12cb1b60p0, -0x0.a5b5104f2f48c8p-4, 0x0.cbef8796e40c20p-8, -0x0.faff6bcd583b78p-12, 0x0.9c8b5858270f48p-15, -0x0.c0ab806c7ed838p-19, // subrange 0:2 (0.00585938..0.00683594)
+ 0x0.9b2f5bf7ba4fb0p7, -0x0.a45654af918da8p3, 0x0.af499e4c073b28p-1, -0x0.baf933dc0faad0p-5, 0x0.c76e8f9f79d558p-9, -0x0.d4ba32cc24e900p-13, 0x0.e5337fff48f848p-17, -0x0.f47b33326ff928p-21, // subrange 0:3 (0.00683594..0.0078125)
+ 0x0.8181d432cc5bb0p7, -0x0.e43fd1fa4fc2e8p3, 0x0.cae11691add488p0, -0x0.b45650fc2e8070p-3, 0x0.a042464bc5aa18p-6, -0x0.8e73ccb4fc2858p-9, 0x0.823dfcfd3aad18p-12, -0x0.e78aa5506852f0p-16, // subrange 1:0 (0.0078125..0.00976562)
+ 0x0.d453930a7f2320p6, -0x0.98cc641d75bea8p3, 0x0.de3cb8e6710678p-1, -0x0.a1a08cdf8d2858p-4, 0x0.eb1144e4fc2e28p-8, -0x0.aaf549604ea5a0p-11, 0x0.fd60c2fb833170p-15, -0x0.b8465f428df698p-18, // subrange 1:1 (0.00976562..0.0117188)
+ 0x0.b400d9d9b9adc8p6, -0x0.dace54cef89768p2, 0x0.86a3144e57f388p-1, -0x0.a5b50fc9a15790p-5, 0x0.cbef8797faed58p-9, -0x0.faff6bcd96fd18p-13, 0x0.9c8b5858271088p-16, -0x0.c0ab806c7ec2c0p-20, // subrange 1:2 (0.0117188..0.0136719)
+ 0x0.9c4c8af1d82840p6, -0x0.a45a511b731bd8p2, 0x0.af498f277d3718p-2, -0x0.baf932cff082c0p-6, 0x0.c76e8fa1592cd0p-10, -0x0.d4ba32cca24c68p-14, 0x0.e5337fff494808p-18, -0x0.f47b33326fa448p-22, // subrange 1:3 (0.0136719..0.015625)
+ 0x0.829e43522c1448p6, -0x0.e447d5f4d41530p2, 0x0.cae0f976f68e58p-1, -0x0.b4564ee1793aa0p-4, 0x0.a042464e99b9b0p-7, -0x0.8e73ccb5f5bf60p-10, 0x0.823dfcfd3c2888p-13, -0x0.e78aa550670860p-17, // subrange 2:0 (0.015625..0.0195312)
+ 0x0.d68a6e815f7630p5, -0x0.98d476402b5370p2, 0x0.de3c81dae3a290p-2, -0x0.a1a088a5b16048p-5, 0x0.eb1144eb736e40p-9, -0x0.aaf5496428c5a8p-12, 0x0.fd60c2fb97e138p-16, -0x0.b8465f42890ca0p-19, // subrange 2:1 (0.0195312..0.0234375)
+ 0x0.b635af18054870p5, -0x0.dade93cf271c68p1, 0x0.86a2e06f190b28p-2, -0x0.a5b50751d74ac0p-6, 0x0.cbef879b5e2910p-10, -0x0.faff6bdcb4c730p-14, 0x0.9c8b5858611928p-17, -0x0.c0ab806c6c6008p-21, // subrange 2:2 (0.0234375..0.0273438)
+ 0x0.9e7f56b99bf540p5, -0x0.a46aa94001fe18p1, 0x0.af492dc2e346e0p-3, -0x0.baf921e1a8cc48p-7, 0x0.c76e8f9575c0b8p-11, -0x0.d4ba32ea183ce0p-15, 0x0.e53380006f3510p-19, -0x0.f47b33322c1480p-23, // subrange 2:3 (0.0273438..0.03125)
+ 0x0.84cdfb43184770p5, -0x0.e468cbb81f0730p1, 0x0.cae049b0f8a7f0p-2, -0x0.b4562d2b22ac30p-5, 0x0.a0424600e9d928p-8, -0x0.8e73cceded4aa8p-11, 0x0.823dfd002bc728p-14, -0x0.e78aa54f81ecd8p-18, // subrange 3:0 (0.03125..0.0390625)
+ 0x0.dae1967c831ed0p4, -0x0.98f5bd9a333948p1, 0x0.de3b54950509b8p-3, -0x0.a1a0461865a9e8p-6, 0x0.eb1142a8cd1f20p-10, -0x0.aaf54a3040bba8p-13, 0x0.fd60c31886ccc0p-17, -0x0.b8465f3fe72778p-20, // subrange 3:1 (0.0390625..0.046875)
+ 0x0.ba847c56f56a50p4, -0x0.db21acbfb04fd8p0, 0x0.86a1e49731fa20p-3, -0x0.a5b484f4c481b0p-7, 0x0.cbef8134482340p-11, -0x0.faff6eb02c2ff8p-15, 0x0.9c8b5899c119b0p-18, -0x0.c0ab8065c7a9e0p-22, // subrange 3:2 (0.046875..0.0546875)
+ 0x0.a2c5b97d40dc80p4, -0x0.a4ae33ff190bd0p0, 0x0.af47968a45a800p-4, -0x0.baf8246642c808p-8, 0x0.c76e7f7dd54ec0p-12, -0x0.d4ba37c5bb2ec8p-16, 0x0.e5338116a66a60p-20, -0x0.f47b332652a020p-24, // subrange 3:3 (0.0546875..0.0625)
+ 0x0.8907a7584d69b8p4, -0x0.e4f0de10923318p0, 0x0.cade31070ac958p-3, -0x0.b4544d7825d680p-6, 0x0.a0421dde8c8bb8p-9, -0x0.8e73d42b41d1d8p-12, 0x0.823dff318ff3f8p-15, -0x0.e78aa56a9dfd58p-19, // subrange 4:0 (0.0625..0.078125)
+ 0x0.e332cfdb2ed090p3, -0x0.997e84f923d6e0p0, 0x0.de39d2b1bcd950p-4, -0x0.a19cdeaa67c5d8p-7, 0x0.eb1085f5692628p-11, -0x0.aaf55a832fac40p-14, 0x0.fd60d2e829b838p-18, -0x0.b84660b45929e0p-21, // subrange 4:1 (0.078125..0.09375)
+ 0x0.c2b37e6d938670p3, -0x0.dc335f133cfe80p-1, 0x0.86a2cbd792bf68p-4, -0x0.a5ae7aa2cc67a0p-8, 0x0.cbedecf2540568p-12, -0x0.faff84d989e2d8p-16, 0x0.9c8b72333ccb88p-19, -0x0.c0ab880105fc68p-23, // subrange 4:2 (0.09375..0.109375)
+ 0x0.aad2925afa21e0p3, -0x0.a5bee8151096b8p-1, 0x0.af4da0797c2150p-5, -0x0.baeda73486da98p-9, 0x0.c76b512a3594d0p-13, -0x0.d4ba2172dbc100p-17, 0x0.e533cc637bbf88p-21, -0x0.f47b51c72b5960p-25, // subrange 4:3 (0.109375..0.125)
+ 0x0.90e1a57f05fd70p3, -0x0.e70bb2da767968p-1, 0x0.caf4bfa3a6d220p-4, -0x0.b443f7988a2258p-7, 0x0.a03c2ce3733558p-10, -0x0.8e7328d4f030f8p-13, 0x0.823e4d274ea058p-16, -0x0.e78b05e8b90330p-20, // subrange 5:0 (0.125..0.15625)
+ 0x0.f261bb756df218p2, -0x0.9b8b5db1176d28p-1, 0x0.de7b38cdb25da0p-5, -0x0.a1871a2e0290f8p-8, 0x0.eafce068fe1bb8p-12, -0x0.aaf1b187e9b750p-15, 0x0.fd613c39d81770p-19, -0x0.b8473298584be8p-22, // subrange 5:1 (0.15625..0.1875)
+ 0x0.d16165e5499000p2, -0x0.e028dc91c18950p-2, 0x0.86f12009324f28p-5, -0x0.a59449daf02e38p-9, 0x0.cbcfc9dd426700p-13, -0x0.faf156254d0e68p-17, 0x0.9c8a56032b47d8p-20, -0x0.c0acd53ab97c78p-24, // subrange 5:2 (0.1875..0.21875)
+ 0x0.b904536849ba90p2, -0x0.a98b36d4b637c0p-2, 0x0.aff8cfc8a4aaa0p-6, -0x0.bad3300a85cb08p-10, 0x0.c73f73fb28f5b8p-14, -0x0.d4a248a0572468p-18, 0x0.e52ce1f7c72270p-22, -0x0.f47c4685f35800p-26, // subrange 5:3 (0.21875..0.25)
+ 0x0.9e633c9072e3d0p2, -0x0.ee20617314d408p-2, 0x0.cc594516e97988p-5, -0x0.b441eab69eaf98p-8, 0x0.a009c8dedef998p-11, -0x0.8e52f453ac5e78p-14, 0x0.82319d9f56d718p-17, -0x0.e7861beb4594e0p-21, // subrange 6:0 (0.25..0.3125)
+ 0x0.85daf1b29c6998p2, -0x0.a1effe4537e700p-2, 0x0.e12a3b5c7ec5b8p-6, -0x0.a1c6ba5438f6d8p-9, 0x0.eaaaaf34844d78p-13, -0x0.aaae8f10121070p-16, 0x0.fd2263210898d0p-20, -0x0.b832736a93f148p-23, // subrange 6:1 (0.3125..0.375)
+ 0x0.e9314db67cb148p1, -0x0.eba8898d0ffc18p-3, 0x0.89656e47843740p-6, -0x0.a64442a5194970p-10, 0x0.cba2b91878ab98p-14, -0x0.fa71641b579738p-18, 0x0.9c474e3822d010p-21, -0x0.c079ad9d2e7168p-25, // subrange 6:2 (0.375..0.4375)
+ 0x0.cf7734340bd780p1, -0x0.b3e1ab8ca7e7b8p-3, 0x0.b45921fdb087b0p-7, -0x0.bc41177a8b0b40p-11, 0x0.c752c16ce59a20p-15, -0x0.d43359bace7fc8p-19, 0x0.e4a6effc9ce7b8p-23, -0x0.f40ea068361068p-27, // subrange 6:3 (0.4375..0.5)
+ 0x0.b30aec4f6688b0p1, -0x0.ffd028870696e0p-3, 0x0.d39100eabbd0e8p-6, -0x0.b6ce15fecc73c0p-9, 0x0.a09bbff20a9a48p-12, -0x0.8e2a944eda4a20p-15, 0x0.81d953ab8172b0p-18, -0x0.e6e7634a55ce80p-22, // subrange 7:0 (0.5..0.625)
+ 0x0.988199ee2e5b00p1, -0x0.b074abaf80b5c8p-3, 0x0.ec39fc160e2840p-7, -0x0.a5ae2a64d3daa8p-10, 0x0.ecf4b260acfd38p-14, -0x0.ab064f5a999440p-17, 0x0.fcb075b49f9970p-21, -0x0.b79eac8de224e0p-24, // subrange 7:1 (0.625..0.75)
+ 0x0.8597572e8bd0d0p1, -0x0.81ea085e5707a0p-3, 0x0.91ed99d4911368p-7, -0x0.ac09abb1ac3cf0p-11, 0x0.cf2c5744bf09d0p-15, -0x0.fc29a6bff60a68p-19, 0x0.9c679ea1759558p-22, -0x0.c00a9b7bf126d8p-26, // subrange 7:2 (0.75..0.875)
+ 0x0.eeae0a6775b0b0p0, -0x0.c84682d8876a60p-4, 0x0.c1aeb9819b82a8p-8, -0x0.c4c3fa1acfbf20p-12, 0x0.cc7269e5f3f628p-16, -0x0.d6f0bfd6848fc0p-20, 0x0.e5bd24b89f9b88p-24, -0x0.f40ba8404e4b28p-28, // subrange 7:3 (0.875..1)
+ 0x0.ced9f810f9f5b0p0, -0x0.9013ff21c86920p-3, 0x0.e67fe76cf2fa58p-7, -0x0.c1cac559fc5120p-10, 0x0.a6cc78b20f6978p-13, -0x0.91768b44f6c068p-16, 0x0.836e513d04c980p-19, -0x0.e8148b30d44ea8p-23, // subrange 8:0 (1..1.25)
+ 0x0.b0c9e32bdbace0p0, -0x0.c90fbfe2803500p-4, 0x0.82b18a9194ffe8p-7, -0x0.b28edf760a4948p-11, 0x0.f9fab5a8ae46d8p-15, -0x0.b1716a7a7bea28p-18, 0x0.8163fff019c960p-21, -0x0.ba48426e2b5fb8p-25, // subrange 8:1 (1.25..1.5)
+ 0x0.9b257471b74510p0, -0x0.9542d3a0ae0800p-4, 0x0.a37291e1b7e450p-8, -0x0.bbfdc7a605c8f8p-12, 0x0.dda4fffeb0f740p-16, -0x0.848ff541faff50p-19, 0x0.a21ded112dc718p-23, -0x0.c4df235657f390p-27, // subrange 8:2 (1.5..1.75)
+ 0x0.8ab8f3107e4100p0, -0x0.e781c4aadc80c0p-5, 0x0.db091baab53a80p-9, -0x0.d981777bc91818p-13, 0x0.dd6be7a0f17400p-17, -0x0.e4c022f7668880p-21, 0x0.f0e604db490040p-25, -0x0.fcd7f71d3fa7c0p-29, // subrange 8:3 (1.75..2)
+ 0x0.f0888ddf94d268p-1, -0x0.a79d3f585660d8p-4, 0x0.83c6e2df382b98p-7, -0x0.d93510eca97c48p-11, 0x0.b7722609e2b870p-14, -0x0.9d4a055cf7d220p-17, 0x0.8befa5ffa7fc38p-20, -0x0.f3fec9f42734c8p-24, // subrange 9:0 (2..2.5)
+ 0x0.cd76d4c0270178p-1, -0x0.eb25998dec3248p-5, 0x0.96f95a40d345d0p-8, -0x0.cae62ebc22a6e0p-12, 0x0.8bacbfb55fd0c0p-15, -0x0.c33344233e18a0p-19, 0x0.8c41ecc02f8f78p-22, -0x0.c75f4df6678650p-26, // subrange 9:1 (2.5..3)
+ 0x0.b41cc27981aa70p-1, -0x0.af1a3f30d65ec8p-5, 0x0.be21bdf7be4878p-9, -0x0.d7c21f00931810p-13, 0x0.fab46bb0bf7068p-17, -0x0.93d1f97affd098p-20, 0x0.b250cf265259a0p-24, -0x0.d5e4afe4cf5ab8p-28, // subrange 9:2 (3..3.5)
+ 0x0.a0d3c93384fda0p-1, -0x0.8807d34da2ca58p-5, 0x0.80045b585022f0p-9, -0x0.fb7bd1aeb9a378p-14, 0x0.fccd872ef40df0p-18, -0x0.80ec2149c2c4f8p-21, 0x0.86118a9afbe878p-25, -0x0.8b15c612e7ad08p-29, // subrange 9:3 (3.5..4)
+ 0x0.8b1fddaf875a78p-1, -0x0.c532e4666bf738p-5, 0x0.9ac43e1e6845a8p-8, -0x0.fd1d63d061cd88p-12, 0x0.d3a0ee387aa870p-15, -0x0.b37fe3b7032f50p-18, 0x0.9de1fb4a101458p-21, -0x0.8833f9d53e84c8p-24, // subrange 10:0 (4..5)
+ 0x0.ecfc645cddffc8p-2, -0x0.8a52e58596b090p-5, 0x0.b1ecee05810e60p-9, -0x0.ee027c0c8f6260p-13, 0x0.a2a41946281bf0p-16, -0x0.e15b8b37009938p-20, 0x0.a06c2ad1560238p-23, -0x0.e1fb4d432d8728p-27, // subrange 10:1 (5..6)
+ 0x0.cf2bbaf9b71ce0p-2, -0x0.cdd304fdd0d430p-6, 0x0.e06e2e625c4438p-10, -0x0.fe19b5c3a08920p-14, 0x0.92db163ce38a58p-17, -0x0.ac04d550df4eb0p-21, 0x0.cdee6a65bc3818p-25, -0x0.f51edcabb64eb0p-29, // subrange 10:2 (6..7)
+ 0x0.b8840a3d31b870p-2, -0x0.9fb0814724d870p-6, 0x0.9730d7fd058780p-10, -0x0.947023b64012b0p-14, 0x0.94aff88a343648p-18, -0x0.96ddfb56bac058p-22, 0x0.9beb21ce4e89c0p-26, -0x0.a0b29c6c1919b8p-30, // subrange 10:3 (7..8)
+ 0x0.9f10b5abf3cbd0p-2, -0x0.e6f8612ec48c08p-6, 0x0.b6b9e4fa498b38p-9, -0x0.95a9a17bbd6bf0p-12, 0x0.f9de5b2760ec88p-16, -0x0.d337dbd3391778p-19, 0x0.b8e8186a4db0b8p-22, -0x0.9eb51a3dfd1dd0p-25, // subrange 11:0 (8..10)
+ 0x0.86efbd6e4b42c8p-2, -0x0.a1800af5a97878p-6, 0x0.d1c41373342b40p-10, -0x0.8ccc0f733f6380p-13, 0x0.c07b656d68ed30p-17, -0x0.85241dcecd6f88p-20, 0x0.bd01799f5900d8p-24, -0x0.84a702d8825088p-27, // subrange 11:1 (10..12)
+ 0x0.eb1d0a2e7b5430p-3, -0x0.ef93675ca9ba30p-7, 0x0.840a22dde40278p-10, -0x0.9638d48c09c0f0p-14, 0x0.aded57b012efe8p-18, -0x0.cbac7421006408p-22, 0x0.f37148e3b4d1c8p-26, -0x0.908b6114ca1730p-29, // subrange 11:2 (12..14)
+ 0x0.d0c7ad65701130p-3, -0x0.b95804a7fe87b0p-7, 0x0.b186739eab8af0p-11, -0x0.af4e5df66228f8p-15, 0x0.b0114cbd167b10p-19, -0x0.b2c772db7beb48p-23, 0x0.b8a8d4d512f1a0p-27, -0x0.be0c9e58a2f5b0p-31, // subrange 11:3 (14..16)
+ 0x0.b34be1a6e45f70p-3, -0x0.8584186b72a9b8p-6, 0x0.d5dee32444adc8p-10, -0x0.b05cf6276ae340p-13, 0x0.93c626dd72d960p-16, -0x0.fa4a53a4095818p-20, 0x0.db3984417c2828p-23, -0x0.bc1776fdd46f18p-26, // subrange 12:0 (16..20)
+ 0x0.977619b7ef9130p-3, -0x0.b9df1e3a1d13a8p-7, 0x0.f488ebb8498450p-11, -0x0.a562e993653ee0p-14, 0x0.e328ce3c433470p-18, -0x0.9d92e680bdf6d8p-21, 0x0.e00b3c964ed658p-25, -0x0.9d5809ce0f4248p-28, // subrange 12:1 (20..24)
+ 0x0.837f2b11d08a90p-3, -0x0.89542d7a58fd80p-7, 0x0.995d2db96e42d8p-11, -0x0.afe6cc49b55be8p-15, 0x0.ccbdf53892ec48p-19, -0x0.f09a3a393d4a08p-23, 0x0.901f29603485a8p-26, -0x0.ab607daeeaa3e0p-30, // subrange 12:2 (24..28)
+ 0x0.e8da9eeac97cd8p-4, -0x0.d3c40b8028e208p-8, 0x0.cd8469c54bf568p-12, -0x0.cca98656e1f140p-16, 0x0.cebb239d6ed300p-20, -0x0.d2c0f3921efdb8p-24, 0x0.da4c386056e958p-28, -0x0.e117756b199438p-32, // subrange 12:3 (28..32)
+ 0x0.c73d1345365f38p-4, -0x0.97e37386a94d38p-7, 0x0.f68498f6b0ae80p-11, -0x0.cd0e3816018fe8p-14, 0x0.acdee2a1673688p-17, -0x0.930dfa35551140p-20, 0x0.813e404c0f0e60p-23, -0x0.de501e9a95e480p-27, // subrange 13:0 (32..40)
+ 0x0.a7a58d149d0ca8p-4, -0x0.d2714f3e041c08p-8, 0x0.8c3d83ecc2e650p-11, -0x0.bf607891bc5a18p-15, 0x0.84467267214c28p-18, -0x0.b8676dcd8273d8p-22, 0x0.8399a0691b4940p-25, -0x0.b9613399767358p-29, // subrange 13:1 (40..48)
+ 0x0.911619c4fffcd8p-4, -0x0.9adf9d25cce760p-8, 0x0.af2e7c50f2f260p-12, -0x0.cab53a6678f700p-16, 0x0.ed7f6223db2738p-20, -0x0.8c41fe7374f270p-23, 0x0.a8b7f68a407730p-27, -0x0.c94534e5bb03f0p-31, // subrange 13:2 (48..56)
+ 0x0.801e750974cb48p-4, -0x0.ee07ab5e43c0d0p-9, 0x0.e9ec5d5151e588p-13, -0x0.eb01c00db57818p-17, 0x0.eef5ff88724948p-21, -0x0.f4e1c233287328p-25, 0x0.feba26216174b8p-29, -0x0.83c6cd2af63440p-32, // subrange 13:3 (56..64)
+ 0x0.da87a53f6b5d28p-5, -0x0.aa056915ff6508p-8, 0x0.8baae45d9eaef8p-11, -0x0.ea60771528f8c8p-15, 0x0.c6e7b1bd62b710p-18, -0x0.aa197f1efcd3a8p-21, 0x0.962c5275cf0ea0p-24, -0x0.819f06d1347938p-27, // subrange 14:0 (64..80)
+ 0x0.b73e2fb2b54790p-5, -0x0.ea86633c8f86e0p-9, 0x0.9e239a0d12e4a0p-12, -0x0.d9a3896c79e7d0p-16, 0x0.976b442f2ee9d0p-19, -0x0.d437de4ad8f730p-23, 0x0.9823a42bc9ff18p-26, -0x0.d71c757931cf98p-30, // subrange 14:1 (80..96)
+ 0x0.9e251474dbb0c8p-5, -0x0.abfb4d2fab3230p-9, 0x0.c4c26cf7262180p-13, -0x0.e5912688eb41e0p-17, 0x0.875b596385bbb8p-20, -0x0.a0b8cbe5b8b690p-24, 0x0.c23657dd5e8a60p-28, -0x0.e88f50a0029b00p-32, // subrange 14:2 (96..112)
+ 0x0.8b54a80c75f0b8p-5, -0x0.83c533a0abae30p-9, 0x0.82eeff762e3150p-13, -0x0.849b28b6d37240p-17, 0x0.87b2b1f80c7950p-21, -0x0.8bca3c00f52d10p-25, 0x0.921072e9a6ac80p-29, -0x0.97b330795e8b68p-33, // subrange 14:3 (112..128)
+ 0x0.ecfc9a3cbf9c20p-6, -0x0.bb8e58d7db9200p-9, 0x0.9bb5f3f3857330p-12, -0x0.83ac0d00be18a0p-15, 0x0.e0e03065f4be20p-19, -0x0.c14c64235405f0p-22, 0x0.ab6f164188d4c8p-25, -0x0.9487cfbe932eb0p-28, // subrange 15:0 (128..160)
+ 0x0.c622484436fc10p-6, -0x0.80dbb5a77b9d78p-9, 0x0.af896d22da15a0p-13, -0x0.f3650c3b80d430p-17, 0x0.aa5a615ca80438p-20, -0x0.eff2ac31010a38p-24, 0x0.acc6d85c5d36c8p-27, -0x0.f53340c2ee45c0p-31, // subrange 15:1 (160..192)
+ 0x0.aa98796992f558p-6, -0x0.bc687add07c768p-10, 0x0.d9a4ece3236c58p-14, -0x0.ffc48d403c3040p-18, 0x0.97adee183d0dc8p-21, -0x0.b4fa4c87fa3880p-25, 0x0.db9f4ff987c448p-29, -0x0.83f96b909ff5b0p-32, // subrange 15:2 (192..224)
+ 0x0.96029bc671edd8p-6, -0x0.8ffd8a66133278p-10, 0x0.9069c5231ec748p-14, -0x0.9347441cf3a028p-18, 0x0.978f3c53862178p-22, -0x0.9cde0d927a6760p-26, 0x0.a4967169f69d48p-30, -0x0.ab8cffbc0a7fa0p-34, // subrange 15:3 (224..256)
+ 0x0.fe8cd80c3d7880p-7, -0x0.cc5094ecb2af00p-10, 0x0.ab2217db29b930p-13, -0x0.91ada4809ec880p-16, 0x0.fa22ec4aa71178p-20, -0x0.d7fd6434798ca8p-23, 0x0.c05929ba9cccd8p-26, -0x0.a73a719a9d0f60p-29, // subrange 16:0 (256..320)
+ 0x0.d44b03bb743220p-7, -0x0.8beab1fb472e00p-10, 0x0.c034ad9412bb60p-14, -0x0.8618c77b698168p-17, 0x0.bcac4f6a995d98p-21, -0x0.85741c6a3780d8p-24, 0x0.c0f00315d0c548p-28, -0x0.895cfbe05d9ba0p-31, // subrange 16:1 (320..384)
+ 0x0.b66de1a8216bd8p-7, -0x0.cc0d03eb1cdf68p-11, 0x0.ed9b92f2acd1d8p-15, -0x0.8c7568f5fe7e20p-18, 0x0.a769cbe070caa0p-22, -0x0.c8959f1c382df0p-26, 0x0.f4522960c71f30p-30, -0x0.934a2fd7b4f758p-33, // subrange 16:2 (384..448)
+ 0x0.a0286df9ee19c8p-7, -0x0.9b9d970d25b278p-11, 0x0.9d46bc887540e8p-15, -0x0.a15467f3c7d200p-19, 0x0.a6ce41ba5544b0p-23, -0x0.ad57bb72f8eb78p-27, 0x0.b6862406c549d0p-31, -0x0.bed72d21e72c18p-35, // subrange 16:3 (448..512)
+ 0x0.879e4d3408cff8p-7, -0x0.dc3dcdcda88cc8p-11, 0x0.b9d2eaff0cfe90p-14, -0x0.9f0ef223b79c28p-17, 0x0.892bb7f4798bb0p-20, -0x0.edcceb2c12af68p-24, 0x0.d4843638b11d60p-27, -0x0.b95056d9bf81a8p-30, // subrange 17:0 (512..640)
+ 0x0.e1bee0df2fe4f8p-8, -0x0.966af4c961a588p-11, 0x0.d00f264c29cb68p-15, -0x0.91ea5dd1d3c4d8p-18, 0x0.ce2d7aae9c1f80p-22, -0x0.925da0aacf7958p-25, 0x0.d44d0be7d7a8a0p-29, -0x0.97941c74e8f010p-32, // subrange 17:1 (640..768)
+ 0x0.c1ac9098b388a8p-8, -0x0.dae5f7751cc7e0p-12, 0x0.8049ab5c242df8p-15, -0x0.986d2f4c63e760p-19, 0x0.b66ada68d3e5c0p-23, -0x0.db52394ccebfe0p-27, 0x0.85fced133a0f28p-30, -0x0.a1fd74c48a6960p-34, // subrange 17:2 (768..896)
+ 0x0.a9cd8510859270p-8, -0x0.a6a5ab4d96b990p-12, 0x0.a97d691b2eed28p-16, -0x0.aeb05d92780a28p-20, 0x0.b5530af4a610b0p-24, -0x0.bd0f4717f76e40p-28, 0x0.c7aabf82670630p-32, -0x0.d14fd141282ce8p-36, // subrange 17:3 (896..1024)
+ 0x0.8f8d12ebe31770p-8, -0x0.eb5a4efc828ff8p-12, 0x0.c7c3a7a44e5e88p-15, -0x0.abc41f8a5a43d8p-18, 0x0.94add7c0aa41d8p-21, -0x0.8148d378595268p-24, 0x0.e7c04fa087eea0p-28, -0x0.ca96c431d7b9f0p-31, // subrange 18:0 (1024..1280)
+ 0x0.ee8ae753ba0fd0p-9, -0x0.a061b7c00c54c8p-12, 0x0.df18c78668fdc8p-16, -0x0.9d218be2a0fa70p-19, 0x0.decd6c398a61b0p-23, -0x0.9ea432e1de9fa0p-26, 0x0.e6bb4b78336d70p-30, -0x0.a5201ef5ee74f0p-33, // subrange 18:1 (1280..1536)
+ 0x0.cc60473651a098p-9, -0x0.e8fd1ec764ecf8p-13, 0x0.894845b3e16db0p-16, -0x0.a3c7480021f468p-20, 0x0.c4a825bd8cf020p-24, -0x0.ed1dbf18e553a8p-28, 0x0.913b2f36dbae58p-31, -0x0.affa3da1ebe310p-35, // subrange 18:2 (1536..1792)
+ 0x0.b2fc7b97f39fa0p-9, -0x0.b11e5ebaa78330p-13, 0x0.b512b720ecf5a8p-17, -0x0.bb5b87f404c150p-21, 0x0.c318c54c2227a8p-25, -0x0.cbfa0829a6a390p-29, 0x0.d7f2dcb2726078p-33, -0x0.e2de5531119748p-37, // subrange 18:3 (1792..2048)
+ 0x0.971be5ebf61940p-9, -0x0.f9b3d3f3d6d460p-13, 0x0.d4fca05eefc4a0p-16, -0x0.b7d0b7619fb6b0p-19, 0x0.9f97753121cf98p-22, -0x0.8b22535606ddd0p-25, 0x0.fa01239a2f8f18p-29, -0x0.dafdd72408a520p-32, // subrange 19:0 (2048..2560)
+ 0x0.fabe70eca56478p-10, -0x0.a9d9320d8931f8p-13, 0x0.ed5d3d1cd06308p-17, -0x0.a7c412e9c496b8p-20, 0x0.ee9050506c7bc8p-24, -0x0.aa47c14d607288p-27, 0x0.f835e2b7b8d1b0p-31, -0x0.b1fa293001f460p-34, // subrange 19:1 (2560..3072)
+ 0x0.d696246acd67b8p-10, -0x0.f662062f080e98p-14, 0x0.91d1b211187a38p-17, -0x0.ae8b67b4a2d090p-21, 0x0.d22824a49f45a0p-25, -0x0.fdfc4e84008060p-29, 0x0.9be3f0af2d2060p-32, -0x0.bd3dac00cd3680p-36, // subrange 19:2 (3072..3584)
+ 0x0.bbc0b8c70e4120p-10, -0x0.bb13d26b8fc280p-14, 0x0.c012211ce088d8p-18, -0x0.c7600dfe083540p-22, 0x0.d027c867de02c0p-26, -0x0.da1e1c841de880p-30, 0x0.e761f347d2bf68p-34, -0x0.f3832271359dd0p-38, // subrange 19:3 (3584..4096)
+ 0x0.9e543fb40bc4d8p-10, -0x0.83ade3cad4f650p-13, 0x0.e18c33dd615308p-17, -0x0.c33ffa8cf19290p-20, 0x0.a9f0fdc8f4cf78p-23, -0x0.9478f1efd08f28p-26, 0x0.85a74ff2a27ef0p-29, -0x0.ea8a069e8a9a88p-33, // subrange 20:0 (4096..5120)
+ 0x0.83346afed27440p-10, -0x0.b2dd4d758886e0p-14, 0x0.faed37dccb19f0p-18, -0x0.b1dd2492416d68p-21, 0x0.fd84b62ade67d0p-25, -0x0.b5517dd53a0940p-28, 0x0.846415d918ce58p-31, -0x0.be28d6ef0768b0p-35, // subrange 20:1 (5120..6144)
+ 0x0.e05af8604f3a38p-11, -0x0.8192f0839b58f8p-14, 0x0.99f061d5116330p-18, -0x0.b8c5be264c5678p-22, 0x0.def8b5768d3b08p-26, -0x0.86feae5efa1988p-29, 0x0.a5ffb66a5c2cd8p-33, -0x0.c9d0d329dd52e8p-37, // subrange 20:2 (6144..7168)
+ 0x0.c4252f3d503b78p-11, -0x0.c492f655cff718p-15, 0x0.ca897fc27692b8p-19, -0x0.d2cc34e052f4c0p-23, 0x0.dc8e7653451d10p-27, -0x0.e789c53e7960d8p-31, 0x0.f60609993a82f8p-35, -0x0.81a5d90c53fa60p-38, // subrange 20:3 (7168..8192)
+ 0x0.a53f0e45420ab0p-11, -0x0.8a32064f973a30p-14, 0x0.ed829f2bab6138p-18, -0x0.ce2020acb9c128p-21, 0x0.b3c6a3e93ae8e8p-24, -0x0.9d5701154437b8p-27, 0x0.8ddd39e7acbde8p-30, -0x0.f949f402aebd40p-34, // subrange 21:0 (8192..10240)
+ 0x0.88cc276e597500p-11, -0x0.bb79de9df2c558p-15, 0x0.83ed499236d408p-18, -0x0.bb79c29eb40ad8p-22, 0x0.85de9a85fee3d0p-25, -0x0.bfce880de377b8p-29, 0x0.8c4268cecd8a08p-32, -0x0.c9b91ba21b66d0p-36, // subrange 21:1 (10240..12288)
+ 0x0.e9ba7f0df8d308p-12, -0x0.87acb0cd6c2e68p-15, 0x0.a1af1c43dc3dc0p-19, -0x0.c283baeeddddd8p-23, 0x0.eb2a49761134b8p-27, -0x0.8e9a66a8071678p-30, 0x0.af9a9449aeefb8p-34, -0x0.d5c21684b028d0p-38, // subrange 21:2 (12288..14336)
+ 0x0.cc33cf3c066be8p-12, -0x0.cda82459a8de30p-16, 0x0.d486c13b16b3f8p-20, -0x0.ddaf28a5692050p-24, 0x0.e85d091f61dc18p-28, -0x0.f44e2b5058bb88p-32, 0x0.81f8a6572530c0p-35, -0x0.89257bd823e910p-39, // subrange 21:3 (14336..16384)
+ 0x0.abe45914a65088p-12, -0x0.906eb424a06420p-15, 0x0.f8efc844815590p-19, -0x0.d87fb7ff81dd38p-22, 0x0.bd257d88fa8660p-25, -0x0.a5c8241193a630p-28, 0x0.95acde088d12a0p-31, -0x0.83a812c3944c90p-34, // subrange 22:0 (16384..20480)
+ 0x0.8e2cc400762d50p-12, -0x0.c3b9cef401fff0p-16, 0x0.8a1b2f37eced00p-19, -0x0.c4a6ce8e534970p-23, 0x0.8ca673b285e988p-26, -0x0.c9cce369950328p-30, 0x0.93c04f3e939c68p-33, -0x0.d4ba04f2c65268p-37, // subrange 22:1 (20480..24576)
+ 0x0.f2bf1d518a8d00p-13, -0x0.8d85e097c65800p-16, 0x0.a9180168a908b0p-20, -0x0.cbd2601968ca60p-24, 0x0.f6cd4ac27da338p-28, -0x0.95db8edbeefd58p-31, 0x0.b8c168173f49c8p-35, -0x0.e1215187a5c3e8p-39, // subrange 22:2 (24576..28672)
+ 0x0.d3f55c3cdff510p-13, -0x0.d65e8709161de8p-17, 0x0.de16d234dc6c48p-21, -0x0.e8175c1f54f058p-25, 0x0.f3a35e5c6493b8p-29, -0x0.803e4542a3a370p-32, 0x0.889b4119deb0c0p-36, -0x0.904a8ac9489768p-40, // subrange 22:3 (28672..32768)
+ 0x0.b24b2bbc59df80p-13, -0x0.966b7007d00450p-16, 0x0.81f11e3f996e98p-19, -0x0.e26c5e47d3c6b0p-23, 0x0.c61a0d912a1d08p-26, -0x0.add7badc803980p-29, 0x0.9d20cccf26c060p-32, -0x0.8a57c932cb9640p-35, // subrange 23:0 (32768..40960)
+ 0x0.935bc9e7e28650p-13, -0x0.cba6cf526e3310p-17, 0x0.90080305496fa0p-20, -0x0.cd70233086cfb8p-24, 0x0.9322d9a3ccba08p-27, -0x0.d359edf3789948p-31, 0x0.9ae7e378984f00p-34, -0x0.df3a7933a0f858p-38, // subrange 23:1 (40960..49152)
+ 0x0.fb71e0cbbf13a0p-14, -0x0.9325383b200860p-17, 0x0.b0342442cf57b8p-21, -0x0.d4bd83c2d0b888p-25, 0x0.80f871c4a81d18p-28, -0x0.9ccbc3192050e0p-32, 0x0.c1807405627438p-36, -0x0.ebfddb65fabbe0p-40, // subrange 23:2 (49152..57344)
+ 0x0.db71742f372018p-14, -0x0.debfef173a8510p-18, 0x0.e74534f8bad258p-22, -0x0.f211d8d1179598p-26, 0x0.fe6ff7a5643398p-30, -0x0.86126d24999130p-33, 0x0.8ef3a5683d75d8p-37, -0x0.971e9a0ce11290p-41, // subrange 23:3 (57344..65536)
+ 0x0.b879a26c7444e8p-14, -0x0.9c2ecc25830ad8p-17, 0x0.87336d07eded18p-20, -0x0.ebf2400dece2c8p-24, 0x0.ceafa385782ff8p-27, -0x0.b5902b3b9c0d60p-30, 0x0.a442cb5fb2c398p-33, -0x0.90bcfb3f897828p-36, // subrange 24:0 (65536..81920)
+ 0x0.985e03fb63e2a0p-14, -0x0.d349510eb0cbd0p-18, 0x0.95ba8b9293d298p-21, -0x0.d5e04325fcefc8p-25, 0x0.995bce1d7dea00p-28, -0x0.dc81b9592e0f38p-32, 0x0.a1c25ac02ae440p-35, -0x0.e9482c87531cc0p-39, // subrange 24:1 (81920..98304)
+ 0x0.81ed4ecbad0d28p-14, -0x0.98908e3e937d40p-18, 0x0.b70b74fe5a9150p-22, -0x0.dd4f94b7c40618p-26, 0x0.86514606d8b998p-29, -0x0.a3739d7e7aac60p-33, 0x0.c9e2c793449ba0p-37, -0x0.f665a6ed8efd98p-41, // subrange 24:2 (98304..114688)
+ 0x0.e2aeac12459d78p-15, -0x0.e6d4df046ce4c0p-19, 0x0.f01bf2c1980850p-23, -0x0.fbaa0fe45c9f20p-27, 0x0.8467d2f8ecd488p-30, -0x0.8baaa715784970p-34, 0x0.9509b7f9e447e8p-38, -0x0.9daa4c8bc8ecd8p-42, // subrange 24:3 (114688..131072)
+ 0x0.be75040b99f0f0p-15, -0x0.a1be77f04ce8b0p-18, 0x0.8c4467f1d89cf0p-21, -0x0.f51bfff15fd978p-25, 0x0.d6f02ecb87f4f8p-28, -0x0.bcfaa457112740p-31, 0x0.ab1b882fe3e138p-34, -0x0.96df954cd2bf10p-37, // subrange 25:0 (131072..163840)
+ 0x0.9d3795801daaa8p-15, -0x0.daa89f08d85538p-19, 0x0.9b38a7ee4b6e80p-22, -0x0.de00534e06df00p-26, 0x0.9f5850392d3440p-29, -0x0.e54edd9737af38p-33, 0x0.a857d41000af58p-36, -0x0.f2ef4333384b00p-40, // subrange 25:1 (163840..196608)
+ 0x0.86000b0f607d40p-15, -0x0.9dccec409ac950p-19, 0x0.bda4d122f04698p-23, -0x0.e591a028e56708p-27, 0x0.8b76ff57baafc8p-30, -0x0.a9daa29a4b34d8p-34, 0x0.d1f21723c8f020p-38, -0x0.80327eaf5519d8p-41, // subrange 25:2 (196608..229376)
+ 0x0.e9b2b30b4e1a10p-16, -0x0.eea4ad7e775520p-20, 0x0.f8a3b6aa83c630p-24, -0x0.8274f4de149b18p-27, 0x0.8966c553fb71a8p-31, -0x0.910d22c06a4d80p-35, 0x0.9ae45f2d0ee268p-39, -0x0.a3f5355a685968p-43, // subrange 25:3 (229376..262144)
+ 0x0.c441dfb4320bf8p-16, -0x0.a71f59f4c404d0p-19, 0x0.9128e1d25e1738p-22, -0x0.fdf2cecca8db90p-26, 0x0.dee44a5201ac18p-29, -0x0.c41f1fb63c2120p-32, 0x0.b1b292743b1630p-35, -0x0.9cc68263ff0ce8p-38, // subrange 26:0 (262144..327680)
+ 0x0.a1ec1237354ce0p-16, -0x0.e1cb0229a1c9e0p-20, 0x0.a087677c358528p-23, -0x0.e5d83753096df0p-27, 0x0.a51e6bc5b98ad0p-30, -0x0.edca86b0a90c18p-34, 0x0.aeaf5b33b618e8p-37, -0x0.fc3a4bd9f9a4c8p-41, // subrange 26:1 (327680..393216)
+ 0x0.89f411b1bba1b8p-16, -0x0.a2dea9c792f080p-20, 0x0.c40622b628fce8p-24, -0x0.ed8b736857fc60p-28, 0x0.906ead225add28p-31, -0x0.b007518bfa81e0p-35, 0x0.d9b6c92dc0b310p-39, -0x0.850342f6898228p-42, // subrange 26:2 (393216..458752)
+ 0x0.f08274d423a780p-17, -0x0.f635ae22b57928p-21, 0x0.8071fbfff94d80p-24, -0x0.86ecf7aea474f0p-28, 0x0.8e399f29310c70p-32, -0x0.963f36f10a5a88p-36, 0x0.a0899179097b20p-40, -0x0.aa05e28be8dd40p-44, // subrange 26:3 (458752..524288)
+ 0x0.c9e428bffea570p-17, -0x0.ac55ac43a8aba0p-20, 0x0.95e5023968f4d0p-23, -0x0.833f4b563c1220p-26, 0x0.e6935fb7266e18p-30, -0x0.cb047d244e8e10p-33, 0x0.b80e6fedbf3188p-36, -0x0.a277bc38f60348p-39, // subrange 27:0 (524288..655360)
+ 0x0.a67e949d617fb8p-17, -0x0.e8b5e72746f5b0p-21, 0x0.a5ab2646311da8p-24, -0x0.ed6eba1fd476c8p-28, 0x0.aab3555c82b008p-31, -0x0.f5fc9ad301d8c0p-35, 0x0.b4cf028a07a030p-38, -0x0.829930840de190p-41, // subrange 27:1 (655360..786432)
+ 0x0.8dcbecc61607a8p-17, -0x0.a7c986f022e278p-21, 0x0.ca3482ad2599b8p-25, -0x0.f543c65cb1c7c8p-29, 0x0.953caa881fa3a0p-32, -0x0.b5ff420cc14b10p-36, 0x0.e138197f93d220p-40, -0x0.89a9b70c1f56a0p-43, // subrange 27:2 (786432..917504)
+ 0x0.f722388c442130p-18, -0x0.fd8d58f0f4a2e0p-22, 0x0.84719377853648p-25, -0x0.8b40bd66244ac8p-29, 0x0.92e481d8d8e488p-33, -0x0.9b457c1730ccc8p-37, 0x0.a5fe70dac4acb8p-41, -0x0.afe1f8fd300160p-45, // subrange 27:3 (917504..1.04858e+06)
+};
+alignas(64) static const double ErfcInvCoeffs[12 * 8] = {
+ 0x0.96fdffb2e85718p-1, 0x0.d152f6ccaed9e8p-3, 0x0.ae370691326270p-7, -0x0.94889d40d2db10p-10, 0x0.8ccf4d67bb5038p-14, 0x0.b53fc415c43bb8p-21, -0x0.b176789af2bdf8p-21, 0x0.9a99af304ccd70p-24, // subrange 0:0 (0.5..0.75)
+ 0x0.843f34ab9ae2d8p0, 0x0.f11bffaa1c8e80p-3, 0x0.b07680d783fba8p-8, -0x0.a77e732bbf0288p-11, 0x0.d72d72756987c0p-15, -0x0.ac2664f688c458p-19, -0x0.ab0e5832bbcbc0p-26, 0x0.ae317ec175f880p-26, // subrange 0:1 (0.75..1)
+ 0x0.e31cf735876288p0, 0x0.82980d5a610e50p-1, 0x0.e66d51dcd710e0p-8, -0x0.f1366958c2fb48p-10, 0x0.a8ad0047fa1cf0p-12, -0x0.ba500e9b52de50p-15, 0x0.9c54cf5645a7e8p-18, -0x0.8c1489d7f77230p-22, // subrange 1:0 (1..1.5)
+ 0x0.b3f782e4debc00p1, 0x0.86108786192520p-1, 0x0.8ec76ca2dab618p-10, -0x0.ee0f43596dbc18p-12, 0x0.a6d6996a2a45f8p-14, -0x0.b8484e38d31f70p-17, 0x0.b32bd1d1d10d18p-20, -0x0.93d73903c80700p-23, // subrange 1:1 (1.5..2)
+ 0x0.8c52ac1e38a430p2, 0x0.86038f3d6c96b0p0, -0x0.9853bd68fcf1e0p-9, -0x0.bed9367f915328p-12, 0x0.b38aa8b6fc5b40p-13, -0x0.bc44f67ce127a8p-15, 0x0.b17cbdd2b74970p-17, -0x0.893a7a8ff2c850p-19, // subrange 2:0 (2..3)
+ 0x0.cefed0e4dfabe0p2, 0x0.84abc668c44be0p0, -0x0.a37b5ff52df1a8p-9, 0x0.e6b08249991cb0p-14, 0x0.9041fa06a50028p-17, -0x0.f6aa80792ee0d0p-19, 0x0.d9fcc8f9dbda00p-21, -0x0.93d882665e06b8p-23, // subrange 2:1 (3..4)
+ 0x0.98f0b883275e20p3, 0x0.8326c54aa63fe8p1, -0x0.c5a5686c52c3f0p-8, 0x0.b9a89c40494a90p-11, -0x0.913654bb7c4800p-14, 0x0.b4cef7b7a8a758p-19, 0x0.d52469884b15f0p-20, -0x0.a3649f252fc790p-21, // subrange 3:0 (4..6)
+ 0x0.da3477165dff68p3, 0x0.82079c9318cd50p1, -0x0.ccbd42c9821908p-9, 0x0.a4b86539456670p-12, -0x0.81a8001f32a430p-15, 0x0.bed1109264cc48p-19, -0x0.eb722429093e90p-23, 0x0.957514a4f53cb8p-27, // subrange 3:1 (6..8)
+ 0x0.9db0e18876c4e8p4, 0x0.813740f8227ba8p2, -0x0.b93585e9ece820p-8, 0x0.e50ca0acf3da50p-11, -0x0.8f2008090cb940p-13, 0x0.b24a72875de780p-16, -0x0.e47b18ae5a23c8p-19, 0x0.85da0af76b09e8p-21, // subrange 4:0 (8..12)
+ 0x0.de291c54500150p4, 0x0.80ba47bf882740p2, -0x0.a611b9912a15c8p-9, 0x0.9a74f1debbf4a0p-12, -0x0.926e1c67e97178p-15, 0x0.8c14894f94eae0p-18, -0x0.8aae64409b9ab8p-21, 0x0.846941c1849c28p-24, // subrange 4:1 (12..16)
+ 0x0.9f4911da414fc0p5, 0x0.8069a4a1a816e0p3, -0x0.88b722b2475970p-8, 0x0.b888318ffa7888p-11, -0x0.fe0dd900c61aa0p-14, 0x0.b159838c83d5d8p-16, -0x0.86218b0ae38988p-18, 0x0.bd6c9f6ab2d780p-21, // subrange 5:0 (16..24)
+ 0x0.df711816f9d1d0p5, 0x0.803cd9934ae068p3, -0x0.e6db9290717cb0p-10, 0x0.e3fd98fd9937c0p-13, -0x0.e5e54d6443a780p-16, 0x0.eaf4b05d9b9a38p-19, -0x0.fbbf289e435f70p-22, 0x0.828af21d22c430p-24, // subrange 5:1 (24..32)
+};
+alignas(64) static const double ErfInvCoeffs[1 * 8] = {
+ 0x0.eadb46552fbc60p0, 0x0.897e00749e5d60p-4, 0x0.ab5023728ff900p-8, 0x0.8443c829bf6e40p-11, 0x0.e238fee4753708p-15, 0x0.cd86db7f0af080p-18, 0x0.c918d51151c3f8p-21, 0x0.c3b944f64df960p-24, // subrange 0:0 (0..0.25)
+};
+// clang-format on
+//--- End of autogenerated code
+
+static const double spi = 1.7724538509055160273;   // sqrt(pi)
+static const double spi2 = 0.88622692545275801365; // sqrt(pi)/2
+static const double ispi2 = 1.1283791670955125739; // 2/sqrt(pi)
+
+//! Evaluates one of the above Chebyshev interpolants, tabulated in 2^M subranges per octave,
+//! with the first octave running from 2^(j0-1) to 2^j0. Same index arithmetics as in erfcx.c.
+static double octavicInterpolant(const double* coeffs, int M, int j0, double x) {
+    int je;
+    const double xm = cerf_inline_frexp2(x, &je);
+    const int ip = (int)((1 << (M + 1)) * xm);     // index in octave + 2^M
+    const int lij = (je - j0 - 1) * (1 << M) + ip; // index in lookup table
+    const double t = (1 << (M + 2)) * xm - (1 + 2 * ip);
+    SET_NTER(lij);
+    return cerf_inline_poly7(coeffs + lij * 8, t);
+}
+
+/******************************************************************************/
+/*  Kernels                                                                   */
+/******************************************************************************/
+
+//! Computes x such that erfcx(x) = y.
+static double erfcx_inv_kernel(double y) {
+    if (!(y > 0))
+        return y == 0 ? HUGE_VAL : NaN;
+
+    double x;
+    if (y < 0x1p-8) {
+        // Inversion of the asymptotic expansion erfcx(x) = 1/(x sqrt(pi)) (1 - 1/(2x^2) + ...),
+        // accurate to machine precision without further refinement.
+        SET_INFO(1300, 4);
+        const double v = 1 / (y * spi);
+        const double e = 1 / (v * v);
+        return v + ((-.5 * e + .25) * e - .5) / v;
+    } else if (y < 0x1p20) {
+        SET_ALGO(1301);
+        x = (1 - y) * octavicInterpolant(ErfcxInvCoeffs, 2, -7, y);
+    } else {
+        // For x -> -inf, erfcx(x) = 2 exp(x^2) - erfcx(-x), where the second term is negligible
+        // beyond 2^60, and is otherwise approximated by its leading asymptote 1/(|x| sqrt(pi)).
+        const double x1 = -sqrt(log(.5 * y));
+        if (y > 0x1p60) {
+            SET_ALGO(1302);
+            return x1;
+        }
+        SET_ALGO(1303);
+        x = -sqrt(log(.5 * (y - 1 / (x1 * spi))));
+    }
+
+    // Halley step for f(x) = erfcx(x) - y, with f' = 2x erfcx - 2/sqrt(pi), f'' = 2 erfcx + 2x f'.
+    const double E = cerf_inline_erfcx(x);
+    const double f = E - y;
+    const double f1 = 2 * x * E - ispi2;
+    const double f2 = 2 * E + 2 * x * f1;
+    return x - 2 * f * f1 / (2 * f1 * f1 - f * f2);
+}
+
+//! Computes x such that erf(x) = z, for |z| <= 1/2.
+static double erf_inv_center(double z) {
+    SET_ALGO(1310);
+    const double w = z * z;
+    const double x = z * cerf_inline_poly7(ErfInvCoeffs, 8 * w - 1);
+
+    // Halley step for f(x) = erf(x) - z, with f' = 2/sqrt(pi) exp(-x^2), f'' = -2x f'.
+    const double u = spi2 * (erf_real(x) - z) * exp(x * x);
+    return x - u / (1 + x * u);
+}
+
+//! Computes x such that erfc(x) = y, for 0 <= y < 1/2.
+static double erfc_inv_tail(double y) {
+    if (y == 0)
+        return HUGE_VAL;
+    SET_ALGO(1320);
+    const double x = octavicInterpolant(ErfcInvCoeffs, 1, 0, sqrt(-log(y)));
+
+    // Halley step for f(x) = erfc(x) - y, with f' = -2/sqrt(pi) exp(-x^2), f'' = -2x f'.
+    // To prevent underflow, f/f' is computed with erfc(x) = erfcx(x) exp(-x^2),
+    // where exp(x^2) = h^2 is split into two factors to prevent overflow.
+    const double xx = x * x;
+    const double xxlo = fma(x, x, -xx);
+    const double h = exp(.5 * xx) * (1 + .5 * xxlo);
+    const double u = spi2 * ((y * h) * h - cerf_inline_erfcx(x));
+    return x - u / (1 + x * u);
+}
+
+//! Computes x such that erfc(x) = y.
+static double erfc_inv_kernel(double y) {
+    if (y >= .5 && y <= 1.5)
+        return erf_inv_center(1 - y); // 1 - y is exact
+    if (y >= 0 && y < .5)
+        return erfc_inv_tail(y);
+    if (y > 1.5 && y <= 2)
+        return -erfc_inv_tail(2 - y); // 2 - y is exact
+    return NaN;
+}
+
+//! Computes x such that erf(x) = z.
+static double erf_inv_kernel(double z) {
+    const double az = fabs(z);
+    if (az <= .5)
+        return erf_inv_center(z);
+    if (az <= 1)
+        return copysign(erfc_inv_tail(1 - az), z); // 1 - |z| is exact
+    return NaN;
+}
+
+/******************************************************************************/
+/*  Library functions erfcx_inv, erfc_inv, erf_inv, and their array versions  */
+/******************************************************************************/
+
+double erfcx_inv(double y) {
+    return erfcx_inv_kernel(y);
+}
+
+double erfc_inv(double y) {
+    return erfc_inv_kernel(y);
+}
+
+double erf_inv(double z) {
+    return erf_inv_kernel(z);
+}
+
+void erfcx_inv_array(size_t n, const double* y, double* result) {
+    for (size_t i = 0; i < n; ++i)
+        result[i] = erfcx_inv_kernel(y[i]);
+}
+
+void erfc_inv_array(size_t n, const double* y, double* result) {
+    for (size_t i = 0; i < n; ++i)
+        result[i] = erfc_inv_kernel(y[i]);
+}
+
+void erf_inv_array(size_t n, const double* z, double* result) {
+    for (size_t i = 0; i < n; ++i)
+        result[i] = erf_inv_kernel(z[i]);
+}
@@ -0,0 +1,195 @@
+/* Library libcerf:
+ *   Compute complex error functions, based on a new implementation of
+ *   Faddeeva's w_of_z. Also provide Dawson and Voigt functions.
+ *
+ * File plasma.c:
+ *   Compute the plasma dispersion function of Fried and Conte,
+ *      Z(zeta) = i*sqrt(pi)*w(zeta),
+ *   and its derivative
+ *      Z'(zeta) = -2*(1 + zeta*Z(zeta)),
+ *   based on w_of_z as implemented in w_of_z.c.
+ *
+ * Copyright:
+ *   (C) 2026 Forschungszentrum Jülich GmbH
+ *
+ * Licence:
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *   LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *   OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *   WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * Website:
+ *   http://apps.jcns.fz-juelich.de/libcerf
+ *
+ * Revision history:
+ *   ../CHANGELOG
+ *
+ * Man page:
+ *   plasma_z(3)
+ */
+
+#include "cerf.h"
+#include "defs.h" // defines _cerf_cmplx, NaN, C, cexp, ...
+#include <math.h>
+
+#ifdef CERF_INTROSPECT
+IMPORT extern int cerf_algorithm;
+IMPORT extern int cerf_nofterms;
+#endif
+
+static const double spi = 1.7724538509055160272981674833411451828; // sqrt(pi)
+
+/******************************************************************************/
+/*  Auxiliary function: Z'(zeta) for large |zeta|                             */
+/******************************************************************************/
+
+//! Compute Z'(x+iy) for |x+iy|^2 >= 64.
+//!
+//! For large |zeta|, Z(zeta) ~ -1/zeta, so that the direct formula -2*(1 + zeta*Z)
+//! suffers from cancellation, with a relative error of order epsilon*|zeta|^2.
+//! Instead, we use the asymptotic expansion
+//!    Z'(zeta) = sum_{n>=1} (2n-1)!!/2^(n-1) / zeta^(2n) - 2*i*sigma*sqrt(pi)*zeta*exp(-zeta^2),
+//! where the exponential term is negligible in the upper half plane, except very close to
+//! the real axis. Consistent with w_of_z, we use sigma=1 if |y| << |x|, else sigma=2 for y<0,
+//! and sigma=0 for y>0.
+
+static _cerf_cmplx zprime_asymptotic(double x, double y)
+{
+    const double xa = fabs(x);
+    const double ya = fabs(y);
+    if (isinf(ya)) {
+        SET_INFO(1100, 1);
+        return (isnan(xa) || y < 0) ? C(NaN, NaN) : C(0, 0);
+    }
+
+    // Compute 1/zeta without overflow of |zeta|^2.
+    _cerf_cmplx r;
+    if (xa >= ya) {
+        const double t = y / x;
+        const double d = x + y * t;
+        r = C(1 / d, -t / d);
+    } else {
+        const double t = x / y;
+        const double d = x * t + y;
+        r = C(t / d, -1 / d);
+    }
+    const _cerf_cmplx r2 = r * r; // 1/zeta^2
+    const double z2 = xa * xa + ya * ya; // may be Inf, which is harmless here
+
+    _cerf_cmplx ret;
+    if (z2 > 22500) {
+        SET_INFO(1120, 4);
+        ret = ((((
+                     + 1.3125000000000000e+01) * r2 // n=4
+                 + 3.7500000000000000e+00) * r2 // n=3
+                + 1.5000000000000000e+00) * r2 // n=2
+               + 1.0000000000000000e+00) * r2; // n=1
+    } else if (z2 > 540) {
+        SET_INFO(1120, 8);
+        ret = ((((((((
+                         + 1.5836132812500000e+04) * r2 // n=8
+                     + 2.1114843750000000e+03) * r2 // n=7
+                    + 3.2484375000000000e+02) * r2 // n=6
+                   + 5.9062500000000000e+01) * r2 // n=5
+                  + 1.3125000000000000e+01) * r2 // n=4
+                 + 3.7500000000000000e+00) * r2 // n=3
+                + 1.5000000000000000e+00) * r2 // n=2
+               + 1.0000000000000000e+00) * r2; // n=1
+    } else {
+        SET_INFO(1120, 20);
+        ret = ((((((((((((((((((((
+                                     + 6.1002919535232115e+17) * r2 // n=20
+                                 + 3.1283548479606216e+16) * r2 // n=19
+                                + 1.6910026205192548e+15) * r2 // n=18
+                               + 9.6628721172528844e+13) * r2 // n=17
+                              + 5.8562861316684150e+12) * r2 // n=16
+                             + 3.7782491172054291e+11) * r2 // n=15
+                            + 2.6056890463485718e+10) * r2 // n=14
+                           + 1.9301400343322754e+09) * r2 // n=13
+                          + 1.5441120274658203e+08) * r2 // n=12
+                         + 1.3427061108398438e+07) * r2 // n=11
+                        + 1.2787677246093750e+06) * r2 // n=10
+                       + 1.3460712890625000e+05) * r2 // n=9
+                      + 1.5836132812500000e+04) * r2 // n=8
+                     + 2.1114843750000000e+03) * r2 // n=7
+                    + 3.2484375000000000e+02) * r2 // n=6
+                   + 5.9062500000000000e+01) * r2 // n=5
+                  + 1.3125000000000000e+01) * r2 // n=4
+                 + 3.7500000000000000e+00) * r2 // n=3
+                + 1.5000000000000000e+00) * r2 // n=2
+               + 1.0000000000000000e+00) * r2; // n=1
+    }
+
+    // Exponential term, computed only where it is not negligible.
+    const double sigma = ya < 1e-8 * xa ? 1. : y < 0 ? 2. : 0.;
+    const double mRe_z2 = (ya - xa) * (xa + ya); // Re(-zeta^2), being careful of overflow
+    if (sigma > 0 && mRe_z2 > -750) {
+        SET_ALGO(cerf_algorithm + 1);
+        // -2*i*sigma*sqrt(pi)*zeta*exp(-zeta^2)
+        const _cerf_cmplx e = cexp(C(mRe_z2, -2 * x * y)) * (2 * sigma * spi);
+        ret += C(creal(e) * y + cimag(e) * x, cimag(e) * y - creal(e) * x);
+    }
+    return ret;
+}
+
+/******************************************************************************/
+/*  Library functions plasma_z, plasma_zprime, plasma_z_zprime_array         */
+/******************************************************************************/
+
+_cerf_cmplx plasma_z(_cerf_cmplx zeta)
+{
+    // Z(zeta) = i*sqrt(pi)*w(zeta); the lower half plane is handled within w_of_z.
+    const _cerf_cmplx w = w_of_z(zeta);
+    return C(-spi * cimag(w), spi * creal(w));
+}
+
+_cerf_cmplx plasma_zprime(_cerf_cmplx zeta)
+{
+    const double x = creal(zeta);
+    const double y = cimag(zeta);
+    if (x * x + y * y >= 64)
+        return zprime_asymptotic(x, y);
+
+    const _cerf_cmplx Z = plasma_z(zeta);
+    return -2. * (1. + zeta * Z);
+}
+
+void plasma_z_zprime_array(
+    size_t n, const double* zeta_re, const double* zeta_im,
+    double* z_re, double* z_im, double* zp_re, double* zp_im)
+{
+    // Structure-of-arrays layout: each component in its own contiguous array.
+    // One call of w_of_z per point yields both Z and, for |zeta|^2 < 64, Z'.
+    for (size_t i = 0; i < n; ++i) {
+        const double x = zeta_re[i];
+        const double y = zeta_im[i];
+        const _cerf_cmplx w = w_of_z(C(x, y));
+        const double Zr = -spi * cimag(w);
+        const double Zi = spi * creal(w);
+        z_re[i] = Zr;
+        z_im[i] = Zi;
+        if (x * x + y * y >= 64) {
+            const _cerf_cmplx zp = zprime_asymptotic(x, y);
+            zp_re[i] = creal(zp);
+            zp_im[i] = cimag(zp);
+        } else {
+            // -2*(1 + zeta*Z), written out in real arithmetic
+            zp_re[i] = -2 * (1 + (x * Zr - y * Zi));
+            zp_im[i] = -2 * (x * Zi + y * Zr);
+        }
+    }
+}
@@ -0,0 +1,306 @@
+/* Library libcerf:
+ *   Compute complex error functions, based on a new implementation of
+ *   Faddeeva's w_of_z. Also provide Dawson and Voigt functions.
+ *
+ * File roots.c:
+ *   Find complex roots of equations that involve w(z), like the kinetic
+ *   dispersion relation 1 + k^2 + zeta*Z(zeta) = 0. Provides Halley's method
+ *   for many independent starting values, and a scan based on the argument
+ *   principle that provides starting values within a rectangle.
+ *
+ * Copyright:
+ *   (C) 2026 Forschungszentrum Jülich GmbH
+ *
+ * Licence:
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *   LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *   OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *   WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * Website:
+ *   http://apps.jcns.fz-juelich.de/libcerf
+ *
+ * Revision history:
+ *   ../CHANGELOG
+ *
+ * Man page:
+ *   cerf_roots(3)
+ */
+
+#include "cerf.h"
+#include "defs.h" // defines _cerf_cmplx, NaN, C, cexp, ...
+#include <math.h>
+#include <stdlib.h>
+
+static const double ispi = 0.5641895835477562869; // 1 / sqrt(pi)
+static const double twopi = 6.283185307179586476925286766559;
+
+/******************************************************************************/
+/*  Predefined functions f(z)                                                 */
+/******************************************************************************/
+
+_cerf_cmplx cerf_rootfct_w(_cerf_cmplx z, const void* param, _cerf_cmplx* df, _cerf_cmplx* d2f)
+{
+    // f(z) = a + b*w(z), with w' = -2*z*w + 2*i/sqrt(pi) and w'' = -2*w - 2*z*w'.
+    const double* p = (const double*)param;
+    const _cerf_cmplx a = C(p[0], p[1]);
+    const _cerf_cmplx b = C(p[2], p[3]);
+    const _cerf_cmplx w = w_of_z(z);
+    const _cerf_cmplx w1 = -2. * z * w + C(0, 2 * ispi);
+    const _cerf_cmplx w2 = -2. * (w + z * w1);
+    *df = b * w1;
+    *d2f = b * w2;
+    return a + b * w;
+}
+
+_cerf_cmplx cerf_rootfct_zZ(_cerf_cmplx z, const void* param, _cerf_cmplx* df, _cerf_cmplx* d2f)
+{
+    // f(z) = a + b*z*Z(z), with Z' = -2*(1 + z*Z) and Z'' = -2*(Z + z*Z').
+    const double* p = (const double*)param;
+    const _cerf_cmplx a = C(p[0], p[1]);
+    const _cerf_cmplx b = C(p[2], p[3]);
+    const double x = creal(z);
+    const double y = cimag(z);
+    const _cerf_cmplx Z = plasma_z(z);
+    // For large |z|, plasma_zprime avoids cancellation without calling w_of_z again.
+    const _cerf_cmplx Z1 = x * x + y * y >= 64 ? plasma_zprime(z) : -2. * (1. + z * Z);
+    const _cerf_cmplx Z2 = -2. * (Z + z * Z1);
+    *df = b * (Z + z * Z1);
+    *d2f = b * (2. * Z1 + z * Z2);
+    return a + b * z * Z;
+}
+
+/******************************************************************************/
+/*  Halley's method for many independent starting values                      */
+/******************************************************************************/
+
+size_t cerf_roots_halley(
+    size_t n, cerf_rootfct f, const void* param, size_t param_stride,
+    double* z_re, double* z_im, int* status, double tol, int maxiter)
+{
+    // Lanes are processed in blocks. Within a block, all unconverged lanes advance by one
+    // iteration before the next iteration starts, and converged lanes are dropped from the
+    // index list, so that the inner loop always runs over active lanes only.
+    enum { NLANES = 64 };
+    size_t nconverged = 0;
+
+    for (size_t i0 = 0; i0 < n; i0 += NLANES) {
+        const size_t m = n - i0 < NLANES ? n - i0 : NLANES;
+        size_t active[NLANES];
+        size_t na = 0;
+        for (size_t j = 0; j < m; ++j) {
+            active[na++] = i0 + j;
+            if (status)
+                status[i0 + j] = -1; // not converged within maxiter
+        }
+
+        for (int it = 1; it <= maxiter && na > 0; ++it) {
+            size_t nb = 0;
+            for (size_t k = 0; k < na; ++k) {
+                const size_t i = active[k];
+                const _cerf_cmplx z = C(z_re[i], z_im[i]);
+                _cerf_cmplx df, d2f;
+                const _cerf_cmplx fz = f(z, (const char*)param + i * param_stride, &df, &d2f);
+
+                if (creal(fz) == 0 && cimag(fz) == 0) {
+                    if (status)
+                        status[i] = it;
+                    ++nconverged;
+                    continue;
+                }
+
+                // Halley step dz = 2 f f' / (2 f'^2 - f f''); fall back to Newton if the
+                // denominator vanishes.
+                const _cerf_cmplx den = 2. * df * df - fz * d2f;
+                const _cerf_cmplx dz = creal(den) == 0 && cimag(den) == 0
+                    ? fz / df : 2. * fz * df / den;
+                if (!isfinite(creal(dz)) || !isfinite(cimag(dz))) {
+                    if (status)
+                        status[i] = -2; // breakdown, e.g. f' = 0
+                    continue;
+                }
+
+                const double xn = creal(z) - creal(dz);
+                const double yn = cimag(z) - cimag(dz);
+                z_re[i] = xn;
+                z_im[i] = yn;
+                if (hypot(creal(dz), cimag(dz)) <= tol * hypot(xn, yn)) {
+                    if (status)
+                        status[i] = it;
+                    ++nconverged;
+                } else {
+                    active[nb++] = i;
+                }
+            }
+            na = nb;
+        }
+    }
+    return nconverged;
+}
+
+/******************************************************************************/
+/*  Argument principle scan                                                   */
+/******************************************************************************/
+
+typedef struct {
+    cerf_rootfct f;
+    const void* param;
+    double min_size;   // boxes containing one root are subdivided down to this size
+    double* guess_re;  // starting values collected so far
+    double* guess_im;
+    size_t nguess;
+    size_t capacity;
+} scan_t;
+
+static double arg_of(scan_t* s, _cerf_cmplx z)
+{
+    _cerf_cmplx df, d2f;
+    const _cerf_cmplx fz = s->f(z, s->param, &df, &d2f);
+    return atan2(cimag(fz), creal(fz));
+}
+
+//! Returns the change of arg f along the straight segment from za to zb,
+//! bisecting the segment until each increment is safely below pi.
+static double arg_increment(
+    scan_t* s, _cerf_cmplx za, double phia, _cerf_cmplx zb, double phib, int depth)
+{
+    double d = phib - phia;
+    if (d > twopi / 2)
+        d -= twopi;
+    else if (d <= -twopi / 2)
+        d += twopi;
+    if (fabs(d) < 0.75 || depth == 0)
+        return d;
+    const _cerf_cmplx zm = 0.5 * (za + zb);
+    const double phim = arg_of(s, zm);
+    return arg_increment(s, za, phia, zm, phim, depth - 1)
+        + arg_increment(s, zm, phim, zb, phib, depth - 1);
+}
+
+//! Returns the number of zeros of f inside the rectangle, according to the argument principle.
+static int winding_number(scan_t* s, double x0, double x1, double y0, double y1)
+{
+    const int ns = 8; // initial number of segments per side
+    const _cerf_cmplx corner[5] = { C(x0, y0), C(x1, y0), C(x1, y1), C(x0, y1), C(x0, y0) };
+    double sum = 0;
+    for (int side = 0; side < 4; ++side) {
+        const _cerf_cmplx za = corner[side];
+        const _cerf_cmplx dz = (corner[side + 1] - za) * (1. / ns);
+        _cerf_cmplx zp = za;
+        double phip = arg_of(s, zp);
+        for (int k = 1; k <= ns; ++k) {
+            const _cerf_cmplx zk = za + (double)k * dz;
+            const double phik = arg_of(s, zk);
+            sum += arg_increment(s, zp, phip, zk, phik, 12);
+            zp = zk;
+            phip = phik;
+        }
+    }
+    return (int)floor(sum / twopi + 0.5);
+}
+
+static void add_guess(scan_t* s, double x, double y)
+{
+    if (s->nguess == s->capacity) {
+        const size_t cap = s->capacity ? 2 * s->capacity : 16;
+        double* re = (double*)realloc(s->guess_re, cap * sizeof(double));
+        double* im = (double*)realloc(s->guess_im, cap * sizeof(double));
+        if (re)
+            s->guess_re = re;
+        if (im)
+            s->guess_im = im;
+        if (!re || !im)
+            return; // out of memory: drop this starting value
+        s->capacity = cap;
+    }
+    s->guess_re[s->nguess] = x;
+    s->guess_im[s->nguess] = y;
+    ++s->nguess;
+}
+
+static void scan_box(scan_t* s, double x0, double x1, double y0, double y1, int count, int depth)
+{
+    if (count <= 0)
+        return;
+    const double wx = x1 - x0;
+    const double wy = y1 - y0;
+    if (depth == 0 || (count == 1 && wx <= s->min_size && wy <= s->min_size)) {
+        add_guess(s, 0.5 * (x0 + x1), 0.5 * (y0 + y1));
+        return;
+    }
+    // Split along the longer side.
+    if (wx >= wy) {
+        const double xm = 0.5 * (x0 + x1);
+        const int n0 = winding_number(s, x0, xm, y0, y1);
+        scan_box(s, x0, xm, y0, y1, n0, depth - 1);
+        scan_box(s, xm, x1, y0, y1, winding_number(s, xm, x1, y0, y1), depth - 1);
+    } else {
+        const double ym = 0.5 * (y0 + y1);
+        const int n0 = winding_number(s, x0, x1, y0, ym);
+        scan_box(s, x0, x1, y0, ym, n0, depth - 1);
+        scan_box(s, x0, x1, ym, y1, winding_number(s, x0, x1, ym, y1), depth - 1);
+    }
+}
+
+size_t cerf_roots_scan(
+    cerf_rootfct f, const void* param, double xmin, double xmax, double ymin, double ymax,
+    size_t max_roots, double* z_re, double* z_im)
+{
+    scan_t s;
+    s.f = f;
+    s.param = param;
+    s.min_size = (xmax - xmin > ymax - ymin ? xmax - xmin : ymax - ymin) / 16;
+    s.guess_re = NULL;
+    s.guess_im = NULL;
+    s.nguess = 0;
+    s.capacity = 0;
+
+    scan_box(&s, xmin, xmax, ymin, ymax, winding_number(&s, xmin, xmax, ymin, ymax), 24);
+
+    // Refine all starting values at once, then keep distinct roots inside the rectangle.
+    int* status = s.nguess ? (int*)malloc(s.nguess * sizeof(int)) : NULL;
+    size_t nroots = 0;
+    if (status) {
+        cerf_roots_halley(s.nguess, f, param, 0, s.guess_re, s.guess_im, status, 1e-14, 50);
+        const double mx = 1e-9 * (xmax - xmin);
+        const double my = 1e-9 * (ymax - ymin);
+        for (size_t i = 0; i < s.nguess; ++i) {
+            const double x = s.guess_re[i];
+            const double y = s.guess_im[i];
+            if (status[i] < 0 || x < xmin - mx || x > xmax + mx || y < ymin - my || y > ymax + my)
+                continue;
+            int duplicate = 0;
+            for (size_t j = 0; j < nroots; ++j)
+                if (hypot(x - s.guess_re[j], y - s.guess_im[j]) <= 1e-10 * (hypot(x, y) + 1))
+                    duplicate = 1;
+            if (duplicate)
+                continue;
+            // Compact accepted roots at the beginning of the guess arrays.
+            s.guess_re[nroots] = x;
+            s.guess_im[nroots] = y;
+            ++nroots;
+        }
+        for (size_t j = 0; j < nroots && j < max_roots; ++j) {
+            z_re[j] = s.guess_re[j];
+            z_im[j] = s.guess_im[j];
+        }
+    }
+    free(status);
+    free(s.guess_re);
+    free(s.guess_im);
+    return nroots;
+}
@@ -0,0 +1,675 @@
+// Created by pro_wofz_cheb.py 4 on 16:18:45.752580
+static const int NChebDiv = 4; // tiles per unit length
+static const int NChebAx = 28; // tiles per axis
+alignas(64) static const short ChebTiles[2*784] = { // offset, number of terms
+   0,18,  18,17,  35,17,  52,17,  69,16,  85,16, 101,16, 117,15, 132,15, 147,15, 162,15, 177,14, 191,14, 205,14, 219,14, 233,14, 247,13, 260,13, 273,13, 286,13, 299,13, 312,13, 325,13, 338,13, 351,12, 363,12, 375,12, 387,12,
+ 399,15, 414,15, 429,15, 444,14, 458,14, 472,14, 486,14, 500,13, 513,13, 526,13, 539,13, 552,13, 565,12, 577,12, 589,12, 601,12, 613,12, 625,12, 637,12, 649,11, 660,11, 671,11, 682,11, 693,11, 704,11, 715,11, 726,11, 737,11,
+ 748,15, 763,15, 778,14, 792,14, 806,14, 820,14, 834,13, 847,13, 860,13, 873,13, 886,13, 899,12, 911,12, 923,12, 935,12, 947,12, 959,12, 971,12, 983,11, 994,11,1005,11,1016,11,1027,11,1038,11,1049,11,1060,11,1071,11,1082,11,
+1093,15,1108,15,1123,14,1137,14,1151,14,1165,13,1178,13,1191,13,1204,13,1217,13,1230,12,1242,12,1254,12,1266,12,1278,12,1290,12,1302,12,1314,11,1325,11,1336,11,1347,11,1358,11,1369,11,1380,11,1391,11,1402,11,1413,11,1424,10,
+1434,15,1449,15,1464,14,1478,14,1492,14,1506,13,1519,13,1532,13,1545,13,1558,12,1570,12,1582,12,1594,12,1606,12,1618,12,1630,12,1642,11,1653,11,1664,11,1675,11,1686,11,1697,11,1708,11,1719,11,1730,11,1741,11,1752,10,1762,10,
+1772,15,1787,15,1802,14,1816,14,1830,14,1844,13,1857,13,1870,13,1883,13,1896,12,1908,12,1920,12,1932,12,1944,12,1956,12,1968,11,1979,11,1990,11,2001,11,2012,11,2023,11,2034,11,2045,11,2056,11,2067,11,2078,10,2088,10,2098,10,
+2108,15,2123,15,2138,14,2152,14,2166,13,2179,13,2192,13,2205,13,2218,12,2230,12,2242,12,2254,12,2266,12,2278,12,2290,12,2302,11,2313,11,2324,11,2335,11,2346,11,2357,11,2368,11,2379,11,2390,11,2401,11,2412,10,2422,10,2432,10,
+2442,15,2457,15,2472,14,2486,14,2500,13,2513,13,2526,13,2539,13,2552,12,2564,12,2576,12,2588,12,2600,12,2612,12,2624,11,2635,11,2646,11,2657,11,2668,11,2679,11,2690,11,2701,11,2712,11,2723,11,2734,10,2744,10,2754,10,2764,10,
+2774,15,2789,15,2804,14,2818,14,2832,13,2845,13,2858,13,2871,13,2884,12,2896,12,2908,12,2920,12,2932,12,2944,12,2956,11,2967,11,2978,11,2989,11,3000,11,3011,11,3022,11,3033,11,3044,11,3055,11,3066,10,3076,10,3086,10,   0, 0,
+3096,15,3111,15,3126,14,3140,14,3154,13,3167,13,3180,13,3193,12,3205,12,3217,12,3229,12,3241,12,3253,12,3265,11,3276,11,3287,11,3298,11,3309,11,3320,11,3331,11,3342,11,3353,11,3364,10,3374,10,3384,10,3394,10,3404,10,   0, 0,
+3414,16,3430,14,3444,14,3458,14,3472,13,3485,13,3498,13,3511,12,3523,12,3535,12,3547,12,3559,12,3571,12,3583,11,3594,11,3605,11,3616,11,3627,11,3638,11,3649,11,3660,11,3671,10,3681,10,3691,10,3701,10,3711,10,3721,10,   0, 0,
+3731,16,3747,14,3761,14,3775,13,3788,13,3801,13,3814,13,3827,12,3839,12,3851,12,3863,12,3875,12,3887,11,3898,11,3909,11,3920,11,3931,11,3942,11,3953,11,3964,11,3975,11,3986,10,3996,10,4006,10,4016,10,4026,10,   0, 0,   0, 0,
+4036,16,4052,14,4066,14,4080,13,4093,13,4106,13,4119,12,4131,12,4143,12,4155,12,4167,12,4179,11,4190,11,4201,11,4212,11,4223,11,4234,11,4245,11,4256,11,4267,11,4278,10,4288,10,4298,10,4308,10,4318,10,4328,10,   0, 0,   0, 0,
+4338,16,4354,14,4368,14,4382,13,4395,13,4408,13,4421,12,4433,12,4445,12,4457,12,4469,12,4481,11,4492,11,4503,11,4514,11,4525,11,4536,11,4547,11,4558,11,4569,11,4580,10,4590,10,4600,10,4610,10,4620,10,   0, 0,   0, 0,   0, 0,
+4630,16,4646,14,4660,13,4673,13,4686,13,4699,12,4711,12,4723,12,4735,12,4747,12,4759,11,4770,11,4781,11,4792,11,4803,11,4814,11,4825,11,4836,11,4847,11,4858,11,4869,10,4879,10,4889,10,4899,10,4909,10,   0, 0,   0, 0,   0, 0,
+4919,17,4936,14,4950,13,4963,13,4976,13,4989,12,5001,12,5013,12,5025,12,5037,12,5049,11,5060,11,5071,11,5082,11,5093,11,5104,11,5115,11,5126,11,5137,11,5148,10,5158,10,5168,10,5178,10,5188,10,   0, 0,   0, 0,   0, 0,   0, 0,
+5198,17,5215,13,5228,13,5241,13,5254,12,5266,12,5278,12,5290,12,5302,12,5314,11,5325,11,5336,11,5347,11,5358,11,5369,11,5380,11,5391,11,5402,11,5413,10,5423,10,5433,10,5443,10,5453,10,   0, 0,   0, 0,   0, 0,   0, 0,   0, 0,
+5463,17,5480,13,5493,13,5506,12,5518,12,5530,12,5542,12,5554,12,5566,11,5577,11,5588,11,5599,11,5610,11,5621,11,5632,11,5643,11,5654,11,5665,11,5676,10,5686,10,5696,10,5706,10,5716,10,   0, 0,   0, 0,   0, 0,   0, 0,   0, 0,
+5726,18,5744,13,5757,12,5769,12,5781,12,5793,12,5805,12,5817,11,5828,11,5839,11,5850,11,5861,11,5872,11,5883,11,5894,11,5905,11,5916,10,5926,10,5936,10,5946,10,5956,10,5966,10,   0, 0,   0, 0,   0, 0,   0, 0,   0, 0,   0, 0,
+5976,18,5994,13,6007,12,6019,12,6031,12,6043,12,6055,12,6067,11,6078,11,6089,11,6100,11,6111,11,6122,11,6133,11,6144,11,6155,11,6166,10,6176,10,6186,10,6196,10,6206,10,   0, 0,   0, 0,   0, 0,   0, 0,   0, 0,   0, 0,   0, 0,
+6216,18,6234,12,6246,12,6258,12,6270,12,6282,12,6294,11,6305,11,6316,11,6327,11,6338,11,6349,11,6360,11,6371,11,6382,11,6393,10,6403,10,6413,10,6423,10,6433,10,   0, 0,   0, 0,   0, 0,   0, 0,   0, 0,   0, 0,   0, 0,   0, 0,
+6443,19,6462,12,6474,12,6486,12,6498,12,6510,11,6521,11,6532,11,6543,11,6554,11,6565,11,6576,11,6587,11,6598,11,6609,10,6619,10,6629,10,6639,10,6649,10,   0, 0,   0, 0,   0, 0,   0, 0,   0, 0,   0, 0,   0, 0,   0, 0,   0, 0,
+6659,19,6678,12,6690,12,6702,12,6714,11,6725,11,6736,11,6747,11,6758,11,6769,11,6780,11,6791,11,6802,11,6813,10,6823,10,6833,10,6843,10,6853,10,   0, 0,   0, 0,   0, 0,   0, 0,   0, 0,   0, 0,   0, 0,   0, 0,   0, 0,   0, 0,
+6863,20,6883,12,6895,12,6907,11,6918,11,6929,11,6940,11,6951,11,6962,11,6973,11,6984,11,6995,11,7006,11,7017,10,7027,10,7037,10,   0, 0,   0, 0,   0, 0,   0, 0,   0, 0,   0, 0,   0, 0,   0, 0,   0, 0,   0, 0,   0, 0,   0, 0,
+7047,21,7068,12,7080,11,7091,11,7102,11,7113,11,7124,11,7135,11,7146,11,7157,11,7168,11,7179,10,7189,10,7199,10,7209,10,   0, 0,   0, 0,   0, 0,   0, 0,   0, 0,   0, 0,   0, 0,   0, 0,   0, 0,   0, 0,   0, 0,   0, 0,   0, 0,
+7219,21,7240,11,7251,11,7262,11,7273,11,7284,11,7295,11,7306,11,7317,11,7328,10,7338,10,7348,10,7358,10,   0, 0,   0, 0,   0, 0,   0, 0,   0, 0,   0, 0,   0, 0,   0, 0,   0, 0,   0, 0,   0, 0,   0, 0,   0, 0,   0, 0,   0, 0,
+7368,22,7390,11,7401,11,7412,11,7423,11,7434,11,7445,11,7456,11,7467,11,7478,10,7488,10,   0, 0,   0, 0,   0, 0,   0, 0,   0, 0,   0, 0,   0, 0,   0, 0,   0, 0,   0, 0,   0, 0,   0, 0,   0, 0,   0, 0,   0, 0,   0, 0,   0, 0,
+7498,23,7521,11,7532,11,7543,11,7554,11,7565,11,7576,11,7587,11,   0, 0,   0, 0,   0, 0,   0, 0,   0, 0,   0, 0,   0, 0,   0, 0,   0, 0,   0, 0,   0, 0,   0, 0,   0, 0,   0, 0,   0, 0,   0, 0,   0, 0,   0, 0,   0, 0,   0, 0,
+};
+alignas(64) static const double ChebCoeffs[2*7598] = {
+ 0x0.80000000000000p1, 0x0, 0x0, 0x0.906eba8214db68p1, -0x0.ffffffffffffd8p0, 0x0, 0x0, -0x0.c093a3581bcb88p0, 0x0.ffffffffff8910p-1, 0x0, 0x0, 0x0.9a0fb5e010b748p-1, -0x0.aaaaaaaa438288p-2, 0x0, 0x0, -0x0.b011f467b64930p-3, 0x0.aaaaaa5df52740p-4, 0x0, 0x0, 0x0.9c81b9a7e2b020p-5, -0x0.88886c1ef21960p-6, 0x0, 0x0, -0x0.e3a3bf93261c60p-8, 0x0.b60086420169e8p-9, 0x0, 0x0, 0x0.8bdc9e5a422098p-10, -0x0.ce076e88197ca0p-12, 0x0, 0x0, -0x0.8e4295c9bba2e8p-13, 0x0.a9179546884740p-15, 0x0, 0x0, 0x0.8242f6441c98f0p-17, // x=       0 y=       0
+ 0x0.af9456f1e52560p0, 0x0, 0x0, 0x0.9d2e33cebddac8p0, -0x0.e9460708bbe6a8p-1, 0x0, 0x0, -0x0.97416dfc237f80p-1, 0x0.b08d7dca2e9750p-2, 0x0, 0x0, 0x0.bd0b0a3d2ae618p-3, -0x0.bc248fd39e1f90p-4, 0x0, 0x0, -0x0.afbba3bd1649c0p-5, 0x0.9b31611fdd3850p-6, 0x0, 0x0, 0x0.8257730f047098p-7, -0x0.d134c5345b9650p-9, 0x0, 0x0, -0x0.a10f32155cafd0p-10, 0x0.eeacdfc39d9ae8p-12, 0x0, 0x0, 0x0.aaa49f0acda2d8p-13, -0x0.ec0fc5549531b0p-15, 0x0, 0x0, -0x0.9b0009c5de8720p-16, 0x0.c6b76272b6e7e0p-18, 0x0, // x=       0 y=    0.25
+ 0x0.8e8b5ac04f57b0p0, 0x0, 0x0, 0x0.dd5e87278d1268p-1, -0x0.92bba107e683e8p-1, 0x0, 0x0, -0x0.ace1ae037c0000p-2, 0x0.b96a354d9f8800p-3, 0x0, 0x0, 0x0.b7e72ef85d1340p-4, -0x0.aa97f380034c78p-5, 0x0, 0x0, -0x0.953fa7dbd14f18p-6, 0x0.f7e81e165b0250p-8, 0x0, 0x0, 0x0.c477cca553c578p-9, -0x0.953557e02d97f0p-10, 0x0, 0x0, -0x0.d9f303f2f40678p-12, 0x0.9989a785cecde0p-13, 0x0, 0x0, 0x0.d125917861e330p-15, -0x0.8a0d48f7157070p-16, 0x0, 0x0, -0x0.ad90ab8a98e2c8p-18, 0x0.d56bff0eb00200p-20, 0x0, // x=       0 y=     0.5
+ 0x0.edba3f7204d628p-1, 0x0, 0x0, 0x0.a1b4fb00caf6e0p-1, -0x0.c077c7a2a67c40p-2, 0x0, 0x0, -0x0.ceac346f05ac10p-3, 0x0.cc18e164280210p-4, 0x0, 0x0, 0x0.bbcee951ed1790p-5, -0x0.a293246b15bb48p-6, 0x0, 0x0, -0x0.8559c195ca4050p-7, 0x0.d077bf72f5b3b8p-9, 0x0, 0x0, 0x0.9bff3852b829b8p-10, -0x0.e059bdd9b2eff8p-12, 0x0, 0x0, -0x0.9b852d09c70668p-13, 0x0.d069c90549b350p-15, 0x0, 0x0, 0x0.87460798512068p-16, -0x0.aa7909a79de470p-18, 0x0, 0x0, -0x0.cd38d132656fd0p-20, 0x0.f205df80505638p-22, 0x0, // x=       0 y=    0.75
+ 0x0.ca98f04d8a4da8p-1, 0x0, 0x0, 0x0.f3c59ab3b87dd8p-2, -0x0.82f39290e50dc0p-2, 0x0, 0x0, -0x0.809a1d16491328p-3, 0x0.ea7388d16fcfc0p-5, 0x0, 0x0, 0x0.c8852ebe053e60p-6, -0x0.a23628b36658b0p-7, 0x0, 0x0, -0x0.f9c636827cc640p-9, 0x0.b7ecd2b8043608p-10, 0x0, 0x0, 0x0.820f1c5d6eeaa0p-11, -0x0.b13a16b1f2c790p-13, 0x0, 0x0, -0x0.e95967d7fa33c0p-15, 0x0.94c71732e0c338p-16, 0x0, 0x0, 0x0.b8244b903c08a8p-18, -0x0.da59247f0d83b0p-20, 0x0, 0x0, -0x0.fdcbb78e7b7c18p-22, // x=       0 y=       1
+ 0x0.afc47a979e3b58p-1, 0x0, 0x0, 0x0.bcbd31cec094e8p-2, -0x0.b809a165e753d8p-3, 0x0, 0x0, -0x0.a5e6dcec841e10p-4, 0x0.8bf5d30698ff88p-5, 0x0, 0x0, 0x0.def925e65633e8p-7, -0x0.a8d5cffe7391b8p-8, 0x0, 0x0, -0x0.f457345a08c7a0p-10, 0x0.a9afabfba8b238p-11, 0x0, 0x0, 0x0.e2fd3575915c00p-13, -0x0.92a76467573fb0p-14, 0x0, 0x0, -0x0.b78305638e1ee8p-16, 0x0.ded592111538a0p-18, 0x0, 0x0, 0x0.838c759bef3118p-19, -0x0.953806506d2570p-21, 0x0, 0x0, -0x0.a61d49c7216210p-23, // x=       0 y=    1.25
+ 0x0.9ac1fb322193d8p-1, 0x0, 0x0, 0x0.9588f34acc9a60p-2, -0x0.850ad6156d59a8p-3, 0x0, 0x0, -0x0.dd00c732140818p-5, 0x0.ad0a14a454da40p-6, 0x0, 0x0, 0x0.80a75714182668p-7, -0x0.b6b04fb55892b0p-9, 0x0, 0x0, -0x0.f8da1e9d582de0p-11, 0x0.a32f6688aaa9c8p-12, 0x0, 0x0, 0x0.ceb1140cf60630p-14, -0x0.fd7e41ab158f78p-16, 0x0, 0x0, -0x0.96d9d2fffd8bc0p-17, 0x0.ae8dbde8fe0b48p-19, 0x0, 0x0, 0x0.c4b9574b791610p-21, -0x0.d590d87b041f18p-23, 0x0, 0x0, -0x0.e3c8e2559e36f8p-25, // x=       0 y=     1.5
+ 0x0.89f2ba1db02400p-1, 0x0, 0x0, 0x0.f1b2c063fb9a50p-3, -0x0.c5377f76919d68p-4, 0x0, 0x0, -0x0.977c97b7883d20p-5, 0x0.dccac4ea079388p-7, 0x0, 0x0, 0x0.9991be1f759e80p-8, -0x0.ccdb07216d50f0p-10, 0x0, 0x0, -0x0.83870659f5f0a0p-11, 0x0.a318e2534848a8p-13, 0x0, 0x0, 0x0.c3d30bee1ce6e0p-15, -0x0.e42c9992c95c00p-17, 0x0, 0x0, -0x0.8140c602cb62b8p-18, 0x0.8ea2704fc916c8p-20, 0x0, 0x0, 0x0.97e47a30953f10p-22, -0x0.9e9d7ff7cc5808p-24, 0x0, // x=       0 y=    1.75
+ 0x0.f87e947ee10558p-2, 0x0, 0x0, 0x0.c6b7b9ead50908p-3, -0x0.956d7bd57aaf10p-4, 0x0, 0x0, -0x0.d51221d563a5d8p-6, 0x0.90ef677076fcf8p-7, 0x0, 0x0, 0x0.bd0c0c92ddad98p-9, -0x0.ed5aaeb7b0b198p-11, 0x0, 0x0, -0x0.8fe448947a1f58p-12, 0x0.a8f0432ece4e28p-14, 0x0, 0x0, 0x0.c08247dfb39a18p-16, -0x0.d55684b6deced0p-18, 0x0, 0x0, -0x0.e64ee443753670p-20, 0x0.f2957a4763c980p-22, 0x0, 0x0, 0x0.f72a7067b70bd0p-24, -0x0.f742d771624558p-26, 0x0, // x=       0 y=       2
+ 0x0.e1cc3e82685cc0p-2, 0x0, 0x0, 0x0.a5d7564a6e4590p-3, -0x0.e6e440502b5120p-5, 0x0, 0x0, -0x0.995455e46d9cd8p-6, 0x0.c3406943a49c60p-8, 0x0, 0x0, 0x0.ef5a2f4e7f5400p-10, -0x0.8db24dcd6d3820p-11, 0x0, 0x0, -0x0.a27c7460b1f190p-13, 0x0.b4e1a2cc2aff70p-15, 0x0, 0x0, 0x0.c3de27ccf253c0p-17, -0x0.ceabe7c10efeb8p-19, 0x0, 0x0, -0x0.d4cf0083700440p-21, 0x0.d623c73bad8008p-23, 0x0, 0x0, 0x0.d0e804fc366828p-25, -0x0.c854e3806dc108p-27, 0x0, // x=       0 y=    2.25
+ 0x0.cebb9c70fa6db8p-2, 0x0, 0x0, 0x0.8c39bd7f083670p-3, -0x0.b57e9dd1fd3210p-5, 0x0, 0x0, -0x0.e146e9e26b3bb8p-7, 0x0.86a051559b4bd8p-8, 0x0, 0x0, 0x0.9b74ca0697c108p-10, -0x0.ade8eeb17e5d60p-12, 0x0, 0x0, -0x0.bced61c00e8da0p-14, 0x0.c7b49a2ab565f0p-16, 0x0, 0x0, 0x0.cdc30ec8481378p-18, -0x0.cef513f97bfa90p-20, 0x0, 0x0, -0x0.cb78a8bc67ced8p-22, 0x0.c3c7e6778b35b8p-24, 0x0, 0x0, 0x0.b703bfee33acc8p-26, -0x0.a85950b97e1438p-28, 0x0, // x=       0 y=     2.5
+ 0x0.be852f4eeab880p-2, 0x0, 0x0, 0x0.efe0102b84d960p-4, -0x0.90e11d7d19e238p-5, 0x0, 0x0, -0x0.a897c97e536bd8p-7, 0x0.bda025526f7d48p-9, 0x0, 0x0, 0x0.ceb79113af10e0p-11, -0x0.daebc5969ea330p-13, 0x0, 0x0, -0x0.e1ae328d8b5ea8p-15, 0x0.e2da43c6d17cb0p-17, 0x0, 0x0, 0x0.deaf55482d7f20p-19, -0x0.d5beba2e5e5888p-21, 0x0, 0x0, -0x0.c8db817b2ce6f0p-23, 0x0.b77210a51d6020p-25, 0x0, 0x0, 0x0.a4de8c94351f00p-27, // x=       0 y=    2.75
+ 0x0.b0954092a28de8p-2, 0x0, 0x0, 0x0.cf4401f0bb9120p-4, -0x0.ea81f0e9004878p-6, 0x0, 0x0, -0x0.804d493911d840p-7, 0x0.8824b9ff51a4e0p-9, 0x0, 0x0, 0x0.8c6a32a3da3120p-11, -0x0.8d09625189cb18p-13, 0x0, 0x0, -0x0.8a31aced741b18p-15, 0x0.844a4c51ed2638p-17, 0x0, 0x0, 0x0.f7c4750c5d6bf0p-20, -0x0.e33b520186bf20p-22, 0x0, 0x0, -0x0.cc502701fdf100p-24, 0x0.b2e4c6eced1910p-26, 0x0, 0x0, 0x0.9a4c9d7a32dfe8p-28, // x=       0 y=       3
+ 0x0.a47c78814cdb88p-2, 0x0, 0x0, 0x0.b4b69a9f8045a8p-4, -0x0.c02660ab8a0c40p-6, 0x0, 0x0, -0x0.c642609d7dce28p-8, 0x0.c6f2f9353f3c20p-10, 0x0, 0x0, 0x0.c288c236cfe430p-12, -0x0.b9a871cfe4b260p-14, 0x0, 0x0, -0x0.ad309c458775a8p-16, 0x0.9e1db751432110p-18, 0x0, 0x0, 0x0.8d701f4ec7f928p-20, -0x0.f82bd0671f6048p-23, 0x0, 0x0, -0x0.d5bca85b2a2fd8p-25, 0x0.b394723ebdc950p-27, 0x0, 0x0, 0x0.94c61894ea25c0p-29, // x=       0 y=    3.25
+ 0x0.99e58c8bcebfb0p-2, 0x0, 0x0, 0x0.9ed6646c2fb620p-4, -0x0.9f34189c382a08p-6, 0x0, 0x0, -0x0.9b4c969bde0090p-8, 0x0.93b580f7b7d0d0p-10, 0x0, 0x0, 0x0.8933d7e262c9b8p-12, -0x0.f9458e1b29f4c8p-15, 0x0, 0x0, -0x0.ddb9d6c9018ed8p-17, 0x0.c1548d56864fe0p-19, 0x0, 0x0, 0x0.a567dc317c4050p-21, -0x0.8afa286d907a70p-23, 0x0, 0x0, -0x0.e58b773420ee68p-26, 0x0.b93cb849d1f840p-28, 0x0, 0x0, 0x0.93868e16ef62a0p-30, // x=       0 y=     3.5
+ 0x0.908e312c9271a0p-2, 0x0, 0x0, 0x0.8c9f5bdcdfab20p-4, -0x0.853d02e99c3d40p-6, 0x0, 0x0, -0x0.f65ac0e15bfbf0p-9, 0x0.de90d7c73af7a8p-11, 0x0, 0x0, 0x0.c4c2cbcf126928p-13, -0x0.aa6b61cdf9bc80p-15, 0x0, 0x0, -0x0.90c384d8e0d928p-17, 0x0.f16fc864135f70p-20, 0x0, 0x0, 0x0.c5d0df48ce2078p-22, -0x0.9f5d67308f82d8p-24, 0x0, 0x0, -0x0.fca9e2b78a2910p-27, 0x0.c403ed4fb110c0p-29, 0x0, 0x0, 0x0.963386c7d86060p-31, // x=       0 y=    3.75
+ 0x0.88422f0ee58cd0p-2, 0x0, 0x0, 0x0.fa9e7eae088c30p-5, -0x0.e10eb7a52490d0p-7, 0x0, 0x0, -0x0.c5a36327c8f5f8p-9, 0x0.a9f1cb20eaad80p-11, 0x0, 0x0, 0x0.8f403df22b7970p-13, -0x0.ecfb22a1c598e8p-16, 0x0, 0x0, -0x0.c086dc11e7bd60p-18, 0x0.99c03da159e740p-20, 0x0, 0x0, 0x0.f191ccf450d0e8p-23, -0x0.bacfed470ca018p-25, 0x0, 0x0, -0x0.8d9a2988403880p-27, 0x0.d4025f555fe7e8p-30, 0x0, // x=       0 y=       4
+ 0x0.80d7e611738dc0p-2, 0x0, 0x0, 0x0.e0a5b7bf9e1780p-5, -0x0.bfa8b295231cc8p-7, 0x0, 0x0, -0x0.a0378485520158p-9, 0x0.835fcd1a8b65c8p-11, 0x0, 0x0, 0x0.d38968d07908b8p-14, -0x0.a75c5305a4d5b8p-16, 0x0, 0x0, -0x0.8238d23c3d1d28p-18, 0x0.c771676808a048p-21, 0x0, 0x0, 0x0.9668dbb686e468p-23, -0x0.df8d57e0060990p-26, 0x0, 0x0, -0x0.a30d0b41fbfff0p-28, 0x0.eb14cc2a2d13b8p-31, 0x0, // x=       0 y=    4.25
+ 0x0.f45b92f487dc68p-3, 0x0, 0x0, 0x0.ca72632d93feb0p-5, -0x0.a475047d4bdec8p-7, 0x0, 0x0, -0x0.8320ea8782e1f8p-9, 0x0.cd6f5509c8a4f0p-12, 0x0, 0x0, 0x0.9e3a44b1578c80p-14, -0x0.efd4e687bad9c8p-17, 0x0, 0x0, -0x0.b2f88cdc224f30p-19, 0x0.83960df79c0e40p-21, 0x0, 0x0, 0x0.bebfe78f312d18p-24, -0x0.885e6fc7ff5b00p-26, 0x0, 0x0, -0x0.bf99285e243af0p-29, 0x0.85204ef8076198p-31, 0x0, // x=       0 y=     4.5
+ 0x0.e85111b6a49f50p-3, 0x0, 0x0, 0x0.b754edb2229530p-5, -0x0.8e190058a79780p-7, 0x0, 0x0, -0x0.d889c5d731b760p-10, 0x0.a250bc9854c3a0p-12, 0x0, 0x0, 0x0.ef91997a1e3320p-15, -0x0.ae2acb69b8a2e8p-17, 0x0, 0x0, -0x0.f99f7bef1e25f8p-20, 0x0.b06cde5a671e30p-22, 0x0, 0x0, 0x0.f6136a38d37b00p-25, -0x0.a96a711d65c238p-27, 0x0, 0x0, -0x0.e57ad49fbbfa20p-30, 0x0.99d203609240a0p-32, 0x0, // x=       0 y=    4.75
+ 0x0.dd63652170dfd8p-3, 0x0, 0x0, 0x0.a6c36e2a230058p-5, -0x0.f71fff6e80ed10p-8, 0x0, 0x0, -0x0.b43e8b475e0a90p-10, 0x0.817ee7d88380a0p-12, 0x0, 0x0, 0x0.b765b619138530p-15, -0x0.8012a204c44a28p-17, 0x0, 0x0, -0x0.b07e849d3b18d0p-20, 0x0.f019501a7c5ac8p-23, 0x0, 0x0, 0x0.a148f95356a968p-25, -0x0.d6156076cc6e58p-28, 0x0, 0x0, -0x0.8be9ebc3e84558p-30, 0x0.b51bc1b1e8b410p-33, 0x0, // x=       0 y=       5
+ 0x0.d36d5a4abadb68p-3, 0x0, 0x0, 0x0.985075f7d3ffa0p-5, -0x0.d82778b6bf7cd8p-8, 0x0, 0x0, -0x0.972967c0f1fad0p-10, 0x0.d07d54b7a542b8p-13, 0x0, 0x0, 0x0.8ddc2447257c78p-15, -0x0.be902a55c22500p-18, 0x0, 0x0, -0x0.fcce46092b44b0p-21, 0x0.a5ac99b43c7ca0p-23, 0x0, 0x0, 0x0.d69e8ba3e6a698p-26, -0x0.8971e2f01bf418p-28, 0x0, 0x0, -0x0.ad84839ef98020p-31, 0x0.d90e7888fab6f0p-34, 0x0, // x=       0 y=    5.25
+ 0x0.ca4fdf5b1ebb08p-3, 0x0, 0x0, 0x0.8ba45d80cff968p-5, -0x0.be177bbf488a68p-8, 0x0, 0x0, -0x0.ff4f150d7eae30p-11, 0x0.a93e0f1cb78220p-13, 0x0, 0x0, 0x0.dd9730a7d482a0p-16, -0x0.8f52b44791f1e0p-18, 0x0, 0x0, -0x0.b73ef8120eb9f8p-21, 0x0.e7a6dd09118c88p-24, 0x0, 0x0, 0x0.90d29a0d90a180p-26, -0x0.b328b7150ddca0p-29, 0x0, 0x0, -0x0.daa55ec9973388p-32, 0x0.844488d7681b30p-34, 0x0, // x=       0 y=     5.5
+ 0x0.c1f0d0aa2c9eb0p-3, 0x0, 0x0, 0x0.8078514705b868p-5, -0x0.a803293b86fa98p-8, 0x0, 0x0, -0x0.d8ffd537c41008p-11, 0x0.8a748a692fef28p-13, 0x0, 0x0, 0x0.aea218a9e1e378p-16, -0x0.d9cab109268048p-19, 0x0, 0x0, -0x0.865485f1b71058p-21, 0x0.a3f4620bcd2800p-24, 0x0, 0x0, 0x0.c60ec391703590p-27, -0x0.ecddd1240f9688p-30, 0x0, 0x0, -0x0.8bd717969b95f0p-32, 0x0.a3c598477a4dd0p-35, 0x0, // x=       0 y=    5.75
+ 0x0.ba3a0a77fed700p-3, 0x0, 0x0, 0x0.ed253f1adf66e8p-6, -0x0.9530c4ed7986f8p-8, 0x0, 0x0, -0x0.b98c21451c0648p-11, 0x0.e42f6e920265e0p-14, 0x0, 0x0, 0x0.8aca6e441ca280p-16, -0x0.a70f9263b082a8p-19, 0x0, 0x0, -0x0.c7094c46e3ee38p-22, 0x0.eac710eebfbd70p-25, 0x0, 0x0, 0x0.89218ef22da5c8p-27, -0x0.9e51edcf0fae30p-30, 0x0, 0x0, -0x0.b53c9305eafda0p-33, // x=       0 y=       6
+ 0x0.b318ae2b837858p-3, 0x0, 0x0, 0x0.db87dbb40bc070p-6, -0x0.850d6301435fc0p-8, 0x0, 0x0, -0x0.9f8b28d607fe80p-11, 0x0.bd4fced6a032d8p-14, 0x0, 0x0, 0x0.de5b3380097980p-17, -0x0.814c132e881280p-19, 0x0, 0x0, -0x0.94ed5174da29b0p-22, 0x0.a9ef4672c41148p-25, 0x0, 0x0, 0x0.c0240e8aa5f070p-28, -0x0.d6da60107c13f8p-31, 0x0, 0x0, -0x0.ee544b4ac0b078p-34, // x=       0 y=    6.25
+ 0x0.ac7c8ea62be650p-3, 0x0, 0x0, 0x0.cbca303c405828p-6, -0x0.ee47ad11a75338p-9, 0x0, 0x0, -0x0.89e7137825f0d8p-11, 0x0.9e0f4d2a87d258p-14, 0x0, 0x0, 0x0.b370c1b15948e8p-17, -0x0.c9d3baf599c0c8p-20, 0x0, 0x0, -0x0.e0f558c1b99590p-23, 0x0.f888b0b6a86148p-26, 0x0, 0x0, 0x0.881c77fb18cea8p-28, -0x0.938841f97c70b8p-31, 0x0, 0x0, -0x0.9eb3cd52e977f8p-34, // x=       0 y=     6.5
+ 0x0.a657ba87d19188p-3, 0x0, 0x0, 0x0.bdab1aae612bf8p-6, -0x0.d62be67d83ef18p-9, 0x0, 0x0, -0x0.ef9019c0a1c1e0p-12, 0x0.84c105bf8ed038p-14, 0x0, 0x0, 0x0.91d13191d10ac0p-17, -0x0.9ec5432dd29b38p-20, 0x0, 0x0, -0x0.ab67b3ba40d920p-23, 0x0.b782325a8f5360p-26, 0x0, 0x0, 0x0.c2df8364b592a8p-29, -0x0.cce7b4bb771a00p-32, 0x0, 0x0, -0x0.d5e921b03ac8f0p-35, // x=       0 y=    6.75
+ 0x0.de6aa9dcebdb10p0, 0x0.c56f9ab1a616c0p-1, -0x0.a6cfff65b0e418p0, 0x0.d6d39b018b6e70p0, -0x0.9fdcaa16c98b30p0, -0x0.b3472779674cc8p0, 0x0.972c7f74278eb0p0, -0x0.c4cbe59ab1f248p-1, 0x0.ce57f496986b20p-2, 0x0.d82d62864ddd78p-1, -0x0.886a31e6c7df30p-1, 0x0.b92b0110fc0270p-3, -0x0.8ab5bf3060f930p-4, -0x0.9bb0f1a06e8308p-2, 0x0.a35561168a8588p-3, -0x0.9c579377e9cf20p-6, 0x0.81b0127fd7a6a0p-9, 0x0.9f5adf81050410p-4, -0x0.91daeba841b258p-5, -0x0.92f3a4a759a968p-9, 0x0.94d82f7f8da8c8p-9, -0x0.fc1b6debdf7c50p-7, 0x0.ce4ffb48338398p-8, 0x0.bd38ee4e75b3c8p-10, -0x0.c149d8e5a350a0p-11, 0x0.9dfcca2c24d968p-9, -0x0.d29478ac194e10p-11, -0x0.9ba3b9d3c4e9e0p-12, 0x0.96b5c3361c9d88p-14, -0x0.b786f233b280c0p-13, // x=    0.25 y=       0
+ 0x0.a004bb2a26f7e0p0, 0x0.dc7f219f175618p-2, -0x0.9d576c2391b388p-1, 0x0.ff0424ad703980p-1, -0x0.a5672005ed36e0p-1, -0x0.92e056033f1d48p-1, 0x0.db0d4a86195168p-2, -0x0.b7e1cb37ff77f8p-2, 0x0.b3b497e4912278p-3, 0x0.8c482e249a4498p-2, -0x0.a01cde28fbbf10p-3, 0x0.9c21624bdd7a88p-4, -0x0.f1095b12a033e8p-6, -0x0.a687dcf00a0b08p-4, 0x0.a036aa49c69a30p-5, -0x0.a27a6b37a44ae8p-7, 0x0.b4d2ce8389a858p-9, 0x0.901b5a08c200b0p-6, -0x0.f452a05fc622b0p-8, 0x0.85240f78c59128p-11, 0x0.beb92be0e09580p-15, -0x0.c46b3db64eb858p-9, 0x0.967efab47114f8p-10, 0x0.e45f75336ae038p-14, -0x0.981ca9e4fc6978p-14, 0x0.dcb249ce461ff0p-12, -0x0.9b4fe0987f5a10p-13, -0x0.9a9d3965ab16c0p-15, 0x0.8248e959edb2e0p-16, -0x0.d1a9adb6f11c28p-15, // x=    0.25 y=    0.25
+ 0x0.84abcb5b9bc358p0, 0x0.9d3dd7dde52d28p-2, -0x0.c976143d74d188p-2, 0x0.bb163cb0181460p-1, -0x0.dd4719fb452548p-2, -0x0.aba4b8bb8e3978p-2, 0x0.ec37b8b347cf60p-3, -0x0.e4adafd114cfe0p-3, 0x0.d30cc0d0a25af0p-4, 0x0.8cb3dffabbafa8p-3, -0x0.9647c0b15a5c30p-4, 0x0.aff065b62c5358p-5, -0x0.84f3a106f05510p-6, -0x0.92faa7108491a0p-5, 0x0.85804d3c327548p-6, -0x0.b532e644619c48p-8, 0x0.da4e4057f75290p-10, 0x0.e381e371ad4840p-8, -0x0.b73c2936ce8bf8p-9, 0x0.dba36dff3e1380p-12, -0x0.94fed7972a5db8p-14, -0x0.8c50bb873be700p-10, 0x0.cd47dfbcc86d18p-12, 0x0.a4313fe5bf4810p-18, -0x0.cb569e0cdbf0b0p-17, 0x0.8fff6206290668p-13, -0x0.c24293050b33f8p-15, -0x0.fc0e6530eb2fd8p-18, 0x0.dedebd65676c48p-19, -0x0.fbd210cbef9970p-17, // x=    0.25 y=     0.5
+ 0x0.e0af71b88c4038p-1, 0x0.e8005858f27790p-3, -0x0.8606dd46fe37b8p-2, 0x0.8d07d274b086d8p-1, -0x0.984ea02a443f98p-2, -0x0.d10010cbbe6040p-3, 0x0.84f06d52460740p-3, -0x0.9223c77d978550p-3, 0x0.fdc7918f9351c8p-5, 0x0.937b1bf2d9ec78p-4, -0x0.9388712f2d71c0p-5, 0x0.c983548215e2a8p-6, -0x0.930e98315acc20p-7, -0x0.87c4f8786aa8a0p-6, 0x0.e8f606470a82e8p-8, -0x0.c52b9d23fc7298p-9, 0x0.f0fbb2a09fa658p-11, 0x0.bc1a64ef2cc530p-9, -0x0.8ff75aa9542bc0p-10, 0x0.83684e5a40e958p-12, -0x0.f1a91b457f9d30p-15, -0x0.d20aaf86f60a28p-12, 0x0.92b0fb74206620p-13, -0x0.98841ed1bc96d0p-17, -0x0.f880de85650a70p-22, 0x0.c4e07f67fcc770p-15, -0x0.fdb4ee68ecc320p-17, -0x0.8de42f82a0ca90p-20, // x=    0.25 y=    0.75
+ 0x0.c1ac39aef9e500p-1, 0x0.b03aa32d73bd08p-3, -0x0.b880bde6a945b0p-3, 0x0.d9d8d34c36edd8p-2, -0x0.d758c419ec82c8p-3, -0x0.840c6c031e8100p-3, 0x0.9b9abd3bd4dcc0p-4, -0x0.bfe181f8207590p-4, 0x0.9c79cf0644af28p-5, 0x0.a0ff53dff9b630p-5, -0x0.97032164d51ec8p-6, 0x0.ebc39288573b58p-7, -0x0.a4f09422bb31e8p-8, -0x0.82dfde6ff88b68p-7, 0x0.d43f72a7019b40p-9, -0x0.d6a53f8710ef68p-10, 0x0.818c6990188798p-11, 0x0.a27b8a58046528p-10, -0x0.ec7035eb3c7dc0p-12, 0x0.8fb8cbf818c150p-13, -0x0.8f57d75c560b80p-15, -0x0.a45a39dfae16b8p-13, 0x0.db35ff78330320p-15, -0x0.f310900542ed60p-18, 0x0.8ff0ea9b273cf0p-20, 0x0.8cbc555e2f34f0p-16, -0x0.adb308d8efecc8p-18, 0x0.c2edefaf93c128p-26, // x=    0.25 y=       1
+ 0x0.a977807d4ac378p-1, 0x0.8948037b1f86d8p-3, -0x0.82e077e5499790p-3, 0x0.abe990115fd5b0p-2, -0x0.9c0788cf67e958p-3, -0x0.ac851559c46d70p-4, 0x0.bcbf76b8eeb4c8p-5, -0x0.813fc0064ff2b0p-4, 0x0.c5e706a6ea46a8p-6, 0x0.b672b779fc9890p-6, -0x0.a0aca953c7da50p-7, 0x0.8d2b74eb329fc0p-7, -0x0.bc9766b95b5848p-9, -0x0.83458bfb42ccd8p-8, 0x0.c96261a57137d8p-10, -0x0.ec788f5d8db668p-11, 0x0.8b170648064f70p-12, 0x0.9242c246769c38p-11, -0x0.ca6f5d0bf906b0p-13, 0x0.98e306d4ca8eb8p-14, -0x0.9b738c990ed928p-16, -0x0.8624b76e8e0878p-14, 0x0.aae7939ff6dc68p-16, -0x0.8ef9f682417f20p-18, 0x0.e142d14b3b9978p-21, 0x0.d1ff1028602ef0p-18, -0x0.f84593db17a588p-20, 0x0.9428b50fe90c40p-23, // x=    0.25 y=    1.25
+ 0x0.962f79b85ae198p-1, 0x0.da97ac70e6edd8p-4, -0x0.beafe9e332c490p-4, 0x0.8a44cc8d2cd448p-2, -0x0.e73aa478009f38p-4, -0x0.e8420666ef59b0p-5, 0x0.ec80b0f6d6be60p-6, -0x0.b25f5cfddc9220p-5, 0x0.804230a5328d60p-6, 0x0.d5fa72fb272bc8p-7, -0x0.b1300941294f38p-8, 0x0.ad205566b2d478p-8, -0x0.dc5845c7494778p-10, -0x0.88a1f9f73f7ec8p-9, 0x0.c6787874668a88p-11, -0x0.848df2b5973ad8p-11, 0x0.96dcb3fe90b790p-13, 0x0.88dcaf929a3ea0p-12, -0x0.b44a67d0654168p-14, 0x0.a226cb88f4bc08p-15, -0x0.a3c98582862588p-17, -0x0.e3e6e55c3156d0p-16, 0x0.8abcce16d5c5c8p-17, -0x0.99d6f2804b2e38p-19, 0x0.836a2428348550p-21, 0x0.a330acbb362ea0p-19, -0x0.b8de04d0e4f198p-21, 0x0.d14ca0c8cc3aa8p-24, // x=    0.25 y=     1.5
+ 0x0.868c6f80c9d1f8p-1, 0x0.b1597aa43a4260p-4, -0x0.8e3b111ce07300p-4, 0x0.e22f9197e48fe0p-3, -0x0.aedaf3a1e14938p-4, -0x0.a09ccf8001ad58p-5, 0x0.989b1a84339fd8p-6, -0x0.fbbdde96066590p-6, 0x0.aa2da33ca5e9d0p-7, 0x0.817e00c064e330p-7, -0x0.c9f81af0997ed0p-9, 0x0.d957de1d1710d8p-9, -0x0.83a32c41439e80p-10, -0x0.932fd7db7fa748p-10, 0x0.caa8cb2a5824e8p-12, -0x0.979fd2a2790d78p-12, 0x0.a641bbbf065840p-14, 0x0.84cf685c94c348p-13, -0x0.a6a42f12b201b0p-15, 0x0.ad7938b8f8d808p-16, -0x0.abd38dd9e152d0p-18, -0x0.c90c9477d153c8p-17, 0x0.ea2bebe4dc9c48p-19, -0x0.a0abc22a0b9218p-20, 0x0.950bb529bac748p-22, 0x0.830bde078e6f38p-20, // x=    0.25 y=    1.75
+ 0x0.f3545592f7a4c0p-2, 0x0.9245bf6d433730p-4, -0x0.d8a92651128790p-5, 0x0.bbc4a8f71b8958p-3, -0x0.86add1027611e0p-4, -0x0.e39615c1d0b8b0p-6, 0x0.ca4aca8d4e2c98p-7, -0x0.b55a5f522c4948p-6, 0x0.e6d26701771fe8p-8, 0x0.a1510494fc7a20p-8, -0x0.ed5a1cca760a20p-10, 0x0.8b899a248fd000p-9, -0x0.a0d4ac14663e00p-11, -0x0.a3b285d604f230p-11, 0x0.d5e5468d161608p-13, -0x0.b12409f5937590p-13, 0x0.bab02230105f98p-15, 0x0.85583240cece18p-14, -0x0.9f7fea70622ea8p-16, 0x0.bc4ddf27ccfb80p-17, -0x0.b5958f5ea4a698p-19, -0x0.b7cbe5912a3b28p-18, 0x0.ccd02d7586c4b8p-20, -0x0.a6e4bce1dace08p-21, 0x0.987dd2bb61f9e0p-23, 0x0.dba18e0dddaa18p-22, // x=    0.25 y=       2
+ 0x0.ddcc7b58a88798p-2, 0x0.f4c610692e6a48p-5, -0x0.a81e162056b4c8p-5, 0x0.9deff14353fa78p-3, -0x0.d2f11e7985ed88p-5, -0x0.a4cd0b82bce938p-6, 0x0.8962b50716ed28p-7, -0x0.852638b03de2b8p-6, 0x0.9fc9e8be4932e0p-8, 0x0.ce58a731a384a0p-9, -0x0.8f72f7aa86e7e8p-10, 0x0.b70df76c5d2ab0p-10, -0x0.c8cf234a7687b0p-12, -0x0.bb8753f3d071e0p-12, 0x0.e8d272e449a5f0p-14, -0x0.d365e74f034780p-14, 0x0.d5db9df5b89660p-16, 0x0.8a37da8d4ee008p-15, -0x0.9dc113bf93ff18p-17, 0x0.d00390a08a28a8p-18, -0x0.c277283811f378p-20, -0x0.adc3eab5b0bff0p-19, 0x0.b962b0e585d070p-21, -0x0.ae6e5db56026a0p-22, 0x0.9ba6ed976d2918p-24, 0x0.be9642a7f60aa0p-23, // x=    0.25 y=    2.25
+ 0x0.cb956a34b38410p-2, 0x0.cf676cec3095e8p-5, -0x0.84a18164360550p-5, 0x0.8667688ba7afd8p-3, -0x0.a7b0f765a727f8p-5, -0x0.f36a585a793ee8p-7, 0x0.becb164fc61018p-8, -0x0.c6f30148cc41b8p-7, 0x0.e17fcc111ea9a8p-9, 0x0.8735d71a23be88p-9, -0x0.b1f46d9bbefdf0p-11, 0x0.f50d61471d4ae8p-11, -0x0.80004534f04f38p-12, -0x0.dcce56e31f9128p-13, 0x0.8267039614bff0p-14, -0x0.80ccfc1c12a1b8p-14, 0x0.fa00bc7443e198p-17, 0x0.939b22a2e78af8p-16, -0x0.a0e7ce50975788p-18, 0x0.ea2bf8e5f5e830p-19, -0x0.d3b4487492d480p-21, -0x0.a98fc45d005cb8p-20, 0x0.ad530220cb5c38p-22, -0x0.b88c0fb621d500p-23, 0x0.a01274ef10d550p-25, 0x0.aaf1467e1f3540p-24, // x=    0.25 y=     2.5
+ 0x0.bc00a6f172df70p-2, 0x0.b1b51eabc60440p-5, -0x0.d464f299fd4860p-6, 0x0.e7246510df1858p-4, -0x0.872104edb4b208p-5, -0x0.b6fd36ec44f9d8p-7, 0x0.872f3e41af1208p-8, -0x0.9705a780809918p-7, 0x0.a1f5ecf2207d28p-9, 0x0.b52db0f8261f38p-10, -0x0.e21ce31e3b0350p-12, 0x0.a72b38f89576f0p-11, -0x0.a672b1e0379920p-13, -0x0.8558166d616150p-13, 0x0.96089bf6c759e8p-15, -0x0.a026fb85266ce0p-15, 0x0.95177a5e831420p-17, 0x0.a2163761c9a0a0p-17, -0x0.a8ed846ba3fc28p-19, 0x0.866396331cae00p-19, -0x0.eaa3c1ea07da70p-22, -0x0.aa756dc74c7f58p-21, 0x0.a7139ef6877988p-23, -0x0.c64770379bcb48p-24, 0x0.a6b835939026d8p-26, 0x0.9e31c70f06eda8p-25, // x=    0.25 y=    2.75
+ 0x0.ae8af235bdd210p-2, 0x0.99c61dbd281418p-5, -0x0.ac56e6c870ddb8p-6, 0x0.c89b5ddc22e1b8p-4, -0x0.dc787790fec860p-6, -0x0.8bcb6e24478bc8p-7, 0x0.c3212820adf358p-9, -0x0.e8a7a30c5a75a0p-8, 0x0.ec7f926e7f35c0p-10, 0x0.f7c7aae8814560p-11, -0x0.92dd13658ed9b0p-12, 0x0.e82a50e0d096b0p-12, -0x0.dc89879d0bc210p-14, -0x0.a4e5ca0af69ee8p-14, 0x0.b0f8e57c856598p-16, -0x0.cb0612c5716640p-16, 0x0.b555be6f6e67d0p-18, 0x0.b6af79060d1160p-18, -0x0.b637a89df51c28p-20, 0x0.9d41e6a9213990p-20, -0x0.8478e9a9cd0d18p-22, -0x0.b03c656f57b1c0p-22, 0x0.a447ca59c94ef0p-24, -0x0.dd9ff522d0a4f8p-25, // x=    0.25 y=       3
+ 0x0.a2d00922ce63b8p-2, 0x0.863d40d6d64c50p-5, -0x0.8d85824d5fa668p-6, 0x0.af8f6146468c60p-4, -0x0.b5dee01b29f610p-6, -0x0.d8bbef47ce6620p-8, 0x0.8f3817ba8695b8p-9, -0x0.b59f30d1d89b30p-8, 0x0.af4f6e6ae6e2b8p-10, 0x0.aca3e62ef049b0p-11, -0x0.c2b7a7c61f8bf8p-13, 0x0.a3e9858941cab0p-12, -0x0.94b434b491d6a0p-14, -0x0.d06e88ddbbc4a8p-15, 0x0.d5a56512d556b8p-17, -0x0.83139eaa84fe50p-16, 0x0.e0bf203fbe1a80p-19, 0x0.d2fa7cfc032130p-19, -0x0.c99b99aa195bd8p-21, 0x0.bb8879fecbfea8p-21, -0x0.98605a1297f3c0p-23, -0x0.bb0f00773ca198p-23, 0x0.a779bbc1483e08p-25, -0x0.f5e71e09d160e0p-26, // x=    0.25 y=    3.25
+ 0x0.98823d993be068p-2, 0x0.ec397eadce5d88p-6, -0x0.eaf419856cbd58p-7, 0x0.9acb8e263c4fc0p-4, -0x0.978e87a04f1e98p-6, -0x0.aa4196954ef7e8p-8, 0x0.d580a1a5850d60p-10, -0x0.8f89123a32c368p-8, 0x0.83ca5a8d7fd748p-10, 0x0.f4c35769099e58p-12, -0x0.838b27a46c7828p-13, 0x0.eb0e34acd39920p-13, -0x0.cbe4337abca588p-15, -0x0.866f6e7ea4baa8p-15, 0x0.83c725ef829ba8p-17, -0x0.ac3b359544eac8p-17, 0x0.8dcf7468c260a0p-19, 0x0.f943e05ca12f88p-20, -0x0.e46fe1f0e63a58p-22, 0x0.e3c6d4eaa83d88p-22, -0x0.b2830d215b2ce0p-24, -0x0.cb85cf8b688d48p-24, 0x0.af299754fbb698p-26, -0x0.8af26f40a98e60p-26, // x=    0.25 y=     3.5
+ 0x0.8f6497801172c8p-2, 0x0.d15236ec1d4b88p-6, -0x0.c4f3e0b5dcafc0p-7, 0x0.89698d74390928p-4, -0x0.feef5aab137ad0p-7, -0x0.87601ee85d1300p-8, 0x0.a16779befe2ec0p-10, -0x0.e57266a8c8f068p-9, 0x0.c8bd6c14e717c8p-11, 0x0.b04aa1b7e32890p-12, -0x0.b4de089e80e920p-14, 0x0.aafc28cc418688p-13, -0x0.8df940d358d7e8p-15, -0x0.b0b9b018e66508p-16, 0x0.a5df7782ce9f68p-18, -0x0.e61234c9c49960p-18, 0x0.b60fa324a55b78p-20, 0x0.966b8ffba1a270p-20, -0x0.8457852389a190p-22, 0x0.8cca539302c998p-22, -0x0.d4e520b9a6ebc8p-25, -0x0.e2a706b7da04c8p-25, 0x0.bbae28e5e263f8p-27, -0x0.9fe36c4b9f72e8p-27, // x=    0.25 y=    3.75
+ 0x0.8746aa0d52ab80p-2, 0x0.baab7801414c20p-6, -0x0.a692b52b0aac30p-7, 0x0.f5767c156e2618p-5, -0x0.d83b3e5897fae0p-7, -0x0.d9adfb446f2cb0p-9, 0x0.f73ab9e7602b38p-11, -0x0.b94dfeef9e0450p-9, 0x0.9abb78b0861578p-11, 0x0.80daac9ebc88c8p-12, -0x0.fcc0140de73518p-15, 0x0.fc1eeb4e8a2e18p-14, -0x0.c8a0497cf77198p-16, -0x0.ec7058f4c79fb0p-17, 0x0.d4c14042bd6ae8p-19, -0x0.9c13eae6456e68p-18, 0x0.ed95766ea30160p-21, 0x0.b933148e327540p-21, -0x0.9c96f506533b38p-23, 0x0.b102f616e5f038p-23, -0x0.81287b1ce1ee10p-25, -0x0.810027750abbc8p-25, 0x0.cdb97cae243958p-28, -0x0.bb41c12e0e1f58p-28, // x=    0.25 y=       4
+ 0x0.800192f8f0d738p-2, 0x0.a76f7b8d843510p-6, -0x0.8e06d52a0a8ce8p-7, 0x0.dc76a21e4a6c70p-5, -0x0.b8d3ba1c408890p-7, -0x0.b0cc16c2279150p-9, 0x0.bfa01602fa6108p-11, -0x0.97184048f467b0p-9, 0x0.f13734863574a0p-12, 0x0.bef0b6520a6798p-13, -0x0.b34769429abfc8p-15, 0x0.bc38907b57cf50p-14, -0x0.8fb548566192d8p-16, -0x0.a0c676d7215cb8p-17, 0x0.8adcf1759988b0p-19, -0x0.d6e46bf8bfabe8p-19, 0x0.9d700929ee1c10p-21, 0x0.e851aead4faf10p-22, -0x0.bcf6c68257f230p-24, 0x0.e22ab6816248a0p-24, -0x0.9f5543e3c14ec8p-26, -0x0.95e6e950a3b050p-26, 0x0.e6665583dd7dc8p-29, -0x0.df15094d95f138p-29, // x=    0.25 y=    4.25
+ 0x0.f2eb91048f3570p-3, 0x0.96f9adbc94afd0p-6, -0x0.f3ff7c2bef9910p-8, 0x0.c70509b5cc5f00p-5, -0x0.9f1bf55d718cc0p-7, -0x0.90f06b910770e8p-9, 0x0.962d3d0e12f228p-11, -0x0.f896f507934dc0p-10, 0x0.bdfa046bbf12f8p-12, 0x0.8f43575168f020p-13, -0x0.80f4d2b41fa930p-15, 0x0.8e2afee12260c0p-14, -0x0.d088d3a001a128p-17, -0x0.de037a7937dfa8p-18, 0x0.b845d8eb549c50p-20, -0x0.95fe4626be19d8p-19, 0x0.d3bc5afe95ec88p-22, 0x0.944985d2cf8380p-22, -0x0.e84a063c27d258p-25, 0x0.92b83903564200p-24, -0x0.c7b3ee336faf00p-27, -0x0.b19ae686ab30f0p-27, 0x0.83a8afebade690p-29, -0x0.8714bbe33bc4e0p-29, // x=    0.25 y=     4.5
+ 0x0.e712f264757d30p-3, 0x0.88c9e06476c810p-6, -0x0.d3058a1ceb41d0p-8, 0x0.b47fff11a43ce8p-5, -0x0.89de2e89e91330p-7, -0x0.efb1f5e733d830p-10, 0x0.edcdb8c61e7020p-12, -0x0.ce2d5f5236c738p-10, 0x0.9711f497d51de0p-12, 0x0.d98203a4971890p-14, -0x0.bbf3338f6874c0p-16, 0x0.d91f41c4451388p-15, -0x0.992238aa0c2040p-17, -0x0.9b7d3093a99678p-18, 0x0.f8529c580ac668p-21, -0x0.d421a0afd18718p-20, 0x0.905e3713915848p-22, 0x0.c06fa4b61c1eb8p-23, -0x0.913f7194446428p-25, 0x0.c1336c972e1c18p-25, -0x0.ff8458e349f9c0p-28, -0x0.d2e9362c344bf8p-28, // x=    0.25 y=    4.75
+ 0x0.dc4ea7801972b0p-3, 0x0.f8f65667d39b78p-7, -0x0.b7a5c8b1f0cd68p-8, 0x0.a4679ccdabcf30p-5, -0x0.f05ea7cfefda90p-8, -0x0.c7c77aa2e21eb0p-10, 0x0.be121aa2602df8p-12, -0x0.ac4d9261200868p-10, 0x0.f26d7a3b088128p-13, 0x0.a6eafb3a153648p-14, -0x0.8aa397798e8ed8p-16, 0x0.a77f1bff7cd4b0p-15, -0x0.e374cd785b6ef8p-18, -0x0.dcb7996a2c8ea8p-19, 0x0.a9bf430755d898p-21, -0x0.97db390a4e08d0p-20, 0x0.c7777d0e71dc68p-23, 0x0.fd9cbd8dff24d0p-24, -0x0.b8af39a8d82a58p-26, 0x0.80f20e32212d00p-25, -0x0.a4def05a5a66c0p-28, -0x0.817216839b2920p-28, // x=    0.25 y=       5
+ 0x0.d27b34b340a218p-3, 0x0.e37aa7579f6b70p-7, -0x0.a0bfe2f22baca0p-8, 0x0.9655c708edbbe0p-5, -0x0.d2b632cd555438p-8, -0x0.a7bcffd1752a00p-10, 0x0.994297e797bac8p-12, -0x0.910328a055f610p-10, 0x0.c4264a6743e6a8p-13, 0x0.816597730ad630p-14, -0x0.cedcead13dc328p-17, 0x0.8273dab69eb4e8p-15, -0x0.aab9f568141a50p-18, -0x0.9e9ec74007e0b0p-19, 0x0.eb3ab44b194ac8p-22, -0x0.dbf1339b4d16f8p-21, 0x0.8b8415c0079758p-23, 0x0.a98f4ec096e478p-24, -0x0.ee7a3d0090bc80p-27, 0x0.ae65bfac3a7090p-26, -0x0.d7ba3d09ade2b8p-29, -0x0.a180ca160f4090p-29, // x=    0.25 y=    5.25
+ 0x0.c97ada571a4f08p-3, 0x0.d09ff31af64c88p-7, -0x0.8d759a4bd1aef0p-8, 0x0.89f841a088c6b0p-5, -0x0.b9aba7ced052f0p-8, -0x0.8dcc9cb42dd4b8p-10, 0x0.f92fbcfff21fb0p-13, -0x0.f5b1a22af5c940p-11, 0x0.9ff32919ba7a78p-13, 0x0.ca85a3845923f0p-15, -0x0.9bf98fc94f6ab8p-17, 0x0.cd07207c0567f8p-16, -0x0.816dded88c3b48p-18, -0x0.e6aaf98b63c148p-20, 0x0.a511c26552d298p-22, -0x0.a10599d0729f10p-21, 0x0.c57818eb55d1f0p-24, 0x0.e5d80b66a53e40p-25, -0x0.9c394d833f2a20p-27, 0x0.eed470ce45fea8p-27, -0x0.8f018737ce2a18p-29, -0x0.cc9f954c237340p-30, // x=    0.25 y=     5.5
+ 0x0.c1347bbcbf2cd8p-3, 0x0.bffe0743830788p-7, -0x0.fa33ddfeca0798p-9, 0x0.fe188f02ea1960p-6, -0x0.a4649d33a265c8p-8, -0x0.f14447779df5f8p-11, 0x0.cc2074937e0940p-13, -0x0.d16a460e64d058p-11, 0x0.836306355e03e0p-13, 0x0.9fe3b4231426e8p-15, -0x0.ed8eb765fc9480p-18, 0x0.a2798928e8ad40p-16, -0x0.c61771c96e5fb8p-19, -0x0.a991f711569768p-20, 0x0.ea7450599e59a0p-23, -0x0.ee34f7497bd710p-22, 0x0.8d4e7602543080p-24, 0x0.9dcbde1f5d4220p-25, -0x0.cf81f6b302a3f8p-28, 0x0.a57aca944e7808p-27, -0x0.bffcac66eba968p-30, -0x0.8386d49bf83be8p-30, // x=    0.25 y=    5.75
+ 0x0.b992c389e68dd8p-3, 0x0.b13fe46c484330p-7, -0x0.de49f12165bd78p-9, 0x0.eab67097904d70p-6, -0x0.9234cd853f3e38p-8, -0x0.ce77fa2d0b31e0p-11, 0x0.a868d7592af138p-13, -0x0.b383d46ab1b3f0p-11, 0x0.d9548bb075bc58p-14, 0x0.fe8e01483fde78p-16, -0x0.b6993a58ade9d8p-18, 0x0.81c59296675e30p-16, -0x0.98ef292fc224d0p-19, -0x0.fbe4f43f5bef98p-21, 0x0.a862838c4b9b18p-23, -0x0.b1e9b6f2710870p-22, 0x0.cc5e791d7838d8p-25, 0x0.db4f1ab0ab78f8p-26, -0x0.8b9c3ac294ccb8p-28, 0x0.e7e7263721f578p-28, -0x0.826ab4f3317280p-30, -0x0.ab6ce28aa3d2d8p-31, // x=    0.25 y=       6
+ 0x0.b283768cda6458p-3, 0x0.a41fb095924140p-7, -0x0.c6560c9ccfcff8p-9, 0x0.d97022b352e0c0p-6, -0x0.82933a61243088p-8, -0x0.b1aa6822536678p-11, 0x0.8bdec49f95ad98p-13, -0x0.9ab534022f6db0p-11, 0x0.b4e71430f45a98p-14, 0x0.cc35244ce943f0p-16, -0x0.8d965fc5ffa0a0p-18, 0x0.d0d80ca0ae7998p-17, -0x0.ee1da83607a218p-20, -0x0.bcea95906c2b78p-21, 0x0.f471b56602d558p-24, -0x0.861aac2849a308p-22, 0x0.9543c10bf10f68p-25, 0x0.9a279682d19088p-26, -0x0.be2c643e4dba40p-29, 0x0.a43c3bf2842fc0p-28, -0x0.b33442ef878318p-31, -0x0.e25ae925e62b48p-32, // x=    0.25 y=    6.25
+ 0x0.abf6ea12daf148p-3, 0x0.98639e22e11638p-7, -0x0.b1ac265073a4e8p-9, 0x0.c9faf9eeb16380p-6, -0x0.ea2437edd75bb8p-9, -0x0.99aba20a697af8p-11, 0x0.e9c9e8b3244378p-14, -0x0.85ff64a25140c0p-11, 0x0.977db86e759d50p-14, 0x0.a503312ede1770p-16, -0x0.dd636b8beb34e0p-19, 0x0.a9396ebac81950p-17, -0x0.bad534c6b40590p-20, -0x0.8efc095cf870c8p-21, 0x0.b3367a23265278p-24, -0x0.cbed0ba41765f8p-23, 0x0.dc19dd5650c478p-26, 0x0.db120f79b12510p-27, -0x0.8308d85b3fa638p-29, 0x0.eafdea2d6c4c80p-29, -0x0.f8e9a7911dc000p-32, -0x0.974c4938829610p-32, // x=    0.25 y=     6.5
+ 0x0.a5df959ff14a30p-3, 0x0.8ddb883f0f5d90p-7, -0x0.9fc1c870f0cec8p-9, 0x0.bc18a3391a0f80p-6, -0x0.d2b1ab8d5ee9c0p-9, -0x0.858f227c505cf8p-11, 0x0.c488755b85dba8p-14, -0x0.e9366606979548p-12, 0x0.ff2a4ff4425208p-15, 0x0.86410c2e5b9740p-16, -0x0.ae6df87b5f36d8p-19, 0x0.8a068d2e0f8420p-17, -0x0.93afba6f4764e8p-20, -0x0.da506d01d62248p-22, 0x0.84a2c3756c0970p-24, -0x0.9c53f824f89bb8p-23, 0x0.a3bbedd9f2eb68p-26, 0x0.9d432d9b803438p-27, -0x0.b690e3bdacaa00p-30, 0x0.a9bdad556f66d0p-29, -0x0.aea722a563db28p-32, -0x0.cca3668d355280p-33, // x=    0.25 y=    6.75
+ 0x0.ad37e030a19e40p0, 0x0.8c1e1b1b4b8978p0, -0x0.d885d83cca05e0p0, 0x0.e36fa644169670p-1, -0x0.9790e42a8d8a28p-2, -0x0.d330ff10929aa0p0, 0x0.a022fd424af4d0p0, 0x0.c2f32dadf7bf38p-4, -0x0.f8c694fac67750p-3, 0x0.cb937f47cdc2b0p-1, -0x0.e11f28fea3eeb8p-2, -0x0.f290eecb7f63b0p-3, 0x0.b0b9d7d70c99f8p-3, -0x0.dce67804d78d08p-3, 0x0.c22a62d3b16f98p-4, 0x0.d9808a97e7c158p-4, -0x0.ed66da9af559b8p-5, 0x0.98ee5beb038588p-5, -0x0.d54c7bd09adce8p-7, -0x0.ebce27b52dbf50p-6, 0x0.d87b8fa6d53b28p-7, -0x0.fdacb1a3988d30p-9, 0x0.e4595704ba61d0p-11, 0x0.b92bc826f57638p-8, -0x0.923fba621cc6a0p-9, 0x0.959e8bdc65c618p-14, 0x0.dc18b6dbf04c30p-15, -0x0.c6ade8f225f7f0p-11, 0x0.aea8b0aeabef58p-13, 0x0.c6d4ae8a38a350p-16, // x=     0.5 y=       0
+ 0x0.881aef7e94c960p0, 0x0.a3ac836c259420p-1, -0x0.d981f42b57c850p-1, 0x0.a8fade83454670p-1, -0x0.91cd25e1b17640p-2, -0x0.bbb892edeff508p-1, 0x0.80733b45c380e8p-1, -0x0.81b03dc14ad120p-4, -0x0.d75b4ffd0f73f8p-6, 0x0.95af2186e07d00p-2, -0x0.99e293e0d9c6d8p-3, -0x0.b3773873572050p-5, 0x0.8db276d720ed08p-5, -0x0.8e69c72f9c4548p-4, 0x0.f018d233123370p-6, 0x0.ade9707e489a58p-6, -0x0.b81e736ef59d10p-7, 0x0.b975f3ce5719b0p-7, -0x0.835d805f4b6df0p-8, -0x0.af6b30f1309ee0p-8, 0x0.99d2d9d5ad3310p-9, -0x0.a99e48e9d5ed38p-10, 0x0.c40e28e75e3940p-12, 0x0.fbbf4e648ec248p-11, -0x0.c20c6a0acc9060p-12, 0x0.c18390aeb53400p-14, -0x0.8b6f6191eb0b08p-16, -0x0.8ddbb315ef37a0p-13, 0x0.c42ddf6d2eda58p-15, -0x0.c4263549eeb8f0p-22, // x=     0.5 y=    0.25
+ 0x0.ea4050e8226ab0p-1, 0x0.ee8ffb0855a040p-2, -0x0.8fb6683cf58138p-1, 0x0.87d08800f2e420p-1, -0x0.ee2feb05c4ad88p-3, -0x0.e4b0a2bd525bd8p-2, 0x0.91f3982398aa30p-2, -0x0.90b48244b796f0p-4, 0x0.a870423cc7be58p-8, 0x0.a0149801cfa148p-3, -0x0.9c1d3540ffec08p-4, -0x0.c651faa62088f8p-7, 0x0.becce429359518p-7, -0x0.8a105a1950b5c8p-5, 0x0.e024c77b27bdc0p-7, 0x0.f26abe73940de8p-8, -0x0.ff22854ace5118p-9, 0x0.a834881bb53428p-8, -0x0.ea28d795be0bc0p-10, -0x0.ee0ee909f529a0p-10, 0x0.cb21043c361300p-11, -0x0.9712c55c93ef10p-11, 0x0.b397e294a52650p-13, 0x0.a14c92c5ea3e00p-12, -0x0.f108018592a948p-14, 0x0.c1a1a224d23ee8p-15, -0x0.ba3f6186cc4ca8p-17, -0x0.a9447414de01f8p-15, // x=     0.5 y=     0.5
+ 0x0.cbbe828132fcd8p-1, 0x0.b2ff45b4962a48p-2, -0x0.c41d8c46f8ae20p-2, 0x0.da9bf42ab8b178p-2, -0x0.bb442f6151e328p-3, -0x0.9006e3913000d0p-2, 0x0.ab7bc54875b088p-3, -0x0.f8df0672249db8p-5, 0x0.cd305558829758p-7, 0x0.b0e45384cec020p-4, -0x0.a35fa01fb3fc28p-5, -0x0.db3f6e5c781f28p-10, 0x0.ef050e84e374c0p-9, -0x0.89b3292eadaf28p-6, 0x0.d6626384c15928p-8, 0x0.a847bdd2a1f338p-9, -0x0.b3e0a2658fe530p-10, 0x0.9b50112bba4878p-9, -0x0.d25ce99960c1b0p-11, -0x0.a5ea3829aaac90p-11, 0x0.8a6b7fb74e3198p-12, -0x0.8564decea8b6e0p-12, 0x0.9e2cf8d3528cf0p-14, 0x0.d5dfe70cac6280p-14, -0x0.9b20268e546320p-15, 0x0.ae587b92e539d8p-16, -0x0.b2d321f355ed08p-18, -0x0.d356289475df20p-17, // x=     0.5 y=    0.75
+ 0x0.b31d208147dc80p-1, 0x0.89c8f4d4825dc0p-2, -0x0.89c4aa650e5448p-2, 0x0.b1378fc14085d0p-2, -0x0.9181a993fc5b90p-3, -0x0.bb1cddf7352528p-3, 0x0.cff7dc15fe1ff8p-4, -0x0.c4c890040a7918p-5, 0x0.c95e625fcffd58p-7, 0x0.c9c19156efac78p-5, -0x0.b056f66db90f68p-6, 0x0.b3da1356868ca8p-10, 0x0.ec8542066956e0p-11, -0x0.8d6fe177d85138p-7, 0x0.d2a7d5498592e8p-9, 0x0.e14f11a1f7ff20p-11, -0x0.fed7f1affdc2c0p-12, 0x0.92c72d96b405c0p-10, -0x0.c0536ceebcdeb0p-12, -0x0.ebf07fa67ab8c8p-13, 0x0.c1dc9c8b62e4c0p-14, -0x0.ed9c432bf713d0p-14, 0x0.8a7b45fbb1ae70p-15, 0x0.9248d8f61bb388p-15, -0x0.ce7628fd43ae80p-17, 0x0.98025b550f9958p-17, -0x0.9e004617600eb0p-19, -0x0.88908e725fc870p-18, // x=     0.5 y=       1
+ 0x0.9f0e0f1c6c13b0p-1, 0x0.d8eee19f0a1c00p-3, -0x0.c6b55f18c09588p-3, 0x0.911333f0ee1d68p-2, -0x0.e22424575240e8p-4, -0x0.fa1aff9455e658p-4, 0x0.81e823a8144f40p-4, -0x0.96b852be9790a0p-5, 0x0.a55154acf57028p-7, 0x0.ed2ad0d192ad60p-6, -0x0.c425ae5e905218p-7, 0x0.fd26381512dae8p-10, 0x0.85dbf6718ac360p-16, -0x0.959b342c7c2328p-8, 0x0.d4de0d2b4d3328p-10, 0x0.86d8a534a2f9c0p-12, -0x0.b18f7e932aaff0p-13, 0x0.8e54d263d57948p-11, -0x0.b3cf28dbd2fc10p-13, -0x0.a98002b8abb0a0p-14, 0x0.8ab9d3c5109d08p-15, -0x0.d74b4b15b3efe8p-15, 0x0.f4ba38fc9523a0p-17, 0x0.cdad1f026ac3b0p-17, -0x0.8dae0d5beab7e0p-18, 0x0.840c7c3981a3d0p-18, -0x0.8828d2478b28e0p-20, -0x0.b65477d5a45e58p-20, // x=     0.5 y=    1.25
+ 0x0.8e8cb89ba42260p-1, 0x0.ae296afc17ba20p-3, -0x0.92b8ff56e78ef0p-3, 0x0.f012827eda4f00p-3, -0x0.b0c25d943a1f88p-4, -0x0.ab90bb3c4fc670p-4, 0x0.a6d5b68b426960p-5, -0x0.e47c95130b7c78p-6, 0x0.fe67bfc7c5f648p-8, 0x0.8f6d1c6c473e70p-6, -0x0.e09087c934df90p-8, 0x0.e327ef5b27bbc0p-10, -0x0.e8376736a93e40p-13, -0x0.a2da8c4ae36cd8p-9, 0x0.dd36f42ad14388p-11, 0x0.d796e3fb4472a0p-15, -0x0.e93ca94f30b1f8p-15, 0x0.8dc27fe6cd6810p-12, -0x0.ac4ef941b46e18p-14, -0x0.f262e58e6572d8p-16, 0x0.c9579d73c79088p-17, -0x0.c7546765762528p-16, 0x0.dc0202a599e868p-18, 0x0.93d34157cba5a8p-18, -0x0.c514cec6687fb0p-20, 0x0.e83b936f936558p-20, // x=     0.5 y=     1.5
+ 0x0.80d266f937c448p-1, 0x0.8e412d4fd648c0p-3, -0x0.dd4f31e5668948p-4, 0x0.c8c626e33d5b60p-3, -0x0.8b5aa6c637f5c0p-4, -0x0.f10b1b5b320490p-5, 0x0.dbce814a1c5180p-6, -0x0.ad27a166306c20p-6, 0x0.bebe7755e6d540p-8, 0x0.b22bc92b4d3790p-7, -0x0.841ebef17b30b0p-8, 0x0.b39ddd68f85380p-10, -0x0.ffb8023e255f98p-13, -0x0.b63e1e8d988e68p-10, 0x0.ec4a27a1aa0f18p-12, -0x0.d36a8b1824df98p-17, -0x0.80d652e6ce5000p-16, 0x0.91074269a8f518p-13, -0x0.a968a5a88d2338p-15, -0x0.a7efcc52306b68p-17, 0x0.9285c0d5a705d0p-18, -0x0.bcfbc98f94e3b0p-17, 0x0.c9e447c60f6af8p-19, 0x0.d824c4b5c2efb0p-20, -0x0.8dff8522930560p-21, 0x0.cefacfca5a6ad0p-21, // x=     0.5 y=    1.75
+ 0x0.ea90f9d24a1c70p-2, 0x0.ebef779ffbf6a8p-4, -0x0.aa1b24b383b5f8p-4, 0x0.a9a5b1e1da4aa0p-3, -0x0.dde578b22cc5d8p-5, -0x0.ad09cff9a9e288p-5, 0x0.944123da788830p-6, -0x0.83e15c16552098p-6, 0x0.8dc6ae98b2b120p-8, 0x0.e2ec1aa211b230p-8, -0x0.9f88cff3ebeef0p-9, 0x0.8712ade5b5dd00p-10, -0x0.d715626f961348p-13, -0x0.d1646cf213fe58p-11, 0x0.819788f8497a70p-12, -0x0.e4afd621c5e908p-16, -0x0.f4d7981abf5510p-20, 0x0.9855b543336dd0p-14, -0x0.aae6d97e834cb8p-16, -0x0.d4acd24b5e4128p-19, 0x0.d1fe2305c64958p-20, -0x0.b7a4f7e5518c80p-18, 0x0.bd8ed759f38a30p-20, 0x0.9f41fc1ccfd608p-21, -0x0.d040a0a6e79cc0p-23, 0x0.bc48743c192e60p-22, // x=     0.5 y=       2
+ 0x0.d6f92d2636a998p-2, 0x0.c649c3c8dc8430p-4, -0x0.84ff7fc4f9dbf8p-4, 0x0.90be60d8bc98e0p-3, -0x0.b27971707d4d70p-5, -0x0.fd63b58fdb6390p-6, 0x0.cc615239240580p-7, -0x0.ca6fcdf235f690p-7, 0x0.d2bed27dfd1de0p-9, 0x0.93e6288f62f4b8p-8, -0x0.c55f6fd4f5fc50p-10, 0x0.c6f6e843d647d0p-11, -0x0.a4f77366494840p-13, -0x0.f6aed6f69357d0p-12, 0x0.91cfe75a1c7f48p-13, -0x0.dac329d3b17f70p-16, 0x0.8e392c7415ac78p-19, 0x0.a42727c6d47588p-15, -0x0.b0d5eee4bd08f8p-17, -0x0.cbbcb43df10b48p-21, 0x0.8f1d0515ae2048p-21, -0x0.b6eee75c4a3530p-19, 0x0.b6411f5ec04e30p-21, 0x0.e96e9098c6bec0p-23, -0x0.9a4e6e8b0e0488p-24, 0x0.af2102e7e93368p-23, // x=     0.5 y=    2.25
+ 0x0.c62e93cf98e938p-2, 0x0.a8a1c9626069a0p-4, -0x0.d32f039304c700p-5, 0x0.f93af48017c788p-4, -0x0.9101b8a06775e0p-5, -0x0.bce3b605e404a0p-6, 0x0.8fb8957ec5c6f0p-7, -0x0.9cc5f3ee174090p-7, 0x0.9d57c982ca68d0p-9, 0x0.c4fd38279eced8p-9, -0x0.f9cd9a6e1daec0p-11, 0x0.9184f90d3f3fd8p-11, -0x0.f35994b4428f50p-14, -0x0.94c82f43c84ee8p-12, 0x0.a816892dd7d320p-14, -0x0.af527b5580d318p-16, 0x0.b9eaf307986740p-19, 0x0.b54a7842dc3d18p-16, -0x0.bb8b6c3c9a76a0p-18, 0x0.e6285e47c9bc80p-26, 0x0.aa56d25d28c6b0p-23, -0x0.babc2f9d52d5f0p-20, 0x0.b37863af053258p-22, 0x0.a657a4f13c18a8p-24, -0x0.e4a73afe1eab08p-26, 0x0.a6b003bc6e2280p-24, // x=     0.5 y=     2.5
+ 0x0.b7aa78a20f3a00p-2, 0x0.90ed4f2f5c8d10p-4, -0x0.a9ffa7b3efedd8p-5, 0x0.d85dd6b8098688p-4, -0x0.edf0d33b9a2bb8p-6, -0x0.8f21d13ee66d08p-6, 0x0.cde19a40c4a2d0p-8, -0x0.f524ecce9cf0d8p-8, 0x0.ec984767d5d6d8p-10, 0x0.85d5bd828493c8p-9, -0x0.a17a0ff78ec138p-11, 0x0.d4eac1ae0cb590p-12, -0x0.b0877bc7c634c8p-14, -0x0.b781db8bce41c0p-13, 0x0.c645ff2f6d05c8p-15, -0x0.8328380f043ee0p-16, 0x0.a265c4bdcd5e38p-19, 0x0.ccfa96e102c658p-17, -0x0.cbb0b77d4bb718p-19, 0x0.f897c19e747cc8p-23, 0x0.f5152e00772da8p-26, -0x0.c3376df8bef210p-21, 0x0.b48f5849634e78p-23, 0x0.ceafb89e4be930p-26, // x=     0.5 y=    2.75
+ 0x0.ab0419ad3cccb0p-2, 0x0.fb7498ce435d78p-5, -0x0.8a9045bb3af678p-5, 0x0.bd47eed6c155d8p-4, -0x0.c50a1a2d5265a8p-6, -0x0.dc2ea5c6731a68p-7, 0x0.95fa97773987d8p-8, -0x0.c18439fe550668p-8, 0x0.b35d299ff81db8p-10, 0x0.b941acee8d3dc8p-10, -0x0.d4f22bf235abd8p-12, 0x0.9c6df61a20e430p-12, -0x0.feb9c53d58afa0p-15, -0x0.e71e3047ac3dd8p-14, 0x0.ef0507662757a8p-16, -0x0.be4f57adf95e38p-17, 0x0.fad1d00575e3e0p-20, 0x0.ed01aa4ca3cba0p-18, -0x0.e25476833d7bd8p-20, 0x0.81e98e2e17a878p-22, -0x0.c99000e2854d68p-27, -0x0.d0d6a89292e730p-22, 0x0.ba486665762ee8p-24, 0x0.d1761e1b374fb0p-28, // x=     0.5 y=       3
+ 0x0.9fe936a64f7e80p-2, 0x0.dbfbab07905be8p-5, -0x0.e472c0181909a8p-6, 0x0.a6c141d37edbb8p-4, -0x0.a49ab9aeb7abf0p-6, -0x0.abae649d12b908p-7, 0x0.ddf0e1ebebee80p-9, -0x0.9a36387def2e00p-8, 0x0.893142f03b8c88p-10, 0x0.82705e9578a1e8p-10, -0x0.8f087d88d0bbd0p-12, 0x0.e75adc981a7160p-13, -0x0.b7e66d72349198p-15, -0x0.946c4a1fa34e10p-14, 0x0.930e470237a798p-16, -0x0.8842bc2ea82768p-17, 0x0.b7cd4dc396ef38p-20, 0x0.8bf5bda5550c30p-18, -0x0.808310e93a7458p-20, 0x0.d5129cc2d973e0p-23, -0x0.ae00b8b0733a28p-26, -0x0.e46aa7440e2600p-23, 0x0.c488a4d875cbb8p-25, 0x0.8f26158e829aa8p-33, // x=     0.5 y=    3.25
+ 0x0.96189c2d87e9e8p-2, 0x0.c1e860bb3a6f60p-5, -0x0.be42b8f3cef7a0p-6, 0x0.93dc62a53167c8p-4, -0x0.8aa478e4d0e320p-6, -0x0.878bb33f444108p-7, 0x0.a696fe00c9a8c0p-9, -0x0.f808ec683b13d8p-9, 0x0.d3ca1ed865dff8p-11, 0x0.baa20ff6b4d7c8p-11, -0x0.c37e1be01e1b38p-13, 0x0.ac692623a93728p-13, -0x0.8550aa45c5e9d8p-15, -0x0.c22bc386567b90p-15, 0x0.b87baa66853bd0p-17, -0x0.c25430a48f2778p-18, 0x0.83798fd3d76108p-20, 0x0.a8a8fca481d720p-19, -0x0.94ffb5916cd5a0p-21, 0x0.9fcf8aae7dcd88p-23, -0x0.9ffe5939a84060p-26, -0x0.ff301756509330p-24, 0x0.d3ddcad528d2b0p-26, -0x0.cc2f8285ec7c38p-30, // x=     0.5 y=     3.5
+ 0x0.8d5e1ef63b4a88p-2, 0x0.ac174f3005bec8p-5, -0x0.9ff11fd448c598p-6, 0x0.83e2fef369cf78p-4, -0x0.eb5997843e3a40p-7, -0x0.d87f01a7e81a48p-8, 0x0.fd6b90ca23ed90p-10, -0x0.c9384a910cdb18p-9, 0x0.a4f53fbf77c008p-11, 0x0.878192c5a4b8e8p-11, -0x0.87c3b449b6a288p-13, 0x0.818fbf379395f8p-13, -0x0.c279c396a03c58p-16, -0x0.8137b54f9b1f98p-15, 0x0.ebafff3db848a0p-18, -0x0.8ab76f471f2940p-18, 0x0.ba24804125cd80p-21, 0x0.cf263a849fbb18p-20, -0x0.b030b85963fe80p-22, 0x0.e635786e788188p-24, -0x0.fa950865b27320p-27, -0x0.9177529334fff8p-24, 0x0.e92b7b00b48d08p-27, -0x0.df5cc8f833da18p-30, // x=     0.5 y=    3.75
+ 0x0.858fa0ad1e2368p-2, 0x0.99ac79c50366d0p-5, -0x0.879ab453a2a3b0p-6, 0x0.ec8f9bad2d7858p-5, -0x0.c9312b91caded8p-7, -0x0.aeb93926030388p-8, 0x0.c320a01549e710p-10, -0x0.a499eda92aee00p-9, 0x0.819f0fcd669af0p-11, 0x0.c77d72a7612738p-12, -0x0.bf6c91d253fc00p-14, 0x0.c4679ed0464578p-14, -0x0.8ee19ae6389d60p-16, -0x0.aec8f07ad4e3a8p-16, 0x0.992752638cf7c8p-18, -0x0.c6d77ba21e07c8p-19, 0x0.8362d1aaf7d8c8p-21, 0x0.8184d767822908p-20, -0x0.d44701a8f28ce8p-23, 0x0.a2aae798890af0p-24, -0x0.b7964a19a914e8p-27, -0x0.a9132d4ee8f4b8p-25, 0x0.82dfcd16226b20p-27, -0x0.b8917638103af8p-30, // x=     0.5 y=       4
+ 0x0.fd15aaec688c68p-3, 0x0.89ffa9f18ee0e0p-5, -0x0.e7bd1e71a239e0p-7, 0x0.d538adc4f90ea8p-5, -0x0.ad249ac87ce1e0p-7, -0x0.8e61ea0308d5d8p-8, 0x0.97f451819a6670p-10, -0x0.87b5420f7d9f38p-9, 0x0.cd744296b6b9a8p-12, 0x0.94baac10f96968p-12, -0x0.88db97c3be8838p-14, 0x0.96279c2fe8b860p-14, -0x0.d39c007d2b5940p-17, -0x0.f0074519474198p-17, 0x0.ca475b85a3c658p-19, -0x0.8f58f299e53b60p-19, 0x0.b9bc84fe8a44f8p-22, 0x0.a4bc6cdf78e220p-21, -0x0.822a62c2d3a4d0p-23, 0x0.e4058bdc4567e0p-25, -0x0.824f4c896e0d10p-27, -0x0.c828daae3a9cc0p-26, 0x0.95b89bb9a76928p-28, -0x0.89f19ea7d08cb8p-30, // x=     0.5 y=    4.25
+ 0x0.f0672b9264e228p-3, 0x0.f91d6d245f1bd0p-6, -0x0.c76f044f0228a8p-7, 0x0.c112f025e6b918p-5, -0x0.95eefbb7c06930p-7, -0x0.ea22fae8542940p-9, 0x0.ef29fae260d790p-11, -0x0.e16ff107bf2078p-10, 0x0.a42a0926e20d50p-12, 0x0.e06b6127fca520p-13, -0x0.c646229b1a5600p-15, 0x0.e78c249579a988p-15, -0x0.9dfb0de7bc1bd8p-17, -0x0.a72ba489237ee0p-17, 0x0.879f82695528a8p-19, -0x0.d01bcc1761e5c0p-20, 0x0.83d0673f738f70p-22, 0x0.d4eaadc5d7a5b0p-22, -0x0.a24d0738c6a8e8p-24, 0x0.9f87c131f83cb8p-25, -0x0.b8388dc7560b18p-28, -0x0.f032a3fa2754d0p-27, // x=     0.5 y=     4.5
+ 0x0.e4e52ea8f86600p-3, 0x0.e1e7969d1fbfe0p-6, -0x0.acc3ac3b7cda90p-7, 0x0.af93c6a52b77d8p-5, -0x0.8296fd5588b6b8p-7, -0x0.c21ad8d4ae07b8p-9, 0x0.be0e1892975010p-11, -0x0.bc8f1e62810d20p-10, 0x0.84339dbc828268p-12, 0x0.ab3323066de668p-13, -0x0.9165c78a6d2848p-15, 0x0.b402c536964fa8p-15, -0x0.edd4d4c558d4b0p-18, -0x0.ebfaf1887ae368p-18, 0x0.b87b4734332280p-20, -0x0.983203304bc950p-20, 0x0.bc24ce83e72d28p-23, 0x0.8bb1d2032b01b8p-22, -0x0.cda9f53712f4b0p-25, 0x0.df946baef02b20p-26, -0x0.ff8a16c4415540p-29, -0x0.9314defe4a6640p-27, // x=     0.5 y=    4.75
+ 0x0.da68e429617980p-3, 0x0.cdbcda1ecd10a0p-6, -0x0.96925bc431a8d8p-7, 0x0.a04c0d915a3aa0p-5, -0x0.e4b7662f7db8e0p-8, -0x0.a226ff6df4c9b8p-9, 0x0.98678496f893c0p-11, -0x0.9ec0d80d82ada8p-10, 0x0.d683b0262dc240p-13, 0x0.83f50885f806b0p-13, -0x0.d7b50f436bd3d0p-16, 0x0.8d11208793df30p-15, -0x0.b47bb8576f9128p-18, -0x0.a8a7a8caef0528p-18, 0x0.fe57835152fe60p-21, -0x0.e05737181ba780p-21, 0x0.8727ff1afcf9d8p-23, 0x0.b9f2fdfa9513d0p-23, -0x0.8449209a98e580p-25, 0x0.9d4d4f955f46f0p-26, -0x0.b11ba80fc94aa8p-29, -0x0.b6fdcfce3f7868p-28, // x=     0.5 y=       5
+ 0x0.d0d1bc7f01f658p-3, 0x0.bc1ccac45ded28p-6, -0x0.83f7b26e43d458p-7, 0x0.92e1f87527c4e8p-5, -0x0.c94d3528bbee20p-8, -0x0.886c8e73cac4c0p-9, 0x0.f67ef7f32c6998p-12, -0x0.867cee704c6d38p-10, 0x0.af45f12557cf78p-13, 0x0.cd64a5f80ba3f0p-14, -0x0.a1bd4ea33c3df0p-16, 0x0.deccfe5a33e368p-16, -0x0.8a0f2bdbb94508p-18, -0x0.f3edd5bb783fd8p-19, 0x0.b1912dc76b8da0p-21, -0x0.a6a4ccbb4e5d80p-21, 0x0.c39189e1424a68p-24, 0x0.fae3a400427c80p-24, -0x0.ac9fb1682b5110p-26, 0x0.de8bbbee5b8c38p-27, -0x0.f6114c68235200p-30, -0x0.e71b547d4a4638p-29, // x=     0.5 y=    5.25
+ 0x0.c80439cf53c9b0p-3, 0x0.aca00961756690p-6, -0x0.e8876243747b88p-8, 0x0.870c7136930658p-5, -0x0.b202b5e8784b80p-8, -0x0.e7134b6d160cb0p-10, 0x0.c8ea1423b1a108p-12, -0x0.e53178ff807c60p-11, 0x0.902c80b6d01ef8p-13, 0x0.a14ca755e26748p-14, -0x0.f50273cd33af60p-17, 0x0.b13ebefc60a688p-16, -0x0.d4db7dfa3979a8p-19, -0x0.b25d280284cc98p-19, 0x0.faeb5c8e813ac8p-22, -0x0.f9828103ad9b28p-22, 0x0.8e8aa7cc867ab0p-24, 0x0.ab6eabd628fea8p-24, -0x0.e45512d2ee0df8p-27, 0x0.9e6af2295abe98p-27, -0x0.aba9133cd52e30p-30, -0x0.94077242d2ab80p-29, // x=     0.5 y=     5.5
+ 0x0.bfe9020672cbc8p-3, 0x0.9ef2b1e168bc80p-6, -0x0.cdd9a89fb53ca8p-8, 0x0.f91f245283f430p-6, -0x0.9e1c61d76b4940p-8, -0x0.c4e78ea6904040p-10, 0x0.a4f882bcd9c9f0p-12, -0x0.c45e164d0fd460p-11, 0x0.eeb28b6e64bf88p-14, 0x0.ff7f599453f7b0p-15, -0x0.bb58230edbd438p-17, 0x0.8dffeb9c2d3080p-16, -0x0.a552f1839d00f0p-19, -0x0.83c9fe76a6b810p-19, 0x0.b34cf0fbfb4528p-22, -0x0.bc3b03dbb88f60p-22, 0x0.d1595a3b429028p-25, 0x0.ed214e235182e0p-25, -0x0.98f5bd57a2d230p-27, 0x0.e3133ca9b09870p-28, -0x0.f0ce2ac1b0beb0p-31, -0x0.c036cbf4691ff0p-30, // x=     0.5 y=    5.75
+ 0x0.b86c2260bcffa0p-3, 0x0.92d02982082638p-6, -0x0.b70d6d39f8a038p-8, 0x0.e673e41f89a7f8p-6, -0x0.8d0492ceb7fcd8p-8, -0x0.a8c08d4f979e20p-10, 0x0.8864b10dcf79a0p-12, -0x0.a91d267daab660p-11, 0x0.c6ca4d7ee5abd0p-14, 0x0.cbf7a39b738850p-15, -0x0.9088febb0f10a0p-17, 0x0.e50f13a4e6ea98p-17, -0x0.8155f099087848p-19, -0x0.c4ad0696155ed8p-20, 0x0.817f87a7bb2318p-22, -0x0.8f11f23edbcde0p-22, 0x0.9ae3aecd00ef70p-25, 0x0.a5e431e38afee8p-25, -0x0.cf722080431478p-28, 0x0.a3e62c410e0648p-28, -0x0.a9f1be76e6f798p-31, -0x0.fcd0fe93355480p-31, // x=     0.5 y=       6
+ 0x0.b17c791098e1b8p-3, 0x0.87ffee976a66e8p-6, -0x0.a376626db0c378p-8, 0x0.d5c51a303ec5b8p-6, -0x0.fc8611809a15d8p-9, -0x0.9167216bfeaf70p-10, 0x0.e2fe38259584d8p-13, -0x0.925a694bab7338p-11, 0x0.a680b7e88fd5d0p-14, 0x0.a40cd95b115478p-15, -0x0.e0e5f5db07a4f0p-18, 0x0.b9ef067aa941c0p-17, -0x0.cbc5985f5097d0p-20, -0x0.941f6f77945d20p-20, 0x0.bcf468907ac938p-23, -0x0.db144cbba25c78p-23, 0x0.e6e50b8d7f6938p-26, 0x0.eaa3dcf56fa928p-26, -0x0.8e4e006cdec780p-28, 0x0.ee4e6758733b58p-29, -0x0.f175f89208bf58p-32, -0x0.a84e9cd39713f0p-31, // x=     0.5 y=    6.25
+ 0x0.ab0b3c76230100p-3, 0x0.fca64c8d562db8p-7, -0x0.928a85d40c6c90p-8, 0x0.c6ce4847996e20p-6, -0x0.e2ecff6ceceab0p-9, -0x0.fbd4b986ccfba8p-11, 0x0.be090034646f18p-13, -0x0.fe7a304b347898p-12, 0x0.8c3756c99893d8p-14, 0x0.84e0023c37f068p-15, -0x0.b05d2e61e62ff0p-18, 0x0.97da04d499fb28p-17, -0x0.a19894d21c1f88p-20, -0x0.e11361ab628128p-21, 0x0.8b2d7123988150p-23, -0x0.a8ebf9e37ffa28p-23, 0x0.ad59b56b129f58p-26, 0x0.a7a7bbdb1fe5f8p-26, -0x0.c56442657b67f8p-29, 0x0.ae7f6079a71090p-29, -0x0.acb75c20792a98p-32, -0x0.e2b6b23dac4cf8p-32, // x=     0.5 y=     6.5
+ 0x0.a50b9973558888p-3, 0x0.eb456f8f9d4908p-7, -0x0.83da7e17f7fc78p-8, 0x0.b955ebc1eabd98p-6, -0x0.cc9f988dfd6a98p-9, -0x0.db1c4cf9e42320p-11, 0x0.a000f7cc97f270p-13, -0x0.de33dbd5eae010p-12, 0x0.ed5fbe853434e0p-15, 0x0.d8ad7c51858b38p-16, -0x0.8b57895e048398p-18, 0x0.f97aecd3861c50p-18, -0x0.80f82d82d4f440p-20, -0x0.ac6d37b03b40e0p-21, 0x0.cee3bd9d4ebc90p-24, -0x0.832313377d1518p-23, 0x0.831225725fc220p-26, 0x0.f1ef7bfcab31d0p-27, -0x0.8a561c0f2dde08p-29, 0x0.80b033e7398568p-29, -0x0.f8d0115b3fbf08p-33, -0x0.9a6496a71eb558p-32, // x=     0.5 y=    6.75
+ 0x0.ee1a240886d570p-1, 0x0.9be67260292fe0p0, -0x0.d056df8775faf0p0, 0x0.805166df0d1858p-3, 0x0.fcfbc6490f40c0p-2, -0x0.a9ef59a08ea4f0p0, 0x0.cbffbadf4f62f0p-1, 0x0.b0df0216242168p-1, -0x0.987ed353f4fa50p-1, 0x0.b91b916de7bf28p-2, -0x0.e1cf39821d1070p-4, -0x0.ce48daf80a4908p-2, 0x0.ec41fcd069e4a0p-3, -0x0.c4a305250ea5d8p-9, -0x0.d672859988f420p-6, 0x0.ed4a4026a53758p-4, -0x0.d4cd74a162bb90p-5, -0x0.c97b7c18123310p-6, 0x0.82670bb0fe6778p-6, -0x0.abbf44f2013190p-6, 0x0.f93317e544c180p-8, 0x0.8c9ea1abc721d0p-7, -0x0.85dcd0a9555e88p-8, 0x0.a050cd5a2ff838p-9, -0x0.afff5a86eb51f8p-11, -0x0.e372d24c5f6b08p-10, 0x0.a217122d686190p-11, -0x0.94fcb7b64c2510p-13, 0x0.8fdbcb513ba0b0p-16, 0x0.92bcc652300598p-13, // x=    0.75 y=       0
+ 0x0.d7391549ee9a68p-1, 0x0.c235dee68d7228p-1, -0x0.e6fb7e14777898p-1, 0x0.98e3a7fad1e420p-2, 0x0.f8da8870149e38p-5, -0x0.ae7b291c9c78c0p-1, 0x0.ca972444cf8e48p-2, 0x0.bbb78217fe9fa0p-3, -0x0.ad2d2865b87240p-3, 0x0.bedd5bb4ebb648p-3, -0x0.91a968a3d11130p-4, -0x0.e7d368f352f360p-4, 0x0.80f516ffd7fa88p-4, -0x0.a5ad9b1f57c850p-6, 0x0.9e187fc4b1a270p-9, 0x0.fb188bb94ff4c8p-6, -0x0.db7aeac92c7dd0p-7, -0x0.f5c4147df733f8p-10, 0x0.faab163d262ad0p-10, -0x0.aeab5b2ac18500p-8, 0x0.fee684498feda0p-10, 0x0.989f20609edad0p-10, -0x0.9770cdad08c710p-11, 0x0.aabe43ca6895c0p-11, -0x0.d0d63ccc5357f8p-13, -0x0.849d7a7aebd888p-12, 0x0.d3fecde218c770p-14, -0x0.e540ed1a10f560p-15, 0x0.d6e20adcea0718p-17, 0x0.9cbf1c2fb6a240p-15, // x=    0.75 y=    0.25
+ 0x0.c3ba8af05f4388p-1, 0x0.91f4fdb4fa2ae8p-1, -0x0.a01436026e0090p-1, 0x0.9b4a00be4d1c50p-2, -0x0.e4376e58dd4680p-6, -0x0.e3b1788d6e4de8p-2, 0x0.fdc60b9c6ee300p-3, 0x0.8cf3dd77cacc40p-4, -0x0.957a272855fcb0p-4, 0x0.eb1c78f4ae94f8p-4, -0x0.b7d92116eb5490p-5, -0x0.ca99f243bde8a0p-5, 0x0.de2162915ff3b0p-6, -0x0.ed6361ab046c00p-7, 0x0.e29ffa161405b8p-9, 0x0.d38f2583d7afa0p-7, -0x0.b4ce262fae6258p-8, 0x0.86e90e2f2fba08p-12, 0x0.b25aa074568fd8p-12, -0x0.8d1ba3d95d25f8p-9, 0x0.cb206e149097f0p-11, 0x0.9444dc6ebf6df8p-12, -0x0.a06a961f5fe390p-13, 0x0.877df73b96bdb0p-12, -0x0.a794681d9eb388p-14, -0x0.907595d4cc0b60p-14, 0x0.e69ba761ae8148p-16, -0x0.be076107374e98p-16, // x=    0.75 y=     0.5
+ 0x0.b0f9f8805ffd08p-1, 0x0.e054e3f717acc0p-2, -0x0.e2d656d0e68740p-2, 0x0.8f765f5eed7758p-2, -0x0.ef868cb733da18p-5, -0x0.9760eb735dbed8p-2, 0x0.a0c5aaeaa83ad0p-3, 0x0.a20c406b427a80p-6, -0x0.fc47ed4f2bdd10p-6, 0x0.905b8a4dad04f8p-4, -0x0.e01267d9a5f4b0p-6, -0x0.b29f152256d980p-6, 0x0.c2b3391f87c040p-7, -0x0.960c9291a70908p-7, 0x0.a76a464097a768p-9, 0x0.b5d03296e66e40p-8, -0x0.97c7625a4982d8p-9, 0x0.8788f4486dcd18p-11, -0x0.8d1871a575d828p-16, -0x0.e787036050fb08p-11, 0x0.a35a7317207b60p-12, 0x0.e2e5e23c2df2e0p-15, -0x0.9ef99be3364238p-15, 0x0.d6c3409562d360p-14, -0x0.83f9aad6f621a0p-15, -0x0.9a89c1cba729e0p-16, 0x0.fc79160b251100p-18, -0x0.96eca3c27b3f68p-17, // x=    0.75 y=    0.75
+ 0x0.a0084c1f3d46a8p-1, 0x0.aff4ae4b014e78p-2, -0x0.a43682449386d0p-2, 0x0.fec89901a1a7f0p-3, -0x0.844040c63a23b0p-4, -0x0.cd5e3d5d242088p-3, 0x0.cefecfc97520d8p-4, -0x0.ed53d62c748110p-12, -0x0.c7a6cd6bf96fd0p-7, 0x0.b2ad7a530b6230p-5, -0x0.87719404b27340p-6, -0x0.9d56c289847948p-7, 0x0.ad1d4e662e32e8p-8, -0x0.b586f6b0f2e638p-8, 0x0.d4aa1915165878p-10, 0x0.9f4aa7460bb0f8p-9, -0x0.820885cab5b788p-10, 0x0.d019d9d34ad0d8p-12, -0x0.8f7dc5d016a528p-14, -0x0.c19da9eb58faa8p-12, 0x0.857afe7ef945e0p-13, 0x0.aac570bc4e90d0p-21, -0x0.80dd925846ec38p-17, 0x0.abfc0f878751c0p-15, -0x0.d028f972908e30p-17, -0x0.9bdfddbea0c090p-18, 0x0.87eadd4ded2650p-19, -0x0.ec4dfb21ad19b0p-19, // x=    0.75 y=       1
+ 0x0.912137c05f60c8p-1, 0x0.8c9762fed65360p-2, -0x0.f2a7e5c900db00p-3, 0x0.de6c6861466a28p-3, -0x0.f97399af6fc638p-5, -0x0.8e26c55e691678p-3, 0x0.87afd55cc114d0p-4, -0x0.831d49192b16f0p-7, -0x0.8448b34e236c10p-8, 0x0.e025f2b812edb0p-6, -0x0.a47c339715bd88p-7, -0x0.8828e9e8d96a48p-8, 0x0.9b4687f965ee88p-9, -0x0.d8bef58e0afcb8p-9, 0x0.800727d91e7848p-10, 0x0.8dfb6462f010d8p-10, -0x0.e359a8324a00f8p-12, 0x0.85381d3ff0ebe0p-12, -0x0.e71ed32f4a3bc0p-15, -0x0.a5483c92dcac48p-13, 0x0.de648871b125c0p-15, -0x0.8794b429d83c00p-17, -0x0.eb753f47a978b0p-22, 0x0.8bf52b4dfd3228p-16, -0x0.a56e691c7d1550p-18, -0x0.813d2659b37ee8p-20, // x=    0.75 y=    1.25
+ 0x0.842ae5cffbdf40p-1, 0x0.e4717e72c7ff50p-3, -0x0.b6bb6dbad91d10p-3, 0x0.c0f75f48a56160p-3, -0x0.dcd67199931578p-5, -0x0.c8b2bf056fcaa0p-4, 0x0.b542f3aabbe318p-5, -0x0.a4c090a95cff38p-7, -0x0.964bcc13e223e0p-11, 0x0.8ee2d1ba7aa810p-6, -0x0.c9f5331ca516c0p-8, -0x0.e01bbed6082878p-10, 0x0.8b465645f80c68p-10, -0x0.818f2c1306f338p-9, 0x0.975ed3439fd248p-11, 0x0.804b6d9090df80p-11, -0x0.ca8512dd988c78p-13, 0x0.a00099b0a8dca8p-13, -0x0.959394be6033e8p-15, -0x0.9009791af196c0p-14, 0x0.bd21f0fb6a23a0p-16, -0x0.e7cfc92d7bc5c0p-18, 0x0.e5a57cd4046088p-21, 0x0.e84d59060a8550p-18, -0x0.862c1c929760a0p-19, -0x0.af3d9661d96e48p-24, // x=    0.75 y=     1.5
+ 0x0.f1dbd99dffcdf0p-2, 0x0.bc635ca4793090p-3, -0x0.8c0cde4038dab0p-3, 0x0.a74ce5e07b1918p-3, -0x0.bdf106fb9c35c8p-5, -0x0.905d0a20f49900p-4, 0x0.f6b74c2c9e7ad0p-6, -0x0.a12241d69e89e0p-7, 0x0.cf18d96f9258f0p-11, 0x0.b95b767e0ea340p-7, -0x0.fb8a5681932e18p-9, -0x0.a2112ede40d1c0p-11, 0x0.f64768f883f6d8p-12, -0x0.9c39ce586de7f0p-10, 0x0.b29c315124b6b0p-12, 0x0.e9cd0652dd17d8p-13, -0x0.b75fddc2224778p-14, 0x0.bbb8aa93554320p-14, -0x0.b390991fb07330p-16, -0x0.800342ddfe1e90p-15, 0x0.a439b2144af130p-17, -0x0.98247235284058p-18, 0x0.d3c52bd40355f8p-21, 0x0.c4cd10de833ac8p-19, -0x0.ddd97a726b0cb0p-21, 0x0.b5bacffbe1da68p-24, // x=    0.75 y=    1.75
+ 0x0.de5a73077f33d0p-2, 0x0.9d725e249141b8p-3, -0x0.da2d04fda7bbf8p-4, 0x0.9162b1a1964b30p-3, -0x0.a13de9a2969660p-5, -0x0.d3639111ca2f20p-5, 0x0.aafb82da5cc9d0p-6, -0x0.8fd592f8c0b520p-7, 0x0.a066a4ee79f550p-10, 0x0.f4bc38c0c70880p-8, -0x0.9f2a05832b9330p-9, -0x0.959a911793ca78p-13, 0x0.d10f907738ca78p-13, -0x0.bec0ed24b13fe8p-11, 0x0.d41562e13d9148p-13, 0x0.d522b49a00e098p-14, -0x0.a82d66b2b798f8p-15, 0x0.db1713c6d94298p-15, -0x0.d16ee2fdad80e8p-17, -0x0.e7a4289805d5c0p-17, 0x0.917cfdfbe17470p-18, -0x0.b6e6ede4ae95c8p-19, 0x0.8d702a72d1d980p-21, 0x0.aa39d219e9c118p-20, -0x0.bb2e450d3ccb88p-22, 0x0.b427cb5638f198p-24, // x=    0.75 y=       2
+ 0x0.cd5f4195ff7170p-2, 0x0.852bdfe45b1fc0p-3, -0x0.ac79fc209a6c58p-4, 0x0.fdabe2816712c0p-4, -0x0.88341f9043b4d0p-5, -0x0.9d58de59035d38p-5, 0x0.f126b4cac04400p-7, -0x0.f64bd2a18ccd20p-8, 0x0.a55257bf3d9bc0p-10, 0x0.a468b829327000p-8, -0x0.cccabf08c92798p-10, 0x0.db0f7a6484ea08p-15, 0x0.a0b11d49ed1220p-14, -0x0.ec53b460e0b0e0p-12, 0x0.fe8f5cf430a390p-14, 0x0.bffbc2957fa158p-15, -0x0.9b73972e73b170p-16, 0x0.805e17f1c50b58p-15, -0x0.f232eccd096258p-18, -0x0.d4cf5c6a4f4c58p-18, 0x0.83521d24d98b38p-19, -0x0.d467ee308cdf38p-20, 0x0.aa95879b9958c8p-22, 0x0.963f5b18f599b8p-21, -0x0.a136404983ae60p-23, 0x0.f42ce70ca875e8p-25, // x=    0.75 y=    2.25
+ 0x0.be862a012a25c0p-2, 0x0.e3b4fbef8805e0p-4, -0x0.8a34fb5e9ce948p-4, 0x0.de592546f84a20p-4, -0x0.e60128de4e2138p-6, -0x0.eddfa2d5158968p-6, 0x0.ace287bcd4a2b0p-7, -0x0.cea4f39a589cd0p-8, 0x0.960e6cf33b9640p-10, 0x0.e0a997dc05afd8p-9, -0x0.85f5ccc9ba9f28p-10, 0x0.fcedc43f55c158p-14, 0x0.b8a35ea291ac08p-16, -0x0.94ae9e82b3c498p-12, 0x0.9acd96c5b14938p-14, 0x0.a73036ac36a448p-16, -0x0.8fc9f2920c1ca8p-17, 0x0.97cc2f1095d3e0p-16, -0x0.8c4c2e58e6d5f0p-18, -0x0.c5d7efd686fd28p-19, 0x0.f1114408b257e0p-21, -0x0.f3c42ab0e09348p-21, 0x0.c5db7a22f7a5c0p-23, 0x0.866b828c9ddc88p-22, // x=    0.75 y=     2.5
+ 0x0.b17a407c56bbf8p-2, 0x0.c48f526f5cd710p-4, -0x0.e03f52cc129e38p-5, 0x0.c3e0b4d3ee11a8p-4, -0x0.c29d175b195f68p-6, -0x0.b663a68dc98c60p-6, 0x0.fbc44880954bd0p-8, -0x0.abbffbcf529bb0p-8, 0x0.80c1540fac7fd0p-10, 0x0.9c02461ae048b8p-9, -0x0.b2242d2aca4fe0p-11, 0x0.8c33a2d0adafa8p-13, -0x0.93ed0d507617f0p-20, -0x0.be1082e8413428p-13, 0x0.bf04b159029a28p-15, 0x0.86865522070508p-17, -0x0.83a814dc11a588p-18, 0x0.b5a714d5207b80p-17, -0x0.a3c07387f635e8p-19, -0x0.b9449cc70eb5a8p-20, 0x0.e06f512ebae5a8p-22, -0x0.8bd11c3fcfac10p-21, 0x0.e17d89639e6c58p-24, 0x0.f5f7200f19d628p-24, // x=    0.75 y=    2.75
+ 0x0.a5f492ac77f938p-2, 0x0.ab2692346d0648p-4, -0x0.b7fde1df3cd288p-5, 0x0.ad717d8f254bd8p-4, -0x0.a5423e0382ef00p-6, -0x0.8db4bc937a7e98p-6, 0x0.ba02773723c718p-8, -0x0.8e42292c2ce5b8p-8, 0x0.d6e03c4f0220a8p-11, 0x0.dc0a439081d0a0p-10, -0x0.f0aca02c0b0818p-12, 0x0.826a8aaf688378p-13, -0x0.a41f7d8f926e60p-17, -0x0.f6d04886ee9870p-14, 0x0.ef437fc366aae8p-16, 0x0.afe8d20d3effd8p-19, -0x0.ea511901fefe10p-20, 0x0.dc50a285b05160p-18, -0x0.c12a87429cdf58p-20, -0x0.ada258fb6adb10p-21, 0x0.d3407052520bb0p-23, -0x0.a1527128966e38p-22, 0x0.802c0b7d9ad3b8p-24, 0x0.e48dc087677090p-25, // x=    0.75 y=       3
+ 0x0.9bba40616e6dd0p-2, 0x0.96325fed9f6530p-4, -0x0.9887764c222b50p-5, 0x0.9a5a5e1c1ee6f8p-4, -0x0.8cf3009609e360p-6, -0x0.dee6d52e063188p-7, 0x0.8b500e4fb16ff0p-8, -0x0.ebac865fd2d008p-9, 0x0.b0cb4c42e2f410p-11, 0x0.9d75e9b202e8e8p-10, -0x0.a511efd1fb56a8p-12, 0x0.e17863acecf0d8p-14, -0x0.c9b8c62c692f80p-17, -0x0.a2bc9996f56d10p-14, 0x0.981f59d2fff640p-16, 0x0.942aec67756908p-22, -0x0.c375e4b3629958p-21, 0x0.8781f2a2620c48p-18, -0x0.e6b4c65bb63830p-21, -0x0.a1501183bfd528p-22, 0x0.c82db6582fe468p-24, -0x0.bbe25ba94b8a00p-23, 0x0.92564f9da3c958p-25, 0x0.d72859d1495ed0p-26, // x=    0.75 y=    3.25
+ 0x0.929a85151a2890p-2, 0x0.84beb9c4fb3af8p-4, -0x0.ff4b82fe66c110p-6, 0x0.8a0877c5ed2de8p-4, -0x0.f196ebfa330c10p-7, -0x0.b14d9edced21a8p-7, 0x0.d359e192518730p-9, -0x0.c3a1f4b3026690p-9, 0x0.9083e6ffb8a830p-11, 0x0.e47cbfbbdd7710p-11, -0x0.e5bdf5666a05e8p-13, 0x0.bbf4dee88a94d8p-14, -0x0.c1f306a9bbdb38p-17, -0x0.d9d2092d4fc988p-15, 0x0.c4566b30f9de00p-17, -0x0.aeb1b402ca18b8p-21, -0x0.8b6678e9035220p-22, 0x0.a91c87bb8c7a20p-19, -0x0.8b9ee416f53d70p-21, -0x0.923ff21dde7678p-23, 0x0.bdd9f3f1912a28p-25, -0x0.dd53ea420402b8p-24, 0x0.a8736ee833c3a8p-26, 0x0.cc8fd81dd99cd0p-27, // x=    0.75 y=     3.5
+ 0x0.8a6cf169123b38p-2, 0x0.ec27bee9700ee8p-5, -0x0.d782585bb592a0p-6, 0x0.f8069afa486970p-5, -0x0.d013b05a6743b0p-7, -0x0.8e83ed4afe7c70p-7, 0x0.a23c895fc8fb78p-9, -0x0.a2f1d7c3323200p-9, 0x0.ebc29485ab1c68p-12, 0x0.a7f17b4735b648p-11, -0x0.a218dad5e1b058p-13, 0x0.99bd0af1954fe8p-14, -0x0.a9b0c1eb6bbfe0p-17, -0x0.93e06d37aea440p-15, 0x0.808e3531087418p-17, -0x0.fa7677245c57f0p-21, -0x0.dd1614034f1510p-25, 0x0.d61a2ffd454840p-20, -0x0.ab558ae8c33698p-22, -0x0.fb46622acbe780p-25, 0x0.b2b0f4039ffd90p-26, -0x0.840187d496a928p-24, 0x0.c3f250da9ae4f8p-27, 0x0.c3a26d5d2c0fb0p-28, // x=    0.75 y=    3.75
+ 0x0.830fe779179da0p-2, 0x0.d34b6de179b958p-5, -0x0.b760bc363ccbd0p-6, 0x0.dfd0f3028b31a0p-5, -0x0.b41bfc1a109ce0p-7, -0x0.e755f29eb102f8p-8, 0x0.fbd9033fe58ef8p-10, -0x0.88475a989cd080p-9, 0x0.c06aa51b1cced0p-12, 0x0.f9eaf73c869e28p-12, -0x0.e7c035c90379c8p-14, 0x0.f9110acd20d800p-15, -0x0.8dd352e404d4b8p-17, -0x0.cb8defbe40a7d8p-16, 0x0.aabb351942fdd8p-18, -0x0.fb805199e05d10p-21, 0x0.929647d85d5280p-25, 0x0.8975822eadbd88p-20, -0x0.d52e3cd7d1c810p-23, -0x0.bee35138ec43d8p-26, 0x0.a4ab00d3135268p-27, -0x0.9f8a4b594d9fc8p-25, 0x0.e6a13378605e70p-28, 0x0.bb2df81b433ee0p-29, // x=    0.75 y=       4
+ 0x0.f8ceb3bc0165f0p-3, 0x0.be105f8039eed0p-5, -0x0.9d2f4d041dc000p-6, 0x0.cacf66b0a08888p-5, -0x0.9caaefe5e8f9a8p-7, -0x0.bd73070e2a9218p-8, 0x0.c582ed62365a60p-10, -0x0.e4fcf5f7c15de0p-10, 0x0.9d6476bad52fd0p-12, 0x0.bc1949c7897780p-12, -0x0.a7bb2a9eae34d0p-14, 0x0.c8e0992ff524f0p-15, -0x0.e76422f4ac12c0p-18, -0x0.8df0bf8ef13aa0p-16, 0x0.e5d531d0ef5290p-19, -0x0.dfc03d8b336470p-21, 0x0.879c414f238dd8p-24, 0x0.b2f304a04cf270p-21, -0x0.866d762f4a7708p-23, -0x0.c71ffcb4bc1f40p-28, 0x0.8e50970473b680p-28, -0x0.c353e7805c58b0p-26, // x=    0.75 y=    4.25
+ 0x0.ecb78c03f796b8p-3, 0x0.abce0fd98394d0p-5, -0x0.87a582ff87fce0p-6, 0x0.b87ec835c7cd38p-5, -0x0.88eda31d5b1c80p-7, -0x0.9c7200cd3f7cf8p-8, 0x0.9c670f4b4493a0p-10, -0x0.c14ba072f59698p-10, 0x0.812a4aea9a6ad0p-12, 0x0.8f1b11baee23a0p-12, -0x0.f5a68f1f0080b8p-15, 0x0.a1d718f0af7128p-15, -0x0.ba4f676aba0448p-18, -0x0.c86de7a00760a8p-17, 0x0.9cb7959aef56f0p-19, -0x0.bc15127890a7d8p-21, 0x0.902eb3d66695b8p-24, 0x0.ec15ef185b8818p-22, -0x0.abdca7be471da0p-24, 0x0.a34efae90cc550p-30, 0x0.e0e815fed72500p-30, -0x0.f25fe5fddfdbe8p-27, // x=    0.75 y=     4.5
+ 0x0.e1b2c0eb104170p-3, 0x0.9bffc634118338p-5, -0x0.eb95e7c71c2a68p-7, 0x0.a873a1da9e3cc0p-5, -0x0.f0741f777ba200p-8, -0x0.82320ac58d2580p-8, 0x0.f9f27869176c88p-11, -0x0.a3f3200449d8a8p-10, 0x0.d4d4b46c317788p-13, 0x0.dbf786672edd48p-13, -0x0.b5e21a13035910p-15, 0x0.8285918db4d470p-15, -0x0.9504e384f29160p-18, -0x0.8f30f7cd727f98p-17, 0x0.d86422b1a2cc70p-20, -0x0.996b7f06ed8550p-21, 0x0.8317c324a20b48p-24, 0x0.9dbe615583bfd8p-22, -0x0.de9c53f31475d8p-25, 0x0.809668de92e458p-28, 0x0.8597204e833178p-31, -0x0.985c5c17d9e8c8p-27, // x=    0.75 y=    4.75
+ 0x0.d79ed481440718p-3, 0x0.8e3bfdc7c26ef8p-5, -0x0.cdc399254d0158p-7, 0x0.9a559bb3bd74a8p-5, -0x0.d40e545de27198p-8, -0x0.da449cd3d8b4f8p-9, 0x0.c96a369f6f09b8p-11, -0x0.8bb91700362cd0p-10, 0x0.b0190ec2ce5ad0p-13, 0x0.aaac073d501d80p-13, -0x0.881503afcdc898p-15, 0x0.d305acdee96ef8p-16, -0x0.edbc448537a968p-19, -0x0.cee7b9d653daa0p-18, 0x0.972c6aaa504db8p-20, -0x0.f62b77918f3728p-22, 0x0.de4fe671cdc228p-25, 0x0.d569417c8f80b0p-23, -0x0.9201fc77039b00p-25, 0x0.93a97caf6b5918p-28, -0x0.e64fe0db01b4e0p-37, -0x0.c20619a9f860b8p-28, // x=    0.75 y=       5
+ 0x0.ce5f4e961b8ba8p-3, 0x0.822e14bc7c25e0p-5, -0x0.b4af1cc228ea38p-7, 0x0.8ddbc904bd2258p-5, -0x0.bbcc9ca3e51708p-8, -0x0.b8315fbbaa92c0p-9, 0x0.a3985c3ca9e740p-11, -0x0.ef44c1b9fb25d8p-11, 0x0.925c0644dc5638p-13, 0x0.859d7156a8f800p-13, -0x0.cda57729c85698p-16, 0x0.ab2206864f5758p-16, -0x0.bd96bcdfbfc7f8p-19, -0x0.97153fe0490510p-18, 0x0.d59f09f7b9a450p-21, -0x0.c3b8b20c1b7440p-22, 0x0.b5bdb332a1a430p-25, 0x0.9213c5f8698d20p-23, -0x0.c1e1824c0cf2f8p-26, 0x0.8a07807338eb78p-28, -0x0.e05ebac464e3d0p-33, -0x0.fa2d60ae9f7ec0p-29, // x=    0.75 y=    5.25
+ 0x0.c5dbde8d529db0p-3, 0x0.ef233485dc90c0p-6, -0x0.9f7439b1268678p-7, 0x0.82c9b3b8902390p-5, -0x0.a6fbd542fa09b8p-8, -0x0.9c6a6634e3a688p-9, 0x0.85dda2d6285150p-11, -0x0.cdcd5d18a59bf8p-11, 0x0.f4663fc725f0d8p-14, 0x0.d2fa5951f202f0p-14, -0x0.9cd6f350ce7670p-16, 0x0.8b4dec953b7ca8p-16, -0x0.9766e92c77e0f8p-19, -0x0.dee149b1130d80p-19, 0x0.989071afd4c5a0p-21, -0x0.9aec540df1c858p-22, 0x0.91924e8756f4e8p-25, 0x0.ca3fd76b9f2030p-24, -0x0.823ecf6e5e2c78p-26, 0x0.ecd64514c450a8p-29, -0x0.8baa34209df338p-32, -0x0.a33fa6e2d4a070p-29, // x=    0.75 y=     5.5
+ 0x0.bdffa7864e05c8p-3, 0x0.dc5d8fff8d9ad0p-6, -0x0.8d5f9abb08ec00p-7, 0x0.f1da01ba8fc608p-6, -0x0.950a79623e6df8p-8, -0x0.859bd7eb0996e8p-9, 0x0.dc9b8f112dd270p-12, -0x0.b1cc51b69600a0p-11, 0x0.ccfd71a6f880a8p-14, 0x0.a7e4cba5cb7110p-14, -0x0.f1590a82540ba8p-17, 0x0.e3b798fbbed528p-17, -0x0.f26803598fc8f8p-20, -0x0.a5fa870e992fe0p-19, 0x0.dc28b4d2e252b8p-22, -0x0.f4e2ed3fc005a8p-23, 0x0.e6874afcba5bc8p-26, 0x0.8d882f0ced1238p-24, -0x0.b0f9f06ef46cd0p-27, 0x0.c273d5f10218f8p-29, -0x0.85fec4f121e4d0p-32, -0x0.d78ba8e58913b0p-30, // x=    0.75 y=    5.75
+ 0x0.b6b8ae473230e0p-3, 0x0.cbafab48c37d00p-6, -0x0.fbc656a58fc4e8p-8, 0x0.e0371e09e0e348p-6, -0x0.8581dd23628f68p-8, -0x0.e5830e3e41e5e0p-10, 0x0.b6f86e37611170p-12, -0x0.9a420db0dd17c0p-11, 0x0.acb6941e3f4478p-14, 0x0.869c5bb6af8618p-14, -0x0.bb3f4f1cd0a0e8p-17, 0x0.baeaa02c29cc88p-17, -0x0.c2ab11cb059b90p-20, -0x0.f9766370940710p-20, 0x0.a0680419a8e4f0p-22, -0x0.c19f1e230042b8p-23, 0x0.b567ceba8f6990p-26, 0x0.c823ea3c18ba30p-25, -0x0.f3167fea8f7dd0p-28, 0x0.9bc659a2533ec8p-29, -0x0.e8559118e94b10p-33, -0x0.8fe7430f6de5a8p-30, // x=    0.75 y=       6
+ 0x0.aff7621f0c4d48p-3, 0x0.bccdda641a9d18p-6, -0x0.e11af4d9639c60p-8, 0x0.d063ea7c585690p-6, -0x0.f001a4810bc268p-9, -0x0.c62515671279b8p-10, 0x0.98b0c790cdf4d0p-12, -0x0.8661af7d5469e0p-11, 0x0.9229efd76b27c8p-14, 0x0.d96141f1f21280p-15, -0x0.926c2c8e5d3088p-17, 0x0.9a1846a4cb1618p-17, -0x0.9ce58e63e48660p-20, -0x0.bd171973bb4518p-20, 0x0.ebeb6533508f00p-23, -0x0.99582b31f8a720p-23, 0x0.8e58c157ec5cb8p-26, 0x0.8ee92563155ae0p-25, -0x0.a8afc0016f83f8p-28, 0x0.f610b922548990p-30, -0x0.bf741db334aa38p-33, -0x0.c23b415dd67138p-31, // x=    0.75 y=    6.25
+ 0x0.a9ae3b5d737810p-3, 0x0.af792d6a312748p-6, -0x0.ca069575152280p-8, 0x0.c2249cdec7f7a0p-6, -0x0.d86ed7b092c388p-9, -0x0.abe4f23351ed30p-10, 0x0.802971e3919ed0p-12, -0x0.eb0cd59ffdc980p-12, 0x0.f875ca66155cc8p-15, 0x0.b0b1c4d683c3c0p-15, -0x0.e6b61a1bcd8468p-18, 0x0.ff2f3f99645808p-18, -0x0.fde53d5a11a7b8p-21, -0x0.90816c80f20e98p-20, 0x0.af07740c584d18p-23, -0x0.f381c9202101f0p-24, 0x0.df42005205ef30p-27, 0x0.ce05613e6b8348p-26, -0x0.ec72b5150d4ac8p-29, 0x0.c0c9eb921d4a40p-30, -0x0.995c5471ceec30p-33, -0x0.847261f16d5e80p-31, // x=    0.75 y=     6.5
+ 0x0.a3d16b1e5d21c0p-3, 0x0.a37cfb4ecdab10p-6, -0x0.b5f570b62fa0c0p-8, 0x0.b54682348149b8p-6, -0x0.c3c74910ae3ed8p-9, -0x0.95cd3839cef250p-10, 0x0.d853562d58bd78p-13, -0x0.ce5663d5b454d8p-12, 0x0.d40f91d18f1008p-15, 0x0.90880019623008p-15, -0x0.b70cb1f8990498p-18, 0x0.d436a6b0c6de28p-18, -0x0.ce4495fcd62970p-21, -0x0.de96c48b3b0618p-21, 0x0.82f35fbd175b18p-23, -0x0.c1f1a1389847b8p-24, 0x0.af3bd9cd278e10p-27, 0x0.95d739ebd127a8p-26, -0x0.a6f941b1fb9368p-29, 0x0.9713012fe56f18p-30, // x=    0.75 y=    6.75
+ 0x0.906a8e21e05730p-1, 0x0.96cd59c6565f28p0, -0x0.a277dfe61c6228p0, -0x0.c9c253e8627db0p-2, 0x0.dd2329a3df8ed0p-1, -0x0.bc1d6459f55b70p-1, 0x0.cb15d7dfa4bb28p-3, 0x0.d056d1e6446288p-1, -0x0.8b20a72d726e50p-1, -0x0.b9111f24304768p-4, 0x0.a93209c3f62f30p-3, -0x0.91d9ee05cf9b78p-2, 0x0.f41c36c50a3b10p-4, 0x0.8c3ba2532f5840p-3, -0x0.af25a8a0bac9b8p-4, 0x0.99132fe73ebe40p-5, -0x0.bc488ec2227a88p-8, -0x0.b748fbf6cd2228p-5, 0x0.a773b492616e18p-6, 0x0.bcd1f255a6e3d8p-9, -0x0.e1d8b7a26739c0p-9, 0x0.87fd0121e84b48p-7, -0x0.c51b8b6817b078p-9, -0x0.90a9ee637476e0p-9, 0x0.9016b0558aa868p-10, -0x0.fb59d8e923b1d8p-11, 0x0.8447b066d41750p-12, 0x0.e15754c84fd8c8p-12, -0x0.d7387987dd8700p-14, 0x0.b2ba37f5091688p-15, // x=       1 y=       0
+ 0x0.9fd9671bba00b0p-1, 0x0.cb4e9d51461be8p-1, -0x0.cf2e32016dec98p-1, 0x0.cdf579545c9a10p-10, 0x0.92c25e5942f5b0p-2, -0x0.fc224949f8ae98p-2, 0x0.ce467dd8ef0478p-3, 0x0.97dfd11046dd30p-2, -0x0.cdd616bd2ed538p-3, 0x0.aa6519fbf09470p-5, 0x0.840c46f1a712a0p-6, -0x0.db963a53930e00p-4, 0x0.c2caed1a0a5460p-5, 0x0.c74712a1dae528p-6, -0x0.8d99c61faa90c8p-6, 0x0.91295c2650c618p-6, -0x0.afd958c26ec878p-8, -0x0.9abdf800333b40p-7, 0x0.900a07a00de4d0p-8, -0x0.94078f65d3a310p-10, -0x0.eea70c402afd70p-22, 0x0.edaea26ad0df10p-10, -0x0.b11333c73224b8p-11, -0x0.ad933c235ca6c8p-13, 0x0.f41056669acb00p-14, -0x0.f0179e5a822ea0p-13, 0x0.93fdc19d697800p-14, 0x0.f4d9bdcf8e54d0p-15, -0x0.d00bca86f9bbe0p-16, 0x0.a23edecd45d670p-16, // x=       1 y=    0.25
+ 0x0.9c2c0a54f1bc60p-1, 0x0.9ea136ed816208p-1, -0x0.991992963e2d48p-1, 0x0.ccc90c3e112c90p-4, 0x0.8041be23b63830p-3, -0x0.b77b0210a9e010p-2, 0x0.9f2c613d4f93e8p-3, 0x0.9984c52017d478p-3, -0x0.d360b054a0d8e8p-4, 0x0.bd89d32dce6b78p-5, -0x0.886c40ba41ec80p-8, -0x0.e13bb5773f6430p-5, 0x0.c8c78590cf90a8p-6, 0x0.c6af7abc035a60p-8, -0x0.b7affa2bcff218p-8, 0x0.99c559ad0fb5f8p-7, -0x0.ca20b659319e08p-9, -0x0.d6eec40fcf03e0p-9, 0x0.cca35752300e58p-10, -0x0.db83dc7a153250p-11, 0x0.a8b5ab327358a8p-13, 0x0.aa2ce035325c38p-11, -0x0.fece9827515bc8p-13, 0x0.9ef5f9fa696550p-20, 0x0.9e5468a20a5898p-16, -0x0.ae468c57fbb3e8p-14, 0x0.da4362a514ee08p-16, 0x0.cff99fe5cac340p-17, // x=       1 y=     0.5
+ 0x0.9446fd13e0be68p-1, 0x0.fb05fd0c28d128p-2, -0x0.e3f4f8042beac0p-2, 0x0.8f5fc9df70d4a0p-3, 0x0.b4fc29758a42c0p-5, -0x0.8435859631db58p-2, 0x0.e7872375ecee88p-4, 0x0.98aca22bb6cdb8p-4, -0x0.d95f0eb92fb968p-5, 0x0.9a7da0e06a75c0p-5, -0x0.855575bea56128p-7, -0x0.e729238e495868p-6, 0x0.ccfc2060d3af50p-7, 0x0.c8b37add3cc520p-12, -0x0.d1cc0e71e20598p-10, 0x0.9da8c68c836490p-8, -0x0.d5032ef5070e30p-10, -0x0.900473e18a0cd8p-10, 0x0.8fbe1adc40ef18p-11, -0x0.fadf62934dd658p-12, 0x0.f74b927e000300p-14, 0x0.f2b28d7fac8120p-13, -0x0.b6702156298138p-14, 0x0.af4ca1271272f8p-16, -0x0.9da2050e4a90d8p-22, -0x0.fa09bad9746b20p-16, 0x0.9d86fee649e098p-17, 0x0.8510d7381c10d8p-19, // x=       1 y=    0.75
+ 0x0.8adc644a02d480p-1, 0x0.c976d4eed5cbe0p-2, -0x0.ab946433abb188p-2, 0x0.9a9563547228a0p-3, 0x0.908c0166ed6550p-8, -0x0.bec7d82869b608p-3, 0x0.a4996191ad7cf0p-4, 0x0.92915f76667438p-5, -0x0.df87104f70c2f8p-6, 0x0.e3e2b9b4ad3c78p-6, -0x0.f0e404d020ac18p-8, -0x0.ee6e4acbc0ccd8p-7, 0x0.d18c34c9d923b0p-8, -0x0.8ac2f6d356a5b8p-10, -0x0.9addedae3b3830p-12, 0x0.a01588ed900c00p-9, -0x0.d938fa1b216a10p-11, -0x0.b1df1268bb3758p-12, 0x0.c51dd9b050b558p-13, -0x0.8383ce48e54568p-12, 0x0.8c7d9f997284f8p-14, 0x0.abf4ab892af470p-14, -0x0.827baed938a3b0p-15, 0x0.fde637cbfa54f8p-17, -0x0.a764e3ea11d628p-19, -0x0.b303fcd6a44f78p-17, 0x0.e17a057670bf60p-19, -0x0.d7d15d191bf588p-25, // x=       1 y=       1
+ 0x0.813f7b3e8fb7e8p-1, 0x0.a3f0b7a9548e08p-2, -0x0.82c7b187de3500p-2, 0x0.977621f7245080p-3, -0x0.e7a2ed4b8f9a68p-7, -0x0.8aa12d530ee4e0p-3, 0x0.e89dee77956ba0p-5, 0x0.82265ce4398148p-6, -0x0.e49d222d7954b0p-7, 0x0.a175f9276dddc8p-6, -0x0.b7686b65861de8p-8, -0x0.f764e2b5481f68p-8, 0x0.d798ae4d318200p-9, -0x0.99c917dddd39b0p-10, 0x0.a9878287e12d88p-14, 0x0.a2c51d3d72e278p-10, -0x0.db4ddb8b520228p-12, -0x0.af9936b919aca8p-14, 0x0.fff24b46383dd8p-15, -0x0.8566489edb86e8p-13, 0x0.928ed46aab7418p-15, 0x0.efd27fa793c678p-16, -0x0.ba2f6bfaff8980p-17, 0x0.8f64469631b1e8p-17, -0x0.ef1cb17c22d060p-20, -0x0.ff7f5e81937200p-19, // x=       1 y=    1.25
+ 0x0.f01e472cfc6700p-2, 0x0.8728ef1ae01500p-2, -0x0.c9fe2e1bbf4718p-3, 0x0.8deea583f4ba78p-3, -0x0.b2d66c229f7820p-6, -0x0.cb829afa395078p-4, 0x0.a4c5e90e285c80p-5, 0x0.bd32a2a6fdef20p-8, -0x0.e6149c52c85d90p-8, 0x0.e150f8bbeabc90p-7, -0x0.82d39347016cc0p-8, -0x0.80e954e94b02f8p-8, 0x0.dfb4a00a008c00p-10, -0x0.f809b1a5855c70p-11, 0x0.a03e387b31f408p-13, 0x0.a6a79448f476e8p-11, -0x0.ddaa6ef7793640p-13, -0x0.918375e5cf2b88p-18, 0x0.91508937487c78p-16, -0x0.85e8aa7bfd5f38p-14, 0x0.93e2f35c1d1388p-16, 0x0.a121155185c450p-17, -0x0.8381e13dcbcf28p-18, 0x0.94d79ed8491f50p-18, -0x0.8656817d6f50f0p-20, -0x0.b723906ee50a48p-20, // x=       1 y=     1.5
+ 0x0.df1bf7e1f33510p-2, 0x0.e196bfe6312700p-3, -0x0.9e088bd98e1c90p-3, 0x0.8206b53cbf10e0p-3, -0x0.c50df4ea025310p-6, -0x0.971c8b253b48d8p-4, 0x0.eb13ff284f3fe0p-6, 0x0.c5bef4b1e265e0p-11, -0x0.df496733aa41a0p-9, 0x0.9cb8f78f179db8p-7, -0x0.b59a74fc7f3c48p-9, -0x0.8668fbdfc87f48p-9, 0x0.ea186e10162968p-11, -0x0.b43adf5efa8468p-11, 0x0.8efff3c26b5b98p-13, 0x0.ac44c717682560p-12, -0x0.e19fdfe53e4f68p-14, 0x0.8261aa59cf7230p-16, 0x0.cdd0b29e7d8078p-19, -0x0.86883e075c38e8p-15, 0x0.939f525dd485a8p-17, 0x0.c68515841e4fc8p-19, -0x0.b51dec4ceac7b8p-20, 0x0.956ec2b9f6d948p-19, -0x0.8acaf364a3fea8p-21, -0x0.828a450356dc40p-21, // x=       1 y=    1.75
+ 0x0.cfa0389d415170p-2, 0x0.be6117f750af30p-3, -0x0.fa68b1d11e0bf8p-4, 0x0.eb7ea1f859f058p-4, -0x0.c17808e8116620p-6, -0x0.e32458934d66a0p-5, 0x0.a94a3b3a573470p-6, -0x0.d311e708dc0f20p-10, -0x0.c81ed345ef7410p-10, 0x0.dac46b1281f460p-8, -0x0.f997c98a34da40p-10, -0x0.8b4030bbe6de80p-10, 0x0.f6ac3ded68d848p-12, -0x0.fab3e196a72308p-12, 0x0.d6ff014308df80p-14, 0x0.b3ec10a314f5e0p-13, -0x0.e7f24924f72c70p-15, 0x0.8d1e7ed07f00d0p-16, -0x0.87ece6e2860680p-20, -0x0.881491c28c69f0p-16, 0x0.936c08a221f590p-18, 0x0.c02561914f9fa0p-21, -0x0.eb3f3a746bf1b0p-22, 0x0.945b71a8036e20p-20, -0x0.8aa9ab081d36f8p-22, -0x0.b6e270609ab450p-23, // x=       1 y=       2
+ 0x0.c1a5d168c571d8p-2, 0x0.a2524ec7c5b3a0p-3, -0x0.c8c670451ad600p-4, 0x0.d41662f8fa51d0p-4, -0x0.b40b7118145120p-6, -0x0.accd04870a8e18p-5, 0x0.f67663bd6ac3d0p-7, -0x0.aa5b1b3a06d2c0p-9, -0x0.92a3317b0c36b0p-11, 0x0.99c484e29ff6a0p-8, -0x0.ab5e8e454a85a0p-10, -0x0.8db043d13bd948p-11, 0x0.8278e059590f20p-12, -0x0.ab287a00694fa8p-12, 0x0.9714b1477799c0p-14, 0x0.bdc7fb6fdce130p-14, -0x0.f11f9727aa8498p-16, 0x0.e09fd1818e5a28p-17, -0x0.ebcd0aee54d3f0p-20, -0x0.8b062dcb07d678p-17, 0x0.942de3756cd560p-19, 0x0.b658d657107d98p-26, -0x0.827114faaed160p-23, 0x0.9331337fa39ef8p-21, // x=       1 y=    2.25
+ 0x0.b512ea57eef2e8p-2, 0x0.8bb394be4d9d98p-3, -0x0.a2cca349379368p-4, 0x0.bea1f9b3a43b20p-4, -0x0.a2f108d738aa50p-6, -0x0.85086b8d043580p-5, 0x0.b57203438a9c98p-7, -0x0.bd4148970e7280p-9, -0x0.9c42682ac770f8p-14, 0x0.da21841a82f420p-9, -0x0.ec4f9431b899c0p-11, -0x0.8aa31e57278b30p-12, 0x0.89e4fa8e854c80p-13, -0x0.e84c8dc8c339d8p-13, 0x0.ce169592213370p-15, 0x0.c9df3077766168p-15, -0x0.fd8338247f8500p-17, 0x0.a11bec2b997bb8p-17, -0x0.cea63cb31cf818p-20, -0x0.8fabed1c037e40p-18, 0x0.9667e9a74207e0p-20, -0x0.9fd63e41da8a88p-23, -0x0.a8ca2fb553de20p-26, 0x0.92fa7ac88188f8p-22, // x=       1 y=     2.5
+ 0x0.a9c5cfa4eb3068p-2, 0x0.f287ecc99a0f28p-4, -0x0.8566bb450edc60p-4, 0x0.ab5fd3abdf71f0p-4, -0x0.9140ad5f668878p-6, -0x0.cf318211aad6f8p-6, 0x0.871c783baf81e0p-7, -0x0.b99e34dc799e68p-9, 0x0.a2f3afa615e1b8p-13, 0x0.9c4b52ab7ecfe8p-9, -0x0.a41722923217e0p-11, -0x0.f98415d07ea7d0p-14, 0x0.90845db560f080p-14, -0x0.9dc59af5d880e8p-13, 0x0.8ad4894af6ad80p-15, 0x0.d804bc8b098cb0p-16, -0x0.86b0e9bf519878p-17, 0x0.dce177cbf1d190p-18, -0x0.9961c22d7d4d88p-20, -0x0.9642df8deeebc0p-19, 0x0.9a6eb0e49b25b0p-21, -0x0.a7244392e834d8p-23, 0x0.9b254916922788p-27, 0x0.942b1187b1e568p-23, // x=       1 y=    2.75
+ 0x0.9f9b5de66c3918p-2, 0x0.d42c0abf944808p-4, -0x0.dcc613d8de7fa0p-5, 0x0.9a480c92fc3768p-4, -0x0.807394917e3e10p-6, -0x0.a31e6788517ba0p-6, 0x0.cb7dc8c92107d0p-8, -0x0.abc4483f8e5958p-9, 0x0.83f0fc032ee798p-12, 0x0.e25de6a0fd92a8p-10, -0x0.e5e25bb08109b0p-12, -0x0.b5ddfe061acef8p-15, 0x0.945d3517fa77d0p-15, -0x0.d756b05a167278p-14, 0x0.ba74afd55b6580p-16, 0x0.e7b44e9d842b08p-17, -0x0.9073d83a4d33e8p-18, 0x0.9458afd36526e8p-18, -0x0.d4db020ea389d0p-21, -0x0.9f01b6b0171ae8p-20, 0x0.a08423bb8890f8p-22, -0x0.83114918e0ec10p-23, 0x0.ecfa746c754ac0p-27, 0x0.971318feaef470p-24, // x=       1 y=       3
+ 0x0.967214b40ee0c8p-2, 0x0.baf035a0606940p-4, -0x0.b85aa0b3f64170p-5, 0x0.8b32a89c30cae8p-4, -0x0.e252fadee28c18p-7, -0x0.81c110819efc70p-6, 0x0.9aeb922a33a4c0p-8, -0x0.9a1cd8246011f8p-9, 0x0.9262248748ec00p-12, 0x0.a5b2dc990747d0p-10, -0x0.a296c3dd69b0f8p-12, -0x0.adbc489e642700p-18, 0x0.91f58a9d0c1090p-16, -0x0.940112c2c68740p-14, 0x0.faf3274744b6c8p-17, 0x0.f7d15e6d69f100p-18, -0x0.9c0b34edf8f820p-19, 0x0.c5ae280617a8c0p-19, -0x0.8f2e499b1df660p-21, -0x0.aa1cc9fa859840p-21, 0x0.a8e623148b5be8p-23, -0x0.b9c6c840c5eeb8p-24, 0x0.ca64a8742590f8p-27, 0x0.9bef6085bbf258p-25, // x=       1 y=    3.25
+ 0x0.8e2b67640b3498p-2, 0x0.a5c79b3f3f0d30p-4, -0x0.9b3ef9f3b77398p-5, 0x0.fbd6f93e1133d8p-5, -0x0.c72469b4b39b28p-7, -0x0.d073134361c6a0p-7, 0x0.ee5f42650e7828p-9, -0x0.87e6804e74a448p-9, 0x0.8f0bac12de40f0p-12, 0x0.f52c996eeb8dc8p-11, -0x0.e84fe37acd10f8p-13, 0x0.d9de12af3d4708p-17, 0x0.834f2aab404528p-17, -0x0.cd2de33e7eb780p-15, 0x0.a9c35dec7dc2e8p-17, 0x0.831c409d738dc0p-18, -0x0.a94f60b2a98758p-20, 0x0.83936fab1094b0p-19, -0x0.bdf5c3e70267f0p-22, -0x0.b7c406a58251c8p-22, 0x0.b3d5d8f9b31378p-24, -0x0.fba087abc652f8p-25, 0x0.940c2029914bc8p-27, 0x0.a2f91cc5c2a760p-26, // x=       1 y=     3.5
+ 0x0.86ac25e26978d8p-2, 0x0.93e4a51457ca98p-4, -0x0.83c2ab3019bad0p-5, 0x0.e4788cd42085e8p-5, -0x0.af4c331cc336e0p-7, -0x0.a8fa44f3c1dff0p-7, 0x0.b93c482b336338p-9, -0x0.ed5ca8f9bd7b98p-10, 0x0.83a5cf7a503290p-12, 0x0.b747366835c310p-11, -0x0.a7aa50e2dc45e0p-13, 0x0.ac65bcdcffa220p-16, 0x0.bc704b22d2b6b8p-19, -0x0.8f8993abcbb928p-15, 0x0.e752e01bf71ca0p-18, 0x0.87833d9b8d1300p-19, -0x0.b7ce15e20c2f38p-21, 0x0.afb19f4feb1758p-20, -0x0.fad3c6ff25f468p-23, -0x0.c81a42c7cfc988p-23, 0x0.c19a2ab06e6de0p-25, -0x0.a6c8e71e8e3078p-25, 0x0.caf1e0c2f37bb0p-28, 0x0.ac6e9982a39e58p-27, // x=       1 y=    3.75
+ 0x0.ffb8e4b5ae2958p-3, 0x0.84a877599f8958p-4, -0x0.e148b238ae33b8p-6, 0x0.cfe30c06759bd0p-5, -0x0.9a8873f0c61688p-7, -0x0.8a29b296705d38p-7, 0x0.915265df1f3c98p-9, -0x0.ce3784fccfd0c8p-10, 0x0.ea94d6f548f210p-13, 0x0.8a6441df2a0868p-11, -0x0.f47940b5e614e0p-14, 0x0.bdd6827994a6d8p-16, 0x0.8bfb232da1c180p-22, -0x0.cac2f655e43c80p-16, 0x0.9ee7d516b470e0p-18, 0x0.85b2c0d94612a0p-20, -0x0.c6900e28217ae0p-22, 0x0.ebea34d26428d8p-21, -0x0.a5ab859006fdd8p-23, -0x0.db33d95698e710p-24, 0x0.d1bdd85ca5f188p-26, -0x0.db7b9812d09bf8p-26, // x=       1 y=       4
+ 0x0.f34f03d674a268p-3, 0x0.ef2e3721759570p-5, -0x0.c1e5804aa9b418p-6, 0x0.bdb91e27fc15e0p-5, -0x0.88844d0390d238p-7, -0x0.e3c38358efa0c8p-8, 0x0.e6162a2435f920p-10, -0x0.b2be49a1aa9a20p-10, 0x0.cd23da420044a0p-13, 0x0.d3064fb6634ba0p-12, -0x0.b401f0f310b6e8p-14, 0x0.b87d95d30cf168p-16, -0x0.ff5c43e0f6dc88p-21, -0x0.909ac3c93901f8p-16, 0x0.dc420cce6e7f40p-19, 0x0.ef9480110b6bc0p-22, -0x0.d3b76e42107938p-23, 0x0.9f840d2cd3e218p-21, -0x0.dbb6292c5f6f38p-24, -0x0.f0b66a37928ae0p-25, 0x0.e5e29170e8b420p-27, -0x0.8fba9a8d61c4c8p-26, // x=       1 y=    4.25
+ 0x0.e7f6922b0fac50p-3, 0x0.d89ddbf9f95730p-5, -0x0.a7ede176955118p-6, 0x0.ada8515981edf8p-5, -0x0.f1d00cdc8e3848p-8, -0x0.bd28f0e391baf0p-8, 0x0.b7b5f08fddf270p-10, -0x0.9adb562a9a03f8p-10, 0x0.b174592d5cd9e0p-13, 0x0.a26217c9a27980p-12, -0x0.85d270a090c360p-14, 0x0.a8d9312a399c28p-16, -0x0.c2bc3bf408f318p-20, -0x0.d040758ba0ac48p-17, 0x0.9a0d89cbf009c0p-19, 0x0.a7a362f014ce60p-23, -0x0.dbde4f6ee90268p-24, 0x0.d9732f0e0bbf78p-22, -0x0.9289ecb0972f80p-24, -0x0.83ffd99e7c3840p-25, 0x0.fd99040ecef7a8p-28, -0x0.bc97631cf1b7f8p-27, // x=       1 y=     4.5
+ 0x0.dd904952d1d108p-3, 0x0.c504afbfc542f8p-5, -0x0.9249c4b73a1888p-6, 0x0.9f68e977c42bd8p-5, -0x0.d6c1a3e2d204b8p-8, -0x0.9e37373f22c3d0p-8, 0x0.93df4fc0c86970p-10, -0x0.8643270e468008p-10, 0x0.988fddb33c7c90p-13, 0x0.fc1f1083243ff8p-13, -0x0.c8d4a4b3fdd358p-15, 0x0.9582f6a9035780p-16, -0x0.d40ad861ef6300p-20, -0x0.9761b7d35bca30p-17, 0x0.d97f5626399588p-20, 0x0.90b08f7abb2ea0p-27, -0x0.d90c9be308b888p-25, 0x0.957b3d1eedd5f8p-22, -0x0.c4da70bd75e6a8p-25, -0x0.8fc5de61ac0488p-26, 0x0.8c7355a82c1928p-28, -0x0.f88c305acb0a00p-28, // x=       1 y=    4.75
+ 0x0.d4010e739f7da0p-3, 0x0.b3e659d007e928p-5, -0x0.8020d2f894a980p-6, 0x0.92bd05ec99ef50p-5, -0x0.bf482630ab65b8p-8, -0x0.85371ee9c12060p-8, 0x0.efdfd79073a528p-11, -0x0.e92cda177efb88p-11, 0x0.82bf0294dd0c30p-13, 0x0.c56077c84d8d90p-13, -0x0.980c920aa974c0p-15, 0x0.81d9746bc3c180p-16, -0x0.ccb1d2357049e8p-20, -0x0.de1f60688365f0p-18, 0x0.9af44a3372e2b8p-20, -0x0.847a81511a0fc0p-24, -0x0.c102f1e4e7e200p-26, 0x0.cf540497c422a8p-23, -0x0.8541e217b733f0p-25, -0x0.9a351abf346948p-27, 0x0.9bba179ff5ba70p-29, -0x0.a4c4e4434ffa60p-28, // x=       1 y=       5
+ 0x0.cb315d26e73438p-3, 0x0.a4de6bfb685818p-5, -0x0.e194f63dfc8bf0p-7, 0x0.876f8806b64e68p-5, -0x0.aae0a1b0cf20f8p-8, -0x0.e1bba1faa14448p-9, 0x0.c3f7505c5910a8p-11, -0x0.cae7000ca24540p-11, 0x0.dfd4cb6ab30cd0p-14, 0x0.9bc23010b93c60p-13, -0x0.e83704d7ef4a78p-16, 0x0.def0fc6c70d210p-17, -0x0.ba48b4788f8110p-20, -0x0.a46c70a286a338p-18, 0x0.decce8b650dc78p-21, -0x0.c1978772012f90p-24, -0x0.826da4848cc9d8p-27, 0x0.910f462d9d1d88p-23, -0x0.b5e7c50f05de90p-26, -0x0.a0a092cf0c42d0p-28, 0x0.ac1eb4138c55b8p-30, -0x0.dbff9205e0e778p-29, // x=       1 y=    5.25
+ 0x0.c30cc47cb61858p-3, 0x0.979b2d93d33ed0p-5, -0x0.c7849e8d796140p-7, 0x0.faa5e019328b78p-6, -0x0.9919f8a180ae08p-8, -0x0.c05fcab0cfc7f0p-9, 0x0.a1303951e60d40p-11, -0x0.b0fd7f1a07e680p-11, 0x0.bf9e6675d912f8p-14, 0x0.f7b45d4f671ee8p-14, -0x0.b2c8b4bb50c6e8p-16, 0x0.be1364cccbdb60p-17, -0x0.a406bacb1260b0p-20, -0x0.f5890e3244fd98p-19, 0x0.a199b1697d9388p-21, -0x0.d004480d5902f0p-24, -0x0.9ab2193fa7cc50p-37, 0x0.ccc85fb44216f8p-24, -0x0.fa6b57078d4e18p-27, -0x0.9e56a411403b58p-29, 0x0.bc85e7638810c0p-31, -0x0.93fee250a05b90p-29, // x=       1 y=     5.5
+ 0x0.bb8175bd008478p-3, 0x0.8bd9a6f0f4e038p-5, -0x0.b13ee8571d76a8p-7, 0x0.e8809667ef1ef8p-6, -0x0.89935e519aec28p-8, -0x0.a4d964b781b5d8p-9, 0x0.85700fa540fee8p-11, -0x0.9acc2485c738a8p-11, 0x0.a4362983ef84b8p-14, 0x0.c6638026a3f018p-14, -0x0.8abaf7f8a7bee0p-16, 0x0.a1700058621c48p-17, -0x0.8d9c4b1c4495b8p-20, -0x0.b8dc2a93057c58p-19, 0x0.ec72b0cc6c0318p-22, -0x0.c75436af226e28p-24, 0x0.f59006fd050788p-29, 0x0.91cf0da5966858p-24, -0x0.add79b89992278p-27, -0x0.8b4cfbdfb75288p-30, 0x0.caccd53271a690p-32, -0x0.c8b6d4c0924e78p-30, // x=       1 y=    5.75
+ 0x0.b47fe372012b30p-3, 0x0.816299d7984148p-5, -0x0.9e1c89c4059348p-7, 0x0.d82c7b1bce0630p-6, -0x0.f7f4e03bc28670p-9, -0x0.8dfec23139b3a0p-9, 0x0.de469f7453cf20p-12, -0x0.87c3ad42bf8128p-11, 0x0.8cf50813181288p-14, 0x0.9ffb8d6ef5f8a0p-14, -0x0.d8eadb96d12c28p-17, 0x0.88deb80d6cca10p-17, -0x0.f194b6a06a8ac8p-21, -0x0.8c4b4cb8b4e6d8p-19, 0x0.ae6dcdef859598p-22, -0x0.b45f8821fc6c70p-24, 0x0.abba31ddc9a320p-28, 0x0.d169370a956858p-25, -0x0.f36a9de83d8ac0p-28, -0x0.b3ea5fa5c33748p-32, 0x0.d313b716e299a8p-33, -0x0.8938a50e5e9768p-30, // x=       1 y=       6
+ 0x0.adfa6edbef08f0p-3, 0x0.f0105508d6c1a8p-6, -0x0.8d971e8c38f7b8p-7, 0x0.c97056154cef60p-6, -0x0.e01287466e32c8p-9, -0x0.f5d0481d7b95f0p-10, 0x0.ba3242b61f8620p-12, -0x0.eed233d9bd1088p-12, 0x0.f27e9269e37570p-15, 0x0.81da6303b3e588p-14, -0x0.aaccdff495f7e8p-17, 0x0.e7fdeed4e597c8p-18, -0x0.cc8cc24de8f958p-21, -0x0.d694f1f9f31370p-20, 0x0.81b796e78dd490p-22, -0x0.9dfdb905471658p-24, 0x0.b5e9f1e66a8260p-28, 0x0.97a15e45d19898p-25, -0x0.abd8f061825698p-28, 0x0.c4db2b87025d40p-36, 0x0.ce9575de6c6c58p-34, -0x0.bd2c3df865ede8p-31, // x=       1 y=    6.25
+ 0x0.a7e521dfb786d8p-3, 0x0.df481b12ee6c80p-6, -0x0.fe83ec00417580p-8, 0x0.bc1afd7dd76bd0p-6, -0x0.cb0929dfb51a78p-9, -0x0.d5bf960145b078p-10, 0x0.9cd2cbd5297d50p-12, -0x0.d2a7b615174b88p-12, 0x0.d1144d8880ba18p-15, 0x0.d419f9e278b110p-15, -0x0.876830a3c139e0p-17, 0x0.c4b9793aa5e838p-18, -0x0.ac734a990ba818p-21, -0x0.a54fec0141d7c0p-20, 0x0.c26f9462a67320p-23, -0x0.87ae187153bc20p-24, 0x0.acf8a799555c70p-28, 0x0.dd5c39f2129ee0p-26, -0x0.f48e114edb32a0p-29, 0x0.d3c847948a2b28p-33, // x=       1 y=     6.5
+ 0x0.a23573a05dd788p-3, 0x0.d02c34b5c63040p-6, -0x0.e589320cd03f40p-8, 0x0.b0021b891d2c70p-6, -0x0.b8744d055cc6f0p-9, -0x0.baac5aa0115680p-10, 0x0.84c4113246a388p-12, -0x0.ba57298ab44040p-12, 0x0.b4ba5ce2ff2410p-15, 0x0.ae3e0c0aaa2888p-15, -0x0.d8186419fdfa18p-18, 0x0.a70733d1a95f88p-18, -0x0.910fdb8ef53740p-21, -0x0.80410c0ef1d450p-20, 0x0.92d08874c76278p-23, -0x0.e62ed11d244a18p-25, 0x0.9ba3b6f3375d40p-28, 0x0.a2d7cab8f88700p-26, -0x0.af7305f1aa7660p-29, 0x0.8bc26f16fa7148p-32, // x=       1 y=    6.75
+ 0x0.9a99d30acf8620p-2, 0x0.85dd6e5eb9e078p0, -0x0.d493822edd5850p-1, -0x0.9e86f500aae520p-1, 0x0.d6fde97b089ae8p-1, -0x0.c7052f722307d0p-3, -0x0.dd6efcf0d2d8d8p-3, 0x0.974b28dfefb588p-1, -0x0.8adfc2884ea018p-2, -0x0.9e460c576f30b8p-2, 0x0.f155bb2b14d448p-3, -0x0.87f001427ce188p-4, -0x0.903ba04416fbd0p-6, 0x0.88ab0896c49a58p-3, -0x0.f77ad922560290p-5, -0x0.8915e5fac16b38p-5, 0x0.ce333dc74ebbb8p-6, -0x0.b3172c3c961580p-6, 0x0.bbf50f95cf11e8p-8, 0x0.e74ae0661e9760p-7, -0x0.d899000cfa29d0p-8, 0x0.81193c01fb73b8p-11, 0x0.9d80cb009e97e0p-11, -0x0.afeb58c66616b8p-9, 0x0.f8d135a50f7390p-11, 0x0.853f498fc0c2f8p-11, -0x0.ffd9f9ca4d3f70p-13, 0x0.9142eac1bc7488p-12, -0x0.d9f80bb8f9f8f0p-15, -0x0.8722c2a5ae6758p-14, // x=    1.25 y=       0
+ 0x0.e280ed3c7bdd88p-2, 0x0.c4bb464a7eaae0p-1, -0x0.a3e4d17b4b5078p-1, -0x0.c0e1c0ecdd6d78p-3, 0x0.bc09feaa29bb30p-2, -0x0.89efbad5ac9e28p-2, 0x0.babff285302c48p-6, 0x0.8fb9d692f2f160p-2, -0x0.9630cd0a80c4a0p-3, -0x0.802097c7011d70p-4, 0x0.fea19840c48170p-5, -0x0.e4de597507bae8p-5, 0x0.dbc22c5c1a2288p-7, 0x0.9e7cc5d235bc90p-5, -0x0.9ab5755370e530p-6, -0x0.b0879f28ec5358p-11, 0x0.c98da88c5665b8p-9, -0x0.fb5fabce4abd50p-8, 0x0.ab8e79476ef170p-9, 0x0.92a0dca4c2e218p-9, -0x0.98fbb094d6a878p-10, 0x0.bd709270203da8p-11, -0x0.8d72ee30999958p-13, -0x0.8522bdab6b7ed8p-11, 0x0.cb1aba86c937a8p-13, 0x0.92cbbae0549c08p-18, -0x0.a7a77e5051e3e0p-16, 0x0.8a74bb215ed1c8p-14, -0x0.a85fa2948919b8p-16, -0x0.d4b520eda120b8p-17, // x=    1.25 y=    0.25
+ 0x0.f0d70d66496f68p-2, 0x0.9feda142ab72e8p-1, -0x0.833ea8d94ea988p-1, -0x0.c98f9cef1f3fe8p-5, 0x0.d0ac155940e3c0p-3, -0x0.f25080f93665d0p-3, 0x0.e6f48e7ca92408p-5, 0x0.a8c4b2271c0928p-3, -0x0.b69536fba98270p-4, -0x0.cea15200549ac0p-7, 0x0.bf16dcb9159928p-6, -0x0.96538647197808p-5, 0x0.ba7358654f9538p-7, 0x0.846d5ac5669d60p-6, -0x0.87259bdd4010d8p-7, 0x0.89d3c0480d4aa0p-9, 0x0.a74b9fb1202ac8p-12, -0x0.e3c3fe35b5bb98p-9, 0x0.a436a348fc68e8p-10, 0x0.903fd844eb00b8p-11, -0x0.b2070971907ca8p-12, 0x0.cafb6d57548fb8p-12, -0x0.cf6b4399ee4660p-14, -0x0.a5ef7b26b9ccf8p-13, 0x0.83a60f935c96d0p-14, -0x0.969e5a020ea268p-16, 0x0.8cc77ed60cdc50p-23, 0x0.b8bccdc70243e0p-16, // x=    1.25 y=     0.5
+ 0x0.f1c66784f35c48p-2, 0x0.82ab850000e658p-1, -0x0.cf894b2d9a1780p-2, 0x0.dab4367f806d40p-6, 0x0.de30eb52e62810p-4, -0x0.c514c9ce200318p-3, 0x0.efa75ffa452cb8p-5, 0x0.c340df9ef45c20p-4, -0x0.d81b39a3dfe630p-5, 0x0.a6b931218e23f0p-8, 0x0.f2543548b9ba28p-8, -0x0.b80e34336de940p-6, 0x0.fa7c19b7fb88c8p-8, 0x0.d32e6a733590f0p-8, -0x0.e5b14692962388p-9, 0x0.818716d1925ed0p-9, -0x0.8f9c7cddb0de88p-12, -0x0.c7bdbb418ec068p-10, 0x0.946f41875d0a20p-11, 0x0.a71fc125cf4f30p-14, -0x0.b66a3803cb8bb0p-14, 0x0.c0b3b1cff91de0p-13, -0x0.d9f8cd6d27a438p-15, -0x0.c36dcdb5553c60p-15, 0x0.a483a1b80f02d8p-16, -0x0.cf9113d4ab7ec0p-17, 0x0.913f3313a0d818p-19, 0x0.eefe69e2dd6280p-18, // x=    1.25 y=    0.75
+ 0x0.eb8db5f6340ae0p-2, 0x0.d728e8b7610290p-2, -0x0.a3a9a8c874d820p-2, 0x0.8719eab99bef38p-4, 0x0.dbd6e10d03ccb0p-5, -0x0.9af5e70b565348p-3, 0x0.ce7780bf28b5e0p-5, 0x0.df2c9812ff18e8p-5, -0x0.fca906fe7ccab8p-6, 0x0.a167b478597d10p-7, 0x0.a1b18a7b8288e0p-10, -0x0.da751048592638p-7, 0x0.9a828fe9acffb8p-8, 0x0.9afb0decf26ab8p-9, -0x0.bd5e80c31d9290p-10, 0x0.b2e7981a521cc8p-10, -0x0.9c63c37c9aabd8p-12, -0x0.ab751e108576e8p-11, 0x0.826297dba23648p-12, -0x0.f263d16be730f8p-16, -0x0.ff8e63b0aacde8p-17, 0x0.ada62b4be93da8p-14, -0x0.cd476694e4cf08p-16, -0x0.cee0da2d0517d8p-17, 0x0.c3c79379b5a368p-18, -0x0.d647cdd7dc24c0p-18, 0x0.beb61625325d48p-20, 0x0.95bb3fb6145b08p-19, // x=    1.25 y=       1
+ 0x0.e1c5c633287360p-2, 0x0.b2b414ef278fa8p-2, -0x0.8170a77b027248p-2, 0x0.ac9ae5c92b4ba8p-4, 0x0.b8a5f1321cbbd8p-6, -0x0.f039b68cac5230p-4, 0x0.a54da001d94a30p-5, 0x0.fb491b7d6a0c68p-6, -0x0.92db71b5604328p-6, 0x0.a0ccdc612a0340p-7, -0x0.e8089b93e2a270p-11, -0x0.ffd9f10afcb868p-8, 0x0.b7ad0ec29625e0p-9, 0x0.bade791a6ff5e8p-11, -0x0.94ecf2077a9630p-11, 0x0.dec1a9555824f0p-11, -0x0.dfa425ba84b210p-13, -0x0.90317a4a9ce010p-12, 0x0.e13039abf8add0p-14, -0x0.a636dd404aa488p-15, 0x0.959f56b8a3f958p-19, 0x0.988fe0525a1550p-15, -0x0.b858d0f1f82820p-17, -0x0.a41308f90f8c48p-19, 0x0.d46d4245bc4c98p-20, -0x0.c7b2357bd5d538p-19, // x=    1.25 y=    1.25
+ 0x0.d67a00fc4c4e28p-2, 0x0.95cb0fb27fea00p-2, -0x0.cdf71f63643cd8p-3, 0x0.b9eb96c73c6710p-4, 0x0.a9e6763e496358p-8, -0x0.b96d0818eceff0p-4, 0x0.800459f13c31d0p-5, 0x0.8a17cb973a7c90p-6, -0x0.aa1eea1138dd20p-7, 0x0.87c54423bfbc08p-7, -0x0.b8144a3d7af118p-10, -0x0.9523ad361eceb0p-8, 0x0.d6e3c594dc78a8p-10, 0x0.b13b00fb59d258p-14, -0x0.d578ec3622b148p-13, 0x0.84a56eaef87a80p-11, -0x0.8cd9263c3176c0p-13, -0x0.eba370416cc8c8p-14, 0x0.bfb75dc88980b8p-15, -0x0.f85dbe96163c18p-16, 0x0.9cc751195d1900p-18, 0x0.843197e0882138p-16, -0x0.a1d7fd87e22cc8p-18, 0x0.880a06cf72fe30p-24, 0x0.b7c024c479f380p-22, -0x0.b2b19d615caf30p-20, // x=    1.25 y=     1.5
+ 0x0.cace8b9bed7318p-2, 0x0.fd6bdb156a09f8p-3, -0x0.a51b8a494c5390p-3, 0x0.b9ebed29ea7808p-4, -0x0.89415778c45760p-8, -0x0.8f54d5b1983f98p-4, 0x0.c35f03c54ad3d0p-6, 0x0.914caf8cf4b378p-7, -0x0.c434d579e0ce80p-8, 0x0.d638ee0718f400p-8, -0x0.b00ddecd4f3468p-10, -0x0.add07818edb018p-9, 0x0.fa106e9837cfe8p-11, -0x0.8221203d7fdcc8p-13, -0x0.f10ae2adc8a248p-15, 0x0.9aecd4a2657a60p-12, -0x0.a836efa51af6b0p-14, -0x0.b6ed0ddeeb8c60p-15, 0x0.a049370d9b3360p-16, -0x0.9eb3111783d248p-16, 0x0.f7d88917e9fa20p-19, 0x0.e2d183d871db40p-18, -0x0.8c7a4663eadab0p-19, 0x0.83c25261b1f018p-21, 0x0.9184a5ffbf1350p-26, -0x0.9ca6c57d8b99f0p-21, // x=    1.25 y=    1.75
+ 0x0.bf61858a81e770p-2, 0x0.d8444ba9c09258p-3, -0x0.85761ce8580b18p-3, 0x0.b2e5d1ea57e998p-4, -0x0.92c744c8d577a8p-7, -0x0.de9d3a3487ad78p-5, 0x0.9453ca1e61a688p-6, 0x0.8c222ea140ba20p-8, -0x0.e075aafec49c28p-9, 0x0.a3b94dc22335f8p-8, -0x0.91ba62afc19820p-10, -0x0.cad31fc8cdad20p-10, 0x0.9187516da707f8p-11, -0x0.b0e799a81a06f0p-13, -0x0.c018108be04fb8p-19, 0x0.b3abc867667dc0p-13, -0x0.c42fb794dd9df8p-15, -0x0.ff0f34bbcae488p-17, 0x0.820268c577a040p-17, -0x0.be523f29f2bcc0p-17, 0x0.a13d477dbccff0p-19, 0x0.c061c39a4a3fa8p-19, -0x0.f22d8b06397ff8p-21, 0x0.e030925148cce0p-22, -0x0.c5bf13e68cd558p-25, -0x0.8805327fc11278p-22, // x=    1.25 y=       2
+ 0x0.b483bbc2710d08p-2, 0x0.ba1be723c39f68p-3, -0x0.d99ffd871924c8p-4, 0x0.a876e98f8388f0p-4, -0x0.b5c43dd949e260p-7, -0x0.adfeaa9800c790p-5, 0x0.e1519dbfaf9130p-7, 0x0.da67ae3fd298b8p-10, -0x0.fcd4cd4d512810p-10, 0x0.f69e038b990370p-9, -0x0.e2c7cf168bc788p-11, -0x0.ece70d20047ed8p-11, 0x0.a9e5101e6a4270p-12, -0x0.a2d515bbe864d0p-13, 0x0.f3211597ea0aa0p-17, 0x0.d049cc866e5ef0p-14, -0x0.e2ae9570ce0778p-16, -0x0.83a38b7c0c9638p-18, 0x0.c70a25abd746e8p-19, -0x0.ddce11359aaaa0p-18, 0x0.c27b45096b8718p-20, 0x0.a0352d33f6bb70p-20, -0x0.ce80768dc61900p-22, 0x0.95673ae6d3a7c0p-22, // x=    1.25 y=    2.25
+ 0x0.aa59b7385ad4d0p-2, 0x0.a16b31f7331918p-3, -0x0.b2f552c84e9d60p-4, 0x0.9cadb5d38eee30p-4, -0x0.c06c6e15404ce8p-7, -0x0.89028946f8b930p-5, 0x0.abc35d79a67eb0p-7, 0x0.df7b9046e33958p-13, -0x0.8a56841c6f58b8p-10, 0x0.b8b85046122840p-9, -0x0.ab49da2b6bda18p-11, -0x0.8a38f665804090p-11, 0x0.c726bc8d898528p-13, -0x0.84416cce621370p-13, 0x0.92a0ed9955bf90p-16, 0x0.f24024e43c77b8p-15, -0x0.82c08c31647748p-16, 0x0.de9f6b8b146ce0p-23, 0x0.861d7b6d30d670p-20, -0x0.ff68759d72e7a8p-19, 0x0.e2b1a66eb04740p-21, 0x0.80fef3438da5e8p-21, -0x0.aecc92dc76a458p-23, 0x0.b57092553b8ce0p-23, // x=    1.25 y=     2.5
+ 0x0.a0ef074e9d2038p-2, 0x0.8d085af97fb370p-3, -0x0.94653a2b83d2d8p-4, 0x0.90afb3d63f2d20p-4, -0x0.bdbe41b54ce9b8p-7, -0x0.d97d17f1ed1ad8p-6, 0x0.83aac1598dff38p-7, -0x0.941bff4f57f670p-11, -0x0.8f4c8030bed410p-11, 0x0.8a5357e6680598p-9, -0x0.ff1d28635fa730p-12, -0x0.a08ec2dfc3b2b8p-12, 0x0.ea5e34de6f8b20p-14, -0x0.cb2e29828fb5c8p-14, 0x0.8259942dd0fa78p-16, 0x0.8d98f4e9d536d0p-15, -0x0.97422e4ac66dc8p-17, 0x0.c24aa069f95fe0p-20, 0x0.f33e99b731c900p-23, -0x0.92972459172160p-19, 0x0.822582b8c74470p-21, 0x0.c243a3b8d7f6b8p-23, -0x0.90fcfc14205398p-24, 0x0.d3a47f284d9d70p-24, // x=    1.25 y=    2.75
+ 0x0.98418482f90b40p-2, 0x0.f81f9c47993c40p-4, -0x0.f81641c26b86a8p-5, 0x0.851a71b363edc8p-4, -0x0.b4210c2d0fcb68p-7, -0x0.ae04c779ea8330p-6, 0x0.cb3621678d7e68p-8, -0x0.f94c1ff5b71348p-11, -0x0.84509081f13408p-12, 0x0.cfc616049785a8p-10, -0x0.bce94b6b8623f8p-12, -0x0.b88ac4795de088p-13, 0x0.8a4b5c4ae1e490p-14, -0x0.97d531be95b488p-14, 0x0.d0079a0af2b098p-17, 0x0.a67f0ec933b888p-16, -0x0.afe588f2d668f0p-18, 0x0.d56915497dcf48p-20, -0x0.d4a2721ce57040p-25, -0x0.a897b383917628p-20, 0x0.94b28002e53a30p-22, 0x0.faae6fa2fee920p-25, -0x0.e7553cff5b0040p-26, 0x0.f2639e1e4edd58p-25, // x=    1.25 y=       3
+ 0x0.9047df85421738p-2, 0x0.dba52bc905ecf8p-4, -0x0.d0f76659ddffa0p-5, 0x0.f4790997a55d58p-5, -0x0.a7493c3ac57cc8p-7, -0x0.8c5b96a683f700p-6, 0x0.9df56f1b110948p-8, -0x0.91b099a1aada78p-10, -0x0.b1803e028d8218p-14, 0x0.9ccd70dc928808p-10, -0x0.8bcbc37f63de90p-12, -0x0.cfd21ca07a37a8p-14, 0x0.a3528b16671b40p-15, -0x0.dfe4e4cddb4510p-15, 0x0.9de4ae62b9fc08p-17, 0x0.c4e4fe367bbc10p-17, -0x0.cddfab8fe164c0p-19, 0x0.b7e9f26a8722a8p-20, -0x0.879e6fc2f83610p-23, -0x0.c2d6a6ecbbb658p-21, 0x0.aa0700bf674ba0p-23, 0x0.b9a40524660558p-27, -0x0.aa6d9ee1120f10p-27, 0x0.89d7d902d53048p-25, // x=    1.25 y=    3.25
+ 0x0.88f56cef9d1310p-2, 0x0.c39281ec30d978p-4, -0x0.b14b00b6bb51d0p-5, 0x0.e06e27a893dd50p-5, -0x0.9953dafa3c1668p-7, -0x0.e4325f2717eae0p-7, 0x0.f76c92b8c331f8p-9, -0x0.96120ab26eb100p-10, 0x0.8cb763bdc4a468p-17, 0x0.ee18a03290a680p-11, -0x0.cf64be1a217a58p-13, -0x0.e15aa69294f718p-15, 0x0.c0626b3349a3f0p-16, -0x0.a4283336e21ec0p-15, 0x0.e9b154c60df858p-18, 0x0.e9fef3da74a628p-18, -0x0.f2a133f6d239c8p-20, 0x0.906043e7059378p-20, -0x0.8a4c2166fed620p-23, -0x0.e2a2f38ce6d450p-22, 0x0.c33b99c0d4d668p-24, -0x0.c2c1f2de507768p-28, -0x0.cedaa01726e258p-29, 0x0.9cb4c8b945b358p-26, // x=    1.25 y=     3.5
+ 0x0.823c500724f1d8p-2, 0x0.af145c803a9528p-4, -0x0.977346d9a0c0a0p-5, 0x0.ce234209021410p-5, -0x0.8b6d7bac09e0c8p-7, -0x0.baea0506246de8p-7, 0x0.c3422ff35e7d28p-9, -0x0.91656005004028p-10, 0x0.f0d056fac50cd8p-15, 0x0.b5fa9899e738f0p-11, -0x0.9a7f5984460cb0p-13, -0x0.e336be20c248a0p-16, 0x0.e0ed5bf22f9840p-17, -0x0.f07ea7a6ec3f90p-16, 0x0.aac5849f2ebe70p-18, 0x0.8b8a38b400d9f8p-18, -0x0.8ff25c3d190588p-20, 0x0.d8be3ed2a0b148p-21, -0x0.e7e60309c707f0p-24, -0x0.84cea3dd4d0fd8p-22, 0x0.e141b922b35810p-25, -0x0.aa1051567d6200p-27, // x=    1.25 y=    3.75
+ 0x0.f81d5eddb582e8p-3, 0x0.9d84b8f4958170p-4, -0x0.823527c329c840p-5, 0x0.bd8b6caf9ab2d0p-5, -0x0.fc6a23b0f3b568p-8, -0x0.9a378d564d7af0p-7, 0x0.9b412c30d2d960p-9, -0x0.8822243988e568p-10, 0x0.a943fe81bc67c0p-14, 0x0.8c11afeebc4108p-11, -0x0.e77155b5c74a50p-14, -0x0.c2b5ab3896cf48p-17, 0x0.8185c821a4d608p-17, -0x0.b083b0aa6d4728p-16, 0x0.f83bbf8ad284b8p-19, 0x0.a6ad970ed6f9a8p-19, -0x0.abdcd473755830p-21, 0x0.9ef84126ba2b78p-21, -0x0.b3530f2782eb00p-24, -0x0.9ccca2de468370p-23, 0x0.831026f6a5d698p-25, -0x0.a28b02f06d0350p-27, // x=    1.25 y=       4
+ 0x0.ecbeb1e0b8a1f0p-3, 0x0.8e602546afe068p-4, -0x0.e13e30a5d23cd0p-6, 0x0.ae8b81c73163a0p-5, -0x0.e3ed724b4f5180p-8, -0x0.80204a521f1320p-7, 0x0.f8b7392b659780p-10, -0x0.f9c249a1391ae0p-11, 0x0.bb06cc072b50c0p-14, 0x0.d92c9623e639a8p-12, -0x0.ae6d0feb275c60p-14, -0x0.bb3baafaff7448p-19, 0x0.912007e1ae60d8p-18, -0x0.820cd8c69653a0p-16, 0x0.b43935ca856100p-19, 0x0.c6d297f88e6ce8p-20, -0x0.ce43a4c79eb8b8p-22, 0x0.e6773254880c68p-22, -0x0.8539f5980c0908p-24, -0x0.ba81614760a548p-24, 0x0.99b754befba920p-26, -0x0.84b796b4baa580p-27, // x=    1.25 y=    4.25
+ 0x0.e24420f33e58a0p-3, 0x0.813dc61fcc11a0p-4, -0x0.c3ed324edd1260p-6, 0x0.a1021bae51a9d8p-5, -0x0.cd9d89843da388p-8, -0x0.d64f6fc74991c8p-8, 0x0.c8a558e98cb878p-10, -0x0.e23ad3ef909588p-11, 0x0.bb560daeb94fb0p-14, 0x0.a992eb335d3db8p-12, -0x0.84525a7aaf6c78p-14, 0x0.89a0ee1423a720p-19, 0x0.9aa4b6bee0ddb8p-19, -0x0.c09736dbe1e000p-17, 0x0.8310f3d9510278p-19, 0x0.ebe0f770fca700p-21, -0x0.f87f141f370cc8p-23, 0x0.a63216497cbe48p-22, -0x0.c1d2f3f9c80368p-25, -0x0.df62e95c020aa0p-25, 0x0.b5ba242059b8b0p-27, -0x0.ca3a73ea63e048p-28, // x=    1.25 y=     4.5
+ 0x0.d8975c5157fb18p-3, 0x0.eb92b37e6f4b88p-5, -0x0.ab5542dc1552f0p-6, 0x0.94cc22851d8a18p-5, -0x0.b97d58290a1198p-8, -0x0.b45c7fe81f79f8p-8, 0x0.a2fbe2f86f2798p-10, -0x0.cb4f22b3aa8610p-11, 0x0.b2511fc50079e0p-14, 0x0.8558ea01ca2db0p-12, -0x0.ca1fecdbe0e4e0p-15, 0x0.981d4adf578a48p-18, 0x0.952552cc5327c8p-20, -0x0.8f6b9da8941038p-17, 0x0.bf4aa271fb6848p-20, 0x0.8a54e064ac43a8p-21, -0x0.95f9caedb55cd0p-23, 0x0.ef6d3c88083e78p-23, -0x0.8b76f8dcd15088p-25, -0x0.869c74b563a3d0p-25, 0x0.d88609c4ecde98p-28, -0x0.94b6888558b518p-28, // x=    1.25 y=    4.75
+ 0x0.cfa441927d76e0p-3, 0x0.d77d633fde0ff0p-5, -0x0.96932ff97ff030p-6, 0x0.89c74f1f7c2510p-5, -0x0.a772fe688d4280p-8, -0x0.98b228de875b28p-8, 0x0.8544cb58cb6878p-10, -0x0.b5d62fb5bb3518p-11, 0x0.a4c43e336e6a58p-14, 0x0.d32d487fee2388p-13, -0x0.9b6eb65cde7840p-15, 0x0.bcfafcf5580540p-18, 0x0.e016bb87739138p-22, -0x0.d6ecfcfcc2c878p-18, 0x0.8c3cc470fb3530p-20, 0x0.9eebc1838c6f10p-22, -0x0.b4ec4f8b672e70p-24, 0x0.acb6cb7f780ab8p-23, -0x0.c7b97b37a21fe8p-26, -0x0.a31210ab193af8p-26, 0x0.81f274e6e92340p-28, -0x0.d69a5b54c49800p-29, // x=    1.25 y=       5
+ 0x0.c758c2ff8f5ae0p-3, 0x0.c5cc82d69b64c8p-5, -0x0.84f3c4f044d8a0p-6, 0x0.ffa6ef93ee8170p-6, -0x0.975685dbe8d668p-8, -0x0.82013234b2bd08p-8, 0x0.db534a6bb9aa00p-11, -0x0.a2303431596848p-11, 0x0.957a40079c3800p-14, 0x0.a85852ccd56b78p-13, -0x0.f0ae4ee39d5010p-16, 0x0.c724245cf32b68p-18, 0x0.d4519dc7530968p-26, -0x0.a212ce8011b578p-18, 0x0.ceb751918ac640p-21, 0x0.b00481d87bcc00p-23, -0x0.d961c023a4d208p-25, 0x0.f9f6e5cba92d98p-24, -0x0.8ed9561b5a9df0p-26, -0x0.c64da71ea27848p-27, 0x0.9d08e86017af30p-29, -0x0.9950709f913fe0p-29, // x=    1.25 y=    5.25
+ 0x0.bfa4c050d14548p-3, 0x0.b624f889227da0p-5, -0x0.ebd15dc8e7d270p-7, 0x0.eda64dae9da720p-6, -0x0.88fa7458cff568p-8, -0x0.de8e20ea8e09b8p-9, 0x0.b591fa814b3530p-11, -0x0.907908c8bbb978p-11, 0x0.860863ae61bf10p-14, 0x0.87139d4de62fb0p-13, -0x0.bb97857c5cd1c0p-16, 0x0.c27a86447e0910p-18, -0x0.c8d1ba7d8ac560p-23, -0x0.f607449ef6ba70p-19, 0x0.993cead2581120p-21, 0x0.b63cef1881c598p-24, -0x0.8171a5c89e69a0p-25, 0x0.b5a7b6207946d0p-24, -0x0.cc9acaad11f900p-27, -0x0.f1a8db85b19ce8p-28, 0x0.bee7073c91e110p-30, -0x0.da141c32254250p-30, // x=    1.25 y=     5.5
+ 0x0.b879d99a128018p-3, 0x0.a83b991fea6838p-5, -0x0.d200499f24e308p-7, 0x0.dd579048196cf0p-6, -0x0.f861545caa25c0p-9, -0x0.bf7602fbdb5a78p-9, 0x0.972f17e0e21de0p-11, -0x0.80a67c103b27a8p-11, 0x0.ee93bdf0b1cbe8p-15, 0x0.da2128f238dee0p-14, -0x0.932c01af24b308p-16, 0x0.b61b74d7d93288p-18, -0x0.9c387f00aed598p-22, -0x0.bbf41ad0cc9f08p-19, 0x0.e49176e686a450p-22, 0x0.a3962d9c4b6990p-25, -0x0.97b48ff66acde0p-26, 0x0.84ac4d8d2895b8p-24, -0x0.92f478748ab798p-27, -0x0.933c743f4e0008p-28, 0x0.e93972f10d8340p-31, -0x0.9af09fb05e2eb8p-30, // x=    1.25 y=    5.75
+ 0x0.b1cb4162684f70p-3, 0x0.9bd2003bee3de0p-5, -0x0.bbbd317153cf58p-7, 0x0.ce8b3814e0f6d8p-6, -0x0.e19a0cabb7a7f8p-9, -0x0.a580314c092170p-9, 0x0.fd2786a91478b0p-12, -0x0.e534fc0e76c5d0p-12, 0x0.d3561172a6df38p-15, 0x0.b13098511da758p-14, -0x0.e86538a0eeaf40p-17, 0x0.a63d08adfa5710p-18, -0x0.b217390cada310p-22, -0x0.9083a789441520p-19, 0x0.ab85afd6b485d0p-22, 0x0.bcc7da6746dd40p-27, -0x0.acf24db7cd13f8p-27, 0x0.c2db7620698280p-25, -0x0.d3f03d31c71470p-28, -0x0.b2e16cbfb48470p-29, 0x0.8efe02c9372e60p-31, -0x0.dc6e93304a24a8p-31, // x=    1.25 y=       6
+ 0x0.ab8d909e9d2ad0p-3, 0x0.90b419337cad00p-5, -0x0.a873d6012ce3b0p-7, 0x0.c117173ca0ee88p-6, -0x0.cd4d6d8cc44b68p-9, -0x0.8fb5c1b4bc6070p-9, 0x0.d51094205813c8p-12, -0x0.cc5bc63b5b3d80p-12, 0x0.baae43fd0f94b0p-15, 0x0.90c51bd29e4280p-14, -0x0.b89e92cf7b67e0p-17, 0x0.9550a624278b20p-18, -0x0.b494e4eb587a48p-22, -0x0.dfa3bf333fbb78p-20, 0x0.818453e62a0408p-22, -0x0.8ee9e379a4c218p-28, -0x0.bbd4e4d4407078p-28, 0x0.8feae0851632d0p-25, -0x0.99a5c685f61550p-28, -0x0.d6c047a789e7b0p-30, // x=    1.25 y=    6.25
+ 0x0.a5b69dea327ed8p-3, 0x0.86b62eab8b5a68p-5, -0x0.97ab7abcd41640p-7, 0x0.b4d5dd6206bcf8p-6, -0x0.bb318232ac1ea8p-9, -0x0.faa672c616ec60p-10, 0x0.b438b42f0592b8p-12, -0x0.b66d4881b4b5f0p-12, 0x0.a4a865e5b13e88p-15, 0x0.ede1944cbd63c0p-15, -0x0.938abe8c784330p-17, 0x0.84b4a9d686fa38p-18, -0x0.ac83fb895c6690p-22, -0x0.ae1e3c9c1df330p-20, 0x0.c4cfd9f12a6308p-23, -0x0.cfc9b64db74728p-27, -0x0.b9f47456a8d6c0p-29, 0x0.d5d8775c807580p-26, -0x0.dfc031248741f8p-29, -0x0.ffa5fcc2c921e8p-31, // x=    1.25 y=     6.5
+ 0x0.a03d588e9f9818p-3, 0x0.fb66c3657e6bb0p-6, -0x0.89013b1c599290p-7, 0x0.a9a69a6abeb130p-6, -0x0.ab04319d014f08p-9, -0x0.db79c86d0b76d8p-10, 0x0.992afe6258d5d8p-12, -0x0.a316c2686e4828p-12, 0x0.9127da4b693530p-15, 0x0.c47b607e8b4380p-15, -0x0.ed2e7f750e0e80p-18, 0x0.ea42d862bb15d0p-19, -0x0.9f30955623fd98p-22, -0x0.8861b9a45d0160p-20, 0x0.967411daddea08p-23, -0x0.872194bfa89090p-26, -0x0.93e7695988cc20p-30, 0x0.9fd3365f320e20p-26, -0x0.a3d06df05700e0p-29, -0x0.94e32050200f90p-31, // x=    1.25 y=    6.75
+ 0x0.920e7b1ec4c580p-3, 0x0.e308d0916f01c8p-1, -0x0.ed578811ffc0c8p-2, -0x0.a021bbd0555810p-1, 0x0.9c537fc6ee9940p-1, 0x0.84b802846ec0f0p-3, -0x0.b47a8f785b0198p-2, 0x0.8d9ea3b8b56700p-2, -0x0.9afeb351d3d488p-6, -0x0.943ee5a738ca20p-2, 0x0.9cf9f15996bbe0p-3, 0x0.9ed8e8c01c52d0p-4, -0x0.9d24369808fea8p-4, 0x0.df3cbdc7a42050p-5, -0x0.85f01d85039208p-7, -0x0.c26a70c9b1b758p-5, 0x0.b85911abdb57a8p-6, 0x0.b9600f9f5de590p-8, -0x0.cebe448b423348p-8, 0x0.8b58f39bae9348p-7, -0x0.a0a6e40146dfb0p-9, -0x0.ff36d61dae3120p-9, 0x0.f4a2fb4cf910a8p-10, -0x0.d1ed102030d778p-12, -0x0.af88f4ca370c88p-14, 0x0.c2eef169310550p-11, -0x0.fa6e43679682e0p-13, -0x0.cc681f28d415f0p-14, 0x0.88d451ab7a6fc8p-15, -0x0.cb437369af0f28p-15, // x=     1.5 y=       0
+ 0x0.9c3afa1f346ad8p-2, 0x0.b56a248263a270p-1, -0x0.eba07621d4e790p-2, -0x0.8ce854d64814b0p-2, 0x0.add2a6076a85b0p-2, -0x0.b5fa4b6f8931b0p-4, -0x0.aa637ca1cd7bb8p-4, 0x0.c7895c4bbfd398p-3, -0x0.8660f42ef627a0p-4, -0x0.c94f68e4fc9808p-4, 0x0.fa9c34e0323468p-5, -0x0.89eedd3e9f5098p-8, -0x0.c1442a91c35788p-7, 0x0.e07081ef1484f0p-6, -0x0.94963165283550p-7, -0x0.a7ff0b57f30310p-7, 0x0.b9dc4b4a6ac0f0p-8, -0x0.f0547dd4df9690p-10, -0x0.c2b56de9c432d0p-13, 0x0.a1bf060a104888p-9, -0x0.e90868d51f55c0p-11, -0x0.dcf976c8cd1e38p-12, 0x0.8c5521b4fd9a58p-12, -0x0.8a34257817c0e8p-12, 0x0.f843ee37887d18p-15, 0x0.82f968ba5fc230p-13, -0x0.cca1ac4a9ded38p-15, 0x0.c6934edda979d0p-18, 0x0.e14f5ee4af0a28p-19, -0x0.8b432f039eed78p-16, // x=     1.5 y=    0.25
+ 0x0.b606379e43eb28p-2, 0x0.99a1952e782530p-1, -0x0.cf803fce305f50p-2, -0x0.8d58764675f898p-3, 0x0.ddfd16358ba420p-3, -0x0.faec898b48d310p-4, -0x0.80c3a7cb84f578p-6, 0x0.89a6fac41be918p-3, -0x0.db99f6cb466258p-5, -0x0.b053933a451ae8p-5, 0x0.f8d30722edef68p-6, -0x0.caec9c1ded3258p-7, -0x0.9844f9928fff88p-10, 0x0.f157ab3a668a80p-7, -0x0.b480b72de1e630p-8, -0x0.cab2d0b7a3dff8p-9, 0x0.860543691d5928p-9, -0x0.cd2d9a5ed99df0p-10, 0x0.8ca11c34e5bd80p-12, 0x0.fde79e092c3ef8p-11, -0x0.c4a926ab44d7b8p-12, -0x0.93c4d92308e3f0p-15, 0x0.f37af60b403ed0p-15, -0x0.810bb2b583e2b8p-13, 0x0.8e7f09b97efb00p-15, 0x0.8b12ca68e8e4d8p-15, -0x0.ef7e7f8c8dd638p-17, 0x0.f3b40ae0191920p-18, // x=     1.5 y=     0.5
+ 0x0.c1bad2632a5590p-2, 0x0.81ae34159d9450p-1, -0x0.afbd7576a20f10p-2, -0x0.d3eb754b1bf3b0p-5, 0x0.89569752cbe880p-3, -0x0.fa2b3640aeb7b0p-4, 0x0.c923386f2e2a30p-7, 0x0.b56d9bfe835e50p-4, -0x0.9cc86d9d7a3f50p-5, -0x0.854d82d21f9be0p-6, 0x0.e9de5e0d152df8p-7, -0x0.bbc7c940d073f0p-7, 0x0.dcc424159b3808p-10, 0x0.f4be1196f71bf8p-8, -0x0.c4280fa4183950p-9, -0x0.a10072366f6d40p-11, 0x0.ad26ee621bd6b0p-11, -0x0.fc70e716520938p-11, 0x0.fafe63fd812068p-13, 0x0.ba89b4ec829540p-12, -0x0.9ace2d76311c10p-13, 0x0.931fd1383d2bc8p-15, 0x0.be83d284084848p-18, -0x0.d847cb83aadbb8p-15, 0x0.826c27254da6e8p-16, 0x0.f4ac6d178cade8p-18, -0x0.fe0882a50b8fc0p-19, 0x0.85de41d70c1810p-18, // x=     1.5 y=    0.75
+ 0x0.c4b2b6ae8e5f48p-2, 0x0.db35da9f2657e8p-2, -0x0.920ba5d1386fe0p-2, 0x0.e9650553ce7768p-11, 0x0.a48dfe61b1eac0p-4, -0x0.de9988a06bc718p-4, 0x0.b0f30084690638p-6, 0x0.e90947bad47e48p-5, -0x0.d2b6fc7cca3498p-6, -0x0.8412ce64f30d70p-8, 0x0.cd4e7f900ec7a0p-8, -0x0.8c4a72d9e78828p-7, 0x0.810dead4cd61c8p-9, 0x0.ee084d6f4373c0p-9, -0x0.c973957dba9400p-10, 0x0.855e61bf606680p-13, 0x0.b00284dd9f63c8p-13, -0x0.8a42df28f49668p-11, 0x0.9c510b99a84678p-13, 0x0.fc233090504190p-14, -0x0.e68d9befb97a68p-15, 0x0.89dc7b3322e938p-15, -0x0.8af14d38303560p-18, -0x0.aa86b9cb6062f8p-16, 0x0.d894aaf6467a00p-18, 0x0.d8eecb02cef528p-21, // x=     1.5 y=       1
+ 0x0.c26bb410c36ed0p-2, 0x0.b9ffbcb4c1de38p-2, -0x0.f0bd848acc0a20p-3, 0x0.8273fcb8bac2f8p-5, 0x0.bcd1b87e139778p-5, -0x0.bbf403ab6e1b60p-4, 0x0.b9ada5b3d75ef8p-6, 0x0.932dcbaf601920p-5, -0x0.894fd70f0e7a78p-6, 0x0.9163a6e3c01228p-10, 0x0.9fd54d270dbef8p-9, -0x0.c0831761f73040p-8, 0x0.ce3d11dd44c060p-10, 0x0.de21f44f0b15b8p-10, -0x0.c7a416847c8b50p-11, 0x0.8f6f1b6492d470p-12, 0x0.a8ce34e720b248p-17, -0x0.8f2647e1d85290p-12, 0x0.ac56569f2b25a0p-14, 0x0.91a6b2f7c68ac0p-15, -0x0.a0ceae788ce780p-16, 0x0.add5332140b6e0p-16, -0x0.897603f4f77768p-18, -0x0.803da87dc11690p-17, 0x0.aaf1ed54c37f60p-19, -0x0.edf09612047e70p-22, // x=     1.5 y=    1.25
+ 0x0.bd2026d1705f18p-2, 0x0.9eaa45a2dde700p-2, -0x0.c5fe37aeb80c90p-3, 0x0.c91f9cb543bb80p-5, 0x0.c98d24156ed338p-6, -0x0.9a9890e6e87b88p-4, 0x0.a7b3234eae1c40p-6, 0x0.b767668a5d0dc0p-6, -0x0.b00836d4729110p-7, 0x0.bf5c8e6bbf3448p-9, 0x0.b5b78230da0588p-11, -0x0.fd9816254c30c8p-9, 0x0.917a1c4ba317b8p-10, 0x0.c3e00b912c7328p-11, -0x0.c0202b0f160c28p-12, 0x0.ff2d0b3d47d870p-13, -0x0.f97e4982f34aa8p-16, -0x0.8f703515f99908p-13, 0x0.b36a4e83f15af8p-15, 0x0.cb4b31def2e528p-18, -0x0.c8cf28b459eae8p-18, 0x0.c0b9bbcbcaf740p-17, -0x0.af8207a3197a90p-19, -0x0.b703a4117dda70p-19, 0x0.818765bbf1ace0p-20, -0x0.faab2dd0d01f40p-22, // x=     1.5 y=     1.5
+ 0x0.b6366c8f8f0a10p-2, 0x0.882c84285dce88p-2, -0x0.a313e276623478p-3, 0x0.ecc87b98ecb260p-5, 0x0.b9170d0f074c18p-7, -0x0.fb14c7a38e8c88p-5, 0x0.8dc99da1036f60p-6, 0x0.e13bf1da296608p-7, -0x0.df95e7e144dbb8p-8, 0x0.d53b4cdfd41aa0p-9, -0x0.c8a7873bad7f48p-15, -0x0.a398cc4fde1978p-9, 0x0.c2076ccfcb5c50p-11, 0x0.9bfa6995b29ea0p-12, -0x0.b2e33d02399d28p-13, 0x0.bb4211a659ba38p-13, -0x0.86508f4357bc78p-15, -0x0.8c6b0eab9d1ea8p-14, 0x0.b4ff2d4de09e70p-16, -0x0.91314255b40d20p-19, -0x0.be74ab954a2500p-20, 0x0.c96f3f0f2be118p-18, -0x0.c396bbf4f12338p-20, -0x0.f09fc03e30ca80p-21, 0x0.bc0266b2c7ef00p-22, -0x0.a21f7170bb4948p-22, // x=     1.5 y=    1.75
+ 0x0.ae8c926889d908p-2, 0x0.eb3ccb904afda0p-3, -0x0.86cf5682414cc8p-3, 0x0.faecd84f1925c8p-5, 0x0.d166ab26f1b128p-9, -0x0.cad1ae6e89c740p-5, 0x0.e7f39aa07501f8p-7, 0x0.87960118f1b898p-7, -0x0.8d26c3b97b01e0p-8, 0x0.c41a9eb952db58p-9, -0x0.a77f905dc4d3b8p-12, -0x0.d0e53863b7b9a0p-10, 0x0.fbaa624ad4b9b0p-12, 0x0.c13aba05b6b060p-14, -0x0.9ea269893c9e80p-14, 0x0.fe0c86031cc4e8p-14, -0x0.d1073d16c3bea0p-16, -0x0.867acb381b6328p-15, 0x0.b2f6417dccc8a8p-17, -0x0.efeaa20ba68ae8p-19, -0x0.adc9aff68042d0p-29, 0x0.cc120efe340a38p-19, -0x0.cc8210b1ec6280p-21, -0x0.84145aa6ab15f0p-22, // x=     1.5 y=       2
+ 0x0.a6a9ed7cc1e040p-2, 0x0.cc7d3a02709670p-3, -0x0.dffb683eaace28p-4, 0x0.fc196de0b7ed60p-5, -0x0.d43e8495e20530p-10, -0x0.a3b40b6d41e830p-5, 0x0.ba865ae3e429c0p-7, 0x0.9e3ed82a650e20p-8, -0x0.b14fc4da7e40d8p-9, 0x0.a67c0c6ab34920p-9, -0x0.c836fa307b08d8p-12, -0x0.84bb0d95cd4018p-10, 0x0.a0f77ec68ca040p-12, 0x0.882b43964648a8p-18, -0x0.80b15d11e86a00p-15, 0x0.a5e85b8b00f508p-14, -0x0.914618086b9ce0p-16, -0x0.fa92f28734f450p-17, 0x0.ae213d89b75bf0p-18, -0x0.cc782349c4dd18p-19, 0x0.b10c1008688460p-22, 0x0.caf9ad1e9dab88p-20, -0x0.cfc5276dd74a20p-22, -0x0.94726fbed7d680p-25, // x=     1.5 y=    2.25
+ 0x0.9edf061631b3b8p-2, 0x0.b2e07c86776cd0p-3, -0x0.bb1e339ca029c0p-4, 0x0.f5b14e0cfed780p-5, -0x0.8f24e093410270p-8, -0x0.846381f8b2f630p-5, 0x0.94c729c634b030p-7, 0x0.af0548fa389010p-9, -0x0.dd56eed1007f30p-10, 0x0.87d22929b73348p-9, -0x0.bbfab66b4ca020p-12, -0x0.a85ab712b33110p-11, 0x0.cca4970ad0c2d0p-13, -0x0.f52c7d27505440p-16, -0x0.a94c0733556670p-17, 0x0.d49b4179c1ca60p-15, -0x0.bfb3f50fe6b7d8p-17, -0x0.df97e99099e280p-18, 0x0.a6876a06182560p-19, -0x0.9324835b4a16f8p-19, 0x0.afecde2d1bf2c0p-22, 0x0.c752ac43fe1a18p-21, -0x0.cf61917a65ad80p-23, 0x0.c73b1b87cc9350p-26, // x=     1.5 y=     2.5
+ 0x0.9759f33c7afa80p-2, 0x0.9d6b1a9d3503d0p-3, -0x0.9d41a8025d0ca0p-4, 0x0.eb1491ab6ca598p-5, -0x0.bef8a87a8876e0p-8, -0x0.d6e8a23b9b2798p-6, 0x0.eca7857fa42de0p-8, 0x0.ae268ec0df1d28p-10, -0x0.88d7b3b483e1b8p-10, 0x0.d9027e42360878p-10, -0x0.a08d71916f8aa0p-12, -0x0.d563f208c1c8a8p-12, 0x0.81d8dfae283c18p-13, -0x0.9f2d1896b94168p-15, -0x0.9d6bb5aeb9d4e8p-20, 0x0.870315b8a1af68p-15, -0x0.f6784ec71501b8p-18, -0x0.b84c9076e849a0p-19, 0x0.9b7fad8677ec10p-20, -0x0.c51cbaa2380260p-20, 0x0.8532a23671d588p-22, 0x0.c179f792c079f8p-22, -0x0.ccbc4b32bb6470p-24, 0x0.852924963549b0p-25, // x=     1.5 y=    2.75
+ 0x0.903348fe48a2b0p-2, 0x0.8b54c083c09e90p-3, -0x0.84f74e7ac88528p-4, 0x0.de5c982a3f0600p-5, -0x0.d4a96af9a39040p-8, -0x0.af3f9da8874780p-6, 0x0.bc48ac850f6a90p-8, 0x0.8436495dcc13b8p-11, -0x0.a69de2d7c6c2b8p-11, 0x0.ab80a9368007e8p-10, -0x0.82e6f4c4325f38p-12, -0x0.87226ebd491cc8p-12, 0x0.a4df4c7e7cd898p-14, -0x0.98ed3558d54f98p-15, 0x0.99154433916da0p-19, 0x0.aaee760a3ba4a8p-16, -0x0.9c6c4e2a63d4a8p-18, -0x0.fdaa5521020988p-21, 0x0.8ba7f061a2ff30p-21, -0x0.fee49b247b8050p-21, 0x0.b652a396a90188p-23, 0x0.b92705463fed30p-23, -0x0.c86f811b138330p-25, 0x0.d93b227cf76320p-26, // x=     1.5 y=       3
+ 0x0.89764b8cb81cc8p-2, 0x0.f7fc2829daa370p-4, -0x0.e2378e15ab4dd8p-5, 0x0.d0d3abc653a1d8p-5, -0x0.da6d8e29822c10p-8, -0x0.8fa98fd9b60e68p-6, 0x0.9628ebce7822c8p-8, 0x0.8360d6222f8f00p-17, -0x0.c5b9ece53a4c68p-12, 0x0.86e2c9c00e8148p-10, -0x0.d03bf9db6bab90p-13, -0x0.aad4853c9ea108p-13, 0x0.d1b5682de99c08p-15, -0x0.8398b84c8e9290p-15, 0x0.db87b7b03a06c0p-19, 0x0.d874934274a930p-17, -0x0.c57b498f6c74b8p-19, -0x0.a94f847db1dfb0p-23, 0x0.e97717d2976840p-23, -0x0.a1e36e0d0b75d8p-21, 0x0.edeed607235d78p-24, 0x0.ad7495e5d96778p-24, -0x0.c27fefeb98c908p-26, 0x0.99267fd76bcd28p-26, // x=     1.5 y=    3.25
+ 0x0.83262132ca8ab8p-2, 0x0.ddd054ef86eb30p-4, -0x0.c1928f976dc420p-5, 0x0.c340f2ee667490p-5, -0x0.d6bb7d00748370p-8, -0x0.ecdbb07619b308p-7, 0x0.f065e0afec3120p-9, -0x0.9394de126814a8p-12, -0x0.e0703dea6eb9a8p-13, 0x0.d3ef60ecd800e8p-11, -0x0.a37043963dab50p-13, -0x0.d70f7abd76de90p-14, 0x0.85a37c5ee6ca48p-15, -0x0.d6c547ecdac2b0p-16, 0x0.d8517671537c48p-19, 0x0.8959d819329b68p-17, -0x0.f912a7a5140fd0p-20, 0x0.a4ec987c0aafb8p-23, 0x0.a687fddac8f620p-24, -0x0.cbed308f2afff0p-22, 0x0.97861d5133b868p-24, 0x0.9ccc79148fe828p-25, -0x0.ba71fa4af7d678p-27, 0x0.ca74de40bcc538p-27, // x=     1.5 y=     3.5
+ 0x0.fa8237ea5acd60p-3, 0x0.c75b41e2427a60p-4, -0x0.a69659b39604c0p-5, 0x0.b618aee587e060p-5, -0x0.cda74161474218p-8, -0x0.c460118671bc30p-7, 0x0.c14d6ab66e2100p-9, -0x0.e6e15e990ee120p-12, -0x0.ea4747806b5ca0p-14, 0x0.a6b41f9be72358p-11, -0x0.fedd79185d78f0p-14, -0x0.865191626720e8p-14, 0x0.aa99768dded380p-16, -0x0.aa584f39219000p-16, 0x0.bbc55e206ab288p-19, 0x0.aedeec1189c9a0p-18, -0x0.9d5617123c1758p-20, 0x0.85a2c64409b690p-22, 0x0.882ecbec3374a8p-26, -0x0.801a09dbd0c218p-22, 0x0.be991976407a40p-25, 0x0.83e212dac197e0p-26, // x=     1.5 y=    3.75
+ 0x0.ef85997378c050p-3, 0x0.b3fa4b40896d10p-4, -0x0.9026f134463c30p-5, 0x0.a99aef7f28cb48p-5, -0x0.c1c00f6344c748p-8, -0x0.a3bee2e04db0e8p-7, 0x0.9c366e8c00fce8p-9, -0x0.87b9e6244bef60p-11, -0x0.ca01464cb8a000p-15, 0x0.837d11fce35c10p-11, -0x0.c63895e9f30b88p-14, -0x0.a586795fbc6290p-15, 0x0.d9e8a121e6fb90p-17, -0x0.850283e29eed50p-16, 0x0.9986ca690041c0p-19, 0x0.df707922981c50p-19, -0x0.c76d3a839d74f8p-21, 0x0.8762d67b3f5430p-22, -0x0.99d8ac3ed2ee00p-27, -0x0.a105a1572825f8p-23, 0x0.ee950a8d7bac80p-26, 0x0.c1112b3af2e9a8p-28, // x=     1.5 y=       4
+ 0x0.e54aa15e78eb70p-3, 0x0.a32a5f28e22aa0p-4, -0x0.fac961015c15c0p-6, 0x0.9de72610f09498p-5, -0x0.b49d00f5629038p-8, -0x0.894f5fe9475c68p-7, 0x0.fdd050f2aafa58p-10, -0x0.8ed718a99dabb8p-11, -0x0.9d4169f4f04008p-17, 0x0.d034c25cbe1b50p-12, -0x0.9a3031b8d8dda8p-14, -0x0.c763d360ac70c8p-16, 0x0.8b037ced306180p-17, -0x0.cdff057b58df88p-17, 0x0.f324fba766a200p-20, 0x0.8f3e9644290d60p-19, -0x0.fdd3e7300d7900p-22, 0x0.ed5600dde902e8p-23, -0x0.91974d72e41950p-26, -0x0.caf586d1953f20p-24, 0x0.9533d2cdd282f0p-26, 0x0.b251d7b3a0bad8p-30, // x=     1.5 y=    4.25
+ 0x0.dbc4411aa1d0a8p-3, 0x0.948151c89f1438p-4, -0x0.db3dcab5714458p-6, 0x0.9308a413c9ae80p-5, -0x0.a736c6dcb3a060p-8, -0x0.e78e4b6e7faf80p-8, 0x0.cf502da39bcbb0p-10, -0x0.8e02f6f5513640p-11, 0x0.e47d8c697fff38p-17, 0x0.a59186994057a8p-12, -0x0.f0534d56795068p-15, -0x0.e708e7afa501d0p-17, 0x0.b0b9d1d187d3f0p-18, -0x0.9ee9c1534c0f58p-17, 0x0.bd1dfb73d595c8p-20, 0x0.b834a17e549450p-20, -0x0.a2444b28f88730p-22, 0x0.c29bad6e8f17f8p-23, -0x0.9807ce7f7889b0p-26, -0x0.806d22d188ff80p-24, 0x0.baf5d6d8950268p-27, -0x0.ffcf3704a38800p-32, // x=     1.5 y=     4.5
+ 0x0.d2e51e953cafd0p-3, 0x0.87a8acc16099d0p-4, -0x0.c092c9b2726cb8p-6, 0x0.88fe94e0042970p-5, -0x0.9a21057f0be758p-8, -0x0.c449fe5e886fa8p-8, 0x0.aa403f1e5fc840p-10, -0x0.88924f3b886b18p-11, 0x0.dee1c936f7cc98p-16, 0x0.844b4c4cdb3988p-12, -0x0.bbdc496e1d62f0p-15, -0x0.f97415431d3638p-18, 0x0.df0c740bbb1b10p-19, -0x0.f4f7c0518a7898p-18, 0x0.91a504e99a2ea0p-20, 0x0.ed5c1a3c7bdee0p-21, -0x0.d068c3a8eb9210p-23, 0x0.99ff5a71a5fdd8p-23, -0x0.86ade1494b5ed0p-26, -0x0.a34e191d7a34d8p-25, 0x0.eb1a8d63267e58p-28, -0x0.90e185fe708b90p-30, // x=     1.5 y=    4.75
+ 0x0.caa02ae7778400p-3, 0x0.f8b34990345cd0p-5, -0x0.a9e8f775f1f8a0p-6, 0x0.ff8224bcd11220p-6, -0x0.8daf23518dbbf0p-8, -0x0.a7406a5b117358p-8, 0x0.8c90e5c43761c8p-10, -0x0.80a1b09c5d9d38p-11, 0x0.8b2c356ad3e148p-15, 0x0.d479bd76d7f498p-13, -0x0.93685aece45250p-15, -0x0.e7f896758c5250p-19, 0x0.8afea0c123a930p-19, -0x0.bd026191a59650p-18, 0x0.df364ab21e7100p-21, 0x0.99085e2e99d378p-21, -0x0.86679f4dad5a80p-23, 0x0.eede4b5f08d460p-24, -0x0.dda78909d72cc8p-27, -0x0.d0b848b6766dc0p-26, 0x0.9480314f23d9c8p-28, -0x0.9bb6870b3a7ba0p-30, // x=     1.5 y=       5
+ 0x0.c2e8f7b119e8e0p-3, 0x0.e4b3e4f7ccdc50p-5, -0x0.968d6d2ced2640p-6, 0x0.ee88bb4105e070p-6, -0x0.820bf689394a38p-8, -0x0.8f373d9f225f10p-8, 0x0.e9568b3c850c80p-11, -0x0.ef0927ff27c750p-12, 0x0.9653b44dbb9c48p-15, 0x0.ab806226302530p-13, -0x0.e8539541429f58p-16, -0x0.86285b3f54fd58p-20, 0x0.a9a4917a5b42d0p-20, -0x0.922cf23fa87e30p-18, 0x0.aabb2c8c845628p-21, 0x0.c51b529d0fb130p-22, -0x0.adff707b98caa8p-24, 0x0.b72683a6f42bf0p-24, -0x0.af683a42e61300p-27, -0x0.8612880ea2ccf8p-26, 0x0.bc92ac450ac640p-29, -0x0.8b496ef7cc4e90p-30, // x=     1.5 y=    5.25
+ 0x0.bbb3e33116e1d0p-3, 0x0.d2f2b4e900f630p-5, -0x0.85f02c81bd4c00p-6, 0x0.def5c9dddc10a8p-6, -0x0.ee920daf6cab18p-9, -0x0.f66ebc05f5df98p-9, 0x0.c2aa41c3dfc9b0p-11, -0x0.dc19ace2493708p-12, 0x0.975aad17ca0e78p-15, 0x0.8b243543d035d8p-13, -0x0.b7ed6c0bdc7a68p-16, 0x0.806651f575ab30p-21, 0x0.c7ef687b900c00p-21, -0x0.e2d3a1658d76f8p-19, 0x0.829fa606c042f0p-21, 0x0.fcf533243f5018p-23, -0x0.e1e7baaa763b58p-25, 0x0.8b91af38182a70p-24, -0x0.87c11ad3546438p-27, -0x0.ad1b14f9c760d8p-27, 0x0.f0c61bb9ce0cc8p-30, -0x0.e5f8f5590173c0p-31, // x=     1.5 y=     5.5
+ 0x0.b4f62a9cfaa5c8p-3, 0x0.c31f790c383fb8p-5, -0x0.ef396ea495f9c0p-7, 0x0.d0ad0896f73720p-6, -0x0.dad0c459777b90p-9, -0x0.d4fb58524d5b38p-9, 0x0.a3363200899360p-11, -0x0.c971be174b0338p-12, 0x0.92670e0490fae8p-15, 0x0.e2ed97e3e83d38p-14, -0x0.924f1814df89f0p-16, 0x0.b2373c89ac3c50p-20, 0x0.dd8ef1989cafa0p-22, -0x0.b0a8d09e8bba58p-19, 0x0.c836b07a73e310p-22, 0x0.a12c72420a6778p-23, -0x0.92ea448f512138p-25, 0x0.d42212a7df3288p-25, -0x0.cf703224d88260p-28, -0x0.e08a47a1681080p-28, 0x0.9a91243a4f3980p-30, -0x0.b5fe5dbc8d7f20p-31, // x=     1.5 y=    5.75
+ 0x0.aea5ecb4721088p-3, 0x0.b4f717261afa18p-5, -0x0.d668a65c017c70p-7, 0x0.c3928d7f140698p-6, -0x0.c8c5de73a53650p-9, -0x0.b8deb6078f8eb0p-9, 0x0.8980154f085468p-11, -0x0.b7a308d5655c98p-12, 0x0.8a20610507abc8p-15, 0x0.b9fb331e361690p-14, -0x0.e9e79a3dbeaf70p-17, 0x0.ee7a5081b062f8p-20, 0x0.d90a599a922720p-23, -0x0.8a2a80c32c1680p-19, 0x0.99d9339f677a70p-22, 0x0.caed2f95588630p-24, -0x0.bf2b70817d18a0p-26, 0x0.a1228144f000e8p-25, -0x0.9d5846f1954598p-28, -0x0.9239fc9e867420p-28, 0x0.c788347c96a098p-31, -0x0.8c962c4e55ce98p-31, // x=     1.5 y=       6
+ 0x0.a8ba22fd7a5b90p-3, 0x0.a8412cec695ae8p-5, -0x0.c0d32863dd7e18p-7, 0x0.b78bac0b0068a0p-6, -0x0.b858f2a4625ce8p-9, -0x0.a12205630aee58p-9, 0x0.e8c18811007138p-12, -0x0.a6faeea5f81138p-12, 0x0.80359a9593ac88p-15, 0x0.992c56f34fca90p-14, -0x0.bbe33e95781a48p-17, 0x0.8470d4012856e0p-19, 0x0.97c7500b2decd0p-24, -0x0.d914fa86afd760p-20, 0x0.ed3b2fc74e3e80p-23, 0x0.fa888ed685c460p-25, -0x0.f8689966203648p-27, 0x0.f50e21764dd098p-26, -0x0.ee2989c1e4e160p-29, -0x0.beaaedd97785e0p-29, // x=     1.5 y=    6.25
+ 0x0.a32a95c5ee7120p-3, 0x0.9cce2020295848p-5, -0x0.adf9c58bdfb3e0p-7, 0x0.ac7f6c44a61ed8p-6, -0x0.a96c833809d608p-9, -0x0.8cff8e845cf5a8p-9, 0x0.c5e1e69e24d578p-12, -0x0.979bc68f2eded0p-12, 0x0.eb67fc55e38eb0p-16, 0x0.fd83fbcf7fafa0p-15, -0x0.97a87c5a95dce0p-17, 0x0.872e95e83f9b50p-19, -0x0.a15ef11c651a20p-27, -0x0.ab51b47ee7c1c0p-20, 0x0.b7991c1e4c5c20p-23, 0x0.95c677c55b1fa0p-25, -0x0.a0c87b9d603620p-27, 0x0.babd5b0d5e3c10p-26, -0x0.b3bf9b8ec91328p-29, -0x0.f9c5eb05ecdf18p-30, // x=     1.5 y=     6.5
+ 0x0.9defcd86913a78p-3, 0x0.9275915dd01338p-5, -0x0.9d73842dcbbe40p-7, 0x0.a256c0563e18f8p-6, -0x0.9be133f34aeca0p-9, -0x0.f7b04ea58b0f50p-10, 0x0.a8f524328e50f8p-12, -0x0.898d48b9992e48p-12, 0x0.d67f866198e618p-16, 0x0.d2c5dfa0cb3630p-15, -0x0.f6012aa1a6ce80p-18, 0x0.83a8b6358dd648p-19, -0x0.f16083615a1880p-25, -0x0.87d56414469000p-20, 0x0.8eac7aca912368p-23, 0x0.a980a1adcd2338p-26, -0x0.ceaca21c771618p-28, 0x0.8eb66cecff2f28p-26, -0x0.87bb2e91bae148p-29, -0x0.a3d3d371452400p-30, // x=     1.5 y=    6.75
+ 0x0.f38aaf83a802c8p-5, 0x0.bdea06d35c7678p-1, -0x0.e452048b6d82a0p-3, -0x0.8672af90474e80p-1, 0x0.b79b8e5241a5e8p-2, 0x0.f8b4096ca4f240p-3, -0x0.99671b0dad7f60p-2, 0x0.be9876e3bca088p-5, 0x0.d00b88cee493e8p-4, -0x0.a905c093afd6d0p-3, 0x0.b2d23c8e4121e0p-5, 0x0.d76a22b19431a0p-4, -0x0.fa75c1311b0f20p-5, -0x0.af9eaa8da72028p-7, 0x0.a62a9af42d9148p-6, -0x0.c725aa3274ddf0p-6, 0x0.bd5bea2bd72e98p-8, 0x0.e69b0880a098c8p-7, -0x0.e29b2403cf0e80p-8, -0x0.f251538dc49920p-12, 0x0.bc4a6ead0f9dc0p-10, -0x0.ad28218cf87830p-9, 0x0.c9bae8a0d649a0p-11, 0x0.80953674a900d8p-10, -0x0.f6062b1d20aaa0p-12, 0x0.92498c3df52000p-13, 0x0.ab921c7f679050p-18, -0x0.b1f0362dd44598p-13, 0x0.9d563dfcf127e0p-15, 0x0.a96a7d4dd88cb0p-17, // x=    1.75 y=       0
+ 0x0.d6d6df89f34170p-3, 0x0.a30fa52f1afe08p-1, -0x0.9e3b6b5bff9da8p-2, -0x0.941016a45ece80p-2, 0x0.85bdf109e21970p-2, 0x0.ad528587ba23f8p-6, -0x0.ebecc3e39a8dd0p-4, 0x0.ceedd6f205e1e0p-4, -0x0.f02a4420466b90p-9, -0x0.ab6ce5792fcdc8p-4, 0x0.9491eca9a3cda8p-5, 0x0.bbb15695ba8220p-6, -0x0.983e7a2aa73168p-6, 0x0.943bc15ddbe528p-7, 0x0.934db6cc940de8p-11, -0x0.9a0a3ee39338d8p-7, 0x0.e5760155126bd8p-9, 0x0.8923a24372ea48p-9, -0x0.b8ba5deba550c0p-10, 0x0.f2a5429c662728p-11, -0x0.d6983aec955a48p-14, -0x0.acfe840eae9588p-11, 0x0.810c141f105d38p-12, 0x0.857c610db88058p-14, -0x0.ea6416ace886f0p-15, 0x0.9cae5756789ba0p-14, -0x0.923fef6e1c4290p-16, -0x0.ebc64a87288470p-16, 0x0.bc4b2d8ef65ef0p-17, -0x0.8cbeaea53fca00p-19, // x=    1.75 y=    0.25
+ 0x0.88de3bc53dc4e0p-2, 0x0.8f54446012d638p-1, -0x0.9aeeb533788ab8p-2, -0x0.b52feeece742f0p-3, 0x0.c204baa277f498p-3, -0x0.9fb33c0f0c37f8p-5, -0x0.d253e2756f5000p-5, 0x0.b3b6a8933805b8p-4, -0x0.9d114f35a916f0p-6, -0x0.bf62a747d02580p-5, 0x0.be5ec3557ccb80p-6, 0x0.9b369d9cbb2100p-8, -0x0.ea2a7338877308p-8, 0x0.feb5f8cbf331f0p-8, -0x0.ba8b1d7da26be8p-10, -0x0.8afbcb748ace68p-8, 0x0.eabe49e0335a90p-10, 0x0.8c1f85297ee6e8p-12, -0x0.cdf5ff40a037a8p-12, 0x0.98aedf5ef7e6f8p-11, -0x0.90c7be8b095320p-13, -0x0.e994c650199ee0p-13, 0x0.c369b71e241e60p-14, -0x0.ef5f05c45af3c0p-17, -0x0.fece549a16ff98p-18, 0x0.85b5e793b33090p-15, -0x0.97f16dbef4b1f0p-17, -0x0.d46de53426bf00p-18, // x=    1.75 y=     0.5
+ 0x0.9a1d90de6af610p-2, 0x0.f9803c5741b020p-2, -0x0.8d4e75a95e2688p-2, -0x0.c77b2eef2a9f50p-4, 0x0.866532f5a87ea0p-3, -0x0.81675d8bcd4f00p-4, -0x0.8aa0462587ba78p-6, 0x0.89f298c4edce88p-4, -0x0.a635febad292c0p-6, -0x0.c5d8e31a75c6e0p-6, 0x0.ddb9640a22e4f8p-7, -0x0.e2830f2a7607a8p-10, -0x0.901d45082a7228p-9, 0x0.a9d98426d1a5f0p-8, -0x0.b68a4d6829c3f0p-10, -0x0.e3304fc2c80768p-10, 0x0.d7d9cab30c9d88p-11, -0x0.bb64eea5002dd8p-13, -0x0.8f589724a860e0p-14, 0x0.9d0b459f466628p-12, -0x0.b5ad533c998c70p-14, -0x0.878533e0289a68p-14, 0x0.84df9500af1fe8p-15, -0x0.9c712354c6f040p-16, 0x0.f414001ecd3098p-20, 0x0.c8f6176c7b65e8p-17, -0x0.fdca044c3296e8p-19, -0x0.e37074680539d0p-21, // x=    1.75 y=    0.75
+ 0x0.a2e1f0e8fd22f0p-2, 0x0.d84a1aa3cfb458p-2, -0x0.f85116f243da60p-3, -0x0.b0e36f0eecbd30p-5, 0x0.b42863f024bcd8p-4, -0x0.8c9cbed02834b0p-4, 0x0.dd7a75721fafb8p-13, 0x0.c7383bd4cb3c20p-5, -0x0.89d0ca2d1ae538p-6, -0x0.ba9238a59a1678p-7, 0x0.f2c3a3adcb8688p-8, -0x0.db27fd2524c0f8p-9, -0x0.910b832047d680p-12, 0x0.cba939a735bec8p-9, -0x0.fe303b2d1a58a8p-11, -0x0.a2a4377180ec70p-11, 0x0.b713b880800018p-12, -0x0.dfbabc55214350p-13, 0x0.8b9a0f10060150p-16, 0x0.924085a3772e30p-13, -0x0.bb783ef690b308p-15, -0x0.e062f12cd598a8p-17, 0x0.9ef2a9eeaa71e0p-17, -0x0.c39493e8319458p-17, 0x0.995ccbdd69e868p-19, 0x0.893b98200f1c98p-18, // x=    1.75 y=       1
+ 0x0.a5f3d89f6a8e58p-2, 0x0.bb6d02a150b5a8p-2, -0x0.d5cd4a346344a0p-3, -0x0.f06260ab3556f8p-8, 0x0.ea93fef026e4d8p-5, -0x0.8593f7212199b0p-4, 0x0.80175de069fcf0p-7, 0x0.8af272da4a2070p-5, -0x0.cf232a0a655a58p-7, -0x0.959ac570b0e178p-8, 0x0.fbe6a855de1400p-9, -0x0.d126f402006ea8p-9, 0x0.b711a2baea8748p-12, 0x0.e600f34a22b920p-10, -0x0.9c34ba8821f1e8p-11, -0x0.ad7224c78f6890p-13, 0x0.8dbacf62da8700p-13, -0x0.a3ebe4f14f31b0p-13, 0x0.edac43cb1b0c00p-16, 0x0.fe2671c449b7b0p-15, -0x0.b01c2cd2dbd2c0p-16, 0x0.c9b4f634e98178p-21, 0x0.932f49d751e960p-19, -0x0.ca29331de903b0p-18, 0x0.bf96ca66463328p-20, 0x0.a82b7475b7c3e0p-20, // x=    1.75 y=    1.25
+ 0x0.a54e7892b0c450p-2, 0x0.a2b7c0989309f0p-2, -0x0.b622246c71ffa8p-3, 0x0.805b9f7c0f7fd8p-6, 0x0.93d6be2c9d72f8p-5, -0x0.ee35fd8801d990p-5, 0x0.ab508302fa0ef0p-7, 0x0.bda348cb4fd190p-6, -0x0.941fa0e1a3a408p-7, -0x0.92bcbefce91050p-10, 0x0.f527d91bfb4dc8p-10, -0x0.a6b17f07876720p-9, 0x0.f4c1eed5e453d0p-12, 0x0.f8f911b27713b8p-11, -0x0.b41bde7ee44860p-12, 0x0.9e85137fd65f88p-20, 0x0.bbe7d4b155d318p-15, -0x0.ce6e13697d5710p-14, 0x0.b99fae7f50cea0p-16, 0x0.ce2325a3deb450p-16, -0x0.9b8d01fa639c60p-17, 0x0.dc1ef04e2eb930p-19, 0x0.e4f2f7b5eb7ad0p-24, -0x0.bf0acebf001fb8p-19, 0x0.c664328582f8a8p-21, 0x0.a84500aed41cb8p-22, // x=    1.75 y=     1.5
+ 0x0.a25073f90c8600p-2, 0x0.8dba21630ae1b0p-2, -0x0.9a676b650c5060p-3, 0x0.f4e23f74f16898p-6, 0x0.b230425634f9f8p-6, -0x0.cd5d81201d04a0p-5, 0x0.aeada3686dd148p-7, 0x0.fed7e082757018p-7, -0x0.ce11521b9badd0p-8, 0x0.80dd69404fbec8p-11, 0x0.d71d18f9920dc8p-11, -0x0.f59eac60656650p-10, 0x0.d815fd15199c20p-12, 0x0.819faf71b9f7e0p-11, -0x0.c7997ce44c2230p-13, 0x0.d0860b93c239f8p-15, 0x0.9f4a94f62ce3d8p-17, -0x0.f1fdc90ff9a8b8p-15, 0x0.efff6acde5d9e0p-17, 0x0.97977bce94e840p-17, -0x0.8204d8a5553390p-18, 0x0.bafce9c7387a98p-19, -0x0.b12b47c5d3a090p-22, -0x0.aaae954244b990p-20, 0x0.bc5717640229f8p-22, 0x0.9a6c13f0878920p-25, // x=    1.75 y=    1.75
+ 0x0.9de79792089ad0p-2, 0x0.f7e4e1cc8bd9a8p-3, -0x0.82bc3121ee2c28p-3, 0x0.9c834423e089a8p-5, 0x0.c77692e9ca64b8p-7, -0x0.adca05550bf160p-5, 0x0.a05fb6391681e8p-7, 0x0.a9016a29063b10p-7, -0x0.8d0706fdaa4990p-8, 0x0.95e82c37d385f8p-10, 0x0.953a342d48d500p-12, -0x0.adc129e854f088p-10, 0x0.a6932344ff6680p-12, 0x0.80cec8da296c18p-12, -0x0.d6ac31a260d008p-14, 0x0.e3809be15ff210p-15, -0x0.b08ade2f0c4ee0p-19, -0x0.882ade3185e948p-15, 0x0.8ed2d98c559b58p-17, 0x0.b63f0d9f02fb68p-19, -0x0.caf1b76eb85f70p-20, 0x0.f92ee58651d748p-20, -0x0.a8b524784020f0p-22, -0x0.91589c056c1478p-21, // x=    1.75 y=       2
+ 0x0.98b2d72a9fb7c8p-2, 0x0.d9c6208059ada8p-3, -0x0.dda066bc07d2e8p-4, 0x0.ae86c8ac406608p-5, 0x0.c0172429c45850p-8, -0x0.919b52473a4c18p-5, 0x0.8bc6a4384876c0p-7, 0x0.dd1db9ef78a410p-8, -0x0.bf197264180660p-9, 0x0.aca6931af2c7a0p-10, 0x0.d897421a34de38p-16, -0x0.f05eb02a683cd8p-11, 0x0.f11ab865850578p-13, 0x0.ee2dc5d98be1d8p-14, -0x0.e059e369195c68p-15, 0x0.bd374aae4ccca0p-15, -0x0.bcbe96d6c11398p-18, -0x0.9526cc1b641438p-16, 0x0.a29ce79d757a30p-18, 0x0.bd0d84650310d0p-22, -0x0.8cf27b28982fc8p-21, 0x0.9698687882ce70p-20, -0x0.e935b968360100p-23, -0x0.eb74e74ea36db0p-23, // x=    1.75 y=    2.25
+ 0x0.931b0b05763cf0p-2, 0x0.c036e89e9accb0p-3, -0x0.bc551ad0942d18p-4, 0x0.b6073054bedc10p-5, 0x0.e735681dd865f8p-10, -0x0.f2d4a0a48e4538p-6, 0x0.ecd008fcf507d8p-8, 0x0.8e2ec3e5bec338p-8, -0x0.8098a8a6adc6a8p-9, 0x0.a6317756e27858p-10, -0x0.b80ba7f7fe0c08p-14, -0x0.a42b7b25788da0p-11, 0x0.a8c44e48a623d8p-13, 0x0.bf0ce71f1046c0p-15, -0x0.e25f7de607b6c8p-16, 0x0.8dd783352746f8p-15, -0x0.b5042e90dfb368p-18, -0x0.9fe38e3cd43e90p-17, 0x0.b43640ce52d0b8p-19, -0x0.d5483e8b95fbb0p-22, -0x0.92b66baac30a58p-23, 0x0.ad304ca5038630p-21, -0x0.8f5975af895038p-23, -0x0.b09c7e80f03d00p-24, // x=    1.75 y=     2.5
+ 0x0.8d64532c2bbff8p-2, 0x0.aa759a822d2830p-3, -0x0.a0986ebd88f150p-4, 0x0.b6c3a0f4b50168p-5, -0x0.dd22d6c504a7c8p-11, -0x0.ca317623692f88p-6, 0x0.c56c2fba5706f0p-8, 0x0.b2689a18f8b2a8p-9, -0x0.ac204241baf268p-10, 0x0.93d97dbd041778p-10, -0x0.860983c8b12350p-13, -0x0.dead358bcd38c0p-12, 0x0.e7f54e2c33c400p-14, 0x0.c8851ec5a35400p-17, -0x0.d8a708e7f1f000p-17, 0x0.ca174bbfd69c40p-16, -0x0.8fb5bcd90cb9d8p-18, -0x0.a7be005834fe38p-18, 0x0.c3fff769c512d8p-20, -0x0.8f6f43d94cbc08p-21, 0x0.ec1e0fc5a0b5c8p-30, 0x0.c18ce31ede7b98p-22, -0x0.a675f5a486c4d0p-24, -0x0.e3c07fa771c128p-26, // x=    1.75 y=    2.75
+ 0x0.87ba136ebf0710p-2, 0x0.97df613d5f8c68p-3, -0x0.897ee3fe070ee8p-4, 0x0.b340224b4e3ea0p-5, -0x0.a0c5952093cec8p-9, -0x0.a879689e099398p-6, 0x0.a326954fad32b0p-8, 0x0.d75b3e19f783b0p-10, -0x0.e5191383466ce8p-11, 0x0.fc692b0bf5bac8p-11, -0x0.8afb3236463f90p-13, -0x0.96710cc0190f58p-12, 0x0.9dd07dac2dad68p-14, -0x0.ee4ff47dabff48p-19, -0x0.bc661bb27f0c10p-18, 0x0.8c118b01002f18p-16, -0x0.d2769e8009c938p-19, -0x0.ab4e1adf37d570p-19, 0x0.d1da8bd11624e8p-21, -0x0.fbd3fcafddcf48p-22, 0x0.afab6bffc39448p-25, 0x0.d4698e506aa1b0p-23, -0x0.bb4d4694d3fda0p-25, -0x0.b6f4fe439346f0p-28, // x=    1.75 y=       3
+ 0x0.82371ec1135250p-2, 0x0.87ed0689d1e6f0p-3, -0x0.ec75ea17204a08p-5, 0x0.ad2ac1b7d6f568p-5, -0x0.deb9150c88b710p-9, -0x0.8cac9ea3db5c00p-6, 0x0.8641a48b20c170p-8, 0x0.f304e867413f10p-11, -0x0.9761dfcc2649e8p-11, 0x0.d27f2306af4750p-11, -0x0.ff4e880bd3ef00p-14, -0x0.cadb246ad97c50p-13, 0x0.d5a75a6ec57908p-15, -0x0.a4460bf7b90b40p-17, -0x0.82b61026669d68p-19, 0x0.bf40ab8a501a98p-17, -0x0.93ddd3cf5710a8p-19, -0x0.a81304eb6749a0p-20, 0x0.dd09ce2cb19110p-22, -0x0.c0b202dca3d940p-22, 0x0.bd05b38edeca58p-25, 0x0.e613a09dd1d200p-24, -0x0.ced0c5d55649d8p-26, 0x0.f27cfce239fc70p-30, // x=    1.75 y=    3.25
+ 0x0.f9d680411f1850p-3, 0x0.f45e07412790a8p-4, -0x0.cc3e1aa014bb40p-5, 0x0.a5a0e2bc085bb8p-5, -0x0.ffe592eb735b50p-9, -0x0.eba25c7a4e9a48p-7, 0x0.dca9405e35da48p-9, 0x0.ef13f78c345f60p-12, -0x0.c60ae666a3df38p-12, 0x0.ad36751db846b0p-11, -0x0.dd113629e691d0p-14, -0x0.8893bc6c8da5d8p-13, 0x0.905330bb3c8d80p-15, -0x0.c0735ac8690fd0p-17, -0x0.d2df8c29c0b758p-23, 0x0.818880e3707a50p-17, -0x0.cb207fa9eb5d30p-20, -0x0.99eaf108f89680p-21, 0x0.e3f150a2188d48p-23, -0x0.8a58b0d4943cc0p-22, 0x0.9bd43a4de5cdc8p-25, 0x0.f5e165f328cc38p-25, // x=    1.75 y=     3.5
+ 0x0.efbdee9d350f50p-3, 0x0.dc93407a417d38p-4, -0x0.b13693cf24d0d0p-5, 0x0.9d5e57e6ded428p-5, -0x0.871e858e7dfcb8p-8, -0x0.c60fa40ad87c98p-7, 0x0.b570d76b06d3b0p-9, 0x0.9d2e74d271bef0p-13, -0x0.ff2a4405c519e8p-13, 0x0.8d7bb777fda308p-11, -0x0.b94d491b6430d0p-14, -0x0.b7a20a99c95d90p-14, 0x0.c2ecb565a90ba8p-16, -0x0.b95bcc4d54f8b0p-17, 0x0.97b24b2e4e8cb8p-21, 0x0.aed361fab02998p-18, -0x0.89cd514bbffc28p-20, -0x0.f4773a8ba6cad0p-23, 0x0.e3ea126450c180p-24, -0x0.c00df31b6636a0p-23, 0x0.e76412c1522678p-26, 0x0.81facdfce3c540p-25, // x=    1.75 y=    3.75
+ 0x0.e62bfb2640c4d8p-3, 0x0.c7e2eeeb82d758p-4, -0x0.9a73510fdca780p-5, 0x0.94dd40b0882ab8p-5, -0x0.88384e189d4948p-8, -0x0.a72423025b2f40p-7, 0x0.9577f822254418p-9, -0x0.be155ca0e0f448p-15, -0x0.a085ac394ae880p-13, 0x0.e64d32cd27d0c0p-12, -0x0.986cc9aeeb3b18p-14, -0x0.f65467e1893a50p-15, 0x0.83b6fb22a47698p-16, -0x0.a40d1a60ba0f28p-17, 0x0.dee52223ff0e28p-21, 0x0.ebbc133fb65178p-19, -0x0.b9cb2c94b6c4e0p-21, -0x0.fa84f4510b0148p-25, 0x0.d86613b5cebf48p-25, -0x0.82d6e4b7e1bd78p-23, 0x0.a34eca37a39730p-26, 0x0.872a813fed4118p-26, // x=    1.75 y=       4
+ 0x0.dd21ef367af178p-3, 0x0.b5d0fb27306688p-4, -0x0.8733d903652398p-5, 0x0.8c6b906c7cd5f8p-5, -0x0.857f70c75fd7f8p-8, -0x0.8da33eabc18a48p-7, 0x0.f6ee3ddafe5a78p-10, -0x0.ae3b94a122c988p-13, -0x0.c24c3129dfcb10p-14, 0x0.bb3b3b2b701410p-12, -0x0.f806c4d46c6258p-15, -0x0.a492fc56dd8298p-15, 0x0.b22d59de1491e0p-17, -0x0.8ae0d97beeff50p-17, 0x0.e68abff0aaaf30p-21, 0x0.9f0caffd1b9640p-19, -0x0.f9dd81bd17aaf8p-22, 0x0.a47eb9fa7232a8p-26, 0x0.ba358f1d2a3808p-26, -0x0.b078ee8d740230p-24, 0x0.e03f0899695830p-27, 0x0.89223b846ad448p-27, // x=    1.75 y=    4.25
+ 0x0.d49d31cb1af310p-3, 0x0.a5f70b5ee92da0p-4, -0x0.edb7311574e3b8p-6, 0x0.843998e27ce260p-5, -0x0.8075308664fef8p-8, -0x0.f1139f26f1a8d8p-8, 0x0.cca4a8a488b938p-10, -0x0.f8d5051be81e00p-13, -0x0.dbb210f0e2bfc0p-15, 0x0.984dbbaab1bfe0p-12, -0x0.c8913ba73b0fe0p-15, -0x0.da81e35f4371a0p-16, 0x0.f13ab2a669a250p-18, -0x0.e53660c614ad88p-18, 0x0.d2930cee26bc40p-21, 0x0.d6fdb74bb2efa8p-20, -0x0.a7fef8b4970aa0p-22, 0x0.d64ec60eabbf40p-25, 0x0.fc240abb9bb260p-28, -0x0.ecd821eaed7af8p-25, 0x0.979d71e5e16138p-27, 0x0.85a54d3976c2f0p-28, // x=    1.75 y=     4.5
+ 0x0.cc98cddd867c30p-3, 0x0.980073e30fb1e0p-4, -0x0.d1d6785e5e73f8p-6, 0x0.f8c7bd3d887260p-6, -0x0.f434957a4cd258p-9, -0x0.ce0b1e4e48a260p-8, 0x0.aa37efa6aa00e0p-10, -0x0.9069fdb7ee8780p-12, -0x0.d81c7381f1dab0p-16, 0x0.f835df6b76a9c8p-13, -0x0.a1b6b4be6d8718p-15, -0x0.8f989d14d7b798p-16, 0x0.a3577a08e78a68p-18, -0x0.ba4f4375a1ffb8p-18, 0x0.b4fe3fad9ed930p-21, 0x0.91a0b04c81b088p-20, -0x0.e2397df927a4d0p-23, 0x0.f820a4210a3ae0p-25, 0x0.936b3d026f1518p-31, -0x0.9eabfb30459b50p-25, 0x0.cb560cabc077d0p-28, 0x0.f24a3ba017e340p-30, // x=    1.75 y=    4.75
+ 0x0.c50e768ff5c128p-3, 0x0.8ba6eb36e94ef8p-4, -0x0.b9f639136efce0p-6, 0x0.e9f37eb60a35d0p-6, -0x0.e63100b24cd9a0p-9, -0x0.b0d957b57e4358p-8, 0x0.8e228931f7bf20p-10, -0x0.99098674f742f0p-12, -0x0.8cbd07bcdcfe00p-17, 0x0.cac35af2dd2980p-13, -0x0.8247e744baaab0p-15, -0x0.b9c46dacbb8e48p-17, 0x0.dd0cd039b71ef8p-19, -0x0.961793097f4248p-18, 0x0.9660ebcd426938p-21, 0x0.c5c07ab9e3b050p-21, -0x0.98ae4f1a4e7cc8p-23, 0x0.ed0c0e22fef238p-25, -0x0.a3f2cc001aaa50p-29, -0x0.d4b4c0269d2950p-26, 0x0.87d58e0ea2be40p-28, 0x0.bc1fb45876a820p-31, // x=    1.75 y=       5
+ 0x0.bdf73341213650p-3, 0x0.80afe048a372b8p-4, -0x0.a56d556e7018b8p-6, 0x0.dc03e4e7b1bc38p-6, -0x0.d7bd5be4e18418p-9, -0x0.986c8c8d821c00p-8, 0x0.ee522cd3d7d9a0p-11, -0x0.9a4c3698df2300p-12, 0x0.b74465bcf33990p-19, 0x0.a6244d5173c8e8p-13, -0x0.d20d0f0ec3d600p-16, -0x0.ea64ea84de64f8p-18, 0x0.9540e1042c7d88p-19, -0x0.f0a2747ee63838p-19, 0x0.f4e84ded360c20p-22, 0x0.868fa5b0e3fc78p-21, -0x0.ceb21c09eae3f8p-24, 0x0.d030b150b299a0p-25, -0x0.e79cb9cc6edd18p-29, -0x0.8ed74de66e4740p-26, 0x0.b550a106932918p-29, 0x0.aefd4969087bb0p-33, // x=    1.75 y=    5.25
+ 0x0.b74bcffc12dac8p-3, 0x0.edd4a9a7f71730p-5, -0x0.93b17646fe19f0p-6, 0x0.cefb2a000f9ba0p-6, -0x0.c967aed914d270p-9, -0x0.83e82302d880c8p-8, 0x0.c89c2b27e084e0p-11, -0x0.96e87103e9ef30p-12, 0x0.a18593d1910908p-17, 0x0.88991e9440d500p-13, -0x0.a99ce633ac1990p-16, -0x0.8df576b1357b48p-18, 0x0.c8b679a4e11b60p-20, -0x0.c073904e1f1b20p-19, 0x0.c504c159301228p-22, 0x0.b7732a467bc0d0p-22, -0x0.8c5ad2ac498140p-24, 0x0.aed3a3748e9bd0p-25, -0x0.ec2c4a4d028620p-29, -0x0.c06288616bae88p-27, 0x0.f242dfb8bb6e08p-30, -0x0.acaeb5ad26d7f0p-34, // x=    1.75 y=     5.5
+ 0x0.b105258e097728p-3, 0x0.dc5a44dd3f76b0p-5, -0x0.84511455c890e0p-6, 0x0.c2d4726797faa0p-6, -0x0.bb883176b648f0p-9, -0x0.e53446260c8100p-9, 0x0.a98d08ce2cf090p-11, -0x0.90b245ea87d660p-12, 0x0.e594feeabec5f0p-17, 0x0.e16e99a32551b0p-14, -0x0.8948ac1cb67f88p-16, -0x0.9ffc2e35b50368p-19, 0x0.8603070573f440p-20, -0x0.99d6417fc82e18p-19, 0x0.9d5af1bacd7018p-22, 0x0.fa6009f6ba5918p-23, -0x0.bf38c721457f18p-25, 0x0.8f0363ef9f4f18p-25, -0x0.d5b0b7d158b4e8p-29, -0x0.81fda414797878p-27, 0x0.a235fb21a9b358p-30, -0x0.bb51f68c3e74e8p-33, // x=    1.75 y=    5.75
+ 0x0.ab1c465cfd3938p-3, 0x0.ccab2a5a6a94f8p-5, -0x0.eddd627cf2e578p-7, 0x0.b78693cb5e6ef8p-6, -0x0.ae52eaa91d5d50p-9, -0x0.c7e5619bf2d9f8p-9, 0x0.8fe02039ddb1e8p-11, -0x0.88e38ae3d757d8p-12, 0x0.84e94de3254200p-16, 0x0.bab84d0bde0f78p-14, -0x0.dede7aea2ec618p-17, -0x0.9b439dd48fea98p-20, 0x0.b0f96867d49568p-21, -0x0.f61fa5b49d9cd0p-20, 0x0.fa5baf4c40b530p-23, 0x0.aae2476310be78p-23, -0x0.82a78fa57b1398p-25, 0x0.e646c0b723de48p-26, -0x0.b6b2e3534a6c88p-29, -0x0.b01222667df120p-28, // x=    1.75 y=       6
+ 0x0.a58a98ea4e8598p-3, 0x0.be8c9590b0f498p-5, -0x0.d67a0b17269608p-7, 0x0.ad05f1f1f54ef8p-6, -0x0.a1e3b432214828p-9, -0x0.aefa6b6a16f778p-9, 0x0.f523b276cc47f0p-12, -0x0.804cdcdb91abf0p-12, 0x0.8c8597d45518c8p-16, 0x0.9b3fcf6e257168p-14, -0x0.b57b954f854cb0p-17, -0x0.bd3e30f2aab9a8p-22, 0x0.e5b6cac68cb330p-22, -0x0.c53550ee5fd880p-20, 0x0.c6d0153fa98d28p-23, 0x0.e90068fe505768p-24, -0x0.b304d4486e0fc8p-26, 0x0.b79748417bfcd0p-26, -0x0.967c3fbfc58630p-29, -0x0.efaf7395121958p-29, // x=    1.75 y=    6.25
+ 0x0.a049e61678b738p-3, 0x0.b1cc910ef3bfc0p-5, -0x0.c1f7e52bd43ee0p-7, 0x0.a345bbcc4db7b8p-6, -0x0.96466d895eeff8p-9, -0x0.99b5d8de513d38p-9, 0x0.d1a4c7002eb230p-12, -0x0.eeee16255acf40p-13, 0x0.8d4e6e77198e60p-16, 0x0.8194aaa8b39208p-14, -0x0.944976f05fb568p-17, 0x0.af9de111afb438p-23, 0x0.911d08eb010cb0p-22, -0x0.9e5f5830fbe5b8p-20, 0x0.9dd7c8de0258f8p-23, 0x0.9e68950c3a8070p-24, -0x0.f5d0e353c44eb8p-27, 0x0.91864e879e0f98p-26, -0x0.f2eb802c0fb7a0p-30, -0x0.a3be39579feed0p-29, // x=    1.75 y=     6.5
+ 0x0.9b545f4c081f10p-3, 0x0.a64079fb3ec618p-5, -0x0.afec20d76ab718p-7, 0x0.9a38bb82998ed0p-6, -0x0.8b7c93a369b9d8p-9, -0x0.877d1536f51490p-9, 0x0.b3f621cbeb7860p-12, -0x0.dd73e3186bd658p-13, 0x0.89c608c80d4560p-16, 0x0.d92499126bcd00p-15, -0x0.f33053f4eb8758p-18, 0x0.81d184c684c938p-21, 0x0.af704a6e20d298p-23, -0x0.ff0f0534ebdcd0p-21, 0x0.fad85a438545d0p-24, 0x0.d65038442f0140p-25, -0x0.a904ec10633368p-27, 0x0.e5fb1b7f96fd78p-27, -0x0.c19c234c943ac8p-30, -0x0.e0820433a23d58p-30, // x=    1.75 y=    6.75
+ 0x0.b33020b20c5918p-6, 0x0.a03c09d0558f60p-1, -0x0.be6322bd2d1ed8p-4, -0x0.ce887f5a306760p-2, 0x0.b3e350d2be64b8p-3, 0x0.ecd3f5fdf776a8p-3, -0x0.bf60fc40d3b208p-3, -0x0.f083cabe231b40p-5, 0x0.e2cac73705c548p-4, -0x0.da1be491d0f1f8p-5, -0x0.9eae4aee7ffc40p-6, 0x0.8ccc9ce41a4480p-4, -0x0.bdfd948e9356f0p-6, -0x0.fd86799c884388p-6, 0x0.a0b05575c07578p-6, -0x0.df989f37e5f1d0p-11, -0x0.977920385b1e30p-8, 0x0.862fe23c327de8p-7, -0x0.8e9e6b0b5ae860p-9, -0x0.f10ae5e7b41c58p-9, 0x0.f268cf38fd1c20p-10, -0x0.9e46643b12bbf0p-14, -0x0.a5f193199da970p-12, 0x0.b702d56d8268a0p-11, -0x0.ceada11bae5ce8p-13, -0x0.eec84742752278p-13, 0x0.cf17dd708fce40p-14, -0x0.94523e7ab8a080p-15, 0x0.dc7e00dc3aa428p-20, 0x0.ca7d3f62aacdf8p-16, // x=       2 y=       0
+ 0x0.969d6bf4254078p-3, 0x0.9137e852c58d40p-1, -0x0.cc7551d54daa30p-3, -0x0.87606b2a764d90p-2, 0x0.b6539191470f08p-3, 0x0.8e4c49b2bb68c8p-4, -0x0.d067f23d32ed60p-4, 0x0.88812e81723b00p-5, 0x0.cf9bf0af870b78p-6, -0x0.d12e904551ae50p-5, 0x0.bc74643ca5feb0p-7, 0x0.d7439f272802b0p-6, -0x0.da142a56310cf8p-7, -0x0.c66bb68a7b9998p-9, 0x0.927debc81a1290p-8, -0x0.8b0cd5672b75b8p-8, 0x0.916fdf3b528b60p-11, 0x0.a9e0f42b2b3178p-9, -0x0.883dbd8ac19ad0p-10, -0x0.ab9a6549d09660p-12, 0x0.a0909f85d46640p-12, -0x0.9e00929b4aaef0p-12, 0x0.d236601bfa80e8p-15, 0x0.a2991668fa9698p-13, -0x0.f7e20ba2f60878p-15, -0x0.833f4b653c87d8p-17, 0x0.bb694b8faa7728p-17, -0x0.960d773d6ea818p-16, 0x0.879b64a22ca4b8p-18, 0x0.ca6eb8b765de38p-18, // x=       2 y=    0.25
+ 0x0.cf84ec54eca6e8p-3, 0x0.83afe0935d8780p-1, -0x0.df8589881a1fc0p-3, -0x0.bb2869121019d0p-3, 0x0.967d964100cc60p-3, 0x0.aa9d2edfc6ca20p-7, -0x0.eef32fce1a2740p-5, 0x0.bbd81d29e88870p-5, 0x0.b9abf6612db470p-9, -0x0.923d45e817be40p-5, 0x0.c4a0156d05eac8p-7, 0x0.b90eff9f303e50p-7, -0x0.e863dce88ba160p-8, 0x0.b7831d6f30b800p-10, 0x0.93b775ea959548p-10, -0x0.b8354752e1d068p-9, 0x0.c0b37ff20d3678p-11, 0x0.fd8653fc6ea648p-11, -0x0.f2e02be69b0d60p-12, 0x0.8a0d4cdad88698p-14, 0x0.f3a34c0e75e5d0p-15, -0x0.ab703309c33268p-13, 0x0.b536c291f67d38p-15, 0x0.bb0ecc6ca86910p-15, -0x0.aa9b2442378e70p-16, 0x0.e94cfd74ccf250p-18, 0x0.c32e4b75773e48p-21, -0x0.f092edbd590e18p-18, // x=       2 y=     0.5
+ 0x0.f5a3713098df68p-3, 0x0.eb806f37636a10p-2, -0x0.dbb51bccadc238p-3, -0x0.f16c1e9515abc8p-4, 0x0.e73c39023dc448p-4, -0x0.b1fc2cea3e1d30p-6, -0x0.f26273a70e32f0p-6, 0x0.b231db6a162a00p-5, -0x0.c410dc98a43760p-8, -0x0.b7a0c93339d488p-6, 0x0.94b22d6f759f68p-7, 0x0.f57876536e2b88p-9, -0x0.daffcb28904018p-9, 0x0.8e523a60ca0e08p-9, -0x0.b274fe31084db8p-16, -0x0.cb96805a4f7058p-10, 0x0.84e46438d05108p-11, 0x0.966bf576a9e8a8p-12, -0x0.bb90643785a408p-13, 0x0.e9045c8544b730p-14, -0x0.c6bfa6bbf73848p-18, -0x0.99b8e987f7de20p-14, 0x0.c2314b1fda63f0p-16, 0x0.9802d1024eae50p-17, -0x0.c5a61f6f1e4450p-18, 0x0.bcf775ce867cb0p-18, -0x0.e8b1a250f70bc0p-21, -0x0.a3ed92a4f770d0p-19, // x=       2 y=    0.75
+ 0x0.86a12ffc1a4f60p-2, 0x0.d0edfe40962820p-2, -0x0.cc2b1fbc3bee28p-3, -0x0.8da141e44a0758p-4, 0x0.a9dd1ccec22e70p-4, -0x0.96c08b2b68f208p-5, -0x0.c794ead1a9a1b8p-7, 0x0.939c1c77bec580p-5, -0x0.8746f9aed75658p-7, -0x0.d5929e90298c90p-7, 0x0.c56bd59c157f30p-8, 0x0.c78c6601f2a890p-12, -0x0.b3e9c482770c50p-10, 0x0.ee0f09b11803e8p-10, -0x0.9f7d548b880160p-12, -0x0.c9eb776ca85a40p-11, 0x0.970fe5e84c7398p-12, 0x0.aab32596ba85a0p-15, -0x0.f476d4ee724918p-15, 0x0.a79a9436e1c470p-14, -0x0.f985fc4d020fb8p-17, -0x0.f3312d9ddf65b8p-16, 0x0.aeaf965ff2b540p-17, -0x0.998370a465d7d0p-22, -0x0.aae304ca9442e8p-20, 0x0.c76fefdaa40548p-19, // x=       2 y=       1
+ 0x0.8d1960d2d5bee0p-2, 0x0.b8a91895d1e500p-2, -0x0.b7b5afc8166ae8p-3, -0x0.8af4f57f07f790p-5, 0x0.f1ac7dff65a140p-5, -0x0.ab98f43422ee00p-5, -0x0.9c6bd995ee1788p-9, 0x0.e4666993889a20p-6, -0x0.ff7f0a10386e70p-8, -0x0.e68a5d16ef09b8p-8, 0x0.f3514e8b319680p-9, -0x0.e7a96ee360edb8p-11, -0x0.e4828263d1b018p-12, 0x0.a664a0ba5bc700p-10, -0x0.9bf10c5efcadf8p-12, -0x0.b5f293be5b7700p-12, 0x0.9ada9888e4e0e8p-13, -0x0.8107309485d040p-15, -0x0.dac8b683d9ddc8p-17, 0x0.c32088ef3faa38p-15, -0x0.bbe8ae82f578e8p-17, -0x0.a852cb970654c0p-17, 0x0.8c950ca181e990p-18, -0x0.ef2792da049e38p-20, -0x0.faba81f85dba20p-26, 0x0.b3e0447b808eb0p-20, // x=       2 y=    1.25
+ 0x0.8fc2eb043cc770p-2, 0x0.a30b4d947b5b20p-2, -0x0.a22f555ee2ced8p-3, -0x0.96762e855e0520p-7, 0x0.a75afa9e7370a8p-5, -0x0.aa37f9043ea5d0p-5, 0x0.b00b2d7f569ba0p-9, 0x0.a9d6320bd6b8c8p-6, -0x0.d2f9b7fef9f1c0p-8, -0x0.e0e5f63a225950p-9, 0x0.8e0e9358c55288p-9, -0x0.9c17728532a0a8p-10, -0x0.8fe1d8e7853928p-15, 0x0.d534409f549ed0p-11, -0x0.e79d065dfed6c8p-13, -0x0.904cce0047afc8p-13, 0x0.92d4aa56b72ed0p-14, -0x0.a9cea2a10b3958p-15, 0x0.bc5e7a940239b8p-20, 0x0.ccd16c2b7f69e0p-16, -0x0.df9b86f004d8b0p-18, -0x0.b799f9159a60d0p-19, 0x0.cad2314a27b1d0p-20, -0x0.bdb14dcc04bd50p-20, 0x0.cd7d6907cbeeb8p-23, 0x0.92a0cfa1d606f0p-21, // x=       2 y=     1.5
+ 0x0.8fc8721fc278e8p-2, 0x0.9012d181878dc0p-2, -0x0.8d9aa6c27c5c80p-3, 0x0.fd8b6cc35edee0p-8, 0x0.e1974be9af0eb8p-6, -0x0.9de7b23d7ceb68p-5, 0x0.a37ceba1f12ff8p-8, 0x0.f64d8ffdc3f180p-7, -0x0.a311e4339efdb8p-8, -0x0.b42c97b47b4710p-10, 0x0.9db9e9e5121500p-10, -0x0.91cfd26afc2600p-10, 0x0.e9247150f492d0p-14, 0x0.81866adc403128p-11, -0x0.99bd1d2c2ed2d0p-13, -0x0.aee703a8c86260p-15, 0x0.80235b7e4ba2a8p-15, -0x0.88ec5ae2d4d898p-15, 0x0.98c46a5f670ff8p-18, 0x0.c889ab1c71bc90p-17, -0x0.ef15d5e655a238p-19, -0x0.8aa98d0f5dcbd0p-22, 0x0.f74e6906fbf558p-22, -0x0.e691655063c5c8p-21, 0x0.ada273853d84f8p-23, 0x0.d9e217e7e60220p-23, // x=       2 y=    1.75
+ 0x0.8e05b04a1b7ea0p-2, 0x0.ff21077acbf568p-3, -0x0.f5c7f5580dc258p-4, 0x0.9b776f0c097ab0p-6, 0x0.93266cc4512ef8p-6, -0x0.8d213131bf6e00p-5, 0x0.bc584dc9a28500p-8, 0x0.af854e884a1da8p-7, -0x0.f2deca9a870038p-9, -0x0.89454c0ddce638p-12, 0x0.a4b71135750568p-11, -0x0.ef3bd23b7770a8p-11, 0x0.96c95ecd9ed208p-13, 0x0.97532acd0a88b8p-12, -0x0.c016203a407370p-14, -0x0.f2032ee6af03b0p-20, 0x0.c525ee3533bc48p-17, -0x0.bd14aef7f5af08p-16, 0x0.8ba03f8c2a9348p-18, 0x0.b8662f995dbec0p-18, -0x0.ef526727452580p-20, 0x0.d8daf4711fcd58p-22, 0x0.bdd7d4101f85a0p-24, -0x0.fa07514e482cd0p-22, // x=       2 y=       2
+ 0x0.8b18d3c7b81768p-2, 0x0.e284e2b5c36d08p-3, -0x0.d4b7a684790258p-4, 0x0.d658459bd24630p-6, 0x0.b73ae0792d0808p-7, -0x0.f6d1fbaebca700p-6, 0x0.baa38f85b5b5e0p-8, 0x0.f6d567144309d0p-8, -0x0.b0d67d1e5f1078p-9, 0x0.9beff6929f3c20p-12, 0x0.9c2619b53d6820p-12, -0x0.b82837323018a8p-11, 0x0.8ac29d6cfe2a68p-13, 0x0.aa95a4a2bc7200p-13, -0x0.e6e2b110458fa8p-15, 0x0.cbcc29b0667d98p-17, 0x0.e26107eaffcca8p-19, -0x0.f240b5c75e3678p-17, 0x0.ca9a12ade2ab88p-19, 0x0.9cf44fadb41168p-19, -0x0.e35009bac3ff18p-21, 0x0.f6e1d52d9f79f8p-22, -0x0.c66413696cb618p-26, -0x0.fe67707113f4d8p-23, // x=       2 y=    2.25
+ 0x0.8771f6e0c286f0p-2, 0x0.c9c49c73296660p-3, -0x0.b800fa33b842f8p-4, 0x0.f9db77ff19d4c8p-6, 0x0.d323eea46662d8p-8, -0x0.d50cff78535820p-6, 0x0.ac3c891f2a5548p-8, 0x0.ab81860c8ae4f8p-8, -0x0.fde1244b699428p-10, 0x0.8e8764535c5a58p-11, 0x0.f0bfe86cb28580p-14, -0x0.88d25c6a3f7110p-11, 0x0.e1bda0b2d3ce60p-14, 0x0.b89714c741a1a8p-14, -0x0.86ccbb0e8a4b88p-15, 0x0.fadb95801eb910p-17, -0x0.d06e01cdcb5db0p-26, -0x0.9499664f4c9cc8p-17, 0x0.85531b107764e0p-19, 0x0.ea9acba31791f8p-21, -0x0.cc5cf667d6a5e0p-22, 0x0.bfa7e1dfb0a3b8p-22, -0x0.bbb24614b44c20p-25, -0x0.f6efbcb0b2e3d8p-24, // x=       2 y=     2.5
+ 0x0.835f8a7cb6e550p-2, 0x0.b459a4563536f8p-3, -0x0.9f515068c141f8p-4, 0x0.868fd462d0ff70p-5, 0x0.cfac473970c3d0p-9, -0x0.b6894ca0f37ec8p-6, 0x0.98d75bc2bd68f0p-8, 0x0.eb61027ea4d700p-9, -0x0.b488a608fcd848p-10, 0x0.a28be03579c308p-11, 0x0.97cd354cc35760p-16, -0x0.c7160960719ba0p-12, 0x0.accd5023512ba8p-14, 0x0.bc808a7b2103f0p-15, -0x0.995a12e64f1860p-16, 0x0.e2de649a1bcc10p-17, -0x0.9cd9111b3dfe30p-20, -0x0.b12a61c7c33e00p-18, 0x0.a68f80f996ed08p-20, 0x0.fc3f65b085d120p-23, -0x0.aa4e79298011b8p-23, 0x0.823cae94116ed0p-22, -0x0.a10c4e93f38f30p-25, -0x0.e584e111b52b48p-25, // x=       2 y=    2.75
+ 0x0.fe2f913750e860p-3, 0x0.a1ca1507bd7878p-3, -0x0.8a364b756f5520p-4, 0x0.8a9e0c9abb28b0p-5, 0x0.f598ce5799dab0p-11, -0x0.9bc9ae93978898p-6, 0x0.848a118c86db18p-8, 0x0.9f18489df38e00p-9, -0x0.ff0a367b15ea78p-11, 0x0.9fb5d93d985d90p-11, -0x0.f68749826895c0p-16, -0x0.8f02eb14d96c40p-12, 0x0.ffc365963e7370p-15, 0x0.ae04f2430f6708p-16, -0x0.a984653687ca28p-17, 0x0.b6c88b3c6a54e0p-17, -0x0.b7434df94b2d78p-20, -0x0.ceb64084187c48p-19, 0x0.c99ba945a5b960p-21, -0x0.9d1dc7c65244c0p-26, -0x0.f72679c1ce3e60p-25, 0x0.a5cdd7eb53e570p-23, -0x0.e41582ed1b1390p-26, -0x0.caa1f7633d0068p-26, // x=       2 y=       3
+ 0x0.f57f5a46be8af0p-3, 0x0.91aaeb2fa2e858p-3, -0x0.f06e30ac78b8e0p-5, 0x0.8ae67ce54cc4f8p-5, -0x0.925709a5a28910p-11, -0x0.84c323bf6ea7f8p-6, 0x0.e2b301cf3eca38p-9, 0x0.d2b4020712a560p-10, -0x0.b32dbc061b1398p-11, 0x0.923b6b70fb8608p-11, -0x0.d00eba114856d0p-15, -0x0.cbdfe2dc350d98p-13, 0x0.b98edc6336c500p-15, 0x0.fe700df0e195a8p-18, -0x0.b45f09f7094ac0p-18, 0x0.8b08b6cda53d00p-17, -0x0.a2b234548d9ad8p-20, -0x0.ec943dd1cd9568p-20, 0x0.eee54e1d179398p-22, -0x0.d6e8e8ab92ca20p-24, -0x0.f478fc79620b08p-27, 0x0.cb5edbf86f13e8p-24, -0x0.9462358445b558p-26, -0x0.a5804f0801dbf8p-27, // x=       2 y=    3.25
+ 0x0.ece006682889b8p-3, 0x0.839ff21cd39140p-3, -0x0.d1c1ffa6b9b118p-5, 0x0.88aed2ce929b90p-5, -0x0.c943c630835160p-10, -0x0.e25026b792b630p-7, 0x0.c04932663a7808p-9, 0x0.875e99ded9f720p-10, -0x0.fa78c4743d3118p-12, 0x0.80c5815de118a8p-11, -0x0.e7d01907f6cd20p-15, -0x0.90a33750bf74e0p-13, 0x0.850b3cecf84130p-15, 0x0.c8779543d9d978p-21, -0x0.b4cd99347a97f0p-19, 0x0.ccd2aae8139140p-18, -0x0.81c3bca2d40798p-20, -0x0.84999518121ef8p-20, 0x0.8b413cd6f38420p-22, -0x0.eea0856b61c658p-24, 0x0.b3005fd5addf08p-29, 0x0.f3696470c55590p-25, // x=       2 y=     3.5
+ 0x0.e47207f7c1f240p-3, 0x0.eeb535b75a95d0p-4, -0x0.b799c6d9e50428p-5, 0x0.84db60ee388b08p-5, -0x0.8cf41b4e605788p-9, -0x0.c122db72578bc8p-7, 0x0.a259e97b0adad0p-9, 0x0.a5b5b5eae226b0p-11, -0x0.ae0bb26e2d8778p-12, 0x0.dd99f19f32da00p-12, -0x0.e0d2e7ab3aeb10p-15, -0x0.cca1f62e90bbd0p-14, 0x0.bd79b28fec3140p-16, -0x0.aa4a701d652800p-19, -0x0.a228474d205358p-20, 0x0.940dc45f512208p-18, -0x0.c417f325172b80p-21, -0x0.90c193818a8c78p-21, 0x0.a00d15f01bb3d0p-23, -0x0.cfecbf382c2fe0p-24, 0x0.84da615a58e1e8p-27, 0x0.8f8ae17e3d3068p-25, // x=       2 y=    3.75
+ 0x0.dc49d4cb744dd0p-3, 0x0.d930ce00bbf010p-4, -0x0.a141da769c31d0p-5, 0x0.800b5b44fb5a38p-5, -0x0.a4c8a7538792d8p-9, -0x0.a528632b26c920p-7, 0x0.88c919ccd79950p-9, 0x0.b9f1847e117198p-12, -0x0.f01139760ad610p-13, 0x0.bbff6c389660d8p-12, -0x0.cbe93c99a79320p-15, -0x0.907ad31e2e0db0p-14, 0x0.866a25efa91268p-16, -0x0.8228bc2ccf7b08p-18, -0x0.dc13a59c673dd8p-22, 0x0.d3ab9a632cc7e0p-19, -0x0.8fb7f96ce43da0p-21, -0x0.98019470a7f260p-22, 0x0.b52ceab1f63968p-24, -0x0.a42741bdcf3540p-24, 0x0.8c5cf753f072f0p-27, 0x0.a7436a10033de0p-26, // x=       2 y=       4
+ 0x0.d4738d63819eb8p-3, 0x0.c64280166a5fe8p-4, -0x0.8e20a21355fbe8p-5, 0x0.f55a1657ebef70p-6, -0x0.b13cc449ba7d08p-9, -0x0.8d97cb569d0068p-7, 0x0.e663cfddc0cad0p-10, 0x0.ac2459799ee708p-13, -0x0.a3dac0d505d000p-13, 0x0.9e200b0cddadd0p-12, -0x0.b2220727e23730p-15, -0x0.cbb26146fb1aa8p-15, 0x0.be5e8beeff6ac0p-17, -0x0.8cd6710f265828p-18, -0x0.c7e051505d2b08p-30, 0x0.965b1a94509328p-19, -0x0.ceecd1fbbc0f18p-22, -0x0.959d01843babd8p-23, 0x0.c93d0f057dee40p-25, -0x0.f6620842e38d00p-25, 0x0.efef9547fd80c8p-28, 0x0.c0d4ffba171298p-27, // x=       2 y=    4.25
+ 0x0.ccf59210f05238p-3, 0x0.b58bcddfcefe58p-4, -0x0.fb68a4e7002908p-6, 0x0.ea185c48370ba0p-6, -0x0.b5ec3a751d2740p-9, -0x0.f37c03b140d0e0p-8, 0x0.c22aac61b4fbe8p-10, 0x0.92c9f78afc7c78p-15, -0x0.dc5844f27c3960p-14, 0x0.84569021c77840p-12, -0x0.9824a0ec3df490p-15, -0x0.8f56d19c28ac60p-15, 0x0.86bbc88c5acb68p-17, -0x0.8686f3abdcb7c0p-18, 0x0.cc3e75221195b8p-23, 0x0.d4e9800a73f910p-20, -0x0.9366c29ece24c0p-22, -0x0.81a140f09d5a28p-24, 0x0.d9a171939efa50p-26, -0x0.b3a7ce9ba7df88p-25, 0x0.bb6bdc0f0e7b60p-28, 0x0.dbd2a840c7b1c8p-28, // x=       2 y=     4.5
+ 0x0.c5d25582058e08p-3, 0x0.a6bd1ca0e98c08p-4, -0x0.df1ffec1288748p-6, 0x0.deb84cbd3a2268p-6, -0x0.b561c4d9d74798p-9, -0x0.d2006ea0709700p-8, 0x0.a3e4acfa854d28p-10, -0x0.d5fd59a9842a10p-15, -0x0.90dff44bfd3080p-14, 0x0.dcf308c2e9d290p-13, -0x0.8024427ba659b8p-15, -0x0.c93d825530bc78p-16, 0x0.bebd6b28ff02f8p-18, -0x0.f18ac28079df78p-19, 0x0.8df3e99084fd28p-22, 0x0.96900c19a630a8p-20, -0x0.d0c1d008f5f870p-23, -0x0.9ddc015f46a3d0p-26, 0x0.e1bfe8cb596db0p-27, -0x0.80ca2cd4d3c4b0p-25, 0x0.8ba980179e22b0p-28, 0x0.f7265d82408f70p-29, // x=       2 y=    4.75
+ 0x0.bf09a56dc126b0p-3, 0x0.9993496eab7008p-4, -0x0.c6b135da323270p-6, 0x0.d37e63892cde30p-6, -0x0.b166d6fac4bda0p-9, -0x0.b5b614ffaf5748p-8, 0x0.8aa2808ce89020p-10, -0x0.dfd9c5cbc9d9c8p-14, -0x0.b7f64912b3bb40p-15, 0x0.b849b5c6998380p-13, -0x0.d5fe1ff1bc7170p-16, -0x0.8cc09f33d2a7a8p-16, 0x0.8711dd7d1f3600p-18, -0x0.d14feb301f0018p-19, 0x0.94f5bcf0f44280p-22, 0x0.d4f679b99f1938p-21, -0x0.9364aa4fe84d00p-23, 0x0.bf9477f7417848p-29, 0x0.d9c31b75827ec8p-28, -0x0.b6ceca04ba98c0p-26, 0x0.ca97e4d9270ef8p-29, 0x0.885010d59008a0p-29, // x=       2 y=       5
+ 0x0.b89991a45a1520p-3, 0x0.8dd59ae4772b20p-4, -0x0.b1845373f29018p-6, 0x0.c8970aa840be38p-6, -0x0.ab3c142089c338p-9, -0x0.9dc086a0b9e8f0p-8, 0x0.eb21a86271eff8p-11, -0x0.9421df007936d0p-13, -0x0.dc4b8f7adc1190p-16, 0x0.99c294d9d6b8a0p-13, -0x0.b1c23120e73010p-16, -0x0.c3d238ff68ee10p-17, 0x0.bf5dfc86da9018p-19, -0x0.b18405d5385478p-19, 0x0.8c099c2fb17b38p-22, 0x0.96c048baa62ac0p-21, -0x0.cff10634d3f960p-24, 0x0.d5db80e7542dd0p-27, 0x0.b49f38c1cdf260p-29, -0x0.81038ca4154900p-26, 0x0.9098b1517961d8p-29, 0x0.921fed3c59c100p-30, // x=       2 y=    5.25
+ 0x0.b27f0e08518d98p-3, 0x0.835407567d8828p-4, -0x0.9f1a92e6c3df70p-6, 0x0.be1dd55f6be140p-6, -0x0.a3c13efb6af808p-9, -0x0.896821cab65a00p-8, 0x0.c7f4ad0a523e28p-11, -0x0.a8e10ba6991858p-13, -0x0.ebed8551416b78p-17, 0x0.80709e584b2940p-13, -0x0.933ef8d9216f20p-16, -0x0.871e7fc3094c70p-17, 0x0.87922059a64c58p-19, -0x0.94863351ebb580p-19, 0x0.f8d40ea0ab7db0p-23, 0x0.d5b99aadd62f18p-22, -0x0.92be2220676840p-24, 0x0.88cb60a9b6ff10p-26, 0x0.b9cf00509afad0p-31, -0x0.b59aeb3ab17568p-27, 0x0.cc737930a454d0p-30, 0x0.9588a4c000e8e0p-31, // x=       2 y=     5.5
+ 0x0.acb6639b5f1de8p-3, 0x0.f3cb8943baf608p-5, -0x0.8f0a20eaf862b0p-6, 0x0.b4229f3dcb8e60p-6, -0x0.9b917ae4e9c838p-9, -0x0.f0291c3299b6e0p-9, 0x0.aa8c678d222350p-11, -0x0.b2f4801503a540p-13, -0x0.bee325c7ab1b50p-18, 0x0.d6f5d1e1a10918p-14, -0x0.f3a93449921340p-17, -0x0.b83fbfc0e41138p-18, 0x0.bffa51ef3fa578p-20, -0x0.f66cab02ef5ba0p-20, 0x0.d5ec15bd6ab168p-23, 0x0.97bf2aebf78778p-22, -0x0.cf61ca666e3f98p-25, 0x0.8b5be12742ef00p-26, -0x0.a0802196f615f0p-32, -0x0.ff712278224190p-28, 0x0.8fc61f8aa13e68p-30, 0x0.8cacd0d2813ff8p-32, // x=       2 y=    5.75
+ 0x0.a73b7ee44c6988p-3, 0x0.e2d02d4655cf18p-5, -0x0.80fa8516efb2a0p-6, 0x0.aaad2ccf53ed08p-6, -0x0.93174ede1f2bd0p-9, -0x0.d28f54c60e7e90p-9, 0x0.91ea183112b608p-11, -0x0.b5c0a2e2bdc4f8p-13, -0x0.cc56bf6a74ca98p-26, 0x0.b44755d0711940p-14, -0x0.c99bce1600bcc0p-17, -0x0.f6cdf7fee61690p-19, 0x0.87ba4940f90c20p-20, -0x0.cb5d374ca3b998p-20, 0x0.b435f52837f218p-23, 0x0.d7d4480b932868p-23, -0x0.92d0b819215868p-25, 0x0.80f858f31ab198p-26, -0x0.c77bd789350e78p-31, -0x0.b39868e18827a8p-28, // x=       2 y=       6
+ 0x0.a20a25c8f72cc0p-3, 0x0.d37aa46cb1f1e8p-5, -0x0.e94347ba34b1f8p-7, 0x0.a1bfbd5c095840p-6, -0x0.8a9ad7392eb5c0p-9, -0x0.b93234db7e4068p-9, 0x0.fa75d1905b89d0p-12, -0x0.b3abf00e32ee60p-13, 0x0.fa13d25c34ae80p-19, 0x0.97927be5816338p-14, -0x0.a6f59e08c7a340p-17, -0x0.a0de1a92dea038p-19, 0x0.bf655231716620p-21, -0x0.a7558463c5d200p-20, 0x0.95db9ffc145208p-23, 0x0.99b4447a3808b8p-23, -0x0.d0558dc4c849e8p-26, 0x0.e2d3ee106cb8f0p-27, -0x0.ecfc0c1fc26a88p-31, -0x0.fd226f47cb3b48p-29, // x=       2 y=    6.25
+ 0x0.9d1e1c0767bec0p-3, 0x0.c59817b91d6e38p-5, -0x0.d38288a476da00p-7, 0x0.9958dc53fe8e50p-6, -0x0.824bdb0049ffa0p-9, -0x0.a364f81f70c5d0p-9, 0x0.d7a22b60f2c178p-12, -0x0.ae685a77c6a018p-13, 0x0.cd9204f1464fe8p-18, 0x0.ff9106e2043300p-15, -0x0.8a788acabcf058p-17, -0x0.c8c8d7a289dd28p-20, 0x0.8659af3b9c51f0p-21, -0x0.898071eee24a00p-20, 0x0.f72e0df0085a30p-24, 0x0.db2778998b1238p-24, -0x0.9429d626a6beb0p-26, 0x0.c1845408c5dd88p-27, -0x0.ea7dff0fd89440p-31, -0x0.b2c537db12a008p-29, // x=       2 y=     6.5
+ 0x0.e8b1ff6ed59160p-8, 0x0.89d86faaf5b328p-1, -0x0.8a29afa9cece60p-5, -0x0.9a1250c7774ac8p-2, 0x0.958660a2b83e40p-4, 0x0.b47541079fd600p-3, -0x0.beb1891e5eae80p-4, -0x0.a097cbd9912340p-4, 0x0.97afa282afdc08p-4, 0x0.a3f010abe46708p-8, -0x0.87a613e03219b8p-5, 0x0.da0375656febb8p-6, 0x0.c8771815a2dbf8p-10, -0x0.ba416902acff10p-6, 0x0.8a05fcf3710f08p-7, 0x0.80323a1e0257c0p-7, -0x0.b06e9d9f437ae8p-8, 0x0.88171ffbd98700p-10, 0x0.fe2ece930ce928p-11, -0x0.95de3ae48673c8p-9, 0x0.a19f6191801348p-11, 0x0.e64cddb5861540p-11, -0x0.e7ebd576183a98p-12, 0x0.9d524345cf1c48p-15, 0x0.908753f19c9490p-14, -0x0.a89bbfd0c77480p-13, 0x0.afe6a497849350p-15, 0x0.be5d4b6e8df688p-15, -0x0.df40887bf1c428p-17, 0x0.d07d8a70341cb8p-18, // x=    2.25 y=       0
+ 0x0.dac13d22428ae8p-4, 0x0.817f1f4f047a70p-1, -0x0.830d9344509aa0p-3, -0x0.e78c21a8e053b8p-3, 0x0.e61625239414c8p-4, 0x0.a22ad3dd422e40p-4, -0x0.9506417b43c728p-4, -0x0.b1d02617012d10p-9, 0x0.f3868bddcfc138p-6, -0x0.ba2c10f6a75a10p-6, -0x0.a6b02860c35a90p-9, 0x0.9539b03d664628p-6, -0x0.b81b7d0d6c3730p-8, -0x0.d5e63f9e2dba30p-8, 0x0.fba64c30c83868p-9, -0x0.b57c644b35a078p-13, -0x0.e9b4e533a37f48p-11, 0x0.b42f4cc7969508p-10, -0x0.8ca00a0bdbf5a0p-12, -0x0.a0a30dc5cb1d08p-11, 0x0.882f1b97d0aa08p-12, 0x0.9808840d26f208p-15, -0x0.ff89e2ca98d390p-15, 0x0.a3b0a9e96f3a18p-14, -0x0.efdfe7d8771968p-17, -0x0.8af3b93c1e68e8p-15, 0x0.d4e9e7bfd32a60p-17, 0x0.f58cba15f19a98p-21, -0x0.9a01764028da50p-19, 0x0.fb444335ae47f0p-19, // x=    2.25 y=    0.25
+ 0x0.a021fa6697b150p-3, 0x0.f09d1f55f44c60p-2, -0x0.9f1897106dcb38p-3, -0x0.af137a8f80bca8p-3, 0x0.d8987f8d7936e0p-4, 0x0.880d8b4cb71950p-5, -0x0.ccf107098ec528p-5, 0x0.8de97ff3f617c0p-6, 0x0.c3c8d32ffb1ba0p-7, -0x0.b07c2ed8721ad8p-6, 0x0.d6acacd5f51dd0p-9, 0x0.acd88aa5af31c8p-7, -0x0.8f7aacc4f90380p-8, -0x0.f2e266f0ffec80p-10, 0x0.df66721675f020p-10, -0x0.ff8dae284e5c90p-11, -0x0.92138940a32810p-14, 0x0.cb5d4f37955d50p-11, -0x0.f5a0ad70cc6d38p-13, -0x0.c005aec6bd9668p-13, 0x0.d68e58fce83760p-14, -0x0.a31e1311a74700p-15, -0x0.c98bd851c61b70p-18, 0x0.a153295db09df0p-15, -0x0.b2f8ba75d0cc50p-17, -0x0.8832863f77a868p-17, 0x0.88d528bec28220p-18, -0x0.fdf70d37d81af0p-20, // x=    2.25 y=     0.5
+ 0x0.c572d6b0649af0p-3, 0x0.dc05d9831cdbd0p-2, -0x0.a7cd027af8de88p-3, -0x0.f9a9c3e1e901d0p-4, 0x0.b7b39301a90998p-4, 0x0.d051f0692f4e58p-9, -0x0.fd509c4853d178p-6, 0x0.c3e6d117119188p-6, 0x0.98ec7865492a38p-9, -0x0.86d3f2f2532640p-6, 0x0.8fe7ecbd28c3a0p-8, 0x0.ac24512f0005c0p-8, -0x0.b268da473beb68p-9, 0x0.c26f4dfdfc7e60p-15, 0x0.9e5d5e492847d8p-11, -0x0.df4dbc4ee541d8p-11, 0x0.8e21a469e26dc8p-13, 0x0.bdcffbec907628p-12, -0x0.8df76b8f40b478p-13, -0x0.ec04492c49f0c8p-16, 0x0.8760f415cbf950p-15, -0x0.944587676d6a30p-15, 0x0.a99c63e1a29918p-18, 0x0.ffc667c975b198p-17, -0x0.ad0ad9641ab568p-18, -0x0.ec4453821d8f20p-21, 0x0.85d1eac93ef018p-20, -0x0.b183901e7f2c80p-20, // x=    2.25 y=    0.75
+ 0x0.df4d9aa8469b80p-3, 0x0.c729a452d98cf8p-2, -0x0.a4753b2a7c6840p-3, -0x0.a71d19d8c7c510p-4, 0x0.9290e6a560fa68p-4, -0x0.edcd76479eaa48p-7, -0x0.8c51858faa30c0p-6, 0x0.c232e3f54f64a0p-6, -0x0.8a22f3b1599a78p-9, -0x0.b8766c012dd8f0p-7, 0x0.f837507edd11c0p-9, 0x0.8daee1d039b2a0p-9, -0x0.c2a7c8f6a940a8p-10, 0x0.a2d026df9f5030p-11, 0x0.835472aa677940p-13, -0x0.9344ad87624248p-11, 0x0.91a82a85eb1298p-13, 0x0.96033483433a38p-13, -0x0.891c9cf2d606b8p-14, 0x0.f517c94f2ec278p-17, 0x0.dc203c0e665400p-18, -0x0.aed3d5e2c66808p-16, 0x0.a0c89101ac8608p-18, 0x0.a7e2efe49cb738p-18, -0x0.89d2468b292ce0p-19, 0x0.9dacf29c1f6720p-21, // x=    2.25 y=       1
+ 0x0.effb3010c33780p-3, 0x0.b32fab2af3ba80p-2, -0x0.9a62f6e362c5e8p-3, -0x0.cd2fd8935a3760p-5, 0x0.e09d9f62816dd8p-5, -0x0.c216d22e10a000p-6, -0x0.839b294adf48c0p-7, 0x0.a9184958cffdb0p-6, -0x0.f1c66387eee788p-9, -0x0.ea105f42c7be58p-8, 0x0.b6c91e3c498ac0p-9, 0x0.92606a82caf9f8p-11, -0x0.bd5d7f8dd15778p-11, 0x0.ad2e9cf18fe4f8p-11, -0x0.c5d3c0f51efbe8p-15, -0x0.a9e3bfe9abb868p-12, 0x0.cbdcb45e3a5118p-14, 0x0.b6402584ea5dd0p-15, -0x0.e713964deeba60p-16, 0x0.a28389f8f15730p-16, -0x0.8a34f34ac566e0p-20, -0x0.ad181a482edbd0p-17, 0x0.c0d8c5449bb2a8p-19, 0x0.9fd183bd44fcd0p-20, -0x0.ba59be2e1dc1d8p-21, 0x0.9dab1d09333290p-21, // x=    2.25 y=    1.25
+ 0x0.f99c6229beed00p-3, 0x0.a0b2845d1593e0p-2, -0x0.8d1e75e93ea488p-3, -0x0.d78402d55e4470p-6, 0x0.a71495337acf90p-5, -0x0.e0c2c23e6b0080p-6, -0x0.9f8db05555cc30p-9, 0x0.898a722c338200p-6, -0x0.fd28821731cfb0p-9, -0x0.8afa8a3273d1e8p-8, 0x0.f74c835396f318p-10, -0x0.b84abd1b087c90p-13, -0x0.9defd82cdd02d0p-12, 0x0.8b2d57aec749d0p-11, -0x0.b8e135a19da2e8p-14, -0x0.b274b85e93b488p-13, 0x0.f56d744c7d2098p-15, 0x0.8ab694041ad3e0p-18, -0x0.a467368fb15f68p-17, 0x0.f3667169388b20p-17, -0x0.9c956083940890p-19, -0x0.981bad5b467af0p-18, 0x0.c2961df18decc0p-20, 0x0.9ea37a50304868p-27, -0x0.c49657eba1e4b0p-23, 0x0.c06735d6cdd670p-22, // x=    2.25 y=     1.5
+ 0x0.fdfd1052ccbdb0p-3, 0x0.8ff2828db5bd80p-2, -0x0.fdae74c4f2ef78p-4, -0x0.9092d577098fd8p-7, 0x0.f2872a9904fec8p-6, -0x0.e4dd5f98e27908p-6, 0x0.cccf8e249a6b28p-11, 0x0.d6ccfd34f1b988p-7, -0x0.e169931066a508p-9, -0x0.98d8d9a88d8288p-9, 0x0.9e0d014e447620p-10, -0x0.eb565a0f3b6258p-12, -0x0.b9ebd1009dd298p-14, 0x0.c6c61dc9daada8p-12, -0x0.aa69c192214b30p-14, -0x0.aaf8b9da3e9c60p-14, 0x0.870a54d2c7fb90p-15, -0x0.8b07a501aded48p-17, -0x0.a0390dbf472f40p-19, 0x0.98421503aa8f38p-17, -0x0.ff44fb4dc68bd0p-20, -0x0.ebf759f65cad70p-20, 0x0.afcd7c635a90d8p-21, -0x0.81c117f6d137f8p-22, // x=    2.25 y=    1.75
+ 0x0.fe8c997d7e76e8p-3, 0x0.80f9d1e1cb6c30p-2, -0x0.e1a0c229af3aa0p-4, 0x0.f4347ab9ee5908p-9, 0x0.abf05939704558p-6, -0x0.da4640299812f8p-6, 0x0.a1ba421fa5f158p-9, 0x0.a3576497511460p-7, -0x0.b99b27e83e6de8p-9, -0x0.953806d4090158p-10, 0x0.c0ddef0aab1a58p-11, -0x0.82ceef1ffcffc8p-11, 0x0.887ba5a5141520p-17, 0x0.84d7f1138eb090p-12, -0x0.81cb9f0059d090p-14, -0x0.8fe2c099fa3b10p-15, 0x0.8a532cc9270100p-16, -0x0.a963f501efc6f0p-17, 0x0.97f43bcda80b58p-22, 0x0.ad50e28a4dc0f8p-18, -0x0.a60bd371140750p-20, -0x0.94d7a94535dcd8p-21, 0x0.8ff5a345045f40p-22, -0x0.edafd2f95f2d38p-23, // x=    2.25 y=       2
+ 0x0.fc66942e7cf170p-3, 0x0.e768fe3987ca20p-3, -0x0.c769109718f580p-4, 0x0.cd1b0b3373bad0p-7, 0x0.ed8332e93dfd48p-7, -0x0.c871f17deaa280p-6, 0x0.d2df2c97452618p-9, 0x0.f3e373f644c030p-8, -0x0.9233375d3bb818p-9, -0x0.deeb9326e29a18p-12, 0x0.e08e7d7b96f738p-12, -0x0.edfddbfeacf590p-12, 0x0.bd7666696f89f0p-15, 0x0.a9e2b7bec62708p-13, -0x0.b4b7cd08a040b8p-15, -0x0.b6cde0c7684a70p-17, 0x0.8333caaf4f8278p-17, -0x0.8dcc40f774dd98p-17, 0x0.8470ac9714f308p-20, 0x0.b8dbe33d4c2948p-19, -0x0.c26ed5189fc038p-21, -0x0.ba61b4c7b0c630p-24, 0x0.cda41a67cda140p-24, -0x0.a18328a6622b70p-23, // x=    2.25 y=    2.25
+ 0x0.f860f56920eef8p-3, 0x0.cfff3c3659e008p-3, -0x0.afa1232c092de8p-4, 0x0.97920db9af3e90p-6, 0x0.9ea50dc1778170p-7, -0x0.b3d8d0fd6ed2b8p-6, 0x0.e0277eb0bf6e90p-9, 0x0.b39601861da088p-8, -0x0.e01e7be98a63c0p-10, -0x0.aa6af8637399d8p-16, 0x0.f659abe9dfd998p-13, -0x0.c5ee742c67a6d8p-12, 0x0.e0f95c1fb67b20p-15, 0x0.d1df17bb94e590p-14, -0x0.eecb3ecb38fb38p-16, -0x0.921702f7b8be30p-22, 0x0.de63d1adf26498p-19, -0x0.cf3b1d322889e8p-18, 0x0.82c302d11cf2f8p-20, 0x0.ba25702ae489d8p-20, -0x0.d55d1b22b1cdb0p-22, 0x0.8b7112849a0a18p-24, 0x0.da72c5b8cdb500p-26, -0x0.c235605d30fc88p-24, // x=    2.25 y=     2.5
+ 0x0.f31a8a4e1fbef8p-3, 0x0.bb64cf85b85688p-3, -0x0.9a74cf6465b2e0p-4, 0x0.b7a199275c8bd0p-6, 0x0.c9c7e067c8f6c0p-8, -0x0.9f06f6e8acf750p-6, 0x0.d9ad8d25765f88p-9, 0x0.82be153c64d0c8p-8, -0x0.a8c6f5ed482180p-10, 0x0.caeee4d6a13768p-13, 0x0.f5e1ccf1992988p-14, -0x0.9cc52fbe9823f8p-12, 0x0.d1124caf455e00p-15, 0x0.fb06df1f269388p-15, -0x0.9858bf2bcd0428p-16, 0x0.820a6cd929c958p-18, 0x0.9496577d89bd80p-20, -0x0.8d44d2e6d06ad0p-18, 0x0.cc78905e42a8e8p-21, 0x0.af6bb6265bbb48p-21, -0x0.dec4348a0cb390p-23, 0x0.c912e9d608c9e0p-24, 0x0.91ccda5ae9dd30p-35, -0x0.d9f7ed2c7a02d8p-25, // x=    2.25 y=    2.75
+ 0x0.ed07b29550cd10p-3, 0x0.a946e22fe85260p-3, -0x0.87d31533a79668p-4, 0x0.cb56ccc4296c40p-6, 0x0.ec37a52998f4d8p-9, -0x0.8b56aecb761c00p-6, 0x0.c944f2e269dd00p-9, 0x0.bc5c748efc78e0p-9, -0x0.fb34f388ffa820p-11, 0x0.9989aa12396d58p-12, 0x0.c93a03ce001a80p-15, -0x0.f132eb6f2a6c38p-13, 0x0.af7850330f7a88p-15, 0x0.90c0600e2786c8p-15, -0x0.bd4786fa8e31b0p-17, 0x0.a618b497a29da8p-18, 0x0.e5e4441a74aea0p-24, -0x0.b8bf54929d7290p-19, 0x0.90a3a93eee3380p-21, 0x0.95908a637bab98p-22, -0x0.ddb22647968c58p-24, 0x0.af034d018e9780p-24, -0x0.f348e78f989dd0p-28, -0x0.e9484517fc7ea8p-26, // x=    2.25 y=       3
+ 0x0.e67cc741249940p-3, 0x0.9956e7fbfd4b40p-3, -0x0.ef185242007018p-5, 0x0.d624c9e51c3518p-6, 0x0.e8976159c7db70p-10, -0x0.f2d4e84514c708p-7, 0x0.b4ba15eb365290p-9, 0x0.862b3cbfecafb8p-9, -0x0.b9676f678e1060p-11, 0x0.aae39b4aac5150p-12, 0x0.948a4be721af08p-17, -0x0.b63038aac830d8p-13, 0x0.8b93497ba7fae8p-15, 0x0.9ee5b549d09da8p-16, -0x0.e5af5e2f28f768p-18, 0x0.9db4b4d41c9d40p-18, -0x0.9b60e16f8f3588p-22, -0x0.eaf3b6c43eff28p-20, 0x0.c1cc5deac48868p-22, 0x0.cf4f67f7de6870p-24, -0x0.cfa1ef9e32d2c0p-25, 0x0.82010d1eba21c0p-24, // x=    2.25 y=    3.25
+ 0x0.dfb6422e7621c8p-3, 0x0.8b4d41dc668d28p-3, -0x0.d2c6737b268410p-5, 0x0.da9a7bcc7118b8p-6, 0x0.fb24f697f7af08p-12, -0x0.d2f45f57d38d48p-7, 0x0.9f55e557dfa450p-9, 0x0.bc968f829c04d8p-10, -0x0.87ff76cdef5620p-11, 0x0.a91d4e56accc48p-12, -0x0.c85fb8efdaa8d0p-17, -0x0.8802fbcf497420p-13, 0x0.d72dffa4386050p-16, 0x0.a10b86bf3032e8p-17, -0x0.87f7605b4297d0p-18, 0x0.8583faa49c8ad0p-18, -0x0.d738b2ddb03230p-22, -0x0.924f788c148818p-20, 0x0.fb24ee44e82948p-23, 0x0.f134555a3d5a08p-27, -0x0.b1dfd78a2b5350p-26, 0x0.b3411c8243ae28p-25, // x=    2.25 y=     3.5
+ 0x0.d8def9f60cee08p-3, 0x0.fdd45a8f6ac068p-4, -0x0.ba311193ff0420p-5, 0x0.da99fece5fc680p-6, -0x0.de80346e3edea8p-12, -0x0.b705be59ac3230p-7, 0x0.8ad96c41d40990p-9, 0x0.823b99b3105248p-10, -0x0.c683830e80c988p-12, 0x0.9d96bd8be18d98p-12, -0x0.b7791b8e680cc0p-16, -0x0.c98ae1cd1bc718p-14, 0x0.a2afb77ca63340p-16, 0x0.8aebc427227fb8p-18, -0x0.9c2d3da86ab890p-19, 0x0.d533cbb3791eb0p-19, -0x0.d0d34f23e944e0p-22, -0x0.b302dad33aaff8p-21, 0x0.9f1d74365c96b0p-23, -0x0.a3e51a4d8b4890p-26, -0x0.fcfe5c54447248p-28, 0x0.ecc11af1943f00p-26, // x=    2.25 y=    3.75
+ 0x0.d214d29a83b370p-3, 0x0.e7eb8346c0d370p-4, -0x0.a4ddab6858b018p-5, 0x0.d78436f429c0b8p-6, -0x0.88843f54c1bea0p-10, -0x0.9ec69304159598p-7, 0x0.f039b549116708p-10, 0x0.af795460d1d168p-11, -0x0.903522622d9cf0p-12, 0x0.8dccf040991308p-12, -0x0.d6481c6af53a30p-16, -0x0.9496bc09a8a818p-14, 0x0.f304320369b658p-17, 0x0.8e623d6eb91ac8p-20, -0x0.abd9413eb42298p-20, 0x0.a491a073054448p-19, -0x0.b24c2a9ae83098p-22, -0x0.d7354c6c540e30p-22, 0x0.c64ebdf34b7cc0p-24, -0x0.f8b05e3ee03858p-26, -0x0.b50c74067930c0p-30, 0x0.9831551a704f68p-26, // x=    2.25 y=       4
+ 0x0.cb6c3b9ffe9df8p-3, 0x0.d47ee1d1cf8f60p-4, -0x0.925bfd08356c20p-5, 0x0.d25a30b866de38p-6, -0x0.be255f23521e40p-10, -0x0.89d9a9eabe3628p-7, 0x0.cee41a970a3228p-10, 0x0.e3c02dab3e8108p-12, -0x0.d078b840668658p-13, 0x0.f9b4ff8de1ee58p-13, -0x0.d820d03bfaa3c8p-16, -0x0.da63537c48f838p-15, 0x0.b41f0eb811c8c0p-17, -0x0.9d5c094be927f0p-21, -0x0.b045d582968860p-21, 0x0.f8ddef1c151b28p-20, -0x0.8eda8536cdf948p-22, -0x0.fd90019143f7e0p-23, 0x0.f3cdd2a9070648p-25, -0x0.f6a96de3aace38p-26, 0x0.9bbc5fb9c792f0p-30, 0x0.c0259fdd53e500p-27, // x=    2.25 y=    4.25
+ 0x0.c4f2c566b2fc78p-3, 0x0.c33aa0c31efe70p-4, -0x0.824808858b59c8p-5, 0x0.cbd642df63d6c0p-6, -0x0.e010d7214382f8p-10, -0x0.efb44c2f006568p-8, 0x0.b1c1097c983888p-10, 0x0.8af16cb0519380p-12, -0x0.95c9e6eb1e4e08p-13, 0x0.d8d4314c45c7e8p-13, -0x0.cb0ad7deee8710p-16, -0x0.a0219d8a2b7bb0p-15, 0x0.84e159de46ca18p-17, -0x0.ba53d3a15469d8p-20, -0x0.9d7fb70325a340p-22, 0x0.b9c283e08d49e8p-20, -0x0.dcc69039d82710p-23, -0x0.917c91187cb8d0p-23, 0x0.93f33610cbe430p-25, -0x0.d45efebf51b7f8p-26, 0x0.8228b733431970p-29, 0x0.ef685f0f7b6f70p-28, // x=    2.25 y=     4.5
+ 0x0.beb1083bafec80p-3, 0x0.b3d6a13823b7d8p-4, -0x0.e894a94eac18b8p-6, 0x0.c47ec7b02cffa8p-6, -0x0.f3d2247cb4ae98p-10, -0x0.d0cb970dcb1860p-8, 0x0.989271594ee9c8p-10, 0x0.96b5b4ab8bf940p-13, -0x0.d59774f6eab400p-14, 0x0.ba9a0803794898p-13, -0x0.b735b5dac73e20p-16, -0x0.ea6deeb969ae68p-16, 0x0.c3874aa55388b8p-18, -0x0.e4c70de6f426c0p-20, -0x0.bd80fb8096b5f8p-24, 0x0.898bda21eec100p-20, -0x0.a6e45d55a667f0p-23, -0x0.a09eb44e2d4668p-24, 0x0.b10f168fe62cb8p-26, -0x0.aabb42a3386c10p-26, 0x0.83cd8db3dcd6f0p-29, 0x0.9393561bf628b0p-28, // x=    2.25 y=    4.75
+ 0x0.b8ac0a02f818a8p-3, 0x0.a614f391d0c650p-4, -0x0.d02e7a1663e5f8p-6, 0x0.bcb3f8447715e8p-6, -0x0.fd795c3b132d80p-10, -0x0.b64428dc77caf8p-8, 0x0.82f70f31f822c8p-10, 0x0.f1d4b725940fa0p-15, -0x0.96b2b434aac870p-14, 0x0.9faeafe7f66db8p-13, -0x0.a1432cf498d828p-16, -0x0.ab539f512233a8p-16, 0x0.8fa7b975867d08p-18, -0x0.eb234d3b56db08p-20, 0x0.be0a27b9b47980p-26, 0x0.cab688f01e3b68p-21, -0x0.f8e1eaec1308f0p-24, -0x0.a66997bb85cef0p-25, 0x0.d03ddfefcf10f8p-27, -0x0.84101d40acb3e8p-26, 0x0.e4af9d66fee2c8p-30, 0x0.b431a7f2df7e48p-29, // x=    2.25 y=       5
+ 0x0.b2e64450a87c68p-3, 0x0.99c06e0940a418p-4, -0x0.badba86b26e758p-6, 0x0.b4ba234207bcc8p-6, -0x0.ffff503dde6e80p-10, -0x0.9f7c8a878f54b8p-8, 0x0.e104592e7185d8p-11, -0x0.b3abbad375a0b0p-19, -0x0.d18b72f609bc30p-15, 0x0.882f597d1da6c8p-13, -0x0.8bb37e4a478a68p-16, -0x0.f9f5adae5778c0p-17, 0x0.d2f7d2eb219258p-19, -0x0.deb6cf3eef7eb8p-20, 0x0.a4b794e8cc4910p-24, 0x0.94fb21d9291df0p-21, -0x0.b7ffc3f2665f90p-24, -0x0.98909ba8c04ef8p-26, 0x0.ef2581ad430828p-28, -0x0.c79839e6cfda30p-27, 0x0.b8636c182f1680p-30, 0x0.d9d1a0f4a7a520p-30, // x=    2.25 y=    5.25
+ 0x0.ad6064268f7bc0p-3, 0x0.8eab69e0eb2c30p-4, -0x0.a82d412ff59a88p-6, 0x0.acc12fca87eb70p-6, -0x0.fd8f98f5803548p-10, -0x0.8be7a95ba7ebf8p-8, 0x0.c190fa4adfe7b8p-11, -0x0.b989f266e206a0p-15, -0x0.8e9cfdf7f6e848p-15, 0x0.e7e113cd6652e8p-14, -0x0.ef8aaac5ec1ae0p-17, -0x0.b5e68b55a7eaa8p-17, 0x0.9ae5f906ac9a08p-19, -0x0.c9983844205058p-20, 0x0.d503a929315508p-24, 0x0.dab9a831fe2e70p-22, -0x0.8755a04fd48080p-24, -0x0.ca52d52579d6b0p-28, 0x0.84231453b92f58p-28, -0x0.94935c97c3ab90p-27, // x=    2.25 y=     5.5
+ 0x0.a819d5fbaee4f8p-3, 0x0.84aea915085860p-4, -0x0.97c4b87f6dc238p-6, 0x0.a4ea2210971328p-6, -0x0.f7bf18d5aea568p-10, -0x0.f617ca771ad220p-9, 0x0.a6cd1ff92a5cf0p-11, -0x0.97448f2dffe008p-14, -0x0.bbf536a2f421b0p-16, 0x0.c549a218e9d030p-14, -0x0.cbfc3015657258p-17, -0x0.83ed51c5463770p-17, 0x0.e37da24368e820p-20, -0x0.b17f8e53dade58p-20, 0x0.df081021f70c28p-24, 0x0.a08842f4b71b08p-22, -0x0.c685908eb70558p-25, 0x0.9363c283030f40p-31, 0x0.89f2d07d87e178p-29, -0x0.db4a5b2e380c18p-28, // x=    2.25 y=    5.75
+ 0x0.a3112bc9723f40p-3, 0x0.f750c59d3b7f60p-5, -0x0.8951965ac3b3a8p-6, 0x0.9d4b2896fc42b0p-6, -0x0.efb409738176f8p-10, -0x0.d90295a8fb86e8p-9, 0x0.9007190b5ca588p-11, -0x0.bcfb07115bf588p-14, -0x0.eb1f3fa8710860p-17, 0x0.a7e58d5df80dc0p-14, -0x0.acf7feabbdb8c0p-17, -0x0.be74b2d14f8fe0p-18, 0x0.a7123de9d81310p-20, -0x0.9987a9435efac8p-20, 0x0.d4f594d00d1ed8p-24, 0x0.ebc29534990f00p-23, -0x0.916dbd53a1daf0p-25, 0x0.80f8b738449418p-28, 0x0.80c2af4f3d0c68p-30, -0x0.a0f11bb1670c70p-28, // x=    2.25 y=       6
+ 0x0.9e44673622cbd8p-3, 0x0.e6f6e647a98de8p-5, -0x0.f91ec3cb8d3dc0p-7, 0x0.95f295cfc5b870p-6, -0x0.e643622d22def0p-10, -0x0.bfdf021fb3e8b8p-9, 0x0.f9477689125f58p-12, -0x0.d3b00aeaf31ca0p-14, -0x0.85cc23773a2830p-17, 0x0.8f02079e952ea0p-14, -0x0.924dc9ba221150p-17, -0x0.888d79105d4f40p-18, 0x0.f55fa7c2b76a18p-21, -0x0.8340e997027dc0p-20, 0x0.c168ab954920c8p-24, 0x0.ad4700493c6010p-23, -0x0.d50c914b46f580p-26, 0x0.b0086f4c2edd38p-28, 0x0.b55a8fa7399958p-32, -0x0.eb831396c5ef20p-29, // x=    2.25 y=    6.25
+ 0x0.99b12f454f32d8p-3, 0x0.d81d5419319b98p-5, -0x0.e2879f5c3de0b8p-7, 0x0.8ee90f684b6110p-6, -0x0.dc066d9fcb9250p-10, -0x0.aa1767444a2b20p-9, 0x0.d83b128c4a0258p-12, -0x0.dfa23d3cb78560p-14, -0x0.f5d2bea45d2d88p-19, 0x0.f3f0ce73d04a78p-15, -0x0.f7330de32ab100p-18, -0x0.c1f452a2726840p-19, 0x0.b418ccc284b508p-21, -0x0.deb03a789f2ee0p-21, 0x0.aa692abe92d1f0p-24, 0x0.fefe9e55cf7678p-24, -0x0.9c29524c992408p-26, 0x0.bbb19ca415ef78p-28, -0x0.b713de764a8828p-44, -0x0.ac146b21edef10p-29, // x=    2.25 y=     6.5
+ 0x0.85562e23776db0p-9, 0x0.f234ab37c20a00p-2, -0x0.af011c8e8cbff0p-7, -0x0.e83d5da827b258p-3, 0x0.d506afb6a9ce50p-6, 0x0.fa6f7ed3c84060p-4, -0x0.9d3affa8127708p-5, -0x0.809bf667bed7b8p-4, 0x0.991bc39eedb6c8p-5, 0x0.ae53cff918ffc8p-6, -0x0.c3be4e4743c890p-6, 0x0.b5d9189d0fa4b0p-9, 0x0.8a680428f9fa08p-7, -0x0.9bff5d5d0465d8p-7, 0x0.80c72b8b985a40p-11, 0x0.d0049ad37fd628p-8, -0x0.9f88b1787ba6a8p-9, -0x0.ea0d5e0064e0d8p-10, 0x0.abd08648523770p-10, -0x0.c17f6f2631d808p-12, -0x0.d31c87799ea918p-13, 0x0.906ad7c3830968p-11, -0x0.9538863ebe12a0p-13, -0x0.cd57096d41dc50p-13, 0x0.c8ed99e2249bf0p-14, -0x0.d6930afb08cc20p-18, -0x0.86a17ce777c400p-16, 0x0.89314791997b40p-15, -0x0.80e3611fedd570p-17, -0x0.a3ec75d57d7798p-17, 0x0.b46dbec630e8c8p-19, -0x0.fd270d1bff5570p-21, // x=     2.5 y=       0
+ 0x0.a582b679c51128p-4, 0x0.e8865429203f20p-2, -0x0.ab5b4183e9dca0p-4, -0x0.c0a7cffc2ec6d0p-3, 0x0.8bcef9835dbce0p-4, 0x0.9199ebd8ec4a00p-4, -0x0.bc0dc6af6f7478p-5, -0x0.83856c862f9e38p-6, 0x0.bd5d322ca029a0p-6, -0x0.c03e3affc12818p-8, -0x0.de64ac96cd8d20p-8, 0x0.9555d9f10957e8p-7, -0x0.a475ab2db49720p-11, -0x0.a974e97dad8538p-8, 0x0.f336383ad47470p-10, 0x0.afd7aa5acf8610p-10, -0x0.f5214f130fd0f0p-11, 0x0.fa1263521b8e00p-13, 0x0.a06ed921ff3ff0p-13, -0x0.bc630efbb82730p-12, 0x0.a73e033c658888p-14, 0x0.87c27c8e275fd8p-13, -0x0.ef4a1888ecda80p-15, -0x0.feac7e27262f30p-20, 0x0.c1c4b116a67808p-17, -0x0.9025b4f44637b0p-16, 0x0.cdbe65c6707a20p-19, 0x0.df1436ed05c100p-18, // x=     2.5 y=    0.25
+ 0x0.fcc0f3df469188p-4, 0x0.dbe4869af09228p-2, -0x0.e37e5f4d7fa168p-4, -0x0.9bec75a51c62f0p-3, 0x0.9583333dc4fa80p-4, 0x0.a26c958f050758p-5, -0x0.984acb4a9a7d10p-5, 0x0.debbd3fbd7f150p-10, 0x0.d22f34986d9608p-7, -0x0.ab067dc81a6060p-7, -0x0.9e428b3c13b508p-10, 0x0.e7c9a572052f60p-8, -0x0.e4db9de2929a00p-10, -0x0.a11bf5fbee9430p-9, 0x0.9f524f7cf7f6b0p-10, 0x0.8d0c80b86a3248p-13, -0x0.b25778b7952df8p-12, 0x0.b05c600c317a78p-12, -0x0.d178831e15e380p-16, -0x0.bb8f2284dac2c8p-13, 0x0.f68e6767d83870p-15, 0x0.f992cf02af0230p-16, -0x0.a8e622bdaa8ea8p-16, 0x0.c35485549ca8c8p-17, 0x0.f0b86bdf8f9d48p-23, -0x0.857673de917db0p-17, 0x0.968ba78be96448p-19, 0x0.be97fe2c2d5140p-20, // x=     2.5 y=     0.5
+ 0x0.a0c1e3d7bdd038p-3, 0x0.ccae7eed551ce0p-2, -0x0.ff2e5fdbf54018p-4, -0x0.ef1fb6a8784a40p-4, 0x0.8b1a341e7ee6d0p-4, 0x0.81075e95779db0p-6, -0x0.d9f776090f3378p-6, 0x0.ae950fe90eaee8p-7, 0x0.b843f8a78570f8p-8, -0x0.a7727c2f6d9658p-7, 0x0.98381cf597ccf0p-10, 0x0.937afaa1b8a608p-8, -0x0.ced195ced80b10p-10, -0x0.e41affa95afa68p-11, 0x0.a63822890c7c68p-11, -0x0.fa70369b0668c8p-13, -0x0.9af175f7af54e8p-14, 0x0.f7038546542d08p-13, -0x0.da1cec706be218p-15, -0x0.92bfb9a677e190p-14, 0x0.fa4011b30d43e0p-16, -0x0.ab65b023e57fc8p-20, -0x0.a74e3c3a4c3138p-18, 0x0.900d8101b59a90p-17, -0x0.ce7cdd4e6b7218p-20, -0x0.bd03eb41317d08p-19, 0x0.87c7d2479bde70p-20, 0x0.fc168643851400p-26, // x=     2.5 y=    0.75
+ 0x0.ba7d624a28eae8p-3, 0x0.bc6bffda413a20p-2, -0x0.832c44af314bb8p-3, -0x0.ae38e6f27678d8p-4, 0x0.ef5b4065575f70p-5, -0x0.9b83512f807778p-11, -0x0.8dcdb1a37292c8p-6, 0x0.e4201613a3c838p-7, 0x0.aebbef6b5157d8p-10, -0x0.87069a986a19b8p-7, 0x0.edfa88f3be1e80p-10, 0x0.a2cae9b5689318p-9, -0x0.9061adb129fe68p-10, -0x0.e0f7017d453020p-14, 0x0.8f176ebea4a158p-12, -0x0.904878de698af0p-12, 0x0.9e5eb22ab55500p-16, 0x0.8900d047b043a8p-13, -0x0.a393134e13ba30p-15, -0x0.a5eeb8a3605928p-16, 0x0.cd7c29489a9110p-17, -0x0.e9eea2f5490490p-18, -0x0.c0f31adc72f060p-23, 0x0.94493154bbf598p-18, -0x0.97c14c82784e80p-20, -0x0.c6f44c457aafe0p-21, // x=     2.5 y=       1
+ 0x0.ccc0e5cb10f900p-3, 0x0.ac2aca76e20b98p-2, -0x0.80095cdc3ddb88p-3, -0x0.efa076b599bfe8p-5, 0x0.c3e214a2923518p-5, -0x0.b076757c223698p-7, -0x0.a737484be05598p-7, 0x0.e59393d4131c68p-7, -0x0.e7624bfc0d4818p-11, -0x0.c440eb283b8758p-8, 0x0.e0cf49e4fabf08p-10, 0x0.99403de7b564e8p-10, -0x0.afcf19e87087d8p-11, 0x0.c4500c0fb232b0p-13, 0x0.b565e56c1020d0p-14, -0x0.dd40493f333ec0p-13, 0x0.a0ee45f794af48p-15, 0x0.81e15310127ca0p-14, -0x0.be40eef89e9610p-16, -0x0.8105649bee7780p-20, 0x0.852b6c23728800p-18, -0x0.bd674b0a2ea690p-18, 0x0.dbb7f2bdfdc7c0p-21, 0x0.fbec9a0103d890p-20, -0x0.9e1010e4793ea0p-21, -0x0.94876b0d75a078p-24, // x=     2.5 y=    1.25
+ 0x0.d8e39ff02be8f0p-3, 0x0.9c93e680b95fb8p-2, -0x0.f1d35ad06331a8p-4, -0x0.98244fcb6dade0p-5, 0x0.9acc1b5ac6e660p-5, -0x0.86a1f6d51167c0p-6, -0x0.ab18e3e35f4928p-8, 0x0.ce233e29837f20p-7, -0x0.ee99f534e36810p-10, -0x0.84d45c5a18f630p-8, 0x0.b2ee245f782b20p-10, 0x0.d556715fe47750p-12, -0x0.c09010491ef5f0p-12, 0x0.86124fddd917b0p-12, 0x0.8b61ee7adca410p-18, -0x0.9034ce0787cc38p-13, 0x0.8b5b493960d738p-15, 0x0.cea407b1a09cc8p-16, -0x0.bf6979083d3178p-17, 0x0.8cb8cb3aef61f0p-18, 0x0.bdf6218f1cfd80p-21, -0x0.e58bc180cecea8p-19, 0x0.c2e4e565277118p-21, 0x0.b172fa0939cdf0p-21, -0x0.89b93ef513e818p-22, 0x0.b3e67e7f030d28p-24, // x=     2.5 y=     1.5
+ 0x0.e02c4aed022990p-3, 0x0.8e061bab490580p-2, -0x0.df7573af4f61c8p-4, -0x0.a7d49aefc8f8a8p-6, 0x0.ee4044c7176410p-6, -0x0.9be2c05c4d6de8p-6, -0x0.fe809a6f609c00p-10, 0x0.adbf193bb5d2b8p-7, -0x0.86700f23584ff8p-9, -0x0.a953faa412ad58p-9, 0x0.8220cc00b8d3a8p-10, 0x0.a0dd5a74789120p-17, -0x0.bb9c9dbfcf2b40p-13, 0x0.f3a521ca8e87c8p-13, -0x0.d19f2aefd8e6c8p-16, -0x0.aa333a90cbede8p-14, 0x0.c1a9d4fbbefb30p-16, 0x0.e6fa9c3dd68a90p-18, -0x0.a94e717b7cc9f8p-18, 0x0.93a596992c0c68p-18, -0x0.aad44ce2cf5658p-22, -0x0.f0e16ac5cccec8p-20, 0x0.f4fc5664dd8378p-22, 0x0.b19c39d9e25f18p-23, // x=     2.5 y=    1.75
+ 0x0.e3b7c73f451840p-3, 0x0.80ad6d39e7b200p-2, -0x0.cb856b3ff2acb0p-4, -0x0.ffcc317317ae40p-8, 0x0.b35631e026bed0p-6, -0x0.a10ac38b64d998p-6, 0x0.bdb1b21f1f7568p-14, 0x0.8ccada3dd06cc0p-7, -0x0.fd84e39055a660p-10, -0x0.ca94a401faf730p-10, 0x0.b284b15d6e9510p-11, -0x0.b2ad99152af738p-13, -0x0.96a75f6a12cd58p-14, 0x0.bec1a4c4734a70p-13, -0x0.fdacce216d3828p-16, -0x0.b921024d049430p-15, 0x0.f0db862d791fb0p-17, -0x0.f1116d0b007d80p-22, -0x0.fa7fc18b8db588p-20, 0x0.dcdc5ab4052bc0p-19, -0x0.84415a9be64ad0p-21, -0x0.e2c6a0c86b5b70p-21, 0x0.84f2517b2a8c00p-22, -0x0.9f79aff6a9be78p-28, // x=     2.5 y=       2
+ 0x0.e471f718a1a1c0p-3, 0x0.e92a785667fd68p-3, -0x0.b7992b4dc53ad0p-4, 0x0.d7ad535601eef8p-10, 0x0.843c484a4e24f8p-6, -0x0.9c8716fc8a8df0p-6, 0x0.a591092d47b458p-10, 0x0.de419e82daa568p-8, -0x0.db78ed70506b78p-10, -0x0.de780660de0f58p-11, 0x0.ea2fca70de7428p-12, -0x0.f285926b5baf90p-13, -0x0.8481e8227d6ec0p-16, 0x0.8a093d6c63cba0p-13, -0x0.ddd92b1fdf9cc0p-16, -0x0.b7f71fbab1e3f0p-16, 0x0.8af88abbb8ee38p-17, -0x0.bcfb64d00e5348p-19, -0x0.ecdbd1a1cf1408p-22, 0x0.8fe7c27e5e9398p-19, -0x0.da38afeaf05068p-22, -0x0.bd85ea1b14f840p-22, 0x0.828e3ae9d83a88p-23, -0x0.c4b14f9860ef28p-25, // x=     2.5 y=    2.25
+ 0x0.e317c875fc4620p-3, 0x0.d36a7153251868p-3, -0x0.a49c12edd35fd0p-4, 0x0.8bff8c15e86388p-7, 0x0.becfd5dc147f40p-7, -0x0.92ac2bb4be5810p-6, 0x0.f526032a9f5fc8p-10, 0x0.ac33b551b6d138p-8, -0x0.b4f1c3ab43a4b8p-10, -0x0.d1bff9bbfde9b0p-12, 0x0.937dd0ec241ac0p-12, -0x0.f3c718d2fbf140p-13, 0x0.b1a511d86659c0p-17, 0x0.be0eb286b5c700p-14, -0x0.aab0f7ef90d6b0p-16, -0x0.9f2a66700c8f90p-17, 0x0.9656545a2c35a8p-18, -0x0.ce8573c892f930p-19, 0x0.f2cdf160635438p-24, 0x0.ad1d4f54d9c8b8p-20, -0x0.95680690389970p-22, -0x0.81f3024a043bc8p-23, 0x0.e9c26910374010p-25, -0x0.bc7bca4c859c40p-25, // x=     2.5 y=     2.5
+ 0x0.e03d260a193b08p-3, 0x0.bff44644e4a258p-3, -0x0.9308e751c3a0f0p-4, 0x0.dc99c7d8c4ef08p-7, 0x0.8622b7a2aeb298p-7, -0x0.8645a4475dd190p-6, 0x0.8af46a6c92a478p-9, 0x0.83955e3841cfc8p-8, -0x0.90b1982441a150p-10, -0x0.810df324894e40p-13, 0x0.b1b44a0faf2320p-13, -0x0.d9943235cca0f0p-13, 0x0.aec3d0fb411fc0p-16, 0x0.fc662d5b8a5e98p-15, -0x0.f532c02da1a258p-17, -0x0.c6a8c2c8a849a8p-19, 0x0.975439191eff20p-19, -0x0.ae482c43aad860p-19, 0x0.92a85d31dc6a38p-22, 0x0.c48329bc191718p-21, -0x0.ba43bdbdf574a0p-23, -0x0.bd0b42a7ff3c68p-26, 0x0.b9799dcb1c3f40p-26, -0x0.88fe205b06af88p-25, // x=     2.5 y=    2.75
+ 0x0.dc53fabafc8e30p-3, 0x0.ae96ef469f56b0p-3, -0x0.831319b89419a0p-4, 0x0.8a3306eef5b610p-6, 0x0.b620b793b9d188p-8, -0x0.f21d55ca08e650p-7, 0x0.8d3081f3ad9af8p-9, 0x0.c6df8bf9999860p-9, -0x0.e2cc5db63738c8p-11, 0x0.a65e33ee342d10p-15, 0x0.c9dc410d373ef0p-14, -0x0.b677ff501bbad0p-13, 0x0.c01909a32832d8p-16, 0x0.a2a464c2c45590p-15, -0x0.a8ad4d9559b148p-17, 0x0.cbcf58928f6278p-23, 0x0.8910d55ec690c8p-20, -0x0.83d00f2e927d68p-19, 0x0.935e3e62803530p-22, 0x0.d3bd7534360e50p-22, -0x0.dabbac811f38f0p-24, 0x0.f4362171ef7948p-27, 0x0.e8a01345f29b00p-28, -0x0.b100081f6db610p-26, // x=     2.5 y=       3
+ 0x0.d7b2e85c019d98p-3, 0x0.9f1de6796412f8p-3, -0x0.e985c0be93eda8p-5, 0x0.9cb86db7ab5990p-6, 0x0.eaab1aa2f00920p-9, -0x0.d818fd8db7bd58p-7, 0x0.875baf583ad4a0p-9, 0x0.94d654732de6e0p-9, -0x0.af50d3cba1b158p-11, 0x0.86df45f604a458p-13, 0x0.d0720a5471e460p-15, -0x0.937814a4830ca8p-13, 0x0.b20887513fada0p-16, 0x0.cb9f3eb165e5d0p-16, -0x0.e125bd07067278p-18, 0x0.cae43acf219d18p-20, 0x0.c8447ab071bae8p-22, -0x0.bbc3353f2ca9c8p-20, 0x0.f0d4149f34efe0p-23, 0x0.d7261c8c67bde0p-23, -0x0.f5007c5672dae8p-25, 0x0.c72de2a49ff250p-26, // x=     2.5 y=    3.25
+ 0x0.d29b211c37a298p-3, 0x0.9155524a8c0630p-3, -0x0.d00f64deb3a288p-5, 0x0.a838406ad9da20p-6, 0x0.8a1d91963dbb50p-9, -0x0.bf9d403c8b67b8p-7, 0x0.faab65c3ee6418p-10, 0x0.dcb29485b74428p-10, -0x0.8635b3ea1639c0p-11, 0x0.b39fac7c6c79e0p-13, 0x0.aff1a72b072300p-16, -0x0.e8d7468e42dc38p-14, 0x0.9838e27a131a38p-16, 0x0.f6b201f8497970p-17, -0x0.92bbcd78013d08p-18, 0x0.fef3b114bb2780p-20, 0x0.eac293dc310c08p-25, -0x0.80cafe4ece5c40p-20, 0x0.b3337e21f1c6a8p-23, 0x0.c90b9a3c458d68p-24, -0x0.839e320eae8190p-25, 0x0.bae63140969480p-26, // x=     2.5 y=     3.5
+ 0x0.cd3d3e10096a48p-3, 0x0.850c51f02953c8p-3, -0x0.b9882b3bc492c8p-5, 0x0.ae82c7c15e3838p-6, 0x0.85bb886c9ca340p-10, -0x0.a935199b5d00b0p-7, 0x0.e3075a5ccd7c90p-10, 0x0.a1fa9e02949848p-10, -0x0.cc0762ac71c0d8p-12, 0x0.c2e9bfb21a2f28p-13, 0x0.82afb2a6326db0p-18, -0x0.b5010872d7ee90p-14, 0x0.f8c1e712a768a0p-17, 0x0.8f1719610a4bb0p-17, -0x0.bb43c8b54bbfb8p-19, 0x0.f7f78fe5759918p-20, -0x0.b831dcbf109358p-24, -0x0.ac2a68fa8623c8p-21, 0x0.fd11a0044869e0p-24, 0x0.a0d23fdf7f0390p-25, -0x0.86aae7329e4e68p-26, 0x0.946647b658c9f8p-26, // x=     2.5 y=    3.75
+ 0x0.c7bd1f9df10998p-3, 0x0.f42c39ebf6dac8p-4, -0x0.a5a9dc3f5caf38p-5, 0x0.b0fa59f70948e0p-6, 0x0.edbd3c124beb70p-13, -0x0.9511759b2e49c0p-7, 0x0.caa62f786912e8p-10, 0x0.eaef446bb606d0p-11, -0x0.9a3cce006c5440p-12, 0x0.c1107ced8a4788p-13, -0x0.c0b658a9ffc190p-18, -0x0.8b422b48a343f0p-14, 0x0.c5ab2ab2078e48p-17, 0x0.9b3e8df9a8d8a8p-18, -0x0.e9e71628e5bf70p-20, 0x0.d8f9a23a92fd58p-20, -0x0.90aa5dafea2428p-23, -0x0.e1afea21b90840p-22, 0x0.ace6f8f03fcf40p-24, 0x0.a2f1bfafca0570p-27, -0x0.80ad0311e452c8p-27, 0x0.d98c0ec89cbc78p-27, // x=     2.5 y=       4
+ 0x0.c234f8a2427ba8p-3, 0x0.e094d690745f50p-4, -0x0.942bba6f7fa098p-5, 0x0.b0abaad2b412c8p-6, -0x0.b4c9bbb87ffeb8p-12, -0x0.832eb6b69ae2e8p-7, 0x0.b325cec69218b8p-10, 0x0.a7c946d6ff5ca8p-11, -0x0.e82213934406e8p-13, 0x0.b5e08057a4b1b0p-13, -0x0.b3f86edd88a440p-17, -0x0.d4c88a95efcd38p-15, 0x0.9a47f65476bd70p-17, 0x0.94c0be41497550p-19, -0x0.8e717603f30968p-20, 0x0.b381f5a830bef8p-20, -0x0.95fabaa61fd8d0p-23, -0x0.9185fcec558da8p-22, 0x0.e704ae89431ca0p-25, -0x0.e1f82b961d57a8p-29, -0x0.da374d12544458p-29, 0x0.985198ffd5d050p-27, // x=     2.5 y=    4.25
+ 0x0.bcb7a9e40ef878p-3, 0x0.cf0ae3cad38e58p-4, -0x0.84c7798cf09890p-5, 0x0.ae61757abf34e0p-6, -0x0.c46a349a89c7f0p-11, -0x0.e6d8fcd74a83f0p-8, 0x0.9d5d8b66ae4b80p-10, 0x0.eab7022544b6f0p-12, -0x0.adf36494b4d010p-13, 0x0.a62cd4e73c8b78p-13, -0x0.d7f3dcd77faaa8p-17, -0x0.a1c99cc2c76718p-15, 0x0.ee03109fab70c8p-18, 0x0.cea7ef8da96148p-21, -0x0.a7c75613c51bb8p-21, 0x0.8fa4270d96bd58p-20, -0x0.86fee38d7e37b0p-23, -0x0.b8cb779df645b8p-23, 0x0.97d017753ed4e0p-25, -0x0.8d1618b7e9cee8p-27, -0x0.8a42febfaff268p-30, 0x0.cf361c46ae4300p-28, // x=     2.5 y=     4.5
+ 0x0.b75291372ada50p-3, 0x0.bf4f491e9d6dd0p-4, -0x0.ee77af630c1690p-6, 0x0.aab402b8752cc0p-6, -0x0.86cd0121bdd360p-10, -0x0.cb38d26f397b00p-8, 0x0.89ab61204c96a8p-10, 0x0.9f4a49781071d0p-12, -0x0.81c95122dca510p-13, 0x0.94dc402297cb98p-13, -0x0.dfd248c1c3ca30p-17, -0x0.f537659cb3dcc0p-16, 0x0.b62b4c4d1b70b0p-18, -0x0.8aac5628917560p-24, -0x0.bbf333c12443b8p-22, 0x0.e118315a982668p-21, -0x0.e2aa758ba916b0p-24, -0x0.e6d1ddb5879f40p-24, 0x0.c4eae5c25f3750p-26, -0x0.9fbbeb393ec360p-27, 0x0.bd2684953afd08p-37, 0x0.8a35b82fb6bdd0p-28, // x=     2.5 y=    4.75
+ 0x0.b20eeab84d9c78p-3, 0x0.b12ab4f47e5000p-4, -0x0.d69b871480dc98p-6, 0x0.a61539f3350580p-6, -0x0.9f24a2e2ae48c8p-10, -0x0.b315de9d400fa8p-8, 0x0.f04b0c59f2bfe0p-11, 0x0.ce497032f2ba38p-13, -0x0.c0b68b95e66258p-14, 0x0.839c47f72ab590p-13, -0x0.d7e43c0234bad8p-17, -0x0.b96617bed6f2f0p-16, 0x0.8ab8af36587a90p-18, -0x0.8a8efbfd9ab510p-21, -0x0.c123ceee22da08p-23, 0x0.adf8a531dddde8p-21, -0x0.b6d7469ea69100p-24, -0x0.8d4f5d2b112ce0p-24, 0x0.fc761d02f293e0p-27, -0x0.94ec10e87a78d8p-27, 0x0.ebe3a635e2fb58p-32, 0x0.b5cb03b3ec19e8p-29, // x=     2.5 y=       5
+ 0x0.acf2dd11cc8a90p-3, 0x0.a46cd02c78e3e0p-4, -0x0.c1914d73407498p-6, 0x0.a0d9e969cc7708p-6, -0x0.ae636a73022e08p-10, -0x0.9e091470875770p-8, 0x0.d173743e146d40p-11, 0x0.f64bd71f6180b0p-14, -0x0.8e351ecf6f29d0p-14, 0x0.e6acc081042348p-14, -0x0.c7cbadf0ffc0d8p-17, -0x0.8bec77be9c99d8p-16, 0x0.d297730a2185e0p-19, -0x0.c4c997fc3df0b0p-21, -0x0.a50edab2122700p-24, 0x0.85422be1ca95a0p-21, -0x0.8fe27b46476630p-24, -0x0.a8787643f48338p-25, 0x0.9fcc15accb4008p-27, -0x0.fe74081b529348p-28, // x=     2.5 y=    5.25
+ 0x0.a802449e449758p-3, 0x0.98eb70eff6d028p-4, -0x0.aefc67c8de3d58p-6, 0x0.9b40ddb7116bc0p-6, -0x0.b6eb55d1b5c0e8p-10, -0x0.8bb107da1b8b18p-8, 0x0.b68166e1470f70p-11, 0x0.f80f7a63630cb0p-15, -0x0.d03c8b27f1eb00p-15, 0x0.c8f7482579d170p-14, -0x0.b428eea4b215d0p-17, -0x0.d2e1d70bd66900p-17, 0x0.9f89afe4bcc0a8p-19, -0x0.d9665a2d4fe680p-21, -0x0.8d5dfad57d2498p-26, 0x0.caf6c37943eb00p-22, -0x0.dee00ad8d6e5a0p-25, -0x0.c11ff952eb7140p-26, 0x0.c7d8254cbebf08p-28, -0x0.cf2f1c0d05e5f8p-28, // x=     2.5 y=     5.5
+ 0x0.a33f4ce4a77e30p-3, 0x0.8e81d84c5d5d40p-4, -0x0.9e8be77e5694f0p-6, 0x0.957846d144b828p-6, -0x0.ba8876c24f0e00p-10, -0x0.f7695884696d90p-9, 0x0.9f13d4bf82c9d8p-11, 0x0.8bba3967b651d8p-16, -0x0.96df8340762240p-15, 0x0.ae6a65dc0db898p-14, -0x0.9fb3d756723098p-17, -0x0.9eaa8093b8cb20p-17, 0x0.f176797eca0558p-20, -0x0.d8659f82b03c18p-21, 0x0.9460bccde8b7d8p-26, 0x0.9a0168b9937658p-22, -0x0.aad2f86a2b5250p-25, -0x0.cf9fafa8e73eb8p-27, 0x0.f5ea09bafeb610p-29, -0x0.a3de296b104d78p-28, // x=     2.5 y=    5.75
+ 0x0.9eaae45dadd150p-3, 0x0.85100043fe59b0p-4, -0x0.8ff96a5ad52db0p-6, 0x0.8fa1cf9a063768p-6, -0x0.ba9542f98df890p-10, -0x0.db88b4bf800430p-9, 0x0.8ac5146e09cb88p-11, -0x0.e9ae28d4a513a0p-17, -0x0.d77fa961797328p-16, 0x0.97056a22f38b80p-14, -0x0.8bf23a3b3fa658p-17, -0x0.ee52f418a6bbb8p-18, 0x0.b6a2fd4c734b60p-20, -0x0.cbb99b28eff500p-21, 0x0.947c4ff868ede0p-25, 0x0.e9392bb47a43d8p-23, -0x0.820b51d99a8ed0p-25, -0x0.c56fdd5c9fa1f8p-28, 0x0.9408d883de8ca0p-29, -0x0.fe750cf0a7ba48p-29, // x=     2.5 y=       6
+ 0x0.9a4513a409b0a8p-3, 0x0.f8f3f8ff9be840p-5, -0x0.8307eb738f59b0p-6, 0x0.89d5b732ac4a08p-6, -0x0.b81632deae2380p-10, -0x0.c333af1c51b880p-9, 0x0.f2656041221868p-12, -0x0.95374b8acbf7c0p-15, -0x0.96cb0b16dc1ed8p-16, 0x0.829ab019bece58p-14, -0x0.f35a60a3c5af98p-18, -0x0.b291f871404b68p-18, 0x0.8a1e75fa1f2e88p-20, -0x0.b9747c77372f80p-21, 0x0.b4395c9f5041f0p-25, 0x0.b06a4c3d489468p-23, -0x0.c5275c2c92f660p-26, -0x0.8807e4b2d29330p-29, 0x0.aca7fb7864a9e0p-30, -0x0.c32fcb172d09f0p-29, // x=     2.5 y=    6.25
+ 0x0.960d3f01c78d50p-3, 0x0.e94edb875156f8p-5, -0x0.ef053991a35d78p-7, 0x0.84252940f71fa0p-6, -0x0.b3ceb30b0ce758p-10, -0x0.adefa535f1db90p-9, 0x0.d402e3fe407878p-12, -0x0.d3ebe0eb3c2050p-15, -0x0.ccc2092036f998p-17, 0x0.e1cda4214e18a8p-15, -0x0.d277bb81978a68p-18, -0x0.8561c8fbf6ae20p-18, 0x0.d0e6c438460e28p-21, -0x0.a53340176d8f88p-21, 0x0.bb14f86ca505f8p-25, 0x0.8568fdb4466580p-23, -0x0.9512860b3140b0p-26, 0x0.bead8cd35100a0p-33, 0x0.bf839619e83720p-31, -0x0.948a87b5375858p-29, // x=     2.5 y=     6.5
+ 0x0.86d9e3ab09abb0p-11, 0x0.d8a11fbfc2d230p-2, -0x0.c1d93745dde6c8p-9, -0x0.b45144fbf2ba90p-3, 0x0.82e6817f86e308p-7, 0x0.aa4ecda9a867f8p-4, -0x0.da9599a8c839b0p-7, -0x0.ac00071528f318p-5, 0x0.f8c3cc22dca1f8p-7, 0x0.99e2790984d328p-6, -0x0.c6a553b15ddb58p-7, -0x0.9d78161b3daa10p-8, 0x0.d6e502fc3db5c0p-8, -0x0.d91630c9255ac8p-10, -0x0.fc08dcd8928e28p-10, 0x0.b324977c085220p-9, -0x0.86fa8dd82f1408p-12, -0x0.cb3f0dfdcd7410p-10, 0x0.9b22393223a1b8p-11, 0x0.c8ee6820becc78p-12, -0x0.976912708c4f28p-12, 0x0.bc402ec1d52a00p-14, 0x0.b5d47bb8a3b218p-15, -0x0.f4964998d462e8p-14, 0x0.e65cd73c4c1750p-16, 0x0.ab7b8b28969fb0p-15, -0x0.9ce45745038e10p-16, 0x0.c02d5980822180p-23, 0x0.ccab919c57a128p-19, -0x0.be7064b898d1c8p-18, 0x0.83cac31b354400p-20, 0x0.9a5c90dbab6ac0p-20, // x=    2.75 y=       0
+ 0x0.821c90ae1f7040p-4, 0x0.d294e2a7514fb0p-2, -0x0.e8cb2fe681acc8p-5, -0x0.9f8f3ca42527f8p-3, 0x0.a9b82d643e3450p-5, 0x0.ed94561b916ec8p-5, -0x0.dd68edbf238038p-6, -0x0.9098c805b11838p-6, 0x0.f2e405bae740e0p-7, 0x0.bcaf60073cb000p-10, -0x0.c5513062316c70p-8, 0x0.d07b3f044f0a40p-9, 0x0.a0cb4f474329d0p-10, -0x0.b5e9b5a1bdb258p-9, 0x0.d9c5aab9260468p-12, 0x0.a27f2b9bf37e20p-10, -0x0.8030d8cd39ef70p-11, -0x0.f789744e283648p-13, 0x0.d22ed5b0215240p-13, -0x0.b0022fc2c79bb0p-14, -0x0.c73813145694b0p-16, 0x0.a8b1fb90c3c620p-14, -0x0.9b93a443899f38p-16, -0x0.d3213c8c6ce198p-16, 0x0.bd2009d03d2c00p-17, -0x0.caae3dbb9a1658p-23, -0x0.95bbe99b924790p-19, 0x0.dd609ffb438c78p-19, // x=    2.75 y=    0.25
+ 0x0.cc22715798fe90p-4, 0x0.c9aac7dff7d148p-2, -0x0.a5702457d8a168p-4, -0x0.87d5d94513cf40p-3, 0x0.cb694f1d3a1ce8p-5, 0x0.9b913108740ee0p-5, -0x0.d0efa57ebc5ea8p-6, -0x0.a594872163fee8p-8, 0x0.a7ff2874b1b6a0p-7, -0x0.f6276606ca0dc8p-9, -0x0.a5ba4ed1bd14a8p-9, 0x0.f78b5f6106d128p-9, -0x0.d99f688f614740p-13, -0x0.f14de748914be0p-10, 0x0.93e9d617f1bfd0p-11, 0x0.f678c7432d52c0p-12, -0x0.92e9578d53ea28p-12, 0x0.8f702944b3e2c8p-15, 0x0.f4e37304211de0p-15, -0x0.b749feff65a688p-14, 0x0.c1b5247847c3b8p-17, 0x0.977c223f923e58p-15, -0x0.d27fbd8d034068p-17, -0x0.904aa9a6498ea0p-18, 0x0.f44349f28f7a68p-19, -0x0.b1f8fd1cca8c60p-19, 0x0.dea760565929d0p-25, 0x0.c79f7ede886168p-20, // x=    2.75 y=     0.5
+ 0x0.84cde4a6610b00p-3, 0x0.be4eade9002658p-2, -0x0.c319041a5af218p-4, -0x0.dc0aeff2bbab90p-4, 0x0.cd8521153e57c8p-5, 0x0.a86a7733aa1e80p-6, -0x0.a952d902593980p-6, 0x0.c1ae5106829ce0p-9, 0x0.c1e5fd31f47780p-8, -0x0.b3b93cdfe5eed8p-8, -0x0.ef7f6ddb03b398p-12, 0x0.c829ba5d4c7b10p-9, -0x0.a8c78fca1518c8p-11, -0x0.fd1a12b6948ca0p-11, 0x0.db285db5ac11d0p-12, 0x0.aabcf27df513f0p-14, -0x0.ff2b973e5be698p-14, 0x0.bfb90552b69e60p-14, 0x0.afea3a4b573880p-19, -0x0.dda1b9aa75c2c0p-15, 0x0.e3d7e28ebdacf8p-17, 0x0.c34b3615c05820p-17, -0x0.c000704b0b1ed0p-18, 0x0.b685bed8faba28p-20, 0x0.b8c3fb3950afb8p-21, -0x0.eb9c8dff826520p-20, // x=    2.75 y=    0.75
+ 0x0.9d2a9ad0d44740p-3, 0x0.b19c3123212b28p-2, -0x0.d0ec3a255eaee8p-4, -0x0.aa70d2911ab3c8p-4, 0x0.bd26094d133c38p-5, 0x0.e9d5a3eb29d1a0p-8, -0x0.f832490f6ad010p-7, 0x0.eaf5beba9942f0p-8, 0x0.b2455041f8d778p-9, -0x0.af7381f0791210p-8, 0x0.88c98e9e1dc9a8p-11, 0x0.8759148fb3ca18p-9, -0x0.a5c29f82b879d0p-11, -0x0.cc84be424184a8p-12, 0x0.806b09b3d67db0p-12, -0x0.8b3cb0b62442c0p-14, -0x0.99af1c28588880p-15, 0x0.a01ff24964a7f0p-14, -0x0.c8339d62d31b30p-17, -0x0.d099ad51f12de8p-16, 0x0.903129f1d463a0p-17, 0x0.e5dda4bbdcd2f0p-20, -0x0.8453a65eded010p-19, 0x0.faad4bc9ec1e28p-20, -0x0.8f7ec485a8b100p-23, -0x0.d9afd41293b2c0p-21, // x=    2.75 y=       1
+ 0x0.afa3c78036dbb0p-3, 0x0.a46f54675fa208p-2, -0x0.d312d5d15ae828p-4, -0x0.fc5c1c9053b410p-5, 0x0.a41e882c7c3068p-5, -0x0.97e051c526c2b0p-9, -0x0.a753b26056d498p-7, 0x0.8ff6800c3a6be8p-7, 0x0.b44b819ec9d708p-11, -0x0.91d9866d66e448p-8, 0x0.ddd08443b5e358p-11, 0x0.a0a5735e0e7880p-10, -0x0.fad2ab14b35588p-12, -0x0.a51a44d2750e48p-14, 0x0.fc441fa5164ca0p-14, -0x0.cc9cdc4df93388p-14, -0x0.d4373e87314df0p-22, 0x0.cb3fc93d6d3880p-15, -0x0.c3d27f95759690p-17, -0x0.99a1ca3b17a2e8p-17, 0x0.8f59537e2fec10p-18, -0x0.a34938b7e59718p-20, -0x0.deb619da160c30p-22, 0x0.a57919547c1560p-20, -0x0.f681fff14fbb30p-23, -0x0.9d6793a97c3ef0p-22, // x=    2.75 y=    1.25
+ 0x0.bcfd78320a7a88p-3, 0x0.9763e24ac98420p-2, -0x0.cd5068733ccb70p-4, -0x0.b1232375871bf0p-5, 0x0.88bf5e2f781a58p-5, -0x0.8a52e3b7886da0p-7, -0x0.ce7ae21850b218p-8, 0x0.90e9fae0cfffc8p-7, -0x0.eb09c0d9a68318p-12, -0x0.dd13ebb6180560p-9, 0x0.dd14a3f17b48c0p-11, 0x0.a5e55553fd53e8p-11, -0x0.a5abdd80b8f598p-12, 0x0.80477da693b9a0p-14, 0x0.c528db64d3cad8p-15, -0x0.b0e32a4f9477e0p-14, 0x0.b7a72c173f8b20p-17, 0x0.dc1469a152e6c0p-16, -0x0.85a41b15aee190p-17, -0x0.8442d63b87c850p-19, 0x0.eaee14bdde7a38p-20, -0x0.ccb095b1e52a68p-20, 0x0.b1e1ddc1a204c0p-24, 0x0.ab607e55582398p-21, -0x0.a9dc9ddcc0d030p-23, -0x0.9f981073e0e378p-24, // x=    2.75 y=     1.5
+ 0x0.c6104d490dcc20p-3, 0x0.8adf4dc8941eb8p-2, -0x0.c2a5ea0770de68p-4, -0x0.e6cbc19a6b42c0p-6, 0x0.dd338e0b9a7f98p-6, -0x0.c51d696afe0f88p-7, -0x0.e0d6107f7a18a0p-9, 0x0.84872913490cf0p-7, -0x0.813f4cdda9c3e0p-10, -0x0.9d05a9e16577f8p-9, 0x0.b9f0b3f276f398p-11, 0x0.87fcc088b55ef0p-12, -0x0.c6209ed20ce6d0p-13, 0x0.dfeaae46d043b8p-14, 0x0.a38da4ce500958p-17, -0x0.fe21efc36eda80p-15, 0x0.c67566eebe3680p-17, 0x0.ce21cf65db6fb0p-17, -0x0.9a7f841dedbfc8p-18, 0x0.b828dda9265f00p-21, 0x0.90af687cf8a060p-21, -0x0.97023dbe482448p-20, 0x0.b7bb17719234c8p-23, 0x0.962db4e86c91d0p-22, // x=    2.75 y=    1.75
+ 0x0.cbac5561e34af8p-3, 0x0.fe3ac1b9142918p-3, -0x0.b54a67408a8100p-4, -0x0.8414e53761a3a0p-6, 0x0.aec891416ef7f8p-6, -0x0.e2431a499e93b0p-7, -0x0.bd435b01e56c50p-10, 0x0.e51dbb906f6d68p-8, -0x0.98755a12e11ec8p-10, -0x0.d346fca603e358p-10, 0x0.8ee4b745f3f020p-11, 0x0.bf20602f5034c0p-15, -0x0.d6b6cff81c0658p-14, 0x0.e1805c27cc2488p-14, -0x0.d5464bcb0c8028p-18, -0x0.a45991c34a8568p-15, 0x0.9cd4b71aa013d0p-17, 0x0.9c4ecb41fc40d0p-18, -0x0.9e6013de6bd160p-19, 0x0.b0c988c90346c0p-20, 0x0.cac9a6e6c77ce8p-25, -0x0.b8289ec4e04198p-21, 0x0.953f0aa1ff60e8p-23, 0x0.d8c7c25ea63220p-24, // x=    2.75 y=       2
+ 0x0.ce8adcc00c3c10p-3, 0x0.e8781d76164870p-3, -0x0.a6c7d2beb902b0p-4, -0x0.db533abd90e678p-8, 0x0.8769a6b05fb590p-6, -0x0.eb658ec9290870p-7, -0x0.93049a5a9dcca0p-13, 0x0.bef50024751180p-8, -0x0.95d6a11987fdd0p-10, -0x0.8697d6c38ac490p-10, 0x0.cf34d3d3bfecf0p-12, -0x0.867169acd58b00p-14, -0x0.cb2c88edfd80c0p-15, 0x0.be848a8f5c1e98p-14, -0x0.c0a5ba2db98c38p-17, -0x0.c49a025ce40120p-16, 0x0.d859a873c2d5d0p-18, 0x0.ff6a4cbe0a26f0p-21, -0x0.8f01cfae161b18p-20, 0x0.a0b2b585e3eef8p-20, -0x0.e84f2fc15ddf38p-24, -0x0.c80eb2eb81bcc0p-22, 0x0.bf8e9242f4b560p-24, 0x0.cccc7a0cef6580p-26, // x=    2.75 y=    2.25
+ 0x0.cf4967c2aaa660p-3, 0x0.d48a26f7c05960p-3, -0x0.9821901546cf00p-4, 0x0.8fe752bbcb37b8p-11, 0x0.ce096951818a70p-7, -0x0.e7bd2e9af51e90p-7, 0x0.aeb3a5b69bbe18p-11, 0x0.9b36507a6aa160p-8, -0x0.86d99dde95eaa0p-10, -0x0.a052f227cf5880p-11, 0x0.8fde551a3a6478p-12, -0x0.e8f82f676487e8p-14, -0x0.9093419a247e18p-16, 0x0.9340dea6cadcb0p-14, -0x0.c2550b0805d398p-17, -0x0.da4cfaa6757008p-17, 0x0.89688276c5c4f8p-18, -0x0.a12a4d87ea51c0p-21, -0x0.d2b86dc1c8b090p-22, 0x0.ede879f3c13178p-21, -0x0.8979ff6ef8ed90p-23, -0x0.c4ffe077cd6910p-23, 0x0.d98b5eaf597428p-25, -0x0.8d485ce2a69fa0p-28, // x=    2.75 y=     2.5
+ 0x0.ce69c51ee88910p-3, 0x0.c26a67e36980e8p-3, -0x0.89f8b02c34dda0p-4, 0x0.c4f4aa7ebfa838p-8, 0x0.99db37206adab0p-7, -0x0.dc6e5f540ba6a8p-7, 0x0.93b50464613120p-10, 0x0.f7cca638269110p-9, -0x0.e6a969e11069f0p-11, -0x0.ac1c5b8631ef00p-12, 0x0.c086d348a71450p-13, -0x0.81046e4108ac68p-13, -0x0.98e6f7dc45f930p-21, 0x0.d78270c8a711f8p-15, -0x0.a42b532ba497c0p-17, -0x0.dceb3dece2fd80p-18, 0x0.a3f8d804dab0a8p-19, -0x0.90f64a054f5d68p-20, -0x0.a4702de4c2d620p-24, 0x0.9eef0580c050e0p-21, -0x0.dfc60ec8f032f0p-24, -0x0.acaa0817bc3a00p-24, 0x0.e2294b498b7c40p-26, -0x0.bf68f756338330p-27, // x=    2.75 y=    2.75
+ 0x0.cc549ec021dd00p-3, 0x0.b202d7c1ca0f68p-3, -0x0.f95331564f59d0p-5, 0x0.a4a6f563038c30p-7, 0x0.e0f91467bb9de8p-8, -0x0.ccfd94e26b46e8p-7, 0x0.b1a17958571fe8p-10, 0x0.c3226764f4e238p-9, -0x0.befd8845f26f48p-11, -0x0.94c71a94dbde38p-13, 0x0.f854810d4f2af0p-14, -0x0.f5a0b52d822af8p-14, 0x0.f765dab0f4b058p-18, 0x0.97cd71d8fa6120p-15, -0x0.fe23bed6a014d8p-18, -0x0.bf2918c7c03b90p-19, 0x0.b890242f8ce758p-20, -0x0.9170f19407dbf0p-20, 0x0.df94cdf450a9d8p-25, 0x0.c6da35fe965ca0p-22, -0x0.9d999ec09fb7e0p-24, -0x0.f71a9aabed9398p-26, // x=    2.75 y=       3
+ 0x0.c95d0114c2a0d0p-3, 0x0.a334f7363613c0p-3, -0x0.e0c50625c85dc8p-5, 0x0.d47535d7507980p-7, 0x0.a02a963a0b8738p-8, -0x0.bbbc9b3057a718p-7, 0x0.bbe1c4ad8564c0p-10, 0x0.98031cd9eb1430p-9, -0x0.9abe6b9c1d4aa0p-11, -0x0.c8e0857d94eba0p-16, 0x0.99672c9e9dcd90p-14, -0x0.d8c527217e19d8p-14, 0x0.ae2e4173ffaf78p-17, 0x0.cf98f9b7815720p-16, -0x0.bab110e1836660p-18, -0x0.d89d3a5a69f338p-21, 0x0.c1fbbd2418b6e8p-21, -0x0.f4eba2f21e8c20p-21, 0x0.c23069b1fa0a80p-24, 0x0.ec833ca36252d0p-23, -0x0.cd4c018e73fdb0p-25, -0x0.b2ccdf3bfb63f8p-28, // x=    2.75 y=    3.25
+ 0x0.c5c402ff9c64f0p-3, 0x0.95de8282e70b70p-3, -0x0.ca677c22e0c590p-5, 0x0.f5f23f36f58ec8p-7, 0x0.dbd022fa32dab0p-9, -0x0.aa2415f2b780e8p-7, 0x0.b9f2d47f1c5ad0p-10, 0x0.eaaf5655ea93d8p-10, -0x0.f6fd9fd4cca858p-12, 0x0.c585511f32b090p-15, 0x0.b2940751a67b38p-15, -0x0.b702fe9240ebb8p-14, 0x0.b4e79aa4bea520p-17, 0x0.8a4cdd6ca36120p-16, -0x0.846bd86e3b3ab0p-18, 0x0.ef5213839d8960p-23, 0x0.b80bba827101f8p-22, -0x0.bd59b5d65f3878p-21, 0x0.c0bb8aed8bf190p-24, 0x0.86340386590540p-23, -0x0.fda39cd836a6c0p-26, 0x0.8e7486b344d2d0p-28, // x=    2.75 y=     3.5
+ 0x0.c1bc258113b010p-3, 0x0.89dc6e217c0300p-3, -0x0.b636088ac07418p-5, 0x0.863061c3608600p-6, 0x0.8e87ff525912c0p-9, -0x0.99178fd4842b48p-7, 0x0.b0e5c701b36208p-10, 0x0.b3a68e17c3a6b0p-10, -0x0.c2fe685b0116c0p-12, 0x0.b61a17c9c119f8p-14, 0x0.bc56f9db720a60p-16, -0x0.96383b5897c9c8p-14, 0x0.a6adea55e02fb8p-17, 0x0.b388d76c2cf1c8p-17, -0x0.b711f1dd432068p-19, 0x0.b58bb257f8c0b8p-21, 0x0.8dec0e1510f908p-23, -0x0.8b3a2188894788p-21, 0x0.a15e38fcd31e28p-24, 0x0.9072e5e5f1f7a8p-24, -0x0.964f408e069ba0p-26, 0x0.ea55937f44e328p-28, // x=    2.75 y=    3.75
+ 0x0.bd6c40b13461b0p-3, 0x0.fe196c186bbbf0p-4, -0x0.a4165858c329e8p-5, 0x0.8d2bdd293ea120p-6, 0x0.a7366bee17bfc8p-10, -0x0.8916e6b7f1caf0p-7, 0x0.a411e4b923e1d8p-10, 0x0.886047287393e0p-10, -0x0.98b96ff7053498p-12, 0x0.dec4cd7c731d28p-14, 0x0.a06cf219082c18p-17, -0x0.f2053b1a6a9ca8p-15, 0x0.9034d28e14ea68p-17, 0x0.e23838c3434b60p-18, -0x0.f7dd5e72fc0060p-20, 0x0.db9c8647037428p-21, 0x0.be8695d368f238p-26, -0x0.c6208bd980aaa0p-22, 0x0.f8cbc8fba10fb8p-25, 0x0.9080efc2b6bc30p-25, -0x0.ab722b226ac090p-27, 0x0.e536f219a7d768p-28, // x=    2.75 y=       4
+ 0x0.b8f1f544d23cb8p-3, 0x0.ea9ec679a6ae00p-4, -0x0.93e277ddfe8fc0p-5, 0x0.90f05b4af77758p-6, 0x0.9c42cfbc0fdc88p-11, -0x0.f4c21e1ebb1540p-8, 0x0.959bec0520d5c8p-10, 0x0.cd2b545e11dd88p-11, -0x0.edcb977bfdf308p-13, 0x0.ec8034ea1a3190p-14, 0x0.d3ae38b4b6ab50p-20, -0x0.c077d7aa0d63b8p-15, 0x0.f04e68d6afbe30p-18, 0x0.89138134be4d28p-18, -0x0.a4ad4cbb674850p-20, 0x0.d7917ef4a72c28p-21, -0x0.81ca369a7fc608p-25, -0x0.89b8d265cc5f00p-22, 0x0.b6c825f8126cf0p-25, 0x0.fe93bab0453d90p-27, -0x0.bb7aaffcd4bfa8p-28, 0x0.be89a9b0237380p-28, // x=    2.75 y=    4.25
+ 0x0.b463aa5c953b08p-3, 0x0.d90e1b126ad670p-4, -0x0.856f597cafce98p-5, 0x0.9249939fb160e8p-6, 0x0.b73a6add6bd518p-14, -0x0.da17e3cdbc65a0p-8, 0x0.86d87c02b76cf8p-10, 0x0.98ae292929dc88p-11, -0x0.b83d3019d599a8p-13, 0x0.e9dfb3f9aa35f8p-14, -0x0.d3108f69b70700p-19, -0x0.97b1f4a00c16f0p-15, 0x0.c371d216c09fc0p-18, 0x0.9cbaaef06f1868p-19, -0x0.d6b51d14e35ab8p-21, 0x0.c0c2060a42ea50p-21, -0x0.db129cbe726040p-25, -0x0.bc12a80555b398p-23, 0x0.822c8509111468p-25, 0x0.a37b948ef9c500p-28, -0x0.c1f8ceabfb6470p-29, 0x0.924dcea39974c0p-28, // x=    2.75 y=     4.5
+ 0x0.afd2263b316fb8p-3, 0x0.c932143b46b1c8p-4, -0x0.f121c99b1cfd00p-6, 0x0.91d5c9ae03b270p-6, -0x0.9775c2d18815f8p-12, -0x0.c228f7b4e05ad0p-8, 0x0.f12329ec6e5148p-11, 0x0.e0301dd33cd558p-12, -0x0.8e29dcd829e1d0p-13, 0x0.dddc999b0791a8p-14, -0x0.c0878484f6f948p-18, -0x0.ed9da5e4d6f768p-16, 0x0.9c6a5c5cff3da0p-18, 0x0.a1d5557c1f82c0p-20, -0x0.88fc056139b198p-21, 0x0.a3b405b6674238p-21, -0x0.edc323643c07d8p-25, -0x0.fd06e72965d628p-24, 0x0.b575b0f1d0c7a0p-26, -0x0.94dcc12a5ea790p-32, -0x0.b7e024551e8990p-30, 0x0.d68c681fea5eb8p-29, // x=    2.75 y=    4.75
+ 0x0.ab49d239ea4e80p-3, 0x0.badace2d7ec260p-4, -0x0.da38c11eccfa20p-6, 0x0.900f6466fd1740p-6, -0x0.939080de81ba68p-11, -0x0.acd26e80e0aa48p-8, 0x0.d66d4278e60158p-11, 0x0.a1aa9c36870a48p-12, -0x0.da91b7c5661f30p-14, 0x0.ccf8fb34228be0p-14, -0x0.e9e0b35008f6f0p-18, -0x0.b94588607d2a50p-16, 0x0.f7a00d6d016608p-19, 0x0.847eb574371940p-21, -0x0.aa132d05f595b0p-22, 0x0.86b359cd2e2d98p-21, -0x0.deb5fbe9bd3e18p-25, -0x0.a7e227e8eef140p-24, 0x0.f8f3b9be889ee0p-27, -0x0.ac5a18f863def8p-29, -0x0.9221b4b13227b0p-31, 0x0.98bba091335788p-29, // x=    2.75 y=       5
+ 0x0.a6d3b9855615f8p-3, 0x0.addd9370d93d38p-4, -0x0.c5d39200faab30p-6, 0x0.8d54af1bfdd210p-6, -0x0.c6cb662d774fb0p-11, -0x0.99e251ba6d6518p-8, 0x0.bdfa32611de880p-11, 0x0.e361ee8bf29e80p-13, -0x0.a7614876c2af80p-14, 0x0.ba0d6e535032e8p-14, -0x0.f6d7a4808c02f0p-18, -0x0.8fff5475421fe0p-16, 0x0.c289f0c666a628p-19, 0x0.fc132436262688p-25, -0x0.cb2bbf4cd4dd60p-23, 0x0.d929d855260e80p-22, -0x0.c1ff651595a938p-25, -0x0.dbaa3c86a392b0p-25, 0x0.a8897bb9ad5480p-27, -0x0.e043cf345a7d08p-29, // x=    2.75 y=    5.25
+ 0x0.a276504cde20e8p-3, 0x0.a2147a5d55e6c8p-4, -0x0.b3a8eb67d05818p-6, 0x0.89ee07a19e66f8p-6, -0x0.ea3e55ebe0dba0p-11, -0x0.89204cf82c5050p-8, 0x0.a7ecbd959a6a28p-11, 0x0.9a0c43bd52ab78p-13, -0x0.ff485efff6cc70p-15, 0x0.a6d7b29f2a2810p-14, -0x0.f2d0958c084a98p-18, -0x0.df505f749e3670p-17, 0x0.980c4d131e9ec8p-19, -0x0.d0fd5f58918f08p-23, -0x0.e4665f6ef92c40p-24, 0x0.aca8a5d67f5aa0p-22, -0x0.a2085768446538p-25, -0x0.8d6c69cee64bf0p-25, 0x0.e1d943b7776e98p-28, -0x0.e0ecf7d7dcc508p-29, // x=    2.75 y=     5.5
+ 0x0.9e360ee3112dd0p-3, 0x0.975df552d751d8p-4, -0x0.a376a2978e3500p-6, 0x0.8612bf38c685d8p-6, -0x0.80d403742440f8p-10, -0x0.f4a5fea1a48978p-9, 0x0.943c59f9fdbf38p-11, 0x0.c481094e9c0a38p-14, -0x0.c1b5c785b38a60p-15, 0x0.945c2a467d58f8p-14, -0x0.e5336a722bb7d8p-18, -0x0.acd9b59b635390p-17, 0x0.ecda9f39e4e618p-20, -0x0.b1aeb67db7cd28p-22, -0x0.e5b13ca6d1d4a8p-25, 0x0.87fe97ce309cd0p-22, -0x0.83ce1a9a982f28p-25, -0x0.b27c4e98a63048p-26, 0x0.95c9e76a6d89a8p-28, -0x0.cac6e2428377d8p-29, // x=    2.75 y=    5.75
+ 0x0.9a15ea34968a48p-3, 0x0.8d9c607a9762d0p-4, -0x0.95019dfc12eed0p-6, 0x0.81ecede532e308p-6, -0x0.87f7a542635520p-10, -0x0.da8631aadf0c70p-9, 0x0.82c7f8992af188p-11, 0x0.e0219f7f0e6128p-15, -0x0.921609278a7af0p-15, 0x0.8327a562026cc8p-14, -0x0.d2bb443590c950p-18, -0x0.859763cd804028p-17, 0x0.b81032503c0e68p-20, -0x0.d32f2ec884daa0p-22, -0x0.b01ecccf1611a8p-26, 0x0.d4df74696de640p-23, -0x0.d2bbaba0595748p-26, -0x0.db31e586710a58p-27, 0x0.c49606cb4625c8p-29, -0x0.acb306587f5f08p-29, // x=    2.75 y=       6
+ 0x0.9617b121270c18p-3, 0x0.84b5936e6b0e10p-4, -0x0.881574f5b05f98p-6, 0x0.fb38ddd2814080p-7, -0x0.8ba95b7e150598p-10, -0x0.c37a17d00d1c30p-9, 0x0.e6c412179e18b8p-12, 0x0.c2759a01381208p-16, -0x0.da9b5578b10618p-16, 0x0.e6f6a5f683eca8p-15, -0x0.be5c72c090ae50p-18, -0x0.ce35b8a8637b60p-18, 0x0.8ed6322f895e40p-20, -0x0.dc47643b571640p-22, -0x0.a4065d4d53a518p-31, 0x0.a5e60ab262f2c8p-23, -0x0.a67ef3fb572828p-26, -0x0.8143ad7755d960p-27, 0x0.fee1287f5ae710p-30, -0x0.8e21297881dfa8p-29, // x=    2.75 y=    6.25
+ 0x0.f0b6ff5fd621d8p-14, 0x0.c4732a4c70f980p-2, -0x0.bc0ef782df4a70p-11, -0x0.90b3e89a367858p-3, 0x0.8b65f9633fc110p-9, 0x0.ed2f8924211430p-5, -0x0.8188f9d1cfcc18p-8, -0x0.d8868d8abca7e0p-6, 0x0.a78c87ff04d228p-8, 0x0.ca4568094b7570p-7, -0x0.9d9f4611422a80p-8, -0x0.9f3ca19fa70908p-8, 0x0.d8ae21f9ca2df0p-9, 0x0.f831c2aa687048p-11, -0x0.ceca1123976790p-10, 0x0.8e5e2828f12738p-11, 0x0.d4db322bcb81f8p-12, -0x0.ad45ff84f00e68p-11, 0x0.8ffbabc64eca90p-14, 0x0.b1620e978410e0p-12, -0x0.82236050377fd0p-13, -0x0.a6393fbce955e0p-14, 0x0.f3732940e7bb18p-15, -0x0.8a4964e63db9d8p-16, -0x0.9fc07d5b1e72e8p-17, 0x0.b72c97dada6d68p-16, -0x0.9654dd02885da8p-18, -0x0.8434ac19b74f08p-17, 0x0.d419607a391620p-19, 0x0.ec459688d8ea80p-24, -0x0.a8e01696d3c8d8p-22, 0x0.b8fe4a00931950p-21, // x=       3 y=       0
+ 0x0.d31dea3b1c0560p-5, 0x0.c05b0e25b23fa0p-2, -0x0.a558a30f41a3e8p-5, -0x0.851c24a0fba5e0p-3, 0x0.d3d9b8c62f43f0p-6, 0x0.bb0895d47039b8p-5, -0x0.fec0e3e7505748p-7, -0x0.f4b2e0ed97ef20p-7, 0x0.8c522126b1c948p-7, 0x0.e029fa16f007c8p-9, -0x0.822fdcff916a90p-8, 0x0.d8f6db0ed7c388p-12, 0x0.af097744a55fa0p-10, -0x0.8cd9abf05d9dc8p-10, -0x0.b4b64be3754600p-13, 0x0.b703fa2ea4f798p-11, -0x0.8c4305624ce7c8p-13, -0x0.88a3ff6caa0d08p-12, 0x0.e593ddf1ad6708p-14, 0x0.9b257da850ca80p-15, -0x0.a320cff3dbbaf8p-15, 0x0.ae72f5275d5448p-16, 0x0.f2642d3ea3d790p-19, -0x0.854a962d70d380p-16, 0x0.f22a6342f1d778p-19, 0x0.99cd970744f800p-18, -0x0.8a1b3f0789ba30p-19, 0x0.c684e0f5a0a408p-28, // x=       3 y=    0.25
+ 0x0.a86474ccd87f30p-4, 0x0.b9db572b59a7e0p-2, -0x0.f6564c4f11a728p-5, -0x0.eb11c4f9349668p-4, 0x0.8b2e8ea5e47000p-5, 0x0.884a456c2675b0p-5, -0x0.89e65d6faae710p-6, -0x0.e408d6269eda38p-8, 0x0.e9e2ca7648c050p-8, -0x0.83da9245600770p-11, -0x0.97ad11e6b64068p-9, 0x0.d560c132ddc820p-10, 0x0.c263fe60d1f2b8p-12, -0x0.89183ebe780678p-10, 0x0.96668d610f5520p-13, 0x0.d30d03942f9dc0p-12, -0x0.94be0c846a07f0p-13, -0x0.9e27bc63d76f00p-14, 0x0.eb8d43a0569768p-15, -0x0.91d04b2799b988p-16, -0x0.955b6e160ae218p-17, 0x0.9ec5b1c47c4568p-16, -0x0.c976217dbe5470p-19, -0x0.dcd9cecc4180a8p-18, 0x0.9e7eca09a0ea58p-19, 0x0.9d5e2d51e3f8b0p-21, -0x0.a8256609ea9178p-21, 0x0.8619495273c1d0p-21, // x=       3 y=     0.5
+ 0x0.dea42f0a6d7ad8p-4, 0x0.b13a044fb1d708p-2, -0x0.96ec07d34f5e80p-4, -0x0.c6726dd80229f0p-4, 0x0.96b29299d14f88p-5, 0x0.ad303374936650p-6, -0x0.f8d7b53d7cfca8p-7, -0x0.edc8d4c98590c0p-11, 0x0.a1d6d055dc1dc8p-8, -0x0.a464dd87fa7c38p-9, -0x0.fff337f5c60308p-11, 0x0.e7f7971d85d258p-10, -0x0.ed231e466b8728p-14, -0x0.bd6bb8760687d8p-11, 0x0.d0f55990b323e0p-13, 0x0.afef2f662f4050p-13, -0x0.be3def2760be20p-14, 0x0.c8660565978b38p-18, 0x0.a6b5e4e3b29478p-16, -0x0.c799a5ca226788p-16, 0x0.d122849e8d95e0p-20, 0x0.ab1c2b22c77760p-17, -0x0.c10af8c9e4a8f8p-19, -0x0.e69ab486504e48p-20, 0x0.85139c890df950p-20, -0x0.cc1a818e765a18p-22, // x=       3 y=    0.75
+ 0x0.85c68101287ed8p-3, 0x0.a73bcb51cc3248p-2, -0x0.a71726ae4c6d30p-4, -0x0.a0fccf3f8bb690p-4, 0x0.92fddb6dc15448p-5, 0x0.b1072f1bce61b8p-7, -0x0.c9029d9c2e0438p-7, 0x0.c3447394321588p-9, 0x0.be37fea5713608p-9, -0x0.cee3702fc36fa0p-9, -0x0.941c16a6ae0a20p-13, 0x0.bdcf706be69760p-10, -0x0.9164dd4b1ae1b8p-12, -0x0.d3673a58927cc8p-12, 0x0.a60c10b5395da0p-13, 0x0.947c1f01aa42b0p-15, -0x0.ba5910660a2e90p-15, 0x0.efffd3dc28bd68p-16, 0x0.bcf803682b37d0p-19, -0x0.8b7c939f36e670p-16, 0x0.e322695fcb0088p-19, 0x0.877484c495ec78p-18, -0x0.d7f8cccd48c280p-20, 0x0.9dcac5ecec6960p-25, 0x0.97d25619221868p-22, -0x0.d0f2fe14bcd508p-22, // x=       3 y=       1
+ 0x0.97a8f66087d598p-3, 0x0.9c895639b2c8b8p-2, -0x0.add9533bf34e10p-4, -0x0.fb66cce58a8738p-5, 0x0.863d14f8f2d7a0p-5, 0x0.b6c336497b78e8p-9, -0x0.9593e114a9c388p-7, 0x0.a603a7c4b80628p-8, 0x0.b2713b5016b0c8p-10, -0x0.c6d65c72a9f460p-9, 0x0.937f81b2a56c00p-12, 0x0.8553c6de3e95f8p-10, -0x0.93223442ca3960p-12, -0x0.b9cd1867324fa0p-13, 0x0.d2ebdc6672bc78p-14, -0x0.b9fe3daf0597e8p-16, -0x0.8687a47b8a8558p-16, 0x0.e2e48206c82cd8p-16, -0x0.c5dfb2ae65a7b0p-19, -0x0.9640c4f73542b8p-17, 0x0.ada3eb8bcf61e0p-19, 0x0.860868e5c43bd8p-20, -0x0.b7ab38c7508e48p-21, 0x0.de38365a0299d0p-22, 0x0.b2b1cce3a55b70p-26, -0x0.f19d58fc97ae90p-23, // x=       3 y=    1.25
+ 0x0.a55c5606b1ee38p-3, 0x0.91a617e8dc7be8p-2, -0x0.ad92fc807dd6e0p-4, -0x0.bc72694ce27190p-5, 0x0.ea56cdd6b59b28p-6, -0x0.c2d819507420a8p-9, -0x0.cee8910394ad68p-8, 0x0.c08b25561db248p-8, 0x0.b0ed53e26353a8p-12, -0x0.a80cdc5f0dd1c0p-9, 0x0.e531b080d3b5f0p-12, 0x0.a69c4e516a2768p-11, -0x0.ea7313484e4f08p-13, -0x0.b8f20e397b59d0p-15, 0x0.e39473d3a48098p-15, -0x0.a11cb5a7373ff0p-15, -0x0.8cc85028ab9d98p-19, 0x0.9f4d75fabace70p-16, -0x0.fb33a2dec27058p-19, -0x0.82a9f9e3a4ec50p-18, 0x0.c8738c5e5da2b0p-20, -0x0.9e9be7ef043ad8p-23, -0x0.e3bbf4e72ae818p-23, 0x0.bbfe1a898518e8p-22, // x=       3 y=     1.5
+ 0x0.af6712b5478dd0p-3, 0x0.86f0f028d5e008p-2, -0x0.a86a5775764be8p-4, -0x0.866a6013c036f8p-5, 0x0.c5e9c747f97850p-6, -0x0.df626883d5bec0p-8, -0x0.84138517a6f0c8p-8, 0x0.c0b375bec9c2e0p-8, -0x0.8ccd03820047b8p-12, -0x0.8329cde4068ab0p-9, 0x0.ea4f2b3b5aec80p-12, 0x0.b7f275919e60a8p-12, -0x0.a457da19a13a88p-13, 0x0.bb6c4e3538b7f8p-16, 0x0.cb2830ce4ab968p-16, -0x0.97f5257711bdb8p-15, 0x0.dc148f0309d2f0p-19, 0x0.beb26333669700p-17, -0x0.c42c55ca1bb038p-19, -0x0.a23bce1782def0p-20, 0x0.c0b18da39ff908p-21, -0x0.e25a6f6ac6b388p-22, -0x0.af8792e6534280p-26, 0x0.e64e50f66f2530p-23, // x=       3 y=    1.75
+ 0x0.b659a09e2ab2c0p-3, 0x0.f952d936400650p-3, -0x0.a020216bf584b0p-4, -0x0.b2b8808fbf4508p-6, 0x0.a2fc8ba2b0f1c0p-6, -0x0.960a37b6472600p-7, -0x0.96a834a14d3228p-9, 0x0.b22a27b23bd188p-8, -0x0.97c71fcfeb7f88p-11, -0x0.c139296a14b840p-10, 0x0.cc9684bced1440p-12, 0x0.a7c50e31a655f0p-13, -0x0.d209002260ec00p-14, 0x0.caad0e6e410568p-15, 0x0.f3e43a245b22e8p-18, -0x0.eb4f4c308e6738p-16, 0x0.95916c0d2e9b98p-18, 0x0.c86c810106bec0p-18, -0x0.fdadeb0ce86338p-20, -0x0.a5c8e94dfebc78p-26, 0x0.972d6e2e352b90p-22, -0x0.cb9fb1dfb2d5f8p-22, 0x0.9e92572264e040p-25, 0x0.eca2ee08241a00p-24, // x=       3 y=       2
+ 0x0.babf1014bb58f8p-3, 0x0.e5ece01365f4f0p-3, -0x0.9609f84add4158p-4, -0x0.d285cba696af58p-7, 0x0.83853d2c1ff8d0p-6, -0x0.aa2e773f5c9170p-7, -0x0.89fc7bbc88b558p-10, 0x0.9cd2d24eaaca80p-8, -0x0.b74c02297b5ba0p-11, -0x0.878ff27e56fe88p-10, 0x0.a3e231e87e8a70p-12, 0x0.b33d8e78876938p-15, -0x0.f636d8ea187eb8p-15, 0x0.dd5c14c5b22f98p-15, -0x0.918d6f26055190p-20, -0x0.a38f74b21af498p-16, 0x0.8466bbe316f1d0p-18, 0x0.b4063a5d2f7720p-19, -0x0.9168cd2fc87808p-20, 0x0.d001ae3194df08p-22, 0x0.9a922bed235ae0p-24, -0x0.8dc3b04e586e90p-22, 0x0.b430acbda37778p-25, 0x0.d055d4efa52070p-25, // x=       3 y=    2.25
+ 0x0.bd14fded15dc10p-3, 0x0.d3d923e5f2bda8p-3, -0x0.8b1e6d251c7770p-4, -0x0.b9f5ab1245c230p-8, 0x0.d09659466e5a78p-7, -0x0.b1836f07490e78p-7, -0x0.cf3d8bb8d0dcb8p-13, 0x0.858e8834075678p-8, -0x0.b966297cf30ef0p-11, -0x0.b559fc776f5ab0p-11, 0x0.f837162b7adf60p-13, -0x0.c0be635987d5f0p-16, -0x0.81c29fe740b158p-15, 0x0.c6d79df8cec838p-15, -0x0.957bc55d7366e8p-18, -0x0.d2bb1bb3eb7a10p-17, 0x0.c770d8c502e4c0p-19, 0x0.ed728418fdd2d0p-21, -0x0.95bdb4540f8598p-21, 0x0.ee0552825073d0p-22, -0x0.def8f68e619f78p-27, -0x0.ad06e7b27c0f78p-23, 0x0.88b951e9170df8p-25, 0x0.934b4c37044eb8p-26, // x=       3 y=     2.5
+ 0x0.bdc84d4ba4c4b8p-3, 0x0.c32702555e01a0p-3, -0x0.80072b5bd28850p-4, -0x0.fc5ce627dcaad0p-16, 0x0.a2c3a1b269b728p-7, -0x0.b040eeee5791f8p-7, 0x0.bcf18da67e6b90p-12, 0x0.de3c6b47e455f0p-9, -0x0.abde5b60027448p-11, -0x0.e57f89bc8aa4d0p-12, 0x0.b4579ac2c71888p-13, -0x0.e7e0c7b94ae428p-15, -0x0.e40a1e3ef4dad8p-17, 0x0.a23918c6412260p-15, -0x0.af97d5d2703a18p-18, -0x0.fe17bcbefa7aa8p-18, 0x0.892510d0cd9100p-19, 0x0.8aa9ab56534218p-27, -0x0.86d165d6d3bf68p-22, 0x0.c7780aafe2ccd0p-22, -0x0.a3a65e59d9b118p-25, -0x0.bfed95c220ab18p-24, // x=       3 y=    2.75
+ 0x0.bd34be1d2fc4b0p-3, 0x0.b3d47bdeabdca0p-3, -0x0.ea66781ae1a940p-5, 0x0.8e3fb76620c950p-8, 0x0.f9f11419376670p-8, -0x0.a98a6f2a4c4118p-7, 0x0.b8063bff671770p-11, 0x0.b5c02b6f3e4b38p-9, -0x0.975cfeacabc4e8p-11, -0x0.864ea7c7ec8190p-12, 0x0.fd37ebd90a7b88p-14, -0x0.8d3d58b665b3c8p-14, -0x0.e8455e52eb5190p-19, 0x0.f9ba19c86109a0p-16, -0x0.a1fef97481c440p-18, -0x0.8e85cacce85c88p-18, 0x0.b0fd1058c335a8p-20, -0x0.bd273a6eaa03e8p-22, -0x0.bc040f9aa22990p-24, 0x0.9277f3bf19a980p-22, -0x0.a53980e4583698p-25, -0x0.c28e39aae63738p-25, // x=       3 y=       3
+ 0x0.bba60f3e5e2f50p-3, 0x0.a5d482fdbd8658p-3, -0x0.d5cdac54357340p-5, 0x0.fb51d14e2defd8p-8, 0x0.bc880ed54d6098p-8, -0x0.9f9f70752e98b0p-7, 0x0.e9aa9bab50bd48p-11, 0x0.92b4a4a86af228p-9, -0x0.80f77720138b20p-11, -0x0.88f5a09102a8a8p-13, 0x0.ac24b6c848f230p-14, -0x0.8e97f073936758p-14, 0x0.85acc31e0a5900p-19, 0x0.b8b834e10d9280p-16, -0x0.8620c8fa5aa940p-18, -0x0.909d252d168930p-19, 0x0.d88d4ca29dc488p-21, -0x0.f0f3128c2d6020p-22, -0x0.92750294495dd0p-27, 0x0.c72e3a17d0d660p-23, -0x0.8430f49bb5ee18p-25, -0x0.af4edc6ae720a8p-26, // x=       3 y=    3.25
+ 0x0.b959d6517ffcd0p-3, 0x0.991383c9f4ff30p-3, -0x0.c2900014bec798p-5, 0x0.a665ea43292a20p-7, 0x0.8b381a3d8c5530p-8, -0x0.940eb7846248b0p-7, 0x0.800ff5ba3d8760p-10, 0x0.ea62138fe8ccd0p-10, -0x0.d6dd83e50dcb68p-12, -0x0.c369bc1c480bd0p-15, 0x0.e21b2679bf95a0p-15, -0x0.83b33770645d90p-14, 0x0.995fe2aa8babb0p-18, 0x0.849a476cc56ba8p-16, -0x0.d0cda5f102bdf0p-19, -0x0.f3013560cf8720p-21, 0x0.fb12e6b719d3d0p-22, -0x0.e41fcd683b6ab0p-22, 0x0.d158248f5c3d98p-26, 0x0.8056a90284e9e8p-23, -0x0.bdc6106b39c4d8p-26, -0x0.fd9987dbf7ba20p-28, // x=       3 y=     3.5
+ 0x0.b6818e46c75480p-3, 0x0.8d7a89132a79b0p-3, -0x0.b0d04b97528430p-5, 0x0.c41c0c4fb6eef0p-7, 0x0.c7fdf0afdc28d0p-9, -0x0.87e3a4024444c0p-7, 0x0.8258f9909d6400p-10, 0x0.b99c659ab0cc40p-10, -0x0.b027c7186fabe8p-12, 0x0.fdcdbf2be40600p-18, 0x0.8e478ff6a751a0p-15, -0x0.e726626bcd6c98p-15, 0x0.b7c4eeac9b6138p-18, 0x0.b9b6926b7629e8p-17, -0x0.9c22de1659fdb0p-19, -0x0.d7e50af0729338p-23, 0x0.8832cfb3eee270p-22, -0x0.bf50e53b857ee8p-22, 0x0.91ffc1f85e0390p-25, 0x0.9e43c5dfece228p-24, -0x0.ff403d75447c90p-27, -0x0.9b620cb2f43620p-30, // x=       3 y=    3.75
+ 0x0.b34496ee2096b8p-3, 0x0.82f1593e905e80p-3, -0x0.a0963c30928990p-5, 0x0.d915d2dba8c9f0p-7, 0x0.8a1a1d1cda3450p-9, -0x0.f795cb6c070258p-8, 0x0.fdfb9a34b7a118p-11, 0x0.91dc45275b7fc0p-10, -0x0.8ec17bd374bc48p-12, 0x0.aafe7886379f80p-15, 0x0.a86a846a1bb3e0p-16, -0x0.c4612951d9d958p-15, 0x0.b78c63636a36f0p-18, 0x0.fe393ea89bf758p-18, -0x0.e2f30abff29fe8p-20, 0x0.b1d56a0617bc98p-23, 0x0.856f6fd6ba97d8p-23, -0x0.9631be22a43de8p-22, 0x0.8dc9986220ceb0p-25, 0x0.bb163a60316d78p-25, -0x0.a3f848f9592bf0p-27, 0x0.cd51bbb56b6200p-30, // x=       3 y=       4
+ 0x0.afc203979d41f8p-3, 0x0.f2bfa8aafaf798p-4, -0x0.91d8521e3384a0p-5, 0x0.e73199c5d6f7d8p-7, 0x0.b3464e09e2b500p-10, -0x0.e05d51a323e468p-8, 0x0.f091f9ab755488p-11, 0x0.e392cbd1b6dde8p-11, -0x0.e565192c292fa8p-13, 0x0.fa095edd14f650p-15, 0x0.b38e97f3151058p-17, -0x0.a3405203bcd728p-15, 0x0.a8343dc8031c00p-18, 0x0.a9f4734d340170p-18, -0x0.a15ed3a69a11f8p-20, 0x0.b252de9b059550p-22, 0x0.d40eb57c87e6f0p-25, -0x0.e24735cb94c510p-23, 0x0.f09500c226ba38p-26, 0x0.d2bea320f02890p-26, -0x0.cb04fd8c099f40p-28, 0x0.9e9e4c10fa2cb0p-29, // x=       3 y=    4.25
+ 0x0.ac122bd1047c38p-3, 0x0.e15d97a9405be8p-4, -0x0.8482d1ae497d50p-5, 0x0.eff18e2fb1a1c8p-7, 0x0.cfdb18ee466e28p-11, -0x0.ca96e50d7cd580p-8, 0x0.df906c79d041e8p-11, 0x0.b0341ab00b67f0p-11, -0x0.b71ae0f9799eb8p-13, 0x0.90617d49805090p-14, 0x0.976324b75901e0p-18, -0x0.85ad7cceadc308p-15, 0x0.92bbc0dca83bc8p-18, 0x0.dd1f3684f51fc8p-19, -0x0.e1562652d19e48p-21, 0x0.cefa764b668510p-22, 0x0.8f22fbefa84bf0p-27, -0x0.a5b59eb138fd78p-23, 0x0.be30f8b60c9030p-26, 0x0.de48740370efc0p-27, -0x0.f2e25075a77540p-29, 0x0.9df5aaa35dc290p-29, // x=       3 y=     4.5
+ 0x0.a847fcf52fa6a0p-3, 0x0.d190fc6aee19c8p-4, -0x0.f0f8f399089df8p-6, 0x0.f48b0fc950d6d8p-7, 0x0.b74203dcb11540p-12, -0x0.b67e5b30f2d2c0p-8, 0x0.cd04f06cd5fa90p-11, 0x0.874e01307bb8e0p-11, -0x0.916856ec348688p-13, 0x0.969c06f6040720p-14, 0x0.92a5f5c82e6740p-21, -0x0.d896e60900e928p-16, 0x0.f82d028eef4298p-19, 0x0.8ad5c6dc0bad50p-19, -0x0.9abb66f12801e8p-21, 0x0.cb6d1b8f230108p-22, -0x0.d50920f79afa58p-27, -0x0.edbfc664760cc0p-24, 0x0.9009caf2b61f10p-26, 0x0.d218df9c610fe0p-28, -0x0.8c003ec173b4a0p-29, 0x0.8772b249121888p-29, // x=       3 y=    4.75
+ 0x0.a4721125ea49d8p-3, 0x0.c331a90e2e0620p-4, -0x0.db5346226370e0p-6, 0x0.f5f48105c6e848p-7, 0x0.b1e4d7912f74f0p-17, -0x0.a42799860506b0p-8, 0x0.ba4100df5bedf0p-11, 0x0.cdc9789e941cc0p-12, -0x0.e5f9c407a1e478p-14, 0x0.94936cfea67958p-14, -0x0.fd986104f60d78p-20, -0x0.ae1daa4be4e520p-16, 0x0.cd921f97bed6a8p-19, 0x0.a5899c97e7c298p-20, -0x0.d0f61437165f38p-22, 0x0.b883518cd5ac50p-22, -0x0.b7bbd31344a990p-26, -0x0.a7d3aa85d4a598p-24, 0x0.d3fb5a138225b0p-27, 0x0.9ab643cc9924a0p-29, // x=       3 y=       5
+ 0x0.a09b92cc1302a0p-3, 0x0.b61aef196a45d0p-4, -0x0.c7dc8296dcc948p-6, 0x0.f4f12e01540448p-7, -0x0.80d4a9651505f0p-12, -0x0.938d5973669240p-8, 0x0.a814636f8a9910p-11, 0x0.9a9dd9e9e62488p-12, -0x0.b534a195b06460p-14, 0x0.8d9a4298d00128p-14, -0x0.dcdfd42b863ed0p-19, -0x0.8b30eb9aecd9c8p-16, 0x0.a7dd5f088f0e10p-19, 0x0.b4ecf531571588p-21, -0x0.8a7a2221d295e0p-22, 0x0.9fc9feca184d58p-22, -0x0.cd3e3d1f6794d0p-26, -0x0.e9c15e79ad30b8p-25, 0x0.98e64521789060p-27, 0x0.d247194c76b2b8p-33, // x=       3 y=    5.25
+ 0x0.9cccf45aaac7f0p-3, 0x0.aa2b9699512d88p-4, -0x0.b65e40c2160c90p-6, 0x0.f21b4862ebee38p-7, -0x0.e51738267287b8p-12, -0x0.849b3cf0655018p-8, 0x0.96f71bd3592ac0p-11, 0x0.e4b9f33e1577f0p-13, -0x0.8e4c7347bcca50p-14, 0x0.83ea93d750ac90p-14, -0x0.86762b30ddc370p-18, -0x0.dda2f3521f54f0p-17, 0x0.87b4dd0828ff40p-19, 0x0.a4df60108a8a20p-22, -0x0.b35a2910b6db20p-23, 0x0.8662b246129078p-22, -0x0.c5fb6859d61cc0p-26, -0x0.a0cc729c461960p-25, 0x0.d94350ca5874b8p-28, -0x0.e0baee31b4b380p-31, // x=       3 y=     5.5
+ 0x0.990c83b8ae6fa0p-3, 0x0.9f45b68331bf40p-4, -0x0.a6a537fbefb060p-6, 0x0.edec20d50a1418p-7, -0x0.9745cc0b1b5988p-11, -0x0.ee69238c348428p-9, 0x0.8726e6813bb888p-11, 0x0.a59b4f6dd4e448p-13, -0x0.debd3cfb74d0f0p-15, 0x0.f1f56f5e272170p-15, -0x0.8f90571d03cbb8p-18, -0x0.afed858d7c0ff8p-17, 0x0.d9dd746fe01508p-20, 0x0.9c15b57f017198p-24, -0x0.e1307d80b7a300p-24, 0x0.ddab19404128b8p-23, -0x0.b1854df1d01d70p-26, -0x0.da862fa68ecae8p-26, 0x0.9886d96c370500p-28, -0x0.a91d6178c1d948p-30, // x=       3 y=    5.75
+ 0x0.955edfeaeb3e28p-3, 0x0.954e7c0cbb5a30p-4, -0x0.9881fd7215e1b8p-6, 0x0.e8c2d7bc2833a8p-7, -0x0.b18254534e3788p-11, -0x0.d67187713198e0p-9, 0x0.f1775497c22f60p-12, 0x0.e894c9637ead70p-14, -0x0.adb1ad4d21c1c0p-15, 0x0.db74604931c9b8p-15, -0x0.8f48515c9be6c0p-18, -0x0.8b54c3856ad458p-17, 0x0.ae016758366f18p-20, -0x0.99dbacc4f6be98p-24, -0x0.8705325bd95e40p-24, 0x0.b460e0b0ee86d8p-23, -0x0.988372bcee3680p-26, -0x0.9281f888c48088p-26, 0x0.d402447a4681a0p-29, -0x0.b58fc5b9f8ee48p-30, // x=       3 y=       6
+ 0x0.91c756a69a5450p-3, 0x0.8c2de9fbfd59f8p-4, -0x0.8bc94f56ab8be0p-6, 0x0.e2e9c21a64a640p-7, -0x0.c390523b376fe0p-11, -0x0.c10c6b85688088p-9, 0x0.d76af2b0c80120p-12, 0x0.9bd0e3245be030p-14, -0x0.86e29fc03eed20p-15, 0x0.c5797e3f84ec50p-15, -0x0.895c5e4f1e05c0p-18, -0x0.dc4f14789fa270p-18, 0x0.8a7cad45facf18p-20, -0x0.a6ffc346cc13d0p-23, -0x0.95ff1e02148f70p-25, 0x0.9167b9c416a1e0p-23, -0x0.ff0364441f7500p-27, -0x0.c15720c4acf550p-27, 0x0.91febba17fb3a8p-29, -0x0.abbaf87dca2020p-30, // x=       3 y=    6.25
+ 0x0.bd9926958d9fd0p-16, 0x0.b406a628bfac30p-2, -0x0.9ff9388e2f7ee0p-13, -0x0.eedc36099bbbd0p-4, 0x0.810d7e834ba610p-11, 0x0.ac193b7addd240p-5, -0x0.83da699d312290p-10, -0x0.897ba639f19298p-6, 0x0.be3d32986ffc38p-10, 0x0.ef9db41ba765e8p-8, -0x0.cc14da0eeecbe0p-10, -0x0.cf0485913f2ee8p-9, 0x0.a62db9c8b04c78p-10, 0x0.924d3c61a8d6c0p-10, -0x0.cbde8e3d2ec120p-11, -0x0.b63f260c1b93c8p-13, 0x0.b1d9d625a5a0b8p-12, -0x0.8ad52fabc38c20p-13, -0x0.ab1e5cbec869c0p-14, 0x0.909fb16d5311a0p-13, -0x0.d633aa198e9a00p-17, -0x0.8bb5ee7d61e348p-14, 0x0.be34ef11c183b0p-16, 0x0.849370d09b3570p-16, -0x0.b2661373b2e9b8p-17, 0x0.95c53b8cb4c538p-19, 0x0.8463e413d6c228p-19, -0x0.f2a63728ab0148p-19, 0x0.a996c29c81ff88p-21, 0x0.acac6e0f0d5e10p-20, -0x0.b8a77d5fa65a28p-22, -0x0.9865ca20d85870p-31, // x=    3.25 y=       0
+ 0x0.af8725a2cf4bd0p-5, 0x0.b110cac41e3878p-2, -0x0.f4d6fae483d9e8p-6, -0x0.e0c0c089a243e0p-4, 0x0.8a2622af2b01f8p-6, 0x0.92770c8aee3f48p-5, -0x0.94c09658a37c78p-7, -0x0.bc93d4b13efb58p-7, 0x0.9b06464a5a22f8p-8, 0x0.d4bde81771c4f8p-9, -0x0.94a6b7376948f8p-9, -0x0.ffe104061de1c0p-12, 0x0.ef8a177270fa08p-11, -0x0.82cbe480463bc8p-12, -0x0.883562ec522ab0p-12, 0x0.93e74f51a7ccb0p-12, 0x0.905af2f67b8680p-16, -0x0.9ea6610b3cd3d0p-13, 0x0.8721cb0ee7d9f0p-15, 0x0.cefec860c58860p-15, -0x0.b440a41bd383c0p-16, -0x0.b77ea731bea948p-18, 0x0.e95dc608005af8p-18, -0x0.8b556c37215150p-18, -0x0.9e6bbbba442a08p-21, 0x0.bcc11926248cc0p-19, -0x0.a00593d47589d0p-21, -0x0.d70532df95fb40p-21, // x=    3.25 y=    0.25
+ 0x0.8d76b53cf3ed98p-4, 0x0.ac2c7a7b5c8c58p-2, -0x0.bc05c5e53f8c38p-5, -0x0.cbadfd4c584910p-4, 0x0.c2192998c08550p-6, 0x0.e5ec6b2f6e8450p-6, -0x0.b4722779dcc930p-7, -0x0.dc39d17b207978p-8, 0x0.97fce0934df6a0p-8, 0x0.c4809e689e11a8p-11, -0x0.dabe90fb9bb9c8p-10, 0x0.87780756291238p-11, 0x0.e6318c6903cc58p-12, -0x0.fd85014b105128p-12, -0x0.8a003408c0f1a0p-15, 0x0.fbe5a3642dfe00p-13, -0x0.ba8366c9612278p-15, -0x0.a0c67e5d3be710p-14, 0x0.fbc8b12f6eae10p-16, 0x0.aca303003724f0p-17, -0x0.a91ea51b38b620p-17, 0x0.9b88631d819bf8p-18, 0x0.a872b5265be728p-20, -0x0.ef903fce0699c8p-19, 0x0.a1acd28cc5e098p-21, 0x0.94462448b2e0c8p-20, -0x0.d785f3e3ef9aa8p-22, -0x0.b7e7acce04d370p-24, // x=    3.25 y=     0.5
+ 0x0.bd2bf103a3f240p-4, 0x0.a57d1db4d67fe0p-2, -0x0.ecf995cd6a47e8p-5, -0x0.b167b79662f7e8p-4, 0x0.ddf9ec8da338a8p-6, 0x0.a1db19484a1258p-6, -0x0.b220d0da975430p-7, -0x0.a4a6ca7744fee0p-9, 0x0.f26cd6f8c261d8p-9, -0x0.e76607e56b94f8p-11, -0x0.fa109fbee3f940p-11, 0x0.ec6f6e71d35af8p-11, 0x0.d865ffb8fa81d0p-14, -0x0.e7d7ab625d7740p-12, 0x0.83108b1acf7528p-14, 0x0.95dcfa0a05aa50p-13, -0x0.c63d9006838cd0p-15, -0x0.c6e3621a04e870p-16, 0x0.8e2ffa6cc7ba78p-16, -0x0.a0a8584f637c30p-18, -0x0.bdaa3426d7bbd8p-19, 0x0.a8065365d16a88p-18, -0x0.941a6582368e30p-21, -0x0.eb4a7e24cc7d40p-20, 0x0.8ce4c333a06fa0p-21, 0x0.fd0a90eeda7fa8p-23, // x=    3.25 y=    0.75
+ 0x0.e6007d3ec6fee8p-4, 0x0.9d892a8e2948e0p-2, -0x0.86b0ce684ba8d0p-4, -0x0.95214688fefff0p-4, 0x0.e33b301c65ebc8p-6, 0x0.c594605864d1c0p-7, -0x0.9c016e1140d888p-7, 0x0.9f581e9299b758p-11, 0x0.a6854acf7ba840p-9, -0x0.debd6bdfa11388p-10, -0x0.ca7bcfa9a5e9f0p-12, 0x0.edec439208c1a8p-11, -0x0.9746821dba85b8p-14, -0x0.a2689a542e00d8p-12, 0x0.a878b6a65d63a8p-14, 0x0.833bd05657d650p-14, -0x0.86d6cde2f28490p-15, 0x0.8985e9e9436af0p-19, 0x0.e337576996d218p-18, -0x0.f880fb5d500fa8p-18, 0x0.ceb7c3b929f720p-23, 0x0.cdba2b7d2c9650p-19, -0x0.c1ee2c5f6a64a0p-21, -0x0.9a29a159c85000p-21, 0x0.8f4dd0f7a5f6e0p-22, -0x0.dcb620138d21f8p-25, // x=    3.25 y=       1
+ 0x0.83e2ce73179f20p-3, 0x0.94cdeaa00d6740p-2, -0x0.8f9cce312b74a0p-4, -0x0.f27fbc2fa0c300p-5, 0x0.d8cf267c139508p-6, 0x0.b777e93c56c718p-8, -0x0.fb3c8283912ac8p-8, 0x0.ab1d2389475b60p-9, 0x0.c4a74df4395bf0p-10, -0x0.fd8bc37e2f25a8p-10, -0x0.bd142f26433890p-16, 0x0.c2791ad2c69390p-11, -0x0.8d4948120e38d0p-13, -0x0.bc2c7205f093c0p-13, 0x0.8a22b4c5b5f788p-14, 0x0.eb4195186ddcf8p-17, -0x0.8f334c2bfc9830p-16, 0x0.ae5301789bc688p-17, 0x0.b3ef6bd225acc8p-20, -0x0.bf05f00f837bc0p-18, 0x0.fd52ad64ea36f0p-21, 0x0.bb5bda5a1dda48p-20, -0x0.fe6468b5518170p-22, -0x0.f74f809fee4970p-25, 0x0.cef90b6b16ec58p-24, -0x0.c441b1c7a8c578p-24, // x=    3.25 y=    1.25
+ 0x0.916538ab626f90p-3, 0x0.8bb4f6993190f8p-2, -0x0.92a5f7422c85a8p-4, -0x0.bea1447f3d63b0p-5, 0x0.c50aa604be0c18p-6, 0x0.94fd7ebcd6cdf0p-11, -0x0.bcf334e9ebc4b8p-8, 0x0.f1e2a484919158p-9, 0x0.b84980b8e3d6e8p-11, -0x0.ef85def65e9b80p-10, 0x0.b1e4006410e850p-13, 0x0.8be8a5802349b8p-11, -0x0.8eb51ad18c6958p-13, -0x0.ae702ccb9d54f8p-14, 0x0.b9293d68f68ea0p-15, -0x0.988db213d19148p-17, -0x0.e820d12bbdaca8p-18, 0x0.b0b521f95ec958p-17, -0x0.dbaafbd85ec598p-21, -0x0.e2deaf8aeb0778p-19, 0x0.e0bf9071c193b8p-21, 0x0.ecf4494095be98p-22, -0x0.fbbfc28954eae0p-23, 0x0.cdd9a302577518p-24, // x=    3.25 y=     1.5
+ 0x0.9bd4ed509d0a10p-3, 0x0.8290d50e4d4f68p-2, -0x0.913e07e9c060e8p-4, -0x0.905838384b7ca8p-5, 0x0.acd32d7ba1b820p-6, -0x0.cb44d07da4b160p-9, -0x0.8537473f325ed0p-8, 0x0.8664084f6df1b8p-8, 0x0.a496a1bb197e88p-13, -0x0.cc4f1c6d824728p-10, 0x0.808ec58737c910p-12, 0x0.b57281467e10a0p-12, -0x0.ea9df6d7b360a8p-14, -0x0.c1091a71f44570p-16, 0x0.d5d8e2e94dd468p-16, -0x0.8c94c00d015410p-16, -0x0.bb6bea5c1de250p-20, 0x0.85445dd79115e0p-17, -0x0.af8ecf3ae62fe8p-20, -0x0.dda9c722f4ed60p-20, 0x0.91b94ae71d24e0p-21, 0x0.8eb527d6bd3730p-26, -0x0.c09b0ef44ea590p-24, 0x0.e11ab8bf0efc80p-24, // x=    3.25 y=    1.75
+ 0x0.a391ab34f1dbb0p-3, 0x0.f33bd8f7d24c18p-3, -0x0.8cb1d310458f40p-4, -0x0.d09b40440d8628p-6, 0x0.93895f237f7310p-6, -0x0.b7ad333a55e998p-8, -0x0.ae972af3c83df8p-9, 0x0.8583ee2f9326f8p-8, -0x0.bce09ed82b15e8p-13, -0x0.a2dee6066af150p-10, 0x0.846be695000f28p-12, 0x0.d28d85b5c58dd8p-13, -0x0.abb1fba238b118p-14, 0x0.9da52fc39cb2f0p-17, 0x0.d18235eb04cf60p-17, -0x0.8c4c05934599a0p-16, 0x0.8c6b01d59c56c0p-20, 0x0.ac13be5f3294d0p-18, -0x0.98bd29762de660p-20, -0x0.a76881d40705a0p-21, 0x0.9dc374f3bb3430p-22, -0x0.81fa40032c1980p-23, -0x0.adf4b9c14cd8b8p-26, 0x0.9f13b067a0ce18p-24, // x=    3.25 y=       2
+ 0x0.a8ffe7dbbb2400p-3, 0x0.e20b293e8aee40p-3, -0x0.8614b244368ed0p-4, -0x0.8cf9dcc4a7e5b0p-6, 0x0.f68d76cff14cc8p-7, -0x0.eb258d5269f878p-8, -0x0.ce6d239fd41438p-10, 0x0.f8884f916415e0p-9, -0x0.be67c8a3036d20p-12, -0x0.f6beaf30235cd8p-11, 0x0.ed0742cd7b6500p-13, 0x0.cf2b63fb38d0e0p-14, -0x0.e6dc8c9c31c040p-15, 0x0.c680b901b2b890p-16, 0x0.989bd00019f090p-18, -0x0.e5bba71f641b30p-17, 0x0.f09b7963dd0550p-20, 0x0.c51eed54456540p-19, -0x0.d812119bead048p-21, -0x0.e40c108ad0f020p-24, 0x0.9041fcc8936d70p-23, -0x0.8f491cf22380d0p-23, 0x0.d630d8735e9448p-28, 0x0.b960c08f93a038p-25, // x=    3.25 y=    2.25
+ 0x0.ac804cfbc47968p-3, 0x0.d1c3b0d0423cc0p-3, -0x0.fc7a9d7849d1a0p-5, -0x0.a9ed58638e0f20p-7, 0x0.ca637616481000p-7, -0x0.83b28d451d4010p-7, -0x0.c9147aa507a768p-11, 0x0.ddb25330def8d8p-9, -0x0.e7c1d9f6602058p-12, -0x0.b2f466685cf590p-11, 0x0.c3dce29e2788b8p-13, 0x0.88bfdf9a6172e0p-15, -0x0.8fb5283a452ed8p-15, 0x0.e61fb040298dd0p-16, 0x0.83a2f163518a50p-22, -0x0.a8f8ed1199bfa0p-17, 0x0.eaca35403d1f90p-20, 0x0.c678c6ca5f9258p-20, -0x0.874282ef5dd8d0p-21, 0x0.e94d15eb95e150p-24, 0x0.cb1e146dd83990p-25, -0x0.e07ee2c6dc9738p-24, 0x0.d9aa6b28d56f70p-27, 0x0.bb6e3f7f13d1f0p-26, // x=    3.25 y=     2.5
+ 0x0.ae6b048e1bfc78p-3, 0x0.c28236ae5e9e00p-3, -0x0.eb969152736e30p-5, -0x0.9d54651a3bf338p-8, 0x0.a3970fa1a05a88p-7, -0x0.89617915754290p-7, -0x0.c9f743901e5bc0p-13, 0x0.c00250b7a1a530p-9, -0x0.eeedb8d8a9c900p-12, -0x0.f8ddf7c8233450p-12, 0x0.997fd436461618p-13, -0x0.ec316776b48af0p-18, -0x0.a3cbc783771850p-16, 0x0.d8e45e56b15810p-16, -0x0.ebf8a729289c00p-20, -0x0.e6e9d0cdb51068p-18, 0x0.be68b2d5189200p-20, 0x0.a2bbbda1d43cf8p-21, -0x0.998a8562f00a28p-22, 0x0.b4a77cf1f757b8p-23, 0x0.cfdc7121447d98p-28, -0x0.96f9619fcb0de8p-24, // x=    3.25 y=    2.75
+ 0x0.af0d9fb80188e0p-3, 0x0.b45285c81bb870p-3, -0x0.da60c7dd746ce8p-5, -0x0.ad0a46edfbd5d0p-12, 0x0.825a8dc04d9838p-7, -0x0.892e84b672a620p-7, 0x0.d005b870e8d568p-13, 0x0.a2c63dbb561fe8p-9, -0x0.e27fabfe6b3d18p-12, -0x0.a5106e121a39a8p-12, 0x0.e75ab3a8fff480p-14, -0x0.eeb005a9d88e08p-16, -0x0.a377dccbcc1e20p-17, 0x0.b8e3ba2dbd5fc8p-16, -0x0.a414731ba9e040p-19, -0x0.9473c33893ac70p-18, 0x0.8be85fbc3fd8d8p-20, 0x0.8ebb89ebcd43d0p-23, -0x0.9ceece6966e678p-23, 0x0.ab587cda1194b0p-23, -0x0.ad32b575045e30p-27, -0x0.b85b6b02fb9c68p-25, // x=    3.25 y=       3
+ 0x0.aeaaa3990267e8p-3, 0x0.a7348c22061fc0p-3, -0x0.c974798c9b9c40p-5, 0x0.d2497cb508b078p-9, 0x0.ccd061259b2730p-8, -0x0.85125a6eec93b0p-7, 0x0.ec5c16622d3198p-12, 0x0.87ca7aef113498p-9, -0x0.cc30f3571f1818p-12, -0x0.cdc674e49af030p-13, 0x0.a8dd29035af2d8p-14, -0x0.9fcbf6358e67d0p-15, -0x0.f34885ad4cc000p-19, 0x0.946393ccf39f90p-16, -0x0.a496dfebf28da8p-19, -0x0.b39efc34307d38p-19, 0x0.c08ce978060708p-21, -0x0.cb396223d97920p-24, -0x0.894e1eddf6b4d8p-24, 0x0.8935be99db57d8p-23, -0x0.f12beaf3db6498p-27, -0x0.cf7f5799dd86b8p-26, // x=    3.25 y=    3.25
+ 0x0.ad7a0b06b3c9e8p-3, 0x0.9b204fb923da98p-3, -0x0.b93621bbe68878p-5, 0x0.c397c1e08764b0p-8, 0x0.9e7a4cc8c1f470p-8, -0x0.fd08533126d128p-8, 0x0.9dcb4627da1438p-11, 0x0.dfc2ac244c1f30p-10, -0x0.b21d1305694fe0p-12, -0x0.e8813af10b87c8p-14, 0x0.ef7b14b39d3c38p-15, -0x0.aa40d2d3ce6dd0p-15, -0x0.ad0d418871b7b8p-25, 0x0.e4a96dda045870p-17, -0x0.90d94c4e26db58p-19, -0x0.c9c2c12cb62d50p-20, 0x0.fbc0c7a81965b0p-22, -0x0.c4661ea6b4ead8p-23, -0x0.a68ef9bcf26910p-26, 0x0.c8c42ed64c3a68p-24, -0x0.ddc7259250bf28p-27, -0x0.d600ea9d55cfe8p-27, // x=    3.25 y=     3.5
+ 0x0.abaa460b1ef718p-3, 0x0.9008e110b6d728p-3, -0x0.a9e22226200158p-5, 0x0.8481a1a4b8f430p-7, 0x0.f0fafabc354cc8p-9, -0x0.ed250290db2b80p-8, 0x0.b28b560b197c90p-11, 0x0.b688fedcc6c8a8p-10, -0x0.97dc762747c770p-12, -0x0.d68489b33d1ef0p-15, 0x0.a4ea332504fa50p-15, -0x0.a3c5b1a410ccd8p-15, 0x0.fca22d71c61c40p-20, 0x0.aaf04ebe088db8p-17, -0x0.ed601d0a9d1d88p-20, -0x0.ca0cd08b164438p-21, 0x0.9d09103f5bc9c0p-22, -0x0.d57116aecccfa8p-23, 0x0.a9c047a055a418p-29, 0x0.8a770163bcfd48p-24, -0x0.af150fac1e4c40p-27, -0x0.c2ff033b11c620p-28, // x=    3.25 y=    3.75
+ 0x0.a9616ba61317a8p-3, 0x0.85de7c44b6af40p-3, -0x0.9b9855a876e7b8p-5, 0x0.9ea29375f14718p-7, 0x0.b341a91e5c0b70p-9, -0x0.dbf5e13b9ea938p-8, 0x0.ba48a4384792a0p-11, 0x0.93ae0bd1e84620p-10, -0x0.febfda674c87c0p-13, -0x0.b26d6a823db460p-17, 0x0.dba8bc1311c1f8p-16, -0x0.94bca1e2a6e880p-15, 0x0.b9830279bc41d8p-19, 0x0.f97542e7769230p-18, -0x0.b9e987c1dbc760p-20, -0x0.9e5f746174b178p-22, 0x0.ba36f86c153650p-23, -0x0.c2a27b9943c168p-23, 0x0.c6f8778c46bbf8p-27, 0x0.b6ac5badbc9588p-25, -0x0.fe9810b207fc98p-28, -0x0.89f043a879d410p-29, // x=    3.25 y=       4
+ 0x0.a6be70f571cd10p-3, 0x0.f9200f10226278p-4, -0x0.8e64e248a6e550p-5, 0x0.b1d18e735e7f88p-7, 0x0.817ebad9b6d390p-9, -0x0.ca7c829e12aa48p-8, 0x0.b957e80c0536a0p-11, 0x0.ed3f6662b5c3d0p-11, -0x0.d31c753f2467f8p-13, 0x0.84d842ed913e30p-16, 0x0.8c1566c9753f68p-16, -0x0.8246ee1e1310b0p-15, 0x0.cb27741d611d40p-19, 0x0.b23683910d5d40p-18, -0x0.8d1d5e32a51d50p-20, -0x0.858c05d8934338p-25, 0x0.cec7a9441c7950p-24, -0x0.a2c79af237baa8p-23, 0x0.f121fdcc4f22d0p-27, 0x0.e7e5ccca099060p-26, -0x0.af7d5878dede30p-28, -0x0.c8210f0e9d0348p-33, // x=    3.25 y=    4.25
+ 0x0.a3da4d3fd11068p-3, 0x0.e8182eddd7f6a0p-4, -0x0.8246c2b2f16908p-5, 0x0.bf6bf6646fe530p-7, 0x0.b34e20197c3960p-10, -0x0.b96189268e8688p-8, 0x0.b2db00fe7c2ef8p-11, 0x0.bd4f9a94334070p-11, -0x0.ad5e7140ddbb08p-13, 0x0.8755d73a47b3a0p-15, 0x0.a78cad82665738p-17, -0x0.deb9c05fd839b8p-16, 0x0.c59d74007a5470p-19, 0x0.f9851984ba03e0p-19, -0x0.d14778e3dc7768p-21, 0x0.eb058d7dfc93c0p-24, 0x0.cee9added6e780p-25, -0x0.8150240419c1e8p-23, 0x0.e5335cd5be4478p-27, 0x0.8da84c6591cb40p-26, -0x0.e895c280f1eb20p-29, 0x0.a9204427ae8390p-31, // x=    3.25 y=     4.5
+ 0x0.a0c8ff3a442460p-3, 0x0.d8833354ced958p-4, -0x0.ee69045edc9058p-6, 0x0.c89226afb36410p-7, 0x0.e7d66749910088p-11, -0x0.a90de5351b79f8p-8, 0x0.a90a02c810b758p-11, 0x0.961506bab330a8p-11, -0x0.8d635fbd4027f8p-13, 0x0.aebb2b1b6d36d0p-15, 0x0.b2f906cb5b5a78p-18, -0x0.bb2b74fddbb1e8p-16, 0x0.b462ba4337cc50p-19, 0x0.aaf78b9b6736f0p-19, -0x0.9852d4ac4d35f8p-21, 0x0.bb442bf0c38bf0p-23, 0x0.a63cd39913c470p-26, -0x0.c697b200ff3f68p-24, 0x0.c3e386e219e2a0p-27, 0x0.a58d090a2a3958p-27, -0x0.952aa54a9d3ad0p-29, 0x0.f046d14f911270p-31, // x=    3.25 y=    4.75
+ 0x0.9d9a6f9f946df0p-3, 0x0.ca407f1a240048p-4, -0x0.da3f30798b2558p-6, 0x0.ce3030562cebc8p-7, 0x0.83a84f4ca97158p-11, -0x0.99bdd62c4abfe0p-8, 0x0.9d6f244f206e78p-11, 0x0.ec5aa3d594b280p-12, -0x0.e55c9811a76c48p-14, 0x0.c1e116a3267938p-15, 0x0.9268703a2f8dc8p-19, -0x0.9b5fc37f5ac410p-16, 0x0.9e5ec24af4c248p-19, 0x0.e475f2f1573310p-20, -0x0.da3b29cb3e8638p-22, 0x0.d1749404c8ea08p-23, 0x0.c98b2a9d10b8b0p-29, -0x0.94dd518c1ded00p-24, 0x0.9dbd1991c852e8p-27, 0x0.b5eceb9232d3b0p-28, // x=    3.25 y=       5
+ 0x0.9a5b319009ade8p-3, 0x0.bd3176e7760700p-4, -0x0.c7ed7b81378320p-6, 0x0.d106207b751530p-7, 0x0.d435cfcc4a5630p-13, -0x0.8b8eea5e8d3cf0p-8, 0x0.9115c74b3b3cb8p-11, 0x0.b8b5d6b415ee30p-12, -0x0.b9390e33fe4470p-14, 0x0.c77b4b8133be98p-15, 0x0.e2b40137a73790p-24, -0x0.ffa8c60a3228a8p-17, 0x0.8784107db6fd28p-19, 0x0.93be4e7fc76858p-20, -0x0.9a08b01adfcec0p-22, 0x0.cd5c138f45c478p-23, -0x0.c5bb9fce8c9380p-28, -0x0.db2bd376eb38a0p-25, 0x0.f4a932da8253d8p-28, 0x0.b57915a9b44a68p-29, // x=    3.25 y=    5.25
+ 0x0.97152372cbb8e8p-3, 0x0.b139be55d28800p-4, -0x0.b74f0520f718d0p-6, 0x0.d1af6f4334b3b8p-7, -0x0.8202b42f339b20p-15, -0x0.fd1441fa291fa0p-9, 0x0.84ae466d7cabe8p-11, 0x0.8f14a2734aef30p-12, -0x0.9507e6293b25d8p-14, 0x0.c44f4cf1c5ffd8p-15, -0x0.a2736c158c0978p-20, -0x0.d0f2f65e215ea8p-17, 0x0.e3d89ba5081b78p-20, 0x0.b6550bac7d9138p-21, -0x0.d6378bee74fba8p-23, 0x0.bc0d3f0de071a8p-23, -0x0.a7fb75d377bd08p-27, -0x0.9f0871ae6af110p-25, 0x0.b8ec097a1a2000p-28, 0x0.93413250330c38p-30, // x=    3.25 y=     5.5
+ 0x0.93cff40abdbf88p-3, 0x0.a63f4b0e8d2a28p-4, -0x0.a83eb2981baa40p-6, 0x0.d0a9751fbbdac0p-7, -0x0.dd1ec3ac6575b0p-13, -0x0.e5564510f90d18p-9, 0x0.f15141681331e0p-12, 0x0.db46af7c443d08p-13, -0x0.ef0cddb0166c60p-15, 0x0.bbb6008a91e610p-15, -0x0.8608b268b560a0p-19, -0x0.a9ef0ef71d37f0p-17, 0x0.bd263add2026b8p-20, 0x0.d07b8cc8ed9d90p-22, -0x0.9284ba1d40ab00p-23, 0x0.a5484b2c026fd8p-23, -0x0.bea496c887e2c8p-27, -0x0.e3fea49a6f2f60p-26, 0x0.8931e7b3be7378p-28, 0x0.cc3f286f7e4378p-33, // x=    3.25 y=    5.75
+ 0x0.90918fab5d9308p-3, 0x0.9c2a5cf34de920p-4, -0x0.9a988393d364f0p-6, 0x0.ce58e78ec7a860p-7, -0x0.b65f08afebf748p-12, -0x0.cfcaa525ce33d0p-9, 0x0.da900406bea908p-12, 0x0.a5b61321bfa448p-13, -0x0.bf25a93df27838p-15, 0x0.afff40f0b9b5a8p-15, -0x0.a28a2e76e0bf48p-19, -0x0.89b1c4f3718860p-17, 0x0.9b9bbb346b8320p-20, 0x0.cd364452023088p-23, -0x0.c47e37788eb870p-24, 0x0.8d70eaae8214e8p-23, -0x0.bbd4f101b00fb0p-27, -0x0.a1a1a4dffee060p-26, 0x0.c8b8fa76b9ac98p-29, -0x0.99e3ccd0030be0p-32, // x=    3.25 y=       6
+ 0x0.83c9f7e4f77c68p-18, 0x0.a65216067622e0p-2, -0x0.eede114f009180p-16, -0x0.c9752e78c68668p-4, 0x0.d03ca031490c28p-14, 0x0.8200e0b7ee3750p-5, -0x0.e7b6c01fa2e400p-13, -0x0.b6422f18869f60p-7, 0x0.b7f60a16826470p-12, 0x0.8cac67d92f2368p-8, -0x0.dc669b671b55b8p-12, -0x0.e8adc39d2ff6c8p-10, 0x0.ccff4dbfe66a70p-12, 0x0.bb2d83ce13c988p-11, -0x0.9558d1d7c2a4f0p-12, -0x0.f39d19c5bd5ad0p-13, 0x0.a8315547463698p-13, 0x0.86636dfa2551c0p-15, -0x0.8a396a652e31a0p-14, 0x0.d8937cc24a71f0p-16, 0x0.83be65a0b0fb98p-16, -0x0.d2c5ce3c6faeb0p-16, 0x0.db193ab0c393f0p-20, 0x0.c71a4588168688p-17, -0x0.f2423b318e1378p-19, -0x0.c8339cc7e43f18p-19, 0x0.ecea5213a3f2d8p-20, -0x0.c685ac7006add0p-23, -0x0.b66aee68b6aad0p-22, 0x0.8db0d877efc740p-21, -0x0.a3168a385e1310p-24, -0x0.929e7f9b51f430p-23, // x=     3.5 y=       0
+ 0x0.94b9fcad581d30p-5, 0x0.a413b24e3758c0p-2, -0x0.bb9c7426e57e80p-6, -0x0.c029a15aaaab60p-4, 0x0.bcc973549f5e38p-7, 0x0.e77b2a4dcb3850p-6, -0x0.b4b14d637dbda8p-8, -0x0.8d27a214452b30p-7, 0x0.ab921850353280p-9, 0x0.a5352ae117c080p-9, -0x0.9ee27105e29088p-10, -0x0.9dc19394bc0cf0p-11, 0x0.877d939b4ba780p-11, 0x0.a10f568e85a380p-15, -0x0.c1d6d36d8addf8p-13, 0x0.a10b73b0ac2a20p-14, 0x0.bee695ae073e78p-15, -0x0.81bc03ffd5a0c0p-14, -0x0.c6878de2f872b0p-21, 0x0.f310c53ef95588p-16, -0x0.d6883cf0285e30p-18, -0x0.8ff11b46c29678p-17, 0x0.fc8f0b9805b9b0p-19, 0x0.dcb722cef73c00p-21, -0x0.9b438eb401b668p-20, 0x0.bb68a8275ea028p-21, 0x0.f9c13f555ea9b0p-24, -0x0.f1f160f40b25c8p-22, // x=     3.5 y=    0.25
+ 0x0.f159b659a004e8p-5, 0x0.a04a33222f9710p-2, -0x0.92e46ab3ec3d08p-5, -0x0.b1688c94ccb278p-4, 0x0.8abf397130f298p-6, 0x0.bf6649ab85f758p-6, -0x0.eecbccbe0df1a0p-8, -0x0.bd15a1ae2e7bf0p-8, 0x0.c0785b5f517698p-9, 0x0.8a2946c032c238p-10, -0x0.8d8ca2e7731b50p-10, 0x0.beec33a6c24dc8p-15, 0x0.afdf9bb8c6aa80p-12, -0x0.be305cc2f39028p-13, -0x0.9575e22a78cd58p-14, 0x0.f1106e2c7d2f50p-14, -0x0.b08d93404ffde0p-20, -0x0.c80893eee24340p-15, 0x0.ac5b763c06e100p-17, 0x0.db0fd4b317f048p-17, -0x0.ba535dd936ad40p-18, -0x0.a2aef865ea3380p-20, 0x0.ddf4578db3bdb8p-20, -0x0.fd2a57185f2d20p-21, -0x0.be81e10e87e898p-23, 0x0.a1540c7e35e6a8p-21, // x=     3.5 y=     0.5
+ 0x0.a2b2afc028cc08p-4, 0x0.9b02fea1a47150p-2, -0x0.bcf5078b515c10p-5, -0x0.9e383b9d4ccda0p-4, 0x0.a560e70adddba8p-6, 0x0.90ac438260f1b0p-6, -0x0.fd5148fc772c48p-8, -0x0.c16c579a4c74e8p-9, 0x0.ac23a614371038p-9, -0x0.ceb1ec9e1c2638p-14, -0x0.c4d5a2743593f8p-11, 0x0.d3e42d14eaa2a0p-12, 0x0.9ce4e067a43060p-13, -0x0.f7fb32a59aa7a0p-13, 0x0.ec092199a4ddf8p-22, 0x0.c11120a02eb668p-14, -0x0.943266324504d8p-16, -0x0.ccb6384d755cb0p-16, 0x0.9d838402b0ac68p-17, 0x0.b0dd33b0376108p-19, -0x0.bcb8a30878bea0p-19, 0x0.b21d09b0289408p-20, 0x0.bfbaa084059cd0p-22, -0x0.f346bff131a248p-21, 0x0.ffef00d6a32d40p-24, 0x0.93fb34d9aaee90p-22, // x=     3.5 y=    0.75
+ 0x0.c7983574e6e500p-4, 0x0.949a5b9d589048p-2, -0x0.db44960ed9d398p-5, -0x0.88bb88d7746e68p-4, 0x0.b004824e83b940p-6, 0x0.c4a7affff2b118p-7, -0x0.ed1798a7d8e1b8p-8, -0x0.a09284de31f998p-11, 0x0.84cee5772443e8p-9, -0x0.d749c0398ae468p-11, -0x0.d8f1c1cdf229f8p-12, 0x0.8957886f730e28p-11, 0x0.afe0c997bc1300p-16, -0x0.d60f6c736b3360p-13, 0x0.8192a28d4c0600p-15, 0x0.e6b4c378620748p-15, -0x0.950c4b3ca848e8p-16, -0x0.fbad1218d280a8p-18, 0x0.baff1cf353a1f8p-18, -0x0.e96e238de18948p-20, -0x0.ebb55b5c8241a8p-21, 0x0.ca48614183c650p-20, -0x0.87c33d00cc4918p-23, -0x0.8590d5aefd0ca0p-21, 0x0.8aa34aac273498p-23, 0x0.9e48ba65751500p-24, // x=     3.5 y=       1
+ 0x0.e705e2933413e0p-4, 0x0.8d6c3cf58c8d60p-2, -0x0.ee88183c5ef9c0p-5, -0x0.e5778d463f9bb0p-5, 0x0.ae3a60e7b156f0p-6, 0x0.e354ce2a260580p-8, -0x0.cba6152c6a3740p-8, 0x0.8e6a6fa7b46948p-10, 0x0.b48a3f07bc53d0p-10, -0x0.98c1cc7a1e9a50p-10, -0x0.9fb0e96e0f1ae8p-13, 0x0.8277ff203a99b0p-11, -0x0.c5263e7d4b3108p-15, -0x0.960e1a2e571620p-13, 0x0.96e4c71fd06450p-15, 0x0.cd5c119bd7de58p-16, -0x0.d0a81aa8e9cff8p-17, 0x0.a437e316a12700p-20, 0x0.a0e9aab61e99f0p-19, -0x0.b03478145dc0a0p-19, 0x0.e74018f0f01ac8p-26, 0x0.8626db4874ced8p-20, -0x0.d9faa7cfa0d728p-23, -0x0.caf3cd8edcf5c8p-23, // x=     3.5 y=    1.25
+ 0x0.8083b201e50a30p-3, 0x0.85cb44bb98d638p-2, -0x0.f8462f296c6570p-5, -0x0.bb0efc140b32d0p-5, 0x0.a3ee929c0528d8p-6, 0x0.b2e388f320b590p-9, -0x0.a3a5f8d8e8b578p-8, 0x0.8e3ba9ecbbad88p-9, 0x0.d43f56ca37cee0p-11, -0x0.a2a0682c534130p-10, 0x0.900ae14da8d0d0p-16, 0x0.d42ab204a4e878p-12, -0x0.95cfaf20c2bfd8p-14, -0x0.b1a2ff573c7eb0p-14, 0x0.f9984d5ba6a260p-16, 0x0.b0f4e45bdb54f0p-18, -0x0.e9a6255b176fe0p-18, 0x0.9096bd7ad9daa8p-18, 0x0.9488744d5d64e8p-21, -0x0.8ed99318b36680p-19, 0x0.a0e449b1cf7180p-22, 0x0.86a63fdd7f04d8p-21, -0x0.a0aecebb1d60d8p-23, -0x0.8bc3fc907cdde0p-25, // x=     3.5 y=     1.5
+ 0x0.8af66342033008p-3, 0x0.fbf89f85fa1bb0p-3, -0x0.fa57e5a0b4d138p-5, -0x0.93eb42864e1968p-5, 0x0.9497ed45608d58p-6, -0x0.923798ee9296e8p-11, -0x0.f82bb9aafa6ee8p-9, 0x0.b43517f2f418f0p-9, 0x0.c30a8f214138c0p-12, -0x0.97609474795ef0p-10, 0x0.e4d1e1bc3490c8p-14, 0x0.9b0b250df8b728p-12, -0x0.94efd2f78b10b0p-14, -0x0.aa1690d7e9a8d0p-15, 0x0.ad473a92241a20p-16, -0x0.952dc0e6b24ef8p-18, -0x0.cca0db89011cc0p-19, 0x0.96793078697280p-18, -0x0.8e89d089adfb48p-22, -0x0.b5bb2318fe3838p-20, 0x0.9e25ea964e5788p-22, 0x0.c5ea040f3b32b0p-23, -0x0.b22e58799d8918p-24, 0x0.cf0ecdf3f44620p-26, // x=     3.5 y=    1.75
+ 0x0.93177a29be87f8p-3, 0x0.ec6aa05c1402c8p-3, -0x0.f694309d413788p-5, -0x0.e1e94d5d68fba0p-6, 0x0.82e6cabfa57c38p-6, -0x0.c38bde8d72d0b8p-9, -0x0.b19cc4897fb940p-9, 0x0.c1e151f6b1e0a0p-9, 0x0.8a0c0a17d2ba90p-14, -0x0.81d7c8eca1ca00p-10, 0x0.99b40c3c0007d8p-13, 0x0.ceacbd10cb6ee0p-13, -0x0.f95a2a2d004e00p-15, -0x0.c5b7ffd1a1d770p-17, 0x0.d257e49da9a9f8p-17, -0x0.8672fa204096c0p-17, -0x0.cb291152dce6d0p-21, 0x0.ee1e32c00db108p-19, -0x0.86742731cde510p-21, -0x0.c149edf79bf5e8p-21, 0x0.dfda3be00a4520p-23, 0x0.d90dde2a4d60f0p-26, -0x0.9d131981379c50p-25, 0x0.90887cd74a4900p-25, // x=     3.5 y=       2
+ 0x0.992d1a5bcacfe8p-3, 0x0.dd3c602708f4d8p-3, -0x0.eea0d9804f6120p-5, -0x0.a502716db4a190p-6, 0x0.e17f113eb80250p-7, -0x0.98f873a47f3f70p-8, -0x0.edac09c7c351a8p-10, 0x0.bf43c956f256c8p-9, -0x0.879ba892718248p-13, -0x0.d2510de9ef49e0p-11, 0x0.9dfa9edaa16740p-13, 0x0.f92383bd6c31f0p-14, -0x0.bc48e3c6e15628p-15, 0x0.9ab1510c98bbb8p-18, 0x0.dcaa054ea3b9d8p-18, -0x0.8a829602632830p-17, 0x0.c1ca782c034f30p-22, 0x0.a2b6e7c48588e8p-19, -0x0.fdad5382152db8p-22, -0x0.a5eb4a9640b240p-22, 0x0.84b12954112c60p-23, -0x0.9c70a19bc051f8p-25, -0x0.c1cbbf5381fc20p-27, 0x0.e64af2d2034e60p-26, // x=     3.5 y=    2.25
+ 0x0.9d7f7a16468ee0p-3, 0x0.cea5739e1ff920p-3, -0x0.e3de588d5ebfa0p-5, -0x0.e211f0e0c85a00p-7, 0x0.beb14a4f6700a0p-7, -0x0.bc6f1dcd8cdf18p-8, -0x0.9090b6d61184e0p-10, 0x0.b2c534e26daba0p-9, -0x0.fbc99839d6d000p-13, -0x0.a2dd68417cc7c8p-11, 0x0.8fab165441cd88p-13, 0x0.81b9d41f35a140p-14, -0x0.83a8edc0691020p-15, 0x0.d113ca7001b928p-17, 0x0.b5f24ef4963b48p-19, -0x0.ec29a028affff8p-18, 0x0.cf26da0adbfee0p-21, 0x0.c720e1c4d82e20p-20, -0x0.c092394ed02150p-22, -0x0.ae711a0dc42728p-24, 0x0.8750b54a936b38p-24, -0x0.d42bf374113488p-25, // x=     3.5 y=     2.5
+ 0x0.a053fa5f1049e8p-3, 0x0.c0c9b01071ace8p-3, -0x0.d7648b4aa1d610p-5, -0x0.8ad73f88818118p-7, 0x0.9ec76720b1ae60p-7, -0x0.d094f1bc007a00p-8, -0x0.939d81c28fb768p-11, 0x0.a1152328b3d520p-9, -0x0.98e86755bbb2f8p-12, -0x0.f2a61aded35d58p-12, 0x0.f30cae2b9bc4f0p-14, 0x0.c387a16ad97750p-16, -0x0.abd92804cf0740p-16, 0x0.fc5821450568e8p-17, 0x0.f6cb8c97a52698p-22, -0x0.b5881ecd81fac0p-18, 0x0.db26acbb0df610p-21, 0x0.da088d57541868p-21, -0x0.8152d5b5383b98p-22, 0x0.e2618787a5d4d8p-26, 0x0.e38dcef44b7e70p-26, -0x0.b8a15b694f8240p-25, // x=     3.5 y=    2.75
+ 0x0.a1ea539d77cdf0p-3, 0x0.b3bd8e50a5d260p-3, -0x0.ca0892f660c8a0p-5, -0x0.856547f228b588p-8, 0x0.8268d8b29ee298p-7, -0x0.d94c4b37732228p-8, -0x0.b029de1acb3830p-13, 0x0.8d636853b69628p-9, -0x0.9f8d01cb3b69f0p-12, -0x0.ae1e597d52ebd0p-12, 0x0.c3bb963d878808p-14, -0x0.883d0b502efef0p-20, -0x0.cff28bff6d1f68p-17, 0x0.f6bc64493a8f80p-17, -0x0.bb7158b604bf20p-21, -0x0.8207a7422d2488p-18, 0x0.bcf9253aae2738p-21, 0x0.cc6c06612b0da8p-22, -0x0.9e618471b33e28p-23, 0x0.8cc67a73625b58p-24, 0x0.f4369c541629a0p-28, -0x0.871fc1c1b18a40p-25, // x=     3.5 y=       3
+ 0x0.a27b3c05cffc08p-3, 0x0.a78a0a428d1a28p-3, -0x0.bc66b7a3adcb28p-5, -0x0.f9eed0da5885b0p-12, 0x0.d382ecc2a1d648p-8, -0x0.d9cbcebcd6c900p-8, 0x0.e736da6d1eb320p-14, 0x0.f36a4918cfb490p-10, -0x0.99ced3a7071d68p-12, -0x0.efde80666d2508p-13, 0x0.97f419888dab18p-14, -0x0.fd641118090a60p-17, -0x0.e2a970d9f6f3c0p-18, 0x0.d9e6b1005d8648p-17, -0x0.9e997b761de370p-20, -0x0.b0029c3bb652e8p-19, 0x0.92c035787e7f50p-21, 0x0.88459aeb0fd908p-23, -0x0.b16951b554a5e8p-24, 0x0.97930d6b67f380p-24, -0x0.f76d7acce97418p-30, -0x0.b27725b23a1510p-26, // x=     3.5 y=    3.25
+ 0x0.a23807eb85a158p-3, 0x0.9c2fd9a70ee268p-3, -0x0.aeed3dc173a1d0p-5, 0x0.9ea12ea63ed368p-9, 0x0.a9632606b70898p-8, -0x0.d49f5a8514d710p-8, 0x0.9c092b5e6a4b20p-12, 0x0.ce6f12928c5580p-10, -0x0.8d44882a603948p-12, -0x0.9cf62231e91b68p-13, 0x0.e503a735902bd8p-15, -0x0.ba8b2af3f79548p-16, -0x0.cb7138d96dcbc8p-19, 0x0.b50a0b56c88e70p-17, -0x0.ac63b7ef3175f8p-20, -0x0.e1da3a1ef39570p-20, 0x0.d514acb7060c78p-22, -0x0.96050fc5f89d38p-27, -0x0.b184356742ea88p-25, 0x0.838b063f6f45b0p-24, -0x0.abdb9c1cf98d38p-28, -0x0.da0346d8de1300p-27, // x=     3.5 y=     3.5
+ 0x0.a14ae3804fdc40p-3, 0x0.91a9f9907e9028p-3, -0x0.a1e68d09b87e40p-5, 0x0.9ade74e9a6d300p-8, 0x0.85df8f19513770p-8, -0x0.cbba85b17777a8p-8, 0x0.da4d256df0b7a0p-12, 0x0.ad090de97ec1c0p-10, -0x0.fb4441a070add8p-13, -0x0.be8bbf58792a58p-14, 0x0.a817007d4d16c8p-15, -0x0.d0d546f946a088p-16, -0x0.bd4c65e7c34948p-21, 0x0.905691eac575b0p-17, -0x0.a05e4f8bb1dc58p-20, -0x0.887d28e8757e48p-20, 0x0.9316e7a94b9bd0p-22, -0x0.9a0667128b2840p-24, -0x0.918c6021226120p-26, 0x0.cd74c1c80484d0p-25, -0x0.babaab94c070d8p-28, -0x0.f767fe227242d0p-28, // x=     3.5 y=    3.75
+ 0x0.9fd761e9ef2a40p-3, 0x0.87efa4147b0568p-3, -0x0.9581f0dc3c16d8p-5, 0x0.d62b585b9658c0p-8, 0x0.d07db05d6af970p-9, -0x0.c0919677a2bcc8p-8, 0x0.fe21c5cb501f60p-12, 0x0.8fadce391d3270p-10, -0x0.da74253df99350p-13, -0x0.ca285aa29adb08p-15, 0x0.f07f93078ed1e8p-16, -0x0.d055acdfaee9e8p-16, 0x0.af63291bda40c0p-21, 0x0.df4c0c97f9c750p-18, -0x0.898f7cebc91780p-20, -0x0.981ba6cec64b70p-21, 0x0.c27ac4f056a7d0p-23, -0x0.c8392aef424918p-24, -0x0.f855fb23d3af68p-29, 0x0.9651defdf8d698p-25, -0x0.a273bba3fc58a0p-28, -0x0.809a2a74173618p-28, // x=     3.5 y=       4
+ 0x0.9dfb343bea6400p-3, 0x0.fdeb8d640894d8p-4, -0x0.89dac072f72740p-5, 0x0.81fbe8a6baff10p-7, 0x0.9f7af2772e53e8p-9, -0x0.b432dd418aa8e8p-8, 0x0.87836b5a7895c0p-11, 0x0.ecbdf73ce703b0p-11, -0x0.bad22ab4784be8p-13, -0x0.978abdc3fd82c0p-16, 0x0.a75a91f6e055e8p-16, -0x0.c311a6d0c33240p-16, 0x0.b7e98e6b748bc0p-20, 0x0.a8a8a52c81f5d8p-18, -0x0.e07729267c1748p-21, -0x0.9380cc540231e0p-22, 0x0.f665bf4db1b710p-24, -0x0.c7c4f3b9e1b158p-24, 0x0.cb02626f53a950p-29, 0x0.d1f2ab8dea13e0p-26, -0x0.fe5d2f2454c1f0p-29, -0x0.e95bd5da3c3fb0p-30, // x=     3.5 y=    4.25
+ 0x0.9bceeba02581c8p-3, 0x0.ed602513d937d8p-4, -0x0.fdfc066a1a54e8p-6, 0x0.9351e2fff5bc88p-7, 0x0.ee7972f5ba98c0p-10, -0x0.a75d885261f198p-8, 0x0.895d0fee668c50p-11, 0x0.c1b9e6a329bf00p-11, -0x0.9dd0e9f2104838p-13, 0x0.adfa6a7ef31748p-19, 0x0.e14aa026c8fe60p-17, -0x0.af8cfeaa876268p-16, 0x0.e16a67ca6a5570p-20, 0x0.f9b349582ae578p-19, -0x0.b0fdeace128d88p-21, -0x0.c96db7db2ca390p-24, 0x0.94a0174fe432d0p-24, -0x0.b1e22dfe1b8bc8p-24, 0x0.c1a36668ecfff0p-28, 0x0.8d3765990dc898p-26, -0x0.bae41b88bb3470p-29, -0x0.9affb3afe7aeb8p-31, // x=     3.5 y=     4.5
+ 0x0.9966b5b120e138p-3, 0x0.de237a4db53c88p-4, -0x0.e9dd884ad6ce78p-6, 0x0.a01a1489c273a0p-7, 0x0.accf2960d9c8c0p-10, -0x0.9a94d80eb8d4a0p-8, 0x0.86c4221459a380p-11, 0x0.9d8f93befe5630p-11, -0x0.8412bc10c1a088p-13, 0x0.88222be37b30e0p-16, 0x0.91014dd963a248p-17, -0x0.99d4acf78a4a08p-16, 0x0.e9ce811d9eced0p-20, 0x0.b57998f5fe29c8p-19, -0x0.881e8b008d6758p-21, 0x0.d3cadc2b1c38b8p-27, 0x0.a7ce3248f53240p-25, -0x0.94a0f5221e97d0p-24, 0x0.d633aceda82b30p-28, 0x0.b79d73ca189b20p-27, -0x0.836adcf84048f8p-29, 0x0.8c684dfe138f50p-36, // x=     3.5 y=    4.75
+ 0x0.96d309dfce5c58p-3, 0x0.d01c0a0e8334e8p-4, -0x0.d752a061bd72c8p-6, 0x0.a92de76aee4530p-7, 0x0.ef1aecbbcdf1e0p-11, -0x0.8e2f96dbc71348p-8, 0x0.814cdb3d56c170p-11, 0x0.fecf83f037d320p-12, -0x0.db77158a6590f8p-14, 0x0.cfab42076beca8p-16, 0x0.ae4e6b4fe11008p-18, -0x0.844b21eab25540p-16, 0x0.df6bd9efd5ec08p-20, 0x0.8181a8338929c8p-19, -0x0.cd5ad8f36e1448p-22, 0x0.95aba49609b3d0p-24, 0x0.a9f755f2669d00p-26, -0x0.ee7e729f810580p-25, 0x0.c800fb122349a8p-28, 0x0.e64eb193fde0c8p-28, // x=     3.5 y=       5
+ 0x0.942143c52ae8c0p-3, 0x0.c33112d201a8f8p-4, -0x0.c64b3165715950p-6, 0x0.af42b607a6be08p-7, 0x0.9937c35e77a100p-11, -0x0.82642ed28e71e8p-8, 0x0.f4358ecd10f3e0p-12, 0x0.ccd8445a9b19a0p-12, -0x0.b54e79fa9618b8p-14, 0x0.f898ae91cd8368p-16, 0x0.b8f87a334fe590p-19, -0x0.e07866594c8390p-17, 0x0.cb73f8d7931850p-20, 0x0.b538820a58e078p-20, -0x0.9873fc673bdd10p-22, 0x0.cefbf54b1db218p-24, 0x0.87b9118a835740p-27, -0x0.ba0de707d3a5b0p-25, 0x0.abb3e770922d98p-28, 0x0.8ab6e581d91cd8p-28, // x=     3.5 y=    5.25
+ 0x0.915c2951c6f9b8p-3, 0x0.b74b02ef885938p-4, -0x0.b6b1d86c1ce498p-6, 0x0.b2eeca500f9f48p-7, 0x0.a8bfbeb737d650p-12, -0x0.eea3c878d97ef0p-9, 0x0.e3f886f5e2a030p-12, 0x0.a3a93c9ab92d08p-12, -0x0.951966187779d8p-14, 0x0.860b43bb478d70p-15, 0x0.8f5d4662596668p-20, -0x0.bc87fc7603e9e0p-17, 0x0.b3955b74c2de38p-20, 0x0.f7b6f49e5f9b18p-21, -0x0.df36e99ec5c5d0p-23, 0x0.e080f691181a80p-24, 0x0.f9baca3f1f85e8p-31, -0x0.8e30b187437fb0p-25, 0x0.8c3e7cd3249c28p-28, 0x0.9dfdfffb8d6770p-29, // x=     3.5 y=     5.5
+ 0x0.8e8c5d90e4dc00p-3, 0x0.ac53b848d47d90p-4, -0x0.a86e5d74d6ca08p-6, 0x0.b4ae0b2ca565c0p-7, 0x0.ec671389978b70p-14, -0x0.da0f82ae7edee0p-9, 0x0.d300a3a5246d60p-12, 0x0.81db57a912c778p-12, -0x0.f44dcc5eee6bc0p-15, 0x0.8874d9137367f0p-15, -0x0.96e3ff0be45a88p-24, -0x0.9d28659c27a6d8p-17, 0x0.9b2a31312e51e0p-20, 0x0.a4400bc2da4cf0p-21, -0x0.a145a9de997bc8p-23, 0x0.db45b2e6f8d058p-24, -0x0.c9841fb7719988p-29, -0x0.d5ea7d60710e40p-26, 0x0.ddb7b6e3be7ce0p-29, 0x0.a49048c3a22b08p-30, // x=     3.5 y=    5.75
+ 0x0.8bb8c1a0480520p-3, 0x0.a2369f37bab3f8p-4, -0x0.9b6764a594b6c0p-6, 0x0.b4e630bd6ab608p-7, -0x0.dc95cbdc89be38p-15, -0x0.c71366006ad400p-9, 0x0.c20f0275c68a40p-12, 0x0.cc69889a267490p-13, -0x0.c781f45d22e2b0p-15, 0x0.85ffe56a4366c8p-15, -0x0.d9c344fa9a6dc0p-21, -0x0.8242dbb262fae0p-17, 0x0.840c255e6f89e8p-20, 0x0.d0a59aa6beb6e8p-22, -0x0.e5f123be088bc0p-24, 0x0.ca1d4b4ba9c720p-24, -0x0.a5130e305be180p-28, -0x0.9edba21a6da5f8p-26, 0x0.ab47295c706e60p-29, 0x0.8f2c60bf4b2f58p-31, // x=     3.5 y=       6
+ 0x0.a1af14832bb690p-21, 0x0.9aa9fa851f66c8p-2, -0x0.9ca19bdf1258e0p-18, -0x0.acbe05dc320508p-4, 0x0.92af165c006860p-16, 0x0.cae1b28310e1a0p-6, -0x0.b06a0539945598p-15, -0x0.fddbf61d98e5c0p-8, 0x0.9890d24447a6a0p-14, 0x0.ac2d8fa66cf378p-9, -0x0.c931ab44b70d50p-14, -0x0.ff27670f8703d8p-11, 0x0.d1053721fda1b0p-14, 0x0.c801a081a7b430p-12, -0x0.adee70adf7d698p-14, -0x0.9744490d653be8p-13, 0x0.e87b5ec26a1468p-15, 0x0.ba255a05580020p-15, -0x0.f5c7a1d1609f58p-16, -0x0.cea9f22582b618p-18, 0x0.c2f91f305deaa0p-17, -0x0.89ab2a284a2c88p-18, -0x0.bff9e7c5414510p-19, 0x0.8691841a2a7448p-18, -0x0.bfb477326eeba8p-24, -0x0.ffe69ebaab98a8p-20, 0x0.84cb27de528010p-21, 0x0.8b9a1cabe44cd0p-21, -0x0.8cdd17cb5bc748p-22, -0x0.c0c0d072a25078p-27, 0x0.80f9d91a6caa30p-24, -0x0.8e297c656ad2a0p-24, 0x0.ec3027403ad9b8p-28, 0x0.aac6ff625c1f20p-26, // x=    3.75 y=       0
+ 0x0.ffd1ab65e82e18p-6, 0x0.98e825924b9d28p-2, -0x0.93b72d7a3c0760p-6, -0x0.a63c8c97a82310p-4, 0x0.8672a3e08873c8p-7, 0x0.b98cdb17cacff0p-6, -0x0.e6609f54ac3a80p-9, -0x0.d362f8e9c7d320p-8, 0x0.c4619f36a3b440p-10, 0x0.f03c6c1536bc08p-10, -0x0.a81b8168569df0p-11, -0x0.fe6af7cc1c5288p-12, 0x0.8ca230608c0308p-12, 0x0.c957413fcd2030p-14, -0x0.d8fce775daf9d8p-14, 0x0.f28459657cfd58p-19, 0x0.8c9166354ab318p-15, -0x0.9556713d742ae8p-16, -0x0.f69fa59d4a2d80p-18, 0x0.c4dd0fc3020270p-17, -0x0.87d8aa6736bc30p-23, -0x0.a72c903b319d98p-18, 0x0.91bc890860c668p-20, 0x0.b9ef56847410d8p-20, -0x0.9f5bb177edfa20p-21, -0x0.8dd8dc56d7bd00p-23, 0x0.c50bfbec851ae8p-23, -0x0.d32419332efe48p-24, // x=    3.75 y=    0.25
+ 0x0.d08a30d0413370p-5, 0x0.95e7c9a9a044a0p-2, -0x0.ea42335b6d4050p-6, -0x0.9b9079c9f5a2e0p-4, 0x0.cb85e9d1bdb640p-7, 0x0.9f2c25397f5ac8p-6, -0x0.a18f1bbd5c9580p-8, -0x0.9b0805c15b4dd0p-8, 0x0.f4336882e45ce0p-10, 0x0.820fe57b3c5e30p-10, -0x0.af00abad692ab8p-11, -0x0.e98a7d0bbbfbc0p-14, 0x0.e4a69df1566ca0p-13, -0x0.c8ac3b2be7aaf8p-15, -0x0.f86b477a2bc448p-15, 0x0.c04daa811a9008p-15, 0x0.a835c5a0fef848p-17, -0x0.c29ed7449b5678p-16, 0x0.af430ed35d6d00p-20, 0x0.8ce1deb03bb478p-17, -0x0.840b67ecf1fab8p-19, -0x0.884b3ab3d2ccf0p-19, 0x0.f67d6501797448p-21, 0x0.89b929ceec21f0p-23, -0x0.882c08d38541f0p-22, 0x0.a9dd31edad73d0p-23, // x=    3.75 y=     0.5
+ 0x0.8d6f41aafe8488p-4, 0x0.91aa1a58ecb7b0p-2, -0x0.98ef08fd76faa0p-5, -0x0.8d44936d4c3978p-4, 0x0.fa1ef603aa75d0p-7, 0x0.fd4f2e95c46cd8p-7, -0x0.b51e10c710fe50p-8, -0x0.bb6e2ba3215808p-9, 0x0.ef2cc3c95c9b98p-10, 0x0.f01660eb69ec50p-13, -0x0.8cdbcd91cb76d8p-11, 0x0.9dbaa9a6a75078p-13, 0x0.87f962d3911800p-13, -0x0.eedaec8c36c548p-14, -0x0.9b590067564430p-16, 0x0.d4a854d05159f8p-15, -0x0.e357453b51d110p-19, -0x0.8b2fbfa9c7bc20p-16, 0x0.ff6da8efdc43c8p-19, 0x0.f6eeb9cd0e7f40p-19, -0x0.da8d401761c6e8p-20, -0x0.d5f420afd5cba8p-23, 0x0.e34e7a35301b50p-22, -0x0.909b5ed4e0c7b8p-22, -0x0.b5814d9baa4700p-25, 0x0.9c369b502a7d10p-23, // x=    3.75 y=    0.75
+ 0x0.aeb85ff8e3cc70p-4, 0x0.8c6f59b898dc00p-2, -0x0.b45580970b68f8p-5, -0x0.f986ca0fcf8568p-5, 0x0.8945de0b764f88p-6, 0x0.b93ec789a86c28p-7, -0x0.b2d672ad0d0e60p-8, -0x0.9871adaa840270p-10, 0x0.ca0f16b1886c18p-10, -0x0.acf16e9b922190p-12, -0x0.ba0753bf271460p-12, 0x0.944425426a1008p-12, 0x0.d3cc89c3b51c08p-15, -0x0.8034425f11de80p-13, 0x0.cf0fb0f4efb228p-18, 0x0.a0c9eda2132ec0p-15, -0x0.8334f87fe89430p-17, -0x0.8b5ba409d5e3f0p-17, 0x0.dc8d121d18e808p-19, 0x0.9e196dbe7951c8p-21, -0x0.e4457ce289d5f8p-21, 0x0.f9da74d469b600p-22, 0x0.cf9fbf48970508p-24, -0x0.8c1de192c02858p-22, 0x0.80e294ae6919c0p-25, 0x0.9cdc7612131d60p-24, // x=    3.75 y=       1
+ 0x0.cbbd9c77cbc3e8p-4, 0x0.867b05d6a5b630p-2, -0x0.c76878ce98b428p-5, -0x0.d6afa609cbfba8p-5, 0x0.8c102dc6ff70a0p-6, 0x0.f200d666d5aa28p-8, -0x0.a1f93adc3297b8p-8, 0x0.c8147a1dea6e98p-13, 0x0.97fbdc711b5de8p-10, -0x0.ae128106c0a7e0p-11, -0x0.c24c0b208f3da0p-13, 0x0.a53e5f62d68e68p-12, -0x0.b6642ce9b77e70p-19, -0x0.d375dfe4255f10p-14, 0x0.890de011bf3288p-16, 0x0.be065fd6e4c2f0p-16, -0x0.f700c9f8ee1b90p-18, -0x0.9de8e2a80be628p-19, 0x0.857db9d1bf3bf8p-19, -0x0.cb999e2f630fa0p-21, -0x0.95375939562c58p-22, 0x0.894721a65a57d0p-21, -0x0.a119cfc02f4b30p-25, -0x0.a47aad0dbd0df0p-23, // x=    3.75 y=    1.25
+ 0x0.e467178d450388p-4, 0x0.800d051d49d270p-2, -0x0.d2eb68142e5730p-5, -0x0.b416b5a8eab488p-5, 0x0.87ba3a02584af0p-6, 0x0.8173012851ada8p-8, -0x0.8960406b960d98p-8, 0x0.97a429f4f34928p-10, 0x0.cc1b0a8c183820p-11, -0x0.d476847b260d58p-11, -0x0.edc8b842460e68p-15, 0x0.96abfd0c7c6eb8p-12, -0x0.8083ac5f8f9d48p-15, -0x0.9380dd90d8ee58p-14, 0x0.92825de377b1c0p-16, 0x0.a78e97a62b55b0p-17, -0x0.ae8e2a92da7148p-18, 0x0.da5ac4f6ae6548p-21, 0x0.ef7ea02d6ee038p-21, -0x0.8bc25573091270p-20, 0x0.b584f5e623a948p-27, 0x0.be3d69a12417f8p-22, -0x0.8b08d102165528p-24, -0x0.88b2490b143a78p-24, // x=    3.75 y=     1.5
+ 0x0.f8d5f33b6fcbd8p-4, 0x0.f2baef28184008p-3, -0x0.d80036bfd916c0p-5, -0x0.9338f5937f5fd0p-5, 0x0.fd2884efeb3368p-7, 0x0.922c345c73b720p-10, -0x0.dc9a1fa1aa7830p-9, 0x0.e78d13a7425f80p-10, 0x0.ed1da4fe53ff60p-12, -0x0.d82ce9e654c828p-11, 0x0.e2246a19879310p-16, 0x0.f3a68d65b80448p-13, -0x0.a93b85adcb65a8p-15, -0x0.b0985c3e715748p-15, 0x0.f1d0e01389b4b0p-17, 0x0.f6fe1619de4b90p-20, -0x0.ca37f020876140p-19, 0x0.8556d41fa09970p-19, 0x0.ebe0a413ce7db8p-23, -0x0.e8060f54b66508p-21, 0x0.e883c6e2cbd3f8p-24, 0x0.cc224057e3d0a0p-23, -0x0.dc7057639efed0p-25, -0x0.ed387c90b47280p-27, // x=    3.75 y=    1.75
+ 0x0.84a904d97426d0p-3, 0x0.e5359a10ebbe58p-3, -0x0.d7e85b35690ef8p-5, -0x0.ea10b3f0178d70p-6, 0x0.e53a3b6835e1f0p-7, -0x0.91093a2042f308p-10, -0x0.a867222750eb30p-9, 0x0.88bb04c64d6b90p-9, 0x0.d1a106e731d280p-13, -0x0.c6e9d9b97c4fc0p-11, 0x0.9918573d2eadd0p-14, 0x0.b400e177913bb8p-13, -0x0.a4fdc114e75330p-15, -0x0.ac0fa9465ebe98p-16, 0x0.abcff900c87ec8p-17, -0x0.a4bfc780fdfaf8p-19, -0x0.baa9a440106b60p-20, 0x0.8a9f43731a61b0p-19, -0x0.dc972a34032350p-24, -0x0.9abd549aaa23e0p-21, 0x0.f22992c74f82c0p-24, 0x0.a5f466c8696d30p-24, -0x0.84a741c1fb87e0p-25, 0x0.e7b6d4b2fb39d8p-28, // x=    3.75 y=       2
+ 0x0.8b1d05b8235680p-3, 0x0.d7d2fa21b81b40p-3, -0x0.d3db20cb9d7408p-5, -0x0.b40a2c7567bc00p-6, 0x0.cac3cda4266188p-7, -0x0.b4fc47fd17d290p-9, -0x0.f4001794c5a488p-10, 0x0.8f9490b05e6098p-9, 0x0.ac73b0a1626960p-16, -0x0.ab46995b55ce00p-11, 0x0.c114ce903c2dc8p-14, 0x0.f508b7a7eecd48p-14, -0x0.8b9090459f9d58p-15, -0x0.c9f77ccde977f0p-18, 0x0.d87038dcc6c288p-18, -0x0.8ae9a51abe8d68p-18, -0x0.d0650fff2ffe18p-22, 0x0.e23676cd9af1e0p-20, -0x0.e118fe4ef929e0p-23, -0x0.af472b42536900p-22, 0x0.b696a5a7ef6fb0p-24, 0x0.854bb9073b50f0p-26, -0x0.818bb68e67ab18p-26, 0x0.c8d5ff31272a88p-27, // x=    3.75 y=    2.25
+ 0x0.8ffb8ad9b19440p-3, 0x0.cac981fcb04100p-3, -0x0.ccee26a20b9e90p-5, -0x0.84b501df645d38p-6, 0x0.affc5f5fcbec20p-7, -0x0.80b17744807a18p-8, -0x0.a60c131a56e5a0p-10, 0x0.8cc901401b57b8p-9, -0x0.caa7533de165a8p-14, -0x0.8c703a79af0aa8p-11, 0x0.c521e9b0ec5c68p-14, 0x0.982c0fb191d998p-14, -0x0.d7b5e6d67b0a08p-16, 0x0.ae9610d0f23750p-19, 0x0.ef2a45906c0ea8p-19, -0x0.912894b03dfcd0p-18, 0x0.935caf9438e520p-23, 0x0.a14a9d030b12e0p-20, -0x0.e08df1ea653218p-23, -0x0.a4d2525c262410p-23, 0x0.e7e8635a6ff958p-25, -0x0.c5946aba52ff70p-27, // x=    3.75 y=     2.5
+ 0x0.9379e56a7348e0p-3, 0x0.be3fa2594694e8p-3, -0x0.c40b31de9e7298p-5, -0x0.b7e6936ac2e700p-7, 0x0.965846807309e0p-7, -0x0.99b7d9ad2fd2f8p-8, -0x0.cebb7157b262f0p-11, 0x0.83f7fbed620250p-9, -0x0.ad947f52e683a0p-13, -0x0.dd6a0d99d23930p-12, 0x0.b522b6d61330c0p-14, 0x0.a59b5a9a6c12d8p-15, -0x0.9b92ef79e160a0p-16, 0x0.ead2312c715e20p-18, 0x0.d73e2a2ef76b78p-20, -0x0.fead932afe10a0p-19, 0x0.beb8e3f5947480p-22, 0x0.cfd2897c164e40p-21, -0x0.b4043879db9d10p-23, -0x0.d800ef37058c08p-25, 0x0.80964632cb1690p-25, -0x0.a6c86f78343ad0p-26, // x=    3.75 y=    2.75
+ 0x0.95cb393fb6cb28p-3, 0x0.b24e9ceb300560p-3, -0x0.b9ee9bbf721328p-5, -0x0.e577b9739d19e8p-8, 0x0.fd6790aeabfbc8p-8, -0x0.a8567913dc0918p-8, -0x0.db1c8af90fb4d8p-12, 0x0.efb31bfc95df50p-10, -0x0.d12b92904eed20p-13, -0x0.a89bb72182cc50p-12, 0x0.9bf6f77316f630p-14, 0x0.88e0446d0419c8p-16, -0x0.d2e70b6d259870p-17, 0x0.912f8d3cb4dcf8p-17, 0x0.d46f13bb2d2928p-22, -0x0.ca9a1a7bc75440p-19, 0x0.d729feb76bdd88p-22, 0x0.f2b68a9d645e70p-22, -0x0.ffbfe168682470p-24, 0x0.e16be52670b5a0p-29, 0x0.f39c3c347c9e50p-27, -0x0.9eef49ec6ab118p-26, // x=    3.75 y=       3
+ 0x0.971ebd582b8ae0p-3, 0x0.a70545121b3f20p-3, -0x0.af2aa4c46628d0p-5, -0x0.e32b4f8ad70cf8p-9, 0x0.d2f93288a2ae90p-8, -0x0.af05576fa0ed90p-8, -0x0.92e065eb0604c8p-13, 0x0.d4ae2ac23ab960p-10, -0x0.dbd121d4b5cd80p-13, -0x0.f85b73cbe84f68p-13, 0x0.805e81c2758bd8p-14, 0x0.9092907200c7a0p-20, -0x0.85cb4170f004e0p-17, 0x0.91e82fc4767b10p-17, -0x0.92e306a8083660p-22, -0x0.96c0197f28ea58p-19, 0x0.c3156d52c98d78p-22, 0x0.f9fccd92fda3d0p-23, -0x0.a668c8f046b938p-24, 0x0.e0e19e42ed9da8p-26, 0x0.ad69ac1e850c78p-28, -0x0.f9b1fbfeb991c8p-27, // x=    3.75 y=    3.25
+ 0x0.979eda989d18b8p-3, 0x0.9c6a7619e77ad0p-3, -0x0.a42d178bcd14b8p-5, -0x0.8d1bf9e7348a38p-11, 0x0.ada9d99d6e9cf0p-8, -0x0.afd98b5ab68de8p-8, 0x0.8053fdebb49bc8p-14, 0x0.b9676659ed4120p-10, -0x0.d693abbb50cb78p-13, -0x0.b0761ae41253e0p-13, 0x0.cc3cf4d52b9150p-15, -0x0.8a418083f01478p-17, -0x0.9bc25b60ff2a98p-18, 0x0.848e8b660b58a0p-17, -0x0.9e671afc3cca98p-21, -0x0.d4c5f1e5eb6370p-20, 0x0.9ea3a28a7ada20p-22, 0x0.cc950bc5d65118p-24, -0x0.c808cbd3671180p-25, 0x0.8a608c8eafb460p-25, 0x0.c2cfdd5a6a40c8p-32, -0x0.b01523ec8ee888p-27, // x=    3.75 y=     3.5
+ 0x0.9770e2dcb39938p-3, 0x0.927f282fc694b0p-3, -0x0.99459af0b38d20p-5, 0x0.f3a9404d695e18p-10, 0x0.8d5d5dda4902d0p-8, -0x0.ac83391e1291d0p-8, 0x0.d3368aef759be0p-13, 0x0.9f6baede31d698p-10, -0x0.c80a7460801668p-13, -0x0.f0166385a11c40p-14, 0x0.9e0a8b85b8b658p-15, -0x0.e03d476af8c108p-17, -0x0.9d3781be12ff48p-19, 0x0.e2a8bee3c16b48p-18, -0x0.ba190ab577ae38p-21, -0x0.8f1b32a49b7a00p-20, 0x0.f0ec27b6e9c660p-23, 0x0.876bc7b8bc82e8p-26, -0x0.dbb638b8bacf68p-26, 0x0.817e57820dc2b0p-25, -0x0.e7b16c92d0bf30p-30, -0x0.e5f474bf104130p-28, // x=    3.75 y=    3.75
+ 0x0.96b529d17ab1d0p-3, 0x0.8940214082dc10p-3, -0x0.8eabc70cfd29e8p-5, 0x0.f9035b48d48718p-9, 0x0.e37d9953106088p-9, -0x0.a6560040d4e080p-8, 0x0.9a56987b24c208p-12, 0x0.8796bd9ea24818p-10, -0x0.b4c520bc3c6528p-13, -0x0.99cb5812fb7878p-14, 0x0.eebdb3f32540e0p-16, -0x0.83628a7f6db1d0p-16, -0x0.df309d10598268p-21, 0x0.b9fb98ea2644b8p-18, -0x0.b61ebbf7bddb50p-21, -0x0.b6ff56c80d6660p-21, 0x0.ae0a48a156f6c0p-23, -0x0.dc0655839d3e08p-26, -0x0.d31b6deba20278p-27, 0x0.d67c4fb4a5aec8p-26, -0x0.9d9c61d5279748p-29, -0x0.8c79c9bf640c78p-28, // x=    3.75 y=       4
+ 0x0.9587579e172f30p-3, 0x0.80a749b027a610p-3, -0x0.8484890f6302d0p-5, 0x0.af5dcc99f25670p-8, 0x0.b4b808773756b0p-9, -0x0.9e55f1bef66e68p-8, 0x0.b85244b19d08a8p-12, 0x0.e498de1bfd8198p-11, -0x0.9fc57675118e90p-13, -0x0.b2a627ca54e488p-15, 0x0.b03c79f6c9a808p-16, -0x0.876ebed8e272c0p-16, 0x0.e99d5d3fece5f0p-24, 0x0.94167cb2a1c700p-18, -0x0.a2c14b30950e58p-21, -0x0.dbcb04b17047e8p-22, 0x0.f15a333e96f388p-24, -0x0.bb3412baa1e020p-25, -0x0.97d5b262bd0330p-28, 0x0.a54cdcf1fc37e0p-26, -0x0.98243e5e03ba80p-29, -0x0.9ffdc8dc8aa980p-29, // x=    3.75 y=    4.25
+ 0x0.93fed982e25360p-3, 0x0.f159632f75f2d0p-4, -0x0.f5cd57d6c41a38p-6, 0x0.d77d79d6e4ca68p-8, 0x0.8d6fe94ceea460p-9, -0x0.95459212e9d820p-8, 0x0.c872fd45b00c60p-12, 0x0.bf4703ad47fe90p-11, -0x0.8aebfdd2a5cb00p-13, -0x0.a9087594f71578p-16, 0x0.fe1706ab53eca8p-17, -0x0.824e65d582b2d8p-16, 0x0.af07c740681278p-21, 0x0.e65d576160b558p-19, -0x0.89b23b3602dc48p-21, -0x0.f06b6f228dc4c0p-23, 0x0.a11d10aa395260p-24, -0x0.ced423a77366d8p-25, -0x0.eb214f50c1c798p-34, 0x0.f286c8e59c75a8p-27, -0x0.8007517c9c2f88p-29, -0x0.a6388ce386f118p-30, // x=    3.75 y=     4.5
+ 0x0.922f5df799ee88p-3, 0x0.e28ea8c80f7cb0p-4, -0x0.e3bd0b7cebc6c8p-6, 0x0.f6a0bd7e9bb638p-8, 0x0.d9583b98ff4e98p-10, -0x0.8bb30ac79d8808p-8, 0x0.ce93fc6e53a348p-12, 0x0.9f08136cfe2068p-11, -0x0.ee9f4651a76ad0p-14, -0x0.8beb15961a57f0p-18, 0x0.b24b93cb0cb118p-17, -0x0.f043ddffcef748p-17, 0x0.f98d52de65f748p-21, 0x0.afbaca8507b448p-19, -0x0.e0939a51884950p-22, -0x0.dbbafd806f99d0p-24, 0x0.ceaac9b77d9130p-25, -0x0.c453411897a7f8p-25, 0x0.89b180d6297bc8p-29, 0x0.ab2eb7bdf6e930p-27, // x=    3.75 y=    4.75
+ 0x0.902950add3c3f8p-3, 0x0.d4db4feae49fe0p-4, -0x0.d2e1bd7aabdc10p-6, 0x0.872577d5d324d8p-7, 0x0.a303be0a8e40c0p-10, -0x0.8203b314ab3bb8p-8, 0x0.cdaeaaf0565080p-12, 0x0.83788ecf903288p-11, -0x0.cb002d7c030400p-14, 0x0.e6b64e4b780df8p-18, 0x0.f1e90a15d5d2c8p-18, -0x0.d73f0de4da93a8p-17, 0x0.8b1cb57b977648p-20, 0x0.83c55c4eaef160p-19, -0x0.b25748f0607840p-22, -0x0.df25b254f867e0p-26, 0x0.fc953b81153f98p-26, -0x0.ac40db05a1e3b0p-25, 0x0.c2062caef85198p-29, 0x0.ea29ada0376058p-28, // x=    3.75 y=       5
+ 0x0.8dfa4fabd1c0a8p-3, 0x0.c82c0588997190p-4, -0x0.c33a5dab069540p-6, 0x0.8fe3a38ec477a0p-7, 0x0.ec6ea4fb6fe3b0p-11, -0x0.f0fb5c7df85e70p-9, 0x0.c8039752dc8280p-12, 0x0.d8398d3bb6df48p-12, -0x0.ab6bba6dfeab60p-14, 0x0.ee8934afd03958p-17, 0x0.9c94e9b91cf1c0p-18, -0x0.bcf867a99a96a8p-17, 0x0.8b65b409c69b38p-20, 0x0.c26dc2095d3500p-20, -0x0.8ac8d279308d58p-22, 0x0.a63e0d2c837508p-26, 0x0.9030dc384bd778p-26, -0x0.90054b644ec120p-25, 0x0.c9f8bcee1e29a8p-29, 0x0.9b5837cd1b64b0p-28, // x=    3.75 y=    5.25
+ 0x0.8bad95f18d9b60p-3, 0x0.bc6dc55308cdd0p-4, -0x0.b4bea0e7bf72a8p-6, 0x0.96174a212851a8p-7, 0x0.a2f00e5b4ceb50p-11, -0x0.de9f5ea6638540p-9, 0x0.bf401a488700c8p-12, 0x0.b0e46053ec02b8p-12, -0x0.8fe7c96f2ad720p-14, 0x0.9deb60af917468p-16, 0x0.bc3cf82d864fc0p-19, -0x0.a378b94eb5fd40p-17, 0x0.83a0706e8a7f28p-20, 0x0.8d137e4d4b4178p-20, -0x0.d48460fbb33c38p-23, 0x0.bd47e19b017478p-25, 0x0.92aa2721eb8270p-27, -0x0.e921ebcdad7818p-26, 0x0.b9f9a564326708p-29, 0x0.c78bf739295688p-29, // x=    3.75 y=     5.5
+ 0x0.894c5a3352d060p-3, 0x0.b18e3827e0ea08p-4, -0x0.a761891bc37fd0p-6, 0x0.9a36aabb91b448p-7, 0x0.cdedcdfec380d0p-12, -0x0.cd2e2f3e8b3550p-9, 0x0.b49ebd7c129928p-12, 0x0.8ff3849a9b1510p-12, -0x0.f07904ccf1da80p-15, 0x0.b3e9f7229b6420p-16, 0x0.c4b708c2d43e30p-20, -0x0.8bdd8bece00ea8p-17, 0x0.ef7474c2358388p-21, 0x0.c900c5e5447238p-21, -0x0.a07c3137be7eb0p-23, 0x0.ee75573315f5b8p-25, 0x0.e4bc49dc89af50p-29, -0x0.b856493f03da28p-26, 0x0.a030ab9d33e0e8p-29, 0x0.f6969c09522208p-30, // x=    3.75 y=    5.75
+ 0x0.af0d636f6f7e50p-24, 0x0.909a596aab0a70p-2, -0x0.b485ce8aeafa40p-21, -0x0.960e367d70eb30p-4, 0x0.b4b191e3c6d618p-19, 0x0.a244ec6b168178p-6, -0x0.e969020d9dd208p-18, -0x0.b85e8e0a986e68p-8, 0x0.da1e17e191f190p-17, 0x0.dee4b07eb58310p-10, -0x0.9c9b204beec8f8p-16, -0x0.9190e64d08cae8p-11, 0x0.b2faf3181bb8a0p-16, 0x0.ce3b1c00777250p-13, -0x0.a6324c22532860p-16, -0x0.9964b39a4c96f0p-14, 0x0.fd4a43877aa318p-17, 0x0.dc492cd9aceb58p-16, -0x0.9e514699dd2e48p-17, -0x0.832876009f52f8p-17, 0x0.9fe85e78e02240p-18, 0x0.a0ba83104cfca8p-20, -0x0.f9719f70ca4838p-20, 0x0.8c73975fe0c0d8p-21, 0x0.81cf1ca0a6da48p-21, -0x0.9624ee75493488p-21, -0x0.b309e21f334b80p-26, 0x0.93a3940c17ea68p-22, -0x0.fb3130d2a7c1c8p-25, -0x0.af95c5d6cbc3e0p-24, 0x0.921fe2a4ed9fa8p-25, 0x0.9de520bcc1b618p-28, -0x0.af238a2f0ffdd0p-28, 0x0.d97398a5cc6250p-28, // x=       4 y=       0
+ 0x0.deaf5ac0ae1770p-6, 0x0.8f319493568278p-2, -0x0.eda76b9b1c4730p-7, -0x0.914db7bfac0918p-4, 0x0.c6157e3ee8b6e8p-8, 0x0.96f872d243bbe8p-6, -0x0.99c6dc6d2d0d20p-9, -0x0.a04aa69c22df68p-8, 0x0.ebe2a79edcdbc0p-11, 0x0.ac4eda9ef26660p-10, -0x0.b6f37e3609aa38p-12, -0x0.b621de14ade370p-12, 0x0.8f119966084fd8p-13, 0x0.ae3a213c42e328p-14, -0x0.daf56254338530p-15, -0x0.dec3767a044630p-17, 0x0.9b05bf9a178418p-16, -0x0.927ac177c630f0p-19, -0x0.b9431175f3a038p-18, 0x0.e4ef557640a848p-19, 0x0.95a0a93b5d24f8p-20, -0x0.83ca25ca64b8d0p-19, 0x0.943a7feebd0218p-25, 0x0.d0712322799028p-21, -0x0.aa890318ac6c40p-23, -0x0.e64021f52704b0p-23, // x=       4 y=    0.25
+ 0x0.b6263a759068f8p-5, 0x0.8cc4bbcc853bc0p-2, -0x0.be181899661960p-6, -0x0.895cc9a40b8808p-4, 0x0.98ddf0e70f0550p-7, 0x0.84fe51aa4a5878p-6, -0x0.e063c683e236d8p-9, -0x0.fa3c1dcd314d10p-9, 0x0.9dbe3ca38a36a8p-10, 0x0.d907935d0bc750p-11, -0x0.d68ae4e2de42a0p-12, -0x0.9260ed8be21a40p-13, 0x0.8ad9223e6d7d18p-13, 0x0.a530c1643c2030p-20, -0x0.a343e2ded7f0e0p-15, 0x0.f81d3fabde8698p-17, 0x0.9cd810a3b7b948p-17, -0x0.9efd434b02d998p-17, -0x0.a5da18a5f87748p-20, 0x0.89a3ed1e595d60p-18, -0x0.b53a2315e318e8p-22, -0x0.b319638a9607d0p-20, 0x0.af42a928239320p-22, 0x0.9d90503a68ae88p-22, -0x0.93de6b0871ef58p-23, -0x0.fff0560a7138e8p-27, // x=       4 y=     0.5
+ 0x0.f837a29fdd4af8p-5, 0x0.894ebf6252da20p-2, -0x0.faf90c8cb379c8p-6, -0x0.fd00136be8a518p-5, 0x0.c027d90fa53f18p-7, 0x0.dbdd2a205d7520p-7, -0x0.83165739168d90p-8, -0x0.a83250097ebac8p-9, 0x0.a5ace5501628f0p-10, 0x0.af07e926717f18p-12, -0x0.c13cf66f5c3368p-12, 0x0.8bdbf31082cb68p-15, 0x0.c79a97d6496990p-14, -0x0.d02a9cee7439d0p-15, -0x0.a1b2d845c13268p-16, 0x0.d327985a4e3a10p-16, 0x0.d56805a19c3050p-20, -0x0.9c98cef1c528e8p-17, 0x0.87b5c945b24418p-20, 0x0.b20e5d1bb75ce8p-19, -0x0.b8a5e652048a88p-21, -0x0.85f88b175ea068p-21, 0x0.87a99c5b0d6230p-22, 0x0.c851cb725bb450p-30, -0x0.fe248b7f96afd8p-25, 0x0.c17f2e8998df68p-25, // x=       4 y=    0.75
+ 0x0.9a290d2ce28e10p-4, 0x0.84fd3e1faf02e0p-2, -0x0.95d6fb2a4bf460p-5, -0x0.e3541eefe36290p-5, 0x0.d8183b9b519428p-7, 0x0.a98ba4be9d4a20p-7, -0x0.870e952c14fc98p-8, -0x0.b0e44f5d259b50p-10, 0x0.9656f39a028ec0p-10, -0x0.976dfa72aa6218p-14, -0x0.90e9b93e618760p-12, 0x0.95c2b2d156f4a8p-13, 0x0.d70f86282d66c0p-15, -0x0.8ffed7bbe9bb00p-14, -0x0.ecd9cbff0dd200p-19, 0x0.c645d36d4493e0p-16, -0x0.a9e039e03220e0p-19, -0x0.d0964f4b5372f8p-18, 0x0.d01f465f88e6c8p-20, 0x0.90c8f504affd88p-20, -0x0.8e58de09c2a7e0p-21, 0x0.98307880e5d1c8p-28, 0x0.fb1828c69fc250p-24, -0x0.c251e4c8e1cf50p-24, // x=       4 y=       1
+ 0x0.b4da9774294950p-4, 0x0.80021f68e9c158p-2, -0x0.a7e80ff8929c18p-5, -0x0.c78fb985f01198p-5, 0x0.e209cf83806458p-7, 0x0.eff7bfb7cea458p-8, -0x0.ff7a60cf6d9f80p-9, -0x0.9fcc38ae3488f0p-12, 0x0.f474ef176171a8p-11, -0x0.b907b46252d3c0p-12, -0x0.b5e36b3d5441c0p-13, 0x0.c8a1f29c4f5e30p-13, 0x0.80e2c991102d80p-16, -0x0.8a4d485d34f5c0p-14, 0x0.ba0c57d1daf980p-18, 0x0.8ec5a49444e868p-16, -0x0.f8dfad04285cc0p-19, -0x0.c75d13de8bc7c8p-19, 0x0.a90f313e64d690p-20, 0x0.9f3ff468aa5e38p-24, -0x0.94bfd171949bd0p-22, 0x0.c857b51bdb5138p-23, 0x0.dc3e69fb29a288p-26, -0x0.b4a392068bc3b8p-24, // x=       4 y=    1.25
+ 0x0.cc07cb4b79f7d8p-4, 0x0.f51d52c481a8b8p-3, -0x0.b4036662c6e838p-5, -0x0.ab4bb43a18b078p-5, 0x0.e08dab8861bdd8p-7, 0x0.954415f1137340p-8, -0x0.e289408994ab30p-9, 0x0.8481df107dfb28p-11, 0x0.b4287d6960dfa8p-11, -0x0.861e22172f4f78p-11, -0x0.afd65506987c18p-14, 0x0.ccc102d2ff58d0p-13, -0x0.86a15e5af7cca8p-17, -0x0.dc5ca845b4a140p-15, 0x0.975770081a5758p-17, 0x0.a5568a6aab6e10p-17, -0x0.dcfadff6eb14a0p-19, -0x0.ba02273e930430p-21, 0x0.ccfc4cbbdd03f0p-21, -0x0.c45743fc8f2570p-22, -0x0.c1e07e20b99590p-24, 0x0.ce49b70a4d2008p-23, -0x0.f4a68754a335c8p-27, -0x0.daf532390c9df0p-25, // x=       4 y=     1.5
+ 0x0.dfb59999cdbf58p-4, 0x0.e9a0181d5540f8p-3, -0x0.bad2fcb1c40698p-5, -0x0.8fc67b444da080p-5, 0x0.d69be0266e3e70p-7, 0x0.8ddf5d1babe850p-9, -0x0.be90e5dbfadb00p-9, 0x0.8cd1aec34d70f0p-10, 0x0.eeab1da326d520p-12, -0x0.96004d240a8de8p-11, -0x0.8fe51dcf1856c8p-16, 0x0.b56254a1c10a98p-13, -0x0.a81f4340ab44d0p-16, -0x0.98a39cbe0f2e10p-15, 0x0.976e0450dd5a20p-17, 0x0.8d0fbdd115ec80p-18, -0x0.9c28aab0f3b188p-19, 0x0.8ebecd202968a0p-21, 0x0.bb484d89504b00p-22, -0x0.f2b98416762210p-22, 0x0.8a5f48266496d0p-27, 0x0.91d664e2dcdbe0p-23, -0x0.c6694f4883d138p-26, -0x0.c0f0a61212b000p-26, // x=       4 y=    1.75
+ 0x0.f00ad70b90d7f8p-4, 0x0.dddac2f88e3060p-3, -0x0.bd2be9bd64b4f0p-5, -0x0.ebc14aced91c78p-6, 0x0.c7085a695c30f0p-7, 0x0.d0ef1add09b598p-13, -0x0.9907a441dc5e98p-9, 0x0.bb324162fbae48p-10, 0x0.880e058d9d4748p-12, -0x0.93ecb6fc068aa0p-11, 0x0.dbbb3c96fb6ae0p-16, 0x0.91fb436b7907c0p-13, -0x0.c88712e1e67c38p-16, -0x0.b79390b38e95c8p-16, 0x0.f864fd8c8ee148p-18, 0x0.8dea57df346858p-21, -0x0.b8d22cfb448748p-20, 0x0.854ae3a5ef9128p-20, 0x0.b913892031ab20p-24, -0x0.cab501bae51810p-22, 0x0.bc45e6d065ed68p-25, 0x0.a3bd51b16fa008p-24, -0x0.a3b5408ee91fe0p-26, -0x0.bd16f5f13173c8p-28, // x=       4 y=       2
+ 0x0.fd4504bf556188p-4, 0x0.d20dbf399a76f0p-3, -0x0.bbed9d0e89f550p-5, -0x0.bc4d6602bb3320p-6, 0x0.b438d4e8401040p-7, -0x0.b060afc80378a8p-10, -0x0.eb03a1115c7b80p-10, 0x0.d2c8f005556c70p-10, 0x0.e22c5992563798p-14, -0x0.86f38fc4bffd58p-11, 0x0.d28c5ccdaff870p-15, 0x0.d9787aeb3ce560p-14, -0x0.bfea46c02e9a40p-16, -0x0.b3f31d8a70b070p-17, 0x0.b345c3b0bb3760p-18, -0x0.c4499cec5d2f08p-20, -0x0.b0c402f56238c0p-21, 0x0.888ca8a8b8f1d8p-20, -0x0.c86f5d6bbca1f8p-25, -0x0.8b9d42ae905ae8p-22, 0x0.c8442491913318p-25, 0x0.8f013d7705f228p-25, // x=       4 y=    2.25
+ 0x0.83d760da645aa8p-3, 0x0.c66bc619fb0890p-3, -0x0.b7ec3c0557fc38p-5, -0x0.91c1b57cc15f90p-6, 0x0.a00ad7e2eee148p-7, -0x0.a4374889657060p-9, -0x0.ac006044bfb5a8p-10, 0x0.d95525bd56acb0p-10, -0x0.ab5dd5b5288e78p-20, -0x0.e91f5bcb86b580p-12, 0x0.fc39d6faf2d218p-15, 0x0.967dc3386ca648p-14, -0x0.a354ef7c1a4820p-16, -0x0.ce3802acd76c50p-19, 0x0.e849ece853ba00p-19, -0x0.98e2d74fe9aed8p-19, -0x0.d371621b36af10p-23, 0x0.e31dbdc79c1830p-21, -0x0.cc478a42bd36f8p-24, -0x0.a5cfef965e0600p-23, 0x0.9de0f766aa01c0p-25, 0x0.8c727fff474b50p-27, // x=       4 y=     2.5
+ 0x0.87cc299d348360p-3, 0x0.bb1aff997cfed0p-3, -0x0.b1e466798a0ad0p-5, -0x0.d8903d8e7733e0p-7, 0x0.8bd7500886c708p-7, -0x0.da6984d9c2eb70p-9, -0x0.ed6efd1053d758p-11, 0x0.d40ad7cd6e5440p-10, -0x0.9b334f1f55fee8p-14, -0x0.c1144968d25828p-12, 0x0.ff68355880ec18p-15, 0x0.bf770184052dd0p-15, -0x0.807610f91cb850p-16, 0x0.db287c861ffce0p-20, 0x0.85a4572035b970p-19, -0x0.a03dcc1cc72970p-19, 0x0.fb954d32297f58p-25, 0x0.a7321a910ca360p-21, -0x0.d315ceb0c23108p-24, -0x0.a6f57f3f0a57d0p-24, 0x0.d3c759616cdc70p-26, -0x0.8544569f3c0c08p-28, // x=       4 y=    2.75
+ 0x0.8aa91d739d8f50p-3, 0x0.b036acb9c38740p-3, -0x0.aa75edc3374478p-5, -0x0.97860edd824fd0p-7, 0x0.f10a1acdff7688p-8, -0x0.fe7ec909304b58p-9, -0x0.96ac8dcca5d490p-11, 0x0.c73016f09a4178p-10, -0x0.f771f890283648p-14, -0x0.9a765dfcb249f0p-12, 0x0.ec4260b422d3c8p-15, 0x0.d7d2da6a646730p-16, -0x0.bdf08b581877a8p-17, 0x0.8b56fdf091fc58p-18, 0x0.806aaaf1565c98p-20, -0x0.8f663f83c0da80p-19, 0x0.bb1b74509dec28p-23, 0x0.e061f90ab07180p-22, -0x0.b055c4e66fece8p-24, -0x0.fb7ad4c5467028p-26, 0x0.fa867e5930a418p-27, -0x0.8b1b4630feb6d0p-27, // x=       4 y=       3
+ 0x0.8c94c9b1ca0170p-3, 0x0.a5d0fea5931578p-3, -0x0.a223247486ec10p-5, -0x0.bf9bc498688d18p-8, 0x0.cd40c549c363f0p-8, -0x0.8a087173788300p-8, -0x0.a49b0b6838fa60p-12, 0x0.b60aa74a1079e0p-10, -0x0.937cf3266b5aa8p-13, -0x0.ef9d6a8ec94da8p-13, 0x0.ce3d29e1a18a80p-15, 0x0.bf0ba58df1dd58p-17, -0x0.84c8e5f8186620p-17, 0x0.ae5df06d3cdcb0p-18, 0x0.9ba9c69e8def48p-22, -0x0.ea5a096ea34898p-20, 0x0.dda0e334b90bb0p-23, 0x0.89e42379d58348p-22, -0x0.83035377f44ad8p-24, -0x0.99412d899a78a8p-29, 0x0.81825d4f7dee58p-27, -0x0.8f3de572f43958p-27, // x=       4 y=    3.25
+ 0x0.8db2ebaeb333d0p-3, 0x0.9bf4e108abe3a8p-3, -0x0.9952e389a0e450p-5, -0x0.c2714633e5cf30p-9, 0x0.ace48fa9466c48p-8, -0x0.8f2eb9b3389c90p-8, -0x0.f02e3e7c193118p-14, 0x0.a2f7963ef851f0p-10, -0x0.9b9347935ba460p-13, -0x0.b45fab3b022c00p-13, 0x0.acc6293ffc06b8p-15, 0x0.da5d905deb3ae0p-20, -0x0.af1486ab2fe030p-18, 0x0.b2c614c28356f8p-18, -0x0.da2f646afbf9c8p-24, -0x0.b3d941d0104120p-20, 0x0.d13db26fcd7440p-23, 0x0.986cc7b5ffb8d8p-23, -0x0.b3199f271289d0p-25, 0x0.b7419b44849ff8p-27, 0x0.d916182423c570p-29, -0x0.eee8fd535ecb88p-28, // x=       4 y=     3.5
+ 0x0.8e23db7e2e98a0p-3, 0x0.92a797c903e448p-3, -0x0.9053e9ec890898p-5, -0x0.90e12afb83a828p-11, 0x0.9028a6e60341b8p-8, -0x0.90158b52349ba0p-8, 0x0.8c0bb04fa7c600p-15, 0x0.8f93f8e8a23808p-10, -0x0.994ae333743330p-13, -0x0.83867f41c13990p-13, 0x0.8c414ccf404a60p-15, -0x0.9a8a18b8e63aa0p-18, -0x0.d6991563f1da60p-19, 0x0.a6206b0a2c2c40p-18, -0x0.a3296d28eb9168p-22, -0x0.835ee8aa8fdd68p-20, 0x0.b0ca41e43e5068p-23, 0x0.8dd7398e0b4140p-24, -0x0.e3c497c655d038p-26, 0x0.826a34df981428p-26, 0x0.c370b581db4170p-31, -0x0.b210a559e0ddc0p-28, // x=       4 y=    3.75
+ 0x0.8e04561c3b9ae0p-3, 0x0.89ea2227ef4678p-3, -0x0.8760b27dd6e1a0p-5, 0x0.be23f775f9c0c0p-10, 0x0.ee02abc5d29090p-9, -0x0.8de259f6df4808p-8, 0x0.92328bb24f3d58p-13, 0x0.f9d10fc4819ce0p-11, -0x0.90a0dc392ad5a0p-13, -0x0.b8bec58df9e7d0p-14, 0x0.ddf1b7422e0d18p-16, -0x0.8a7b146f441948p-17, -0x0.eb40419b105a58p-20, 0x0.916fd091701b98p-18, -0x0.ced894f9755e38p-22, -0x0.b7af962445ea08p-21, 0x0.8b6ae080811738p-23, 0x0.a6a2285c6ab9a8p-26, -0x0.8631c4c0685a48p-26, 0x0.831169e6dcce58p-26, -0x0.87441f6685c208p-31, -0x0.f5d81397e23950p-29, // x=       4 y=       4
+ 0x0.8d6d8722bd09c0p-3, 0x0.81ba608cc6d288p-3, -0x0.fd4670765ef2a0p-6, 0x0.caeb49fbd61a20p-9, 0x0.c2781a40c38908p-9, -0x0.8980aa18c650b8p-8, 0x0.de984b4b126440p-13, 0x0.d721fbe33c1408p-11, -0x0.8471914ca4c9a0p-13, -0x0.f6eb84ea0d24f0p-15, 0x0.abbb6f037f6230p-16, -0x0.a94e11e80d66c8p-17, -0x0.cccef232986d98p-21, 0x0.f48ac2df9b58c8p-19, -0x0.d40ffdd6dc1eb0p-22, -0x0.f5bae598294538p-22, 0x0.d14e0d9a119c48p-24, -0x0.eed714d6c4ab30p-28, -0x0.8f00af13111770p-27, 0x0.e4f450458af580p-27, -0x0.848fe299a0d530p-30, -0x0.9f6aefc8996280p-29, // x=       4 y=    4.25
+ 0x0.8c7539e9c8ff08p-3, 0x0.f428013f688ae0p-4, -0x0.ec70c01bb5ae58p-6, 0x0.91496927685068p-8, 0x0.9d2155ccb0a330p-9, -0x0.83a903b875dd70p-8, 0x0.8805ed7b0d80b0p-12, 0x0.b7b8fed61d4cb8p-11, -0x0.ed67d9891c1a70p-14, -0x0.990594e0c99390p-15, 0x0.82260502be9860p-16, -0x0.b3c07818338610p-17, -0x0.f8d6479ce6a268p-24, 0x0.c796203baf48b8p-19, -0x0.c4a08f4de93670p-22, -0x0.9c29c660bb6f10p-22, 0x0.970a9d6b631c98p-24, -0x0.ac78666deca228p-26, -0x0.ff8072cfdec5b8p-29, 0x0.b8aa7dfba6ce40p-27, // x=       4 y=     4.5
+ 0x0.8b2e20acfa8368p-3, 0x0.e5e26cf9643fc0p-4, -0x0.dc65d29a502ab0p-6, 0x0.b47d00c0b5cbe8p-8, 0x0.fab583f9425e60p-10, -0x0.f9d1cfe02d4670p-9, 0x0.9687513d93ee30p-12, 0x0.9bcd661f4ebdd8p-11, -0x0.d16336a3983710p-14, -0x0.a51dbc68852ad8p-16, 0x0.c1326290c03a40p-17, -0x0.b135f437d66bd0p-17, 0x0.981e70359fb448p-22, 0x0.9f308d00e974e8p-19, -0x0.abd38f429e59c8p-22, -0x0.b931cc8165b190p-23, 0x0.d281a87cfc5a10p-25, -0x0.d79964c71cc520p-26, -0x0.88a6db379d9830p-30, 0x0.8d729ec2883d58p-27, // x=       4 y=    4.75
+ 0x0.89a825b4062b08p-3, 0x0.d89695b7b5b8f0p-4, -0x0.cd3bbdfd7c7a10p-6, 0x0.d05f82c81c4e68p-8, 0x0.c4fa1a5d4640a8p-10, -0x0.eb554050b11750p-9, 0x0.9d70ff9fd1de38p-12, 0x0.8354ab244fe8e0p-11, -0x0.b66d5b684f70f8p-14, -0x0.f673ef23c53930p-18, 0x0.8c2cb311ee3850p-17, -0x0.a6f00342e48f98p-17, 0x0.88c2354f327630p-21, 0x0.f93280e110b6b0p-20, -0x0.905f32d19e9cf0p-22, -0x0.c407dd81184710p-24, 0x0.8db45de1d72e30p-25, -0x0.dae810624a2810p-26, 0x0.875d546c4c22f8p-31, 0x0.d06fecc0d1a3e0p-28, // x=       4 y=       5
+ 0x0.87f0be94e20508p-3, 0x0.cc360be38b44e8p-4, -0x0.befd2329e0ba70p-6, 0x0.e616cac6308300p-8, 0x0.97cdce000092a8p-10, -0x0.dc789d4bb983a0p-9, 0x0.9ed70fd552dde0p-12, 0x0.dc39de3fe407b8p-12, -0x0.9d6e9d711cfbc0p-14, 0x0.c9203dd1036020p-20, 0x0.c6019528dc6c00p-18, -0x0.988b2f25799ce8p-17, 0x0.a61d960c488870p-21, 0x0.bfe4f0dc257bb0p-20, -0x0.ebe64d1cfa0a58p-23, -0x0.a15e35c5863a70p-25, 0x0.b792130217d068p-26, -0x0.c991072abbf440p-26, 0x0.a599ff148778c8p-30, 0x0.94cce5788f9b90p-28, // x=       4 y=    5.25
+ 0x0.86133ca16875d0p-3, 0x0.c0b1fc26ea1c48p-4, -0x0.b1ac4ec5c76758p-6, 0x0.f6a1bd1e1a92a0p-8, 0x0.e40a3add074a90p-11, -0x0.cdac0451919708p-9, 0x0.9c570652844180p-12, 0x0.b7be6ef25bcc88p-12, -0x0.86d87f765791d0p-14, 0x0.8051554aa11608p-17, 0x0.870db62a24cc30p-18, -0x0.886c62878ac3c8p-17, 0x0.af203aa611d5d0p-21, 0x0.91932d106eb978p-20, -0x0.bcb0f06d89d6d0p-23, -0x0.f17a3a624a0f10p-29, 0x0.e27ed55d092260p-27, -0x0.af4b830a5dfcd8p-26, 0x0.c867dc2e1461a0p-30, 0x0.ce8c8496b0b7e8p-29, // x=       4 y=     5.5
+ 0x0.a7419166de0800p-27, 0x0.87d103324171e0p-2, -0x0.b6efb70882d8c8p-24, -0x0.83bc1f9c572490p-4, 0x0.c2dc23a6182cc0p-22, 0x0.844bf60bdde1f0p-6, -0x0.867687b36c2a08p-20, -0x0.8a4a3ab17b1b20p-8, 0x0.86e3e231dcd930p-19, 0x0.97a9d132061e10p-10, -0x0.d12a4a4cfc1ec0p-19, -0x0.b09673ee4a2278p-12, 0x0.8208db251dca28p-18, 0x0.dd39488de400b0p-14, -0x0.84a999995c8b88p-18, -0x0.956e2c66b56740p-15, 0x0.e12e927a5de200p-19, 0x0.d34f712a369e58p-17, -0x0.9ff73c8f40cbf0p-19, -0x0.913a294c8cac38p-18, 0x0.bdde00e98443c0p-20, 0x0.aa32d200610b20p-20, -0x0.b9b88e16753360p-21, -0x0.ee2138618da0c8p-23, 0x0.904848cacd1688p-22, -0x0.d50856c4d3eba0p-25, -0x0.a02ceb3c22ff50p-24, 0x0.9142d0ca60fb78p-24, 0x0.85b8f2c263c590p-27, -0x0.9903cd2dc9dc30p-25, 0x0.da0e7b919ffd60p-28, 0x0.b8f1e527f915d0p-27, -0x0.ccdd4f85ec9ed0p-29, -0x0.c1d45221faf840p-33, // x=    4.25 y=       0
+ 0x0.c3cc984a188ee8p-6, 0x0.86aa4e7394aa68p-2, -0x0.c2850e3abdcae0p-7, -0x0.8027c6189c7a38p-4, 0x0.95eb36c5ef9638p-8, 0x0.f9182c40d69410p-7, -0x0.d56cda9f9f20c8p-10, -0x0.f71472f50a5b30p-9, 0x0.94c00b2ad259f8p-11, 0x0.f93a5dd5418b58p-11, -0x0.d0c0f3e0439630p-13, -0x0.fc88eb0184f378p-13, 0x0.95106ec640de48p-14, 0x0.f847e05c3dc0c0p-15, -0x0.d6f770e52e06b0p-16, -0x0.d6ba69ef4ce0d8p-17, 0x0.97faf12d39adc0p-17, 0x0.d7133d4a8311b8p-20, -0x0.c7e9479cbc1080p-19, 0x0.8ea0d39dab3228p-21, 0x0.e00cdec28b17a0p-21, -0x0.96dd05312392c0p-21, -0x0.ac4e991dd63608p-23, 0x0.9d810e7444eda0p-22, -0x0.9800e75d8a09b0p-29, -0x0.ef47b374622ae0p-24, // x=    4.25 y=    0.25
+ 0x0.a09320f495fbc0p-5, 0x0.84ac839cfa1c00p-2, -0x0.9c947874b685b8p-6, -0x0.f4354598e847b8p-5, 0x0.ea82d85940df40p-8, 0x0.dfcd64e6818eb8p-7, -0x0.9fe26e19ffb4a0p-9, -0x0.c99111c1efe8d0p-9, 0x0.d0fc8bcc0e15e8p-11, 0x0.ad253dcd664c68p-11, -0x0.853fea105327a8p-12, -0x0.82fa645d762e40p-13, 0x0.a56b0c17fce840p-14, 0x0.fab76d281e8f18p-17, -0x0.c39064af2af048p-16, 0x0.c432e8eb2275e0p-19, 0x0.d13f82e1e4b078p-18, -0x0.dcdaa082dcf320p-19, -0x0.b3c12728fc6aa8p-20, 0x0.e1fd5933f85930p-20, 0x0.911216f3dbf2e0p-23, -0x0.addccb112e3ed8p-21, 0x0.86572163f4de60p-24, 0x0.cffe7043ab1d70p-23, -0x0.ccc12be321a4c8p-25, -0x0.adf3b384442a70p-25, // x=    4.25 y=     0.5
+ 0x0.db9c67fd77a190p-5, 0x0.81cf98472ed840p-2, -0x0.d07c740a8de430p-6, -0x0.e366b8ed29a2b8p-5, 0x0.95e7d028694cf0p-7, 0x0.be6c6662f5e6b0p-7, -0x0.c0a6780d99fe88p-9, -0x0.91c5dba9c3bde8p-9, 0x0.e757d8caa95f60p-11, 0x0.b286c21b1dcf40p-12, -0x0.82bc65dd031298p-12, -0x0.fc6bf6f47d15e0p-17, 0x0.8882206bd2b5b0p-14, -0x0.9dfb7677a681d0p-16, -0x0.f8c637e6151f48p-17, 0x0.c20f4111fa0068p-17, 0x0.a62028e7688c10p-19, -0x0.9daf328eb8aca8p-18, -0x0.d95c2274258a18p-26, 0x0.cb9e7f7c961178p-20, -0x0.dec3a867c2d7b0p-23, -0x0.cdb438fafa6bf8p-22, 0x0.e89dfd82081978p-24, 0x0.872d19175c0690p-24, // x=    4.25 y=    0.75
+ 0x0.88fed160791548p-4, 0x0.fc6934384b4948p-3, -0x0.fb70f43b42c1a0p-6, -0x0.cf2e315f350a48p-5, 0x0.abd5efd650c5d8p-7, 0x0.98d34202c1d330p-7, -0x0.cd41118004d768p-9, -0x0.b11630ac790298p-10, 0x0.de10e3ab9ee060p-11, 0x0.df96c3c8c14a18p-15, -0x0.d7ae6d442376b8p-13, 0x0.8a46e5631b30a8p-14, 0x0.b17f4084881178p-15, -0x0.9a50ba68814f68p-15, -0x0.c7d67d883a91b0p-18, 0x0.e34dfbfe2a5248p-17, -0x0.88fe932a354560p-22, -0x0.8464e8c7643f38p-18, 0x0.9d14048f71b530p-21, 0x0.eea9630367ccb8p-21, -0x0.8c16fa94b3d508p-22, -0x0.815d878936d038p-23, 0x0.a44cc45b1411f0p-24, -0x0.ced8c2afa13978p-27, // x=    4.25 y=       1
+ 0x0.a1838c802e9f80p-4, 0x0.f401ae839cbdc8p-3, -0x0.8e6b9b1b73bf68p-5, -0x0.b8dfc03a378588p-5, 0x0.b770151ec33b78p-7, 0x0.e50121aff8c278p-8, -0x0.c91dc22a205700p-9, -0x0.91e63e194587d0p-11, 0x0.bff56f49219da8p-11, -0x0.af2c23d30db410p-13, -0x0.98e9773ff58a80p-13, 0x0.eb5cf40b4fd2e0p-14, 0x0.a7e98b9d96f110p-16, -0x0.ac92e812572538p-15, 0x0.80ed77c47c8b18p-21, 0x0.c0f723cd843608p-17, -0x0.d3805b9bc19248p-20, -0x0.a50230a59ebc40p-19, 0x0.b4ed415a0f4630p-21, 0x0.a9b30823531408p-22, -0x0.c98196e6ec12f8p-23, 0x0.8022b049ddf7f8p-25, 0x0.931be442c8bc90p-25, -0x0.92c59886c3abb8p-25, // x=    4.25 y=    1.25
+ 0x0.b72d85cfaf4ed8p-4, 0x0.eab4d16f07ddb0p-3, -0x0.9a6e030f15a1b8p-5, -0x0.a1b1e76ecff5b0p-5, 0x0.ba14a6ba385a80p-7, 0x0.9c4e9e098c17e0p-8, -0x0.b9067771a5d910p-9, 0x0.d35c5d409a8718p-14, 0x0.97cac0c9376698p-11, -0x0.a3616ae900cef8p-12, -0x0.b58ddb49c0b100p-14, 0x0.86e687e432bbb0p-13, 0x0.c428c7f0f2d270p-19, -0x0.9a8df8b5ec4820p-15, 0x0.854d641f159b70p-18, 0x0.8550fbb57a0950p-17, -0x0.f7ffe607ef8ac0p-20, -0x0.92b2c79158bdc0p-20, 0x0.8b4a73f3b629b8p-21, -0x0.9a85ed746e9f78p-25, -0x0.ce8c0467309020p-24, 0x0.aee1e652b0bdd0p-24, 0x0.d7c106eb61e820p-28, -0x0.80089912681420p-25, // x=    4.25 y=     1.5
+ 0x0.c9f18b7c51ae20p-4, 0x0.e0cb038f871958p-3, -0x0.a21dd396aaeb10p-5, -0x0.8aa6723ea63688p-5, 0x0.b59d4214430758p-7, 0x0.b64124e7b41fa0p-9, -0x0.a1c5c3d8f862c8p-9, 0x0.9d27324c9712a8p-11, 0x0.dbda4060642318p-12, -0x0.cb44d2d29f17d0p-12, -0x0.9c2c13b60586c0p-15, 0x0.8237973c6d0330p-13, -0x0.83eafe02259410p-17, -0x0.efe26764cf77e8p-16, 0x0.acb8ca97e3e120p-18, 0x0.9634ae5dca3a40p-18, -0x0.d22fd52e658218p-20, -0x0.abbb4eb4bc9ff8p-23, 0x0.a77e1f839676e8p-22, -0x0.c88cc9eb326498p-23, -0x0.8014108e319b60p-25, 0x0.a86a7b32564518p-24, -0x0.d60be77eb4e618p-28, -0x0.9cf583e8786dc0p-26, // x=    4.25 y=    1.75
+ 0x0.d9e0d4576ae1c8p-4, 0x0.d6854ac88bf038p-3, -0x0.a6048ca8837b80p-5, -0x0.e9034b99eef9c0p-6, 0x0.abfaf97b6e3d18p-7, 0x0.8d76a4944cfb58p-10, -0x0.8760cdb17f8b18p-9, 0x0.f784208511ddb0p-11, 0x0.8f673d061b8e20p-12, -0x0.d718830a05f890p-12, -0x0.93bb27e7dbdb90p-20, 0x0.e20c2a872e88b8p-14, -0x0.ddc4d15e00a490p-17, -0x0.a4e49ec8e09c28p-16, 0x0.a4851d971a1e48p-18, 0x0.f1959506d19c18p-20, -0x0.93e53582c169d8p-20, 0x0.b6f1a5d7943b00p-22, 0x0.9930cc66e9f4e8p-23, -0x0.e2859d7c8a4eb0p-23, 0x0.c8be2f18744f90p-28, 0x0.ef901be98a0850p-25, // x=    4.25 y=       2
+ 0x0.e72150f7ad5710p-4, 0x0.cc1b5de4fa8d38p-3, -0x0.a6bf10efc0f890p-5, -0x0.bf976df3f25e60p-6, 0x0.9ef5d65f8704c0p-7, -0x0.a6376a6edc0940p-12, -0x0.d99cbadb706c08p-10, 0x0.975861b640eb38p-10, 0x0.9f439a52bcd648p-13, -0x0.cf812a30f0e9a8p-12, 0x0.bb1b5751843550p-16, 0x0.b55210c47a7528p-14, -0x0.f6c5e0e6c80a68p-17, -0x0.c646f67e2f5568p-17, 0x0.86017bf8ac1650p-18, 0x0.da43daf62ca1c8p-25, -0x0.b15ba0889f23b0p-21, 0x0.8da99b92bdb7a0p-21, 0x0.8f89c320de8590p-25, -0x0.bc9eb9824d7558p-23, 0x0.a6ebfb69b8b0a8p-26, 0x0.8ab953f8b7bf08p-25, // x=    4.25 y=    2.25
+ 0x0.f1e69678203508p-4, 0x0.c1bb055a4ff198p-3, -0x0.a4ebd8cda4ced0p-5, -0x0.99b08d8212b480p-6, 0x0.900bb762e046f8p-7, -0x0.b9d8d81cc79460p-10, -0x0.a7facabd123bd8p-10, 0x0.a4c4ff01c9b430p-10, 0x0.f109948e04dc90p-15, -0x0.bc255eb574d558p-12, 0x0.93e5dd215350d0p-15, 0x0.87f3c8ed068430p-14, -0x0.e8747c336153d0p-17, -0x0.c1b977b13247a8p-18, 0x0.c3957e4ddcdf70p-19, -0x0.f543aee74005c0p-21, -0x0.ada05ba90e1ca8p-22, 0x0.8e4cbb5a7743f8p-21, -0x0.ce0d0621494f58p-26, -0x0.84cf0629853e10p-23, 0x0.b1f4320761a560p-26, 0x0.fe9d9606290910p-27, // x=    4.25 y=     2.5
+ 0x0.fa6bea458a0880p-4, 0x0.b78867110336c0p-3, -0x0.a11f4139a5a930p-5, -0x0.ef41f3b7b411b0p-7, 0x0.806606945d19f0p-7, -0x0.9379e2d63a1458p-9, -0x0.f80a1f2fc42cd8p-11, 0x0.a78a5a27d4d980p-10, -0x0.bb134df9b0a9c8p-17, -0x0.a2f5efda49f940p-12, 0x0.aa0f67dd44a430p-15, 0x0.beb75bf6e6cb98p-15, -0x0.c6948e07aa26c0p-17, -0x0.d14a96a1485128p-20, 0x0.818653a04edd70p-19, -0x0.b11f072d38bd78p-20, -0x0.d7ae6a5426d650p-24, 0x0.ef6e08fc43f4a8p-22, -0x0.c6f88d255d9158p-25, -0x0.a38c20e7375148p-24, 0x0.907b4315521d60p-26, 0x0.8cdfc2fb572aa0p-28, // x=    4.25 y=    2.75
+ 0x0.8077cd86f36bf0p-3, 0x0.ad9ee2d0823ac0p-3, -0x0.9bdcf3169005b8p-5, -0x0.b2f5d0a972e268p-7, 0x0.e1bb33143542a0p-8, -0x0.bac37623131738p-9, -0x0.ad4451e3ce1248p-11, 0x0.a2d08b0142d0b0p-10, -0x0.f1ba6ca90d07f0p-15, -0x0.881d67d6d8a208p-12, 0x0.aac8a2423314d8p-15, 0x0.f77b849fd16010p-16, -0x0.9e5878001f76b8p-17, 0x0.93c0bb2e214ee8p-20, 0x0.99ed4c3d00cdd0p-20, -0x0.b8fffccdbdd078p-20, 0x0.f35f797e3af020p-26, 0x0.b4999729685a78p-22, -0x0.d18e1f6201d910p-25, -0x0.ad9a667e9a7598p-25, 0x0.c9f21d48839fd0p-27, -0x0.c0ef80b5a064a0p-30, // x=    4.25 y=       3
+ 0x0.82d7cccfeff978p-3, 0x0.a41238249c0f18p-3, -0x0.95951491598400p-5, -0x0.fc8d3353742d70p-8, 0x0.c40ba8a795c368p-8, -0x0.d5483163e960c0p-9, -0x0.df82071fdf0308p-12, 0x0.9934bb166de610p-10, -0x0.b5339b3e3ebdd8p-14, -0x0.dc8266dda87fc8p-13, 0x0.9eae24461c4450p-15, 0x0.8f8bfdcadace00p-16, -0x0.eee6752c7013c8p-18, 0x0.ad3e1f52e19608p-19, 0x0.9ba47b0245ca08p-21, -0x0.a7d941ef776230p-20, 0x0.c29401f7d39ad0p-24, 0x0.fa692716156aa8p-23, -0x0.b481ddba4355f8p-25, -0x0.902d7fa697c048p-26, 0x0.fb718db470cf38p-28, -0x0.f5fa10b7dd6b58p-29, // x=    4.25 y=    3.25
+ 0x0.8473935f23d878p-3, 0x0.9aefc33aabfa30p-3, -0x0.8ea4085c6b4050p-5, -0x0.a186123adefe80p-8, 0x0.a874b6a8c661a0p-8, -0x0.e571ca3792c788p-9, -0x0.fa623afafee360p-13, 0x0.8cbfbbd7027590p-10, -0x0.d570cbb36828d0p-14, -0x0.adbafa8f27bd08p-13, 0x0.8c0513ad9e1a78p-15, 0x0.8603ddfc46d4f8p-17, -0x0.ab584eb6c708d0p-18, 0x0.d9718095ce7bc0p-19, 0x0.d7b1d6d494f1b8p-23, -0x0.8c123518052af8p-20, 0x0.eea85aa237c9b8p-24, 0x0.a05fe4c358b210p-23, -0x0.8b05c96e835ba8p-25, -0x0.c1e34d944152c8p-29, 0x0.8b1128ad33b4d0p-28, -0x0.8713795419a028p-28, // x=    4.25 y=     3.5
+ 0x0.8566b00660f9b0p-3, 0x0.923fb03d404b78p-3, -0x0.8753b97478ffd0p-5, -0x0.a75c8a051b3340p-9, 0x0.8f590eb6871058p-8, -0x0.ed7049446de858p-9, -0x0.c2e5c7e4a4be90p-14, 0x0.fde4416fb8bc80p-11, -0x0.e1793b490995f0p-14, -0x0.853c58c8a25828p-13, 0x0.ee072b8205d4b8p-16, 0x0.d6c6b5ae46b4b8p-20, -0x0.e93b8337aaaf48p-19, 0x0.e221c0014371d8p-19, -0x0.8a71d0223dfbc8p-25, -0x0.dc807e5df8a3b8p-21, 0x0.e8aeb935d6f738p-24, 0x0.bb6507e7b708e0p-24, -0x0.c5e03d644dead0p-26, 0x0.973082386e3340p-28, 0x0.8233eb18c3da68p-29, -0x0.ece30ef89ccc48p-29, // x=    4.25 y=    3.75
+ 0x0.85ca3b5dceb8d8p-3, 0x0.8a0612aa11f518p-3, -0x0.ffbb6bcde55ad0p-6, -0x0.8de4f4b8debcd0p-11, 0x0.f1bcc9540782e0p-9, -0x0.ef29594fb8f188p-9, 0x0.9249bce5063560p-16, 0x0.e1b3b92baf8120p-11, -0x0.dfb7793ce79c18p-14, -0x0.c6a198e7089190p-14, 0x0.c48913f3800598p-16, -0x0.b04c6a5fbb1a78p-19, -0x0.9503432880f728p-19, 0x0.d5f1f3f6e4fdb0p-19, -0x0.acef21577599e8p-23, -0x0.a5c0c9cacd6340p-21, 0x0.caeebfe90a6ef8p-24, 0x0.bee8522ad88d18p-25, -0x0.83bf4ce327f9d8p-26, 0x0.fd93349769afd0p-28, 0x0.a7455cf11faaf0p-31, -0x0.b9045b9d88af70p-29, // x=    4.25 y=       4
+ 0x0.85b4b075613b00p-3, 0x0.8243d8006cfff8p-3, -0x0.f0db2ffac82398p-6, 0x0.967f0d40995f68p-10, 0x0.ca015eee5d9fa8p-9, -0x0.ec345dcf32a040p-9, 0x0.ce888213803590p-14, 0x0.c6543693932dc8p-11, -0x0.d51ed059f2eca8p-14, -0x0.8f467aae0edec0p-14, 0x0.9e765460d62990p-16, -0x0.af5d1bd6d8ce98p-18, -0x0.add6cbb9e735e0p-20, 0x0.bf05800a66d880p-19, -0x0.ec5eb9a6af80d0p-23, -0x0.ef5b67345b9448p-22, 0x0.a53a7bf55b4a00p-24, 0x0.904b7c1a71c2b8p-26, -0x0.a41c0a7084db58p-27, 0x0.886916c5f233b8p-27, -0x0.b4dadc6f958aa8p-34, -0x0.85db49abe45268p-29, // x=    4.25 y=    4.25
+ 0x0.8539efa0b03868p-3, 0x0.f5ef2738651c00p-4, -0x0.e246dac9925f78p-6, 0x0.a75cff0d5491d0p-9, 0x0.a7421d009c17e0p-9, -0x0.e5de23c4cdacd8p-9, 0x0.a36cbfd20804f0p-13, 0x0.aca2e8ccf93518p-11, -0x0.c557c470a2c140p-14, -0x0.c62f49c326e8d0p-15, 0x0.fa506a4515ac60p-17, -0x0.df0c3681647838p-18, -0x0.ab9f8caf509f68p-21, 0x0.a3eff2f228ddd8p-19, -0x0.fcf461bfe1d7a8p-23, -0x0.a6265532b5bfb8p-22, 0x0.80245877adbcf0p-24, 0x0.ba7e6c60210ea0p-33, -0x0.bc764ae2338500p-28, 0x0.f9f5e4a4541f00p-28, // x=    4.25 y=     4.5
+ 0x0.846b5c6cf2cb50p-3, 0x0.e83c4adee6aac8p-4, -0x0.d42bddd53f9318p-6, 0x0.f346daf75345b0p-9, 0x0.8921a460b43ed0p-9, -0x0.dd308e5a323d78p-9, 0x0.cbf5bb2220c2e0p-13, 0x0.9519869f9a7d78p-11, -0x0.b2fb97984f0320p-14, -0x0.81077d18970750p-15, 0x0.c1fccced9feb40p-17, -0x0.f33b9b9e51c4a0p-18, -0x0.cf367b401eb5b0p-23, 0x0.88aa9aa023e4c8p-19, -0x0.f279ccd4a4e3a0p-23, -0x0.dcddaef0c23668p-23, 0x0.bf52968d711f70p-25, -0x0.99381cf8da5608p-27, -0x0.bf6d4a18ad9900p-29, 0x0.d2450efc801820p-28, // x=    4.25 y=    4.75
+ 0x0.83580ba9c386e0p-3, 0x0.db667eafb61e88p-4, -0x0.c6a8e6474bfc00p-6, 0x0.9898ca8f995270p-8, 0x0.de655b1cca9810p-10, -0x0.d2fbe0f4160520p-9, 0x0.e5466b04d3a4f8p-13, 0x0.ffd8ddba235788p-12, -0x0.9fd00c67889fc8p-14, -0x0.97d1a55046b2d0p-16, 0x0.938f415b40e3b8p-17, -0x0.f51910284bbc18p-18, 0x0.cf9233b1f27870p-24, 0x0.deca80ebafc460p-20, -0x0.da207ba939ab78p-23, -0x0.8afc5748da47a8p-23, 0x0.8a37ba37690fd8p-25, -0x0.e17645aebf26b8p-27, -0x0.95ab996f669008p-30, 0x0.a753b9e7db3ad0p-28, // x=    4.25 y=       5
+ 0x0.820cf99afeb6b0p-3, 0x0.cf639b4b682b08p-4, -0x0.b9d12ab726ba58p-6, 0x0.b18caea679cce8p-8, 0x0.b2058b90765490p-10, -0x0.c7e034da2dd438p-9, 0x0.f30103afdc4c58p-13, 0x0.da436487251030p-12, -0x0.8cfc53f8481e68p-14, -0x0.8f7eae6739bd20p-17, 0x0.dc1eaba1422ef8p-18, -0x0.eb6695be482d80p-18, 0x0.927e4b01bdbb68p-22, 0x0.b24c6e8bb976b0p-20, -0x0.bc3b686ec2d4d8p-23, -0x0.a162fee56afec8p-24, 0x0.c19a80b80f5cc0p-26, -0x0.f66e5d06f6f6d8p-27, -0x0.c244e0b1973168p-34, 0x0.ffd935c0821c80p-29, // x=    4.25 y=    5.25
+ 0x0.809542e7f9d938p-3, 0x0.c4288f0dbc18d8p-4, -0x0.adaf2604410660p-6, 0x0.c560b26f7fc440p-8, 0x0.8c429ff995e6c8p-10, -0x0.bc564c47b2f078p-9, 0x0.f8158bdd6838c0p-13, 0x0.b94424ee897780p-12, -0x0.f6694873997710p-15, -0x0.ca2c5a5b876880p-20, 0x0.a08ed206a67b10p-18, -0x0.daf5fe98adf268p-18, 0x0.c65e782055eb08p-22, 0x0.8c7a9a6494b728p-20, -0x0.9db906cf5f8668p-23, -0x0.a1e63ff4872a68p-25, 0x0.8341815d366ca0p-26, -0x0.ee40e23107b2d8p-27, 0x0.f86e6f2fc01d40p-32, 0x0.bd84ebb939bea8p-29, // x=    4.25 y=     5.5
+ 0x0.8d0781f88366c0p-30, 0x0.801175f7571620p-2, -0x0.a310ae4757eed0p-27, -0x0.e95d78f9f58aa8p-5, 0x0.b8230d72b990f0p-25, 0x0.db127f255bc140p-7, -0x0.8724fdc5760ad8p-23, -0x0.d4a9c06285ddf8p-9, 0x0.90c0949524e080p-22, 0x0.d68e3a64783b30p-11, -0x0.f0c346860676f0p-22, -0x0.e2aae0d7542980p-13, 0x0.a1766d992160b8p-21, 0x0.fd7c886d5b11a8p-15, -0x0.b2f7747719ba68p-21, -0x0.97d4d45965fe58p-16, 0x0.a6908341a4d398p-21, 0x0.c33f4542e6f550p-18, -0x0.836bc265f85030p-21, -0x0.836b3f8b8d5048p-19, 0x0.b080c121dce020p-22, 0x0.addac8bdebc680p-21, -0x0.c944507481e0b8p-23, -0x0.ca794dbac36240p-23, 0x0.c09d5db0f3bd88p-24, 0x0.a0af7e97a7b808p-25, -0x0.964412e36dd370p-25, 0x0.a3c6a04bbab530p-29, 0x0.b1720a07529058p-27, -0x0.ee43cb614f3af8p-28, -0x0.e4242c10ec2e70p-30, 0x0.8a8bdeb9ee4748p-28, -0x0.838befd12edb68p-31, -0x0.bc3d1a78f5a198p-30, 0x0.b113f3641ed228p-32, 0x0.bf7a460c64f428p-34, // x=     4.5 y=       0
+ 0x0.ada28e52a9c320p-6, 0x0.fe3a3566450aa0p-3, -0x0.a184c82e081a60p-7, -0x0.e3d80ca1c357c0p-5, 0x0.e7f3b8f3b3c078p-9, 0x0.d00b5e5d903728p-7, -0x0.98d9618388d290p-10, -0x0.c1889e01669b50p-9, 0x0.c3bef52fc8ed10p-12, 0x0.b7264731c6b858p-11, -0x0.fa81840f3fdd90p-14, -0x0.af6a31f5c1ef68p-13, 0x0.a2b25b0a447ab8p-15, 0x0.a78dc4104af1c0p-15, -0x0.d793163210c430p-17, -0x0.9978e1498071d0p-17, 0x0.9058c460ae8f40p-18, 0x0.f0de54fdcfd3e8p-20, -0x0.be1c0191642d88p-20, -0x0.b6b2a1b00dbce8p-23, 0x0.eaa5e2508b6230p-22, -0x0.ccacde76373070p-24, -0x0.fa311494d96098p-24, 0x0.ae5f0c9b3921e0p-24, 0x0.c28cf85ad47b40p-26, -0x0.a8ccda48366ab0p-25, // x=     4.5 y=    0.25
+ 0x0.8eb0a51d281ac0p-5, 0x0.fae98c6ac32388p-3, -0x0.82a4726fc68bc0p-6, -0x0.da6f794d6f69b8p-5, 0x0.b72fbda76b32c8p-8, 0x0.bdc30c78131a18p-7, -0x0.e93ddf82f9fca8p-10, -0x0.a312ff45208338p-9, 0x0.8e277409b07328p-11, 0x0.881e0130b31160p-11, -0x0.a97327da4beeb0p-13, -0x0.d37e363bec4058p-14, 0x0.c6a9c9a00116f8p-15, 0x0.86b4d97facb070p-16, -0x0.e35701ea6681a8p-17, -0x0.e7fe4fed3833f8p-21, 0x0.f7bb7b0ffcf4d0p-19, -0x0.f10dd801069390p-21, -0x0.f39dd9c978b970p-21, 0x0.a1ae0f34781710p-21, 0x0.bd7966bd1f7168p-23, -0x0.8dc963a23b7fc8p-22, -0x0.f1a812bd3e1248p-27, 0x0.c704795ff8f608p-24, // x=     4.5 y=     0.5
+ 0x0.c3b7af28679160p-5, 0x0.f61e6d0b284a28p-3, -0x0.af1c31cf47f370p-6, -0x0.cd38949e511bd8p-5, 0x0.ed400fe33eca00p-8, 0x0.a52143e915ca88p-7, -0x0.8fd1b9dd509f40p-9, -0x0.f8bda300e9aea8p-10, 0x0.a3adc911651100p-11, 0x0.a223efbdb0da18p-12, -0x0.b14835c04295f8p-13, -0x0.8465b54cf3a7d0p-15, 0x0.b5ab70e3a1c3f0p-15, -0x0.ab7648c354b8b0p-18, -0x0.ab412853ccc980p-17, 0x0.a5db9d71c6e4f8p-18, 0x0.89efefd2aaaa20p-19, -0x0.93f79a31ee70e8p-19, -0x0.9281c4de1c0ee0p-22, 0x0.ce2b4e0df639e0p-21, -0x0.d05bdde4d1e7e0p-26, -0x0.ee0ecffc50d190p-23, 0x0.941aa59f8a85f0p-25, 0x0.db1c33f51a4340p-25, // x=     4.5 y=    0.75
+ 0x0.f50ed0b9575648p-5, 0x0.f009ad716280d0p-3, -0x0.d4e3e36be2ad98p-6, -0x0.bd18c67f0a45c8p-5, 0x0.8a113784e532b0p-7, 0x0.88b040cad404b8p-7, -0x0.9d5982c72b1b10p-9, -0x0.a5fd00bcf1d0e8p-10, 0x0.a4359cb6970900p-11, 0x0.e1cc1a9af794c0p-14, -0x0.9d4ebcb65d1800p-13, 0x0.d5c8e3bea03ab0p-16, 0x0.865d47f52cc4f0p-15, -0x0.9eb9a1c6d99058p-16, -0x0.ba420b763f70a8p-18, 0x0.f924510c9134a0p-18, 0x0.85a0d43c28f100p-21, -0x0.99eb9b02e20230p-19, 0x0.9f783b00b60290p-23, 0x0.9c754c69f7fc58p-21, -0x0.e332f47592c770p-24, -0x0.f476fa66e605c8p-24, 0x0.a5d14f4c85db68p-25, 0x0.c78dfa31662330p-27, // x=     4.5 y=       1
+ 0x0.910d4304951720p-4, 0x0.e8e3c6669475a8p-3, -0x0.f357a2d8ca3a98p-6, -0x0.ab05fce7722688p-5, 0x0.95df9b37b21130p-7, 0x0.d5c6c049491f20p-8, -0x0.9eb0b54f0237b0p-9, -0x0.ae4befad8e37c0p-11, 0x0.95117e95f2edc8p-11, -0x0.fa5744a861ca78p-15, -0x0.f3d1d9ffc78818p-14, 0x0.8569f18023dc98p-14, 0x0.9e15b4d4cfc758p-16, -0x0.d0d269265e3b58p-16, -0x0.c48a843a707a20p-20, 0x0.f576521469e930p-18, -0x0.8727af794b4188p-21, -0x0.e86a1f25b3e678p-20, 0x0.a8766af16836f0p-22, 0x0.a5523c41dccf90p-22, -0x0.e13597278f5eb0p-24, -0x0.d516017e7249b0p-26, 0x0.d62c05bed1f400p-26, -0x0.97791fa8f112d8p-27, // x=     4.5 y=    1.25
+ 0x0.a53df248e94260p-4, 0x0.e0e7fa207ec180p-3, -0x0.85324e9e6b7888p-5, -0x0.97eb2d07074d58p-5, 0x0.9aba777dcaabf8p-7, 0x0.9b8c3bffab1cc0p-8, -0x0.9688a3cbabda10p-9, -0x0.93c42296a366a8p-13, 0x0.f930b04e0e2528p-12, -0x0.be1ddea69fc9b0p-13, -0x0.a453bcb802f508p-14, 0x0.adc009160cc840p-14, 0x0.f32dcca39de1a8p-18, -0x0.d07078124aaa88p-16, 0x0.ab0ec5662b57d8p-20, 0x0.c28f56bcb754f0p-18, -0x0.f99be752b93638p-21, -0x0.87932ed66d7d30p-20, 0x0.a5345560af4808p-22, 0x0.b7776d51ef0018p-24, -0x0.984147d0176398p-24, 0x0.c5783cd3417120p-26, 0x0.b41034fa40df90p-27, -0x0.ee9e5897246038p-27, // x=     4.5 y=     1.5
+ 0x0.b705a996178d60p-4, 0x0.d850435f62c320p-3, -0x0.8d34cec1ea4860p-5, -0x0.84959429bffdb0p-5, 0x0.99c1cd1991e158p-7, 0x0.cb5c36f24307a8p-9, -0x0.87efaa22c5c028p-9, 0x0.935c0be96b9708p-12, 0x0.c0db4514fd6988p-12, -0x0.86b03b5004c760p-12, -0x0.b670c5365e0588p-15, 0x0.b6596e34a6e3a0p-14, -0x0.a2b7cdeb27b298p-20, -0x0.b2194a237ef6f0p-16, 0x0.b23e46d422c8e0p-19, 0x0.819342e8bd4dd8p-18, -0x0.808e34499f0e78p-20, -0x0.d7f7fe8003b928p-22, 0x0.f34720aa7c3f00p-23, -0x0.c414f12fb3f908p-25, -0x0.970caa2c8ce490p-25, 0x0.a1776429a2c828p-25, // x=     4.5 y=    1.75
+ 0x0.c667db78c02f70p-4, 0x0.cf525884754ec0p-3, -0x0.92097b6e1932c0p-5, -0x0.e355e8443e34e8p-6, 0x0.9443748cc84e40p-7, 0x0.d82daabe0566b8p-10, -0x0.eb74ea81562d10p-10, 0x0.9c1616fa5238a0p-11, 0x0.89712133c63180p-12, -0x0.99909b1c14cd00p-12, -0x0.81123a8ad68ba8p-16, 0x0.a999f497fcac80p-14, -0x0.d601874a1345d8p-18, -0x0.876fea4bd91700p-16, 0x0.cac50456046830p-19, 0x0.8cfce5a2affd20p-19, -0x0.d232dd1b9df848p-21, 0x0.8b8972297261b0p-29, 0x0.903b7c642536b8p-23, -0x0.d50864ee8e6b50p-24, -0x0.a8c265661929b8p-27, 0x0.92f51e8c234e10p-25, // x=     4.5 y=       2
+ 0x0.d37a12d5a6d310p-4, 0x0.c61dc935ad2390p-3, -0x0.941c6d74b49d20p-5, -0x0.bf4e4e55003cd8p-6, 0x0.8b895e2e15a170p-7, 0x0.d8ba218479d980p-12, -0x0.c4699c1d42b1f8p-10, 0x0.d424ec2efae968p-11, 0x0.b0256439c6fcd8p-13, -0x0.9c922f9085fd08p-12, 0x0.a5472c079e9b10p-18, 0x0.91162dc2d0c090p-14, -0x0.93f726abe8f7e8p-17, -0x0.b8bbba77ec7d50p-17, 0x0.ba3d59d9a55c88p-19, 0x0.ce3f4391c5c738p-21, -0x0.930980186aef60p-21, 0x0.e891a4b5cc85f0p-23, 0x0.821dd7cdf27c88p-24, -0x0.dfeb26722bd280p-24, 0x0.8837cc3596edd8p-28, 0x0.d1132e23e52390p-26, // x=     4.5 y=    2.25
+ 0x0.de5ed5729d6648p-4, 0x0.bcdb120f17db60p-3, -0x0.93e1f18b6ae598p-5, -0x0.9dbd79b9611988p-6, 0x0.80ba89f1109f18p-7, -0x0.9d412c6d91f090p-11, -0x0.9e1385d13bb980p-10, 0x0.f596acbc1d7640p-11, 0x0.bcddf0b0b44db8p-14, -0x0.94b133edfb6040p-12, 0x0.971b9dccc9fac0p-16, 0x0.e841cf34a75c90p-15, -0x0.9ca9532e0c8d80p-17, -0x0.dd47faaa0d4050p-18, 0x0.96c1ac5ee0bb78p-19, -0x0.de54000febc2b8p-24, -0x0.b1ae59f9cd49e0p-22, 0x0.9debd015a55eb0p-22, 0x0.d7604969093208p-27, -0x0.b93dac0c527740p-24, 0x0.9fc6d494cc9810p-27, 0x0.f7198200038c00p-27, // x=     4.5 y=     2.5
+ 0x0.e7410cf3186390p-4, 0x0.b3ab6e9455b228p-3, -0x0.91cc803d903060p-5, -0x0.fe11bf5b1177c0p-7, 0x0.e997ad68ac54c0p-8, -0x0.b7a88be1816128p-10, -0x0.f538c35e57d2d8p-11, 0x0.8270cfba82dba0p-10, 0x0.f71c6bf65280e8p-16, -0x0.863f380afa9d50p-12, 0x0.d389f5cc98d528p-16, 0x0.af201c6e566a88p-15, -0x0.91abe635b03820p-17, -0x0.d5b06d3c1d3720p-19, 0x0.dddc323cc9f130p-20, -0x0.9e411ece2a3638p-21, -0x0.b07106e5bc6860p-23, 0x0.9b7e8ebb460c28p-22, -0x0.e61ea6a2de5fa0p-27, -0x0.8475698eff6b60p-24, 0x0.a80d2352e999f8p-27, 0x0.eaff59406f48b8p-28, // x=     4.5 y=    2.75
+ 0x0.ee50348dcf26e8p-4, 0x0.aaa92f1830bcd8p-3, -0x0.8e4632e2b5de88p-5, -0x0.c6befb99c75cc0p-7, 0x0.d0f86d6638b7e8p-8, -0x0.83c8a727c18b30p-9, -0x0.b66f805bc95b38p-11, 0x0.8339b50022c1b8p-10, -0x0.fae1c90d09f110p-17, -0x0.e92d7906cbfd48p-13, 0x0.eb76f118b7e798p-16, 0x0.f8759cd6290088p-16, -0x0.f98790959b7e10p-18, -0x0.d053f0ca6e9830p-21, 0x0.9587634bdfeed0p-20, -0x0.d5fc1f0210a340p-21, -0x0.de6cc98a071b00p-25, 0x0.83b9f48e570c70p-22, -0x0.cdc6f60cbe36d0p-26, -0x0.a7c7c177f3f8b8p-25, 0x0.8b1742f19a1d00p-27, 0x0.8c5f7bff07f298p-29, // x=     4.5 y=       3
+ 0x0.f3bd5c1c52a6b0p-4, 0x0.a1e85f5f86ae80p-3, -0x0.89ad18f8c4a420p-5, -0x0.958e0f1e70a470p-7, 0x0.b8aff421c8f718p-8, -0x0.a0d07bb50d20a8p-9, -0x0.80c4607e0d3488p-11, 0x0.fe42174831f6c8p-11, -0x0.bea2a19d0afda0p-15, -0x0.c431ee608c4b30p-13, 0x0.eaa9b43310d180p-16, 0x0.a3e5b8ba815038p-16, -0x0.c93068fd015db0p-18, 0x0.d0828521fc1148p-21, 0x0.b66e14e2592368p-21, -0x0.ddfdab65a56728p-21, 0x0.8472fcb2c5e2e8p-26, 0x0.ca7f1eb0be1ce0p-23, -0x0.da6b8d599c14f0p-26, -0x0.b9b226ff4915b8p-26, 0x0.c8b0f55be0ad20p-28, -0x0.97ceee88bb9240p-31, // x=     4.5 y=    3.25
+ 0x0.f7b8f47e866c48p-4, 0x0.997795c5553360p-3, -0x0.8451b3ca100188p-5, -0x0.d49ef155b5a278p-8, 0x0.a17f8975370720p-8, -0x0.b4a47d34dc5fe8p-9, -0x0.a86eae8f3eb9e8p-12, 0x0.ef9aadd03ebb08p-11, -0x0.87ae87ae4d78e8p-14, -0x0.a0a1a5581e53f8p-13, 0x0.daaffe6d40d460p-16, 0x0.c2bb15a9a3d450p-17, -0x0.9a5658fc6e69f0p-18, 0x0.dff84c9ea71b58p-20, 0x0.c02671122ee6b8p-22, -0x0.cb52e8b97bd9f8p-21, 0x0.d53641ef9c8c20p-25, 0x0.902911658609c8p-23, -0x0.c06ee5fe7ef578p-26, -0x0.a5ec77c41553c8p-27, 0x0.8230cbfe334fc0p-28, -0x0.e5f2357a533ea0p-30, // x=     4.5 y=     3.5
+ 0x0.fa714a43c45c38p-4, 0x0.9160ce0afdfe48p-3, -0x0.fcedd521ddbf50p-6, -0x0.8959315f13dbf0p-8, 0x0.8be1a365d39ba0p-8, -0x0.c0edaaf62db3f0p-9, -0x0.c0ba33b45a97b8p-13, 0x0.dd17bd9edda2a0p-11, -0x0.9de74279e439a0p-14, -0x0.80457e1ea57000p-13, 0x0.c2a5757e5185a0p-16, 0x0.bdb9ae52897720p-18, -0x0.e2363702f84b20p-19, 0x0.8c20404d371378p-19, 0x0.928034e0bda280p-23, -0x0.ac8763d122cf90p-21, 0x0.85d039fda463a0p-24, 0x0.bf09b46022d7b8p-24, -0x0.988c4517d5e4c0p-26, -0x0.9b52eff11c0378p-29, 0x0.97f876e22478d0p-29, -0x0.85048325854a80p-29, // x=     4.5 y=    3.75
+ 0x0.fc118e0733a648p-4, 0x0.89aa3cf1eabd70p-3, -0x0.f0a5d0abf23150p-6, -0x0.90dd5e88abe670p-9, 0x0.f03441ffc73cb0p-9, -0x0.c72f81185bef08p-9, -0x0.9ded5da847ec78p-14, 0x0.c8aeb39b537da0p-11, -0x0.a6cca3e46caa48p-14, -0x0.c7ee5808b536c0p-14, 0x0.a77440d50ce6b8p-16, 0x0.ba163c5ee0cf30p-20, -0x0.9e23b067ba0228p-19, 0x0.93291993f6e838p-19, -0x0.afc5eff76eb798p-28, -0x0.8aab5f0100c708p-21, 0x0.85cb6f819212f0p-24, 0x0.e9794a75b4bcf8p-25, -0x0.e069dce3b43c38p-27, 0x0.f90e95103f9108p-30, // x=     4.5 y=       4
+ 0x0.fcc14a49ead690p-4, 0x0.8257118b6fd590p-3, -0x0.e420f08e5c9d00p-6, -0x0.875f2be02bc4b8p-11, 0x0.cc896358d7fde8p-9, -0x0.c8bd74aa194be0p-9, 0x0.8a270a8a15bd38p-17, 0x0.b3c7dfbad2d018p-11, -0x0.a65bb354018790p-14, -0x0.97e10d406930b8p-14, 0x0.8c44368f7e7ec8p-16, -0x0.cc7e6622a814e0p-20, -0x0.d126a814b984c8p-20, 0x0.8d3b849228adb0p-19, -0x0.bc24f3dfd18c70p-24, -0x0.d5910857442550p-22, 0x0.ef958fe2f362d8p-25, 0x0.feac36bd8ec978p-26, -0x0.9b3b99c7c680c8p-27, 0x0.fdb561462865d0p-29, // x=     4.5 y=    4.25
+ 0x0.fca42a15a350f8p-4, 0x0.f6d03daac67038p-4, -0x0.d7a12b71ec7b90p-6, 0x0.f1484764991800p-11, 0x0.acc1974f14c100p-9, -0x0.c6b8006df129f0p-9, 0x0.949525c35de340p-14, 0x0.9f598b8ee33420p-11, -0x0.9fb9c671aa5690p-14, -0x0.e022ec90437f40p-15, 0x0.e5ddc3292bbd20p-17, -0x0.e3382e32941de8p-19, -0x0.802116df3e65a8p-20, 0x0.802eafd406ed30p-19, -0x0.8a9e8ad0032060p-23, -0x0.9e74f330efd690p-22, 0x0.c86c1b48947278p-25, 0x0.dfb03c8dd16960p-27, -0x0.ca4f4b992553f0p-28, 0x0.91c906fd818b90p-28, // x=     4.5 y=     4.5
+ 0x0.fbd9f87d3a2728p-4, 0x0.e9b8d81657dac8p-4, -0x0.cb57feb20553c0p-6, 0x0.8b8955def8f048p-9, 0x0.90b642b27dc9f8p-9, -0x0.c20e62d36aeb60p-9, 0x0.f3e7f154f69a30p-14, 0x0.8c01d021d66f20p-11, -0x0.95492ea881b620p-14, -0x0.9f8172f4d2dcd8p-15, 0x0.b8c994057c69b8p-17, -0x0.95f5b1ae243ee0p-18, -0x0.8a092aa8348e68p-21, 0x0.dfe8bd969f7900p-20, -0x0.9a5d820836ef18p-23, -0x0.e2ebddc474b9a0p-23, 0x0.9fd73cfcfe4550p-25, 0x0.ac4cecc852ce20p-29, -0x0.f6538ea89be0e8p-29, 0x0.8bbf7d11130290p-28, // x=     4.5 y=    4.75
+ 0x0.fa7ec60631bc40p-4, 0x0.dd6358e8638ba8p-4, -0x0.bf6961ad3ed670p-6, 0x0.cd9d83b09af648p-9, 0x0.f0534059ef4bc8p-10, -0x0.bb82f95e2dce38p-9, 0x0.9b231ba3708a78p-13, 0x0.f43a2e98140290p-12, -0x0.88c8050c95f2f0p-14, -0x0.d7fa1b05f40c08p-16, 0x0.91faf7d8d73440p-17, -0x0.a78fa1a03717b8p-18, -0x0.db629e45dace00p-23, 0x0.be1b1276f84b20p-20, -0x0.98801529c3e3f0p-23, -0x0.9c75813a154978p-23, 0x0.f5b18161a1a1c8p-26, -0x0.fa8b2490cf3d18p-29, -0x0.8887c1f40aea20p-29, 0x0.f405d1da005460p-29, // x=     4.5 y=       5
+ 0x0.f8ab258e6f0ca8p-4, 0x0.d1c9419cc5af70p-4, -0x0.b3ee6840d85c00p-6, 0x0.821dd9d4d0e3d8p-8, 0x0.c5a28a825294c0p-10, -0x0.b3b0cfa4eab3e0p-9, 0x0.b0e03c1f994c00p-13, 0x0.d3b12d0f49c400p-12, -0x0.f6e18b80c18dd8p-15, -0x0.873ca6a25c69d8p-16, 0x0.e2ca42cf7989a8p-18, -0x0.ac35ea963c51c8p-18, 0x0.aecf51fad08fc0p-28, 0x0.9de66d761a2de8p-20, -0x0.8cd0075b1c1888p-23, -0x0.ce3e1b0509e970p-24, 0x0.b709721c735a90p-26, -0x0.eb2d358225af00p-28, -0x0.802315874c4d80p-30, 0x0.c8e883a99bda58p-29, // x=     4.5 y=    5.25
+ 0x0.d1e263a4fd0830p-34, 0x0.f25ba591a476e8p-3, -0x0.ffcbe9711461f8p-31, -0x0.d04798aad74358p-5, 0x0.9898b8b25477a0p-28, 0x0.b7b9c7e91e32a0p-7, -0x0.ed4fad12686a10p-27, -0x0.a6c8ca62e5c3d0p-9, 0x0.871301ec125058p-25, 0x0.9c5775fb4ea018p-11, -0x0.efa9e5a418c558p-25, -0x0.980b88fc0d2f00p-13, 0x0.ac36df98ad9628p-24, 0x0.9a78852a07b2d8p-15, -0x0.cda1dfc68f8348p-24, -0x0.a58f4f20c93bb8p-17, 0x0.cf8f90cee415f8p-24, 0x0.bd388d17a43448p-19, -0x0.b32955bae06ca0p-24, -0x0.e74cd84d6c0050p-21, 0x0.852b9844a242b8p-24, 0x0.94482a9d4639a0p-22, -0x0.aaecd568871728p-25, -0x0.bd4a398ce821e0p-24, 0x0.bcf80d704ab7d8p-26, 0x0.dbc5af83109dd8p-26, -0x0.b240a729703378p-27, -0x0.c173f25b697e18p-28, 0x0.8c9b40caf191d8p-28, 0x0.9437855e0aac20p-32, -0x0.b0cb995fcf3af0p-30, 0x0.a54dde3d1efa50p-31, 0x0.f1099bd4dc2350p-33, -0x0.e644b2b4e37000p-32, 0x0.cad564ce4cd5a8p-35, 0x0.da7ebc20447f10p-34, // x=    4.75 y=       0
+ 0x0.9b1e7b740179c0p-6, 0x0.f0c1543eb5d8d0p-3, -0x0.87c27465969c40p-7, -0x0.cbf0a353fdbb88p-5, 0x0.b6b82e24fab3f8p-9, 0x0.afa818a08eb610p-7, -0x0.e09fc67839c8b8p-11, -0x0.99db2830961b70p-9, 0x0.856172ad4dcb30p-12, 0x0.88f5f80bccb8a8p-11, -0x0.9d380cec11c098p-14, -0x0.f7425fe56128b0p-14, 0x0.baee15c50e5e60p-16, 0x0.e0e11ff5b9d340p-16, -0x0.e2600bf98654d0p-18, -0x0.caaf299b82cd00p-18, 0x0.8bed1a9cd8c198p-19, 0x0.ad75712e95a730p-20, -0x0.aefdd1a22fd240p-21, -0x0.f89273b011fa10p-23, 0x0.d81099b0e63c38p-23, 0x0.8a8da2bc47a528p-26, -0x0.fc5d296909f2c8p-25, 0x0.f1492a19967b28p-27, 0x0.82f8202d815a88p-26, -0x0.af0036473e6d58p-27, // x=    4.75 y=    0.25
+ 0x0.ff5ebf6a148440p-6, 0x0.edf6a876beadf0p-3, -0x0.dc726b4daa7c18p-7, -0x0.c48041342277f8p-5, 0x0.915f52883fd100p-8, 0x0.a221f31d3fd1f8p-7, -0x0.adae74eb864e78p-10, -0x0.84db65c1add918p-9, 0x0.c645e1522bb858p-12, 0x0.d5b120932b61d0p-12, -0x0.dd469d70e158a0p-14, -0x0.a47ffc1eede820p-14, 0x0.f3c0fb8db9e098p-16, 0x0.e3e97881492c78p-17, -0x0.848e7f9a0bac80p-17, -0x0.e4080c56dfc268p-20, 0x0.8ce40f421398d0p-19, -0x0.c36b1fcba858b0p-24, -0x0.8e9be6912d0638p-21, 0x0.c6288a15a5c9d8p-23, 0x0.82183c41989f50p-23, -0x0.ccb854d7c68ff0p-24, -0x0.bc0893d99165b0p-26, 0x0.9efdb8db540668p-25, // x=    4.75 y=     0.5
+ 0x0.af8d19b2d73338p-5, 0x0.e9e88e07ad6e68p-3, -0x0.9487b0b3e85d18p-6, -0x0.b9f5ef9f2d9130p-5, 0x0.be339ac33a8570p-8, 0x0.8fa0555ff84ba0p-7, -0x0.da0b46006e3120p-10, -0x0.d2ed1ced9ecb20p-10, 0x0.eb3221ca8a3710p-12, 0x0.8c163e8e09c718p-12, -0x0.f2ec89956013e8p-14, -0x0.900c55ca0dce40p-15, 0x0.f099980771c698p-16, 0x0.8e028bd2f93d70p-21, -0x0.e189c5f5ddde68p-18, 0x0.ffb658b3c356f8p-20, 0x0.c109546ff02c80p-20, -0x0.840dd4d56977e0p-20, -0x0.894911372b3608p-22, 0x0.c2cc44a1303fd0p-22, 0x0.d836a4c3ccf938p-26, -0x0.f10af44f031c78p-24, 0x0.d49cfb37f12d08p-28, 0x0.fe4d5e7601bdf0p-26, // x=    4.75 y=    0.75
+ 0x0.dc75ae4ebb4df8p-5, 0x0.e4bbbeff279a28p-3, -0x0.b5c3590e7b9978p-6, -0x0.acf4408af71120p-5, 0x0.e01d9141e02728p-8, 0x0.f3ad0607dc8990p-8, -0x0.f3aaeda650a6e0p-10, -0x0.9671f6973cae00p-10, 0x0.f45598324a9528p-12, 0x0.835f1573c211f0p-13, -0x0.e419b8779f1cb0p-14, 0x0.ab2de29f67aa10p-18, 0x0.c395a5e6ea6328p-16, -0x0.9b6de6797b51f0p-17, -0x0.92dbf7977021a8p-18, 0x0.849b7e72cf5690p-18, 0x0.a591b709cf3f08p-21, -0x0.aa62be13bd17d8p-20, -0x0.de6a688c4b2ae8p-27, 0x0.b80fd7261e8088p-22, -0x0.904bf83ee2d780p-25, -0x0.a65a704840da08p-24, 0x0.8b6cef5345fe98p-26, 0x0.e46d15248ab1a0p-27, // x=    4.75 y=       1
+ 0x0.82f0cd77772d10p-4, 0x0.de9b84ed31d9f0p-3, -0x0.d151e0d0df2320p-6, -0x0.9e2f09ae70d178p-5, 0x0.f6aa5df2b35b88p-8, 0x0.c4fc3069bfecf8p-8, -0x0.fba0b5c60fca90p-10, -0x0.b551fe9e7e6f88p-11, 0x0.e6bb3e9b926870p-12, 0x0.829d75408de1d0p-24, -0x0.bd379a89b481b8p-14, 0x0.90bbf0912136b8p-15, 0x0.840465c66a8a78p-16, -0x0.f750ce04a01fd8p-17, -0x0.81b39aa91b3cb0p-19, 0x0.96ac9cc8276b30p-18, -0x0.97cb789dfce8c8p-25, -0x0.96bc7155d91a78p-20, 0x0.85cf54f2341470p-23, 0x0.f683806b049850p-23, -0x0.dc557d9c109cd0p-25, -0x0.8fe25c46fc71d8p-25, 0x0.f7c63070bdc278p-27, 0x0.e5002005b7f598p-31, // x=    4.75 y=    1.25
+ 0x0.95bb3b7a1716a0p-4, 0x0.d7b64f2e0e23e8p-3, -0x0.e70204ec14cd20p-6, -0x0.8e58721886b178p-5, 0x0.813aee8da69960p-7, 0x0.963c9bf947c1c0p-8, -0x0.f4e00ca9d6bff8p-10, -0x0.9179f44ee7a1a0p-12, 0x0.c9a67c1d686628p-12, -0x0.cdcdcc87bff280p-14, -0x0.8b71a26507f6d0p-14, 0x0.db93f2db61b110p-15, 0x0.8995f6c3133198p-17, -0x0.89183a0e6d4478p-16, -0x0.d7b2d5b5dee158p-27, 0x0.86298eb105f970p-18, -0x0.dc6a641f2462c8p-22, -0x0.d1f4f95b326578p-21, 0x0.b14b329bb52910p-23, 0x0.e5ea82fc85d290p-24, -0x0.bd55adbd333b98p-25, -0x0.de997569ea12d8p-30, 0x0.935218fa195ef0p-27, -0x0.ab2a8bb8726aa0p-28, // x=    4.75 y=     1.5
+ 0x0.a68250857531a8p-4, 0x0.d03aa9e82d4790p-3, -0x0.f6fa5b1f8c2df0p-6, -0x0.fc253b853c0250p-6, 0x0.826ad5144c29c8p-7, 0x0.d3acee1a092758p-9, -0x0.e33ada28ce4758p-10, 0x0.97cc718f5ee518p-14, 0x0.a4646866afa700p-12, -0x0.ae2f3704f58ab0p-13, -0x0.b2877fad478888p-15, 0x0.fad8acb190bb30p-15, 0x0.8828500859d910p-19, -0x0.ff31d3492874c0p-17, 0x0.9f47c5af7fa070p-20, 0x0.ca21932f2db228p-19, -0x0.9168ba0c709980p-21, -0x0.e3ded01fd8b988p-22, 0x0.9d088308713308p-23, 0x0.8acf8928ed4b60p-26, -0x0.f24c1d26613290p-26, 0x0.f3fe6cd83498d0p-27, // x=    4.75 y=    1.75
+ 0x0.b54102e2b7e5d8p-4, 0x0.c854d79303b7b0p-3, -0x0.80d16781c2cf88p-5, -0x0.dbcd9eceea8640p-6, 0x0.ff82d0ba65cb18p-8, 0x0.82ed0c00ac18f0p-9, -0x0.ca91aca507bdf0p-10, 0x0.b69cc4949979d0p-12, 0x0.f9f8bca77da7c0p-13, -0x0.d7ce62df069570p-13, -0x0.b545a86d7cc1a8p-16, 0x0.f906731c8396c8p-15, -0x0.99e7bd2e54f7f0p-19, -0x0.d2e52e57c83cf0p-17, 0x0.e90f66e1d78ef8p-20, 0x0.820793759fa9d8p-19, -0x0.89dde54d3db418p-21, -0x0.97c12090d2d4f0p-23, 0x0.dedceeac246888p-24, -0x0.961fe6534e9538p-25, -0x0.e5025eb19a0a18p-27, 0x0.9c4b19baa959f0p-26, // x=    4.75 y=       2
+ 0x0.c201a9bd32c0b8p-4, 0x0.c02d233a07da40p-3, -0x0.83c6d09ac87b58p-5, -0x0.bc8313aebb1880p-6, 0x0.f451f0c56d5698p-8, 0x0.f0c8a05931edb8p-11, -0x0.ae4e58d9e62e98p-10, 0x0.90525ba8f71cf8p-11, 0x0.af5feba4c88a18p-13, -0x0.e8cbf24bbeddc8p-13, -0x0.ab75decbfe4180p-18, 0x0.e1bb316fc9eba0p-15, -0x0.a268b9120c1738p-18, -0x0.9dcd0ceb26b9a0p-17, 0x0.f42bef27666c30p-20, 0x0.8759b2ceac0968p-20, -0x0.db3e5308524408p-22, 0x0.b55a1252da6220p-25, 0x0.81c1a913437278p-24, -0x0.e94d961749f7a8p-25, -0x0.d14226e5fc68e0p-29, 0x0.87b515487387d0p-26, // x=    4.75 y=    2.25
+ 0x0.ccda5c66d53040p-4, 0x0.b7e6e1b5f3c010p-3, -0x0.84b185e83e6c00p-5, -0x0.9ee518d553c590p-6, 0x0.e5001b343fd578p-8, 0x0.9ca63a219a4590p-18, -0x0.91241611a49c68p-10, 0x0.b3c65c71a32ce0p-11, 0x0.dc1ec0d14c1cf0p-14, -0x0.e745b6833a96a0p-13, 0x0.dfefc5ee12a020p-18, 0x0.bf1cde3d7853d8p-15, -0x0.c814e7a8a8eef0p-18, -0x0.d5817b84106e50p-18, 0x0.da4bc30b20f938p-20, 0x0.a9d7bb53671b10p-22, -0x0.98680d1c34a1f8p-22, 0x0.9400ea570f4280p-23, 0x0.e3c951f05e65d8p-26, -0x0.e814035dfbc268p-25, 0x0.af27f44373fc10p-29, 0x0.c040ced4edb478p-27, // x=    4.75 y=     2.5
+ 0x0.d5e97d4d2dbdb8p-4, 0x0.afa0059ae8a2d0p-3, -0x0.83e88a76155358p-5, -0x0.835eb6178ff1f0p-6, 0x0.d314151b6c7800p-8, -0x0.c32b1fad977c28p-11, -0x0.ea05b87cd87e28p-11, 0x0.c8520ff1015568p-11, 0x0.e13942d100bb48p-15, -0x0.d928f744bfe5a0p-13, 0x0.ee7ba3fa154310p-17, 0x0.98ca15d4a2ead8p-15, -0x0.cc47dfbda54058p-18, -0x0.fdf63bc596c200p-19, 0x0.afcf10a1e49430p-20, -0x0.9210d663517770p-23, -0x0.b8dfaf65454e88p-23, 0x0.b6f734b85392f0p-23, 0x0.942636f7ddcf40p-28, -0x0.be903c5af48230p-25, 0x0.a20ce4f80685c0p-28, 0x0.e64e0a5414af18p-28, // x=    4.75 y=    2.75
+ 0x0.dd52aebd95ca40p-4, 0x0.a771226f2d2e10p-3, -0x0.81bff2957f6818p-5, -0x0.d45c9ab1ee29c0p-7, 0x0.bfd04214fbb358p-8, -0x0.af7ae4158a00d0p-10, -0x0.b653a8e61319e8p-11, 0x0.d0eb99ed8a6668p-11, 0x0.e6c0f802131c08p-17, -0x0.c382acd7e57270p-13, 0x0.99b18c7681bf30p-16, 0x0.e78fd4ac970608p-16, -0x0.bc00c035da0880p-18, -0x0.f063453ce191d0p-20, 0x0.8236c902e773a8p-20, -0x0.d136d5e9725a30p-22, -0x0.b8eb0b92261880p-24, 0x0.b0e5f7af671128p-23, -0x0.87aa4531e57538p-27, -0x0.89ca634f2b8930p-25, 0x0.a73de564ccca78p-28, 0x0.e0a7e6948f24f0p-29, // x=    4.75 y=       3
+ 0x0.e33c4e73cc8d50p-4, 0x0.9f6dbc4a3cf9e8p-3, -0x0.fd0a3bfb4ccfc8p-6, -0x0.a6dcc79572b188p-7, 0x0.ac306736cad040p-8, -0x0.eb131657d01660p-10, -0x0.8890b5d55ad4c0p-11, 0x0.d072759aa29d78p-11, -0x0.83f765c5669a58p-16, -0x0.aa3ed5e44beea0p-13, 0x0.a6b817e3f0e468p-16, 0x0.a5dc572bd42a48p-16, -0x0.a1588b537d4040p-18, -0x0.c610def66ed158p-22, 0x0.b211af69fb2a20p-21, -0x0.85d57917e816e8p-21, -0x0.e810a5c7d4bcd8p-26, 0x0.967d792b841080p-23, -0x0.dfd43b90ca64a8p-27, -0x0.b27c542ad77350p-26, 0x0.8c21d66f00a840p-28, 0x0.8cf9def19e34c0p-30, // x=    4.75 y=    3.25
+ 0x0.e7cd7d2d4df5b8p-4, 0x0.97a4c5cea2d898p-3, -0x0.f4f94115fb5c18p-6, -0x0.fc78c834147de0p-8, 0x0.98eecc9afbe048p-8, -0x0.8b5b742f74ebe0p-9, -0x0.c2897cbc194a00p-12, 0x0.c9759e75024940p-11, -0x0.97e73329c5f7d8p-15, -0x0.902cc34f535fc0p-13, 0x0.a507f2a5004de0p-16, 0x0.ddee84504993b8p-17, -0x0.834ab6551cf6e0p-18, 0x0.977f04109d0138p-21, 0x0.de091c9102ae28p-22, -0x0.89b5f88f77ca70p-21, 0x0.9ec06e2c990e30p-27, 0x0.eacf1af32e49f8p-24, -0x0.edadc3014468a0p-27, -0x0.cc54bb81527210p-27, 0x0.cf4534ba4634a8p-29, -0x0.838c6a6697f828p-32, // x=    4.75 y=     3.5
+ 0x0.eb2ca895746518p-4, 0x0.902134f2117f60p-3, -0x0.ebc2dc247e8cf8p-6, -0x0.b4a52b3ffd6978p-8, 0x0.868d33d86772a0p-8, -0x0.9a6a2e69260298p-9, -0x0.80c6ebb252a2b0p-12, 0x0.be19bd33dbb510p-11, -0x0.cf0818bcf49be0p-15, -0x0.ee4d603adc25b8p-14, 0x0.9a1f56b6122890p-16, 0x0.86898afa36b5b0p-17, -0x0.cc503fedfcf638p-19, 0x0.9599a0d840de98p-20, 0x0.f1d30ebe669b80p-23, -0x0.fde86f318b8bc8p-22, 0x0.f4ac69e7474da0p-26, 0x0.aadd91cb79ca70p-24, -0x0.d4deb81db62ad0p-27, -0x0.c1490132558ac8p-28, 0x0.8b0ac0c83ec648p-29, -0x0.e279e355ace968p-31, // x=    4.75 y=    3.75
+ 0x0.ed7e8606ff8308p-4, 0x0.88ea9d900dc008p-3, -0x0.e1c9cbed617420p-6, -0x0.eb703e05959560p-9, 0x0.eabe5072df42c0p-9, -0x0.a3e0ec0ea6cd50p-9, -0x0.960cf00edfe960p-13, 0x0.b01482886f7760p-11, -0x0.ee27163483bc18p-15, -0x0.c08bd23cb51270p-14, 0x0.8a2704d291c100p-16, 0x0.87c10f9e15a3e8p-18, -0x0.98828c2d1a2778p-19, 0x0.b9e591d78710e0p-20, 0x0.c633609ad57030p-24, -0x0.da5999b91a5520p-22, 0x0.9ba83f25fd52a8p-25, 0x0.e8f315a6520480p-25, -0x0.aca92519ab4c28p-27, -0x0.dbf4b757b95c70p-30, // x=    4.75 y=       4
+ 0x0.eee569c47c8bc0p-4, 0x0.8205c67585b5f8p-3, -0x0.d75ed8cc6988f0p-6, -0x0.fc2aca156d8718p-10, 0x0.cb283485a2ca00p-9, -0x0.a8d1acdac4c7a0p-9, -0x0.80367dc6323a18p-14, 0x0.a0b46fcc250e30p-11, -0x0.fb51a2a5144180p-15, -0x0.982c833ef82e10p-14, 0x0.f02259aa711020p-17, 0x0.98ceec48916aa8p-20, -0x0.da2a08175f7bb8p-20, 0x0.c47f4b24c357d0p-20, 0x0.9d5f7dec029620p-28, -0x0.b29659b64dac58p-22, 0x0.9eb311af4e99e8p-25, 0x0.93bb84d4c86ba0p-25, -0x0.82a0cb4b3490c8p-27, 0x0.c970bc42388870p-31, // x=    4.75 y=    4.25
+ 0x0.ef80e6945a7128p-4, 0x0.f6ea64340dd448p-4, -0x0.ccc2a513c78e68p-6, -0x0.fe55952fff7540p-12, 0x0.ae80d93858dc40p-9, -0x0.aa2e83bca344f8p-9, 0x0.c50bb2eacb0020p-19, 0x0.90eec098027db8p-11, -0x0.fb9e195484eb08p-15, -0x0.eb09906fe7ce58p-15, 0x0.cba2d3a672da90p-17, -0x0.f0386bfd690158p-21, -0x0.94848684c29b88p-20, 0x0.bebbaf93d5f028p-20, -0x0.d1983cc35a5230p-25, -0x0.8c5d72ccb5eb98p-22, 0x0.913549da7b4030p-25, 0x0.aa135429330158p-26, -0x0.ba9ad265c0e948p-28, 0x0.82a3e5672b0050p-29, // x=    4.75 y=     4.5
+ 0x0.ef6da3b6134b30p-4, 0x0.ea732f2696a2b0p-4, -0x0.c227c1dbfdab08p-6, 0x0.c3a42d914ee218p-11, 0x0.94ca294a53cb28p-9, -0x0.a8c773d8476978p-9, 0x0.d95d79341c2620p-15, 0x0.816f557f2a9148p-11, -0x0.f322fa5a025600p-15, -0x0.b0db62c5938b28p-15, 0x0.a93275ff744258p-17, -0x0.96553fd2345e58p-19, -0x0.bd5fe982ca2478p-21, 0x0.af7e889ea87908p-20, -0x0.a69787ac183930p-24, -0x0.d52edb1e310d70p-23, 0x0.f89913489b2fd8p-26, 0x0.a58609de0a4720p-27, -0x0.fc84d6a1ecbb18p-29, 0x0.a00cbd5b57a9c8p-29, // x=    4.75 y=    4.75
+ 0x0.eec559f1a0fdf0p-4, 0x0.dea4954031cf50p-4, -0x0.b7b4cc878c7b38p-6, 0x0.eaf1c900e735e0p-10, 0x0.fbd6fb092f0388p-10, -0x0.a54b4042edc018p-9, 0x0.b8b9ea953aa648p-14, 0x0.e5505d4c3aa430p-12, -0x0.e50a8f8fbc4f90p-15, -0x0.80efe52d8c1700p-15, 0x0.8a1d19db16d050p-17, -0x0.cd7b88e1cf6678p-19, -0x0.d9bef596efb960p-22, 0x0.9b9800871a2fa8p-20, -0x0.c0852687ad3e40p-24, -0x0.9cb99eb6d4a680p-23, 0x0.cb1647c48e7960p-26, 0x0.c9e1436e7962e8p-29, -0x0.a115ab3788c178p-29, 0x0.9fd6ced1825110p-29, // x=    4.75 y=       5
+ 0x0.89d3abe1aaf910p-37, 0x0.e6050ca9c6c498p-3, -0x0.b0973439230f08p-34, -0x0.bb2066ab9ea1e0p-5, 0x0.ddf31d8a279398p-32, 0x0.9bc76e21c7ad48p-7, -0x0.b6395c63a05eb0p-30, -0x0.84f699fc622c10p-9, 0x0.db9a4c8702ee80p-29, 0x0.e948729961b2a8p-12, -0x0.ceded200698880p-28, -0x0.d2fd924b388538p-14, 0x0.9e66ccffcaeb30p-27, 0x0.c597af254e8328p-16, -0x0.ca64699c4e66a0p-27, -0x0.c0ccae39802918p-18, 0x0.dbb6f40c310558p-27, 0x0.c5ba40515af940p-20, -0x0.cd41289eea6650p-27, -0x0.d73fd5fcc90dd8p-22, 0x0.a67166f7f23d58p-27, 0x0.f9cb534335fa48p-24, -0x0.eb8d54af18ee80p-28, -0x0.986f8474568fd8p-25, 0x0.91b7d076e97708p-28, 0x0.bbc29525847720p-27, -0x0.9d4233609a1f78p-29, -0x0.d8f4fdd25432d0p-29, 0x0.93227825704740p-30, 0x0.cef7a3c3ab7218p-31, -0x0.eec70896818730p-32, -0x0.c76fa9df1567e0p-34, 0x0.97d6b8d11858e0p-33, -0x0.e49979757cc0e0p-35, -0x0.d18fef4ca04548p-37, 0x0.8eefba887bbc68p-35, // x=       5 y=       0
+ 0x0.8b797a39bf9690p-6, 0x0.e4a8d615e692a8p-3, -0x0.e6a08132115dc0p-8, -0x0.b7a936d25e7b58p-5, 0x0.922a1184fe6840p-9, 0x0.95bd9ab38af7c8p-7, -0x0.a89b28eb0c6750p-11, -0x0.f7e45110cb68d8p-10, 0x0.bb0f5da8151ff0p-13, 0x0.d044c30b9a3288p-12, -0x0.cce4100dd50b08p-15, -0x0.b169a172e236c8p-14, 0x0.e105836d4997a8p-17, 0x0.98c6c301994330p-16, -0x0.fa635a523f5198p-19, -0x0.8405e8205c12f0p-18, 0x0.8e1118590bf2f8p-20, 0x0.e0ebc2d93c7518p-21, -0x0.a4936ed8d3ae58p-22, -0x0.b484ecbe580ab8p-23, 0x0.c1186095490b88p-24, 0x0.ee4a74f7ff9e48p-26, -0x0.e0a75970c39ed0p-26, -0x0.863485b99dfc70p-29, // x=       5 y=    0.25
+ 0x0.e5ed690403a358p-6, 0x0.e248de8bfd0208p-3, -0x0.bbd185e2866bf8p-7, -0x0.b1b16588d0bf98p-5, 0x0.e9edf92b7f0e90p-9, 0x0.8b89ac627b3a80p-7, -0x0.83b1c8a8d1e1c0p-10, -0x0.da30ec16acd560p-10, 0x0.8d693cf811ffe8p-12, 0x0.a878e893bf3660p-12, -0x0.9441072608d998p-14, -0x0.fcebf8ab4cfb90p-15, 0x0.997e1966e73550p-16, 0x0.b259d3a9eb7590p-17, -0x0.9d993af055a030p-18, -0x0.d7603c19052c48p-20, 0x0.a011c7e891d9e0p-20, 0x0.8dfc4ae9f3cda0p-23, -0x0.9eff41661ea788p-22, 0x0.ad54f0329449f8p-25, 0x0.96805571fa20c8p-24, -0x0.84419b24843068p-25, -0x0.8133b7724770f0p-26, 0x0.e39f3e6ab969b8p-27, // x=       5 y=     0.5
+ 0x0.9e5f0336464378p-5, 0x0.ded27bc91c25c8p-3, -0x0.fe31f9b22cacb8p-7, -0x0.a92d784f4628e8p-5, 0x0.9a49db852cb050p-8, 0x0.fad040868602c0p-8, -0x0.a7ab98813bcaa8p-10, -0x0.b2ab161f61ad60p-10, 0x0.aba4984c54d060p-12, 0x0.ec87d2df451a40p-13, -0x0.a8cf96cdbc55c0p-14, -0x0.8532506acd4338p-15, 0x0.a06a00a86d8648p-16, 0x0.aa49d84bed4de0p-19, -0x0.92933c1e5552f0p-18, 0x0.9ae0a1da5a69f8p-21, 0x0.fcf658d5acdf30p-21, -0x0.e06f9956e8f058p-22, -0x0.c55a4ea43482f8p-23, 0x0.b0cd0eb8397a70p-23, 0x0.f6da621fdd1f28p-26, -0x0.e3a45f6a8e0d18p-25, -0x0.ff0bb848021ca0p-30, 0x0.ffa852777923f0p-27, // x=       5 y=    0.75
+ 0x0.c760d68f282650p-5, 0x0.da61bef41d4d70p-3, -0x0.9c61c14ca79fb0p-6, -0x0.9e92d75594e338p-5, 0x0.b7a3b427ef1a38p-8, 0x0.d904840a210428p-8, -0x0.be9d04270f5dd0p-10, -0x0.85ec3735d2ed28p-10, 0x0.b7584d17caf300p-12, 0x0.82e4bddd198d10p-13, -0x0.a5b2e5e881bc90p-14, -0x0.99433dcd83f288p-18, 0x0.8c113a154961a0p-16, -0x0.8c2e51846371e8p-18, -0x0.d7f1a6ebecec00p-19, 0x0.89ef7cd1ddb8f0p-19, 0x0.8d5a3a77062fc0p-21, -0x0.b79eccaf3d5cd0p-21, -0x0.ef0709bd3f6e28p-25, 0x0.ccb467e646cd58p-23, -0x0.b8ba50ea878fb8p-28, -0x0.c5ecbe74feac50p-25, 0x0.c2c3ef83979bb8p-28, 0x0.a1b6e576a1a938p-27, // x=       5 y=       1
+ 0x0.ed86f64974a4b8p-5, 0x0.d5183f30236a58p-3, -0x0.b5394abecc0d38p-6, -0x0.9266a37a75f340p-5, 0x0.cc75c3b8a07558p-8, 0x0.b42363b1d8f2a8p-8, -0x0.c8b9e8069f92a8p-10, -0x0.b0b65688c4ba00p-11, 0x0.b2c8b582d224e0p-12, 0x0.8454e002fb7e58p-15, -0x0.90fd7905801dc8p-14, 0x0.920ee64b3666b8p-16, 0x0.d0638e475dff90p-17, -0x0.8fd801c62397f8p-17, -0x0.f1f59a456bb418p-20, 0x0.b532aed096c890p-19, 0x0.8e73ca03e13a50p-23, -0x0.baeae0e19a4608p-21, 0x0.9dd6ef2cc9ea00p-25, 0x0.a3ba246ef48928p-23, -0x0.bf4b7e6b912378p-26, -0x0.e91a855e297b08p-26, 0x0.f9d7fbf5826c20p-28, 0x0.d912703c8a8178p-29, // x=       5 y=    1.25
+ 0x0.883f043b9ac400p-4, 0x0.cf1aacdaa27470p-3, -0x0.c9621f57499070p-6, -0x0.8530aa023bc5b8p-5, 0x0.d8f29ca6aec6d8p-8, 0x0.8e736abea246f0p-8, -0x0.c793955e2fad38p-10, -0x0.b62f65ea8fde50p-12, 0x0.a20d53015a9f68p-12, -0x0.c111dacf3b19a0p-15, -0x0.e491dace759490p-15, 0x0.881d63dd0dbba8p-15, 0x0.8040e4d5ce1338p-17, -0x0.b17501f62f0c38p-17, -0x0.8f7d1d58720fe8p-21, 0x0.b2f79d4ba08780p-19, -0x0.99651af79b0c60p-23, -0x0.951645d1ca6a00p-21, 0x0.adbc13956bd370p-24, 0x0.c477b26288a008p-24, -0x0.d3635a33cce2e0p-26, -0x0.9b852782da18b0p-27, // x=       5 y=     1.5
+ 0x0.9809ebb36d0640p-4, 0x0.c88e8f50978ba0p-3, -0x0.d8e1f44ab3a338p-6, -0x0.eee176498062f0p-6, 0x0.ddde5d9d4f4820p-8, 0x0.d3b56e003380b8p-9, -0x0.bd8493f33ec7f0p-10, -0x0.feaac07d02ed00p-15, 0x0.89c3fd0420ae28p-12, -0x0.da476e225c2780p-14, -0x0.a0f1f4e7ae4640p-15, 0x0.aa37a2729807f8p-15, 0x0.df57a883292ee8p-19, -0x0.b2b6217b6116a8p-17, 0x0.ce121ca36cc7d8p-22, 0x0.94f45f03475f98p-19, -0x0.9822b67b187db8p-22, -0x0.c1b01c6047b5d8p-22, 0x0.bb0b6d10769658p-24, 0x0.9950a767af7170p-25, -0x0.a51750c61a4290p-26, 0x0.c3eead38ea70a0p-29, // x=       5 y=    1.75
+ 0x0.a61a29bfdd0938p-4, 0x0.c19860d6db9f18p-3, -0x0.e3f3d3313b5818p-6, -0x0.d32e898598df50p-6, 0x0.dc583c83dc9070p-8, 0x0.8f8cd6f384d660p-9, -0x0.ad28b7f5aa6290p-10, 0x0.b87a8e83897f40p-13, 0x0.dc412a5a1b6138p-13, -0x0.9546a9250c8670p-13, -0x0.c26135ca7ee090p-16, 0x0.b4082a2aad8d50p-15, -0x0.f08fea1b39ef20p-26, -0x0.9eb538863e4728p-17, 0x0.f675bb82b8c7c8p-21, 0x0.d76d1810db2ef0p-20, -0x0.aa03f67fa90998p-22, -0x0.c0844dee6f9068p-23, 0x0.9a888e2db383b0p-24, -0x0.caa11a5591d5e0p-29, -0x0.c8ac9310aa23b0p-27, 0x0.8dfe03ab2425b8p-27, // x=       5 y=       2
+ 0x0.b2729394932558p-4, 0x0.ba5a219d93d7a8p-3, -0x0.eaf8a5679ef7f0p-6, -0x0.b8027775d92508p-6, 0x0.d5a896a379a578p-8, 0x0.a4a202573ad598p-10, -0x0.98f8a2b41700f0p-10, 0x0.bc698b7958cd78p-12, 0x0.a4da48746f1b80p-13, -0x0.aaeaea7bf5b668p-13, -0x0.acfd10a8f4d338p-17, 0x0.ac2a4ab981c778p-15, -0x0.9a02655cc4a770p-19, -0x0.ffe788638ea140p-18, 0x0.97d50309a712c8p-20, 0x0.85ccc2eddb03d8p-20, -0x0.9858bb700d2e68p-22, -0x0.b5a71b3144d1d0p-25, 0x0.d47ba4031657a8p-25, -0x0.cabf2a60f44d68p-26, -0x0.b1a0d9d3de9660p-28, 0x0.9cf02015848570p-27, // x=       5 y=    2.25
+ 0x0.bd20513c7f45d8p-4, 0x0.b2f264ae3524c8p-3, -0x0.ee687e1baa2628p-6, -0x0.9deda8b908cf60p-6, 0x0.cb1999d84f2fb0p-8, 0x0.e84992d0a925d0p-12, -0x0.830dc529d93f28p-10, 0x0.80e9f5729bd630p-11, 0x0.e399e9dd495cb8p-14, -0x0.b197106ffbac50p-13, -0x0.c7074b565ee3a0p-22, 0x0.993a2c018dc1e0p-15, -0x0.f01072640b15d0p-19, -0x0.bced43f9accda8p-18, 0x0.967b32b43957f0p-20, 0x0.837760c3103a48p-21, -0x0.ed13a747184c68p-23, 0x0.be7fed1eaed170p-25, 0x0.f22017012d5208p-26, -0x0.833b388aee7358p-25, -0x0.d528d0d3d3d3f0p-31, 0x0.834c88befaaf90p-27, // x=       5 y=     2.5
+ 0x0.c6384db97891b0p-4, 0x0.ab7bca896263f0p-3, -0x0.eec60e04a15f58p-6, -0x0.85589aa0eb6610p-6, 0x0.bddc518ccff1e8p-8, -0x0.ff69c286613068p-13, -0x0.da123731250858p-11, 0x0.97afabcc9c6c48p-11, 0x0.8b4f718680b810p-14, -0x0.ad2b02537cad30p-13, 0x0.df482898bc21e0p-18, 0x0.80c5a8d9ae8b68p-15, -0x0.892ce9a39782b8p-18, -0x0.fd7a236ee488e0p-19, 0x0.83d9acfdab3ad0p-20, 0x0.fb33f4900fa038p-24, -0x0.a3c91786dc6eb8p-23, 0x0.bdafe5053d5190p-24, 0x0.cbae0397656e48p-27, -0x0.fa4f205921c0d0p-26, 0x0.dbbb5acd0540c8p-30, 0x0.b8fe2bbbf69d00p-28, // x=       5 y=    2.75
+ 0x0.cdd4d77f7e7c98p-4, 0x0.a40cd53cddc040p-3, -0x0.ec94dd87f26808p-6, -0x0.dd102fcfe81678p-7, 0x0.aef91a9796fee0p-8, -0x0.d37f632ab86960p-11, -0x0.b0251a1eebfec8p-11, 0x0.a4682af277c328p-11, 0x0.85d6babbc0a668p-15, -0x0.a1450e9e9722e0p-13, 0x0.ba6fe37d392c80p-17, 0x0.cdd190cd7ea9c0p-16, -0x0.8851b533a4c998p-18, -0x0.95410c4a203780p-19, 0x0.d38c3de82ac058p-21, -0x0.876fe099a8ac68p-23, -0x0.c6e0a379032fc8p-24, 0x0.daeaec889dbf28p-24, 0x0.9c6d84c8f01138p-30, -0x0.cc147b5a527958p-26, 0x0.ac2b145ddc77a8p-29, 0x0.df933be4a4ee88p-29, // x=       5 y=       3
+ 0x0.d41390ca13dc40p-4, 0x0.9cb7ff4ceced88p-3, -0x0.e8525623342b30p-6, -0x0.b34595d31d37f8p-7, 0x0.9f4925df6a7780p-8, -0x0.a47c7c39c7b178p-10, -0x0.89cdb74507ba98p-11, 0x0.a9143aa13a7d60p-11, 0x0.a65889a66505a0p-18, -0x0.90f0d2fb844c20p-13, 0x0.e28c2c972e6c38p-17, 0x0.9cacb3fe9ad680p-16, -0x0.f8e68ddb0251b8p-19, -0x0.893af491b22ba0p-20, 0x0.9d8ac76ccf6160p-21, -0x0.8d0a23dc470b28p-22, -0x0.c737e9caafbb20p-25, 0x0.d0573406979220p-24, -0x0.a5f924c2699158p-28, -0x0.94cdcdd6883560p-26, 0x0.ae20435c1a26f0p-29, 0x0.ddfd9c675d7ba8p-30, // x=       5 y=    3.25
+ 0x0.d913bd39dbd940p-4, 0x0.958c000c41c040p-3, -0x0.e2714b7d503d28p-6, -0x0.8d6e64e112f6d0p-7, 0x0.8f765c8b65d498p-8, -0x0.d1a6c3b0a8bad0p-10, -0x0.cfb091e2be31a8p-12, 0x0.a79cc566453218p-11, -0x0.fcc45e6d863070p-17, -0x0.fd178f7f61a5f8p-14, 0x0.f0bbbf8ae06470p-17, 0x0.e258300dc8eb00p-17, -0x0.d5fd8c0be3d270p-19, -0x0.a956b82be9b0f0p-23, 0x0.da0f8d8bc89a40p-22, -0x0.ac644916e31680p-22, -0x0.f474d3e1574968p-27, 0x0.b1b4fd8bd7de58p-24, -0x0.fe06e07b08a6c0p-28, -0x0.c448633de087e0p-27, 0x0.930808f67eb350p-29, 0x0.8f884049c43900p-31, // x=       5 y=     3.5
+ 0x0.dcf4ed59c2abb8p-4, 0x0.8e942b37fca4e8p-3, -0x0.db578bd0fd9100p-6, -0x0.d705530c47a6b0p-8, 0x0.fffe75a11b7060p-9, -0x0.f2f498e52c7af0p-10, -0x0.951e1849777198p-12, 0x0.a1b3badebd00d0p-11, -0x0.f4444290f525b8p-16, -0x0.d79673736115f8p-14, 0x0.ece9169c36acb8p-17, 0x0.994ab712f63cf0p-17, -0x0.af80bc84b6ba80p-19, 0x0.e08fc0bad748a0p-22, 0x0.8a79041667a0b0p-22, -0x0.afe4fbbbb86138p-22, 0x0.cc25d541d13360p-28, 0x0.8c50d7ce728dd8p-24, -0x0.863ef086661460p-27, -0x0.e6f8811b4195f0p-28, // x=       5 y=    3.75
+ 0x0.dfd600a761cfc8p-4, 0x0.87d8dda0da7e30p-3, -0x0.d35cf75655beb0p-6, -0x0.9abf483ca9fd80p-8, 0x0.e27973f3072160p-9, -0x0.8512e1a7c38ee8p-9, -0x0.c7866e9e8eb0a8p-13, 0x0.98c63c71acbb68p-11, -0x0.a07ec5e069dcc0p-15, -0x0.b3a734500f75b0p-14, 0x0.dd999b3a0b2f08p-17, 0x0.bd1cd11820fa60p-18, -0x0.8a3b9f7550cdc8p-19, 0x0.cd763d87a969a0p-21, 0x0.9b16c4ab82b920p-23, -0x0.a2e2caeb0b1268p-22, 0x0.922c688d6cbb48p-26, 0x0.cffdbe42f91430p-25, -0x0.f362919ec459d0p-28, -0x0.e4c2deb9cd1bd8p-29, // x=       5 y=       4
+ 0x0.e1d47283efe818p-4, 0x0.815fec8a59f458p-3, -0x0.cacba94cd35bf8p-6, -0x0.cb415a817a5580p-9, 0x0.c6d1e0d9657ea8p-9, -0x0.8c740d3e048a98p-9, -0x0.ec2bfd92c56210p-14, 0x0.8dfa6715e42f00p-11, -0x0.b69e8f9e4a4920p-15, -0x0.92ac32af6d4960p-14, 0x0.c7cfcc50213e50p-17, 0x0.c481dcb5443300p-19, -0x0.d1ac82bd05eaa8p-20, 0x0.fcf5cbf2b4ba20p-21, 0x0.868edf3cad7ec0p-24, -0x0.8d9a20a7355450p-22, 0x0.bb22a4241927a8p-26, 0x0.913c177eea5be0p-25, -0x0.c9439d2189c728p-28, -0x0.9472cb9dc5f900p-30, // x=       5 y=    4.25
+ 0x0.e30be4f23c1920p-4, 0x0.f65a218f113b90p-4, -0x0.c1e0d11e2269d8p-6, -0x0.dca35e20477b70p-10, 0x0.ad4b15e15a8028p-9, -0x0.9063575476f7e8p-9, -0x0.d0f48415cd5380p-15, 0x0.823419275d1438p-11, -0x0.c0688702fe5e98p-15, -0x0.eab7ab4c9e5d18p-15, 0x0.af2acc6b2a4ad0p-17, 0x0.f4b796760d6c88p-21, -0x0.98f5c85b601cd8p-20, 0x0.863a7d23dd6f58p-20, 0x0.f7e55e40bb4008p-28, -0x0.eb0f8491695918p-23, 0x0.c1a570a2628bc0p-26, 0x0.be0ef1724fa0a8p-26, -0x0.9bdbdd4f946810p-28, 0x0.998b286a416dd8p-32, // x=       5 y=     4.5
+ 0x0.e395dc43a9f308p-4, 0x0.ea8492a216d5c8p-4, -0x0.b8cdf024bd5b70p-6, -0x0.ecb24e87a3ce30p-12, 0x0.960345926d7160p-9, -0x0.9190845b1cd898p-9, -0x0.9836e63d0ee518p-24, 0x0.ec3a9a8b0ef008p-12, -0x0.c12ee65f0cffa0p-15, -0x0.b7e751d67cb058p-15, 0x0.962141d46bdb88p-17, -0x0.8e449631a0a8d0p-21, -0x0.d57ea0cee4dcc8p-21, 0x0.8378548e5290d8p-20, -0x0.ee80f2bf014a60p-26, -0x0.bc03e958a73db8p-23, 0x0.b4640ad1978548p-26, 0x0.e49ff083bbb600p-27, -0x0.e4c931ba0b7720p-29, 0x0.8a1544d60169a0p-30, // x=       5 y=    4.75
+ 0x0.9fbf0ca2334c20p-41, 0x0.dae6ecacfd9fa8p-3, -0x0.d6a8b8f9f4ee50p-38, -0x0.a91b208962f750p-5, 0x0.8dba601567c2e8p-35, 0x0.855870b9f5cad8p-7, -0x0.f4fc39c69a5df8p-34, -0x0.d6f9e95ff17058p-10, 0x0.9bbdd0d0194040p-32, 0x0.b177812806ca18p-12, -0x0.9b2c3d95c69b18p-31, -0x0.965de78bcac7e8p-14, 0x0.fc0fa0defaf830p-31, 0x0.83239fe9b3b820p-16, -0x0.ab611bdef96cc8p-30, -0x0.ec5b1e823d6d80p-19, 0x0.c6c8895983ab50p-30, 0x0.dd4cc4ae6c5a50p-21, -0x0.c759f330d65e50p-30, -0x0.d8f1e9e3e90308p-23, 0x0.ae8bc9498587a8p-30, 0x0.e0b42b8ca87550p-25, -0x0.865558e17ec5f0p-30, -0x0.f7465f92a82f58p-27, 0x0.b67feb11247690p-31, 0x0.8f6ddb32443448p-28, -0x0.db28a7a982bb40p-32, -0x0.aa1406ab1adc68p-30, 0x0.e82d4c2c79af08p-33, 0x0.c28ca518cba510p-32, -0x0.d7f88d56ce2380p-34, -0x0.c39bbef37de578p-34, 0x0.b213882ffeb090p-35, 0x0.87b4f361918fe0p-36, -0x0.f2b4b52df6df60p-37, 0x0.aa5dd3fb288ae0p-39, 0x0.eabe2aeea1f670p-40, -0x0.be955cc9c928f8p-39, // x=    5.25 y=       0
+ 0x0.fc40221729eca0p-7, 0x0.d9bca40078e230p-3, -0x0.c5b37ce6b02a78p-8, -0x0.a64cf1f36f0090p-5, 0x0.ecf6953d482588p-10, 0x0.80bdb955857100p-7, -0x0.80ddae12c3ba80p-11, -0x0.ca12e74458a7b0p-10, 0x0.86585f6e101fa0p-13, 0x0.a0c2c20d6b38d0p-12, -0x0.89b6be90d15f20p-15, -0x0.8192d95f0300f8p-14, 0x0.8cde2a0f6c8518p-17, 0x0.d34c1fb62a5c50p-17, -0x0.9139d69cad8380p-19, -0x0.adab123f2b1038p-19, 0x0.97fddafe75ea10p-21, 0x0.8ebcadbeb0a358p-21, -0x0.a23f59bc605278p-23, -0x0.e6490ca234b610p-24, 0x0.b0c52a4c4be6a0p-25, 0x0.ae141ee1150280p-26, -0x0.c29e5cbee7f460p-27, -0x0.e55e401dcd5310p-29, // x=    5.25 y=    0.25
+ 0x0.d0283a9d7e9018p-6, 0x0.d7b2d0cc2746d0p-3, -0x0.a1689c470f9158p-7, -0x0.a1739667d12518p-5, 0x0.be836afdaec180p-9, 0x0.f1d2ed440bd610p-8, -0x0.caeb63b0a5fe18p-11, -0x0.b49aeea6a2dca0p-10, 0x0.cdc3c31ce9d878p-13, 0x0.85bd39ad6025c8p-12, -0x0.cb69cfcd033900p-15, -0x0.c254e7a1375610p-15, 0x0.c670d4f22a5160p-17, 0x0.87ab974a3f00d0p-17, -0x0.c032434d88b768p-19, -0x0.ad8be49f0a9060p-20, 0x0.b90eff294e8dd8p-21, 0x0.af64628ae5d430p-23, -0x0.b07251404799b8p-23, -0x0.f1d0a4dbc14420p-29, 0x0.a4a5926b248a58p-25, -0x0.8f5e50ebfb7118p-27, -0x0.9302f71f31df00p-27, 0x0.959a81340b3ed8p-28, // x=    5.25 y=     0.5
+ 0x0.8f9cc53dce1d40p-5, 0x0.d4b7b0240b7f88p-3, -0x0.db3ddd705cf640p-7, -0x0.9a7e4eb4e044f8p-5, 0x0.fcfd772ea91508p-9, 0x0.dbed7764de53b0p-8, -0x0.82a477e11a87a8p-10, -0x0.9797809edcde48p-10, 0x0.fe5215c66c9e18p-13, 0x0.c5a17a9d851520p-13, -0x0.ee404459693a50p-15, -0x0.e698d07797d0f0p-16, 0x0.d892fc18bc79d8p-17, 0x0.c8f00888327fe8p-19, -0x0.bf0088f62c79b0p-19, 0x0.f5fbe8b2041480p-26, 0x0.a20566eeee8120p-21, -0x0.b08f30c2b42540p-23, -0x0.815066676fb6c0p-23, 0x0.9c15c21e12bc70p-24, 0x0.b86cc520188340p-26, -0x0.cfa1cd7152fd30p-26, -0x0.cb379b1b9e1890p-29, 0x0.efb35652919de8p-28, // x=    5.25 y=    0.75
+ 0x0.b52d6d32c88758p-5, 0x0.d0e104bc144958p-3, -0x0.877e568a6a3628p-6, -0x0.91c360c474a7b8p-5, 0x0.97d274218d6c28p-8, 0x0.c1692eebecf528p-8, -0x0.969eae0361ed70p-10, -0x0.ec25d92112b328p-11, 0x0.8aeb9952bc9ce0p-12, 0x0.f39bfce7e5b758p-14, -0x0.f23f362ca81c98p-15, -0x0.9125e753b05360p-17, 0x0.c7db14b8c75508p-17, -0x0.d194958bf0cc90p-20, -0x0.99f41fbd88de80p-19, 0x0.8bb52ee9c779c8p-20, 0x0.d553a0e4423d70p-22, -0x0.c2f3e1b468e258p-22, -0x0.eecbc139ff43e0p-25, 0x0.dd60a6435b6ac0p-24, 0x0.f00a28d90b5800p-29, -0x0.dc9e40031bd878p-26, 0x0.c3b2ceacdbff18p-30, 0x0.c2313bd57eea68p-28, // x=    5.25 y=       1
+ 0x0.d860f576c11258p-5, 0x0.cc492d19192380p-3, -0x0.9ddabd510dfd78p-6, -0x0.87a695b8950f40p-5, 0x0.aaaecbaa3c8f00p-8, 0x0.a408941bb21160p-8, -0x0.a13764c1ecb158p-10, -0x0.a63421e17fcc28p-11, 0x0.8b156f3cbb45a8p-12, 0x0.c35f529e380ea8p-15, -0x0.dd373558954530p-15, 0x0.fd7987bb4a2998p-18, 0x0.9fe83596e79400p-17, -0x0.a402d693ed0248p-18, -0x0.c7c2ee888186a0p-20, 0x0.d73ef25745f408p-20, 0x0.b4d8c4015d3898p-23, -0x0.e23b8469e40e40p-22, 0x0.d8e4658c143e30p-31, 0x0.cd1654922d33a0p-24, -0x0.8d6105497dc178p-27, -0x0.9fd376818f70f8p-26, // x=    5.25 y=    1.25
+ 0x0.f8ebeda257e5f8p-5, 0x0.c70d6576b4ee08p-3, -0x0.b074271401a358p-6, -0x0.f9205d75959a40p-6, 0x0.b70f7b9f179e00p-8, 0x0.857e288b7d5890p-8, -0x0.a3399b612208c8p-10, -0x0.c53ddfbf6799e8p-12, 0x0.81ed238feb3ca0p-12, -0x0.ebf841bad730a0p-17, -0x0.b7cc297ee50f80p-15, 0x0.a4c7d332d06ca0p-16, 0x0.dbb1a5bae7d8a0p-18, -0x0.e32889fffeb280p-18, -0x0.b5f5be88b3cb88p-21, 0x0.ea1d9be16c5600p-20, -0x0.9526d0b6438668p-26, -0x0.c9e59505d05618p-22, 0x0.98b7767c41a5e0p-25, 0x0.91ad6f759b2fb0p-24, -0x0.da101b80fbb240p-27, -0x0.9fa87a3b733ab0p-27, // x=    5.25 y=     1.5
+ 0x0.8b4e575c2307c8p-4, 0x0.c14c18849aea70p-3, -0x0.bf3dccefbad578p-6, -0x0.e1ca19e7aa81a8p-6, 0x0.bd5f7e1681a4d8p-8, 0x0.ce8b3acedbae30p-9, -0x0.9e141ceafee9a8p-10, -0x0.9566e749f3dcb8p-13, 0x0.e4a8137ef6eae8p-13, -0x0.827cdffb4caaf0p-14, -0x0.8ac5b8b06204b8p-15, 0x0.e4578efd690ce0p-16, 0x0.f1d82eca592170p-19, -0x0.f6a790209dfec0p-18, -0x0.a4fcc37bb7e628p-26, 0x0.d4320518628890p-20, -0x0.8fef6c98bad588p-23, -0x0.9519394a53fff0p-22, 0x0.d0fb668f7c32b0p-25, 0x0.9ba60466999c30p-25, -0x0.cc8c55e5e34d18p-27, -0x0.e814ed6d07dc40p-30, // x=    5.25 y=    1.75
+ 0x0.98acdd5666c3c8p-4, 0x0.bb236593661b88p-3, -0x0.ca55afefb33b28p-6, -0x0.ca019136b28b10p-6, 0x0.be571eea339ce0p-8, 0x0.951aae415d67d0p-9, -0x0.93832366e364a0p-10, 0x0.f1cf9dd07f7a30p-15, 0x0.be4cb06c3f0d78p-13, -0x0.cae48650e65618p-14, -0x0.baac7f426dcb58p-16, 0x0.80b210feac9a38p-15, 0x0.94f7af44095588p-20, -0x0.e9a2140a753e80p-18, 0x0.e4cc6c9a959ba0p-22, 0x0.a815d17e6f23d0p-20, -0x0.c6788d29c2d120p-23, -0x0.b4f2e8675cf318p-23, 0x0.c7af05ee992f80p-25, 0x0.b080707a092898p-27, -0x0.948c38b7f6c930p-27, 0x0.c5dbda01d77540p-29, // x=    5.25 y=       2
+ 0x0.a48f734cb615e8p-4, 0x0.b4aff2cc40ea28p-3, -0x0.d1fa5390f2eba8p-6, -0x0.b263de44e49650p-6, 0x0.bada105289d7d0p-8, 0x0.c0bbac88646498p-10, -0x0.8548f2bcf9a830p-10, 0x0.e672df5b01f818p-13, 0x0.95a7c6f26b6680p-13, -0x0.f81cd0c5c3da78p-14, -0x0.d19c6240741178p-17, 0x0.8179c1f43ff6c0p-15, -0x0.c9a6429c12ce70p-21, -0x0.c8aa91add44178p-18, 0x0.b290d5a8e04670p-21, 0x0.ea9bbe334b9c28p-21, -0x0.c8f2a14f195908p-23, -0x0.9f907c376fe208p-24, 0x0.9cbfd250237f10p-25, -0x0.e63b5538ee1980p-28, -0x0.ab60e3f8f3fae8p-28, 0x0.a1fe856517aee0p-28, // x=    5.25 y=    2.25
+ 0x0.aefcead68f83b8p-4, 0x0.ae0c1344e60f90p-3, -0x0.d68048bc5c9240p-6, -0x0.9b707bb4a15308p-6, 0x0.b3da5b80302560p-8, 0x0.c597b644b43988p-11, -0x0.e9f95b0571ea08p-11, 0x0.b41e01d3e8fe30p-12, 0x0.dcc33e8792edc0p-14, -0x0.86f3987fd5a180p-13, -0x0.95230381a97138p-18, 0x0.f1369310f16570p-16, -0x0.83e71e4acff048p-19, -0x0.9eb775975d9f50p-18, 0x0.c6d82834f49aa8p-21, 0x0.8c473a163fc250p-21, -0x0.acf28337b270f0p-23, -0x0.c7494957ec7200p-28, 0x0.d18be19132c018p-26, -0x0.82f6d13749e0c8p-26, -0x0.8a75f23be80858p-29, 0x0.a2b77a21aff878p-28, // x=    5.25 y=     2.5
+ 0x0.b8031c2bd668a0p-4, 0x0.a74f3d74a36a70p-3, -0x0.d848b067a672e8p-6, -0x0.8588ec14bb7410p-6, 0x0.aa427308a86590p-8, 0x0.8b823a29634770p-13, -0x0.c7de72767cd9d8p-11, 0x0.e23d938b956958p-12, 0x0.95c24c410ad1e8p-14, -0x0.888d03f9a5fce0p-13, 0x0.e209e5e2e93990p-20, 0x0.d3d8021d546af8p-16, -0x0.afc95071099f30p-19, -0x0.e7a73255a5a608p-19, 0x0.bd8514917579f0p-21, 0x0.fef436670b4dc8p-23, -0x0.8446843cf58230p-23, 0x0.9c98ff9d5dbbd0p-25, 0x0.e8c0934d7e5f68p-27, -0x0.97490898cc6838p-26, -0x0.e929f995cde928p-35, 0x0.84366fe19dc7b8p-28, // x=    5.25 y=    2.75
+ 0x0.bfb513a8036000p-4, 0x0.a08dc769074038p-3, -0x0.d7b95ab5269618p-6, -0x0.e1e54f4cac7c90p-7, 0x0.9ee6b417519000p-8, -0x0.ccaead04777b80p-12, -0x0.a643e5133cb358p-11, 0x0.ffd914aa6d2948p-12, 0x0.b1d3f6b923b860p-15, -0x0.8357ca57575208p-13, 0x0.c86b9f5cc13f80p-18, 0x0.b119f7ffda1110p-16, -0x0.bebe619455a0d0p-19, -0x0.9a03920d972138p-19, 0x0.a38ec342437850p-21, 0x0.8199836b183a80p-25, -0x0.b5ab8cb9084068p-24, 0x0.f59aefd99890d8p-25, 0x0.b81f56b199bb48p-28, -0x0.8bb0970e48f578p-26, 0x0.88b4512bcb3b08p-30, 0x0.b9370543bbb3d8p-29, // x=    5.25 y=       3
+ 0x0.c6296a60984140p-4, 0x0.99d8daaf9e4b18p-3, -0x0.d536bd2e2f1f40p-6, -0x0.bbb4dc499cce40p-7, 0x0.927d6e668e9b68p-8, -0x0.d700df67bc9d58p-11, -0x0.86933a4c1dcfe8p-11, 0x0.87cfe0643adfe8p-11, 0x0.9c97b76f2414d0p-16, -0x0.f32e47c86c3e40p-14, 0x0.916c05309aa2e0p-17, 0x0.8d8f9315d87ec8p-16, -0x0.b9b937eb53f6a8p-19, -0x0.b304abc8763e00p-20, 0x0.82d6676bddbdd8p-21, -0x0.e0887c2e475408p-24, -0x0.dc542801a72a18p-25, 0x0.86a30b2ed3b818p-24, -0x0.91150d09dbd590p-36, -0x0.e26049b0660b10p-27, 0x0.be0c383c7dc6f8p-30, 0x0.e117f260f681e0p-30, // x=    5.25 y=    3.25
+ 0x0.cb78d9fdb775f8p-4, 0x0.933e9151c90cd8p-3, -0x0.d11fb11643e7b0p-6, -0x0.98b08459c9f1c0p-7, 0x0.859bfff8447b10p-8, -0x0.98744ec4385a58p-10, -0x0.d36173f77b2fc8p-12, 0x0.8a29b8d17c3a80p-11, 0x0.d25de599d7a8d8p-24, -0x0.da5c06b3ef2e38p-14, 0x0.a92b5144b802a8p-17, 0x0.d86d813e432200p-17, -0x0.a880d4a9817788p-19, -0x0.9e32348e22fd98p-21, 0x0.c3ccedf5bcd938p-22, -0x0.c16c38425608f0p-23, -0x0.dbebeac0c653d0p-26, 0x0.fce0ba9dd00270p-25, -0x0.d0469047e9c8f8p-29, -0x0.a60f6f2e62c6f0p-27, // x=    5.25 y=     3.5
+ 0x0.cfbd11df4b2d28p-4, 0x0.8cca2e759ca638p-3, -0x0.cbcac005b054d0p-6, -0x0.f1ce1209326840p-8, 0x0.f16ef943f1ed58p-9, -0x0.bb2e35a7e2d2f8p-10, -0x0.a02abdc5314968p-12, 0x0.88462650cceb68p-11, -0x0.e7265297257250p-17, -0x0.bf274bd1e14800p-14, 0x0.b0ce35aa79e288p-17, 0x0.9d81dcd68815b0p-17, -0x0.911e76b25a87d0p-19, -0x0.d4e70932d83ad8p-25, 0x0.88eb19af08e748p-22, -0x0.e3b73cefc955e8p-23, -0x0.8177cacd8609f8p-27, 0x0.d8149ef55cf450p-25, -0x0.9551a50abeb988p-28, -0x0.de63a8db80f058p-28, // x=    5.25 y=    3.75
+ 0x0.d30fcc797b5ad0p-4, 0x0.8684675d787748p-3, -0x0.c584b24ea98038p-6, -0x0.b89b5013c448c8p-8, 0x0.d84f0f63f9d450p-9, -0x0.d4f27ccb8c7760p-10, -0x0.e7a566fedbd3d8p-13, 0x0.834b2ad073f098p-11, -0x0.c5fea8d91af938p-16, -0x0.a3b1e94a0e3288p-14, 0x0.ad239500716038p-17, 0x0.d7a389dbeeb5e0p-18, -0x0.efac62ee9773d8p-20, 0x0.a8e00e890644e8p-22, 0x0.b0a686a3ace960p-23, -0x0.e677630ecff778p-23, 0x0.89bc46d7a96b58p-28, 0x0.ac52ab001f8f70p-25, -0x0.9cea2e080cc988p-28, -0x0.85fbc2365638a8p-28, // x=    5.25 y=       4
+ 0x0.d58a1f62690eb8p-4, 0x0.8073b3f56ebb78p-3, -0x0.be90106b5e36c0p-6, -0x0.858df774892220p-8, 0x0.c054a080016de8p-9, -0x0.e70935121662e0p-10, -0x0.9c6ff9dc4ac470p-13, 0x0.f86251de2b8180p-12, -0x0.fc4f72a021b410p-16, -0x0.896d625fd97850p-14, 0x0.a226e45b4e44a8p-17, 0x0.8709f7710b44b0p-18, -0x0.becb9bf5806ba8p-20, 0x0.907612f71015c0p-21, 0x0.ca98da5199f9c8p-24, -0x0.d617e053c2d400p-23, 0x0.b4e66ba0e16f20p-27, 0x0.81b9acb01e13f8p-25, -0x0.8f77680cf22138p-28, -0x0.89c941cb518a58p-29, // x=    5.25 y=    4.25
+ 0x0.d743fe38c4b108p-4, 0x0.f53940f5a29628p-4, -0x0.b72550088a0868p-6, -0x0.b0a3336278d9e8p-9, 0x0.a9d1dcaf2a56e8p-9, -0x0.f2acb28e2bf3b0p-10, -0x0.bbbd3c2a1583f0p-14, 0x0.e783cdcce62200p-12, -0x0.8e1c1334760140p-15, -0x0.e27b698ff11020p-15, 0x0.92f0f220ea9aa0p-17, 0x0.8fde72070d7498p-19, -0x0.92b98f8890be48p-20, 0x0.b001f51af03678p-21, 0x0.b81499c6a666d0p-25, -0x0.bbc90530b940a8p-23, 0x0.e7bc415d5be6c0p-27, 0x0.b8f1acebab1b78p-26, -0x0.f0f6eabac51fd0p-29, -0x0.c4dc9f3ab2f158p-31, // x=    5.25 y=     4.5
+ 0x0.a3655420958400p-45, 0x0.d0d42f8cbc4590p-3, -0x0.e5c67e4dd241b0p-42, -0x0.999dbb37e16020p-5, 0x0.9f01fb7e358000p-39, 0x0.e633f73b153398p-8, -0x0.904863cf5dc390p-37, -0x0.afe68d23760320p-10, 0x0.c0f5aca3b898a8p-36, 0x0.8941f9f6460670p-12, -0x0.caa6bea37490f0p-35, -0x0.db1c84be3918e0p-15, 0x0.ade7d9ab8f9888p-34, 0x0.b340cea516a088p-17, -0x0.fa8a829725b530p-34, -0x0.96b088768c72b0p-19, 0x0.9a6c68a024eb20p-33, 0x0.829dc5067bc0a0p-21, -0x0.a53102a56e6028p-33, -0x0.ea97aef5c0b7f0p-24, 0x0.9af4a667894070p-33, 0x0.dbb8d98c27cf48p-26, -0x0.807142d6c797e0p-33, -0x0.d8697d4b144b58p-28, 0x0.bd2df907ed7700p-34, 0x0.e19eaebbbe3320p-30, -0x0.f86786e5cafe60p-35, -0x0.f8485478f95188p-32, 0x0.9176ddb3089b00p-35, 0x0.8d273337507ac0p-33, -0x0.9762a221299f10p-36, -0x0.9ef751771c80c0p-35, 0x0.8fe29f6b3377d8p-37, 0x0.a7a7fe03a0a3c8p-37, -0x0.812e8e1f4a13c0p-38, -0x0.e6c388bc93eae8p-40, 0x0.f15b2a6ba81008p-41, -0x0.b9cac8b6a9aa18p-42, // x=     5.5 y=       0
+ 0x0.e545613e7c0b08p-7, 0x0.cfd28e8a65e3c0p-3, -0x0.aadbaf04599e18p-8, -0x0.9751700a697110p-5, 0x0.c25297710ebff8p-10, 0x0.df1142296e0268p-8, -0x0.c81536cbbe9de0p-12, -0x0.a678dac0ec6970p-10, 0x0.c4ef5ca8e334d8p-14, 0x0.fb930bea4e57f0p-13, -0x0.bdfed4f21c9f50p-16, -0x0.c0684a3068dbc8p-15, 0x0.b63d04b8d09118p-18, 0x0.94d2f770d5b800p-17, -0x0.af6b0ee0619338p-20, -0x0.e866c9c75a6738p-20, 0x0.aa9f669837e018p-22, 0x0.b6728c8bd6d9d0p-22, -0x0.a89743b62872d0p-24, -0x0.8ecba60cd16730p-24, 0x0.a9d8c335bcaae8p-26, 0x0.daab8eaa156708p-27, -0x0.ad9d0b93e1d2e8p-28, -0x0.a2be6956b0c738p-29, // x=     5.5 y=    0.25
+ 0x0.bd60540ea6d028p-6, 0x0.ce0f1bfabaead0p-3, -0x0.8bc933b30ef3b8p-7, -0x0.93557f16ccae20p-5, 0x0.9cd573e39b1d70p-9, 0x0.d2df584a6ff228p-8, -0x0.9e8c7c92acbfe8p-11, -0x0.96a8205e81f190p-10, 0x0.985c8968f8e438p-13, 0x0.d600ef5ec4bb60p-13, -0x0.8e8994da7e26a0p-15, -0x0.95fcef04302438p-15, 0x0.8372385e18a5e0p-17, 0x0.ccad5562d67988p-18, -0x0.f09ffdabde0328p-20, -0x0.843e11091f8f30p-20, 0x0.db4b4262627450p-22, 0x0.9717acd16b0d48p-23, -0x0.c6f26ebcb40738p-24, -0x0.eaebc5a58ef5f8p-27, 0x0.b2d78b7373b048p-26, -0x0.a2116d4c161a70p-30, -0x0.9da367c27e2be0p-28, 0x0.b0294bb9413d38p-30, // x=     5.5 y=     0.5
+ 0x0.82d6808a499178p-5, 0x0.cb7934e024c158p-3, -0x0.be72cfcae96cb0p-7, -0x0.8d970bd33fe0c8p-5, 0x0.d16c95236caaf8p-9, 0x0.c1af63c0bad658p-8, -0x0.ce0c431b919538p-11, -0x0.81048a04494608p-10, 0x0.bf1566cbbfc838p-13, 0x0.a4855ac5026388p-13, -0x0.aab77098b41488p-15, -0x0.c18e81408453e0p-16, 0x0.945a877fa4c580p-17, 0x0.be3f6525797190p-19, -0x0.fb715f512465c0p-20, -0x0.bb18bd01043398p-23, 0x0.cf12bd4bde8708p-22, -0x0.e770dbb4246588p-25, -0x0.a3d97386e5bcb0p-24, 0x0.857f7d3a8bded0p-25, 0x0.f2d335ccfe9370p-27, -0x0.ba3306fab39c50p-27, -0x0.9f4b6cc2c30078p-29, 0x0.d9e553b5680498p-29, // x=     5.5 y=    0.75
+ 0x0.a55b7ae5e00388p-5, 0x0.c821f08cac2e80p-3, -0x0.ec4ec6a02a14c8p-7, -0x0.86567cba455b00p-5, 0x0.fd20019cd234f0p-9, 0x0.aca71a1109dce8p-8, -0x0.f057dfc8550c90p-11, -0x0.cf359e74ba5230p-11, 0x0.d4a3e420895180p-13, 0x0.dade9a269c4360p-14, -0x0.b2951566583b20p-15, -0x0.a61968bfedf5d8p-17, 0x0.8effd8949936f8p-17, -0x0.8af57bb3e5b040p-22, -0x0.d8fa1f6d115730p-20, 0x0.878c53187b6630p-21, 0x0.98bf4372dca2e8p-22, -0x0.ccc8aecc043d10p-23, -0x0.bd4e93f1356980p-25, 0x0.ec8f216f5006c0p-25, 0x0.b043f8ad318390p-28, -0x0.ee23d2a3899f80p-27, // x=     5.5 y=       1
+ 0x0.c5e7dd689df4b8p-5, 0x0.c41e3bd8db7608p-3, -0x0.8a47d10f05dcf0p-6, -0x0.fbbf0af21e8d80p-6, 0x0.8f7638596c3b68p-8, 0x0.950df8fee0ed48p-8, -0x0.8266b0f68af138p-10, -0x0.991a8c40e9ed40p-11, 0x0.d99a0661eeb610p-13, 0x0.daff9ce0c88258p-15, -0x0.a8d4ca0899c268p-15, 0x0.864b901ba54db8p-19, 0x0.f228e37e25a898p-18, -0x0.b5b329489eb960p-19, -0x0.9be7dff7e317b8p-20, 0x0.fd84331ff8b030p-21, 0x0.a53f206ca1d970p-23, -0x0.873f05d2c48ad0p-22, -0x0.c0d1290c39d168p-27, 0x0.f92714a50fd520p-25, -0x0.9559bbbd792080p-29, -0x0.ca6e16deb06528p-27, // x=     5.5 y=    1.25
+ 0x0.e438194c2cc7a8p-5, 0x0.bf8594a2942768p-3, -0x0.9b5d20aee38b70p-6, -0x0.e905a48ccb37d8p-6, 0x0.9b49e76a709928p-8, 0x0.f8536cfc3d0b68p-9, -0x0.8613c67b4451b8p-10, -0x0.c72c594ce89108p-12, 0x0.d0766a117c40c8p-13, 0x0.a7d311fdc722e8p-18, -0x0.9256a7ca5d2148p-15, 0x0.c09ab3b24f6cc8p-17, 0x0.b421ac26a6c5d0p-18, -0x0.9012fb72d29490p-18, -0x0.af34b0d2084e50p-21, 0x0.976c270418fef0p-20, 0x0.9268858280d970p-25, -0x0.8519d4f5efd150p-22, 0x0.dd90865cb7e430p-27, 0x0.c9602e042272e0p-25, -0x0.d0de2229e1b260p-28, -0x0.fcf8c2d88191e8p-28, // x=     5.5 y=     1.5
+ 0x0.800e66e56b6820p-4, 0x0.ba70c678fe8a68p-3, -0x0.a950d4260d1578p-6, -0x0.d5208cf05a0dd8p-6, 0x0.a24015f6cc7918p-8, 0x0.c643963af617a8p-9, -0x0.840f7af75db540p-10, -0x0.c700feee4678d0p-13, 0x0.bcca0051912e20p-13, -0x0.8fd72a69312088p-15, -0x0.e9374637655a48p-16, 0x0.975c3984020b38p-16, 0x0.e38a3608f96818p-19, -0x0.a896641646a2d8p-18, -0x0.d40efec436db20p-23, 0x0.940d1ed9657150p-20, -0x0.e30be705ff1c28p-25, -0x0.d97999777ac0b8p-23, 0x0.dba1e8dd25f2d0p-26, 0x0.812a9449cf5d20p-25, -0x0.ed8353b6cdc598p-28, -0x0.c92312856b2220p-29, // x=     5.5 y=    1.75
+ 0x0.8cbcfd89e28478p-4, 0x0.b4f8c4b3709550p-3, -0x0.b42e7167dd73e0p-6, -0x0.c0a4bc33319590p-6, 0x0.a4ccdf4fa8f060p-8, 0x0.95d9700946a888p-9, -0x0.fafde7cec78a38p-11, -0x0.b7f88f0f951bc8p-16, 0x0.a26b77dba2aa60p-13, -0x0.86ce099fd53400p-14, -0x0.a93290a0b75158p-16, 0x0.b6609402439e50p-16, 0x0.d4f4dba88ac390p-20, -0x0.a97a33a541ab28p-18, 0x0.9d145bf6ec4128p-23, 0x0.fcf495cdb1e8e8p-21, -0x0.da8de8fc078dc0p-24, -0x0.9680f362942548p-23, 0x0.f4ea1c6eda11a0p-26, 0x0.ee1745e9517978p-27, -0x0.c861e6a6e2fcc8p-28, 0x0.aba15b8bb20dc8p-32, // x=     5.5 y=       2
+ 0x0.98229cc0785660p-4, 0x0.af35b4aca75110p-3, -0x0.bc1cbc345126d0p-6, -0x0.ac15e5f15334d0p-6, 0x0.a38cb61d060d68p-8, 0x0.d11c7047a3cce0p-10, -0x0.e73e44d26bacc8p-11, 0x0.f9918f455a7630p-14, 0x0.84df9180075550p-13, -0x0.b1fd57612cc7e8p-14, -0x0.d8555f72963088p-17, 0x0.c0c274fb3c2758p-16, 0x0.8ae66111b5dd58p-23, -0x0.99e4198f2f4bc0p-18, 0x0.c37926ddd30fa0p-22, 0x0.c0a97e09e83608p-21, -0x0.fdd80e8ca3baf8p-24, -0x0.a970a47a6b0c88p-24, 0x0.d87b8cb432dc38p-26, 0x0.d06f69ee93e738p-30, -0x0.8923ea7e771bc0p-28, 0x0.8fe4b1c5d1f7b8p-29, // x=     5.5 y=    2.25
+ 0x0.a241a7681a58d8p-4, 0x0.a93e3130e4b670p-3, -0x0.c1565b471bb058p-6, -0x0.97e2c5b023b8f0p-6, 0x0.9f2f7384d25ca0p-8, 0x0.fd97c2497d7510p-11, -0x0.cf3e5a4dbc9d18p-11, 0x0.f2a6e8af8a6e68p-13, 0x0.ce02a20792b1a8p-14, -0x0.cb3b31d122c258p-14, -0x0.dbc8cb3e0c1a20p-18, 0x0.bb59fc088ff870p-16, -0x0.f72a325dd719b0p-21, -0x0.80ecd1664b7cf0p-18, 0x0.fc1602f6545670p-22, 0x0.820dc4eb516a70p-21, -0x0.f0df633179a478p-24, -0x0.f81d076e0f6c50p-26, 0x0.a35293c1060f50p-26, -0x0.d2abdac07ae868p-28, -0x0.958a3360989230p-29, 0x0.b8a4711c7f0e88p-29, // x=     5.5 y=     2.5
+ 0x0.ab22ba39584af8p-4, 0x0.a326c80e43c5f8p-3, -0x0.c422c984579b58p-6, -0x0.8463cf2054a1c0p-6, 0x0.98674498613378p-8, 0x0.d7cc000e6f3228p-12, -0x0.b5106970ec81c8p-11, 0x0.a5b14d96ffe5e8p-12, 0x0.95c42f84e21ce8p-14, -0x0.d565ec6cfc43b0p-14, -0x0.be872623b7d700p-20, 0x0.ab39b7de5489f8p-16, -0x0.d4518aea434ef0p-20, -0x0.c8d729e3252378p-19, 0x0.836bccd8b3bc68p-21, 0x0.94df843e5b9d50p-22, -0x0.c9340dfc8f4df8p-24, 0x0.da47c2da9c1760p-28, 0x0.d4ab6775fd0770p-27, -0x0.a6bab8db793528p-27, -0x0.d329f1206e34d0p-31, 0x0.ada151b6cce120p-29, // x=     5.5 y=    2.75
+ 0x0.b2d3497dee4b50p-4, 0x0.9d01aceb428d68p-3, -0x0.c4d0252fe39eb0p-6, -0x0.e3b76dee7aba28p-7, 0x0.8fdc3dc41db238p-8, -0x0.8f0df5b3efcb10p-14, -0x0.9a6270fa096ae8p-11, 0x0.c4b8df59b7d470p-12, 0x0.c74552cdb55b88p-15, -0x0.d3ca51a1e59988p-14, 0x0.a39d976445e570p-19, 0x0.94e9fa3d5d44c0p-16, -0x0.809b657b5d8700p-19, -0x0.910bc08da3cd10p-19, 0x0.f37f8a7e5c13c8p-22, 0x0.f1ff32c17a9c00p-24, -0x0.97c2d8f38db500p-24, 0x0.ec83450d84f708p-26, 0x0.e5235e898ee2d0p-28, -0x0.b264b7e453ae80p-27, 0x0.9b9cdda17282c8p-33, 0x0.89da49a6f3a2b0p-29, // x=     5.5 y=       3
+ 0x0.b964523864a418p-4, 0x0.96de991fa8e1f0p-3, -0x0.c3ae273c113060p-6, -0x0.c0f280131e0f20p-7, 0x0.86246ec02d97d8p-8, -0x0.f7bf1732209c40p-12, -0x0.8078af9c4d9cd8p-11, 0x0.d8225ae2bbdf50p-12, 0x0.e3d5f2c64fc210p-16, -0x0.c9a70d5468d2f8p-14, 0x0.ab85432c969b58p-18, 0x0.f812551cadcd08p-17, -0x0.86711ba3adbbc8p-19, -0x0.befeee032f9bd0p-20, 0x0.cfbef7d7d4a8b8p-22, -0x0.c86b5dd916ede0p-28, -0x0.cf35ebe7774d18p-25, 0x0.a0e93b96f1b640p-25, 0x0.a648b99976ad90p-29, -0x0.a087da5628cf78p-27, // x=     5.5 y=    3.25
+ 0x0.bee92eb1a84ae0p-4, 0x0.90cacee7b3f5e8p-3, -0x0.c10a54bbcf7300p-6, -0x0.a0b38d15ce71d8p-7, 0x0.f77f91123c6698p-9, -0x0.d300e8ef61d1a0p-11, -0x0.d06946b02eeb08p-12, 0x0.e1daf574015610p-12, 0x0.b0d5ed1a9b3870p-17, -0x0.b9e0651e33c340p-14, 0x0.e33b3cb828aaa8p-18, 0x0.c66b0b5363e948p-17, -0x0.80e0abad23ab60p-19, -0x0.da61d092b28cc0p-21, 0x0.a5dce9df735ad8p-22, -0x0.b14bdc9bab0ff8p-24, -0x0.fa8802c9b4d5c0p-26, 0x0.a9aaf83f4895e8p-25, -0x0.cbc13610b488f0p-32, -0x0.816efee6ccf430p-27, // x=     5.5 y=     3.5
+ 0x0.c37696c768d988p-4, 0x0.8ad1365b9c0828p-3, -0x0.bd2d56dda441b8p-6, -0x0.83183aa03f0440p-7, 0x0.e22ddf54f39828p-9, -0x0.8c5dd5f5287000p-10, -0x0.a445ff3e782d38p-12, 0x0.e3d06486f429f0p-12, -0x0.a76e5751a373a0p-19, -0x0.a6db4120d40e58p-14, 0x0.ffb8261ad11a40p-18, 0x0.9846b5cc607e70p-17, -0x0.e8c0e767e68b70p-20, -0x0.b7055b5f30cb18p-22, 0x0.f9476cc84bd990p-23, -0x0.86aaf475a81ed0p-23, -0x0.f803dab1daa268p-27, 0x0.9d978cbb7ae7b0p-25, -0x0.85c518a7bb3a40p-29, -0x0.bf0d521de67540p-28, // x=     5.5 y=    3.75
+ 0x0.c721ce7d2f5038p-4, 0x0.84fa8b91121d60p-3, -0x0.b859509aa58658p-6, -0x0.d04db86427e0f8p-8, 0x0.ccf82a4ee59430p-9, -0x0.a76a4bdce0ca18p-10, -0x0.fa319141f3b848p-13, 0x0.dfce7e006f8720p-12, -0x0.ce2222be3192e8p-17, -0x0.9274336dd30e30p-14, 0x0.83d8fc28bde040p-17, 0x0.df21ae0dce75b0p-18, -0x0.c8cd30ce9b77b0p-20, 0x0.8a2e57fcfeca78p-28, 0x0.afe52086c8dac8p-23, -0x0.99baae7f955f10p-23, -0x0.890af81bc27d30p-28, 0x0.86d77b4e4902b0p-25, -0x0.b533ed976d2bd0p-29, -0x0.818edb7c1ca640p-28, // x=     5.5 y=       4
+ 0x0.ca00013f9d4620p-4, 0x0.fe9b2d78dc45a0p-4, -0x0.b2c900a887cdf0p-6, -0x0.9fa7a39b2c7d78p-8, 0x0.b85a1e1e712458p-9, -0x0.bb994efe861098p-10, -0x0.b6180a28232bd0p-13, 0x0.d76bb3456566a0p-12, -0x0.a1b1209854cfa0p-16, -0x0.fc0ff8d1d4b9a0p-15, 0x0.8093ec583c0ff0p-17, 0x0.9a32426151e248p-18, -0x0.a6d500dc1d9d28p-20, 0x0.8079473dddf928p-22, 0x0.e60f3ad0c8a0d8p-24, -0x0.9a6d25ed86c568p-23, 0x0.bffaa59b771e40p-29, 0x0.d8e42c40f95140p-26, -0x0.bceea98b717ed0p-29, -0x0.9f397bc4e16d30p-29, // x=     5.5 y=    4.25
+ 0x0.937d967b871a88p-49, 0x0.c7a82fff91e448p-3, -0x0.d8a075056e6ef8p-46, -0x0.8c322f66920fb8p-5, 0x0.9cc7df960efd18p-43, 0x0.c830b3e29459d8p-8, -0x0.95005dd2d1b4d8p-41, -0x0.91770efc3d8558p-10, 0x0.d10c0bd4430e08p-40, 0x0.d762a1fe602048p-13, -0x0.e6baeaeaba2c70p-39, -0x0.a2ab32eda75170p-15, 0x0.d080afb427e698p-38, 0x0.fb08b3473bf8e8p-18, -0x0.9e83398aebbba0p-37, -0x0.c641bd86069e60p-20, 0x0.cec0a68cba4658p-37, 0x0.a09f6c56770118p-22, -0x0.eab3b040c35368p-37, -0x0.85e505ae1d53f0p-24, 0x0.ea6c9aeecf4640p-37, 0x0.e69fb33b32dc20p-27, -0x0.cfbc0dcef76090p-37, -0x0.ce5e96edbf8c48p-29, 0x0.a455f46c7fcd28p-37, 0x0.c1489c343ad7e0p-31, -0x0.e92775863c03d8p-38, -0x0.becef0644ebfe0p-33, 0x0.94bfc2e0016010p-38, 0x0.c6c6fda7322de8p-35, -0x0.aab55563e7d248p-39, -0x0.d7bcf95f9710a8p-37, 0x0.af53d8069abf98p-40, 0x0.ecaf1f9c581258p-39, -0x0.a70ea1a6085d48p-41, -0x0.fd3f768fdd3cc0p-41, 0x0.9d0b5ba8dadfd8p-42, 0x0.cc65484bdbd2a0p-43, -0x0.a176e4f9d67e28p-44, 0x0.f46a2862eb2c38p-47, // x=    5.75 y=       0
+ 0x0.d157015ca64370p-7, 0x0.c6c8086a997c38p-3, -0x0.94bbd602df8b78p-8, -0x0.8a4b3b4e562128p-5, 0x0.a0ff52b249a3f8p-10, 0x0.c295464fb463b8p-8, -0x0.9d7760e10a53f8p-12, -0x0.8a72dbb0c46b08p-10, 0x0.92e789af9e1ca0p-14, 0x0.c7438a13254fe8p-13, -0x0.86002fbb98ad70p-16, -0x0.910225920a41e8p-15, 0x0.f258e406616688p-19, 0x0.d5514e5711e5f8p-18, -0x0.db32033a8e11e8p-21, -0x0.9e6a79ef5c1950p-20, 0x0.c7923f0585c408p-23, 0x0.ed0b57249e09c8p-23, -0x0.b7d4e982259460p-25, -0x0.b1e8c7f4d6f118p-25, 0x0.ac066489a8b490p-27, 0x0.84ca84cbba66f0p-27, -0x0.a2eb047bb23c20p-29, -0x0.c6f12bccaa9fc8p-30, // x=    5.75 y=    0.25
+ 0x0.ad0e26d103ff98p-6, 0x0.c53eb1b54ee3d0p-3, -0x0.f3cd5c0b6854d0p-8, -0x0.86fcd806e77828p-5, 0x0.825b52b8df3628p-9, 0x0.b8f5cc21c3cb78p-8, -0x0.fae2f945dfcb98p-12, -0x0.fd3484da2c3b18p-11, 0x0.e5327945a2d568p-14, 0x0.ac9a32b2f6eb40p-13, -0x0.cb9306697c5658p-16, -0x0.e9185ab4c1d118p-16, 0x0.b208dfdb082f48p-18, 0x0.9a772f15965920p-18, -0x0.9a6ae9395c49f8p-20, -0x0.c56e7b1543c710p-21, 0x0.855e01faa11028p-22, 0x0.ea6a8b7c9225f8p-24, -0x0.e5c0b535d37928p-25, -0x0.e92c41feec85b0p-27, 0x0.c52532fbe63388p-27, 0x0.dca90fccee2c90p-31, -0x0.a7b31f4c642a78p-29, 0x0.9beda22159efe8p-32, // x=    5.75 y=     0.5
+ 0x0.ef6928aabc23c0p-6, 0x0.c2fcbb5a6cba30p-3, -0x0.a682bdc860ea98p-7, -0x0.8233c8aa23f448p-5, 0x0.aee22d410d0ee8p-9, 0x0.ab4f380dac2e48p-8, -0x0.a44881b749cd10p-11, -0x0.dc75d43e338d70p-11, 0x0.917456b462c2e8p-13, 0x0.88f3e000daf728p-13, -0x0.f8403b458429c8p-16, -0x0.a0172fb9537918p-16, 0x0.ce587bd06db7f8p-18, 0x0.a5ae76108b5d38p-19, -0x0.a7c2ea52738aa8p-20, -0x0.f5c1bd36055208p-23, 0x0.8556456e2ad5e8p-22, -0x0.83077c3610abb8p-27, -0x0.cdfd2f5e2a4a08p-25, 0x0.d76099d18156f8p-27, 0x0.9913c09512ede8p-27, -0x0.a3b58c9f9dbd38p-28, // x=    5.75 y=    0.75
+ 0x0.978573029200e8p-5, 0x0.c00fba2cb61a48p-3, -0x0.cf49ef2f3278e0p-7, -0x0.f841a0ec00f608p-6, 0x0.d4a39c5ff963f8p-9, 0x0.9a755a3d84dc70p-8, -0x0.c183d2770b89b8p-11, -0x0.b57a77a7702690p-11, 0x0.a45c78be4142a0p-13, 0x0.c0e3e745e03b88p-14, -0x0.84e60f105c5020p-15, -0x0.a3e403bc0f96b8p-17, 0x0.cdf98bfbbcac18p-18, 0x0.bda6a680ace7e0p-22, -0x0.98a904162046b0p-20, 0x0.f192cdb836ec60p-23, 0x0.d5e71f092dcb38p-23, -0x0.d44e3ca78f8a58p-24, -0x0.899b6a484c5888p-25, 0x0.fb871c8c0a07c8p-26, 0x0.97e9a1cf68f870p-28, -0x0.fe2b8629e7a658p-28, // x=    5.75 y=       1
+ 0x0.b5ae526268bb88p-5, 0x0.bc8873dab7f758p-3, -0x0.f38d36799bead0p-7, -0x0.e9fc0e625f25b8p-6, 0x0.f2bcbbc92db720p-9, 0x0.87592c7f29d0f0p-8, -0x0.d471f29a1a7b68p-11, -0x0.8b479a94d82fc0p-11, 0x0.ab501b2ff70138p-13, 0x0.dcbfae2858c8e0p-15, -0x0.8147e8b8e19840p-15, -0x0.884091f158a190p-20, 0x0.b673609ed4c728p-18, -0x0.bfb4ce8e875938p-20, -0x0.ecaf63d09be588p-21, 0x0.9406eae992eeb0p-21, 0x0.8674eb5025ece8p-23, -0x0.a0ce4eee674dd0p-23, -0x0.e4abef3f353878p-27, 0x0.9524922ee44d68p-25, 0x0.b196d2ee3073d8p-33, -0x0.f6a633368fc4b0p-28, // x=    5.75 y=    1.25
+ 0x0.d1f30e34b35330p-5, 0x0.b879f00017b228p-3, -0x0.896d6dd40e0b30p-6, -0x0.da14bb54d352e0p-6, 0x0.846c61aa51d268p-8, 0x0.e5e0f851963e00p-9, -0x0.dd569920a28628p-11, -0x0.c16b1e0c0ad5d8p-12, 0x0.a7a55bc6c648e8p-13, 0x0.8537fd20e593b8p-16, -0x0.e8057da215c148p-16, 0x0.d438740c852d10p-18, 0x0.903b19621ddf30p-18, -0x0.b5054920c1e868p-19, -0x0.97a823117d8820p-21, 0x0.c2a2549ed52bf8p-21, 0x0.d5aa8d6a15cb48p-25, -0x0.acf3a397fc15d8p-23, 0x0.a6e9a01a083210p-29, 0x0.8604ebe72330e8p-25, -0x0.b6778b7728d9e0p-29, -0x0.b4061f5f437090p-28, // x=    5.75 y=     1.5
+ 0x0.ec27673aebe3e0p-5, 0x0.b3f884135989d0p-3, -0x0.967e7fa4294468p-6, -0x0.c90ac44a5c1360p-6, 0x0.8b90bd8cb81770p-8, 0x0.bc427f6ef01bd8p-9, -0x0.dd356860676080p-11, -0x0.e0a361b0d96dc0p-13, 0x0.9b8e860b707d00p-13, -0x0.855e28b3f8e018p-16, -0x0.c105a4f2b20b10p-16, 0x0.c5d51b3082c608p-17, 0x0.c80cb08c3c4298p-19, -0x0.e4ee050e62fbe8p-19, -0x0.89f63b479a92c0p-22, 0x0.cc0b96b45209d8p-21, -0x0.c59f4a58722408p-27, -0x0.99b551e3da2840p-23, 0x0.d645ee8b207d60p-27, 0x0.c39650d0e14310p-26, -0x0.830c4a8b798298p-28, -0x0.c0da9f7bc56e18p-29, // x=    5.75 y=    1.75
+ 0x0.82175a01f8a340p-4, 0x0.af18eead8bee28p-3, -0x0.a0f9d3501057d8p-6, -0x0.b7575cd07696a0p-6, 0x0.8f12b0ce05dc20p-8, 0x0.93656733dff208p-9, -0x0.d58ebf1010a990p-11, -0x0.9b5b44b8a7e1f8p-14, 0x0.8999bb9a4bfd18p-13, -0x0.ad7a02ae0910c8p-15, -0x0.94433de25e6138p-16, 0x0.803a187358bda0p-16, 0x0.e3d8b91926ade0p-20, -0x0.f38667721c2320p-19, -0x0.c98559a9ebea80p-29, 0x0.ba10affdead3a0p-21, -0x0.deb9185e0937b8p-25, -0x0.eab870d0f88b80p-24, 0x0.8fc40eb2a42520p-26, 0x0.e1f2a46d630f78p-27, -0x0.fe93d1a0215da8p-29, -0x0.c41b5d5a946590p-31, // x=    5.75 y=       2
+ 0x0.8cfd648211f060p-4, 0x0.a9ef9103462fb8p-3, -0x0.a8f5ed64e00bc0p-6, -0x0.a56873d0aca8a0p-6, 0x0.8f5cb66309ccb8p-8, 0x0.d91341f58fcc50p-10, -0x0.c81d8ed8401608p-11, 0x0.c5c71245634df0p-15, 0x0.e88e0351da18b0p-14, -0x0.fbfb4af80dfc88p-15, -0x0.ce9a78de64f710p-17, 0x0.8e622b85a06460p-16, 0x0.9e4936cbc3ed68p-21, -0x0.e88745f1fffac0p-19, 0x0.be84dbb913ba88p-23, 0x0.980fe7be7c4068p-21, -0x0.99ed7f5dc0cc88p-24, -0x0.98be5dd74f0000p-24, 0x0.8eabff164734c0p-26, 0x0.a51abbf031fa08p-28, -0x0.c72738d1d806f0p-29, 0x0.bbfdb506e0d1e8p-31, // x=    5.75 y=    2.25
+ 0x0.96c529d26f0e20p-4, 0x0.a48fcf262109b8p-3, -0x0.ae9ab160f80050p-6, -0x0.939d3d38d004d0p-6, 0x0.8ceda86b4af2e8p-8, 0x0.913601b48cf770p-10, -0x0.b6a0246a9455c8p-11, 0x0.9a7b5b5e5baa28p-13, 0x0.bb821a36ef5040p-14, -0x0.97b3480fac0c50p-14, -0x0.f8721894e839d8p-18, 0x0.901b46182acf28p-16, -0x0.921a6579fcc1e0p-22, -0x0.ccc09e7d18d000p-19, 0x0.987b4d3e616218p-22, 0x0.e004dc4fd79760p-22, -0x0.a1ad773392ed78p-24, -0x0.9cb62ea350a5b0p-25, 0x0.eea5fd3d340a78p-27, -0x0.a15ae892d71bb0p-30, -0x0.81470ffe765c30p-29, 0x0.bda3c3698cd018p-30, // x=    5.75 y=     2.5
+ 0x0.9f7371977f5708p-4, 0x0.9f0b99f54fe7b0p-3, -0x0.b21c30bc0558b0p-6, -0x0.82447ba55a3040p-6, 0x0.884bd1dcfb0860p-8, 0x0.a0d25bb03f9f20p-11, -0x0.a2b0704f2306b8p-11, 0x0.ed1f530e06cc80p-13, 0x0.8f72226ca938c0p-14, -0x0.a5746b2552e748p-14, -0x0.d87c973ad053b8p-19, 0x0.88a1e0a475da68p-16, -0x0.ea7c331cd4a878p-21, -0x0.a8418cec35a490p-19, 0x0.b0581e68c714d0p-22, 0x0.923e90e049f1b8p-22, -0x0.9299885db0f808p-24, -0x0.a10291632a1448p-27, 0x0.ae484ab389b798p-27, -0x0.a0f7244dacec78p-28, -0x0.83fe8e9eace590p-30, 0x0.d41ac32ff1d808p-30, // x=    5.75 y=    2.75
+ 0x0.a71169807c5458p-4, 0x0.99732130f4e0b0p-3, -0x0.b3b5e306ff99f8p-6, -0x0.e33878f7420eb0p-7, 0x0.81facb135480d8p-8, 0x0.ba9fa244e36d58p-13, -0x0.8dac2099d47ab0p-11, 0x0.953f05a4edc708p-12, 0x0.cd7afdf67e5bc0p-15, -0x0.a95c8d13ecb448p-14, 0x0.d73646e58442b8p-24, 0x0.f63e5166f44080p-17, -0x0.a61a93439fc468p-20, -0x0.8163b677293b28p-19, 0x0.afaf7a0fbd7228p-22, 0x0.9ec0577dc89478p-23, -0x0.ef603d017bb018p-25, 0x0.9e240099796de0p-27, 0x0.dd291266b80ec0p-28, -0x0.d3f9fbd712a458p-28, -0x0.95824ef69e3de0p-32, 0x0.be30b3e32b0d18p-30, // x=    5.75 y=       3
+ 0x0.adab9f46c683d0p-4, 0x0.93d4a928921db0p-3, -0x0.b3a68f6f9ff070p-6, -0x0.c3a550a4523300p-7, 0x0.f4e8abfb36f8f8p-9, -0x0.cec42491d67fc8p-13, -0x0.f154789e235630p-12, 0x0.aa55684fea1318p-12, 0x0.85ac9354380dc8p-15, -0x0.a5ad36edb982f0p-14, 0x0.acb79d8d085aa8p-19, 0x0.d49c1c4a301ed0p-17, -0x0.bcd84f098d1d30p-20, -0x0.b910fc5ca28910p-20, 0x0.9f598ae56f90a0p-22, 0x0.d906feb8abbf48p-25, -0x0.b27bb46ca65268p-25, 0x0.ac525841deddf8p-26, 0x0.e5da0de6b632f8p-29, -0x0.d6a4d0b82e5c60p-28, // x=    5.75 y=    3.25
+ 0x0.b3510de3ca32b8p-4, 0x0.8e3c7de199ec38p-3, -0x0.b22d07b53fcad0p-6, -0x0.a60f1533fd8c68p-7, 0x0.e447fa5b937070p-9, -0x0.868c9a61ead308p-11, -0x0.c8f59b2eae1c30p-12, 0x0.b71f9569ad6e28p-12, 0x0.91acd3a5c19a40p-16, -0x0.9c8c0cff9c54b0p-14, 0x0.8f52919ee9ee58p-18, 0x0.b0a5e2e99764c8p-17, -0x0.c007a3db442640p-20, -0x0.f1147b16790d08p-21, 0x0.86c64f17b092f0p-22, -0x0.a2d0431554e388p-26, -0x0.f246af7e35faa0p-26, 0x0.d58a36394ce048p-26, 0x0.925abdc3ce72f0p-30, -0x0.bda2d20c64efc8p-28, // x=    5.75 y=     3.5
+ 0x0.b81246d4062328p-4, 0x0.88b4fd1276b040p-3, -0x0.af85b67461c578p-6, -0x0.8a9c7ed3ca88d8p-7, 0x0.d2c9f70a6b9138p-9, -0x0.cac22052f66270p-11, -0x0.a35a258d828008p-12, 0x0.bd029d58bb47f8p-12, 0x0.b980c07afe3550p-18, -0x0.8fdb947e0bb6a0p-14, 0x0.b23600d0738cc8p-18, 0x0.8d6e0e0c9617a0p-17, -0x0.b5e178e19b41d8p-20, -0x0.870db224847780p-21, 0x0.d6f27e672dd930p-23, -0x0.88d522fd4affd8p-24, -0x0.91c39b49c21388p-26, 0x0.da7a650fd48f80p-26, -0x0.eb268e543a1308p-32, -0x0.98448af26579b0p-28, // x=    5.75 y=    3.75
+ 0x0.eafade0e120408p-54, 0x0.bf44cd16858828p-3, -0x0.b3e81202c5cb18p-50, -0x0.807ca0ca5835f8p-5, 0x0.87e7b80e034b78p-47, 0x0.af4123ea314f70p-8, -0x0.86fd0b83949390p-45, -0x0.f2dfc8d39723d0p-11, 0x0.c634fe209b4d60p-44, 0x0.ab231d7ce68028p-13, -0x0.e54e02f4628568p-43, -0x0.f57fd0fbb0d1f0p-16, 0x0.d9908dd6c24190p-42, 0x0.b3729ad3340648p-18, -0x0.adfd7be5e7ad80p-41, -0x0.85d9ee2343d9c8p-20, 0x0.ef3a13fd33dde0p-41, 0x0.cc18ce965ef9c0p-23, -0x0.8f79952a3bf2b8p-40, -0x0.9f5ce3c6229868p-25, 0x0.97d587ee559e68p-40, 0x0.ff8927a0274910p-28, -0x0.8f006b4a85bab0p-40, -0x0.d317f7a5b453b8p-30, 0x0.f159acbfaf0640p-41, 0x0.b4897435d87da0p-32, -0x0.b76ccc686f0758p-41, -0x0.a0decaa6e597b8p-34, 0x0.fc09d3ac4e18b0p-42, 0x0.9663e8af1bf998p-36, -0x0.9cf4f0239fb7b0p-42, -0x0.941593171ff5a8p-38, 0x0.b13b0ea61c0908p-43, 0x0.98b0b2d4cc7218p-40, -0x0.b3bcf75c91fb60p-44, -0x0.a18a8777e1d560p-42, 0x0.a9d4a2afcdf710p-45, 0x0.ac7d5fe6c890b0p-44, -0x0.aa75f6d5490190p-46, -0x0.9d43faabfa0eb0p-46, 0x0.c91f79249b3d48p-48, -0x0.bb8c1521676750p-56, // x=       6 y=       0
+ 0x0.bfeeec4a02a708p-7, 0x0.be807b6853d848p-3, -0x0.82520b4d64b538p-8, -0x0.fdcb95816c1768p-6, 0x0.869d318f8592e8p-10, 0x0.aacb261562f7e0p-8, -0x0.fadf86878f3af8p-13, -0x0.e843aa0eb72278p-11, 0x0.de9418d81b3268p-15, 0x0.9f946b177ead38p-13, -0x0.c0b09576b1bd50p-17, -0x0.dd8db9b7615568p-16, 0x0.a4fe86670eb060p-19, 0x0.9b57c6676f0498p-18, -0x0.8cf0e9a75d8ba0p-21, -0x0.dbe103d46fa7a8p-21, 0x0.f1aa13391472b8p-24, 0x0.9cde5281c14aa0p-23, -0x0.d0e75647c2d880p-26, -0x0.e1185a35c0e280p-26, 0x0.b6ca170a302808p-28, 0x0.a1b050879d3148p-28, -0x0.a1369d1c258140p-30, -0x0.eb861c4d46ee70p-31, // x=       6 y=    0.25
+ 0x0.9ec732a85478b0p-6, 0x0.bd2793afca6e30p-3, -0x0.d5f19ec089e240p-8, -0x0.f84247937a11e0p-6, 0x0.da95bb2525e940p-10, 0x0.a31c66dc371d60p-8, -0x0.c8befaf23cc2b8p-12, -0x0.d64145192680f8p-11, 0x0.aed27c2f5bcd68p-14, 0x0.8c507d880c6f30p-13, -0x0.93dab317b9c130p-16, -0x0.b68570f1952af8p-16, 0x0.f5fb2ef5845908p-19, 0x0.ea3ae95adc66f8p-19, -0x0.cac005e44ee058p-21, -0x0.928bc2b404b6b0p-21, 0x0.a6546e0da7d5b8p-23, 0x0.aec90ac06e06f8p-24, -0x0.88189e2f7e1ee8p-25, -0x0.bca1acbb4d8c08p-27, 0x0.de06f2b5a97280p-28, 0x0.a05d10652eff60p-30, // x=       6 y=     0.5
+ 0x0.dbe32065006758p-6, 0x0.bb2bd59b671df8p-3, -0x0.92713cab429ce0p-7, -0x0.f037fd23cc7960p-6, 0x0.93355f414576c8p-9, 0x0.982730abe27150p-8, -0x0.844e543a873658p-11, -0x0.bd27a68b7d26e8p-11, 0x0.e01e549d65fd00p-14, 0x0.e47781aa048768p-14, -0x0.b6fdb7f7d5fde8p-16, -0x0.838ee631aa6d60p-16, 0x0.91a4e3ec1c9420p-18, 0x0.8ac8a0c47e29f0p-19, -0x0.e32c11ed38cf90p-21, -0x0.efd362308f07c0p-23, 0x0.add0e4fe427f08p-23, 0x0.adf9e2914479d0p-27, -0x0.822000697f6578p-25, 0x0.9673647a1473e0p-28, 0x0.bdaefa73a57150p-28, -0x0.8d9da978f0fe20p-29, // x=       6 y=    0.75
+ 0x0.8b59fbdf5a12c0p-5, 0x0.b8982962e0a218p-3, -0x0.b6d363d8a6cb88p-7, -0x0.e5f7843ca5ae58p-6, 0x0.b3e7aa24822d78p-9, 0x0.8a869c193e3608p-8, -0x0.9d26b40b3b1cf0p-11, -0x0.9eee8f42fda6f0p-11, 0x0.80440a0ec8d518p-13, 0x0.a82f5cf407d718p-14, -0x0.c7bdb6daa5b1f8p-16, -0x0.9748ac65eea4c8p-17, 0x0.959668c0193fc0p-18, 0x0.a2f069797d1008p-21, -0x0.d7a5e668019088p-21, 0x0.ae4a0d49e9d418p-24, 0x0.94a77a15ad3398p-23, -0x0.d71ad96c31c1a8p-25, -0x0.c0b6b624863ac0p-26, 0x0.856130005ac710p-26, 0x0.e3005c3bc78d28p-29, -0x0.8759b2ba598590p-28, // x=       6 y=       1
+ 0x0.a75b982ab2d9d0p-5, 0x0.b57a2094f9f158p-3, -0x0.d78a86914635c8p-7, -0x0.d9dafce8185ec8p-6, 0x0.ce9f8042fe75f8p-9, 0x0.f5dc274d2ff530p-9, -0x0.ae4058c84a1db8p-11, -0x0.fb7f346b5907f8p-12, 0x0.87c95569fe0e00p-13, 0x0.d2eb6b3b31b800p-15, -0x0.c6fc56f2425af0p-16, -0x0.ab1747c2d945b0p-19, 0x0.8973e13763e6d8p-18, -0x0.b7eb2a3b826170p-21, -0x0.b14b0806f2bd70p-21, 0x0.aacaab8c985f08p-22, 0x0.cf6fd66a3333a8p-24, -0x0.beb537426fb6f0p-24, -0x0.cb70da96513558p-27, 0x0.b18bd51b4210e0p-26, 0x0.f24e93e7beb890p-31, -0x0.938435e8045e48p-28, // x=       6 y=    1.25
+ 0x0.c1c1047ef06b30p-5, 0x0.b1e144168d8738p-3, -0x0.f43007b7450cb8p-7, -0x0.cc456cd0dac938p-6, 0x0.e301ee7ff8ccc0p-9, 0x0.d431007dbf86e8p-9, -0x0.b7a038666bf4f0p-11, -0x0.b76a003c660d90p-12, 0x0.874efe84be0458p-13, 0x0.b54fa6869713b0p-16, -0x0.b7c8e4ccf9fe98p-16, 0x0.d043f0358a6748p-19, 0x0.e40b857ae3b690p-19, -0x0.e09bce0ab16e10p-20, -0x0.f92011402e29e0p-22, 0x0.f93359b14c00e0p-22, 0x0.d4f722c6c41480p-25, -0x0.df179e02b32330p-24, -0x0.81ca3936989430p-29, 0x0.aec89b701d52e8p-26, -0x0.876fcb3373eb88p-30, -0x0.f2c234f56883d8p-29, // x=       6 y=     1.5
+ 0x0.da617b223ff918p-5, 0x0.adde5a7ad878b8p-3, -0x0.8645ae61c130b8p-6, -0x0.bd9c7d7d504f88p-6, 0x0.f113543a461880p-9, 0x0.b1729e0092e4c0p-9, -0x0.b9dac18f8115a8p-11, -0x0.ea9912ed8734b0p-13, 0x0.802d9f8d0d4dd0p-13, -0x0.857a0660b08d70p-18, -0x0.9e61d1386c2410p-16, 0x0.fd9826476e4f10p-18, 0x0.a96e92b37aeb58p-19, -0x0.9a9d81f5945608p-19, -0x0.8a8de14f2e74e0p-22, 0x0.8b981d3d34d7c8p-21, 0x0.8554f11482ce10p-27, -0x0.d5519331652b28p-24, 0x0.b96147ca528e10p-28, 0x0.8cf6c404245e68p-26, -0x0.89d7dde1896108p-29, -0x0.9b5e5b8a3dc4f8p-29, // x=       6 y=    1.75
+ 0x0.f120cb23a70768p-5, 0x0.a982b58d816748p-3, -0x0.9047541e4c7e68p-6, -0x0.ae42fdd0279320p-6, 0x0.f9278cbf92f550p-9, 0x0.8ee1c77a4dbd48p-9, -0x0.b5ea38a847f8e8p-11, -0x0.e04032e9fc9cd8p-14, 0x0.e82d6a09168ef8p-14, -0x0.d443e8878b49d0p-16, -0x0.fe817f2b2b63d8p-17, 0x0.b2e55ee0b63920p-17, 0x0.d98e0b4ea11530p-20, -0x0.add7dd1fc1cf78p-19, -0x0.a16b78c4487d00p-24, 0x0.86eb281fe1b168p-21, -0x0.c691dd83db0c80p-26, -0x0.b040c527acd858p-24, 0x0.a1a3edb2adae58p-27, 0x0.bbe4d17eff6690p-27, -0x0.9ae56bb5113608p-29, -0x0.876198374a1d18p-30, // x=       6 y=       2
+ 0x0.82f75a01449028p-4, 0x0.a4df928ddea030p-3, -0x0.9828792f13d0f0p-6, -0x0.9e94875ce24fb8p-6, 0x0.fbcde5f56d0e88p-9, 0x0.db14879c4372a0p-10, -0x0.ad028ff823a048p-11, -0x0.df117ba830a7f0p-19, 0x0.c99941d1d93b90p-14, -0x0.af6571ae60d110p-15, -0x0.bcc887a43f6280p-17, 0x0.d10a589c664a50p-17, 0x0.d53963b8683d68p-21, -0x0.ade71d2b81f900p-19, 0x0.8ec307e704fc18p-24, 0x0.ea096b85a98a30p-22, -0x0.b26e9263d49cd8p-25, -0x0.fe0925037682d8p-25, 0x0.b5581a2491dfc8p-27, 0x0.beffb117153690p-28, -0x0.882b9b2d5d7608p-29, 0x0.a8edf0710eced0p-39, // x=       6 y=    2.25
+ 0x0.8c62e54a0263d8p-4, 0x0.a00594955b85c8p-3, -0x0.9e0382a9712940p-6, -0x0.8ee26f34cdb260p-6, 0x0.f9bc39d97cc8b0p-9, 0x0.9c77b7558c2908p-10, -0x0.a069cbc0c827f8p-11, 0x0.b1e55c7610b500p-14, 0x0.a7d96bb65090a8p-14, -0x0.e06a94db7cf5c8p-15, -0x0.fba16d5cf2eef0p-18, 0x0.dc1435580a1700p-17, 0x0.ec0235843fb3c0p-24, -0x0.a0121a5c29fe38p-19, 0x0.ad44215e7e11d0p-23, 0x0.b8969315874aa0p-22, -0x0.d22c3c5e01b740p-25, -0x0.9ae5913ce11cc0p-25, 0x0.a6c7b8c043dac0p-27, 0x0.a8b59f6bc447a8p-30, -0x0.c8c97c354efa98p-30, 0x0.a795c787979b48p-31, // x=       6 y=     2.5
+ 0x0.94d50843b774f8p-4, 0x0.9b045cb5add7b8p-3, -0x0.a1fdec50e0a0f8p-6, -0x0.fee3f52f34c528p-7, 0x0.f3bbaf65315708p-9, 0x0.c62813751587c8p-11, -0x0.915904c1aee238p-11, 0x0.a449474681e5e0p-13, 0x0.859cab20dcf1f8p-14, -0x0.fec2d761ad0158p-15, -0x0.8b9697ce525f80p-18, 0x0.d7ff1d002d6548p-17, -0x0.d9c771af24b3f8p-22, -0x0.89b3a5b5e74378p-19, 0x0.e4ab7029223158p-23, 0x0.83e37c3cc8a6a0p-22, -0x0.ceaf1a7739dfb0p-25, -0x0.8baa7265ea4068p-26, 0x0.85c55bc5304738p-27, -0x0.eb04fbeb865d98p-30, // x=       6 y=    2.75
+ 0x0.9c53b2631e3a68p-4, 0x0.95ea400c6ade88p-3, -0x0.a444a28be9b820p-6, -0x0.e0f75ec8de5cf0p-7, 0x0.ea98af95196958p-9, 0x0.be83764319d308p-12, -0x0.80e76254948e38p-11, 0x0.ded1feec6c7c90p-13, 0x0.c9d458d2e8b150p-15, -0x0.8680d8cd0b39a0p-14, -0x0.b83049cb9ac458p-20, 0x0.c9114a7911d2a0p-17, -0x0.ca775b10255c98p-21, -0x0.ded613a3b53cb8p-20, 0x0.f694836a2e2888p-23, 0x0.a622e994456098p-23, -0x0.b543164da130c0p-25, -0x0.aeaaf8c081a138p-30, 0x0.be029282f8ed50p-28, -0x0.e597049674a258p-29, // x=       6 y=       3
+ 0x0.a2e7f654a23ed0p-4, 0x0.90c419997ab3a8p-3, -0x0.a508bfd32c2078p-6, -0x0.c4570d474f6310p-7, 0x0.df16b9947aa358p-9, 0x0.9d4d1d09bcc3b8p-16, -0x0.dffcddaaec8a30p-12, 0x0.84d860c22c1718p-12, 0x0.8e451e89a28ee0p-15, -0x0.87196caa172438p-14, 0x0.db987b3f22dcf8p-21, 0x0.b345099d1f0670p-17, -0x0.804a41e03f5938p-20, -0x0.a979af25a22750p-20, 0x0.edb6d8d8e375a8p-23, 0x0.a87dc60dac93d8p-24, -0x0.91599aaae64458p-25, 0x0.960caa4dc22298p-27, 0x0.ead9aa0e6af6c0p-29, -0x0.8750bac01f6de8p-28, // x=       6 y=    3.25
+ 0x0.a89d472dd99e00p-4, 0x0.8b9d341dab1988p-3, -0x0.a47cd10de37530p-6, -0x0.a943850571f2f8p-7, 0x0.d1e8151e616988p-9, -0x0.9198ee94d2f590p-12, -0x0.beac1accd83820p-12, 0x0.9349f65dd5eee0p-12, 0x0.b44cc23e4540d8p-16, -0x0.82b86a86b740d0p-14, 0x0.a31e61638da9f8p-19, 0x0.99f3a31e7d1070p-17, -0x0.8b779c61006c38p-20, -0x0.f017eec471c4a8p-21, 0x0.d42eea878dabc0p-23, 0x0.a8fa0aa2fe0c40p-26, -0x0.d6a24b6b352560p-26, 0x0.f758d50770a790p-27, 0x0.e910702d86e920p-30, -0x0.83d720803e7f50p-28, // x=       6 y=     3.5
+ 0x0.a530539fe94c98p-58, 0x0.b791010fe855a0p-3, -0x0.83a282a36de908p-54, -0x0.ec692b4c2468d8p-6, 0x0.cf363ee5f78638p-52, 0x0.9a59ae1895bdd0p-8, -0x0.d6ad880d87c0a0p-50, -0x0.cc7ad8eb852308p-11, 0x0.a4989673987058p-48, 0x0.89836c3185a230p-13, -0x0.c72045d2b4fb68p-47, -0x0.bbee2cf8645f70p-16, 0x0.c5dae850e92e70p-46, 0x0.829951846e6908p-18, -0x0.a5f757baa8b300p-45, -0x0.b8cabf8620db28p-21, 0x0.efc6d6c74e9c30p-45, 0x0.8541f8d39e2cb8p-23, -0x0.9766b1f0f11718p-44, -0x0.c42d7932c1ab98p-26, 0x0.a90f0d67e8c980p-44, 0x0.93a818054dcd78p-28, -0x0.a86d5213887900p-44, -0x0.e3c84c212465e0p-31, 0x0.96c6fa18948160p-44, 0x0.b492c3708e02a8p-33, -0x0.f3ee784040c128p-45, -0x0.93b52fa319ff00p-35, 0x0.b3128e31ba80d0p-45, 0x0.faadba24dc4cc0p-38, -0x0.ef691b62d1f078p-46, -0x0.de166e236e9bb8p-40, 0x0.920a54ced58dd8p-46, 0x0.ce889f974d5790p-42, -0x0.a0e46f458bc048p-47, -0x0.c9869f3ff8de68p-44, 0x0.a1ed37ecbe7450p-48, 0x0.ce9ac0097c02c0p-46, -0x0.c33196af1194d8p-49, -0x0.d86b62744e9be8p-48, 0x0.b4a215b4445c68p-50, 0x0.d46c643cbf8600p-51, // x=    6.25 y=       0
+ 0x0.b0a30a70be3f88p-7, 0x0.b6e4097d42ba98p-3, -0x0.e5b94cf963aaa8p-9, -0x0.e9bbaac86ffce0p-6, 0x0.e2f8826649abf8p-11, 0x0.96c311bd930d60p-8, -0x0.ca04e5cf7a0370p-13, -0x0.c45840686fba48p-11, 0x0.aaf19da9b8fbc8p-15, 0x0.811504714796f8p-13, -0x0.8ce84b832b6f48p-17, -0x0.ab586b1ad70ef8p-16, 0x0.e5559b8e05f5d8p-20, 0x0.e592e3d6db3700p-19, -0x0.b9ca7aa1eee200p-22, -0x0.9b2a673b3989f8p-21, 0x0.96b4dd2652f278p-24, 0x0.d371e716dfbee8p-24, -0x0.f5cc6b74289400p-27, -0x0.910efd06b47ce0p-26, 0x0.c779f7586885c0p-29, 0x0.c95b422d03b6c8p-29, // x=    6.25 y=    0.25
+ 0x0.9236c891898f58p-6, 0x0.b5b3d856b33fe0p-3, -0x0.bcd02772659380p-8, -0x0.e50f6c36e9b1a0p-6, 0x0.b8b52aa7644b28p-10, 0x0.909055495eb228p-8, -0x0.a243f7c5a0ba98p-12, -0x0.b679480bedc110p-11, 0x0.870a0dbece4178p-14, 0x0.e5def9bb6240a8p-14, -0x0.da0f8e420540f8p-17, -0x0.900f339d74b5c8p-16, 0x0.acffa5df1a3840p-19, 0x0.b2c4fc43219ef8p-19, -0x0.87e07007001278p-21, -0x0.d9d6ba7b632320p-22, 0x0.d44a9dbb2f03d8p-24, 0x0.8069bc96e1d9d0p-24, -0x0.a55e9819d6ed28p-26, -0x0.8e292bc584ff38p-27, 0x0.806617e1620ca0p-28, 0x0.8b82a5510781a0p-30, // x=    6.25 y=     0.5
+ 0x0.caabaefceaf330p-6, 0x0.b3f3503c483a38p-3, -0x0.817d279980dac8p-7, -0x0.de412934f4a848p-6, 0x0.f9a3b2e09b2fc8p-10, 0x0.87ae9889f8fad0p-8, -0x0.d71359c27d57e8p-12, -0x0.a30123ef6307a0p-11, 0x0.ae9523a50bb090p-14, 0x0.bf2be02d9903b8p-14, -0x0.889e59a9ebede0p-16, -0x0.d7d042b3077b30p-17, 0x0.d084d4f1ade8d8p-19, 0x0.e40f61f4b25cc8p-20, -0x0.9c1846f1c3d8b0p-21, -0x0.d2eec4b7d296e0p-23, 0x0.e5c6d20da0a908p-24, 0x0.8517c8da239998p-26, -0x0.a62601af9bbc60p-26, 0x0.f7d394e1b7d068p-31, 0x0.eb8188d725d788p-29, -0x0.e940ed7016f5a0p-31, // x=    6.25 y=    0.75
+ 0x0.8097552e601f40p-5, 0x0.b1ab49460c6718p-3, -0x0.a20faa6367bae8p-7, -0x0.d58af02f33eb70p-6, 0x0.9937b457ffe388p-9, 0x0.f92206a390ea38p-9, -0x0.80a5cc73a38b30p-11, -0x0.8b5589f5a0fb40p-11, 0x0.ca07ab3378e068p-14, 0x0.91ceebc6d95c20p-14, -0x0.978f8a786afff0p-16, -0x0.86d7ccce3a10b8p-17, 0x0.db480755d27fc0p-19, 0x0.b63c655dc71210p-21, -0x0.9958f9c633df80p-21, 0x0.a3f7e5d7561a98p-27, 0x0.ceb23421010560p-24, -0x0.d06cf1868b2b90p-26, -0x0.84e578d38ab998p-26, 0x0.8cc2f95dbebe48p-27, 0x0.9ffa1478501eb0p-29, -0x0.9071c3d4299578p-29, // x=    6.25 y=       1
+ 0x0.9aa72d0fd58d98p-5, 0x0.aee6d5ba849cd8p-3, -0x0.bfa13e18c03fc0p-7, -0x0.cb335f1d7f5550p-6, 0x0.b0e7c83554d540p-9, 0x0.df7d59c75827b8p-9, -0x0.8fe0c1525c4410p-11, -0x0.e20f23c0ea9780p-12, 0x0.d8bd1c0c5ed050p-14, 0x0.c37f25564d9c18p-15, -0x0.9a0cfdb438bd50p-16, -0x0.d8a320d13a3410p-19, 0x0.cfb0e96e3e2198p-19, -0x0.8b894e596d9148p-22, -0x0.841f689f264e20p-21, 0x0.c12a5ce1b2f840p-23, 0x0.9bd668253a1f58p-24, -0x0.e1af537661b698p-25, -0x0.a2ea3634f269c8p-27, 0x0.d32f13254edf38p-27, 0x0.847bba2e6d9710p-30, -0x0.af32a316244e28p-29, // x=    6.25 y=    1.25
+ 0x0.b3560db64ad748p-5, 0x0.abb2bbf424ee88p-3, -0x0.d9d68db9686fb8p-7, -0x0.bf88fb5d2fce08p-6, 0x0.c3897ed7cc35c8p-9, 0x0.c38dafbc713fe8p-9, -0x0.992035bfa02fa0p-11, -0x0.ab4f12cd520a78p-12, 0x0.db5c6ffe66a990p-14, 0x0.ca9a45414894e0p-16, -0x0.91c7e623b1c6f0p-16, 0x0.966be263cdb508p-20, 0x0.b329806dd40ed8p-19, -0x0.88c23d373f35f8p-20, -0x0.c6ebe7fdb547f8p-22, 0x0.9f03f86bb566f8p-22, 0x0.ba74a11ee450c8p-25, -0x0.8f71495e743148p-24, -0x0.e1bd753e47a138p-29, 0x0.e19d89de6e1f48p-27, -0x0.f4ebd8c6d88dc8p-33, -0x0.9f102e32e5d078p-29, // x=    6.25 y=     1.5
+ 0x0.ca7eb662031740p-5, 0x0.a81ce8080e8d68p-3, -0x0.f077f3a3347ed8p-7, -0x0.b2dd8a0a75d010p-6, 0x0.d10c4804a1fdb0p-9, 0x0.a66c2159ded1c0p-9, -0x0.9cb4a56b37d308p-11, -0x0.ea8078bf3cede8p-13, 0x0.d389177d5cf840p-14, 0x0.ef78992b277e50p-19, -0x0.816128acbcf9c8p-16, 0x0.9ddf2c657a3ff0p-18, 0x0.8c69b06a2b9368p-19, -0x0.cfc31e11e0aab0p-20, -0x0.fad8d5c17e7608p-23, 0x0.be3a1656850f00p-22, 0x0.83c9c555fd41d8p-26, -0x0.927ac06b570cd8p-24, 0x0.f1b1bc8b357638p-30, 0x0.c59219f2a2c048p-27, -0x0.88fe5bb7191ff8p-30, -0x0.e6ef7709f9bdd0p-30, // x=    6.25 y=    1.75
+ 0x0.e00619c09cfd90p-5, 0x0.a433dff72f7cf8p-3, -0x0.81b7d1db54a8d0p-6, -0x0.a581d657b48358p-6, 0x0.d99df6d5110ff0p-9, 0x0.891aa53db62198p-9, -0x0.9b3f942c0bf098p-11, -0x0.8473a205b7e908p-13, 0x0.c3801cc5f80e98p-14, -0x0.ed65fc0444a0e0p-17, -0x0.d7a3c32f896940p-17, 0x0.f74eb1743b1810p-18, 0x0.c3e731c82f5270p-20, -0x0.f7179cf0b04548p-20, -0x0.df3fdbab0ed758p-24, 0x0.c1ee3f9b8742f0p-22, -0x0.fb4e29fb61e3c8p-28, -0x0.81568ff274eca0p-24, 0x0.ac86a1ab392c90p-28, 0x0.921c165a91c068p-27, -0x0.b608e223ab1ad8p-30, -0x0.804d6d34289b28p-30, // x=    6.25 y=       2
+ 0x0.f3db0480abd970p-5, 0x0.a0064337eb17c8p-3, -0x0.8962f88438a138p-6, -0x0.97c232039e56a0p-6, 0x0.dd9d8407ca1b98p-9, 0x0.d8ef351bf292c0p-10, -0x0.95963bfc88bb80p-11, -0x0.9fd5ca70674c18p-15, 0x0.adb7c8f83f9718p-14, -0x0.eea6d1757212f0p-16, -0x0.a7dc2bb4d8f0e0p-17, 0x0.989a78c6554618p-17, 0x0.e441032a232850p-21, -0x0.812af342490e08p-19, 0x0.81cb9195830c68p-28, 0x0.b127bc99eb4cd8p-22, -0x0.c2c5b338e80220p-26, -0x0.c9ad7da38545d0p-25, 0x0.df0eaccf4f10e0p-28, 0x0.b166fe8e707c20p-28, // x=    6.25 y=    2.25
+ 0x0.82fab0e9efece0p-4, 0x0.9ba25bd111b050p-3, -0x0.8f4e2e4de54320p-6, -0x0.89e3d7734cf898p-6, 0x0.dd8c6fd15e6278p-9, 0x0.a26d882f6fe860p-10, -0x0.8ca589c3770b08p-11, 0x0.a2d354ef380060p-15, 0x0.9490eb9f724328p-14, -0x0.a445d4a8bc8de0p-15, -0x0.f047c70f9059e8p-18, 0x0.a71b35ffd82a18p-17, 0x0.aade91e7be98e0p-22, -0x0.f7952cf5babda0p-20, 0x0.b1cd92b0816000p-24, 0x0.93d60b08620658p-22, -0x0.8458ac26c6ac20p-25, -0x0.899d6e13240820p-25, 0x0.e168761f16bf20p-28, 0x0.959ff0fa249b90p-29, // x=    6.25 y=     2.5
+ 0x0.8b2a9d66cf29a0p-4, 0x0.9715c48ee6dd28p-3, -0x0.939409cdc98df0p-6, -0x0.f8466844564da8p-7, 0x0.da009813619800p-9, 0x0.df7c8247f4c1d8p-11, -0x0.815aa3c419ed00p-11, 0x0.d8ca59e98af7f0p-14, 0x0.f4416024670848p-15, -0x0.c2c958d22771e0p-15, -0x0.97eae66f404c70p-18, 0x0.a984b000d05fe8p-17, -0x0.e736639a430300p-24, -0x0.ddbce1f25add80p-20, 0x0.8e6571f0a85d38p-23, 0x0.e23c4b6a5982d8p-23, -0x0.8dbe28a2575f10p-25, -0x0.9b79ed87d7dbe8p-26, 0x0.c475d072767020p-28, -0x0.caa59a18dffb70p-34, // x=    6.25 y=    2.75
+ 0x0.9280c65db8a298p-4, 0x0.926d2571215028p-3, -0x0.9656349346bb48p-6, -0x0.dd66125fc03bb0p-7, 0x0.d397c7f32013d0p-9, 0x0.83326a8ce8b6d0p-11, -0x0.e9230f1e0410a8p-12, 0x0.a2e69e47129d00p-13, 0x0.c026605599dd90p-15, -0x0.d459797a402f80p-15, -0x0.96183863bd6a08p-19, 0x0.a2a666d333ed78p-17, -0x0.e11ee14df93c80p-22, -0x0.bb4aa81fc6c438p-20, 0x0.a86ecab10176d0p-23, 0x0.9cef8571e0ad48p-23, -0x0.851803e45c9e50p-25, -0x0.e3df6178c566c0p-28, 0x0.986b85c729eaa0p-28, -0x0.d694a3f7db4b10p-30, // x=    6.25 y=       3
+ 0x0.ccf648a2de4cb0p-63, 0x0.b077d399d0d770p-3, -0x0.a9bbf426e01780p-59, -0x0.da405ca60b8188p-6, 0x0.8af5b99eebd6e0p-56, 0x0.88af23f615fa30p-8, -0x0.95e61289551220p-54, -0x0.ad79e8cb6866e0p-11, 0x0.ef95b319862878p-53, 0x0.df3a1a4b8f6118p-14, -0x0.973adf53a49e48p-51, -0x0.91b5d95bb779f8p-16, 0x0.9d0019cb4adc10p-50, 0x0.c120e783b009a0p-19, -0x0.89c99abeffd490p-49, -0x0.820ccc79f07fd0p-21, 0x0.d095e512ed7b28p-49, 0x0.b22259323250a8p-24, -0x0.8a3b7e8a7fd9d0p-48, -0x0.f86cbe6c826378p-27, 0x0.a24ca3f5bd6f38p-48, 0x0.b097b6643dd798p-29, -0x0.aa5d22d8c780b0p-48, -0x0.802a44d5dd32b0p-31, 0x0.a10f65c82f5c58p-48, 0x0.be4c3df52d8458p-34, -0x0.89f29873e68e08p-48, -0x0.90dce4cab687d8p-36, 0x0.d71915703bda20p-49, 0x0.e2e2cd9ecfbec8p-39, -0x0.9937a9cc8e12a8p-49, -0x0.b79506793e7ae0p-41, 0x0.c80153ce4917f0p-50, 0x0.9a580a8bced438p-43, -0x0.efb93740b5fb20p-51, -0x0.879ebeeac77a68p-45, 0x0.82db7c19602d80p-51, 0x0.f9d3f2722eb0f0p-48, -0x0.815f33dba195b0p-52, -0x0.f222bf2420b840p-50, 0x0.9d8119c14b0430p-53, 0x0.f78671c1d89870p-52, -0x0.abc29cec890b68p-54, -0x0.9473b9aa74a500p-54, // x=     6.5 y=       0
+ 0x0.a31e70656e7508p-7, 0x0.afde9b4b310270p-3, -0x0.cb9026e6adc620p-9, -0x0.d7fa763de6b980p-6, 0x0.c0c775a344ff68p-11, 0x0.85c4db4d827ae8p-8, -0x0.a445fa3bc6c050p-13, -0x0.a728f248440df8p-11, 0x0.84e8afa5165468p-15, 0x0.d2bbe8a127d368p-14, -0x0.d13573f87082f8p-18, -0x0.860186274bab80p-16, 0x0.a24dcd18ac0270p-20, 0x0.abe943072ed250p-19, -0x0.fa460c8be05960p-23, -0x0.de63fa0e37ae38p-22, 0x0.c0d70388df3718p-25, 0x0.90f9a8a683f120p-24, -0x0.9510c43ad4d650p-27, -0x0.be5d56a27d7d48p-27, 0x0.e4a9cc617b5ca8p-30, 0x0.fcea1cc90da3e0p-30, // x=     6.5 y=    0.25
+ 0x0.8718d79192f7f0p-6, 0x0.aed0e6e1048758p-3, -0x0.a7808dfab82eb0p-8, -0x0.d40165976a0d10p-6, 0x0.9d334170bcd368p-10, 0x0.80b880c89c8bd0p-8, -0x0.84603f1bf24190p-12, -0x0.9c595af00ce268p-11, 0x0.d303aaa8881ae0p-15, 0x0.bda81fa8b361e0p-14, -0x0.a306a9dcb04980p-17, -0x0.e5339839593960p-17, 0x0.f74df425b1db80p-20, 0x0.8976a73421bc68p-19, -0x0.b98c52060bb728p-22, -0x0.a2add6a958afd8p-22, 0x0.8a5d687a1cdf88p-24, 0x0.bc04908854de20p-25, -0x0.cdad4ee948b5b0p-27, -0x0.d0458ab7bf8020p-28, 0x0.9845f9c64950d8p-29, 0x0.d6ff604ab8c588p-31, // x=     6.5 y=     0.5
+ 0x0.bb68e2f5d5f2c8p-6, 0x0.ad42a94eee6380p-3, -0x0.e621f3a1257f98p-8, -0x0.ce3466d27de658p-6, 0x0.d517e94e1fefb0p-10, 0x0.f2ea6032797048p-9, -0x0.b04bdcc1c2c5c0p-12, -0x0.8d154ccc5e2818p-11, 0x0.896355cb0cb658p-14, 0x0.a09332533cf228p-14, -0x0.ce6c510408d508p-17, -0x0.b1256d13af6c10p-17, 0x0.9742e3ee7189a0p-19, 0x0.b9a31284933c18p-20, -0x0.d9980c75a120a0p-22, -0x0.b0e00888de2558p-23, 0x0.9a166f4aec3530p-24, 0x0.86fb5cb4ebaeb0p-26, -0x0.d6f14726587ae8p-27, -0x0.83c01a2dd76490p-31, 0x0.93849315a47fc8p-29, -0x0.aa4b8517913c28p-32, // x=     6.5 y=    0.75
+ 0x0.ee0fd0b7324650p-6, 0x0.ab3b1ea5f38328p-3, -0x0.9052cba075d5e0p-7, -0x0.c6c1054897b900p-6, 0x0.834a5ed54af010p-9, 0x0.e0a302dc9ac550p-9, -0x0.d4360d903aa428p-12, -0x0.f4bd1203d4bd48p-12, 0x0.a07cddd9bc1a30p-14, 0x0.fc253edb33d190p-15, -0x0.e82d0d4725d8a8p-17, -0x0.ebb0717dfd25e8p-18, 0x0.a24061c6fe0c98p-19, 0x0.b1cb92840c9e00p-21, -0x0.dbe6fcef28f298p-22, -0x0.cdd13fa6116c08p-26, 0x0.905eb7659147c8p-24, -0x0.b7d630b3eba0f8p-27, -0x0.b68b19327415e8p-27, 0x0.92d26bc3e470f8p-28, 0x0.dbd6686f3eac68p-30, -0x0.9a8547ef13fe50p-30, // x=     6.5 y=       1
+ 0x0.8f556aaa7e69e8p-5, 0x0.a8c361faa26700p-3, -0x0.ab1a3e38423830p-7, -0x0.bddf1b66883988p-6, 0x0.984a98c319b9a8p-9, 0x0.cb6883c7065d08p-9, -0x0.ef1d7534844300p-12, -0x0.cab5ff4d93f640p-12, 0x0.ae2846b0e66128p-14, 0x0.b1e87947db5fe0p-15, -0x0.f0108d34bdb940p-17, -0x0.e5ac49584c30f0p-19, 0x0.9da04bad7791f0p-19, -0x0.c3dba6afad52f8p-26, -0x0.c4d7ad22ca4b50p-22, 0x0.d2f6b83ac2d8e8p-24, 0x0.e72eccc97c7a98p-25, -0x0.85050f27bae300p-25, -0x0.f86dc6606f6610p-28, 0x0.fb87ac0c82f608p-28, 0x0.e4a218f13e9998p-31, -0x0.cfe61a4fbdb450p-30, // x=     6.5 y=    1.25
+ 0x0.a67305a170e700p-5, 0x0.a5e6074aa9c2a8p-3, -0x0.c316af41e447c0p-7, -0x0.b3cd68793ac3b0p-6, 0x0.a93a7c13170de0p-9, 0x0.b418419b05abc8p-9, -0x0.8058d0f2a66608p-11, -0x0.9e6d2d2bc4f1a8p-12, 0x0.b2a70d1e88af28p-14, 0x0.cf8f2bf33ea5e0p-16, -0x0.e7ecde5418a948p-17, -0x0.9968aefea39da0p-24, 0x0.8c730502195aa8p-19, -0x0.a199684a185450p-21, -0x0.9c6686e72cd4a8p-22, 0x0.ca1d6973e0d730p-23, 0x0.998dfca9836888p-25, -0x0.b8505f562352f8p-25, -0x0.e94a5241f72490p-29, 0x0.90ff007a89f718p-27, 0x0.cc54b696330ef0p-34, -0x0.cd661c0aef0f50p-30, // x=     6.5 y=     1.5
+ 0x0.bc3ede012402f8p-5, 0x0.a2aead77dd66a0p-3, -0x0.d8134e24908eb0p-7, -0x0.a8ce139fcce1a8p-6, 0x0.b5fe9059b55d08p-9, 0x0.9b8f7c304d3c78p-9, -0x0.84a09d0ea6a3f8p-11, -0x0.e4230468877818p-13, 0x0.aef59424ebf438p-14, 0x0.8926a0ec77b1b8p-17, -0x0.d30330e6666d38p-17, 0x0.bb7ab066ce2ad8p-19, 0x0.e5c563ffd301d8p-20, -0x0.8ab4ee66b240c8p-20, -0x0.d75596553ef5a8p-23, 0x0.815155f4462508p-22, 0x0.92b9953fca2948p-26, -0x0.c80e0e80993e78p-25, 0x0.b038a80f3fbe70p-37, 0x0.88407d95398da8p-27, -0x0.f9d1372f67a198p-32, -0x0.a45c7fbf4bfbc0p-30, // x=     6.5 y=    1.75
+ 0x0.d09f67fc4fafa0p-5, 0x0.9f299038d2fc68p-3, -0x0.e9f638247450e0p-7, -0x0.9d236a5d942408p-6, 0x0.beac3fca390048p-9, 0x0.829dd460c90ac8p-9, -0x0.84cd074b4dc2c0p-11, -0x0.8f037c187f0410p-13, 0x0.a48ddcf3ee6530p-14, -0x0.d9771ea3290520p-18, -0x0.b54498176458f8p-17, 0x0.a8ebbbdaed3bb0p-18, 0x0.aa855436572640p-20, -0x0.aefeca062d64b0p-20, -0x0.eb12423deba998p-24, 0x0.8aa1f5018229c8p-22, 0x0.ec7f36cc945798p-31, -0x0.bb28656b3d6f90p-25, 0x0.aa703d4d16a190p-29, 0x0.dab0a03dbebc00p-28, -0x0.cf03dd2ead4770p-31, -0x0.d46531d715c570p-31, // x=     6.5 y=       2
+ 0x0.e3833ddb2305e8p-5, 0x0.9b6320b4a5c820p-3, -0x0.f8be18bd08cea8p-7, -0x0.910d156403e1b8p-6, 0x0.c3811b72ef4708p-9, 0x0.d3f6571e5ec158p-10, -0x0.81711e834e7910p-11, -0x0.80d48dc995f088p-14, 0x0.9527890948fdd0p-14, -0x0.9d00059f2e2280p-16, -0x0.92a989eca2f7c8p-17, 0x0.dd913dae5547c0p-18, 0x0.dd676d745ac008p-21, -0x0.befbc16260e088p-20, -0x0.fa4b5d14344cc8p-26, 0x0.84a9626e0a7040p-22, -0x0.c0cadf76233490p-27, -0x0.9b97e2dc191e70p-25, 0x0.84fa5a41a65c90p-28, 0x0.9552bec120dc48p-28, // x=     6.5 y=    2.25
+ 0x0.f4e0a68ee69b38p-5, 0x0.9767a9d69b8280p-3, -0x0.823f60955ba8e8p-6, -0x0.84c5e6ae6bb120p-6, 0x0.c4d8a9aebabf48p-9, 0x0.a482716bdfcfc0p-10, -0x0.f670e3460b4c50p-12, 0x0.b32b19d2a263c0p-18, 0x0.827fb192b11340p-14, -0x0.ed6b3a1f7a4120p-16, -0x0.dd6b6fd0118780p-18, 0x0.fc97b68d0cac08p-18, 0x0.dfe4f5fd610038p-22, -0x0.be0839b634bf78p-20, 0x0.927745fca151c0p-25, 0x0.e85eb8c2d391b8p-23, -0x0.a0cda4e69e31d0p-26, -0x0.e69ff3a41afb38p-26, 0x0.9453d1467f7310p-28, 0x0.a1f622c3aa88d0p-29, // x=     6.5 y=     2.5
+ 0x0.e06de669f56608p-68, 0x0.a9e78d2e6546c8p-3, -0x0.c0de72030ee3b0p-64, -0x0.ca2168e516b410p-6, 0x0.a3fe4e2dcce0e0p-61, 0x0.f34a3d9e8efe50p-9, -0x0.b7e417346a7240p-59, -0x0.94330143ae8a58p-11, 0x0.98e8117f9d1328p-57, 0x0.b6d6c8dc4ff7c8p-14, -0x0.c90d4a19a5daf0p-56, -0x0.e48ebc2a37dc38p-17, 0x0.d9a138c8164940p-55, 0x0.90d408ffab0f70p-19, -0x0.c761f70bd33070p-54, -0x0.ba341e2fa5f070p-22, 0x0.9dbe1cc1a81c30p-53, 0x0.f30c0f1478b338p-25, -0x0.dad7907be23598p-53, -0x0.a12c690dd3d250p-27, 0x0.86adfd41cd93b8p-52, 0x0.d9682315158e70p-30, -0x0.94746f6fbaa768p-52, -0x0.954c1da49b5d80p-32, 0x0.93a86acfaa9448p-52, 0x0.d10e549f1d3700p-35, -0x0.85565fd5522038p-52, -0x0.957722d943a468p-37, 0x0.dbb98b6a55ccc0p-53, 0x0.daafb38a8dd8f0p-40, -0x0.a5db951ac1a4d0p-53, -0x0.a4218629d24b30p-42, 0x0.e6230ba096f6e0p-54, 0x0.fda7ac3601d438p-45, -0x0.931db5142e83a0p-54, -0x0.cabe60f9ce8230p-47, 0x0.ada3f9e8022260p-55, 0x0.a88d359b511f10p-49, -0x0.bc825661e9dc48p-56, -0x0.926eb130b35a50p-51, 0x0.b81affb501e8d8p-57, 0x0.858a9441417bf0p-53, -0x0.db0e74a221f5e0p-58, -0x0.8272b818570988p-55, 0x0.91771d98e84560p-58, 0x0.b4c860b249a968p-58, // x=    6.75 y=       0
+ 0x0.971c6fb972f1b0p-7, 0x0.a95f26b8ed30f0p-3, -0x0.b544be2b38c078p-9, -0x0.c8300c51086d78p-6, 0x0.a4dade41046fc8p-11, 0x0.ee82be7db89160p-9, -0x0.86c4598ebc51a0p-13, -0x0.8f3d5525c50ab0p-11, 0x0.d0f9bbe256b128p-16, 0x0.ad745f48a8ecb8p-14, -0x0.9d6c1a1b5c3a30p-18, -0x0.d3c29808771208p-17, 0x0.e97b84fa7cd500p-21, 0x0.824ed52806a278p-19, -0x0.abd4afc1f67798p-23, -0x0.a1a2ac59ffba60p-22, 0x0.fc5ca93e79c640p-26, 0x0.c9ff87e944a970p-25, -0x0.b9995a43381af8p-28, -0x0.fe39577bfeb820p-28, 0x0.871de827b77088p-30, 0x0.a1ce4289969290p-30, // x=    6.75 y=    0.25
+ 0x0.fa6c412829a3a0p-7, 0x0.a86edd675b0c40p-3, -0x0.954e67aa3f2978p-8, -0x0.c4c98a17cb95a0p-6, 0x0.86aab49a87ff00p-10, 0x0.e63752dac90938p-9, -0x0.d9cf123fa566c8p-13, -0x0.86b903858a8348p-11, 0x0.a696dfa6eeed30p-15, 0x0.9d8c1e93984ec8p-14, -0x0.f6d2a1419cf8b0p-18, -0x0.b7babfc8366320p-17, 0x0.b35f8a3de204f0p-20, 0x0.d50cb6200fbc88p-20, -0x0.80d98b514ce7d0p-22, -0x0.f48baa04bd1c80p-23, 0x0.b7dbec24748c00p-25, 0x0.89ea9b2f8e4118p-25, -0x0.82abc92c511740p-27, -0x0.96f55b42ec5a48p-28, 0x0.b8df7546bc8340p-30, 0x0.9dfb41066bbdf0p-31, // x=    6.75 y=     0.5
+ 0x0.add15a1f98dc70p-6, 0x0.a70b9fc216aab0p-3, -0x0.cd6f6a54e205b0p-8, -0x0.bfcfc2129b23a8p-6, 0x0.b705ad203de1d8p-10, 0x0.da3dbb8e358850p-9, -0x0.91a38c835f1348p-12, -0x0.f5446de50aa558p-12, 0x0.da4745773474b8p-15, 0x0.876f640fe047e0p-14, -0x0.9daaaa2dea6dc0p-17, -0x0.91bdaf29fdc458p-17, 0x0.de30b247b52990p-20, 0x0.9686172321bdb0p-20, -0x0.99bb90a4004a10p-22, -0x0.90c6e1fb328188p-23, 0x0.d19fbd2ea73068p-25, 0x0.f0bb5771ba63c0p-27, -0x0.8cfdde0b912a20p-27, -0x0.8074a6b4ddf700p-30, 0x0.bb12828fa48400p-30, -0x0.a7b7a37f215c30p-34, // x=    6.75 y=    0.75
+ 0x0.dcff62293dd9f0p-6, 0x0.a53b65117db280p-3, -0x0.8114d4f877cfa0p-7, -0x0.b966c9566027e8p-6, 0x0.e24976bb1d2e78p-10, 0x0.cb19bb8d5719f8p-9, -0x0.b0415c0c65b7c0p-12, -0x0.d76a5d5fcaa348p-12, 0x0.8087a9ba05c008p-14, 0x0.d9dbb4572a83d8p-15, -0x0.b3721d8d9e1cf0p-17, -0x0.cba8ef24941c08p-18, 0x0.f2609246389540p-20, 0x0.a2cc1fbaa95e30p-21, -0x0.9f170d2e8dbbe0p-22, -0x0.a160de45b9a3d0p-25, 0x0.cb1565ddcc1938p-25, -0x0.fde46b079701a8p-29, -0x0.fb38e60311fab0p-28, 0x0.95684bc58db420p-29, 0x0.959a953e58ebc8p-30, -0x0.a54af8aba93820p-31, // x=    6.75 y=       1
+ 0x0.8534ebede13d58p-5, 0x0.a305b8b97dbb00p-3, -0x0.9962f039c809f0p-7, -0x0.b1bb3045ef77b8p-6, 0x0.83c6fc559f1750p-9, 0x0.b96959e4d02e70p-9, -0x0.c7e78c3a272a08p-12, -0x0.b597643c76bb48p-12, 0x0.8cdfaf1f62db10p-14, 0x0.a0118b2491e390p-15, -0x0.bc4b714671d830p-17, -0x0.e0ea4ebfb7b230p-19, 0x0.f09711ec74d728p-20, 0x0.de0bc1a5ed31d8p-24, -0x0.92fdc5698c6a28p-22, 0x0.d7d9d6f37192f8p-25, 0x0.aa9bd4a8fdedb8p-25, -0x0.9b95456155f330p-26, -0x0.b8d19454fa5868p-28, 0x0.960aed026cf990p-28, 0x0.b3f6a2fb99a1b0p-31, -0x0.f74fd84be3a910p-31, // x=    6.75 y=    1.25
+ 0x0.9ae3257216f858p-5, 0x0.a0736bb5dc47d8p-3, -0x0.af5b2a9230c240p-7, -0x0.a8ff7a7fce78b8p-6, 0x0.931f8315513718p-9, 0x0.a5d8f8b486e740p-9, -0x0.d83ccec255e150p-12, -0x0.91904f46fe3c38p-12, 0x0.9236e7f44f3e80p-14, 0x0.cad95afd3fc928p-16, -0x0.b92ca2314ccf48p-17, -0x0.cc500a7475ebb0p-21, 0x0.dc49465986d308p-20, -0x0.b5531478eadb10p-22, -0x0.f3f7e1cf301648p-23, 0x0.ff47e5ac6aae68p-24, 0x0.f4d0e90a500ae8p-26, -0x0.ecdcd1476ab660p-26, -0x0.ceb37d7d31a3f8p-29, 0x0.ba3c68c33f19b0p-28, 0x0.daa74ba10c9d40p-33, -0x0.83bcd5224848a0p-30, // x=    6.75 y=     1.5
+ 0x0.af6bb1f006fef8p-5, 0x0.9d8e3ee647dc00p-3, -0x0.c2cc7c98a937d0p-7, -0x0.9f697c70a74a50p-6, 0x0.9f0df8cbf03520p-9, 0x0.9117a91aef1ab0p-9, -0x0.e15ea56fa142b8p-12, -0x0.da0a6618d46698p-13, 0x0.9122569157b058p-14, 0x0.b57ec4f2f77ae0p-17, -0x0.ac18e3ff490ef8p-17, 0x0.cc58dcd6112e00p-20, 0x0.baa351dd693cb0p-20, -0x0.b797d13f853b60p-21, -0x0.b36013fe3d6d08p-23, 0x0.af8f7bb7ac9a48p-23, 0x0.8a8df00b54a020p-26, -0x0.88473ab6df40b8p-25, -0x0.cb808d0d61e008p-31, 0x0.ba4a3701827858p-28, -0x0.bf75cd9d30c6f8p-33, -0x0.e4524010152b28p-31, // x=    6.75 y=    1.75
+};
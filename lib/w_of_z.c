@@ -73,9 +73,11 @@ EXPORT int cerf_algorithm;
 EXPORT int cerf_nofterms;
 #endif
 
-#include "w_taylor_cover.c" // -> static const int Cover[]
-#include "w_taylor_centers.c" // -> static const int Centers[]
-#include "w_taylor_coeffs.c"  // -> static const int NTay; static const double TaylorCoeffs[]
+#include "cerf_inline.h" // series and Taylor kernels, with their tables
+
+#ifdef CERF_W_CHEB
+#include "w_cheb_tiles.c" // -> static const int NChebDiv, NChebAx; ChebTiles[]; ChebCoeffs[]
+#endif
 
 /******************************************************************************/
 /*  w_of_z, Faddeeva's scaled complex error function                          */
@@ -140,57 +142,9 @@ _cerf_cmplx w_of_z(_cerf_cmplx z) {
 // ------------------------------------------------------------------------------
 
     if (z2 < .053) {
-        if (z2 < .00689) {
-            if (z2 < 4e-7) {
-		SET_INFO(210, 5);
-                return ((((
-                              + C(+5.0000000000000000e-01, 0) ) * z // z^4
-                          + C(0, -7.5225277806367508e-01) ) * z // z^3
-                         + C(-1.0000000000000000e+00, 0) ) * z // z^2
-                        + C(0, +1.1283791670955126e+00) ) * z // z^1
-                    + 1.;
-            }
-
-	    SET_INFO(210, 14);
-            return (((((((((((((
-                                   + C(0, +5.3440090793734269e-04) ) * z // z^13
-                               + C(+1.3888888888888889e-03, 0) ) * z // z^12
-                              + C(0, -3.4736059015927274e-03) ) * z // z^11
-                             + C(-8.3333333333333332e-03, 0) ) * z // z^10
-                            + C(0, +1.9104832458760001e-02) ) * z // z^9
-                           + C(+4.1666666666666664e-02, 0) ) * z // z^8
-                          + C(0, -8.5971746064419999e-02) ) * z // z^7
-                         + C(-1.6666666666666666e-01, 0) ) * z // z^6
-                        + C(0, +3.0090111122547003e-01) ) * z // z^5
-                       + C(+5.0000000000000000e-01, 0) ) * z // z^4
-                      + C(0, -7.5225277806367508e-01) ) * z // z^3
-                     + C(-1.0000000000000000e+00, 0) ) * z // z^2
-                    + C(0, +1.1283791670955126e+00) ) * z // z^1
-                + 1.;
-        }
-
-	SET_INFO(210, 20);
-	return (((((((((((((((((((
-				     + C(0, -8.8239572002038009e-07) ) * z // z^19
-				 + C(-2.7557319223985893e-06, 0) ) * z // z^18
-				+ C(0, +8.3827593401936105e-06) ) * z // z^17
-			       + C(+2.4801587301587302e-05, 0) ) * z // z^16
-			      + C(0, -7.1253454391645692e-05) ) * z // z^15
-			     + C(-1.9841269841269841e-04, 0) ) * z // z^14
-			    + C(0, +5.3440090793734269e-04) ) * z // z^13
-			   + C(+1.3888888888888889e-03, 0) ) * z // z^12
-			  + C(0, -3.4736059015927274e-03) ) * z // z^11
-			 + C(-8.3333333333333332e-03, 0) ) * z // z^10
-			+ C(0, +1.9104832458760001e-02) ) * z // z^9
-		       + C(+4.1666666666666664e-02, 0) ) * z // z^8
-		      + C(0, -8.5971746064419999e-02) ) * z // z^7
-		     + C(-1.6666666666666666e-01, 0) ) * z // z^6
-		    + C(0, +3.0090111122547003e-01) ) * z // z^5
-		   + C(+5.0000000000000000e-01, 0) ) * z // z^4
-		  + C(0, -7.5225277806367508e-01) ) * z // z^3
-		 + C(-1.0000000000000000e+00, 0) ) * z // z^2
-		+ C(0, +1.1283791670955126e+00) ) * z // z^1
-	    + 1.;
+	double wr, wi;
+	cerf_inline_w_maclaurin(z2 < .00689 ? (z2 < 4e-7 ? 5 : 14) : 20, x, y, &wr, &wi);
+	return C(wr, wi);
     }
 
 // ------------------------------------------------------------------------------
@@ -198,83 +152,14 @@ _cerf_cmplx w_of_z(_cerf_cmplx z) {
 // ------------------------------------------------------------------------------
 
     if (z2 >= 49) {
-	_cerf_cmplx ret = 0.; // return value
 	const double xs = y < 0 ? -creal(z) : creal(z); // compute for -z if y < 0
-
-	if (z2 > 4.8e15) {
-	    // Scale to prevent overflow.
-	    if (xa > ya) {
-		SET_INFO(222, 1);
-		const double yax = ya / xs;
-		const double denom = 0.56418958354775629 / (xs + yax*ya);
-		ret = C(denom*yax, denom);
-	    } else if (isinf(ya)) {
-		SET_INFO(100, 1);
-		return ((isnan(xa) || y < 0) ? C(NaN, NaN) : C(0, 0));
-	    } else {
-		SET_INFO(224, 1);
-		const double xya = xs / ya;
-		const double denom = 0.56418958354775629 / (xya*xs + ya);
-		ret = C(denom, denom*xya);
-	    }
-
-	} else {
-	    const double zm2 = 1 / z2;                                   // 1/|z|^2
-	    const _cerf_cmplx r = C(ya*zm2, xs*zm2);                     // i/z
-	    const double zm4 = zm2 * zm2;                                // 1/|z|^4
-	    const _cerf_cmplx r2 = C(zm4*(xs+ya)*(xs-ya), -2*zm4*xs*ya); // 1/z^2
-
-            if (z2 > 540) {
-		if (z2 > 22500) {
-		    SET_INFO(220, 4);
-		    ret = ((((
-				 + 1.0578554691520430e+00) * r2 // n=3
-			     + 4.2314218766081724e-01) * r2 // n=2
-			    + 2.8209479177387814e-01) * r2 // n=1
-			   + 5.6418958354775628e-01) * r; // n=0
-
-		} else {
-		    SET_INFO(220, 12);
-		    ret = ((((((((((((
-					 + 3.7877040075087948e+06) * r2 // n=11
-				     + 3.6073371500083758e+05) * r2 // n=10
-				    + 3.7971970000088164e+04) * r2 // n=9
-				   + 4.4672905882456671e+03) * r2 // n=8
-				  + 5.9563874509942218e+02) * r2 // n=7
-				 + 9.1636730015295726e+01) * r2 // n=6
-				+ 1.6661223639144676e+01) * r2 // n=5
-			       + 3.7024941420321507e+00) * r2 // n=4
-			      + 1.0578554691520430e+00) * r2 // n=3
-			     + 4.2314218766081724e-01) * r2 // n=2
-			    + 2.8209479177387814e-01) * r2 // n=1
-			   + 5.6418958354775628e-01) * r; // n=0
-		}
-
-            } else {
-		SET_INFO(220, 20);
-                ret = ((((((((((((((((((((
-                                             + 8.8249260943025370e+15) * r2 // n=19
-                                         + 4.7702303212446150e+14) * r2 // n=18
-                                        + 2.7258458978540656e+13) * r2 // n=17
-                                       + 1.6520278168812520e+12) * r2 // n=16
-                                      + 1.0658243979879044e+11) * r2 // n=15
-                                     + 7.3505130895717545e+09) * r2 // n=14
-                                    + 5.4448245107938921e+08) * r2 // n=13
-                                   + 4.3558596086351141e+07) * r2 // n=12
-                                  + 3.7877040075087948e+06) * r2 // n=11
-                                 + 3.6073371500083758e+05) * r2 // n=10
-                                + 3.7971970000088164e+04) * r2 // n=9
-                               + 4.4672905882456671e+03) * r2 // n=8
-                              + 5.9563874509942218e+02) * r2 // n=7
-                             + 9.1636730015295726e+01) * r2 // n=6
-                            + 1.6661223639144676e+01) * r2 // n=5
-                           + 3.7024941420321507e+00) * r2 // n=4
-                          + 1.0578554691520430e+00) * r2 // n=3
-                         + 4.2314218766081724e-01) * r2 // n=2
-                        + 2.8209479177387814e-01) * r2 // n=1
-                       + 5.6418958354775628e-01) * r; // n=0
-            }
-        }
+	if (isinf(ya)) {
+	    SET_INFO(100, 1);
+	    return ((isnan(xa) || y < 0) ? C(NaN, NaN) : C(0, 0));
+	}
+	double wr, wi;
+	cerf_inline_w_asymptotic(xs, ya, z2, &wr, &wi);
+	const _cerf_cmplx ret = C(wr, wi);
         if (y < 0) {
             // Use w(z) = 2.0*exp(-z*z) - w(-z),
             // but be careful of overflow in exp(-z*z) = exp(-(xs*xs-ya*ya) -2*i*xs*ya)
@@ -285,7 +170,7 @@ _cerf_cmplx w_of_z(_cerf_cmplx z) {
     }
 
 // ------------------------------------------------------------------------------
-// Taylor around some z                                                [ALGO 9??]
+// Taylor around some z, or fitted polynomial on square tile           [ALGO 9??]
 // ------------------------------------------------------------------------------
 
     if (isnan(xa)) {
@@ -297,14 +182,45 @@ _cerf_cmplx w_of_z(_cerf_cmplx z) {
 	return C(y, y);
     }
 
-    const int kP = Cover[((int)(8*xa)*64)+((int)(8*ya))];
-    assert(kP >= 0);
-    const _cerf_cmplx dz = C(xa - Centers[2*kP]/16., ya - Centers[2*kP+1]/16.);
-    const double* T = &TaylorCoeffs[2*NTay*kP];
-    _cerf_cmplx ret = C(T[2*NTay-2], T[2*NTay-1]);
-    for (int k = NTay-2; k >= 0; --k)
+#ifdef CERF_W_CHEB
+    // Regular grid of square tiles with edge 1/NChebDiv. In each tile, w is approximated by a
+    // polynomial in dz, fitted at bivariate Chebyshev nodes, see dev/w/pro_wofz_cheb.py.
+    // Tiles that touch an axis are centered on that axis.
+    const int ix = (int)(NChebDiv*xa);
+    const int iy = (int)(NChebDiv*ya);
+    const int iT = ix*NChebAx + iy;
+    const int nT = ChebTiles[2*iT+1]; // number of terms
+    assert(nT > 1);
+    const _cerf_cmplx dz = C(xa - (ix ? (ix + .5) / NChebDiv : 0.),
+			     ya - (iy ? (iy + .5) / NChebDiv : 0.));
+    const double* T = &ChebCoeffs[2*ChebTiles[2*iT]];
+#ifdef CERF_ESTRIN
+    // Split into even and odd terms, evaluated as two independent chains in dz^2.
+    const _cerf_cmplx dz2 = dz * dz;
+    _cerf_cmplx even = C(0, 0);
+    _cerf_cmplx odd = C(0, 0);
+    int k = nT-1;
+    if (k % 2 == 0) {
+	even = C(T[2*k], T[2*k+1]);
+	--k;
+    }
+    for (; k > 0; k -= 2) {
+	odd = odd * dz2 + C(T[2*k], T[2*k+1]);
+	even = even * dz2 + C(T[2*k-2], T[2*k-1]);
+    }
+    _cerf_cmplx ret = even + odd * dz;
+#else
+    _cerf_cmplx ret = C(T[2*nT-2], T[2*nT-1]);
+    for (int k = nT-2; k >= 0; --k)
 	ret = ret * dz + C(T[2*k], T[2*k+1]);
-    SET_INFO(900, kP);
+#endif
+    SET_INFO(950, nT);
+
+#else // Taylor expansion around centers of polyominoes
+    double wr, wi;
+    cerf_inline_w_taylor(xa, ya, &wr, &wi);
+    _cerf_cmplx ret = C(wr, wi);
+#endif // CERF_W_CHEB
 
 
     if (y < 0) {
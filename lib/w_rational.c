@@ -0,0 +1,162 @@
+/* Library libcerf:
+ *   Compute complex error functions, based on a new implementation of
+ *   Faddeeva's w_of_z. Also provide Dawson and Voigt functions.
+ *
+ * File w_rational.c:
+ *   Compute Faddeeva's w(z) for arrays of arguments, optionally using
+ *   Weideman's rational approximation, which has no branches and therefore
+ *   can be vectorized by the compiler, or the interpolation table from w_table.c.
+ *
+ * Copyright:
+ *   (C) 2026 Forschungszentrum Jülich GmbH
+ *
+ * Licence:
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *   LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *   OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *   WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * Website:
+ *   http://apps.jcns.fz-juelich.de/libcerf
+ *
+ * Revision history:
+ *   ../CHANGELOG
+ *
+ * Man page:
+ *   w_of_z(3)
+ */
+
+/*
+  Weideman's approximation [SIAM J Numer Anal 31, 1497 (1994)] is, for Im z >= 0,
+      w(z) = 2 p(Z) / (L - iz)^2 + 1 / sqrt(pi) / (L - iz),   Z = (L + iz) / (L - iz),
+  with a polynomial p of degree N-1. For N = 40, the relative error |dw|/|w| is about 1e-15
+  in the entire upper half plane. For Im z < 0, we use w(z) = 2 exp(-z^2) - w(-z).
+
+  The componentwise relative error, however, grows as |w|/|Re w| or |w|/|Im w|, which is large
+  near the axes. Such arguments, and those where the reflection causes cancellation, are
+  detected in a second pass, and recomputed by w_of_z. For arguments with 0.3 < |z| < 30,
+  randomly distributed over all phases, this concerns about one argument in twenty.
+  Near the origin, where Im w / Re w ~ 1.13 x, it concerns most arguments with |z| < 0.03.
+*/
+
+#include "cerf.h"
+#include "defs.h" // defines _cerf_cmplx, NaN, C, cexp, ...
+#include <math.h>
+
+//--- The following code is generated by dev/w/pro_wofz_weideman.py; do not edit
+// clang-format off
+static const double WeidemanL = 0x0.aa2f7ae07a8d00p3; // sqrt(N/sqrt(2)), N = 40
+alignas(64) static const double WeidemanCoeffs[40] = { // highest order first
+ -0x0.88e32fbf4c1420p-48, 0x0.a292918fef17e8p-49, 0x0.cc9a16567e82e8p-46, -0x0.c2e414c9a43dc8p-47,
+ -0x0.9f4b54b4335990p-43, 0x0.f74240a760ecf8p-46, 0x0.ff2eef3de06ad8p-41, 0x0.87765139694fc8p-42,
+ -0x0.cc9c41ac7054c8p-38, -0x0.bff01d76b4e090p-38, 0x0.9bd17f3cdccf40p-35, 0x0.98bb6d41c770b0p-34,
+ -0x0.c71fd1a2098b18p-33, -0x0.c3e40f67468988p-31, 0x0.e7d7d4da35a2a0p-32, 0x0.cf615b50c2b180p-28,
+ 0x0.df5225352c7e40p-28, -0x0.9d54779d69c610p-25, -0x0.88673e7807ee60p-23, 0x0.f3ee4a27c6f030p-26,
+ 0x0.9eb3e5515a9200p-20, 0x0.c71ef18956b650p-19, -0x0.8f13f56a042b18p-19, -0x0.970eb2c2d7f458p-15,
+ -0x0.ea8439e05746f0p-14, -0x0.a53a96f61427d0p-14, 0x0.e695e60070eab0p-11, 0x0.b14d2cb76a52b0p-8,
+ 0x0.a4a125d2fff318p-6, 0x0.ef3af466234130p-5, 0x0.931842cbeee460p-3, 0x0.9ec37f4f354f50p-2,
+ 0x0.998bc19460b008p-1, 0x0.86d2b970cf00c0p0, 0x0.d8e33e493f4fb0p0, 0x0.a0d11c7804e848p1,
+ 0x0.dcd95a592eb210p1, 0x0.8ce59a1dac7e30p2, 0x0.a76d6e65ab56e0p2, 0x0.b99372ada090a8p2,
+};
+// clang-format on
+//--- End of autogenerated code
+
+/******************************************************************************/
+/*  Library function w_of_z_array                                             */
+/******************************************************************************/
+
+void w_of_z_array(
+    size_t n, const double* z_re, const double* z_im, double* w_re, double* w_im, int engine) {
+    if (engine == CERF_W_TABLE) {
+        for (size_t i = 0; i < n; ++i) {
+            const _cerf_cmplx w = w_of_z_table(C(z_re[i], z_im[i]));
+            w_re[i] = creal(w);
+            w_im[i] = cimag(w);
+        }
+        return;
+    }
+    if (engine != CERF_W_RATIONAL) {
+        for (size_t i = 0; i < n; ++i) {
+            const _cerf_cmplx w = w_of_z(C(z_re[i], z_im[i]));
+            w_re[i] = creal(w);
+            w_im[i] = cimag(w);
+        }
+        return;
+    }
+
+    // Work in chunks: first loops without branches, which the compiler can vectorize,
+    // then reflection and fallback where needed. The buffers allow z_re == w_re etc.
+    // Weideman's approximation is computed for -z if y < 0, using only real arithmetic.
+    enum { NCHUNK = 256 };
+    const double L = WeidemanL;
+    double Zr[NCHUNK], Zi[NCHUNK], ur[NCHUNK], ui[NCHUNK], ar[NCHUNK], ai[NCHUNK];
+    for (size_t i0 = 0; i0 < n; i0 += NCHUNK) {
+        const size_t m = n - i0 < NCHUNK ? n - i0 : NCHUNK;
+        for (size_t j = 0; j < m; ++j) {
+            const double y = z_im[i0 + j];
+            const double x = y < 0 ? -z_re[i0 + j] : z_re[i0 + j];
+            const double ly = L + fabs(y);
+            const double rD = 1 / (ly * ly + x * x); // 1/|L - iz|^2
+            Zr[j] = (L - fabs(y)) * ly * rD - x * x * rD; // Z = (L + iz) / (L - iz)
+            Zi[j] = 2 * L * x * rD;
+            ur[j] = ly * rD; // u = 1 / (L - iz)
+            ui[j] = x * rD;
+            ar[j] = WeidemanCoeffs[0];
+            ai[j] = 0;
+        }
+        for (int k = 1; k < 40; ++k) { // Horner scheme for p(Z), all lanes in step
+            const double c = WeidemanCoeffs[k];
+            for (size_t j = 0; j < m; ++j) {
+                const double t = ar[j] * Zr[j] - ai[j] * Zi[j] + c;
+                ai[j] = ar[j] * Zi[j] + ai[j] * Zr[j];
+                ar[j] = t;
+            }
+        }
+        for (size_t j = 0; j < m; ++j) { // w = 2 p u^2 + u / sqrt(pi)
+            const double u2r = (ur[j] - ui[j]) * (ur[j] + ui[j]);
+            const double u2i = 2 * ur[j] * ui[j];
+            const double p_re = ar[j];
+            ar[j] = 2 * (p_re * u2r - ai[j] * u2i) + 0.56418958354775629 * ur[j];
+            ai[j] = 2 * (p_re * u2i + ai[j] * u2r) + 0.56418958354775629 * ui[j];
+        }
+        for (size_t j = 0; j < m; ++j) {
+            const double x = z_re[i0 + j];
+            const double y = z_im[i0 + j];
+            double re = ar[j];
+            double im = ai[j];
+            double s = fabs(re) + fabs(im); // scale of the errors
+            if (y < 0) {
+                // w(z) = 2 exp(-z^2) - w(-z)
+                const double e = 2 * exp((y - x) * (x + y));
+                const double er = e * cos(2 * x * y);
+                const double ei = -e * sin(2 * x * y);
+                re = er - re;
+                im = ei - im;
+                s += fabs(er) + fabs(ei);
+            }
+            // Negated comparisons, so that NaN and Inf also go to the fallback.
+            if (!(fabs(re) >= s / 32 && fabs(im) >= s / 32 && s < 1e300
+                  && x * x + y * y < 1e100)) {
+                const _cerf_cmplx w = w_of_z(C(x, y));
+                re = creal(w);
+                im = cimag(w);
+            }
+            w_re[i0 + j] = re;
+            w_im[i0 + j] = im;
+        }
+    }
+}
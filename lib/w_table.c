@@ -0,0 +1,295 @@
+/* Library libcerf:
+ *   Compute complex error functions, based on a new implementation of
+ *   Faddeeva's w_of_z. Also provide Dawson and Voigt functions.
+ *
+ * File w_table.c:
+ *   Fast approximate computation of Faddeeva's w(z) by interpolation in a precomputed table,
+ *   which is stored in a binary file, and memory-mapped.
+ *
+ * Copyright:
+ *   (C) 2026 Forschungszentrum Jülich GmbH
+ *
+ * Licence:
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *   LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *   OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *   WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * Website:
+ *   http://apps.jcns.fz-juelich.de/libcerf
+ *
+ * Revision history:
+ *   ../CHANGELOG
+ *
+ * Man page:
+ *   w_of_z_table(3)
+ */
+
+/*
+  The table contains w(z) on a square grid with spacing h in the quadrant x, y >= 0.
+  Within a grid cell, w is obtained by bicubic Hermite interpolation. As w is analytic,
+  the required partial derivatives follow from w itself:
+      dw/dx = w',   dw/dy = i w',   d2w/dxdy = i w'',
+      w' = -2 z w + 2i/sqrt(pi),   w'' = -2 w - 2 z w'.
+  The interpolation error is of order h^4 |w''''|; for h = 1/64 the relative error |dw|/|w|
+  is below 1e-9. For x < 0, we use w(-x+iy) = conj(w(x+iy)). Outside the grid, and for y < 0,
+  w_of_z is called.
+
+  File format (native byte order, all fields 8-byte aligned):
+      header (64 bytes): magic "libcerfW", version, byte-order mark, nx, ny, h, error bound,
+                         3 reserved doubles;
+      nx * ny complex values w(ix*h + i*iy*h), as pairs of doubles, with index ix*ny + iy.
+  The error bound is the maximum relative error |dw|/|w|, determined by the generator
+  at the centers and edge midpoints of all cells.
+
+  The file is mapped read-only and shared, so that pages are loaded on demand, and several
+  processes share the page cache. Opening and closing the table is not thread-safe;
+  lookups are.
+*/
+
+#include "cerf.h"
+#include "defs.h" // defines _cerf_cmplx, NaN, C, cexp, ...
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+typedef struct {
+    char magic[8];      // "libcerfW"
+    uint32_t version;   // WTableVersion
+    uint32_t byteorder; // 0x01020304, to detect files written on other architectures
+    int32_t nx, ny;     // number of grid points in x and y direction
+    double h;           // grid spacing
+    double errbound;    // maximum relative error |dw|/|w| of interpolated values
+    double reserved[3];
+} w_table_header;
+
+static const char WTableMagic[8] = {'l', 'i', 'b', 'c', 'e', 'r', 'f', 'W'};
+static const uint32_t WTableVersion = 1;
+static const uint32_t WTableByteOrder = 0x01020304;
+
+// The currently selected table.
+static const w_table_header* wtab = NULL;
+static const double* wtab_data = NULL;
+static size_t wtab_size = 0;
+
+/******************************************************************************/
+/*  Interpolation                                                             */
+/******************************************************************************/
+
+//! Returns w(x+iy) for 0 <= x < (nx-1)*h, 0 <= y < (ny-1)*h, interpolated in table T.
+static _cerf_cmplx w_interpolate(const w_table_header* hd, const double* T, double x, double y)
+{
+    const double h = hd->h;
+    const double u = x / h;
+    const double v = y / h;
+    // Unless h is a power of two, x/h can round up to nx-1 just below the upper edge.
+    const int ix = u < hd->nx - 2 ? (int)u : hd->nx - 2;
+    const int iy = v < hd->ny - 2 ? (int)v : hd->ny - 2;
+    const double s = u - ix;
+    const double t = v - iy;
+
+    // Cubic Hermite basis functions, for values (H0) and derivatives (H1) at both ends.
+    const double H0s[2] = {(1 + 2 * s) * (1 - s) * (1 - s), (3 - 2 * s) * s * s};
+    const double H1s[2] = {h * s * (1 - s) * (1 - s), -h * s * s * (1 - s)};
+    const double H0t[2] = {(1 + 2 * t) * (1 - t) * (1 - t), (3 - 2 * t) * t * t};
+    const double H1t[2] = {h * t * (1 - t) * (1 - t), -h * t * t * (1 - t)};
+
+    // Real arithmetic, to avoid the overhead of complex multiplication in C.
+    double rr = 0, ri = 0;
+    for (int a = 0; a < 2; ++a) {
+        for (int b = 0; b < 2; ++b) {
+            const double* p = T + 2 * ((size_t)(ix + a) * hd->ny + iy + b);
+            const double wr = p[0], wi = p[1];
+            const double zx = (ix + a) * h, zy = (iy + b) * h;
+            const double w1r = -2 * (zx * wr - zy * wi); // w' = -2 z w + 2i/sqrt(pi)
+            const double w1i = -2 * (zx * wi + zy * wr) + 1.1283791670955126;
+            const double w2r = -2 * (wr + zx * w1r - zy * w1i); // w'' = -2 w - 2 z w'
+            const double w2i = -2 * (wi + zx * w1i + zy * w1r);
+            // w + dx w' + dy i w' + dx dy i w''
+            const double A = H0s[a] * H0t[b], B = H1s[a] * H0t[b];
+            const double Cy = H0s[a] * H1t[b], D = H1s[a] * H1t[b];
+            rr += A * wr + B * w1r - Cy * w1i - D * w2i;
+            ri += A * wi + B * w1i + Cy * w1r + D * w2r;
+        }
+    }
+    return C(rr, ri);
+}
+
+/******************************************************************************/
+/*  Library functions cerf_w_table_open, cerf_w_table_close, w_of_z_table     */
+/******************************************************************************/
+
+//! Checks header, and returns 0 if the table is valid.
+static int w_table_check(const w_table_header* hd, size_t size)
+{
+    if (size < sizeof(w_table_header) || memcmp(hd->magic, WTableMagic, 8)
+        || hd->version != WTableVersion || hd->byteorder != WTableByteOrder)
+        return -2;
+    if (hd->nx < 2 || hd->ny < 2 || !(hd->h > 0)
+        || size != sizeof(w_table_header) + 16 * (size_t)hd->nx * (size_t)hd->ny)
+        return -2;
+    return 0;
+}
+
+int cerf_w_table_open(const char* filename, double errbound)
+{
+    cerf_w_table_close();
+#ifdef _WIN32
+    // No memory mapping; read the entire file.
+    FILE* f = fopen(filename, "rb");
+    if (!f)
+        return -1;
+    fseek(f, 0, SEEK_END);
+    const long fsize = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    if (fsize <= 0) {
+        fclose(f);
+        return -2;
+    }
+    const size_t size = (size_t)fsize;
+    void* mem = malloc(size);
+    if (!mem || fread(mem, 1, size, f) != size) {
+        free(mem);
+        fclose(f);
+        return -1;
+    }
+    fclose(f);
+#else
+    const int fd = open(filename, O_RDONLY);
+    if (fd < 0)
+        return -1;
+    struct stat st;
+    if (fstat(fd, &st) || st.st_size <= 0) {
+        close(fd);
+        return -2;
+    }
+    const size_t size = (size_t)st.st_size;
+    void* mem = mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd); // the mapping stays valid
+    if (mem == MAP_FAILED)
+        return -1;
+#endif
+    const w_table_header* hd = (const w_table_header*)mem;
+    int ret = w_table_check(hd, size);
+    if (!ret && !(hd->errbound <= errbound))
+        ret = -3;
+    if (ret) {
+#ifdef _WIN32
+        free(mem);
+#else
+        munmap(mem, size);
+#endif
+        return ret;
+    }
+    wtab = hd;
+    wtab_data = (const double*)(hd + 1);
+    wtab_size = size;
+    return 0;
+}
+
+void cerf_w_table_close(void)
+{
+    if (!wtab)
+        return;
+#ifdef _WIN32
+    free((void*)wtab);
+#else
+    munmap((void*)wtab, wtab_size);
+#endif
+    wtab = NULL;
+    wtab_data = NULL;
+    wtab_size = 0;
+}
+
+_cerf_cmplx w_of_z_table(_cerf_cmplx z)
+{
+    const double x = creal(z);
+    const double y = cimag(z);
+    const double xa = fabs(x);
+    // Negated comparisons, so that NaN also goes to w_of_z.
+    if (!wtab || !(y >= 0 && y < (wtab->ny - 1) * wtab->h && xa < (wtab->nx - 1) * wtab->h))
+        return w_of_z(z);
+    const _cerf_cmplx w = w_interpolate(wtab, wtab_data, xa, y);
+    return x < 0 ? C(creal(w), -cimag(w)) : w;
+}
+
+/******************************************************************************/
+/*  Library function cerf_w_table_write                                       */
+/******************************************************************************/
+
+int cerf_w_table_write(const char* filename, int ndiv, double xmax, double ymax, double* errbound)
+{
+    if (ndiv < 1 || !(xmax > 0) || !(ymax > 0) || xmax * ndiv > 1e5 || ymax * ndiv > 1e5)
+        return -2;
+    w_table_header hd;
+    memset(&hd, 0, sizeof(hd));
+    memcpy(hd.magic, WTableMagic, 8);
+    hd.version = WTableVersion;
+    hd.byteorder = WTableByteOrder;
+    hd.h = 1. / ndiv;
+    hd.nx = (int32_t)ceil(xmax * ndiv) + 1;
+    hd.ny = (int32_t)ceil(ymax * ndiv) + 1;
+
+    const size_t n = (size_t)hd.nx * (size_t)hd.ny;
+    double* T = (double*)malloc(16 * n);
+    if (!T)
+        return -1;
+    for (int ix = 0; ix < hd.nx; ++ix) {
+        for (int iy = 0; iy < hd.ny; ++iy) {
+            const _cerf_cmplx w = w_of_z(C(ix * hd.h, iy * hd.h));
+            T[2 * ((size_t)ix * hd.ny + iy)] = creal(w);
+            T[2 * ((size_t)ix * hd.ny + iy) + 1] = cimag(w);
+        }
+    }
+
+    // The interpolation error is largest at the center and at the edge midpoints of the cells.
+    double emax = 0;
+    const double st[3][2] = {{.5, .5}, {.5, 0}, {0, .5}};
+    for (int ix = 0; ix < hd.nx - 1; ++ix) {
+        for (int iy = 0; iy < hd.ny - 1; ++iy) {
+            for (int k = 0; k < 3; ++k) {
+                const double x = (ix + st[k][0]) * hd.h;
+                const double y = (iy + st[k][1]) * hd.h;
+                const _cerf_cmplx w = w_of_z(C(x, y));
+                const _cerf_cmplx d = w_interpolate(&hd, T, x, y) - w;
+                const double e = hypot(creal(d), cimag(d)) / hypot(creal(w), cimag(w));
+                if (e > emax)
+                    emax = e;
+            }
+        }
+    }
+    hd.errbound = emax;
+
+    FILE* f = fopen(filename, "wb");
+    int ret = 0;
+    if (!f || fwrite(&hd, sizeof(hd), 1, f) != 1 || fwrite(T, 16, n, f) != n)
+        ret = -1;
+    if (f && fclose(f))
+        ret = -1;
+    free(T);
+    if (errbound)
+        *errbound = emax;
+    return ret;
+}
@@ -1,94 +0,0 @@
-// Created by ./arrange_polyominoes.py 20 d30N20b16.dat on 13:21:13.983958
-alignas(64) static const short Centers[2*91] = {
-  0,  3,
-  0,  7,
-  0, 15,
-  0, 25,
-  0, 36,
-  0, 54,
-  0, 77,
-  0,106,
-  3,  0,
-  5,  0,
-  7,  0,
-  9,  0,
- 11,  0,
- 13,  0,
- 15,  0,
- 17,  0,
- 19,  0,
- 21,  0,
- 25,  0,
- 29,  0,
- 35,  0,
- 41,  0,
- 49,  0,
- 57,  0,
- 67,  0,
- 81,  0,
- 99,  0,
-111,  0,
-  4,  4,
-  5, 10,
-  6, 21,
- 11, 44,
- 11, 30,
-  8,  4,
-  9,  8,
-  9, 14,
- 15, 66,
- 10,  4,
- 13, 10,
- 13, 20,
- 14,  4,
- 16, 16,
- 17,  8,
- 20, 55,
- 20, 27,
- 21, 36,
- 19, 93,
- 19,  4,
- 21, 12,
- 23, 20,
- 24,  7,
- 26, 81,
- 25,  4,
- 29, 44,
- 28, 12,
- 29, 16,
- 30, 28,
- 31,  5,
- 36, 37,
- 35,  8,
- 37, 20,
- 37, 62,
- 37, 14,
- 32,104,
- 27, 99,
- 41,  4,
- 43, 26,
- 47, 50,
- 44, 13,
- 49, 10,
- 51, 20,
- 53, 36,
- 52, 80,
- 53, 89,
- 58, 25,
- 57,  9,
- 60, 58,
- 61, 67,
- 66, 18,
- 68, 45,
- 69,  8,
- 73, 34,
- 83, 22,
- 78, 70,
- 84, 13,
- 60, 90,
- 86, 53,
- 84, 10,
- 96, 37,
-103, 20,
- 88, 49,
-};
@@ -1,95 +0,0 @@
-// Created by ./arrange_polyominoes.py 20 d30N20b16.dat on 13:21:13.985923
-static const int NTay = 20;
-alignas(64) static const double TaylorCoeffs[2*20*91] = {
- 0x0.d1b5ddbf9b4368p0, 0x0, 0x0, 0x0.d23941dc4f7d88p0, -0x0.aa4b21664c5be0p0, 0x0, 0x0, -0x0.edb98f76d6e5c0p-1, 0x0.9401bbf3283650p-1, 0x0, 0x0, 0x0.a7fa969432afa8p-2, -0x0.b0585271af47d0p-3, 0x0, 0x0, -0x0.ad14ec6654dc80p-4, 0x0.a01e5c48175320p-5, 0x0, 0x0, 0x0.8c81d8aa497d10p-6, -0x0.eb1d198d00b248p-8, 0x0, 0x0, -0x0.bc57f968421e20p-9, 0x0.90f8917226ffa0p-10, 0x0, 0x0, 0x0.d71484a4609170p-12, -0x0.9a28b1675e40f0p-13, 0x0, 0x0, -0x0.d600c002dd94a8p-15, 0x0.9020a8673bddf8p-16, 0x0, 0x0, 0x0.bcb287bd5a52a8p-18, -0x0.f08083a0a2e748p-20, 0x0, 0x0, -0x0.9568d8e6967920p-21, // x=       0 y=  0.1875
- 0x0.a6318761c3eaa8p0, 0x0, 0x0, 0x0.8f721e8e9e4980p0, -0x0.cedf3406bd5500p-1, 0x0, 0x0, -0x0.82ec643c312930p-1, 0x0.9597c82c67d2f8p-2, 0x0, 0x0, 0x0.9d1eb3ea5d84e0p-3, -0x0.99a16bc1847d38p-4, 0x0, 0x0, -0x0.8d2872adc09d20p-5, 0x0.f581255704b5b0p-7, 0x0, 0x0, 0x0.cb35e82b158240p-8, -0x0.a0d77ba4799a90p-9, 0x0, 0x0, -0x0.f466f02d3e6960p-11, 0x0.b2d04c7f5e5eb8p-12, 0x0, 0x0, 0x0.fca91301b36830p-14, -0x0.acc6a2c3a323d0p-15, 0x0, 0x0, -0x0.e530aa075d9170p-17, 0x0.93b5502ad4e7e8p-18, 0x0, 0x0, 0x0.b94c3cb2d1e0a8p-20, -0x0.e28ff47eb53ed0p-22, 0x0, 0x0, -0x0.872c342c994f00p-23, // x=       0 y=  0.4375
- 0x0.e3fc09c1390f78p-1, 0x0, 0x0, 0x0.964257be0870a0p-1, -0x0.ae3baefe224bc0p-2, 0x0, 0x0, -0x0.b6e64f3d164da8p-3, 0x0.b0ff73b2ffaeb0p-4, 0x0, 0x0, 0x0.9fe41b35171f98p-5, -0x0.8810b3ed7bca88p-6, 0x0, 0x0, -0x0.dbae58d654cab0p-8, 0x0.a927ae367fd610p-9, 0x0, 0x0, 0x0.f994e216ba6ed8p-11, -0x0.b10e0ec1e039c0p-12, 0x0, 0x0, -0x0.f24ef8f9f64b50p-14, 0x0.a05a1089b8aac8p-15, 0x0, 0x0, 0x0.cdb71532f5d2d0p-17, -0x0.80282d38e37d00p-18, 0x0, 0x0, -0x0.9b59ddde2e1148p-20, 0x0.b77e3a71a161e8p-22, 0x0, 0x0, 0x0.d3790051f8edd0p-24, -0x0.ee18a7c44c83d0p-26, 0x0, 0x0, -0x0.8316eca1a79350p-27, // x=       0 y=  0.9375
- 0x0.9f90680bf9a980p-1, 0x0, 0x0, 0x0.9e2f49c5ce77d8p-2, -0x0.8fedd9a5c16f78p-3, 0x0, 0x0, -0x0.f3f27e96fc8420p-5, 0x0.c28c80cb1b2f68p-6, 0x0, 0x0, 0x0.9321298d4ba4f0p-7, -0x0.d446eb8c959178p-9, 0x0, 0x0, -0x0.92c355ce951290p-10, 0x0.c33ca1066235e8p-12, 0x0, 0x0, 0x0.faa96de3def728p-14, -0x0.9bb71cf564fbd0p-15, 0x0, 0x0, -0x0.bba65c060bbdb8p-17, 0x0.dbc5ad5d6bb9e0p-19, 0x0, 0x0, 0x0.fa9680bee68c98p-21, -0x0.8b4c713a1d55a8p-22, 0x0, 0x0, -0x0.97362af910ac78p-24, 0x0.a07690e1a5a490p-26, 0x0, 0x0, 0x0.a6a55ed48f0060p-28, -0x0.a98a9c2834f280p-30, 0x0, 0x0, -0x0.a92061667d2b30p-32, // x=       0 y=  1.5625
- 0x0.eca2236b13c990p-2, 0x0, 0x0, 0x0.b538695d9ba088p-3, -0x0.830ab38712d3d8p-4, 0x0, 0x0, -0x0.b441fcc8cd0bc8p-6, 0x0.ed2caab0fbe998p-8, 0x0, 0x0, 0x0.95e928dd978148p-9, -0x0.b6bba1e9d94068p-11, 0x0, 0x0, -0x0.d76bf5e4cf1718p-13, 0x0.f63b9e64930db0p-15, 0x0, 0x0, 0x0.88bd33323270b0p-16, -0x0.93d7a146907e50p-18, 0x0, 0x0, -0x0.9bdcd2d8bd9070p-20, 0x0.a073c721ba4d78p-22, 0x0, 0x0, 0x0.a17f420e331fa8p-24, -0x0.9f1bdff1b13f48p-26, 0x0, 0x0, -0x0.9998b362a96f10p-28, 0x0.916bf61463e1a0p-30, 0x0, 0x0, 0x0.87259867e43c80p-32, -0x0.f6c2e4ce0c7040p-35, 0x0, 0x0, -0x0.dd75289abf1e20p-37, // x=       0 y=    2.25
- 0x0.a47c78814cdb88p-2, 0x0, 0x0, 0x0.b4b69a9f8045a8p-4, -0x0.c02660ab8a0c40p-6, 0x0, 0x0, -0x0.c642609d7dce20p-8, 0x0.c6f2f9353f3288p-10, 0x0, 0x0, 0x0.c288c236cfe320p-12, -0x0.b9a871cffee4d8p-14, 0x0, 0x0, -0x0.ad309c4603c020p-16, 0x0.9e1db7d3aeeaf0p-18, 0x0, 0x0, 0x0.8d70209a55ea50p-20, -0x0.f82d82095c54c8p-23, 0x0, 0x0, -0x0.d5bf95c8113d78p-25, 0x0.b4df9f16cf6d18p-27, 0x0, 0x0, 0x0.967d4da967efc8p-29, -0x0.f664196d2355d0p-32, 0x0, 0x0, -0x0.c695a61f6acb10p-34, 0x0.9dabaa854274f0p-36, 0x0, 0x0, 0x0.f6c6cc38649828p-39, -0x0.be710f8538f460p-41, 0x0, 0x0, -0x0.90fefe86b6cd70p-43, // x=       0 y=   3.375
- 0x0.eb376260c61f78p-3, 0x0, 0x0, 0x0.bbda54f76b1ec0p-5, -0x0.934b427193e780p-7, 0x0, 0x0, -0x0.e2fb6b3b1904b8p-10, 0x0.ac003f006daa58p-12, 0x0, 0x0, 0x0.80472f9086e500p-14, -0x0.bc7112f07948d8p-17, 0x0, 0x0, -0x0.886613da3641e0p-19, 0x0.c2b2186f800c88p-22, 0x0, 0x0, 0x0.8914ebc0fa8268p-24, -0x0.be85eb7baa9740p-27, 0x0, 0x0, -0x0.82bc46607f59d8p-29, 0x0.b13ccefdb1fb88p-32, 0x0, 0x0, 0x0.ed7325fedb67a0p-35, -0x0.9d3de52f76d7b8p-37, 0x0, 0x0, -0x0.cdf1d66ddfab28p-40, 0x0.8569a8c5792b10p-42, 0x0, 0x0, 0x0.ab0a39e2f80c98p-45, -0x0.d90ab886aa5188p-48, 0x0, 0x0, -0x0.8856d3d0b48540p-50, // x=       0 y=  4.8125
- 0x0.ac7c8ea62be650p-3, 0x0, 0x0, 0x0.cbca303c405828p-6, -0x0.ee47ad11a75328p-9, 0x0, 0x0, -0x0.89e7137825f0c8p-11, 0x0.9e0f4d2a87c5b8p-14, 0x0, 0x0, 0x0.b370c1b159b408p-17, -0x0.c9d3baf8ca6330p-20, 0x0, 0x0, -0x0.e0f558cf01d9b0p-23, 0x0.f888d6d5cdae48p-26, 0x0, 0x0, 0x0.881ca2d4fc9818p-28, -0x0.93d5d4204875b0p-31, 0x0, 0x0, -0x0.9f40b0774caa30p-34, 0x0.aa2d6a8fdfb298p-37, 0x0, 0x0, 0x0.b46d15da21a060p-40, -0x0.bdd30442233528p-43, 0x0, 0x0, -0x0.c63613d86a6978p-46, 0x0.cd71de9758ae68p-49, 0x0, 0x0, 0x0.d367c017348038p-52, -0x0.d7ffa739cfac48p-55, 0x0, 0x0, -0x0.db28ac823968c0p-58, // x=       0 y=   6.625
- 0x0.f728078f76cb38p0, 0x0.d3a44c2ddf7f60p-2, -0x0.b95e05ab991868p-1, 0x0.868306efee6170p1, -0x0.e5c737076070f0p0, -0x0.ceb46b4ae288c0p-1, 0x0.b505d1899381d8p-1, -0x0.a66e17e08faeb0p0, 0x0.d4ceab627a9cc0p-1, 0x0.868eda1f8c3520p-1, -0x0.b0bd41566ecc30p-2, 0x0.f61ab8af5da928p-2, -0x0.82d348d6ead118p-2, -0x0.d22c79eaa6a6a8p-3, 0x0.e60591231ea870p-4, -0x0.815f2c255a4e98p-3, 0x0.f0160c128ac260p-5, 0x0.ea6e5231a79568p-5, -0x0.e078903d350980p-6, 0x0.d27555dab622d8p-6, -0x0.af3bcba3d7d468p-7, -0x0.cb5441cb53ba28p-7, 0x0.af33083d80eca8p-8, -0x0.8b327fc5903560p-8, 0x0.d3beae7d6fa848p-10, 0x0.9040a92e90d4c0p-9, -0x0.e3d89435651e38p-11, 0x0.9aacd881796438p-11, -0x0.d99500ae34c638p-13, -0x0.ad2571854c0640p-12, 0x0.fdea3374dd6e70p-14, -0x0.93ac17521c03e0p-14, 0x0.c1c70bdb4003e0p-16, 0x0.b411829d255670p-15, -0x0.f78716998bb360p-17, 0x0.f631c98de2d9e8p-18, -0x0.979e8fc450d0f0p-19, -0x0.a5309a13f97878p-18, 0x0.d66de98c6b5bf8p-20, -0x0.b53d3316036ea0p-21, // x=  0.1875 y=       0
- 0x0.e82e9230961578p0, 0x0.a93bbabc1bab10p-1, -0x0.911d1b5e5dcd68p0, 0x0.ebfacaa9611160p0, -0x0.bad579a318c548p0, -0x0.9e5c3cb2fc2af8p0, 0x0.87aa8b96390760p0, -0x0.f8a7f4ec985a90p-1, 0x0.90702e0426f2f8p-1, 0x0.c5367af7f3f918p-1, -0x0.fd2cead7cb6220p-2, 0x0.959f25327ce3c8p-2, -0x0.8bd6e1c33ee4d8p-3, -0x0.930f90853a5320p-2, 0x0.9d28481150b118p-3, -0x0.ecf2edcb185f90p-5, 0x0.b574967bab5b00p-6, 0x0.9c510dcf2946e0p-4, -0x0.91fef710213b40p-5, 0x0.f78eb3d8365b30p-8, -0x0.90552ce8f0f000p-9, -0x0.80ebdf751b7888p-6, 0x0.d875472f88a2d0p-8, -0x0.fb5cb010f46a38p-12, 0x0.c0fd5e44f62f98p-16, 0x0.ad8819c1963810p-9, -0x0.8559979bb01d60p-10, -0x0.e09327c8a164d8p-15, 0x0.b0b708b4ea0200p-15, -0x0.c511945b43ebd0p-12, 0x0.8c66311761f398p-13, 0x0.bf44071d02fc60p-16, -0x0.b01b6309123940p-17, 0x0.c1554037b2dce0p-15, -0x0.80e734da8bdad0p-16, -0x0.92debbe1cc9998p-18, 0x0.e427039dec1e38p-20, -0x0.a6c07d39ab70c8p-18, 0x0.d19853d85b5b50p-20, 0x0.a78fe7976d9f08p-21, // x=  0.3125 y=       0
- 0x0.d3676f4fb82340p0, 0x0.ded80dc886cf10p-1, -0x0.b8fa8165c11ed8p0, 0x0.bf5eeefc6ebc38p0, -0x0.8279d6b333a5c0p0, -0x0.c3258f72b3d9e0p0, 0x0.a15fdf8d6fcf90p0, -0x0.8d5355a3001130p-1, 0x0.ef7f93954aebc0p-3, 0x0.e20fca2e5bdda0p-1, -0x0.8b93e14c7b2060p-1, 0x0.87c15d624c6720p-4, 0x0.cb33c8176cd088p-10, -0x0.9ba83e31280788p-2, 0x0.9f51a240d000a8p-3, 0x0.9c2a5acd667498p-6, -0x0.8e943d1913b3d0p-6, 0x0.976315b58a3a58p-4, -0x0.86af945db9b610p-5, -0x0.bb27005a43b688p-7, 0x0.d057e588de8f50p-8, -0x0.e1d7ec4dc40a30p-7, 0x0.b3557cd1cde058p-8, 0x0.cff85714928800p-9, -0x0.bf338818706ba0p-10, 0x0.8765d72fad5788p-9, -0x0.c2fae4d78bca88p-11, -0x0.a46f51fbf52658p-11, 0x0.85a1613b31b6d8p-12, -0x0.862f9df6fe5188p-12, 0x0.b0cc5d692ba4d8p-14, 0x0.ceb50d5ffc9140p-14, -0x0.98f7bb72b27ce0p-15, 0x0.df27a100fd6350p-16, -0x0.86e7b152e63628p-17, -0x0.d98511de34f898p-17, 0x0.951649a35897d0p-18, -0x0.9c10764e8fd298p-19, 0x0.ac481cfe98fae0p-21, 0x0.c58c85bb9ee820p-20, // x=  0.4375 y=       0
- 0x0.ba903bcc873ce8p0, 0x0.842f11895cc800p0, -0x0.d1e24346182488p0, 0x0.8c288149a155d0p0, -0x0.8901ebea3350b8p-1, -0x0.d305da42c78848p0, 0x0.a59c89154f0cd0p0, -0x0.e4e24580b661e0p-4, -0x0.c538b9371676c0p-4, 0x0.db11ceb44df1b0p-1, -0x0.fde27750986aa0p-2, -0x0.9762c5bbbb45f8p-3, 0x0.8013b647679120p-3, -0x0.83da9c99451298p-2, 0x0.f8fc7b7c03c210p-4, 0x0.ab44fa3b8521a0p-4, -0x0.c61ab902489fb0p-5, 0x0.d789d2d1ccb3b0p-5, -0x0.abcb869f712f40p-6, -0x0.ce1fc4e95b4ad8p-6, 0x0.c5232be5b390d0p-7, -0x0.fc1b058044d778p-8, 0x0.a93c8ef2aca0c8p-9, 0x0.afb1242277fb00p-8, -0x0.934a755537e4f0p-9, 0x0.cc5f2c3bd72308p-11, -0x0.d4a41fdf5b89e0p-13, -0x0.e9ec1a25c15ce8p-11, 0x0.b0e042cdcb8ea0p-12, -0x0.a660d5c5f321c8p-15, 0x0.e90e2e63a2c2d8p-20, 0x0.ffc19b5fb209b0p-14, -0x0.b1635ac7e39a30p-15, -0x0.f2b1f20b6a5240p-19, 0x0.ae1d12191497c8p-19, -0x0.ecb25549e0a128p-17, 0x0.983cbd763a8ef8p-18, 0x0.ac47d235b29bc0p-20, -0x0.916c615d82b988p-21, 0x0.bd1f657b087b28p-20, // x=  0.5625 y=       0
- 0x0.9f937e1d211d08p0, 0x0.92678e0b685d70p0, -0x0.db6acd680d87f0p0, 0x0.af1e2368f46cb8p-1, -0x0.8ba10e597cf968p-4, -0x0.ce99ea377c62c8p0, 0x0.96472603ee99c0p0, 0x0.91475384737980p-2, -0x0.bd2db27a387440p-2, 0x0.b5a1a7dcb889e8p-1, -0x0.bc6babbe47d610p-2, -0x0.9e023dbb2d4940p-2, 0x0.d47a7b08b13a48p-3, -0x0.a9c12e30814ba8p-3, 0x0.83dd3883c35498p-4, 0x0.f7454f8d8b1f28p-4, -0x0.80e7433afe2fb0p-4, 0x0.a982b5afb2f1e0p-6, -0x0.99c0cf44492a08p-8, -0x0.f5b1943fc53990p-6, 0x0.d8d0e037e220d0p-7, -0x0.f432d2f8908140p-17, -0x0.d1fdaa3afcbea0p-11, 0x0.b2bef4cfed8458p-8, -0x0.8a875144e62db8p-9, -0x0.a336e931f403a0p-11, 0x0.b5d43e115f4da8p-12, -0x0.cabb5e7d16d3b8p-11, 0x0.8c75cda3e48ef0p-12, 0x0.ace8fca91d8c20p-13, -0x0.947a41d66d0880p-14, 0x0.b88c14555b7718p-14, -0x0.e5e194a613a2f0p-16, -0x0.ec5923a674fd10p-16, 0x0.b0ee2511dabcb8p-17, -0x0.87756b7cf05638p-17, 0x0.9646dc5c63f3a0p-19, 0x0.fb7a396bea50a0p-19, -0x0.aabe96b09e3ed0p-20, 0x0.9b5846183cbd40p-21, // x=  0.6875 y=       0
- 0x0.844b13b092b978p0, 0x0.9a368abf6f0798p0, -0x0.d6f9fffeee6d68p0, 0x0.99134e345529e0p-2, 0x0.a980313a3bfda8p-2, -0x0.b94e76a2105418p0, 0x0.f0ba9d5422fd28p-1, 0x0.95b93bc8caa278p-1, -0x0.8c2bdc38bd3640p-1, 0x0.f8f66cb0fc0430p-2, -0x0.caf190a34201c0p-3, -0x0.c8b11326f40358p-2, 0x0.f1dbe777de28d8p-3, -0x0.e5117858e4ae98p-5, 0x0.eb453968c93968p-10, 0x0.fff3419243b388p-4, -0x0.f35a37f5286fd0p-5, -0x0.bad9d234c95520p-7, 0x0.a9381fb5424810p-7, -0x0.d2a4903294ab78p-6, 0x0.a72f0e0378c760p-7, 0x0.d3a87e9c645e50p-8, -0x0.dddbe528c90750p-9, 0x0.f3daac558c0c10p-9, -0x0.a2d32f49954280p-10, -0x0.cf26386a18d778p-10, 0x0.b13c1dc41c1a08p-11, -0x0.c48db7e5788f70p-12, 0x0.cf989996a8c8f8p-14, 0x0.8d2f6eb98c3058p-12, -0x0.d38a4174b486e8p-14, 0x0.ae97d974b8de30p-16, -0x0.8ee1119f586d78p-19, -0x0.960d24c47993a8p-15, 0x0.ca82cbac78ba08p-17, 0x0.8255a9f5bd8ac0p-20, -0x0.e5039024154dd8p-21, 0x0.826ff8d8a75888p-18, -0x0.a0bdfdc59747a8p-20, -0x0.e95efa6785a620p-22, // x=  0.8125 y=       0
- 0x0.d499ebee9107e0p-1, 0x0.9c42d7daa00528p0, -0x0.c7504d2fa7f760p0, -0x0.83fbf6b84a5ae8p-5, 0x0.a11ca4cac9e7f8p-1, -0x0.9864f62039d780p0, 0x0.a50e7feb7718d8p-1, 0x0.c3fe089aa0bbd0p-1, -0x0.9ded1e5bc4c7a0p-1, 0x0.f217885ef9fdc8p-3, -0x0.d99c2c4587e290p-6, -0x0.ca2fa3a71c42a0p-2, 0x0.db11978a685908p-3, 0x0.b6ad0df8795438p-5, -0x0.cba11c0a5c6398p-5, 0x0.ce9ab24db49e98p-4, -0x0.ab57d4f7fab1b0p-5, -0x0.8e83c7128aff68p-5, 0x0.a1e516fa26d9e0p-6, -0x0.f888c1c1cd4520p-7, 0x0.98ba5051272c20p-8, 0x0.a09ca9fcc5afb0p-7, -0x0.8fc65e66aba8e0p-8, 0x0.8e7cec35915db8p-10, -0x0.bf58fe0997e880p-14, -0x0.ec69bce410f638p-10, 0x0.b46749ff26ef70p-11, 0x0.c2d43363101670p-14, -0x0.a5f43d46dd2878p-14, 0x0.8091e35c264bf8p-12, -0x0.abafa523099e98p-14, -0x0.b48635546eda78p-15, 0x0.a374740bdb1690p-16, -0x0.d6d45238829cb8p-16, 0x0.fb0fb85ad71910p-18, 0x0.84576777f69ff8p-17, -0x0.c59902e4931cd8p-19, 0x0.87d1334e780188p-19, -0x0.856bc9431cbfa0p-21, -0x0.8a405de3aabce8p-20, // x=  0.9375 y=       0
- 0x0.a592f34b58f4f8p-1, 0x0.998fc874c6adc0p0, -0x0.afec22800e8448p0, -0x0.95d053cff1e980p-2, 0x0.d042d604c5e420p-1, -0x0.e388e46314d770p-1, 0x0.ae1702240e5d90p-2, 0x0.d31bbdb62a1118p-1, -0x0.965f8793f6c2e8p-1, 0x0.cedab462095100p-8, 0x0.e8b99656fccdd0p-4, -0x0.aa42a52ac850b8p-2, 0x0.9f492cd08c3f78p-3, 0x0.ece4863a90eb58p-4, -0x0.a333bd052faa78p-4, 0x0.f556ba508429a0p-5, -0x0.912b60cb95d9c8p-6, -0x0.b79d4c9aab90b8p-5, 0x0.b3583b511f8768p-6, -0x0.b2a93c2b4dc698p-9, -0x0.913ac721f21378p-10, 0x0.9c6207ae096258p-7, -0x0.f6d64bc5a0a8e8p-9, -0x0.b0b70d43097e48p-10, 0x0.df40b80ca27e20p-11, -0x0.b1379fe42d7f68p-10, 0x0.e6d021167ceb90p-12, 0x0.e09edd035eaae0p-12, -0x0.c5a42a129e3428p-13, 0x0.86587cc852b008p-13, -0x0.86342d95f86640p-15, -0x0.9ddcbb5cb05148p-14, 0x0.e94a062e742f50p-16, -0x0.c9ece4fc541368p-18, 0x0.9aa36df5557a28p-22, 0x0.a1325179d49cc8p-17, -0x0.d1a66ee5228968p-19, -0x0.f9fc80448dbbf8p-22, 0x0.ab4dd0e915e760p-22, -0x0.80c1353c419af8p-20, // x=  1.0625 y=       0
- 0x0.f9f6b28eca70e0p-2, 0x0.934eb6b46bacd8p0, -0x0.946a7a04c83300p0, -0x0.f3f5f3a1580ed0p-2, 0x0.e3818883f640b8p-1, -0x0.95c364c10b10e8p-1, 0x0.8e3b5f99ea8638p-4, 0x0.c7e200f9461cf8p-1, -0x0.f89e58b4cf10a0p-2, -0x0.af31f8cdf06308p-3, 0x0.cfbdc12695ce90p-3, -0x0.ec9844f9d13288p-3, 0x0.a70792b2882800p-4, 0x0.980cee3cdd9a58p-3, -0x0.af6149497aa830p-4, 0x0.8014602816f520p-6, 0x0.a4efd152e5fee0p-8, -0x0.ab0ff482d102c0p-5, 0x0.9103198e833040p-6, 0x0.f74875d4169db0p-8, -0x0.aabfb557f76da0p-8, 0x0.d6f851a222a560p-8, -0x0.8931b9c6656e20p-9, -0x0.b6bfc2760b8c60p-9, 0x0.a8237d192d1a00p-10, -0x0.8df3483aba62a8p-11, 0x0.b7ef875fbe4848p-14, 0x0.8a64e9c986b240p-11, -0x0.cfc29706096620p-13, -0x0.ccbbe829e9c018p-17, 0x0.a51054f6b77cf8p-16, -0x0.8f918593ff9548p-14, 0x0.b7422a696a2998p-16, 0x0.c4144ba4fcb948p-17, -0x0.b4161281d57028p-18, 0x0.d775aa11e5c718p-18, -0x0.e6bf4fda6fa410p-20, -0x0.9000f59c45d8a8p-19, 0x0.d156a02e0c4778p-21, -0x0.dae028d2b66938p-22, // x=  1.1875 y=       0
- 0x0.b6e0982a1053c8p-2, 0x0.8ab3e40f4de200p0, -0x0.f006c7b7356df8p-1, -0x0.967583480574e8p-1, 0x0.df989a0b6df670p-1, -0x0.9fdb17a0293528p-2, -0x0.8e840694c7b948p-3, 0x0.aa3e31db6affd8p-1, -0x0.b0d547e29c6da0p-2, -0x0.8f84159fe7d538p-2, 0x0.f2ae5ae97423a8p-3, -0x0.f364d887ef8c88p-4, 0x0.bb73d7b9aced60p-7, 0x0.94eb731dac4a40p-3, -0x0.93763458f678a0p-4, -0x0.a8983d4ff31988p-6, 0x0.aa1ca9bd8de0a8p-6, -0x0.f284f21d1cd018p-6, 0x0.a2ec167dce1370p-7, 0x0.d8668c09d94be0p-7, -0x0.dd9fad334a7df0p-8, 0x0.a0cf70577056f0p-9, -0x0.cb6c38303c6618p-13, -0x0.c3c1e6791ea900p-9, 0x0.994fbe562dfac0p-10, 0x0.80296834b533d8p-12, -0x0.d85c79977c0f38p-13, 0x0.d70dab8a6d7450p-12, -0x0.86a53996166e08p-13, -0x0.ea867c33a75970p-14, 0x0.d1a4fa39da6630p-15, -0x0.934e71e7fa2dd8p-15, 0x0.83b62ef63588f8p-17, 0x0.a598fb79f1c3c0p-16, -0x0.edfcf27af4ac58p-18, 0x0.917121693a6e88p-20, 0x0.adfeabd8c039e0p-23, -0x0.9dcd9114f4f0b8p-19, 0x0.c266bcfecac510p-21, 0x0.e259ab4ef9b710p-23, // x=  1.3125 y=       0
- 0x0.b2412bf4a54838p-3, 0x0.ed27620b8a8d68p-1, -0x0.8b42ea57212070p-1, -0x0.a360285bbd8c40p-1, 0x0.ad08432afa7098p-1, 0x0.90f6e81e6cee08p-4, -0x0.aecd537ab2ea08p-2, 0x0.b4153eb265b258p-2, -0x0.91df67cc7aa710p-4, -0x0.9ecf75ff2d1118p-2, 0x0.b96d466ba8a908p-3, 0x0.d9c9522768b458p-5, -0x0.90875c16a6cdb8p-4, 0x0.9b082fef4e27d8p-4, -0x0.a5beea3b57a550p-6, -0x0.c8a566d7c844d0p-5, 0x0.d145ef95d50a48p-6, 0x0.dc8434a326f5b0p-13, -0x0.8f53e01b59fb60p-8, 0x0.b127dcaf968710p-7, -0x0.f541e011d639c8p-9, -0x0.e0337aea530be8p-9, 0x0.f396cb06c0fa90p-10, -0x0.824b46cbb76668p-10, 0x0.928ad936d3e570p-13, 0x0.d954317ba6e2a0p-11, -0x0.a783a35abefe60p-12, -0x0.c26ec43f712098p-15, 0x0.d764de706e4328p-15, -0x0.e2ad005d17d080p-14, 0x0.85ceddc51b27c0p-15, 0x0.f0bec5b3d42560p-16, -0x0.d43c0c7a3458a8p-17, 0x0.84a27b22d8f1e8p-17, -0x0.bfa36cc8ec1350p-20, -0x0.a20dfb3f8df210p-18, 0x0.ddec6a6bf3f5b0p-20, -0x0.ab81a65ae4fa40p-25, -0x0.829ffa8687ac48p-23, 0x0.8a3ae5648f2668p-21, // x=  1.5625 y=       0
- 0x0.99552a487e3e50p-4, 0x0.c68e7443a97a58p-1, -0x0.8af52e51b26878p-2, -0x0.8e097b6cf2edd8p-1, 0x0.d5871961f3cdc8p-2, 0x0.eb8aedc73b5318p-3, -0x0.a55fca753a5300p-2, 0x0.bc4d7e4e404110p-4, 0x0.ac6d0b250bd150p-4, -0x0.cb18941f12c708p-3, 0x0.8b970240b4c040p-4, 0x0.db2b0aa75b2030p-4, -0x0.8dcf9513712498p-4, 0x0.beedbe915da590p-10, 0x0.86384482e4f010p-6, -0x0.8054282bfc0410p-5, 0x0.a1fc2c1042cf98p-7, 0x0.e2a11adb2dda30p-7, -0x0.f9cb6065015200p-8, 0x0.b64f555a170888p-10, 0x0.ce0d3dbdae08a0p-11, -0x0.d658dcf478db50p-9, 0x0.93b78bee916008p-10, 0x0.d8410438c57b18p-11, -0x0.f72cddaa29ac38p-12, 0x0.9b248963a9d4b8p-12, -0x0.afd4c269a9ceb0p-15, -0x0.db99ecc1e70260p-13, 0x0.a401c0fa581530p-14, 0x0.c88d855bb4ab28p-17, -0x0.df4da700fa6568p-17, 0x0.d20204f5e1a558p-16, -0x0.e2d452483eb470p-18, -0x0.f07535d5c1a8a0p-18, 0x0.c9d1ea26cccf78p-19, -0x0.be366a7a6572b0p-20, 0x0.9c3215a04b0168p-23, 0x0.912d4642519cb0p-20, -0x0.b8da99c5047820p-22, -0x0.f5a07c2e8198c0p-25, // x=  1.8125 y=       0
- 0x0.88da4297554c20p-6, 0x0.9a01fdbf261408p-1, -0x0.95aeb8d5854b40p-4, -0x0.c01b9837e653f8p-2, 0x0.929bd1d69f20d0p-3, 0x0.e070c2f7f75f40p-3, -0x0.a3e8ff11d0f6c0p-3, -0x0.8e54a2be2b4b38p-4, 0x0.d3f1dc2059faf0p-4, -0x0.898861eff009e8p-5, -0x0.d94b523837d8c0p-6, 0x0.ea34a4b07b11a8p-5, -0x0.f84c73199e8120p-7, -0x0.f9dc8436be1dd8p-6, 0x0.8bad692ca3c648p-6, 0x0.b2a711eaf1b210p-9, -0x0.b5651c84d70130p-8, 0x0.c902d550800720p-8, -0x0.8feb13d54ee960p-10, -0x0.eb20c5260783d8p-9, 0x0.d01489179820a8p-10, 0x0.b3b66dd04d69d0p-12, -0x0.e25e6e960a15e0p-12, 0x0.87438de80d57f0p-11, -0x0.e0c261a41c4c88p-14, -0x0.8094ff1bebf718p-12, 0x0.d6f1aec254a738p-14, 0x0.d39a04b0bad168p-19, -0x0.8c3f0739b51300p-16, 0x0.8ed16a9abe98e0p-15, -0x0.9376a0dc8e8968p-17, -0x0.adaca731e49738p-17, 0x0.96c46395787ca8p-18, -0x0.bf5bfcadd658c0p-20, -0x0.834c9706fa5238p-23, 0x0.d4b485eac12160p-20, -0x0.fc12f076360010p-22, -0x0.f37f07589c8e78p-23, 0x0.81e85cf3ce2a60p-23, -0x0.f61a976cac54f8p-24, // x=  2.1875 y=       0
- 0x0.b865db86d11140p-9, 0x0.f9b73f3dfed248p-2, -0x0.ec428144bbde18p-7, -0x0.f8aaa01a2634f0p-3, 0x0.8bd43d179b4930p-5, 0x0.89c6bbc7044308p-3, -0x0.c77f7d7cdf4d58p-5, -0x0.8b2e2c1a70f3d0p-4, 0x0.b9b13a3c307680p-5, 0x0.a231b2eb71d570p-6, -0x0.dd121fcab0b510p-6, 0x0.e1c2231719c6f8p-8, 0x0.8212a8aa029750p-7, -0x0.cc8c0b997ee5f0p-7, 0x0.f8c0fe963d3338p-10, 0x0.eb03501a294eb8p-8, -0x0.d1c07a362231b8p-9, -0x0.c12066100c0dd0p-10, 0x0.b79afd46eead40p-10, -0x0.c5d9e146e65fc8p-11, -0x0.a3270eb7fd8198p-14, 0x0.b2a639145ae368p-11, -0x0.e50e289c501c60p-13, -0x0.bd0baf43d34ae0p-13, 0x0.ded7efced95880p-14, -0x0.9971f777bebe80p-15, -0x0.8afc5546ad33c0p-17, 0x0.b0d41ea540ea68p-15, -0x0.cbccb2d9622238p-17, -0x0.ab3e9f76b20ef8p-17, 0x0.b0536ed20f1ca8p-18, -0x0.8f33343e52dfa0p-19, -0x0.b0f1991e09d3e8p-23, 0x0.837db6774f9320p-19, -0x0.989e32e115f3f0p-21, -0x0.b65959b7ea6328p-22, 0x0.c179ae83af6d58p-23, -0x0.81ec9bf60b8d10p-23, 0x0.c12a14c183d6c0p-27, 0x0.92de876303de48p-24, // x=  2.5625 y=       0
- 0x0.b12ee9ddf25b08p-13, 0x0.c9174e83667158p-2, -0x0.87a7eb0ded8db8p-10, -0x0.9871d9a85935c0p-3, 0x0.c4a6314f749b50p-9, 0x0.815c1b1988a3d8p-4, -0x0.b223007eca1c40p-8, -0x0.f36654795570c8p-6, 0x0.df9c0c6e485468p-8, 0x0.e3f8f64d731a10p-7, -0x0.caaac23ac7c288p-8, -0x0.a917d4486ae4f8p-8, 0x0.845a4ccc93cfc8p-8, 0x0.a512ceb2586da0p-11, -0x0.e79d77f68ec208p-10, 0x0.f20f2737301928p-11, 0x0.b3e90c30c5f320p-12, -0x0.e2984db2d6eeb0p-11, 0x0.a6e1da02293fd0p-13, 0x0.c8d6ca1ae480d0p-12, -0x0.ae2df401a20b88p-13, -0x0.8180f2d6f18a78p-14, 0x0.8549c646d9d2b8p-14, -0x0.93e8d1b7bf6128p-15, -0x0.9f901339e7fb78p-18, 0x0.ed53a2a589ba28p-16, -0x0.fcea552945f530p-18, -0x0.849d13487364d8p-17, 0x0.8571f5b80b2ce8p-18, -0x0.9ca0851e2947d8p-21, -0x0.a624fb0b0d15b0p-21, 0x0.ad6eb847b494f0p-20, -0x0.8baf9b3ba05538p-22, -0x0.e26968e6423218p-22, 0x0.b2d778d20c83d8p-23, -0x0.a5c3831d5ebc78p-34, -0x0.ee8426b55a5da8p-26, 0x0.c95d74bafb64a0p-25, -0x0.936d46bdaf06b8p-27, -0x0.81c2627839f030p-26, // x=  3.0625 y=       0
- 0x0.ce865883c7dad8p-18, 0x0.a988883f23c498p-2, -0x0.b7efa6d55dfee8p-15, -0x0.d1dbdac4dff5f0p-4, 0x0.9d5d3dd1e97830p-13, 0x0.8afa34c19d9390p-5, -0x0.ab8ac0d77d6978p-12, -0x0.c909bbc003da30p-7, 0x0.851bec05ae82e8p-11, 0x0.a049d9d5976b08p-8, -0x0.9b5f3cf6993240p-11, -0x0.87294d3a4fc728p-9, 0x0.8c227462f11560p-11, 0x0.d694949b6729e0p-11, -0x0.c47d6eaa37ced0p-12, -0x0.ffc4b2dbdbe530p-13, 0x0.d1dcf8bc425300p-13, 0x0.d369ab068ae410p-17, -0x0.9da0277653d9d0p-14, 0x0.b981ee06946b08p-15, 0x0.e2e75e94d68318p-17, -0x0.8ebea88b6a4ae0p-15, 0x0.a49a89ba526710p-18, 0x0.eaec9335e1a2b0p-17, -0x0.ad5e36a2e86e38p-18, -0x0.b14ac6d6dc7008p-19, 0x0.8b6407aa791e08p-19, -0x0.bd988f100d10f8p-21, -0x0.ab3feb7890b538p-22, 0x0.c5ccf149cdc1d0p-21, -0x0.86ae01b92393f8p-23, -0x0.895a03572aa6c8p-22, 0x0.cd92ef452c0a60p-24, 0x0.bb6d92a5d8dd28p-26, -0x0.d9e19e9102b350p-26, 0x0.b3fd650f8291f8p-26, -0x0.a3e37272174268p-31, -0x0.b824825f5b1d98p-27, 0x0.c6d7f334cf66f0p-29, 0x0.f9497e9827f730p-30, // x=  3.5625 y=       0
- 0x0.d03df193a0c1d8p-25, 0x0.8e4c17a249d030p-2, -0x0.da00d8e68c4af0p-22, -0x0.911dc77a0d5130p-4, 0x0.ddb6f384bdd860p-20, 0x0.99f15317c20ce0p-6, -0x0.91a7a6405ea690p-18, -0x0.ab1e7ac8be2db0p-8, 0x0.8aa012d31738d8p-17, 0x0.c994ab932857b0p-10, -0x0.cb10fe47e72ab8p-17, -0x0.ff6dd222005a58p-12, 0x0.ed3d07535598b0p-17, 0x0.af862116801268p-13, -0x0.e1d1e01cdfca70p-17, -0x0.8015ba738d7ba0p-14, 0x0.b11874c964e1c8p-17, 0x0.b94eba96e050e8p-16, -0x0.e53ae7866d9f90p-18, -0x0.ea57ca41685928p-18, 0x0.f248b32cda1d10p-19, 0x0.c01090784fc158p-20, -0x0.ca3839e8597e00p-20, 0x0.c199e2fcd66d48p-23, 0x0.f17c081781ae58p-22, -0x0.c39a1385c55458p-22, -0x0.f907f8ed950290p-25, 0x0.de3d9d9e136aa8p-23, -0x0.fe043f87319000p-26, -0x0.9a1f63b541e640p-24, 0x0.d03bf6ead69bc0p-26, 0x0.d64d06b6413200p-27, -0x0.9a7db69c0c4710p-27, 0x0.a7cc48c76f1850p-29, 0x0.d8e7fee93301e8p-30, -0x0.b7833d99e65a18p-29, 0x0.919d6edc620e68p-32, 0x0.857af3d11daae0p-30, -0x0.9b83b575dba578p-32, -0x0.a19ea32f0d13b0p-33, // x=  4.1875 y=       0
- 0x0.8243cd494c35c0p-36, 0x0.e8fb6c6f4e5460p-3, -0x0.a4ddcfd0c47408p-33, -0x0.c0180716ad7eb8p-5, 0x0.cc969c99ee4130p-31, 0x0.a22fc89653fff0p-7, -0x0.a5c080ce838228p-29, -0x0.8c84c850de0cf0p-9, 0x0.c4fe393bbf8ca8p-28, 0x0.fa844f00508750p-12, -0x0.b6e159de3e6498p-27, -0x0.e68c15777208a0p-14, 0x0.89e39f0e8a03d8p-26, 0x0.dc1a9639e99358p-16, -0x0.ad52301547dbc0p-26, -0x0.db87279abe1a90p-18, 0x0.b8e31d174c7128p-26, 0x0.e6f1df97bc1938p-20, -0x0.a97b760ad0b208p-26, -0x0.815a9b57a37b48p-21, 0x0.869f94e64a6a70p-26, 0x0.9a5f28fcf5f148p-23, -0x0.ba330fe9d46048p-27, -0x0.c010f5ea3991c8p-25, 0x0.e07672410f70d8p-28, 0x0.ec90d0a947c888p-27, -0x0.eb0f3bdf4b8350p-29, -0x0.841b78d3b7bb20p-28, 0x0.d3bb7e74a8f8e0p-30, 0x0.df9d14fcde5e08p-31, -0x0.a0794240001b00p-31, -0x0.a0653af410d310p-35, 0x0.c277713d574b80p-33, -0x0.acdd0d55a50b40p-34, -0x0.a1384d4e5ed3d8p-35, 0x0.e0c7ed6860edc0p-35, 0x0.8836416f987a98p-40, -0x0.b00ce5284022f0p-36, 0x0.eb3c2857f12ff0p-39, 0x0.b9f9dd2d0eaaa8p-38, // x=  5.0625 y=       0
- 0x0.d9b318e7f6fea8p-55, 0x0.bd484598ce55e0p-3, -0x0.a86085436908f8p-51, -0x0.fb95a90d5d8048p-6, 0x0.808740e0534ef0p-48, 0x0.a9af64f0ff6b78p-8, -0x0.81097820990e90p-46, -0x0.e87897492229a8p-11, 0x0.bf9231c4678d90p-45, 0x0.a1de0119100c20p-13, -0x0.e02a5e5fca70f0p-44, -0x0.e5575214eedab8p-16, 0x0.d734d7d7c02358p-43, 0x0.a57b04215cb5b8p-18, -0x0.ae371c9eb91730p-42, -0x0.f388de3d0515c0p-21, 0x0.f296a54a8e4b70p-42, 0x0.b706be0ea9c8e0p-23, -0x0.936c1cae10d150p-41, -0x0.8cbe70e9774a90p-25, 0x0.9e2d1fc3269510p-41, 0x0.ddff03dcab2968p-28, -0x0.9724ed10428778p-41, -0x0.b41be929ef1410p-30, 0x0.818139d83e2d80p-41, 0x0.96f5c22b31c468p-32, -0x0.c80d2042ff71e8p-42, -0x0.8376c2ee7ad800p-34, 0x0.8bd465220250d0p-42, 0x0.ef88ead0eee328p-37, -0x0.b15f37ddb72b40p-43, -0x0.e58d60c90831f8p-39, 0x0.cc7517d9f62e80p-44, 0x0.e71b8dcc139438p-41, -0x0.d6325f05ee54f8p-45, -0x0.f0d52a75ed5918p-43, 0x0.cba68d63ba4ad8p-46, 0x0.fb6e8e0429e660p-45, -0x0.af17f538aca2c8p-47, -0x0.f96ee71bcff150p-47, // x=  6.1875 y=       0
- 0x0.bd5155fd4813c8p-69, 0x0.a8570e5903c430p-3, -0x0.a42c8891a48128p-65, -0x0.c661f78e345b48p-6, 0x0.8ce3fbc25217d8p-62, 0x0.ec79951368bec8p-9, -0x0.9f7c02eafb7e38p-60, -0x0.8e9f4f62b4d8b0p-11, 0x0.85e66aa9b386b0p-58, 0x0.ae2b89bc8e9148p-14, -0x0.b1cfe70c82eb00p-57, -0x0.d771ce47e0edc0p-17, 0x0.c26fda42fdbf28p-56, 0x0.870c4c3d9a8978p-19, -0x0.b40000f3c8fca8p-55, -0x0.abb27f88d32a98p-22, 0x0.8ff1032f386f28p-54, 0x0.dd87e5b0c957b8p-25, -0x0.c9e8e4cdb60118p-54, -0x0.91260bbc515168p-27, 0x0.fb5c89a0c7a4e0p-54, 0x0.c15a2aa54ad650p-30, -0x0.8c2c765ce1bac8p-53, -0x0.830c7b9d37bcb8p-32, 0x0.8d21080dff0790p-53, 0x0.b4fd3ea75f1a98p-35, -0x0.81101b4f6b0180p-53, -0x0.ff0b1ac42ea0f0p-38, 0x0.d77fa18bb460d0p-54, 0x0.b7af79680616c0p-40, -0x0.a4eb5d1494fb48p-54, -0x0.878b2a3c3b9660p-42, 0x0.e8284d0cc54ba0p-55, 0x0.cd978f61c50858p-45, -0x0.96ad471a494478p-55, -0x0.a0ea69cd5f28d0p-47, 0x0.b4b3f562218e18p-56, 0x0.82a8e3c44e3d48p-49, -0x0.c87a81b6c80da8p-57, -0x0.dd4bce4052a6a8p-52, // x=  6.9375 y=       0
- 0x0.bc181ee481a348p0, 0x0.b8065d294d79f0p-2, -0x0.8e16879a2e44d0p-1, 0x0.abd099ecbf35f0p0, -0x0.fec24eec181a68p-1, -0x0.8e65d9a47ac6b8p-1, 0x0.e2e786901cccf0p-2, -0x0.a2e4c678e677b8p-1, 0x0.b9ac2c7bdae2d8p-2, 0x0.9ac21a70b0cb08p-2, -0x0.bbb4d5a8b90f20p-3, 0x0.c08b2f5eee6990p-3, -0x0.b8303a79329a60p-4, -0x0.cf268789f49dd0p-4, 0x0.d33dc499dc59f0p-5, -0x0.a424f5d9c1b9c8p-5, 0x0.8943e32abed7e8p-6, 0x0.c9436db1f149c8p-6, -0x0.b4a8bbcf1398a8p-7, 0x0.d8956a35a309e8p-8, -0x0.a1d588159d2058p-9, -0x0.99c623e2ba6c48p-8, 0x0.f987b9eeabcd48p-10, -0x0.e5b046262fb298p-11, 0x0.9b0cbb4730e4b0p-12, 0x0.c1cee346ac3c00p-11, -0x0.909cb6e8caa9e8p-12, 0x0.c734dfe6ea7ec8p-14, -0x0.f34e48214829d0p-16, -0x0.cff35f53304328p-14, 0x0.9071d78ceb7e40p-15, -0x0.8cd025eef983a0p-17, 0x0.997b579cf33a38p-19, 0x0.c24ba5910a9f78p-17, -0x0.fd8d411366d510p-19, 0x0.9b91ef2ee13c78p-21, -0x0.8ee19d25a29050p-23, -0x0.a0c8166eb8a2c0p-20, 0x0.c6791174562430p-22, -0x0.df27b6623f2f68p-26, // x=    0.25 y=    0.25
- 0x0.8798873b803a30p0, 0x0.8536d5e485d8e0p-2, -0x0.ac78c6b7194260p-2, 0x0.c51c751c290868p-1, -0x0.f218cc7195b980p-2, -0x0.949d22e3afb4a0p-2, 0x0.cefdc11062f9f0p-3, -0x0.82fadfb173b840p-2, 0x0.ffc8b4f03bde98p-4, 0x0.f9b878ec09e030p-4, -0x0.8722c609ba9888p-4, 0x0.e4d0531e51e648p-5, -0x0.bd66516f9ff3f8p-6, -0x0.8602316c76b340p-5, 0x0.f6fb9d9cb24830p-7, -0x0.91ff9df89ea6e8p-7, 0x0.d25e3ee2e50908p-9, 0x0.d5a5b246ce79f8p-8, -0x0.aecd8280433ef0p-9, 0x0.8dc555d912d9b0p-10, -0x0.b24d5ed7f69bc0p-12, -0x0.8813e9c2f25918p-10, 0x0.ca892d5121aa70p-12, -0x0.cfabb44cd32748p-14, 0x0.dc29cc06f2eba0p-16, 0x0.90a6719a5c4848p-13, -0x0.c6eebe8630b440p-15, 0x0.cbf8f9a5928338p-18, -0x0.92318d950cc5a0p-20, -0x0.8411397402f998p-16, 0x0.a9b1f7f315c258p-18, -0x0.88ec63e8b17a50p-24, -0x0.8e8c4883cab818p-24, 0x0.d370692a809568p-20, -0x0.ffed96e54582f8p-22, -0x0.c392598d8468d8p-25, 0x0.b25fcb2d6736b0p-26, -0x0.96b3dfbeee28d0p-23, 0x0.aced0f29de6020p-25, 0x0.8a315f0ca0c7e8p-27, // x=  0.3125 y=   0.625
- 0x0.aefed7b2cd1628p-1, 0x0.91cf57f5336d00p-3, -0x0.8e3c4034c04458p-3, 0x0.b60e26a9fede10p-2, -0x0.a8bfa1392f3810p-3, -0x0.bf55c15eec73a8p-4, 0x0.d534e4b51223e8p-5, -0x0.8e564749849120p-4, 0x0.dd6833ffda15c8p-6, 0x0.d196cc07548508p-6, -0x0.bb7bf419f8e788p-7, 0x0.a01fd6b6037810p-7, -0x0.d87583896db448p-9, -0x0.9b6f3acb37c4d0p-8, 0x0.f1c4843a45ec20p-10, -0x0.890a1ca1ddc008p-10, 0x0.a2640fe88e23f0p-12, 0x0.b1e7642e8b3aa0p-11, -0x0.f951dc6646e558p-13, 0x0.b33165ca11cb88p-14, -0x0.b5e803c9d66d60p-16, -0x0.a7315a9d87ae50p-14, 0x0.d774deb4e2c5f8p-16, -0x0.a54236023bcc68p-18, 0x0.fa0d22f17415a0p-21, 0x0.85d36912f8e580p-17, -0x0.a0b1951f185d10p-19, 0x0.eafb0e7a00cc40p-24, 0x0.870b1760f06b40p-26, -0x0.baf0dc6cdc5a70p-21, 0x0.d31c4dd0ba5be0p-23, 0x0.96265700694438p-26, -0x0.8ed36ba8a55558p-27, 0x0.e7d23fbebbf100p-25, -0x0.f7e65387e36af0p-27, -0x0.d8bd71175471d0p-29, 0x0.925fac5549b1d8p-30, -0x0.813e6df16bdbc8p-28, 0x0.838e354eb38560p-30, 0x0.b7413eb2e281a8p-32, // x=   0.375 y=  1.3125
- 0x0.bd20603b211240p-2, 0x0.aa78d0107163e0p-4, -0x0.cd3331d58c7e20p-5, 0x0.e2a8ed1727f230p-4, -0x0.fa9d6f2db88eb0p-6, -0x0.b09a3a2aeeb3d8p-6, 0x0.81635585f49508p-7, -0x0.800ba381d58630p-7, 0x0.f09a47a9371758p-10, 0x0.aad6931d7f3418p-9, -0x0.d0ba10416587f8p-11, 0x0.cc7c7abad60fb8p-12, -0x0.96c3f3b6dac9b0p-14, -0x0.ef8737edd43fc8p-13, 0x0.824d93ff17cc80p-14, -0x0.a91dff8c864130p-17, 0x0.c31387cb11ac18p-22, 0x0.8741acd43a96d0p-16, -0x0.86890941eeae18p-18, -0x0.ef1c53a1b7a360p-22, 0x0.fae7300562b8a0p-23, -0x0.809fb502ec13a0p-20, 0x0.ece47bd055db00p-23, 0x0.b43e4847869f98p-24, -0x0.dd3e2d03062fb0p-26, 0x0.d2629c813ed288p-25, -0x0.b4483bef4f1908p-27, -0x0.f74874049d7420p-28, 0x0.81615d8b8f0088p-29, -0x0.9501a79c2b39f0p-29, 0x0.ed3d46eebf26e0p-32, 0x0.80a57ccf5d87d0p-31, -0x0.f54b6f560c81f0p-34, 0x0.b5609719d5c4e0p-34, -0x0.847c0ee603d520p-36, -0x0.e18e85bc424410p-36, 0x0.c8e15feaf114e8p-38, -0x0.b734a31a1b8960p-39, 0x0.eba9f4dc064560p-42, 0x0.adcda4bae9eaf8p-40, // x=  0.6875 y=    2.75
- 0x0.fe0d99297f8ff8p-2, 0x0.9a8ffddfb446f0p-3, -0x0.ee12da567583c0p-4, 0x0.c0ffae56791d48p-3, -0x0.80caa0c6474770p-4, -0x0.801c321432bf18p-4, 0x0.e66e1d4268fc28p-6, -0x0.9680221e19d8a8p-6, 0x0.951d1e0608f450p-8, 0x0.b7da68e8f7e880p-7, -0x0.85ea2ce8102d20p-8, 0x0.dec532f59f1c28p-11, -0x0.ce51337cc1c920p-15, -0x0.b50395553c3670p-10, 0x0.e55c428d46d290p-12, 0x0.e5f3666e9d3810p-15, -0x0.9c00769f373cf8p-15, 0x0.891f36df454608p-13, -0x0.9b61b3679ae688p-15, -0x0.8bcad4d9d01110p-16, 0x0.d2d590a9fddf30p-18, -0x0.a7465b265c1b48p-17, 0x0.ab356f42f418e8p-19, 0x0.8f3897d0756b58p-19, -0x0.b48e80c76f9978p-21, 0x0.a6698d130eadc0p-21, -0x0.99088761d3c788p-23, -0x0.d69d61b6c40328p-23, 0x0.f2e072d82dfc10p-25, -0x0.841801df83ed00p-25, 0x0.d2a51cdd6f15e8p-28, 0x0.83b3847b924620p-26, -0x0.8982571f5c6630p-28, 0x0.95ce66448e6f10p-30, -0x0.acbf12eff3ef50p-33, -0x0.8ab17c4eb6be20p-30, 0x0.877b1c04a7f6a0p-32, -0x0.c6a4e8c9faae48p-37, -0x0.f80a4936b1cb78p-39, 0x0.806d54153f8c28p-34, // x=  0.6875 y=   1.875
- 0x0.a36a1463086f90p0, 0x0.a6d133e3361538p-1, -0x0.f36b8ed475d488p-1, 0x0.f77fa1c214e8d8p-1, -0x0.8f3e78eb50baa8p-1, -0x0.e5b6210f231480p-1, 0x0.abbe2caee39dd0p-1, -0x0.811beeaa3eea90p-2, 0x0.a4ef92fa5c39b8p-4, 0x0.db0d918df9e7b0p-2, -0x0.f778b91476a0c0p-3, 0x0.ed6adec2d1e938p-8, 0x0.e5fcd98db9d1d0p-7, -0x0.fd4c6ae140f490p-4, 0x0.ee6ce10d931670p-5, 0x0.ef23b8800cb058p-7, -0x0.a1c36b623734a8p-7, 0x0.d08c93378dc6b8p-6, -0x0.aac9abc2178640p-7, -0x0.b4ffc0632212a0p-8, 0x0.b3a03a924bc460p-9, -0x0.83a91e28b87620p-8, 0x0.bfd22f83f2e730p-10, 0x0.a32ec01b0f26a8p-10, -0x0.8a1f499fef10e0p-11, 0x0.845d843c1f2e70p-11, -0x0.ad3971f1c8e8d0p-13, -0x0.dc517ff3d013e0p-13, 0x0.a6dcffda3157b8p-14, -0x0.d6dad4d813b0f0p-15, 0x0.fbe78172a0bb60p-17, 0x0.f167b5f2b7dcd8p-16, -0x0.a784fc922fe5a0p-17, 0x0.8ac26f443bae08p-18, -0x0.8dedd7c4b5f390p-20, -0x0.dfd24044ae6ef8p-19, 0x0.905b4c7ad5a8d0p-20, -0x0.8370030c085ac0p-22, 0x0.cf4762d2aa70e0p-25, 0x0.b43413487cd730p-22, // x=     0.5 y=    0.25
- 0x0.837517e322d948p0, 0x0.8125e8f7360738p-1, -0x0.a6a18cc7d861a8p-1, 0x0.a986142bf0f2f8p-1, -0x0.a8d88cffc70448p-2, -0x0.8d308dec015f08p-1, 0x0.bf5d91f7b4e478p-2, -0x0.ff6e05d14cece8p-4, 0x0.ea3151523d3138p-6, 0x0.de9dcbad971d28p-3, -0x0.e64fc4a6b86ca8p-4, -0x0.9b710981b7d9d0p-8, 0x0.b062aff871dab0p-7, -0x0.d8687d2181b390p-5, 0x0.bb3561234922c0p-6, 0x0.8820a66001f350p-7, -0x0.9f773508119410p-8, 0x0.96768d732f24a8p-7, -0x0.e213841eda7320p-9, -0x0.a0cc07b7ce49b8p-9, 0x0.9247c0356f8e68p-10, -0x0.9f58ac8f2aeca8p-10, 0x0.d30d55b4693a10p-12, 0x0.f5e18049c39840p-12, -0x0.c1a1eaf7728a10p-13, 0x0.832f0fbda85aa8p-13, -0x0.985d934e0885a0p-15, -0x0.903a0136eb4478p-14, 0x0.cc92f193135690p-16, -0x0.a39942410bb3e8p-17, 0x0.9eacfe09ae1f88p-19, 0x0.8ad5c60dfb6270p-17, -0x0.b505a9ec42bc28p-19, 0x0.8356c62ff11130p-21, -0x0.983851a11849a0p-24, -0x0.e36f471e5f1798p-21, 0x0.8a043786ee05c8p-22, 0x0.adb45305fe4c90p-29, -0x0.8308b7963c0898p-27, 0x0.a2257c7786eb08p-24, // x=  0.5625 y=     0.5
- 0x0.d1adf3c17223a8p-1, 0x0.a4c79d8a802bb0p-2, -0x0.b76a10c0e083c0p-2, 0x0.ec346dafc72d50p-2, -0x0.db04bc392f6b18p-3, -0x0.89284c949bc1e8p-2, 0x0.a6aad8e93cc040p-3, -0x0.a89f2b5dc783b0p-4, 0x0.cdfbfcf3d7d558p-6, 0x0.afe7df8f827898p-4, -0x0.a6b4fe38f48d98p-5, 0x0.9d8a5b6492a120p-8, 0x0.aae98b17ce8cd0p-11, -0x0.90ae121180d870p-6, 0x0.e8ee5d5c33b2a8p-8, 0x0.aa9fb9328559b0p-10, -0x0.e620aac79374f8p-11, 0x0.af74a0451db268p-9, -0x0.f8de4cdc5260b8p-11, -0x0.eda090b2a1ff58p-12, 0x0.d4ec5ef77befc0p-13, -0x0.a6e4554093a880p-12, 0x0.d43be04d7ab068p-14, 0x0.ad586de4dc3df8p-14, -0x0.832f03fb6eb980p-15, 0x0.801e664f4276f0p-15, -0x0.92d06f49f44530p-17, -0x0.bb0f46102f6058p-17, 0x0.fd8240b2f3e980p-19, -0x0.9f4f371d4569b8p-19, 0x0.a2ce7c05170298p-21, 0x0.a44650b46eb360p-20, -0x0.cc8886d4bab760p-22, 0x0.9afc8a92d27d70p-23, -0x0.865bf089ae06c0p-25, -0x0.f58427715b96b8p-24, 0x0.8e772f36c45f00p-25, -0x0.c90b98667b3e78p-28, 0x0.d925ede2cab258p-31, 0x0.a03716dbca1cf0p-27, // x=  0.5625 y=   0.875
- 0x0.8252f5c9c29c68p-2, 0x0.e12b0c0394aff0p-5, -0x0.c2728769b8fcf8p-6, 0x0.dc1a8bfa53bd70p-5, -0x0.ae11f5afb2fd38p-7, -0x0.f3bdbfa1ad3e80p-8, 0x0.83a6c51c8be668p-9, -0x0.80531702091fd0p-9, 0x0.ae12fc2e8ca660p-12, 0x0.8172ef7f03e8b8p-11, -0x0.ed85fbf36ae550p-14, 0x0.d2a2e26d2b25e0p-15, -0x0.d0f75d6f1cc1e8p-18, -0x0.ce0ede6998bcc8p-16, 0x0.aa60a96ddbc000p-18, -0x0.e656920dd158b0p-22, -0x0.a25930f713af98p-24, 0x0.86ebd15007bf50p-20, -0x0.cd3da453419470p-23, -0x0.c058798d544688p-25, 0x0.f0bd43cc4e20c0p-27, -0x0.9622d356262b08p-25, 0x0.d33de54e381830p-28, 0x0.f6cb797e4454c0p-29, -0x0.e3568552053720p-31, 0x0.8eafefe7914880p-30, -0x0.b8640b3a1bdd40p-33, -0x0.c30b9eace02228p-33, 0x0.9ea91c27af1ae8p-35, -0x0.e252327a05f1a0p-36, 0x0.822ac6d4dcd6e8p-38, 0x0.f73f6481122538p-38, -0x0.b9b5be884e83a8p-40, 0x0.888ce78107cd20p-41, -0x0.f471576f336db0p-45, -0x0.87086f55e20e10p-42, 0x0.bea4dba8e16dc8p-45, -0x0.918a6056cf58e0p-48, -0x0.fb6d7de1fb4528p-53, 0x0.82e91e439f8368p-47, // x=  0.9375 y=   4.125
- 0x0.934035cda7c8e0p0, 0x0.c210dcf79dd348p-1, -0x0.878c0c032a4648p0, 0x0.bbe5a005265ca8p-1, -0x0.9c2fe92c224580p-2, -0x0.f3ba5af940aa10p-1, 0x0.aca5a6c3df6528p-1, -0x0.ab21c02911bca0p-5, -0x0.81f06a93fb0db8p-4, 0x0.cf4042c9e38220p-2, -0x0.da8af024ebbfb8p-3, -0x0.a007de7fad4170p-4, 0x0.f212bf6c2448b0p-5, -0x0.ce923801c3f548p-4, 0x0.b1068cd6a1cfa8p-5, 0x0.93ee3c54266580p-5, -0x0.9ddda42e9fe888p-6, 0x0.8a36f38ca3bb98p-6, -0x0.c44b690b85ff30p-8, -0x0.98589fecaf9f30p-7, 0x0.879846e24583a0p-8, -0x0.faae899fdb1fb0p-10, 0x0.8b764bd76fca20p-11, 0x0.e16d6b5e62fbf0p-10, -0x0.b088e8219abf90p-11, 0x0.f648f81a7e17e8p-14, -0x0.d3046c5e94fc90p-17, -0x0.8310b62e4a31d0p-12, 0x0.b962b2c3223458p-14, 0x0.c91473f7494120p-18, -0x0.b834efb80bf7c0p-18, 0x0.fab2dd99fb6520p-16, -0x0.a285738c520658p-17, -0x0.c37198828eb000p-19, 0x0.aaca24471e6df8p-20, -0x0.ca75f03a94b358p-19, 0x0.f2b5d85ad98488p-21, 0x0.859d59d491b2d0p-21, -0x0.c1a11822796ca8p-23, 0x0.8c235b831b3be8p-22, // x=   0.625 y=    0.25
- 0x0.cdb0a38c5a9d40p-1, 0x0.8ca7d93544d490p-1, -0x0.9e6d3a417d35d0p-1, 0x0.b81ab944a49f58p-2, -0x0.9b7c528d8b7dc8p-4, -0x0.e8dce02072e750p-2, 0x0.8743c6224ca068p-2, 0x0.9cc0de94782c10p-5, -0x0.eb23abd387fdb8p-5, 0x0.8466edafeece98p-3, -0x0.e0065ae5e099d8p-5, -0x0.b00a0978048528p-5, 0x0.ccc1b52cdd1a58p-6, -0x0.a45fb97f077408p-6, 0x0.cc83fe76c10698p-8, 0x0.cc607286676010p-7, -0x0.b66e6112fc01a8p-8, 0x0.c58facd77d2fd0p-10, -0x0.b4c6209a050c98p-13, -0x0.94d40a70513060p-9, 0x0.e0d1d5d2df9f00p-11, 0x0.bae7955696d8e0p-14, -0x0.b2b8889a46c190p-14, 0x0.9e7ab9cc9c3e98p-12, -0x0.d18652845a2500p-14, -0x0.c4c109450cce70p-15, 0x0.b0e8369daec460p-16, -0x0.822a026af9ac20p-15, 0x0.97e6e30c72ff40p-17, 0x0.8d460ef3d2e2d0p-17, -0x0.cf6f0f2094e368p-19, 0x0.a5d4b2fef0c8e8p-19, -0x0.a7b63003fe4350p-21, -0x0.8e8be8f2848818p-20, 0x0.b95e710546b358p-22, -0x0.99d1aecae7ef40p-23, 0x0.f319182412d918p-26, 0x0.e5b293a088f600p-24, -0x0.8845bcc8710f18p-25, 0x0.8bd4cd3f903dd8p-28, // x=  0.8125 y=   0.625
- 0x0.9ca8ca9d9d8d48p-1, 0x0.952832ff3890f0p-2, -0x0.8840130232a0d0p-2, 0x0.81c88c1dd72d50p-2, -0x0.a18b5a9093fd00p-4, -0x0.a8961a29703980p-3, 0x0.a9dc2d79c6cb68p-4, -0x0.e6ab19519c9348p-7, -0x0.c8246571dff480p-9, 0x0.94465c0cf1dba8p-5, -0x0.e6bdb12dbe3af0p-7, -0x0.96f1c1b7192e90p-8, 0x0.bee5805443bfe0p-9, -0x0.a23c12b024f160p-8, 0x0.cf037eb3832710p-10, 0x0.baccb7a657d578p-10, -0x0.9e3ef9053a2250p-11, 0x0.ee659729087740p-12, -0x0.f295ebbae6b860p-14, -0x0.f258e146106400p-13, 0x0.ab70adb3b3e950p-14, -0x0.cd3b9fed524358p-16, 0x0.e3cfec55b36778p-19, 0x0.e2f8044b6c12f0p-16, -0x0.8dba9a7b144200p-17, -0x0.9d995a8e662d28p-22, 0x0.801ca9963049d8p-21, -0x0.a7dc8b803bd5b0p-19, 0x0.bd2e3c0e94d120p-21, 0x0.84a19b0ca2a038p-22, -0x0.d4303d4f14dd70p-24, 0x0.cb3f532b81bbe0p-23, -0x0.d03b17ade84fd0p-25, -0x0.94e441ad98cf58p-25, 0x0.bfbdba3d6565e8p-27, -0x0.cb2a576574e370p-27, 0x0.bc1420f4db0010p-29, 0x0.e789e5be418a20p-29, -0x0.84b4d1cd33b4e0p-30, 0x0.a3f954efa6f830p-31, // x=  0.8125 y=    1.25
- 0x0.e06eaf43b65a88p-1, 0x0.e2050246292be0p-1, -0x0.8bdf98c9b54440p0, 0x0.8bf59cd7606728p-2, 0x0.975d3ee0cba730p-3, -0x0.d950aa7f88b6e0p-1, 0x0.80346b76e7ded0p-1, 0x0.939d43c7ce42a8p-2, -0x0.83918547440468p-2, 0x0.f15d83f4c90400p-3, -0x0.b1c94fb491c200p-4, -0x0.b0417027442910p-3, 0x0.c5e72b97cf2cf8p-4, -0x0.ad1d94f4f314f8p-6, -0x0.e2aff6cbd0f3e0p-11, 0x0.c2cd75b5ceafb0p-5, -0x0.ac00c8f130a958p-6, -0x0.a604991b9efc98p-8, 0x0.82da9386d498e8p-8, -0x0.89e7dfdd02db78p-7, 0x0.c9d32de682e0c8p-9, 0x0.95db17feac55c8p-9, -0x0.91c29a9fe32348p-10, 0x0.868fa28a073e08p-10, -0x0.a1a5729468ccc0p-12, -0x0.fe0225096ed0a8p-12, 0x0.cb60d075dc79e8p-13, -0x0.a995b94b8af530p-14, 0x0.8ddf641bb61288p-16, 0x0.97d198dd458410p-14, -0x0.d53efc0e1d8c30p-16, 0x0.ede0f9df8ef308p-20, 0x0.c1bcf160880fb0p-21, -0x0.8dbe3c86f21fa0p-17, 0x0.b30a63a90ae1b0p-19, 0x0.abca21cc7836a8p-21, -0x0.acc34862e721c8p-22, 0x0.d76480cccc3640p-21, -0x0.f70b5dcc816978p-23, -0x0.8e984758f86c98p-23, // x=   0.875 y=    0.25
- 0x0.9c076eb672a9b0p-1, 0x0.d5375867f4be38p-2, -0x0.c5af0a09e12a50p-2, 0x0.d1d2d0cde57030p-3, -0x0.9766afc1170f58p-6, -0x0.f0e36d8a0c97f8p-3, 0x0.e734a6027628c8p-4, 0x0.854e87361ac480p-5, -0x0.fd676cee460568p-6, 0x0.b7eaf17695a4d8p-5, -0x0.f2ddd35852a9a8p-7, -0x0.986b01c4711ef0p-6, 0x0.94478de3fed238p-7, -0x0.fa9fe94c2ce538p-9, 0x0.91f832e14bf778p-11, 0x0.fa875b647e7358p-9, -0x0.bd8a7471e7e9b8p-10, -0x0.9195fb42923000p-13, 0x0.aedbbf48c67ff8p-13, -0x0.825d1dbf72fc00p-11, 0x0.a400af74ef5f90p-13, 0x0.c4df7ac96fd9a0p-14, -0x0.aedaaf868a24e0p-15, 0x0.bc6007601aa590p-15, -0x0.c330049e1077e0p-17, -0x0.87c16f242566a0p-16, 0x0.bfb8950ebf7598p-18, -0x0.b07e4b727f9458p-19, 0x0.fc5c2109719250p-22, 0x0.fb2b99d89ed1c8p-20, -0x0.9a5900b4763e30p-21, 0x0.a53b8be6773d28p-25, 0x0.99faa3b893a370p-26, -0x0.b328f5dd976c98p-23, 0x0.c52b29a4526588p-25, 0x0.df416672a410b8p-27, -0x0.c215737549f480p-28, 0x0.ce11ec898103d8p-27, -0x0.cc7286dd1c75e8p-29, -0x0.8be8ac51794e78p-29, // x=       1 y=       1
- 0x0.aa181815cad0c8p-1, 0x0.b1dff83d3d4f38p-1, -0x0.b7933af111ac70p-1, 0x0.ed37138332a420p-4, 0x0.9f1f1f0a2c82d0p-3, -0x0.eb2f56b8426598p-2, 0x0.dc08580b78ab78p-3, 0x0.c910ff55e902e8p-3, -0x0.922fbe75b41bc8p-3, 0x0.92b8721f80e250p-4, -0x0.b3633a903a2288p-7, -0x0.a4bc16fca2bdd0p-4, 0x0.9be314cd7f0b80p-5, 0x0.d2c88a74fe32c8p-8, -0x0.f5f6b422382580p-8, 0x0.ff76dcc7fba820p-7, -0x0.b692ea8fe84300p-8, -0x0.9daa7163363950p-8, 0x0.a07eecbd1e2398p-9, -0x0.e01bb5296c0fe8p-10, 0x0.ddc013ada26068p-12, 0x0.8da80ea8bf83c0p-10, -0x0.e0c66e1742a7f0p-12, 0x0.8577ac013affa8p-14, 0x0.b409243be9b548p-17, -0x0.a33aef17e577a0p-13, 0x0.db107bd549e1d8p-15, 0x0.f8cb10fd4c52b8p-17, -0x0.8cf3aa93643890p-17, 0x0.885f4d20795478p-16, -0x0.9d5dcbfde31fb8p-18, -0x0.f9a8662f422770p-19, 0x0.c158722c5c9c78p-20, -0x0.a7166c1cec4e88p-20, 0x0.a03b4b93be1738p-22, 0x0.8882eadc0404b8p-21, -0x0.b35bf8796c8868p-23, 0x0.848298b49281f8p-24, -0x0.a2f9a353149ca0p-27, -0x0.ddcb653089f420p-25, // x=  1.0625 y=     0.5
- 0x0.917029429f5490p-2, 0x0.c5c7437880d9c8p-4, -0x0.bd4f597b86e8b8p-5, 0x0.ffb171da776e20p-5, -0x0.bfb08b6e5ddc58p-7, -0x0.80d72352ee7a68p-6, 0x0.94195727e1e688p-8, -0x0.de9afefb7a0578p-10, 0x0.de86d9588f7950p-14, 0x0.97abc2c26f0588p-10, -0x0.8d758cfceeade8p-12, -0x0.bd557547943980p-15, 0x0.d4780806c43718p-16, -0x0.f239a02d969390p-15, 0x0.bdfaa050983898p-17, 0x0.91115b17eccce8p-17, -0x0.a3bdaf5008b488p-19, 0x0.868347c3670b90p-19, -0x0.a511fefd94f388p-22, -0x0.a4ef8a2b68f6a8p-21, 0x0.98eedaedec1548p-23, -0x0.9a2273719cb160p-25, 0x0.979ea577491798p-30, 0x0.8482ceae06c0a0p-25, -0x0.d8329fa02d4d40p-28, -0x0.943888f695dcf8p-30, 0x0.81300a6a732850p-31, -0x0.a6842b07b848d0p-30, 0x0.f1e2725f9693f8p-33, 0x0.9983a0f8505560p-33, -0x0.9b69ff9fd7d7f0p-35, 0x0.a4abf2106acc70p-35, -0x0.cf3639de1d6338p-38, -0x0.8ed489e0286f60p-37, 0x0.f4e135618de0d8p-40, -0x0.e96b1ef7ed70f8p-41, 0x0.d81b29ceead828p-44, 0x0.c68eb69b0e4cb0p-42, -0x0.997a6b51a193f8p-44, 0x0.ddcd850eed0fa8p-48, // x=    1.25 y=  3.4375
- 0x0.dfb8ee327567e8p-2, 0x0.890090620ff6f0p-2, -0x0.c1d8d8665f44b8p-3, 0x0.e7911cc4cacd10p-4, -0x0.9c05d9ee89ce40p-7, -0x0.b73bcb24bbd420p-4, 0x0.89279abab424e8p-5, 0x0.a20f4607b04898p-7, -0x0.802332c500b7e8p-7, 0x0.a8bff698012688p-7, -0x0.a5e3f8867c6138p-9, -0x0.fad2edc200d0b8p-9, 0x0.c5c3e0587dfb40p-10, -0x0.d9694f71848330p-12, -0x0.82aaa2ae547f80p-16, 0x0.86c6fc6ef16600p-11, -0x0.a2fd4c5af54d70p-13, -0x0.d38050f6e824b0p-15, 0x0.e89c1f54223b20p-16, -0x0.aff93fa0ff3368p-15, 0x0.a7b2685fa754d8p-17, 0x0.bc29b80dbb68d8p-17, -0x0.81eedb1a6c22b0p-18, 0x0.870e6323eeab30p-19, -0x0.9d659dea904fc0p-22, -0x0.a0fb92e38e56c0p-20, 0x0.b6edefee25cf90p-22, -0x0.c384f02478b1b8p-29, -0x0.a8c86aa83b86e8p-26, 0x0.c0a7c1b98bd858p-24, -0x0.bcbaaea7f38c48p-26, -0x0.ae6774f7465100p-27, 0x0.80c53d24c450f0p-28, -0x0.ab91ab881c3900p-28, 0x0.8f42fe76a9f678p-30, 0x0.a2cf226e6b96e8p-30, -0x0.ba6883cceabcf8p-32, 0x0.d63b4c290a4db0p-33, -0x0.8621184a017600p-35, -0x0.c62233c0a55670p-34, // x=    1.25 y=  1.6875
- 0x0.bd9af02f346810p-2, 0x0.c2ca4140998e80p-3, -0x0.edbe8eaa404218p-4, 0x0.ba4c965dc5efd8p-4, -0x0.d9aa9952ff6ef0p-7, -0x0.c6588dba6ca628p-5, 0x0.862d21005fd3a0p-6, 0x0.d8eaf5fc3366c0p-10, -0x0.9313903e1b4f58p-9, 0x0.9a00960ca2f178p-8, -0x0.95e3c5fa179e90p-10, -0x0.916f3376066228p-10, 0x0.da352b63df02b0p-12, -0x0.ea551337d0ab90p-13, 0x0.e275061db26330p-16, 0x0.8bbe499db98ae8p-13, -0x0.9f256425bbd118p-15, -0x0.cc5971f8d06aa8p-19, 0x0.edea9db7c72308p-19, -0x0.a3ac2995db1948p-17, 0x0.98342c3790c340p-19, 0x0.d353c3c59f7370p-20, -0x0.916959d32fd280p-21, 0x0.fc6ef7d27d2600p-22, -0x0.b2a21ae5b4a7e8p-24, -0x0.ae178ab6ce4978p-23, 0x0.bd06a7e77e9570p-25, -0x0.b99f2f904f8680p-27, 0x0.adfd860ea24b30p-33, 0x0.bdb1f4f58cd110p-27, -0x0.b186394f9f1b68p-29, -0x0.9433d49aa44568p-31, 0x0.8ac32b409a4838p-32, -0x0.9b5c689027aff0p-31, 0x0.fd9ef634767aa8p-34, 0x0.b879ee4a82a100p-34, -0x0.d2286e38b85190p-36, 0x0.bf2996209fc398p-36, -0x0.81e8ee786c0328p-38, -0x0.d93e0959c90c58p-38, // x=  1.3125 y=    2.25
- 0x0.bc9becdd2bcdc8p-3, 0x0.96051537846400p-5, -0x0.bf38ce3ef46118p-7, 0x0.ea200fe9cf17a0p-6, -0x0.89ed3fd3e66cc0p-8, -0x0.b2992f6dc3cf58p-9, 0x0.90f62262dc5960p-11, -0x0.996182a2196750p-11, 0x0.9efbb9ee684cc0p-14, 0x0.d7c783e3b28258p-14, -0x0.96d3b53d9b4d88p-16, 0x0.957fff1bb66bf8p-17, -0x0.ee5020ff468cd8p-21, -0x0.c8895983146790p-19, 0x0.ff6bac6ad409a0p-22, -0x0.f80828047edfb0p-25, -0x0.dcb0fa725c0920p-29, 0x0.9c7a27dc5d99b0p-24, -0x0.b8d5813774c518p-27, -0x0.9a697ed2f1bff8p-29, 0x0.a0e7f272ee0458p-31, -0x0.d29b16a98a1800p-30, 0x0.e74142fd08f850p-33, 0x0.84c75d01bfa2a8p-33, -0x0.c348a652b673c0p-36, 0x0.f400d74f4c0f38p-36, -0x0.f5feafe3dec5b0p-39, -0x0.85799e248ba190p-38, 0x0.acfec2e1f9af18p-41, -0x0.ea7d29bef48ee0p-42, 0x0.cf120e88e61048p-45, 0x0.d6ed49c8cff730p-44, -0x0.80d2c968eea2d8p-46, 0x0.a1dcca3efd4d38p-48, -0x0.c370b4c13234b0p-52, -0x0.959f87fc43c0f0p-49, 0x0.a8cfc6d6f98828p-52, -0x0.e6470a3b7b5528p-58, -0x0.aebc8050c3cd60p-58, 0x0.b94c18e60bed78p-55, // x=  1.1875 y=  5.8125
- 0x0.8ff2c463964e20p-1, 0x0.e55c6635ac3d88p-1, -0x0.e3325f51aedac8p-1, -0x0.9be7aba3c32e68p-3, 0x0.e83524265a4590p-2, -0x0.fc8e0ed9452a28p-2, 0x0.9a02d554ac4b40p-3, 0x0.d534d446de1a90p-2, -0x0.872ccedf7485c8p-2, -0x0.9f083f2bc0f680p-6, 0x0.81a5dcd0885570p-4, -0x0.8616697f015240p-3, 0x0.d5220b047505b8p-5, 0x0.d933e2184b87c8p-5, -0x0.82e20d325deda0p-5, 0x0.80a6962375e840p-6, -0x0.a6832250daf9f0p-9, -0x0.826f23f8610720p-6, 0x0.e1aa79542017a8p-8, 0x0.df98d2d572e3c8p-11, -0x0.8e3013770a6cd0p-10, 0x0.acda1a80520388p-9, -0x0.eb6a179e2cb898p-11, -0x0.b10252b95ac578p-11, 0x0.ad39da19311678p-12, -0x0.8cc90b49e05c78p-12, 0x0.8d7e4ab8980978p-14, 0x0.930b5c68a885e8p-13, -0x0.e0f90e8c782e60p-15, 0x0.cc0afedc55ef80p-17, -0x0.d22bcbe5548460p-24, -0x0.9e00a6d7b6d0d8p-16, 0x0.cdb5c3b2917e70p-18, 0x0.ab9fa349eeeac0p-20, -0x0.d8b995a5807d90p-21, 0x0.f93d11de3e1968p-20, -0x0.8c693e8c8b2588p-21, -0x0.c3c789b083d250p-22, 0x0.97276b3f4c50c8p-23, -0x0.9228fd9e8b6db8p-23, // x=  1.1875 y=    0.25
- 0x0.80b3bb36d1f2b0p-1, 0x0.904d9df40cfed8p-1, -0x0.f2c6bd03a73d90p-2, 0x0.bc3252aecc93e8p-6, 0x0.8c1f7b0eb264b8p-3, -0x0.f3ec9ddb66af50p-3, 0x0.9e439829f46f40p-4, 0x0.ff60e0bec9e010p-4, -0x0.943782a2af19b8p-4, 0x0.87dd8a73b45440p-7, 0x0.9cd34dae20ee08p-7, -0x0.8534792fce8218p-5, 0x0.c16dc685d60500p-7, 0x0.949d27d6e50c10p-7, -0x0.aafe94c735bd78p-8, 0x0.dc38565c57e0e8p-9, -0x0.9fb092c7291a00p-11, -0x0.9cc02c627dbad0p-9, 0x0.f610dcd377b4c0p-11, 0x0.dbd54d03d32cf8p-15, -0x0.f4bf4be9f02ea0p-14, 0x0.a9c49ea4052070p-12, -0x0.cee85b76a94730p-14, -0x0.94a959e5bd2850p-14, 0x0.86f06ad8757f48p-15, -0x0.db2e9ffbb384f0p-16, 0x0.be2beab4b76938p-18, 0x0.d1344cb51d8a20p-17, -0x0.910b37f706e9e0p-18, 0x0.d35bbe56ac8bc0p-21, 0x0.aac7c0c9a94b70p-24, -0x0.b7a0a8e3d45fe0p-20, 0x0.d638ff3058be38p-22, 0x0.fea742ec7910d8p-24, -0x0.81efb5ec03cfb0p-24, 0x0.e6b8f1fb0aecd8p-24, -0x0.e422f58ded3bd8p-26, -0x0.cc748ab3fae8d8p-26, 0x0.8c2ce8d4ea9e10p-27, -0x0.cb8db9fb946720p-28, // x=  1.3125 y=    0.75
- 0x0.ddf05f92aea6b8p-2, 0x0.c611557e773178p-2, -0x0.8ee7bd098c23a0p-2, 0x0.f9587ab2dc61e0p-5, 0x0.b3949ab7e9de48p-5, -0x0.807b1e7d573d10p-3, 0x0.a1cb20f6332820p-5, 0x0.b0a122254def90p-5, -0x0.bf5f2f6b31fc80p-6, 0x0.e71bbeaff3e6c8p-8, 0x0.97e18bb78b4588p-10, -0x0.9dadce097a6ec0p-7, 0x0.d32372ea153578p-9, 0x0.e901f2ad40c280p-10, -0x0.859cdd5b6b3a50p-10, 0x0.e3caddce9c32b0p-11, -0x0.afad39ff3d4ed8p-13, -0x0.e5b7ad677afe00p-12, 0x0.a60829efe6c590p-13, -0x0.dd69ac0d677f98p-18, -0x0.e54209a074b398p-17, 0x0.d1791e17bfbc48p-15, -0x0.e8a6ed948cb610p-17, -0x0.92c3194498e1e0p-17, 0x0.fd7ebfb57fe9f8p-19, -0x0.e0123cb7223088p-19, 0x0.b012e6ac89fd10p-21, 0x0.b63d979ab2b3f0p-20, -0x0.e7da56b0efc9b0p-22, 0x0.ae00479b8c00a8p-24, 0x0.9789292a242230p-27, -0x0.85c7e10289f880p-23, 0x0.8d6ec0b5f4eed8p-25, 0x0.baf0f0dd2b0470p-27, -0x0.ac05d6a0ece078p-28, 0x0.89030d7457a680p-27, -0x0.f0bb8e026e2538p-30, -0x0.f5ac28f1a0dc00p-30, 0x0.99105f0c089528p-31, -0x0.ba1daed96a39d8p-32, // x=  1.4375 y=    1.25
- 0x0.c38e4fc24e9110p-2, 0x0.b5294824d037a0p-1, -0x0.86d158833fa8e8p-1, -0x0.cd3cc52c7e62d0p-3, 0x0.a4006ea5b4c410p-2, -0x0.b4db9dead3e2b8p-3, -0x0.a9eaa539ec93e0p-6, 0x0.de03e0d27eb230p-3, -0x0.c7032bf475be68p-4, -0x0.8edf5e47bf3880p-4, 0x0.decaf4cb067b18p-5, -0x0.e43ee7fd7813b8p-6, 0x0.9456ea5f4ffeb0p-10, 0x0.efa36a4dd91c00p-6, -0x0.caa852e2d0d7e8p-7, -0x0.9a9788ffe574d0p-8, 0x0.fba07910551278p-9, -0x0.8955c4cc4560f8p-8, 0x0.8b1ee7e3915c08p-10, 0x0.87cced34c4d9e0p-9, -0x0.ed3e65c3232cf8p-11, 0x0.81b7a365256320p-13, 0x0.858b7286bd4900p-14, -0x0.b1793092c68ee8p-12, 0x0.e72cfce25b0000p-14, 0x0.f8fe48d9234118p-15, -0x0.83072baab31978p-15, 0x0.81d957b2d625d0p-15, -0x0.eedb94750d53c0p-18, -0x0.dcd2f3061eecf8p-17, 0x0.a1c59ed9936e28p-18, -0x0.90f870d5ee2c38p-20, -0x0.9d403145aef270p-24, 0x0.d49e4d6ea35528p-20, -0x0.fdcccd9a0e0d70p-22, -0x0.9fad6b42f00a38p-23, 0x0.ab25eb39b73f58p-24, -0x0.89b4c9a11996e8p-23, 0x0.865007d1d3fd38p-25, 0x0.8a70f886b89050p-25, // x=     1.5 y=  0.4375
- 0x0.cca3a4bcca72b8p-3, 0x0.fe17c0786f85e8p-5, -0x0.af3dc1a5bd4eb8p-6, 0x0.81fddf1fc54118p-5, -0x0.90b9605d4b0a98p-8, -0x0.adffc704470388p-8, 0x0.9363b46d1470a0p-10, -0x0.82c49ea4e3f2a0p-11, 0x0.861cab289f5260p-15, 0x0.e0586e3b772458p-13, -0x0.9c8f5e39c1bd60p-15, -0x0.8facdbd2f90a40p-18, 0x0.9caf8f33df8498p-19, -0x0.c9a228b1a321e8p-18, 0x0.eea3234a8ebf00p-21, 0x0.aac91a379c3ad8p-21, -0x0.95ed416f1f1ed8p-23, 0x0.fee13092911170p-24, -0x0.e9caaa4259a270p-27, -0x0.e94b2577106d08p-26, 0x0.a6a839b67ee8c8p-28, -0x0.9b9ee169156b38p-30, -0x0.8ee4827a6013c8p-40, 0x0.de1970618b87b8p-31, -0x0.8af347681650a0p-33, -0x0.80afae5adb07d8p-35, 0x0.9da459917f8308p-37, -0x0.a34d466553e6c0p-36, 0x0.b333fdd4027990p-39, 0x0.8d610e26f1dee0p-39, -0x0.dbc6fac5b4e7d0p-42, 0x0.b4c15cf9a3e2d0p-42, -0x0.a169b06f002780p-45, -0x0.9c11a9622ab910p-44, 0x0.cf350ff0fbbac8p-47, -0x0.e5049e53159110p-49, 0x0.87bdc333901440p-53, 0x0.820bcbdc0c8460p-49, -0x0.9b29f076e1d6c8p-52, -0x0.aa25ad349d6160p-55, // x=   1.625 y=  5.0625
- 0x0.97d69a32960eb0p-2, 0x0.ca4d61dfcb3dd0p-1, -0x0.88189fff24d808p-1, -0x0.b8d91cbf5a6e78p-2, 0x0.e340129ae678d0p-2, -0x0.beecdb541b0c20p-4, -0x0.fcd9c76d55a3e0p-4, 0x0.8713be83a795f8p-2, -0x0.bd6c22268e3e98p-4, -0x0.93860661d9bd18p-3, 0x0.be064a3d0f9c78p-4, -0x0.cc6d8a14756f70p-8, -0x0.93948aac3aa4d8p-6, 0x0.b2561dcaf4b1f8p-5, -0x0.fb9edc37cdfb10p-7, -0x0.8615e242e02fb8p-6, 0x0.9b5197138dc288p-7, -0x0.e76c5d0ce2b3e8p-9, -0x0.9d442f0fbe3c40p-14, 0x0.8e1b6c0b827080p-8, -0x0.d90453fe7a0330p-10, -0x0.a925702d9125c0p-11, 0x0.ee61b47ad78e88p-12, -0x0.8aeb671b350a18p-11, 0x0.8e0ba6241ee850p-13, 0x0.ed9b5c7b260d20p-13, -0x0.c4b5c6986932b8p-14, 0x0.b744db8e013368p-16, 0x0.9ebb911ef9bf40p-19, -0x0.8e2dc3bc79cac8p-15, 0x0.b6997d60e51918p-17, 0x0.88935b83351e00p-18, -0x0.99f6265f5ee1a0p-19, 0x0.d02ec80d9632b0p-19, -0x0.ce048b14504720p-21, -0x0.83c088f1d5edd0p-20, 0x0.c1bfdfa0f4e348p-22, -0x0.a43907c603a450p-23, 0x0.9583a14abf1898p-26, 0x0.ff863358567570p-24, // x=  1.5625 y=    0.25
- 0x0.92f7a1131f3a18p-2, 0x0.b1ef39fb775fb0p-3, -0x0.adbf21c723add0p-4, 0x0.c512287d95f270p-5, -0x0.fd8fb36f07fc90p-11, -0x0.e2a52f14721458p-6, 0x0.e587c37afd3320p-8, 0x0.cd079ec79da8e8p-9, -0x0.ccd3431d2249b0p-10, 0x0.b320f5b5524740p-10, -0x0.adab350e746ff0p-13, -0x0.892b351301b9d8p-11, 0x0.942c606b661ec0p-13, 0x0.d02cc57a8d4648p-17, -0x0.871eed2bc0dab8p-16, 0x0.866b1c4fc4a6c0p-15, -0x0.c92dd9c529d470p-18, -0x0.dbc59d261d2618p-18, 0x0.85aa6336ea4160p-19, -0x0.dc0836bdfb4850p-21, 0x0.e1b90204a1ab08p-26, 0x0.89551b69099100p-21, -0x0.f6f511975fcff0p-24, -0x0.8c7431c822c368p-25, 0x0.840971f403a0f8p-26, -0x0.c2d3be87190748p-26, 0x0.82ea5fec1fe768p-28, 0x0.a6b9f852857bf0p-28, -0x0.af641872e9dce0p-30, 0x0.85d3dbb3f9a4c8p-31, -0x0.b9a02d177b8ee8p-36, -0x0.a32053d1b1a0e8p-32, 0x0.88ff503353fc10p-34, 0x0.efa9a1109f9aa0p-37, -0x0.e0f939d58c2d20p-38, 0x0.d06fc7bfdd8ca0p-37, -0x0.8dbb38d5fc4228p-39, -0x0.88f0afd1391350p-39, 0x0.8b0d6ed0aa5d18p-41, -0x0.a4de543c736670p-42, // x=  1.8125 y=    2.75
- 0x0.a6ab048fcea888p-2, 0x0.89d6f5010182d0p-1, -0x0.a9d1b0f44ec568p-2, -0x0.edad973866d4d0p-4, 0x0.abe6c9824fd218p-3, -0x0.b152cc886bd1c8p-4, -0x0.93a83cf8786808p-6, 0x0.c16d89ed1d3088p-4, -0x0.8621d0e6151248p-5, -0x0.857d5967f0afa0p-5, 0x0.a6c10733f07370p-6, -0x0.a87abbe5aaccc8p-8, -0x0.930dd01a1c74f0p-9, 0x0.8fbfbfbe452c30p-7, -0x0.b8695f7d6e5e60p-9, -0x0.9fb66785fe1370p-9, 0x0.aefeb4c88f85c0p-10, -0x0.9d30c2308547f0p-11, 0x0.ced3f3ee21b5e8p-18, 0x0.90c3c09c740ee8p-11, -0x0.c365325ad45eb0p-13, -0x0.9bc67ae511a120p-14, 0x0.c98007929ffcc8p-15, -0x0.d76caf60e9d708p-15, 0x0.b24225c15c14b0p-17, 0x0.b323b657417ef8p-16, -0x0.82a71fd2c4bee8p-17, 0x0.f8a7b8a0964f28p-21, 0x0.8dce21592c0ba8p-21, -0x0.a44719b7ffed68p-19, 0x0.b3ed53f44cad10p-21, 0x0.d3fb91b46892a8p-22, -0x0.bc978ed08581c0p-23, 0x0.a85724357559c0p-23, -0x0.f7ebfb0b797670p-26, -0x0.87cad0dcb36220p-24, 0x0.aa948db2044618p-26, -0x0.bae062face3e80p-29, -0x0.e56f3d4f62dea8p-31, 0x0.c00c2eaa2b8e28p-28, // x=    1.75 y=    0.75
- 0x0.a7e30adaad7868p-2, 0x0.ea60b8db63db40p-2, -0x0.8bd595a1ed1df8p-2, -0x0.ef76fdfff082b0p-5, 0x0.de84d26b48f648p-4, -0x0.a128b6b5e8feb0p-4, -0x0.db2f981c20dea0p-10, 0x0.fc6b4a533220e8p-5, -0x0.b4342865c7ef08p-6, -0x0.80578c8a17d758p-6, 0x0.a994c4f3507978p-7, -0x0.93392f3d4e9408p-8, -0x0.db69d32bb85668p-12, 0x0.930419f59ef240p-8, -0x0.bf3083737dda30p-10, -0x0.f13605f97b6848p-11, 0x0.8c63b007c23e70p-11, -0x0.b246eef8e61848p-12, 0x0.89e6abf373e018p-15, 0x0.e93b3791250e18p-13, -0x0.9c5338fce1c550p-14, -0x0.a10b69369fe808p-16, 0x0.fd46c46167b3b8p-17, -0x0.ac7baa864b8cf0p-16, 0x0.94db64f8a3b3a0p-18, 0x0.e75ac810e353b8p-18, -0x0.a7b15afc7c8cb0p-19, 0x0.95d70ceeaf5908p-21, 0x0.c7b8d336f7adf8p-24, -0x0.cf60f1b7ae9af0p-21, 0x0.df0274775d96a8p-23, 0x0.d67920d4a8b558p-24, -0x0.c66a2624c08eb0p-25, 0x0.ce11c65351f858p-25, -0x0.9992a8a930a580p-27, -0x0.8e2013867d8350p-26, 0x0.af0eb99ad1a390p-28, -0x0.8a3908c40e71a0p-30, -0x0.9692f6d507b588p-33, 0x0.c0082dabc7fb78p-30, // x=  1.8125 y=       1
- 0x0.a4097b8a98d758p-2, 0x0.97ca04af442b20p-2, -0x0.a7c0fdc49d2130p-3, 0x0.c1f121a5047da0p-6, 0x0.e71d20bc6f5838p-6, -0x0.dddb44a489a670p-5, 0x0.b04280af9dfcd8p-7, 0x0.9bb6c4517de560p-6, -0x0.f7b743a4ee47a8p-8, -0x0.9e95da58bfa200p-13, 0x0.a53d78d50d4fa0p-10, -0x0.900c75ae82b158p-9, 0x0.ebd2ead748fb78p-12, 0x0.b48e961871d6a0p-11, -0x0.869f84178478d0p-12, 0x0.8f1b23b618fb30p-15, 0x0.bf987292937820p-16, -0x0.9f10616669b4a8p-14, 0x0.9765474c919450p-16, 0x0.fdfd3d96d772e0p-17, -0x0.ca93ceb1b987c8p-18, 0x0.d51e31bd301f20p-19, -0x0.e47d6971765a10p-23, -0x0.8075dd2002aab0p-19, 0x0.8a155dd9d18240p-21, 0x0.8ca161134f8750p-23, -0x0.aca02166e30318p-24, 0x0.fde08364afb068p-24, -0x0.c067e147ad1fc0p-26, -0x0.820d91bb3ea128p-25, 0x0.9ef436eb5b0dd8p-27, -0x0.cbd6cdb2498630p-29, -0x0.9a0799fc294a50p-36, 0x0.a8cbcb9e56d1a0p-29, -0x0.9f231bb06aac18p-31, -0x0.d016fb431baa10p-33, 0x0.bc9557d2ef4968p-34, -0x0.84f4e01b2fd610p-33, 0x0.bf392bfceaa5e0p-36, 0x0.f6356dfde867c0p-36, // x=   1.875 y=    1.75
- 0x0.b0d4712c266010p-3, 0x0.a2dc0c49b18d68p-1, -0x0.8b088be96c6958p-2, -0x0.a1f5ee88452ab0p-2, 0x0.82597bf3993ec0p-2, 0x0.fc388a6ca64670p-5, -0x0.8a38d3c86801f8p-3, 0x0.a060bb64e2b008p-4, 0x0.80a8fed369c750p-6, -0x0.af3a15f644ab80p-4, 0x0.fefc3ba2521c80p-6, 0x0.874215cc9813c8p-5, -0x0.b362cc3f589b68p-6, 0x0.817740fcba4b68p-8, 0x0.eab802ae128ed0p-9, -0x0.9e61bf922cf8e0p-7, 0x0.c395eb54b22be0p-9, 0x0.dfcb6277408950p-9, -0x0.f1a868d3f52788p-10, 0x0.f6c3b545a93140p-12, 0x0.9a1c642abfc778p-13, -0x0.c4a39330cdc410p-11, 0x0.fc85c81a26a0d8p-13, 0x0.b297e4e330cb60p-13, -0x0.c3dab57223ca88p-14, 0x0.f11421d73da298p-15, -0x0.d8641bf9e81380p-18, -0x0.a2ee71cd4cf540p-15, 0x0.e0af837cf0fe60p-17, 0x0.bdd651b2f382f8p-19, -0x0.a68f9adf8a97f0p-19, 0x0.828c90adba4918p-18, -0x0.f737fbbb0982c0p-21, -0x0.a0ea887b9283a8p-20, 0x0.f5cd3f82a9b370p-22, -0x0.a1b0195c7c0840p-23, -0x0.c9062c2baf0ee8p-30, 0x0.a0c65a5e02ede8p-23, -0x0.b88e1f856231c8p-25, -0x0.fb7d975b0aadf0p-27, // x=  1.9375 y=  0.3125
- 0x0.851ff802dc3f10p-2, 0x0.ebf6d8dde1bf00p-3, -0x0.d5941a2f144850p-4, 0x0.8d691103049d98p-6, 0x0.ee70c5a1da8c70p-7, -0x0.e6493b025cbdc0p-6, 0x0.8ec0852cb77670p-8, 0x0.86b71454347958p-7, -0x0.af03f8e2df3228p-9, -0x0.f302368e16ce28p-13, 0x0.ea1b726e5fe710p-12, -0x0.9ff15026b746e8p-11, 0x0.b232993a182cc0p-14, 0x0.c7ea5ce4043fe8p-13, -0x0.ebdd8bec5cc568p-15, -0x0.930532e7ba90f0p-18, 0x0.83cdc7a8a474c8p-17, -0x0.d4dfa9ac4dfe50p-17, 0x0.8973856a442d28p-19, 0x0.dc28ddc8806980p-19, -0x0.82f1d0c7341b80p-20, 0x0.f4fd2dcf08e3b8p-24, 0x0.a061d8d9036a28p-24, -0x0.fa2033367c7958p-23, 0x0.c079528fa8c800p-25, 0x0.a9e5d1101a72f0p-25, -0x0.de1e49d8a0e048p-27, 0x0.d517931f628f10p-28, -0x0.d91136ad1d3600p-33, -0x0.e7cfdadab98378p-29, 0x0.cc3b26eb3afe48p-31, 0x0.87377ac06802a0p-32, -0x0.f8e8a3f7852ba0p-34, 0x0.976c1ba93c4f70p-33, -0x0.afc0d5e10a0f70p-36, -0x0.9828197bf3a478p-35, 0x0.98bee27eeba900p-37, -0x0.d5c46ab13de9f0p-40, -0x0.b5c560aade5af8p-42, 0x0.84da329953cc30p-39, // x=    2.25 y=  2.3125
- 0x0.a8b5421209b3a0p-3, 0x0.87175ea1b2e798p-1, -0x0.c5bb86881ed378p-3, -0x0.dde291fe76d200p-3, 0x0.98e3ab387e51f0p-3, 0x0.af7fa0679edaf0p-5, -0x0.9908ba9e023088p-4, 0x0.83e7d719776e20p-5, 0x0.f7d6de3c180770p-7, -0x0.9b810628a8f5a8p-5, 0x0.94724dcaead050p-7, 0x0.8dd2d5465f5510p-6, -0x0.8f94b10b337360p-7, -0x0.c1d3de3c870f08p-10, 0x0.af743f8b33c388p-9, -0x0.b58d03b9d24bc8p-9, 0x0.c77bee9ec6d7a0p-12, 0x0.cb2a23bf92d5c0p-10, -0x0.9f4c16fb4f7d68p-11, -0x0.bce679e95f0c68p-13, 0x0.b41622fa8baa60p-13, -0x0.b2b35aab17f4d8p-13, 0x0.dfda8ea82f3808p-16, 0x0.b218a275395108p-14, -0x0.832e7e3f7c2a48p-15, -0x0.a07154fe08fc30p-18, 0x0.cb1558087f4fa8p-18, -0x0.97d58f1bd77138p-17, 0x0.81890e5f4589f8p-19, 0x0.ce9f232a2b65a0p-19, -0x0.9c52ea1ce26928p-20, 0x0.c13f22d43be138p-23, 0x0.bdee6b1bcfe058p-24, -0x0.c1f60a65f6fb20p-22, 0x0.c7bd4b9cde56c0p-24, 0x0.8f060b4472fc88p-24, -0x0.f6d26f8053e378p-26, 0x0.a161e881a41928p-26, -0x0.962f12c4ffd4e8p-29, -0x0.a8c7d13f6a4f10p-27, // x=  2.1875 y=     0.5
- 0x0.f2e78b9df55040p-3, 0x0.bf0bf7811f8088p-2, -0x0.a8331034f11088p-3, -0x0.fe17994febdc10p-5, 0x0.854e53e6fce260p-4, -0x0.c793b0eeea8988p-6, -0x0.b69b84cfaa7260p-7, 0x0.ca1e102e43c6c8p-6, -0x0.8adfd3a4037998p-8, -0x0.99b0a17a47aaa8p-7, 0x0.f1b5a5e0bb02a8p-9, 0x0.f3016eeb356d70p-11, -0x0.88d7f919708b28p-10, 0x0.e58383404d5ad0p-11, -0x0.d70f33f1c3d008p-15, -0x0.f6a7c8f7088b28p-12, 0x0.969c471a6d0c60p-13, 0x0.90f75a586fa4b8p-14, -0x0.b542a9c13dba68p-15, 0x0.f4522bb6b85610p-16, -0x0.c3b09d040e51b0p-20, -0x0.8a575ad1094e68p-16, 0x0.9e74d7c4ed0358p-18, 0x0.8430ec75cefc88p-19, -0x0.9c97a5487f6e58p-20, 0x0.86f732c3d91640p-20, -0x0.fd89172584f248p-24, -0x0.ea4ebae6169550p-22, 0x0.8928fa8a4e6318p-23, 0x0.b99bae933a1b48p-26, -0x0.ac2caf7df0c3f8p-26, 0x0.81df978d3145d0p-25, -0x0.bb38c1cf1d9278p-28, -0x0.8ec37c08b44250p-27, 0x0.b3f04d312a8a88p-29, -0x0.882afcb3307d00p-31, -0x0.95b8351460af20p-33, 0x0.bcd2d9a94ff3b8p-31, -0x0.a73a96bd27b7b0p-33, -0x0.d5a43e5c9cca00p-34, // x=  2.3125 y=    1.25
- 0x0.dbc72be306bcb0p-3, 0x0.fa52f1ee3e98c8p-4, -0x0.b9df05fb326298p-5, 0x0.e622245745f718p-6, -0x0.d9b2d387b800b8p-11, -0x0.b9f49ad00b64f8p-7, 0x0.90fd96edf29dd0p-9, 0x0.efc7308f352520p-11, -0x0.c25304665e4330p-12, 0x0.ad72694d5adb78p-12, -0x0.f608ee2d78d120p-16, -0x0.cc3b9f5431cef8p-14, 0x0.aad8428757da40p-16, 0x0.b3b4150e3323b8p-19, -0x0.8db6ba384cbc18p-19, 0x0.eb57d58e36e8e0p-19, -0x0.fe2e5422f13158p-22, -0x0.aecb214ce8c568p-21, 0x0.a30bdd7166f5b8p-23, -0x0.9ee2f999f90c00p-25, -0x0.90aaa3f01fd408p-28, 0x0.fec2d241f35a58p-26, -0x0.a9d83e8f277b08p-28, -0x0.bedc061d02a7f8p-29, 0x0.df85e103f2a420p-31, -0x0.baf3ea0f61cdd0p-31, 0x0.9083edb6c49c80p-34, 0x0.cad6fea2a7bb00p-33, -0x0.9d3f66f99dae40p-35, -0x0.b780abd7c4bcc8p-43, 0x0.993b114820a9c0p-39, -0x0.d5b98a9ff87970p-38, 0x0.fc9ff2a5a4d708p-41, 0x0.cb16a474ed75d8p-41, -0x0.c1030439a1bc10p-43, 0x0.f5de47f07863a0p-44, -0x0.9c1209a9958050p-47, -0x0.9afc659d865d38p-45, 0x0.dc621174582cc8p-48, 0x0.f0a97f8f17d308p-52, // x=  2.3125 y=   3.875
- 0x0.d04d7d5bb815c0p-3, 0x0.dfed54b7793548p-2, -0x0.b3a7bb460b2a28p-3, -0x0.f9de85c0ab38d8p-4, 0x0.c3aa1263eda5b8p-4, -0x0.df4d757155faa8p-10, -0x0.8049d972ba8a70p-5, 0x0.e748b06989b308p-6, 0x0.d0cde7f40a6238p-11, -0x0.9431020a194e00p-6, 0x0.b2e97fc2604db0p-8, 0x0.a91e6b236da788p-8, -0x0.c2920f20aab390p-9, 0x0.f0b203421203c0p-12, 0x0.875dfb392944e0p-11, -0x0.87c047fd5af1c0p-10, 0x0.e3ae69931c37e0p-13, 0x0.c28707c05bbff8p-12, -0x0.a1adfd372864a0p-13, -0x0.b77e3d4ebfb620p-19, 0x0.e5e9236fc8e948p-16, -0x0.c0c39b61162ee0p-15, 0x0.9a56b7390a1430p-17, 0x0.81b0cfdebcddb8p-16, -0x0.c49720ef3a3468p-18, 0x0.c1043eec222cb8p-22, 0x0.c09b6dbb22d7b0p-21, -0x0.e68cb114c5d498p-20, 0x0.ced0f7f3a1f5d8p-22, 0x0.e4ede101ca1ca8p-22, -0x0.b0d7fccab1f728p-23, 0x0.e1f5255fc25f10p-25, 0x0.b2fca369a892b8p-28, -0x0.d8e03f36ca7000p-25, 0x0.db3ba04a7e1e38p-27, 0x0.f0eedd1d8aa948p-28, -0x0.da3fde10133b30p-29, 0x0.b07cb94e24eb70p-29, -0x0.b769d5799e0f28p-32, -0x0.9329bd91349ad0p-30, // x=  2.3125 y=   0.875
- 0x0.a13f30ea817f00p-3, 0x0.c25b0a52eafb90p-5, -0x0.d54e21c8a4a718p-7, 0x0.a2d90f2e7a3ff8p-6, -0x0.914416ea658918p-9, -0x0.a95229b59abfb8p-9, 0x0.e638c9e4ff0298p-12, -0x0.d4660b8b058c30p-13, 0x0.b637e055c3bef0p-17, 0x0.8d0c71cec3f1f0p-14, -0x0.9ecd8c84a444f8p-17, -0x0.89051484624318p-20, 0x0.8050802a6fc278p-21, -0x0.a51b3fe79dfbe0p-20, 0x0.9d8653a7480050p-23, 0x0.e588ecbea00ce0p-24, -0x0.a4a34d198dc158p-26, 0x0.86cfe57df7a008p-26, -0x0.c2498bd698a958p-30, -0x0.d118f3397c84c0p-29, 0x0.f39c72aefbbbe0p-32, -0x0.b8c193487ecf38p-34, -0x0.efc07c7d5a7610p-39, 0x0.84228744e834c0p-34, -0x0.861c6f9aefec68p-37, -0x0.a4575fd49136c8p-39, 0x0.9669df0954e5b0p-41, -0x0.fdff46e7177af8p-41, 0x0.ddada3228e1fc8p-44, 0x0.d67b4d0456d700p-44, -0x0.86af5aa407fb80p-46, 0x0.ace991ee57d8a0p-47, -0x0.dd82f3ee2c2048p-51, -0x0.9b62f8d57f51c8p-49, 0x0.a7bd2afbdc8fb0p-52, -0x0.9d840c91ad7c58p-55, -0x0.9153579a9b37f0p-58, 0x0.aad1105f603f48p-55, -0x0.a4707f9e90e8b8p-58, -0x0.de73bffe2b6e58p-60, // x=       2 y=     6.5
- 0x0.ac4e20117160f0p-3, 0x0.b7a16174da2c58p-5, -0x0.d6c66b95badf00p-7, 0x0.bda58876d48be8p-6, -0x0.be4acb2f91cd88p-9, -0x0.b6a1e2d8071708p-9, 0x0.85d099a6b9c0e8p-11, -0x0.a84193beb6ae40p-12, 0x0.ed0485ee8957d8p-16, 0x0.b210a545a49610p-14, -0x0.dbf249e4deb290p-17, 0x0.971f4a6f40c880p-20, 0x0.956ad9a20d0740p-22, -0x0.fe9c47169bc540p-20, 0x0.8a704d1e84dca0p-22, 0x0.d8b2f1b7e43c10p-24, -0x0.bf4e377460baa0p-26, 0x0.8cdd8268096d00p-25, -0x0.846de96068d028p-28, -0x0.8ce69537a58bc8p-28, 0x0.baff6093058e40p-31, -0x0.df2fa492be7440p-32, 0x0.9b5436f7d132d8p-35, 0x0.e6810a3ef84648p-34, -0x0.85dd17b7c32bf8p-36, 0x0.f7ad9f6afc3650p-40, 0x0.d8fc35e91d58a0p-43, -0x0.93844283db2ad0p-39, 0x0.9a969bfe75ec08p-42, 0x0.bc43d9ff61c850p-44, -0x0.a6b1b54a7c9b28p-46, 0x0.99ce7656029b68p-45, -0x0.906172c8a61b90p-48, -0x0.f0bca5a2ecedd8p-49, 0x0.9be551570cec80p-51, -0x0.fc301f73022d48p-52, 0x0.c6b14db63257d8p-55, 0x0.bbaaec41e16920p-54, -0x0.d592feb142a4b0p-57, 0x0.82494ea3b02188p-58, // x=  1.6875 y=  6.1875
- 0x0.f7cb4caccb4f98p-5, 0x0.f3fb54b94bb740p-2, -0x0.93024b08318d70p-4, -0x0.dcdde5df93c9c0p-3, 0x0.8e6146fecf6dc8p-4, 0x0.c0c479f6b2f040p-4, -0x0.e2327b341c5508p-5, -0x0.ea35516c9229b0p-6, 0x0.84cc11c52bbc98p-5, -0x0.e740266a1c2ea8p-9, -0x0.bc5584b146b180p-7, 0x0.c18177132ddb78p-7, -0x0.8cb8c450e1a8d8p-18, -0x0.82521cc8c44378p-7, 0x0.b234a5591ae5a0p-9, 0x0.a0861bf3e8ae38p-9, -0x0.d01f822a992808p-10, 0x0.82c744578c2c08p-12, 0x0.a483781cd14560p-12, -0x0.9ccc7165e3f130p-11, 0x0.8502c4df0a8f18p-13, 0x0.fcaca7849315e0p-13, -0x0.dc9e227ba61e88p-14, -0x0.9bbe19dcdc71b0p-17, 0x0.c44bd3dfe91db0p-16, -0x0.856fa0b5d4ad38p-15, 0x0.c0752deff1b5d8p-18, 0x0.db47711bcbaa38p-17, -0x0.a6f5b1cef16e40p-18, -0x0.eeb33a3f8664a0p-22, 0x0.f7170da3941cd8p-21, -0x0.bf3f56196e1b18p-20, 0x0.97b8b41dea3698p-22, 0x0.81b70e5f264ec0p-21, -0x0.c07f07ea68c358p-23, 0x0.ea6d33a0602a00p-27, 0x0.abfe0efbddce40p-26, -0x0.e1e71774bf4e98p-25, 0x0.cfa3b8ac8654d8p-27, 0x0.d202274b9daa98p-27, // x=  2.5625 y=    0.25
- 0x0.d17b60ccd73b78p-3, 0x0.9b5b98c37897d0p-2, -0x0.e8478eacea09d0p-4, -0x0.9ff7f2b6f8aae8p-5, 0x0.96a03144b8f138p-5, -0x0.e82768783f4d18p-7, -0x0.b85232a92394f8p-8, 0x0.bdd04ceae71c88p-7, -0x0.b97f5007919940p-10, -0x0.80359d15a0e690p-8, 0x0.a0fa9511b98208p-10, 0x0.80f0a917aab5e0p-11, -0x0.bdd37446730098p-12, 0x0.cff4fd05175c28p-13, 0x0.a0f25154e4a5e8p-16, -0x0.82c63c221c8860p-13, 0x0.e226bf05e5a798p-16, 0x0.dd9d1822adc158p-16, -0x0.b59a4c3748a9e0p-17, 0x0.93c14a4adca208p-19, 0x0.993f87f1e8f830p-20, -0x0.c5eaa844a7bc70p-19, 0x0.90a1d2005dd720p-21, 0x0.bcd2b6e3b4ff10p-21, -0x0.8173d90642ac08p-22, 0x0.8323ab7ad56700p-25, 0x0.d1e9b65b2e64e0p-26, -0x0.820e40718aabc8p-24, 0x0.bd1160fa995830p-27, 0x0.e30f73d9ecb840p-27, -0x0.950f348e534308p-28, 0x0.832f31b6ddddc0p-30, 0x0.97828ef72e6ba8p-32, -0x0.9604f3d9b79a50p-30, 0x0.ebea67724ad3c8p-33, 0x0.c61012675ec8a8p-33, -0x0.88b58c021f17a0p-34, 0x0.fce3211ad95468p-36, -0x0.b628ea1856a0d8p-44, -0x0.90cad5b3165770p-36, // x=  2.6875 y=   1.625
- 0x0.c8766f3a8ff8a0p-3, 0x0.b29adf7f652e08p-3, -0x0.f5bf626f55d3a8p-5, 0x0.8b98fe6d7762e8p-7, 0x0.e8bfd8128c0418p-8, -0x0.c3e714e830bd88p-7, 0x0.9a5e1042b1d730p-10, 0x0.c08578fef80910p-9, -0x0.b5317bd48c3fe8p-11, -0x0.b8f5c9a35c2660p-13, 0x0.fcdd78a44dcaa0p-14, -0x0.d9af36323a3448p-14, 0x0.8d4964c4288358p-18, 0x0.921c1ba5e01e20p-15, -0x0.e6e4b205327e78p-18, -0x0.e01600d8d13348p-19, 0x0.bad404d854f008p-20, -0x0.ec6bbf409fc4f8p-21, 0x0.9867007b6d0090p-27, 0x0.bc1183123c1e00p-22, -0x0.8adf0b76238338p-24, -0x0.97300280978528p-25, 0x0.de0a9f8f88a4d0p-27, -0x0.8bfdd86ced0370p-27, 0x0.e2a971a0eb1dc8p-33, 0x0.d6bb02168787d0p-29, -0x0.9f3a95e5178340p-31, -0x0.8da14a9d6c4b10p-32, 0x0.d8e1f6156ef340p-34, -0x0.af36ebd121d100p-34, 0x0.be47072b2bc108p-38, 0x0.d72cff04d20558p-36, -0x0.a76bb2552fcf08p-38, -0x0.9fbff6e6b7b520p-40, 0x0.a65238466a8178p-41, -0x0.cf3e8cacd65f70p-41, 0x0.b495da70789dd8p-44, 0x0.b59136beb577f8p-43, -0x0.98e4b569a367f0p-45, 0x0.b5576612f20898p-50, // x=  2.9375 y=   3.125
- 0x0.8a6a29b89ed720p-3, 0x0.c8c936fec51e38p-2, -0x0.d973e576d1f9f8p-4, -0x0.f54c713a5966e8p-4, 0x0.f3b88f2c363b10p-5, 0x0.c06e1757aff4d0p-6, -0x0.d1895c6b179960p-6, 0x0.953da02bc44658p-8, 0x0.ee3248adf09bf0p-8, -0x0.f991b4bd877120p-8, -0x0.fbc2da32aa8fd8p-13, 0x0.896a7becd84738p-8, -0x0.8be15c51884cf8p-10, -0x0.a2939204ad52c8p-10, 0x0.a2501cdcff9cc0p-11, 0x0.ca7fc68d4e16e0p-16, -0x0.a175583217d9a0p-13, 0x0.afdf1185a64038p-13, -0x0.ddac7b4cf81df8p-17, -0x0.a7e640991c4130p-14, 0x0.d228b83b64d3b0p-16, 0x0.d3fdb83283d628p-17, -0x0.8a89b23d35b180p-17, 0x0.984239c4e43bd8p-18, 0x0.f02c0c659d0ba8p-23, -0x0.cddb448a56b020p-19, 0x0.d4af6bc6c0d448p-21, 0x0.9978cc80ea6e38p-21, -0x0.94a33860ec4e08p-22, 0x0.829cc4b0c55e48p-23, 0x0.9b7eb925bd45c8p-27, -0x0.c3137c9ce02168p-24, 0x0.bf4cbe4fa10680p-26, 0x0.81b89740043320p-26, -0x0.ea8d607d196eb0p-28, 0x0.fc5e167b1112a0p-29, -0x0.fb1bee78d88e98p-35, -0x0.9611f856245b98p-29, 0x0.96b891dfbf6c48p-31, 0x0.89b20cd1908e60p-32, // x=    2.75 y=  0.8125
- 0x0.b05ef4fada5230p-4, 0x0.bd98e03a51c548p-2, -0x0.84493b5ce05d10p-4, -0x0.f3c0d78bc8db18p-4, 0x0.98d194346e83a8p-5, 0x0.8d91b099b887f0p-5, -0x0.9945c108fddae8p-6, -0x0.dda7e1ffd7ecd8p-8, 0x0.81203b72b2aa08p-7, -0x0.8d19fc2f88ad80p-10, -0x0.9fe1f91b303408p-9, 0x0.869f9703e430f0p-9, 0x0.98bcf3f2698f58p-12, -0x0.a1345877703f08p-10, 0x0.e94f005727d900p-13, 0x0.e53afa0947dc58p-12, -0x0.b75c881908d4f0p-13, -0x0.821bebf9e78a78p-14, 0x0.ff9fb0a309a378p-15, -0x0.808f6fb58dea50p-15, -0x0.cf9a83cdd16ba0p-18, 0x0.c5aaecaa5e44f0p-16, -0x0.a65eba817749d0p-18, -0x0.e5abf4ed718fc0p-18, 0x0.bf3061f74d4148p-19, 0x0.b1ebfff1381cb8p-24, -0x0.996a86c6989110p-21, 0x0.c6a8fa3c2584e8p-21, -0x0.c3267e887986b0p-24, -0x0.98c942e2ec2920p-22, 0x0.c066caffec0a68p-24, 0x0.d7a308d54b1398p-26, -0x0.b4316ae2facf18p-26, 0x0.a2e5fcf437d180p-26, -0x0.da43ee3c18cc48p-30, -0x0.8d9f2c666f5b38p-27, 0x0.9df7b6c3f98fb8p-29, 0x0.de2c168a9b40a8p-31, -0x0.8f20bec53fd788p-31, 0x0.faa88526022d28p-32, // x=  3.0625 y=   0.625
- 0x0.8a0bba024b02f0p-3, 0x0.9fb7ab406e3b88p-2, -0x0.a2e8d318ee1200p-4, -0x0.8d2ee0b3d68fb0p-4, 0x0.856827f4293fd0p-5, 0x0.ec9c71aac92658p-8, -0x0.a68513b9ea6e80p-7, 0x0.e38d172f39c380p-9, 0x0.88874c9d709c28p-9, -0x0.b6f89d4d4321a0p-9, 0x0.df4f3a1925af60p-17, 0x0.9401cb8e992a00p-10, -0x0.f99fdf9d5ae040p-13, -0x0.9003b067011668p-12, 0x0.f0f686ef229fe8p-14, 0x0.d296d9b96a20a0p-17, -0x0.ebea7cda900810p-16, 0x0.bef27e3138c8c8p-16, 0x0.beadc6ef525d20p-21, -0x0.ba3de4e749c9e0p-17, 0x0.a0d59728452298p-19, 0x0.9d7bc7c345c220p-19, -0x0.842c3220095e28p-20, 0x0.f40bdca5252030p-24, 0x0.9e437e434dfc98p-23, -0x0.843f1e8ceecd50p-22, 0x0.88ccb28fa5c1c8p-25, 0x0.a0fd90cd75a2c0p-24, -0x0.be77025869c610p-26, -0x0.9f3f4fe6be8630p-28, 0x0.97545a569efcb0p-28, -0x0.94ca28db704490p-28, 0x0.bb04ecb67ffa28p-32, 0x0.de2d209af6d270p-30, -0x0.e04bbaee373f88p-32, -0x0.a1629526ccdce0p-33, 0x0.bdcdb62e78ed78p-34, -0x0.9c0e8c0571a820p-34, 0x0.a38f35e18ff0e8p-38, 0x0.f57388cc2717f0p-36, // x=  3.1875 y=    1.25
- 0x0.aaea22a73a5ee8p-3, 0x0.ebdc9ed19d8f50p-3, -0x0.8ddcb5c93b5fd0p-4, -0x0.a63c7fdf665040p-6, 0x0.8a5333b9d98998p-6, -0x0.ede8ab974cc960p-8, -0x0.83136e7ef6deb0p-9, 0x0.8aba99916bd938p-8, -0x0.c08632ef54e590p-12, -0x0.94572997257768p-10, 0x0.8c83028cdf97a0p-12, 0x0.8f3900785b18e8p-13, -0x0.950f86a5370650p-14, 0x0.d5527f2c2a26f0p-16, 0x0.ec63a19522ca30p-18, -0x0.91f62858a17b40p-16, 0x0.90237bfbdfe8f0p-19, 0x0.8934db95892f98p-18, -0x0.93ea328c4f1620p-20, -0x0.e949d18f74a1d8p-23, 0x0.d9b9ada77bc308p-23, -0x0.bf1312ee7a6908p-23, 0x0.bb4383409ee198p-28, 0x0.88d9e661aa0e28p-24, -0x0.ddbd697f77b938p-27, -0x0.820184fa311b70p-27, 0x0.d66162da755320p-29, -0x0.cb6272b362f330p-30, -0x0.eda32ffe172480p-34, 0x0.d6036fb1570c50p-31, -0x0.940cedfda87528p-33, -0x0.fb00a127aeddf0p-34, 0x0.a36ddb85526e58p-35, -0x0.d66f38c1cf1400p-37, -0x0.8357fe5a615300p-39, 0x0.92c2e91ff2b4c8p-37, -0x0.bee002979b9700p-40, -0x0.afd9b5af457578p-40, 0x0.d23b05439f0e48p-42, -0x0.888522cf0eba68p-43, // x=  3.3125 y=    2.25
- 0x0.a2c7572b603a80p-3, 0x0.cde19d87c754b0p-4, -0x0.e53d179866a600p-6, 0x0.e050076439a500p-7, 0x0.e4f973b6f90040p-12, -0x0.a75c309fe70388p-8, 0x0.b36ea95a450c38p-11, 0x0.fd3bcb95e76468p-12, -0x0.811dc69434d9b8p-13, 0x0.f1b85b4236deb0p-15, 0x0.cf5068ac0832e8p-20, -0x0.b74e67c1d6c3b8p-16, 0x0.c61a418eb38250p-19, 0x0.fd6fdfe988f9a0p-20, -0x0.822b41d9181340p-21, 0x0.9284f33ac48aa8p-22, -0x0.c40409951bfe68p-29, -0x0.bc3f03aa31e898p-24, 0x0.d5627b6fdc4528p-27, 0x0.c85b1e2f817598p-28, -0x0.e5c5387f352b70p-30, 0x0.b58c3821b279a0p-30, -0x0.98f99502d45150p-34, -0x0.b0700f0b45d7a0p-32, 0x0.d6e9d51e5aa240p-35, 0x0.cd118e07629508p-37, -0x0.a79c1edd3e6570p-38, 0x0.d19ed2e7e445a8p-38, -0x0.908a74b2aa3270p-41, -0x0.90c61af5d409e8p-40, 0x0.c18bad1be87e18p-43, -0x0.e1c66f31eded20p-48, -0x0.ac46425faffa58p-47, 0x0.d5649d6e2802b8p-46, -0x0.bd9a81c0eefc98p-49, -0x0.c241a3af590b00p-49, 0x0.9474e21eafbc20p-51, -0x0.e3301a213f9380p-53, -0x0.d90cb029f6e248p-59, 0x0.b8b38ea0d1d040p-54, // x=    3.25 y=       5
- 0x0.995d7360b5a708p-3, 0x0.b2736b5e2c40c0p-4, -0x0.bb48b926ea5380p-6, 0x0.d9db0e5763db48p-7, -0x0.a175d1b749d9c8p-14, -0x0.836fdd43dbd730p-8, 0x0.8caaa4efa567c8p-11, 0x0.92349281f1e4a0p-12, -0x0.9c9142a607a2b8p-14, 0x0.d7151014f02cf0p-15, -0x0.d9bd6618989f38p-20, -0x0.e076ec9622d900p-17, 0x0.faf7f933712c40p-20, 0x0.b89201e399deb8p-21, -0x0.e528fbb8a9db40p-23, 0x0.d6e07e96cea710p-23, -0x0.d59d1e83e4ea18p-27, -0x0.af5bb2aec330a8p-25, 0x0.d1f8d94dcce400p-28, 0x0.8301e34ed766f8p-30, -0x0.89cbeab3a88618p-31, 0x0.ca3fad8cdf1958p-31, -0x0.8f019c855cf2a8p-34, -0x0.f0af28aff4f440p-34, 0x0.9e2ee682d903f8p-36, -0x0.86abfa8c2c9390p-39, -0x0.e078922e8053e8p-41, 0x0.aa97567d929db0p-39, -0x0.95540b58e2a128p-42, -0x0.8726779efe7020p-42, 0x0.cc9b44dcd56428p-45, -0x0.b854df0ffa9d28p-46, 0x0.863f48e4250e80p-53, 0x0.f8609f5e079838p-48, -0x0.fd512aca956260p-51, -0x0.ccb98ebac226e8p-52, 0x0.d1eb85d416be40p-54, -0x0.d453b23c7ca8f0p-54, 0x0.fcd02e7554beb8p-58, 0x0.9549006189b300p-56, // x=  3.3125 y=  5.5625
- 0x0.fb05ab16945fc8p-4, 0x0.87ba41c6a280c8p-2, -0x0.f6a1c46188d938p-5, -0x0.c567b3c8b9a9c0p-5, 0x0.a71a11958a7538p-6, 0x0.f22a05af2d4868p-9, -0x0.add204fcce50e8p-8, 0x0.ffd165846fa5c8p-10, 0x0.f67b5d97f6b4f8p-11, -0x0.a2a53e1932e808p-10, -0x0.8f5f125bbe4a08p-16, 0x0.e1eec3f3803cb8p-12, -0x0.8f4829238fe868p-14, -0x0.cde5b183ea33a8p-14, 0x0.8571670eb42b98p-15, 0x0.980e76c8945110p-17, -0x0.89c51ce7d35d98p-17, 0x0.82fa2cb628f368p-18, 0x0.f1abfe2a300aa8p-21, -0x0.9ad5425ce75c78p-19, 0x0.903895bfda46d8p-22, 0x0.a3ee064994d020p-21, -0x0.b396488dc81b80p-23, -0x0.fecba9b175e8a8p-25, 0x0.af5ab37b49da20p-25, -0x0.c04647fff4f8e8p-26, -0x0.a6378b75906a18p-29, 0x0.caa5bd62eb66c8p-27, -0x0.85cc48edbe1fe0p-29, -0x0.a2ece2506d20c0p-29, 0x0.d38dd6830c5268p-31, -0x0.ba787afa324f58p-36, -0x0.f0cbe7e54ba010p-34, 0x0.ab22c801a47a98p-33, -0x0.85ff75dc430770p-36, -0x0.c070cf49324a18p-35, 0x0.bc5840adf9d9b8p-37, 0x0.d150b0d34871c8p-39, -0x0.8c34d4e9f091a8p-39, 0x0.f0a89aceb6d518p-40, // x=   3.625 y=  1.5625
- 0x0.e394a457b89e20p-5, 0x0.a4470ca0378a78p-2, -0x0.8f03a14f0f8860p-5, -0x0.bc153404eb5610p-4, 0x0.8ca0df98cbedd8p-6, 0x0.d4a170bb925c98p-6, -0x0.fe481c173846a8p-8, -0x0.e0b77e26a76908p-8, 0x0.d8f62eb9ca9930p-9, 0x0.ba20fc90f53720p-10, -0x0.a99c6c32236400p-10, -0x0.d4732c47fc75c0p-16, 0x0.e0992bcf33e258p-12, -0x0.d2643bf9feae40p-13, -0x0.ceb27b9b559ab8p-14, 0x0.958b308c24b5f8p-13, 0x0.c677f7475751f0p-21, -0x0.841cb71aca0338p-14, 0x0.e1878a67d4bdd0p-17, 0x0.97b9758f138be0p-16, -0x0.8108580de11268p-17, -0x0.f19977659e2260p-20, 0x0.9def8f31cb9b20p-19, -0x0.b3514955f47768p-20, -0x0.8143e362bd1630p-22, 0x0.ea3f2e85455468p-21, -0x0.a5fc2ad17060e8p-23, -0x0.873c20f4a53120p-22, 0x0.c758b535d27af8p-24, 0x0.890f77c8f10350p-26, -0x0.bf6d9b3e30a208p-26, 0x0.a397ea3e952f28p-26, -0x0.bb374034460160p-32, -0x0.990bc0bd3a4810p-27, 0x0.9576b50b2e3f60p-29, 0x0.d04f8a23a61ba0p-30, -0x0.c8360d5fad0458p-31, 0x0.8b9b29d48d8a08p-32, 0x0.823dc975d02928p-34, -0x0.e8b4a81cab5f78p-33, // x=  3.5625 y=  0.5625
- 0x0.9cd5ed16cc72c8p-3, 0x0.9c6562435438d8p-3, -0x0.a995a70b6b0320p-5, 0x0.e450430bcc1190p-11, 0x0.ac404ede547c88p-8, -0x0.c1bdfb8cef6898p-8, 0x0.b39d64e49e3bc0p-13, 0x0.c438c2c2e55c20p-10, -0x0.f7950307f2c0b8p-13, -0x0.a900f77ad8a8e0p-13, 0x0.d9e30892fdeaf8p-15, -0x0.f68ead245c5390p-17, -0x0.85d70281024520p-18, 0x0.9c6e2c362ba810p-17, -0x0.f4be3cf5854e30p-21, -0x0.decae4d47530f8p-20, 0x0.baa13ece3a35a0p-22, 0x0.dd023742dea650p-25, -0x0.c3f772c72165e0p-25, 0x0.c56726a8bb5b90p-25, -0x0.8840593e2a7000p-29, -0x0.c8b66cee3689f0p-27, 0x0.85d4f733d70920p-29, 0x0.fbbf70aaca52b0p-31, -0x0.b74bb4e1f0c9b8p-32, 0x0.d9db454cd7edb8p-33, 0x0.e3d0cac1b205f8p-39, -0x0.98536e819df128p-34, 0x0.b0590cc83b2480p-37, 0x0.fabf41e5909770p-38, -0x0.8caea8192cea90p-39, 0x0.e8f348df489c10p-41, 0x0.851cf51f56aca0p-44, -0x0.d1e976c1326ed8p-42, 0x0.e1a1b1691d6a50p-45, 0x0.bcd557f25f64c8p-45, -0x0.be24d76f39b670p-47, 0x0.883a40ffad6db0p-48, 0x0.c16f0da1db4948p-52, -0x0.875d12d33d4838p-49, // x=    3.75 y=   3.625
- 0x0.98a71b2c22bbf8p-3, 0x0.86c04135cae3d0p-3, -0x0.8dc03438169538p-5, 0x0.9f466aaff8e7d8p-8, 0x0.d2f363d67725f0p-9, -0x0.aa9dc8214ce758p-8, 0x0.b9df8ed9fab1b8p-12, 0x0.840ebe0fdcdc60p-10, -0x0.b8487fc9118a00p-13, -0x0.f971da378dce30p-15, 0x0.df06b681767c78p-16, -0x0.9679114cba8170p-16, -0x0.82b6d48708b3b0p-22, 0x0.b8dc3832035638p-18, -0x0.c6872025220df0p-21, -0x0.9cfa358a1a1b18p-21, 0x0.a4e6d49ec8dd90p-23, -0x0.c447fb58623fd0p-25, -0x0.8e6dd9769dff10p-27, 0x0.dd450d1bfa90c8p-26, -0x0.c1d358d800ccf8p-29, -0x0.f4821328dff6d0p-29, 0x0.cf205784f53a50p-31, -0x0.992b8a71591190p-34, -0x0.fc1c8cb0964488p-35, 0x0.f4ea282bac8c68p-34, -0x0.b9a71d3b45f140p-37, -0x0.9b8353c708b510p-36, 0x0.ec78d4e5619a08p-39, 0x0.8e45b134fbedd0p-45, -0x0.9f9ad4b0386080p-42, 0x0.82e1976b6080e0p-41, -0x0.bb270827eda930p-45, -0x0.adb43f0bb9a020p-44, 0x0.fc0a4d749b8588p-47, 0x0.d441a826bcec40p-52, -0x0.a4040d7c407f88p-50, 0x0.894ce43781e368p-49, -0x0.cb0ca274713a80p-53, -0x0.adf6a0b9868b60p-52, // x=  3.8125 y=  4.1875
- 0x0.9a290d2ce28e10p-4, 0x0.84fd3e1faf02e0p-2, -0x0.95d6fb2a4bf460p-5, -0x0.e3541eefe36290p-5, 0x0.d8183b9b519428p-7, 0x0.a98ba4be9d4a20p-7, -0x0.870e952c14fd98p-8, -0x0.b0e44f5d25a138p-10, 0x0.9656f39a01b100p-10, -0x0.976dfa72851630p-14, -0x0.90e9b93e66fec8p-12, 0x0.95c2b2d15352a8p-13, 0x0.d70f862857e3e8p-15, -0x0.8ffed7bbde4870p-14, -0x0.ecd9cd08b103f0p-19, 0x0.c645d33420f3b0p-16, -0x0.a9e061fb1edf50p-19, -0x0.d096077255e6f0p-18, 0x0.d01f074fb15ee8p-20, 0x0.90c8b2ae8e2318p-20, -0x0.8e5893ac0c0090p-21, 0x0.984419878cd580p-28, 0x0.fa943fa28b47b8p-24, -0x0.c365bbb7875c58p-24, -0x0.98ec7b10c90f18p-27, 0x0.ab883461e84a48p-25, -0x0.b9356924787b70p-28, -0x0.a87888a2844360p-27, 0x0.c55d2a67874a40p-29, 0x0.8122c5fa9714e0p-30, -0x0.c5e76d7a378858p-31, 0x0.c5df93bc89dcc8p-32, 0x0.8a33bd14157590p-34, -0x0.dddf28c04603d8p-33, 0x0.f1da4d42f3dcc0p-36, 0x0.cfe021114bc5c0p-35, -0x0.f09b5e5be92c68p-37, -0x0.bc84c8a3668808p-39, 0x0.bfe7fa38f4bfc8p-39, -0x0.9a471231614710p-39, // x=   4.125 y=   1.125
- 0x0.81720549113650p-3, 0x0.bc051a61a57210p-3, -0x0.aab1e21f3eb058p-5, -0x0.f6115d7b164698p-7, 0x0.8a9ed897e7aa58p-7, -0x0.a8daa3bedcd3e8p-9, -0x0.85c6e639b07d90p-10, 0x0.bde4e18e1c83a0p-10, -0x0.cab6fd4be15900p-16, -0x0.ba301f37fe4d00p-12, 0x0.d0f5f46afb8438p-15, 0x0.d78a1cbf911130p-15, -0x0.f0b1d45d45b180p-17, -0x0.97e7fe766588d0p-20, 0x0.98ce2ac342c868p-19, -0x0.eeddd814a9dd58p-20, -0x0.b466e12e9f6890p-24, 0x0.99c79221efe710p-21, -0x0.93569d333f8090p-24, -0x0.c7d5e6a4788f38p-24, 0x0.c3a4507b14f9b8p-26, 0x0.d61a55174b3e28p-29, -0x0.f2b25c1cf844a0p-29, 0x0.c4e2274aad7c68p-29, 0x0.d5fb6c2ff82a28p-35, -0x0.f583e602218940p-31, 0x0.897fcf45a08340p-33, 0x0.865563e88ffa08p-33, -0x0.949a388c78bc20p-35, 0x0.df544d70875550p-39, 0x0.80e0052e2973b0p-38, -0x0.bea038b455a3f0p-38, 0x0.d1ee1dc8c9b070p-42, 0x0.a8045dda29dc58p-40, -0x0.fa5b1abc9c9520p-43, -0x0.baaf3e1c4d7a08p-44, 0x0.a99cada735d7b0p-45, -0x0.d8459c1ed6fc90p-46, -0x0.9eb8479148edf8p-51, 0x0.95dbaefae385f8p-47, // x=    4.25 y=  2.8125
- 0x0.85b4400e449490p-5, 0x0.87c67a98f131e0p-2, -0x0.85fda7670be500p-6, -0x0.814255610815b0p-4, 0x0.cfa2dc3727dc30p-8, 0x0.f89ed5dc7c95b8p-7, -0x0.93cbd846ea4fb8p-9, -0x0.f00810cbb17dd8p-9, 0x0.cc2aa7bb540120p-11, 0x0.e51aba3fe07f60p-11, -0x0.8bc8f749cd6b70p-12, -0x0.cff3b96a2d1740p-13, 0x0.be0090d16e1f00p-14, 0x0.a036d2859282e8p-15, -0x0.fba590d9c9d158p-16, -0x0.e0898ddee2b018p-19, 0x0.9b979243c7d7e0p-17, -0x0.93216c4833d478p-19, -0x0.a569824fc7b450p-19, 0x0.f37d93b132e5a8p-20, 0x0.f2f362eec41f30p-22, -0x0.ec26e0d1980d40p-21, 0x0.e55ab485a1caa0p-27, 0x0.ab289ab21a8228p-22, -0x0.fb0a6937a18fe0p-25, -0x0.b399d834a5d408p-24, 0x0.821a84fc97c358p-25, 0x0.bbe204cf6e2488p-27, -0x0.a3bd8b3fdaf128p-27, 0x0.d15893f566eb70p-29, 0x0.e2029010b99998p-30, -0x0.b0e9ff4ef96758p-29, 0x0.9e574d67bdbb90p-33, 0x0.f88bf2857f1df0p-31, -0x0.ea918a8132ea88p-33, -0x0.b4b3f98f6c5f90p-33, 0x0.a987a27861b398p-34, -0x0.ad8c39f6e2eea8p-37, -0x0.e5bb7546e31b38p-37, 0x0.9bdf0a94f1c798p-36, // x=  4.3125 y=     0.5
- 0x0.cb0aeb29ebf408p-4, 0x0.d11aaaa0d211c8p-3, -0x0.96c1ef0f1ef740p-5, -0x0.e4f7049a249238p-6, 0x0.99e21df57a12b0p-7, 0x0.c89e7f8f9e7bf0p-10, -0x0.f41f0db1e551b0p-10, 0x0.b02188728e6b50p-11, 0x0.8bc0bf931a02a8p-12, -0x0.a7520375d82630p-12, -0x0.d5ac88196f8630p-17, 0x0.b6a8d946568348p-14, -0x0.82aa1d4126edc8p-17, -0x0.8f20a7190b5348p-16, 0x0.e654762e0125e8p-19, 0x0.8be9e5697487f0p-19, -0x0.e6e7dead31e500p-21, 0x0.89b4b7aba3eb50p-24, 0x0.96039c78b086e0p-23, -0x0.831fef4c26bd90p-23, -0x0.fc857e179a8d20p-28, 0x0.a87fbc5db956f0p-25, -0x0.8e842e1a602c10p-28, -0x0.80dfb4e65b57e0p-27, 0x0.ecb1351348c070p-30, 0x0.ae706d00598ac0p-31, -0x0.c7b16ff4fd9a10p-32, 0x0.a0195fb28e9f60p-33, 0x0.99a437106662d0p-35, -0x0.a5933f1687bc70p-34, 0x0.cdb7f7c9f851f8p-38, 0x0.91104ff79a4660p-36, -0x0.e9ab9ad5042d90p-39, -0x0.d9ae5845b9b5f0p-40, 0x0.c73ef351d175e8p-41, -0x0.9d87a326aebf48p-42, -0x0.fc019cbd083720p-45, 0x0.a5090a8625c288p-43, -0x0.85c250f4b61710p-46, -0x0.8003d6ecbda698p-45, // x=  4.5625 y=   2.125
- 0x0.e7f657b017bc68p-5, 0x0.d2d43aba7dda00p-3, -0x0.aefa8f7f1bc9b0p-6, -0x0.8f9e55da714318p-5, 0x0.c34eb3a9e4d350p-8, 0x0.b005a8d4b9f590p-8, -0x0.bde5fa56607fa8p-10, -0x0.ae7a15731bbe18p-11, 0x0.a7d48a72bc6c98p-12, 0x0.9923c866cce658p-15, -0x0.878730a66d2e78p-14, 0x0.f1bc6de3c6e068p-17, 0x0.c36963e9724e30p-17, -0x0.fa81030166d998p-18, -0x0.e8720738207e70p-20, 0x0.9f3852e347ae40p-19, 0x0.a0be9431367b30p-23, -0x0.a523c3019fcdc8p-21, 0x0.d0c52b8167d630p-26, 0x0.923ed9de915ca8p-23, -0x0.980cd154f31ab0p-26, -0x0.d65b02a3b45080p-26, 0x0.cf747f1bc3e120p-28, 0x0.dbbe7247f85e50p-29, -0x0.d34414fc80a2d8p-30, 0x0.bca11f529294a0p-37, 0x0.a503a4a092fd20p-32, -0x0.c0ca3a470a86c8p-33, -0x0.a3fd426d7f1510p-35, 0x0.98b846c082a2c8p-34, -0x0.d2f17f62e3efc0p-40, -0x0.9cc0ba07160038p-36, 0x0.b4d5d15e4fd098p-39, 0x0.dc676af5372c90p-39, -0x0.f933dfb04b6428p-41, -0x0.81dafad3cf0400p-42, 0x0.d5633bc367c840p-43, -0x0.b3b0534483a1d8p-44, -0x0.c4c728da9a5c28p-46, 0x0.b60cfe162a6c00p-45, // x=  5.1875 y=   1.375
- 0x0.eee569c47c8bc0p-4, 0x0.8205c67585b5f8p-3, -0x0.d75ed8cc6988f0p-6, -0x0.fc2aca156d8718p-10, 0x0.cb283485a2ccb8p-9, -0x0.a8d1acdac4cbc8p-9, -0x0.80367dc6322bd8p-14, 0x0.a0b46fcc250e70p-11, -0x0.fb51a2a51406e0p-15, -0x0.982c833ef81d50p-14, 0x0.f02259a9de5ac8p-17, 0x0.98ceec4ae43d08p-20, -0x0.da2a037ce82478p-20, 0x0.c47f4487d815d0p-20, 0x0.9d5fdca77e8318p-28, -0x0.b29655d9e6e460p-22, 0x0.9eb31217188f68p-25, 0x0.93bb85a2e43848p-25, -0x0.82ab26528f2f40p-27, 0x0.c9d67472d6f508p-31, 0x0.b7af142b2e98d8p-31, -0x0.81343d622cb500p-30, 0x0.bc3990acd33850p-35, 0x0.b8ef35acaf5398p-33, -0x0.ceba92e5265848p-36, -0x0.c4c882394038a8p-37, 0x0.f73fc2566c50e8p-39, -0x0.eac696ead47790p-40, -0x0.94c17c44201f80p-43, 0x0.9ead3a967514a8p-41, -0x0.f21c7ad6373948p-45, -0x0.96b721fd20bf10p-44, 0x0.e4472f3ef796a8p-47, -0x0.a1d849a20691c8p-52, -0x0.9cbdd00a9786e8p-50, 0x0.da09042a90ba00p-50, -0x0.c05dad66e50a70p-54, -0x0.95a6de192ea728p-52, 0x0.ae0cf25fa962a0p-55, 0x0.e46b5d61d45860p-57, // x=   4.875 y=   4.375
- 0x0.8c8d6e92394258p-5, 0x0.da8c2ccb20d160p-3, -0x0.dcf7975c0f9f58p-7, -0x0.a3b68c7bc88b30p-5, 0x0.8399af90426d88p-8, 0x0.f17fc8e0660d30p-8, -0x0.8caa3f67c6e468p-10, -0x0.ad939902c3b760p-10, 0x0.8e1e449b16e7f8p-12, 0x0.ee484d44f39e30p-13, -0x0.8aa74511c2c010p-14, -0x0.954cc81970c710p-15, 0x0.83bd33de1154b0p-16, 0x0.9559e47c503678p-18, -0x0.f3d6ccd5dab998p-19, -0x0.a329f9d0d44e78p-23, 0x0.d9f4f2c296e100p-21, -0x0.bc2df249643198p-23, -0x0.b82019364c0f20p-23, 0x0.c4c6b77d3551a0p-24, 0x0.8bd1297e0df6c0p-25, -0x0.8f0148b5bb2d10p-25, -0x0.a56cba463039a0p-28, 0x0.b12e151e0080a0p-27, 0x0.c9ecd7044c32e8p-33, -0x0.c1fb1591618fc8p-29, 0x0.83abfba86c8708p-32, 0x0.b842f9c003e390p-31, -0x0.8ccddb1af503a0p-33, -0x0.8bf7841645dcc0p-33, 0x0.c126396c0aefc8p-35, 0x0.ef52cdd2b81900p-37, -0x0.c91a379e4bfba0p-37, 0x0.b1a4a71979dee0p-39, 0x0.963f25c3cb4178p-39, -0x0.917394aed7ada8p-39, -0x0.b6565664f60b68p-43, 0x0.ce2db4cd0d0538p-41, -0x0.a37e6e1e5de758p-44, -0x0.c332913b377028p-43, // x=    5.25 y=  0.8125
- 0x0.8e82eb44284648p-3, 0x0.b9f93c74c53448p-4, -0x0.b5df8372c64860p-6, 0x0.a442eaca51bd78p-7, 0x0.fac1c98ad084f0p-12, -0x0.e6c9354695e9b0p-9, 0x0.d17287ab1c0c40p-12, 0x0.ab233a34588518p-12, -0x0.93123dcc0f8c88p-14, 0x0.d30aa66f2cab18p-16, 0x0.86768e41a587b0p-19, -0x0.b06750c5a7fa68p-17, 0x0.9b4f071dab8c28p-20, 0x0.863e6ff174d008p-20, -0x0.dbe9ba531e61e0p-23, 0x0.9c5ac1a8a85610p-24, 0x0.af9c13a577ff48p-28, -0x0.821af294573af8p-25, 0x0.e8dd0cbaa5b940p-29, 0x0.b7dbbad06ae910p-29, -0x0.9834168ed011e0p-31, 0x0.83c6082ffdb978p-32, 0x0.e6eaf915b96c10p-38, -0x0.b7cd6e23645670p-34, 0x0.acd2c8bdc64478p-37, 0x0.d7f45732fb2638p-38, -0x0.c03709f029ab88p-40, 0x0.e5d7bc278b2e10p-41, -0x0.8c5368f1164128p-46, -0x0.f41298c82cc2b0p-43, 0x0.f5f630516aaec0p-46, 0x0.c9bed14885ee10p-47, -0x0.d69f1fa4412098p-49, 0x0.bec62e0f72e008p-49, -0x0.a8f4c544ab68a8p-53, -0x0.944ce1d2de3180p-51, 0x0.a264e4aa02fe38p-54, 0x0.d9c5aab5857648p-57, -0x0.c6a4c18e701c68p-58, 0x0.8fe0bce9b7b4a8p-57, // x=    3.75 y=   5.625
- 0x0.c4a8c7e17b1188p-4, 0x0.9b8416a31ca3e8p-3, -0x0.d600e31abe0348p-6, -0x0.c4f61530dd5848p-7, 0x0.95a8484389c4e8p-8, -0x0.bd0d7b9f9ae500p-11, -0x0.8e42f100b88060p-11, 0x0.86698b06a220f0p-11, 0x0.ca329cd8a98068p-16, -0x0.f8b04546a58ac8p-14, 0x0.885865b5260930p-17, 0x0.96551d3860a040p-16, -0x0.bc65f90ca9bb58p-19, -0x0.d08f022d2bb288p-20, 0x0.8b3d5285520bf0p-21, -0x0.a562ad219e7e20p-24, -0x0.fd324c2776cc58p-25, 0x0.86025ea69c3480p-24, 0x0.94b10069211628p-30, -0x0.f0fdc9c0f982c0p-27, 0x0.b75c267330bc00p-30, 0x0.81597da3dc9fb8p-29, -0x0.c9ae21f93b3360p-32, -0x0.cb82d15b031050p-34, 0x0.f2beb494a64e28p-35, -0x0.f8b388b2b76400p-36, -0x0.fe16f93409e8f0p-39, 0x0.a6f669cb0772c8p-37, -0x0.aed19dc05087d8p-41, -0x0.d8b06eb56ee920p-40, 0x0.8ac8fdacc296c8p-42, 0x0.fce6d10bb75518p-44, -0x0.bae5f2e2410858p-45, 0x0.86639343716d60p-46, 0x0.dc01d2d617e8b8p-49, -0x0.e94adb95da6db0p-48, 0x0.e921490407edf0p-52, 0x0.9c723d57993840p-50, -0x0.c5f0cdf8c934e8p-53, -0x0.a9c049d580b068p-54, // x=   5.375 y=  3.3125
- 0x0.daa14c4f446740p-6, 0x0.dcdd60bebbcf38p-3, -0x0.adefb399f047c0p-7, -0x0.a9480e7723e5c0p-5, 0x0.d2cec87f2baf08p-9, 0x0.81c8f41a6b1220p-7, -0x0.e6c11fda4171c8p-11, -0x0.c6507ab55c9248p-10, 0x0.f0ac57b4ea44d0p-13, 0x0.95f67ab203c578p-12, -0x0.f4e6b916d24538p-15, -0x0.dd9fdbebbbe998p-15, 0x0.f60804966c8820p-17, 0x0.9bda2b9a550d38p-17, -0x0.f550f766d658a8p-19, -0x0.c36b5ba79876f0p-20, 0x0.f2b773ddd38bd8p-21, 0x0.ab8ef33b87eb30p-23, -0x0.ec9d442a9c70a8p-23, 0x0.c6b0de9420fd50p-27, 0x0.df4bcc14f387f8p-25, -0x0.8e311c4267f308p-26, -0x0.c4919ccbdb1988p-27, 0x0.85d553a0233590p-27, 0x0.944c6769aec510p-29, -0x0.c4ec7dadaaacc0p-29, -0x0.8dfe20588e8a68p-32, 0x0.f9bddb7e3ec100p-31, -0x0.932448231f49c8p-35, -0x0.88e0f6b820a200p-32, 0x0.a3349f73c2db48p-35, 0x0.f60030fcb7be18p-35, -0x0.8afbf797ab37b0p-36, -0x0.953d178b0caf88p-37, 0x0.a7d21cfcd728e0p-38, -0x0.c98f9d099935e8p-43, -0x0.923f91b9be89c0p-40, 0x0.c9794435055cc8p-41, 0x0.864cc8c70b4098p-43, -0x0.ad962a3f1c9050p-42, // x=    5.25 y=   0.625
- 0x0.8548607074ab40p-4, 0x0.a89f8ebe164100p-3, -0x0.9e82739ca8b6b0p-6, -0x0.a6333e5e590bf8p-6, 0x0.865acebfcebd78p-8, 0x0.ec4ab9faa66538p-10, -0x0.bd3f22d19cbe10p-11, -0x0.e2f445b3fad700p-18, 0x0.e22ac4a3588238p-14, -0x0.c2800161148650p-15, -0x0.d95815fe2919c8p-17, 0x0.eef46c0f350a48p-17, 0x0.fc532e9c9bad78p-21, -0x0.cc29154ee6cbd8p-19, 0x0.ab9774d4c18e08p-24, 0x0.8ce0d30b79d8b0p-21, -0x0.dcf378c68c4bb0p-25, -0x0.9c74c99d7faf78p-24, 0x0.e625223da3a948p-27, 0x0.eee24a98058aa8p-28, -0x0.b0af69acb1e6e0p-29, 0x0.8eb5fde07a80b8p-35, 0x0.d27463a5c78d88p-32, -0x0.f02e8d6dc36720p-33, -0x0.a9467ab00ab728p-35, 0x0.90052c13e8f400p-34, -0x0.95054a6e6034e0p-44, -0x0.e76cd84f3e2ec8p-37, 0x0.aa3086e26415c0p-40, 0x0.889e3c67191e90p-39, -0x0.caa5dc6c102ba0p-42, -0x0.c1af3e2958fa90p-43, 0x0.9b97378f80e680p-44, -0x0.ad126c0b628020p-47, -0x0.a2ce4a43d21090p-47, 0x0.941ccfe14cf118p-47, 0x0.84a83c2361fa78p-51, -0x0.96b7bc38b42ab0p-49, 0x0.aea8496a3dbc60p-53, 0x0.c60856c5873be0p-52, // x=       6 y=  2.3125
- 0x0.8b0de280f1f130p-5, 0x0.aeba66fbcad568p-3, -0x0.ac2af998faabd8p-7, -0x0.cce79ac8e7df38p-6, 0x0.9f68673b08fdf0p-9, 0x0.e6d4c474d56890p-9, -0x0.829b4c3ae12c78p-11, -0x0.f551e7b8e06ee8p-12, 0x0.c74bb3ed654538p-14, 0x0.ec757a8ab1d348p-15, -0x0.9085a62a6bd5e8p-16, -0x0.b93a82e43b1278p-18, 0x0.c8c8b835d1bb60p-19, 0x0.f90b8bd3091680p-23, -0x0.859dc1d5432610p-21, 0x0.b03b39428c1868p-24, 0x0.a91bdfcffe7688p-24, -0x0.943562f6ec46c8p-25, -0x0.c7b6aaa21d7e08p-27, 0x0.9efc09cea7b7a8p-27, 0x0.d26cc0565fadc0p-30, -0x0.90ca17fcce2ad0p-29, -0x0.ace8b5ed44f5f0p-33, 0x0.ef759b9b63af00p-32, 0x0.9735c7da292498p-38, -0x0.b76c9abe638460p-34, 0x0.891b24f59b01a0p-38, 0x0.81ef14ff669480p-36, -0x0.db853505da5738p-40, -0x0.a665e448631eb0p-39, 0x0.ef54617cf42120p-42, 0x0.b42d5c829ba250p-42, -0x0.dab0d5ecdbd6c8p-44, -0x0.ffbcb643c43190p-46, 0x0.ae64a6b2b91f60p-46, -0x0.86a84122fff4d8p-49, -0x0.ef0d3c15d5a820p-49, 0x0.81de7af077c850p-49, 0x0.80e0e1374f3a00p-51, -0x0.a97fc1569e58a0p-51, // x=  6.4375 y=    1.25
- 0x0.b74e9660c028d0p-4, 0x0.a064e1b9eb6aa8p-3, -0x0.ce32a40af79900p-6, -0x0.ecab7641c5bb88p-7, 0x0.99d67e92697cc0p-8, -0x0.d47238e54cf448p-14, -0x0.a7e8a661f92e80p-11, 0x0.da53bd9e8aeb28p-12, 0x0.d8dec7129a8fc0p-15, -0x0.ee7e132d252700p-14, 0x0.d31f71b7ee76e0p-19, 0x0.aa1bb6a90662d0p-16, -0x0.9a7b77d00eb1c0p-19, -0x0.a685c3e3ea2248p-19, 0x0.92eb6619985d58p-21, 0x0.80808de6e2f920p-23, -0x0.b77ccb4f8ae788p-24, 0x0.9dd58f0f3752d8p-25, 0x0.863cc7f1d15f10p-27, -0x0.e58b0bb1cf73a0p-27, 0x0.aa5b130b8262c0p-32, 0x0.b009e6339ecab8p-29, -0x0.a73385a4813368p-32, -0x0.a7a48c8a4ada60p-32, 0x0.9d3ae90e7f5218p-34, 0x0.897dee125ada58p-37, -0x0.b06707834f9b80p-37, 0x0.e8af46c54c6280p-38, 0x0.9cf6551c376790p-41, -0x0.8782858872ec00p-39, 0x0.9f8c224e04e840p-43, 0x0.aa694c826b9b78p-42, -0x0.e6cb8e3f92c1b8p-45, -0x0.c2fb1a225ff540p-46, 0x0.9c86d53cad7518p-47, -0x0.e26a4c5e610028p-49, -0x0.c5731963023b30p-51, 0x0.c5430e6ed72e50p-50, -0x0.b1080d463a2890p-54, -0x0.8ad93fe7443e40p-52, // x=     5.5 y=  3.0625
-};
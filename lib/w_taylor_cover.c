@@ -1,67 +0,0 @@
-// Created by ./arrange_polyominoes.py 20 d30N20b16.dat on 13:21:13.984073
-alignas(64) static const signed char Cover[4096] = {
--1, 0, 0, 1, 1, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,-1,-1,-1,-1,-1,-1,-1,-1,
- 8,28,28, 1,29,29, 2, 2, 2,30, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4,31, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,-1,-1,-1,-1,-1,-1,-1,-1,
- 9,28,28,29,29,29,29, 2,30,30,30, 3, 3, 3,32, 4, 4, 4, 4, 4, 4,31,31, 5, 5, 5, 5, 5, 5, 5, 5,36,36, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,46, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,-1,-1,-1,-1,-1,-1,-1,-1,
-10,33,33,34,29,29,35,35,30,30,30,30,30,32,32,32,32, 4, 4,31,31,31,31,31, 5, 5, 5, 5, 5, 5,36,36,36, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,46,46, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,-1,-1,-1,-1,-1,-1,-1,-1,
-11,33,33,34,34,35,35,35,35,30,30,30,32,32,32,32,32,32,31,31,31,31,31,31,31, 5, 5, 5, 5,36,36,36,36,36, 6, 6, 6, 6, 6, 6, 6, 6, 6,46,46,46, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,-1,-1,-1,-1,-1,-1,-1,-1,
-12,37,37,34,34,38,35,35,39,39,39,39,32,32,32,32,32,32,31,31,31,31,31,31,31,31,43,43,43,36,36,36,36,36,36, 6, 6, 6, 6, 6, 6, 6,46,46,46,46,46, 7, 7, 7, 7, 7, 7, 7, 7, 7,-1,-1,-1,-1,-1,-1,-1,-1,
-13,40,40,38,38,38,38,41,39,39,39,39,32,32,32,32,32,32,31,31,31,31,31,31,31,31,43,43,43,36,36,36,36,36,36,36,36,36, 6,51,51,46,46,46,46,46,46,46, 7, 7, 7, 7, 7, 7, 7, 7,-1,-1,-1,-1,-1,-1,-1,-1,
-14,40,40,42,38,38,41,41,41,39,39,39,44,32,32,32,32,45,45,31,31,31,31,31,31,43,43,43,43,43,36,36,36,36,36,36,36,36,36,51,51,46,46,46,46,46,46,46,46,46, 7, 7, 7, 7, 7, 7,-1,-1,-1,-1,-1,-1,-1,-1,
-15,47,47,42,42,42,41,41,41,41,39,44,44,44,44,44,45,45,45,45,45,31,31,31,43,43,43,43,43,43,36,36,36,36,36,36,36,36,51,51,51,51,46,46,46,46,46,46,46,46,46,46,64,64,64,64,-1,-1,-1,-1,-1,-1,-1,-1,
-16,47,47,42,42,48,48,41,41,49,49,44,44,44,44,44,45,45,45,45,45,45,31,43,43,43,43,43,43,43,43,36,36,36,36,36,36,51,51,51,51,51,46,46,46,46,46,46,46,46,46,64,64,64,64,64,-1,-1,-1,-1,-1,-1,-1,-1,
-17,47,47,50,48,48,48,48,49,49,49,49,44,44,44,44,45,45,45,45,45,45,53,43,43,43,43,43,43,43,43,36,36,36,36,36,36,51,51,51,51,51,51,46,46,46,46,46,46,64,64,64,64,64,64,63,-1,-1,-1,-1,-1,-1,-1,-1,
-18,52,50,50,50,48,48,49,49,49,49,49,44,44,44,44,45,45,45,45,45,53,53,53,43,43,43,43,43,43,43,36,36,36,36,36,51,51,51,51,51,51,51,51,46,46,46,46,64,64,64,64,64,64,63,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-18,52,52,50,50,54,54,55,49,49,49,49,44,44,56,56,45,45,45,45,53,53,53,53,53,43,43,43,43,43,43,43,36,36,36,51,51,51,51,51,51,51,51,51,46,46,46,64,64,64,64,64,64,63,63,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-18,52,52,50,54,54,54,55,55,55,49,56,56,56,56,56,56,45,45,53,53,53,53,53,53,53,43,43,43,43,43,61,61,61,51,51,51,51,51,51,51,51,51,51,51,64,64,64,64,64,64,64,63,63,63,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-19,57,57,57,54,54,54,55,55,55,55,56,56,56,56,56,56,58,53,53,53,53,53,53,53,53,43,43,43,61,61,61,61,61,61,51,51,51,51,51,51,51,51,51,51,64,64,64,64,64,64,63,63,63,63,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-19,57,57,57,59,54,54,55,55,55,60,56,56,56,56,56,56,58,58,53,53,53,53,53,53,53,61,61,61,61,61,61,61,61,61,61,51,51,51,51,51,51,51,51,51,64,64,64,64,64,63,63,63,63,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-20,57,57,59,59,59,62,55,55,60,60,60,56,56,56,56,58,58,58,58,53,53,53,53,53,53,61,61,61,61,61,61,61,61,61,61,51,51,51,51,51,51,51,51,51,64,64,64,64,63,63,63,63,63,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-20,20,59,59,59,59,62,62,60,60,60,60,60,56,56,56,58,58,58,58,58,53,53,53,53,61,61,61,61,61,61,61,61,61,61,61,61,51,51,51,51,51,51,51,51,64,64,64,63,63,63,63,63,63,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-20,65,59,59,59,62,62,62,60,60,60,60,60,66,66,58,58,58,58,58,58,58,53,53,67,67,61,61,61,61,61,61,61,61,61,61,61,51,51,51,51,51,51,51,64,64,64,63,63,63,63,63,63,63,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-21,21,65,65,59,62,62,62,60,60,60,60,66,66,66,66,58,58,58,58,58,58,67,67,67,67,67,61,61,61,61,61,61,61,61,61,61,72,72,72,51,51,72,73,73,73,63,63,63,63,63,63,63,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-21,21,65,65,68,68,68,68,60,60,60,66,66,66,66,66,58,58,58,58,58,58,67,67,67,67,67,67,61,61,61,61,61,61,61,61,72,72,72,72,72,72,72,73,73,73,73,63,63,63,63,63,63,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-21,21,65,65,68,68,68,68,68,60,66,66,66,66,66,66,66,58,58,58,67,67,67,67,67,67,67,67,61,61,61,61,61,61,61,61,72,72,72,72,72,72,72,73,73,73,73,73,73,63,63,63,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-22,65,65,69,68,68,68,68,68,70,66,66,66,66,66,66,71,71,71,71,67,67,67,67,67,67,67,67,67,61,61,61,61,61,61,72,72,72,72,72,72,72,72,73,73,73,73,73,73,73,63,63,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-22,22,69,69,69,69,68,68,68,70,70,66,66,66,66,66,71,71,71,71,71,67,67,67,67,67,67,67,67,67,61,61,61,61,72,72,72,72,72,72,72,72,72,73,73,73,73,73,73,73,73,63,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-22,22,69,69,69,69,69,69,70,70,70,70,70,66,66,71,71,71,71,71,71,67,67,67,67,67,67,67,67,67,76,77,77,77,72,72,72,72,72,72,72,72,73,73,73,73,73,73,73,73,73,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-22,22,69,69,69,69,69,70,70,70,70,70,70,74,71,71,71,71,71,71,71,71,67,67,67,67,67,67,67,76,76,76,77,77,77,72,72,72,72,72,72,72,73,73,73,73,73,73,73,73,73,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-22,23,75,75,75,69,69,70,70,70,70,70,74,74,74,71,71,71,71,71,71,71,67,67,67,67,67,76,76,76,76,76,77,77,77,77,72,72,72,72,72,72,73,73,73,73,73,73,73,73,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-23,23,75,75,75,75,75,70,70,70,70,74,74,74,74,71,71,71,71,71,71,71,67,67,67,67,76,76,76,76,76,76,77,77,77,77,72,72,72,72,72,72,73,73,73,73,73,73,73,73,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-23,23,23,75,75,75,75,75,74,70,74,74,74,74,74,74,71,71,71,71,71,71,79,76,76,76,76,76,76,76,76,77,77,77,77,77,77,72,72,72,72,72,73,85,85,85,85,85,85,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-23,23,75,75,75,75,75,78,78,74,74,74,74,74,74,74,71,71,71,71,71,79,79,79,76,76,76,76,76,76,76,77,77,77,77,77,77,77,72,72,72,85,85,85,85,85,85,85,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-23,23,75,75,75,75,75,78,78,78,74,74,74,74,74,74,71,71,71,71,79,79,79,79,79,76,76,76,76,76,76,77,77,77,77,77,77,77,72,72,72,85,85,85,85,85,85,85,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-24,24,80,80,75,80,78,78,78,78,78,74,74,74,74,74,81,81,79,79,79,79,79,79,79,76,76,76,76,76,76,77,77,77,77,77,77,77,77,72,85,85,85,85,85,85,85,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-24,24,24,80,80,80,78,78,78,78,78,78,74,74,81,81,81,81,79,79,79,79,79,79,79,79,76,76,76,76,76,77,77,77,77,77,77,77,77,85,85,85,85,85,85,85,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-24,24,24,80,80,80,78,78,78,78,78,78,78,81,81,81,81,81,81,79,79,79,79,79,79,79,79,76,76,76,76,77,77,77,77,77,77,77,77,85,85,85,85,85,85,85,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-24,24,24,80,80,80,80,78,78,78,78,78,78,81,81,81,81,81,81,79,79,79,79,79,79,79,79,76,76,76,76,77,77,77,77,77,83,83,83,83,85,85,85,85,85,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-24,24,80,80,80,80,80,78,78,78,78,78,81,81,81,81,81,81,81,81,79,79,79,79,79,79,79,79,76,76,76,83,83,83,83,83,83,83,83,83,83,85,85,85,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-24,80,80,80,80,80,80,78,78,78,78,82,81,81,81,81,81,81,81,81,79,79,79,79,79,79,79,86,83,83,83,83,83,83,83,83,83,83,83,83,83,83,85,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-25,25,80,80,80,80,84,84,82,82,82,82,82,81,81,81,81,81,81,81,81,79,79,79,79,79,79,86,86,83,83,83,83,83,83,83,83,83,83,83,83,83,85,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-25,25,25,87,87,87,84,84,82,82,82,82,82,82,81,81,81,81,81,81,81,79,79,79,79,86,86,86,86,86,83,83,83,83,83,83,83,83,83,83,83,83,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-25,25,25,25,87,87,84,84,82,82,82,82,82,82,81,81,81,81,81,81,81,90,90,86,86,86,86,86,86,86,83,83,83,83,83,83,83,83,83,83,83,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-25,25,25,25,87,87,84,84,84,82,82,82,82,82,82,81,81,81,81,81,90,90,90,90,86,86,86,86,86,86,86,83,83,83,83,83,83,83,83,83,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-25,25,25,25,87,87,84,84,84,82,82,82,82,82,82,82,81,81,88,90,90,90,90,90,86,86,86,86,86,86,86,83,83,83,83,83,83,83,83,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-25,25,25,87,87,87,84,84,84,82,82,82,82,82,82,82,88,88,88,90,90,90,90,90,90,86,86,86,86,86,86,83,83,83,83,83,83,83,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-25,25,87,87,87,87,84,84,84,82,82,82,82,82,82,82,88,88,88,88,90,90,90,90,90,86,86,86,86,86,86,86,83,83,83,83,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-26,87,87,87,87,87,84,84,84,82,82,82,82,82,82,88,88,88,88,88,88,90,90,90,90,90,86,86,86,86,86,86,83,83,83,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-26,26,26,87,87,87,84,84,84,82,82,82,82,82,88,88,88,88,88,88,88,90,90,90,90,90,86,86,86,86,86,86,86,83,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-26,26,26,26,87,87,84,84,89,89,82,82,89,88,88,88,88,88,88,88,88,88,90,90,90,90,90,86,86,86,86,86,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-26,26,26,26,26,89,89,89,89,89,89,89,89,88,88,88,88,88,88,88,88,88,88,90,90,90,90,86,86,86,86,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-26,26,26,26,26,89,89,89,89,89,89,89,89,89,88,88,88,88,88,88,88,88,88,90,90,90,90,90,86,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-26,26,26,26,26,89,89,89,89,89,89,89,89,89,88,88,88,88,88,88,88,88,88,88,90,90,90,90,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-26,26,26,26,26,89,89,89,89,89,89,89,89,89,89,88,88,88,88,88,88,88,88,88,88,90,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-26,26,26,26,26,89,89,89,89,89,89,89,89,89,89,88,88,88,88,88,88,88,88,88,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-26,26,26,26,27,89,89,89,89,89,89,89,89,89,89,88,88,88,88,88,88,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-26,26,26,27,27,27,89,89,89,89,89,89,89,89,89,89,88,88,88,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-26,27,27,27,27,27,89,89,89,89,89,89,89,89,89,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-27,27,27,27,27,27,89,89,89,89,89,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
--1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
--1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
--1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
--1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
--1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
--1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
--1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
--1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-};
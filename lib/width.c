@@ -32,6 +32,12 @@
 #include <assert.h>
 #include <math.h>
 #include "cerf.h"
+#include "defs.h"
+
+#ifdef CERF_INTROSPECT
+IMPORT extern int cerf_algorithm;
+IMPORT extern int cerf_nofterms;
+#endif
 
 #ifndef DBL_EPSILON
 #define DBL_EPSILON 2.2204460492503131E-16
@@ -92,11 +98,15 @@ double voigt_hwhm(double sigma, double gamma)
      * We have never seen convergence worse than k = 15.
      */
     for (k=0; k<30; k++) {
-        if (fabs(del_a-del_b) < 2 * DBL_EPSILON * HM)
+        if (fabs(del_a-del_b) < 2 * DBL_EPSILON * HM) {
+            SET_INFO(1500, k);
             return prefac*(a+b)/2;
+        }
 	c = (b*del_a - a*del_b) / (del_a - del_b);
-	if (fabs(b-a) < 2 * DBL_EPSILON * fabs(b+a))
+	if (fabs(b-a) < 2 * DBL_EPSILON * fabs(b+a)) {
+	    SET_INFO(1500, k);
 	    return prefac*c;
+	}
 	del_c = voigt(c, s, g) - HM;
 
 	if (del_b * del_c > 0) {
@@ -110,6 +120,7 @@ double voigt_hwhm(double sigma, double gamma)
 		del_b /= 2;
 	    side = 1;
 	} else {
+	    SET_INFO(1500, k+1);
 	    return prefac*c;
 	}
     }
@@ -0,0 +1,378 @@
+/* Library libcerf:
+ *   Compute complex error functions, based on a new implementation of
+ *   Faddeeva's w_of_z. Also provide Dawson and Voigt functions.
+ *
+ * File benchcheck.c:
+ *   Run benchmark kernels repeatedly, and compare with a stored baseline.
+ *
+ * Copyright:
+ *   (C) 2026 Forschungszentrum Jülich GmbH
+ *
+ * Licence:
+ *   Public domain.
+ *
+ * Website:
+ *   http://apps.jcns.fz-juelich.de/libcerf
+ */
+
+/*
+   Each kernel (one function with one input distribution) is timed in NRUN runs.
+   The result is the median time per call, with a distribution-free confidence interval
+   from order statistics (at least 95%).
+
+   Baselines are stored per CPU model, in <dir>/<cpu model>.json, as written by the
+   update command; an update of some kernels keeps the entries of the others.
+   A kernel is flagged as slower if its confidence interval lies entirely above the baseline
+   interval, and its median exceeds the baseline median by more than the tolerance
+   (default 5%, or environment variable CERF_BENCH_TOLERANCE, in percent).
+
+   CTest runs the check command for each kernel, with label "benchmark":
+       ctest -L benchmark
+   If there is no baseline for the CPU, the check is skipped (return code 77).
+   The baseline directory is run/baselines, or as set by cmake -DCERF_BENCH_BASELINES=<dir>.
+
+   Usage:
+       benchcheck list
+       benchcheck run [kernel...]
+       benchcheck update <dir> [kernel...]
+       benchcheck check <kernel> <dir>
+*/
+
+#include "cerf.h"
+#include "defs.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+enum { M = 1 << 12, NRUN = 21 };
+
+static double sink = 0;
+static double xs[M], ys[M];
+
+/******************************************************************************/
+/*  Kernels                                                                   */
+/******************************************************************************/
+
+static void k_erfcx_pos(long n)
+{
+    for (long i = 0; i < n; ++i)
+        sink += erfcx(xs[i % M]);
+}
+
+static void k_erfcx_neg(long n)
+{
+    for (long i = 0; i < n; ++i)
+        sink += erfcx(-xs[i % M]);
+}
+
+static void k_im_w_of_x(long n)
+{
+    for (long i = 0; i < n; ++i)
+        sink += im_w_of_x(xs[i % M]);
+}
+
+static void k_dawson(long n)
+{
+    for (long i = 0; i < n; ++i)
+        sink += dawson(xs[i % M]);
+}
+
+static void k_voigt(long n)
+{
+    for (long i = 0; i < n; ++i)
+        sink += voigt(xs[i % M], 1, ys[i % M]);
+}
+
+static void k_cmplx(_cerf_cmplx (*f)(_cerf_cmplx), double scale, long n)
+{
+    _cerf_cmplx s = C(0, 0);
+    for (long i = 0; i < n; ++i)
+        s += f(C(scale * xs[i % M], scale * ys[i % M]));
+    sink += creal(s);
+}
+
+static void k_w_of_z_small(long n)
+{
+    k_cmplx(w_of_z, .02, n);
+}
+
+static void k_w_of_z_tiles(long n)
+{
+    k_cmplx(w_of_z, .5, n);
+}
+
+static void k_w_of_z_asymp(long n)
+{
+    k_cmplx(w_of_z, 8, n);
+}
+
+static void k_cerf(long n)
+{
+    k_cmplx(cerf, .5, n);
+}
+
+static void k_w_of_z_rational(long n)
+{
+    static double wr[M], wi[M];
+    for (long i = 0; i < n; i += M) {
+        const size_t m = n - i < M ? (size_t)(n - i) : M;
+        w_of_z_array(m, xs, ys, wr, wi, CERF_W_RATIONAL);
+        sink += wr[0];
+    }
+}
+
+typedef struct {
+    const char* name;
+    void (*run)(long n);
+} kernel_t;
+
+static const kernel_t kernels[] = {
+    {"erfcx_pos", k_erfcx_pos},         {"erfcx_neg", k_erfcx_neg},
+    {"im_w_of_x", k_im_w_of_x},         {"dawson", k_dawson},
+    {"voigt", k_voigt},                 {"w_of_z_small", k_w_of_z_small},
+    {"w_of_z_tiles", k_w_of_z_tiles},   {"w_of_z_asymp", k_w_of_z_asymp},
+    {"w_of_z_rational", k_w_of_z_rational}, {"cerf", k_cerf},
+};
+enum { NKERNEL = sizeof(kernels) / sizeof(kernels[0]) };
+
+static const kernel_t* find_kernel(const char* name)
+{
+    for (int i = 0; i < NKERNEL; ++i)
+        if (!strcmp(kernels[i].name, name))
+            return &kernels[i];
+    fprintf(stderr, "unknown kernel %s\n", name);
+    return NULL;
+}
+
+/******************************************************************************/
+/*  Statistics                                                                */
+/******************************************************************************/
+
+typedef struct {
+    double median, lo, hi; // ns per call, with confidence interval
+} stat_t;
+
+static double now(void)
+{
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return ts.tv_sec + 1e-9 * ts.tv_nsec;
+}
+
+static int by_value(const void* a, const void* b)
+{
+    const double u = *(const double*)a, v = *(const double*)b;
+    return u < v ? -1 : u > v;
+}
+
+//! Returns the largest k such that P(X < k) <= 2.5% for X ~ Binomial(NRUN, 1/2).
+//! The k-th smallest and the k-th largest of NRUN times then bracket the median with
+//! probability 1 - 2 P(X < k) >= 95% (97.3% for NRUN = 21, k = 6).
+static int ci_rank(void)
+{
+    double p = pow(.5, NRUN), cdf = 0;
+    int k = 0;
+    while (cdf + p <= .025) {
+        cdf += p;
+        p *= (double)(NRUN - k) / (k + 1);
+        ++k;
+    }
+    return k;
+}
+
+static stat_t measure(const kernel_t* kern)
+{
+    // Fixed arguments: x in [0, 6), y in [0.1, 3).
+    for (int i = 0; i < M; ++i) {
+        xs[i] = 6. * ((i * 1103) % M) / M;
+        ys[i] = .1 + 2.9 * ((i * 2731) % M) / M;
+    }
+    // Choose the number of calls per run such that a run takes about 20 ms.
+    long n = M;
+    kern->run(n); // warm-up
+    for (;;) {
+        const double t0 = now();
+        kern->run(n);
+        if (now() - t0 > .02 || n > (1L << 30))
+            break;
+        n *= 2;
+    }
+    double t[NRUN];
+    for (int r = 0; r < NRUN; ++r) {
+        const double t0 = now();
+        kern->run(n);
+        t[r] = 1e9 * (now() - t0) / n;
+    }
+    qsort(t, NRUN, sizeof(double), by_value);
+    const int k = ci_rank();
+    stat_t s = {t[NRUN / 2], t[k - 1], t[NRUN - k]};
+    return s;
+}
+
+/******************************************************************************/
+/*  Baseline files                                                            */
+/******************************************************************************/
+
+static void cpu_model(char* model, size_t size)
+{
+    snprintf(model, size, "unknown");
+    FILE* f = fopen("/proc/cpuinfo", "r");
+    if (!f)
+        return;
+    char line[256];
+    while (fgets(line, sizeof(line), f)) {
+        if (!strncmp(line, "model name", 10)) {
+            const char* c = strchr(line, ':');
+            if (c) {
+                snprintf(model, size, "%s", c + 2);
+                model[strcspn(model, "\n")] = 0;
+            }
+            break;
+        }
+    }
+    fclose(f);
+}
+
+static void baseline_path(const char* dir, char* path, size_t size)
+{
+    char model[128];
+    cpu_model(model, sizeof(model));
+    for (char* c = model; *c; ++c)
+        if (!(('a' <= *c && *c <= 'z') || ('A' <= *c && *c <= 'Z') || ('0' <= *c && *c <= '9')))
+            *c = '_';
+    snprintf(path, size, "%s/%s.json", dir, model);
+}
+
+//! Reads the baseline of one kernel; returns 0 on success.
+static int read_baseline(const char* path, const char* name, stat_t* s)
+{
+    FILE* f = fopen(path, "r");
+    if (!f)
+        return -1;
+    char key[80], line[256];
+    snprintf(key, sizeof(key), "\"%s\":", name);
+    int ret = -1;
+    while (fgets(line, sizeof(line), f)) {
+        const char* c = strstr(line, key);
+        if (c && sscanf(c + strlen(key), " {\"median\": %lf, \"lo\": %lf, \"hi\": %lf", &s->median,
+                        &s->lo, &s->hi) == 3) {
+            ret = 0;
+            break;
+        }
+    }
+    fclose(f);
+    return ret;
+}
+
+static int write_baseline(const char* path, const kernel_t* const* ks, const stat_t* s, int nk)
+{
+    FILE* f = fopen(path, "w");
+    if (!f) {
+        fprintf(stderr, "cannot write %s\n", path);
+        return 1;
+    }
+    char model[128];
+    cpu_model(model, sizeof(model));
+    fprintf(f, "{\n  \"cpu\": \"%s\",\n  \"unit\": \"ns per call\",\n  \"runs\": %i,\n", model,
+            NRUN);
+    fprintf(f, "  \"kernels\": {\n");
+    for (int i = 0; i < nk; ++i)
+        fprintf(f, "    \"%s\": {\"median\": %.4g, \"lo\": %.4g, \"hi\": %.4g}%s\n", ks[i]->name,
+                s[i].median, s[i].lo, s[i].hi, i + 1 < nk ? "," : "");
+    fprintf(f, "  }\n}\n");
+    fclose(f);
+    return 0;
+}
+
+/******************************************************************************/
+/*  Commands                                                                  */
+/******************************************************************************/
+
+//! Collects kernels named in argv[0..argc-1], or all kernels if argc == 0; returns their number.
+static int select_kernels(int argc, char** argv, const kernel_t** ks)
+{
+    if (argc == 0) {
+        for (int i = 0; i < NKERNEL; ++i)
+            ks[i] = &kernels[i];
+        return NKERNEL;
+    }
+    int nk = 0;
+    for (int i = 0; i < argc && nk < NKERNEL; ++i)
+        if ((ks[nk] = find_kernel(argv[i])))
+            ++nk;
+    return nk;
+}
+
+static int check(const char* name, const char* dir)
+{
+    const kernel_t* kern = find_kernel(name);
+    if (!kern)
+        return 1;
+    char path[512];
+    baseline_path(dir, path, sizeof(path));
+    stat_t base;
+    if (read_baseline(path, name, &base)) {
+        printf("no baseline for %s in %s; create one with: benchcheck update %s\n", name, path,
+               dir);
+        return 77;
+    }
+    const char* env = getenv("CERF_BENCH_TOLERANCE");
+    const double tol = env ? atof(env) / 100 : .05;
+    const stat_t s = measure(kern);
+    const int slower = s.lo > base.hi && s.median > (1 + tol) * base.median;
+    printf("%-16s %8.3f [%8.3f, %8.3f] ns, baseline %8.3f [%8.3f, %8.3f] ns, %+6.1f%%%s\n", name,
+           s.median, s.lo, s.hi, base.median, base.lo, base.hi,
+           100 * (s.median / base.median - 1), slower ? "  SLOWER" : "");
+    return slower;
+}
+
+int main(int argc, char** argv)
+{
+    const kernel_t* ks[NKERNEL];
+    stat_t s[NKERNEL];
+    int ret = 0;
+
+    if (argc == 2 && !strcmp(argv[1], "list")) {
+        for (int i = 0; i < NKERNEL; ++i)
+            printf("%s\n", kernels[i].name);
+    } else if (argc >= 2 && !strcmp(argv[1], "run")) {
+        const int nk = select_kernels(argc - 2, argv + 2, ks);
+        for (int i = 0; i < nk; ++i) {
+            s[i] = measure(ks[i]);
+            printf("%-16s %8.3f [%8.3f, %8.3f] ns\n", ks[i]->name, s[i].median, s[i].lo, s[i].hi);
+        }
+    } else if (argc >= 3 && !strcmp(argv[1], "update")) {
+        const int nk = select_kernels(argc - 3, argv + 3, ks);
+        for (int i = 0; i < nk; ++i)
+            s[i] = measure(ks[i]);
+        char path[512];
+        baseline_path(argv[2], path, sizeof(path));
+        // Kernels not measured now keep their entries from the existing file.
+        const kernel_t* all[NKERNEL];
+        stat_t sall[NKERNEL];
+        int n = 0;
+        for (int j = 0; j < NKERNEL; ++j) {
+            int i = 0;
+            while (i < nk && ks[i] != &kernels[j])
+                ++i;
+            if (i < nk) {
+                all[n] = ks[i];
+                sall[n++] = s[i];
+            } else if (!read_baseline(path, kernels[j].name, &sall[n])) {
+                all[n++] = &kernels[j];
+            }
+        }
+        ret = write_baseline(path, all, sall, n);
+        if (!ret)
+            printf("wrote %s\n", path);
+    } else if (argc == 4 && !strcmp(argv[1], "check")) {
+        ret = check(argv[2], argv[3]);
+    } else {
+        fprintf(stderr, "Usage: %s list | run [kernel...] | update <dir> [kernel...] | "
+                        "check <kernel> <dir>\n", argv[0]);
+        ret = 1;
+    }
+    return ret ? ret : sink == 42;
+}
@@ -0,0 +1,506 @@
+/* Library libcerf:
+ *   Compute complex error functions, based on a new implementation of
+ *   Faddeeva's w_of_z. Also provide Dawson and Voigt functions.
+ *
+ * File cerf_eval.c:
+ *   Evaluate any library function for a stream of arguments, as text or binary,
+ *   from standard input or from files, with several threads.
+ *
+ * Copyright:
+ *   (C) 2026 Forschungszentrum Jülich GmbH
+ *
+ * Licence:
+ *   Public domain.
+ *
+ * Website:
+ *   http://apps.jcns.fz-juelich.de/libcerf
+ */
+
+/*
+   Builds the executable cerf-eval.
+
+   Input records contain the nin arguments of the function (see fctable.h; two for a
+   complex argument). Output records contain the nout function values.
+   Text format: one record per line, numbers separated by blanks, tabs or commas;
+   empty lines and lines starting with '#' are skipped. Output numbers are written as the
+   shortest text that reads back exactly (dtoa.h), or with a given number of significant digits.
+   Binary format: raw IEEE doubles in little-endian byte order, without any header.
+
+   Input files are memory mapped (except under Windows); standard input ("-", or no file)
+   is read in large blocks. The input is processed in windows of several MB. Each window is
+   cut into pieces (at line boundaries for text), which are parsed, evaluated by the array
+   functions, and formatted in parallel; then the outputs of the pieces are written in order.
+
+   Mapped mode (-m, not under Windows): binary input file and binary output file, both memory
+   mapped and in the byte order of the host, evaluated without copies through stdio (mapeval.h).
+   Records as above, or with -c columns (all first arguments, then all second arguments, ...;
+   likewise for the values). The output file may be the input file, if nin = nout.
+
+   Usage:
+       cerf-eval [-i text|bin] [-o text|bin] [-t threads] [-p digits] <function> [file...]
+       cerf-eval -m <outfile> [-c] [-t threads] <function> <infile>
+       cerf-eval -l      (list functions)
+   Example:
+       seq 0 .001 10 | cerf-eval dawson
+*/
+
+#include "dtoa.h"
+#include "fctable.h"
+#include "parallel.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "mapeval.h"
+#endif
+
+enum { BLOCK = 512 };          // records per call of an array function
+enum { WINDOW = 1 << 24 };     // bytes of input processed at once
+enum { MAXLINE = 1024 };       // longest accepted input line
+enum { MAXPIECE = 4 * 256 };   // pieces per window
+
+typedef struct {
+    char* buf;
+    size_t len, cap;
+} outbuf_t;
+
+typedef struct {
+    const fct_t* f;
+    int text_in, text_out, digits; // digits = 0: shortest exact representation
+    int nthreads, npiece;
+    // present window, and its pieces
+    const char* in;
+    size_t piece_begin[MAXPIECE + 1];
+    outbuf_t out[MAXPIECE];
+    int error; // set by any thread; then the offending line is in errline
+    char errline[80];
+} job_t;
+
+/******************************************************************************/
+/*  Binary conversion                                                         */
+/******************************************************************************/
+
+static int big_endian(void)
+{
+    const uint16_t one = 1;
+    unsigned char c;
+    memcpy(&c, &one, 1);
+    return c == 0;
+}
+
+static int swap_bytes; // nonzero on big-endian hosts
+
+static double get_double(const char* p)
+{
+    unsigned char b[8];
+    memcpy(b, p, 8);
+    if (swap_bytes)
+        for (int k = 0; k < 4; ++k) {
+            const unsigned char t = b[k];
+            b[k] = b[7 - k];
+            b[7 - k] = t;
+        }
+    double v;
+    memcpy(&v, b, 8);
+    return v;
+}
+
+static void put_double(char* p, double v)
+{
+    unsigned char b[8];
+    memcpy(b, &v, 8);
+    if (swap_bytes)
+        for (int k = 0; k < 4; ++k) {
+            const unsigned char t = b[k];
+            b[k] = b[7 - k];
+            b[7 - k] = t;
+        }
+    memcpy(p, b, 8);
+}
+
+/******************************************************************************/
+/*  Processing of one piece                                                   */
+/******************************************************************************/
+
+static int reserve(outbuf_t* o, size_t extra)
+{
+    if (o->len + extra <= o->cap)
+        return 0;
+    size_t cap = o->cap ? 2 * o->cap : 1 << 16;
+    while (cap < o->len + extra)
+        cap *= 2;
+    char* buf = (char*)realloc(o->buf, cap);
+    if (!buf)
+        return 1;
+    o->buf = buf;
+    o->cap = cap;
+    return 0;
+}
+
+//! Parses one line into v[0..nin-1]. Returns 1 for a skipped line, -1 for an error.
+static int parse_line(const char* p, const char* eol, int nin, double* v)
+{
+    char line[MAXLINE + 1];
+    const size_t len = (size_t)(eol - p);
+    if (len > MAXLINE)
+        return -1;
+    memcpy(line, p, len);
+    line[len] = 0; // strtod needs a terminated string, and the input may be a mapped file
+    char* s = line;
+    while (*s == ' ' || *s == '\t' || *s == '\r')
+        ++s;
+    if (!*s || *s == '#')
+        return 1;
+    for (int k = 0; k < nin; ++k) {
+        while (*s == ' ' || *s == '\t' || *s == ',')
+            ++s;
+        char* end;
+        v[k] = strtod(s, &end);
+        if (end == s)
+            return -1;
+        s = end;
+    }
+    while (*s == ' ' || *s == '\t' || *s == ',' || *s == '\r')
+        ++s;
+    return *s ? -1 : 0;
+}
+
+static void emit(job_t* job, outbuf_t* o, size_t n, double* const* r)
+{
+    const int nout = job->f->nout;
+    if (!job->text_out) {
+        if (reserve(o, n * nout * 8)) {
+            job->error = 1;
+            return;
+        }
+        char* p = o->buf + o->len;
+        for (size_t i = 0; i < n; ++i)
+            for (int k = 0; k < nout; ++k, p += 8)
+                put_double(p, r[k][i]);
+        o->len = (size_t)(p - o->buf);
+        return;
+    }
+    const size_t width = DTOA_BUFSIZE; // enough for any number and a separator
+    if (reserve(o, n * nout * width)) {
+        job->error = 1;
+        return;
+    }
+    char* p = o->buf + o->len;
+    for (size_t i = 0; i < n; ++i) {
+        for (int k = 0; k < nout; ++k) {
+            if (job->digits)
+                p += snprintf(p, width, "%.*g", job->digits, r[k][i]);
+            else
+                p += dtoa_shortest(r[k][i], p);
+            *p++ = k + 1 < nout ? ' ' : '\n';
+        }
+    }
+    o->len = (size_t)(p - o->buf);
+}
+
+static void body(void* ctx, int thread, long begin, long end)
+{
+    (void)thread;
+    job_t* job = (job_t*)ctx;
+    const fct_t* f = job->f;
+    double abuf[4][BLOCK], rbuf[4][BLOCK];
+    const double* a[4] = {abuf[0], abuf[1], abuf[2], abuf[3]};
+    double* r[4] = {rbuf[0], rbuf[1], rbuf[2], rbuf[3]};
+    for (long ip = begin; ip < end; ++ip) {
+        outbuf_t* o = &job->out[ip];
+        o->len = 0;
+        const char* p = job->in + job->piece_begin[ip];
+        const char* const stop = job->in + job->piece_begin[ip + 1];
+        while (p < stop && !job->error) {
+            size_t n = 0;
+            if (job->text_in) {
+                while (n < BLOCK && p < stop) {
+                    const char* eol = (const char*)memchr(p, '\n', (size_t)(stop - p));
+                    if (!eol)
+                        eol = stop;
+                    double v[4];
+                    const int ret = parse_line(p, eol, f->nin, v);
+                    if (ret < 0) {
+                        const size_t len = (size_t)(eol - p) < 79 ? (size_t)(eol - p) : 79;
+                        memcpy(job->errline, p, len);
+                        job->errline[len] = 0;
+                        job->error = 2;
+                        return;
+                    }
+                    if (!ret) {
+                        for (int k = 0; k < f->nin; ++k)
+                            abuf[k][n] = v[k];
+                        ++n;
+                    }
+                    p = eol + 1;
+                }
+            } else {
+                const size_t rec = 8 * (size_t)f->nin;
+                for (; n < BLOCK && p < stop; ++n, p += rec)
+                    for (int k = 0; k < f->nin; ++k)
+                        abuf[k][n] = get_double(p + 8 * k);
+            }
+            if (!n)
+                continue;
+            fct_eval(f, n, a, r);
+            emit(job, o, n, r);
+        }
+    }
+}
+
+/******************************************************************************/
+/*  Windows of input                                                          */
+/******************************************************************************/
+
+//! Processes a complete prefix of in[0..len), writes the output, and returns the number of
+//! bytes consumed. If final, all input must be consumed.
+static size_t process(job_t* job, const char* in, size_t len, int final)
+{
+    size_t use = len;
+    if (job->text_in) {
+        if (!final) {
+            while (use > 0 && in[use - 1] != '\n')
+                --use;
+            if (!use)
+                return 0; // no complete line; the caller needs to supply more input
+        }
+    } else {
+        const size_t rec = 8 * (size_t)job->f->nin;
+        use -= use % rec;
+        if (final && use != len) {
+            fprintf(stderr, "cerf-eval: input ends with incomplete record\n");
+            job->error = 3;
+        }
+    }
+    if (!use)
+        return 0;
+
+    // Cut into pieces of about equal size.
+    int npiece = job->nthreads == 1 ? 1 : 4 * job->nthreads;
+    if ((size_t)npiece > use / 4096 + 1)
+        npiece = (int)(use / 4096) + 1;
+    if (npiece > MAXPIECE)
+        npiece = MAXPIECE;
+    job->in = in;
+    job->piece_begin[0] = 0;
+    const size_t rec = job->text_in ? 1 : 8 * (size_t)job->f->nin;
+    for (int i = 1; i < npiece; ++i) {
+        size_t b = use / npiece * i;
+        b -= b % rec;
+        if (job->text_in) { // advance to the next line
+            const char* eol = (const char*)memchr(in + b, '\n', use - b);
+            b = eol ? (size_t)(eol - in) + 1 : use;
+        }
+        job->piece_begin[i] = b < job->piece_begin[i - 1] ? job->piece_begin[i - 1] : b;
+    }
+    job->piece_begin[npiece] = use;
+    job->npiece = npiece;
+
+    parallel_for(job->nthreads, npiece, 1, body, job);
+
+    for (int i = 0; i < npiece && !job->error; ++i)
+        if (job->out[i].len && fwrite(job->out[i].buf, 1, job->out[i].len, stdout) != job->out[i].len)
+            job->error = 4;
+    return use;
+}
+
+//! Processes an open stream, read in blocks.
+static void process_stream(job_t* job, FILE* f)
+{
+    char* buf = (char*)malloc(WINDOW);
+    if (!buf) {
+        job->error = 1;
+        return;
+    }
+    size_t have = 0;
+    for (;;) {
+        const size_t got = fread(buf + have, 1, WINDOW - have, f);
+        have += got;
+        const int final = got == 0;
+        const size_t used = process(job, buf, have, final);
+        if (job->error || final)
+            break;
+        if (!used && have == WINDOW) {
+            fprintf(stderr, "cerf-eval: input line too long\n");
+            job->error = 3;
+            break;
+        }
+        memmove(buf, buf + used, have - used);
+        have -= used;
+    }
+    free(buf);
+}
+
+//! Processes a file, memory mapped if possible.
+static void process_file(job_t* job, const char* name)
+{
+    if (!strcmp(name, "-")) {
+        process_stream(job, stdin);
+        return;
+    }
+#ifndef _WIN32
+    const int fd = open(name, O_RDONLY);
+    struct stat st;
+    if (fd >= 0 && !fstat(fd, &st) && S_ISREG(st.st_mode) && st.st_size > 0) {
+        const size_t size = (size_t)st.st_size;
+        void* mem = mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+        close(fd);
+        if (mem != MAP_FAILED) {
+            const char* in = (const char*)mem;
+            size_t pos = 0;
+            while (pos < size && !job->error) {
+                const size_t len = size - pos < WINDOW ? size - pos : WINDOW;
+                const int final = pos + len == size;
+                const size_t used = process(job, in + pos, len, final);
+                if (!used && !final) {
+                    fprintf(stderr, "cerf-eval: input line too long\n");
+                    job->error = 3;
+                }
+                pos += used;
+                if (final)
+                    break;
+            }
+            munmap(mem, size);
+            return;
+        }
+    } else if (fd >= 0) {
+        close(fd);
+    }
+#endif
+    FILE* f = fopen(name, "rb");
+    if (!f) {
+        fprintf(stderr, "cerf-eval: cannot open %s\n", name);
+        job->error = 5;
+        return;
+    }
+    process_stream(job, f);
+    fclose(f);
+}
+
+/******************************************************************************/
+/*  Mapped mode                                                               */
+/******************************************************************************/
+
+static int mapped(const job_t* job, int columns, const char* infile, const char* outfile)
+{
+#ifndef _WIN32
+    mapeval_opt_t opt = mapeval_default();
+    opt.columns = columns;
+    opt.nthreads = job->nthreads;
+    const int ret = mapeval_files(job->f, infile, outfile, &opt, NULL);
+    if (ret == -1)
+        fprintf(stderr, "cerf-eval: cannot map %s or %s\n", infile, outfile);
+    else if (ret == -2)
+        fprintf(stderr, "cerf-eval: size of %s is not a multiple of %i bytes\n", infile,
+                8 * job->f->nin);
+    else if (ret == -3)
+        fprintf(stderr, "cerf-eval: %s has %i arguments but %i value%s, cannot work in place\n",
+                job->f->name, job->f->nin, job->f->nout, job->f->nout > 1 ? "s" : "");
+    return ret ? 5 : 0;
+#else
+    (void)job;
+    (void)columns;
+    (void)infile;
+    (void)outfile;
+    fprintf(stderr, "cerf-eval: mapped mode is not available under Windows\n");
+    return 1;
+#endif
+}
+
+/******************************************************************************/
+/*  Main                                                                      */
+/******************************************************************************/
+
+static int usage(void)
+{
+    fprintf(stderr,
+            "Usage: cerf-eval [-i text|bin] [-o text|bin] [-t threads] [-p digits] <function> "
+            "[file...]\n"
+            "       cerf-eval -m <outfile> [-c] [-t threads] <function> <infile>\n"
+            "       cerf-eval -l\n"
+            "Input records contain the arguments, output records the values of the function;\n"
+            "text: one record per line; bin: little-endian doubles. Files default to stdin.\n"
+            "-m: memory-mapped binary files in host byte order; -c: columns instead of records.\n");
+    return 1;
+}
+
+int main(int argc, char** argv)
+{
+    static job_t job; // large; zero-initialized
+    job.text_in = job.text_out = 1;
+    job.nthreads = parallel_nproc();
+    swap_bytes = big_endian();
+
+    const char* mapped_out = NULL;
+    int columns = 0;
+    int i = 1;
+    for (; i < argc && argv[i][0] == '-' && argv[i][1]; ++i) {
+        const char* opt = argv[i];
+        if (!strcmp(opt, "-l")) {
+            fct_list(stdout);
+            return 0;
+        }
+        if (!strcmp(opt, "-c")) {
+            columns = 1;
+            continue;
+        }
+        if (i + 1 == argc || opt[2])
+            return usage();
+        const char* val = argv[++i];
+        if (!strcmp(opt, "-i") || !strcmp(opt, "-o")) {
+            const int text = !strcmp(val, "text");
+            if (!text && strcmp(val, "bin"))
+                return usage();
+            if (opt[1] == 'i')
+                job.text_in = text;
+            else
+                job.text_out = text;
+        } else if (!strcmp(opt, "-m")) {
+            mapped_out = val;
+        } else if (!strcmp(opt, "-t")) {
+            job.nthreads = atoi(val);
+        } else if (!strcmp(opt, "-p")) {
+            job.digits = atoi(val);
+            if (job.digits < 1 || job.digits > 17)
+                return usage();
+        } else {
+            return usage();
+        }
+    }
+    if (i == argc)
+        return usage();
+    job.f = fct_find(argv[i]);
+    if (!job.f) {
+        fprintf(stderr, "cerf-eval: unknown function %s; available functions:\n", argv[i]);
+        fct_list(stderr);
+        return 1;
+    }
+    if (job.nthreads < 1)
+        job.nthreads = 1;
+    if (job.nthreads > MAXPIECE / 4)
+        job.nthreads = MAXPIECE / 4;
+    if (mapped_out || columns) {
+        if (!mapped_out || i + 2 != argc)
+            return usage();
+        return mapped(&job, columns, argv[i + 1], mapped_out);
+    }
+
+    if (++i == argc)
+        process_file(&job, "-");
+    for (; i < argc && !job.error; ++i)
+        process_file(&job, argv[i]);
+    if (job.error == 2)
+        fprintf(stderr, "cerf-eval: cannot parse line \"%s\"\n", job.errline);
+    else if (job.error == 1)
+        fprintf(stderr, "cerf-eval: out of memory\n");
+    else if (job.error == 4)
+        fprintf(stderr, "cerf-eval: write error\n");
+    for (int k = 0; k < MAXPIECE; ++k)
+        free(job.out[k].buf);
+    return job.error != 0 || fflush(stdout) != 0;
+}
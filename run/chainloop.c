@@ -0,0 +1,103 @@
+/* Library libcerf:
+ *   Compute complex error functions, based on a new implementation of
+ *   Faddeeva's w_of_z. Also provide Dawson and Voigt functions.
+ *
+ * File chainloop.c:
+ *   Compute chains of dependent function values, to measure latency.
+ *
+ * Copyright:
+ *   (C) 2026 Forschungszentrum Jülich GmbH
+ *
+ * Licence:
+ *   Public domain.
+ *
+ * Website:
+ *   http://apps.jcns.fz-juelich.de/libcerf
+ */
+
+/*
+   Unlike bigloop, which measures throughput, this program makes the argument of each
+   function call depend on the result of the previous call. Out-of-order execution
+   cannot overlap successive calls, so that the time per call is the latency of one call.
+   Compare builds with and without CERF_ESTRIN.
+
+   Usage:
+       chainloop [number of calls per test, default 2^22]
+*/
+
+#include "cerf.h"
+#include "defs.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+enum { M = 64 }; // number of different arguments per test
+
+//! Returns the time per call in ns, for a chain of n calls of f cycling through x[0..M-1].
+static double chain_real(double (*f)(double), const double* x, long n, double* sink)
+{
+    double y = 0;
+    const clock_t t0 = clock();
+    for (long i = 0; i < n; ++i)
+        y = f(x[i % M] + 1e-300 * y); // the tiny increment makes the argument depend on y
+    const clock_t t1 = clock();
+    *sink += y;
+    return 1e9 * (double)(t1 - t0) / CLOCKS_PER_SEC / n;
+}
+
+static double chain_cmplx(const double* x, const double* y, long n, double* sink)
+{
+    _cerf_cmplx w = C(0, 0);
+    const clock_t t0 = clock();
+    for (long i = 0; i < n; ++i)
+        w = w_of_z(C(x[i % M] + 1e-300 * creal(w), y[i % M] + 1e-300 * cimag(w)));
+    const clock_t t1 = clock();
+    *sink += creal(w);
+    return 1e9 * (double)(t1 - t0) / CLOCKS_PER_SEC / n;
+}
+
+static void fill(double* x, double lo, double hi)
+{
+    for (int i = 0; i < M; ++i)
+        x[i] = lo + (hi - lo) * (i + .5) / M;
+}
+
+static void test_real(const char* name, double (*f)(double), double lo, double hi, long n,
+		      double* sink)
+{
+    double x[M];
+    fill(x, lo, hi);
+    printf("%-12s %8.3g .. %-8.3g %8.2f ns\n", name, lo, hi, chain_real(f, x, n, sink));
+}
+
+static void test_cmplx(const char* name, double xlo, double xhi, double ylo, double yhi, long n,
+		       double* sink)
+{
+    double x[M], y[M];
+    fill(x, xlo, xhi);
+    fill(y, ylo, yhi);
+    for (int i = 0; i < M; ++i) // decorrelate x and y
+	y[i] = y[(i * 37) % M];
+    printf("%-12s %8.3g .. %-8.3g %8.2f ns\n", name, xlo, xhi, chain_cmplx(x, y, n, sink));
+}
+
+int main(int argc, char** argv)
+{
+    const long n = argc > 1 ? atol(argv[1]) : 1L << 22;
+    double sink = 0;
+
+    printf("function     argument range       latency\n");
+    test_real("erfcx", erfcx, 0.01, 0.12, n, &sink); // Taylor series
+    test_real("erfcx", erfcx, 0.13, 12, n, &sink); // Chebyshev interpolants
+    test_real("erfcx", erfcx, -6, -0.13, n, &sink); // negative arguments
+    test_real("erfcx", erfcx, 60, 100, n, &sink); // asymptotic expansion
+    test_real("im_w_of_x", im_w_of_x, 0.1, 0.5, n, &sink); // Taylor series
+    test_real("im_w_of_x", im_w_of_x, 0.6, 11.9, n, &sink); // Chebyshev interpolants
+    test_real("im_w_of_x", im_w_of_x, 13, 100, n, &sink); // asymptotic expansion
+    test_real("dawson", dawson, -5, 5, n, &sink);
+    test_cmplx("w_of_z", -5, 5, 0.5, 5, n, &sink); // mostly Taylor tiles
+    test_cmplx("w_of_z", -0.1, 0.1, -0.1, 0.1, n, &sink); // Maclaurin series
+    test_cmplx("w_of_z", 10, 50, 1, 20, n, &sink); // asymptotic expansion
+
+    return sink == 42; // use sink, so that the compiler cannot drop the loops
+}
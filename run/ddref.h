@@ -0,0 +1,366 @@
+/* Library libcerf:
+ *   Compute complex error functions, based on a new implementation of
+ *   Faddeeva's w_of_z. Also provide Dawson and Voigt functions.
+ *
+ * File ddref.h:
+ *   Reference values of w(z), erfcx(x), im_w_of_x(x) in double-double arithmetic.
+ *
+ * Copyright:
+ *   (C) 2026 Forschungszentrum Jülich GmbH
+ *
+ * Licence:
+ *   Public domain.
+ *
+ * Website:
+ *   http://apps.jcns.fz-juelich.de/libcerf
+ */
+
+/*
+   A double-double number hi + lo carries about 106 bits. The reference functions are
+   accurate to a relative error of about 1e-28 (componentwise for w), which is ample
+   for measuring errors of double results in units of the last place (ulp),
+   and they are some 1000 times faster than the mpmath references in dev/.
+
+   Algorithm for w(z), with x >= 0, y >= 0 (other quadrants by symmetry):
+   - For |z| < 30, the trapezoidal rule for w(z) = (i/pi) int dt exp(-t^2) / (z - t),
+     with nodes t_n = x + (n+1/2) h, n integer, |t_n| < T, and with the pole correction
+     2 exp(-z^2) / (1 + exp(2 pi y / h)) for y < pi/h. The error is of order exp(-pi^2/h^2)
+     (Matta & Reichel 1971; Weideman & Trefethen 2014). As z lies midway between two nodes,
+     there is no near-singular term. Nodes at x +- s are combined in pairs, such that
+     Re w is a sum of positive terms, and Im w near the imaginary axis is obtained without
+     cancellation (from expm1 instead of a difference of exponentials).
+   - For |z| >= 30, the asymptotic expansion (i/sqrt(pi)/z) sum_k (2k-1)!!/(2z^2)^k.
+     The term exp(-z^2) beyond all orders is below the range of double.
+   - For y < 0, w(z) = 2 exp(-z^2) - w(-z); restricted to |2xy| < 2^30, else NaN.
+*/
+
+#ifndef DDREF_H
+#define DDREF_H
+
+#include <math.h>
+
+typedef struct {
+    double hi, lo;
+} dd_t;
+
+static inline dd_t dd_make(double hi, double lo)
+{
+    dd_t r;
+    r.hi = hi;
+    r.lo = lo;
+    return r;
+}
+
+static inline dd_t dd_two_sum(double a, double b)
+{
+    const double s = a + b;
+    const double v = s - a;
+    return dd_make(s, (a - (s - v)) + (b - v));
+}
+
+static inline dd_t dd_quick_two_sum(double a, double b)
+{
+    const double s = a + b;
+    return dd_make(s, b - (s - a));
+}
+
+static inline dd_t dd_two_prod(double a, double b)
+{
+    const double p = a * b;
+    return dd_make(p, fma(a, b, -p));
+}
+
+static inline dd_t dd_add(dd_t a, dd_t b)
+{
+    dd_t s = dd_two_sum(a.hi, b.hi);
+    const dd_t t = dd_two_sum(a.lo, b.lo);
+    s.lo += t.hi;
+    s = dd_quick_two_sum(s.hi, s.lo);
+    s.lo += t.lo;
+    return dd_quick_two_sum(s.hi, s.lo);
+}
+
+static inline dd_t dd_neg(dd_t a)
+{
+    return dd_make(-a.hi, -a.lo);
+}
+
+static inline dd_t dd_sub(dd_t a, dd_t b)
+{
+    return dd_add(a, dd_neg(b));
+}
+
+static inline dd_t dd_mul(dd_t a, dd_t b)
+{
+    dd_t p = dd_two_prod(a.hi, b.hi);
+    p.lo += a.hi * b.lo + a.lo * b.hi;
+    return dd_quick_two_sum(p.hi, p.lo);
+}
+
+static inline dd_t dd_mul_d(dd_t a, double b)
+{
+    dd_t p = dd_two_prod(a.hi, b);
+    p.lo += a.lo * b;
+    return dd_quick_two_sum(p.hi, p.lo);
+}
+
+static inline dd_t dd_div(dd_t a, dd_t b)
+{
+    const double q1 = a.hi / b.hi;
+    dd_t r = dd_sub(a, dd_mul_d(b, q1));
+    const double q2 = r.hi / b.hi;
+    r = dd_sub(r, dd_mul_d(b, q2));
+    const double q3 = r.hi / b.hi;
+    return dd_add(dd_quick_two_sum(q1, q2), dd_make(q3, 0));
+}
+
+static inline dd_t dd_div_d(dd_t a, double b)
+{
+    const double q1 = a.hi / b;
+    dd_t r = dd_sub(a, dd_two_prod(q1, b));
+    const double q2 = r.hi / b;
+    r = dd_sub(r, dd_two_prod(q2, b));
+    const double q3 = r.hi / b;
+    return dd_add(dd_quick_two_sum(q1, q2), dd_make(q3, 0));
+}
+
+static inline dd_t dd_ldexp(dd_t a, int k)
+{
+    return dd_make(ldexp(a.hi, k), ldexp(a.lo, k));
+}
+
+static const dd_t dd_ln2 = {0x1.62e42fefa39efp-1, 0x1.abc9e3b39803fp-56};
+static const dd_t dd_pi = {0x1.921fb54442d18p+1, 0x1.1a62633145c07p-53};
+static const dd_t dd_1_sqrtpi = {0x1.20dd750429b6dp-1, 0x1.1ae3a914fed80p-57};
+
+//! Returns exp(a) - 1 for |a| <= 1, by Taylor series.
+static inline dd_t dd_expm1_small(dd_t a)
+{
+    dd_t s = a, t = a;
+    for (int k = 2; k < 40; ++k) {
+        t = dd_div_d(dd_mul(t, a), k);
+        s = dd_add(s, t);
+        if (fabs(t.hi) <= 1e-34 * fabs(s.hi))
+            break;
+    }
+    return s;
+}
+
+static inline dd_t dd_exp(dd_t a)
+{
+    if (a.hi > 709.78)
+        return dd_make(INFINITY, 0);
+    if (a.hi < -745.2)
+        return dd_make(0, 0);
+    // a = k ln2 + r, then exp(r) = (1 + expm1(r/2^9))^(2^9).
+    const double k = nearbyint(a.hi / dd_ln2.hi);
+    const dd_t r = dd_ldexp(dd_sub(a, dd_mul_d(dd_ln2, k)), -9);
+    dd_t p = dd_expm1_small(r);
+    for (int i = 0; i < 9; ++i)
+        p = dd_add(dd_mul_d(p, 2), dd_mul(p, p)); // (1+p)^2 - 1
+    p = dd_add(dd_make(1, 0), p);
+    // Two steps of scaling, so that 2^k is representable even where exp(a) is subnormal.
+    const int k1 = (int)k / 2;
+    return dd_ldexp(dd_ldexp(p, k1), (int)k - k1);
+}
+
+//! Sets s = sin(a), c = cos(a), for |a| < 2^30.
+static inline void dd_sincos(dd_t a, dd_t* s, dd_t* c)
+{
+    // Reduce by pi/2, given as a sum of three doubles; products with k are exact.
+    static const double p0 = 0x1.921fb54442d18p+0, p1 = 0x1.1a62633145c07p-54,
+                        p2 = -0x1.f1976b7ed8fbcp-110;
+    const double k = nearbyint(a.hi * 0x1.45f306dc9c883p-1);
+    dd_t r = dd_sub(a, dd_two_prod(k, p0));
+    r = dd_sub(r, dd_two_prod(k, p1));
+    r = dd_sub(r, dd_make(k * p2, 0));
+    // Taylor series on |r| <= pi/4.
+    const dd_t r2 = dd_mul(r, r);
+    dd_t ss = r, cc = dd_make(1, 0), t = r, u = dd_make(1, 0);
+    for (int n = 1; n < 20; ++n) {
+        t = dd_div_d(dd_mul(t, r2), -(2. * n) * (2. * n + 1));
+        u = dd_div_d(dd_mul(u, r2), -(2. * n - 1) * (2. * n));
+        ss = dd_add(ss, t);
+        cc = dd_add(cc, u);
+        if (fabs(u.hi) <= 1e-34)
+            break;
+    }
+    switch (((long long)k) & 3) {
+    case 0:
+        *s = ss;
+        *c = cc;
+        break;
+    case 1:
+        *s = cc;
+        *c = dd_neg(ss);
+        break;
+    case 2:
+        *s = dd_neg(ss);
+        *c = dd_neg(cc);
+        break;
+    default:
+        *s = dd_neg(cc);
+        *c = ss;
+        break;
+    }
+}
+
+/******************************************************************************/
+/*  Reference functions                                                       */
+/******************************************************************************/
+
+//! Computes w(x+iy) for x >= 0, y >= 0.
+static inline void ddref_w_quadrant(double x, double y, dd_t* wr, dd_t* wi)
+{
+    if (x * x + y * y >= 900) {
+        // Asymptotic expansion in u = 1/z, computed by Smith's algorithm.
+        dd_t ur, ui;
+        if (x >= y) {
+            const dd_t q = dd_div(dd_make(y, 0), dd_make(x, 0));
+            const dd_t d = dd_add(dd_make(x, 0), dd_mul_d(q, y));
+            ur = dd_div(dd_make(1, 0), d);
+            ui = dd_neg(dd_div(q, d));
+        } else {
+            const dd_t q = dd_div(dd_make(x, 0), dd_make(y, 0));
+            const dd_t d = dd_add(dd_make(y, 0), dd_mul_d(q, x));
+            ur = dd_div(q, d);
+            ui = dd_neg(dd_div(dd_make(1, 0), d));
+        }
+        const dd_t u2r = dd_sub(dd_mul(ur, ur), dd_mul(ui, ui));
+        const dd_t u2i = dd_mul_d(dd_mul(ur, ui), 2);
+        dd_t sr = dd_make(1, 0), si = dd_make(0, 0), tr = sr, ti = si;
+        for (int k = 1; k < 100; ++k) {
+            const dd_t vr = dd_sub(dd_mul(tr, u2r), dd_mul(ti, u2i));
+            const dd_t vi = dd_add(dd_mul(tr, u2i), dd_mul(ti, u2r));
+            tr = dd_mul_d(vr, k - .5);
+            ti = dd_mul_d(vi, k - .5);
+            sr = dd_add(sr, tr);
+            si = dd_add(si, ti);
+            if (fabs(tr.hi) + fabs(ti.hi) < 1e-34 * (fabs(sr.hi) + fabs(si.hi)))
+                break;
+        }
+        // w = (i/sqrt(pi)) u s
+        const dd_t pr = dd_sub(dd_mul(ur, sr), dd_mul(ui, si));
+        const dd_t pi = dd_add(dd_mul(ur, si), dd_mul(ui, sr));
+        *wr = dd_neg(dd_mul(pi, dd_1_sqrtpi));
+        *wi = dd_mul(pr, dd_1_sqrtpi);
+        return;
+    }
+
+    // Trapezoidal rule.
+    const double h = .375; // exactly representable, so that the offsets (n+1/2)h are exact
+    const double T = 8.2; // exp(-T^2) < 1e-29
+    const dd_t y2 = dd_two_prod(y, y);
+
+    // Nodes t_n = x + s_n, s_n = (n+1/2) h, for nlo <= n <= nhi.
+    const long nlo = (long)ceil((-T - x) / h - .5);
+    const long nhi = (long)floor((T - x) / h - .5);
+    // E_n = exp(-t_n^2) is computed by recurrence from the node n0 closest to t = 0.
+    long n0 = (long)nearbyint(-x / h - .5);
+    n0 = n0 < nlo ? nlo : n0 > nhi ? nhi : n0;
+    const dd_t t0 = dd_two_sum(x, (n0 + .5) * h);
+    const dd_t E0 = dd_exp(dd_neg(dd_mul(t0, t0)));
+    const dd_t q = dd_exp(dd_make(-2 * h * h, 0));
+
+    // Exponentials at all nodes; at most 2T/h + 1 < 48 of them.
+    dd_t E[48];
+    E[n0 - nlo] = E0;
+    dd_t rho = dd_exp(dd_neg(dd_add(dd_mul_d(t0, 2 * h), dd_make(h * h, 0)))); // E_{n+1}/E_n
+    for (long n = n0; n < nhi; ++n) {
+        E[n + 1 - nlo] = dd_mul(E[n - nlo], rho);
+        rho = dd_mul(rho, q);
+    }
+    dd_t sig = dd_exp(dd_sub(dd_mul_d(t0, 2 * h), dd_make(h * h, 0))); // E_{n-1}/E_n
+    for (long n = n0; n > nlo; --n) {
+        E[n - 1 - nlo] = dd_mul(E[n - nlo], sig);
+        sig = dd_mul(sig, q);
+    }
+
+    // Sums of y E_n / (s_n^2 + y^2) and -s_n E_n / (s_n^2 + y^2).
+    dd_t sr = dd_make(0, 0), si = dd_make(0, 0);
+    for (long n = nlo; n <= nhi; ++n) {
+        const double s = (n + .5) * h;
+        const long m = -n - 1; // partner node at x - s
+        if (n < 0 && m <= nhi)
+            continue; // handled together with the partner
+        const dd_t d = dd_div(dd_make(1, 0), dd_add(dd_two_prod(s, s), y2));
+        if (m < nlo || m > nhi) {
+            sr = dd_add(sr, dd_mul(dd_mul_d(E[n - nlo], y), d));
+            si = dd_sub(si, dd_mul(dd_mul_d(E[n - nlo], s), d));
+            continue;
+        }
+        // Pair of nodes at x + s and x - s, s > 0.
+        const dd_t Ep = E[n - nlo], Em = E[m - nlo];
+        dd_t diff; // Em - Ep = Ep (exp(4 x s) - 1); direct difference loses at most 3 digits
+        if (4 * x * s < 1e-3)
+            diff = dd_mul(Ep, dd_expm1_small(dd_mul_d(dd_make(4 * s, 0), x)));
+        else
+            diff = dd_sub(Em, Ep);
+        sr = dd_add(sr, dd_mul(dd_mul_d(dd_add(Ep, Em), y), d));
+        si = dd_add(si, dd_mul(dd_mul_d(diff, s), d));
+    }
+    const dd_t f = dd_div(dd_make(h, 0), dd_pi);
+    sr = dd_mul(sr, f);
+    si = dd_mul(si, f);
+
+    // Pole correction 2 exp(-z^2) / (1 + exp(2 pi y / h)).
+    const dd_t a = dd_sub(y2, dd_two_prod(x, x));
+    const dd_t b = dd_div(dd_mul_d(dd_pi, 2 * y), dd_make(h, 0)); // 2 pi y / h
+    if (y < dd_pi.hi / h && a.hi - b.hi > -760) {
+        const dd_t g = dd_div(dd_mul_d(dd_exp(a), 2), dd_add(dd_make(1, 0), dd_exp(b)));
+        dd_t sn, cs;
+        dd_sincos(dd_mul_d(dd_two_prod(x, y), 2), &sn, &cs);
+        sr = dd_add(sr, dd_mul(g, cs));
+        si = dd_sub(si, dd_mul(g, sn));
+    }
+    *wr = sr;
+    *wi = si;
+}
+
+//! Computes w(x+iy) in double-double precision.
+static inline void ddref_w(double x, double y, dd_t* wr, dd_t* wi)
+{
+    if (y >= 0) {
+        ddref_w_quadrant(fabs(x), y, wr, wi);
+        if (x < 0)
+            *wi = dd_neg(*wi);
+        return;
+    }
+    // w(z) = 2 exp(-z^2) - w(-z)
+    if (fabs(2 * x * y) >= 0x1p30) {
+        *wr = *wi = dd_make(NAN, 0);
+        return;
+    }
+    dd_t vr, vi;
+    ddref_w(-x, -y, &vr, &vi);
+    const dd_t a = dd_sub(dd_two_prod(y, y), dd_two_prod(x, x));
+    const dd_t g = dd_mul_d(dd_exp(a), 2);
+    dd_t sn, cs;
+    dd_sincos(dd_mul_d(dd_two_prod(x, y), 2), &sn, &cs);
+    *wr = dd_sub(dd_mul(g, cs), vr);
+    *wi = dd_sub(dd_neg(dd_mul(g, sn)), vi);
+}
+
+//! Returns erfcx(x) = exp(x^2) erfc(x) = Re w(ix) in double-double precision.
+static inline dd_t ddref_erfcx(double x)
+{
+    dd_t wr, wi;
+    ddref_w_quadrant(0, fabs(x), &wr, &wi);
+    if (x >= 0)
+        return wr;
+    // erfcx(x) = 2 exp(x^2) - erfcx(-x)
+    const dd_t e = dd_exp(dd_two_prod(x, x));
+    if (isinf(e.hi))
+        return e;
+    return dd_sub(dd_mul_d(e, 2), wr);
+}
+
+//! Returns im_w_of_x(x) = Im w(x) = 2 dawson(x) / sqrt(pi) in double-double precision.
+static inline dd_t ddref_im_w_of_x(double x)
+{
+    dd_t wr, wi;
+    ddref_w_quadrant(fabs(x), 0, &wr, &wi);
+    return x >= 0 ? wi : dd_neg(wi);
+}
+
+#endif // DDREF_H
@@ -0,0 +1,321 @@
+/* Library libcerf:
+ *   Compute complex error functions, based on a new implementation of
+ *   Faddeeva's w_of_z. Also provide Dawson and Voigt functions.
+ *
+ * File dtoa.h:
+ *   Fast conversion of doubles to the shortest decimal text that reads back exactly.
+ *
+ * Copyright:
+ *   (C) 2026 Forschungszentrum Jülich GmbH
+ *
+ * Licence:
+ *   Public domain.
+ *
+ * Website:
+ *   http://apps.jcns.fz-juelich.de/libcerf
+ */
+
+/*
+   dtoa_shortest(v, buf) writes the shortest decimal number that converts back to v,
+   and among these the closest to v, as Python's repr does. Digits are generated by
+   Loitsch's Grisu3 algorithm (F. Loitsch, Printing floating-point numbers quickly and
+   accurately with integers, PLDI 2010), with 64-bit integer arithmetic only. For the
+   about 0.5% of numbers where Grisu3 cannot decide, the digits are obtained from snprintf
+   with increasing precision, checked by strtod.
+
+   Numbers with decimal exponent in [-5, 17) are written in positional notation
+   (0.00125, 42, 1234.5), others in scientific notation (1e-07, 6.02214076e+23).
+   Special values are written as inf, -inf, nan.
+*/
+
+#ifndef DTOA_H
+#define DTOA_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+enum { DTOA_BUFSIZE = 32 }; // enough for any output, including the terminating 0
+
+typedef struct {
+    uint64_t f;
+    int e;
+} dtoa_fp; // f * 2^e
+
+typedef struct {
+    uint64_t f;
+    int e, k; // 10^k = f * 2^e, rounded
+} dtoa_power;
+
+// Powers of ten 10^k for k = -348, -340, ..., 340, with normalized 64-bit significand.
+static const dtoa_power dtoa_powers[87] = {
+    {0xfa8fd5a0081c0288ULL, -1220, -348}, {0xbaaee17fa23ebf76ULL, -1193, -340},
+    {0x8b16fb203055ac76ULL, -1166, -332}, {0xcf42894a5dce35eaULL, -1140, -324},
+    {0x9a6bb0aa55653b2dULL, -1113, -316}, {0xe61acf033d1a45dfULL, -1087, -308},
+    {0xab70fe17c79ac6caULL, -1060, -300}, {0xff77b1fcbebcdc4fULL, -1034, -292},
+    {0xbe5691ef416bd60cULL, -1007, -284}, {0x8dd01fad907ffc3cULL, -980, -276},
+    {0xd3515c2831559a83ULL, -954, -268}, {0x9d71ac8fada6c9b5ULL, -927, -260},
+    {0xea9c227723ee8bcbULL, -901, -252}, {0xaecc49914078536dULL, -874, -244},
+    {0x823c12795db6ce57ULL, -847, -236}, {0xc21094364dfb5637ULL, -821, -228},
+    {0x9096ea6f3848984fULL, -794, -220}, {0xd77485cb25823ac7ULL, -768, -212},
+    {0xa086cfcd97bf97f4ULL, -741, -204}, {0xef340a98172aace5ULL, -715, -196},
+    {0xb23867fb2a35b28eULL, -688, -188}, {0x84c8d4dfd2c63f3bULL, -661, -180},
+    {0xc5dd44271ad3cdbaULL, -635, -172}, {0x936b9fcebb25c996ULL, -608, -164},
+    {0xdbac6c247d62a584ULL, -582, -156}, {0xa3ab66580d5fdaf6ULL, -555, -148},
+    {0xf3e2f893dec3f126ULL, -529, -140}, {0xb5b5ada8aaff80b8ULL, -502, -132},
+    {0x87625f056c7c4a8bULL, -475, -124}, {0xc9bcff6034c13053ULL, -449, -116},
+    {0x964e858c91ba2655ULL, -422, -108}, {0xdff9772470297ebdULL, -396, -100},
+    {0xa6dfbd9fb8e5b88fULL, -369, -92}, {0xf8a95fcf88747d94ULL, -343, -84},
+    {0xb94470938fa89bcfULL, -316, -76}, {0x8a08f0f8bf0f156bULL, -289, -68},
+    {0xcdb02555653131b6ULL, -263, -60}, {0x993fe2c6d07b7facULL, -236, -52},
+    {0xe45c10c42a2b3b06ULL, -210, -44}, {0xaa242499697392d3ULL, -183, -36},
+    {0xfd87b5f28300ca0eULL, -157, -28}, {0xbce5086492111aebULL, -130, -20},
+    {0x8cbccc096f5088ccULL, -103, -12}, {0xd1b71758e219652cULL, -77, -4},
+    {0x9c40000000000000ULL, -50, 4}, {0xe8d4a51000000000ULL, -24, 12},
+    {0xad78ebc5ac620000ULL, 3, 20}, {0x813f3978f8940984ULL, 30, 28},
+    {0xc097ce7bc90715b3ULL, 56, 36}, {0x8f7e32ce7bea5c70ULL, 83, 44},
+    {0xd5d238a4abe98068ULL, 109, 52}, {0x9f4f2726179a2245ULL, 136, 60},
+    {0xed63a231d4c4fb27ULL, 162, 68}, {0xb0de65388cc8ada8ULL, 189, 76},
+    {0x83c7088e1aab65dbULL, 216, 84}, {0xc45d1df942711d9aULL, 242, 92},
+    {0x924d692ca61be758ULL, 269, 100}, {0xda01ee641a708deaULL, 295, 108},
+    {0xa26da3999aef774aULL, 322, 116}, {0xf209787bb47d6b85ULL, 348, 124},
+    {0xb454e4a179dd1877ULL, 375, 132}, {0x865b86925b9bc5c2ULL, 402, 140},
+    {0xc83553c5c8965d3dULL, 428, 148}, {0x952ab45cfa97a0b3ULL, 455, 156},
+    {0xde469fbd99a05fe3ULL, 481, 164}, {0xa59bc234db398c25ULL, 508, 172},
+    {0xf6c69a72a3989f5cULL, 534, 180}, {0xb7dcbf5354e9beceULL, 561, 188},
+    {0x88fcf317f22241e2ULL, 588, 196}, {0xcc20ce9bd35c78a5ULL, 614, 204},
+    {0x98165af37b2153dfULL, 641, 212}, {0xe2a0b5dc971f303aULL, 667, 220},
+    {0xa8d9d1535ce3b396ULL, 694, 228}, {0xfb9b7cd9a4a7443cULL, 720, 236},
+    {0xbb764c4ca7a44410ULL, 747, 244}, {0x8bab8eefb6409c1aULL, 774, 252},
+    {0xd01fef10a657842cULL, 800, 260}, {0x9b10a4e5e9913129ULL, 827, 268},
+    {0xe7109bfba19c0c9dULL, 853, 276}, {0xac2820d9623bf429ULL, 880, 284},
+    {0x80444b5e7aa7cf85ULL, 907, 292}, {0xbf21e44003acdd2dULL, 933, 300},
+    {0x8e679c2f5e44ff8fULL, 960, 308}, {0xd433179d9c8cb841ULL, 986, 316},
+    {0x9e19db92b4e31ba9ULL, 1013, 324}, {0xeb96bf6ebadf77d9ULL, 1039, 332},
+    {0xaf87023b9bf0ee6bULL, 1066, 340},
+};
+
+//! Returns the upper 64 bits of the 128-bit product, rounded.
+static inline dtoa_fp dtoa_mul(dtoa_fp x, dtoa_fp y)
+{
+    const uint64_t M32 = 0xffffffffUL;
+    const uint64_t a = x.f >> 32, b = x.f & M32, c = y.f >> 32, d = y.f & M32;
+    const uint64_t ac = a * c, bc = b * c, ad = a * d, bd = b * d;
+    const uint64_t tmp = (bd >> 32) + (ad & M32) + (bc & M32) + (UINT64_C(1) << 31);
+    dtoa_fp r;
+    r.f = ac + (ad >> 32) + (bc >> 32) + (tmp >> 32);
+    r.e = x.e + y.e + 64;
+    return r;
+}
+
+static inline dtoa_fp dtoa_normalize(dtoa_fp x)
+{
+    while (!(x.f & (UINT64_C(1) << 63))) {
+        x.f <<= 1;
+        x.e--;
+    }
+    return x;
+}
+
+//! Adjusts the last digit towards w, and returns 1 if the result is known to be correct.
+static inline int dtoa_round_weed(char* buf, int len, uint64_t dist_high_w, uint64_t unsafe,
+                                  uint64_t rest, uint64_t ten_kappa, uint64_t unit)
+{
+    const uint64_t small_dist = dist_high_w - unit;
+    const uint64_t big_dist = dist_high_w + unit;
+    while (rest < small_dist && unsafe - rest >= ten_kappa
+           && (rest + ten_kappa < small_dist
+               || small_dist - rest >= rest + ten_kappa - small_dist)) {
+        buf[len - 1]--;
+        rest += ten_kappa;
+    }
+    if (rest < big_dist && unsafe - rest >= ten_kappa
+        && (rest + ten_kappa < big_dist || big_dist - rest > rest + ten_kappa - big_dist))
+        return 0;
+    return 2 * unit <= rest && rest <= unsafe - 4 * unit;
+}
+
+//! Generates the shortest digits of w in (low, high). Returns 0 if undecided.
+static inline int dtoa_digit_gen(dtoa_fp low, dtoa_fp w, dtoa_fp high, char* buf, int* len,
+                                 int* kappa)
+{
+    uint64_t unit = 1;
+    const uint64_t too_low = low.f - unit;
+    const uint64_t too_high = high.f + unit;
+    uint64_t unsafe = too_high - too_low;
+    const int shift = -w.e;
+    const uint64_t one = UINT64_C(1) << shift;
+    uint32_t integrals = (uint32_t)(too_high >> shift);
+    uint64_t fractionals = too_high & (one - 1);
+    uint32_t divisor = 1;
+    int k = 1;
+    while (k < 10 && divisor * 10 <= integrals) {
+        divisor *= 10;
+        ++k;
+    }
+    if (integrals < divisor) // integrals == 0
+        k = 0, divisor = 0;
+    *kappa = k;
+    *len = 0;
+    while (*kappa > 0) {
+        buf[(*len)++] = (char)('0' + integrals / divisor);
+        integrals %= divisor;
+        (*kappa)--;
+        const uint64_t rest = ((uint64_t)integrals << shift) + fractionals;
+        if (rest < unsafe)
+            return dtoa_round_weed(buf, *len, too_high - w.f, unsafe, rest,
+                                   (uint64_t)divisor << shift, unit);
+        divisor /= 10;
+    }
+    for (;;) {
+        fractionals *= 10;
+        unit *= 10;
+        unsafe *= 10;
+        buf[(*len)++] = (char)('0' + (fractionals >> shift));
+        fractionals &= one - 1;
+        (*kappa)--;
+        if (fractionals < unsafe)
+            return dtoa_round_weed(buf, *len, (too_high - w.f) * unit, unsafe, fractionals, one,
+                                   unit);
+    }
+}
+
+//! Sets the shortest digits of v > 0 (finite), and the decimal exponent of the last digit.
+static inline void dtoa_digits(double v, char* buf, int* len, int* dexp)
+{
+    uint64_t u;
+    memcpy(&u, &v, 8);
+    const uint64_t frac = u & ((UINT64_C(1) << 52) - 1);
+    const int bexp = (int)(u >> 52) & 0x7ff;
+    dtoa_fp w;
+    if (bexp) {
+        w.f = frac | (UINT64_C(1) << 52);
+        w.e = bexp - 1075;
+    } else {
+        w.f = frac;
+        w.e = -1074;
+    }
+    // Boundaries half-way to the neighbours; the lower one is closer at a power of two.
+    dtoa_fp plus = {(w.f << 1) + 1, w.e - 1};
+    plus = dtoa_normalize(plus);
+    dtoa_fp minus;
+    if (frac == 0 && bexp > 1) {
+        minus.f = (w.f << 2) - 1;
+        minus.e = w.e - 2;
+    } else {
+        minus.f = (w.f << 1) - 1;
+        minus.e = w.e - 1;
+    }
+    minus.f <<= minus.e - plus.e;
+    minus.e = plus.e;
+    w = dtoa_normalize(w);
+
+    // Scale by a cached power of ten, such that the binary exponent is in [-60, -32].
+    const int min_exp = -60 - (w.e + 64);
+    const double dk = (min_exp + 63) * 0.30102999566398114;
+    int k = (int)dk;
+    if (k < dk)
+        ++k;
+    const dtoa_power* c = &dtoa_powers[(348 + k - 1) / 8 + 1];
+    const dtoa_fp cp = {c->f, c->e};
+    const dtoa_fp sw = dtoa_mul(w, cp);
+    const dtoa_fp sminus = dtoa_mul(minus, cp);
+    const dtoa_fp splus = dtoa_mul(plus, cp);
+    int kappa;
+    if (dtoa_digit_gen(sminus, sw, splus, buf, len, &kappa)) {
+        *dexp = kappa - c->k;
+        return;
+    }
+
+    // Fallback: the shortest correctly rounded representation that reads back exactly.
+    // If p digits read back exactly, so do p+1 digits; therefore bisect, starting at 16.
+    char tmp[DTOA_BUFSIZE];
+    int lo = 1, hi = 17;
+    snprintf(tmp, sizeof(tmp), "%.15e", v);
+    if (strtod(tmp, NULL) == v)
+        hi = 16;
+    else
+        lo = 17;
+    while (lo < hi) {
+        const int mid = (lo + hi) / 2;
+        snprintf(tmp, sizeof(tmp), "%.*e", mid - 1, v);
+        if (strtod(tmp, NULL) == v)
+            hi = mid;
+        else
+            lo = mid + 1;
+    }
+    snprintf(tmp, sizeof(tmp), "%.*e", lo - 1, v);
+    *len = 0;
+    const char* s = tmp;
+    for (; *s != 'e'; ++s)
+        if (*s != '.')
+            buf[(*len)++] = *s;
+    *dexp = atoi(s + 1) - (*len - 1);
+}
+
+//! Writes the shortest text for v to out (at least DTOA_BUFSIZE bytes), returns its length.
+static inline int dtoa_shortest(double v, char* out)
+{
+    char* p = out;
+    if (v != v) {
+        memcpy(out, "nan", 4);
+        return 3;
+    }
+    if (v < 0 || (v == 0 && 1 / v < 0)) {
+        *p++ = '-';
+        v = -v;
+    }
+    if (v == 0) {
+        *p++ = '0';
+        *p = 0;
+        return (int)(p - out);
+    }
+    if (v > 1.7976931348623157e308) {
+        memcpy(p, "inf", 4);
+        return (int)(p - out) + 3;
+    }
+    char d[20];
+    int n, dexp;
+    dtoa_digits(v, d, &n, &dexp);
+    const int x = dexp + n - 1; // decimal exponent of the first digit
+    if (x >= -5 && x < 17) {
+        if (x < 0) {
+            *p++ = '0';
+            *p++ = '.';
+            for (int i = -1; i > x; --i)
+                *p++ = '0';
+            memcpy(p, d, n);
+            p += n;
+        } else if (n <= x + 1) {
+            memcpy(p, d, n);
+            p += n;
+            for (int i = n; i <= x; ++i)
+                *p++ = '0';
+        } else {
+            memcpy(p, d, x + 1);
+            p += x + 1;
+            *p++ = '.';
+            memcpy(p, d + x + 1, n - x - 1);
+            p += n - x - 1;
+        }
+    } else {
+        *p++ = d[0];
+        if (n > 1) {
+            *p++ = '.';
+            memcpy(p, d + 1, n - 1);
+            p += n - 1;
+        }
+        *p++ = 'e';
+        *p++ = x < 0 ? '-' : '+';
+        const int ax = x < 0 ? -x : x;
+        if (ax >= 100)
+            *p++ = (char)('0' + ax / 100);
+        *p++ = (char)('0' + ax / 10 % 10);
+        *p++ = (char)('0' + ax % 10);
+    }
+    *p = 0;
+    return (int)(p - out);
+}
+
+#endif // DTOA_H
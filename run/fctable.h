@@ -0,0 +1,163 @@
+/* Library libcerf:
+ *   Compute complex error functions, based on a new implementation of
+ *   Faddeeva's w_of_z. Also provide Dawson and Voigt functions.
+ *
+ * File fctable.h:
+ *   Table of library functions, callable by name for many arguments at once.
+ *
+ * Copyright:
+ *   (C) 2026 Forschungszentrum Jülich GmbH
+ *
+ * Licence:
+ *   Public domain.
+ *
+ * Website:
+ *   http://apps.jcns.fz-juelich.de/libcerf
+ */
+
+/*
+   Each function takes nin real arguments per point (two for a complex argument) and
+   returns nout real values (two for a complex value). Arguments and values are passed
+   as columns, i.e. in separate arrays. Where the library has an array version
+   (erfcx_array, w_of_z_array, ...), it is used; otherwise the scalar function is called
+   in a loop.
+*/
+
+#ifndef FCTABLE_H
+#define FCTABLE_H
+
+#include "cerf.h"
+#include "defs.h"
+#include <stdio.h>
+#include <string.h>
+
+typedef struct {
+    const char* name;
+    int nin, nout;
+    void (*array)(size_t n, const double* x, double* r); // real array function, or NULL
+    double (*real)(double x);                           // real scalar function, or NULL
+    _cerf_cmplx (*cmplx)(_cerf_cmplx z);                // complex scalar function, or NULL
+    //! Any other function, with arguments a[0..nin-1] and results r[0..nout-1].
+    void (*kernel)(size_t n, const double* const* a, double* const* r);
+    const char* args;
+} fct_t;
+
+static void fct_w_of_z(size_t n, const double* const* a, double* const* r)
+{
+    w_of_z_array(n, a[0], a[1], r[0], r[1], CERF_W_DEFAULT);
+}
+
+static void fct_w_of_z_rational(size_t n, const double* const* a, double* const* r)
+{
+    w_of_z_array(n, a[0], a[1], r[0], r[1], CERF_W_RATIONAL);
+}
+
+static void fct_re_w_of_z(size_t n, const double* const* a, double* const* r)
+{
+    for (size_t i = 0; i < n; ++i)
+        r[0][i] = re_w_of_z(a[0][i], a[1][i]);
+}
+
+static void fct_im_w_of_z(size_t n, const double* const* a, double* const* r)
+{
+    for (size_t i = 0; i < n; ++i)
+        r[0][i] = im_w_of_z(a[0][i], a[1][i]);
+}
+
+static void fct_plasma_z_zprime(size_t n, const double* const* a, double* const* r)
+{
+    plasma_z_zprime_array(n, a[0], a[1], r[0], r[1], r[2], r[3]);
+}
+
+static void fct_voigt(size_t n, const double* const* a, double* const* r)
+{
+    for (size_t i = 0; i < n; ++i)
+        r[0][i] = voigt(a[0][i], a[1][i], a[2][i]);
+}
+
+static void fct_voigt_hwhm(size_t n, const double* const* a, double* const* r)
+{
+    for (size_t i = 0; i < n; ++i)
+        r[0][i] = voigt_hwhm(a[0][i], a[1][i]);
+}
+
+static void fct_emg(size_t n, const double* const* a, double* const* r)
+{
+    for (size_t i = 0; i < n; ++i)
+        r[0][i] = emg(a[0][i], a[1][i], a[2][i], a[3][i]);
+}
+
+static const fct_t fct_table[] = {
+    // complex functions of complex argument
+    {"w_of_z", 2, 2, NULL, NULL, NULL, fct_w_of_z, "x y"},
+    {"w_of_z_rational", 2, 2, NULL, NULL, NULL, fct_w_of_z_rational, "x y"},
+    {"cerf", 2, 2, NULL, NULL, cerf, NULL, "x y"},
+    {"cerfc", 2, 2, NULL, NULL, cerfc, NULL, "x y"},
+    {"cerfcx", 2, 2, NULL, NULL, cerfcx, NULL, "x y"},
+    {"cerfi", 2, 2, NULL, NULL, cerfi, NULL, "x y"},
+    {"cdawson", 2, 2, NULL, NULL, cdawson, NULL, "x y"},
+    {"plasma_z", 2, 2, NULL, NULL, plasma_z, NULL, "x y"},
+    {"plasma_zprime", 2, 2, NULL, NULL, plasma_zprime, NULL, "x y"},
+    {"plasma_z_zprime", 2, 4, NULL, NULL, NULL, fct_plasma_z_zprime, "x y"},
+    // real functions of complex argument
+    {"re_w_of_z", 2, 1, NULL, NULL, NULL, fct_re_w_of_z, "x y"},
+    {"im_w_of_z", 2, 1, NULL, NULL, NULL, fct_im_w_of_z, "x y"},
+    // real functions of real argument
+    {"im_w_of_x", 1, 1, NULL, im_w_of_x, NULL, NULL, "x"},
+    {"erf", 1, 1, erf_real_array, NULL, NULL, NULL, "x"},
+    {"erfc", 1, 1, erfc_real_array, NULL, NULL, NULL, "x"},
+    {"erfcx", 1, 1, erfcx_array, NULL, NULL, NULL, "x"},
+    {"erfi", 1, 1, NULL, erfi, NULL, NULL, "x"},
+    {"dawson", 1, 1, NULL, dawson, NULL, NULL, "x"},
+    {"log_erfc", 1, 1, log_erfc_array, NULL, NULL, NULL, "x"},
+    {"log_ndtr", 1, 1, log_ndtr_array, NULL, NULL, NULL, "x"},
+    {"erfcx_inv", 1, 1, erfcx_inv_array, NULL, NULL, NULL, "y"},
+    {"erfc_inv", 1, 1, erfc_inv_array, NULL, NULL, NULL, "y"},
+    {"erf_inv", 1, 1, erf_inv_array, NULL, NULL, NULL, "y"},
+    {"mills_ratio", 1, 1, mills_ratio_array, NULL, NULL, NULL, "x"},
+    {"inv_mills_ratio", 1, 1, inv_mills_ratio_array, NULL, NULL, NULL, "x"},
+    {"normal_tail", 1, 1, normal_tail_array, NULL, NULL, NULL, "x"},
+    // real functions of several real arguments
+    {"voigt", 3, 1, NULL, NULL, NULL, fct_voigt, "x sigma gamma"},
+    {"voigt_hwhm", 2, 1, NULL, NULL, NULL, fct_voigt_hwhm, "sigma gamma"},
+    {"emg", 4, 1, NULL, NULL, NULL, fct_emg, "x mu sigma tau"},
+};
+enum { NFCT = sizeof(fct_table) / sizeof(fct_table[0]) };
+
+//! Returns the function with given name, or NULL.
+static inline const fct_t* fct_find(const char* name)
+{
+    for (int i = 0; i < NFCT; ++i)
+        if (!strcmp(fct_table[i].name, name))
+            return &fct_table[i];
+    return NULL;
+}
+
+//! Prints names and arguments of all functions.
+static inline void fct_list(FILE* f)
+{
+    for (int i = 0; i < NFCT; ++i)
+        fprintf(f, "  %-16s %-15s -> %i value%s\n", fct_table[i].name, fct_table[i].args,
+                fct_table[i].nout, fct_table[i].nout > 1 ? "s" : "");
+}
+
+//! Computes r[0..nout-1][i] = f(a[0..nin-1][i]) for i < n.
+static inline void fct_eval(const fct_t* f, size_t n, const double* const* a, double* const* r)
+{
+    if (f->array) {
+        f->array(n, a[0], r[0]);
+    } else if (f->real) {
+        for (size_t i = 0; i < n; ++i)
+            r[0][i] = f->real(a[0][i]);
+    } else if (f->cmplx) {
+        for (size_t i = 0; i < n; ++i) {
+            const _cerf_cmplx w = f->cmplx(C(a[0][i], a[1][i]));
+            r[0][i] = creal(w);
+            r[1][i] = cimag(w);
+        }
+    } else {
+        f->kernel(n, a, r);
+    }
+}
+
+#endif // FCTABLE_H
@@ -0,0 +1,846 @@
+/* Library libcerf:
+ *   Compute complex error functions, based on a new implementation of
+ *   Faddeeva's w_of_z. Also provide Dawson and Voigt functions.
+ *
+ * File golden.c:
+ *   Generate binary corpora of golden values of erfcx, im_w_of_x and w_of_z,
+ *   and verify the library against them, with several threads.
+ *
+ * Copyright:
+ *   (C) 2026 Forschungszentrum Jülich GmbH
+ *
+ * Licence:
+ *   Public domain.
+ *
+ * Website:
+ *   http://apps.jcns.fz-juelich.de/libcerf
+ */
+
+/*
+   A corpus file <dir>/<corpus>.golden consists of a 64-byte header and of one record per
+   point, containing the argument (x, or x and y) and the reference value in double-double
+   precision (hi and lo, for the real and the imaginary part), computed by ddref.h.
+   Files are memory mapped, or read entirely under Windows.
+
+   Arguments are determined bit by bit from their index, without calls to libm, and are
+   therefore the same on all platforms; the hash of all arguments of each corpus is frozen
+   below. Reference values are computed with IEEE operations, fma, ldexp and nearbyint only;
+   their hash is compared with the frozen one as well, but a difference is only reported,
+   since it may be caused by the compiler contracting a*b+c into fma.
+
+   Real arguments: 64 ulp-neighbours on either side of each point where the algorithm
+   changes, the rest with random sign and random binary exponent, mostly in [-30, 9].
+   Complex arguments: random signs, |z| with random binary exponent, mostly in [-27, 27];
+   half of the points with |y/x| in (1/8, 8), the others close to the real or the imaginary
+   axis, where one of the components of w is small.
+
+   The verifier computes componentwise errors in ulp, and the normwise relative error
+   |f-w|/|w| in units of u = 2^-53. Points are grouped in regions: if the library is built with
+   CERF_INTROSPECT, by the algorithm code cerf_algorithm returned by the scalar function;
+   otherwise by decade of |x| or |z|, and by sign of x or by closeness to an axis.
+   For each region and for all points, maximum and mean error and histograms are reported.
+   The return code is 1 if the normwise error exceeds the limit given for the function,
+   for |x| or |z| up to a given bound, and for z in the upper half plane; for erfcx, a separate
+   limit applies to x < -20. Limits are set to the present state of the library.
+   The lower half plane is only reported: there, w(z) is computed as 2 exp(-z^2) - w(-z),
+   and its error is dominated by the condition of exp(-z^2).
+
+   The comparison mode checks that array and scalar entry points agree, bitwise unless
+   a tolerance in ulp is given for the function (the rational engine is only reported).
+
+   Usage:
+       golden gen <corpus|all> <dir> [threads]
+       golden verify <function> <dir> [threads]
+       golden compare <function> <dir> [threads]
+       golden list
+*/
+
+#include "cerf.h"
+#include "ddref.h"
+#include "defs.h"
+#include "parallel.h"
+#include "ulpstats.h"
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef CERF_INTROSPECT
+IMPORT extern int cerf_algorithm;
+IMPORT extern int cerf_nofterms;
+#endif
+
+static double sink = 0; // prevents the compiler from optimizing away probe calls
+
+/******************************************************************************/
+/*  Arguments                                                                 */
+/******************************************************************************/
+
+static uint64_t splitmix64(uint64_t z)
+{
+    z += 0x9e3779b97f4a7c15UL;
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9UL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebUL;
+    return z ^ (z >> 31);
+}
+
+//! Returns 64 pseudo-random bits, determined by index i and stream k.
+static uint64_t bits(long i, int k)
+{
+    return splitmix64(8 * (uint64_t)i + k);
+}
+
+//! Returns a number in [2^e, 2^(e+1)) with random mantissa from r.
+static double random_binade(uint64_t r, int e)
+{
+    return ldexp(1 + (double)(r >> 12) * 0x1p-52, e);
+}
+
+//! Returns the k-th floating-point neighbour of s (k < 0: towards zero, for s != 0).
+static double ulp_neighbour(double s, int k)
+{
+    if (s == 0)
+        return k * 0x1p-1074;
+    uint64_t u;
+    memcpy(&u, &s, 8);
+    u += (int64_t)k;
+    double x;
+    memcpy(&x, &u, 8);
+    return x;
+}
+
+enum { NNEIGHBOUR = 64 }; // ulp-neighbours on either side of each switch point
+
+// Points where the algorithm of erfcx or im_w_of_x changes: the branch thresholds of
+// cerf_inline_erfcx and cerf_inline_im_w_of_x in lib/cerf_inline.h, which are called by
+// lib/erfcx.c and lib/im_w_of_x.c. The thresholds of im_w_of_x apply to |x|.
+static const double erfcx_switch[] = {-26.7, -6.1, -.125, .125, 12, 23.2, 150, 6.9e7};
+static const double im_w_switch[] = {.003, .083, .272, .51, 12, 23.2, 150, 6.9e7};
+enum {
+    NERFCX_SWITCH = sizeof(erfcx_switch) / sizeof(erfcx_switch[0]),
+    NIM_W_SWITCH = sizeof(im_w_switch) / sizeof(im_w_switch[0])
+};
+
+static double real_argument(long i, const double* sw, int nsw, int symmetric)
+{
+    const long nspecial = (long)nsw * 2 * NNEIGHBOUR * (symmetric ? 2 : 1);
+    if (i < nspecial) {
+        const int k = (int)(i % (2 * NNEIGHBOUR)) - NNEIGHBOUR;
+        const long j = i / (2 * NNEIGHBOUR);
+        const double x = ulp_neighbour(sw[j % nsw], k);
+        return j >= nsw ? -x : x;
+    }
+    const uint64_t r = bits(i, 0);
+    const uint64_t s = bits(i, 1);
+    const int e = (s & 7) ? -30 + (int)((s >> 8) % 40) : -1074 + (int)((s >> 8) % 2098);
+    const double x = random_binade(r, e);
+    return (s >> 3) & 1 ? -x : x;
+}
+
+static void argument_erfcx(long i, double* x, double* y)
+{
+    *x = real_argument(i, erfcx_switch, NERFCX_SWITCH, 0);
+    *y = 0;
+}
+
+static void argument_im_w(long i, double* x, double* y)
+{
+    *x = real_argument(i, im_w_switch, NIM_W_SWITCH, 1);
+    *y = 0;
+}
+
+static void argument_w(long i, double* x, double* y)
+{
+    const uint64_t s = bits(i, 0);
+    const int e = (s & 15) ? -27 + (int)((s >> 8) % 54) : -1022 + (int)((s >> 8) % 2046);
+    const double a = random_binade(bits(i, 1), e);
+    double b;
+    switch ((s >> 4) & 3) {
+    case 0:
+    case 1: // generic
+        b = random_binade(bits(i, 2), e + (int)((s >> 32) % 5) - 2);
+        break;
+    default: { // close to an axis; exactly on the axis if k = 63
+        const int k = 3 + (int)((s >> 32) % 61);
+        b = k == 63 ? 0 : a * ldexp(1 + (double)(bits(i, 2) >> 12) * 0x1p-52, -k);
+    }
+    }
+    const int near_imag = ((s >> 4) & 3) == 3;
+    *x = near_imag ? b : a;
+    *y = near_imag ? a : b;
+    if ((s >> 6) & 1)
+        *x = -*x;
+    if ((s >> 7) & 1)
+        *y = -*y;
+}
+
+/******************************************************************************/
+/*  Corpora                                                                   */
+/******************************************************************************/
+
+typedef struct {
+    char magic[8];      // "libcerfG"
+    uint32_t version;   // GoldenVersion
+    uint32_t byteorder; // 0x01020304, to detect files written on other architectures
+    char corpus[16];    // name of the corpus, zero-padded
+    int32_t nargs;      // 1 (x) or 2 (x, y)
+    int32_t nvalues;    // 1 (real) or 2 (complex) values, each stored as hi and lo
+    int64_t count;      // number of records
+    uint64_t arghash;   // FNV-1a hash of all arguments
+    uint64_t valhash;   // FNV-1a hash of all reference values
+} golden_header;
+
+static const char GoldenMagic[8] = {'l', 'i', 'b', 'c', 'e', 'r', 'f', 'G'};
+static const uint32_t GoldenVersion = 1;
+static const uint32_t GoldenByteOrder = 0x01020304;
+
+typedef struct {
+    const char* name;
+    int complex_arg;
+    long count;
+    uint64_t arghash, valhash; // frozen hashes
+    void (*argument)(long i, double* x, double* y);
+    //! Calls the scalar function, for setting cerf_algorithm.
+    void (*probe)(double x, double y);
+} corpus_t;
+
+static void probe_erfcx(double x, double y)
+{
+    (void)y;
+    sink += erfcx(x);
+}
+
+static void probe_im_w(double x, double y)
+{
+    (void)y;
+    sink += im_w_of_x(x);
+}
+
+static void probe_w(double x, double y)
+{
+    sink += creal(w_of_z(C(x, y)));
+}
+
+static const corpus_t corpora[] = {
+    {"erfcx", 0, 1L << 20, 0x7f67b4407e70291dUL, 0x464e3997756a5a2aUL, argument_erfcx,
+     probe_erfcx},
+    {"im_w_of_x", 0, 1L << 20, 0x50594408daad080eUL, 0xfb1d7f6dc32ce18fUL, argument_im_w,
+     probe_im_w},
+    {"w_of_z", 1, 1L << 20, 0xffae636a24d1790fUL, 0x07f10937436cb5faUL, argument_w, probe_w},
+};
+enum { NCORPUS = sizeof(corpora) / sizeof(corpora[0]) };
+
+static const corpus_t* find_corpus(const char* name)
+{
+    for (int i = 0; i < NCORPUS; ++i)
+        if (!strcmp(corpora[i].name, name))
+            return &corpora[i];
+    fprintf(stderr, "unknown corpus %s\n", name);
+    return NULL;
+}
+
+//! Returns the number of doubles per record.
+static int stride(const corpus_t* c)
+{
+    return c->complex_arg ? 6 : 3;
+}
+
+static void reference(const corpus_t* c, double x, double y, dd_t* vr, dd_t* vi)
+{
+    *vi = dd_make(0, 0);
+    if (c->complex_arg)
+        ddref_w(x, y, vr, vi);
+    else if (c->argument == argument_erfcx)
+        *vr = ddref_erfcx(x);
+    else
+        *vr = ddref_im_w_of_x(x);
+}
+
+//! FNV-1a hash over words of 64 bits, taking n of every m doubles starting at offset.
+static uint64_t hash(const double* data, long count, int m, int offset, int n)
+{
+    uint64_t h = 0xcbf29ce484222325UL;
+    for (long i = 0; i < count; ++i) {
+        for (int j = 0; j < n; ++j) {
+            uint64_t u;
+            memcpy(&u, &data[i * m + offset + j], 8);
+            h ^= u;
+            h *= 0x100000001b3UL;
+        }
+    }
+    return h;
+}
+
+static char* corpus_path(const char* dir, const corpus_t* c)
+{
+    char* path = (char*)malloc(strlen(dir) + strlen(c->name) + 9);
+    if (path)
+        sprintf(path, "%s/%s.golden", dir, c->name);
+    return path;
+}
+
+//! Maps the corpus file; returns NULL if it does not exist or is invalid.
+static const golden_header* corpus_open(const char* dir, const corpus_t* c, size_t* size)
+{
+    char* path = corpus_path(dir, c);
+    if (!path)
+        return NULL;
+#ifdef _WIN32
+    // No memory mapping; read the entire file.
+    FILE* f = fopen(path, "rb");
+    free(path);
+    if (!f)
+        return NULL;
+    fseek(f, 0, SEEK_END);
+    const long fsize = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    *size = fsize > 0 ? (size_t)fsize : 0;
+    void* mem = *size ? malloc(*size) : NULL;
+    if (mem && fread(mem, 1, *size, f) != *size) {
+        free(mem);
+        mem = NULL;
+    }
+    fclose(f);
+    if (!mem)
+        return NULL;
+#else
+    const int fd = open(path, O_RDONLY);
+    free(path);
+    if (fd < 0)
+        return NULL;
+    struct stat st;
+    if (fstat(fd, &st) || st.st_size <= 0) {
+        close(fd);
+        return NULL;
+    }
+    *size = (size_t)st.st_size;
+    void* mem = mmap(NULL, *size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd); // the mapping stays valid
+    if (mem == MAP_FAILED)
+        return NULL;
+#endif
+    const golden_header* hd = (const golden_header*)mem;
+    if (*size < sizeof(golden_header) || memcmp(hd->magic, GoldenMagic, 8)
+        || hd->version != GoldenVersion || hd->byteorder != GoldenByteOrder
+        || strncmp(hd->corpus, c->name, sizeof(hd->corpus)) || hd->count != c->count
+        || hd->nargs != 1 + c->complex_arg || hd->nvalues != 1 + c->complex_arg
+        || *size != sizeof(golden_header) + 8 * (size_t)stride(c) * (size_t)hd->count) {
+        fprintf(stderr, "invalid corpus file for %s\n", c->name);
+#ifdef _WIN32
+        free(mem);
+#else
+        munmap(mem, *size);
+#endif
+        return NULL;
+    }
+    return hd;
+}
+
+static void corpus_close(const golden_header* hd, size_t size)
+{
+#ifdef _WIN32
+    (void)size;
+    free((void*)hd);
+#else
+    munmap((void*)hd, size);
+#endif
+}
+
+/******************************************************************************/
+/*  Generation                                                                */
+/******************************************************************************/
+
+typedef struct {
+    const corpus_t* c;
+    double* data;
+} gen_job_t;
+
+static void gen_body(void* ctx, int thread, long begin, long end)
+{
+    (void)thread;
+    const gen_job_t* job = (const gen_job_t*)ctx;
+    const corpus_t* c = job->c;
+    const int m = stride(c);
+    for (long i = begin; i < end; ++i) {
+        double* r = job->data + i * m;
+        double x, y;
+        c->argument(i, &x, &y);
+        dd_t vr, vi;
+        reference(c, x, y, &vr, &vi);
+        r[0] = x;
+        if (c->complex_arg) {
+            r[1] = y;
+            r[2] = vr.hi;
+            r[3] = vr.lo;
+            r[4] = vi.hi;
+            r[5] = vi.lo;
+        } else {
+            r[1] = vr.hi;
+            r[2] = vr.lo;
+        }
+    }
+}
+
+//! Writes the corpus file, unless an intact one exists. Returns 0 on success.
+static int generate(const corpus_t* c, const char* dir, int nthreads)
+{
+    const int m = stride(c);
+    const int nargs = 1 + c->complex_arg;
+    size_t size;
+    const golden_header* old = corpus_open(dir, c, &size);
+    if (old) {
+        const double* data = (const double*)(old + 1);
+        const int intact = old->arghash == hash(data, old->count, m, 0, nargs)
+            && old->valhash == hash(data, old->count, m, nargs, m - nargs)
+            && (!c->arghash || old->arghash == c->arghash);
+        corpus_close(old, size);
+        if (intact) {
+            printf("%s: up to date\n", c->name);
+            return 0;
+        }
+    }
+
+    golden_header hd;
+    memset(&hd, 0, sizeof(hd));
+    memcpy(hd.magic, GoldenMagic, 8);
+    hd.version = GoldenVersion;
+    hd.byteorder = GoldenByteOrder;
+    strncpy(hd.corpus, c->name, sizeof(hd.corpus) - 1);
+    hd.nargs = nargs;
+    hd.nvalues = nargs;
+    hd.count = c->count;
+    double* data = (double*)malloc(8 * (size_t)m * (size_t)c->count);
+    if (!data)
+        return 1;
+    gen_job_t job = {c, data};
+    parallel_for(nthreads, c->count, 4096, gen_body, &job);
+    hd.arghash = hash(data, c->count, m, 0, nargs);
+    hd.valhash = hash(data, c->count, m, nargs, m - nargs);
+    if (c->arghash && hd.arghash != c->arghash) {
+        fprintf(stderr, "%s: arguments differ from the frozen corpus (hash %016llx)\n", c->name,
+                (unsigned long long)hd.arghash);
+        free(data);
+        return 1;
+    }
+    if (c->valhash && hd.valhash != c->valhash)
+        fprintf(stderr,
+                "%s: warning: reference values differ from the frozen corpus (hash %016llx)\n",
+                c->name, (unsigned long long)hd.valhash);
+
+    char* path = corpus_path(dir, c);
+    FILE* f = path ? fopen(path, "wb") : NULL;
+    int ret = !f || fwrite(&hd, sizeof(hd), 1, f) != 1
+        || fwrite(data, 8 * (size_t)m, (size_t)c->count, f) != (size_t)c->count;
+    if (f && fclose(f))
+        ret = 1;
+    if (ret)
+        fprintf(stderr, "%s: cannot write %s\n", c->name, path ? path : dir);
+    else
+        printf("%s: %li points, hashes %016llx %016llx\n", c->name, c->count,
+               (unsigned long long)hd.arghash, (unsigned long long)hd.valhash);
+    free(path);
+    free(data);
+    return ret;
+}
+
+/******************************************************************************/
+/*  Functions under test                                                      */
+/******************************************************************************/
+
+enum { BLOCK = 1024 }; // arguments per call of an array function
+
+typedef struct {
+    const char* name;
+    const char* corpus;
+    //! Computes n function values f = (fr, fi) for arguments (x, y).
+    void (*eval)(int n, const double* x, const double* y, double* fr, double* fi);
+    double limit;     // maximum normwise error, in units of 2^-53,
+    double rmax;      // for |x| or |z| <= rmax, and y >= 0,
+    double xlow;      // and for x >= xlow;
+    double limit_low; // maximum normwise error for x < xlow
+    const char* scalar; // scalar counterpart of an array function, or NULL
+    double tolerance;   // maximum difference from the scalar function, in ulp
+} target_t;
+
+static void eval_w_of_z(int n, const double* x, const double* y, double* fr, double* fi)
+{
+    for (int i = 0; i < n; ++i) {
+        const _cerf_cmplx w = w_of_z(C(x[i], y[i]));
+        fr[i] = creal(w);
+        fi[i] = cimag(w);
+    }
+}
+
+static void eval_w_of_z_array(int n, const double* x, const double* y, double* fr, double* fi)
+{
+    w_of_z_array(n, x, y, fr, fi, CERF_W_DEFAULT);
+}
+
+static void eval_w_of_z_rational(int n, const double* x, const double* y, double* fr, double* fi)
+{
+    w_of_z_array(n, x, y, fr, fi, CERF_W_RATIONAL);
+}
+
+static void eval_erfcx(int n, const double* x, const double* y, double* fr, double* fi)
+{
+    (void)y;
+    (void)fi;
+    for (int i = 0; i < n; ++i)
+        fr[i] = erfcx(x[i]);
+}
+
+static void eval_erfcx_array(int n, const double* x, const double* y, double* fr, double* fi)
+{
+    (void)y;
+    (void)fi;
+    erfcx_array(n, x, fr);
+}
+
+static void eval_im_w_of_x(int n, const double* x, const double* y, double* fr, double* fi)
+{
+    (void)y;
+    (void)fi;
+    for (int i = 0; i < n; ++i)
+        fr[i] = im_w_of_x(x[i]);
+}
+
+static const target_t targets[] = {
+    // For x < -20, erfcx(x) = 2 exp(x^2) to double precision, and the error is that of exp
+    // from the C library; the limit of 16 u leaves room for libraries less accurate than glibc.
+    {"erfcx", "erfcx", eval_erfcx, 8, INFINITY, -20, 16, NULL, 0},
+    {"erfcx_array", "erfcx", eval_erfcx_array, 8, INFINITY, -20, 16, "erfcx", 0},
+    {"im_w_of_x", "im_w_of_x", eval_im_w_of_x, 8, INFINITY, -INFINITY, 0, NULL, 0},
+    {"w_of_z", "w_of_z", eval_w_of_z, 8, 1e4, -INFINITY, 0, NULL, 0},
+    {"w_of_z_array", "w_of_z", eval_w_of_z_array, 8, 1e4, -INFINITY, 0, "w_of_z", 0},
+    {"w_of_z_rational", "w_of_z", eval_w_of_z_rational, 32, 1e4, -INFINITY, 0, "w_of_z",
+     INFINITY},
+};
+enum { NTARGET = sizeof(targets) / sizeof(targets[0]) };
+
+static const target_t* find_target(const char* name)
+{
+    for (int i = 0; i < NTARGET; ++i)
+        if (!strcmp(targets[i].name, name))
+            return &targets[i];
+    fprintf(stderr, "unknown function %s\n", name);
+    return NULL;
+}
+
+/******************************************************************************/
+/*  Regions                                                                   */
+/******************************************************************************/
+
+enum { MAXKEY = 4096, MAXREGION = 256 };
+
+#ifndef CERF_INTROSPECT
+//! Returns the region key of argument (x, y).
+static int region_key(const corpus_t* c, double x, double y)
+{
+    const double r = c->complex_arg ? hypot(x, y) : fabs(x);
+    int d = r == 0 ? -31 : (int)floor(log10(r));
+    d = d < -31 ? -31 : d > 31 ? 31 : d;
+    int cls;
+    if (!c->complex_arg)
+        cls = x < 0 ? 0 : 1;
+    else if (8 * fabs(y) <= fabs(x))
+        cls = 2; // close to the real axis
+    else if (8 * fabs(x) <= fabs(y))
+        cls = 3; // close to the imaginary axis
+    else
+        cls = 1;
+    return 64 * cls + d + 32;
+}
+#endif
+
+static void region_name(const corpus_t* c, int key, char* name, size_t size)
+{
+#ifdef CERF_INTROSPECT
+    (void)c;
+    snprintf(name, size, "algorithm %i", key);
+#else
+    static const char* real_cls[] = {"x < 0", "x >= 0"};
+    static const char* complex_cls[] = {"", "|y/x| in (1/8, 8)", "close to real axis",
+                                        "close to imaginary axis"};
+    const char* v = c->complex_arg ? "|z|" : "|x|";
+    const char* cls = c->complex_arg ? complex_cls[key / 64] : real_cls[key / 64];
+    const int d = key % 64 - 32;
+    if (d == -31)
+        snprintf(name, size, "%s, %s < 1e-30", cls, v);
+    else if (d == 31)
+        snprintf(name, size, "%s, %s >= 1e31", cls, v);
+    else
+        snprintf(name, size, "%s, 1e%i <= %s < 1e%i", cls, d, v, d + 1);
+#endif
+}
+
+typedef struct {
+    int nregion;
+    int key[MAXREGION];
+    unsigned char* index; // region index of each point
+} regions_t;
+
+//! Assigns each point to a region. Serial, because cerf_algorithm is a global variable.
+static int assign_regions(const corpus_t* c, const double* data, regions_t* reg)
+{
+    static short map[MAXKEY];
+    for (int k = 0; k < MAXKEY; ++k)
+        map[k] = -1;
+    reg->nregion = 0;
+    reg->index = (unsigned char*)malloc(c->count);
+    if (!reg->index)
+        return 1;
+    const int m = stride(c);
+    for (long i = 0; i < c->count; ++i) {
+        const double x = data[i * m], y = c->complex_arg ? data[i * m + 1] : 0;
+#ifdef CERF_INTROSPECT
+        cerf_algorithm = 0;
+        c->probe(x, y);
+        int key = cerf_algorithm;
+        key = key < 0 ? 0 : key >= MAXKEY ? MAXKEY - 1 : key;
+#else
+        const int key = region_key(c, x, y);
+#endif
+        if (map[key] < 0) {
+            if (reg->nregion == MAXREGION) {
+                fprintf(stderr, "too many regions\n");
+                return 1;
+            }
+            reg->key[reg->nregion] = key;
+            map[key] = (short)reg->nregion++;
+        }
+        reg->index[i] = (unsigned char)map[key];
+    }
+    return 0;
+}
+
+/******************************************************************************/
+/*  Verification                                                              */
+/******************************************************************************/
+
+typedef struct {
+    const corpus_t* c;
+    const target_t* t;
+    const target_t* s; // scalar counterpart, in comparison mode
+    const double* data;
+    const regions_t* reg;
+    stats_t* stats; // per thread: NSTATS
+} job_t;
+
+// All points, points within rmax and above xlow, points below xlow, one per region.
+enum { NSTATS = 3 + MAXREGION };
+
+static void body(void* ctx, int thread, long begin, long end)
+{
+    const job_t* job = (const job_t*)ctx;
+    const corpus_t* c = job->c;
+    const int m = stride(c);
+    stats_t* s = job->stats + (size_t)thread * NSTATS;
+    double x[BLOCK], y[BLOCK], fr[BLOCK], fi[BLOCK], gr[BLOCK], gi[BLOCK];
+    for (long i0 = begin; i0 < end; i0 += BLOCK) {
+        const int n = end - i0 < BLOCK ? (int)(end - i0) : BLOCK;
+        const double* r = job->data + i0 * m;
+        for (int j = 0; j < n; ++j) {
+            x[j] = r[j * m];
+            y[j] = c->complex_arg ? r[j * m + 1] : 0;
+        }
+        for (int j = 0; j < n; ++j)
+            fi[j] = gi[j] = 0;
+        job->t->eval(n, x, y, fr, fi);
+        if (job->s)
+            job->s->eval(n, x, y, gr, gi);
+        for (int j = 0; j < n; ++j) {
+            const double* v = r + j * m + 1 + c->complex_arg;
+            dd_t vr, vi;
+            if (job->s) { // compare with the scalar function instead of the reference
+                vr = dd_make(gr[j], 0);
+                vi = dd_make(gi[j], 0);
+            } else {
+                vr = dd_make(v[0], v[1]);
+                vi = c->complex_arg ? dd_make(v[2], v[3]) : dd_make(0, 0);
+            }
+            const int in_range = hypot(x[j], y[j]) <= job->t->rmax && y[j] >= 0;
+            stats_t* dest[3] = {s, s + 3 + job->reg->index[i0 + j],
+                                in_range ? (x[j] < job->t->xlow ? s + 2 : s + 1) : NULL};
+            if (isnan(vr.hi) || isnan(vi.hi)) {
+                // In comparison mode, NaN from both functions is an agreement.
+                const int agree =
+                    job->s && isnan(fr[j]) == isnan(vr.hi) && isnan(fi[j]) == isnan(vi.hi);
+                for (int d = 0; d < 3 && dest[d]; ++d) {
+                    if (agree)
+                        dest[d]->count++;
+                    else
+                        dest[d]->skipped++;
+                }
+                continue;
+            }
+            const double e0 = ulp_error(fr[j], vr);
+            const double e1 = ulp_error(fi[j], vi);
+            const double e2 = norm_error(fr[j], fi[j], vr, vi);
+            for (int d = 0; d < 3 && dest[d]; ++d) {
+                stats_t* p = dest[d];
+                p->count++;
+                stats_record(p, 0, e0, x[j], y[j]);
+                if (c->complex_arg)
+                    stats_record(p, 1, e1, x[j], y[j]);
+                stats_record(p, 2, e2, x[j], y[j]);
+                if (job->s && (fr[j] != vr.hi || fi[j] != vi.hi))
+                    p->skipped++; // in comparison mode: number of mismatches
+            }
+        }
+    }
+}
+
+static void print_stats(const corpus_t* c, const stats_t* s, int compare)
+{
+    for (int k = 0; k < 3; ++k) {
+        if (k == 1 && !c->complex_arg)
+            continue;
+        if (k == 2 && compare)
+            continue;
+        const char* part = k == 2 ? "  norm " : c->complex_arg ? (k ? "  Im " : "  Re ") : "  ";
+        printf("%s", part);
+        stats_print_max(s, k, c->complex_arg, k == 2 ? "u" : "ulp");
+        printf("%shistogram:", part);
+        stats_print_hist(s, k);
+    }
+}
+
+static int verify(const target_t* t, const char* dir, int nthreads, int compare)
+{
+    const corpus_t* c = find_corpus(t->corpus);
+    if (!c)
+        return 1;
+    const target_t* s = NULL;
+    if (compare) {
+        if (!t->scalar) {
+            fprintf(stderr, "%s is not an array function\n", t->name);
+            return 1;
+        }
+        s = find_target(t->scalar);
+    }
+    size_t size;
+    const golden_header* hd = corpus_open(dir, c, &size);
+    if (!hd) {
+        fprintf(stderr, "no corpus %s in %s; run golden gen first\n", c->name, dir);
+        return 1;
+    }
+    const double* data = (const double*)(hd + 1);
+    regions_t reg;
+    int ret = assign_regions(c, data, &reg);
+    nthreads = nthreads < 1 ? 1 : nthreads;
+    stats_t* stats = (stats_t*)calloc((size_t)nthreads * NSTATS, sizeof(stats_t));
+    if (ret || !stats) {
+        free(reg.index);
+        free(stats);
+        corpus_close(hd, size);
+        return 1;
+    }
+    job_t job = {c, t, s, data, &reg, stats};
+    parallel_for(nthreads, c->count, 16 * BLOCK, body, &job);
+
+    // Sum over threads, into the stats of thread 0.
+    for (int i = 1; i < nthreads; ++i)
+        for (int r = 0; r < 3 + reg.nregion; ++r)
+            stats_merge(&stats[r], &stats[(size_t)i * NSTATS + r]);
+    const stats_t* total = &stats[0];
+    const stats_t* checked = &stats[1];
+    const stats_t* low = &stats[2];
+
+    // Regions in order of their keys.
+    int order[MAXREGION];
+    for (int r = 0; r < reg.nregion; ++r) {
+        int k = r;
+        for (; k > 0 && reg.key[order[k - 1]] > reg.key[r]; --k)
+            order[k] = order[k - 1];
+        order[k] = r;
+    }
+    for (int i = 0; i < reg.nregion; ++i) {
+        const int r = order[i];
+        char name[80];
+        region_name(c, reg.key[r], name, sizeof(name));
+        printf("%s: %li points (%li %s)\n", name, stats[3 + r].count, stats[3 + r].skipped,
+               compare ? "mismatches" : "skipped");
+        print_stats(c, &stats[3 + r], compare);
+    }
+    if (compare) {
+        const double d = fmax(total->max[0], total->max[1]);
+        printf("%s vs %s: %li points, %li mismatches, max difference %.3g ulp\n", t->name,
+               s->name, total->count, total->skipped, d);
+        ret = t->tolerance != INFINITY && (t->tolerance ? d > t->tolerance : total->skipped > 0);
+    } else {
+        printf("%s: %li points (%li skipped), %i regions\n", t->name, total->count,
+               total->skipped, reg.nregion);
+        print_stats(c, total, compare);
+        printf("for %s <= %g%s", c->complex_arg ? "|z|" : "|x|", t->rmax,
+               c->complex_arg ? ", y >= 0" : "");
+        if (t->xlow > -INFINITY)
+            printf(", x >= %g", t->xlow);
+        printf(": %li points, max %.3g u, limit %g u\n", checked->count, checked->max[2],
+               t->limit);
+        ret = checked->max[2] > t->limit;
+        if (t->xlow > -INFINITY) {
+            printf("for x < %g: %li points, max %.3g u, limit %g u\n", t->xlow, low->count,
+                   low->max[2], t->limit_low);
+            ret |= low->max[2] > t->limit_low;
+        }
+    }
+    if (ret)
+        printf("FAILED\n");
+    free(reg.index);
+    free(stats);
+    corpus_close(hd, size);
+    return ret;
+}
+
+/******************************************************************************/
+/*  Main                                                                      */
+/******************************************************************************/
+
+static int usage(const char* prog)
+{
+    fprintf(stderr,
+            "Usage: %s gen <corpus|all> <dir> [threads]\n"
+            "       %s verify <function> <dir> [threads]\n"
+            "       %s compare <function> <dir> [threads]\n"
+            "       %s list\n",
+            prog, prog, prog, prog);
+    return 1;
+}
+
+int main(int argc, char** argv)
+{
+    if (argc == 2 && !strcmp(argv[1], "list")) {
+        for (int i = 0; i < NTARGET; ++i) {
+            printf("%-16s corpus %-10s limit %g u", targets[i].name, targets[i].corpus,
+                   targets[i].limit);
+            if (targets[i].xlow > -INFINITY)
+                printf(", %g u for x < %g", targets[i].limit_low, targets[i].xlow);
+            printf("%s\n", targets[i].scalar ? ", array" : "");
+        }
+        return 0;
+    }
+    if (argc < 4 || argc > 5)
+        return usage(argv[0]);
+    const int nthreads = argc > 4 ? atoi(argv[4]) : parallel_nproc();
+    if (!strcmp(argv[1], "gen")) {
+        int ret = 0;
+        for (int i = 0; i < NCORPUS; ++i)
+            if (!strcmp(argv[2], "all") || !strcmp(argv[2], corpora[i].name))
+                ret |= generate(&corpora[i], argv[3], nthreads);
+        return ret || (strcmp(argv[2], "all") && !find_corpus(argv[2]));
+    }
+    if (strcmp(argv[1], "verify") && strcmp(argv[1], "compare"))
+        return usage(argv[0]);
+    const target_t* t = find_target(argv[2]);
+    if (!t)
+        return 1;
+    const int ret = verify(t, argv[3], nthreads, !strcmp(argv[1], "compare"));
+    return ret ? ret : sink == 42;
+}
@@ -0,0 +1,380 @@
+/* Library libcerf:
+ *   Compute complex error functions, based on a new implementation of
+ *   Faddeeva's w_of_z. Also provide Dawson and Voigt functions.
+ *
+ * File latency.c:
+ *   Time single function calls, and report percentiles of the latency distribution.
+ *
+ * Copyright:
+ *   (C) 2026 Forschungszentrum Jülich GmbH
+ *
+ * Licence:
+ *   Public domain.
+ *
+ * Website:
+ *   http://apps.jcns.fz-juelich.de/libcerf
+ */
+
+/*
+   Each call is timed individually with the time-stamp counter (rdtsc before, rdtscp after,
+   fenced by lfence), or with timespec_get on processors other than x86.
+   The timer overhead, determined from empty calls, is subtracted.
+
+   Latencies are collected in a histogram with logarithmic buckets, each subdivided into
+   32 linear sub-buckets (as in HdrHistogram), so that percentiles are resolved to about 3%.
+
+   Arguments are chosen from each algorithm region, and from adversarial places:
+   switch points between algorithms, subrange edges of Chebyshev tables,
+   tile boundaries of w_of_z. Within each test, arguments are visited in random order.
+   Tests marked "cold" evict the caches before each call, to show cold-table effects.
+
+   Usage:
+       latency [number of calls per test, default 2^20] [hist]
+   With "hist", the full histogram is printed for each test.
+*/
+
+#include "cerf.h"
+#include "defs.h"
+#include "ticks.h"
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/******************************************************************************/
+/*  Histogram                                                                 */
+/******************************************************************************/
+
+enum { SUB = 32, NBUCKET = 2 * SUB + 40 * SUB };
+
+typedef struct {
+    uint64_t count[NBUCKET];
+    uint64_t total;
+    uint64_t max;
+} histogram_t;
+
+static int bucket_index(uint64_t v)
+{
+    if (v < 2 * SUB)
+        return (int)v;
+    int e = 0;
+    while ((v >> e) >= 2 * SUB)
+        ++e;
+    const int i = 2 * SUB + (e - 1) * SUB + (int)((v >> e) - SUB);
+    return i < NBUCKET ? i : NBUCKET - 1;
+}
+
+//! Returns the smallest value that falls into bucket i.
+static uint64_t bucket_value(int i)
+{
+    if (i < 2 * SUB)
+        return (uint64_t)i;
+    const int e = (i - 2 * SUB) / SUB + 1;
+    return (uint64_t)(SUB + (i - 2 * SUB) % SUB) << e;
+}
+
+static void hist_add(histogram_t* h, uint64_t v)
+{
+    ++h->count[bucket_index(v)];
+    ++h->total;
+    if (v > h->max)
+        h->max = v;
+}
+
+//! Returns the value below which the fraction p of all entries lies.
+static uint64_t hist_percentile(const histogram_t* h, double p)
+{
+    const uint64_t limit = (uint64_t)ceil(p * h->total);
+    uint64_t cum = 0;
+    for (int i = 0; i < NBUCKET; ++i) {
+        cum += h->count[i];
+        if (cum >= limit)
+            return i + 1 < NBUCKET ? bucket_value(i + 1) - 1 : h->max;
+    }
+    return h->max;
+}
+
+/******************************************************************************/
+/*  Tests                                                                     */
+/******************************************************************************/
+
+static double ns_per_tick = 1;
+static uint64_t overhead = 0;
+static int print_hist = 0;
+static double sink = 0;
+
+// Buffer that is streamed through to evict the caches.
+enum { NEVICT = 1 << 22 };
+static double* evict_buf;
+
+static void evict(void)
+{
+    for (int i = 0; i < NEVICT; i += 8)
+        evict_buf[i] += 1;
+}
+
+static uint32_t rng_state = 4711;
+static uint32_t rng(void)
+{
+    rng_state = rng_state * 1664525u + 1013904223u;
+    return rng_state >> 8;
+}
+
+typedef struct {
+    const char* name;
+    const char* range;
+    double (*f)(double);              // real function, or NULL
+    _cerf_cmplx (*fz)(_cerf_cmplx);   // complex function
+    int cold;
+} test_t;
+
+static void report(const test_t* t, const histogram_t* h)
+{
+    static const double P[5] = {.5, .9, .99, .999, .9999};
+    printf("%-10s %-26s %-4s", t->name, t->range, t->cold ? "cold" : "");
+    for (int k = 0; k < 5; ++k)
+        printf(" %8.1f", ns_per_tick * hist_percentile(h, P[k]));
+    printf(" %8.1f\n", ns_per_tick * h->max);
+    if (!print_hist)
+        return;
+    uint64_t cum = 0;
+    for (int i = 0; i < NBUCKET; ++i) {
+        if (!h->count[i])
+            continue;
+        cum += h->count[i];
+        printf("    %10.1f .. %-10.1f %10lu %9.6f\n", ns_per_tick * bucket_value(i),
+               ns_per_tick * (i + 1 < NBUCKET ? bucket_value(i + 1) : h->max),
+               (unsigned long)h->count[i], (double)cum / h->total);
+    }
+}
+
+//! Times n calls, with arguments x[i] (+ i y[i]) chosen at random from m values.
+static void run(const test_t* t, const double* x, const double* y, int m, long n)
+{
+    histogram_t* h = (histogram_t*)calloc(1, sizeof(histogram_t));
+    if (t->cold)
+        n /= 1024;
+    for (long i = 0; i < n; ++i) {
+        const int j = (int)(rng() % (uint32_t)m);
+        if (t->cold)
+            evict();
+        uint64_t t0, t1;
+        if (t->f) {
+            const double xj = x[j];
+            t0 = tick_start();
+            const double r = t->f(xj);
+            t1 = tick_stop();
+            sink += r;
+        } else {
+            const _cerf_cmplx zj = C(x[j], y[j]);
+            t0 = tick_start();
+            const _cerf_cmplx r = t->fz(zj);
+            t1 = tick_stop();
+            sink += creal(r);
+        }
+        const uint64_t dt = t1 - t0;
+        hist_add(h, dt > overhead ? dt - overhead : 0);
+    }
+    report(t, h);
+    free(h);
+}
+
+enum { M = 1 << 12 }; // maximum number of different arguments per test
+
+static double x[M], y[M];
+
+//! Fills x with m points in [lo, hi]; returns m.
+static int fill(double lo, double hi, int m)
+{
+    for (int i = 0; i < m; ++i)
+        x[i] = lo + (hi - lo) * (i + .5) / m;
+    return m;
+}
+
+//! Fills x with the neighbors of the given points; returns their number.
+static int fill_edges(const double* e, int ne)
+{
+    int m = 0;
+    for (int k = 0; k < ne && m + 4 <= M; ++k) {
+        x[m++] = nextafter(e[k], -Inf);
+        x[m++] = e[k];
+        x[m++] = nextafter(e[k], Inf);
+        x[m++] = e[k] * (1 + 1e-12);
+    }
+    return m;
+}
+
+//! Fills x, y with m points on a polar grid r0 < |z| < r1 in the upper half plane.
+static int fill_z(double r0, double r1, int m)
+{
+    for (int i = 0; i < m; ++i) {
+        const double r = r0 + (r1 - r0) * (i / 64 + .5) / (m / 64);
+        const double phi = 3.141592653589793 * (i % 64 + .5) / 64;
+        x[i] = r * cos(phi);
+        y[i] = r * sin(phi);
+    }
+    return m;
+}
+
+static double identity(double v)
+{
+    return v;
+}
+
+static double voigt_1_1(double v)
+{
+    return voigt(v, 1, 1);
+}
+
+static double voigt_1_1em6(double v)
+{
+    return voigt(v, 1, 1e-6);
+}
+
+int main(int argc, char** argv)
+{
+    const long n = argc > 1 ? atol(argv[1]) : 1L << 20;
+    print_hist = argc > 2 && !strcmp(argv[2], "hist");
+    evict_buf = (double*)calloc(NEVICT, sizeof(double));
+
+    // Calibrate the counter against the wall clock.
+    {
+        struct timespec a, b;
+        timespec_get(&a, TIME_UTC);
+        const uint64_t t0 = tick_start();
+        do
+            timespec_get(&b, TIME_UTC);
+        while ((b.tv_sec - a.tv_sec) * 1e9 + (b.tv_nsec - a.tv_nsec) < 1e8);
+        const uint64_t t1 = tick_stop();
+        ns_per_tick = ((b.tv_sec - a.tv_sec) * 1e9 + (b.tv_nsec - a.tv_nsec)) / (double)(t1 - t0);
+    }
+    // Timer overhead: minimum over empty calls.
+    {
+        double (*volatile f)(double) = identity;
+        overhead = UINT64_MAX;
+        for (int i = 0; i < 100000; ++i) {
+            const uint64_t t0 = tick_start();
+            sink += f(i);
+            const uint64_t t1 = tick_stop();
+            if (t1 - t0 < overhead)
+                overhead = t1 - t0;
+        }
+    }
+    printf("timer %s, %.4f ns per tick, overhead %lu ticks subtracted\n", TIMER_NAME, ns_per_tick,
+           (unsigned long)overhead);
+    printf("function   arguments                       "
+           "   p50      p90      p99    p99.9   p99.99      max [ns]\n");
+
+    // Switch points of erfcx and im_w_of_x between algorithms.
+    static const double erfcx_switch[] = {-26.7, -6.1, -.125, .125, 12, 23.2, 150};
+    static const double imwx_switch[] = {.5, 12, -.5, -12};
+    // Subrange edges of the Chebyshev tables: 64 per octave.
+    double cheb_edges[7 * 64];
+    for (int j = -2; j <= 4; ++j)
+        for (int k = 0; k < 64; ++k)
+            cheb_edges[(j + 2) * 64 + k] = ldexp(1 + k / 64., j);
+
+    test_t t = {0, 0, 0, 0, 0};
+    t.name = "erfcx";
+    t.f = erfcx;
+    t.range = "0.01 .. 0.12";
+    run(&t, x, y, fill(.01, .12, M), n);
+    t.range = "0.13 .. 12";
+    run(&t, x, y, fill(.13, 12, M), n);
+    t.cold = 1;
+    run(&t, x, y, fill(.13, 12, M), n);
+    t.cold = 0;
+    t.range = "12 .. 150";
+    run(&t, x, y, fill(12.01, 150, M), n);
+    t.range = "-6 .. -0.13";
+    run(&t, x, y, fill(-6, -.13, M), n);
+    t.range = "-26.6 .. -6.2";
+    run(&t, x, y, fill(-26.6, -6.2, M), n);
+    t.range = "switch points";
+    run(&t, x, y, fill_edges(erfcx_switch, 7), n);
+    t.range = "subrange edges";
+    run(&t, x, y, fill_edges(cheb_edges, 7 * 64), n);
+
+    t.name = "im_w_of_x";
+    t.f = im_w_of_x;
+    t.range = "0.01 .. 0.5";
+    run(&t, x, y, fill(.01, .5, M), n);
+    t.range = "0.5 .. 12";
+    run(&t, x, y, fill(.5, 12, M), n);
+    t.range = "12 .. 150";
+    run(&t, x, y, fill(12.01, 150, M), n);
+    t.range = "switch points";
+    run(&t, x, y, fill_edges(imwx_switch, 4), n);
+    t.range = "subrange edges";
+    run(&t, x, y, fill_edges(cheb_edges, 7 * 64), n);
+
+    t.name = "voigt";
+    t.f = voigt_1_1;
+    t.range = "-10 .. 10, s=g=1";
+    run(&t, x, y, fill(-10, 10, M), n);
+    t.f = voigt_1_1em6;
+    t.range = "-10 .. 10, s=1, g=1e-6";
+    run(&t, x, y, fill(-10, 10, M), n);
+
+    t.name = "w_of_z";
+    t.f = 0;
+    t.fz = w_of_z;
+    t.range = "|z| 0.01 .. 0.23";
+    run(&t, x, y, fill_z(.01, .23, M), n);
+    t.range = "|z| 0.24 .. 6.9";
+    run(&t, x, y, fill_z(.24, 6.9, M), n);
+    t.cold = 1;
+    run(&t, x, y, fill_z(.24, 6.9, M), n);
+    t.cold = 0;
+    t.range = "|z| 7.1 .. 100";
+    run(&t, x, y, fill_z(7.1, 100, M), n);
+    // Lower half plane, where w(-z) is reflected.
+    fill_z(.24, 6.9, M);
+    for (int i = 0; i < M; ++i)
+        y[i] = -y[i];
+    t.range = "|z| 0.24 .. 6.9, y < 0";
+    run(&t, x, y, M, n);
+    // Tile boundaries: the Cover grid has spacing 1/8 in x and y.
+    {
+        int m = 0;
+        for (int i = 0; i < 56 && m + 4 <= M; ++i) {
+            for (int j = 0; j < 18 && m + 4 <= M; ++j) {
+                const double a = i / 8., b = (j + .5) * 7 / 18;
+                if (a * a + b * b >= 49 || a * a + b * b < .06)
+                    continue;
+                x[m] = nextafter(a, -Inf); y[m++] = b;
+                x[m] = a; y[m++] = b;
+                x[m] = b; y[m++] = nextafter(a, -Inf);
+                x[m] = b; y[m++] = a;
+            }
+        }
+        t.range = "tile boundaries";
+        run(&t, x, y, m, n);
+    }
+    // Close to the real axis, and at the switches |z|^2 = .053 and 49.
+    for (int i = 0; i < M; ++i) {
+        const double r = i % 2 ? sqrt(.053) : 7;
+        const double phi = 1.5707963267948966 * (i / 2 + .5) / (M / 2);
+        const double s = i % 4 < 2 ? 1 - 1e-15 : 1 + 1e-15;
+        x[i] = s * r * cos(phi);
+        y[i] = s * r * sin(phi);
+    }
+    t.range = "|z|^2 = .053, 49";
+    run(&t, x, y, M, n);
+    for (int i = 0; i < M; ++i) {
+        x[i] = 7. * (i + .5) / M;
+        y[i] = x[i] * pow(10., -6 - 4. * (i % 7) / 6);
+    }
+    t.range = "y/x 1e-6 .. 1e-10";
+    run(&t, x, y, M, n);
+
+    t.name = "cerf";
+    t.fz = cerf;
+    t.range = "|z| 0.01 .. 10";
+    run(&t, x, y, fill_z(.01, 10, M), n);
+
+    free(evict_buf);
+    return sink == 42; // use sink, so that the compiler cannot drop the calls
+}
@@ -0,0 +1,278 @@
+/* Library libcerf:
+ *   Compute complex error functions, based on a new implementation of
+ *   Faddeeva's w_of_z. Also provide Dawson and Voigt functions.
+ *
+ * File mapeval.h:
+ *   Evaluate a function from fctable.h for all arguments in a binary file, writing a binary
+ *   file, both memory mapped, in chunks, with several threads and a prefetch thread.
+ *
+ * Copyright:
+ *   (C) 2026 Forschungszentrum Jülich GmbH
+ *
+ * Licence:
+ *   Public domain.
+ *
+ * Website:
+ *   http://apps.jcns.fz-juelich.de/libcerf
+ */
+
+/*
+   mapeval_files(f, infile, outfile, opt) reads the arguments of f from infile, and writes the
+   function values to outfile, which is created or overwritten. Files contain raw doubles in
+   the byte order of the host, without header, either as records (x0 y0 x1 y1 ...) or as
+   columns (x0 x1 ... y0 y1 ...). If infile and outfile are the same file, values overwrite
+   arguments in place; this requires as many values as arguments per point.
+
+   Both files are memory mapped, with the hint MADV_SEQUENTIAL; data do not pass through stdio
+   buffers. Points are processed in chunks; the points of a chunk are distributed over the
+   compute threads. Meanwhile, a prefetch thread requests the next chunks (MADV_WILLNEED) and
+   touches their pages, so that page faults are taken there rather than in the compute
+   threads. In column layout, the array functions work directly on the mapped memory; in record
+   layout, and in place, arguments and values pass through buffers of BLOCK points per thread.
+
+   Only for POSIX systems.
+*/
+
+#ifndef MAPEVAL_H
+#define MAPEVAL_H
+
+#include "fctable.h"
+#include "parallel.h"
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+typedef struct {
+    int columns;  // layout: 0 records, 1 columns
+    int nthreads; // compute threads
+    size_t chunk; // points per chunk
+    int ahead;    // chunks prefetched ahead of the computation; 0: no prefetch thread
+} mapeval_opt_t;
+
+//! Returns the default options: records, all processors, 2^20 points, 2 chunks ahead.
+static inline mapeval_opt_t mapeval_default(void)
+{
+    mapeval_opt_t opt;
+    opt.columns = 0;
+    opt.nthreads = parallel_nproc();
+    opt.chunk = (size_t)1 << 20;
+    opt.ahead = 2;
+    return opt;
+}
+
+enum { MAPEVAL_BLOCK = 512 }; // points per call of an array function, in buffered mode
+
+typedef struct {
+    const fct_t* f;
+    mapeval_opt_t opt;
+    size_t count;    // number of points
+    double* in;      // mapped input
+    double* out;     // mapped output; equal to in if in place
+    size_t insize, outsize;
+    int buffered;    // pass through per-thread buffers
+    // state shared with the prefetch thread
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    size_t current;  // chunk being computed
+    int done;
+    size_t offset;   // first point of the present chunk, for the compute threads
+} mapeval_job_t;
+
+//! Requests pages of nbytes at p, and touches them by reading one byte per page.
+static inline void mapeval_touch(const void* p, size_t nbytes, size_t page)
+{
+    const uintptr_t a = (uintptr_t)p & ~(uintptr_t)(page - 1); // madvise needs page alignment
+    madvise((void*)a, nbytes + ((uintptr_t)p - a), MADV_WILLNEED);
+    volatile const char* c = (volatile const char*)p;
+    for (size_t k = 0; k < nbytes; k += page)
+        (void)c[k];
+}
+
+//! Touches argument and value pages of the points [b, e).
+static inline void mapeval_touch_points(const mapeval_job_t* job, size_t b, size_t e, size_t page)
+{
+    const fct_t* f = job->f;
+    if (job->opt.columns) {
+        for (int k = 0; k < f->nin; ++k)
+            mapeval_touch(job->in + k * job->count + b, 8 * (e - b), page);
+        if (job->out != job->in)
+            for (int k = 0; k < f->nout; ++k)
+                mapeval_touch(job->out + k * job->count + b, 8 * (e - b), page);
+    } else {
+        mapeval_touch(job->in + f->nin * b, 8 * f->nin * (e - b), page);
+        if (job->out != job->in)
+            mapeval_touch(job->out + f->nout * b, 8 * f->nout * (e - b), page);
+    }
+}
+
+static inline void* mapeval_prefetch(void* arg)
+{
+    mapeval_job_t* job = (mapeval_job_t*)arg;
+    const size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    const size_t nchunk = (job->count + job->opt.chunk - 1) / job->opt.chunk;
+    // Chunk 0 is touched by the compute threads.
+    for (size_t c = 1; c < nchunk; ++c) {
+        pthread_mutex_lock(&job->lock);
+        while (!job->done && c > job->current + job->opt.ahead)
+            pthread_cond_wait(&job->cond, &job->lock);
+        const int done = job->done;
+        const int late = c <= job->current;
+        pthread_mutex_unlock(&job->lock);
+        if (done)
+            break;
+        if (late)
+            continue;
+        const size_t b = c * job->opt.chunk;
+        const size_t e = b + job->opt.chunk < job->count ? b + job->opt.chunk : job->count;
+        mapeval_touch_points(job, b, e, page);
+    }
+    return NULL;
+}
+
+static inline void mapeval_body(void* ctx, int thread, long begin, long end)
+{
+    (void)thread;
+    const mapeval_job_t* job = (const mapeval_job_t*)ctx;
+    const fct_t* f = job->f;
+    const size_t count = job->count;
+    begin += (long)job->offset;
+    end += (long)job->offset;
+    const double* a[4];
+    double* r[4];
+    if (!job->buffered) { // directly on the mapped columns
+        for (int k = 0; k < f->nin; ++k)
+            a[k] = job->in + k * count + begin;
+        for (int k = 0; k < f->nout; ++k)
+            r[k] = job->out + k * count + begin;
+        fct_eval(f, (size_t)(end - begin), a, r);
+        return;
+    }
+    double abuf[4][MAPEVAL_BLOCK], rbuf[4][MAPEVAL_BLOCK];
+    for (int k = 0; k < 4; ++k) {
+        a[k] = abuf[k];
+        r[k] = rbuf[k];
+    }
+    for (long i0 = begin; i0 < end; i0 += MAPEVAL_BLOCK) {
+        const size_t n = end - i0 < MAPEVAL_BLOCK ? (size_t)(end - i0) : MAPEVAL_BLOCK;
+        if (job->opt.columns) {
+            for (int k = 0; k < f->nin; ++k)
+                memcpy(abuf[k], job->in + k * count + i0, 8 * n);
+        } else {
+            const double* p = job->in + f->nin * (size_t)i0;
+            for (size_t i = 0; i < n; ++i)
+                for (int k = 0; k < f->nin; ++k)
+                    abuf[k][i] = *p++;
+        }
+        fct_eval(f, n, a, r);
+        if (job->opt.columns) {
+            for (int k = 0; k < f->nout; ++k)
+                memcpy(job->out + k * count + i0, rbuf[k], 8 * n);
+        } else {
+            double* p = job->out + f->nout * (size_t)i0;
+            for (size_t i = 0; i < n; ++i)
+                for (int k = 0; k < f->nout; ++k)
+                    *p++ = rbuf[k][i];
+        }
+    }
+}
+
+//! Maps nbytes of file fd, or returns NULL.
+static inline double* mapeval_map(int fd, size_t nbytes, int writable)
+{
+    void* mem = mmap(NULL, nbytes, writable ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED,
+                     fd, 0);
+    if (mem == MAP_FAILED)
+        return NULL;
+    madvise(mem, nbytes, MADV_SEQUENTIAL);
+    return (double*)mem;
+}
+
+//! Evaluates f for all arguments in infile, and writes the values to outfile.
+//! Returns 0, or -1 (i/o), -2 (size of infile not a multiple of the record size),
+//! -3 (in place, but different number of arguments and values).
+//! If count is not NULL, sets *count to the number of points.
+static inline int mapeval_files(const fct_t* f, const char* infile, const char* outfile,
+                                const mapeval_opt_t* opt, size_t* count)
+{
+    mapeval_job_t job;
+    memset(&job, 0, sizeof(job));
+    job.f = f;
+    job.opt = *opt;
+    if (job.opt.chunk < 1)
+        job.opt.chunk = 1;
+    if (count)
+        *count = 0;
+
+    struct stat st_in, st_out;
+    if (stat(infile, &st_in))
+        return -1;
+    const int in_place = !stat(outfile, &st_out) && st_out.st_dev == st_in.st_dev
+        && st_out.st_ino == st_in.st_ino;
+    if (st_in.st_size % (8 * f->nin))
+        return -2;
+    if (in_place && f->nin != f->nout)
+        return -3;
+    job.count = (size_t)st_in.st_size / (8 * f->nin);
+    job.insize = 8 * f->nin * job.count;
+    job.outsize = 8 * f->nout * job.count;
+
+    int ret = 0;
+    const int fd_in = open(infile, in_place ? O_RDWR : O_RDONLY);
+    const int fd_out = in_place ? -1 : open(outfile, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd_in < 0 || (!in_place && fd_out < 0)) {
+        ret = -1;
+    } else if (job.count) {
+        job.in = mapeval_map(fd_in, job.insize, in_place);
+        if (in_place) {
+            job.out = job.in;
+        } else if (!ftruncate(fd_out, (off_t)job.outsize)) {
+            posix_fallocate(fd_out, 0, (off_t)job.outsize); // avoid a sparse file; optional
+            job.out = mapeval_map(fd_out, job.outsize, 1);
+        }
+        if (!job.in || !job.out)
+            ret = -1;
+    }
+    if (fd_in >= 0)
+        close(fd_in);
+    if (fd_out >= 0)
+        close(fd_out); // the mappings stay valid
+
+    if (!ret && job.count) {
+        job.buffered = !job.opt.columns || in_place;
+        pthread_mutex_init(&job.lock, NULL);
+        pthread_cond_init(&job.cond, NULL);
+        pthread_t prefetcher;
+        const int prefetching = job.opt.ahead > 0 && job.count > job.opt.chunk
+            && !pthread_create(&prefetcher, NULL, mapeval_prefetch, &job);
+        for (size_t b = 0; b < job.count; b += job.opt.chunk) {
+            pthread_mutex_lock(&job.lock);
+            job.current = b / job.opt.chunk;
+            pthread_cond_signal(&job.cond);
+            pthread_mutex_unlock(&job.lock);
+            const size_t n = b + job.opt.chunk < job.count ? job.opt.chunk : job.count - b;
+            job.offset = b;
+            parallel_for(job.opt.nthreads, (long)n, 16 * MAPEVAL_BLOCK, mapeval_body, &job);
+        }
+        pthread_mutex_lock(&job.lock);
+        job.done = 1;
+        pthread_cond_signal(&job.cond);
+        pthread_mutex_unlock(&job.lock);
+        if (prefetching)
+            pthread_join(prefetcher, NULL);
+        pthread_cond_destroy(&job.cond);
+        pthread_mutex_destroy(&job.lock);
+    }
+    if (job.out && job.out != job.in)
+        munmap(job.out, job.outsize);
+    if (job.in)
+        munmap(job.in, job.insize);
+    if (count && !ret)
+        *count = job.count;
+    return ret;
+}
+
+#endif // MAPEVAL_H
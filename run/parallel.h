@@ -0,0 +1,118 @@
+/* Library libcerf:
+ *   Compute complex error functions, based on a new implementation of
+ *   Faddeeva's w_of_z. Also provide Dawson and Voigt functions.
+ *
+ * File parallel.h:
+ *   Minimal parallel loop over chunks of an index range, with POSIX threads.
+ *
+ * Copyright:
+ *   (C) 2026 Forschungszentrum Jülich GmbH
+ *
+ * Licence:
+ *   Public domain.
+ *
+ * Website:
+ *   http://apps.jcns.fz-juelich.de/libcerf
+ */
+
+/*
+   parallel_for(nthreads, n, chunk, body, ctx) calls body(ctx, thread, begin, end)
+   for consecutive chunks [begin, end) of [0, n). Threads fetch chunks from a shared counter,
+   so that the load is balanced even if the cost per index varies a lot.
+   The calling thread participates as thread 0.
+
+   With PARALLEL_SERIAL defined, for programs built without threads, parallel_for runs all
+   chunks in the calling thread, and parallel_nproc returns 1.
+*/
+
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+typedef void (*parallel_body_t)(void* ctx, int thread, long begin, long end);
+
+#ifdef PARALLEL_SERIAL
+
+static inline int parallel_nproc(void)
+{
+    return 1;
+}
+
+static inline void parallel_for(int nthreads, long n, long chunk, parallel_body_t body, void* ctx)
+{
+    (void)nthreads;
+    chunk = chunk > 0 ? chunk : 1;
+    for (long begin = 0; begin < n; begin += chunk)
+        body(ctx, 0, begin, begin + chunk < n ? begin + chunk : n);
+}
+
+#else // PARALLEL_SERIAL
+
+#include <pthread.h>
+#include <unistd.h>
+
+typedef struct {
+    parallel_body_t body;
+    void* ctx;
+    long n, chunk, next;
+    pthread_mutex_t lock;
+} parallel_job_t;
+
+typedef struct {
+    parallel_job_t* job;
+    int thread;
+} parallel_worker_t;
+
+//! Returns the number of online processors.
+static inline int parallel_nproc(void)
+{
+    const long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return n > 0 ? (int)n : 1;
+}
+
+static inline void* parallel_work(void* arg)
+{
+    const parallel_worker_t* w = (const parallel_worker_t*)arg;
+    parallel_job_t* job = w->job;
+    for (;;) {
+        pthread_mutex_lock(&job->lock);
+        const long begin = job->next;
+        job->next += job->chunk;
+        pthread_mutex_unlock(&job->lock);
+        if (begin >= job->n)
+            break;
+        const long end = begin + job->chunk < job->n ? begin + job->chunk : job->n;
+        job->body(job->ctx, w->thread, begin, end);
+    }
+    return NULL;
+}
+
+//! Runs body over [0, n) in chunks, with up to nthreads threads (at most 256).
+static inline void parallel_for(int nthreads, long n, long chunk, parallel_body_t body, void* ctx)
+{
+    enum { MAXTHREADS = 256 };
+    parallel_job_t job;
+    job.body = body;
+    job.ctx = ctx;
+    job.n = n;
+    job.chunk = chunk > 0 ? chunk : 1;
+    job.next = 0;
+    pthread_mutex_init(&job.lock, NULL);
+    nthreads = nthreads < 1 ? 1 : nthreads > MAXTHREADS ? MAXTHREADS : nthreads;
+    pthread_t tid[MAXTHREADS];
+    parallel_worker_t worker[MAXTHREADS];
+    int nstarted = 1;
+    for (int t = 0; t < nthreads; ++t) {
+        worker[t].job = &job;
+        worker[t].thread = t;
+    }
+    for (int t = 1; t < nthreads; ++t, ++nstarted)
+        if (pthread_create(&tid[t], NULL, parallel_work, &worker[t]))
+            break; // continue with fewer threads
+    parallel_work(&worker[0]);
+    for (int t = 1; t < nstarted; ++t)
+        pthread_join(tid[t], NULL);
+    pthread_mutex_destroy(&job.lock);
+}
+
+#endif // PARALLEL_SERIAL
+#endif // PARALLEL_H
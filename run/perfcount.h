@@ -0,0 +1,108 @@
+/* Library libcerf:
+ *   Compute complex error functions, based on a new implementation of
+ *   Faddeeva's w_of_z. Also provide Dawson and Voigt functions.
+ *
+ * File perfcount.h:
+ *   Read hardware performance counters through the Linux system call perf_event_open.
+ *
+ * Copyright:
+ *   (C) 2026 Forschungszentrum Jülich GmbH
+ *
+ * Licence:
+ *   Public domain.
+ *
+ * Website:
+ *   http://apps.jcns.fz-juelich.de/libcerf
+ */
+
+/*
+   Counters are opened one by one, so that the others remain usable if some of them are
+   not supported (e.g. in virtual machines), or not permitted (see
+   /proc/sys/kernel/perf_event_paranoid). Only user-space events of the calling thread
+   are counted. If the kernel multiplexes counters, the counts are extrapolated.
+
+   Linux only; see run/CMakeLists.txt.
+*/
+
+#ifndef PERFCOUNT_H
+#define PERFCOUNT_H
+
+#include <linux/perf_event.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+enum { NPERF = 5 };
+
+static const char* const perfcount_names[NPERF] = {
+    "cycles", "instr", "br-miss", "L1D-miss", "LLC-miss"};
+
+typedef struct {
+    int fd[NPERF]; // file descriptor per counter, or -1 if not available
+} perfcount_t;
+
+//! Opens all counters, in disabled state. Returns the number of available counters.
+static int perfcount_open(perfcount_t* pc)
+{
+    static const unsigned type[NPERF] = {
+        PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE,
+        PERF_TYPE_HW_CACHE, PERF_TYPE_HW_CACHE};
+    static const unsigned long long config[NPERF] = {
+        PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_BRANCH_MISSES,
+        PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8)
+            | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16),
+        PERF_COUNT_HW_CACHE_LL | (PERF_COUNT_HW_CACHE_OP_READ << 8)
+            | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)};
+    int n = 0;
+    for (int k = 0; k < NPERF; ++k) {
+        struct perf_event_attr attr;
+        memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = type[k];
+        attr.config = config[k];
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+        pc->fd[k] = (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+        if (pc->fd[k] >= 0)
+            ++n;
+    }
+    return n;
+}
+
+static void perfcount_close(perfcount_t* pc)
+{
+    for (int k = 0; k < NPERF; ++k)
+        if (pc->fd[k] >= 0)
+            close(pc->fd[k]);
+}
+
+//! Resets and enables all available counters.
+static void perfcount_start(perfcount_t* pc)
+{
+    for (int k = 0; k < NPERF; ++k) {
+        if (pc->fd[k] >= 0) {
+            ioctl(pc->fd[k], PERF_EVENT_IOC_RESET, 0);
+            ioctl(pc->fd[k], PERF_EVENT_IOC_ENABLE, 0);
+        }
+    }
+}
+
+//! Disables all counters, and sets val[k] to the count, or to -1 if counter k is not available.
+static void perfcount_stop(perfcount_t* pc, double* val)
+{
+    for (int k = 0; k < NPERF; ++k)
+        if (pc->fd[k] >= 0)
+            ioctl(pc->fd[k], PERF_EVENT_IOC_DISABLE, 0);
+    for (int k = 0; k < NPERF; ++k) {
+        unsigned long long buf[3]; // value, time enabled, time running
+        val[k] = -1;
+        if (pc->fd[k] >= 0 && read(pc->fd[k], buf, sizeof(buf)) == (ssize_t)sizeof(buf)
+            && buf[2] > 0)
+            val[k] = (double)buf[0] * ((double)buf[1] / (double)buf[2]);
+    }
+}
+
+#endif // PERFCOUNT_H
@@ -0,0 +1,361 @@
+/* Library libcerf:
+ *   Compute complex error functions, based on a new implementation of
+ *   Faddeeva's w_of_z. Also provide Dawson and Voigt functions.
+ *
+ * File perffuzz.c:
+ *   Search for arguments that maximize the time per call (performance fuzzer),
+ *   and replay the resulting corpus as a benchmark.
+ *
+ * Copyright:
+ *   (C) 2026 Forschungszentrum Jülich GmbH
+ *
+ * Licence:
+ *   Public domain.
+ *
+ * Website:
+ *   http://apps.jcns.fz-juelich.de/libcerf
+ */
+
+/*
+   For each function, a guided random search is run: new arguments are either drawn at random,
+   or obtained by mutating an argument from the corpus. The fitness is the number of ticks
+   per call (minimum of several repetitions, to suppress noise; see ticks.h).
+   If the library is built with CERF_INTROSPECT, the algorithm code cerf_algorithm serves
+   as coverage feedback: the corpus keeps the slowest argument for each algorithm code,
+   so that the search explores all code paths, instead of only climbing the highest peak.
+   Without CERF_INTROSPECT, only the slowest argument per function is kept.
+
+   The corpus is written to stdout, one line per entry:
+       function  algorithm  ticks  arguments...
+   In replay mode, the arguments are read from a corpus file, and timed again; the exit code
+   is nonzero if the file contains malformed lines or unknown functions. The replay of
+   run/perffuzz_corpus.txt is registered as a CTest with label benchmark.
+
+   A corpus, obtained with CERF_INTROSPECT, is in run/perffuzz_corpus.txt.
+
+   Usage:
+       perffuzz [number of evaluations per function, default 20000] > corpus
+       perffuzz replay corpus
+*/
+
+#include "cerf.h"
+#include "defs.h"
+#include "ticks.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef CERF_INTROSPECT
+IMPORT extern int cerf_algorithm;
+IMPORT extern int cerf_nofterms;
+#endif
+
+/******************************************************************************/
+/*  Functions under test                                                      */
+/******************************************************************************/
+
+enum { LOGSIGNED, LOGPOS, LIN }; // kinds of parameter domain
+
+typedef struct {
+    int kind;
+    double lo, hi; // decimal exponents for LOGSIGNED and LOGPOS, values for LIN
+} domain_t;
+
+enum { MAXPAR = 4 };
+
+typedef struct {
+    const char* name;
+    double (*call)(const double* p);
+    int np;
+    domain_t dom[MAXPAR];
+} target_t;
+
+#define CMPLX_TARGET(f)                                                                            \
+    static double call_##f(const double* p)                                                        \
+    {                                                                                              \
+        const _cerf_cmplx w = f(C(p[0], p[1]));                                                    \
+        return creal(w) + cimag(w);                                                                \
+    }
+#define REAL_TARGET(f)                                                                             \
+    static double call_##f(const double* p)                                                        \
+    {                                                                                              \
+        return f(p[0]);                                                                            \
+    }
+
+CMPLX_TARGET(w_of_z)
+CMPLX_TARGET(cerf)
+CMPLX_TARGET(cerfc)
+CMPLX_TARGET(cerfcx)
+CMPLX_TARGET(cerfi)
+CMPLX_TARGET(cdawson)
+CMPLX_TARGET(plasma_zprime)
+REAL_TARGET(erfcx)
+REAL_TARGET(im_w_of_x)
+REAL_TARGET(dawson)
+REAL_TARGET(erfi)
+REAL_TARGET(erfc_real)
+REAL_TARGET(log_erfc)
+REAL_TARGET(erfcx_inv)
+REAL_TARGET(erfc_inv)
+
+static double call_voigt(const double* p)
+{
+    return voigt(p[0], p[1], p[2]);
+}
+
+static double call_voigt_hwhm(const double* p)
+{
+    return voigt_hwhm(p[0], p[1]);
+}
+
+static double call_emg(const double* p)
+{
+    return emg(p[0], p[1], p[2], p[3]);
+}
+
+#define S {LOGSIGNED, -20, 20}
+#define P {LOGPOS, -20, 20}
+
+static const target_t targets[] = {
+    {"w_of_z", call_w_of_z, 2, {S, S}},
+    {"cerf", call_cerf, 2, {S, S}},
+    {"cerfc", call_cerfc, 2, {S, S}},
+    {"cerfcx", call_cerfcx, 2, {S, S}},
+    {"cerfi", call_cerfi, 2, {S, S}},
+    {"cdawson", call_cdawson, 2, {S, S}},
+    {"plasma_zprime", call_plasma_zprime, 2, {S, S}},
+    {"erfcx", call_erfcx, 1, {S}},
+    {"im_w_of_x", call_im_w_of_x, 1, {S}},
+    {"dawson", call_dawson, 1, {S}},
+    {"erfi", call_erfi, 1, {S}},
+    {"erfc_real", call_erfc_real, 1, {S}},
+    {"log_erfc", call_log_erfc, 1, {S}},
+    {"erfcx_inv", call_erfcx_inv, 1, {P}},
+    {"erfc_inv", call_erfc_inv, 1, {{LIN, 0, 2}}},
+    {"voigt", call_voigt, 3, {S, P, P}},
+    {"voigt_hwhm", call_voigt_hwhm, 2, {P, P}},
+    {"emg", call_emg, 4, {S, S, P, P}},
+};
+enum { NTARGET = sizeof(targets) / sizeof(targets[0]) };
+
+#undef S
+#undef P
+
+/******************************************************************************/
+/*  Measurement                                                               */
+/******************************************************************************/
+
+static double sink = 0;
+
+//! Returns the minimum number of ticks per call over nrep calls; sets *algo.
+static uint64_t measure(const target_t* t, const double* p, int nrep, int* algo)
+{
+    uint64_t best = UINT64_MAX;
+    for (int r = 0; r < nrep; ++r) {
+        const uint64_t t0 = tick_start();
+        sink += t->call(p);
+        const uint64_t t1 = tick_stop();
+        if (t1 - t0 < best)
+            best = t1 - t0;
+    }
+#ifdef CERF_INTROSPECT
+    *algo = cerf_algorithm;
+#else
+    *algo = -1;
+#endif
+    return best;
+}
+
+/******************************************************************************/
+/*  Search                                                                    */
+/******************************************************************************/
+
+static uint64_t rng_state = 4711;
+
+//! Returns a pseudo-random number in [0, 1).
+static double rnd(void)
+{
+    rng_state = rng_state * 6364136223846793005UL + 1442695040888963407UL;
+    return (double)(rng_state >> 11) * 0x1p-53;
+}
+
+static double random_param(const domain_t* d)
+{
+    if (d->kind == LIN)
+        return d->lo + (d->hi - d->lo) * rnd();
+    // Mostly moderate exponents, sometimes the full range of double.
+    const double e = rnd() < .9 ? d->lo + (d->hi - d->lo) * rnd() : -320 + 628 * rnd();
+    const double v = pow(10., e);
+    return d->kind == LOGSIGNED && rnd() < .5 ? -v : v;
+}
+
+static double clamp_param(const domain_t* d, double v)
+{
+    if (d->kind == LIN)
+        return v < d->lo ? d->lo : v > d->hi ? d->hi : v;
+    if (d->kind == LOGPOS)
+        return fabs(v);
+    return v;
+}
+
+static void mutate(const target_t* t, double* p)
+{
+    const int k = (int)(t->np * rnd());
+    const double u = rnd();
+    if (u < .5) {
+        // Relative change on different scales: jumps, local search, and tile boundaries.
+        static const double scale[4] = {1, 1e-2, 1e-6, 1e-12};
+        const double s = scale[(int)(4 * rnd())];
+        p[k] *= exp(s * (2 * rnd() - 1));
+    } else if (u < .7) {
+        // A few ulps.
+        const int n = 1 + (int)(8 * rnd());
+        for (int i = 0; i < n; ++i)
+            p[k] = nextafter(p[k], rnd() < .5 ? -Inf : Inf);
+    } else if (u < .8) {
+        p[k] = -p[k];
+    } else if (u < .9 && t->np > 1) {
+        const int l = (k + 1) % t->np; // exchange magnitudes of two parameters
+        const double v = p[k];
+        p[k] = copysign(p[l], v);
+        p[l] = copysign(v, p[l]);
+    } else {
+        p[k] = random_param(&t->dom[k]);
+    }
+    for (int i = 0; i < t->np; ++i)
+        p[i] = clamp_param(&t->dom[i], p[i]);
+}
+
+enum { MAXCORPUS = 256, NREP = 5, NCONFIRM = 25 };
+
+typedef struct {
+    int algo;
+    uint64_t ticks;
+    double p[MAXPAR];
+} entry_t;
+
+static int by_ticks(const void* a, const void* b)
+{
+    const uint64_t ta = ((const entry_t*)a)->ticks, tb = ((const entry_t*)b)->ticks;
+    return ta < tb ? 1 : ta > tb ? -1 : 0;
+}
+
+static void fuzz(const target_t* t, long neval)
+{
+    static entry_t corpus[MAXCORPUS];
+    int n = 0;
+    for (long i = 0; i < neval; ++i) {
+        double p[MAXPAR];
+        if (n == 0 || rnd() < .2) {
+            for (int k = 0; k < t->np; ++k)
+                p[k] = random_param(&t->dom[k]);
+        } else {
+            memcpy(p, corpus[(int)(n * rnd())].p, sizeof(p));
+            mutate(t, p);
+        }
+        int algo;
+        uint64_t ticks = measure(t, p, NREP, &algo);
+        int j = 0;
+        while (j < n && corpus[j].algo != algo)
+            ++j;
+        if (j < n && ticks <= corpus[j].ticks)
+            continue;
+        // Confirm, to reject outliers caused by interrupts etc.
+        ticks = measure(t, p, NCONFIRM, &algo);
+        if (j < n && ticks <= corpus[j].ticks)
+            continue;
+        if (j == n) {
+            if (n == MAXCORPUS)
+                continue;
+            ++n;
+        }
+        corpus[j].algo = algo;
+        corpus[j].ticks = ticks;
+        memcpy(corpus[j].p, p, sizeof(p));
+    }
+    qsort(corpus, n, sizeof(entry_t), by_ticks);
+    for (int j = 0; j < n; ++j) {
+        printf("%-14s %5i %7lu", t->name, corpus[j].algo, (unsigned long)corpus[j].ticks);
+        for (int k = 0; k < t->np; ++k)
+            printf(" %24.17g", corpus[j].p[k]);
+        printf("\n");
+    }
+    fflush(stdout);
+}
+
+/******************************************************************************/
+/*  Replay                                                                    */
+/******************************************************************************/
+
+static int replay(const char* fname)
+{
+    FILE* f = fopen(fname, "r");
+    if (!f) {
+        fprintf(stderr, "cannot open %s\n", fname);
+        return 1;
+    }
+    printf("function       algo   ticks (min, median of %i calls), arguments\n", 101);
+    char line[512];
+    int nerr = 0;
+    while (fgets(line, sizeof(line), f)) {
+        char name[64];
+        int pos = -1; // stays unset if the line ends before the ticks column
+        if (line[0] == '#' || line[strspn(line, " \t\r\n")] == '\0')
+            continue;
+        if (sscanf(line, "%63s %*d %*u%n", name, &pos) != 1 || pos < 0) {
+            fprintf(stderr, "malformed corpus line: %s", line);
+            ++nerr;
+            continue;
+        }
+        const target_t* t = NULL;
+        for (int i = 0; i < NTARGET; ++i)
+            if (!strcmp(targets[i].name, name))
+                t = &targets[i];
+        if (!t) {
+            fprintf(stderr, "unknown function %s\n", name);
+            ++nerr;
+            continue;
+        }
+        double p[MAXPAR] = {0, 0, 0, 0};
+        const char* s = line + pos;
+        for (int k = 0; k < t->np; ++k) {
+            char* end;
+            p[k] = strtod(s, &end);
+            s = end;
+        }
+        uint64_t tt[101];
+        int algo = -1;
+        for (int r = 0; r < 101; ++r)
+            tt[r] = measure(t, p, 1, &algo);
+        for (int r = 1; r < 101; ++r) // insertion sort
+            for (int q = r; q > 0 && tt[q] < tt[q - 1]; --q) {
+                const uint64_t v = tt[q];
+                tt[q] = tt[q - 1];
+                tt[q - 1] = v;
+            }
+        printf("%-14s %5i %7lu %7lu", name, algo, (unsigned long)tt[0], (unsigned long)tt[50]);
+        for (int k = 0; k < t->np; ++k)
+            printf(" %.17g", p[k]);
+        printf("\n");
+    }
+    fclose(f);
+    return nerr > 0;
+}
+
+int main(int argc, char** argv)
+{
+    if (argc == 3 && !strcmp(argv[1], "replay"))
+        return replay(argv[2]) || sink == 42;
+    if (argc > 2) {
+        fprintf(stderr, "Usage: %s [evaluations per function] | replay <corpus>\n", argv[0]);
+        return 1;
+    }
+    const long neval = argc > 1 ? atol(argv[1]) : 20000;
+    printf("# corpus of slow arguments, written by perffuzz with %li evaluations per function\n",
+           neval);
+    printf("# function    algo   ticks  arguments\n");
+    for (int i = 0; i < NTARGET; ++i)
+        fuzz(&targets[i], neval);
+    return sink == 42; // use sink, so that the compiler cannot drop the calls
+}
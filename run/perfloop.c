@@ -0,0 +1,153 @@
+/* Library libcerf:
+ *   Compute complex error functions, based on a new implementation of
+ *   Faddeeva's w_of_z. Also provide Dawson and Voigt functions.
+ *
+ * File perfloop.c:
+ *   Measure time and hardware performance counters per call, for several functions
+ *   and input distributions.
+ *
+ * Copyright:
+ *   (C) 2026 Forschungszentrum Jülich GmbH
+ *
+ * Licence:
+ *   Public domain.
+ *
+ * Website:
+ *   http://apps.jcns.fz-juelich.de/libcerf
+ */
+
+/*
+   For each function, the arguments are drawn from ranges that select one algorithm
+   (e.g. Taylor tiles or asymptotic expansion of w_of_z, negative or positive x for erfcx),
+   and from a mixed range in random order, where branches are unpredictable.
+   Per call, the program reports time, cycles, instructions, branch misses, L1 data cache misses,
+   and last-level cache misses. Counters that are not available are shown as "-".
+
+   Linux only, because counters are read through perf_event_open.
+
+   Usage:
+       perfloop [number of calls per test, default 2^22]
+*/
+
+#include "cerf.h"
+#include "defs.h"
+#include "perfcount.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+enum { M = 1 << 12 }; // number of different arguments per test
+
+static perfcount_t pc;
+static double sink = 0;
+
+static void report(const char* name, const char* range, double t, const double* val, long n)
+{
+    printf("%-10s %-22s %8.2f", name, range, 1e9 * t / n);
+    for (int k = 0; k < NPERF; ++k) {
+        if (val[k] < 0)
+            printf(" %9s", "-");
+        else
+            printf(" %9.3f", val[k] / n);
+    }
+    printf("\n");
+}
+
+//! Fills x with M points in [lo, hi]; in random order if shuffle is set.
+static void fill(double* x, double lo, double hi, int shuffle)
+{
+    for (int i = 0; i < M; ++i)
+        x[i] = lo + (hi - lo) * (i + .5) / M;
+    if (!shuffle)
+        return;
+    unsigned long s = 12345;
+    for (int i = M - 1; i > 0; --i) {
+        s = s * 6364136223846793005UL + 1442695040888963407UL;
+        const int j = (int)((s >> 33) % (unsigned long)(i + 1));
+        const double t = x[i];
+        x[i] = x[j];
+        x[j] = t;
+    }
+}
+
+static void test_real(const char* name, double (*f)(double), double lo, double hi, int shuffle,
+                      long n)
+{
+    double x[M], val[NPERF];
+    fill(x, lo, hi, shuffle);
+    double s = 0;
+    perfcount_start(&pc);
+    const clock_t t0 = clock();
+    for (long i = 0; i < n; ++i)
+        s += f(x[i % M]);
+    const clock_t t1 = clock();
+    perfcount_stop(&pc, val);
+    sink += s;
+    char range[40];
+    snprintf(range, 40, "%g .. %g%s", lo, hi, shuffle ? " rnd" : "");
+    report(name, range, (double)(t1 - t0) / CLOCKS_PER_SEC, val, n);
+}
+
+static void test_cmplx(const char* name, _cerf_cmplx (*f)(_cerf_cmplx), double rlo, double rhi,
+                       int shuffle, long n)
+{
+    // Points on a polar grid in the upper half plane, with radii from [rlo, rhi].
+    double r[M], phi[M], val[NPERF];
+    fill(r, rlo, rhi, shuffle);
+    fill(phi, 0.01, 3.13, 1);
+    _cerf_cmplx* z = (_cerf_cmplx*)malloc(M * sizeof(_cerf_cmplx));
+    for (int i = 0; i < M; ++i)
+        z[i] = C(r[i] * cos(phi[i]), r[i] * sin(phi[i]));
+    _cerf_cmplx s = C(0, 0);
+    perfcount_start(&pc);
+    const clock_t t0 = clock();
+    for (long i = 0; i < n; ++i)
+        s += f(z[i % M]);
+    const clock_t t1 = clock();
+    perfcount_stop(&pc, val);
+    sink += creal(s);
+    free(z);
+    char range[40];
+    snprintf(range, 40, "|z| %g .. %g%s", rlo, rhi, shuffle ? " rnd" : "");
+    report(name, range, (double)(t1 - t0) / CLOCKS_PER_SEC, val, n);
+}
+
+static double voigt_1_1(double x)
+{
+    return voigt(x, 1, 1);
+}
+
+int main(int argc, char** argv)
+{
+    const long n = argc > 1 ? atol(argv[1]) : 1L << 22;
+    if (!perfcount_open(&pc))
+        printf("No performance counters available, only time is measured\n");
+
+    printf("function   arguments                    ns");
+    for (int k = 0; k < NPERF; ++k)
+        printf(" %9s", perfcount_names[k]);
+    printf("   [per call]\n");
+
+    test_real("erfcx", erfcx, 0.01, 0.12, 0, n); // Taylor series
+    test_real("erfcx", erfcx, 0.13, 12, 0, n); // Chebyshev interpolants
+    test_real("erfcx", erfcx, 60, 100, 0, n); // asymptotic expansion
+    test_real("erfcx", erfcx, -6, -0.13, 0, n); // negative arguments
+    test_real("erfcx", erfcx, -6, 12, 1, n);
+    test_real("im_w_of_x", im_w_of_x, 0.1, 0.5, 0, n); // Taylor series
+    test_real("im_w_of_x", im_w_of_x, 0.6, 11.9, 0, n); // Chebyshev interpolants
+    test_real("im_w_of_x", im_w_of_x, 13, 100, 0, n); // asymptotic expansion
+    test_real("im_w_of_x", im_w_of_x, -100, 100, 1, n);
+    test_real("erfc_real", erfc_real, -6, 6, 1, n);
+    test_real("dawson", dawson, -5, 5, 1, n);
+    test_real("voigt", voigt_1_1, -10, 10, 1, n);
+    test_cmplx("w_of_z", w_of_z, 0.01, 0.2, 0, n); // Maclaurin series
+    test_cmplx("w_of_z", w_of_z, 0.3, 6.8, 0, n); // Taylor tiles
+    test_cmplx("w_of_z", w_of_z, 7.1, 50, 0, n); // asymptotic expansion
+    test_cmplx("w_of_z", w_of_z, 0.01, 50, 1, n);
+    test_cmplx("cerf", cerf, 0.01, 10, 1, n);
+    test_cmplx("cdawson", cdawson, 0.01, 10, 1, n);
+
+    perfcount_close(&pc);
+    return sink == 42; // use sink, so that the compiler cannot drop the loops
+}
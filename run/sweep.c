@@ -0,0 +1,290 @@
+/* Library libcerf:
+ *   Compute complex error functions, based on a new implementation of
+ *   Faddeeva's w_of_z. Also provide Dawson and Voigt functions.
+ *
+ * File sweep.c:
+ *   Measure the error in ulp of w_of_z, erfcx, im_w_of_x, and of their array versions,
+ *   at many arguments, against the double-double reference in ddref.h, with several threads.
+ *
+ * Copyright:
+ *   (C) 2026 Forschungszentrum Jülich GmbH
+ *
+ * Licence:
+ *   Public domain.
+ *
+ * Website:
+ *   http://apps.jcns.fz-juelich.de/libcerf
+ */
+
+/*
+   Arguments are pseudo-random, reproducible from their index. For real functions,
+   |x| is log-uniform in [rmin, rmax], with random sign. For complex functions, z is in the
+   first quadrant (the others follow by symmetry), |z| is log-uniform in [rmin, rmax];
+   half of the points have a uniformly distributed phase, the others are close to the real
+   or the imaginary axis (phase or pi/2 - phase log-uniform in [1e-16, 1]), where one of the
+   components of w is small. Errors are measured componentwise.
+
+   Results: maximum error with its argument, mean error, and a histogram of errors.
+   If a limit is given, the return code is 1 if the maximum error exceeds the limit.
+
+   Usage:
+       sweep <function> [points, default 1e6] [threads, default all] [rmin rmax] [limit]
+       sweep ref <function> <x> [y]     (prints reference value as hi lo [hi lo])
+   Functions: w_of_z, w_of_z_array, w_of_z_rational, erfcx, erfcx_array, im_w_of_x.
+*/
+
+#include "cerf.h"
+#include "ddref.h"
+#include "defs.h"
+#include "parallel.h"
+#include "ulpstats.h"
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/******************************************************************************/
+/*  Functions under test                                                      */
+/******************************************************************************/
+
+enum { BLOCK = 1024 }; // arguments per call of an array function
+
+typedef struct {
+    const char* name;
+    int complex_arg;
+    //! Computes n function values f = (fr, fi) for arguments (x, y).
+    void (*eval)(int n, const double* x, const double* y, double* fr, double* fi);
+} target_t;
+
+static void eval_w_of_z(int n, const double* x, const double* y, double* fr, double* fi)
+{
+    for (int i = 0; i < n; ++i) {
+        const _cerf_cmplx w = w_of_z(C(x[i], y[i]));
+        fr[i] = creal(w);
+        fi[i] = cimag(w);
+    }
+}
+
+static void eval_w_of_z_array(int n, const double* x, const double* y, double* fr, double* fi)
+{
+    w_of_z_array(n, x, y, fr, fi, CERF_W_DEFAULT);
+}
+
+static void eval_w_of_z_rational(int n, const double* x, const double* y, double* fr, double* fi)
+{
+    w_of_z_array(n, x, y, fr, fi, CERF_W_RATIONAL);
+}
+
+static void eval_erfcx(int n, const double* x, const double* y, double* fr, double* fi)
+{
+    (void)y;
+    (void)fi;
+    for (int i = 0; i < n; ++i)
+        fr[i] = erfcx(x[i]);
+}
+
+static void eval_erfcx_array(int n, const double* x, const double* y, double* fr, double* fi)
+{
+    (void)y;
+    (void)fi;
+    erfcx_array(n, x, fr);
+}
+
+static void eval_im_w_of_x(int n, const double* x, const double* y, double* fr, double* fi)
+{
+    (void)y;
+    (void)fi;
+    for (int i = 0; i < n; ++i)
+        fr[i] = im_w_of_x(x[i]);
+}
+
+static const target_t targets[] = {
+    {"w_of_z", 1, eval_w_of_z},
+    {"w_of_z_array", 1, eval_w_of_z_array},
+    {"w_of_z_rational", 1, eval_w_of_z_rational},
+    {"erfcx", 0, eval_erfcx},
+    {"erfcx_array", 0, eval_erfcx_array},
+    {"im_w_of_x", 0, eval_im_w_of_x},
+};
+enum { NTARGET = sizeof(targets) / sizeof(targets[0]) };
+
+static const target_t* find_target(const char* name)
+{
+    for (int i = 0; i < NTARGET; ++i)
+        if (!strcmp(targets[i].name, name))
+            return &targets[i];
+    fprintf(stderr, "unknown function %s\n", name);
+    return NULL;
+}
+
+//! Computes the reference value (one component for real functions).
+static void reference(const target_t* t, double x, double y, dd_t* vr, dd_t* vi)
+{
+    if (t->complex_arg) {
+        ddref_w(x, y, vr, vi);
+    } else if (!strncmp(t->name, "erfcx", 5)) {
+        *vr = ddref_erfcx(x);
+    } else {
+        *vr = ddref_im_w_of_x(x);
+    }
+}
+
+/******************************************************************************/
+/*  Arguments                                                                 */
+/******************************************************************************/
+
+static uint64_t splitmix64(uint64_t z)
+{
+    z += 0x9e3779b97f4a7c15UL;
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9UL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebUL;
+    return z ^ (z >> 31);
+}
+
+//! Returns a pseudo-random number in [0, 1), determined by index i and stream k.
+static double uniform(long i, int k)
+{
+    return (double)(splitmix64(4 * (uint64_t)i + k) >> 11) * 0x1p-53;
+}
+
+static double lrmin, lrmax; // decimal logarithms of the range of |z| or |x|
+
+static void argument(const target_t* t, long i, double* x, double* y)
+{
+    const double r = pow(10., lrmin + (lrmax - lrmin) * uniform(i, 0));
+    if (!t->complex_arg) {
+        *x = uniform(i, 1) < .5 ? -r : r;
+        *y = 0;
+        return;
+    }
+    const double u = uniform(i, 1);
+    const double v = uniform(i, 2);
+    double phi;
+    if (u < .5)
+        phi = v * 1.5707963267948966;
+    else if (u < .75)
+        phi = pow(10., -16 * v);
+    else
+        phi = 1.5707963267948966 - pow(10., -16 * v);
+    *x = r * cos(phi);
+    *y = r * sin(phi);
+}
+
+/******************************************************************************/
+/*  Error statistics                                                          */
+/******************************************************************************/
+
+typedef struct {
+    const target_t* t;
+    stats_t* stats; // one per thread
+} job_t;
+
+static void body(void* ctx, int thread, long begin, long end)
+{
+    const job_t* job = (const job_t*)ctx;
+    const target_t* t = job->t;
+    stats_t* s = &job->stats[thread];
+    double x[BLOCK], y[BLOCK], fr[BLOCK], fi[BLOCK];
+    for (long i0 = begin; i0 < end; i0 += BLOCK) {
+        const int n = end - i0 < BLOCK ? (int)(end - i0) : BLOCK;
+        for (int j = 0; j < n; ++j)
+            argument(t, i0 + j, &x[j], &y[j]);
+        t->eval(n, x, y, fr, fi);
+        for (int j = 0; j < n; ++j) {
+            dd_t vr, vi = dd_make(0, 0);
+            reference(t, x[j], y[j], &vr, &vi);
+            if (isnan(vr.hi) || isnan(vi.hi)) {
+                s->skipped++;
+                continue;
+            }
+            s->count++;
+            stats_record(s, 0, ulp_error(fr[j], vr), x[j], y[j]);
+            if (t->complex_arg)
+                stats_record(s, 1, ulp_error(fi[j], vi), x[j], y[j]);
+        }
+    }
+}
+
+static void print_stats(const target_t* t, const stats_t* s)
+{
+    for (int k = 0; k < 1 + t->complex_arg; ++k) {
+        const char* part = t->complex_arg ? (k ? "Im " : "Re ") : "";
+        printf("%s", part);
+        stats_print_max(s, k, t->complex_arg, "ulp");
+        printf("%shistogram:", part);
+        stats_print_hist(s, k);
+    }
+}
+
+/******************************************************************************/
+/*  Main                                                                      */
+/******************************************************************************/
+
+static double now(void)
+{
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return ts.tv_sec + 1e-9 * ts.tv_nsec;
+}
+
+static int usage(const char* prog)
+{
+    fprintf(stderr,
+            "Usage: %s <function> [points] [threads] [rmin rmax] [limit]\n"
+            "       %s ref <function> <x> [y]\n"
+            "Functions:",
+            prog, prog);
+    for (int i = 0; i < NTARGET; ++i)
+        fprintf(stderr, " %s", targets[i].name);
+    fprintf(stderr, "\n");
+    return 1;
+}
+
+int main(int argc, char** argv)
+{
+    if (argc >= 4 && !strcmp(argv[1], "ref")) {
+        const target_t* t = find_target(argv[2]);
+        if (!t)
+            return 1;
+        const double x = atof(argv[3]), y = argc > 4 ? atof(argv[4]) : 0;
+        dd_t vr, vi = dd_make(0, 0);
+        reference(t, x, y, &vr, &vi);
+        // hi with enough digits to be exact to about 1e-35 relative, for comparison with mpmath.
+        printf("%.35e %.17e", vr.hi, vr.lo);
+        if (t->complex_arg)
+            printf(" %.35e %.17e", vi.hi, vi.lo);
+        printf("\n");
+        return 0;
+    }
+    if (argc < 2 || argc == 5 || argc > 7)
+        return usage(argv[0]);
+    const target_t* t = find_target(argv[1]);
+    if (!t)
+        return usage(argv[0]);
+    const long npoints = argc > 2 ? (long)atof(argv[2]) : 1000000;
+    const int nthreads = argc > 3 ? atoi(argv[3]) : parallel_nproc();
+    lrmin = argc > 5 ? log10(atof(argv[4])) : t->complex_arg ? -8 : -10;
+    lrmax = argc > 5 ? log10(atof(argv[5])) : t->complex_arg ? 8 : 10;
+    const double limit = argc > 6 ? atof(argv[6]) : INFINITY;
+
+    stats_t* stats = (stats_t*)calloc(nthreads, sizeof(stats_t));
+    if (!stats)
+        return 1;
+    job_t job = {t, stats};
+    const double t0 = now();
+    parallel_for(nthreads, npoints, 16 * BLOCK, body, &job);
+    const double t1 = now();
+
+    stats_t total;
+    memset(&total, 0, sizeof(total));
+    for (int i = 0; i < nthreads; ++i)
+        stats_merge(&total, &stats[i]);
+    free(stats);
+    printf("%s: %li points with %g <= |%s| <= %g (%li skipped), %i threads, %.1f s, %.3g points/s\n",
+           t->name, total.count, pow(10., lrmin), t->complex_arg ? "z" : "x", pow(10., lrmax),
+           total.skipped, nthreads, t1 - t0, npoints / (t1 - t0));
+    print_stats(t, &total);
+    return fmax(total.max[0], total.max[1]) > limit;
+}
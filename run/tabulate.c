@@ -18,18 +18,54 @@
  *   http://apps.jcns.fz-juelich.de/libcerf
  */
 
+/*
+   Tabulates any function from fctable.h on a grid. Each argument of the function is given
+   either as a number, or as a grid:
+       lin:a:b:n     n equidistant points from a to b
+       log:a:b:n     n points from a to b, equidistant in log|x| (a and b of equal sign)
+       cheb:a:b:n    n Chebyshev nodes of the first kind in (a, b), in ascending order
+   With two grids, the table is the outer product, the last grid varying fastest; in text
+   output, rows are separated by a blank line, as expected by gnuplot's splot.
+
+   Output formats:
+       text    arguments and values per line, as the shortest text that reads back exactly
+               (dtoa.h), or with a given number of significant digits (-p)
+       bin     arguments and values as raw doubles in the byte order of the host
+       rtest   RTEST or ZTEST lines, as in the test sources
+   With -v, only the values are written.
+
+   Points are evaluated and formatted in parallel, in windows of many points; the outputs of
+   the pieces of a window are written in order.
+
+   Usage:
+       tabulate [-o text|bin|rtest] [-t threads] [-p digits] [-v] <function> <arg>...
+       tabulate rtest    (test cases for im_w_of_x, as in test/imwxtest.c)
+   Examples:
+       tabulate dawson lin:-10:10:2001
+       tabulate -o bin w_of_z lin:-8:8:1001 log:1e-3:1e3:601 > w.bin
+       tabulate voigt lin:-5:5:101 1 0.5
+*/
+
 #include "cerf.h"
+#include "dtoa.h"
+#include "fctable.h"
+#include "parallel.h"
+#include <math.h>
 #include <stdio.h>
 #include <stdlib.h>
-#include <math.h>
+#include <string.h>
+
+/******************************************************************************/
+/*  Test cases for im_w_of_x                                                  */
+/******************************************************************************/
 
 static const double R6[6] = { 1.0, 1.5, 2.2, 3.3, 4.7, 6.8 };
 
-void tabulate(double x) {
+static void tabulate(double x) {
     printf( "    RTEST(result, 1e-13, im_w_of_x(%24.15e), %24.15e);\n", x, im_w_of_x(x) );
 }
 
-int main(void)
+static int rtest_imwx(void)
 {
     tabulate(0);
     printf("\n    // rough logarithmic grid\n");
@@ -62,3 +98,286 @@ int main(void)
 
     return 0;
 }
+
+/******************************************************************************/
+/*  Grids                                                                     */
+/******************************************************************************/
+
+enum { GRID_CONST, GRID_LIN, GRID_LOG, GRID_CHEB };
+
+typedef struct {
+    int kind;
+    double a, b;
+    long n;
+} grid_t;
+
+//! Parses a number or a grid specification; returns 0 on success.
+static int parse_grid(const char* s, grid_t* g)
+{
+    static const char* const prefix[] = {"lin:", "log:", "cheb:"};
+    for (int kind = GRID_LIN; kind <= GRID_CHEB; ++kind) {
+        const size_t len = strlen(prefix[kind - 1]);
+        if (strncmp(s, prefix[kind - 1], len))
+            continue;
+        char tail;
+        g->kind = kind;
+        if (sscanf(s + len, "%lf:%lf:%ld%c", &g->a, &g->b, &g->n, &tail) != 3 || g->n < 1)
+            return -1;
+        if (kind == GRID_LOG && !(g->a * g->b > 0))
+            return -1;
+        return 0;
+    }
+    char* end;
+    g->kind = GRID_CONST;
+    g->a = g->b = strtod(s, &end);
+    g->n = 1;
+    return end == s || *end;
+}
+
+//! Returns the k-th point of grid g.
+static double grid_node(const grid_t* g, long k)
+{
+    if (g->n == 1 || g->kind == GRID_CONST)
+        return g->kind == GRID_CHEB ? (g->a + g->b) / 2 : g->a;
+    if (g->kind == GRID_CHEB) // -cos(pi (2k+1) / 2n), as a sine: symmetric, and 0 in the middle
+        return (g->a + g->b) / 2
+            + (g->b - g->a) / 2 * sin(3.141592653589793 * (2 * k + 1 - g->n) / (2 * g->n));
+    // Weighted sum rather than a + k*h, so that "round" points like 0.1 or 1e-2 come out
+    // as the nearest double.
+    const double m = (double)(g->n - 1);
+    if (g->kind == GRID_LIN) {
+        const double x = (g->a * (m - k) + g->b * k) / m;
+        return isfinite(x) ? x : g->a / m * (m - k) + g->b / m * k;
+    }
+    const double la = log10(fabs(g->a)), lb = log10(fabs(g->b));
+    return copysign(pow(10., (la * (m - k) + lb * k) / m), g->a);
+}
+
+/******************************************************************************/
+/*  Evaluation and formatting                                                 */
+/******************************************************************************/
+
+enum { FORMAT_TEXT, FORMAT_BIN, FORMAT_RTEST };
+
+enum { BLOCK = 512 };            // points per call of an array function
+enum { PIECE = 4 * BLOCK };      // points per piece
+enum { MAXPIECE = 64 };          // pieces per window
+
+typedef struct {
+    char* buf;
+    size_t len;
+} outbuf_t;
+
+typedef struct {
+    const fct_t* f;
+    grid_t arg[4];
+    int ngrid;
+    long ninner;  // points per row: size of the last grid
+    long npoints;
+    int format, digits, values_only;
+    size_t linemax; // bytes per point, at most
+    long first;     // first point of the present window
+    outbuf_t out[MAXPIECE];
+    int error;      // set by any thread if out of memory
+} job_t;
+
+//! Writes x as text, and returns the number of characters.
+static int put_number(const job_t* job, char* p, double x)
+{
+    if (job->digits)
+        return snprintf(p, DTOA_BUFSIZE, "%.*g", job->digits, x);
+    return dtoa_shortest(x, p);
+}
+
+static char* emit_rtest(const job_t* job, char* p, const double* a, const double* r)
+{
+    const fct_t* f = job->f;
+    if (f->nin == 2 && f->nout == 2)
+        return p + sprintf(p, "    ZTEST(result, 1e-13, %s(C(%24.15e, %24.15e)), "
+                           "C(%24.15e, %24.15e));\n", f->name, a[0], a[1], r[0], r[1]);
+    p += sprintf(p, "    RTEST(result, 1e-13, %s(", f->name);
+    for (int k = 0; k < f->nin; ++k)
+        p += sprintf(p, "%s%24.15e", k ? ", " : "", a[k]);
+    return p + sprintf(p, "), %24.15e);\n", r[0]);
+}
+
+//! Appends points i0 .. i0+n-1, with arguments a and values r, to o.
+static void emit(const job_t* job, outbuf_t* o, long i0, size_t n, const double* const* a,
+                 double* const* r)
+{
+    const fct_t* f = job->f;
+    char* p = o->buf + o->len;
+    for (size_t i = 0; i < n; ++i) {
+        double v[8];
+        int nv = 0;
+        if (!job->values_only || job->format == FORMAT_RTEST)
+            for (int k = 0; k < f->nin; ++k)
+                v[nv++] = a[k][i];
+        for (int k = 0; k < f->nout; ++k)
+            v[nv++] = r[k][i];
+        if (job->format == FORMAT_BIN) {
+            memcpy(p, v, 8 * nv);
+            p += 8 * nv;
+            continue;
+        }
+        if (job->format == FORMAT_RTEST) {
+            p = emit_rtest(job, p, v, v + f->nin);
+            continue;
+        }
+        for (int k = 0; k < nv; ++k) {
+            p += put_number(job, p, v[k]);
+            *p++ = k + 1 < nv ? ' ' : '\n';
+        }
+        const long next = i0 + (long)i + 1;
+        if (job->ngrid == 2 && next % job->ninner == 0 && next < job->npoints)
+            *p++ = '\n';
+    }
+    o->len = (size_t)(p - o->buf);
+}
+
+static void body(void* ctx, int thread, long begin, long end)
+{
+    (void)thread;
+    job_t* job = (job_t*)ctx;
+    const fct_t* f = job->f;
+    double abuf[4][BLOCK], rbuf[4][BLOCK];
+    const double* a[4] = {abuf[0], abuf[1], abuf[2], abuf[3]};
+    double* r[4] = {rbuf[0], rbuf[1], rbuf[2], rbuf[3]};
+    for (long ip = begin; ip < end; ++ip) {
+        outbuf_t* o = &job->out[ip];
+        o->len = 0;
+        if (!o->buf && !(o->buf = (char*)malloc(PIECE * job->linemax))) {
+            job->error = 1;
+            return;
+        }
+        const long b = job->first + ip * PIECE;
+        const long e = b + PIECE < job->npoints ? b + PIECE : job->npoints;
+        for (long i0 = b; i0 < e; i0 += BLOCK) {
+            const size_t n = e - i0 < BLOCK ? (size_t)(e - i0) : BLOCK;
+            for (size_t i = 0; i < n; ++i) {
+                const long outer = (i0 + (long)i) / job->ninner;
+                const long inner = (i0 + (long)i) % job->ninner;
+                int g = job->ngrid == 2 ? 0 : 1; // 0: next grid is the outer one
+                for (int k = 0; k < f->nin; ++k) {
+                    if (job->arg[k].kind == GRID_CONST) {
+                        abuf[k][i] = job->arg[k].a;
+                    } else {
+                        abuf[k][i] = grid_node(&job->arg[k], g ? inner : outer);
+                        g = 1;
+                    }
+                }
+            }
+            fct_eval(f, n, a, r);
+            emit(job, o, i0, n, a, r);
+        }
+    }
+}
+
+/******************************************************************************/
+/*  Main                                                                      */
+/******************************************************************************/
+
+static int usage(void)
+{
+    fprintf(stderr,
+            "Usage: tabulate [-o text|bin|rtest] [-t threads] [-p digits] [-v] <function> "
+            "<arg>...\n"
+            "       tabulate rtest\n"
+            "Each argument is a number, or a grid lin:a:b:n, log:a:b:n, cheb:a:b:n;\n"
+            "at most two grids. Available functions:\n");
+    fct_list(stderr);
+    return 1;
+}
+
+int main(int argc, char** argv)
+{
+    if (argc == 2 && !strcmp(argv[1], "rtest"))
+        return rtest_imwx();
+
+    static job_t job; // large; zero-initialized
+    int nthreads = parallel_nproc();
+    int i = 1;
+    for (; i < argc && argv[i][0] == '-' && argv[i][1]; ++i) {
+        const char* opt = argv[i];
+        if (!strcmp(opt, "-v")) {
+            job.values_only = 1;
+            continue;
+        }
+        if (i + 1 == argc || opt[2])
+            return usage();
+        const char* val = argv[++i];
+        if (!strcmp(opt, "-o")) {
+            if (!strcmp(val, "text"))
+                job.format = FORMAT_TEXT;
+            else if (!strcmp(val, "bin"))
+                job.format = FORMAT_BIN;
+            else if (!strcmp(val, "rtest"))
+                job.format = FORMAT_RTEST;
+            else
+                return usage();
+        } else if (!strcmp(opt, "-t")) {
+            nthreads = atoi(val);
+        } else if (!strcmp(opt, "-p")) {
+            job.digits = atoi(val);
+            if (job.digits < 1 || job.digits > 17)
+                return usage();
+        } else {
+            return usage();
+        }
+    }
+    if (i == argc)
+        return usage();
+    job.f = fct_find(argv[i]);
+    if (!job.f) {
+        fprintf(stderr, "tabulate: unknown function %s\n", argv[i]);
+        return usage();
+    }
+    const fct_t* f = job.f;
+    if (argc - i - 1 != f->nin) {
+        fprintf(stderr, "tabulate: %s needs %i argument%s (%s)\n", f->name, f->nin,
+                f->nin > 1 ? "s" : "", f->args);
+        return 1;
+    }
+    job.npoints = 1;
+    job.ninner = 1;
+    for (int k = 0; k < f->nin; ++k) {
+        grid_t* g = &job.arg[k];
+        if (parse_grid(argv[i + 1 + k], g)) {
+            fprintf(stderr, "tabulate: invalid argument or grid %s\n", argv[i + 1 + k]);
+            return 1;
+        }
+        if (g->kind != GRID_CONST) {
+            job.ngrid++;
+            job.ninner = g->n;
+            job.npoints *= g->n;
+        }
+    }
+    if (job.ngrid > 2) {
+        fprintf(stderr, "tabulate: at most two grids\n");
+        return 1;
+    }
+    if (job.format == FORMAT_RTEST && f->nout > 1 && !(f->nin == 2 && f->nout == 2)) {
+        fprintf(stderr, "tabulate: no rtest format for %s\n", f->name);
+        return 1;
+    }
+    job.linemax = (size_t)(f->nin + f->nout) * (DTOA_BUFSIZE + 8) + strlen(f->name) + 64;
+    if (nthreads < 1)
+        nthreads = 1;
+
+    for (job.first = 0; job.first < job.npoints && !job.error;
+         job.first += (long)MAXPIECE * PIECE) {
+        const long n = job.npoints - job.first;
+        const long npiece = n < (long)MAXPIECE * PIECE ? (n + PIECE - 1) / PIECE : MAXPIECE;
+        parallel_for(nthreads, npiece, 1, body, &job);
+        for (long ip = 0; ip < npiece && !job.error; ++ip)
+            if (fwrite(job.out[ip].buf, 1, job.out[ip].len, stdout) != job.out[ip].len)
+                job.error = 4;
+    }
+    if (job.error == 1)
+        fprintf(stderr, "tabulate: out of memory\n");
+    else if (job.error == 4)
+        fprintf(stderr, "tabulate: write error\n");
+    for (int k = 0; k < MAXPIECE; ++k)
+        free(job.out[k].buf);
+    return job.error != 0 || fflush(stdout) != 0;
+}
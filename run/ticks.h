@@ -0,0 +1,62 @@
+/* Library libcerf:
+ *   Compute complex error functions, based on a new implementation of
+ *   Faddeeva's w_of_z. Also provide Dawson and Voigt functions.
+ *
+ * File ticks.h:
+ *   Cycle-accurate timer for single function calls.
+ *
+ * Copyright:
+ *   (C) 2026 Forschungszentrum Jülich GmbH
+ *
+ * Licence:
+ *   Public domain.
+ *
+ * Website:
+ *   http://apps.jcns.fz-juelich.de/libcerf
+ */
+
+/*
+   On x86, the time-stamp counter is read with rdtsc before, and rdtscp after the timed code,
+   fenced by lfence so that the timed code cannot be moved across. Elsewhere, timespec_get
+   is used, with a resolution of some ns at best.
+*/
+
+#ifndef TICKS_H
+#define TICKS_H
+
+#include <stdint.h>
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#define TIMER_NAME "rdtsc"
+static inline uint64_t tick_start(void)
+{
+    _mm_lfence();
+    const uint64_t t = __rdtsc();
+    _mm_lfence();
+    return t;
+}
+static inline uint64_t tick_stop(void)
+{
+    unsigned aux;
+    const uint64_t t = __rdtscp(&aux);
+    _mm_lfence();
+    return t;
+}
+#else
+#define TIMER_NAME "timespec_get"
+static inline uint64_t tick_start(void)
+{
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+#define tick_stop tick_start
+#endif
+
+#endif // TICKS_H
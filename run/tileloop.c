@@ -0,0 +1,128 @@
+/* Library libcerf:
+ *   Compute complex error functions, based on a new implementation of
+ *   Faddeeva's w_of_z. Also provide Dawson and Voigt functions.
+ *
+ * File tileloop.c:
+ *   Compute w_of_z for many arguments with medium |z|, to measure throughput.
+ *
+ * Copyright:
+ *   (C) 2026 Forschungszentrum Jülich GmbH
+ *
+ * Licence:
+ *   Public domain.
+ *
+ * Website:
+ *   http://apps.jcns.fz-juelich.de/libcerf
+ */
+
+/*
+   For 0.23 < |z| < 7, w_of_z evaluates a polynomial that is tabulated for some tile
+   of the complex plane. Depending on the compile switch CERF_W_CHEB, these are Taylor
+   expansions on polyominoes, or fitted polynomials on a regular grid of square tiles.
+   Compare builds with and without CERF_W_CHEB.
+
+   Arguments are visited in two orders: sequentially, so that successive calls use the same
+   tile, and shuffled, so that table lookup and branches are unpredictable.
+   For comparison, shuffled arguments are also passed to w_of_z_array with the rational engine.
+
+   Usage:
+       tileloop [number of calls per test, default 2^22]
+*/
+
+#include "cerf.h"
+#include "defs.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+enum { M = 1 << 16 }; // number of different arguments per test
+
+//! Returns the time per call in ns, for n calls of w_of_z cycling through z[0..M-1].
+static double loop(const _cerf_cmplx* z, long n, double* sink)
+{
+    _cerf_cmplx s = C(0, 0);
+    const clock_t t0 = clock();
+    for (long i = 0; i < n; ++i)
+        s += w_of_z(z[i % M]);
+    const clock_t t1 = clock();
+    *sink += creal(s) + cimag(s);
+    return 1e9 * (double)(t1 - t0) / CLOCKS_PER_SEC / n;
+}
+
+//! Returns the time per argument in ns, for calls of w_of_z_array with the rational engine.
+static double loop_array(const _cerf_cmplx* z, long n, double* sink)
+{
+    double* zr = (double*)malloc(4 * M * sizeof(double));
+    double* zi = zr + M;
+    double* wr = zr + 2 * M;
+    double* wi = zr + 3 * M;
+    for (int i = 0; i < M; ++i) {
+        zr[i] = creal(z[i]);
+        zi[i] = cimag(z[i]);
+    }
+    const long nrep = n / M > 0 ? n / M : 1;
+    const clock_t t0 = clock();
+    for (long k = 0; k < nrep; ++k) {
+        w_of_z_array(M, zr, zi, wr, wi, CERF_W_RATIONAL);
+        *sink += wr[k % M] + wi[k % M];
+    }
+    const clock_t t1 = clock();
+    free(zr);
+    return 1e9 * (double)(t1 - t0) / CLOCKS_PER_SEC / (nrep * M);
+}
+
+//! Fills z with points in the sector r0 < |z| < r1 of the first quadrant, on a polar grid.
+static void fill(_cerf_cmplx* z, double r0, double r1)
+{
+    const int nr = 256;
+    for (int i = 0; i < M; ++i) {
+        const double r = r0 + (r1 - r0) * (i / nr + .5) / (M / nr);
+        const double phi = 1.5707963267948966 * (i % nr + .5) / nr;
+        z[i] = C(r * cos(phi), r * sin(phi));
+    }
+}
+
+//! Applies a fixed pseudo-random permutation.
+static void shuffle(_cerf_cmplx* z)
+{
+    unsigned long s = 12345;
+    for (int i = M - 1; i > 0; --i) {
+        s = s * 6364136223846793005UL + 1442695040888963407UL;
+        const int j = (int)((s >> 33) % (unsigned long)(i + 1));
+        const _cerf_cmplx t = z[i];
+        z[i] = z[j];
+        z[j] = t;
+    }
+}
+
+static void test(double r0, double r1, long n, double* sink)
+{
+    _cerf_cmplx* z = (_cerf_cmplx*)malloc(M * sizeof(_cerf_cmplx));
+    fill(z, r0, r1);
+    const double t_seq = loop(z, n, sink);
+    shuffle(z);
+    const double t_rnd = loop(z, n, sink);
+    const double t_arr = loop_array(z, n, sink);
+    printf("%6.3g .. %-6.3g %10.2f %10.2f %10.2f\n", r0, r1, t_seq, t_rnd, t_arr);
+    free(z);
+}
+
+int main(int argc, char** argv)
+{
+    const long n = argc > 1 ? atol(argv[1]) : 1L << 22;
+    double sink = 0;
+
+#ifdef CERF_W_CHEB
+    printf("w_of_z with fitted polynomials on regular grid (CERF_W_CHEB)\n");
+#else
+    printf("w_of_z with Taylor expansions on polyominoes\n");
+#endif
+    printf("   |z| range    sequential   shuffled   rational [ns per call]\n");
+    test(0.25, 1, n, &sink);
+    test(1, 3, n, &sink);
+    test(3, 7, n, &sink);
+    test(0.25, 7, n, &sink);
+
+    return sink == 42; // use sink, so that the compiler cannot drop the loops
+}
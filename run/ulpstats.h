@@ -0,0 +1,128 @@
+/* Library libcerf:
+ *   Compute complex error functions, based on a new implementation of
+ *   Faddeeva's w_of_z. Also provide Dawson and Voigt functions.
+ *
+ * File ulpstats.h:
+ *   Statistics of errors in units of the last place (ulp), against double-double references.
+ *
+ * Copyright:
+ *   (C) 2026 Forschungszentrum Jülich GmbH
+ *
+ * Licence:
+ *   Public domain.
+ *
+ * Website:
+ *   http://apps.jcns.fz-juelich.de/libcerf
+ */
+
+/*
+   Up to three error measures are accumulated per stats_t, e.g. for the real part,
+   the imaginary part, and the normwise error of a complex function value.
+   Histogram bin 0 counts errors <= 0.5; bin b counts 2^(b-2) < err <= 2^(b-1);
+   the last bin counts all larger errors.
+*/
+
+#ifndef ULPSTATS_H
+#define ULPSTATS_H
+
+#include "ddref.h"
+#include <math.h>
+#include <stdio.h>
+
+enum { NBIN = 24, NSLOT = 3 };
+
+typedef struct {
+    long count, skipped;
+    double max[NSLOT], sum[NSLOT];
+    double argmax[NSLOT][2];
+    long hist[NSLOT][NBIN];
+    char pad[64]; // avoid false sharing between threads
+} stats_t;
+
+//! Returns the error of f in units of the last place of the reference value v.
+static inline double ulp_error(double f, dd_t v)
+{
+    if (isinf(v.hi))
+        return f == v.hi ? 0 : INFINITY;
+    if (!isfinite(f))
+        return INFINITY;
+    const double denorm_min = 0x1p-1074;
+    const double ulp = v.hi == 0 ? denorm_min : fmax(ldexp(1., ilogb(v.hi) - 52), denorm_min);
+    return fabs((f - v.hi) - v.lo) / ulp;
+}
+
+//! Returns the normwise relative error of (fr, fi) against (vr, vi), in units of 2^-53.
+//! Below the normal range, the error is taken relative to the smallest normal number.
+static inline double norm_error(double fr, double fi, dd_t vr, dd_t vi)
+{
+    if (isinf(vr.hi) || isinf(vi.hi))
+        return fr == vr.hi && fi == vi.hi ? 0 : INFINITY;
+    if (!isfinite(fr) || !isfinite(fi))
+        return INFINITY;
+    const double v = fmax(hypot(vr.hi, vi.hi), 0x1p-1022);
+    const double d = hypot((fr - vr.hi) - vr.lo, (fi - vi.hi) - vi.lo);
+    return d / v * 0x1p53;
+}
+
+static inline void stats_record(stats_t* s, int k, double err, double x, double y)
+{
+    s->sum[k] += err;
+    if (err > s->max[k]) {
+        s->max[k] = err;
+        s->argmax[k][0] = x;
+        s->argmax[k][1] = y;
+    }
+    int bin = 0;
+    if (err > .5) {
+        int e;
+        const double m = frexp(fmin(err, 1e300), &e); // err <= 2^e, or = 2^(e-1) if m = 1/2
+        bin = 1 + (m == .5 ? e - 1 : e);
+    }
+    s->hist[k][bin >= NBIN ? NBIN - 1 : bin]++;
+}
+
+//! Adds the statistics s to total.
+static inline void stats_merge(stats_t* total, const stats_t* s)
+{
+    total->count += s->count;
+    total->skipped += s->skipped;
+    for (int k = 0; k < NSLOT; ++k) {
+        total->sum[k] += s->sum[k];
+        if (s->max[k] > total->max[k]) {
+            total->max[k] = s->max[k];
+            total->argmax[k][0] = s->argmax[k][0];
+            total->argmax[k][1] = s->argmax[k][1];
+        }
+        for (int b = 0; b < NBIN; ++b)
+            total->hist[k][b] += s->hist[k][b];
+    }
+}
+
+//! Prints maximum and mean error of slot k, with argument (one or two components).
+static inline void stats_print_max(const stats_t* s, int k, int complex_arg, const char* unit)
+{
+    if (complex_arg)
+        printf("max %.3g %s at z = (%.17g, %.17g), mean %.3g %s\n", s->max[k], unit,
+               s->argmax[k][0], s->argmax[k][1], s->count ? s->sum[k] / s->count : 0, unit);
+    else
+        printf("max %.3g %s at x = %.17g, mean %.3g %s\n", s->max[k], unit, s->argmax[k][0],
+               s->count ? s->sum[k] / s->count : 0, unit);
+}
+
+//! Prints the nonempty bins of the histogram of slot k.
+static inline void stats_print_hist(const stats_t* s, int k)
+{
+    for (int b = 0; b < NBIN; ++b) {
+        if (!s->hist[k][b])
+            continue;
+        if (b == 0)
+            printf(" <=0.5: %li", s->hist[k][b]);
+        else if (b == NBIN - 1)
+            printf(" >%g: %li", ldexp(1., b - 2), s->hist[k][b]);
+        else
+            printf(" <=%g: %li", ldexp(1., b - 1), s->hist[k][b]);
+    }
+    printf("\n");
+}
+
+#endif // ULPSTATS_H
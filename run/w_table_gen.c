@@ -0,0 +1,49 @@
+/* Library libcerf:
+ *   Compute complex error functions, based on a new implementation of
+ *   Faddeeva's w_of_z. Also provide Dawson and Voigt functions.
+ *
+ * File w_table_gen.c:
+ *   Write a table file for w_of_z_table.
+ *
+ * Copyright:
+ *   (C) 2026 Forschungszentrum Jülich GmbH
+ *
+ * Licence:
+ *   Public domain.
+ *
+ * Website:
+ *   http://apps.jcns.fz-juelich.de/libcerf
+ */
+
+/*
+   Tabulates w_of_z on a square grid with spacing h = 1/ndiv in the quadrant
+   0 <= x <= xmax, 0 <= y <= ymax, and reports the interpolation error bound.
+
+   Usage:
+       w_table_gen <file> [ndiv, default 64] [xmax, default 8] [ymax, default 8]
+*/
+
+#include "cerf.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+int main(int argc, char** argv)
+{
+    if (argc < 2 || argc > 5) {
+        fprintf(stderr, "Usage: %s <file> [ndiv] [xmax] [ymax]\n", argv[0]);
+        return 1;
+    }
+    const int ndiv = argc > 2 ? atoi(argv[2]) : 64;
+    const double xmax = argc > 3 ? atof(argv[3]) : 8;
+    const double ymax = argc > 4 ? atof(argv[4]) : 8;
+
+    double errbound;
+    const int ret = cerf_w_table_write(argv[1], ndiv, xmax, ymax, &errbound);
+    if (ret) {
+        fprintf(stderr, "%s: cannot write table (error %i)\n", argv[0], ret);
+        return 1;
+    }
+    printf("%s: h = 1/%i, 0 <= x <= %g, 0 <= y <= %g, relative error < %.3g\n",
+           argv[1], ndiv, xmax, ymax, errbound);
+    return 0;
+}
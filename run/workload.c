@@ -0,0 +1,474 @@
+/* Library libcerf:
+ *   Compute complex error functions, based on a new implementation of
+ *   Faddeeva's w_of_z. Also provide Dawson and Voigt functions.
+ *
+ * File workload.c:
+ *   End-to-end benchmarks that resemble applications: spectral fitting,
+ *   dispersion scans, line-by-line synthesis, line widths.
+ *
+ * Copyright:
+ *   (C) 2026 Forschungszentrum Jülich GmbH
+ *
+ * Licence:
+ *   Public domain.
+ *
+ * Website:
+ *   http://apps.jcns.fz-juelich.de/libcerf
+ */
+
+/*
+   Workloads:
+     fit      Levenberg-Marquardt fit of 50 Voigt peaks (amplitude, center, sigma, gamma)
+              to a noisy spectrum of 10^5 points. Model and Jacobian are computed from
+              one call of w_of_z per point and peak, within ten widths around each peak.
+     scan     w_of_z on a 2000 x 2000 grid in the complex plane, -10 <= x <= 10, -5 <= y <= 10,
+              as in a scan of a plasma dispersion relation; also w_of_z_array on the same grid.
+     lines    Line-by-line synthesis of an absorption spectrum, HITRAN-like:
+              5000 lines with log-uniform intensities, Doppler and pressure broadening,
+              on a grid of 50000 points, with line-wing cutoff at 5 / cm.
+     hwhm     voigt_hwhm for 10^6 pairs (sigma, gamma), with log-uniform ratio in [1e-4, 1e4].
+
+   All input data come from a pseudo-random generator with fixed seed.
+   Each workload is run three times; the fastest run is reported, as wall time
+   and as throughput (library calls per second).
+
+   Usage:
+       workload [fit|scan|lines|hwhm ...]
+*/
+
+#include "cerf.h"
+#include "defs.h"
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+static double sink = 0;
+
+static double now(void)
+{
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return ts.tv_sec + 1e-9 * ts.tv_nsec;
+}
+
+static uint64_t rng_state;
+
+//! Returns a pseudo-random number in [0, 1).
+static double rnd(void)
+{
+    rng_state = rng_state * 6364136223846793005UL + 1442695040888963407UL;
+    return (double)(rng_state >> 11) * 0x1p-53;
+}
+
+//! Returns a normally distributed pseudo-random number (Box-Muller).
+static double rnd_normal(void)
+{
+    const double u = 1 - rnd(), v = rnd();
+    return sqrt(-2 * log(u)) * cos(6.283185307179586 * v);
+}
+
+static double* alloc(size_t n)
+{
+    double* p = (double*)malloc(n * sizeof(double));
+    if (!p) {
+        fprintf(stderr, "out of memory\n");
+        exit(1);
+    }
+    return p;
+}
+
+/******************************************************************************/
+/*  fit: Levenberg-Marquardt fit of Voigt peaks                               */
+/******************************************************************************/
+
+enum { NPEAK = 50, NPAR = 4 * NPEAK, NPOINT = 100000 };
+
+static const double fit_xmax = 1000; // spectrum on [0, fit_xmax]
+
+//! Half width of the window in which a peak is evaluated.
+static double window(const double* p)
+{
+    return 10 * (p[2] + p[3]);
+}
+
+//! Sets the index range [*i0, *i1] of the window of a peak.
+static void window_range(const double* p, int* i0, int* i1)
+{
+    const double W = window(p);
+    *i0 = (int)ceil((p[1] - W) / fit_xmax * (NPOINT - 1));
+    *i1 = (int)floor((p[1] + W) / fit_xmax * (NPOINT - 1));
+    *i0 = *i0 < 0 ? 0 : *i0;
+    *i1 = *i1 > NPOINT - 1 ? NPOINT - 1 : *i1;
+}
+
+/* Adds one peak, with parameters p = (amplitude, center, sigma, gamma), to the model y,
+   and, if J != NULL, stores the derivatives in the rows J[0..3] (indexed by point;
+   only the entries within the window of the peak are written).
+   Returns the number of calls of w_of_z.
+*/
+static long add_peak(const double* x, const double* p, double* y, double* const* J)
+{
+    const double A = p[0], x0 = p[1], s = p[2], g = p[3];
+    const double s2 = s * 1.4142135623730951;
+    const double norm = 1 / (s * 2.5066282746310002);
+    int i0, i1;
+    window_range(p, &i0, &i1);
+    for (int i = i0; i <= i1; ++i) {
+        const double zr = (x[i] - x0) / s2, zi = g / s2;
+        const _cerf_cmplx w = w_of_z(C(zr, zi));
+        const double wr = creal(w), wi = cimag(w);
+        const double V = norm * wr;
+        y[i] += A * V;
+        if (!J)
+            continue;
+        // w'(z) = -2 z w + 2i/sqrt(pi)
+        const double dr = -2 * (zr * wr - zi * wi);
+        const double di = -2 * (zr * wi + zi * wr) + 1.1283791670955126;
+        J[0][i] = V;
+        J[1][i] = -A * norm * dr / s2;
+        J[2][i] = A * (-norm * (dr * zr - di * zi) / s - V / s);
+        J[3][i] = -A * norm * di / s2;
+    }
+    return i1 >= i0 ? i1 - i0 + 1 : 0;
+}
+
+//! Computes the model; returns the number of calls of w_of_z.
+static long model(const double* x, const double* p, double* y)
+{
+    memset(y, 0, NPOINT * sizeof(double));
+    long n = 0;
+    for (int k = 0; k < NPEAK; ++k)
+        n += add_peak(x, p + 4 * k, y, NULL);
+    return n;
+}
+
+static double chi2(const double* y, const double* data)
+{
+    double s = 0;
+    for (int i = 0; i < NPOINT; ++i)
+        s += (data[i] - y[i]) * (data[i] - y[i]);
+    return s;
+}
+
+//! Solves A x = b by Cholesky decomposition, overwriting A and b; returns 0 on success.
+static int cholesky_solve(double* A, double* b, int n)
+{
+    for (int j = 0; j < n; ++j) {
+        double d = A[j * n + j];
+        for (int k = 0; k < j; ++k)
+            d -= A[j * n + k] * A[j * n + k];
+        if (!(d > 0))
+            return -1;
+        d = sqrt(d);
+        A[j * n + j] = d;
+        for (int i = j + 1; i < n; ++i) {
+            double s = A[i * n + j];
+            for (int k = 0; k < j; ++k)
+                s -= A[i * n + k] * A[j * n + k];
+            A[i * n + j] = s / d;
+        }
+    }
+    for (int i = 0; i < n; ++i) {
+        for (int k = 0; k < i; ++k)
+            b[i] -= A[i * n + k] * b[k];
+        b[i] /= A[i * n + i];
+    }
+    for (int i = n - 1; i >= 0; --i) {
+        for (int k = i + 1; k < n; ++k)
+            b[i] -= A[k * n + i] * b[k];
+        b[i] /= A[i * n + i];
+    }
+    return 0;
+}
+
+static void random_peaks(double* p)
+{
+    for (int k = 0; k < NPEAK; ++k) {
+        p[4 * k + 0] = 1 + 9 * rnd();
+        p[4 * k + 1] = fit_xmax * (.02 + .96 * (k + rnd()) / NPEAK);
+        p[4 * k + 2] = .5 + 1.5 * rnd();
+        p[4 * k + 3] = .2 + 1.8 * rnd();
+    }
+}
+
+static long run_fit(char* info, size_t infosize)
+{
+    double* x = alloc(NPOINT);
+    double* data = alloc(NPOINT);
+    double* y = alloc(NPOINT);
+    double* J = alloc((size_t)NPAR * NPOINT); // row per parameter, valid within the window
+    double* JTJ = alloc((size_t)NPAR * NPAR);
+    double* N = alloc((size_t)NPAR * NPAR);
+    double p[NPAR], ptry[NPAR], JTr[NPAR], delta[NPAR];
+    int lo[NPEAK], hi[NPEAK];
+
+    rng_state = 4711;
+    for (int i = 0; i < NPOINT; ++i)
+        x[i] = fit_xmax * i / (NPOINT - 1);
+    double ptrue[NPAR];
+    random_peaks(ptrue);
+    long ncall = model(x, ptrue, data);
+    for (int i = 0; i < NPOINT; ++i)
+        data[i] += .002 * rnd_normal();
+    // Start values: widths and amplitudes up to 10% off, centers up to 0.2%.
+    for (int j = 0; j < NPAR; ++j)
+        p[j] = ptrue[j] * (j % 4 == 1 ? 1 + .002 * (2 * rnd() - 1) : 1 + .1 * (2 * rnd() - 1));
+
+    ncall += model(x, p, y);
+    double c2 = chi2(y, data);
+    double lambda = 1e-3;
+    int niter = 0;
+    for (int iter = 0; iter < 100; ++iter) {
+        // Model and Jacobian.
+        memset(y, 0, NPOINT * sizeof(double));
+        for (int k = 0; k < NPEAK; ++k) {
+            double* Jk[4];
+            for (int l = 0; l < 4; ++l)
+                Jk[l] = J + (size_t)(4 * k + l) * NPOINT;
+            ncall += add_peak(x, p + 4 * k, y, Jk);
+            window_range(p + 4 * k, &lo[k], &hi[k]);
+        }
+        // Normal equations; only overlapping windows contribute.
+        for (int a = 0; a < NPAR; ++a) {
+            const double* Ja = J + (size_t)a * NPOINT;
+            double s = 0;
+            for (int i = lo[a / 4]; i <= hi[a / 4]; ++i)
+                s += Ja[i] * (data[i] - y[i]);
+            JTr[a] = s;
+            for (int b = 0; b <= a; ++b) {
+                const double* Jb = J + (size_t)b * NPOINT;
+                const int i0 = lo[a / 4] > lo[b / 4] ? lo[a / 4] : lo[b / 4];
+                const int i1 = hi[a / 4] < hi[b / 4] ? hi[a / 4] : hi[b / 4];
+                double t = 0;
+                for (int i = i0; i <= i1; ++i)
+                    t += Ja[i] * Jb[i];
+                JTJ[a * NPAR + b] = JTJ[b * NPAR + a] = t;
+            }
+        }
+        // Damped steps, until chi^2 decreases.
+        int accepted = 0;
+        while (lambda < 1e10) {
+            memcpy(N, JTJ, (size_t)NPAR * NPAR * sizeof(double));
+            for (int a = 0; a < NPAR; ++a)
+                N[a * NPAR + a] *= 1 + lambda;
+            memcpy(delta, JTr, sizeof(delta));
+            int ok = !cholesky_solve(N, delta, NPAR);
+            for (int a = 0; a < NPAR; ++a) {
+                ptry[a] = p[a] + delta[a];
+                if (a % 4 >= 2 && !(ptry[a] > 0))
+                    ok = 0;
+            }
+            if (ok) {
+                ncall += model(x, ptry, y);
+                const double c2try = chi2(y, data);
+                if (c2try < c2) {
+                    accepted = 1;
+                    const double gain = (c2 - c2try) / c2;
+                    memcpy(p, ptry, sizeof(p));
+                    c2 = c2try;
+                    lambda = fmax(lambda / 10, 1e-12);
+                    ++niter;
+                    if (gain < 1e-9)
+                        iter = 100; // converged
+                    break;
+                }
+            }
+            lambda *= 10;
+        }
+        if (!accepted)
+            break;
+    }
+    double maxdev = 0;
+    for (int j = 1; j < NPAR; j += 4)
+        maxdev = fmax(maxdev, fabs(p[j] - ptrue[j]));
+    snprintf(info, infosize, "%i iterations, chi2/N %.3g, max center deviation %.2g", niter,
+             c2 / NPOINT, maxdev);
+    sink += c2;
+    free(x);
+    free(data);
+    free(y);
+    free(J);
+    free(JTJ);
+    free(N);
+    return ncall;
+}
+
+/******************************************************************************/
+/*  scan: w_of_z on a grid                                                    */
+/******************************************************************************/
+
+enum { NGRID = 2000 };
+
+static long run_scan(char* info, size_t infosize)
+{
+    double s = 0;
+    for (int j = 0; j < NGRID; ++j) {
+        const double y = -5 + 15. * j / (NGRID - 1);
+        for (int i = 0; i < NGRID; ++i) {
+            const double x = -10 + 20. * i / (NGRID - 1);
+            const _cerf_cmplx w = w_of_z(C(x, y));
+            s += fabs(creal(w)) + fabs(cimag(w));
+        }
+    }
+    snprintf(info, infosize, "sum |Re w| + |Im w| = %.10g", s);
+    sink += s;
+    return (long)NGRID * NGRID;
+}
+
+static long run_scan_array(int engine, char* info, size_t infosize)
+{
+    double* zr = alloc(NGRID);
+    double* zi = alloc(NGRID);
+    double* wr = alloc(NGRID);
+    double* wi = alloc(NGRID);
+    double s = 0;
+    for (int j = 0; j < NGRID; ++j) {
+        const double y = -5 + 15. * j / (NGRID - 1);
+        for (int i = 0; i < NGRID; ++i) {
+            zr[i] = -10 + 20. * i / (NGRID - 1);
+            zi[i] = y;
+        }
+        w_of_z_array(NGRID, zr, zi, wr, wi, engine);
+        for (int i = 0; i < NGRID; ++i)
+            s += fabs(wr[i]) + fabs(wi[i]);
+    }
+    snprintf(info, infosize, "sum |Re w| + |Im w| = %.10g", s);
+    sink += s;
+    free(zr);
+    free(zi);
+    free(wr);
+    free(wi);
+    return (long)NGRID * NGRID;
+}
+
+static long run_scan_default(char* info, size_t infosize)
+{
+    return run_scan_array(CERF_W_DEFAULT, info, infosize);
+}
+
+static long run_scan_rational(char* info, size_t infosize)
+{
+    return run_scan_array(CERF_W_RATIONAL, info, infosize);
+}
+
+/******************************************************************************/
+/*  lines: line-by-line synthesis                                             */
+/******************************************************************************/
+
+enum { NLINE = 5000, NNU = 50000 };
+
+static long run_lines(char* info, size_t infosize)
+{
+    const double nu0 = 2000, nu1 = 2500; // wavenumber range in 1/cm
+    const double dnu = (nu1 - nu0) / (NNU - 1);
+    const double cutoff = 5;
+    double* k = alloc(NNU);
+    memset(k, 0, NNU * sizeof(double));
+    rng_state = 4712;
+    long ncall = 0;
+    for (int l = 0; l < NLINE; ++l) {
+        // Line parameters, as in a HITRAN-like list for a molecule at about 300 K and 1 bar:
+        // intensities spread over six decades, Doppler width ~ 3e-3/cm (sigma),
+        // pressure broadening ~ 0.07/cm (gamma, HWHM) with some spread.
+        const double nu = nu0 + (nu1 - nu0) * rnd();
+        const double S = pow(10., -6 * rnd());
+        const double sigma = nu * 1.5e-6;
+        const double gamma = .07 * (.5 + rnd());
+        int i0 = (int)ceil((nu - cutoff - nu0) / dnu);
+        int i1 = (int)floor((nu + cutoff - nu0) / dnu);
+        i0 = i0 < 0 ? 0 : i0;
+        i1 = i1 > NNU - 1 ? NNU - 1 : i1;
+        for (int i = i0; i <= i1; ++i)
+            k[i] += S * voigt(nu0 + i * dnu - nu, sigma, gamma);
+        ncall += i1 - i0 + 1;
+    }
+    double s = 0, kmax = 0;
+    for (int i = 0; i < NNU; ++i) {
+        s += k[i];
+        kmax = fmax(kmax, k[i]);
+    }
+    snprintf(info, infosize, "integral %.10g, peak %.6g", s * dnu, kmax);
+    sink += s;
+    free(k);
+    return ncall;
+}
+
+/******************************************************************************/
+/*  hwhm: many line widths                                                    */
+/******************************************************************************/
+
+enum { NHWHM = 1000000 };
+
+static long run_hwhm(char* info, size_t infosize)
+{
+    rng_state = 4713;
+    double s = 0;
+    for (int i = 0; i < NHWHM; ++i) {
+        const double sigma = pow(10., -1 + 2 * rnd());
+        const double gamma = sigma * pow(10., -4 + 8 * rnd());
+        s += voigt_hwhm(sigma, gamma) / (sigma + gamma);
+    }
+    snprintf(info, infosize, "mean hwhm/(sigma+gamma) %.10g", s / NHWHM);
+    sink += s;
+    return NHWHM;
+}
+
+/******************************************************************************/
+/*  Driver                                                                    */
+/******************************************************************************/
+
+typedef struct {
+    const char* name;
+    const char* group;
+    const char* calls;
+    long (*run)(char* info, size_t infosize);
+} workload_t;
+
+static const workload_t workloads[] = {
+    {"fit", "fit", "w_of_z", run_fit},
+    {"scan", "scan", "w_of_z", run_scan},
+    {"scan_array", "scan", "w_of_z_array", run_scan_default},
+    {"scan_rational", "scan", "w_of_z_array(RATIONAL)", run_scan_rational},
+    {"lines", "lines", "voigt", run_lines},
+    {"hwhm", "hwhm", "voigt_hwhm", run_hwhm},
+};
+enum { NWORKLOAD = sizeof(workloads) / sizeof(workloads[0]) };
+
+int main(int argc, char** argv)
+{
+    for (int i = 1; i < argc; ++i) {
+        int found = 0;
+        for (int j = 0; j < NWORKLOAD; ++j)
+            found |= !strcmp(argv[i], workloads[j].group);
+        if (!found) {
+            fprintf(stderr, "Usage: %s [fit|scan|lines|hwhm ...]\n", argv[0]);
+            return 1;
+        }
+    }
+    printf("%-14s %-24s %10s %10s %9s  %s\n", "workload", "calls of", "number", "time/s", "Mcalls/s",
+           "result");
+    for (int j = 0; j < NWORKLOAD; ++j) {
+        const workload_t* w = &workloads[j];
+        int selected = argc == 1;
+        for (int i = 1; i < argc; ++i)
+            selected |= !strcmp(argv[i], w->group);
+        if (!selected)
+            continue;
+        char info[128] = "";
+        double tbest = INFINITY;
+        long ncall = 0;
+        for (int r = 0; r < 3; ++r) {
+            const double t0 = now();
+            ncall = w->run(info, sizeof(info));
+            const double t = now() - t0;
+            tbest = t < tbest ? t : tbest;
+        }
+        printf("%-14s %-24s %10li %10.4f %9.3f  %s\n", w->name, w->calls, ncall, tbest,
+               1e-6 * ncall / tbest, info);
+        fflush(stdout);
+    }
+    return sink == 42;
+}
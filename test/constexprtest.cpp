@@ -0,0 +1,160 @@
+/* Library libcerf:
+ *   Compute complex error functions, based on a new implementation of
+ *   Faddeeva's w_of_z. Also provide Dawson and Voigt functions.
+ *
+ * File constexprtest.cpp
+ *   Test compile-time evaluation of erfcx, im_w_of_x, dawson, w_of_z, voigt (requires C++20).
+ *
+ * Copyright:
+ *   (C) 2026 Forschungszentrum Jülich GmbH
+ *
+ * Licence:
+ *   ../LICENSE
+ *
+ * Website:
+ *   http://apps.jcns.fz-juelich.de/libcerf
+ *
+ * Revision history:
+ *   ../CHANGELOG
+ *
+ * More information:
+ *   man 3 cerf_inline
+ */
+
+#include "cerf.hpp"
+#include <cmath>
+#include <cstdio>
+
+static int failed = 0;
+static int total = 0;
+
+#ifdef CERF_HAS_CONSTEXPR
+
+static void check(double limit, double computed, double expected, const char* name, double x)
+{
+    ++total;
+    if (!(std::fabs(computed - expected) <= limit * std::fabs(expected))
+        && !(computed == expected)) {
+        std::printf("failure in subtest %i: %s, x=%g\n", total, name, x);
+        std::printf("- fct value %20.15g\n- expected  %20.15g\n", computed, expected);
+        ++failed;
+    }
+}
+
+static void zcheck(double limit, std::complex<double> computed, std::complex<double> expected,
+                   const char* name, std::complex<double> z)
+{
+    ++total;
+    if (!(std::abs(computed - expected) <= limit * std::abs(expected))
+        && !(computed == expected)
+        && !(std::isnan(computed.real()) && std::isnan(expected.real()))) {
+        std::printf("failure in subtest %i: %s, z=(%g,%g)\n", total, name, z.real(), z.imag());
+        std::printf("- fct value %20.15g %20.15g\n- expected  %20.15g %20.15g\n",
+                    computed.real(), computed.imag(), expected.real(), expected.imag());
+        ++failed;
+    }
+}
+
+// Arguments covering all algorithms of erfcx and im_w_of_x.
+constexpr double X[] = {0,     1e-300, 1e-8, -0.01, 0.1,  -0.3, 0.6,  -1,   1.5,   -2.5, 3,
+                        -4.75, 6,      -7,   8.5,   11.9, -12,  13,   -20,  23.1,  -26,  27,
+                        100,   -149,   151,  1e7,   1e8,  1e300, -1e300};
+constexpr int N = sizeof(X) / sizeof(X[0]);
+
+template <class F> struct Table {
+    double v[N];
+    constexpr Table(F f) : v() {
+        for (int i = 0; i < N; ++i)
+            v[i] = f(X[i]);
+    }
+};
+
+constexpr Table Erfcx([](double x) { return libcerf::erfcx(x); });
+constexpr Table Imwx([](double x) { return libcerf::im_w_of_x(x); });
+constexpr Table Dawson([](double x) { return libcerf::dawson(x); });
+
+// Peak height of a Voigt profile, voigt(0, sigma, hwhm) = erfcx(gamma/(sqrt(2) sigma))/(sqrt(2 pi) sigma).
+constexpr double sigma = 0.7, hwhm = 0.2;
+constexpr double peak = cerf_inline_erfcx(hwhm / (1.4142135623730950488 * sigma))
+    / (2.5066282746310005024 * sigma);
+
+// Arguments covering all algorithms of w_of_z, in all quadrants, on a polar grid
+// with |z| <= 1e4, and some far away, where exp(-z^2) overflows or underflows.
+constexpr double R[] = {0, 1e-300, 1e-9, 1e-3, 0.1, 0.22, 0.5, 1.3, 2.9, 5, 6.95, 7.05,
+                        10, 23, 150, 1e4};
+constexpr double Phi[] = {0, 1e-12, 0.3, 0.7853981633974483, 1.2, 1.5707963267948966 - 1e-10,
+                          1.5707963267948966, 2.1, 3.1, 3.14159265358979, 3.4, 4.5, 4.71238898038469,
+                          5.9, 6.2831853};
+constexpr double Far[][2] = {{1e9, 1}, {-1e9, -3e8}, {1e200, -1e199}, {-1e-5, -1e12},
+                             {1e12, 1e12}, {-1e200, 1e200}, {-30, -29.9}};
+constexpr int NR = sizeof(R) / sizeof(R[0]);
+constexpr int NPhi = sizeof(Phi) / sizeof(Phi[0]);
+constexpr int NFar = sizeof(Far) / sizeof(Far[0]);
+constexpr int NZ = NR * NPhi + NFar;
+
+struct WTable {
+    std::complex<double> z[NZ];
+    std::complex<double> w[NZ];
+    constexpr WTable() : z(), w() {
+        for (int i = 0; i < NR; ++i)
+            for (int j = 0; j < NPhi; ++j) {
+                double s = 0, c = 0;
+                cerf_inline_constexpr_sincos(Phi[j], &s, &c);
+                z[i * NPhi + j] = std::complex<double>(R[i] * c, R[i] * s);
+            }
+        for (int i = 0; i < NFar; ++i)
+            z[NR * NPhi + i] = std::complex<double>(Far[i][0], Far[i][1]);
+        for (int i = 0; i < NZ; ++i)
+            w[i] = libcerf::w_of_z(z[i]);
+    }
+};
+constexpr WTable Wofz;
+
+// Voigt profile with the parameters above, at a few x.
+constexpr double VX[] = {0, 0.01, 0.3, -1, 2.5, 40};
+constexpr int NV = sizeof(VX) / sizeof(VX[0]);
+constexpr double VoigtX[NV] = {libcerf::voigt(VX[0], sigma, hwhm), libcerf::voigt(VX[1], sigma, hwhm),
+                               libcerf::voigt(VX[2], sigma, hwhm), libcerf::voigt(VX[3], sigma, hwhm),
+                               libcerf::voigt(VX[4], sigma, hwhm), libcerf::voigt(VX[5], sigma, hwhm)};
+
+static_assert(cerf_inline_erfcx(0.) == 1, "erfcx(0)");
+static_assert(libcerf::erfcx(0.f) == 1.f, "erfcx(0f)");
+static_assert(cerf_inline_im_w_of_x(0.) == 0, "im_w_of_x(0)");
+static_assert(cerf_inline_erfcx(-30.) == HUGE_VAL, "erfcx(-30)");
+static_assert(libcerf::w_of_z(std::complex<double>(0, 0)) == std::complex<double>(1, 0), "w(0)");
+static_assert(libcerf::voigt(1., 0., 0.) == 0, "voigt, delta function");
+
+#endif // CERF_HAS_CONSTEXPR
+
+int main()
+{
+#ifdef CERF_HAS_CONSTEXPR
+    for (int i = 0; i < N; ++i) {
+        check(1e-15, Erfcx.v[i], erfcx(X[i]), "constexpr erfcx", X[i]);
+        check(1e-15, Imwx.v[i], im_w_of_x(X[i]), "constexpr im_w_of_x", X[i]);
+        check(1e-15, Dawson.v[i], dawson(X[i]), "constexpr dawson", X[i]);
+    }
+    check(1e-15, peak, voigt(0, sigma, hwhm), "constexpr Voigt peak height", sigma);
+    for (int i = 0; i < NZ; ++i)
+        zcheck(1e-13, Wofz.w[i], w_of_z(Wofz.z[i]), "constexpr w_of_z", Wofz.z[i]);
+    for (int i = 0; i < NV; ++i)
+        check(1e-15, VoigtX[i], voigt(VX[i], sigma, hwhm), "constexpr voigt", VX[i]);
+
+    // The compile-time exponential, against exp from math.h.
+    for (int i = -1000; i <= 1000; ++i) {
+        const double x = 0.7453 * i + 0.001;
+        check(3e-16, cerf_inline_constexpr_exp(x), std::exp(x), "cerf_inline_constexpr_exp", x);
+    }
+
+    // The compile-time sine and cosine, against sin and cos from math.h.
+    for (int i = -1000; i <= 1000; ++i) {
+        const double x = i % 2 ? 0.7453 * i + 0.001 : 2.6e5 * i + 0.001;
+        double s = 0, c = 0;
+        cerf_inline_constexpr_sincos(x, &s, &c);
+        check(0, std::hypot(s - std::sin(x), c - std::cos(x)) > 3e-16, 0, "constexpr sincos", x);
+    }
+#endif
+
+    std::printf("%i/%i tests failed\n", failed, total);
+    return failed ? 1 : 0;
+}
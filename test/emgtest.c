@@ -0,0 +1,102 @@
+/* Library libcerf:
+ *   Compute complex error functions, based on a new implementation of
+ *   Faddeeva's w_of_z. Also provide Dawson and Voigt functions.
+ *
+ * File emgtest.c
+ *   Test the exponentially modified Gaussian emg and its derivatives.
+ *
+ * Copyright:
+ *   (C) 2026 Forschungszentrum Jülich GmbH
+ *
+ * Licence:
+ *   ../LICENSE
+ *
+ * Website:
+ *   http://apps.jcns.fz-juelich.de/libcerf
+ *
+ * Revision history:
+ *   ../CHANGELOG
+ *
+ * More information:
+ *   man 3 emg
+ */
+
+#include "cerf.h"
+#include "testtool.h"
+
+// Arguments x, mu, sigma, tau, and expected values emg, d/dmu, d/dsigma, d/dtau,
+// evaluated with mpmath (mp.dps=40)
+static const double Tab[][8] = {
+    {0, 0, 1, 1, 0.26157829186512337, -0.13736398853630931, -0.13736398853630931,
+     -0.12421430332881407},
+    {1.5, 0.2, 0.7, 2, 0.25922598547551258, 0.078815108074118115, -0.066753640835100994,
+     -0.05501939819729417},
+    {-3, 0, 1, 0.5, 0.0017089925853826983, -0.0054457116531106177, 0.015699667165406808,
+     -0.0021430495829153059},
+    {10, 0, 1, 1, 7.4851829887700591e-5, 7.4851829887700591e-5, 7.4851829887700591e-5,
+     0.00059881463910160473},
+    {40, 0, 1, 10, 0.0018407446410717218, 0.00018407446410717218, 1.8407446410717218e-5,
+     0.00055038264768044481},
+    {-20, 0, 1, 0.1, 1.8382781034408858e-88, -3.6826702587188771e-87, 7.3592264656006488e-86,
+     -1.2268729197303416e-87},
+    {0.3, 0, 0.01, 3, 0.30161414830815593, 0.10053804943605198, 0.00033512683145350659,
+     -0.090485361581884957},
+    {0.5, 0, 2, 0.05, 0.194427100879087, 0.021860849553247943, -0.092236309877205282,
+     0.019518873038950692},
+    {100, 3, 5, 0.2, 6.5053254081838026e-83, 2.5021216354463907e-82, 4.7992544154436861e-81,
+     1.0462726626486054e-81},
+    {-8, 0, 2, 20, 1.5485925879460634e-6, -3.2683260147248306e-6, 1.3056189975016052e-5,
+     -7.5718221008976135e-8},
+    {3, 1, 0.5, 0.5, 0.060313240067752667, 0.12009115923244579, 0.11794987562020763,
+     0.24178828117407021},
+};
+
+int main(void)
+{
+    result_t result = {0, 0};
+    const int n = sizeof(Tab) / sizeof(Tab[0]);
+
+    for (int i = 0; i < n; ++i) {
+        const double* t = Tab[i];
+        double grad[3];
+        char info[80];
+        snprintf(info, 80, "emg(%g,%g,%g,%g)", t[0], t[1], t[2], t[3]);
+        rtest(&result, 1e-13, emg(t[0], t[1], t[2], t[3]), t[4], info);
+        rtest(&result, 1e-13, emg_grad(t[0], t[1], t[2], t[3], grad), t[4], info);
+        for (int k = 0; k < 3; ++k) {
+            snprintf(info, 80, "emg_grad(%g,%g,%g,%g)[%i]", t[0], t[1], t[2], t[3], k);
+            rtest(&result, 1e-12, grad[k], t[5 + k], info);
+        }
+    }
+
+    // Degenerate cases
+    RTEST(result, 1e-15, emg(1.5, 0.5, 2, 0), 0.17603266338214976); // Gaussian
+    RTEST(result, 1e-15, emg(1.5, 0.5, 0, 2), 0.30326532985631671); // exponential decay
+    RTEST(result, 0, emg(-1.5, 0.5, 0, 2), 0.);
+    RTEST(result, 0, emg(1.5, 0.5, 0, 0), 0.);
+    RTEST(result, 0, emg(0.5, 0.5, 0, 0), Inf);
+
+    // The array function must reproduce the scalar function, in several chunks.
+    enum { NA = 1000 };
+    static double x[NA], f[NA], fm[NA], fs[NA], ft[NA];
+    for (int i = 0; i < NA; ++i)
+        x[i] = -10 + 0.05 * i;
+    emg_array(NA, x, 1.2, 0.8, 1.7, f, fm, fs, ft);
+    int nbad = 0;
+    for (int i = 0; i < NA; ++i) {
+        double grad[3];
+        if (f[i] != emg_grad(x[i], 1.2, 0.8, 1.7, grad) || fm[i] != grad[0] || fs[i] != grad[1]
+            || ft[i] != grad[2])
+            ++nbad;
+    }
+    rtest(&result, 0, nbad, 0, "emg_array vs emg_grad");
+    emg_array(NA, x, 1.2, 0.8, 1.7, fm, NULL, NULL, NULL);
+    nbad = 0;
+    for (int i = 0; i < NA; ++i)
+        if (fm[i] != f[i])
+            ++nbad;
+    rtest(&result, 0, nbad, 0, "emg_array without derivatives");
+
+    printf("%i/%i tests failed\n", result.failed, result.total);
+    return result.failed ? 1 : 0;
+}
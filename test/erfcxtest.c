@@ -3213,6 +3213,19 @@ int main(void)
     for (int iT = 0; iT < nT; ++iT)
 	RTEST(result, T[3*iT], erfcx(T[3*iT+1]), T[3*iT+2]);
 
+    // Array function must reproduce scalar function:
+    {
+	double x[nT], y[nT];
+	for (int iT = 0; iT < nT; ++iT)
+	    x[iT] = T[3*iT+1];
+	erfcx_array(nT, x, y);
+	int nbad = 0;
+	for (int iT = 0; iT < nT; ++iT)
+	    if (y[iT] != erfcx(x[iT]))
+		++nbad;
+	rtest(&result, 0, nbad, 0, "erfcx_array");
+    }
+
     printf("%i/%i tests failed\n", result.failed, result.total);
     return result.failed ? 1 : 0;
 }
@@ -0,0 +1,71 @@
+/* Library libcerf:
+ *   Compute complex error functions, based on a new implementation of
+ *   Faddeeva's w_of_z. Also provide Dawson and Voigt functions.
+ *
+ * File inlinetest.c
+ *   Test the header-only functions from cerf_inline.h against the library.
+ *
+ * Copyright:
+ *   (C) 2026 Forschungszentrum Jülich GmbH
+ *
+ * Licence:
+ *   ../LICENSE
+ *
+ * Website:
+ *   http://apps.jcns.fz-juelich.de/libcerf
+ *
+ * Revision history:
+ *   ../CHANGELOG
+ *
+ * More information:
+ *   man 3 cerf_inline
+ */
+
+#include "cerf.h"
+#include "cerf_inline.h"
+#include "testtool.h"
+
+int main(void)
+{
+    result_t result = {0, 0};
+
+    // The library is built from the same kernels, so results must be identical.
+    // Arguments +-x from a logarithmic grid, covering all algorithms.
+    const int n = 2000;
+    for (int i = 0; i < n; ++i) {
+        const double ax = pow(10., -20. + i * 30. / (n - 1));
+        for (int s = -1; s <= 1; s += 2) {
+            const double x = s * ax;
+            char info[80];
+            snprintf(info, 80, "cerf_inline_erfcx(%g)", x);
+            rtest(&result, 0, cerf_inline_erfcx(x), erfcx(x), info);
+            snprintf(info, 80, "cerf_inline_im_w_of_x(%g)", x);
+            rtest(&result, 0, cerf_inline_im_w_of_x(x), im_w_of_x(x), info);
+            snprintf(info, 80, "cerf_inline_dawson(%g)", x);
+            rtest(&result, 0, cerf_inline_dawson(x), dawson(x), info);
+        }
+    }
+
+    // Special arguments.
+    RTEST(result, 0, cerf_inline_erfcx(0.), 1.);
+    RTEST(result, 0, cerf_inline_erfcx(Inf), 0.);
+    RTEST(result, 0, cerf_inline_erfcx(-Inf), Inf);
+    RTEST(result, 0, cerf_inline_im_w_of_x(0.), 0.);
+    RTEST(result, 0, cerf_inline_dawson(Inf), 0.);
+    RTEST(result, 0, cerf_inline_dawson(-Inf), 0.);
+
+    // A loop the compiler may inline and vectorize.
+    double x[64], y[64];
+    for (int i = 0; i < 64; ++i)
+        x[i] = -3 + i * 0.25;
+    for (int i = 0; i < 64; ++i)
+        y[i] = cerf_inline_erfcx(x[i]);
+    for (int i = 0; i < 64; ++i) {
+        char info[80];
+        snprintf(info, 80, "cerf_inline_erfcx in loop, x=%g", x[i]);
+        rtest(&result, 0, y[i], erfcx(x[i]), info);
+    }
+
+    printf("%i/%i tests failed\n", result.failed, result.total);
+    return result.failed ? 1 : 0;
+}
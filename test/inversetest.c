@@ -0,0 +1,154 @@
+/* Library libcerf:
+ *   Compute complex error functions, based on a new implementation of
+ *   Faddeeva's w_of_z. Also provide Dawson and Voigt functions.
+ *
+ * File inversetest.c
+ *   Test the inverse functions erfcx_inv, erfc_inv, erf_inv.
+ *
+ * Copyright:
+ *   (C) 2026 Forschungszentrum Jülich GmbH
+ *
+ * Licence:
+ *   ../LICENSE
+ *
+ * Website:
+ *   http://apps.jcns.fz-juelich.de/libcerf
+ *
+ * Revision history:
+ *   ../CHANGELOG
+ *
+ * More information:
+ *   man 3 erf_inv
+ */
+
+#include "cerf.h"
+#include "testtool.h"
+
+// Arguments and expected values, evaluated with mpmath (mp.dps=50)
+static const double TX[][2] = {
+    {1e-300, 5.6418958354775627e+299},
+    {1e-10, 5641895835.4775627},
+    {0.001, 564.1886973222229},
+    {0.003, 188.06053587272649},
+    {0.1, 5.5545858925411286},
+    {0.5, 0.76907977106131421},
+    {0.9, 0.096278647767749621},
+    {1, 0.0},
+    {1.1, -0.082237098703542192},
+    {2, -0.51519807748248337},
+    {10, -1.2825423843925312},
+    {1000, -2.4929539521529003},
+    {1e6, -3.622480300538819},
+    {1e10, -4.7257490146422502},
+    {1e20, -6.7348759958384511},
+    {1e100, -15.151414525345303},
+    {1e300, -26.269419116487021},
+};
+static const double TC[][2] = {
+    {1e-320, 27.073153719853041},
+    {1e-300, 26.209469960516124},
+    {1e-100, 15.065574702592646},
+    {1e-10, 4.5728249673894853},
+    {0.01, 1.8213863677184497},
+    {0.3, 0.73286907795921687},
+    {0.49, 0.48812205051595882},
+    {0.5, 0.47693627620446987},
+    {0.7, 0.2724627147267544},
+    {1, 0.0},
+    {1.2, -0.17914345462129164},
+    {1.5, -0.47693627620446987},
+    {1.6, -0.59511608144999496},
+    {1.99, -1.8213863677184495},
+    {1.999999, -3.4589107372909471},
+};
+static const double TE[][2] = {
+    {1e-300, 8.8622692545275804e-301},
+    {1e-8, 8.8622692545275806e-9},
+    {0.1, 0.088855990494257692},
+    {0.3, 0.27246271472675435},
+    {0.5, 0.47693627620446987},
+    {0.75, 0.81341984759761854},
+    {0.9, 1.1630871536766742},
+    {0.999, 2.3267537655135245},
+    {0.999999999, 4.320005388105362},
+    {-0.2, -0.17914345462129169},
+    {-0.6, -0.59511608144999482},
+    {-0.99999, -3.1234132743415709},
+};
+
+int main(void)
+{
+    result_t result = {0, 0};
+
+    // Special cases
+    RTEST(result, 0, erfcx_inv(0), Inf);
+    RTEST(result, 0, erfcx_inv(Inf), -Inf);
+    RTEST(result, 0, erfcx_inv(1), 0.);
+    RTEST(result, 0, erfc_inv(0), Inf);
+    RTEST(result, 0, erfc_inv(2), -Inf);
+    RTEST(result, 0, erf_inv(1), Inf);
+    RTEST(result, 0, erf_inv(-1), -Inf);
+    RTEST(result, 0, erf_inv(0), 0.);
+    RTEST(result, 0, erfcx_inv(-1), NaN);
+    RTEST(result, 0, erfc_inv(-.1), NaN);
+    RTEST(result, 0, erfc_inv(2.1), NaN);
+    RTEST(result, 0, erf_inv(1.1), NaN);
+
+    // Cases from tables
+    for (size_t i = 0; i < sizeof(TX) / sizeof(TX[0]); ++i) {
+        char info[80];
+        snprintf(info, 80, "erfcx_inv(%g)", TX[i][0]);
+#if defined(CERF_ESTRIN) || defined(CERF_UNIFORM)
+        // Near y=1, erfcx_inv is ill-conditioned: one ulp of erfcx shifts x by more than 1e-15.
+        const double limit = fabs(TX[i][0] - 1) < .2 ? 2e-15 : 1e-15;
+#else
+        const double limit = 1e-15;
+#endif
+        rtest(&result, limit, erfcx_inv(TX[i][0]), TX[i][1], info);
+    }
+    for (size_t i = 0; i < sizeof(TC) / sizeof(TC[0]); ++i) {
+        char info[80];
+        snprintf(info, 80, "erfc_inv(%g)", TC[i][0]);
+        rtest(&result, 1e-15, erfc_inv(TC[i][0]), TC[i][1], info);
+    }
+    for (size_t i = 0; i < sizeof(TE) / sizeof(TE[0]); ++i) {
+        char info[80];
+        snprintf(info, 80, "erf_inv(%g)", TE[i][0]);
+        rtest(&result, 1e-15, erf_inv(TE[i][0]), TE[i][1], info);
+    }
+
+    // Round trip erfcx(erfcx_inv(y)) across all tabulated subranges, and array versions
+    enum { N = 1000 };
+    static double y[N], x[N], x2[N];
+    for (int i = 0; i < N; ++i)
+        y[i] = pow(2., -12 + 36. * i / N);
+    erfcx_inv_array(N, y, x);
+    int nbad = 0;
+    for (int i = 0; i < N; ++i) {
+        if (x[i] != erfcx_inv(y[i]))
+            ++nbad;
+        // tolerance accounts for rounding of x, and for the inaccuracy of erfcx itself
+        const double dy = fabs(2 * x[i] * y[i] - 1.1283791670955126) * fabs(x[i]);
+        if (fabs(erfcx(x[i]) - y[i]) > 4e-16 * (y[i] + dy))
+            ++nbad;
+    }
+    rtest(&result, 0, nbad, 0, "erfcx_inv round trip and array");
+
+    for (int i = 0; i < N; ++i)
+        y[i] = 2. * i / (N - 1);
+    erfc_inv_array(N, y, x);
+    nbad = 0;
+    for (int i = 0; i < N; ++i)
+        if (x[i] != erfc_inv(y[i]))
+            ++nbad;
+    for (int i = 0; i < N; ++i)
+        y[i] -= 1;
+    erf_inv_array(N, y, x2);
+    for (int i = 0; i < N; ++i)
+        if (x2[i] != erf_inv(y[i]))
+            ++nbad;
+    rtest(&result, 0, nbad, 0, "erfc_inv and erf_inv array");
+
+    printf("%i/%i tests failed\n", result.failed, result.total);
+    return result.failed ? 1 : 0;
+}
@@ -0,0 +1,90 @@
+/* Library libcerf:
+ *   Compute complex error functions, based on a new implementation of
+ *   Faddeeva's w_of_z. Also provide Dawson and Voigt functions.
+ *
+ * File logerfctest.c
+ *   Test the log-domain functions log_erfc and log_ndtr.
+ *
+ * Copyright:
+ *   (C) 2026 Forschungszentrum Jülich GmbH
+ *
+ * Licence:
+ *   ../LICENSE
+ *
+ * Website:
+ *   http://apps.jcns.fz-juelich.de/libcerf
+ *
+ * Revision history:
+ *   ../CHANGELOG
+ *
+ * More information:
+ *   man 3 log_erfc
+ */
+
+#include "cerf.h"
+#include "testtool.h"
+
+// Arguments x and expected values log(erfc(x)), log(Phi(x)), evaluated with mpmath (mp.dps=60)
+static const double Tab[][3] = {
+    {-1e8, 0.69314718055994531, -5000000000000019.3},
+    {-3e4, 0.69314718055994531, -450000011.22789119},
+    {-100, 0.69314718055994531, -5005.5242086942051},
+    {-27, 0.69314718055994531, -368.71614246865635},
+    {-10, 0.69314718055994531, -53.231285150512471},
+    {-3, 0.69313613525044681, -6.6077262215103495},
+    {-1, 0.61123231767807049, -1.8410216450092635},
+    {-0.5, 0.41903914777555958, -1.1759117615936186},
+    {-1e-3, 0.0011277426501148765, -0.69394538346696518},
+    {-1e-20, 1.1283791670955126e-20, -0.69314718055994531},
+    {0, 0.0, -0.69314718055994531},
+    {1e-20, -1.1283791670955126e-20, -0.69314718055994531},
+    {1e-8, -1.1283791734617103e-8, -0.69314717258109973},
+    {0.1, -0.1193049737373956, -0.61650501011502629},
+    {0.49, -0.71676031143688046, -0.37406375598343361},
+    {0.5, -0.7350111298370844, -0.36894641528865639},
+    {0.7, -1.1325865135143413, -0.27702394227713124},
+    {1, -1.8496055099332482, -0.17275377902344989},
+    {2, -5.3649412646166376, -0.023012909328963488},
+    {5, -27.200889545537434, -2.8665161296376359e-7},
+    {10, -102.87988902484489, -7.6198530241605261e-24},
+    {26, -679.83119976319423, -2.4760633155033893e-149},
+    {30, -903.97411711064388, -4.9067139271481871e-198},
+    {100, -10005.177585122664, 0.0},
+    {1e4, -100000009.78270532, 0.0},
+    {1e8, -10000000000000019.0, 0.0},
+};
+
+int main(void)
+{
+    result_t result = {0, 0};
+    const int n = sizeof(Tab) / sizeof(Tab[0]);
+
+    // Special cases
+    RTEST(result, 0, log_erfc(-Inf), log(2.));
+    RTEST(result, 0, log_erfc(+Inf), -Inf);
+    RTEST(result, 0, log_ndtr(-Inf), -Inf);
+    RTEST(result, 0, log_ndtr(+Inf), 0.);
+
+    // Cases from table
+    for (int i = 0; i < n; ++i) {
+        char info[80];
+        snprintf(info, 80, "log_erfc(%g)", Tab[i][0]);
+        rtest(&result, 4e-16, log_erfc(Tab[i][0]), Tab[i][1], info);
+        snprintf(info, 80, "log_ndtr(%g)", Tab[i][0]);
+        rtest(&result, 4e-16, log_ndtr(Tab[i][0]), Tab[i][2], info);
+    }
+
+    // Array functions must reproduce scalar functions
+    double x[sizeof(Tab) / sizeof(Tab[0])], y[sizeof(Tab) / sizeof(Tab[0])];
+    for (int i = 0; i < n; ++i)
+        x[i] = Tab[i][0];
+    log_erfc_array(n, x, y);
+    for (int i = 0; i < n; ++i)
+        RTEST(result, 0, y[i], log_erfc(x[i]));
+    log_ndtr_array(n, x, y);
+    for (int i = 0; i < n; ++i)
+        RTEST(result, 0, y[i], log_ndtr(x[i]));
+
+    printf("%i/%i tests failed\n", result.failed, result.total);
+    return result.failed ? 1 : 0;
+}
@@ -0,0 +1,90 @@
+/* Library libcerf:
+ *   Compute complex error functions, based on a new implementation of
+ *   Faddeeva's w_of_z. Also provide Dawson and Voigt functions.
+ *
+ * File millstest.c
+ *   Test mills_ratio, inv_mills_ratio, normal_tail.
+ *
+ * Copyright:
+ *   (C) 2026 Forschungszentrum Jülich GmbH
+ *
+ * Licence:
+ *   ../LICENSE
+ *
+ * Website:
+ *   http://apps.jcns.fz-juelich.de/libcerf
+ *
+ * Revision history:
+ *   ../CHANGELOG
+ *
+ * More information:
+ *   man 3 mills_ratio
+ */
+
+#include "cerf.h"
+#include "testtool.h"
+
+// Arguments x and expected values (1-Phi(x))/phi(x), phi(x)/(1-Phi(x)), 1-Phi(x),
+// evaluated with mpmath (mp.dps=60)
+static const double Tab[][4] = {
+    {-37, 4.7169665550365805e+297, 2.1200065515246056e-298, 1.0},
+    {-30, 6.7858896130611187e+195, 1.4736461348785475e-196, 1.0},
+    {-10, 1.2996129473592023e+22, 7.6945986267064193e-23, 1.0},
+    {-3, 225.33489622034912, 0.0044378390421256638, 0.99865010196836991},
+    {-1, 3.4770518117036945, 0.28759997093917836, 0.84134474606854295},
+    {-0.3, 1.6201656087067893, 0.61722085361273444, 0.61791142218895264},
+    {-1e-10, 1.2533141374155003, 0.79788456073920338, 0.50000000003989423},
+    {0, 1.2533141373155003, 0.79788456080286536, 0.5},
+    {1e-10, 1.2533141372155003, 0.79788456086652733, 0.49999999996010577},
+    {0.3, 1.0018374009921557, 0.99816596885848333, 0.38208857781104736},
+    {1, 0.65567954241879847, 1.5251352761609812, 0.15865525393145705},
+    {3, 0.3045902987101033, 3.2830986549304365, 0.0013498980316300945},
+    {10, 0.099028596471731921, 10.098093233962512, 7.6198530241605261e-24},
+    {30, 0.033296419072497213, 30.033259667433677, 4.9067139271481871e-198},
+    {37, 0.027007327965128336, 37.02698768612699, 5.7255712225245768e-300},
+    {100, 0.0099990002998501049, 100.00999800099926, 0.0},
+    {1e4, 9.999999900000003e-5, 10000.000099999998, 0.0},
+    {1e8, 9.999999999999999e-9, 100000000.00000001, 0.0},
+};
+
+int main(void)
+{
+    result_t result = {0, 0};
+    const int n = sizeof(Tab) / sizeof(Tab[0]);
+
+    // Special cases
+    RTEST(result, 0, mills_ratio(-Inf), Inf);
+    RTEST(result, 0, mills_ratio(+Inf), 0.);
+    RTEST(result, 0, inv_mills_ratio(-Inf), 0.);
+    RTEST(result, 0, inv_mills_ratio(+Inf), Inf);
+    RTEST(result, 0, normal_tail(-Inf), 1.);
+    RTEST(result, 0, normal_tail(+Inf), 0.);
+
+    // Cases from table
+    for (int i = 0; i < n; ++i) {
+        char info[80];
+        snprintf(info, 80, "mills_ratio(%g)", Tab[i][0]);
+        rtest(&result, 1e-15, mills_ratio(Tab[i][0]), Tab[i][1], info);
+        snprintf(info, 80, "inv_mills_ratio(%g)", Tab[i][0]);
+        rtest(&result, 1e-15, inv_mills_ratio(Tab[i][0]), Tab[i][2], info);
+        snprintf(info, 80, "normal_tail(%g)", Tab[i][0]);
+        rtest(&result, 1e-15, normal_tail(Tab[i][0]), Tab[i][3], info);
+    }
+
+    // Array functions must reproduce scalar functions
+    double x[sizeof(Tab) / sizeof(Tab[0])], y[sizeof(Tab) / sizeof(Tab[0])];
+    for (int i = 0; i < n; ++i)
+        x[i] = Tab[i][0];
+    mills_ratio_array(n, x, y);
+    for (int i = 0; i < n; ++i)
+        RTEST(result, 0, y[i], mills_ratio(x[i]));
+    inv_mills_ratio_array(n, x, y);
+    for (int i = 0; i < n; ++i)
+        RTEST(result, 0, y[i], inv_mills_ratio(x[i]));
+    normal_tail_array(n, x, y);
+    for (int i = 0; i < n; ++i)
+        RTEST(result, 0, y[i], normal_tail(x[i]));
+
+    printf("%i/%i tests failed\n", result.failed, result.total);
+    return result.failed ? 1 : 0;
+}
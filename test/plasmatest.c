@@ -0,0 +1,106 @@
+/* Library libcerf:
+ *   Compute complex error functions, based on a new implementation of
+ *   Faddeeva's w_of_z. Also provide Dawson and Voigt functions.
+ *
+ * File plasmatest.c
+ *   Test the plasma dispersion function Z and its derivative Z'.
+ *
+ * Copyright:
+ *   (C) 2026 Forschungszentrum Jülich GmbH
+ *
+ * Licence:
+ *   ../LICENSE
+ *
+ * Website:
+ *   http://apps.jcns.fz-juelich.de/libcerf
+ *
+ * Revision history:
+ *   ../CHANGELOG
+ *
+ * More information:
+ *   man 3 plasma_z
+ */
+
+#include "cerf.h"
+#include "testtool.h"
+
+// Arguments and expected values Z(zeta), Z'(zeta), evaluated with mpmath (mp.dps=50)
+static const double Tab[][6] = {
+    {0, 0, 0.0, 1.772453850905516, -2.0, 0.0},
+    {0.5, 0.1, -0.72400202611759277, 1.2718911569498227, -1.0216197424924427, -1.1270907517263042},
+    {1, 1, -0.36905845884906658, 0.54014504014875573, -0.18159300200435538, -0.34217316259937828},
+    {2, -1, -0.26029456996831756, -0.36393011610645513, -0.23096148791381951, 0.93513132448918541},
+    {-1.5, 0.3, 0.69420858525118767, 0.30816830250434542, 0.26752673725617025, 0.50797975636232366},
+    {3, -0.5, -0.34213407169538439, -0.066360879733000442, 0.1191653099053068, 0.056031206702618257},
+    {0, 2, 0.0, 0.45267704998117458, -0.18929180007530168, 0.0},
+    {0, -2, 0.0, 193.09272550714609, -774.37090202858437, 0.0},
+    {7.5, 0.2, -0.13445146106417736, 0.0036520953902509711, 0.018232754118760764,
+     -0.0010008464280936206},
+    {8, 0.5, -0.12548992871104527, 0.0079702027495499506, 0.015809062126274233,
+     -0.0020333152817539426},
+    {10, 0, -0.10050769437519706, 6.5936629893592268e-44, 0.010153887503941121,
+     -1.3187325978718454e-42},
+    {-12, 0.001, 0.083625752316891936, 7.018069741472976e-6, 0.0070180696415459377,
+     1.1821691615675485e-6},
+    {20, -1, -0.049937107116294662, -0.0025031209500758646, 0.002490526551938229,
+     0.00025062377044526097},
+    {30, 5, -0.032448087801195409, 0.0054138763094236002, 0.0010240311659605679,
+     -0.00035170055346192048},
+    {100, 1, -0.0099994998749712436, 0.00010000499974963729, 9.9984993747986921e-5,
+     -2.000199984970979e-6},
+    {-300, -200, 0.0023076902593241039, -0.0015384720073072998, 2.9585173822640896e-6,
+     -7.1006547383363995e-6},
+    {1e4, 1e2, -9.9990001499600092e-5, 9.9990002499400152e-7, 9.9970006497800652e-9,
+     -1.9996001199620116e-10},
+    {0, 50, 0.0, 0.019996002397603354, -0.00039976023966460347, 0.0},
+    {0.001, 0.001, -0.0019964577589627247, 1.7704538535686399, -1.9964550993773448,
+     -0.0035369147916193545},
+    {5, -5, 0.83112304499463555, 3.3197468930893702, -43.508699380840057, -24.886238480947346},
+};
+
+int main(void)
+{
+    result_t result = {0, 0};
+    const int n = sizeof(Tab) / sizeof(Tab[0]);
+
+    for (int i = 0; i < n; ++i) {
+        const _cerf_cmplx zeta = C(Tab[i][0], Tab[i][1]);
+        char info[80];
+        snprintf(info, 80, "plasma_z(%g%+gi)", Tab[i][0], Tab[i][1]);
+        ztest(&result, 1e-13, plasma_z(zeta), C(Tab[i][2], Tab[i][3]), info);
+        snprintf(info, 80, "plasma_zprime(%g%+gi)", Tab[i][0], Tab[i][1]);
+        ztest(&result, 1e-13, plasma_zprime(zeta), C(Tab[i][4], Tab[i][5]), info);
+    }
+
+    // The fused array function must reproduce the scalar functions exactly.
+    double zr[sizeof(Tab) / sizeof(Tab[0])], zi[sizeof(Tab) / sizeof(Tab[0])];
+    double Zr[sizeof(Tab) / sizeof(Tab[0])], Zi[sizeof(Tab) / sizeof(Tab[0])];
+    double Pr[sizeof(Tab) / sizeof(Tab[0])], Pi[sizeof(Tab) / sizeof(Tab[0])];
+    for (int i = 0; i < n; ++i) {
+        zr[i] = Tab[i][0];
+        zi[i] = Tab[i][1];
+    }
+    plasma_z_zprime_array(n, zr, zi, Zr, Zi, Pr, Pi);
+    for (int i = 0; i < n; ++i) {
+        const _cerf_cmplx zeta = C(zr[i], zi[i]);
+        char info[80];
+        snprintf(info, 80, "plasma_z_zprime_array, Z(%g%+gi)", zr[i], zi[i]);
+        ztest(&result, 0, C(Zr[i], Zi[i]), plasma_z(zeta), info);
+        snprintf(info, 80, "plasma_z_zprime_array, Z'(%g%+gi)", zr[i], zi[i]);
+        ztest(&result, 1e-15, C(Pr[i], Pi[i]), plasma_zprime(zeta), info);
+    }
+
+    // Continuity of Z' across the switch to the asymptotic expansion at |zeta| = 8.
+    for (int i = 0; i < 16; ++i) {
+        const double phi = 0.2 * i;
+        const double c = cos(phi), s = sin(phi);
+        const _cerf_cmplx below = plasma_zprime(C(8 * c * (1 - 1e-15), 8 * s * (1 - 1e-15)));
+        const _cerf_cmplx above = plasma_zprime(C(8 * c, 8 * s));
+        char info[80];
+        snprintf(info, 80, "plasma_zprime continuity at phi=%g", phi);
+        ztest2(&result, 1e-13, 1e-10, above, below, info);
+    }
+
+    printf("%i/%i tests failed\n", result.failed, result.total);
+    return result.failed ? 1 : 0;
+}
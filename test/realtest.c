@@ -68,9 +68,31 @@ int main(void)
     real_tests(&result, "erf", cerf, erf, 1e-300, 1e300);
     real_tests(&result, "erfi", cerfi, erfi, 1e-300, 1e300);
     real_tests(&result, "erfc", cerfc, erfc, 1e-300, 1e300);
+    real_tests(&result, "erf_real", cerf, erf_real, 1e-300, 1e300);
+    real_tests(&result, "erfc_real", cerfc, erfc_real, 1e-300, 1e300);
     real_tests(&result, "erfcx", cerfcx, erfcx, 1e-300, 1e300);
     real_tests(&result, "dawson", cdawson, dawson, 1e-300, 1e150);
 
+    // Library-native real functions must agree with those from the C library,
+    // and array versions must reproduce scalar versions.
+    {
+        enum { N = 2000 };
+        static double x[N], f[N], g[N];
+        for (int i = 0; i < N; ++i)
+            x[i] = -30 + 60. * i / (N - 1);
+        erf_real_array(N, x, f);
+        erfc_real_array(N, x, g);
+        for (int i = 0; i < N; ++i) {
+            char info[30];
+            snprintf(info, 30, "erf_real(%g)", x[i]);
+            rtest(&result, 1e-15, f[i], erf(x[i]), info);
+            rtest(&result, 0, f[i], erf_real(x[i]), info);
+            snprintf(info, 30, "erfc_real(%g)", x[i]);
+            rtest(&result, 1e-14, g[i], erfc(x[i]), info);
+            rtest(&result, 0, g[i], erfc_real(x[i]), info);
+        }
+    }
+
     printf("%i/%i tests failed\n", result.failed, result.total);
     return result.failed;
 }
@@ -0,0 +1,90 @@
+/* Library libcerf:
+ *   Compute complex error functions, based on a new implementation of
+ *   Faddeeva's w_of_z. Also provide Dawson and Voigt functions.
+ *
+ * File roottest.c
+ *   Test the root finders cerf_roots_halley and cerf_roots_scan.
+ *
+ * Copyright:
+ *   (C) 2026 Forschungszentrum Jülich GmbH
+ *
+ * Licence:
+ *   ../LICENSE
+ *
+ * Website:
+ *   http://apps.jcns.fz-juelich.de/libcerf
+ *
+ * Revision history:
+ *   ../CHANGELOG
+ *
+ * More information:
+ *   man 3 cerf_roots
+ */
+
+#include "cerf.h"
+#include "testtool.h"
+
+int main(void)
+{
+    result_t result = {0, 0};
+
+    // Kinetic dispersion relation 1 + k^2 + zeta*Z(zeta) = 0 for three values of k,
+    // one lane each, with expected roots evaluated with mpmath.findroot.
+    {
+        const double k[3] = {0.3, 0.5, 1.0};
+        const double expected[3][2] = {
+            {2.7337843718729779, -0.029746493638815101},
+            {2.0020482425992451, -0.21688303802187104},
+            {1.4466732041923934, -0.60198154037180689},
+        };
+        double param[3][4];
+        double zr[3], zi[3];
+        int status[3];
+        for (int i = 0; i < 3; ++i) {
+            param[i][0] = 1 + k[i] * k[i];
+            param[i][1] = 0;
+            param[i][2] = 1;
+            param[i][3] = 0;
+            zr[i] = sqrt(1.5 + 1 / (k[i] * k[i]) / 2); // Bohm-Gross estimate
+            zi[i] = 0;
+        }
+        const size_t nc = cerf_roots_halley(
+            3, cerf_rootfct_zZ, param, sizeof(param[0]), zr, zi, status, 1e-15, 50);
+        RTEST(result, 0, (double)nc, 3.);
+        for (int i = 0; i < 3; ++i) {
+            char info[80];
+            snprintf(info, 80, "cerf_roots_halley, k=%g", k[i]);
+            ztest(&result, 1e-13, C(zr[i], zi[i]), C(expected[i][0], expected[i][1]), info);
+        }
+    }
+
+    // The first zeros of w(z), located in the lower half plane.
+    {
+        const double param[4] = {0, 0, 1, 0};
+        double zr[8], zi[8];
+        const size_t n = cerf_roots_scan(cerf_rootfct_w, param, 0, 3.5, -3, -0.5, 8, zr, zi);
+        RTEST(result, 0, (double)n, 3.);
+        const double expected[3][2] = {
+            {1.9914668428338796, -1.3548101281120062},
+            {2.6911490242514388, -2.1770449060896159},
+            {3.2353308683528165, -2.7843876132304282},
+        };
+        for (int j = 0; j < 3; ++j) {
+            // Roots may be returned in any order.
+            int found = 0;
+            for (size_t i = 0; i < n && i < 8; ++i)
+                if (fabs(zr[i] - expected[j][0]) < 1e-12 && fabs(zi[i] - expected[j][1]) < 1e-12)
+                    found = 1;
+            char info[80];
+            snprintf(info, 80, "cerf_roots_scan, zero %i of w(z)", j);
+            rtest(&result, 0, found, 1, info);
+        }
+
+        // No zeros in the upper half plane.
+        RTEST(result, 0,
+              (double)cerf_roots_scan(cerf_rootfct_w, param, -4, 4, 0.1, 4, 8, zr, zi), 0.);
+    }
+
+    printf("%i/%i tests failed\n", result.failed, result.total);
+    return result.failed ? 1 : 0;
+}
@@ -0,0 +1,101 @@
+/* Library libcerf:
+ *   Compute complex error functions, based on a new implementation of
+ *   Faddeeva's w_of_z. Also provide Dawson and Voigt functions.
+ *
+ * File templatetest.cpp
+ *   Test the C++ interface from cerf.hpp against the C interface.
+ *
+ * Copyright:
+ *   (C) 2026 Forschungszentrum Jülich GmbH
+ *
+ * Licence:
+ *   ../LICENSE
+ *
+ * Website:
+ *   http://apps.jcns.fz-juelich.de/libcerf
+ *
+ * Revision history:
+ *   ../CHANGELOG
+ *
+ * More information:
+ *   man 3 cerf_cpp
+ */
+
+#include "cerf.hpp"
+#include <cstdio>
+#include <vector>
+#ifdef __cpp_lib_ranges
+#  include <span>
+#endif
+
+static int failed = 0;
+static int total = 0;
+
+static void check(bool ok, const char* name, double x)
+{
+    ++total;
+    if (!ok) {
+        std::printf("failure in subtest %i: %s, x=%g\n", total, name, x);
+        ++failed;
+    }
+}
+
+int main()
+{
+    const int n = 200;
+    std::vector<double> x(n);
+    std::vector<float> xf(n);
+    std::vector<std::complex<double>> z(n);
+    std::vector<std::complex<float>> zf(n);
+    for (int i = 0; i < n; ++i) {
+        x[i] = -8 + 16. * i / (n - 1);
+        xf[i] = static_cast<float>(x[i]);
+        z[i] = std::complex<double>(x[i], 0.3 * x[i] - 1);
+        zf[i] = std::complex<float>(z[i]);
+    }
+
+    // Scalar templates: double must reproduce the C functions exactly,
+    // float must return the correctly rounded double result.
+    for (int i = 0; i < n; ++i) {
+        check(libcerf::erfcx(x[i]) == erfcx(x[i]), "erfcx<double>", x[i]);
+        check(libcerf::im_w_of_x(x[i]) == im_w_of_x(x[i]), "im_w_of_x<double>", x[i]);
+        check(libcerf::dawson(x[i]) == dawson(x[i]), "dawson<double>", x[i]);
+        check(libcerf::erfcx(xf[i]) == static_cast<float>(erfcx(xf[i])), "erfcx<float>", x[i]);
+        check(libcerf::dawson(xf[i]) == static_cast<float>(dawson(xf[i])), "dawson<float>", x[i]);
+        check(libcerf::w_of_z(z[i]) == w_of_z(z[i]), "w_of_z<double>", x[i]);
+        const std::complex<double> w = w_of_z(std::complex<double>(zf[i]));
+        check(libcerf::w_of_z(zf[i]) == std::complex<float>(w), "w_of_z<float>", x[i]);
+        check(libcerf::cerf(z[i]) == cerf(z[i]), "cerf<double>", x[i]);
+        check(libcerf::plasma_z(z[i]) == plasma_z(z[i]), "plasma_z<double>", x[i]);
+    }
+
+    // Batch versions for pointer ranges.
+    std::vector<double> r(n);
+    std::vector<std::complex<float>> wf(n);
+    libcerf::erfcx(n, x.data(), r.data());
+    libcerf::w_of_z(n, zf.data(), wf.data());
+    for (int i = 0; i < n; ++i) {
+        check(r[i] == erfcx(x[i]), "erfcx batch", x[i]);
+        check(wf[i] == libcerf::w_of_z(zf[i]), "w_of_z batch", x[i]);
+    }
+
+#ifdef __cpp_lib_ranges
+    // Batch versions for contiguous ranges: containers, and spans also as temporaries.
+    std::vector<std::complex<double>> w(n);
+    libcerf::dawson(x, r);
+    libcerf::w_of_z(z, w);
+    for (int i = 0; i < n; ++i) {
+        check(r[i] == dawson(x[i]), "dawson range", x[i]);
+        check(w[i] == w_of_z(z[i]), "w_of_z range", x[i]);
+    }
+    libcerf::erfcx(std::span<const double>(x).first(n / 2), std::span<double>(r));
+    libcerf::cerf(std::span(z), std::span(w));
+    for (int i = 0; i < n; ++i) {
+        check(r[i] == (i < n / 2 ? erfcx(x[i]) : dawson(x[i])), "erfcx span", x[i]);
+        check(w[i] == cerf(z[i]), "cerf span", x[i]);
+    }
+#endif
+
+    std::printf("%i/%i tests failed\n", failed, total);
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,98 @@
+/* Library libcerf:
+ *   Compute complex error functions, based on a new implementation of
+ *   Faddeeva's w_of_z. Also provide Dawson and Voigt functions.
+ *
+ * File uniformtest.c
+ *   Test the uniform table path for erfcx and im_w_of_x from cerf_inline.h.
+ *
+ * Copyright:
+ *   (C) 2026 Forschungszentrum Jülich GmbH
+ *
+ * Licence:
+ *   ../LICENSE
+ *
+ * Website:
+ *   http://apps.jcns.fz-juelich.de/libcerf
+ *
+ * Revision history:
+ *   ../CHANGELOG
+ *
+ * More information:
+ *   man 3 cerf_inline
+ */
+
+#include "cerf.h"
+#include "cerf_inline.h"
+#include "testtool.h"
+
+int main(void)
+{
+    result_t result = {0, 0};
+
+    // The uniform path uses other interpolants than the library (unless built with
+    // CERF_UNIFORM), so results may differ by a few epsilon.
+    // Arguments +-x from a logarithmic grid, covering all tabulated octaves and beyond.
+    const int n = 3000;
+    for (int i = 0; i < n; ++i) {
+        const double ax = pow(10., -20. + i * 30. / (n - 1));
+        for (int s = -1; s <= 1; s += 2) {
+            const double x = s * ax;
+            char info[80];
+            if (x > -5) { // beyond, the error is dominated by exp(x^2)
+                snprintf(info, 80, "cerf_inline_erfcx_uniform(%g)", x);
+                rtest(&result, 5e-16, cerf_inline_erfcx_uniform(x), erfcx(x), info);
+            }
+            snprintf(info, 80, "cerf_inline_im_w_of_x_uniform(%g)", x);
+            rtest(&result, 5e-16, cerf_inline_im_w_of_x_uniform(x), im_w_of_x(x), info);
+        }
+    }
+
+    // Subrange boundaries, from both sides.
+    for (int j = -3; j <= 6; ++j) {
+        for (int k = 0; k <= 64; ++k) {
+            const double x0 = ldexp(1 + k / 64., j);
+            const double xx[2] = {nextafter(x0, 0), x0};
+            for (int l = 0; l < 2; ++l) {
+                char info[80];
+                snprintf(info, 80, "cerf_inline_erfcx_uniform(%.17g)", xx[l]);
+                rtest(&result, 5e-16, cerf_inline_erfcx_uniform(xx[l]), erfcx(xx[l]), info);
+                snprintf(info, 80, "cerf_inline_im_w_of_x_uniform(%.17g)", xx[l]);
+                rtest(&result, 5e-16, cerf_inline_im_w_of_x_uniform(xx[l]), im_w_of_x(xx[l]), info);
+            }
+        }
+    }
+
+    // Special arguments.
+    RTEST(result, 0, cerf_inline_erfcx_uniform(0.), 1.);
+    RTEST(result, 0, cerf_inline_erfcx_uniform(1e-300), 1.);
+    RTEST(result, 0, cerf_inline_erfcx_uniform(Inf), 0.);
+    RTEST(result, 0, cerf_inline_erfcx_uniform(-Inf), Inf);
+    RTEST(result, 0, cerf_inline_erfcx_uniform(-30.), Inf);
+    RTEST(result, 0, cerf_inline_erfcx_uniform(NaN), NaN);
+    RTEST(result, 1e-15, cerf_inline_erfcx_uniform(1e300), 0.56418958354775629e-300);
+    RTEST(result, 0, cerf_inline_im_w_of_x_uniform(0.), 0.);
+    RTEST(result, 1e-15, cerf_inline_im_w_of_x_uniform(1e-300), 1.1283791670955126e-300);
+    RTEST(result, 1e-15, cerf_inline_im_w_of_x_uniform(-1e-300), -1.1283791670955126e-300);
+    RTEST(result, 1e-15, cerf_inline_im_w_of_x_uniform(1e300), 0.56418958354775629e-300);
+    RTEST(result, 0, cerf_inline_im_w_of_x_uniform(Inf), 0.);
+    RTEST(result, 0, cerf_inline_im_w_of_x_uniform(-Inf), 0.);
+    RTEST(result, 0, cerf_inline_im_w_of_x_uniform(NaN), NaN);
+
+    // The array version must agree with the scalar function, also when called in place.
+    enum { M = 1000 };
+    static double x[M], y[M];
+    for (int i = 0; i < M; ++i)
+        x[i] = -30 + 60. * i / M;
+    erfcx_array(M, x, y);
+    erfcx_array(M, x, x);
+    int nbad = 0;
+    for (int i = 0; i < M; ++i) {
+        const double expected = erfcx(-30 + 60. * i / M);
+        if (!(y[i] == expected) || !(x[i] == expected))
+            ++nbad;
+    }
+    rtest(&result, 0, nbad, 0, "erfcx_array against erfcx");
+
+    printf("%i/%i tests failed\n", result.failed, result.total);
+    return result.failed ? 1 : 0;
+}
@@ -0,0 +1,94 @@
+/* Library libcerf:
+ *   Compute complex error functions, based on a new implementation of
+ *   Faddeeva's w_of_z. Also provide Dawson and Voigt functions.
+ *
+ * File wofzarraytest.c
+ *   Test w_of_z_array with both engines against w_of_z.
+ *
+ * Copyright:
+ *   (C) 2026 Forschungszentrum Jülich GmbH
+ *
+ * Licence:
+ *   ../LICENSE
+ *
+ * Website:
+ *   http://apps.jcns.fz-juelich.de/libcerf
+ *
+ * Revision history:
+ *   ../CHANGELOG
+ *
+ * More information:
+ *   man 3 w_of_z
+ */
+
+#include "cerf.h"
+#include "testtool.h"
+
+const double errBound = 1e-13; // as in wofztest
+
+enum { M = 4 * 4000 + 4 * 2 * 600 + 12 };
+static double zr[M], zi[M], wr[M], wi[M];
+
+int main(void)
+{
+    result_t result = {0, 0};
+
+    // Arguments in all four quadrants: a polar grid with logarithmic radii,
+    // plus points close to the axes, plus special values.
+    int n = 0;
+    for (int i = 0; i < 4000; ++i) {
+        const double r = pow(10., -3 + 8. * (i / 40) / 99);
+        const double phi = 1.5707963267948966 * (i % 40 + .5) / 40;
+        for (int q = 0; q < 4; ++q) {
+            zr[n] = (q & 1 ? -1 : 1) * r * cos(phi);
+            zi[n] = (q & 2 ? -1 : 1) * r * sin(phi);
+            ++n;
+        }
+    }
+    for (int i = 0; i < 600; ++i) {
+        const double r = pow(10., -2 + 4. * (i / 20) / 29);
+        const double eps = pow(10., -12 + 10. * (i % 20) / 19);
+        for (int q = 0; q < 4; ++q) {
+            const double sx = q & 1 ? -1 : 1, sy = q & 2 ? -1 : 1;
+            zr[n] = sx * r;
+            zi[n] = sy * r * eps;
+            ++n;
+            zr[n] = sx * r * eps;
+            zi[n] = sy * r;
+            ++n;
+        }
+    }
+    const double special[12][2] = {
+        {0, 0}, {-0., 0}, {0, -0.}, {1, 0}, {0, 1}, {0, -1},
+        {Inf, 0}, {0, Inf}, {-Inf, 1}, {1, -Inf}, {NaN, 0}, {1e300, 1e300}};
+    for (int i = 0; i < 12; ++i) {
+        zr[n] = special[i][0];
+        zi[n] = special[i][1];
+        ++n;
+    }
+
+    for (int engine = CERF_W_DEFAULT; engine <= CERF_W_RATIONAL; ++engine) {
+        w_of_z_array(n, zr, zi, wr, wi, engine);
+        for (int i = 0; i < n; ++i) {
+            char info[80];
+            snprintf(info, 80, "w_of_z_array(%.17g%+.17gi), engine %i", zr[i], zi[i], engine);
+            ztest(&result, errBound, C(wr[i], wi[i]), w_of_z(C(zr[i], zi[i])), info);
+        }
+    }
+
+    // In-place computation.
+    const int m = 1000;
+    for (int i = 0; i < m; ++i) {
+        wr[i] = zr[i];
+        wi[i] = zi[i];
+    }
+    w_of_z_array(m, wr, wi, wr, wi, CERF_W_RATIONAL);
+    for (int i = 0; i < m; ++i) {
+        char info[80];
+        snprintf(info, 80, "w_of_z_array in place (%.17g%+.17gi)", zr[i], zi[i]);
+        ztest(&result, errBound, C(wr[i], wi[i]), w_of_z(C(zr[i], zi[i])), info);
+    }
+
+    printf("%i/%i tests failed\n", result.failed, result.total);
+    return result.failed ? 1 : 0;
+}
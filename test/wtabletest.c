@@ -0,0 +1,116 @@
+/* Library libcerf:
+ *   Compute complex error functions, based on a new implementation of
+ *   Faddeeva's w_of_z. Also provide Dawson and Voigt functions.
+ *
+ * File wtabletest.c
+ *   Test the table interpolation w_of_z_table.
+ *
+ * Copyright:
+ *   (C) 2026 Forschungszentrum Jülich GmbH
+ *
+ * Licence:
+ *   ../LICENSE
+ *
+ * Website:
+ *   http://apps.jcns.fz-juelich.de/libcerf
+ *
+ * Revision history:
+ *   ../CHANGELOG
+ *
+ * More information:
+ *   man 3 w_of_z_table
+ */
+
+#include "cerf.h"
+#include "testtool.h"
+#include <stdlib.h>
+
+static const char* fname = "wtabletest.tmp";
+
+//! Returns number of z on a polar grid in r0 < |z| < r1 for which w_of_z_table deviates
+//! by more than limit.
+static int count_bad(double limit, double r0, double r1)
+{
+    int nbad = 0;
+    for (int i = 0; i < 2000; ++i) {
+        const double r = r0 + (r1 - r0) * (i / 40 + .5) / 50;
+        const double phi = 6.283185307179586 * (i % 40 + .5) / 40;
+        const _cerf_cmplx z = C(r * cos(phi), r * sin(phi));
+        const _cerf_cmplx w = w_of_z(z);
+        const _cerf_cmplx d = w_of_z_table(z) - w;
+        if (!(hypot(creal(d), cimag(d)) <= limit * hypot(creal(w), cimag(w))))
+            ++nbad;
+    }
+    return nbad;
+}
+
+int main(void)
+{
+    result_t result = {0, 0};
+
+    // Coarse grid, small domain, to keep the test fast.
+    double errbound = 0;
+    rtest(&result, 0, cerf_w_table_write(fname, 16, 4, 3, &errbound), 0, "cerf_w_table_write");
+    rtest(&result, 0, errbound < 1e-6, 1, "interpolation error bound");
+
+    rtest(&result, 0, cerf_w_table_open("nonexisting.tmp", 1), -1, "open nonexisting file");
+    rtest(&result, 0, cerf_w_table_open(fname, errbound / 2), -3, "open with too low bound");
+    rtest(&result, 0, cerf_w_table_open(fname, errbound), 0, "open table");
+
+    // Within the grid (also x < 0), and beyond the grid or y < 0, where w_of_z is used.
+    rtest(&result, 0, count_bad(errbound, 0, 3), 0, "w_of_z_table within grid");
+    rtest(&result, 0, count_bad(0, 5, 20), 0, "w_of_z_table beyond grid");
+    ZTEST(result, 0, w_of_z_table(C(4, 1)), w_of_z(C(4, 1)));
+    ZTEST(result, 0, w_of_z_table(C(1, -1e-3)), w_of_z(C(1, -1e-3)));
+    ZTEST(result, 0, w_of_z_table(C(NaN, 1)), w_of_z(C(NaN, 1)));
+    ZTEST(result, 1e-15, w_of_z_table(C(0, 0)), C(1, 0));
+    ZTEST(result, 1e-15, w_of_z_table(C(-2, 1)), conj(w_of_z_table(C(2, 1))));
+
+    // Array version.
+    enum { M = 100 };
+    double zr[M], zi[M], wr[M], wi[M];
+    int nbad = 0;
+    for (int i = 0; i < M; ++i) {
+        zr[i] = -5 + .1 * i;
+        zi[i] = -1 + .05 * i;
+    }
+    w_of_z_array(M, zr, zi, wr, wi, CERF_W_TABLE);
+    for (int i = 0; i < M; ++i) {
+        const _cerf_cmplx w = w_of_z_table(C(zr[i], zi[i]));
+        if (!(wr[i] == creal(w) && wi[i] == cimag(w)))
+            ++nbad;
+    }
+    rtest(&result, 0, nbad, 0, "w_of_z_array with CERF_W_TABLE");
+
+    // Without table, w_of_z_table is w_of_z.
+    cerf_w_table_close();
+    ZTEST(result, 0, w_of_z_table(C(1, 1)), w_of_z(C(1, 1)));
+
+    // Grid spacing 1/3 is not a power of two; just below the upper edges, x/h rounds up
+    // to the last grid row or column.
+    rtest(&result, 0, cerf_w_table_write(fname, 3, 2, 1, &errbound), 0, "write ndiv=3");
+    rtest(&result, 0, cerf_w_table_open(fname, errbound), 0, "open ndiv=3");
+    nbad = 0;
+    for (int i = 0; i < 20; ++i) {
+        const double t = i / 19.;
+        const _cerf_cmplx z[2] = {C(nextafter(2, 0), t), C(2 * t, nextafter(1, 0))};
+        for (int k = 0; k < 2; ++k) {
+            const _cerf_cmplx w = w_of_z(z[k]);
+            const _cerf_cmplx d = w_of_z_table(z[k]) - w;
+            if (!(hypot(creal(d), cimag(d)) <= errbound * hypot(creal(w), cimag(w))))
+                ++nbad;
+        }
+    }
+    rtest(&result, 0, nbad, 0, "w_of_z_table at upper edges, ndiv=3");
+    cerf_w_table_close();
+
+    // Corrupted file.
+    FILE* f = fopen(fname, "r+b");
+    fputc('X', f);
+    fclose(f);
+    rtest(&result, 0, cerf_w_table_open(fname, 1), -2, "open corrupted file");
+    remove(fname);
+
+    printf("%i/%i tests failed\n", result.failed, result.total);
+    return result.failed ? 1 : 0;
+}